@@ -1,11 +1,36 @@
 dnl Checks for required headers and functions
 dnl
-dnl Version: 20190317
+dnl Version: 20261015
 
 dnl Function to detect if assorted tools dependencies are available
 AC_DEFUN([AX_ASSORTED_TOOLS_CHECK_LOCAL],
   [AC_CHECK_HEADERS([signal.h sys/signal.h math.h unistd.h])
 
+  dnl Headers and functions used by the memory mapped input
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h])
+  AC_CHECK_FUNCS([madvise mmap])
+
+  dnl Functions and members used by the checksum cache of the sum tools
+  AC_CHECK_FUNCS([fcntl fsync link mkstemp pwrite])
+  AC_CHECK_MEMBERS([struct stat.st_mtim.tv_nsec])
+
+  dnl Headers used by the asynchronous direct I/O of the tools
+  AC_CHECK_HEADERS([linux/io_uring.h])
+
+  dnl Headers used by the directory walk of multisum
+  AC_CHECK_HEADERS([dirent.h])
+
+  dnl Headers and functions used by the timer of checksumbench and decompressbench
+  AC_CHECK_HEADERS([time.h])
+  AC_CHECK_FUNCS([clock_gettime])
+
+  dnl Headers and functions used by the peak resident set size of decompressbench
+  AC_CHECK_HEADERS([sys/resource.h])
+  AC_CHECK_FUNCS([getrusage])
+
+  dnl Headers used by the hardware performance counters of the benchmarks
+  AC_CHECK_HEADERS([linux/perf_event.h])
+
   AC_CHECK_LIB(
     m,
     log,
@@ -19,3 +44,21 @@ AC_DEFUN([AX_ASSORTED_TOOLS_CHECK_LOCAL],
   AX_COMMON_CHECK_ENABLE_STATIC_EXECUTABLES
 ])
 
+dnl Function to detect whether decode statistics should be enabled
+AC_DEFUN([AX_ASSORTED_CHECK_ENABLE_DECODE_STATISTICS],
+  [AX_COMMON_ARG_ENABLE(
+    [decode-statistics],
+    [decode_statistics],
+    [enable decode statistics],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_decode_statistics" != xno ],
+    [AC_DEFINE(
+      [HAVE_DECODE_STATISTICS],
+      [1],
+      [Define to 1 if decode statistics should be maintained.])
+
+    ac_cv_enable_decode_statistics=yes])
+  ])
+
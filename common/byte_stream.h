@@ -219,6 +219,266 @@ typedef union byte_stream_float64
 	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
 	( byte_stream )[ 0 ] = (uint8_t) ( ( value ) & 0x0ff )
 
+/* The unaligned load and store helpers read and write a value with a single
+ * unaligned memory access on compilers that support it, otherwise the byte
+ * based copy macros are used. The value of a load must be an unsigned integer
+ * of the size of the load.
+ */
+#if defined( __GNUC__ ) && defined( __BYTE_ORDER__ ) && ( ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) || ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ ) )
+#define BYTE_STREAM_HAVE_UNALIGNED_ACCESS
+
+static __inline__ uint16_t byte_stream_load_uint16_unaligned(
+                            const uint8_t *byte_stream )
+{
+	uint16_t value = 0;
+
+	__builtin_memcpy( &value, byte_stream, 2 );
+
+	return( value );
+}
+
+static __inline__ uint32_t byte_stream_load_uint32_unaligned(
+                            const uint8_t *byte_stream )
+{
+	uint32_t value = 0;
+
+	__builtin_memcpy( &value, byte_stream, 4 );
+
+	return( value );
+}
+
+static __inline__ uint64_t byte_stream_load_uint64_unaligned(
+                            const uint8_t *byte_stream )
+{
+	uint64_t value = 0;
+
+	__builtin_memcpy( &value, byte_stream, 8 );
+
+	return( value );
+}
+
+static __inline__ void byte_stream_store_uint16_unaligned(
+                        uint8_t *byte_stream,
+                        uint16_t value )
+{
+	__builtin_memcpy( byte_stream, &value, 2 );
+}
+
+static __inline__ void byte_stream_store_uint32_unaligned(
+                        uint8_t *byte_stream,
+                        uint32_t value )
+{
+	__builtin_memcpy( byte_stream, &value, 4 );
+}
+
+static __inline__ void byte_stream_store_uint64_unaligned(
+                        uint8_t *byte_stream,
+                        uint64_t value )
+{
+	__builtin_memcpy( byte_stream, &value, 8 );
+}
+
+#define byte_stream_byte_swap_uint16( value ) \
+	__builtin_bswap16( value )
+
+#define byte_stream_byte_swap_uint32( value ) \
+	__builtin_bswap32( value )
+
+#define byte_stream_byte_swap_uint64( value ) \
+	__builtin_bswap64( value )
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define BYTE_STREAM_HOST_IS_LITTLE_ENDIAN
+#endif
+
+#elif defined( _MSC_VER ) && ( defined( _M_IX86 ) || defined( _M_X64 ) || defined( _M_ARM ) || defined( _M_ARM64 ) )
+#define BYTE_STREAM_HAVE_UNALIGNED_ACCESS
+
+#include <stdlib.h>
+#include <string.h>
+
+static __inline uint16_t byte_stream_load_uint16_unaligned(
+                          const uint8_t *byte_stream )
+{
+	uint16_t value = 0;
+
+	memcpy( &value, byte_stream, 2 );
+
+	return( value );
+}
+
+static __inline uint32_t byte_stream_load_uint32_unaligned(
+                          const uint8_t *byte_stream )
+{
+	uint32_t value = 0;
+
+	memcpy( &value, byte_stream, 4 );
+
+	return( value );
+}
+
+static __inline uint64_t byte_stream_load_uint64_unaligned(
+                          const uint8_t *byte_stream )
+{
+	uint64_t value = 0;
+
+	memcpy( &value, byte_stream, 8 );
+
+	return( value );
+}
+
+static __inline void byte_stream_store_uint16_unaligned(
+                      uint8_t *byte_stream,
+                      uint16_t value )
+{
+	memcpy( byte_stream, &value, 2 );
+}
+
+static __inline void byte_stream_store_uint32_unaligned(
+                      uint8_t *byte_stream,
+                      uint32_t value )
+{
+	memcpy( byte_stream, &value, 4 );
+}
+
+static __inline void byte_stream_store_uint64_unaligned(
+                      uint8_t *byte_stream,
+                      uint64_t value )
+{
+	memcpy( byte_stream, &value, 8 );
+}
+
+#define byte_stream_byte_swap_uint16( value ) \
+	_byteswap_ushort( value )
+
+#define byte_stream_byte_swap_uint32( value ) \
+	_byteswap_ulong( value )
+
+#define byte_stream_byte_swap_uint64( value ) \
+	_byteswap_uint64( value )
+
+/* All Windows targets supported by MSVC are little-endian
+ */
+#define BYTE_STREAM_HOST_IS_LITTLE_ENDIAN
+
+#endif /* defined( __GNUC__ ) && defined( __BYTE_ORDER__ ) */
+
+#if defined( BYTE_STREAM_HAVE_UNALIGNED_ACCESS ) && defined( BYTE_STREAM_HOST_IS_LITTLE_ENDIAN )
+
+#define byte_stream_load_uint16_big_endian( byte_stream, value ) \
+	( value ) = byte_stream_byte_swap_uint16( byte_stream_load_uint16_unaligned( byte_stream ) )
+
+#define byte_stream_load_uint16_little_endian( byte_stream, value ) \
+	( value ) = byte_stream_load_uint16_unaligned( byte_stream )
+
+#define byte_stream_load_uint32_big_endian( byte_stream, value ) \
+	( value ) = byte_stream_byte_swap_uint32( byte_stream_load_uint32_unaligned( byte_stream ) )
+
+#define byte_stream_load_uint32_little_endian( byte_stream, value ) \
+	( value ) = byte_stream_load_uint32_unaligned( byte_stream )
+
+#define byte_stream_load_uint64_big_endian( byte_stream, value ) \
+	( value ) = byte_stream_byte_swap_uint64( byte_stream_load_uint64_unaligned( byte_stream ) )
+
+#define byte_stream_load_uint64_little_endian( byte_stream, value ) \
+	( value ) = byte_stream_load_uint64_unaligned( byte_stream )
+
+#define byte_stream_store_uint16_big_endian( byte_stream, value ) \
+	byte_stream_store_uint16_unaligned( byte_stream, byte_stream_byte_swap_uint16( (uint16_t) ( value ) ) )
+
+#define byte_stream_store_uint16_little_endian( byte_stream, value ) \
+	byte_stream_store_uint16_unaligned( byte_stream, (uint16_t) ( value ) )
+
+#define byte_stream_store_uint32_big_endian( byte_stream, value ) \
+	byte_stream_store_uint32_unaligned( byte_stream, byte_stream_byte_swap_uint32( (uint32_t) ( value ) ) )
+
+#define byte_stream_store_uint32_little_endian( byte_stream, value ) \
+	byte_stream_store_uint32_unaligned( byte_stream, (uint32_t) ( value ) )
+
+#define byte_stream_store_uint64_big_endian( byte_stream, value ) \
+	byte_stream_store_uint64_unaligned( byte_stream, byte_stream_byte_swap_uint64( (uint64_t) ( value ) ) )
+
+#define byte_stream_store_uint64_little_endian( byte_stream, value ) \
+	byte_stream_store_uint64_unaligned( byte_stream, (uint64_t) ( value ) )
+
+#elif defined( BYTE_STREAM_HAVE_UNALIGNED_ACCESS )
+
+#define byte_stream_load_uint16_big_endian( byte_stream, value ) \
+	( value ) = byte_stream_load_uint16_unaligned( byte_stream )
+
+#define byte_stream_load_uint16_little_endian( byte_stream, value ) \
+	( value ) = byte_stream_byte_swap_uint16( byte_stream_load_uint16_unaligned( byte_stream ) )
+
+#define byte_stream_load_uint32_big_endian( byte_stream, value ) \
+	( value ) = byte_stream_load_uint32_unaligned( byte_stream )
+
+#define byte_stream_load_uint32_little_endian( byte_stream, value ) \
+	( value ) = byte_stream_byte_swap_uint32( byte_stream_load_uint32_unaligned( byte_stream ) )
+
+#define byte_stream_load_uint64_big_endian( byte_stream, value ) \
+	( value ) = byte_stream_load_uint64_unaligned( byte_stream )
+
+#define byte_stream_load_uint64_little_endian( byte_stream, value ) \
+	( value ) = byte_stream_byte_swap_uint64( byte_stream_load_uint64_unaligned( byte_stream ) )
+
+#define byte_stream_store_uint16_big_endian( byte_stream, value ) \
+	byte_stream_store_uint16_unaligned( byte_stream, (uint16_t) ( value ) )
+
+#define byte_stream_store_uint16_little_endian( byte_stream, value ) \
+	byte_stream_store_uint16_unaligned( byte_stream, byte_stream_byte_swap_uint16( (uint16_t) ( value ) ) )
+
+#define byte_stream_store_uint32_big_endian( byte_stream, value ) \
+	byte_stream_store_uint32_unaligned( byte_stream, (uint32_t) ( value ) )
+
+#define byte_stream_store_uint32_little_endian( byte_stream, value ) \
+	byte_stream_store_uint32_unaligned( byte_stream, byte_stream_byte_swap_uint32( (uint32_t) ( value ) ) )
+
+#define byte_stream_store_uint64_big_endian( byte_stream, value ) \
+	byte_stream_store_uint64_unaligned( byte_stream, (uint64_t) ( value ) )
+
+#define byte_stream_store_uint64_little_endian( byte_stream, value ) \
+	byte_stream_store_uint64_unaligned( byte_stream, byte_stream_byte_swap_uint64( (uint64_t) ( value ) ) )
+
+#else
+
+#define byte_stream_load_uint16_big_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint16_big_endian( byte_stream, value )
+
+#define byte_stream_load_uint16_little_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint16_little_endian( byte_stream, value )
+
+#define byte_stream_load_uint32_big_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint32_big_endian( byte_stream, value )
+
+#define byte_stream_load_uint32_little_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint32_little_endian( byte_stream, value )
+
+#define byte_stream_load_uint64_big_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint64_big_endian( byte_stream, value )
+
+#define byte_stream_load_uint64_little_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint64_little_endian( byte_stream, value )
+
+#define byte_stream_store_uint16_big_endian( byte_stream, value ) \
+	byte_stream_copy_from_uint16_big_endian( byte_stream, value )
+
+#define byte_stream_store_uint16_little_endian( byte_stream, value ) \
+	byte_stream_copy_from_uint16_little_endian( byte_stream, value )
+
+#define byte_stream_store_uint32_big_endian( byte_stream, value ) \
+	byte_stream_copy_from_uint32_big_endian( byte_stream, value )
+
+#define byte_stream_store_uint32_little_endian( byte_stream, value ) \
+	byte_stream_copy_from_uint32_little_endian( byte_stream, value )
+
+#define byte_stream_store_uint64_big_endian( byte_stream, value ) \
+	byte_stream_copy_from_uint64_big_endian( byte_stream, value )
+
+#define byte_stream_store_uint64_little_endian( byte_stream, value ) \
+	byte_stream_copy_from_uint64_little_endian( byte_stream, value )
+
+#endif /* defined( BYTE_STREAM_HAVE_UNALIGNED_ACCESS ) && defined( BYTE_STREAM_HOST_IS_LITTLE_ENDIAN ) */
+
 #define byte_stream_bit_rotate_left_8bit( byte_stream, number_of_bits ) \
 	( ( ( byte_stream ) << ( number_of_bits ) ) | ( ( byte_stream ) >> ( 8 - ( number_of_bits ) ) ) )
 
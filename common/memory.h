@@ -114,6 +114,13 @@ extern "C" {
 	memcpy( (void *) destination, (void *) source, count )
 #endif
 
+/* Memory move
+ */
+#if defined( HAVE_MEMMOVE ) || defined( WINAPI )
+#define memory_move( destination, source, count ) \
+	memmove( (void *) destination, (void *) source, count )
+#endif
+
 /* Memory set
  */
 #if defined( HAVE_MEMSET ) || defined( WINAPI )
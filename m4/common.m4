@@ -371,7 +371,7 @@ AC_DEFUN([AX_COMMON_CHECK_LOCAL],
     ])
 
   dnl Memory functions used in common/memory.h
-  AC_CHECK_FUNCS([free malloc memcmp memcpy memset realloc])
+  AC_CHECK_FUNCS([free malloc memcmp memcpy memmove memset realloc])
 
   AS_IF(
     [test "x$ac_cv_func_free" != xyes],
@@ -401,6 +401,13 @@ AC_DEFUN([AX_COMMON_CHECK_LOCAL],
       [1])
     ])
 
+  AS_IF(
+    [test "x$ac_cv_func_memmove" != xyes],
+    [AC_MSG_FAILURE(
+      [Missing function: memmove],
+      [1])
+    ])
+
   AS_IF(
     [test "x$ac_cv_func_memset" != xyes],
     [AC_MSG_FAILURE(
@@ -24,6 +24,8 @@
 
 #include "../src/assorted_bzip.h"
 
+#include "ossfuzz_budget.h"
+
 /* Note that some of the OSS-Fuzz engines use C++
  */
 extern "C" {
@@ -35,13 +37,21 @@ int LLVMFuzzerTestOneInput(
 	uint8_t uncompressed_data[ 64 * 1024 ];
 
 	size_t uncompressed_data_size = 64 * 1024;
+	uint64_t start_time           = ossfuzz_budget_start();
 
+	/* The run-length encoding of BZip2 allows for an amplification of
+	 * millions, hence no amplification budget is applied
+	 */
 	assorted_bzip_decompress(
 	 data,
 	 size,
 	 uncompressed_data,
 	 &uncompressed_data_size,
 	 NULL );
+	ossfuzz_budget_check_time(
+	 "bzip_fuzzer",
+	 start_time,
+	 size + ( 64 * 1024 ) );
 
 	return( 0 );
 }
@@ -24,6 +24,8 @@
 
 #include "../src/assorted_deflate.h"
 
+#include "ossfuzz_budget.h"
+
 /* Note that some of the OSS-Fuzz engines use C++
  */
 extern "C" {
@@ -35,13 +37,27 @@ int LLVMFuzzerTestOneInput(
 	uint8_t uncompressed_data[ 64 * 1024 ];
 
 	size_t uncompressed_data_size = 64 * 1024;
+	uint64_t start_time           = ossfuzz_budget_start();
 
-	assorted_deflate_decompress_zlib(
-	 data,
-	 size,
-	 uncompressed_data,
-	 &uncompressed_data_size,
-	 NULL );
+	if( assorted_deflate_decompress_zlib(
+	     data,
+	     size,
+	     uncompressed_data,
+	     &uncompressed_data_size,
+	     NULL ) == 1 )
+	{
+		/* A DEFLATE match of 258 bytes is encoded in at least 2 bits
+		 */
+		ossfuzz_budget_check_amplification(
+		 "deflate_fuzzer",
+		 size,
+		 uncompressed_data_size,
+		 1032 );
+	}
+	ossfuzz_budget_check_time(
+	 "deflate_fuzzer",
+	 start_time,
+	 size + ( 64 * 1024 ) );
 
 	return( 0 );
 }
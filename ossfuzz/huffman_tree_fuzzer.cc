@@ -0,0 +1,184 @@
+/*
+ * OSS-Fuzz target for Huffman tree build functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../src/assorted_bit_stream.h"
+#include "../src/assorted_huffman_tree.h"
+
+#include "ossfuzz_budget.h"
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	uint8_t code_sizes[ 1024 ];
+	uint32_t frequencies[ 1024 ];
+
+	assorted_bit_stream_t *bit_stream     = NULL;
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	size_t data_offset                    = 0;
+	uint64_t start_time                   = ossfuzz_budget_start();
+	uint32_t number_of_decoded_symbols    = 0;
+	uint16_t symbol                       = 0;
+	uint8_t maximum_code_size             = 0;
+	int number_of_symbols                 = 0;
+	int symbol_index                      = 0;
+
+	if( size < 3 )
+	{
+		return( 0 );
+	}
+	/* Byte 0 contains the maximum code size in the lower 4 bits and
+	 * if the code sizes are built from frequencies in bit 7
+	 * Byte 1 - 2 contain the number of symbols
+	 */
+	maximum_code_size = data[ 0 ] & 0x0f;
+
+	if( maximum_code_size == 0 )
+	{
+		maximum_code_size = 15;
+	}
+	number_of_symbols = ( (int) data[ 2 ] << 8 ) | data[ 1 ];
+
+	if( ( number_of_symbols < 1 )
+	 || ( number_of_symbols > 1024 ) )
+	{
+		return( 0 );
+	}
+	data_offset = 3;
+
+	if( ( data[ 0 ] & 0x80 ) != 0 )
+	{
+		/* The frequencies are stored in 16-bit little-endian values
+		 */
+		for( symbol_index = 0;
+		     symbol_index < number_of_symbols;
+		     symbol_index++ )
+		{
+			if( ( data_offset + 1 ) < size )
+			{
+				frequencies[ symbol_index ] = ( (uint32_t) data[ data_offset + 1 ] << 8 ) | data[ data_offset ];
+
+				data_offset += 2;
+			}
+			else
+			{
+				frequencies[ symbol_index ] = 0;
+			}
+		}
+		if( assorted_huffman_tree_build_code_sizes(
+		     frequencies,
+		     number_of_symbols,
+		     maximum_code_size,
+		     code_sizes,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		/* The code sizes are stored in 4-bit values
+		 */
+		for( symbol_index = 0;
+		     symbol_index < number_of_symbols;
+		     symbol_index++ )
+		{
+			if( data_offset < size )
+			{
+				code_sizes[ symbol_index ] = data[ data_offset++ ] & 0x0f;
+			}
+			else
+			{
+				code_sizes[ symbol_index ] = 0;
+			}
+		}
+	}
+	if( assorted_huffman_tree_initialize(
+	     &huffman_tree,
+	     number_of_symbols,
+	     15,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( assorted_huffman_tree_build(
+	     huffman_tree,
+	     code_sizes,
+	     number_of_symbols,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The remaining data is decoded as a bit stream
+	 */
+	if( assorted_bit_stream_initialize(
+	     &bit_stream,
+	     data,
+	     size,
+	     data_offset,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	while( assorted_huffman_tree_get_symbol_from_bit_stream(
+	        huffman_tree,
+	        bit_stream,
+	        &symbol,
+	        NULL ) == 1 )
+	{
+		number_of_decoded_symbols++;
+
+		/* Every symbol consumes at least 1 bit
+		 */
+		ossfuzz_budget_check_amplification(
+		 "huffman_tree_fuzzer",
+		 ( size - data_offset ) * 8,
+		 number_of_decoded_symbols,
+		 1 );
+	}
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	assorted_huffman_tree_free(
+	 &huffman_tree,
+	 NULL );
+
+	ossfuzz_budget_check_time(
+	 "huffman_tree_fuzzer",
+	 start_time,
+	 size + ( (size_t) number_of_symbols * 16 ) );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
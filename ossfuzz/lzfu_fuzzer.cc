@@ -0,0 +1,81 @@
+/*
+ * OSS-Fuzz target for LZFu decompress function
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../src/assorted_lzfu.h"
+
+#include "ossfuzz_budget.h"
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	uint8_t uncompressed_data[ 64 * 1024 ];
+
+	size_t uncompressed_data_size = 0;
+	uint64_t start_time           = ossfuzz_budget_start();
+
+	/* The uncompressed data size in the header is claimed by the input,
+	 * hence it is limited to the size of the buffer as a caller should
+	 */
+	if( assorted_lzfu_get_uncompressed_data_size(
+	     data,
+	     size,
+	     &uncompressed_data_size,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( uncompressed_data_size > ( 64 * 1024 ) )
+	{
+		uncompressed_data_size = 64 * 1024;
+	}
+	if( assorted_lzfu_decompress(
+	     data,
+	     size,
+	     uncompressed_data,
+	     &uncompressed_data_size,
+	     NULL ) == 1 )
+	{
+		/* A 2-byte reference produces at most 17 bytes and every 8 items
+		 * are preceded by a flag byte
+		 */
+		ossfuzz_budget_check_amplification(
+		 "lzfu_fuzzer",
+		 size,
+		 uncompressed_data_size,
+		 9 );
+	}
+	ossfuzz_budget_check_time(
+	 "lzfu_fuzzer",
+	 start_time,
+	 size + ( 64 * 1024 ) );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
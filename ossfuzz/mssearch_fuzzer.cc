@@ -0,0 +1,126 @@
+/*
+ * OSS-Fuzz target for MSSearch decompress functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../src/assorted_mssearch.h"
+
+#include "ossfuzz_budget.h"
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	uint8_t compressed_data[ 64 * 1024 ];
+	uint8_t uncompressed_data[ 64 * 1024 ];
+
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	uint64_t start_time           = ossfuzz_budget_start();
+	uint8_t compression_type      = 0;
+
+	if( size < 1 )
+	{
+		return( 0 );
+	}
+	/* The first byte selects the compression type, the run-length and
+	 * byte-index functions modify the compressed data hence it is copied
+	 */
+	compression_type     = data[ 0 ] & 0x01;
+	compressed_data_size = size - 1;
+
+	if( compressed_data_size > ( 64 * 1024 ) )
+	{
+		compressed_data_size = 64 * 1024;
+	}
+	memcpy(
+	 compressed_data,
+	 &( data[ 1 ] ),
+	 compressed_data_size );
+
+	if( compression_type == 0 )
+	{
+		if( assorted_mssearch_get_run_length_uncompressed_utf16_string_size(
+		     compressed_data,
+		     compressed_data_size,
+		     &uncompressed_data_size,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		/* Every byte is expanded to an UTF-16 character
+		 */
+		ossfuzz_budget_check_amplification(
+		 "mssearch_fuzzer",
+		 compressed_data_size,
+		 uncompressed_data_size,
+		 2 );
+
+		if( uncompressed_data_size > ( 64 * 1024 ) )
+		{
+			uncompressed_data_size = 64 * 1024;
+		}
+		assorted_mssearch_decompress_run_length_compressed_utf16_string(
+		 uncompressed_data,
+		 uncompressed_data_size,
+		 compressed_data,
+		 compressed_data_size,
+		 NULL );
+	}
+	else
+	{
+		if( assorted_mssearch_get_byte_index_uncompressed_data_size(
+		     compressed_data,
+		     compressed_data_size,
+		     &uncompressed_data_size,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		/* The uncompressed data size is stored in 16 bits, hence no
+		 * amplification budget is applied
+		 */
+		if( uncompressed_data_size > ( 64 * 1024 ) )
+		{
+			uncompressed_data_size = 64 * 1024;
+		}
+		assorted_mssearch_decompress_byte_indexed_compressed_data(
+		 uncompressed_data,
+		 uncompressed_data_size,
+		 compressed_data,
+		 compressed_data_size,
+		 NULL );
+	}
+	ossfuzz_budget_check_time(
+	 "mssearch_fuzzer",
+	 start_time,
+	 size + ( 64 * 1024 ) );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
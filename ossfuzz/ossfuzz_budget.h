@@ -0,0 +1,106 @@
+/*
+ * Time and output amplification budgets of the OSS-Fuzz targets
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OSSFUZZ_BUDGET_H )
+#define _OSSFUZZ_BUDGET_H
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/assorted_timer.h"
+
+/* The time budget of an input consists of a base time and a time per byte of
+ * input and output, which is generous enough for sanitizer builds. An input
+ * that exceeds it indicates super-linear behavior, such as degenerate BWT
+ * chains, which would stall a worker on a larger input.
+ * Note that an input that never returns is caught by the libFuzzer -timeout
+ */
+#define OSSFUZZ_BUDGET_BASE_TIME		( (uint64_t) 250 * 1000000 )
+#define OSSFUZZ_BUDGET_TIME_PER_BYTE		( (uint64_t) 10 * 1000 )
+
+/* The number of bytes the output may exceed the maximum amplification of the input
+ */
+#define OSSFUZZ_BUDGET_AMPLIFICATION_SLACK	1024
+
+/* Retrieves the start time of an input
+ */
+static inline uint64_t ossfuzz_budget_start(
+                        void )
+{
+	return( assorted_timer_get_time() );
+}
+
+/* Reports a finding if the time budget of an input was exceeded
+ * The work size is the number of bytes read and written
+ */
+static inline void ossfuzz_budget_check_time(
+                    const char *name,
+                    uint64_t start_time,
+                    size_t work_size )
+{
+	uint64_t elapsed_time = assorted_timer_get_time() - start_time;
+	uint64_t time_budget  = OSSFUZZ_BUDGET_BASE_TIME + ( (uint64_t) work_size * OSSFUZZ_BUDGET_TIME_PER_BYTE );
+
+	if( elapsed_time > time_budget )
+	{
+		fprintf(
+		 stderr,
+		 "%s: time budget exceeded: %" PRIu64 " ns for %" PRIu64 " bytes of work, budget: %" PRIu64 " ns.\n",
+		 name,
+		 elapsed_time,
+		 (uint64_t) work_size,
+		 time_budget );
+
+		abort();
+	}
+}
+
+/* Reports a finding if the output size exceeds the maximum amplification of
+ * the input, which the format cannot produce and hence indicates that a
+ * decoder trusts a size claimed by the input
+ */
+static inline void ossfuzz_budget_check_amplification(
+                    const char *name,
+                    size_t input_size,
+                    size_t output_size,
+                    size_t maximum_amplification )
+{
+	uint64_t output_budget = ( (uint64_t) input_size * maximum_amplification ) + OSSFUZZ_BUDGET_AMPLIFICATION_SLACK;
+
+	if( (uint64_t) output_size > output_budget )
+	{
+		fprintf(
+		 stderr,
+		 "%s: output amplification budget exceeded: %" PRIu64 " bytes for %" PRIu64 " bytes of input, budget: %" PRIu64 " bytes.\n",
+		 name,
+		 (uint64_t) output_size,
+		 (uint64_t) input_size,
+		 output_budget );
+
+		abort();
+	}
+}
+
+#endif /* !defined( _OSSFUZZ_BUDGET_H ) */
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -30,38 +31,1774 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_dmg_block_table.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_libfmos.h"
+#include "assorted_libfplist.h"
+#include "assorted_memory_map.h"
 #include "assorted_output.h"
 #include "assorted_system_string.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+#define ADCDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The number of chunks that are decompressed per thread in a batch
+ */
+#define ADCDECOMPRESS_NUMBER_OF_CHUNKS_PER_THREAD	16
+
+/* The maximum uncompressed size of a chunk
+ */
+#define ADCDECOMPRESS_MAXIMUM_CHUNK_SIZE		( 64 * 1024 * 1024 )
+
+/* The size of the DMG file trailer (koly)
+ */
+#define ADCDECOMPRESS_DMG_TRAILER_SIZE			512
+
+typedef struct adcdecompress_task adcdecompress_task_t;
+
+struct adcdecompress_task
+{
+	/* The block table entry index
+	 */
+	uint32_t entry_index;
+
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data buffer, used if the source is not memory mapped
+	 */
+	uint8_t *compressed_data_buffer;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data offset in the destination
+	 */
+	off64_t uncompressed_data_offset;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+typedef struct adcdecompress_image adcdecompress_image_t;
+
+struct adcdecompress_image
+{
+	/* The source memory map
+	 */
+	assorted_memory_map_t *memory_map;
+
+	/* The source file, used if the source is not memory mapped
+	 */
+	libcfile_file_t *source_file;
+
+	/* The source size
+	 */
+	size64_t source_size;
+
+	/* The offset of the data fork in the source
+	 */
+	off64_t data_fork_offset;
+
+	/* The destination file
+	 */
+	libcfile_file_t *destination_file;
+
+	/* The destination size
+	 */
+	size64_t destination_size;
+
+	/* The tasks
+	 */
+	adcdecompress_task_t *tasks;
+
+	/* The maximum number of tasks in a batch
+	 */
+	int maximum_number_of_tasks;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The number of decompressed chunks
+	 */
+	int number_of_decompressed_chunks;
+
+	/* The number of failed chunks
+	 */
+	int number_of_failed_chunks;
+
+	/* Value to indicate if verbose output should be printed
+	 */
+	int verbose;
+};
 
 /* Prints the executable usage information
  */
-void usage_fprint(
-      FILE *stream )
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use adcdecompress to decompress data as ADC compressed data.\n\n" );
+
+	fprintf( stream, "Usage: adcdecompress [ -d size ] [ -m block_table ] [ -o offset ]\n"
+	                 "                     [ -j number_of_threads ] [ -s size ] [ -bhvV ]\n"
+	                 "                     source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-b:     decompress the ADC compressed chunks of a DMG image, the block\n"
+	                 "\t        tables (mish) are read from the property list of the image\n" );
+	fprintf( stream, "\t-d:     size of the decompressed data (default is 16 times the size\n"
+	                 "\t        of the data)).\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to decompress chunks with -b or -m\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-m:     decompress the ADC compressed chunks described by the block\n"
+	                 "\t        table (mish) stored in the file, the source contains the\n"
+	                 "\t        data fork of a DMG image\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0), with -m the offset of the data\n"
+	                 "\t        fork\n" );
+	fprintf( stream, "\t-p:     same as -j\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Retrieves data from the source
+ * If the source is memory mapped data points into the memory map otherwise
+ * the data is read into data buffer, which must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int adcdecompress_get_data(
+     adcdecompress_image_t *image,
+     off64_t offset,
+     size64_t size,
+     const uint8_t **data,
+     uint8_t **data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "adcdecompress_get_data";
+	ssize_t read_count    = 0;
+
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > image->source_size )
+	 || ( size > ( image->source_size - (size64_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range exceeds source size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( image->source_file == NULL )
+	{
+		*data = &( image->memory_map->data[ offset ] );
+
+		return( 1 );
+	}
+	*data_buffer = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * ( (size_t) size + 1 ) );
+
+	if( *data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_seek_offset(
+	     image->source_file,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              image->source_file,
+	              *data_buffer,
+	              (size_t) size,
+	              error );
+
+	if( read_count != (ssize_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	*data = *data_buffer;
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 *data_buffer );
+
+	*data_buffer = NULL;
+
+	return( -1 );
+}
+
+/* Writes data to the destination at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int adcdecompress_write_data(
+     adcdecompress_image_t *image,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "adcdecompress_write_data";
+	ssize_t write_count   = 0;
+
+	if( libcfile_file_seek_offset(
+	     image->destination_file,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in destination.",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	write_count = libcfile_file_write_buffer(
+	               image->destination_file,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data at offset: %" PRIi64 " to destination.",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses the ADC compressed chunk of a task
+ */
+void adcdecompress_task_decompress(
+      adcdecompress_task_t *task )
+{
+	size_t uncompressed_data_size = 0;
+
+	if( task == NULL )
+	{
+		return;
+	}
+	task->result = -1;
+
+	task->uncompressed_data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * task->uncompressed_data_size );
+
+	if( task->uncompressed_data == NULL )
+	{
+		return;
+	}
+	uncompressed_data_size = task->uncompressed_data_size;
+
+	if( libfmos_adc_decompress(
+	     task->compressed_data,
+	     task->compressed_data_size,
+	     task->uncompressed_data,
+	     &uncompressed_data_size,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+	/* A chunk must fill all the sectors it describes
+	 */
+	if( uncompressed_data_size != task->uncompressed_data_size )
+	{
+		return;
+	}
+	task->result = 1;
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the ADC compressed chunk of a task from a thread pool
+ * Returns 1 on success or -1 on error
+ */
+int adcdecompress_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	adcdecompress_task_decompress(
+	 (adcdecompress_task_t *) value );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses the chunks of the pending tasks and writes them to the destination
+ * The chunks are independent and are decompressed on a thread pool, the uncompressed
+ * data of every chunk is written at its own offset in the destination
+ * Returns 1 if successful or -1 on error
+ */
+int adcdecompress_decompress_tasks(
+     adcdecompress_image_t *image,
+     int number_of_tasks,
+     libcerror_error_t **error )
+{
+	adcdecompress_task_t *task             = NULL;
+	static char *function                  = "adcdecompress_decompress_tasks";
+	int task_index                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( image->number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = image->number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     image->number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &adcdecompress_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( image->tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		task = &( image->tasks[ task_index ] );
+
+		/* Without a thread pool the chunks are decompressed here
+		 */
+		if( task->result == 0 )
+		{
+			adcdecompress_task_decompress(
+			 task );
+		}
+		if( task->result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress chunk: %" PRIu32 " at offset: %" PRIi64 ".\n",
+			 task->entry_index,
+			 task->uncompressed_data_offset );
+
+			image->number_of_failed_chunks++;
+		}
+		else
+		{
+			if( adcdecompress_write_data(
+			     image,
+			     task->uncompressed_data_offset,
+			     task->uncompressed_data,
+			     task->uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write chunk: %" PRIu32 ".",
+				 function,
+				 task->entry_index );
+
+				goto on_error;
+			}
+			image->number_of_decompressed_chunks++;
+		}
+		if( task->uncompressed_data != NULL )
+		{
+			memory_free(
+			 task->uncompressed_data );
+
+			task->uncompressed_data = NULL;
+		}
+		if( task->compressed_data_buffer != NULL )
+		{
+			memory_free(
+			 task->compressed_data_buffer );
+
+			task->compressed_data_buffer = NULL;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( image->tasks[ task_index ].uncompressed_data != NULL )
+		{
+			memory_free(
+			 image->tasks[ task_index ].uncompressed_data );
+
+			image->tasks[ task_index ].uncompressed_data = NULL;
+		}
+		if( image->tasks[ task_index ].compressed_data_buffer != NULL )
+		{
+			memory_free(
+			 image->tasks[ task_index ].compressed_data_buffer );
+
+			image->tasks[ task_index ].compressed_data_buffer = NULL;
+		}
+	}
+	return( -1 );
+}
+
+/* Decompresses the chunks described by a block table (mish)
+ * ADC compressed chunks are decompressed in batches, raw chunks are copied and
+ * sparse chunks are not written, which leaves holes in a sparse destination
+ * Returns 1 if successful or -1 on error
+ */
+int adcdecompress_decompress_block_table(
+     adcdecompress_image_t *image,
+     const uint8_t *block_table_data,
+     size_t block_table_data_size,
+     libcerror_error_t **error )
+{
+	assorted_dmg_block_table_entry_t *entries = NULL;
+	adcdecompress_task_t *task                = NULL;
+	const uint8_t *data                       = NULL;
+	static char *function                     = "adcdecompress_decompress_block_table";
+	uint8_t *data_buffer                      = NULL;
+	size64_t end_offset                       = 0;
+	uint32_t entry_index                      = 0;
+	uint32_t number_of_entries                = 0;
+	int number_of_tasks                       = 0;
+
+	if( assorted_dmg_block_table_get_number_of_entries(
+	     block_table_data,
+	     block_table_data_size,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of block table entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	entries = (assorted_dmg_block_table_entry_t *) memory_allocate(
+	                                                sizeof( assorted_dmg_block_table_entry_t ) * number_of_entries );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block table entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_dmg_block_table_get_entries(
+	     block_table_data,
+	     block_table_data_size,
+	     entries,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block table entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( ( entries[ entry_index ].type == ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_COMMENT )
+		 || ( entries[ entry_index ].type == ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_TERMINATOR ) )
+		{
+			continue;
+		}
+		if( image->verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Chunk: %" PRIu32 " of type: 0x%08" PRIx32 " at offset: %" PRIi64 " of size: %" PRIu64 "\n",
+			 entry_index,
+			 entries[ entry_index ].type,
+			 entries[ entry_index ].uncompressed_data_offset,
+			 entries[ entry_index ].uncompressed_data_size );
+		}
+		end_offset = (size64_t) entries[ entry_index ].uncompressed_data_offset + entries[ entry_index ].uncompressed_data_size;
+
+		if( end_offset > image->destination_size )
+		{
+			image->destination_size = end_offset;
+		}
+		if( ( entries[ entry_index ].type == ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_SPARSE )
+		 || ( entries[ entry_index ].type == ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_IGNORE )
+		 || ( entries[ entry_index ].uncompressed_data_size == 0 ) )
+		{
+			continue;
+		}
+		if( ( entries[ entry_index ].type != ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_RAW )
+		 && ( entries[ entry_index ].type != ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_ADC ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported chunk: %" PRIu32 " type: 0x%08" PRIx32 ".\n",
+			 entry_index,
+			 entries[ entry_index ].type );
+
+			image->number_of_failed_chunks++;
+
+			continue;
+		}
+		if( ( entries[ entry_index ].uncompressed_data_size > (size64_t) ADCDECOMPRESS_MAXIMUM_CHUNK_SIZE )
+		 || ( entries[ entry_index ].compressed_data_offset > ( INT64_MAX - image->data_fork_offset ) ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid chunk: %" PRIu32 " value out of bounds.\n",
+			 entry_index );
+
+			image->number_of_failed_chunks++;
+
+			continue;
+		}
+		if( entries[ entry_index ].type == ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_RAW )
+		{
+			if( entries[ entry_index ].compressed_data_size != entries[ entry_index ].uncompressed_data_size )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid raw chunk: %" PRIu32 " size value mismatch.\n",
+				 entry_index );
+
+				image->number_of_failed_chunks++;
+
+				continue;
+			}
+			if( adcdecompress_get_data(
+			     image,
+			     image->data_fork_offset + entries[ entry_index ].compressed_data_offset,
+			     entries[ entry_index ].compressed_data_size,
+			     &data,
+			     &data_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu32 " data.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( adcdecompress_write_data(
+			     image,
+			     entries[ entry_index ].uncompressed_data_offset,
+			     data,
+			     (size_t) entries[ entry_index ].uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write chunk: %" PRIu32 ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( data_buffer != NULL )
+			{
+				memory_free(
+				 data_buffer );
+
+				data_buffer = NULL;
+			}
+			image->number_of_decompressed_chunks++;
+
+			continue;
+		}
+		task = &( image->tasks[ number_of_tasks ] );
+
+		task->entry_index              = entry_index;
+		task->compressed_data_size     = (size_t) entries[ entry_index ].compressed_data_size;
+		task->uncompressed_data_offset = entries[ entry_index ].uncompressed_data_offset;
+		task->uncompressed_data_size   = (size_t) entries[ entry_index ].uncompressed_data_size;
+		task->result                   = 0;
+
+		if( adcdecompress_get_data(
+		     image,
+		     image->data_fork_offset + entries[ entry_index ].compressed_data_offset,
+		     entries[ entry_index ].compressed_data_size,
+		     &( task->compressed_data ),
+		     &( task->compressed_data_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu32 " data.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		number_of_tasks++;
+
+		if( number_of_tasks == image->maximum_number_of_tasks )
+		{
+			if( adcdecompress_decompress_tasks(
+			     image,
+			     number_of_tasks,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress chunks.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_tasks = 0;
+		}
+	}
+	if( number_of_tasks > 0 )
+	{
+		if( adcdecompress_decompress_tasks(
+		     image,
+		     number_of_tasks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 entries );
+
+	return( 1 );
+
+on_error:
+	while( number_of_tasks > 0 )
+	{
+		number_of_tasks--;
+
+		if( image->tasks[ number_of_tasks ].compressed_data_buffer != NULL )
+		{
+			memory_free(
+			 image->tasks[ number_of_tasks ].compressed_data_buffer );
+
+			image->tasks[ number_of_tasks ].compressed_data_buffer = NULL;
+		}
+	}
+	if( data_buffer != NULL )
+	{
+		memory_free(
+		 data_buffer );
+	}
+	if( entries != NULL )
+	{
+		memory_free(
+		 entries );
+	}
+	return( -1 );
+}
+
+/* Decompresses the chunks of the block tables stored in the property list of a DMG image
+ * The property list is located by the file trailer (koly) at the end of the image and
+ * stores a block table in the "Data" value of every entry of resource-fork/blkx
+ * Returns 1 if successful or -1 on error
+ */
+int adcdecompress_decompress_image(
+     adcdecompress_image_t *image,
+     libcerror_error_t **error )
+{
+	libfplist_property_list_t *property_list = NULL;
+	libfplist_property_t *blkx_property      = NULL;
+	libfplist_property_t *data_property      = NULL;
+	libfplist_property_t *entry_property     = NULL;
+	libfplist_property_t *resource_property  = NULL;
+	libfplist_property_t *root_property      = NULL;
+	const uint8_t *data                      = NULL;
+	static char *function                    = "adcdecompress_decompress_image";
+	uint8_t *block_table_data                = NULL;
+	uint8_t *data_buffer                     = NULL;
+	size_t block_table_data_size             = 0;
+	uint64_t data_fork_offset                = 0;
+	uint64_t xml_plist_offset                = 0;
+	uint64_t xml_plist_size                  = 0;
+	int entry_index                          = 0;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+
+	if( image->source_size < ADCDECOMPRESS_DMG_TRAILER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( adcdecompress_get_data(
+	     image,
+	     (off64_t) ( image->source_size - ADCDECOMPRESS_DMG_TRAILER_SIZE ),
+	     ADCDECOMPRESS_DMG_TRAILER_SIZE,
+	     &data,
+	     &data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file trailer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     data,
+	     "koly",
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported file trailer signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 &( data[ 24 ] ),
+	 data_fork_offset );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( data[ 216 ] ),
+	 xml_plist_offset );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( data[ 224 ] ),
+	 xml_plist_size );
+
+	if( data_buffer != NULL )
+	{
+		memory_free(
+		 data_buffer );
+
+		data_buffer = NULL;
+	}
+	if( ( data_fork_offset > image->source_size )
+	 || ( xml_plist_offset > image->source_size )
+	 || ( xml_plist_size == 0 )
+	 || ( xml_plist_size > ( image->source_size - xml_plist_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data fork offset or property list range value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	image->data_fork_offset = (off64_t) data_fork_offset;
+
+	if( adcdecompress_get_data(
+	     image,
+	     (off64_t) xml_plist_offset,
+	     xml_plist_size,
+	     &data,
+	     &data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_initialize(
+	     &property_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_copy_from_byte_stream(
+	     property_list,
+	     data,
+	     (size_t) xml_plist_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy property list from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_buffer != NULL )
+	{
+		memory_free(
+		 data_buffer );
+
+		data_buffer = NULL;
+	}
+	if( libfplist_property_list_get_root_property(
+	     property_list,
+	     &root_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root property.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          root_property,
+	          (uint8_t *) "resource-fork",
+	          13,
+	          &resource_property,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libfplist_property_get_sub_property_by_utf8_name(
+		          resource_property,
+		          (uint8_t *) "blkx",
+		          4,
+		          &blkx_property,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource-fork/blkx property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_get_array_number_of_entries(
+	     blkx_property,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blkx entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libfplist_property_get_array_entry_by_index(
+		     blkx_property,
+		     entry_index,
+		     &entry_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve blkx entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfplist_property_get_sub_property_by_utf8_name(
+		     entry_property,
+		     (uint8_t *) "Data",
+		     4,
+		     &data_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve blkx entry: %d Data property.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfplist_property_get_value_data_size(
+		     data_property,
+		     &block_table_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve blkx entry: %d block table size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( block_table_data_size == 0 )
+		 || ( block_table_data_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid blkx entry: %d block table size value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		block_table_data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * block_table_data_size );
+
+		if( block_table_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block table data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfplist_property_get_value_data(
+		     data_property,
+		     block_table_data,
+		     block_table_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve blkx entry: %d block table.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( adcdecompress_decompress_block_table(
+		     image,
+		     block_table_data,
+		     block_table_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunks of blkx entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		memory_free(
+		 block_table_data );
+
+		block_table_data = NULL;
+
+		if( libfplist_property_free(
+		     &data_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Data property.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfplist_property_free(
+		     &entry_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blkx entry: %d property.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libfplist_property_free(
+	     &blkx_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free blkx property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_free(
+	     &resource_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource-fork property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_free(
+	     &root_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_free(
+	     &property_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free property list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block_table_data != NULL )
+	{
+		memory_free(
+		 block_table_data );
+	}
+	if( data_property != NULL )
+	{
+		libfplist_property_free(
+		 &data_property,
+		 NULL );
+	}
+	if( entry_property != NULL )
+	{
+		libfplist_property_free(
+		 &entry_property,
+		 NULL );
+	}
+	if( blkx_property != NULL )
+	{
+		libfplist_property_free(
+		 &blkx_property,
+		 NULL );
+	}
+	if( resource_property != NULL )
+	{
+		libfplist_property_free(
+		 &resource_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	if( data_buffer != NULL )
+	{
+		memory_free(
+		 data_buffer );
+	}
+	return( -1 );
+}
+
+/* Decompresses the chunks of a DMG image into a sparse destination
+ * The block table is read from block table file if set, otherwise the block tables
+ * are read from the property list of the DMG image
+ * Returns 1 if successful, 0 if one or more chunks could not be decompressed or -1 on error
+ */
+int adcdecompress_decompress_chunks(
+     const system_character_t *source,
+     const system_character_t *block_table_file,
+     const char *destination,
+     off64_t data_fork_offset,
+     int number_of_threads,
+     int verbose,
+     libcerror_error_t **error )
 {
-	if( stream == NULL )
+	adcdecompress_image_t image;
+
+	libcfile_file_t *block_table_source = NULL;
+	static char *function               = "adcdecompress_decompress_chunks";
+	uint8_t *block_table_data           = NULL;
+	size64_t block_table_data_size      = 0;
+	ssize_t read_count                  = 0;
+	int result                          = 0;
+
+	if( memory_set(
+	     &image,
+	     0,
+	     sizeof( adcdecompress_image_t ) ) == NULL )
 	{
-		return;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear image.",
+		 function );
+
+		return( -1 );
 	}
-	fprintf( stream, "Use adcdecompress to decompress data as ADC compressed data.\n\n" );
+	image.data_fork_offset        = data_fork_offset;
+	image.number_of_threads       = number_of_threads;
+	image.maximum_number_of_tasks = number_of_threads * ADCDECOMPRESS_NUMBER_OF_CHUNKS_PER_THREAD;
+	image.verbose                 = verbose;
 
-	fprintf( stream, "Usage: adcdecompress [ -d size ] [ -o offset ] [ -s size ] [ -hvV ]\n"
-	                 "       source\n\n" );
+	if( block_table_file != NULL )
+	{
+		if( libcfile_file_initialize(
+		     &block_table_source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block table file.",
+			 function );
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          block_table_source,
+		          block_table_file,
+		          LIBCFILE_OPEN_READ,
+		          error );
+#else
+		result = libcfile_file_open(
+		          block_table_source,
+		          block_table_file,
+		          LIBCFILE_OPEN_READ,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open block table file.",
+			 function );
 
-	fprintf( stream, "\t-d:     size of the decompressed data (default is 16 times the size\n"
-	                 "\t        of the data)).\n" );
-	fprintf( stream, "\t-h:     shows this help\n" );
-	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
-	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
-	fprintf( stream, "\t-v:     verbose output to stderr\n" );
-	fprintf( stream, "\t-V:     print version\n" );
-	fprintf( stream, "\n" );
+			goto on_error;
+		}
+		if( libcfile_file_get_size(
+		     block_table_source,
+		     &block_table_data_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of block table file.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( block_table_data_size == 0 )
+		 || ( block_table_data_size > (size64_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block table file size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		block_table_data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * (size_t) block_table_data_size );
+
+		if( block_table_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block table data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+		              block_table_source,
+		              block_table_data,
+		              (size_t) block_table_data_size,
+		              error );
+
+		if( read_count != (ssize_t) block_table_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block table file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcfile_file_close(
+		     block_table_source,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close block table file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &block_table_source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block table file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The source stays open for all chunks, it is memory mapped if supported
+	 * otherwise the data of every chunk is read
+	 */
+	if( assorted_memory_map_initialize(
+	     &( image.memory_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	result = assorted_memory_map_open(
+	          image.memory_map,
+	          source,
+	          0,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open memory map.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		image.source_size = (size64_t) image.memory_map->data_size;
+	}
+	else
+	{
+		if( libcfile_file_initialize(
+		     &( image.source_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create source file.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          image.source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          error );
+#else
+		result = libcfile_file_open(
+		          image.source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open source file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcfile_file_get_size(
+		     image.source_file,
+		     &( image.source_size ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of source file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	image.tasks = (adcdecompress_task_t *) memory_allocate(
+	                                        sizeof( adcdecompress_task_t ) * image.maximum_number_of_tasks );
+
+	if( image.tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     image.tasks,
+	     0,
+	     sizeof( adcdecompress_task_t ) * image.maximum_number_of_tasks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &( image.destination_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_open(
+	     image.destination_file,
+	     destination,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open destination file: %s.",
+		 function,
+		 destination );
+
+		goto on_error;
+	}
+	if( block_table_data != NULL )
+	{
+		result = adcdecompress_decompress_block_table(
+		          &image,
+		          block_table_data,
+		          (size_t) block_table_data_size,
+		          error );
+	}
+	else
+	{
+		result = adcdecompress_decompress_image(
+		          &image,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress chunks.",
+		 function );
+
+		goto on_error;
+	}
+	/* Sparse chunks at the end of the image are not written
+	 */
+	if( libcfile_file_resize(
+	     image.destination_file,
+	     image.destination_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize destination file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     image.destination_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close destination file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &( image.destination_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination file.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Decompressed %d chunks into an image of %" PRIu64 " bytes.\n",
+	 image.number_of_decompressed_chunks,
+	 image.destination_size );
+
+	memory_free(
+	 image.tasks );
+
+	image.tasks = NULL;
+
+	if( image.source_file != NULL )
+	{
+		if( libcfile_file_close(
+		     image.source_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &( image.source_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( assorted_memory_map_free(
+	     &( image.memory_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( block_table_data != NULL )
+	{
+		memory_free(
+		 block_table_data );
+	}
+	if( image.number_of_failed_chunks > 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( image.destination_file != NULL )
+	{
+		libcfile_file_free(
+		 &( image.destination_file ),
+		 NULL );
+	}
+	if( image.tasks != NULL )
+	{
+		memory_free(
+		 image.tasks );
+	}
+	if( image.source_file != NULL )
+	{
+		libcfile_file_free(
+		 &( image.source_file ),
+		 NULL );
+	}
+	if( image.memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &( image.memory_map ),
+		 NULL );
+	}
+	if( block_table_data != NULL )
+	{
+		memory_free(
+		 block_table_data );
+	}
+	if( block_table_source != NULL )
+	{
+		libcfile_file_free(
+		 &block_table_source,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* The main program
@@ -77,6 +1814,7 @@ int main( int argc, char * const argv[] )
 	libcerror_error_t *error          = NULL;
 	libcfile_file_t *destination_file = NULL;
 	libcfile_file_t *source_file      = NULL;
+	system_character_t *block_table   = NULL;
 	system_character_t *source        = NULL;
 	uint8_t *buffer                   = NULL;
 	uint8_t *uncompressed_data        = NULL;
@@ -87,6 +1825,8 @@ int main( int argc, char * const argv[] )
 	ssize_t read_count                = 0;
 	ssize_t write_count               = 0;
 	off_t source_offset               = 0;
+	int dmg_image                     = 0;
+	int number_of_threads             = 1;
 	int print_count                   = 0;
 	int result                        = 0;
 	int verbose                       = 0;
@@ -98,7 +1838,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "d:ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "bd:hj:m:o:p:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -114,6 +1854,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				dmg_image = 1;
+
+				break;
+
 			case (system_integer_t) 'd':
 				uncompressed_data_size = system_string_copy_to_long( optarg );
 
@@ -125,11 +1870,22 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case 'm':
+				block_table = optarg;
+
+				break;
+
 			case 'o':
 				source_offset = system_string_copy_to_long( optarg );
 
 				break;
 
+			case 'j':
+			case 'p':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
 			case 's':
 				source_size = system_string_copy_to_long( optarg );
 
@@ -160,12 +1916,78 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > ADCDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( ( dmg_image != 0 )
+	 || ( block_table != NULL ) )
+	{
+		print_count = narrow_string_snprintf(
+		               destination,
+		               128,
+		               "%s.adcdecompressed",
+		               source );
+
+		if( ( print_count < 0 )
+		 || ( print_count > 128 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set destination filename.\n" );
+
+			goto on_error;
+		}
+		/* The -b option takes precedence, since the block tables and
+		 * the data fork offset are then read from the image
+		 */
+		if( dmg_image != 0 )
+		{
+			block_table = NULL;
+		}
+		result = adcdecompress_decompress_chunks(
+		          source,
+		          block_table,
+		          destination,
+		          (off64_t) source_offset,
+		          number_of_threads,
+		          verbose,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress chunks.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "ADC decompression:\tFAILURE\n" );
+
+			return( EXIT_FAILURE );
+		}
+		fprintf(
+		 stdout,
+		 "ADC decompression:\tSUCCESS\n" );
+
+		return( EXIT_SUCCESS );
+	}
+
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
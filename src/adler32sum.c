@@ -35,11 +35,20 @@
 #endif
 
 #include "assorted_adler32.h"
+#include "assorted_async_file.h"
+#include "assorted_checksum_cache.h"
+#include "assorted_cpu_features.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_memory_map.h"
 #include "assorted_output.h"
+#include "assorted_system_string.h"
+
+/* The size of the chunks the source file is read in
+ */
+#define ADLER32SUM_CHUNK_SIZE	( 4 * 1024 * 1024 )
 
 /* Prints the executable usage information
  */
@@ -52,18 +61,26 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use adler32sum to calculate an Adler-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: adler32sum [ -i initial_value ] [ -o offset ] [ -s size ]\n"
-	                 "                  [ -12345hvV ] source\n\n" );
+	fprintf( stream, "Usage: adler32sum [ -C cache_file ] [ -i initial_value ] [ -m features_mask ]\n"
+	                 "                  [ -o offset ] [ -s size ] [ -12345AhMvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the basic calculation method\n" );
-	fprintf( stream, "\t-2:     use the unfolded calculation method (default)\n" );
+	fprintf( stream, "\t-2:     use the unfolded calculation method\n" );
 	fprintf( stream, "\t-3:     use the cpu-aligned calculation method\n" );
-	fprintf( stream, "\t-4:     use the SIMD calculation method\n" );
+	fprintf( stream, "\t-4:     use the fastest SIMD calculation method supported by\n"
+	                 "\t        the CPU (default), which is AVX2, SSSE3 or NEON\n" );
 	fprintf( stream, "\t-5:     use the zlib calculation method\n" );
+	fprintf( stream, "\t-A:     use asynchronous direct I/O instead of reading the source file\n" );
+	fprintf( stream, "\t-C:     use the checksum cache file, where the checksum of data of\n"
+	                 "\t        an unchanged file is retrieved instead of calculated\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial Adler-32 (default is 0)\n" );
+	fprintf( stream, "\t-m:     mask of the CPU features used by the fastest calculation\n"
+	                 "\t        method, where 0 only uses portable code, intended for\n"
+	                 "\t        benchmarking (default is all supported CPU features)\n" );
+	fprintf( stream, "\t-M:     use memory mapped input instead of reading the source file\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
@@ -79,20 +96,34 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "adler32sum";
-	system_integer_t option      = 0;
-	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
-	off_t source_offset          = 0;
-	uint32_t checksum_value      = 0;
-	uint32_t initial_value       = 0;
-	int calculation_method       = 2;
-	int result                   = 0;
-	int verbose                  = 0;
+	assorted_checksum_cache_key_t checksum_cache_key;
+
+	assorted_checksum_cache_t *checksum_cache = NULL;
+	libcerror_error_t *error                  = NULL;
+	libcfile_file_t *source_file              = NULL;
+	assorted_async_file_t *async_file         = NULL;
+	assorted_memory_map_t *memory_map         = NULL;
+	system_character_t *cache_filename        = NULL;
+	system_character_t *source                = NULL;
+	const uint8_t *chunk_data                 = NULL;
+	uint8_t *buffer                           = NULL;
+	char *program                             = "adler32sum";
+	system_integer_t option                   = 0;
+	size64_t remaining_size                   = 0;
+	size64_t source_size                      = 0;
+	size_t chunk_data_size                    = 0;
+	size_t read_size                          = 0;
+	ssize_t read_count                        = 0;
+	off_t source_offset                       = 0;
+	uint64_t cached_checksum                  = 0;
+	uint32_t checksum_value                   = 0;
+	uint32_t initial_value                    = 0;
+	int calculation_method                    = 4;
+	int is_cached                             = 0;
+	int result                                = 0;
+	int use_asynchronous_io                   = 0;
+	int use_memory_map                        = 0;
+	int verbose                               = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -101,7 +132,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12345hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12345AC:hMi:m:o:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -142,6 +173,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'A':
+				use_asynchronous_io = 1;
+
+				break;
+
+			case 'C':
+				cache_filename = optarg;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -156,6 +197,17 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 'm':
+				assorted_cpu_features_set_mask(
+				 (uint32_t) system_string_copy_to_64bit( optarg ) );
+
+				break;
+
+			case 'M':
+				use_memory_map = 1;
+
+				break;
+
 			case 'o':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_offset = _wtol( optarg );
@@ -258,24 +310,156 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX )
+	if( cache_filename != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		if( assorted_checksum_cache_initialize(
+		     &checksum_cache,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create checksum cache.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = assorted_checksum_cache_open(
+		          checksum_cache,
+		          cache_filename,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open checksum cache.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Checksum cache not supported, calculating Adler-32 instead.\n" );
+
+			if( assorted_checksum_cache_free(
+			     &checksum_cache,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free checksum cache.\n" );
+
+				goto on_error;
+			}
+		}
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
+	if( use_memory_map != 0 )
+	{
+		if( assorted_memory_map_initialize(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create memory map.\n" );
 
-	if( buffer == NULL )
+			goto on_error;
+		}
+		result = assorted_memory_map_open(
+		          memory_map,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to memory map source file.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Memory mapped input not supported, reading source file instead.\n" );
+
+			if( assorted_memory_map_free(
+			     &memory_map,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free memory map.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( use_asynchronous_io != 0 )
+	 && ( memory_map == NULL ) )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		if( assorted_async_file_initialize(
+		     &async_file,
+		     ADLER32SUM_CHUNK_SIZE,
+		     ASSORTED_ASYNC_FILE_DEFAULT_QUEUE_DEPTH,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create asynchronous file.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = assorted_async_file_open(
+		          async_file,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file for asynchronous I/O.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Asynchronous I/O not supported, reading source file instead.\n" );
+
+			if( assorted_async_file_free(
+			     &async_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free asynchronous file.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( memory_map == NULL )
+	 && ( async_file == NULL ) )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * ADLER32SUM_CHUNK_SIZE );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Position the source file at the right offset
 	 */
@@ -291,121 +475,268 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	/* The data is read in chunks, where the Adler-32 of the preceding chunks
+	 * is used as the initial value of the next chunk
+	 */
+	checksum_value = initial_value;
+	remaining_size = source_size;
 
-	if( read_count != (ssize_t) source_size )
+	if( checksum_cache != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		if( memory_set(
+		     &checksum_cache_key,
+		     0,
+		     sizeof( assorted_checksum_cache_key_t ) ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to clear checksum cache key.\n" );
 
-		goto on_error;
-	}
-	/* Clean up
-	 */
-	if( libcfile_file_close(
-	     source_file,
-	     &error ) != 0 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to close source file.\n" );
+			goto on_error;
+		}
+		checksum_cache_key.offset        = (uint64_t) source_offset;
+		checksum_cache_key.size          = (uint64_t) source_size;
+		checksum_cache_key.initial_value = (uint64_t) initial_value;
+		checksum_cache_key.parameters    = 0;
+		checksum_cache_key.method        = ASSORTED_CHECKSUM_CACHE_METHOD_ADLER32;
+		checksum_cache_key.flags         = 0;
+
+		result = assorted_checksum_cache_get_checksum(
+		          checksum_cache,
+		          source,
+		          &checksum_cache_key,
+		          &cached_checksum,
+		          &error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve checksum from cache.\n" );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			checksum_value = (uint32_t) cached_checksum;
+			remaining_size = 0;
+			is_cached      = 1;
+
+			if( verbose != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Retrieved Adler-32 from checksum cache.\n" );
+			}
+		}
 	}
-	if( libcfile_file_free(
-	     &source_file,
-	     &error ) != 1 )
+
+	while( remaining_size > 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to free source file.\n" );
+		read_size = ADLER32SUM_CHUNK_SIZE;
 
-		goto on_error;
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		if( memory_map != NULL )
+		{
+			chunk_data = &( memory_map->data[ source_size - remaining_size ] );
+		}
+		else if( async_file != NULL )
+		{
+			result = assorted_async_file_read_next(
+			          async_file,
+			          &chunk_data,
+			          &chunk_data_size,
+			          &error );
+
+			if( ( result != 1 )
+			 || ( chunk_data_size != read_size ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      buffer,
+				      read_size,
+				      &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			chunk_data = buffer;
+		}
+		if( calculation_method == 1 )
+		{
+			result = assorted_adler32_calculate_checksum_basic2(
+			          &checksum_value,
+			          chunk_data,
+			          read_size,
+			          checksum_value,
+			          &error );
+		}
+		else if( calculation_method == 2 )
+		{
+			/* The unfolded4_2 variant is slower than the unfolded4_1 variant
+			 */
+			/* Fastest to slowest variant
+			 * - assorted_adler32_calculate_checksum_unfolded16_4
+			 * - assorted_adler32_calculate_checksum_unfolded16_2
+			 * - assorted_adler32_calculate_checksum_unfolded16_1
+			 * - assorted_adler32_calculate_checksum_unfolded16_3
+			 */
+			result = assorted_adler32_calculate_checksum_unfolded16_4(
+			          &checksum_value,
+			          chunk_data,
+			          read_size,
+			          checksum_value,
+			          &error );
+		}
+		else if( calculation_method == 3 )
+		{
+			/* The unfolded variants seems to be faster then the CPU aligned
+			 */
+			result = assorted_adler32_calculate_checksum_cpu_aligned(
+			          &checksum_value,
+			          chunk_data,
+			          read_size,
+			          checksum_value,
+			          &error );
+		}
+		else if( calculation_method == 4 )
+		{
+			result = assorted_adler32_calculate_checksum_simd(
+			          &checksum_value,
+			          chunk_data,
+			          read_size,
+			          checksum_value,
+			          &error );
+		}
+		else if( calculation_method == 5 )
+		{
+#if !defined( HAVE_ZLIB_ADLER32 )
+			fprintf(
+			 stderr,
+			 "Missing zlib Adler-32 support.\n" );
+
+			goto on_error;
+#else
+			checksum_value = adler32(
+			                  checksum_value,
+			                  chunk_data,
+			                  read_size );
+
+			result = 1;
+#endif
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate Adler-32.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 chunk_data,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
 	}
-	if( calculation_method == 1 )
+	if( ( checksum_cache != NULL )
+	 && ( is_cached == 0 ) )
 	{
-		result = assorted_adler32_calculate_checksum_basic2(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
+		if( assorted_checksum_cache_set_checksum(
+		     checksum_cache,
+		     source,
+		     &checksum_cache_key,
+		     (uint64_t) checksum_value,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to store checksum in cache.\n" );
+
+			goto on_error;
+		}
 	}
-	else if( calculation_method == 2 )
+	if( checksum_cache != NULL )
 	{
-		/* The unfolded4_2 variant is slower than the unfolded4_1 variant
-		 */
-		/* Fastest to slowest variant
-		 * - assorted_adler32_calculate_checksum_unfolded16_4
-		 * - assorted_adler32_calculate_checksum_unfolded16_2
-		 * - assorted_adler32_calculate_checksum_unfolded16_1
-		 * - assorted_adler32_calculate_checksum_unfolded16_3
-		 */
-		result = assorted_adler32_calculate_checksum_unfolded16_4(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
+		if( assorted_checksum_cache_free(
+		     &checksum_cache,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free checksum cache.\n" );
+
+			goto on_error;
+		}
 	}
-	else if( calculation_method == 3 )
+	if( memory_map != NULL )
 	{
-		/* The unfolded variants seems to be faster then the CPU aligned
-		 */
-		result = assorted_adler32_calculate_checksum_cpu_aligned(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
+		if( assorted_memory_map_free(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free memory map.\n" );
+
+			goto on_error;
+		}
 	}
-	else if( calculation_method == 4 )
+	if( async_file != NULL )
 	{
-/* TODO experimental */
-		result = assorted_adler32_calculate_checksum_simd(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
+		if( assorted_async_file_free(
+		     &async_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free asynchronous file.\n" );
+
+			goto on_error;
+		}
 	}
-	else if( calculation_method == 5 )
+	/* Clean up
+	 */
+	if( libcfile_file_close(
+	     source_file,
+	     &error ) != 0 )
 	{
-#if !defined( HAVE_ZLIB_ADLER32 )
 		fprintf(
 		 stderr,
-		 "Missing zlib Adler-32 support.\n" );
+		 "Unable to close source file.\n" );
 
 		goto on_error;
-#else
-		checksum_value = adler32(
-		                  initial_value,
-		                  buffer,
-		                  source_size );
-
-		result = 1;
-#endif
 	}
-	if( result != 1 )
+	if( libcfile_file_free(
+	     &source_file,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to calculate Adler-32.\n" );
+		 "Unable to free source file.\n" );
 
 		goto on_error;
 	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
 	memory_free(
 	 buffer );
 
@@ -425,6 +756,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( checksum_cache != NULL )
+	{
+		assorted_checksum_cache_free(
+		 &checksum_cache,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( async_file != NULL )
+	{
+		assorted_async_file_free(
+		 &async_file,
+		 NULL );
+	}
 	if( buffer != NULL )
 	{
 		memory_free(
@@ -74,21 +74,23 @@ int main( int argc, char * const argv[] )
 {
 	char destination[ 128 ];
 
-	libcerror_error_t *error      = NULL;
-	libcfile_file_t *source_file  = NULL;
-	system_character_t *source    = NULL;
-	uint8_t *buffer               = NULL;
-	uint8_t *uncompressed_data    = NULL;
-	char *program                 = "ascii7decompress";
-	system_integer_t option       = 0;
-	size64_t source_size          = 0;
-	size_t buffer_size            = 0;
-	size_t uncompressed_data_size = 0;
-	ssize_t read_count            = 0;
-	off_t source_offset           = 0;
-	int print_count               = 0;
-	int result                    = 0;
-	int verbose                   = 0;
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *destination_file = NULL;
+	libcfile_file_t *source_file      = NULL;
+	system_character_t *source        = NULL;
+	uint8_t *buffer                   = NULL;
+	uint8_t *uncompressed_data        = NULL;
+	char *program                     = "ascii7decompress";
+	system_integer_t option           = 0;
+	size64_t source_size              = 0;
+	size_t buffer_size                = 0;
+	size_t uncompressed_data_size     = 0;
+	ssize_t read_count                = 0;
+	ssize_t write_count               = 0;
+	off_t source_offset               = 0;
+	int print_count                   = 0;
+	int result                        = 0;
+	int verbose                       = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -349,10 +351,6 @@ int main( int argc, char * const argv[] )
 	source_offset += source_size;
 	source_size   -= source_size;
 
-#ifdef NOWRITE
-	libcfile_file_t *destination_file = NULL;
-	ssize_t write_count               = 0;
-
 	if( destination_file == NULL )
 	{
 		/* Open the destination file
@@ -367,19 +365,12 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_open_wide(
-		          destination_file,
-		          destination,
-		          LIBCFILE_OPEN_WRITE,
-		          &error );
-#else
 		result = libcfile_file_open(
 		          destination_file,
 		          destination,
 		          LIBCFILE_OPEN_WRITE,
 		          &error );
-#endif
+
 	 	if( result != 1 )
 		{
 			fprintf(
@@ -428,7 +419,6 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-#endif
 	/* Clean up
 	 */
 	if( libcfile_file_close(
@@ -471,14 +461,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-#ifdef NOWRITE
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
 		 &destination_file,
 		 NULL );
 	}
-#endif
 	if( uncompressed_data != NULL )
 	{
 		memory_free(
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H )
@@ -28,14 +29,16 @@
 #endif
 
 #include "assorted_adler32.h"
+#include "assorted_cpu_features.h"
 #include "assorted_libcerror.h"
 
-typedef union
-{
-	uint8_t vector __attribute__ ((vector_size (8)));
-	uint8_t integer[ 8 ];
+#if defined( ASSORTED_ADLER32_HAVE_SSSE3 )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_ADLER32_HAVE_NEON )
+#include <arm_neon.h>
 
-} assorted_adler32_8byte_vector_t;
+#endif
 
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
@@ -1356,7 +1359,324 @@ int assorted_adler32_calculate_checksum_cpu_aligned(
 	return( 1 );
 }
 
+/* Determines the SIMD method supported by the CPU
+ * Returns the SIMD method
+ */
+int assorted_adler32_get_simd_method(
+     void )
+{
+#if defined( ASSORTED_ADLER32_HAVE_SSSE3 ) || defined( ASSORTED_ADLER32_HAVE_NEON )
+	uint32_t cpu_features = 0;
+#endif
+	int simd_method       = ASSORTED_ADLER32_SIMD_METHOD_NONE;
+
+#if defined( ASSORTED_ADLER32_HAVE_SSSE3 )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_SSSE3 ) != 0 )
+	{
+		simd_method = ASSORTED_ADLER32_SIMD_METHOD_SSSE3;
+
+#if defined( ASSORTED_ADLER32_HAVE_AVX2 )
+		if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX2 ) != 0 )
+		{
+			simd_method = ASSORTED_ADLER32_SIMD_METHOD_AVX2;
+		}
+#endif
+	}
+#elif defined( ASSORTED_ADLER32_HAVE_NEON )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_NEON ) != 0 )
+	{
+		simd_method = ASSORTED_ADLER32_SIMD_METHOD_NEON;
+	}
+#endif
+	return( simd_method );
+}
+
+/* The number of bytes after which the modulo calculation is needed,
+ * rounded down to a multiple of the 64 bytes processed per iteration
+ * 5552 (0x15b0) & ~63 = 5504 (0x1580)
+ */
+#define ASSORTED_ADLER32_SIMD_BLOCK_SIZE	0x1580
+
+#if defined( ASSORTED_ADLER32_HAVE_SSSE3 )
+
+/* Calculates the Adler-32 of a buffer using SSSE3, 32 bytes per iteration
+ * The size must be a multiple of 32
+ * Returns the Adler-32
+ */
+__attribute__ ((target ("ssse3"))) uint32_t assorted_adler32_simd_ssse3(
+                                             uint32_t checksum_value,
+                                             const uint8_t *buffer,
+                                             size_t size )
+{
+	__m128i lower_multipliers_128bit = _mm_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17 );
+	__m128i upper_multipliers_128bit = _mm_setr_epi8( 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+	__m128i ones_128bit              = _mm_set1_epi16( 1 );
+	__m128i zero_128bit              = _mm_setzero_si128();
+	__m128i lower_sum_128bit;
+	__m128i previous_sum_128bit;
+	__m128i upper_sum_128bit;
+	__m128i value_128bit1;
+	__m128i value_128bit2;
+
+	size_t block_size   = 0;
+	size_t block_offset = 0;
+	uint32_t lower_word = checksum_value & 0xffff;
+	uint32_t upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	while( size > 0 )
+	{
+		block_size = size;
+
+		if( block_size > ASSORTED_ADLER32_SIMD_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_ADLER32_SIMD_BLOCK_SIZE;
+		}
+		/* Every byte of the block adds the lower word to the upper word
+		 */
+		upper_word += lower_word * (uint32_t) block_size;
+
+		lower_sum_128bit    = _mm_setzero_si128();
+		previous_sum_128bit = _mm_setzero_si128();
+		upper_sum_128bit    = _mm_setzero_si128();
+
+		for( block_offset = 0;
+		     block_offset < block_size;
+		     block_offset += 32 )
+		{
+			value_128bit1 = _mm_loadu_si128( (const __m128i *) buffer );
+			value_128bit2 = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+
+			/* Every 32 bytes add the lower sum of the previous iterations to the upper sum
+			 */
+			previous_sum_128bit = _mm_add_epi32( previous_sum_128bit, lower_sum_128bit );
+
+			lower_sum_128bit = _mm_add_epi32( lower_sum_128bit, _mm_sad_epu8( value_128bit1, zero_128bit ) );
+			lower_sum_128bit = _mm_add_epi32( lower_sum_128bit, _mm_sad_epu8( value_128bit2, zero_128bit ) );
+
+			value_128bit1 = _mm_maddubs_epi16( value_128bit1, lower_multipliers_128bit );
+			value_128bit2 = _mm_maddubs_epi16( value_128bit2, upper_multipliers_128bit );
+
+			upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_madd_epi16( value_128bit1, ones_128bit ) );
+			upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_madd_epi16( value_128bit2, ones_128bit ) );
+
+			buffer += 32;
+		}
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_slli_epi32( previous_sum_128bit, 5 ) );
+
+		/* Add the 32-bit values of the sums horizontally
+		 */
+		lower_sum_128bit = _mm_add_epi32( lower_sum_128bit, _mm_shuffle_epi32( lower_sum_128bit, 0x4e ) );
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_shuffle_epi32( upper_sum_128bit, 0x4e ) );
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_shuffle_epi32( upper_sum_128bit, 0xb1 ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32( lower_sum_128bit );
+		upper_word += (uint32_t) _mm_cvtsi128_si32( upper_sum_128bit );
+
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+
+		size -= block_size;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#endif /* defined( ASSORTED_ADLER32_HAVE_SSSE3 ) */
+
+#if defined( ASSORTED_ADLER32_HAVE_AVX2 )
+
+/* Calculates the Adler-32 of a buffer using AVX2, 64 bytes per iteration
+ * The size must be a multiple of 64
+ * Returns the Adler-32
+ */
+__attribute__ ((target ("avx2"))) uint32_t assorted_adler32_simd_avx2(
+                                            uint32_t checksum_value,
+                                            const uint8_t *buffer,
+                                            size_t size )
+{
+	__m256i lower_multipliers_256bit = _mm256_setr_epi8( 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33 );
+	__m256i upper_multipliers_256bit = _mm256_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+	__m256i ones_256bit              = _mm256_set1_epi16( 1 );
+	__m256i zero_256bit              = _mm256_setzero_si256();
+	__m256i lower_sum_256bit;
+	__m256i previous_sum_256bit;
+	__m256i upper_sum_256bit;
+	__m256i value_256bit1;
+	__m256i value_256bit2;
+	__m128i lower_sum_128bit;
+	__m128i upper_sum_128bit;
+
+	size_t block_size   = 0;
+	size_t block_offset = 0;
+	uint32_t lower_word = checksum_value & 0xffff;
+	uint32_t upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	while( size > 0 )
+	{
+		block_size = size;
+
+		if( block_size > ASSORTED_ADLER32_SIMD_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_ADLER32_SIMD_BLOCK_SIZE;
+		}
+		/* Every byte of the block adds the lower word to the upper word
+		 */
+		upper_word += lower_word * (uint32_t) block_size;
+
+		lower_sum_256bit    = _mm256_setzero_si256();
+		previous_sum_256bit = _mm256_setzero_si256();
+		upper_sum_256bit    = _mm256_setzero_si256();
+
+		for( block_offset = 0;
+		     block_offset < block_size;
+		     block_offset += 64 )
+		{
+			value_256bit1 = _mm256_loadu_si256( (const __m256i *) buffer );
+			value_256bit2 = _mm256_loadu_si256( (const __m256i *) &( buffer[ 32 ] ) );
+
+			/* Every 64 bytes add the lower sum of the previous iterations to the upper sum
+			 */
+			previous_sum_256bit = _mm256_add_epi32( previous_sum_256bit, lower_sum_256bit );
+
+			lower_sum_256bit = _mm256_add_epi32( lower_sum_256bit, _mm256_sad_epu8( value_256bit1, zero_256bit ) );
+			lower_sum_256bit = _mm256_add_epi32( lower_sum_256bit, _mm256_sad_epu8( value_256bit2, zero_256bit ) );
+
+			value_256bit1 = _mm256_maddubs_epi16( value_256bit1, lower_multipliers_256bit );
+			value_256bit2 = _mm256_maddubs_epi16( value_256bit2, upper_multipliers_256bit );
+
+			upper_sum_256bit = _mm256_add_epi32( upper_sum_256bit, _mm256_madd_epi16( value_256bit1, ones_256bit ) );
+			upper_sum_256bit = _mm256_add_epi32( upper_sum_256bit, _mm256_madd_epi16( value_256bit2, ones_256bit ) );
+
+			buffer += 64;
+		}
+		upper_sum_256bit = _mm256_add_epi32( upper_sum_256bit, _mm256_slli_epi32( previous_sum_256bit, 6 ) );
+
+		/* Add the 32-bit values of the sums horizontally
+		 */
+		lower_sum_128bit = _mm_add_epi32( _mm256_castsi256_si128( lower_sum_256bit ), _mm256_extracti128_si256( lower_sum_256bit, 1 ) );
+		upper_sum_128bit = _mm_add_epi32( _mm256_castsi256_si128( upper_sum_256bit ), _mm256_extracti128_si256( upper_sum_256bit, 1 ) );
+
+		lower_sum_128bit = _mm_add_epi32( lower_sum_128bit, _mm_shuffle_epi32( lower_sum_128bit, 0x4e ) );
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_shuffle_epi32( upper_sum_128bit, 0x4e ) );
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_shuffle_epi32( upper_sum_128bit, 0xb1 ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32( lower_sum_128bit );
+		upper_word += (uint32_t) _mm_cvtsi128_si32( upper_sum_128bit );
+
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+
+		size -= block_size;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#endif /* defined( ASSORTED_ADLER32_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_ADLER32_HAVE_NEON )
+
+/* Calculates the Adler-32 of a buffer using NEON, 32 bytes per iteration
+ * The size must be a multiple of 32
+ * Returns the Adler-32
+ */
+uint32_t assorted_adler32_simd_neon(
+          uint32_t checksum_value,
+          const uint8_t *buffer,
+          size_t size )
+{
+	static const uint16_t multipliers[ 32 ] = {
+		32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+		16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+	uint32x4_t lower_sum_128bit;
+	uint32x4_t previous_sum_128bit;
+	uint32x4_t upper_sum_128bit;
+	uint16x8_t column_sum_128bit1;
+	uint16x8_t column_sum_128bit2;
+	uint16x8_t column_sum_128bit3;
+	uint16x8_t column_sum_128bit4;
+	uint16x8_t byte_sum_128bit;
+	uint8x16_t value_128bit1;
+	uint8x16_t value_128bit2;
+
+	size_t block_size   = 0;
+	size_t block_offset = 0;
+	uint32_t lower_word = checksum_value & 0xffff;
+	uint32_t upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	while( size > 0 )
+	{
+		block_size = size;
+
+		if( block_size > ASSORTED_ADLER32_SIMD_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_ADLER32_SIMD_BLOCK_SIZE;
+		}
+		/* Every byte of the block adds the lower word to the upper word
+		 */
+		upper_word += lower_word * (uint32_t) block_size;
+
+		lower_sum_128bit    = vdupq_n_u32( 0 );
+		previous_sum_128bit = vdupq_n_u32( 0 );
+		column_sum_128bit1  = vdupq_n_u16( 0 );
+		column_sum_128bit2  = vdupq_n_u16( 0 );
+		column_sum_128bit3  = vdupq_n_u16( 0 );
+		column_sum_128bit4  = vdupq_n_u16( 0 );
+
+		/* The column sums cannot overflow since at most 172 x 255 is added per block
+		 */
+		for( block_offset = 0;
+		     block_offset < block_size;
+		     block_offset += 32 )
+		{
+			value_128bit1 = vld1q_u8( buffer );
+			value_128bit2 = vld1q_u8( &( buffer[ 16 ] ) );
+
+			/* Every 32 bytes add the lower sum of the previous iterations to the upper sum
+			 */
+			previous_sum_128bit = vaddq_u32( previous_sum_128bit, lower_sum_128bit );
+
+			byte_sum_128bit  = vpaddlq_u8( value_128bit1 );
+			byte_sum_128bit  = vpadalq_u8( byte_sum_128bit, value_128bit2 );
+			lower_sum_128bit = vpadalq_u16( lower_sum_128bit, byte_sum_128bit );
+
+			column_sum_128bit1 = vaddw_u8( column_sum_128bit1, vget_low_u8( value_128bit1 ) );
+			column_sum_128bit2 = vaddw_u8( column_sum_128bit2, vget_high_u8( value_128bit1 ) );
+			column_sum_128bit3 = vaddw_u8( column_sum_128bit3, vget_low_u8( value_128bit2 ) );
+			column_sum_128bit4 = vaddw_u8( column_sum_128bit4, vget_high_u8( value_128bit2 ) );
+
+			buffer += 32;
+		}
+		upper_sum_128bit = vshlq_n_u32( previous_sum_128bit, 5 );
+
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_low_u16( column_sum_128bit1 ), vld1_u16( &( multipliers[ 0 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_high_u16( column_sum_128bit1 ), vld1_u16( &( multipliers[ 4 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_low_u16( column_sum_128bit2 ), vld1_u16( &( multipliers[ 8 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_high_u16( column_sum_128bit2 ), vld1_u16( &( multipliers[ 12 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_low_u16( column_sum_128bit3 ), vld1_u16( &( multipliers[ 16 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_high_u16( column_sum_128bit3 ), vld1_u16( &( multipliers[ 20 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_low_u16( column_sum_128bit4 ), vld1_u16( &( multipliers[ 24 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_high_u16( column_sum_128bit4 ), vld1_u16( &( multipliers[ 28 ] ) ) );
+
+		lower_word += vaddvq_u32( lower_sum_128bit );
+		upper_word += vaddvq_u32( upper_sum_128bit );
+
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+
+		size -= block_size;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#endif /* defined( ASSORTED_ADLER32_HAVE_NEON ) */
+
 /* Calculates the Adler-32 of a buffer
+ * Uses the fastest SIMD kernel supported by the CPU, otherwise or for
+ * the remaining bytes a byte for byte calculation
  * It uses the initial value to calculate a new Adler-32
  * Returns 1 if successful or -1 on error
  */
@@ -1367,16 +1687,12 @@ int assorted_adler32_calculate_checksum_simd(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	assorted_adler32_8byte_vector_t value_8byte;
-	assorted_adler32_8byte_vector_t upper_word_8byte_multiplier;
-	assorted_adler32_8byte_vector_t upper_word_8byte_value;
-
 	static char *function = "assorted_adler32_calculate_checksum_simd";
+	size_t block_size     = 0;
 	size_t buffer_offset  = 0;
 	uint32_t lower_word   = 0;
 	uint32_t upper_word   = 0;
-	int block_index       = 0;
-	int number_of_blocks  = 0;
+	int simd_method       = 0;
 
 	if( checksum_value == NULL )
 	{
@@ -1411,144 +1727,235 @@ int assorted_adler32_calculate_checksum_simd(
 
 		return( -1 );
 	}
+	simd_method = assorted_adler32_get_simd_method();
+
+#if defined( ASSORTED_ADLER32_HAVE_AVX2 )
+	if( simd_method == ASSORTED_ADLER32_SIMD_METHOD_AVX2 )
+	{
+		buffer_offset = size & ~( (size_t) 63 );
+
+		initial_value = assorted_adler32_simd_avx2(
+		                 initial_value,
+		                 buffer,
+		                 buffer_offset );
+	}
+#endif
+#if defined( ASSORTED_ADLER32_HAVE_SSSE3 )
+	if( simd_method == ASSORTED_ADLER32_SIMD_METHOD_SSSE3 )
+	{
+		buffer_offset = size & ~( (size_t) 31 );
+
+		initial_value = assorted_adler32_simd_ssse3(
+		                 initial_value,
+		                 buffer,
+		                 buffer_offset );
+	}
+#endif
+#if defined( ASSORTED_ADLER32_HAVE_NEON )
+	if( simd_method == ASSORTED_ADLER32_SIMD_METHOD_NEON )
+	{
+		buffer_offset = size & ~( (size_t) 31 );
+
+		initial_value = assorted_adler32_simd_neon(
+		                 initial_value,
+		                 buffer,
+		                 buffer_offset );
+	}
+#endif
 	lower_word = initial_value & 0xffff;
 	upper_word = ( initial_value >> 16 ) & 0xffff;
 
-	upper_word_8byte_multiplier.integer[ 0 ] = 8;
-	upper_word_8byte_multiplier.integer[ 1 ] = 7;
-	upper_word_8byte_multiplier.integer[ 2 ] = 6;
-	upper_word_8byte_multiplier.integer[ 3 ] = 5;
-	upper_word_8byte_multiplier.integer[ 4 ] = 4;
-	upper_word_8byte_multiplier.integer[ 5 ] = 3;
-	upper_word_8byte_multiplier.integer[ 6 ] = 2;
-	upper_word_8byte_multiplier.integer[ 7 ] = 1;
-
-	upper_word_8byte_value.integer[ 0 ] = 0;
-	upper_word_8byte_value.integer[ 1 ] = 0;
-	upper_word_8byte_value.integer[ 2 ] = 0;
-	upper_word_8byte_value.integer[ 3 ] = 0;
-	upper_word_8byte_value.integer[ 4 ] = 0;
-	upper_word_8byte_value.integer[ 5 ] = 0;
-	upper_word_8byte_value.integer[ 6 ] = 0;
-	upper_word_8byte_value.integer[ 7 ] = 0;
-
-	while( size >= 0x15b0 )
+	while( buffer_offset < size )
 	{
 		/* The modulo calculation is needed per 5552 (0x15b0) bytes
-		 * 5552 / 16 = 347
 		 */
-		number_of_blocks = 347 * 2;
+		block_size = size - buffer_offset;
 
-		for( block_index = 0;
-		     block_index < number_of_blocks;
-		     block_index++ )
+		if( block_size > 0x15b0 )
 		{
-			value_8byte.integer[ 0 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 1 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 2 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 3 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 4 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 5 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 6 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 7 ] = buffer[ buffer_offset++ ];
-
-/* TODO
-			upper_word_8byte_value.vector = __builtin_mulv8qi(
-			                                 value_8byte.vector,
-			                                 upper_word_8byte_multiplier.vector );
-*/
-
-			upper_word += 8 * lower_word
-			            + upper_word_8byte_value.integer[ 0 ]
-			            + upper_word_8byte_value.integer[ 1 ]
-			            + upper_word_8byte_value.integer[ 2 ]
-			            + upper_word_8byte_value.integer[ 3 ]
-			            + upper_word_8byte_value.integer[ 4 ]
-			            + upper_word_8byte_value.integer[ 5 ]
-			            + upper_word_8byte_value.integer[ 6 ]
-			            + upper_word_8byte_value.integer[ 7 ];
-
-			lower_word += value_8byte.integer[ 0 ]
-			            + value_8byte.integer[ 1 ]
-			            + value_8byte.integer[ 2 ]
-			            + value_8byte.integer[ 3 ]
-			            + value_8byte.integer[ 4 ]
-			            + value_8byte.integer[ 5 ]
-			            + value_8byte.integer[ 6 ]
-			            + value_8byte.integer[ 7 ];
-
+			block_size = 0x15b0;
 		}
-		lower_word %= 0xfff1;
-		upper_word %= 0xfff1;
-
-		size -= 0x15b0;
-	}
-	if( size > 0 )
-	{
-		while( size > 16 )
+		while( block_size > 0 )
 		{
 			lower_word += buffer[ buffer_offset++ ];
 			upper_word += lower_word;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+			block_size--;
+		}
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+	}
+	*checksum_value = ( upper_word << 16 ) | lower_word;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	return( 1 );
+}
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+/* The size of the blocks that are copied before the Adler-32 is calculated from the cached destination
+ */
+#define ASSORTED_ADLER32_COPY_BLOCK_SIZE	16384
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+/* Copies a buffer and calculates its Adler-32 in a single pass over the source
+ * The buffer is copied in blocks that are small enough for the Adler-32 to be
+ * calculated from the cached destination
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_copy_calculate_checksum(
+     uint32_t *checksum_value,
+     uint8_t *destination,
+     const uint8_t *source,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_adler32_copy_calculate_checksum";
+	size_t block_size     = 0;
+	size_t buffer_offset  = 0;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	if( destination == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		block_size = size - buffer_offset;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		if( block_size > ASSORTED_ADLER32_COPY_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_ADLER32_COPY_BLOCK_SIZE;
+		}
+		if( memory_copy(
+		     &( destination[ buffer_offset ] ),
+		     &( source[ buffer_offset ] ),
+		     block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_adler32_calculate_checksum_simd(
+		     &initial_value,
+		     &( destination[ buffer_offset ] ),
+		     block_size,
+		     initial_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate Adler-32.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset += block_size;
+	}
+	*checksum_value = initial_value;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	return( 1 );
+}
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+/* Combines the Adler-32 of two consecutive buffers
+ * The second checksum value must be calculated with an initial value of 1
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_combine(
+     uint32_t *checksum_value,
+     uint32_t first_checksum_value,
+     uint32_t second_checksum_value,
+     size64_t second_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_adler32_combine";
+	uint32_t lower_word   = 0;
+	uint32_t remainder    = 0;
+	uint32_t upper_word   = 0;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	/* The upper word of the second checksum lacks the lower word of the first
+	 * checksum added for every byte of the second buffer and the initial
+	 * lower word of 1 of the second checksum is counted twice
+	 */
+	remainder = (uint32_t) ( second_size % 0xfff1 );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	lower_word = first_checksum_value & 0xffff;
+	upper_word = (uint32_t) ( ( (uint64_t) remainder * lower_word ) % 0xfff1 );
 
-			size          -= 16;
-		}
-		while( size > 0 )
-		{
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	lower_word += ( second_checksum_value & 0xffff ) + 0xfff1 - 1;
+	upper_word += ( ( first_checksum_value >> 16 ) & 0xffff ) + ( ( second_checksum_value >> 16 ) & 0xffff ) + 0xfff1 - remainder;
 
-			size--;
-		}
-		lower_word %= 0xfff1;
-		upper_word %= 0xfff1;
+	if( lower_word >= 0xfff1 )
+	{
+		lower_word -= 0xfff1;
+	}
+	if( lower_word >= 0xfff1 )
+	{
+		lower_word -= 0xfff1;
+	}
+	if( upper_word >= ( 2 * 0xfff1 ) )
+	{
+		upper_word -= 2 * 0xfff1;
+	}
+	if( upper_word >= 0xfff1 )
+	{
+		upper_word -= 0xfff1;
 	}
 	*checksum_value = ( upper_word << 16 ) | lower_word;
 
 	return( 1 );
 }
-
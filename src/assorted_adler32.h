@@ -31,6 +31,29 @@
 extern "C" {
 #endif
 
+/* The SIMD kernels are available with GCC compatible compilers on x86
+ * and on little-endian ARMv8, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define ASSORTED_ADLER32_HAVE_SSSE3
+
+#if defined( __clang__ ) || ( __GNUC__ >= 5 )
+#define ASSORTED_ADLER32_HAVE_AVX2
+#endif
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ )
+#define ASSORTED_ADLER32_HAVE_NEON
+
+#endif
+
+enum ASSORTED_ADLER32_SIMD_METHODS
+{
+	ASSORTED_ADLER32_SIMD_METHOD_NONE	= 0x00,
+	ASSORTED_ADLER32_SIMD_METHOD_SSSE3	= 0x01,
+	ASSORTED_ADLER32_SIMD_METHOD_AVX2	= 0x02,
+	ASSORTED_ADLER32_SIMD_METHOD_NEON	= 0x03
+};
+
 int assorted_adler32_calculate_checksum_basic1(
      uint32_t *checksum_value,
      const uint8_t *buffer,
@@ -94,6 +117,36 @@ int assorted_adler32_calculate_checksum_cpu_aligned(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int assorted_adler32_get_simd_method(
+     void );
+
+#if defined( ASSORTED_ADLER32_HAVE_SSSE3 )
+
+uint32_t assorted_adler32_simd_ssse3(
+          uint32_t checksum_value,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_ADLER32_HAVE_SSSE3 ) */
+
+#if defined( ASSORTED_ADLER32_HAVE_AVX2 )
+
+uint32_t assorted_adler32_simd_avx2(
+          uint32_t checksum_value,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_ADLER32_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_ADLER32_HAVE_NEON )
+
+uint32_t assorted_adler32_simd_neon(
+          uint32_t checksum_value,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_ADLER32_HAVE_NEON ) */
+
 int assorted_adler32_calculate_checksum_simd(
      uint32_t *checksum_value,
      const uint8_t *buffer,
@@ -101,6 +154,21 @@ int assorted_adler32_calculate_checksum_simd(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int assorted_adler32_copy_calculate_checksum(
+     uint32_t *checksum_value,
+     uint8_t *destination,
+     const uint8_t *source,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int assorted_adler32_combine(
+     uint32_t *checksum_value,
+     uint32_t first_checksum_value,
+     uint32_t second_checksum_value,
+     size64_t second_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,667 @@
+/*
+ * Rolling Adler-32 functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_adler32.h"
+#include "assorted_adler32_rolling.h"
+#include "assorted_libcerror.h"
+
+/* Creates a rolling Adler-32
+ * Make sure the value rolling is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_rolling_initialize(
+     assorted_adler32_rolling_t **rolling,
+     size_t window_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_adler32_rolling_initialize";
+	uint32_t byte_value   = 0;
+	uint32_t window_value = 0;
+
+	if( rolling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rolling.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rolling != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid rolling value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid window size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_size > (size_t) ASSORTED_ADLER32_ROLLING_MAXIMUM_WINDOW_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid window size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*rolling = memory_allocate_structure(
+	            assorted_adler32_rolling_t );
+
+	if( *rolling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create rolling.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *rolling,
+	     0,
+	     sizeof( assorted_adler32_rolling_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear rolling.",
+		 function );
+
+		goto on_error;
+	}
+	( *rolling )->window = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * window_size );
+
+	if( ( *rolling )->window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create window.",
+		 function );
+
+		goto on_error;
+	}
+	window_value = (uint32_t) ( window_size % 0xfff1 );
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		( *rolling )->outgoing_table[ byte_value ] = 0xfff0 - ( ( window_value * byte_value ) % 0xfff1 );
+	}
+	( *rolling )->window_size = window_size;
+	( *rolling )->lower_word  = 1;
+
+	return( 1 );
+
+on_error:
+	if( *rolling != NULL )
+	{
+		memory_free(
+		 *rolling );
+
+		*rolling = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a rolling Adler-32
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_rolling_free(
+     assorted_adler32_rolling_t **rolling,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_adler32_rolling_free";
+
+	if( rolling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rolling.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rolling != NULL )
+	{
+		if( ( *rolling )->window != NULL )
+		{
+			memory_free(
+			 ( *rolling )->window );
+		}
+		memory_free(
+		 *rolling );
+
+		*rolling = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets a rolling Adler-32 to an empty window
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_rolling_reset(
+     assorted_adler32_rolling_t *rolling,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_adler32_rolling_reset";
+
+	if( rolling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rolling.",
+		 function );
+
+		return( -1 );
+	}
+	rolling->lower_word             = 1;
+	rolling->upper_word             = 0;
+	rolling->window_offset          = 0;
+	rolling->number_of_window_bytes = 0;
+
+	return( 1 );
+}
+
+/* Sets the window of a rolling Adler-32
+ * The size must be equal to the window size
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_rolling_set_window(
+     assorted_adler32_rolling_t *rolling,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function   = "assorted_adler32_rolling_set_window";
+	uint32_t checksum_value = 0;
+
+	if( rolling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rolling.",
+		 function );
+
+		return( -1 );
+	}
+	if( rolling->window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid rolling - missing window.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size != rolling->window_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_adler32_calculate_checksum_simd(
+	     &checksum_value,
+	     buffer,
+	     size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum of window.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     rolling->window,
+	     buffer,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy window.",
+		 function );
+
+		return( -1 );
+	}
+	rolling->lower_word             = checksum_value & 0xffff;
+	rolling->upper_word             = checksum_value >> 16;
+	rolling->window_offset          = 0;
+	rolling->number_of_window_bytes = size;
+
+	return( 1 );
+}
+
+/* Updates a rolling Adler-32 with a byte
+ * If the window is full the oldest byte is rolled out of the window
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_rolling_update(
+     assorted_adler32_rolling_t *rolling,
+     uint8_t byte_value,
+     libcerror_error_t **error )
+{
+	static char *function  = "assorted_adler32_rolling_update";
+	uint8_t outgoing_value = 0;
+
+	if( rolling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rolling.",
+		 function );
+
+		return( -1 );
+	}
+	if( rolling->window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid rolling - missing window.",
+		 function );
+
+		return( -1 );
+	}
+	rolling->lower_word += byte_value;
+
+	if( rolling->lower_word >= 0xfff1 )
+	{
+		rolling->lower_word -= 0xfff1;
+	}
+	if( rolling->number_of_window_bytes < rolling->window_size )
+	{
+		rolling->window[ rolling->number_of_window_bytes++ ] = byte_value;
+	}
+	else
+	{
+		outgoing_value = rolling->window[ rolling->window_offset ];
+
+		rolling->window[ rolling->window_offset++ ] = byte_value;
+
+		if( rolling->window_offset >= rolling->window_size )
+		{
+			rolling->window_offset = 0;
+		}
+		/* lower = lower - outgoing
+		 * upper = upper + lower - ( window size * outgoing ) - 1
+		 */
+		rolling->lower_word += 0xfff1 - outgoing_value;
+
+		if( rolling->lower_word >= 0xfff1 )
+		{
+			rolling->lower_word -= 0xfff1;
+		}
+		rolling->upper_word += rolling->outgoing_table[ outgoing_value ];
+
+		if( rolling->upper_word >= 0xfff1 )
+		{
+			rolling->upper_word -= 0xfff1;
+		}
+	}
+	rolling->upper_word += rolling->lower_word;
+
+	if( rolling->upper_word >= 0xfff1 )
+	{
+		rolling->upper_word -= 0xfff1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the Adler-32 of the window of a rolling Adler-32
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_rolling_get_checksum(
+     assorted_adler32_rolling_t *rolling,
+     uint32_t *checksum_value,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_adler32_rolling_get_checksum";
+
+	if( rolling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rolling.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum_value = ( rolling->upper_word << 16 ) | rolling->lower_word;
+
+	return( 1 );
+}
+
+/* Scans a buffer for content-defined boundaries
+ * A boundary is at every offset where the window preceding the offset is full
+ * and the Adler-32 of the window, masked with mask, is 0
+ * The boundary offsets are relative to the start of the buffer, where the window
+ * carries over from previous scans, and scanning stops when the maximum number
+ * of boundaries is reached, the size of the scanned data is returned in scanned size
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_adler32_rolling_scan(
+     assorted_adler32_rolling_t *rolling,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t mask,
+     size_t *boundary_offsets,
+     size_t maximum_number_of_boundaries,
+     size_t *number_of_boundaries,
+     size_t *scanned_size,
+     libcerror_error_t **error )
+{
+	const uint32_t *outgoing_table = NULL;
+	static char *function          = "assorted_adler32_rolling_scan";
+	size_t boundary_index          = 0;
+	size_t buffer_offset           = 0;
+	size_t window_size             = 0;
+	uint32_t lower_word            = 0;
+	uint32_t upper_word            = 0;
+	uint8_t outgoing_value         = 0;
+
+	if( rolling == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rolling.",
+		 function );
+
+		return( -1 );
+	}
+	if( rolling->window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid rolling - missing window.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( boundary_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid boundary offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_boundaries == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of boundaries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_boundaries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of boundaries.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanned_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanned size.",
+		 function );
+
+		return( -1 );
+	}
+	window_size = rolling->window_size;
+
+	/* An empty window is filled using the SIMD Adler-32 calculation
+	 */
+	if( ( rolling->number_of_window_bytes == 0 )
+	 && ( size >= window_size ) )
+	{
+		if( assorted_adler32_rolling_set_window(
+		     rolling,
+		     buffer,
+		     window_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set window.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset = window_size;
+
+		if( ( ( ( rolling->upper_word << 16 ) | rolling->lower_word ) & mask ) == 0 )
+		{
+			boundary_offsets[ boundary_index++ ] = buffer_offset;
+		}
+	}
+	/* As long as the window extends before the buffer the bytes are rolled
+	 * in and out of the window data
+	 */
+	while( ( boundary_index < maximum_number_of_boundaries )
+	    && ( buffer_offset < size )
+	    && ( buffer_offset < window_size ) )
+	{
+		if( assorted_adler32_rolling_update(
+		     rolling,
+		     buffer[ buffer_offset++ ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update rolling.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( rolling->number_of_window_bytes == window_size )
+		 && ( ( ( ( rolling->upper_word << 16 ) | rolling->lower_word ) & mask ) == 0 ) )
+		{
+			boundary_offsets[ boundary_index++ ] = buffer_offset;
+		}
+	}
+	/* Otherwise the outgoing byte is read from the buffer directly
+	 * and the window data is only updated once the scan is done
+	 */
+	outgoing_table = rolling->outgoing_table;
+	lower_word     = rolling->lower_word;
+	upper_word     = rolling->upper_word;
+
+	while( ( boundary_index < maximum_number_of_boundaries )
+	    && ( buffer_offset < size ) )
+	{
+		outgoing_value = buffer[ buffer_offset - window_size ];
+
+		lower_word += buffer[ buffer_offset++ ];
+
+		if( lower_word >= 0xfff1 )
+		{
+			lower_word -= 0xfff1;
+		}
+		lower_word += 0xfff1 - outgoing_value;
+
+		if( lower_word >= 0xfff1 )
+		{
+			lower_word -= 0xfff1;
+		}
+		upper_word += outgoing_table[ outgoing_value ];
+
+		if( upper_word >= 0xfff1 )
+		{
+			upper_word -= 0xfff1;
+		}
+		upper_word += lower_word;
+
+		if( upper_word >= 0xfff1 )
+		{
+			upper_word -= 0xfff1;
+		}
+		if( ( ( ( upper_word << 16 ) | lower_word ) & mask ) == 0 )
+		{
+			boundary_offsets[ boundary_index++ ] = buffer_offset;
+		}
+	}
+	rolling->lower_word = lower_word;
+	rolling->upper_word = upper_word;
+
+	if( buffer_offset >= window_size )
+	{
+		if( memory_copy(
+		     rolling->window,
+		     &( buffer[ buffer_offset - window_size ] ),
+		     window_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy window.",
+			 function );
+
+			return( -1 );
+		}
+		rolling->window_offset          = 0;
+		rolling->number_of_window_bytes = window_size;
+	}
+	*number_of_boundaries = boundary_index;
+	*scanned_size         = buffer_offset;
+
+	return( 1 );
+}
+
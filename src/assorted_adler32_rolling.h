@@ -0,0 +1,118 @@
+/*
+ * Rolling Adler-32 functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_ADLER32_ROLLING_H )
+#define _ASSORTED_ADLER32_ROLLING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of the rolling window (16 MiB)
+ */
+#define ASSORTED_ADLER32_ROLLING_MAXIMUM_WINDOW_SIZE	( 16 * 1024 * 1024 )
+
+typedef struct assorted_adler32_rolling assorted_adler32_rolling_t;
+
+struct assorted_adler32_rolling
+{
+	/* The lower word of the Adler-32 of the window
+	 */
+	uint32_t lower_word;
+
+	/* The upper word of the Adler-32 of the window
+	 */
+	uint32_t upper_word;
+
+	/* The value to add to the upper word per outgoing byte value
+	 * this is ( 65520 - ( ( window size * byte value ) % 65521 ) ),
+	 * which keeps rolling a byte out of the window free of divisions
+	 */
+	uint32_t outgoing_table[ 256 ];
+
+	/* The window data, used as a ring buffer
+	 */
+	uint8_t *window;
+
+	/* The window size
+	 */
+	size_t window_size;
+
+	/* The offset of the oldest byte in the window
+	 */
+	size_t window_offset;
+
+	/* The number of bytes in the window
+	 */
+	size_t number_of_window_bytes;
+};
+
+int assorted_adler32_rolling_initialize(
+     assorted_adler32_rolling_t **rolling,
+     size_t window_size,
+     libcerror_error_t **error );
+
+int assorted_adler32_rolling_free(
+     assorted_adler32_rolling_t **rolling,
+     libcerror_error_t **error );
+
+int assorted_adler32_rolling_reset(
+     assorted_adler32_rolling_t *rolling,
+     libcerror_error_t **error );
+
+int assorted_adler32_rolling_set_window(
+     assorted_adler32_rolling_t *rolling,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int assorted_adler32_rolling_update(
+     assorted_adler32_rolling_t *rolling,
+     uint8_t byte_value,
+     libcerror_error_t **error );
+
+int assorted_adler32_rolling_get_checksum(
+     assorted_adler32_rolling_t *rolling,
+     uint32_t *checksum_value,
+     libcerror_error_t **error );
+
+int assorted_adler32_rolling_scan(
+     assorted_adler32_rolling_t *rolling,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t mask,
+     size_t *boundary_offsets,
+     size_t maximum_number_of_boundaries,
+     size_t *number_of_boundaries,
+     size_t *scanned_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_ADLER32_ROLLING_H ) */
+
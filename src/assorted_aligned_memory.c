@@ -0,0 +1,328 @@
+/*
+ * Aligned and huge page backed memory functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#include "assorted_aligned_memory.h"
+
+#if !defined( WINAPI ) && defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H )
+#if defined( MAP_ANONYMOUS )
+#define ASSORTED_ALIGNED_MEMORY_MAP_ANONYMOUS	MAP_ANONYMOUS
+#elif defined( MAP_ANON )
+#define ASSORTED_ALIGNED_MEMORY_MAP_ANONYMOUS	MAP_ANON
+#endif
+#endif
+
+/* Sets the header of aligned memory
+ * Returns the aligned memory
+ */
+static void *assorted_aligned_memory_set_header(
+              void *allocation,
+              size_t allocation_size,
+              size_t size,
+              uint8_t type )
+{
+	assorted_aligned_memory_header_t *header = NULL;
+	uint8_t *memory                          = NULL;
+
+	memory = (uint8_t *) ( ( (intptr_t) allocation + sizeof( assorted_aligned_memory_header_t ) + ASSORTED_ALIGNED_MEMORY_ALIGNMENT - 1 ) & ~( (intptr_t) ASSORTED_ALIGNED_MEMORY_ALIGNMENT - 1 ) );
+	header = (assorted_aligned_memory_header_t *) ( memory - sizeof( assorted_aligned_memory_header_t ) );
+
+	header->allocation      = allocation;
+	header->allocation_size = allocation_size;
+	header->size            = size;
+	header->type            = type;
+
+	return( memory );
+}
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+
+/* Allocates memory using Windows large pages
+ * Large pages require the lock pages in memory privilege
+ * Returns a pointer to the aligned memory or NULL if large pages are not available
+ */
+static void *assorted_aligned_memory_allocate_large_pages(
+              size_t size )
+{
+	void *allocation       = NULL;
+	size_t allocation_size = 0;
+	SIZE_T large_page_size = 0;
+
+	large_page_size = GetLargePageMinimum();
+
+	if( ( large_page_size == 0 )
+	 || ( size < (size_t) large_page_size )
+	 || ( size > ( (size_t) SSIZE_MAX - ASSORTED_ALIGNED_MEMORY_ALIGNMENT - large_page_size ) ) )
+	{
+		return( NULL );
+	}
+	allocation_size = ( size + ASSORTED_ALIGNED_MEMORY_ALIGNMENT + large_page_size - 1 ) & ~( (size_t) large_page_size - 1 );
+
+	allocation = VirtualAlloc(
+	              NULL,
+	              allocation_size,
+	              MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+	              PAGE_READWRITE );
+
+	if( allocation == NULL )
+	{
+		return( NULL );
+	}
+	return( assorted_aligned_memory_set_header(
+	         allocation,
+	         allocation_size,
+	         size,
+	         ASSORTED_ALIGNED_MEMORY_TYPE_LARGE_PAGES ) );
+}
+
+#elif defined( ASSORTED_ALIGNED_MEMORY_MAP_ANONYMOUS )
+
+/* Allocates memory using an anonymous mapping that is aligned to the huge page size
+ * The mapping is advised to use transparent huge pages where supported
+ * Returns a pointer to the aligned memory or NULL if the mapping failed
+ */
+static void *assorted_aligned_memory_allocate_mapping(
+              size_t size )
+{
+	uint8_t *allocation    = NULL;
+	uint8_t *mapping       = NULL;
+	size_t allocation_size = 0;
+	size_t mapping_size    = 0;
+	size_t trim_size       = 0;
+
+	if( ( size < (size_t) ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE )
+	 || ( size > ( (size_t) SSIZE_MAX - ASSORTED_ALIGNED_MEMORY_ALIGNMENT - ( 2 * ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE ) ) ) )
+	{
+		return( NULL );
+	}
+	allocation_size = ( size + ASSORTED_ALIGNED_MEMORY_ALIGNMENT + ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE - 1 ) & ~( (size_t) ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE - 1 );
+
+	/* The mapping is a huge page larger than needed so that the part that
+	 * starts at a huge page boundary can be kept and the rest unmapped
+	 */
+	mapping_size = allocation_size + ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE;
+
+	mapping = (uint8_t *) mmap(
+	                       NULL,
+	                       mapping_size,
+	                       PROT_READ | PROT_WRITE,
+	                       MAP_PRIVATE | ASSORTED_ALIGNED_MEMORY_MAP_ANONYMOUS,
+	                       -1,
+	                       0 );
+
+	if( mapping == (uint8_t *) MAP_FAILED )
+	{
+		return( NULL );
+	}
+	allocation = (uint8_t *) ( ( (intptr_t) mapping + ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE - 1 ) & ~( (intptr_t) ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE - 1 ) );
+
+	trim_size = (size_t) ( allocation - mapping );
+
+	if( trim_size > 0 )
+	{
+		munmap(
+		 mapping,
+		 trim_size );
+	}
+	trim_size = mapping_size - allocation_size - trim_size;
+
+	if( trim_size > 0 )
+	{
+		munmap(
+		 &( allocation[ allocation_size ] ),
+		 trim_size );
+	}
+#if defined( HAVE_MADVISE ) && defined( MADV_HUGEPAGE )
+	/* The advice is a hint, hence failures are ignored, for example
+	 * when transparent huge pages are disabled
+	 */
+	madvise(
+	 allocation,
+	 allocation_size,
+	 MADV_HUGEPAGE );
+#endif
+	return( assorted_aligned_memory_set_header(
+	         allocation,
+	         allocation_size,
+	         size,
+	         ASSORTED_ALIGNED_MEMORY_TYPE_MAPPING ) );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0600 ) */
+
+/* Allocates memory that is aligned to ASSORTED_ALIGNED_MEMORY_ALIGNMENT bytes
+ * Allocations of at least the huge page size are backed by huge pages
+ * where the operating system allows it, otherwise the memory is allocated
+ * from the heap
+ * The memory must be freed with assorted_aligned_memory_free
+ * Returns a pointer to the aligned memory or NULL on error
+ */
+void *assorted_aligned_memory_allocate(
+       size_t size )
+{
+	void *allocation       = NULL;
+	void *memory           = NULL;
+	size_t allocation_size = 0;
+
+	if( ( size == 0 )
+	 || ( size > (size_t) SSIZE_MAX ) )
+	{
+		return( NULL );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	memory = assorted_aligned_memory_allocate_large_pages(
+	          size );
+
+#elif defined( ASSORTED_ALIGNED_MEMORY_MAP_ANONYMOUS )
+	memory = assorted_aligned_memory_allocate_mapping(
+	          size );
+
+#endif
+	if( memory != NULL )
+	{
+		return( memory );
+	}
+	if( size > ( (size_t) SSIZE_MAX - sizeof( assorted_aligned_memory_header_t ) - ASSORTED_ALIGNED_MEMORY_ALIGNMENT ) )
+	{
+		return( NULL );
+	}
+	allocation_size = size + sizeof( assorted_aligned_memory_header_t ) + ASSORTED_ALIGNED_MEMORY_ALIGNMENT - 1;
+
+	allocation = memory_allocate(
+	              allocation_size );
+
+	if( allocation == NULL )
+	{
+		return( NULL );
+	}
+	return( assorted_aligned_memory_set_header(
+	         allocation,
+	         allocation_size,
+	         size,
+	         ASSORTED_ALIGNED_MEMORY_TYPE_HEAP ) );
+}
+
+/* Reallocates aligned memory
+ * The data is preserved up to the smaller of the old and new size,
+ * memory that is NULL is allocated
+ * Returns a pointer to the aligned memory or NULL on error, in which case
+ * the original memory is left unchanged
+ */
+void *assorted_aligned_memory_reallocate(
+       void *memory,
+       size_t size )
+{
+	assorted_aligned_memory_header_t *header = NULL;
+	void *reallocation                       = NULL;
+	size_t copy_size                         = 0;
+
+	if( memory == NULL )
+	{
+		return( assorted_aligned_memory_allocate(
+		         size ) );
+	}
+	header = (assorted_aligned_memory_header_t *) ( (uint8_t *) memory - sizeof( assorted_aligned_memory_header_t ) );
+
+	/* A mapping or large pages allocation is rounded up to a page multiple
+	 * and can hold a larger size without moving the data
+	 */
+	if( ( header->type != ASSORTED_ALIGNED_MEMORY_TYPE_HEAP )
+	 && ( size > 0 )
+	 && ( size <= ( header->allocation_size - (size_t) ( (uint8_t *) memory - (uint8_t *) header->allocation ) ) ) )
+	{
+		header->size = size;
+
+		return( memory );
+	}
+	reallocation = assorted_aligned_memory_allocate(
+	                size );
+
+	if( reallocation == NULL )
+	{
+		return( NULL );
+	}
+	copy_size = header->size;
+
+	if( copy_size > size )
+	{
+		copy_size = size;
+	}
+	if( memory_copy(
+	     reallocation,
+	     memory,
+	     copy_size ) == NULL )
+	{
+		assorted_aligned_memory_free(
+		 reallocation );
+
+		return( NULL );
+	}
+	assorted_aligned_memory_free(
+	 memory );
+
+	return( reallocation );
+}
+
+/* Frees aligned memory
+ */
+void assorted_aligned_memory_free(
+      void *memory )
+{
+	assorted_aligned_memory_header_t *header = NULL;
+
+	if( memory == NULL )
+	{
+		return;
+	}
+	header = (assorted_aligned_memory_header_t *) ( (uint8_t *) memory - sizeof( assorted_aligned_memory_header_t ) );
+
+	switch( header->type )
+	{
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+		case ASSORTED_ALIGNED_MEMORY_TYPE_LARGE_PAGES:
+			VirtualFree(
+			 header->allocation,
+			 0,
+			 MEM_RELEASE );
+			break;
+
+#elif defined( ASSORTED_ALIGNED_MEMORY_MAP_ANONYMOUS )
+		case ASSORTED_ALIGNED_MEMORY_TYPE_MAPPING:
+			munmap(
+			 header->allocation,
+			 header->allocation_size );
+			break;
+
+#endif
+		default:
+			memory_free(
+			 header->allocation );
+			break;
+	}
+}
+
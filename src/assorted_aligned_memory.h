@@ -0,0 +1,96 @@
+/*
+ * Aligned and huge page backed memory functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_ALIGNED_MEMORY_H )
+#define _ASSORTED_ALIGNED_MEMORY_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the aligned memory, which is the size of a cache line
+ */
+#define ASSORTED_ALIGNED_MEMORY_ALIGNMENT	64
+
+/* The size of a huge page, allocations of at least this size are backed
+ * by huge pages where the operating system allows it
+ */
+#define ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE	( 2 * 1024 * 1024 )
+
+/* The aligned memory types
+ */
+enum ASSORTED_ALIGNED_MEMORY_TYPES
+{
+	/* The memory is allocated from the heap
+	 */
+	ASSORTED_ALIGNED_MEMORY_TYPE_HEAP		= 1,
+
+	/* The memory is an anonymous mapping that is advised to use huge pages
+	 */
+	ASSORTED_ALIGNED_MEMORY_TYPE_MAPPING		= 2,
+
+	/* The memory is allocated with Windows large pages
+	 */
+	ASSORTED_ALIGNED_MEMORY_TYPE_LARGE_PAGES	= 3
+};
+
+typedef struct assorted_aligned_memory_header assorted_aligned_memory_header_t;
+
+/* The header is stored in the ASSORTED_ALIGNED_MEMORY_ALIGNMENT bytes before the aligned memory
+ */
+struct assorted_aligned_memory_header
+{
+	/* The start of the allocation
+	 */
+	void *allocation;
+
+	/* The size of the allocation
+	 */
+	size_t allocation_size;
+
+	/* The size of the aligned memory
+	 */
+	size_t size;
+
+	/* The type
+	 */
+	uint8_t type;
+};
+
+void *assorted_aligned_memory_allocate(
+       size_t size );
+
+void *assorted_aligned_memory_reallocate(
+       void *memory,
+       size_t size );
+
+void assorted_aligned_memory_free(
+      void *memory );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_ALIGNED_MEMORY_H ) */
+
@@ -0,0 +1,447 @@
+/*
+ * Arena (bump) allocator functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_aligned_memory.h"
+#include "assorted_arena.h"
+#include "assorted_libcerror.h"
+
+/* Creates an arena
+ * The slab of data_size bytes is allocated upfront, a data_size of 0 defers
+ * the slab to the first reset
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_arena_initialize(
+     assorted_arena_t **arena,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          assorted_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( assorted_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		( *arena )->data = (uint8_t *) assorted_aligned_memory_allocate(
+		                                sizeof( uint8_t ) * data_size );
+
+		if( ( *arena )->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		( *arena )->data_size = data_size;
+	}
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the overflow blocks of an arena
+ */
+static void assorted_arena_free_overflow_blocks(
+             assorted_arena_t *arena )
+{
+	int block_index = 0;
+
+	for( block_index = 0;
+	     block_index < arena->number_of_overflow_blocks;
+	     block_index++ )
+	{
+		memory_free(
+		 arena->overflow_blocks[ block_index ] );
+	}
+	arena->number_of_overflow_blocks = 0;
+}
+
+/* Frees an arena and all memory allocated from it
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_arena_free(
+     assorted_arena_t **arena,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		assorted_arena_free_overflow_blocks(
+		 *arena );
+
+		if( ( *arena )->overflow_blocks != NULL )
+		{
+			memory_free(
+			 ( *arena )->overflow_blocks );
+		}
+		if( ( *arena )->data != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *arena )->data );
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Allocates memory from an arena
+ * The memory is aligned to ASSORTED_ARENA_ALIGNMENT bytes and is not cleared,
+ * it remains valid until the arena is rewound past it, reset or freed
+ * If the slab is exhausted the memory is allocated separately and the slab
+ * is grown on the next reset
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_arena_allocate(
+     assorted_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error )
+{
+	void *block           = NULL;
+	void *reallocation    = NULL;
+	static char *function = "assorted_arena_allocate";
+	size_t aligned_size   = 0;
+	int blocks_size       = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	/* A 0-byte allocation is given a distinct non-NULL address
+	 */
+	if( size == 0 )
+	{
+		aligned_size = ASSORTED_ARENA_ALIGNMENT;
+	}
+	else
+	{
+		aligned_size = ( size + ( ASSORTED_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) ASSORTED_ARENA_ALIGNMENT - 1 );
+	}
+
+	if( aligned_size <= ( arena->data_size - arena->data_offset ) )
+	{
+		*memory = &( arena->data[ arena->data_offset ] );
+
+		arena->data_offset += aligned_size;
+
+		if( arena->data_offset > arena->maximum_data_offset )
+		{
+			arena->maximum_data_offset = arena->data_offset;
+		}
+		return( 1 );
+	}
+	if( arena->number_of_overflow_blocks >= arena->overflow_blocks_size )
+	{
+		if( arena->overflow_blocks_size == 0 )
+		{
+			blocks_size = 8;
+		}
+		else if( arena->overflow_blocks_size < ( INT_MAX / 2 ) )
+		{
+			blocks_size = arena->overflow_blocks_size * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of overflow blocks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                arena->overflow_blocks,
+		                sizeof( void * ) * blocks_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize overflow blocks.",
+			 function );
+
+			return( -1 );
+		}
+		arena->overflow_blocks      = (void **) reallocation;
+		arena->overflow_blocks_size = blocks_size;
+	}
+	block = memory_allocate(
+	         aligned_size );
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create overflow block.",
+		 function );
+
+		return( -1 );
+	}
+	arena->overflow_blocks[ arena->number_of_overflow_blocks++ ] = block;
+
+	arena->overflow_size += aligned_size;
+
+	*memory = block;
+
+	return( 1 );
+}
+
+/* Rewinds the slab of an arena to a previous data offset
+ * The memory allocated from the slab after the data offset can be reused,
+ * overflow blocks are kept until the next reset
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_arena_rewind(
+     assorted_arena_t *arena,
+     size_t data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_arena_rewind";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset > arena->data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	arena->data_offset = data_offset;
+
+	return( 1 );
+}
+
+/* Resets an arena, which invalidates all memory allocated from it
+ * If allocations did not fit in the slab since the last reset, the slab is
+ * grown so that the same allocations fit in the slab the next time
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_arena_reset(
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_arena_reset";
+	size_t data_size      = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	assorted_arena_free_overflow_blocks(
+	 arena );
+
+	if( arena->overflow_size > 0 )
+	{
+		if( arena->overflow_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - arena->maximum_data_offset ) )
+		{
+			data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+		}
+		else
+		{
+			data_size = arena->maximum_data_offset + arena->overflow_size;
+		}
+		/* The slab is replaced instead of reallocated since its data does not need to be preserved
+		 */
+		if( arena->data != NULL )
+		{
+			assorted_aligned_memory_free(
+			 arena->data );
+
+			arena->data      = NULL;
+			arena->data_size = 0;
+		}
+		arena->data = (uint8_t *) assorted_aligned_memory_allocate(
+		                           sizeof( uint8_t ) * data_size );
+
+		if( arena->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			arena->data_offset         = 0;
+			arena->maximum_data_offset = 0;
+			arena->overflow_size       = 0;
+
+			return( -1 );
+		}
+		arena->data_size = data_size;
+	}
+	arena->data_offset         = 0;
+	arena->maximum_data_offset = 0;
+	arena->overflow_size       = 0;
+
+	return( 1 );
+}
+
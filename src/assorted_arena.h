@@ -0,0 +1,104 @@
+/*
+ * Arena (bump) allocator functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_ARENA_H )
+#define _ASSORTED_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the allocations of an arena
+ */
+#define ASSORTED_ARENA_ALIGNMENT	16
+
+typedef struct assorted_arena assorted_arena_t;
+
+struct assorted_arena
+{
+	/* The slab
+	 */
+	uint8_t *data;
+
+	/* The slab size
+	 */
+	size_t data_size;
+
+	/* The offset of the next allocation in the slab
+	 */
+	size_t data_offset;
+
+	/* The largest slab offset since the last reset
+	 */
+	size_t maximum_data_offset;
+
+	/* The allocations that did not fit in the slab
+	 */
+	void **overflow_blocks;
+
+	/* The number of overflow blocks
+	 */
+	int number_of_overflow_blocks;
+
+	/* The number of overflow blocks allocated
+	 */
+	int overflow_blocks_size;
+
+	/* The size of the overflow blocks since the last reset
+	 */
+	size_t overflow_size;
+};
+
+int assorted_arena_initialize(
+     assorted_arena_t **arena,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int assorted_arena_free(
+     assorted_arena_t **arena,
+     libcerror_error_t **error );
+
+int assorted_arena_allocate(
+     assorted_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error );
+
+int assorted_arena_rewind(
+     assorted_arena_t *arena,
+     size_t data_offset,
+     libcerror_error_t **error );
+
+int assorted_arena_reset(
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_ARENA_H ) */
+
@@ -23,8 +23,608 @@
 #include <types.h>
 
 #include "assorted_ascii7.h"
+#include "assorted_cpu_features.h"
 #include "assorted_libcerror.h"
 
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_ASCII7_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
+/* Determines the SIMD method supported by the CPU
+ * Returns the SIMD method
+ */
+int assorted_ascii7_get_simd_method(
+     void )
+{
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 ) || defined( ASSORTED_ASCII7_HAVE_NEON )
+	uint32_t cpu_features = 0;
+#endif
+	int simd_method       = ASSORTED_ASCII7_SIMD_METHOD_NONE;
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_SSSE3 ) != 0 )
+	{
+		simd_method = ASSORTED_ASCII7_SIMD_METHOD_SSSE3;
+	}
+#elif defined( ASSORTED_ASCII7_HAVE_NEON )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_NEON ) != 0 )
+	{
+		simd_method = ASSORTED_ASCII7_SIMD_METHOD_NEON;
+	}
+#endif
+	return( simd_method );
+}
+
+/* Every 7 compressed bytes contain 8 septets, where septet N is stored in
+ * bits 7 * N to 7 * N + 6 of the 56-bit little-endian value. The SIMD kernels
+ * shuffle the 2 bytes that contain a septet into a 16-bit lane and shift the
+ * septet into the lower 7 bits of the lane, that is 16 septets from 14 bytes
+ * per 128-bit vector. The last vector of a 56-byte block is loaded at offset 40
+ * instead of 42 to prevent reading beyond the block.
+ */
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 )
+
+/* Unpacks ASCII 7-bit compressed data using SSSE3, 56 bytes per iteration
+ * The compressed data size must be a multiple of 56, every 7 compressed bytes
+ * are unpacked into 8 uncompressed bytes
+ */
+__attribute__ ((target ("ssse3"))) void assorted_ascii7_simd_ssse3(
+                                         const uint8_t *compressed_data,
+                                         size_t compressed_data_size,
+                                         uint8_t *uncompressed_data )
+{
+	/* The high byte of the last septet of a group is not used
+	 */
+	__m128i lower_shuffle_128bit   = _mm_setr_epi8( 0, 1, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, -128 );
+	__m128i upper_shuffle_128bit   = _mm_setr_epi8( 7, 8, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, -128 );
+	__m128i lower_shuffle2_128bit  = _mm_setr_epi8( 2, 3, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, -128 );
+	__m128i upper_shuffle2_128bit  = _mm_setr_epi8( 9, 10, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, -128 );
+	__m128i multipliers_128bit     = _mm_setr_epi16( 256, 2, 4, 8, 16, 32, 64, 128 );
+	__m128i septet_mask_128bit     = _mm_set1_epi8( 0x7f );
+	__m128i lower_128bit;
+	__m128i upper_128bit;
+	__m128i value_128bit;
+
+	size_t vector_index = 0;
+
+	while( compressed_data_size >= ASSORTED_ASCII7_SIMD_BLOCK_SIZE )
+	{
+		for( vector_index = 0;
+		     vector_index < 4;
+		     vector_index++ )
+		{
+			if( vector_index < 3 )
+			{
+				value_128bit = _mm_loadu_si128( (const __m128i *) &( compressed_data[ vector_index * 14 ] ) );
+
+				lower_128bit = _mm_shuffle_epi8( value_128bit, lower_shuffle_128bit );
+				upper_128bit = _mm_shuffle_epi8( value_128bit, upper_shuffle_128bit );
+			}
+			else
+			{
+				value_128bit = _mm_loadu_si128( (const __m128i *) &( compressed_data[ 40 ] ) );
+
+				lower_128bit = _mm_shuffle_epi8( value_128bit, lower_shuffle2_128bit );
+				upper_128bit = _mm_shuffle_epi8( value_128bit, upper_shuffle2_128bit );
+			}
+			/* Shift the septet of every lane into bits 8 to 14 by multiplying
+			 * with 2 ^ ( 8 - shift ) and then shift it into the lower byte
+			 */
+			lower_128bit = _mm_srli_epi16( _mm_mullo_epi16( lower_128bit, multipliers_128bit ), 8 );
+			upper_128bit = _mm_srli_epi16( _mm_mullo_epi16( upper_128bit, multipliers_128bit ), 8 );
+
+			value_128bit = _mm_and_si128( _mm_packus_epi16( lower_128bit, upper_128bit ), septet_mask_128bit );
+
+			_mm_storeu_si128( (__m128i *) &( uncompressed_data[ vector_index * 16 ] ), value_128bit );
+		}
+		compressed_data      += ASSORTED_ASCII7_SIMD_BLOCK_SIZE;
+		compressed_data_size -= ASSORTED_ASCII7_SIMD_BLOCK_SIZE;
+		uncompressed_data    += 64;
+	}
+}
+
+#endif /* defined( ASSORTED_ASCII7_HAVE_SSSE3 ) */
+
+#if defined( ASSORTED_ASCII7_HAVE_NEON )
+
+/* Unpacks ASCII 7-bit compressed data using NEON, 56 bytes per iteration
+ * The compressed data size must be a multiple of 56, every 7 compressed bytes
+ * are unpacked into 8 uncompressed bytes
+ */
+void assorted_ascii7_simd_neon(
+      const uint8_t *compressed_data,
+      size_t compressed_data_size,
+      uint8_t *uncompressed_data )
+{
+	/* The high byte of the last septet of a group is not used, out of range indexes result in 0
+	 */
+	static const uint8_t lower_shuffle[ 16 ]  = { 0, 1, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 0xff };
+	static const uint8_t upper_shuffle[ 16 ]  = { 7, 8, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 0xff };
+	static const uint8_t lower_shuffle2[ 16 ] = { 2, 3, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 0xff };
+	static const uint8_t upper_shuffle2[ 16 ] = { 9, 10, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 0xff };
+	static const int16_t shifts[ 8 ]          = { 0, -7, -6, -5, -4, -3, -2, -1 };
+
+	uint8x16_t lower_shuffle_128bit  = vld1q_u8( lower_shuffle );
+	uint8x16_t upper_shuffle_128bit  = vld1q_u8( upper_shuffle );
+	uint8x16_t lower_shuffle2_128bit = vld1q_u8( lower_shuffle2 );
+	uint8x16_t upper_shuffle2_128bit = vld1q_u8( upper_shuffle2 );
+	int16x8_t shifts_128bit          = vld1q_s16( shifts );
+	uint8x16_t septet_mask_128bit    = vdupq_n_u8( 0x7f );
+	uint16x8_t lower_128bit;
+	uint16x8_t upper_128bit;
+	uint8x16_t value_128bit;
+
+	size_t vector_index = 0;
+
+	while( compressed_data_size >= ASSORTED_ASCII7_SIMD_BLOCK_SIZE )
+	{
+		for( vector_index = 0;
+		     vector_index < 4;
+		     vector_index++ )
+		{
+			if( vector_index < 3 )
+			{
+				value_128bit = vld1q_u8( &( compressed_data[ vector_index * 14 ] ) );
+
+				lower_128bit = vreinterpretq_u16_u8( vqtbl1q_u8( value_128bit, lower_shuffle_128bit ) );
+				upper_128bit = vreinterpretq_u16_u8( vqtbl1q_u8( value_128bit, upper_shuffle_128bit ) );
+			}
+			else
+			{
+				value_128bit = vld1q_u8( &( compressed_data[ 40 ] ) );
+
+				lower_128bit = vreinterpretq_u16_u8( vqtbl1q_u8( value_128bit, lower_shuffle2_128bit ) );
+				upper_128bit = vreinterpretq_u16_u8( vqtbl1q_u8( value_128bit, upper_shuffle2_128bit ) );
+			}
+			/* A negative shift count shifts right
+			 */
+			lower_128bit = vshlq_u16( lower_128bit, shifts_128bit );
+			upper_128bit = vshlq_u16( upper_128bit, shifts_128bit );
+
+			value_128bit = vandq_u8( vcombine_u8( vmovn_u16( lower_128bit ), vmovn_u16( upper_128bit ) ), septet_mask_128bit );
+
+			vst1q_u8( &( uncompressed_data[ vector_index * 16 ] ), value_128bit );
+		}
+		compressed_data      += ASSORTED_ASCII7_SIMD_BLOCK_SIZE;
+		compressed_data_size -= ASSORTED_ASCII7_SIMD_BLOCK_SIZE;
+		uncompressed_data    += 64;
+	}
+}
+
+#endif /* defined( ASSORTED_ASCII7_HAVE_NEON ) */
+
+/* The SIMD packing kernels do the reverse of the unpacking kernels, they merge
+ * the septets of adjacent lanes with increasingly wider lanes: 2 septets into
+ * 14 bits of a 16-bit lane, 4 septets into 28 bits of a 32-bit lane and 8 septets
+ * into 56 bits of a 64-bit lane. The 7 bytes of every 64-bit lane are gathered
+ * into the lower 14 bytes of the vector and 4 of these vectors are concatenated
+ * into a 56-byte block.
+ */
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 )
+
+/* Packs 16 septets into the lower 14 bytes of a vector using SSSE3
+ */
+__attribute__ ((target ("ssse3"))) static inline __m128i assorted_ascii7_pack_vector_ssse3(
+                                                         __m128i value_128bit )
+{
+	__m128i septet_mask_128bit     = _mm_set1_epi8( 0x7f );
+	__m128i lower_mask_16bit       = _mm_set1_epi16( 0x007f );
+	__m128i upper_mask_16bit       = _mm_set1_epi16( 0x3f80 );
+	__m128i multipliers_128bit     = _mm_setr_epi16( 1, 16384, 1, 16384, 1, 16384, 1, 16384 );
+	__m128i lower_mask_64bit       = _mm_set1_epi64x( 0x000000000fffffffULL );
+	__m128i upper_mask_64bit       = _mm_set1_epi64x( 0x00fffffff0000000ULL );
+	__m128i gather_shuffle_128bit  = _mm_setr_epi8( 0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, -128, -128 );
+
+	value_128bit = _mm_and_si128( value_128bit, septet_mask_128bit );
+
+	/* Merge 2 septets into 14 bits of a 16-bit lane
+	 */
+	value_128bit = _mm_or_si128(
+	                _mm_and_si128( value_128bit, lower_mask_16bit ),
+	                _mm_and_si128( _mm_srli_epi16( value_128bit, 1 ), upper_mask_16bit ) );
+
+	/* Merge 2 16-bit lanes into 28 bits of a 32-bit lane by multiplying the upper
+	 * lane with 2 ^ 14 and adding it to the lower lane
+	 */
+	value_128bit = _mm_madd_epi16( value_128bit, multipliers_128bit );
+
+	/* Merge 2 32-bit lanes into 56 bits of a 64-bit lane
+	 */
+	value_128bit = _mm_or_si128(
+	                _mm_and_si128( value_128bit, lower_mask_64bit ),
+	                _mm_and_si128( _mm_srli_epi64( value_128bit, 4 ), upper_mask_64bit ) );
+
+	return( _mm_shuffle_epi8( value_128bit, gather_shuffle_128bit ) );
+}
+
+/* Packs uncompressed data into ASCII 7-bit compressed data using SSSE3, 64 bytes per iteration
+ * The uncompressed data size must be a multiple of 64, every 8 uncompressed bytes
+ * are packed into 7 compressed bytes
+ * Returns 0x80 if any of the uncompressed bytes has the most significant bit set or 0 otherwise
+ */
+__attribute__ ((target ("ssse3"))) uint8_t assorted_ascii7_pack_simd_ssse3(
+                                            const uint8_t *uncompressed_data,
+                                            size_t uncompressed_data_size,
+                                            uint8_t *compressed_data )
+{
+	__m128i combined_128bit = _mm_setzero_si128();
+	__m128i packed_128bit[ 4 ];
+	__m128i value_128bit;
+
+	size_t vector_index = 0;
+
+	while( uncompressed_data_size >= 64 )
+	{
+		for( vector_index = 0;
+		     vector_index < 4;
+		     vector_index++ )
+		{
+			value_128bit = _mm_loadu_si128( (const __m128i *) &( uncompressed_data[ vector_index * 16 ] ) );
+
+			combined_128bit = _mm_or_si128( combined_128bit, value_128bit );
+
+			packed_128bit[ vector_index ] = assorted_ascii7_pack_vector_ssse3( value_128bit );
+		}
+		/* Concatenate the 14 bytes of the 4 vectors into 56 bytes
+		 */
+		value_128bit = _mm_or_si128( packed_128bit[ 0 ], _mm_slli_si128( packed_128bit[ 1 ], 14 ) );
+
+		_mm_storeu_si128( (__m128i *) &( compressed_data[ 0 ] ), value_128bit );
+
+		value_128bit = _mm_or_si128( _mm_srli_si128( packed_128bit[ 1 ], 2 ), _mm_slli_si128( packed_128bit[ 2 ], 12 ) );
+
+		_mm_storeu_si128( (__m128i *) &( compressed_data[ 16 ] ), value_128bit );
+
+		value_128bit = _mm_or_si128( _mm_srli_si128( packed_128bit[ 2 ], 4 ), _mm_slli_si128( packed_128bit[ 3 ], 10 ) );
+
+		_mm_storeu_si128( (__m128i *) &( compressed_data[ 32 ] ), value_128bit );
+
+		value_128bit = _mm_srli_si128( packed_128bit[ 3 ], 6 );
+
+		_mm_storel_epi64( (__m128i *) &( compressed_data[ 48 ] ), value_128bit );
+
+		uncompressed_data      += 64;
+		uncompressed_data_size -= 64;
+		compressed_data        += ASSORTED_ASCII7_SIMD_BLOCK_SIZE;
+	}
+	if( _mm_movemask_epi8( combined_128bit ) != 0 )
+	{
+		return( 0x80 );
+	}
+	return( 0 );
+}
+
+#endif /* defined( ASSORTED_ASCII7_HAVE_SSSE3 ) */
+
+#if defined( ASSORTED_ASCII7_HAVE_NEON )
+
+/* Packs 16 septets into the lower 14 bytes of a vector using NEON
+ */
+static inline uint8x16_t assorted_ascii7_pack_vector_neon(
+                          uint8x16_t value_128bit,
+                          uint8x16_t gather_shuffle_128bit )
+{
+	uint16x8_t value_16bit;
+	uint32x4_t value_32bit;
+	uint64x2_t value_64bit;
+
+	value_128bit = vandq_u8( value_128bit, vdupq_n_u8( 0x7f ) );
+
+	/* Shift and insert the upper part of every lane next to the lower part,
+	 * which merges 2 septets into 14 bits, 4 into 28 bits and 8 into 56 bits
+	 */
+	value_16bit = vreinterpretq_u16_u8( value_128bit );
+	value_16bit = vsliq_n_u16( value_16bit, vshrq_n_u16( value_16bit, 8 ), 7 );
+
+	value_32bit = vreinterpretq_u32_u16( value_16bit );
+	value_32bit = vsliq_n_u32( value_32bit, vshrq_n_u32( value_32bit, 16 ), 14 );
+
+	value_64bit = vreinterpretq_u64_u32( value_32bit );
+	value_64bit = vsliq_n_u64( value_64bit, vshrq_n_u64( value_64bit, 32 ), 28 );
+
+	return( vqtbl1q_u8( vreinterpretq_u8_u64( value_64bit ), gather_shuffle_128bit ) );
+}
+
+/* Packs uncompressed data into ASCII 7-bit compressed data using NEON, 64 bytes per iteration
+ * The uncompressed data size must be a multiple of 64, every 8 uncompressed bytes
+ * are packed into 7 compressed bytes
+ * Returns 0x80 if any of the uncompressed bytes has the most significant bit set or 0 otherwise
+ */
+uint8_t assorted_ascii7_pack_simd_neon(
+         const uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         uint8_t *compressed_data )
+{
+	/* Out of range indexes result in 0
+	 */
+	static const uint8_t gather_shuffle[ 16 ] = { 0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 0xff, 0xff };
+
+	uint8x16_t gather_shuffle_128bit = vld1q_u8( gather_shuffle );
+	uint8x16_t combined_128bit       = vdupq_n_u8( 0 );
+	uint8x16_t zero_128bit           = vdupq_n_u8( 0 );
+	uint8x16_t packed_128bit[ 4 ];
+	uint8x16_t value_128bit;
+
+	size_t vector_index = 0;
+
+	while( uncompressed_data_size >= 64 )
+	{
+		for( vector_index = 0;
+		     vector_index < 4;
+		     vector_index++ )
+		{
+			value_128bit = vld1q_u8( &( uncompressed_data[ vector_index * 16 ] ) );
+
+			combined_128bit = vorrq_u8( combined_128bit, value_128bit );
+
+			packed_128bit[ vector_index ] = assorted_ascii7_pack_vector_neon(
+			                                 value_128bit,
+			                                 gather_shuffle_128bit );
+		}
+		/* Concatenate the 14 bytes of the 4 vectors into 56 bytes
+		 */
+		value_128bit = vorrq_u8( packed_128bit[ 0 ], vextq_u8( zero_128bit, packed_128bit[ 1 ], 2 ) );
+
+		vst1q_u8( &( compressed_data[ 0 ] ), value_128bit );
+
+		value_128bit = vorrq_u8( vextq_u8( packed_128bit[ 1 ], zero_128bit, 2 ), vextq_u8( zero_128bit, packed_128bit[ 2 ], 4 ) );
+
+		vst1q_u8( &( compressed_data[ 16 ] ), value_128bit );
+
+		value_128bit = vorrq_u8( vextq_u8( packed_128bit[ 2 ], zero_128bit, 4 ), vextq_u8( zero_128bit, packed_128bit[ 3 ], 6 ) );
+
+		vst1q_u8( &( compressed_data[ 32 ] ), value_128bit );
+
+		value_128bit = vextq_u8( packed_128bit[ 3 ], zero_128bit, 6 );
+
+		vst1_u8( &( compressed_data[ 48 ] ), vget_low_u8( value_128bit ) );
+
+		uncompressed_data      += 64;
+		uncompressed_data_size -= 64;
+		compressed_data        += ASSORTED_ASCII7_SIMD_BLOCK_SIZE;
+	}
+	return( vmaxvq_u8( combined_128bit ) & 0x80 );
+}
+
+#endif /* defined( ASSORTED_ASCII7_HAVE_NEON ) */
+
+/* Determines the compressed data size of ASCII 7-bit compressed data
+ * Return 1 on success or -1 on error
+ */
+int assorted_ascii7_get_compressed_data_size(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_ascii7_get_compressed_data_size";
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first byte is stored as-is, the remaining bytes as septets
+	 */
+	*compressed_data_size = 1 + ( ( uncompressed_data_size - 1 ) / 8 ) * 7 + ( ( ( ( uncompressed_data_size - 1 ) % 8 ) * 7 ) + 7 ) / 8;
+
+	return( 1 );
+}
+
+/* Compresses data using ASCII 7-bit compression
+ * The first byte is stored as-is, every other byte must be 7-bit ASCII
+ * Note that when the number of septets modulo 8 is 7, the padding contains
+ * a complete septet, which decompresses as a trailing 0-byte
+ * Returns 1 on success or -1 on error
+ */
+int assorted_ascii7_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "assorted_ascii7_compress";
+	size_t compressed_data_offset    = 0;
+	size_t required_data_size        = 0;
+	size_t uncompressed_data_offset  = 0;
+	uint16_t value_16bit             = 0;
+	uint8_t bit_index                = 0;
+	uint8_t byte_value               = 0;
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 ) || defined( ASSORTED_ASCII7_HAVE_NEON )
+	size_t simd_data_size            = 0;
+	int simd_method                  = 0;
+	uint8_t combined_value           = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_ascii7_get_compressed_data_size(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *compressed_data_size < required_data_size )
+	 || ( *compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data[ compressed_data_offset++ ] = uncompressed_data[ 0 ];
+
+	uncompressed_data_offset = 1;
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 ) || defined( ASSORTED_ASCII7_HAVE_NEON )
+	/* Every SIMD block ends on a byte boundary, hence the byte for byte
+	 * packing continues with an empty bit buffer after the blocks
+	 */
+	simd_data_size = uncompressed_data_size - 1;
+	simd_data_size = simd_data_size - ( simd_data_size % 64 );
+
+	if( simd_data_size > 0 )
+	{
+		simd_method = assorted_ascii7_get_simd_method();
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 )
+		if( simd_method == ASSORTED_ASCII7_SIMD_METHOD_SSSE3 )
+		{
+			combined_value = assorted_ascii7_pack_simd_ssse3(
+			                  &( uncompressed_data[ uncompressed_data_offset ] ),
+			                  simd_data_size,
+			                  &( compressed_data[ compressed_data_offset ] ) );
+		}
+#endif
+#if defined( ASSORTED_ASCII7_HAVE_NEON )
+		if( simd_method == ASSORTED_ASCII7_SIMD_METHOD_NEON )
+		{
+			combined_value = assorted_ascii7_pack_simd_neon(
+			                  &( uncompressed_data[ uncompressed_data_offset ] ),
+			                  simd_data_size,
+			                  &( compressed_data[ compressed_data_offset ] ) );
+		}
+#endif
+		if( ( combined_value & 0x80 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported uncompressed data value - not 7-bit ASCII.",
+			 function );
+
+			return( -1 );
+		}
+		if( simd_method != ASSORTED_ASCII7_SIMD_METHOD_NONE )
+		{
+			uncompressed_data_offset += simd_data_size;
+			compressed_data_offset   += ( simd_data_size / 8 ) * 7;
+		}
+	}
+#endif /* defined( ASSORTED_ASCII7_HAVE_SSSE3 ) || defined( ASSORTED_ASCII7_HAVE_NEON ) */
+
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		byte_value = uncompressed_data[ uncompressed_data_offset++ ];
+
+		if( ( byte_value & 0x80 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported uncompressed data value - not 7-bit ASCII.",
+			 function );
+
+			return( -1 );
+		}
+		value_16bit |= (uint16_t) byte_value << bit_index;
+
+		bit_index += 7;
+
+		if( bit_index >= 8 )
+		{
+			compressed_data[ compressed_data_offset++ ] = (uint8_t) ( value_16bit & 0xff );
+
+			value_16bit >>= 8;
+
+			bit_index -= 8;
+		}
+	}
+	if( bit_index > 0 )
+	{
+		compressed_data[ compressed_data_offset++ ] = (uint8_t) ( value_16bit & 0xff );
+	}
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+}
+
 /* Determines the uncompressed data size from the ASCII 7-bit compressed data
  * Return 1 on success or -1 on error
  */
@@ -102,6 +702,11 @@ int assorted_ascii7_decompress(
 	uint16_t value_16bit               = 0;
 	uint8_t bit_index                  = 0;
 
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 ) || defined( ASSORTED_ASCII7_HAVE_NEON )
+	size_t simd_data_size              = 0;
+	int simd_method                    = 0;
+#endif
+
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -162,11 +767,50 @@ int assorted_ascii7_decompress(
 	}
 	uncompressed_data[ uncompressed_data_offset++ ] = compressed_data[ 0 ];
 
-	for( compressed_data_offset = 1;
-	     compressed_data_offset < compressed_data_size;
-	     compressed_data_offset++ )
+	compressed_data_offset = 1;
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 ) || defined( ASSORTED_ASCII7_HAVE_NEON )
+	/* The 7-byte groups of the SIMD blocks are independent, hence the byte
+	 * for byte unpacking continues at the start of a group after the blocks
+	 */
+	if( compressed_data_size > 1 )
+	{
+		simd_data_size = compressed_data_size - 1;
+		simd_data_size = simd_data_size - ( simd_data_size % ASSORTED_ASCII7_SIMD_BLOCK_SIZE );
+	}
+	if( simd_data_size > 0 )
+	{
+		simd_method = assorted_ascii7_get_simd_method();
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 )
+		if( simd_method == ASSORTED_ASCII7_SIMD_METHOD_SSSE3 )
+		{
+			assorted_ascii7_simd_ssse3(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 simd_data_size,
+			 &( uncompressed_data[ uncompressed_data_offset ] ) );
+		}
+#endif
+#if defined( ASSORTED_ASCII7_HAVE_NEON )
+		if( simd_method == ASSORTED_ASCII7_SIMD_METHOD_NEON )
+		{
+			assorted_ascii7_simd_neon(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 simd_data_size,
+			 &( uncompressed_data[ uncompressed_data_offset ] ) );
+		}
+#endif
+		if( simd_method != ASSORTED_ASCII7_SIMD_METHOD_NONE )
+		{
+			compressed_data_offset   += simd_data_size;
+			uncompressed_data_offset += ( simd_data_size / 7 ) * 8;
+		}
+	}
+#endif /* defined( ASSORTED_ASCII7_HAVE_SSSE3 ) || defined( ASSORTED_ASCII7_HAVE_NEON ) */
+
+	while( compressed_data_offset < compressed_data_size )
 	{
-		value_16bit |= (uint16_t) compressed_data[ compressed_data_offset ] << bit_index;
+		value_16bit |= (uint16_t) compressed_data[ compressed_data_offset++ ] << bit_index;
 
 		uncompressed_data[ uncompressed_data_offset++ ] = (uint8_t) ( value_16bit & 0x7f );
 
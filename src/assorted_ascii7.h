@@ -31,6 +31,81 @@
 extern "C" {
 #endif
 
+/* The SIMD kernels are available with GCC compatible compilers on x86
+ * and on little-endian ARMv8, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define ASSORTED_ASCII7_HAVE_SSSE3
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ )
+#define ASSORTED_ASCII7_HAVE_NEON
+
+#endif
+
+/* The number of compressed bytes processed per SIMD block
+ * which unpack into 64 uncompressed bytes
+ */
+#define ASSORTED_ASCII7_SIMD_BLOCK_SIZE		56
+
+enum ASSORTED_ASCII7_SIMD_METHODS
+{
+	ASSORTED_ASCII7_SIMD_METHOD_NONE	= 0x00,
+	ASSORTED_ASCII7_SIMD_METHOD_SSSE3	= 0x01,
+	ASSORTED_ASCII7_SIMD_METHOD_NEON	= 0x02
+};
+
+int assorted_ascii7_get_simd_method(
+     void );
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 )
+
+void assorted_ascii7_simd_ssse3(
+      const uint8_t *compressed_data,
+      size_t compressed_data_size,
+      uint8_t *uncompressed_data );
+
+#endif /* defined( ASSORTED_ASCII7_HAVE_SSSE3 ) */
+
+#if defined( ASSORTED_ASCII7_HAVE_NEON )
+
+void assorted_ascii7_simd_neon(
+      const uint8_t *compressed_data,
+      size_t compressed_data_size,
+      uint8_t *uncompressed_data );
+
+#endif /* defined( ASSORTED_ASCII7_HAVE_NEON ) */
+
+#if defined( ASSORTED_ASCII7_HAVE_SSSE3 )
+
+uint8_t assorted_ascii7_pack_simd_ssse3(
+         const uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         uint8_t *compressed_data );
+
+#endif /* defined( ASSORTED_ASCII7_HAVE_SSSE3 ) */
+
+#if defined( ASSORTED_ASCII7_HAVE_NEON )
+
+uint8_t assorted_ascii7_pack_simd_neon(
+         const uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         uint8_t *compressed_data );
+
+#endif /* defined( ASSORTED_ASCII7_HAVE_NEON ) */
+
+int assorted_ascii7_get_compressed_data_size(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_ascii7_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
 int assorted_ascii7_get_uncompressed_data_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -0,0 +1,1738 @@
+/*
+ * Asynchronous direct I/O file functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* O_DIRECT is only defined by glibc if _GNU_SOURCE is defined
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_async_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_unused.h"
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* Creates an asynchronous file
+ * Make sure the value async_file is referencing, is set to NULL
+ * The buffers of the queue_depth chunks of chunk_size are allocated here
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_async_file_initialize(
+     assorted_async_file_t **async_file,
+     size_t chunk_size,
+     int queue_depth,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_async_file_initialize";
+	uint8_t *buffers      = NULL;
+	size_t alignment_size = 0;
+	int slot_index        = 0;
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) ASSORTED_ASYNC_FILE_MAXIMUM_CHUNK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth < 1 )
+	 || ( queue_depth > ASSORTED_ASYNC_FILE_MAXIMUM_QUEUE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*async_file = memory_allocate_structure(
+	               assorted_async_file_t );
+
+	if( *async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create asynchronous file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *async_file,
+	     0,
+	     sizeof( assorted_async_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear asynchronous file.",
+		 function );
+
+		memory_free(
+		 *async_file );
+
+		*async_file = NULL;
+
+		return( -1 );
+	}
+	/* A chunk is read as the aligned blocks that contain it, which requires
+	 * at most one block more than the chunk size rounded up to the alignment
+	 */
+	( *async_file )->chunk_size  = chunk_size;
+	( *async_file )->queue_depth = queue_depth;
+	( *async_file )->buffer_size = ( ( chunk_size + ASSORTED_ASYNC_FILE_ALIGNMENT - 1 ) / ASSORTED_ASYNC_FILE_ALIGNMENT + 1 ) * ASSORTED_ASYNC_FILE_ALIGNMENT;
+
+	if( ( *async_file )->buffer_size > ( ( (size_t) SSIZE_MAX - ASSORTED_ASYNC_FILE_ALIGNMENT ) / queue_depth ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffers size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	( *async_file )->buffers_memory = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * ( ( *async_file )->buffer_size * queue_depth + ASSORTED_ASYNC_FILE_ALIGNMENT ) );
+
+	if( ( *async_file )->buffers_memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	( *async_file )->slots = (assorted_async_file_slot_t *) memory_allocate(
+	                                                         sizeof( assorted_async_file_slot_t ) * queue_depth );
+
+	if( ( *async_file )->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *async_file )->slots,
+	     0,
+	     sizeof( assorted_async_file_slot_t ) * queue_depth ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		goto on_error;
+	}
+	alignment_size = (size_t) ( (intptr_t) ( *async_file )->buffers_memory % ASSORTED_ASYNC_FILE_ALIGNMENT );
+
+	if( alignment_size != 0 )
+	{
+		alignment_size = ASSORTED_ASYNC_FILE_ALIGNMENT - alignment_size;
+	}
+	buffers = &( ( ( *async_file )->buffers_memory )[ alignment_size ] );
+
+	for( slot_index = 0;
+	     slot_index < queue_depth;
+	     slot_index++ )
+	{
+		( *async_file )->slots[ slot_index ].buffer = &( buffers[ ( *async_file )->buffer_size * slot_index ] );
+	}
+	( *async_file )->returned_slot_index = -1;
+
+#if defined( WINAPI )
+	( *async_file )->file_handle = INVALID_HANDLE_VALUE;
+
+#elif defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	( *async_file )->file_descriptor      = -1;
+	( *async_file )->ring_file_descriptor = -1;
+#endif
+	return( 1 );
+
+on_error:
+	if( *async_file != NULL )
+	{
+		if( ( *async_file )->slots != NULL )
+		{
+			memory_free(
+			 ( *async_file )->slots );
+		}
+		if( ( *async_file )->buffers_memory != NULL )
+		{
+			memory_free(
+			 ( *async_file )->buffers_memory );
+		}
+		memory_free(
+		 *async_file );
+
+		*async_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an asynchronous file
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_async_file_free(
+     assorted_async_file_t **async_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_async_file_free";
+	int result            = 1;
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_file != NULL )
+	{
+		if( assorted_async_file_close(
+		     *async_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close asynchronous file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *async_file )->slots );
+
+		memory_free(
+		 ( *async_file )->buffers_memory );
+
+		memory_free(
+		 *async_file );
+
+		*async_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a part of a file for asynchronous reading
+ * The file is opened for direct I/O that bypasses the file cache when the file system
+ * supports it, where a size of 0 represents the remainder of the file from the offset.
+ * The reads of the first queue depth chunks are started before returning
+ * Returns 1 if successful, 0 if asynchronous reading is not supported or -1 on error
+ */
+int assorted_async_file_open(
+     assorted_async_file_t *async_file,
+     const system_character_t *filename,
+     off64_t offset,
+     size64_t size ASSORTED_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER large_integer;
+
+#elif defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	struct stat file_statistics;
+
+#endif
+	static char *function = "assorted_async_file_open";
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC )
+	size64_t file_size    = 0;
+	int slot_index        = 0;
+#endif
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	int result            = 0;
+#endif
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_file->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous file - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC )
+	ASSORTED_UNREFERENCED_PARAMETER( size )
+
+	return( 0 );
+#else
+#if defined( WINAPI )
+	/* Reads without buffering must be aligned to the sector size in both
+	 * the file offset and the memory, which the slot buffers are
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	async_file->file_handle = CreateFileW(
+	                           (LPCWSTR) filename,
+	                           GENERIC_READ,
+	                           FILE_SHARE_READ,
+	                           NULL,
+	                           OPEN_EXISTING,
+	                           FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED | FILE_FLAG_NO_BUFFERING,
+	                           NULL );
+#else
+	async_file->file_handle = CreateFileA(
+	                           (LPCSTR) filename,
+	                           GENERIC_READ,
+	                           FILE_SHARE_READ,
+	                           NULL,
+	                           OPEN_EXISTING,
+	                           FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED | FILE_FLAG_NO_BUFFERING,
+	                           NULL );
+#endif
+	if( async_file->file_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	async_file->use_direct_io = 1;
+
+	if( GetFileSizeEx(
+	     async_file->file_handle,
+	     &large_integer ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	file_size = (size64_t) large_integer.QuadPart;
+
+	async_file->completion_port = CreateIoCompletionPort(
+	                               async_file->file_handle,
+	                               NULL,
+	                               0,
+	                               1 );
+
+	if( async_file->completion_port == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create I/O completion port.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	/* File systems that do not support direct I/O, such as tmpfs, fail the open with EINVAL
+	 * in which case the file is read through the file cache
+	 */
+#if defined( O_DIRECT )
+	async_file->file_descriptor = open(
+	                               (const char *) filename,
+	                               O_RDONLY | O_DIRECT );
+
+	if( async_file->file_descriptor != -1 )
+	{
+		async_file->use_direct_io = 1;
+	}
+	else if( errno == EINVAL )
+#endif
+	{
+		async_file->file_descriptor = open(
+		                               (const char *) filename,
+		                               O_RDONLY );
+	}
+	if( async_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( fstat(
+	     async_file->file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	file_size = (size64_t) file_statistics.st_size;
+#endif
+	if( (size64_t) offset >= file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( size == 0 )
+	{
+		size = file_size - (size64_t) offset;
+	}
+	if( size > ( file_size - (size64_t) offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	result = assorted_async_file_initialize_ring(
+	          async_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize io_uring.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* The kernel does not support io_uring or it is not permitted, such as
+		 * by a seccomp filter of a container
+		 */
+		assorted_async_file_close(
+		 async_file,
+		 NULL );
+
+		return( 0 );
+	}
+#endif
+	async_file->data_offset         = offset;
+	async_file->data_size           = size;
+	async_file->submit_offset       = 0;
+	async_file->next_slot_index     = 0;
+	async_file->returned_slot_index = -1;
+	async_file->remaining_data      = NULL;
+	async_file->remaining_data_size = 0;
+	async_file->is_open             = 1;
+
+	for( slot_index = 0;
+	     slot_index < async_file->queue_depth;
+	     slot_index++ )
+	{
+		if( async_file->submit_offset >= async_file->data_size )
+		{
+			break;
+		}
+		if( assorted_async_file_submit_read(
+		     async_file,
+		     slot_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to submit read of slot: %d.",
+			 function,
+			 slot_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	assorted_async_file_close(
+	 async_file,
+	 NULL );
+
+	return( -1 );
+
+#endif /* !defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC ) */
+}
+
+/* Closes an asynchronous file
+ * Reads that are still in progress are waited for, since they write into the slot buffers
+ * Returns 0 if successful or -1 on error
+ */
+int assorted_async_file_close(
+     assorted_async_file_t *async_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_async_file_close";
+	int result            = 0;
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC )
+	int number_of_pending = 0;
+	int slot_index        = 0;
+#endif
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC )
+	/* Completions of a closing file only mark the slot as unused
+	 */
+	async_file->is_open = 0;
+
+#if defined( WINAPI )
+	if( async_file->file_handle != INVALID_HANDLE_VALUE )
+	{
+		CancelIoEx(
+		 async_file->file_handle,
+		 NULL );
+	}
+#endif
+	do
+	{
+		number_of_pending = 0;
+
+		for( slot_index = 0;
+		     slot_index < async_file->queue_depth;
+		     slot_index++ )
+		{
+			if( async_file->slots[ slot_index ].status == ASSORTED_ASYNC_FILE_SLOT_STATUS_PENDING )
+			{
+				number_of_pending++;
+			}
+		}
+		if( number_of_pending > 0 )
+		{
+			if( assorted_async_file_wait_for_completions(
+			     async_file,
+			     NULL ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to wait for pending reads.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( number_of_pending > 0 );
+
+	for( slot_index = 0;
+	     slot_index < async_file->queue_depth;
+	     slot_index++ )
+	{
+		async_file->slots[ slot_index ].status = ASSORTED_ASYNC_FILE_SLOT_STATUS_UNUSED;
+	}
+#endif /* defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC ) */
+
+#if defined( WINAPI )
+	if( async_file->completion_port != NULL )
+	{
+		CloseHandle(
+		 async_file->completion_port );
+
+		async_file->completion_port = NULL;
+	}
+	if( async_file->file_handle != INVALID_HANDLE_VALUE )
+	{
+		if( CloseHandle(
+		     async_file->file_handle ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		async_file->file_handle = INVALID_HANDLE_VALUE;
+	}
+#elif defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	if( async_file->submission_entries != NULL )
+	{
+		munmap(
+		 async_file->submission_entries,
+		 async_file->submission_entries_size );
+
+		async_file->submission_entries = NULL;
+	}
+	if( async_file->submission_ring != NULL )
+	{
+		munmap(
+		 async_file->submission_ring,
+		 async_file->submission_ring_size );
+
+		async_file->submission_ring = NULL;
+	}
+	if( async_file->completion_ring != NULL )
+	{
+		munmap(
+		 async_file->completion_ring,
+		 async_file->completion_ring_size );
+
+		async_file->completion_ring = NULL;
+	}
+	/* Closing the io_uring also unregisters the buffers
+	 */
+	if( async_file->ring_file_descriptor != -1 )
+	{
+		close(
+		 async_file->ring_file_descriptor );
+
+		async_file->ring_file_descriptor = -1;
+	}
+	async_file->has_registered_buffers = 0;
+
+	if( async_file->file_descriptor != -1 )
+	{
+		if( close(
+		     async_file->file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		async_file->file_descriptor = -1;
+	}
+#endif /* defined( WINAPI ) */
+
+	async_file->use_direct_io       = 0;
+	async_file->returned_slot_index = -1;
+	async_file->remaining_data      = NULL;
+	async_file->remaining_data_size = 0;
+
+	return( result );
+}
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+
+/* Sets up the io_uring of the asynchronous file and maps its queues
+ * The slot buffers are registered so that the reads do not map the buffer pages
+ * on every read, if registration fails, for example due to the locked memory limit,
+ * vectored reads are used instead
+ * Returns 1 if successful, 0 if io_uring is not available or -1 on error
+ */
+int assorted_async_file_initialize_ring(
+     assorted_async_file_t *async_file,
+     libcerror_error_t **error )
+{
+	struct io_uring_params parameters;
+	struct iovec io_vectors[ ASSORTED_ASYNC_FILE_MAXIMUM_QUEUE_DEPTH ];
+
+	static char *function = "assorted_async_file_initialize_ring";
+	void *mapping         = NULL;
+	int slot_index        = 0;
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_file->ring_file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous file - ring file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		return( -1 );
+	}
+	async_file->ring_file_descriptor = (int) syscall(
+	                                          __NR_io_uring_setup,
+	                                          (unsigned int) async_file->queue_depth,
+	                                          &parameters );
+
+	if( async_file->ring_file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	async_file->submission_ring_offsets = parameters.sq_off;
+	async_file->completion_ring_offsets = parameters.cq_off;
+
+	async_file->submission_ring_size    = parameters.sq_off.array + ( parameters.sq_entries * sizeof( uint32_t ) );
+	async_file->submission_entries_size = parameters.sq_entries * sizeof( struct io_uring_sqe );
+	async_file->completion_ring_size    = parameters.cq_off.cqes + ( parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+	mapping = mmap(
+	           NULL,
+	           async_file->submission_ring_size,
+	           PROT_READ | PROT_WRITE,
+	           MAP_SHARED,
+	           async_file->ring_file_descriptor,
+	           IORING_OFF_SQ_RING );
+
+	if( mapping == MAP_FAILED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to map submission queue ring.",
+		 function );
+
+		return( -1 );
+	}
+	async_file->submission_ring = (uint8_t *) mapping;
+
+	mapping = mmap(
+	           NULL,
+	           async_file->submission_entries_size,
+	           PROT_READ | PROT_WRITE,
+	           MAP_SHARED,
+	           async_file->ring_file_descriptor,
+	           IORING_OFF_SQES );
+
+	if( mapping == MAP_FAILED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to map submission queue entries.",
+		 function );
+
+		return( -1 );
+	}
+	async_file->submission_entries = (struct io_uring_sqe *) mapping;
+
+	mapping = mmap(
+	           NULL,
+	           async_file->completion_ring_size,
+	           PROT_READ | PROT_WRITE,
+	           MAP_SHARED,
+	           async_file->ring_file_descriptor,
+	           IORING_OFF_CQ_RING );
+
+	if( mapping == MAP_FAILED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to map completion queue ring.",
+		 function );
+
+		return( -1 );
+	}
+	async_file->completion_ring = (uint8_t *) mapping;
+
+	for( slot_index = 0;
+	     slot_index < async_file->queue_depth;
+	     slot_index++ )
+	{
+		io_vectors[ slot_index ].iov_base = async_file->slots[ slot_index ].buffer;
+		io_vectors[ slot_index ].iov_len  = async_file->buffer_size;
+	}
+	if( syscall(
+	     __NR_io_uring_register,
+	     async_file->ring_file_descriptor,
+	     IORING_REGISTER_BUFFERS,
+	     io_vectors,
+	     (unsigned int) async_file->queue_depth ) == 0 )
+	{
+		async_file->has_registered_buffers = 1;
+	}
+	return( 1 );
+}
+
+#endif /* defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING ) */
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC )
+
+/* Submits the read of the next chunk into a slot
+ * The read covers the aligned blocks that contain the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_async_file_submit_read(
+     assorted_async_file_t *async_file,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	assorted_async_file_slot_t *slot = NULL;
+	static char *function            = "assorted_async_file_submit_read";
+	off64_t chunk_offset             = 0;
+	size_t chunk_size                = 0;
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= async_file->queue_depth ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot = &( async_file->slots[ slot_index ] );
+
+	if( slot->status == ASSORTED_ASYNC_FILE_SLOT_STATUS_PENDING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid slot: %d - read already pending.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	if( async_file->submit_offset >= async_file->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid asynchronous file - submit offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_size = async_file->chunk_size;
+
+	if( (size64_t) chunk_size > ( async_file->data_size - async_file->submit_offset ) )
+	{
+		chunk_size = (size_t) ( async_file->data_size - async_file->submit_offset );
+	}
+	chunk_offset = async_file->data_offset + (off64_t) async_file->submit_offset;
+
+	slot->read_offset = chunk_offset - ( chunk_offset % ASSORTED_ASYNC_FILE_ALIGNMENT );
+	slot->data_offset = (size_t) ( chunk_offset - slot->read_offset );
+	slot->data_size   = chunk_size;
+	slot->read_size   = ( ( slot->data_offset + chunk_size + ASSORTED_ASYNC_FILE_ALIGNMENT - 1 ) / ASSORTED_ASYNC_FILE_ALIGNMENT ) * ASSORTED_ASYNC_FILE_ALIGNMENT;
+	slot->read_count  = 0;
+	slot->error_code  = 0;
+
+	async_file->submit_offset += chunk_size;
+
+	if( assorted_async_file_start_read(
+	     async_file,
+	     slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to start read of slot: %d.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Starts the read of the remainder of the read of a slot
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_async_file_start_read(
+     assorted_async_file_t *async_file,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	assorted_async_file_slot_t *slot      = NULL;
+	static char *function                 = "assorted_async_file_start_read";
+	off64_t read_offset                   = 0;
+
+#if defined( WINAPI )
+	DWORD error_code                      = 0;
+
+#elif defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	struct io_uring_sqe *submission_entry = NULL;
+	uint32_t *submission_array            = NULL;
+	uint32_t *submission_tail             = NULL;
+	uint32_t entry_index                  = 0;
+	uint32_t tail                         = 0;
+	long result                           = 0;
+#endif
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= async_file->queue_depth ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot = &( async_file->slots[ slot_index ] );
+
+	read_offset = slot->read_offset + (off64_t) slot->read_count;
+
+	slot->status = ASSORTED_ASYNC_FILE_SLOT_STATUS_PENDING;
+
+#if defined( WINAPI )
+	if( memory_set(
+	     &( slot->overlapped ),
+	     0,
+	     sizeof( OVERLAPPED ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear overlapped.",
+		 function );
+
+		goto on_error;
+	}
+	slot->overlapped.Offset     = (DWORD) ( (uint64_t) read_offset & 0xffffffffUL );
+	slot->overlapped.OffsetHigh = (DWORD) ( (uint64_t) read_offset >> 32 );
+
+	/* A read that completes immediately also queues a completion packet
+	 */
+	if( ReadFile(
+	     async_file->file_handle,
+	     &( slot->buffer[ slot->read_count ] ),
+	     (DWORD) ( slot->read_size - slot->read_count ),
+	     NULL,
+	     &( slot->overlapped ) ) == 0 )
+	{
+		error_code = GetLastError();
+
+		if( error_code != ERROR_IO_PENDING )
+		{
+			/* No completion packet is queued for a read that fails immediately
+			 */
+			if( error_code == ERROR_HANDLE_EOF )
+			{
+				error_code = 0;
+			}
+			if( assorted_async_file_complete_read(
+			     async_file,
+			     slot_index,
+			     0,
+			     (uint32_t) error_code,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to complete read of slot: %d.",
+				 function,
+				 slot_index );
+
+				goto on_error;
+			}
+		}
+	}
+#elif defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	submission_tail  = (uint32_t *) &( async_file->submission_ring[ async_file->submission_ring_offsets.tail ] );
+	submission_array = (uint32_t *) &( async_file->submission_ring[ async_file->submission_ring_offsets.array ] );
+
+	/* Only this thread adds submission queue entries, the kernel reads them after the tail is released
+	 */
+	tail        = *submission_tail;
+	entry_index = tail & *( (uint32_t *) &( async_file->submission_ring[ async_file->submission_ring_offsets.ring_mask ] ) );
+
+	submission_entry = &( async_file->submission_entries[ entry_index ] );
+
+	if( memory_set(
+	     submission_entry,
+	     0,
+	     sizeof( struct io_uring_sqe ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear submission queue entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( async_file->has_registered_buffers != 0 )
+	{
+		submission_entry->opcode    = IORING_OP_READ_FIXED;
+		submission_entry->addr      = (uint64_t) (intptr_t) &( slot->buffer[ slot->read_count ] );
+		submission_entry->len       = (uint32_t) ( slot->read_size - slot->read_count );
+		submission_entry->buf_index = (uint16_t) slot_index;
+	}
+	else
+	{
+		slot->io_vector.iov_base = &( slot->buffer[ slot->read_count ] );
+		slot->io_vector.iov_len  = slot->read_size - slot->read_count;
+
+		submission_entry->opcode = IORING_OP_READV;
+		submission_entry->addr   = (uint64_t) (intptr_t) &( slot->io_vector );
+		submission_entry->len    = 1;
+	}
+	submission_entry->fd        = async_file->file_descriptor;
+	submission_entry->off       = (uint64_t) read_offset;
+	submission_entry->user_data = (uint64_t) slot_index;
+
+	submission_array[ entry_index ] = entry_index;
+
+	__atomic_store_n(
+	 submission_tail,
+	 tail + 1,
+	 __ATOMIC_RELEASE );
+
+	do
+	{
+		result = syscall(
+		          __NR_io_uring_enter,
+		          async_file->ring_file_descriptor,
+		          1,
+		          0,
+		          0,
+		          NULL,
+		          0 );
+	}
+	while( ( result == -1 )
+	    && ( errno == EINTR ) );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to submit read.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+
+on_error:
+	slot->status = ASSORTED_ASYNC_FILE_SLOT_STATUS_FAILED;
+
+	return( -1 );
+}
+
+/* Processes the completion of a read of a slot
+ * A short read before the end of the chunk data is continued, since a read is not
+ * required to return all requested data, where reading no data is an error
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_async_file_complete_read(
+     assorted_async_file_t *async_file,
+     int slot_index,
+     size_t read_count,
+     uint32_t error_code,
+     libcerror_error_t **error )
+{
+	assorted_async_file_slot_t *slot = NULL;
+	static char *function            = "assorted_async_file_complete_read";
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= async_file->queue_depth ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot = &( async_file->slots[ slot_index ] );
+
+	if( async_file->is_open == 0 )
+	{
+		slot->status = ASSORTED_ASYNC_FILE_SLOT_STATUS_UNUSED;
+
+		return( 1 );
+	}
+	if( error_code != 0 )
+	{
+		slot->status     = ASSORTED_ASYNC_FILE_SLOT_STATUS_FAILED;
+		slot->error_code = error_code;
+
+		return( 1 );
+	}
+	if( read_count > ( slot->read_size - slot->read_count ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot->read_count += read_count;
+
+	if( slot->read_count >= ( slot->data_offset + slot->data_size ) )
+	{
+		slot->status = ASSORTED_ASYNC_FILE_SLOT_STATUS_COMPLETED;
+	}
+	else if( read_count == 0 )
+	{
+		slot->status = ASSORTED_ASYNC_FILE_SLOT_STATUS_FAILED;
+	}
+	else if( assorted_async_file_start_read(
+	          async_file,
+	          slot_index,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to continue read of slot: %d.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits for at least one read to complete and processes the available completions
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_async_file_wait_for_completions(
+     assorted_async_file_t *async_file,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	OVERLAPPED *overlapped                  = NULL;
+	ULONG_PTR completion_key                = 0;
+	DWORD error_code                        = 0;
+	DWORD read_count                        = 0;
+	BOOL result                             = FALSE;
+
+#elif defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	struct io_uring_cqe *completion_entries = NULL;
+	uint32_t *completion_head               = NULL;
+	uint32_t *completion_tail               = NULL;
+	uint32_t completion_ring_mask           = 0;
+	uint32_t error_code                     = 0;
+	uint32_t head                           = 0;
+	uint32_t tail                           = 0;
+	size_t read_count                       = 0;
+	long result                             = 0;
+	int32_t completion_result               = 0;
+#endif
+	static char *function                   = "assorted_async_file_wait_for_completions";
+	int slot_index                          = 0;
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	result = GetQueuedCompletionStatus(
+	          async_file->completion_port,
+	          &read_count,
+	          &completion_key,
+	          &overlapped,
+	          INFINITE );
+
+	if( overlapped == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve completion status.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == FALSE )
+	{
+		error_code = GetLastError();
+
+		if( error_code == ERROR_HANDLE_EOF )
+		{
+			error_code = 0;
+		}
+	}
+	slot_index = (int) ( (assorted_async_file_slot_t *) overlapped - async_file->slots );
+
+	if( assorted_async_file_complete_read(
+	     async_file,
+	     slot_index,
+	     (size_t) read_count,
+	     (uint32_t) error_code,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to complete read of slot: %d.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+#elif defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	completion_head      = (uint32_t *) &( async_file->completion_ring[ async_file->completion_ring_offsets.head ] );
+	completion_tail      = (uint32_t *) &( async_file->completion_ring[ async_file->completion_ring_offsets.tail ] );
+	completion_ring_mask = *( (uint32_t *) &( async_file->completion_ring[ async_file->completion_ring_offsets.ring_mask ] ) );
+	completion_entries   = (struct io_uring_cqe *) &( async_file->completion_ring[ async_file->completion_ring_offsets.cqes ] );
+
+	head = *completion_head;
+	tail = __atomic_load_n(
+	        completion_tail,
+	        __ATOMIC_ACQUIRE );
+
+	if( head == tail )
+	{
+		do
+		{
+			result = syscall(
+			          __NR_io_uring_enter,
+			          async_file->ring_file_descriptor,
+			          0,
+			          1,
+			          IORING_ENTER_GETEVENTS,
+			          NULL,
+			          0 );
+		}
+		while( ( result == -1 )
+		    && ( errno == EINTR ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to wait for completions.",
+			 function );
+
+			return( -1 );
+		}
+		tail = __atomic_load_n(
+		        completion_tail,
+		        __ATOMIC_ACQUIRE );
+	}
+	/* The head is released before the completion is processed, so that the entry
+	 * is available for the completion of a continued read
+	 */
+	while( head != tail )
+	{
+		slot_index        = (int) completion_entries[ head & completion_ring_mask ].user_data;
+		completion_result = completion_entries[ head & completion_ring_mask ].res;
+
+		head++;
+
+		__atomic_store_n(
+		 completion_head,
+		 head,
+		 __ATOMIC_RELEASE );
+
+		if( completion_result < 0 )
+		{
+			error_code = (uint32_t) -completion_result;
+			read_count = 0;
+		}
+		else
+		{
+			error_code = 0;
+			read_count = (size_t) completion_result;
+		}
+		if( assorted_async_file_complete_read(
+		     async_file,
+		     slot_index,
+		     read_count,
+		     error_code,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to complete read of slot: %d.",
+			 function,
+			 slot_index );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
+#endif /* defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC ) */
+
+/* Reads the next chunk of the data
+ * The chunks are returned in order, where every chunk except the last is of the chunk size.
+ * The rest of a chunk that was partially copied by assorted_async_file_read_buffer is
+ * returned first. The data remains valid until the next call, which reuses its buffer
+ * for the read of the chunk queue depth chunks ahead
+ * Returns 1 if successful, 0 if no more data is available or -1 on error
+ */
+int assorted_async_file_read_next(
+     assorted_async_file_t *async_file,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "assorted_async_file_read_next";
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC )
+	assorted_async_file_slot_t *slot = NULL;
+#endif
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_file->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid asynchronous file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_file->remaining_data_size > 0 )
+	{
+		*data      = async_file->remaining_data;
+		*data_size = async_file->remaining_data_size;
+
+		async_file->remaining_data      = NULL;
+		async_file->remaining_data_size = 0;
+
+		return( 1 );
+	}
+#if !defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC )
+	return( 0 );
+#else
+	/* Chunk n is read into slot n modulo the queue depth, hence the slot of the returned
+	 * chunk is the slot of the next chunk to submit
+	 */
+	if( async_file->returned_slot_index != -1 )
+	{
+		async_file->slots[ async_file->returned_slot_index ].status = ASSORTED_ASYNC_FILE_SLOT_STATUS_UNUSED;
+
+		if( async_file->submit_offset < async_file->data_size )
+		{
+			if( assorted_async_file_submit_read(
+			     async_file,
+			     async_file->returned_slot_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to submit read of slot: %d.",
+				 function,
+				 async_file->returned_slot_index );
+
+				return( -1 );
+			}
+		}
+		async_file->returned_slot_index = -1;
+	}
+	slot = &( async_file->slots[ async_file->next_slot_index ] );
+
+	if( slot->status == ASSORTED_ASYNC_FILE_SLOT_STATUS_UNUSED )
+	{
+		return( 0 );
+	}
+	while( slot->status == ASSORTED_ASYNC_FILE_SLOT_STATUS_PENDING )
+	{
+		if( assorted_async_file_wait_for_completions(
+		     async_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to wait for read of slot: %d.",
+			 function,
+			 async_file->next_slot_index );
+
+			return( -1 );
+		}
+	}
+	if( slot->status != ASSORTED_ASYNC_FILE_SLOT_STATUS_COMPLETED )
+	{
+		if( slot->error_code != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 slot->error_code,
+			 "%s: unable to read chunk at offset: %" PRIi64 ".",
+			 function,
+			 slot->read_offset + (off64_t) slot->data_offset );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIi64 " - unexpected end of file.",
+			 function,
+			 slot->read_offset + (off64_t) slot->data_offset );
+		}
+		return( -1 );
+	}
+	*data      = &( slot->buffer[ slot->data_offset ] );
+	*data_size = slot->data_size;
+
+	async_file->returned_slot_index = async_file->next_slot_index;
+	async_file->next_slot_index     = ( async_file->next_slot_index + 1 ) % async_file->queue_depth;
+
+	return( 1 );
+
+#endif /* !defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC ) */
+}
+
+/* Reads data into a buffer
+ * The data is copied from the chunks, which allows to read sizes other than the chunk size.
+ * Reads with assorted_async_file_read_next should not be mixed with this function
+ * Returns the number of bytes read, which is less than the size at the end of the data, or -1 on error
+ */
+ssize_t assorted_async_file_read_buffer(
+     assorted_async_file_t *async_file,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_async_file_read_buffer";
+	size_t buffer_offset  = 0;
+	size_t copy_size      = 0;
+	int result            = 0;
+
+	if( async_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		if( async_file->remaining_data_size == 0 )
+		{
+			result = assorted_async_file_read_next(
+			          async_file,
+			          &( async_file->remaining_data ),
+			          &( async_file->remaining_data_size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read next chunk.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		copy_size = size - buffer_offset;
+
+		if( copy_size > async_file->remaining_data_size )
+		{
+			copy_size = async_file->remaining_data_size;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     async_file->remaining_data,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		async_file->remaining_data       = &( ( async_file->remaining_data )[ copy_size ] );
+		async_file->remaining_data_size -= copy_size;
+		buffer_offset                   += copy_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
@@ -0,0 +1,314 @@
+/*
+ * Asynchronous direct I/O file functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_ASYNC_FILE_H )
+#define _ASSORTED_ASYNC_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+/* Asynchronous reads are supported on Windows using overlapped I/O with a completion port
+ * and on Linux using io_uring, where narrow system strings are used
+ */
+#if defined( WINAPI )
+#define ASSORTED_ASYNC_FILE_HAVE_ASYNC		1
+
+#elif defined( __linux__ ) && defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H ) \
+ && defined( HAVE_FCNTL_H ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define ASSORTED_ASYNC_FILE_HAVE_ASYNC		1
+#define ASSORTED_ASYNC_FILE_HAVE_IO_URING	1
+
+#endif
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the file offsets, sizes and buffers of the reads, which is
+ * the largest logical sector size direct I/O commonly requires
+ */
+#define ASSORTED_ASYNC_FILE_ALIGNMENT			4096
+
+/* The default number of chunks that are read concurrently
+ */
+#define ASSORTED_ASYNC_FILE_DEFAULT_QUEUE_DEPTH		8
+
+/* The maximum number of chunks that are read concurrently
+ */
+#define ASSORTED_ASYNC_FILE_MAXIMUM_QUEUE_DEPTH		64
+
+/* The maximum size of a chunk, which keeps the size of a read within 32-bit
+ */
+#define ASSORTED_ASYNC_FILE_MAXIMUM_CHUNK_SIZE		( 256 * 1024 * 1024 )
+
+enum ASSORTED_ASYNC_FILE_SLOT_STATUSES
+{
+	ASSORTED_ASYNC_FILE_SLOT_STATUS_UNUSED		= 0,
+	ASSORTED_ASYNC_FILE_SLOT_STATUS_PENDING		= 1,
+	ASSORTED_ASYNC_FILE_SLOT_STATUS_COMPLETED	= 2,
+	ASSORTED_ASYNC_FILE_SLOT_STATUS_FAILED		= 3
+};
+
+typedef struct assorted_async_file_slot assorted_async_file_slot_t;
+
+struct assorted_async_file_slot
+{
+#if defined( WINAPI )
+	/* The overlapped structure of the read, which is the first member
+	 * so that the slot of a completion is the overlapped structure
+	 */
+	OVERLAPPED overlapped;
+#endif
+
+	/* The buffer, which is aligned to the alignment
+	 */
+	uint8_t *buffer;
+
+	/* The file offset of the read, which is aligned to the alignment
+	 */
+	off64_t read_offset;
+
+	/* The size of the read, which is aligned to the alignment
+	 */
+	size_t read_size;
+
+	/* The number of bytes read
+	 */
+	size_t read_count;
+
+	/* The offset of the chunk data in the buffer
+	 */
+	size_t data_offset;
+
+	/* The size of the chunk data
+	 */
+	size_t data_size;
+
+	/* The status
+	 */
+	int status;
+
+	/* The system error code of a failed read
+	 */
+	uint32_t error_code;
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	/* The I/O vector of a read when the buffers are not registered
+	 */
+	struct iovec io_vector;
+#endif
+};
+
+typedef struct assorted_async_file assorted_async_file_t;
+
+struct assorted_async_file
+{
+	/* The size of the chunks
+	 */
+	size_t chunk_size;
+
+	/* The number of chunks that are read concurrently
+	 */
+	int queue_depth;
+
+	/* The size of the buffer of a slot
+	 */
+	size_t buffer_size;
+
+	/* The memory of the buffers, which is not aligned
+	 */
+	uint8_t *buffers_memory;
+
+	/* The slots
+	 */
+	assorted_async_file_slot_t *slots;
+
+	/* The file offset of the data
+	 */
+	off64_t data_offset;
+
+	/* The size of the data
+	 */
+	size64_t data_size;
+
+	/* The offset of the next chunk to read relative from the data offset
+	 */
+	size64_t submit_offset;
+
+	/* The index of the slot of the next chunk to return
+	 */
+	int next_slot_index;
+
+	/* The index of the slot of the last returned chunk or -1 if not set
+	 */
+	int returned_slot_index;
+
+	/* The data of the last returned chunk that has not been copied by read buffer
+	 */
+	const uint8_t *remaining_data;
+
+	/* The size of the remaining data
+	 */
+	size_t remaining_data_size;
+
+	/* Value to indicate the file is open
+	 */
+	uint8_t is_open;
+
+	/* Value to indicate the file cache is bypassed
+	 */
+	uint8_t use_direct_io;
+
+#if defined( WINAPI )
+	/* The file handle
+	 */
+	HANDLE file_handle;
+
+	/* The I/O completion port
+	 */
+	HANDLE completion_port;
+
+#elif defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The io_uring file descriptor
+	 */
+	int ring_file_descriptor;
+
+	/* Value to indicate the buffers are registered with the io_uring
+	 */
+	uint8_t has_registered_buffers;
+
+	/* The mapped submission queue ring
+	 */
+	uint8_t *submission_ring;
+
+	/* The size of the mapped submission queue ring
+	 */
+	size_t submission_ring_size;
+
+	/* The mapped submission queue entries
+	 */
+	struct io_uring_sqe *submission_entries;
+
+	/* The size of the mapped submission queue entries
+	 */
+	size_t submission_entries_size;
+
+	/* The offsets of the submission queue ring values
+	 */
+	struct io_sqring_offsets submission_ring_offsets;
+
+	/* The mapped completion queue ring
+	 */
+	uint8_t *completion_ring;
+
+	/* The size of the mapped completion queue ring
+	 */
+	size_t completion_ring_size;
+
+	/* The offsets of the completion queue ring values
+	 */
+	struct io_cqring_offsets completion_ring_offsets;
+#endif
+};
+
+int assorted_async_file_initialize(
+     assorted_async_file_t **async_file,
+     size_t chunk_size,
+     int queue_depth,
+     libcerror_error_t **error );
+
+int assorted_async_file_free(
+     assorted_async_file_t **async_file,
+     libcerror_error_t **error );
+
+int assorted_async_file_open(
+     assorted_async_file_t *async_file,
+     const system_character_t *filename,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int assorted_async_file_close(
+     assorted_async_file_t *async_file,
+     libcerror_error_t **error );
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+
+int assorted_async_file_initialize_ring(
+     assorted_async_file_t *async_file,
+     libcerror_error_t **error );
+
+#endif /* defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING ) */
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC )
+
+int assorted_async_file_submit_read(
+     assorted_async_file_t *async_file,
+     int slot_index,
+     libcerror_error_t **error );
+
+int assorted_async_file_start_read(
+     assorted_async_file_t *async_file,
+     int slot_index,
+     libcerror_error_t **error );
+
+int assorted_async_file_complete_read(
+     assorted_async_file_t *async_file,
+     int slot_index,
+     size_t read_count,
+     uint32_t error_code,
+     libcerror_error_t **error );
+
+int assorted_async_file_wait_for_completions(
+     assorted_async_file_t *async_file,
+     libcerror_error_t **error );
+
+#endif /* defined( ASSORTED_ASYNC_FILE_HAVE_ASYNC ) */
+
+int assorted_async_file_read_next(
+     assorted_async_file_t *async_file,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+ssize_t assorted_async_file_read_buffer(
+     assorted_async_file_t *async_file,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_ASYNC_FILE_H ) */
+
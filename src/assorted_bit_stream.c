@@ -20,13 +20,77 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#include "assorted_arena.h"
 #include "assorted_bit_stream.h"
 #include "assorted_libcerror.h"
 
-/* TODO use memory alignment in bit stream */
+/* Refills the bit buffer of a back to front (LSB first) bit stream
+ * If enough bytes remain in the byte stream the bit buffer is refilled
+ * with as many whole bytes as fit in 63 bits using a single 64-bit read,
+ * otherwise it is refilled a byte at a time
+ */
+#define assorted_bit_stream_refill_back_to_front( bit_stream, read_value, read_size ) \
+	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 8 ) \
+	{ \
+		read_size = ( 63 - bit_stream->bit_buffer_size ) & 0x38; \
+\
+		byte_stream_load_uint64_little_endian( \
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ), \
+		 read_value ); \
+\
+		read_value &= ( (uint64_t) 1 << read_size ) - 1; \
+\
+		bit_stream->bit_buffer         |= read_value << bit_stream->bit_buffer_size; \
+		bit_stream->bit_buffer_size    += read_size; \
+		bit_stream->byte_stream_offset += read_size >> 3; \
+	} \
+	else \
+	{ \
+		while( ( bit_stream->bit_buffer_size <= 55 ) \
+		    && ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size ) ) \
+		{ \
+			bit_stream->bit_buffer         |= (uint64_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size; \
+			bit_stream->bit_buffer_size    += 8; \
+			bit_stream->byte_stream_offset += 1; \
+		} \
+	}
+
+/* Refills the bit buffer of a front to back (MSB first) bit stream
+ * If enough bytes remain in the byte stream the bit buffer is refilled
+ * with as many whole bytes as fit in 63 bits using a single 64-bit read,
+ * otherwise it is refilled a byte at a time
+ */
+#define assorted_bit_stream_refill_front_to_back( bit_stream, read_value, read_size ) \
+	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 8 ) \
+	{ \
+		read_size = ( 63 - bit_stream->bit_buffer_size ) & 0x38; \
+\
+		byte_stream_load_uint64_big_endian( \
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ), \
+		 read_value ); \
+\
+		read_value >>= 64 - read_size; \
+\
+		bit_stream->bit_buffer        <<= read_size; \
+		bit_stream->bit_buffer         |= read_value; \
+		bit_stream->bit_buffer_size    += read_size; \
+		bit_stream->byte_stream_offset += read_size >> 3; \
+	} \
+	else \
+	{ \
+		while( ( bit_stream->bit_buffer_size <= 55 ) \
+		    && ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size ) ) \
+		{ \
+			bit_stream->bit_buffer        <<= 8; \
+			bit_stream->bit_buffer         |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ]; \
+			bit_stream->bit_buffer_size    += 8; \
+			bit_stream->byte_stream_offset += 1; \
+		} \
+	}
 
 /* Creates a bit stream
  * Make sure the value bit_stream is referencing, is set to NULL
@@ -40,7 +104,31 @@ int assorted_bit_stream_initialize(
      uint8_t storage_type,
      libcerror_error_t **error )
 {
-	static char *function = "assorted_bit_stream_initialize";
+	return( assorted_bit_stream_initialize_with_arena(
+	         bit_stream,
+	         byte_stream,
+	         byte_stream_size,
+	         byte_stream_offset,
+	         storage_type,
+	         NULL,
+	         error ) );
+}
+
+/* Creates a bit stream of which the memory is allocated from an arena
+ * If arena is NULL the memory is allocated separately
+ * Make sure the value bit_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bit_stream_initialize_with_arena(
+     assorted_bit_stream_t **bit_stream,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t byte_stream_offset,
+     uint8_t storage_type,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_initialize_with_arena";
 
 	if( bit_stream == NULL )
 	{
@@ -109,9 +197,22 @@ int assorted_bit_stream_initialize(
 
 		return( -1 );
 	}
-	*bit_stream = memory_allocate_structure(
-	               assorted_bit_stream_t );
-
+	if( arena != NULL )
+	{
+		if( assorted_arena_allocate(
+		     arena,
+		     sizeof( assorted_bit_stream_t ),
+		     (void **) bit_stream,
+		     error ) != 1 )
+		{
+			*bit_stream = NULL;
+		}
+	}
+	else
+	{
+		*bit_stream = memory_allocate_structure(
+		               assorted_bit_stream_t );
+	}
 	if( *bit_stream == NULL )
 	{
 		libcerror_error_set(
@@ -141,17 +242,19 @@ int assorted_bit_stream_initialize(
 	( *bit_stream )->byte_stream_size   = byte_stream_size;
 	( *bit_stream )->byte_stream_offset = byte_stream_offset;
 	( *bit_stream )->storage_type       = storage_type;
+	( *bit_stream )->arena              = arena;
 
 	return( 1 );
 
 on_error:
-	if( *bit_stream != NULL )
+	if( ( *bit_stream != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 *bit_stream );
-
-		*bit_stream = NULL;
 	}
+	*bit_stream = NULL;
+
 	return( -1 );
 }
 
@@ -175,13 +278,14 @@ int assorted_bit_stream_free(
 
 		return( -1 );
 	}
-	if( *bit_stream != NULL )
+	if( ( *bit_stream != NULL )
+	 && ( ( *bit_stream )->arena == NULL ) )
 	{
 		memory_free(
 		 *bit_stream );
-
-		*bit_stream = NULL;
 	}
+	*bit_stream = NULL;
+
 	return( 1 );
 }
 
@@ -225,6 +329,8 @@ int assorted_bit_stream_set_byte_stream_offset(
 }
 
 /* Retrieves a value from the bit stream
+ * This function reads the byte stream a byte at a time and is used
+ * for the tail of the byte stream where a 64-bit refill is not possible
  * Returns 1 on success or -1 on error
  */
 int assorted_bit_stream_get_value(
@@ -233,11 +339,8 @@ int assorted_bit_stream_get_value(
      uint32_t *value_32bit,
      libcerror_error_t **error )
 {
-	static char *function            = "assorted_bit_stream_get_value";
-	uint32_t read_value_32bit        = 0;
-	uint32_t safe_value_32bit        = 0;
-	uint8_t read_number_of_bits      = 0;
-	uint8_t remaining_number_of_bits = 0;
+	static char *function = "assorted_bit_stream_get_value";
+	uint64_t safe_value   = 0;
 
 	if( bit_stream == NULL )
 	{
@@ -272,78 +375,549 @@ int assorted_bit_stream_get_value(
 
 		return( -1 );
 	}
-	remaining_number_of_bits = number_of_bits;
-
-	while( remaining_number_of_bits > 0 )
+	while( bit_stream->bit_buffer_size < number_of_bits )
 	{
-		while( ( remaining_number_of_bits > bit_stream->bit_buffer_size )
-		    && ( bit_stream->bit_buffer_size <= 24 ) )
+		if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
 		{
-			if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid byte stream offset value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
-			{
-				bit_stream->bit_buffer |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
-			}
-			else if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
-			{
-				bit_stream->bit_buffer <<= 8;
-				bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
-			}
-			bit_stream->bit_buffer_size    += 8;
-			bit_stream->byte_stream_offset += 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			return( -1 );
 		}
-		if( remaining_number_of_bits < bit_stream->bit_buffer_size )
+		if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
 		{
-			read_number_of_bits = remaining_number_of_bits;
+			bit_stream->bit_buffer |= (uint64_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
 		}
 		else
 		{
-			read_number_of_bits = bit_stream->bit_buffer_size;
+			bit_stream->bit_buffer <<= 8;
+			bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
 		}
-		read_value_32bit   = bit_stream->bit_buffer;
-		safe_value_32bit <<= remaining_number_of_bits;
+		bit_stream->bit_buffer_size    += 8;
+		bit_stream->byte_stream_offset += 1;
+	}
+	bit_stream->bit_buffer_size -= number_of_bits;
 
-		if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		safe_value               = bit_stream->bit_buffer & ( ( (uint64_t) 1 << number_of_bits ) - 1 );
+		bit_stream->bit_buffer >>= number_of_bits;
+	}
+	else
+	{
+		safe_value              = bit_stream->bit_buffer >> bit_stream->bit_buffer_size;
+		bit_stream->bit_buffer &= ( (uint64_t) 1 << bit_stream->bit_buffer_size ) - 1;
+	}
+	*value_32bit = (uint32_t) safe_value;
+
+	return( 1 );
+}
+
+/* Retrieves a value from the bit stream without consuming the bits
+ * If the byte stream contains less than the requested number of bits
+ * the missing bits are returned as 0
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_peek_bits(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_peek_bits";
+	int result            = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		result = assorted_bit_stream_peek_bits_back_to_front(
+		          bit_stream,
+		          number_of_bits,
+		          value_32bit,
+		          error );
+	}
+	else
+	{
+		result = assorted_bit_stream_peek_bits_front_to_back(
+		          bit_stream,
+		          number_of_bits,
+		          value_32bit,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Skips bits in the bit stream
+ * The bits are typically made available by a preceding peek
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_skip_bits(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_skip_bits";
+	int result            = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		result = assorted_bit_stream_skip_bits_back_to_front(
+		          bit_stream,
+		          number_of_bits,
+		          error );
+	}
+	else
+	{
+		result = assorted_bit_stream_skip_bits_front_to_back(
+		          bit_stream,
+		          number_of_bits,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to skip bits in bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a value from a back to front (LSB first) bit stream
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_get_value_back_to_front(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_get_value_back_to_front";
+	uint64_t read_value   = 0;
+	uint8_t read_size     = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->bit_buffer_size < number_of_bits )
+	{
+		assorted_bit_stream_refill_back_to_front(
+		 bit_stream,
+		 read_value,
+		 read_size );
+
+		if( bit_stream->bit_buffer_size < number_of_bits )
 		{
-			if( read_number_of_bits < 32 )
-			{
-				/* On VS 2008 32-bit "~( 0xfffffffUL << 32 )" does not behave as expected
-				 */
-				read_value_32bit &= ~( 0xffffffffUL << read_number_of_bits );
-
-				bit_stream->bit_buffer >>= read_number_of_bits;
-			}
-			bit_stream->bit_buffer_size -= read_number_of_bits;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			return( -1 );
 		}
-		else if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
-		{
-			bit_stream->bit_buffer_size -= read_number_of_bits;
-			read_value_32bit           >>= bit_stream->bit_buffer_size;
+	}
+	bit_stream->bit_buffer_size -= number_of_bits;
+
+	*value_32bit = (uint32_t) ( bit_stream->bit_buffer & ( ( (uint64_t) 1 << number_of_bits ) - 1 ) );
+
+	bit_stream->bit_buffer >>= number_of_bits;
+
+	return( 1 );
+}
+
+/* Retrieves a value from a back to front (LSB first) bit stream without consuming the bits
+ * If the byte stream contains less than the requested number of bits
+ * the missing bits are returned as 0
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_peek_bits_back_to_front(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_peek_bits_back_to_front";
+	uint64_t read_value   = 0;
+	uint64_t safe_value   = 0;
+	uint8_t read_size     = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->bit_buffer_size < number_of_bits )
+	{
+		assorted_bit_stream_refill_back_to_front(
+		 bit_stream,
+		 read_value,
+		 read_size );
+	}
+	safe_value = bit_stream->bit_buffer;
+	*value_32bit = (uint32_t) ( safe_value & ( ( (uint64_t) 1 << number_of_bits ) - 1 ) );
+
+	return( 1 );
+}
 
-			if( bit_stream->bit_buffer_size > 0 )
-			{
-				bit_stream->bit_buffer &= 0xffffffffUL >> ( 32 - bit_stream->bit_buffer_size );
-			}
+/* Skips bits in a back to front (LSB first) bit stream
+ * The bits are typically made available by a preceding peek
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_skip_bits_back_to_front(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_skip_bits_back_to_front";
+	uint32_t value_32bit  = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > bit_stream->bit_buffer_size )
+	{
+		if( assorted_bit_stream_get_value_back_to_front(
+		     bit_stream,
+		     number_of_bits,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
 		}
-		if( bit_stream->bit_buffer_size == 0 )
+		return( 1 );
+	}
+	bit_stream->bit_buffer_size -= number_of_bits;
+
+	bit_stream->bit_buffer >>= number_of_bits;
+
+	return( 1 );
+}
+
+/* Retrieves a value from a front to back (MSB first) bit stream
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_get_value_front_to_back(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_get_value_front_to_back";
+	uint64_t read_value   = 0;
+	uint8_t read_size     = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->bit_buffer_size < number_of_bits )
+	{
+		assorted_bit_stream_refill_front_to_back(
+		 bit_stream,
+		 read_value,
+		 read_size );
+
+		if( bit_stream->bit_buffer_size < number_of_bits )
 		{
-			bit_stream->bit_buffer = 0;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			return( -1 );
 		}
-		safe_value_32bit         |= read_value_32bit;
-		remaining_number_of_bits -= read_number_of_bits;
 	}
-	*value_32bit = safe_value_32bit;
+	bit_stream->bit_buffer_size -= number_of_bits;
+
+	*value_32bit = (uint32_t) ( bit_stream->bit_buffer >> bit_stream->bit_buffer_size );
+
+	bit_stream->bit_buffer &= ( (uint64_t) 1 << bit_stream->bit_buffer_size ) - 1;
+
+	return( 1 );
+}
+
+/* Retrieves a value from a front to back (MSB first) bit stream without consuming the bits
+ * If the byte stream contains less than the requested number of bits
+ * the missing bits are returned as 0
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_peek_bits_front_to_back(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_peek_bits_front_to_back";
+	uint64_t read_value   = 0;
+	uint64_t safe_value   = 0;
+	uint8_t read_size     = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->bit_buffer_size < number_of_bits )
+	{
+		assorted_bit_stream_refill_front_to_back(
+		 bit_stream,
+		 read_value,
+		 read_size );
+	}
+	if( bit_stream->bit_buffer_size >= number_of_bits )
+	{
+		safe_value = bit_stream->bit_buffer >> ( bit_stream->bit_buffer_size - number_of_bits );
+	}
+	else
+	{
+		safe_value = bit_stream->bit_buffer << ( number_of_bits - bit_stream->bit_buffer_size );
+	}
+	*value_32bit = (uint32_t) ( safe_value & ( ( (uint64_t) 1 << number_of_bits ) - 1 ) );
 
 	return( 1 );
 }
 
+/* Skips bits in a front to back (MSB first) bit stream
+ * The bits are typically made available by a preceding peek
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_skip_bits_front_to_back(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_skip_bits_front_to_back";
+	uint32_t value_32bit  = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > bit_stream->bit_buffer_size )
+	{
+		if( assorted_bit_stream_get_value_front_to_back(
+		     bit_stream,
+		     number_of_bits,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	bit_stream->bit_buffer_size -= number_of_bits;
+
+	bit_stream->bit_buffer &= ( (uint64_t) 1 << bit_stream->bit_buffer_size ) - 1;
+
+	return( 1 );
+}
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "assorted_arena.h"
 #include "assorted_libcerror.h"
 
 #if defined( __cplusplus )
@@ -62,11 +63,15 @@ struct assorted_bit_stream
 
 	/* The bit buffer
 	 */
-	uint32_t bit_buffer;
+	uint64_t bit_buffer;
 
 	/* The number of bits remaining in the bit buffer
 	 */
 	uint8_t bit_buffer_size;
+
+	/* The arena the bit stream is allocated from, NULL if allocated separately
+	 */
+	assorted_arena_t *arena;
 };
 
 int assorted_bit_stream_initialize(
@@ -77,6 +82,15 @@ int assorted_bit_stream_initialize(
      uint8_t storage_type,
      libcerror_error_t **error );
 
+int assorted_bit_stream_initialize_with_arena(
+     assorted_bit_stream_t **bit_stream,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t byte_stream_offset,
+     uint8_t storage_type,
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
 int assorted_bit_stream_free(
      assorted_bit_stream_t **bit_stream,
      libcerror_error_t **error );
@@ -92,6 +106,51 @@ int assorted_bit_stream_get_value(
      uint32_t *value_32bit,
      libcerror_error_t **error );
 
+int assorted_bit_stream_peek_bits(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_skip_bits(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_get_value_back_to_front(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_peek_bits_back_to_front(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_skip_bits_back_to_front(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_get_value_front_to_back(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_peek_bits_front_to_back(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_skip_bits_front_to_back(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,416 @@
+/*
+ * Bit-stream writer functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_bit_stream.h"
+#include "assorted_bit_stream_writer.h"
+#include "assorted_libcerror.h"
+
+/* Creates a bit stream writer
+ * Make sure the value bit_stream_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bit_stream_writer_initialize(
+     assorted_bit_stream_writer_t **bit_stream_writer,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t byte_stream_offset,
+     uint8_t storage_type,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_writer_initialize";
+
+	if( bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bit_stream_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bit stream writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_offset > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported storage type.",
+		 function );
+
+		return( -1 );
+	}
+	*bit_stream_writer = memory_allocate_structure(
+	                      assorted_bit_stream_writer_t );
+
+	if( *bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bit_stream_writer,
+	     0,
+	     sizeof( assorted_bit_stream_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *bit_stream_writer )->byte_stream        = byte_stream;
+	( *bit_stream_writer )->byte_stream_size   = byte_stream_size;
+	( *bit_stream_writer )->byte_stream_offset = byte_stream_offset;
+	( *bit_stream_writer )->storage_type       = storage_type;
+
+	return( 1 );
+
+on_error:
+	if( *bit_stream_writer != NULL )
+	{
+		memory_free(
+		 *bit_stream_writer );
+
+		*bit_stream_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bit stream writer
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bit_stream_writer_free(
+     assorted_bit_stream_writer_t **bit_stream_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_writer_free";
+
+	if( bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bit_stream_writer != NULL )
+	{
+		memory_free(
+		 *bit_stream_writer );
+
+		*bit_stream_writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Writes a value to the bit stream
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_writer_write_value(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     uint32_t value_32bit,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_writer_write_value";
+
+	if( bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) ( ( bit_stream_writer->bit_buffer_size + number_of_bits + 7 ) / 8 ) > ( bit_stream_writer->byte_stream_size - bit_stream_writer->byte_stream_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits < 32 )
+	{
+		value_32bit &= ( (uint32_t) 1 << number_of_bits ) - 1;
+	}
+	if( bit_stream_writer->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		assorted_bit_stream_writer_write_bits_back_to_front(
+		 bit_stream_writer,
+		 value_32bit,
+		 number_of_bits );
+	}
+	else
+	{
+		assorted_bit_stream_writer_write_bits_front_to_back(
+		 bit_stream_writer,
+		 value_32bit,
+		 number_of_bits );
+	}
+	return( 1 );
+}
+
+/* Flushes the bits in the bit buffer to the byte stream
+ * The last byte is padded with 0-bits to a byte boundary
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_writer_flush(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_writer_flush";
+	uint8_t padding_size  = 0;
+
+	if( bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) ( ( bit_stream_writer->bit_buffer_size + 7 ) / 8 ) > ( bit_stream_writer->byte_stream_size - bit_stream_writer->byte_stream_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream_writer->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		while( bit_stream_writer->bit_buffer_size > 0 )
+		{
+			bit_stream_writer->byte_stream[ bit_stream_writer->byte_stream_offset++ ] = (uint8_t) ( bit_stream_writer->bit_buffer & 0xff );
+
+			bit_stream_writer->bit_buffer >>= 8;
+
+			if( bit_stream_writer->bit_buffer_size < 8 )
+			{
+				bit_stream_writer->bit_buffer_size = 0;
+			}
+			else
+			{
+				bit_stream_writer->bit_buffer_size -= 8;
+			}
+		}
+	}
+	else
+	{
+		padding_size = ( 8 - ( bit_stream_writer->bit_buffer_size & 0x07 ) ) & 0x07;
+
+		bit_stream_writer->bit_buffer     <<= padding_size;
+		bit_stream_writer->bit_buffer_size += padding_size;
+
+		while( bit_stream_writer->bit_buffer_size > 0 )
+		{
+			bit_stream_writer->bit_buffer_size -= 8;
+
+			bit_stream_writer->byte_stream[ bit_stream_writer->byte_stream_offset++ ] = (uint8_t) ( ( bit_stream_writer->bit_buffer >> bit_stream_writer->bit_buffer_size ) & 0xff );
+		}
+	}
+	bit_stream_writer->bit_buffer = 0;
+
+	return( 1 );
+}
+
+/* Writes data to the byte stream
+ * The bits in the bit buffer are flushed first, hence the data starts at a byte boundary
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bit_stream_writer_write_data(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bit_stream_writer_write_data";
+
+	if( bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_writer_flush(
+	     bit_stream_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush bit buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( bit_stream_writer->byte_stream_size - bit_stream_writer->byte_stream_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( bit_stream_writer->byte_stream[ bit_stream_writer->byte_stream_offset ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream_writer->byte_stream_offset += data_size;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,139 @@
+/*
+ * Bit-stream writer functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_BIT_STREAM_WRITER_H )
+#define _ASSORTED_BIT_STREAM_WRITER_H
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "assorted_bit_stream.h"
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct assorted_bit_stream_writer assorted_bit_stream_writer_t;
+
+struct assorted_bit_stream_writer
+{
+	/* The byte stream
+	 */
+	uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The byte stream offset
+	 */
+	size_t byte_stream_offset;
+
+	/* The storage type
+	 */
+	uint8_t storage_type;
+
+	/* The bit buffer
+	 */
+	uint64_t bit_buffer;
+
+	/* The number of bits in the bit buffer that have not been written
+	 */
+	uint8_t bit_buffer_size;
+};
+
+/* Writes bits to a back to front (LSB first) bit stream
+ * The value must not contain bits above number_of_bits and number_of_bits must not exceed 32
+ * Whenever 32 or more bits are buffered a 32-bit word is written
+ * The caller is responsible for making sure the byte stream can hold the bits
+ */
+#define assorted_bit_stream_writer_write_bits_back_to_front( bit_stream_writer, value, number_of_bits ) \
+	bit_stream_writer->bit_buffer      |= (uint64_t) ( value ) << bit_stream_writer->bit_buffer_size; \
+	bit_stream_writer->bit_buffer_size += ( number_of_bits ); \
+\
+	if( bit_stream_writer->bit_buffer_size >= 32 ) \
+	{ \
+		byte_stream_copy_from_uint32_little_endian( \
+		 &( bit_stream_writer->byte_stream[ bit_stream_writer->byte_stream_offset ] ), \
+		 bit_stream_writer->bit_buffer ); \
+\
+		bit_stream_writer->byte_stream_offset += 4; \
+		bit_stream_writer->bit_buffer        >>= 32; \
+		bit_stream_writer->bit_buffer_size    -= 32; \
+	}
+
+/* Writes bits to a front to back (MSB first) bit stream
+ * The value must not contain bits above number_of_bits and number_of_bits must not exceed 32
+ * Whenever 32 or more bits are buffered a 32-bit word is written
+ * The caller is responsible for making sure the byte stream can hold the bits
+ */
+#define assorted_bit_stream_writer_write_bits_front_to_back( bit_stream_writer, value, number_of_bits ) \
+	bit_stream_writer->bit_buffer     <<= ( number_of_bits ); \
+	bit_stream_writer->bit_buffer      |= (uint64_t) ( value ); \
+	bit_stream_writer->bit_buffer_size += ( number_of_bits ); \
+\
+	if( bit_stream_writer->bit_buffer_size >= 32 ) \
+	{ \
+		bit_stream_writer->bit_buffer_size -= 32; \
+\
+		byte_stream_copy_from_uint32_big_endian( \
+		 &( bit_stream_writer->byte_stream[ bit_stream_writer->byte_stream_offset ] ), \
+		 bit_stream_writer->bit_buffer >> bit_stream_writer->bit_buffer_size ); \
+\
+		bit_stream_writer->byte_stream_offset += 4; \
+	}
+
+int assorted_bit_stream_writer_initialize(
+     assorted_bit_stream_writer_t **bit_stream_writer,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t byte_stream_offset,
+     uint8_t storage_type,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_writer_free(
+     assorted_bit_stream_writer_t **bit_stream_writer,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_writer_write_value(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     uint32_t value_32bit,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_writer_flush(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     libcerror_error_t **error );
+
+int assorted_bit_stream_writer_write_data(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_BIT_STREAM_WRITER_H ) */
+
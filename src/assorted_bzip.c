@@ -20,57 +20,554 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#include "assorted_aligned_memory.h"
+#include "assorted_arena.h"
 #include "assorted_bit_stream.h"
 #include "assorted_bzip.h"
 #include "assorted_huffman_tree.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
+#include "assorted_suffix_array.h"
 
-/* Table of the CRC-32 of all 8-bit messages.
+/* Tables of the CRC-32 of all 8-bit messages followed by 0 to 7 zero bytes
+ * used to calculate the CRC-32 with slicing-by-8
+ * The tables are calculated in reverse bit-order of polynomial: 0x04c11db7
+ * Table N contains the CRC-32 of the 8-bit message followed by N zero bytes
  */
-uint32_t assorted_bzip_crc32_table[ 256 ];
-
-/* Value to indicate the CRC-32 table been computed
- */
-int assorted_bzip_crc32_table_computed = 0;
-
-/* Initializes the internal CRC-32 table
- * The table speeds up the CRC-32 calculation
- * The table is calcuted in reverse bit-order
- */
-void assorted_bzip_initialize_crc32_table(
-      void )
-{
-	uint32_t crc32             = 0;
-	uint16_t crc32_table_index = 0;
-	uint8_t bit_iterator       = 0;
-
-	for( crc32_table_index = 0;
-	     crc32_table_index < 256;
-	     crc32_table_index++ )
+const uint32_t assorted_bzip_crc32_table[ 8 ][ 256 ] = {
 	{
-		crc32 = (uint32_t) crc32_table_index << 24;
-
-		for( bit_iterator = 0;
-		     bit_iterator < 8;
-		     bit_iterator++ )
-		{
-			if( crc32 & 0x80000000UL )
-			{
-				crc32 = 0x04c11db7UL ^ ( crc32 << 1 );
-			}
-			else
-			{
-				crc32 = crc32 << 1;
-			}
-		}
-		assorted_bzip_crc32_table[ crc32_table_index ] = crc32;
+		0x00000000UL, 0x04c11db7UL, 0x09823b6eUL, 0x0d4326d9UL,
+		0x130476dcUL, 0x17c56b6bUL, 0x1a864db2UL, 0x1e475005UL,
+		0x2608edb8UL, 0x22c9f00fUL, 0x2f8ad6d6UL, 0x2b4bcb61UL,
+		0x350c9b64UL, 0x31cd86d3UL, 0x3c8ea00aUL, 0x384fbdbdUL,
+		0x4c11db70UL, 0x48d0c6c7UL, 0x4593e01eUL, 0x4152fda9UL,
+		0x5f15adacUL, 0x5bd4b01bUL, 0x569796c2UL, 0x52568b75UL,
+		0x6a1936c8UL, 0x6ed82b7fUL, 0x639b0da6UL, 0x675a1011UL,
+		0x791d4014UL, 0x7ddc5da3UL, 0x709f7b7aUL, 0x745e66cdUL,
+		0x9823b6e0UL, 0x9ce2ab57UL, 0x91a18d8eUL, 0x95609039UL,
+		0x8b27c03cUL, 0x8fe6dd8bUL, 0x82a5fb52UL, 0x8664e6e5UL,
+		0xbe2b5b58UL, 0xbaea46efUL, 0xb7a96036UL, 0xb3687d81UL,
+		0xad2f2d84UL, 0xa9ee3033UL, 0xa4ad16eaUL, 0xa06c0b5dUL,
+		0xd4326d90UL, 0xd0f37027UL, 0xddb056feUL, 0xd9714b49UL,
+		0xc7361b4cUL, 0xc3f706fbUL, 0xceb42022UL, 0xca753d95UL,
+		0xf23a8028UL, 0xf6fb9d9fUL, 0xfbb8bb46UL, 0xff79a6f1UL,
+		0xe13ef6f4UL, 0xe5ffeb43UL, 0xe8bccd9aUL, 0xec7dd02dUL,
+		0x34867077UL, 0x30476dc0UL, 0x3d044b19UL, 0x39c556aeUL,
+		0x278206abUL, 0x23431b1cUL, 0x2e003dc5UL, 0x2ac12072UL,
+		0x128e9dcfUL, 0x164f8078UL, 0x1b0ca6a1UL, 0x1fcdbb16UL,
+		0x018aeb13UL, 0x054bf6a4UL, 0x0808d07dUL, 0x0cc9cdcaUL,
+		0x7897ab07UL, 0x7c56b6b0UL, 0x71159069UL, 0x75d48ddeUL,
+		0x6b93dddbUL, 0x6f52c06cUL, 0x6211e6b5UL, 0x66d0fb02UL,
+		0x5e9f46bfUL, 0x5a5e5b08UL, 0x571d7dd1UL, 0x53dc6066UL,
+		0x4d9b3063UL, 0x495a2dd4UL, 0x44190b0dUL, 0x40d816baUL,
+		0xaca5c697UL, 0xa864db20UL, 0xa527fdf9UL, 0xa1e6e04eUL,
+		0xbfa1b04bUL, 0xbb60adfcUL, 0xb6238b25UL, 0xb2e29692UL,
+		0x8aad2b2fUL, 0x8e6c3698UL, 0x832f1041UL, 0x87ee0df6UL,
+		0x99a95df3UL, 0x9d684044UL, 0x902b669dUL, 0x94ea7b2aUL,
+		0xe0b41de7UL, 0xe4750050UL, 0xe9362689UL, 0xedf73b3eUL,
+		0xf3b06b3bUL, 0xf771768cUL, 0xfa325055UL, 0xfef34de2UL,
+		0xc6bcf05fUL, 0xc27dede8UL, 0xcf3ecb31UL, 0xcbffd686UL,
+		0xd5b88683UL, 0xd1799b34UL, 0xdc3abdedUL, 0xd8fba05aUL,
+		0x690ce0eeUL, 0x6dcdfd59UL, 0x608edb80UL, 0x644fc637UL,
+		0x7a089632UL, 0x7ec98b85UL, 0x738aad5cUL, 0x774bb0ebUL,
+		0x4f040d56UL, 0x4bc510e1UL, 0x46863638UL, 0x42472b8fUL,
+		0x5c007b8aUL, 0x58c1663dUL, 0x558240e4UL, 0x51435d53UL,
+		0x251d3b9eUL, 0x21dc2629UL, 0x2c9f00f0UL, 0x285e1d47UL,
+		0x36194d42UL, 0x32d850f5UL, 0x3f9b762cUL, 0x3b5a6b9bUL,
+		0x0315d626UL, 0x07d4cb91UL, 0x0a97ed48UL, 0x0e56f0ffUL,
+		0x1011a0faUL, 0x14d0bd4dUL, 0x19939b94UL, 0x1d528623UL,
+		0xf12f560eUL, 0xf5ee4bb9UL, 0xf8ad6d60UL, 0xfc6c70d7UL,
+		0xe22b20d2UL, 0xe6ea3d65UL, 0xeba91bbcUL, 0xef68060bUL,
+		0xd727bbb6UL, 0xd3e6a601UL, 0xdea580d8UL, 0xda649d6fUL,
+		0xc423cd6aUL, 0xc0e2d0ddUL, 0xcda1f604UL, 0xc960ebb3UL,
+		0xbd3e8d7eUL, 0xb9ff90c9UL, 0xb4bcb610UL, 0xb07daba7UL,
+		0xae3afba2UL, 0xaafbe615UL, 0xa7b8c0ccUL, 0xa379dd7bUL,
+		0x9b3660c6UL, 0x9ff77d71UL, 0x92b45ba8UL, 0x9675461fUL,
+		0x8832161aUL, 0x8cf30badUL, 0x81b02d74UL, 0x857130c3UL,
+		0x5d8a9099UL, 0x594b8d2eUL, 0x5408abf7UL, 0x50c9b640UL,
+		0x4e8ee645UL, 0x4a4ffbf2UL, 0x470cdd2bUL, 0x43cdc09cUL,
+		0x7b827d21UL, 0x7f436096UL, 0x7200464fUL, 0x76c15bf8UL,
+		0x68860bfdUL, 0x6c47164aUL, 0x61043093UL, 0x65c52d24UL,
+		0x119b4be9UL, 0x155a565eUL, 0x18197087UL, 0x1cd86d30UL,
+		0x029f3d35UL, 0x065e2082UL, 0x0b1d065bUL, 0x0fdc1becUL,
+		0x3793a651UL, 0x3352bbe6UL, 0x3e119d3fUL, 0x3ad08088UL,
+		0x2497d08dUL, 0x2056cd3aUL, 0x2d15ebe3UL, 0x29d4f654UL,
+		0xc5a92679UL, 0xc1683bceUL, 0xcc2b1d17UL, 0xc8ea00a0UL,
+		0xd6ad50a5UL, 0xd26c4d12UL, 0xdf2f6bcbUL, 0xdbee767cUL,
+		0xe3a1cbc1UL, 0xe760d676UL, 0xea23f0afUL, 0xeee2ed18UL,
+		0xf0a5bd1dUL, 0xf464a0aaUL, 0xf9278673UL, 0xfde69bc4UL,
+		0x89b8fd09UL, 0x8d79e0beUL, 0x803ac667UL, 0x84fbdbd0UL,
+		0x9abc8bd5UL, 0x9e7d9662UL, 0x933eb0bbUL, 0x97ffad0cUL,
+		0xafb010b1UL, 0xab710d06UL, 0xa6322bdfUL, 0xa2f33668UL,
+		0xbcb4666dUL, 0xb8757bdaUL, 0xb5365d03UL, 0xb1f740b4UL
+	},
+	{
+		0x00000000UL, 0xd219c1dcUL, 0xa0f29e0fUL, 0x72eb5fd3UL,
+		0x452421a9UL, 0x973de075UL, 0xe5d6bfa6UL, 0x37cf7e7aUL,
+		0x8a484352UL, 0x5851828eUL, 0x2abadd5dUL, 0xf8a31c81UL,
+		0xcf6c62fbUL, 0x1d75a327UL, 0x6f9efcf4UL, 0xbd873d28UL,
+		0x10519b13UL, 0xc2485acfUL, 0xb0a3051cUL, 0x62bac4c0UL,
+		0x5575babaUL, 0x876c7b66UL, 0xf58724b5UL, 0x279ee569UL,
+		0x9a19d841UL, 0x4800199dUL, 0x3aeb464eUL, 0xe8f28792UL,
+		0xdf3df9e8UL, 0x0d243834UL, 0x7fcf67e7UL, 0xadd6a63bUL,
+		0x20a33626UL, 0xf2baf7faUL, 0x8051a829UL, 0x524869f5UL,
+		0x6587178fUL, 0xb79ed653UL, 0xc5758980UL, 0x176c485cUL,
+		0xaaeb7574UL, 0x78f2b4a8UL, 0x0a19eb7bUL, 0xd8002aa7UL,
+		0xefcf54ddUL, 0x3dd69501UL, 0x4f3dcad2UL, 0x9d240b0eUL,
+		0x30f2ad35UL, 0xe2eb6ce9UL, 0x9000333aUL, 0x4219f2e6UL,
+		0x75d68c9cUL, 0xa7cf4d40UL, 0xd5241293UL, 0x073dd34fUL,
+		0xbabaee67UL, 0x68a32fbbUL, 0x1a487068UL, 0xc851b1b4UL,
+		0xff9ecfceUL, 0x2d870e12UL, 0x5f6c51c1UL, 0x8d75901dUL,
+		0x41466c4cUL, 0x935fad90UL, 0xe1b4f243UL, 0x33ad339fUL,
+		0x04624de5UL, 0xd67b8c39UL, 0xa490d3eaUL, 0x76891236UL,
+		0xcb0e2f1eUL, 0x1917eec2UL, 0x6bfcb111UL, 0xb9e570cdUL,
+		0x8e2a0eb7UL, 0x5c33cf6bUL, 0x2ed890b8UL, 0xfcc15164UL,
+		0x5117f75fUL, 0x830e3683UL, 0xf1e56950UL, 0x23fca88cUL,
+		0x1433d6f6UL, 0xc62a172aUL, 0xb4c148f9UL, 0x66d88925UL,
+		0xdb5fb40dUL, 0x094675d1UL, 0x7bad2a02UL, 0xa9b4ebdeUL,
+		0x9e7b95a4UL, 0x4c625478UL, 0x3e890babUL, 0xec90ca77UL,
+		0x61e55a6aUL, 0xb3fc9bb6UL, 0xc117c465UL, 0x130e05b9UL,
+		0x24c17bc3UL, 0xf6d8ba1fUL, 0x8433e5ccUL, 0x562a2410UL,
+		0xebad1938UL, 0x39b4d8e4UL, 0x4b5f8737UL, 0x994646ebUL,
+		0xae893891UL, 0x7c90f94dUL, 0x0e7ba69eUL, 0xdc626742UL,
+		0x71b4c179UL, 0xa3ad00a5UL, 0xd1465f76UL, 0x035f9eaaUL,
+		0x3490e0d0UL, 0xe689210cUL, 0x94627edfUL, 0x467bbf03UL,
+		0xfbfc822bUL, 0x29e543f7UL, 0x5b0e1c24UL, 0x8917ddf8UL,
+		0xbed8a382UL, 0x6cc1625eUL, 0x1e2a3d8dUL, 0xcc33fc51UL,
+		0x828cd898UL, 0x50951944UL, 0x227e4697UL, 0xf067874bUL,
+		0xc7a8f931UL, 0x15b138edUL, 0x675a673eUL, 0xb543a6e2UL,
+		0x08c49bcaUL, 0xdadd5a16UL, 0xa83605c5UL, 0x7a2fc419UL,
+		0x4de0ba63UL, 0x9ff97bbfUL, 0xed12246cUL, 0x3f0be5b0UL,
+		0x92dd438bUL, 0x40c48257UL, 0x322fdd84UL, 0xe0361c58UL,
+		0xd7f96222UL, 0x05e0a3feUL, 0x770bfc2dUL, 0xa5123df1UL,
+		0x189500d9UL, 0xca8cc105UL, 0xb8679ed6UL, 0x6a7e5f0aUL,
+		0x5db12170UL, 0x8fa8e0acUL, 0xfd43bf7fUL, 0x2f5a7ea3UL,
+		0xa22feebeUL, 0x70362f62UL, 0x02dd70b1UL, 0xd0c4b16dUL,
+		0xe70bcf17UL, 0x35120ecbUL, 0x47f95118UL, 0x95e090c4UL,
+		0x2867adecUL, 0xfa7e6c30UL, 0x889533e3UL, 0x5a8cf23fUL,
+		0x6d438c45UL, 0xbf5a4d99UL, 0xcdb1124aUL, 0x1fa8d396UL,
+		0xb27e75adUL, 0x6067b471UL, 0x128ceba2UL, 0xc0952a7eUL,
+		0xf75a5404UL, 0x254395d8UL, 0x57a8ca0bUL, 0x85b10bd7UL,
+		0x383636ffUL, 0xea2ff723UL, 0x98c4a8f0UL, 0x4add692cUL,
+		0x7d121756UL, 0xaf0bd68aUL, 0xdde08959UL, 0x0ff94885UL,
+		0xc3cab4d4UL, 0x11d37508UL, 0x63382adbUL, 0xb121eb07UL,
+		0x86ee957dUL, 0x54f754a1UL, 0x261c0b72UL, 0xf405caaeUL,
+		0x4982f786UL, 0x9b9b365aUL, 0xe9706989UL, 0x3b69a855UL,
+		0x0ca6d62fUL, 0xdebf17f3UL, 0xac544820UL, 0x7e4d89fcUL,
+		0xd39b2fc7UL, 0x0182ee1bUL, 0x7369b1c8UL, 0xa1707014UL,
+		0x96bf0e6eUL, 0x44a6cfb2UL, 0x364d9061UL, 0xe45451bdUL,
+		0x59d36c95UL, 0x8bcaad49UL, 0xf921f29aUL, 0x2b383346UL,
+		0x1cf74d3cUL, 0xceee8ce0UL, 0xbc05d333UL, 0x6e1c12efUL,
+		0xe36982f2UL, 0x3170432eUL, 0x439b1cfdUL, 0x9182dd21UL,
+		0xa64da35bUL, 0x74546287UL, 0x06bf3d54UL, 0xd4a6fc88UL,
+		0x6921c1a0UL, 0xbb38007cUL, 0xc9d35fafUL, 0x1bca9e73UL,
+		0x2c05e009UL, 0xfe1c21d5UL, 0x8cf77e06UL, 0x5eeebfdaUL,
+		0xf33819e1UL, 0x2121d83dUL, 0x53ca87eeUL, 0x81d34632UL,
+		0xb61c3848UL, 0x6405f994UL, 0x16eea647UL, 0xc4f7679bUL,
+		0x79705ab3UL, 0xab699b6fUL, 0xd982c4bcUL, 0x0b9b0560UL,
+		0x3c547b1aUL, 0xee4dbac6UL, 0x9ca6e515UL, 0x4ebf24c9UL
+	},
+	{
+		0x00000000UL, 0x01d8ac87UL, 0x03b1590eUL, 0x0269f589UL,
+		0x0762b21cUL, 0x06ba1e9bUL, 0x04d3eb12UL, 0x050b4795UL,
+		0x0ec56438UL, 0x0f1dc8bfUL, 0x0d743d36UL, 0x0cac91b1UL,
+		0x09a7d624UL, 0x087f7aa3UL, 0x0a168f2aUL, 0x0bce23adUL,
+		0x1d8ac870UL, 0x1c5264f7UL, 0x1e3b917eUL, 0x1fe33df9UL,
+		0x1ae87a6cUL, 0x1b30d6ebUL, 0x19592362UL, 0x18818fe5UL,
+		0x134fac48UL, 0x129700cfUL, 0x10fef546UL, 0x112659c1UL,
+		0x142d1e54UL, 0x15f5b2d3UL, 0x179c475aUL, 0x1644ebddUL,
+		0x3b1590e0UL, 0x3acd3c67UL, 0x38a4c9eeUL, 0x397c6569UL,
+		0x3c7722fcUL, 0x3daf8e7bUL, 0x3fc67bf2UL, 0x3e1ed775UL,
+		0x35d0f4d8UL, 0x3408585fUL, 0x3661add6UL, 0x37b90151UL,
+		0x32b246c4UL, 0x336aea43UL, 0x31031fcaUL, 0x30dbb34dUL,
+		0x269f5890UL, 0x2747f417UL, 0x252e019eUL, 0x24f6ad19UL,
+		0x21fdea8cUL, 0x2025460bUL, 0x224cb382UL, 0x23941f05UL,
+		0x285a3ca8UL, 0x2982902fUL, 0x2beb65a6UL, 0x2a33c921UL,
+		0x2f388eb4UL, 0x2ee02233UL, 0x2c89d7baUL, 0x2d517b3dUL,
+		0x762b21c0UL, 0x77f38d47UL, 0x759a78ceUL, 0x7442d449UL,
+		0x714993dcUL, 0x70913f5bUL, 0x72f8cad2UL, 0x73206655UL,
+		0x78ee45f8UL, 0x7936e97fUL, 0x7b5f1cf6UL, 0x7a87b071UL,
+		0x7f8cf7e4UL, 0x7e545b63UL, 0x7c3daeeaUL, 0x7de5026dUL,
+		0x6ba1e9b0UL, 0x6a794537UL, 0x6810b0beUL, 0x69c81c39UL,
+		0x6cc35bacUL, 0x6d1bf72bUL, 0x6f7202a2UL, 0x6eaaae25UL,
+		0x65648d88UL, 0x64bc210fUL, 0x66d5d486UL, 0x670d7801UL,
+		0x62063f94UL, 0x63de9313UL, 0x61b7669aUL, 0x606fca1dUL,
+		0x4d3eb120UL, 0x4ce61da7UL, 0x4e8fe82eUL, 0x4f5744a9UL,
+		0x4a5c033cUL, 0x4b84afbbUL, 0x49ed5a32UL, 0x4835f6b5UL,
+		0x43fbd518UL, 0x4223799fUL, 0x404a8c16UL, 0x41922091UL,
+		0x44996704UL, 0x4541cb83UL, 0x47283e0aUL, 0x46f0928dUL,
+		0x50b47950UL, 0x516cd5d7UL, 0x5305205eUL, 0x52dd8cd9UL,
+		0x57d6cb4cUL, 0x560e67cbUL, 0x54679242UL, 0x55bf3ec5UL,
+		0x5e711d68UL, 0x5fa9b1efUL, 0x5dc04466UL, 0x5c18e8e1UL,
+		0x5913af74UL, 0x58cb03f3UL, 0x5aa2f67aUL, 0x5b7a5afdUL,
+		0xec564380UL, 0xed8eef07UL, 0xefe71a8eUL, 0xee3fb609UL,
+		0xeb34f19cUL, 0xeaec5d1bUL, 0xe885a892UL, 0xe95d0415UL,
+		0xe29327b8UL, 0xe34b8b3fUL, 0xe1227eb6UL, 0xe0fad231UL,
+		0xe5f195a4UL, 0xe4293923UL, 0xe640ccaaUL, 0xe798602dUL,
+		0xf1dc8bf0UL, 0xf0042777UL, 0xf26dd2feUL, 0xf3b57e79UL,
+		0xf6be39ecUL, 0xf766956bUL, 0xf50f60e2UL, 0xf4d7cc65UL,
+		0xff19efc8UL, 0xfec1434fUL, 0xfca8b6c6UL, 0xfd701a41UL,
+		0xf87b5dd4UL, 0xf9a3f153UL, 0xfbca04daUL, 0xfa12a85dUL,
+		0xd743d360UL, 0xd69b7fe7UL, 0xd4f28a6eUL, 0xd52a26e9UL,
+		0xd021617cUL, 0xd1f9cdfbUL, 0xd3903872UL, 0xd24894f5UL,
+		0xd986b758UL, 0xd85e1bdfUL, 0xda37ee56UL, 0xdbef42d1UL,
+		0xdee40544UL, 0xdf3ca9c3UL, 0xdd555c4aUL, 0xdc8df0cdUL,
+		0xcac91b10UL, 0xcb11b797UL, 0xc978421eUL, 0xc8a0ee99UL,
+		0xcdaba90cUL, 0xcc73058bUL, 0xce1af002UL, 0xcfc25c85UL,
+		0xc40c7f28UL, 0xc5d4d3afUL, 0xc7bd2626UL, 0xc6658aa1UL,
+		0xc36ecd34UL, 0xc2b661b3UL, 0xc0df943aUL, 0xc10738bdUL,
+		0x9a7d6240UL, 0x9ba5cec7UL, 0x99cc3b4eUL, 0x981497c9UL,
+		0x9d1fd05cUL, 0x9cc77cdbUL, 0x9eae8952UL, 0x9f7625d5UL,
+		0x94b80678UL, 0x9560aaffUL, 0x97095f76UL, 0x96d1f3f1UL,
+		0x93dab464UL, 0x920218e3UL, 0x906bed6aUL, 0x91b341edUL,
+		0x87f7aa30UL, 0x862f06b7UL, 0x8446f33eUL, 0x859e5fb9UL,
+		0x8095182cUL, 0x814db4abUL, 0x83244122UL, 0x82fceda5UL,
+		0x8932ce08UL, 0x88ea628fUL, 0x8a839706UL, 0x8b5b3b81UL,
+		0x8e507c14UL, 0x8f88d093UL, 0x8de1251aUL, 0x8c39899dUL,
+		0xa168f2a0UL, 0xa0b05e27UL, 0xa2d9abaeUL, 0xa3010729UL,
+		0xa60a40bcUL, 0xa7d2ec3bUL, 0xa5bb19b2UL, 0xa463b535UL,
+		0xafad9698UL, 0xae753a1fUL, 0xac1ccf96UL, 0xadc46311UL,
+		0xa8cf2484UL, 0xa9178803UL, 0xab7e7d8aUL, 0xaaa6d10dUL,
+		0xbce23ad0UL, 0xbd3a9657UL, 0xbf5363deUL, 0xbe8bcf59UL,
+		0xbb8088ccUL, 0xba58244bUL, 0xb831d1c2UL, 0xb9e97d45UL,
+		0xb2275ee8UL, 0xb3fff26fUL, 0xb19607e6UL, 0xb04eab61UL,
+		0xb545ecf4UL, 0xb49d4073UL, 0xb6f4b5faUL, 0xb72c197dUL
+	},
+	{
+		0x00000000UL, 0xdc6d9ab7UL, 0xbc1a28d9UL, 0x6077b26eUL,
+		0x7cf54c05UL, 0xa098d6b2UL, 0xc0ef64dcUL, 0x1c82fe6bUL,
+		0xf9ea980aUL, 0x258702bdUL, 0x45f0b0d3UL, 0x999d2a64UL,
+		0x851fd40fUL, 0x59724eb8UL, 0x3905fcd6UL, 0xe5686661UL,
+		0xf7142da3UL, 0x2b79b714UL, 0x4b0e057aUL, 0x97639fcdUL,
+		0x8be161a6UL, 0x578cfb11UL, 0x37fb497fUL, 0xeb96d3c8UL,
+		0x0efeb5a9UL, 0xd2932f1eUL, 0xb2e49d70UL, 0x6e8907c7UL,
+		0x720bf9acUL, 0xae66631bUL, 0xce11d175UL, 0x127c4bc2UL,
+		0xeae946f1UL, 0x3684dc46UL, 0x56f36e28UL, 0x8a9ef49fUL,
+		0x961c0af4UL, 0x4a719043UL, 0x2a06222dUL, 0xf66bb89aUL,
+		0x1303defbUL, 0xcf6e444cUL, 0xaf19f622UL, 0x73746c95UL,
+		0x6ff692feUL, 0xb39b0849UL, 0xd3ecba27UL, 0x0f812090UL,
+		0x1dfd6b52UL, 0xc190f1e5UL, 0xa1e7438bUL, 0x7d8ad93cUL,
+		0x61082757UL, 0xbd65bde0UL, 0xdd120f8eUL, 0x017f9539UL,
+		0xe417f358UL, 0x387a69efUL, 0x580ddb81UL, 0x84604136UL,
+		0x98e2bf5dUL, 0x448f25eaUL, 0x24f89784UL, 0xf8950d33UL,
+		0xd1139055UL, 0x0d7e0ae2UL, 0x6d09b88cUL, 0xb164223bUL,
+		0xade6dc50UL, 0x718b46e7UL, 0x11fcf489UL, 0xcd916e3eUL,
+		0x28f9085fUL, 0xf49492e8UL, 0x94e32086UL, 0x488eba31UL,
+		0x540c445aUL, 0x8861deedUL, 0xe8166c83UL, 0x347bf634UL,
+		0x2607bdf6UL, 0xfa6a2741UL, 0x9a1d952fUL, 0x46700f98UL,
+		0x5af2f1f3UL, 0x869f6b44UL, 0xe6e8d92aUL, 0x3a85439dUL,
+		0xdfed25fcUL, 0x0380bf4bUL, 0x63f70d25UL, 0xbf9a9792UL,
+		0xa31869f9UL, 0x7f75f34eUL, 0x1f024120UL, 0xc36fdb97UL,
+		0x3bfad6a4UL, 0xe7974c13UL, 0x87e0fe7dUL, 0x5b8d64caUL,
+		0x470f9aa1UL, 0x9b620016UL, 0xfb15b278UL, 0x277828cfUL,
+		0xc2104eaeUL, 0x1e7dd419UL, 0x7e0a6677UL, 0xa267fcc0UL,
+		0xbee502abUL, 0x6288981cUL, 0x02ff2a72UL, 0xde92b0c5UL,
+		0xcceefb07UL, 0x108361b0UL, 0x70f4d3deUL, 0xac994969UL,
+		0xb01bb702UL, 0x6c762db5UL, 0x0c019fdbUL, 0xd06c056cUL,
+		0x3504630dUL, 0xe969f9baUL, 0x891e4bd4UL, 0x5573d163UL,
+		0x49f12f08UL, 0x959cb5bfUL, 0xf5eb07d1UL, 0x29869d66UL,
+		0xa6e63d1dUL, 0x7a8ba7aaUL, 0x1afc15c4UL, 0xc6918f73UL,
+		0xda137118UL, 0x067eebafUL, 0x660959c1UL, 0xba64c376UL,
+		0x5f0ca517UL, 0x83613fa0UL, 0xe3168dceUL, 0x3f7b1779UL,
+		0x23f9e912UL, 0xff9473a5UL, 0x9fe3c1cbUL, 0x438e5b7cUL,
+		0x51f210beUL, 0x8d9f8a09UL, 0xede83867UL, 0x3185a2d0UL,
+		0x2d075cbbUL, 0xf16ac60cUL, 0x911d7462UL, 0x4d70eed5UL,
+		0xa81888b4UL, 0x74751203UL, 0x1402a06dUL, 0xc86f3adaUL,
+		0xd4edc4b1UL, 0x08805e06UL, 0x68f7ec68UL, 0xb49a76dfUL,
+		0x4c0f7becUL, 0x9062e15bUL, 0xf0155335UL, 0x2c78c982UL,
+		0x30fa37e9UL, 0xec97ad5eUL, 0x8ce01f30UL, 0x508d8587UL,
+		0xb5e5e3e6UL, 0x69887951UL, 0x09ffcb3fUL, 0xd5925188UL,
+		0xc910afe3UL, 0x157d3554UL, 0x750a873aUL, 0xa9671d8dUL,
+		0xbb1b564fUL, 0x6776ccf8UL, 0x07017e96UL, 0xdb6ce421UL,
+		0xc7ee1a4aUL, 0x1b8380fdUL, 0x7bf43293UL, 0xa799a824UL,
+		0x42f1ce45UL, 0x9e9c54f2UL, 0xfeebe69cUL, 0x22867c2bUL,
+		0x3e048240UL, 0xe26918f7UL, 0x821eaa99UL, 0x5e73302eUL,
+		0x77f5ad48UL, 0xab9837ffUL, 0xcbef8591UL, 0x17821f26UL,
+		0x0b00e14dUL, 0xd76d7bfaUL, 0xb71ac994UL, 0x6b775323UL,
+		0x8e1f3542UL, 0x5272aff5UL, 0x32051d9bUL, 0xee68872cUL,
+		0xf2ea7947UL, 0x2e87e3f0UL, 0x4ef0519eUL, 0x929dcb29UL,
+		0x80e180ebUL, 0x5c8c1a5cUL, 0x3cfba832UL, 0xe0963285UL,
+		0xfc14cceeUL, 0x20795659UL, 0x400ee437UL, 0x9c637e80UL,
+		0x790b18e1UL, 0xa5668256UL, 0xc5113038UL, 0x197caa8fUL,
+		0x05fe54e4UL, 0xd993ce53UL, 0xb9e47c3dUL, 0x6589e68aUL,
+		0x9d1cebb9UL, 0x4171710eUL, 0x2106c360UL, 0xfd6b59d7UL,
+		0xe1e9a7bcUL, 0x3d843d0bUL, 0x5df38f65UL, 0x819e15d2UL,
+		0x64f673b3UL, 0xb89be904UL, 0xd8ec5b6aUL, 0x0481c1ddUL,
+		0x18033fb6UL, 0xc46ea501UL, 0xa419176fUL, 0x78748dd8UL,
+		0x6a08c61aUL, 0xb6655cadUL, 0xd612eec3UL, 0x0a7f7474UL,
+		0x16fd8a1fUL, 0xca9010a8UL, 0xaae7a2c6UL, 0x768a3871UL,
+		0x93e25e10UL, 0x4f8fc4a7UL, 0x2ff876c9UL, 0xf395ec7eUL,
+		0xef171215UL, 0x337a88a2UL, 0x530d3accUL, 0x8f60a07bUL
+	},
+	{
+		0x00000000UL, 0x490d678dUL, 0x921acf1aUL, 0xdb17a897UL,
+		0x20f48383UL, 0x69f9e40eUL, 0xb2ee4c99UL, 0xfbe32b14UL,
+		0x41e90706UL, 0x08e4608bUL, 0xd3f3c81cUL, 0x9afeaf91UL,
+		0x611d8485UL, 0x2810e308UL, 0xf3074b9fUL, 0xba0a2c12UL,
+		0x83d20e0cUL, 0xcadf6981UL, 0x11c8c116UL, 0x58c5a69bUL,
+		0xa3268d8fUL, 0xea2bea02UL, 0x313c4295UL, 0x78312518UL,
+		0xc23b090aUL, 0x8b366e87UL, 0x5021c610UL, 0x192ca19dUL,
+		0xe2cf8a89UL, 0xabc2ed04UL, 0x70d54593UL, 0x39d8221eUL,
+		0x036501afUL, 0x4a686622UL, 0x917fceb5UL, 0xd872a938UL,
+		0x2391822cUL, 0x6a9ce5a1UL, 0xb18b4d36UL, 0xf8862abbUL,
+		0x428c06a9UL, 0x0b816124UL, 0xd096c9b3UL, 0x999bae3eUL,
+		0x6278852aUL, 0x2b75e2a7UL, 0xf0624a30UL, 0xb96f2dbdUL,
+		0x80b70fa3UL, 0xc9ba682eUL, 0x12adc0b9UL, 0x5ba0a734UL,
+		0xa0438c20UL, 0xe94eebadUL, 0x3259433aUL, 0x7b5424b7UL,
+		0xc15e08a5UL, 0x88536f28UL, 0x5344c7bfUL, 0x1a49a032UL,
+		0xe1aa8b26UL, 0xa8a7ecabUL, 0x73b0443cUL, 0x3abd23b1UL,
+		0x06ca035eUL, 0x4fc764d3UL, 0x94d0cc44UL, 0xddddabc9UL,
+		0x263e80ddUL, 0x6f33e750UL, 0xb4244fc7UL, 0xfd29284aUL,
+		0x47230458UL, 0x0e2e63d5UL, 0xd539cb42UL, 0x9c34accfUL,
+		0x67d787dbUL, 0x2edae056UL, 0xf5cd48c1UL, 0xbcc02f4cUL,
+		0x85180d52UL, 0xcc156adfUL, 0x1702c248UL, 0x5e0fa5c5UL,
+		0xa5ec8ed1UL, 0xece1e95cUL, 0x37f641cbUL, 0x7efb2646UL,
+		0xc4f10a54UL, 0x8dfc6dd9UL, 0x56ebc54eUL, 0x1fe6a2c3UL,
+		0xe40589d7UL, 0xad08ee5aUL, 0x761f46cdUL, 0x3f122140UL,
+		0x05af02f1UL, 0x4ca2657cUL, 0x97b5cdebUL, 0xdeb8aa66UL,
+		0x255b8172UL, 0x6c56e6ffUL, 0xb7414e68UL, 0xfe4c29e5UL,
+		0x444605f7UL, 0x0d4b627aUL, 0xd65ccaedUL, 0x9f51ad60UL,
+		0x64b28674UL, 0x2dbfe1f9UL, 0xf6a8496eUL, 0xbfa52ee3UL,
+		0x867d0cfdUL, 0xcf706b70UL, 0x1467c3e7UL, 0x5d6aa46aUL,
+		0xa6898f7eUL, 0xef84e8f3UL, 0x34934064UL, 0x7d9e27e9UL,
+		0xc7940bfbUL, 0x8e996c76UL, 0x558ec4e1UL, 0x1c83a36cUL,
+		0xe7608878UL, 0xae6deff5UL, 0x757a4762UL, 0x3c7720efUL,
+		0x0d9406bcUL, 0x44996131UL, 0x9f8ec9a6UL, 0xd683ae2bUL,
+		0x2d60853fUL, 0x646de2b2UL, 0xbf7a4a25UL, 0xf6772da8UL,
+		0x4c7d01baUL, 0x05706637UL, 0xde67cea0UL, 0x976aa92dUL,
+		0x6c898239UL, 0x2584e5b4UL, 0xfe934d23UL, 0xb79e2aaeUL,
+		0x8e4608b0UL, 0xc74b6f3dUL, 0x1c5cc7aaUL, 0x5551a027UL,
+		0xaeb28b33UL, 0xe7bfecbeUL, 0x3ca84429UL, 0x75a523a4UL,
+		0xcfaf0fb6UL, 0x86a2683bUL, 0x5db5c0acUL, 0x14b8a721UL,
+		0xef5b8c35UL, 0xa656ebb8UL, 0x7d41432fUL, 0x344c24a2UL,
+		0x0ef10713UL, 0x47fc609eUL, 0x9cebc809UL, 0xd5e6af84UL,
+		0x2e058490UL, 0x6708e31dUL, 0xbc1f4b8aUL, 0xf5122c07UL,
+		0x4f180015UL, 0x06156798UL, 0xdd02cf0fUL, 0x940fa882UL,
+		0x6fec8396UL, 0x26e1e41bUL, 0xfdf64c8cUL, 0xb4fb2b01UL,
+		0x8d23091fUL, 0xc42e6e92UL, 0x1f39c605UL, 0x5634a188UL,
+		0xadd78a9cUL, 0xe4daed11UL, 0x3fcd4586UL, 0x76c0220bUL,
+		0xccca0e19UL, 0x85c76994UL, 0x5ed0c103UL, 0x17dda68eUL,
+		0xec3e8d9aUL, 0xa533ea17UL, 0x7e244280UL, 0x3729250dUL,
+		0x0b5e05e2UL, 0x4253626fUL, 0x9944caf8UL, 0xd049ad75UL,
+		0x2baa8661UL, 0x62a7e1ecUL, 0xb9b0497bUL, 0xf0bd2ef6UL,
+		0x4ab702e4UL, 0x03ba6569UL, 0xd8adcdfeUL, 0x91a0aa73UL,
+		0x6a438167UL, 0x234ee6eaUL, 0xf8594e7dUL, 0xb15429f0UL,
+		0x888c0beeUL, 0xc1816c63UL, 0x1a96c4f4UL, 0x539ba379UL,
+		0xa878886dUL, 0xe175efe0UL, 0x3a624777UL, 0x736f20faUL,
+		0xc9650ce8UL, 0x80686b65UL, 0x5b7fc3f2UL, 0x1272a47fUL,
+		0xe9918f6bUL, 0xa09ce8e6UL, 0x7b8b4071UL, 0x328627fcUL,
+		0x083b044dUL, 0x413663c0UL, 0x9a21cb57UL, 0xd32cacdaUL,
+		0x28cf87ceUL, 0x61c2e043UL, 0xbad548d4UL, 0xf3d82f59UL,
+		0x49d2034bUL, 0x00df64c6UL, 0xdbc8cc51UL, 0x92c5abdcUL,
+		0x692680c8UL, 0x202be745UL, 0xfb3c4fd2UL, 0xb231285fUL,
+		0x8be90a41UL, 0xc2e46dccUL, 0x19f3c55bUL, 0x50fea2d6UL,
+		0xab1d89c2UL, 0xe210ee4fUL, 0x390746d8UL, 0x700a2155UL,
+		0xca000d47UL, 0x830d6acaUL, 0x581ac25dUL, 0x1117a5d0UL,
+		0xeaf48ec4UL, 0xa3f9e949UL, 0x78ee41deUL, 0x31e32653UL
+	},
+	{
+		0x00000000UL, 0x1b280d78UL, 0x36501af0UL, 0x2d781788UL,
+		0x6ca035e0UL, 0x77883898UL, 0x5af02f10UL, 0x41d82268UL,
+		0xd9406bc0UL, 0xc26866b8UL, 0xef107130UL, 0xf4387c48UL,
+		0xb5e05e20UL, 0xaec85358UL, 0x83b044d0UL, 0x989849a8UL,
+		0xb641ca37UL, 0xad69c74fUL, 0x8011d0c7UL, 0x9b39ddbfUL,
+		0xdae1ffd7UL, 0xc1c9f2afUL, 0xecb1e527UL, 0xf799e85fUL,
+		0x6f01a1f7UL, 0x7429ac8fUL, 0x5951bb07UL, 0x4279b67fUL,
+		0x03a19417UL, 0x1889996fUL, 0x35f18ee7UL, 0x2ed9839fUL,
+		0x684289d9UL, 0x736a84a1UL, 0x5e129329UL, 0x453a9e51UL,
+		0x04e2bc39UL, 0x1fcab141UL, 0x32b2a6c9UL, 0x299aabb1UL,
+		0xb102e219UL, 0xaa2aef61UL, 0x8752f8e9UL, 0x9c7af591UL,
+		0xdda2d7f9UL, 0xc68ada81UL, 0xebf2cd09UL, 0xf0dac071UL,
+		0xde0343eeUL, 0xc52b4e96UL, 0xe853591eUL, 0xf37b5466UL,
+		0xb2a3760eUL, 0xa98b7b76UL, 0x84f36cfeUL, 0x9fdb6186UL,
+		0x0743282eUL, 0x1c6b2556UL, 0x311332deUL, 0x2a3b3fa6UL,
+		0x6be31dceUL, 0x70cb10b6UL, 0x5db3073eUL, 0x469b0a46UL,
+		0xd08513b2UL, 0xcbad1ecaUL, 0xe6d50942UL, 0xfdfd043aUL,
+		0xbc252652UL, 0xa70d2b2aUL, 0x8a753ca2UL, 0x915d31daUL,
+		0x09c57872UL, 0x12ed750aUL, 0x3f956282UL, 0x24bd6ffaUL,
+		0x65654d92UL, 0x7e4d40eaUL, 0x53355762UL, 0x481d5a1aUL,
+		0x66c4d985UL, 0x7decd4fdUL, 0x5094c375UL, 0x4bbcce0dUL,
+		0x0a64ec65UL, 0x114ce11dUL, 0x3c34f695UL, 0x271cfbedUL,
+		0xbf84b245UL, 0xa4acbf3dUL, 0x89d4a8b5UL, 0x92fca5cdUL,
+		0xd32487a5UL, 0xc80c8addUL, 0xe5749d55UL, 0xfe5c902dUL,
+		0xb8c79a6bUL, 0xa3ef9713UL, 0x8e97809bUL, 0x95bf8de3UL,
+		0xd467af8bUL, 0xcf4fa2f3UL, 0xe237b57bUL, 0xf91fb803UL,
+		0x6187f1abUL, 0x7aaffcd3UL, 0x57d7eb5bUL, 0x4cffe623UL,
+		0x0d27c44bUL, 0x160fc933UL, 0x3b77debbUL, 0x205fd3c3UL,
+		0x0e86505cUL, 0x15ae5d24UL, 0x38d64aacUL, 0x23fe47d4UL,
+		0x622665bcUL, 0x790e68c4UL, 0x54767f4cUL, 0x4f5e7234UL,
+		0xd7c63b9cUL, 0xccee36e4UL, 0xe196216cUL, 0xfabe2c14UL,
+		0xbb660e7cUL, 0xa04e0304UL, 0x8d36148cUL, 0x961e19f4UL,
+		0xa5cb3ad3UL, 0xbee337abUL, 0x939b2023UL, 0x88b32d5bUL,
+		0xc96b0f33UL, 0xd243024bUL, 0xff3b15c3UL, 0xe41318bbUL,
+		0x7c8b5113UL, 0x67a35c6bUL, 0x4adb4be3UL, 0x51f3469bUL,
+		0x102b64f3UL, 0x0b03698bUL, 0x267b7e03UL, 0x3d53737bUL,
+		0x138af0e4UL, 0x08a2fd9cUL, 0x25daea14UL, 0x3ef2e76cUL,
+		0x7f2ac504UL, 0x6402c87cUL, 0x497adff4UL, 0x5252d28cUL,
+		0xcaca9b24UL, 0xd1e2965cUL, 0xfc9a81d4UL, 0xe7b28cacUL,
+		0xa66aaec4UL, 0xbd42a3bcUL, 0x903ab434UL, 0x8b12b94cUL,
+		0xcd89b30aUL, 0xd6a1be72UL, 0xfbd9a9faUL, 0xe0f1a482UL,
+		0xa12986eaUL, 0xba018b92UL, 0x97799c1aUL, 0x8c519162UL,
+		0x14c9d8caUL, 0x0fe1d5b2UL, 0x2299c23aUL, 0x39b1cf42UL,
+		0x7869ed2aUL, 0x6341e052UL, 0x4e39f7daUL, 0x5511faa2UL,
+		0x7bc8793dUL, 0x60e07445UL, 0x4d9863cdUL, 0x56b06eb5UL,
+		0x17684cddUL, 0x0c4041a5UL, 0x2138562dUL, 0x3a105b55UL,
+		0xa28812fdUL, 0xb9a01f85UL, 0x94d8080dUL, 0x8ff00575UL,
+		0xce28271dUL, 0xd5002a65UL, 0xf8783dedUL, 0xe3503095UL,
+		0x754e2961UL, 0x6e662419UL, 0x431e3391UL, 0x58363ee9UL,
+		0x19ee1c81UL, 0x02c611f9UL, 0x2fbe0671UL, 0x34960b09UL,
+		0xac0e42a1UL, 0xb7264fd9UL, 0x9a5e5851UL, 0x81765529UL,
+		0xc0ae7741UL, 0xdb867a39UL, 0xf6fe6db1UL, 0xedd660c9UL,
+		0xc30fe356UL, 0xd827ee2eUL, 0xf55ff9a6UL, 0xee77f4deUL,
+		0xafafd6b6UL, 0xb487dbceUL, 0x99ffcc46UL, 0x82d7c13eUL,
+		0x1a4f8896UL, 0x016785eeUL, 0x2c1f9266UL, 0x37379f1eUL,
+		0x76efbd76UL, 0x6dc7b00eUL, 0x40bfa786UL, 0x5b97aafeUL,
+		0x1d0ca0b8UL, 0x0624adc0UL, 0x2b5cba48UL, 0x3074b730UL,
+		0x71ac9558UL, 0x6a849820UL, 0x47fc8fa8UL, 0x5cd482d0UL,
+		0xc44ccb78UL, 0xdf64c600UL, 0xf21cd188UL, 0xe934dcf0UL,
+		0xa8ecfe98UL, 0xb3c4f3e0UL, 0x9ebce468UL, 0x8594e910UL,
+		0xab4d6a8fUL, 0xb06567f7UL, 0x9d1d707fUL, 0x86357d07UL,
+		0xc7ed5f6fUL, 0xdcc55217UL, 0xf1bd459fUL, 0xea9548e7UL,
+		0x720d014fUL, 0x69250c37UL, 0x445d1bbfUL, 0x5f7516c7UL,
+		0x1ead34afUL, 0x058539d7UL, 0x28fd2e5fUL, 0x33d52327UL
+	},
+	{
+		0x00000000UL, 0x4f576811UL, 0x9eaed022UL, 0xd1f9b833UL,
+		0x399cbdf3UL, 0x76cbd5e2UL, 0xa7326dd1UL, 0xe86505c0UL,
+		0x73397be6UL, 0x3c6e13f7UL, 0xed97abc4UL, 0xa2c0c3d5UL,
+		0x4aa5c615UL, 0x05f2ae04UL, 0xd40b1637UL, 0x9b5c7e26UL,
+		0xe672f7ccUL, 0xa9259fddUL, 0x78dc27eeUL, 0x378b4fffUL,
+		0xdfee4a3fUL, 0x90b9222eUL, 0x41409a1dUL, 0x0e17f20cUL,
+		0x954b8c2aUL, 0xda1ce43bUL, 0x0be55c08UL, 0x44b23419UL,
+		0xacd731d9UL, 0xe38059c8UL, 0x3279e1fbUL, 0x7d2e89eaUL,
+		0xc824f22fUL, 0x87739a3eUL, 0x568a220dUL, 0x19dd4a1cUL,
+		0xf1b84fdcUL, 0xbeef27cdUL, 0x6f169ffeUL, 0x2041f7efUL,
+		0xbb1d89c9UL, 0xf44ae1d8UL, 0x25b359ebUL, 0x6ae431faUL,
+		0x8281343aUL, 0xcdd65c2bUL, 0x1c2fe418UL, 0x53788c09UL,
+		0x2e5605e3UL, 0x61016df2UL, 0xb0f8d5c1UL, 0xffafbdd0UL,
+		0x17cab810UL, 0x589dd001UL, 0x89646832UL, 0xc6330023UL,
+		0x5d6f7e05UL, 0x12381614UL, 0xc3c1ae27UL, 0x8c96c636UL,
+		0x64f3c3f6UL, 0x2ba4abe7UL, 0xfa5d13d4UL, 0xb50a7bc5UL,
+		0x9488f9e9UL, 0xdbdf91f8UL, 0x0a2629cbUL, 0x457141daUL,
+		0xad14441aUL, 0xe2432c0bUL, 0x33ba9438UL, 0x7cedfc29UL,
+		0xe7b1820fUL, 0xa8e6ea1eUL, 0x791f522dUL, 0x36483a3cUL,
+		0xde2d3ffcUL, 0x917a57edUL, 0x4083efdeUL, 0x0fd487cfUL,
+		0x72fa0e25UL, 0x3dad6634UL, 0xec54de07UL, 0xa303b616UL,
+		0x4b66b3d6UL, 0x0431dbc7UL, 0xd5c863f4UL, 0x9a9f0be5UL,
+		0x01c375c3UL, 0x4e941dd2UL, 0x9f6da5e1UL, 0xd03acdf0UL,
+		0x385fc830UL, 0x7708a021UL, 0xa6f11812UL, 0xe9a67003UL,
+		0x5cac0bc6UL, 0x13fb63d7UL, 0xc202dbe4UL, 0x8d55b3f5UL,
+		0x6530b635UL, 0x2a67de24UL, 0xfb9e6617UL, 0xb4c90e06UL,
+		0x2f957020UL, 0x60c21831UL, 0xb13ba002UL, 0xfe6cc813UL,
+		0x1609cdd3UL, 0x595ea5c2UL, 0x88a71df1UL, 0xc7f075e0UL,
+		0xbadefc0aUL, 0xf589941bUL, 0x24702c28UL, 0x6b274439UL,
+		0x834241f9UL, 0xcc1529e8UL, 0x1dec91dbUL, 0x52bbf9caUL,
+		0xc9e787ecUL, 0x86b0effdUL, 0x574957ceUL, 0x181e3fdfUL,
+		0xf07b3a1fUL, 0xbf2c520eUL, 0x6ed5ea3dUL, 0x2182822cUL,
+		0x2dd0ee65UL, 0x62878674UL, 0xb37e3e47UL, 0xfc295656UL,
+		0x144c5396UL, 0x5b1b3b87UL, 0x8ae283b4UL, 0xc5b5eba5UL,
+		0x5ee99583UL, 0x11befd92UL, 0xc04745a1UL, 0x8f102db0UL,
+		0x67752870UL, 0x28224061UL, 0xf9dbf852UL, 0xb68c9043UL,
+		0xcba219a9UL, 0x84f571b8UL, 0x550cc98bUL, 0x1a5ba19aUL,
+		0xf23ea45aUL, 0xbd69cc4bUL, 0x6c907478UL, 0x23c71c69UL,
+		0xb89b624fUL, 0xf7cc0a5eUL, 0x2635b26dUL, 0x6962da7cUL,
+		0x8107dfbcUL, 0xce50b7adUL, 0x1fa90f9eUL, 0x50fe678fUL,
+		0xe5f41c4aUL, 0xaaa3745bUL, 0x7b5acc68UL, 0x340da479UL,
+		0xdc68a1b9UL, 0x933fc9a8UL, 0x42c6719bUL, 0x0d91198aUL,
+		0x96cd67acUL, 0xd99a0fbdUL, 0x0863b78eUL, 0x4734df9fUL,
+		0xaf51da5fUL, 0xe006b24eUL, 0x31ff0a7dUL, 0x7ea8626cUL,
+		0x0386eb86UL, 0x4cd18397UL, 0x9d283ba4UL, 0xd27f53b5UL,
+		0x3a1a5675UL, 0x754d3e64UL, 0xa4b48657UL, 0xebe3ee46UL,
+		0x70bf9060UL, 0x3fe8f871UL, 0xee114042UL, 0xa1462853UL,
+		0x49232d93UL, 0x06744582UL, 0xd78dfdb1UL, 0x98da95a0UL,
+		0xb958178cUL, 0xf60f7f9dUL, 0x27f6c7aeUL, 0x68a1afbfUL,
+		0x80c4aa7fUL, 0xcf93c26eUL, 0x1e6a7a5dUL, 0x513d124cUL,
+		0xca616c6aUL, 0x8536047bUL, 0x54cfbc48UL, 0x1b98d459UL,
+		0xf3fdd199UL, 0xbcaab988UL, 0x6d5301bbUL, 0x220469aaUL,
+		0x5f2ae040UL, 0x107d8851UL, 0xc1843062UL, 0x8ed35873UL,
+		0x66b65db3UL, 0x29e135a2UL, 0xf8188d91UL, 0xb74fe580UL,
+		0x2c139ba6UL, 0x6344f3b7UL, 0xb2bd4b84UL, 0xfdea2395UL,
+		0x158f2655UL, 0x5ad84e44UL, 0x8b21f677UL, 0xc4769e66UL,
+		0x717ce5a3UL, 0x3e2b8db2UL, 0xefd23581UL, 0xa0855d90UL,
+		0x48e05850UL, 0x07b73041UL, 0xd64e8872UL, 0x9919e063UL,
+		0x02459e45UL, 0x4d12f654UL, 0x9ceb4e67UL, 0xd3bc2676UL,
+		0x3bd923b6UL, 0x748e4ba7UL, 0xa577f394UL, 0xea209b85UL,
+		0x970e126fUL, 0xd8597a7eUL, 0x09a0c24dUL, 0x46f7aa5cUL,
+		0xae92af9cUL, 0xe1c5c78dUL, 0x303c7fbeUL, 0x7f6b17afUL,
+		0xe4376989UL, 0xab600198UL, 0x7a99b9abUL, 0x35ced1baUL,
+		0xddabd47aUL, 0x92fcbc6bUL, 0x43050458UL, 0x0c526c49UL
+	},
+	{
+		0x00000000UL, 0x5ba1dccaUL, 0xb743b994UL, 0xece2655eUL,
+		0x6a466e9fUL, 0x31e7b255UL, 0xdd05d70bUL, 0x86a40bc1UL,
+		0xd48cdd3eUL, 0x8f2d01f4UL, 0x63cf64aaUL, 0x386eb860UL,
+		0xbecab3a1UL, 0xe56b6f6bUL, 0x09890a35UL, 0x5228d6ffUL,
+		0xadd8a7cbUL, 0xf6797b01UL, 0x1a9b1e5fUL, 0x413ac295UL,
+		0xc79ec954UL, 0x9c3f159eUL, 0x70dd70c0UL, 0x2b7cac0aUL,
+		0x79547af5UL, 0x22f5a63fUL, 0xce17c361UL, 0x95b61fabUL,
+		0x1312146aUL, 0x48b3c8a0UL, 0xa451adfeUL, 0xfff07134UL,
+		0x5f705221UL, 0x04d18eebUL, 0xe833ebb5UL, 0xb392377fUL,
+		0x35363cbeUL, 0x6e97e074UL, 0x8275852aUL, 0xd9d459e0UL,
+		0x8bfc8f1fUL, 0xd05d53d5UL, 0x3cbf368bUL, 0x671eea41UL,
+		0xe1bae180UL, 0xba1b3d4aUL, 0x56f95814UL, 0x0d5884deUL,
+		0xf2a8f5eaUL, 0xa9092920UL, 0x45eb4c7eUL, 0x1e4a90b4UL,
+		0x98ee9b75UL, 0xc34f47bfUL, 0x2fad22e1UL, 0x740cfe2bUL,
+		0x262428d4UL, 0x7d85f41eUL, 0x91679140UL, 0xcac64d8aUL,
+		0x4c62464bUL, 0x17c39a81UL, 0xfb21ffdfUL, 0xa0802315UL,
+		0xbee0a442UL, 0xe5417888UL, 0x09a31dd6UL, 0x5202c11cUL,
+		0xd4a6caddUL, 0x8f071617UL, 0x63e57349UL, 0x3844af83UL,
+		0x6a6c797cUL, 0x31cda5b6UL, 0xdd2fc0e8UL, 0x868e1c22UL,
+		0x002a17e3UL, 0x5b8bcb29UL, 0xb769ae77UL, 0xecc872bdUL,
+		0x13380389UL, 0x4899df43UL, 0xa47bba1dUL, 0xffda66d7UL,
+		0x797e6d16UL, 0x22dfb1dcUL, 0xce3dd482UL, 0x959c0848UL,
+		0xc7b4deb7UL, 0x9c15027dUL, 0x70f76723UL, 0x2b56bbe9UL,
+		0xadf2b028UL, 0xf6536ce2UL, 0x1ab109bcUL, 0x4110d576UL,
+		0xe190f663UL, 0xba312aa9UL, 0x56d34ff7UL, 0x0d72933dUL,
+		0x8bd698fcUL, 0xd0774436UL, 0x3c952168UL, 0x6734fda2UL,
+		0x351c2b5dUL, 0x6ebdf797UL, 0x825f92c9UL, 0xd9fe4e03UL,
+		0x5f5a45c2UL, 0x04fb9908UL, 0xe819fc56UL, 0xb3b8209cUL,
+		0x4c4851a8UL, 0x17e98d62UL, 0xfb0be83cUL, 0xa0aa34f6UL,
+		0x260e3f37UL, 0x7dafe3fdUL, 0x914d86a3UL, 0xcaec5a69UL,
+		0x98c48c96UL, 0xc365505cUL, 0x2f873502UL, 0x7426e9c8UL,
+		0xf282e209UL, 0xa9233ec3UL, 0x45c15b9dUL, 0x1e608757UL,
+		0x79005533UL, 0x22a189f9UL, 0xce43eca7UL, 0x95e2306dUL,
+		0x13463bacUL, 0x48e7e766UL, 0xa4058238UL, 0xffa45ef2UL,
+		0xad8c880dUL, 0xf62d54c7UL, 0x1acf3199UL, 0x416eed53UL,
+		0xc7cae692UL, 0x9c6b3a58UL, 0x70895f06UL, 0x2b2883ccUL,
+		0xd4d8f2f8UL, 0x8f792e32UL, 0x639b4b6cUL, 0x383a97a6UL,
+		0xbe9e9c67UL, 0xe53f40adUL, 0x09dd25f3UL, 0x527cf939UL,
+		0x00542fc6UL, 0x5bf5f30cUL, 0xb7179652UL, 0xecb64a98UL,
+		0x6a124159UL, 0x31b39d93UL, 0xdd51f8cdUL, 0x86f02407UL,
+		0x26700712UL, 0x7dd1dbd8UL, 0x9133be86UL, 0xca92624cUL,
+		0x4c36698dUL, 0x1797b547UL, 0xfb75d019UL, 0xa0d40cd3UL,
+		0xf2fcda2cUL, 0xa95d06e6UL, 0x45bf63b8UL, 0x1e1ebf72UL,
+		0x98bab4b3UL, 0xc31b6879UL, 0x2ff90d27UL, 0x7458d1edUL,
+		0x8ba8a0d9UL, 0xd0097c13UL, 0x3ceb194dUL, 0x674ac587UL,
+		0xe1eece46UL, 0xba4f128cUL, 0x56ad77d2UL, 0x0d0cab18UL,
+		0x5f247de7UL, 0x0485a12dUL, 0xe867c473UL, 0xb3c618b9UL,
+		0x35621378UL, 0x6ec3cfb2UL, 0x8221aaecUL, 0xd9807626UL,
+		0xc7e0f171UL, 0x9c412dbbUL, 0x70a348e5UL, 0x2b02942fUL,
+		0xada69feeUL, 0xf6074324UL, 0x1ae5267aUL, 0x4144fab0UL,
+		0x136c2c4fUL, 0x48cdf085UL, 0xa42f95dbUL, 0xff8e4911UL,
+		0x792a42d0UL, 0x228b9e1aUL, 0xce69fb44UL, 0x95c8278eUL,
+		0x6a3856baUL, 0x31998a70UL, 0xdd7bef2eUL, 0x86da33e4UL,
+		0x007e3825UL, 0x5bdfe4efUL, 0xb73d81b1UL, 0xec9c5d7bUL,
+		0xbeb48b84UL, 0xe515574eUL, 0x09f73210UL, 0x5256eedaUL,
+		0xd4f2e51bUL, 0x8f5339d1UL, 0x63b15c8fUL, 0x38108045UL,
+		0x9890a350UL, 0xc3317f9aUL, 0x2fd31ac4UL, 0x7472c60eUL,
+		0xf2d6cdcfUL, 0xa9771105UL, 0x4595745bUL, 0x1e34a891UL,
+		0x4c1c7e6eUL, 0x17bda2a4UL, 0xfb5fc7faUL, 0xa0fe1b30UL,
+		0x265a10f1UL, 0x7dfbcc3bUL, 0x9119a965UL, 0xcab875afUL,
+		0x3548049bUL, 0x6ee9d851UL, 0x820bbd0fUL, 0xd9aa61c5UL,
+		0x5f0e6a04UL, 0x04afb6ceUL, 0xe84dd390UL, 0xb3ec0f5aUL,
+		0xe1c4d9a5UL, 0xba65056fUL, 0x56876031UL, 0x0d26bcfbUL,
+		0x8b82b73aUL, 0xd0236bf0UL, 0x3cc10eaeUL, 0x6760d264UL
 	}
-	assorted_bzip_crc32_table_computed = 1;
-}
+};
 
 /* Calculates the CRC-32 of a buffer
  * Use a previous key of 0 to calculate a new CRC-32
@@ -87,6 +584,7 @@ int assorted_bzip_calculate_crc32(
 	size_t data_offset         = 0;
 	uint32_t crc32_table_index = 0;
 	uint32_t safe_crc32        = 0;
+	uint32_t value_32bit       = 0;
 
 	if( crc32 == NULL )
 	{
@@ -121,34 +619,53 @@ int assorted_bzip_calculate_crc32(
 
 		return( -1 );
 	}
-        if( assorted_bzip_crc32_table_computed == 0 )
-	{
-		assorted_bzip_initialize_crc32_table();
-	}
 	safe_crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
 
-        for( data_offset = 0;
-	     data_offset < data_size;
-	     data_offset++ )
+	/* Process 8 bytes at a time, the first 4 bytes are combined with the CRC-32
+	 * and every byte is looked up in the table of its distance to the end of the 8 bytes
+	 */
+	while( ( data_size - data_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		safe_crc32 ^= value_32bit;
+
+		safe_crc32 = assorted_bzip_crc32_table[ 7 ][ safe_crc32 >> 24 ]
+		           ^ assorted_bzip_crc32_table[ 6 ][ ( safe_crc32 >> 16 ) & 0x000000ffUL ]
+		           ^ assorted_bzip_crc32_table[ 5 ][ ( safe_crc32 >> 8 ) & 0x000000ffUL ]
+		           ^ assorted_bzip_crc32_table[ 4 ][ safe_crc32 & 0x000000ffUL ]
+		           ^ assorted_bzip_crc32_table[ 3 ][ data[ data_offset + 4 ] ]
+		           ^ assorted_bzip_crc32_table[ 2 ][ data[ data_offset + 5 ] ]
+		           ^ assorted_bzip_crc32_table[ 1 ][ data[ data_offset + 6 ] ]
+		           ^ assorted_bzip_crc32_table[ 0 ][ data[ data_offset + 7 ] ];
+
+		data_offset += 8;
+	}
+	while( data_offset < data_size )
 	{
 		/* Use the upper 8-bits of the pre-calculated CRC-32 values due to BZip bit ordering
 		 */
-		crc32_table_index = ( ( safe_crc32 >> 24 ) ^ data[ data_offset ] ) & 0x000000ffUL;
+		crc32_table_index = ( ( safe_crc32 >> 24 ) ^ data[ data_offset++ ] ) & 0x000000ffUL;
 
-		safe_crc32 = assorted_bzip_crc32_table[ crc32_table_index ] ^ ( safe_crc32 << 8 );
-        }
+		safe_crc32 = assorted_bzip_crc32_table[ 0 ][ crc32_table_index ] ^ ( safe_crc32 << 8 );
+	}
         *crc32 = safe_crc32 ^ (uint32_t) 0xffffffffUL;
 
 	return( 1 );
 }
 
 /* Reverses a Burrows-Wheeler transform and run-length encoded strings
+ * The permutations must contain an entry for every input data byte, an entry
+ * is packed with the byte value in the lower 8 bits and the index of the next
+ * entry in the upper 24 bits so that the transform only walks a single vector
  * Returns 1 on success or -1 on error
  */
 int assorted_bzip_reverse_burrows_wheeler_transform(
      const uint8_t *input_data,
      size_t input_data_size,
-     size_t *permutations,
+     uint32_t *permutations,
      uint32_t origin_pointer,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -161,11 +678,14 @@ int assorted_bzip_reverse_burrows_wheeler_transform(
 	size_t input_data_offset             = 0;
 	size_t distribution_value            = 0;
 	size_t number_of_values              = 0;
-	size_t permutation_value             = 0;
+	size_t run_length                    = 0;
 	size_t safe_uncompressed_data_offset = 0;
+	uint32_t permutation_value           = 0;
+	uint32_t run_permutation_value       = 0;
 	uint16_t byte_value                  = 0;
 	uint16_t last_byte_value             = 0;
 	uint8_t number_of_last_byte_values   = 0;
+	uint8_t run_index                    = 0;
 
 	if( input_data == NULL )
 	{
@@ -178,7 +698,7 @@ int assorted_bzip_reverse_burrows_wheeler_transform(
 
 		return( -1 );
 	}
-	if( input_data_size > (size_t) SSIZE_MAX )
+	if( input_data_size > (size_t) 0x00ffffffUL )
 	{
 		libcerror_error_set(
 		 error,
@@ -200,6 +720,18 @@ int assorted_bzip_reverse_burrows_wheeler_transform(
 
 		return( -1 );
 	}
+	if( ( input_data_size > 0 )
+	 && ( (size_t) origin_pointer >= input_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid origin pointer value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -246,6 +778,10 @@ int assorted_bzip_reverse_burrows_wheeler_transform(
 
 		return( -1 );
 	}
+	if( input_data_size == 0 )
+	{
+		return( 1 );
+	}
 	if( memory_set(
 	     distributions,
 	     0,
@@ -267,6 +803,8 @@ int assorted_bzip_reverse_burrows_wheeler_transform(
 		byte_value = input_data[ input_data_offset ];
 
 		distributions[ byte_value ] += 1;
+
+		permutations[ input_data_offset ] = (uint32_t) byte_value;
 	}
 	for( byte_value = 0;
 	     byte_value < 256;
@@ -286,37 +824,83 @@ int assorted_bzip_reverse_burrows_wheeler_transform(
 
 		distribution_value = distributions[ byte_value ];
 
-		permutations[ distribution_value ] = input_data_offset;
+		permutations[ distribution_value ] |= (uint32_t) input_data_offset << 8;
 
 		distributions[ byte_value ] += 1;
 	}
-	permutation_value = permutations[ origin_pointer ];
+	permutation_value = permutations[ origin_pointer ] >> 8;
 
 	for( input_data_offset = 0;
 	     input_data_offset < input_data_size;
 	     input_data_offset++ )
 	{
-		byte_value = input_data[ permutation_value ];
+		permutation_value = permutations[ permutation_value ];
+
+		byte_value         = (uint16_t) ( permutation_value & 0x000000ffUL );
+		permutation_value >>= 8;
 
 		if( number_of_last_byte_values == 4 )
 		{
-			if( ( byte_value > uncompressed_data_size )
-			 || ( safe_uncompressed_data_offset > ( uncompressed_data_size - byte_value ) ) )
+			run_length = (size_t) byte_value;
+
+			/* Long runs are stored as groups of 4 equal bytes and a run-length,
+			 * the groups that continue the run are expanded together
+			 */
+			while( ( input_data_size - input_data_offset ) > 5 )
+			{
+				run_permutation_value = permutation_value;
+
+				for( run_index = 0;
+				     run_index < 4;
+				     run_index++ )
+				{
+					run_permutation_value = permutations[ run_permutation_value ];
+
+					if( (uint16_t) ( run_permutation_value & 0x000000ffUL ) != last_byte_value )
+					{
+						break;
+					}
+					run_permutation_value >>= 8;
+				}
+				if( run_index < 4 )
+				{
+					break;
+				}
+				run_permutation_value = permutations[ run_permutation_value ];
+
+				run_length        += 4 + (size_t) ( run_permutation_value & 0x000000ffUL );
+				permutation_value  = run_permutation_value >> 8;
+				input_data_offset += 5;
+			}
+			if( ( run_length > uncompressed_data_size )
+			 || ( safe_uncompressed_data_offset > ( uncompressed_data_size - run_length ) ) )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
 				 "%s: invalid uncompressed data value too small.",
 				 function );
 
 				return( -1 );
 			}
-			while( byte_value > 0 )
+			if( run_length > 0 )
 			{
-				uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) last_byte_value;
-
-				byte_value--;
+				if( memory_set(
+				     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+				     (int) last_byte_value,
+				     run_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to set run-length in uncompressed data.",
+					 function );
+
+					return( -1 );
+				}
+				safe_uncompressed_data_offset += run_length;
 			}
 			last_byte_value            = 0;
 			number_of_last_byte_values = 0;
@@ -334,8 +918,8 @@ int assorted_bzip_reverse_burrows_wheeler_transform(
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
 				 "%s: invalid uncompressed data value too small.",
 				 function );
 
@@ -343,298 +927,377 @@ int assorted_bzip_reverse_burrows_wheeler_transform(
 			}
 			uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) byte_value;
 		}
-		permutation_value = permutations[ permutation_value ];
 	}
 	*uncompressed_data_offset = safe_uncompressed_data_offset;
 
 	return( 1 );
 }
 
-/* Reads the stream header
+/* Reverses a Burrows-Wheeler transform and run-length encoded strings
+ * without storing the uncompressed data
+ * The uncompressed data is passed through a small buffer to calculate the CRC-32
+ * Use a previous CRC-32 of 0 to calculate a new CRC-32
+ * The permutations are packed as in assorted_bzip_reverse_burrows_wheeler_transform
  * Returns 1 on success or -1 on error
  */
-int assorted_bzip_read_stream_header(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *compressed_data_offset,
-     uint8_t *compression_level,
+int assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint32_t *permutations,
+     uint32_t origin_pointer,
+     uint32_t *crc32,
+     size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
-	static char *function              = "assorted_bzip_read_stream_header";
-	size_t safe_compressed_data_offset = 0;
-	uint8_t safe_compression_level     = 0;
+	uint8_t output_buffer[ 4096 ];
+	size_t distributions[ 256 ];
 
-	if( compressed_data == NULL )
+	static char *function                = "assorted_bzip_reverse_burrows_wheeler_transform_checksum";
+	size_t distribution_value            = 0;
+	size_t input_data_offset             = 0;
+	size_t number_of_values              = 0;
+	size_t output_buffer_offset          = 0;
+	size_t safe_uncompressed_data_offset = 0;
+	size_t write_size                    = 0;
+	uint32_t permutation_value           = 0;
+	uint32_t run_permutation_value       = 0;
+	uint32_t safe_crc32                  = 0;
+	uint16_t byte_value                  = 0;
+	uint16_t last_byte_value             = 0;
+	uint8_t number_of_last_byte_values   = 0;
+	uint8_t run_index                    = 0;
+
+	if( input_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid input data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( compressed_data_size < 4 )
-	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	if( input_data_size > (size_t) 0x00ffffffUL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid compressed data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_offset == NULL )
+	if( permutations == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data offset.",
+		 "%s: invalid permutations.",
 		 function );
 
 		return( -1 );
 	}
-	safe_compressed_data_offset = *compressed_data_offset;
-
-	if( safe_compressed_data_offset > ( compressed_data_size - 4 ) )
+	if( ( input_data_size > 0 )
+	 && ( (size_t) origin_pointer >= input_data_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid compressed data value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid origin pointer value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( compression_level == NULL )
+	if( crc32 == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compression level.",
+		 "%s: invalid CRC-32.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: stream header data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( compressed_data[ safe_compressed_data_offset ] ),
-		 4,
-		 0 );
-	}
-#endif
-	if( ( compressed_data[ safe_compressed_data_offset + 0 ] != 'B' )
-	 || ( compressed_data[ safe_compressed_data_offset + 1 ] != 'Z' ) )
+	if( uncompressed_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported signature.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
 		 function );
 
 		return( -1 );
 	}
-	safe_compression_level = compressed_data[ safe_compressed_data_offset + 3 ];
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+	safe_crc32                    = *crc32;
 
-	if( ( safe_compression_level < '1' )
-	 || ( safe_compression_level > '9' ) )
+	if( input_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     distributions,
+	     0,
+	     sizeof( size_t ) * 256 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression level.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear distributions.",
 		 function );
 
 		return( -1 );
 	}
-	safe_compression_level -= '0';
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	for( input_data_offset = 0;
+	     input_data_offset < input_data_size;
+	     input_data_offset++ )
 	{
-		libcnotify_printf(
-		 "%s: signature\t\t\t\t: %c%c\n",
-		 function,
-		 compressed_data[ safe_compressed_data_offset + 0 ],
-		 compressed_data[ safe_compressed_data_offset + 1 ] );
-
-		libcnotify_printf(
-		 "%s: format version\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 compressed_data[ safe_compressed_data_offset + 2 ] );
+		byte_value = input_data[ input_data_offset ];
 
-		libcnotify_printf(
-		 "%s: compression level\t\t\t: %" PRIu8 "\n",
-		 function,
-		 safe_compression_level );
+		distributions[ byte_value ] += 1;
 
-		libcnotify_printf(
-		 "\n" );
+		permutations[ input_data_offset ] = (uint32_t) byte_value;
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-	if( compressed_data[ safe_compressed_data_offset + 2 ] != 0x68 )
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported format version.",
-		 function );
+		number_of_values = distributions[ byte_value ];
 
-		return( -1 );
-	}
-	*compressed_data_offset = safe_compressed_data_offset + 4;
-	*compression_level      = safe_compression_level;
+		distributions[ byte_value ] = distribution_value;
 
-	return( 1 );
-}
+		distribution_value += number_of_values;
+	}
+	for( input_data_offset = 0;
+	     input_data_offset < input_data_size;
+	     input_data_offset++ )
+	{
+		byte_value = input_data[ input_data_offset ];
 
-/* Reads a (stream) block header or stream footer signature
- * Returns 1 on success or -1 on error
- */
-int assorted_bzip_read_signature(
-     assorted_bit_stream_t *bit_stream,
-     uint64_t *signature,
-     libcerror_error_t **error )
-{
-	static char *function   = "assorted_bzip_read_signature";
-	uint32_t value_32bit    = 0;
-	uint64_t safe_signature = 0;
+		distribution_value = distributions[ byte_value ];
 
-	if( signature == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid signature.",
-		 function );
+		permutations[ distribution_value ] |= (uint32_t) input_data_offset << 8;
 
-		return( -1 );
+		distributions[ byte_value ] += 1;
 	}
-	if( assorted_bit_stream_get_value(
-	     bit_stream,
-	     24,
-	     &value_32bit,
-	     error ) != 1 )
+	permutation_value = permutations[ origin_pointer ] >> 8;
+
+	for( input_data_offset = 0;
+	     input_data_offset < input_data_size;
+	     input_data_offset++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from bit stream.",
-		 function );
+		permutation_value = permutations[ permutation_value ];
 
-		return( -1 );
-	}
-	safe_signature = value_32bit;
+		byte_value         = (uint16_t) ( permutation_value & 0x000000ffUL );
+		permutation_value >>= 8;
 
-	if( assorted_bit_stream_get_value(
-	     bit_stream,
-	     24,
-	     &value_32bit,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from bit stream.",
-		 function );
+		if( number_of_last_byte_values == 4 )
+		{
+			number_of_values = (size_t) byte_value;
 
-		return( -1 );
-	}
-	safe_signature <<= 24;
-	safe_signature  |= value_32bit;
+			/* Long runs are stored as groups of 4 equal bytes and a run-length,
+			 * the groups that continue the run are expanded together
+			 */
+			while( ( input_data_size - input_data_offset ) > 5 )
+			{
+				run_permutation_value = permutation_value;
 
-	*signature = safe_signature;
+				for( run_index = 0;
+				     run_index < 4;
+				     run_index++ )
+				{
+					run_permutation_value = permutations[ run_permutation_value ];
+
+					if( (uint16_t) ( run_permutation_value & 0x000000ffUL ) != last_byte_value )
+					{
+						break;
+					}
+					run_permutation_value >>= 8;
+				}
+				if( run_index < 4 )
+				{
+					break;
+				}
+				run_permutation_value = permutations[ run_permutation_value ];
+
+				number_of_values  += 4 + (size_t) ( run_permutation_value & 0x000000ffUL );
+				permutation_value  = run_permutation_value >> 8;
+				input_data_offset += 5;
+			}
+			number_of_last_byte_values = 0;
+		}
+		else
+		{
+			if( byte_value != last_byte_value )
+			{
+				number_of_last_byte_values = 0;
+			}
+			last_byte_value             = byte_value;
+			number_of_last_byte_values += 1;
+
+			number_of_values = 1;
+		}
+		while( number_of_values > 0 )
+		{
+			write_size = 4096 - output_buffer_offset;
+
+			if( write_size > number_of_values )
+			{
+				write_size = number_of_values;
+			}
+			if( write_size == 1 )
+			{
+				output_buffer[ output_buffer_offset ] = (uint8_t) last_byte_value;
+			}
+			else if( memory_set(
+			          &( output_buffer[ output_buffer_offset ] ),
+			          (int) last_byte_value,
+			          write_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set run-length in output buffer.",
+				 function );
+
+				return( -1 );
+			}
+			output_buffer_offset += write_size;
+			number_of_values     -= write_size;
+
+			/* Flush the buffer into the CRC-32 when it is full
+			 */
+			if( output_buffer_offset >= 4096 )
+			{
+				if( assorted_bzip_calculate_crc32(
+				     &safe_crc32,
+				     output_buffer,
+				     output_buffer_offset,
+				     safe_crc32,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to calculate CRC-32.",
+					 function );
+
+					return( -1 );
+				}
+				safe_uncompressed_data_offset += output_buffer_offset;
+				output_buffer_offset           = 0;
+			}
+		}
+		/* Reset the last byte value after a run-length
+		 */
+		if( number_of_last_byte_values == 0 )
+		{
+			last_byte_value = 0;
+		}
+	}
+	if( output_buffer_offset > 0 )
+	{
+		if( assorted_bzip_calculate_crc32(
+		     &safe_crc32,
+		     output_buffer,
+		     output_buffer_offset,
+		     safe_crc32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+		safe_uncompressed_data_offset += output_buffer_offset;
+	}
+	*crc32                    = safe_crc32;
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
 
 	return( 1 );
 }
 
-/* Reads a (stream) block header
+/* Reads the stream header
  * Returns 1 on success or -1 on error
  */
-int assorted_bzip_read_block_header(
-     assorted_bit_stream_t *bit_stream,
-     uint64_t signature,
-     uint32_t *origin_pointer,
+int assorted_bzip_read_stream_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *compression_level,
      libcerror_error_t **error )
 {
-	static char *function        = "assorted_bzip_read_block_header";
-	uint32_t checksum            = 0;
-	uint32_t safe_origin_pointer = 0;
-	uint32_t value_32bit         = 0;
-	uint8_t is_randomized        = 0;
+	static char *function              = "assorted_bzip_read_stream_header";
+	size_t safe_compressed_data_offset = 0;
+	uint8_t safe_compression_level     = 0;
 
-	if( origin_pointer == NULL )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid origin pointer.",
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( assorted_bit_stream_get_value(
-	     bit_stream,
-	     32,
-	     &checksum,
-	     error ) != 1 )
+	if( ( compressed_data_size < 4 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from bit stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( assorted_bit_stream_get_value(
-	     bit_stream,
-	     1,
-	     &value_32bit,
-	     error ) != 1 )
+	if( compressed_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from bit stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
 		 function );
 
 		return( -1 );
 	}
-	is_randomized = (uint8_t) ( value_32bit & 0x00000001UL );
+	safe_compressed_data_offset = *compressed_data_offset;
 
-	if( assorted_bit_stream_get_value(
-	     bit_stream,
-	     24,
-	     &safe_origin_pointer,
-	     error ) != 1 )
+	if( safe_compressed_data_offset > ( compressed_data_size - 4 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from bit stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression level.",
 		 function );
 
 		return( -1 );
@@ -643,102 +1306,127 @@ int assorted_bzip_read_block_header(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: signature\t\t\t\t: 0x%08" PRIx64 "\n",
-		 function,
-		 signature );
+		 "%s: stream header data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 4,
+		 0 );
+	}
+#endif
+	if( ( compressed_data[ safe_compressed_data_offset + 0 ] != 'B' )
+	 || ( compressed_data[ safe_compressed_data_offset + 1 ] != 'Z' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compression_level = compressed_data[ safe_compressed_data_offset + 3 ];
+
+	if( ( safe_compression_level < '1' )
+	 || ( safe_compression_level > '9' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compression_level -= '0';
 
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
 		libcnotify_printf(
-		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 "%s: signature\t\t\t\t: %c%c\n",
 		 function,
-		 checksum );
+		 compressed_data[ safe_compressed_data_offset + 0 ],
+		 compressed_data[ safe_compressed_data_offset + 1 ] );
 
 		libcnotify_printf(
-		 "%s: is randomized\t\t\t\t: %" PRIu8 "\n",
+		 "%s: format version\t\t\t: 0x%02" PRIx8 "\n",
 		 function,
-		 is_randomized );
+		 compressed_data[ safe_compressed_data_offset + 2 ] );
 
 		libcnotify_printf(
-		 "%s: origin pointer\t\t\t\t: 0x%06" PRIx32 "\n",
+		 "%s: compression level\t\t\t: %" PRIu8 "\n",
 		 function,
-		 safe_origin_pointer );
+		 safe_compression_level );
 
 		libcnotify_printf(
 		 "\n" );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( signature != 0x314159265359UL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported signature.",
-		 function );
-
-		return( -1 );
-	}
-	if( is_randomized != 0 )
+	if( compressed_data[ safe_compressed_data_offset + 2 ] != 0x68 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported is randomized flag.",
+		 "%s: unsupported format version.",
 		 function );
 
 		return( -1 );
 	}
-	*origin_pointer = safe_origin_pointer;
+	*compressed_data_offset = safe_compressed_data_offset + 4;
+	*compression_level      = safe_compression_level;
 
 	return( 1 );
 }
 
-/* Reads a (stream block) symbol stack
+/* Reads a (stream) block header or stream footer signature
  * Returns 1 on success or -1 on error
  */
-int assorted_bzip_read_symbol_stack(
+int assorted_bzip_read_signature(
      assorted_bit_stream_t *bit_stream,
-     uint8_t *symbol_stack,
-     uint16_t *number_of_symbols,
+     uint64_t *signature,
      libcerror_error_t **error )
 {
-	static char *function    = "assorted_bzip_read_symbol_stack";
-	uint32_t level1_bitmask  = 0;
-	uint32_t level1_value    = 0;
-	uint32_t level2_bitmask  = 0;
-	uint32_t level2_value    = 0;
-	uint16_t symbol_index    = 0;
-	uint8_t level1_bit_index = 0;
-	uint8_t level2_bit_index = 0;
-	uint8_t symbol_value     = 0;
+	static char *function   = "assorted_bzip_read_signature";
+	uint32_t value_32bit    = 0;
+	uint64_t safe_signature = 0;
 
-	if( symbol_stack == NULL )
+	if( signature == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid symbol stack.",
+		 "%s: invalid signature.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_symbols == NULL )
+	if( assorted_bit_stream_get_value_front_to_back(
+	     bit_stream,
+	     24,
+	     &value_32bit,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of symbols.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( assorted_bit_stream_get_value(
+	safe_signature = value_32bit;
+
+	if( assorted_bit_stream_get_value_front_to_back(
 	     bit_stream,
-	     16,
-	     &level1_value,
+	     24,
+	     &value_32bit,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -750,27 +1438,232 @@ int assorted_bzip_read_symbol_stack(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: level 1 value\t\t\t\t: 0x%04" PRIx32 "\n",
-		 function,
-		 level1_value );
-	}
-#endif
-	level1_bitmask = 0x00008000UL;
+	safe_signature <<= 24;
+	safe_signature  |= value_32bit;
 
-	for( level1_bit_index = 0;
-	     level1_bit_index < 16;
-	     level1_bit_index++ )
-	{
-		if( ( level1_value & level1_bitmask ) != 0 )
-		{
-			if( assorted_bit_stream_get_value(
-			     bit_stream,
-			     16,
-			     &level2_value,
+	*signature = safe_signature;
+
+	return( 1 );
+}
+
+/* Reads a (stream) block header
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_read_block_header(
+     assorted_bit_stream_t *bit_stream,
+     uint64_t signature,
+     uint32_t *origin_pointer,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	static char *function        = "assorted_bzip_read_block_header";
+	uint32_t safe_checksum       = 0;
+	uint32_t safe_origin_pointer = 0;
+	uint32_t value_32bit         = 0;
+	uint8_t is_randomized        = 0;
+
+	if( origin_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid origin pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_get_value_front_to_back(
+	     bit_stream,
+	     32,
+	     &safe_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_get_value_front_to_back(
+	     bit_stream,
+	     1,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	is_randomized = (uint8_t) ( value_32bit & 0x00000001UL );
+
+	if( assorted_bit_stream_get_value_front_to_back(
+	     bit_stream,
+	     24,
+	     &safe_origin_pointer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 signature );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 safe_checksum );
+
+		libcnotify_printf(
+		 "%s: is randomized\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 is_randomized );
+
+		libcnotify_printf(
+		 "%s: origin pointer\t\t\t\t: 0x%06" PRIx32 "\n",
+		 function,
+		 safe_origin_pointer );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( signature != 0x314159265359UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_randomized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported is randomized flag.",
+		 function );
+
+		return( -1 );
+	}
+	*origin_pointer = safe_origin_pointer;
+	*checksum       = safe_checksum;
+
+	return( 1 );
+}
+
+/* Reads a (stream block) symbol stack
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_read_symbol_stack(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t *symbol_stack,
+     uint16_t *number_of_symbols,
+     libcerror_error_t **error )
+{
+	static char *function    = "assorted_bzip_read_symbol_stack";
+	uint32_t level1_bitmask  = 0;
+	uint32_t level1_value    = 0;
+	uint32_t level2_bitmask  = 0;
+	uint32_t level2_value    = 0;
+	uint16_t symbol_index    = 0;
+	uint8_t level1_bit_index = 0;
+	uint8_t level2_bit_index = 0;
+	uint8_t symbol_value     = 0;
+
+	if( symbol_stack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol stack.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of symbols.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_get_value_front_to_back(
+	     bit_stream,
+	     16,
+	     &level1_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: level 1 value\t\t\t\t: 0x%04" PRIx32 "\n",
+		 function,
+		 level1_value );
+	}
+#endif
+	level1_bitmask = 0x00008000UL;
+
+	for( level1_bit_index = 0;
+	     level1_bit_index < 16;
+	     level1_bit_index++ )
+	{
+		if( ( level1_value & level1_bitmask ) != 0 )
+		{
+			if( assorted_bit_stream_get_value_front_to_back(
+			     bit_stream,
+			     16,
+			     &level2_value,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -879,7 +1772,7 @@ int assorted_bzip_read_selectors(
 
 		while( tree_index < number_of_trees )
 		{
-			if( assorted_bit_stream_get_value(
+			if( assorted_bit_stream_get_value_front_to_back(
 			     bit_stream,
 			     1,
 			     &value_32bit,
@@ -963,7 +1856,7 @@ int assorted_bzip_read_huffman_tree(
 	uint8_t code_size         = 0;
 	uint8_t largest_code_size = 0;
 
-	if( assorted_bit_stream_get_value(
+	if( assorted_bit_stream_get_value_front_to_back(
 	     bit_stream,
 	     5,
 	     &value_32bit,
@@ -986,7 +1879,7 @@ int assorted_bzip_read_huffman_tree(
 	{
 		while( code_size < 20 )
 		{
-			if( assorted_bit_stream_get_value(
+			if( assorted_bit_stream_get_value_front_to_back(
 			     bit_stream,
 			     1,
 			     &value_32bit,
@@ -1005,7 +1898,7 @@ int assorted_bzip_read_huffman_tree(
 			{
 				break;
 			}
-			if( assorted_bit_stream_get_value(
+			if( assorted_bit_stream_get_value_front_to_back(
 			     bit_stream,
 			     1,
 			     &value_32bit,
@@ -1152,33 +2045,59 @@ int assorted_bzip_read_huffman_trees(
 			 tree_index );
 		}
 #endif
-		if( assorted_huffman_tree_initialize(
-		     &huffman_tree,
+		/* A Huffman tree that was created for a previous block is reused
+		 */
+		huffman_tree                = huffman_trees[ tree_index ];
+		huffman_trees[ tree_index ] = NULL;
+
+		if( huffman_tree == NULL )
+		{
+			if( assorted_huffman_tree_initialize(
+			     &huffman_tree,
+			     258,
+			     20,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create Huffman tree: %" PRIu8 ".",
+				 function,
+				 tree_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_bzip_read_huffman_tree(
+		     bit_stream,
+		     huffman_tree,
 		     number_of_symbols,
-		     20,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create Huffman tree: %" PRIu8 ".",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read Huffman tree: %" PRIu8 ".",
 			 function,
 			 tree_index );
 
 			goto on_error;
 		}
-		if( assorted_bzip_read_huffman_tree(
-		     bit_stream,
+		/* Build the lookup table up front so that switching between the trees
+		 * of the groups of 50 symbols only requires switching the tree
+		 */
+		if( assorted_huffman_tree_build_lookup_table(
 		     huffman_tree,
-		     number_of_symbols,
+		     bit_stream->storage_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read Huffman tree: %" PRIu8 ".",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build lookup table of Huffman tree: %" PRIu8 ".",
 			 function,
 			 tree_index );
 
@@ -1222,20 +2141,21 @@ int assorted_bzip_read_block_data(
      size_t *block_data_size,
      libcerror_error_t **error )
 {
-	static char *function                = "assorted_bzip_read_block_data";
-	size_t block_data_offset             = 0;
-	size_t safe_block_data_size          = 0;
-	size_t selector_index                = 0;
-	size_t symbol_index                  = 0;
-	uint64_t run_length                  = 0;
-	uint64_t run_length_value            = 0;
-	uint16_t end_of_block_symbol         = 0;
-	uint16_t symbol                      = 0;
-	uint8_t number_of_run_length_symbols = 0;
-	uint8_t stack_index                  = 0;
-	uint8_t stack_value                  = 0;
-	uint8_t stack_value_index            = 0;
-	uint8_t tree_index                   = 0;
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	static char *function                 = "assorted_bzip_read_block_data";
+	size_t block_data_offset              = 0;
+	size_t safe_block_data_size           = 0;
+	size_t selector_index                 = 0;
+	uint64_t run_length                   = 0;
+	uint64_t run_length_value             = 0;
+	uint16_t end_of_block_symbol          = 0;
+	uint16_t symbol                       = 0;
+	uint8_t number_of_group_symbols       = 0;
+	uint8_t number_of_run_length_symbols  = 0;
+	uint8_t stack_index                   = 0;
+	uint8_t stack_value                   = 0;
+	uint8_t stack_value_index             = 0;
+	uint8_t tree_index                    = 0;
 
 	if( bit_stream == NULL )
 	{
@@ -1305,25 +2225,45 @@ int assorted_bzip_read_block_data(
 	}
 	safe_block_data_size = *block_data_size;
 
-	tree_index = selectors[ 0 ];
+	end_of_block_symbol = number_of_symbols - 1;
 
-	if( tree_index > number_of_trees )
+	do
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid tree index value out of bounds.",
-		 function );
+		/* Every group of 50 symbols uses the Huffman tree of its selector
+		 */
+		if( number_of_group_symbols == 0 )
+		{
+			if( selector_index >= number_of_selectors )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid selector index value out of bounds.",
+				 function );
 
-		return( -1 );
-	}
-	end_of_block_symbol = number_of_symbols - 1;
+				return( -1 );
+			}
+			tree_index = selectors[ selector_index++ ];
+
+			if( tree_index >= number_of_trees )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid tree index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			huffman_tree            = huffman_trees[ tree_index ];
+			number_of_group_symbols = 50;
+		}
+		number_of_group_symbols--;
 
-	do
-	{
 		if( assorted_huffman_tree_get_symbol_from_bit_stream(
-		     huffman_trees[ tree_index ],
+		     huffman_tree,
 		     bit_stream,
 		     &symbol,
 		     error ) != 1 )
@@ -1367,15 +2307,24 @@ int assorted_bzip_read_block_data(
 			run_length_value             = 0;
 			number_of_run_length_symbols = 0;
 
-			while( run_length > 0 )
+			/* Inverse move-to-front transform
+			 * Note that 0 is already at the front of the stack hence the stack does not need to be reordered.
+			 */
+			if( memory_set(
+			     &( block_data[ block_data_offset ] ),
+			     symbol_stack[ 0 ],
+			     (size_t) run_length ) == NULL )
 			{
-				/* Inverse move-to-front transform
-				 * Note that 0 is already at the front of the stack hence the stack does not need to be reordered.
-				 */
-				block_data[ block_data_offset++ ] = symbol_stack[ 0 ];
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set 0-byte run-length in block data.",
+				 function );
 
-				run_length--;
+				return( -1 );
 			}
+			block_data_offset += (size_t) run_length;
 		}
 		if( symbol > end_of_block_symbol )
 		{
@@ -1411,11 +2360,31 @@ int assorted_bzip_read_block_data(
 			stack_value_index = symbol - 1;
 			stack_value       = symbol_stack[ stack_value_index ];
 
-			for( stack_index = stack_value_index;
-			     stack_index > 0;
-			     stack_index-- )
+			/* Most indexes are small hence these are shifted in place,
+			 * larger indexes are shifted as a single overlapping move
+			 */
+			if( stack_value_index < 8 )
+			{
+				for( stack_index = stack_value_index;
+				     stack_index > 0;
+				     stack_index-- )
+				{
+					symbol_stack[ stack_index ] = symbol_stack[ stack_index - 1 ];
+				}
+			}
+			else if( memory_move(
+			          &( symbol_stack[ 1 ] ),
+			          symbol_stack,
+			          (size_t) stack_value_index ) == NULL )
 			{
-				symbol_stack[ stack_index ] = symbol_stack[ stack_index - 1 ];
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move symbol stack values.",
+				 function );
+
+				return( -1 );
 			}
 			symbol_stack[ 0 ] = stack_value;
 
@@ -1451,37 +2420,6 @@ int assorted_bzip_read_block_data(
 			 symbol );
 		}
 #endif
-		symbol_index++;
-
-		if( ( symbol_index % 50 ) == 0 )
-		{
-			selector_index = symbol_index / 50;
-
-			if( selector_index > number_of_selectors )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid selector index value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			tree_index = selectors[ selector_index ];
-
-			if( tree_index > number_of_trees )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid tree index value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-		}
 	}
 	while( symbol != end_of_block_symbol );
 
@@ -1490,599 +2428,3228 @@ int assorted_bzip_read_block_data(
 	return( 1 );
 }
 
-/* Reads a stream foorter
- * Returns 1 on success or -1 on error
+/* Creates a decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
  */
-int assorted_bzip_read_stream_footer(
-     assorted_bit_stream_t *bit_stream,
-     uint64_t signature,
-     uint32_t *checksum,
+int assorted_bzip_decoder_initialize(
+     assorted_bzip_decoder_t **decoder,
      libcerror_error_t **error )
 {
-	static char *function  = "assorted_bzip_read_stream_footer";
-	uint32_t safe_checksum = 0;
+	return( assorted_bzip_decoder_initialize_with_arena(
+	         decoder,
+	         NULL,
+	         error ) );
+}
 
-	if( checksum == NULL )
+/* Creates a decoder of which the memory is allocated from an arena
+ * If arena is NULL the memory is allocated separately
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_decoder_initialize_with_arena(
+     assorted_bzip_decoder_t **decoder,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_decoder_initialize_with_arena";
+	uint8_t tree_index    = 0;
+
+	if( decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid checksum.",
+		 "%s: invalid decoder.",
 		 function );
 
 		return( -1 );
 	}
-	if( assorted_bit_stream_get_value(
-	     bit_stream,
-	     32,
-	     &safe_checksum,
-	     error ) != 1 )
+	if( *decoder != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from bit stream.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( arena != NULL )
 	{
-		libcnotify_printf(
-		 "%s: signature\t\t\t\t\t: 0x%08" PRIx64 "\n",
-		 function,
-		 signature );
-
-		libcnotify_printf(
-		 "%s: checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 safe_checksum );
+		if( assorted_arena_allocate(
+		     arena,
+		     sizeof( assorted_bzip_decoder_t ),
+		     (void **) decoder,
+		     error ) != 1 )
+		{
+			*decoder = NULL;
+		}
+	}
+	else
+	{
+		*decoder = memory_allocate_structure(
+		            assorted_bzip_decoder_t );
+	}
+	if( *decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
+		 function );
 
-		libcnotify_printf(
-		 "\n" );
+		goto on_error;
 	}
-#endif
-	if( signature != 0x177245385090UL )
+	if( memory_set(
+	     *decoder,
+	     0,
+	     sizeof( assorted_bzip_decoder_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported signature.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder.",
 		 function );
 
+		if( arena == NULL )
+		{
+			memory_free(
+			 *decoder );
+		}
+		*decoder = NULL;
+
 		return( -1 );
 	}
-	*checksum = safe_checksum;
+	( *decoder )->arena = arena;
+
+	/* The Huffman trees are created upfront so that they are allocated from the arena
+	 */
+	if( arena != NULL )
+	{
+		for( tree_index = 0;
+		     tree_index < 7;
+		     tree_index++ )
+		{
+			if( assorted_huffman_tree_initialize_with_arena(
+			     &( ( *decoder )->huffman_trees[ tree_index ] ),
+			     258,
+			     20,
+			     arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create Huffman tree: %" PRIu8 ".",
+				 function,
+				 tree_index );
 
+				goto on_error;
+			}
+		}
+	}
 	return( 1 );
+
+on_error:
+	if( ( *decoder != NULL )
+	 && ( arena == NULL ) )
+	{
+		memory_free(
+		 *decoder );
+	}
+	*decoder = NULL;
+
+	return( -1 );
 }
 
-/* Decompresses data using BZIP2 compression
- * Returns 1 on success or -1 on error
+/* Frees a decoder
+ * Returns 1 if successful or -1 on error
  */
-int assorted_bzip_decompress(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
+int assorted_bzip_decoder_free(
+     assorted_bzip_decoder_t **decoder,
      libcerror_error_t **error )
 {
-	uint8_t symbol_stack[ 256 ];
-	uint8_t selectors[ ( 1 << 15 ) + 1 ];
-
-	assorted_huffman_tree_t *huffman_trees[ 7 ] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL };
-
-	assorted_bit_stream_t *bit_stream           = NULL;
-	size_t *permutations                        = NULL;
-	uint8_t *block_data                         = NULL;
-	static char *function                       = "assorted_bzip_decompress";
-	size_t block_data_size                      = 0;
-	size_t compressed_data_offset               = 0;
-	size_t safe_block_data_size                 = 0;
-	size_t safe_uncompressed_data_size          = 0;
-	size_t uncompressed_data_offset             = 0;
-	uint64_t signature                          = 0;
-	uint32_t calculated_checksum                = 0;
-	uint32_t origin_pointer                     = 0;
-	uint32_t stored_checksum                    = 0;
-	uint32_t value_32bit                        = 0;
-	uint16_t number_of_selectors                = 0;
-	uint16_t number_of_symbols                  = 0;
-	uint8_t compression_level                   = 0;
-	uint8_t number_of_trees                     = 0;
-	uint8_t tree_index                          = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	size_t block_data_offset                    = 0;
-#endif
+	static char *function = "assorted_bzip_decoder_free";
+	uint8_t tree_index    = 0;
+	int result            = 1;
 
-	if( compressed_data == NULL )
+	if( decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid decoder.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( compressed_data_size < 14 )
-	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	if( *decoder != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid compressed data size value out of bounds.",
-		 function );
+		for( tree_index = 0;
+		     tree_index < 7;
+		     tree_index++ )
+		{
+			if( ( *decoder )->huffman_trees[ tree_index ] == NULL )
+			{
+				continue;
+			}
+			if( assorted_huffman_tree_free(
+			     &( ( *decoder )->huffman_trees[ tree_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free Huffman tree: %" PRIu8 ".",
+				 function,
+				 tree_index );
 
-		return( -1 );
+				result = -1;
+			}
+		}
+		if( ( *decoder )->arena == NULL )
+		{
+			if( ( *decoder )->permutations != NULL )
+			{
+				assorted_aligned_memory_free(
+				 ( *decoder )->permutations );
+			}
+			if( ( *decoder )->block_data != NULL )
+			{
+				assorted_aligned_memory_free(
+				 ( *decoder )->block_data );
+			}
+			memory_free(
+			 *decoder );
+		}
+		*decoder = NULL;
 	}
-	if( uncompressed_data_size == NULL )
+	return( result );
+}
+
+/* Resizes the buffers of a decoder to fit a maximum block data size
+ * The buffers only grow, so that a decoder can be reused for blocks of any
+ * compression level without reallocating
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_decoder_resize(
+     assorted_bzip_decoder_t *decoder,
+     size_t maximum_block_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_decoder_resize";
+	void *reallocation    = NULL;
+
+	if( decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid decoder.",
 		 function );
 
 		return( -1 );
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
-
-	if( assorted_bzip_read_stream_header(
-	     compressed_data,
-	     compressed_data_size,
-	     &compressed_data_offset,
-	     &compression_level,
-	     error ) != 1 )
+	if( ( maximum_block_data_size == 0 )
+	 || ( maximum_block_data_size > (size_t) 900000 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read stream header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum block data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( compressed_data_offset > ( compressed_data_size - 10 ) )
+	if( maximum_block_data_size <= decoder->maximum_block_data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid compressed data value too small.",
-		 function );
-
-		goto on_error;
+		return( 1 );
 	}
-	block_data_size = 100000;
+	/* The buffers of a decoder allocated from an arena cannot be resized,
+	 * larger ones are allocated instead, the data does not need to be preserved
+	 */
+	if( decoder->arena != NULL )
+	{
+		if( assorted_arena_allocate(
+		     decoder->arena,
+		     sizeof( uint8_t ) * maximum_block_data_size,
+		     (void **) &( decoder->block_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block data.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_arena_allocate(
+		     decoder->arena,
+		     sizeof( uint32_t ) * maximum_block_data_size,
+		     (void **) &( decoder->permutations ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create permutations.",
+			 function );
+
+			return( -1 );
+		}
+		decoder->maximum_block_data_size = maximum_block_data_size;
 
-	block_data = (uint8_t *) memory_allocate(
-	                          sizeof( uint8_t ) * block_data_size );
+		return( 1 );
+	}
+	reallocation = assorted_aligned_memory_reallocate(
+	                decoder->block_data,
+	                sizeof( uint8_t ) * maximum_block_data_size );
 
-	if( block_data == NULL )
+	if( reallocation == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create block data.",
+		 "%s: unable to resize block data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	permutations = (size_t *) memory_allocate(
-	                           sizeof( size_t ) * block_data_size );
+	decoder->block_data = (uint8_t *) reallocation;
 
-	if( permutations == NULL )
+	reallocation = assorted_aligned_memory_reallocate(
+	                decoder->permutations,
+	                sizeof( uint32_t ) * maximum_block_data_size );
+
+	if( reallocation == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create permutations.",
+		 "%s: unable to resize permutations.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( assorted_bit_stream_initialize(
-	     &bit_stream,
-	     compressed_data,
-	     compressed_data_size,
-	     compressed_data_offset,
-	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
-	     error ) != 1 )
+	decoder->permutations            = (uint32_t *) reallocation;
+	decoder->maximum_block_data_size = maximum_block_data_size;
+
+	return( 1 );
+}
+
+/* Reads a block into the block data of the decoder
+ * The signature of the block must have been read
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_decoder_read_block(
+     assorted_bzip_decoder_t *decoder,
+     assorted_bit_stream_t *bit_stream,
+     uint64_t signature,
+     uint32_t *origin_pointer,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	static char *function        = "assorted_bzip_decoder_read_block";
+	size_t safe_block_data_size  = 0;
+	uint32_t safe_origin_pointer = 0;
+	uint32_t value_32bit         = 0;
+	uint16_t number_of_selectors = 0;
+	uint16_t number_of_symbols   = 0;
+	uint8_t number_of_trees      = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( decoder->block_data == NULL )
+	 || ( decoder->permutations == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit stream.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decoder - missing buffers.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	if( origin_pointer == NULL )
 	{
-		if( assorted_bzip_read_signature(
-		     bit_stream,
-		     &signature,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read signature.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid origin pointer.",
+		 function );
 
-			goto on_error;
-		}
-		if( signature == 0x177245385090UL )
-		{
-			break;
-		}
-		if( signature != 0x314159265359UL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported signature: 0x%" PRIx64 ".",
-			 function,
-			 signature );
+		return( -1 );
+	}
+	decoder->block_data_size = 0;
 
-			goto on_error;
-		}
-		if( assorted_bzip_read_block_header(
-		     bit_stream,
-		     signature,
-		     &origin_pointer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read block header.",
-			 function );
+	safe_block_data_size = decoder->maximum_block_data_size;
 
-			goto on_error;
-		}
-		if( origin_pointer > block_data_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid origin pointer value out of bounds.",
-			 function );
+	if( assorted_bzip_read_block_header(
+	     bit_stream,
+	     signature,
+	     &safe_origin_pointer,
+	     checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block header.",
+		 function );
 
-			goto on_error;
-		}
-		if( memory_set(
-		     symbol_stack,
-		     0,
-		     256 ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear symbol stack.",
-			 function );
+		return( -1 );
+	}
+	if( safe_origin_pointer >= decoder->maximum_block_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid origin pointer value out of bounds.",
+		 function );
 
-			goto on_error;
-		}
-		if( assorted_bzip_read_symbol_stack(
-		     bit_stream,
-		     symbol_stack,
-		     &number_of_symbols,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read symbol stack.",
-			 function );
+		return( -1 );
+	}
+	if( memory_set(
+	     decoder->symbol_stack,
+	     0,
+	     256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear symbol stack.",
+		 function );
 
-			goto on_error;
-		}
-		if( assorted_bit_stream_get_value(
-		     bit_stream,
-		     3,
-		     &value_32bit,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from bit stream.",
-			 function );
+		return( -1 );
+	}
+	if( assorted_bzip_read_symbol_stack(
+	     bit_stream,
+	     decoder->symbol_stack,
+	     &number_of_symbols,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read symbol stack.",
+		 function );
 
-			goto on_error;
-		}
-		number_of_trees = (uint8_t) ( value_32bit & 0x00000007UL );
+		return( -1 );
+	}
+	if( assorted_bit_stream_get_value_front_to_back(
+	     bit_stream,
+	     3,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
 
-		if( assorted_bit_stream_get_value(
-		     bit_stream,
-		     15,
-		     &value_32bit,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from bit stream.",
-			 function );
+		return( -1 );
+	}
+	number_of_trees = (uint8_t) ( value_32bit & 0x00000007UL );
 
-			goto on_error;
-		}
-		number_of_selectors = (uint16_t) ( value_32bit & 0x00007fffUL );
+	if( assorted_bit_stream_get_value_front_to_back(
+	     bit_stream,
+	     15,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_selectors = (uint16_t) ( value_32bit & 0x00007fffUL );
 
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: number of trees\t\t\t\t: %" PRIu8 "\n",
-			 function,
-			 number_of_trees );
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of trees\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 number_of_trees );
 
-			libcnotify_printf(
-			 "%s: number of selectors\t\t\t\t: %" PRIu16 "\n",
-			 function,
-			 number_of_selectors );
+		libcnotify_printf(
+		 "%s: number of selectors\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 number_of_selectors );
 
-			libcnotify_printf(
-			 "\n" );
-		}
+		libcnotify_printf(
+		 "\n" );
+	}
 #endif
-		if( assorted_bzip_read_selectors(
-		     bit_stream,
-		     selectors,
-		     number_of_trees,
-		     number_of_selectors,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read selectors.",
-			 function );
-
-			goto on_error;
-		}
-		if( assorted_bzip_read_huffman_trees(
-		     bit_stream,
-		     huffman_trees,
-		     number_of_trees,
-		     number_of_symbols,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read Huffman trees.",
-			 function );
+	if( assorted_bzip_read_selectors(
+	     bit_stream,
+	     decoder->selectors,
+	     number_of_trees,
+	     number_of_selectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read selectors.",
+		 function );
 
-			goto on_error;
-		}
-		safe_block_data_size = block_data_size;
+		return( -1 );
+	}
+	if( assorted_bzip_read_huffman_trees(
+	     bit_stream,
+	     decoder->huffman_trees,
+	     number_of_trees,
+	     number_of_symbols,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read Huffman trees.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_read_block_data(
+	     bit_stream,
+	     decoder->huffman_trees,
+	     number_of_trees,
+	     decoder->selectors,
+	     number_of_selectors,
+	     decoder->symbol_stack,
+	     number_of_symbols,
+	     decoder->block_data,
+	     &safe_block_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block data.",
+		 function );
+
+		return( -1 );
+	}
+	decoder->block_data_size = safe_block_data_size;
+
+	*origin_pointer = safe_origin_pointer;
+
+	return( 1 );
+}
+
+/* Reads a stream foorter
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_read_stream_footer(
+     assorted_bit_stream_t *bit_stream,
+     uint64_t signature,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	static char *function  = "assorted_bzip_read_stream_footer";
+	uint32_t safe_checksum = 0;
+
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_get_value_front_to_back(
+	     bit_stream,
+	     32,
+	     &safe_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 signature );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 safe_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( signature != 0x177245385090UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum = safe_checksum;
+
+	return( 1 );
+}
+
+/* Decodes a BZIP2 compressed stream
+ * If uncompressed data is NULL the data is only decoded to verify the checksum
+ * The buffers of the decoder are reused, hence a decoder can be used for multiple streams
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_decode_stream(
+     assorted_bzip_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream  = NULL;
+	static char *function              = "assorted_bzip_decode_stream";
+	size_t block_data_offset           = 0;
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint64_t signature                 = 0;
+	uint32_t block_checksum            = 0;
+	uint32_t calculated_block_checksum = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t origin_pointer            = 0;
+	uint32_t stored_checksum           = 0;
+	uint8_t compression_level          = 0;
+	int result                         = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 14 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( assorted_bzip_read_stream_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     &compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream header.",
+		 function );
+
+		goto on_error;
+	}
+	if( compressed_data_offset > ( compressed_data_size - 10 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compression level defines the maximum block size in units of 100k
+	 */
+	if( assorted_bzip_decoder_resize(
+	     decoder,
+	     (size_t) compression_level * 100000,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_initialize_with_arena(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     compressed_data_offset,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	     decoder->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
+	{
+		if( assorted_bzip_read_signature(
+		     bit_stream,
+		     &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( signature == 0x177245385090UL )
+		{
+			break;
+		}
+		if( signature != 0x314159265359UL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported signature: 0x%" PRIx64 ".",
+			 function,
+			 signature );
+
+			goto on_error;
+		}
+		if( assorted_bzip_decoder_read_block(
+		     decoder,
+		     bit_stream,
+		     signature,
+		     &origin_pointer,
+		     &block_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block.",
+			 function );
+
+			goto on_error;
+		}
+		block_data_offset         = uncompressed_data_offset;
+		calculated_block_checksum = 0;
+
+		/* Perform Burrows-Wheeler transform
+		 */
+		if( uncompressed_data == NULL )
+		{
+			result = assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+			          decoder->block_data,
+			          decoder->block_data_size,
+			          decoder->permutations,
+			          origin_pointer,
+			          &calculated_block_checksum,
+			          &uncompressed_data_offset,
+			          error );
+		}
+		else
+		{
+			result = assorted_bzip_reverse_burrows_wheeler_transform(
+			          decoder->block_data,
+			          decoder->block_data_size,
+			          decoder->permutations,
+			          origin_pointer,
+			          uncompressed_data,
+			          safe_uncompressed_data_size,
+			          &uncompressed_data_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to reverse Burrows-Wheeler transform.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( libcnotify_verbose != 0 )
+		 && ( uncompressed_data != NULL ) )
+		{
+			libcnotify_printf(
+			 "%s: block data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( uncompressed_data[ block_data_offset ] ),
+			 uncompressed_data_offset - block_data_offset,
+			 0 );
+		}
+#endif
+		/* When verifying the checksum was calculated by the transform
+		 */
+		if( uncompressed_data != NULL )
+		{
+			if( assorted_bzip_calculate_crc32(
+			     &calculated_block_checksum,
+			     &( uncompressed_data[ block_data_offset ] ),
+			     uncompressed_data_offset - block_data_offset,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to calculate block checksum.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( block_checksum != calculated_block_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: block checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 block_checksum,
+			 calculated_block_checksum );
+
+			goto on_error;
+		}
+		/* The stream checksum combines the checksums of the blocks
+		 */
+		calculated_checksum = ( calculated_checksum << 1 ) | ( calculated_checksum >> 31 );
+		calculated_checksum ^= calculated_block_checksum;
+	}
+	if( assorted_bzip_read_stream_footer(
+	     bit_stream,
+	     signature,
+	     &stored_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream footer.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: stored checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "%s: calculated checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 calculated_checksum );
+	}
+#endif
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using BZIP2 compression
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( assorted_bzip_decompress_with_arena(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         NULL,
+	         error ) );
+}
+
+/* Decompresses data using BZIP2 compression
+ * The decoder is allocated from the arena if not NULL, the arena is rewound
+ * on return so that it can be reused for the next call
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_decompress_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	assorted_bzip_decoder_t *decoder = NULL;
+	static char *function            = "assorted_bzip_decompress_with_arena";
+	size_t arena_data_offset         = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena != NULL )
+	{
+		arena_data_offset = arena->data_offset;
+	}
+	if( assorted_bzip_decoder_initialize_with_arena(
+	     &decoder,
+	     arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_decode_stream(
+	     decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decode stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_decoder_free(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		if( assorted_arena_rewind(
+		     arena,
+		     arena_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( decoder != NULL )
+	{
+		assorted_bzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_rewind(
+		 arena,
+		 arena_data_offset,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Verifies BZIP2 compressed data without storing the uncompressed data
+ * The uncompressed data is passed through a small buffer per block to calculate the checksum
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_verify(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_bzip_decoder_t *decoder = NULL;
+	static char *function            = "assorted_bzip_verify";
+
+	if( assorted_bzip_decoder_initialize(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_decode_stream(
+	     decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     NULL,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decode stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_decoder_free(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( decoder != NULL )
+	{
+		assorted_bzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+
+/* Run-length encodes uncompressed data into block data
+ * Runs of 4 to 255 equal bytes are stored as 4 bytes followed by the number of additional bytes
+ * The data is encoded until all uncompressed data is consumed or the next run does
+ * not fit in the maximum block data size
+ * If block data is NULL only the size of the block data is determined
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_run_length_encode(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t *block_data,
+     size_t maximum_block_data_size,
+     size_t *block_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                = "assorted_bzip_run_length_encode";
+	size_t block_data_offset             = 0;
+	size_t encoded_size                  = 0;
+	size_t run_length                    = 0;
+	size_t safe_uncompressed_data_offset = 0;
+	uint8_t byte_value                   = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_block_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum block data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data size.",
+		 function );
+
+		return( -1 );
+	}
+	while( safe_uncompressed_data_offset < uncompressed_data_size )
+	{
+		byte_value = uncompressed_data[ safe_uncompressed_data_offset ];
+		run_length = 1;
+
+		while( ( run_length < 255 )
+		    && ( ( safe_uncompressed_data_offset + run_length ) < uncompressed_data_size )
+		    && ( uncompressed_data[ safe_uncompressed_data_offset + run_length ] == byte_value ) )
+		{
+			run_length++;
+		}
+		if( run_length < 4 )
+		{
+			encoded_size = run_length;
+		}
+		else
+		{
+			encoded_size = 5;
+		}
+		if( encoded_size > ( maximum_block_data_size - block_data_offset ) )
+		{
+			break;
+		}
+		if( block_data != NULL )
+		{
+			if( run_length < 4 )
+			{
+				while( encoded_size > 0 )
+				{
+					block_data[ block_data_offset + --encoded_size ] = byte_value;
+				}
+			}
+			else
+			{
+				block_data[ block_data_offset ]     = byte_value;
+				block_data[ block_data_offset + 1 ] = byte_value;
+				block_data[ block_data_offset + 2 ] = byte_value;
+				block_data[ block_data_offset + 3 ] = byte_value;
+				block_data[ block_data_offset + 4 ] = (uint8_t) ( run_length - 4 );
+			}
+		}
+		if( run_length < 4 )
+		{
+			block_data_offset += run_length;
+		}
+		else
+		{
+			block_data_offset += 5;
+		}
+		safe_uncompressed_data_offset += run_length;
+	}
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+	*block_data_size          = block_data_offset;
+
+	return( 1 );
+}
+
+/* Creates a compressor
+ * Make sure the value compressor is referencing, is set to NULL
+ * The compression level ranges from 1 to 9 and determines the block size in multitudes of 100 kB
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_compressor_initialize(
+     assorted_bzip_compressor_t **compressor,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function          = "assorted_bzip_compressor_initialize";
+	size_t maximum_block_data_size = 0;
+	size_t maximum_text_size       = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_level < 1 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	/* Leave some room below the block size of the compression level, as bzip2 does
+	 */
+	maximum_block_data_size = ( (size_t) compression_level * 100000 ) - 19;
+
+	/* The text contains the block data twice followed by a sentinel
+	 */
+	maximum_text_size = ( 2 * maximum_block_data_size ) + 1;
+
+	*compressor = memory_allocate_structure(
+	               assorted_bzip_compressor_t );
+
+	if( *compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compressor,
+	     0,
+	     sizeof( assorted_bzip_compressor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressor.",
+		 function );
+
+		memory_free(
+		 *compressor );
+
+		*compressor = NULL;
+
+		return( -1 );
+	}
+	( *compressor )->block_data = (uint8_t *) assorted_aligned_memory_allocate(
+	                                           sizeof( uint8_t ) * maximum_block_data_size );
+
+	if( ( *compressor )->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressor )->text = (int32_t *) assorted_aligned_memory_allocate(
+	                                     sizeof( int32_t ) * maximum_text_size );
+
+	if( ( *compressor )->text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create text.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressor )->suffix_array = (int32_t *) assorted_aligned_memory_allocate(
+	                                             sizeof( int32_t ) * maximum_text_size );
+
+	if( ( *compressor )->suffix_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create suffix array.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressor )->transformed_data = (uint8_t *) assorted_aligned_memory_allocate(
+	                                                 sizeof( uint8_t ) * maximum_block_data_size );
+
+	if( ( *compressor )->transformed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create transformed data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every byte of the block data results in at most 1 symbol, followed by the end-of-block symbol
+	 */
+	( *compressor )->symbols = (uint16_t *) memory_allocate(
+	                                         sizeof( uint16_t ) * ( maximum_block_data_size + 1 ) );
+
+	if( ( *compressor )->symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create symbols.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressor )->selectors = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * ( ( maximum_block_data_size / ASSORTED_BZIP_NUMBER_OF_SYMBOLS_PER_SELECTOR ) + 1 ) );
+
+	if( ( *compressor )->selectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create selectors.",
+		 function );
+
+		goto on_error;
+	}
+	( *compressor )->compression_level       = (uint8_t) compression_level;
+	( *compressor )->maximum_block_data_size = maximum_block_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *compressor != NULL )
+	{
+		assorted_bzip_compressor_free(
+		 compressor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a compressor
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_compressor_free(
+     assorted_bzip_compressor_t **compressor,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_compressor_free";
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressor != NULL )
+	{
+		if( ( *compressor )->selectors != NULL )
+		{
+			memory_free(
+			 ( *compressor )->selectors );
+		}
+		if( ( *compressor )->symbols != NULL )
+		{
+			memory_free(
+			 ( *compressor )->symbols );
+		}
+		if( ( *compressor )->transformed_data != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *compressor )->transformed_data );
+		}
+		if( ( *compressor )->suffix_array != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *compressor )->suffix_array );
+		}
+		if( ( *compressor )->text != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *compressor )->text );
+		}
+		if( ( *compressor )->block_data != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *compressor )->block_data );
+		}
+		memory_free(
+		 *compressor );
+
+		*compressor = NULL;
+	}
+	return( 1 );
+}
+
+/* Applies the Burrows-Wheeler transform to the block data
+ * The rotations of the block data are sorted using the suffix array of the block
+ * data repeated twice, where the order of equal rotations does not affect the result
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_compressor_sort_block(
+     assorted_bzip_compressor_t *compressor,
+     libcerror_error_t **error )
+{
+	static char *function     = "assorted_bzip_compressor_sort_block";
+	size_t block_data_offset  = 0;
+	size_t suffix_index       = 0;
+	size_t text_size          = 0;
+	size_t transformed_offset = 0;
+	int32_t text_index        = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressor->block_data_size == 0 )
+	 || ( compressor->block_data_size > compressor->maximum_block_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressor - block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The byte values are stored as 1 to 256 since 0 is used as sentinel
+	 */
+	for( block_data_offset = 0;
+	     block_data_offset < compressor->block_data_size;
+	     block_data_offset++ )
+	{
+		text_index = (int32_t) compressor->block_data[ block_data_offset ] + 1;
+
+		compressor->text[ block_data_offset ]                               = text_index;
+		compressor->text[ compressor->block_data_size + block_data_offset ] = text_index;
+	}
+	text_size = 2 * compressor->block_data_size;
+
+	compressor->text[ text_size++ ] = 0;
+
+	if( assorted_suffix_array_build(
+	     compressor->text,
+	     text_size,
+	     257,
+	     compressor->suffix_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build suffix array.",
+		 function );
+
+		return( -1 );
+	}
+	/* The suffixes that start in the first copy of the block data are in the order
+	 * of the rotations, the last byte of a rotation is the byte before its start
+	 */
+	for( suffix_index = 0;
+	     suffix_index < text_size;
+	     suffix_index++ )
+	{
+		text_index = compressor->suffix_array[ suffix_index ];
+
+		if( (size_t) text_index >= compressor->block_data_size )
+		{
+			continue;
+		}
+		if( text_index == 0 )
+		{
+			compressor->origin_pointer = (uint32_t) transformed_offset;
+
+			block_data_offset = compressor->block_data_size - 1;
+		}
+		else
+		{
+			block_data_offset = (size_t) text_index - 1;
+		}
+		compressor->transformed_data[ transformed_offset++ ] = compressor->block_data[ block_data_offset ];
+	}
+	return( 1 );
+}
+
+/* Encodes the transformed data as move-to-front and run-length encoded symbols
+ * Runs of the symbol 0 are stored as bijective base-2 numbers using RUNA (0) and RUNB (1),
+ * the other move-to-front indexes are stored as index + 1 and the last symbol is
+ * the end-of-block symbol
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_compressor_encode_symbols(
+     assorted_bzip_compressor_t *compressor,
+     libcerror_error_t **error )
+{
+	uint8_t symbol_stack[ 256 ];
+	uint8_t symbol_values[ 256 ];
+
+	static char *function     = "assorted_bzip_compressor_encode_symbols";
+	size_t block_data_offset  = 0;
+	size_t number_of_symbols  = 0;
+	size_t run_length         = 0;
+	uint16_t byte_value       = 0;
+	uint8_t previous_value    = 0;
+	uint8_t stack_index       = 0;
+	uint8_t stack_value       = 0;
+	uint8_t symbol_value      = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressor->block_data_size == 0 )
+	 || ( compressor->block_data_size > compressor->maximum_block_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressor - block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     compressor->byte_values_in_use,
+	     0,
+	     sizeof( uint8_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear byte values in use.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_data_offset = 0;
+	     block_data_offset < compressor->block_data_size;
+	     block_data_offset++ )
+	{
+		compressor->byte_values_in_use[ compressor->block_data[ block_data_offset ] ] = 1;
+	}
+	/* The move-to-front indexes are relative to the byte values in use
+	 */
+	compressor->number_of_byte_values_in_use = 0;
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( compressor->byte_values_in_use[ byte_value ] != 0 )
+		{
+			symbol_stack[ compressor->number_of_byte_values_in_use ] = (uint8_t) compressor->number_of_byte_values_in_use;
+			symbol_values[ byte_value ]                              = (uint8_t) compressor->number_of_byte_values_in_use;
+
+			compressor->number_of_byte_values_in_use += 1;
+		}
+	}
+	for( block_data_offset = 0;
+	     block_data_offset <= compressor->block_data_size;
+	     block_data_offset++ )
+	{
+		if( block_data_offset < compressor->block_data_size )
+		{
+			symbol_value = symbol_values[ compressor->transformed_data[ block_data_offset ] ];
+
+			if( symbol_stack[ 0 ] == symbol_value )
+			{
+				run_length++;
+
+				continue;
+			}
+		}
+		if( run_length > 0 )
+		{
+			run_length -= 1;
+
+			while( 1 )
+			{
+				compressor->symbols[ number_of_symbols++ ] = (uint16_t) ( run_length & 1 );
+
+				if( run_length < 2 )
+				{
+					break;
+				}
+				run_length = ( run_length - 2 ) / 2;
+			}
+			run_length = 0;
+		}
+		if( block_data_offset >= compressor->block_data_size )
+		{
+			break;
+		}
+		previous_value    = symbol_stack[ 0 ];
+		symbol_stack[ 0 ] = symbol_value;
+
+		for( stack_index = 1;
+		     stack_index < compressor->number_of_byte_values_in_use;
+		     stack_index++ )
+		{
+			stack_value                 = symbol_stack[ stack_index ];
+			symbol_stack[ stack_index ] = previous_value;
+
+			if( stack_value == symbol_value )
+			{
+				break;
+			}
+			previous_value = stack_value;
+		}
+		compressor->symbols[ number_of_symbols++ ] = (uint16_t) stack_index + 1;
+	}
+	compressor->alphabet_size = compressor->number_of_byte_values_in_use + 2;
+
+	compressor->symbols[ number_of_symbols++ ] = compressor->alphabet_size - 1;
+
+	compressor->number_of_symbols = number_of_symbols;
+
+	return( 1 );
+}
+
+/* Builds the code sizes of a Huffman tree used for compression
+ * Every symbol is assigned a code, since the decoder requires a code size for every symbol,
+ * and the code is made complete, since the decoder rejects incomplete codes
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_compressor_build_code_sizes(
+     const uint32_t *frequencies,
+     uint16_t alphabet_size,
+     uint8_t *code_sizes,
+     libcerror_error_t **error )
+{
+	uint32_t symbol_frequencies[ 258 ];
+
+	static char *function       = "assorted_bzip_compressor_build_code_sizes";
+	uint32_t code_space         = 0;
+	uint32_t maximum_code_space = 0;
+	uint16_t symbol             = 0;
+	uint8_t code_size           = 0;
+
+	if( frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alphabet_size < 3 )
+	 || ( alphabet_size > 258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alphabet size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < alphabet_size;
+	     symbol++ )
+	{
+		if( frequencies[ symbol ] == 0 )
+		{
+			symbol_frequencies[ symbol ] = 1;
+		}
+		else
+		{
+			symbol_frequencies[ symbol ] = frequencies[ symbol ];
+		}
+	}
+	if( assorted_huffman_tree_build_code_sizes(
+	     symbol_frequencies,
+	     (int) alphabet_size,
+	     ASSORTED_BZIP_MAXIMUM_CODE_SIZE,
+	     code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Shorten the largest codes while the code is incomplete, the unused code space
+	 * is a multitude of the code space of the largest code, hence this completes the code
+	 */
+	maximum_code_space = (uint32_t) 1 << ASSORTED_BZIP_MAXIMUM_CODE_SIZE;
+
+	for( symbol = 0;
+	     symbol < alphabet_size;
+	     symbol++ )
+	{
+		code_space += (uint32_t) 1 << ( ASSORTED_BZIP_MAXIMUM_CODE_SIZE - code_sizes[ symbol ] );
+	}
+	while( code_space < maximum_code_space )
+	{
+		code_size = 1;
+
+		for( symbol = 0;
+		     symbol < alphabet_size;
+		     symbol++ )
+		{
+			if( code_sizes[ symbol ] > code_size )
+			{
+				code_size = code_sizes[ symbol ];
+			}
+		}
+		for( symbol = 0;
+		     symbol < alphabet_size;
+		     symbol++ )
+		{
+			if( code_sizes[ symbol ] == code_size )
+			{
+				break;
+			}
+		}
+		code_space += (uint32_t) 1 << ( ASSORTED_BZIP_MAXIMUM_CODE_SIZE - code_size );
+
+		code_sizes[ symbol ] -= 1;
+	}
+	if( code_space != maximum_code_space )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid code space value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the Huffman trees of the symbols and selects a tree for every group of 50 symbols
+ * The trees are initialized with ranges of symbols of about equal frequency and are
+ * refined by iteratively assigning every group to the tree that encodes it in the least bits
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_compressor_build_huffman_trees(
+     assorted_bzip_compressor_t *compressor,
+     libcerror_error_t **error )
+{
+	uint32_t tree_frequencies[ ASSORTED_BZIP_MAXIMUM_NUMBER_OF_TREES ][ 258 ];
+	uint32_t frequencies[ 258 ];
+	uint32_t costs[ ASSORTED_BZIP_MAXIMUM_NUMBER_OF_TREES ];
+	uint8_t tree_stack[ ASSORTED_BZIP_MAXIMUM_NUMBER_OF_TREES ];
+
+	static char *function          = "assorted_bzip_compressor_build_huffman_trees";
+	uint64_t compressed_block_size = 0;
+	size_t group_end_index         = 0;
+	size_t remaining_frequency     = 0;
+	size_t symbol_index            = 0;
+	size_t range_frequency         = 0;
+	size_t target_frequency        = 0;
+	uint16_t range_end             = 0;
+	uint16_t range_start           = 0;
+	uint16_t selector_index        = 0;
+	uint16_t symbol                = 0;
+	uint8_t best_tree_index        = 0;
+	uint8_t code_size              = 0;
+	uint8_t iteration              = 0;
+	uint8_t number_of_ranges       = 0;
+	uint8_t previous_tree_index    = 0;
+	uint8_t stack_index            = 0;
+	uint8_t tree_index             = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressor->number_of_symbols == 0 )
+	 || ( compressor->number_of_symbols > ( compressor->maximum_block_data_size + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressor - number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressor->alphabet_size < 3 )
+	 || ( compressor->alphabet_size > 258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressor - alphabet size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* More symbols benefit from more Huffman trees, as in bzip2
+	 */
+	if( compressor->number_of_symbols < 200 )
+	{
+		compressor->number_of_trees = 2;
+	}
+	else if( compressor->number_of_symbols < 600 )
+	{
+		compressor->number_of_trees = 3;
+	}
+	else if( compressor->number_of_symbols < 1200 )
+	{
+		compressor->number_of_trees = 4;
+	}
+	else if( compressor->number_of_symbols < 2400 )
+	{
+		compressor->number_of_trees = 5;
+	}
+	else
+	{
+		compressor->number_of_trees = 6;
+	}
+	if( memory_set(
+	     frequencies,
+	     0,
+	     sizeof( uint32_t ) * 258 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol_index = 0;
+	     symbol_index < compressor->number_of_symbols;
+	     symbol_index++ )
+	{
+		frequencies[ compressor->symbols[ symbol_index ] ] += 1;
+	}
+	/* Initialize every tree to favor a range of symbols
+	 */
+	number_of_ranges    = compressor->number_of_trees;
+	remaining_frequency = compressor->number_of_symbols;
+	range_start         = 0;
+
+	while( number_of_ranges > 0 )
+	{
+		target_frequency = remaining_frequency / number_of_ranges;
+		range_end        = range_start;
+		range_frequency  = frequencies[ range_start ];
+
+		while( ( range_frequency < target_frequency )
+		    && ( ( range_end + 1 ) < compressor->alphabet_size ) )
+		{
+			range_end++;
+
+			range_frequency += frequencies[ range_end ];
+		}
+		if( ( range_end > range_start )
+		 && ( number_of_ranges != compressor->number_of_trees )
+		 && ( number_of_ranges != 1 )
+		 && ( ( ( compressor->number_of_trees - number_of_ranges ) % 2 ) == 1 ) )
+		{
+			range_frequency -= frequencies[ range_end ];
+
+			range_end--;
+		}
+		tree_index = number_of_ranges - 1;
+
+		for( symbol = 0;
+		     symbol < compressor->alphabet_size;
+		     symbol++ )
+		{
+			if( ( symbol >= range_start )
+			 && ( symbol <= range_end ) )
+			{
+				compressor->code_sizes[ tree_index ][ symbol ] = 0;
+			}
+			else
+			{
+				compressor->code_sizes[ tree_index ][ symbol ] = 15;
+			}
+		}
+		number_of_ranges--;
+
+		remaining_frequency -= range_frequency;
+		range_start          = range_end + 1;
+
+		if( range_start >= compressor->alphabet_size )
+		{
+			range_start = compressor->alphabet_size - 1;
+		}
+	}
+	for( iteration = 0;
+	     iteration < 4;
+	     iteration++ )
+	{
+		if( memory_set(
+		     tree_frequencies,
+		     0,
+		     sizeof( uint32_t ) * ASSORTED_BZIP_MAXIMUM_NUMBER_OF_TREES * 258 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear tree frequencies.",
+			 function );
+
+			return( -1 );
+		}
+		selector_index = 0;
+
+		for( symbol_index = 0;
+		     symbol_index < compressor->number_of_symbols;
+		     symbol_index = group_end_index )
+		{
+			group_end_index = symbol_index + ASSORTED_BZIP_NUMBER_OF_SYMBOLS_PER_SELECTOR;
+
+			if( group_end_index > compressor->number_of_symbols )
+			{
+				group_end_index = compressor->number_of_symbols;
+			}
+			for( tree_index = 0;
+			     tree_index < compressor->number_of_trees;
+			     tree_index++ )
+			{
+				costs[ tree_index ] = 0;
+			}
+			for( symbol = 0;
+			     ( symbol_index + symbol ) < group_end_index;
+			     symbol++ )
+			{
+				for( tree_index = 0;
+				     tree_index < compressor->number_of_trees;
+				     tree_index++ )
+				{
+					costs[ tree_index ] += compressor->code_sizes[ tree_index ][ compressor->symbols[ symbol_index + symbol ] ];
+				}
+			}
+			best_tree_index = 0;
+
+			for( tree_index = 1;
+			     tree_index < compressor->number_of_trees;
+			     tree_index++ )
+			{
+				if( costs[ tree_index ] < costs[ best_tree_index ] )
+				{
+					best_tree_index = tree_index;
+				}
+			}
+			compressor->selectors[ selector_index++ ] = best_tree_index;
+
+			for( symbol = 0;
+			     ( symbol_index + symbol ) < group_end_index;
+			     symbol++ )
+			{
+				tree_frequencies[ best_tree_index ][ compressor->symbols[ symbol_index + symbol ] ] += 1;
+			}
+		}
+		for( tree_index = 0;
+		     tree_index < compressor->number_of_trees;
+		     tree_index++ )
+		{
+			if( assorted_bzip_compressor_build_code_sizes(
+			     tree_frequencies[ tree_index ],
+			     compressor->alphabet_size,
+			     compressor->code_sizes[ tree_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to build code sizes of tree: %" PRIu8 ".",
+				 function,
+				 tree_index );
+
+				return( -1 );
+			}
+		}
+	}
+	compressor->number_of_selectors = selector_index;
+
+	for( tree_index = 0;
+	     tree_index < compressor->number_of_trees;
+	     tree_index++ )
+	{
+		if( assorted_huffman_tree_build_codes(
+		     compressor->code_sizes[ tree_index ],
+		     (int) compressor->alphabet_size,
+		     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+		     compressor->codes[ tree_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to build codes of tree: %" PRIu8 ".",
+			 function,
+			 tree_index );
+
+			return( -1 );
+		}
+	}
+	/* Determine the size of the compressed block: the signature, checksum, randomized flag,
+	 * origin pointer, symbol stack, number of trees and selectors, followed by the move-to-front
+	 * encoded selectors, the delta encoded code sizes and the encoded symbols
+	 */
+	compressed_block_size = 48 + 32 + 1 + 24 + 16 + 3 + 15;
+
+	for( symbol = 0;
+	     symbol < 256;
+	     symbol += 16 )
+	{
+		for( code_size = 0;
+		     code_size < 16;
+		     code_size++ )
+		{
+			if( compressor->byte_values_in_use[ symbol + code_size ] != 0 )
+			{
+				compressed_block_size += 16;
+
+				break;
+			}
+		}
+	}
+	for( tree_index = 0;
+	     tree_index < compressor->number_of_trees;
+	     tree_index++ )
+	{
+		tree_stack[ tree_index ] = tree_index;
+	}
+	for( selector_index = 0;
+	     selector_index < compressor->number_of_selectors;
+	     selector_index++ )
+	{
+		best_tree_index     = compressor->selectors[ selector_index ];
+		previous_tree_index = tree_stack[ 0 ];
+		stack_index         = 0;
+
+		while( previous_tree_index != best_tree_index )
+		{
+			stack_index++;
+
+			tree_index                = tree_stack[ stack_index ];
+			tree_stack[ stack_index ] = previous_tree_index;
+			previous_tree_index       = tree_index;
+		}
+		tree_stack[ 0 ] = best_tree_index;
+
+		compressed_block_size += (uint64_t) stack_index + 1;
+	}
+	for( tree_index = 0;
+	     tree_index < compressor->number_of_trees;
+	     tree_index++ )
+	{
+		code_size = compressor->code_sizes[ tree_index ][ 0 ];
+
+		compressed_block_size += 5;
+
+		for( symbol = 0;
+		     symbol < compressor->alphabet_size;
+		     symbol++ )
+		{
+			if( compressor->code_sizes[ tree_index ][ symbol ] > code_size )
+			{
+				compressed_block_size += 2 * (uint64_t) ( compressor->code_sizes[ tree_index ][ symbol ] - code_size );
+			}
+			else
+			{
+				compressed_block_size += 2 * (uint64_t) ( code_size - compressor->code_sizes[ tree_index ][ symbol ] );
+			}
+			code_size = compressor->code_sizes[ tree_index ][ symbol ];
+
+			compressed_block_size += 1;
+		}
+	}
+	for( symbol_index = 0;
+	     symbol_index < compressor->number_of_symbols;
+	     symbol_index++ )
+	{
+		tree_index = compressor->selectors[ symbol_index / ASSORTED_BZIP_NUMBER_OF_SYMBOLS_PER_SELECTOR ];
+
+		compressed_block_size += compressor->code_sizes[ tree_index ][ compressor->symbols[ symbol_index ] ];
+	}
+	compressor->compressed_block_size = compressed_block_size;
+
+	return( 1 );
+}
+
+/* Compresses the next block of the uncompressed data
+ * The block is written by assorted_bzip_compressor_write_block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_compressor_compress_block(
+     assorted_bzip_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function                = "assorted_bzip_compressor_compress_block";
+	size_t safe_uncompressed_data_offset = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset >= uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_run_length_encode(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     &safe_uncompressed_data_offset,
+	     compressor->block_data,
+	     compressor->maximum_block_data_size,
+	     &( compressor->block_data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to run-length encode block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_calculate_crc32(
+	     &( compressor->checksum ),
+	     &( uncompressed_data[ *uncompressed_data_offset ] ),
+	     safe_uncompressed_data_offset - *uncompressed_data_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_compressor_sort_block(
+	     compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to sort block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_compressor_encode_symbols(
+	     compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to encode symbols.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_compressor_build_huffman_trees(
+	     compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to build Huffman trees.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Writes the compressed block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_compressor_write_block(
+     assorted_bzip_compressor_t *compressor,
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     libcerror_error_t **error )
+{
+	uint8_t tree_stack[ ASSORTED_BZIP_MAXIMUM_NUMBER_OF_TREES ];
+
+	static char *function       = "assorted_bzip_compressor_write_block";
+	size_t symbol_index         = 0;
+	uint64_t available_bits     = 0;
+	uint32_t level1_value       = 0;
+	uint32_t level2_value       = 0;
+	uint16_t byte_value         = 0;
+	uint16_t selector_index     = 0;
+	uint16_t symbol             = 0;
+	uint8_t code_size           = 0;
+	uint8_t previous_tree_index = 0;
+	uint8_t selected_tree_index = 0;
+	uint8_t stack_index         = 0;
+	uint8_t tree_index          = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream_writer->storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bit stream writer - storage type.",
+		 function );
+
+		return( -1 );
+	}
+	available_bits = ( (uint64_t) ( bit_stream_writer->byte_stream_size - bit_stream_writer->byte_stream_offset ) * 8 ) - bit_stream_writer->bit_buffer_size;
+
+	if( compressor->compressed_block_size > available_bits )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid bit stream writer - byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* Write the block header
+	 */
+	assorted_bit_stream_writer_write_bits_front_to_back(
+	 bit_stream_writer,
+	 0x314159UL,
+	 24 );
+
+	assorted_bit_stream_writer_write_bits_front_to_back(
+	 bit_stream_writer,
+	 0x265359UL,
+	 24 );
+
+	assorted_bit_stream_writer_write_bits_front_to_back(
+	 bit_stream_writer,
+	 compressor->checksum,
+	 32 );
+
+	/* The randomized flag is not set
+	 */
+	assorted_bit_stream_writer_write_bits_front_to_back(
+	 bit_stream_writer,
+	 compressor->origin_pointer & 0x00ffffffUL,
+	 1 + 24 );
+
+	/* Write the symbol stack as bitmasks of the byte values in use
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( compressor->byte_values_in_use[ byte_value ] != 0 )
+		{
+			level1_value |= (uint32_t) 0x00008000UL >> ( byte_value / 16 );
+		}
+	}
+	assorted_bit_stream_writer_write_bits_front_to_back(
+	 bit_stream_writer,
+	 level1_value,
+	 16 );
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value += 16 )
+	{
+		if( ( level1_value & ( (uint32_t) 0x00008000UL >> ( byte_value / 16 ) ) ) == 0 )
+		{
+			continue;
+		}
+		level2_value = 0;
+
+		for( symbol = 0;
+		     symbol < 16;
+		     symbol++ )
+		{
+			if( compressor->byte_values_in_use[ byte_value + symbol ] != 0 )
+			{
+				level2_value |= (uint32_t) 0x00008000UL >> symbol;
+			}
+		}
+		assorted_bit_stream_writer_write_bits_front_to_back(
+		 bit_stream_writer,
+		 level2_value,
+		 16 );
+	}
+	assorted_bit_stream_writer_write_bits_front_to_back(
+	 bit_stream_writer,
+	 compressor->number_of_trees,
+	 3 );
+
+	assorted_bit_stream_writer_write_bits_front_to_back(
+	 bit_stream_writer,
+	 compressor->number_of_selectors,
+	 15 );
+
+	/* Write the move-to-front encoded selectors in unary
+	 */
+	for( tree_index = 0;
+	     tree_index < compressor->number_of_trees;
+	     tree_index++ )
+	{
+		tree_stack[ tree_index ] = tree_index;
+	}
+	for( selector_index = 0;
+	     selector_index < compressor->number_of_selectors;
+	     selector_index++ )
+	{
+		selected_tree_index = compressor->selectors[ selector_index ];
+		previous_tree_index = tree_stack[ 0 ];
+		stack_index         = 0;
+
+		while( previous_tree_index != selected_tree_index )
+		{
+			stack_index++;
+
+			tree_index                = tree_stack[ stack_index ];
+			tree_stack[ stack_index ] = previous_tree_index;
+			previous_tree_index       = tree_index;
+		}
+		tree_stack[ 0 ] = selected_tree_index;
+
+		assorted_bit_stream_writer_write_bits_front_to_back(
+		 bit_stream_writer,
+		 ( (uint32_t) 1 << ( stack_index + 1 ) ) - 2,
+		 stack_index + 1 );
+	}
+	/* Write the delta encoded code sizes, 10 increments and 11 decrements the code size
+	 */
+	for( tree_index = 0;
+	     tree_index < compressor->number_of_trees;
+	     tree_index++ )
+	{
+		code_size = compressor->code_sizes[ tree_index ][ 0 ];
+
+		assorted_bit_stream_writer_write_bits_front_to_back(
+		 bit_stream_writer,
+		 code_size,
+		 5 );
+
+		for( symbol = 0;
+		     symbol < compressor->alphabet_size;
+		     symbol++ )
+		{
+			while( code_size < compressor->code_sizes[ tree_index ][ symbol ] )
+			{
+				assorted_bit_stream_writer_write_bits_front_to_back(
+				 bit_stream_writer,
+				 0x02,
+				 2 );
+
+				code_size++;
+			}
+			while( code_size > compressor->code_sizes[ tree_index ][ symbol ] )
+			{
+				assorted_bit_stream_writer_write_bits_front_to_back(
+				 bit_stream_writer,
+				 0x03,
+				 2 );
+
+				code_size--;
+			}
+			assorted_bit_stream_writer_write_bits_front_to_back(
+			 bit_stream_writer,
+			 0,
+			 1 );
+		}
+	}
+	/* Write the symbols
+	 */
+	for( symbol_index = 0;
+	     symbol_index < compressor->number_of_symbols;
+	     symbol_index++ )
+	{
+		tree_index = compressor->selectors[ symbol_index / ASSORTED_BZIP_NUMBER_OF_SYMBOLS_PER_SELECTOR ];
+		symbol     = compressor->symbols[ symbol_index ];
+
+		assorted_bit_stream_writer_write_bits_front_to_back(
+		 bit_stream_writer,
+		 compressor->codes[ tree_index ][ symbol ],
+		 compressor->code_sizes[ tree_index ][ symbol ] );
+	}
+	return( 1 );
+}
+
+/* Writes the stream header
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_write_stream_header(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_write_stream_header";
+
+	if( ( compression_level < 1 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	/* The signature "BZh" followed by the compression level as a digit
+	 */
+	if( assorted_bit_stream_writer_write_value(
+	     bit_stream_writer,
+	     0x425a6830UL + (uint32_t) compression_level,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write stream header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the stream footer and flushes the bit stream writer
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_write_stream_footer(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     uint32_t checksum,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_write_stream_footer";
+
+	if( assorted_bit_stream_writer_write_value(
+	     bit_stream_writer,
+	     0x177245UL,
+	     24,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_writer_write_value(
+	     bit_stream_writer,
+	     0x385090UL,
+	     24,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_writer_write_value(
+	     bit_stream_writer,
+	     checksum,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_writer_flush(
+	     bit_stream_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compresses data using BZip2 compression
+ * The compression level ranges from 1 to 9 and determines the block size in multitudes of 100 kB
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	assorted_bzip_compressor_t *compressor          = NULL;
+	static char *function                           = "assorted_bzip_compress";
+	size_t uncompressed_data_offset                 = 0;
+	uint32_t calculated_checksum                    = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_compressor_initialize(
+	     &compressor,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressor.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_writer_initialize(
+	     &bit_stream_writer,
+	     compressed_data,
+	     *compressed_data_size,
+	     0,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream writer.",
+		 function );
 
-		if( assorted_bzip_read_block_data(
-		     bit_stream,
-		     huffman_trees,
-		     number_of_trees,
-		     selectors,
-		     number_of_selectors,
-		     symbol_stack,
-		     number_of_symbols,
-		     block_data,
-		     &safe_block_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read block data.",
-			 function );
+		goto on_error;
+	}
+	if( assorted_bzip_write_stream_header(
+	     bit_stream_writer,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write stream header.",
+		 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		block_data_offset = uncompressed_data_offset;
-#endif
-		if( memory_set(
-		     permutations,
-		     0,
-		     sizeof( size_t ) * block_data_size ) == NULL )
+		goto on_error;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		if( assorted_bzip_compressor_compress_block(
+		     compressor,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear permutations.",
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress block.",
 			 function );
 
 			goto on_error;
 		}
-		/* Perform Burrows-Wheeler transform
-		 */
-		if( assorted_bzip_reverse_burrows_wheeler_transform(
-		     block_data,
-		     safe_block_data_size,
-		     permutations,
-		     origin_pointer,
-		     uncompressed_data,
-		     safe_uncompressed_data_size,
-		     &uncompressed_data_offset,
+		if( assorted_bzip_compressor_write_block(
+		     compressor,
+		     bit_stream_writer,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to reverse Burrows-Wheeler transform.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: block data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( uncompressed_data[ block_data_offset ] ),
-			 uncompressed_data_offset - block_data_offset,
-			 0 );
-		}
-#endif
-		for( tree_index = 0;
-		     tree_index < number_of_trees;
-		     tree_index++ )
-		{
-			if( assorted_huffman_tree_free(
-			     &( huffman_trees[ tree_index ] ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free Huffman tree: %" PRIu8 ".",
-				 function,
-				 tree_index );
+		calculated_checksum = ( calculated_checksum << 1 ) | ( calculated_checksum >> 31 );
 
-				goto on_error;
-			}
-		}
+		calculated_checksum ^= compressor->checksum;
 	}
-	if( assorted_bzip_read_stream_footer(
-	     bit_stream,
-	     signature,
-	     &stored_checksum,
+	if( assorted_bzip_write_stream_footer(
+	     bit_stream_writer,
+	     calculated_checksum,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read stream footer.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write stream footer.",
 		 function );
 
 		goto on_error;
 	}
-	if( assorted_bit_stream_free(
-	     &bit_stream,
+	*compressed_data_size = bit_stream_writer->byte_stream_offset;
+
+	if( assorted_bit_stream_writer_free(
+	     &bit_stream_writer,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit stream.",
+		 "%s: unable to free bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_compressor_free(
+	     &compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressor.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 permutations );
+	return( 1 );
 
-	permutations = NULL;
+on_error:
+	if( bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &bit_stream_writer,
+		 NULL );
+	}
+	if( compressor != NULL )
+	{
+		assorted_bzip_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	return( -1 );
+}
 
-	memory_free(
-	 block_data );
+/* Creates a decoder context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_context_initialize(
+     assorted_bzip_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_context_initialize";
 
-	block_data = NULL;
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
-	if( assorted_bzip_calculate_crc32(
-	     &calculated_checksum,
-	     uncompressed_data,
-	     uncompressed_data_offset,
-	     0,
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( *context != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to calculate checksum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            assorted_bzip_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( assorted_bzip_context_t ) ) == NULL )
 	{
-		libcnotify_printf(
-		 "%s: stored checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 stored_checksum );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
 
-		libcnotify_printf(
-		 "%s: calculated checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 calculated_checksum );
+		memory_free(
+		 *context );
+
+		*context = NULL;
+
+		return( -1 );
 	}
-#endif
-	if( stored_checksum != calculated_checksum )
+	/* The slab of the arena is sized by the first reset after a stream
+	 * that did not fit
+	 */
+	if( assorted_arena_initialize(
+	     &( ( *context )->arena ),
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
-		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
-		 function,
-		 stored_checksum,
-		 calculated_checksum );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
 
 		goto on_error;
 	}
-	*uncompressed_data_size = uncompressed_data_offset;
-
 	return( 1 );
 
 on_error:
-	for( tree_index = 0;
-	     tree_index < number_of_trees;
-	     tree_index++ )
+	if( *context != NULL )
 	{
-		assorted_huffman_tree_free(
-		 &( huffman_trees[ tree_index ] ),
-		 NULL );
+		memory_free(
+		 *context );
+
+		*context = NULL;
 	}
-	if( bit_stream != NULL )
+	return( -1 );
+}
+
+/* Frees a decoder context
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_context_free(
+     assorted_bzip_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_context_free";
+	int result            = 1;
+
+	if( context == NULL )
 	{
-		assorted_bit_stream_free(
-		 &bit_stream,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
 	}
-	if( permutations != NULL )
+	if( *context != NULL )
 	{
+		if( assorted_arena_free(
+		     &( ( *context )->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
-		 permutations );
+		 *context );
+
+		*context = NULL;
 	}
-	if( block_data != NULL )
+	return( result );
+}
+
+/* Resets a decoder context
+ * The scratch memory of the previous stream is released and the arena is
+ * grown to fit it, so that a following stream of a similar size is decoded
+ * without allocating
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_context_reset(
+     assorted_bzip_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_context_reset";
+
+	if( context == NULL )
 	{
-		memory_free(
-		 block_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( assorted_arena_reset(
+	     context->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset arena.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses data using BZIP2 compression using a decoder context
+ * The context is reset before the stream is decompressed
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_context_decompress(
+     assorted_bzip_context_t *context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_context_decompress";
+
+	if( assorted_bzip_context_reset(
+	     context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset context.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_decompress_with_arena(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     context->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "assorted_arena.h"
 #include "assorted_bit_stream.h"
+#include "assorted_bit_stream_writer.h"
 #include "assorted_huffman_tree.h"
 #include "assorted_libcerror.h"
 
@@ -33,8 +35,153 @@
 extern "C" {
 #endif
 
-void assorted_bzip_initialize_crc32_table(
-      void );
+/* The maximum number of Huffman trees of a block
+ */
+#define ASSORTED_BZIP_MAXIMUM_NUMBER_OF_TREES	6
+
+/* The number of symbols that are encoded with the same Huffman tree
+ */
+#define ASSORTED_BZIP_NUMBER_OF_SYMBOLS_PER_SELECTOR	50
+
+/* The maximum code size of the Huffman codes used for compression
+ */
+#define ASSORTED_BZIP_MAXIMUM_CODE_SIZE	17
+
+typedef struct assorted_bzip_decoder assorted_bzip_decoder_t;
+
+struct assorted_bzip_decoder
+{
+	/* The maximum block data size the buffers are allocated for
+	 */
+	size_t maximum_block_data_size;
+
+	/* The block data
+	 */
+	uint8_t *block_data;
+
+	/* The block data size
+	 */
+	size_t block_data_size;
+
+	/* The permutations of the reverse Burrows-Wheeler transform
+	 */
+	uint32_t *permutations;
+
+	/* The symbol stack
+	 */
+	uint8_t symbol_stack[ 256 ];
+
+	/* The selectors
+	 */
+	uint8_t selectors[ ( 1 << 15 ) + 1 ];
+
+	/* The Huffman trees
+	 */
+	assorted_huffman_tree_t *huffman_trees[ 7 ];
+
+	/* The arena the decoder is allocated from, NULL if allocated separately
+	 */
+	assorted_arena_t *arena;
+};
+
+typedef struct assorted_bzip_context assorted_bzip_context_t;
+
+/* The decoder context
+ * Holds the scratch memory of the decoder, such as the block buffers and
+ * the Huffman trees, so that it can be reused to decompress many small
+ * streams
+ */
+struct assorted_bzip_context
+{
+	/* The arena the scratch memory is allocated from
+	 */
+	assorted_arena_t *arena;
+};
+
+typedef struct assorted_bzip_compressor assorted_bzip_compressor_t;
+
+struct assorted_bzip_compressor
+{
+	/* The compression level
+	 */
+	uint8_t compression_level;
+
+	/* The maximum size of the run-length encoded data of a block
+	 */
+	size_t maximum_block_data_size;
+
+	/* The block data, which contains the run-length encoded uncompressed data
+	 */
+	uint8_t *block_data;
+
+	/* The block data size
+	 */
+	size_t block_data_size;
+
+	/* The CRC-32 of the uncompressed data of the block
+	 */
+	uint32_t checksum;
+
+	/* The text of which the suffixes are sorted for the Burrows-Wheeler transform
+	 */
+	int32_t *text;
+
+	/* The suffix array
+	 */
+	int32_t *suffix_array;
+
+	/* The Burrows-Wheeler transformed block data
+	 */
+	uint8_t *transformed_data;
+
+	/* The origin pointer of the Burrows-Wheeler transform
+	 */
+	uint32_t origin_pointer;
+
+	/* The byte values used in the block data
+	 */
+	uint8_t byte_values_in_use[ 256 ];
+
+	/* The number of byte values used in the block data
+	 */
+	uint16_t number_of_byte_values_in_use;
+
+	/* The move-to-front and run-length encoded symbols
+	 */
+	uint16_t *symbols;
+
+	/* The number of symbols
+	 */
+	size_t number_of_symbols;
+
+	/* The number of symbols in the Huffman alphabet
+	 */
+	uint16_t alphabet_size;
+
+	/* The number of Huffman trees
+	 */
+	uint8_t number_of_trees;
+
+	/* The selectors
+	 */
+	uint8_t *selectors;
+
+	/* The number of selectors
+	 */
+	uint16_t number_of_selectors;
+
+	/* The code sizes of the Huffman trees
+	 */
+	uint8_t code_sizes[ ASSORTED_BZIP_MAXIMUM_NUMBER_OF_TREES ][ 258 ];
+
+	/* The codes of the Huffman trees
+	 */
+	uint32_t codes[ ASSORTED_BZIP_MAXIMUM_NUMBER_OF_TREES ][ 258 ];
+
+	/* The size of the compressed block in bits
+	 */
+	uint64_t compressed_block_size;
+};
 
 int assorted_bzip_calculate_crc32(
      uint32_t *crc32,
@@ -46,13 +193,22 @@ int assorted_bzip_calculate_crc32(
 int assorted_bzip_reverse_burrows_wheeler_transform(
      const uint8_t *input_data,
      size_t input_data_size,
-     size_t *permutations,
+     uint32_t *permutations,
      uint32_t origin_pointer,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error );
 
+int assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint32_t *permutations,
+     uint32_t origin_pointer,
+     uint32_t *crc32,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
 int assorted_bzip_read_stream_header(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -69,6 +225,7 @@ int assorted_bzip_read_block_header(
      assorted_bit_stream_t *bit_stream,
      uint64_t signature,
      uint32_t *origin_pointer,
+     uint32_t *checksum,
      libcerror_error_t **error );
 
 int assorted_bzip_read_symbol_stack(
@@ -114,12 +271,46 @@ int assorted_bzip_read_block_data(
      size_t *block_data_size,
      libcerror_error_t **error );
 
+int assorted_bzip_decoder_initialize(
+     assorted_bzip_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int assorted_bzip_decoder_initialize_with_arena(
+     assorted_bzip_decoder_t **decoder,
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
+int assorted_bzip_decoder_free(
+     assorted_bzip_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int assorted_bzip_decoder_resize(
+     assorted_bzip_decoder_t *decoder,
+     size_t maximum_block_data_size,
+     libcerror_error_t **error );
+
+int assorted_bzip_decoder_read_block(
+     assorted_bzip_decoder_t *decoder,
+     assorted_bit_stream_t *bit_stream,
+     uint64_t signature,
+     uint32_t *origin_pointer,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
 int assorted_bzip_read_stream_footer(
      assorted_bit_stream_t *bit_stream,
      uint64_t signature,
      uint32_t *checksum,
      libcerror_error_t **error );
 
+int assorted_bzip_decode_stream(
+     assorted_bzip_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 int assorted_bzip_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -127,6 +318,106 @@ int assorted_bzip_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int assorted_bzip_decompress_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
+int assorted_bzip_verify(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_bzip_run_length_encode(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t *block_data,
+     size_t maximum_block_data_size,
+     size_t *block_data_size,
+     libcerror_error_t **error );
+
+int assorted_bzip_compressor_initialize(
+     assorted_bzip_compressor_t **compressor,
+     int compression_level,
+     libcerror_error_t **error );
+
+int assorted_bzip_compressor_free(
+     assorted_bzip_compressor_t **compressor,
+     libcerror_error_t **error );
+
+int assorted_bzip_compressor_sort_block(
+     assorted_bzip_compressor_t *compressor,
+     libcerror_error_t **error );
+
+int assorted_bzip_compressor_encode_symbols(
+     assorted_bzip_compressor_t *compressor,
+     libcerror_error_t **error );
+
+int assorted_bzip_compressor_build_code_sizes(
+     const uint32_t *frequencies,
+     uint16_t alphabet_size,
+     uint8_t *code_sizes,
+     libcerror_error_t **error );
+
+int assorted_bzip_compressor_build_huffman_trees(
+     assorted_bzip_compressor_t *compressor,
+     libcerror_error_t **error );
+
+int assorted_bzip_compressor_compress_block(
+     assorted_bzip_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_bzip_compressor_write_block(
+     assorted_bzip_compressor_t *compressor,
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     libcerror_error_t **error );
+
+int assorted_bzip_write_stream_header(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     int compression_level,
+     libcerror_error_t **error );
+
+int assorted_bzip_write_stream_footer(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     uint32_t checksum,
+     libcerror_error_t **error );
+
+int assorted_bzip_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_bzip_context_initialize(
+     assorted_bzip_context_t **context,
+     libcerror_error_t **error );
+
+int assorted_bzip_context_free(
+     assorted_bzip_context_t **context,
+     libcerror_error_t **error );
+
+int assorted_bzip_context_reset(
+     assorted_bzip_context_t *context,
+     libcerror_error_t **error );
+
+int assorted_bzip_context_decompress(
+     assorted_bzip_context_t *context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1962 @@
+/*
+ * BZip parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_bit_stream.h"
+#include "assorted_bit_stream_writer.h"
+#include "assorted_bzip.h"
+#include "assorted_bzip_parallel.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+/* Finds the next block signature from a bit offset
+ * The block signature is not byte aligned and can occur in the compressed data
+ * of a block, hence a signature found is a candidate block start
+ * Returns 1 if found, 0 if not or -1 on error
+ */
+int assorted_bzip_parallel_find_block_signature(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t *bit_offset,
+     libcerror_error_t **error )
+{
+	static char *function       = "assorted_bzip_parallel_find_block_signature";
+	size_t byte_offset          = 0;
+	uint64_t candidate_value    = 0;
+	uint64_t end_bit_offset     = 0;
+	uint64_t safe_bit_offset    = 0;
+	uint64_t value_64bit        = 0;
+	uint8_t bit_index           = 0;
+	uint8_t byte_index          = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_bit_offset = *bit_offset;
+	end_bit_offset  = (uint64_t) compressed_data_size * 8;
+
+	if( ( end_bit_offset < 48 )
+	 || ( safe_bit_offset > ( end_bit_offset - 48 ) ) )
+	{
+		return( 0 );
+	}
+	/* The value contains the 56 bits of the 7 bytes starting at the byte offset,
+	 * which contains the 48 bits starting at each of the 8 bit offsets of the byte
+	 */
+	byte_offset = (size_t) ( safe_bit_offset / 8 );
+
+	for( byte_index = 0;
+	     byte_index < 6;
+	     byte_index++ )
+	{
+		value_64bit <<= 8;
+
+		if( ( byte_offset + byte_index ) < compressed_data_size )
+		{
+			value_64bit |= compressed_data[ byte_offset + byte_index ];
+		}
+	}
+	while( byte_offset < compressed_data_size )
+	{
+		value_64bit <<= 8;
+
+		if( ( byte_offset + 6 ) < compressed_data_size )
+		{
+			value_64bit |= compressed_data[ byte_offset + 6 ];
+		}
+		for( bit_index = 0;
+		     bit_index < 8;
+		     bit_index++ )
+		{
+			candidate_value = ( value_64bit >> ( 8 - bit_index ) ) & 0x0000ffffffffffffUL;
+
+			if( candidate_value == 0x314159265359UL )
+			{
+				safe_bit_offset = ( (uint64_t) byte_offset * 8 ) + bit_index;
+
+				if( ( safe_bit_offset >= *bit_offset )
+				 && ( safe_bit_offset <= ( end_bit_offset - 48 ) ) )
+				{
+					*bit_offset = safe_bit_offset;
+
+					return( 1 );
+				}
+			}
+		}
+		byte_offset++;
+	}
+	return( 0 );
+}
+
+/* Decompresses a block using a decoder
+ * The uncompressed data of the block is allocated and its CRC-32 is validated
+ * against the CRC-32 stored in the block header
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_parallel_decompress_block(
+     assorted_bzip_parallel_block_t *block,
+     assorted_bzip_decoder_t *decoder,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream    = NULL;
+	libcerror_error_t *local_error       = NULL;
+	void *reallocation                   = NULL;
+	static char *function                = "assorted_bzip_parallel_decompress_block";
+	size_t uncompressed_data_offset      = 0;
+	size_t uncompressed_data_size        = 0;
+	uint64_t signature                   = 0;
+	uint32_t calculated_checksum         = 0;
+	uint32_t origin_pointer              = 0;
+	uint32_t value_32bit                 = 0;
+	int result                           = 0;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( block->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block - missing compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block->start_bit_offset / 8 ) >= (uint64_t) block->compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block - start bit offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_decoder_resize(
+	     decoder,
+	     block->maximum_block_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( block->uncompressed_data != NULL )
+	{
+		memory_free(
+		 block->uncompressed_data );
+
+		block->uncompressed_data = NULL;
+	}
+	block->uncompressed_data_size = 0;
+
+	if( assorted_bit_stream_initialize(
+	     &bit_stream,
+	     block->compressed_data,
+	     block->compressed_data_size,
+	     (size_t) ( block->start_bit_offset / 8 ),
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( block->start_bit_offset & 0x07 ) != 0 )
+	{
+		if( assorted_bit_stream_get_value_front_to_back(
+		     bit_stream,
+		     (uint8_t) ( block->start_bit_offset & 0x07 ),
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( assorted_bzip_read_signature(
+	     bit_stream,
+	     &signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_decoder_read_block(
+	     decoder,
+	     bit_stream,
+	     signature,
+	     &origin_pointer,
+	     &( block->stored_checksum ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block.",
+		 function );
+
+		goto on_error;
+	}
+	block->end_bit_offset = ( (uint64_t) bit_stream->byte_stream_offset * 8 ) - bit_stream->bit_buffer_size;
+
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	/* The run-length encoding of the block data can expand the data more than twice
+	 * in which case the exact size is determined and the transform is reversed again
+	 */
+	uncompressed_data_size = ( decoder->block_data_size * 2 ) + 1;
+
+	block->uncompressed_data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( block->uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	result = assorted_bzip_reverse_burrows_wheeler_transform(
+	          decoder->block_data,
+	          decoder->block_data_size,
+	          decoder->permutations,
+	          origin_pointer,
+	          block->uncompressed_data,
+	          uncompressed_data_size,
+	          &uncompressed_data_offset,
+	          &local_error );
+
+	if( result != 1 )
+	{
+		result = libcerror_error_matches(
+		          local_error,
+		          LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		          LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE );
+
+		libcerror_error_free(
+		 &local_error );
+
+		uncompressed_data_offset = 0;
+
+		if( result != 0 )
+		{
+			if( assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+			     decoder->block_data,
+			     decoder->block_data_size,
+			     decoder->permutations,
+			     origin_pointer,
+			     &calculated_checksum,
+			     &uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine uncompressed data size.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = memory_reallocate(
+			                block->uncompressed_data,
+			                sizeof( uint8_t ) * uncompressed_data_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+			block->uncompressed_data = (uint8_t *) reallocation;
+		}
+		/* Reverse the transform again to retrieve the error otherwise
+		 */
+		if( assorted_bzip_reverse_burrows_wheeler_transform(
+		     decoder->block_data,
+		     decoder->block_data_size,
+		     decoder->permutations,
+		     origin_pointer,
+		     block->uncompressed_data,
+		     uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to reverse Burrows-Wheeler transform.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( assorted_bzip_calculate_crc32(
+	     &calculated_checksum,
+	     block->uncompressed_data,
+	     uncompressed_data_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( block->stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 block->stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	block->uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( local_error != NULL )
+	{
+		libcerror_error_free(
+		 &local_error );
+	}
+	if( block->uncompressed_data != NULL )
+	{
+		memory_free(
+		 block->uncompressed_data );
+
+		block->uncompressed_data = NULL;
+	}
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses a block from a thread pool
+ * The arguments contain a queue of decoders, one per worker thread, a decoder
+ * is taken from the queue for the duration of the block decompression
+ * The error is not available from the worker thread, the result is stored in the block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_parallel_decompress_block_callback(
+     intptr_t *value,
+     void *arguments )
+{
+	assorted_bzip_decoder_t *decoder      = NULL;
+	assorted_bzip_parallel_block_t *block = NULL;
+	libcthreads_queue_t *decoders_queue   = NULL;
+
+	if( ( value == NULL )
+	 || ( arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	block          = (assorted_bzip_parallel_block_t *) value;
+	decoders_queue = (libcthreads_queue_t *) arguments;
+
+	if( libcthreads_queue_pop(
+	     decoders_queue,
+	     (intptr_t **) &decoder,
+	     NULL ) != 1 )
+	{
+		block->result = -1;
+
+		return( -1 );
+	}
+	block->result = assorted_bzip_parallel_decompress_block(
+	                 block,
+	                 decoder,
+	                 NULL );
+
+	if( libcthreads_queue_push(
+	     decoders_queue,
+	     (intptr_t *) decoder,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+
+	/* A failed block is decompressed again to retrieve the error
+	 * if it is part of the stream
+	 */
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses data using BZIP2 compression with the blocks decoded in parallel
+ * The compressed data is scanned for block signatures. Since a block signature can
+ * also occur in the compressed data of a block, the candidate blocks are decoded and
+ * only the candidate that starts where the previous block ends is part of the stream.
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream       = NULL;
+	assorted_bzip_decoder_t *decoder        = NULL;
+	assorted_bzip_parallel_block_t *blocks  = NULL;
+	static char *function                   = "assorted_bzip_parallel_decompress";
+	size_t block_index                      = 0;
+	size_t compressed_data_offset           = 0;
+	size_t maximum_block_data_size          = 0;
+	size_t maximum_number_of_blocks         = 0;
+	size_t number_of_blocks                 = 0;
+	size_t safe_uncompressed_data_size      = 0;
+	size_t uncompressed_data_offset         = 0;
+	uint64_t next_bit_offset                = 0;
+	uint64_t search_bit_offset              = 0;
+	uint64_t signature                      = 0;
+	uint32_t calculated_checksum            = 0;
+	uint32_t stored_checksum                = 0;
+	uint32_t value_32bit                    = 0;
+	uint8_t compression_level               = 0;
+	int result                              = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_bzip_decoder_t *thread_decoder = NULL;
+	libcthreads_queue_t *decoders_queue     = NULL;
+	assorted_thread_pool_t *thread_pool     = NULL;
+	int maximum_number_of_values            = 0;
+	int thread_index                        = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 14 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bzip_read_stream_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     &compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream header.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_block_data_size = (size_t) compression_level * 100000;
+
+	maximum_number_of_blocks = (size_t) number_of_threads * ASSORTED_BZIP_PARALLEL_NUMBER_OF_BLOCKS_PER_THREAD;
+
+	blocks = (assorted_bzip_parallel_block_t *) memory_allocate(
+	                                             sizeof( assorted_bzip_parallel_block_t ) * maximum_number_of_blocks );
+
+	if( blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     blocks,
+	     0,
+	     sizeof( assorted_bzip_parallel_block_t ) * maximum_number_of_blocks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blocks.",
+		 function );
+
+		goto on_error;
+	}
+	/* The decoders are reused for all the blocks, the blocks that are part of the
+	 * stream are decompressed again with a separate decoder to retrieve the error
+	 */
+	if( assorted_bzip_decoder_initialize(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_queue_initialize(
+		     &decoders_queue,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decoders queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( assorted_bzip_decoder_initialize(
+			     &thread_decoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create decoder: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     decoders_queue,
+			     (intptr_t *) thread_decoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push decoder: %d onto queue.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			thread_decoder = NULL;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( assorted_bit_stream_initialize(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     compressed_data_offset,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	next_bit_offset   = (uint64_t) compressed_data_offset * 8;
+	search_bit_offset = next_bit_offset;
+
+	do
+	{
+		/* Determine if the next block is the stream footer
+		 */
+		if( assorted_bit_stream_set_byte_stream_offset(
+		     bit_stream,
+		     (size_t) ( next_bit_offset / 8 ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set byte stream offset.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( next_bit_offset & 0x07 ) != 0 )
+		{
+			if( assorted_bit_stream_get_value_front_to_back(
+			     bit_stream,
+			     (uint8_t) ( next_bit_offset & 0x07 ),
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( assorted_bzip_read_signature(
+		     bit_stream,
+		     &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( signature == 0x177245385090UL )
+		{
+			break;
+		}
+		if( signature != 0x314159265359UL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported signature: 0x%" PRIx64 ".",
+			 function,
+			 signature );
+
+			goto on_error;
+		}
+		/* Collect the next candidate blocks
+		 */
+		for( number_of_blocks = 0;
+		     number_of_blocks < maximum_number_of_blocks;
+		     number_of_blocks++ )
+		{
+			result = assorted_bzip_parallel_find_block_signature(
+			          compressed_data,
+			          compressed_data_size,
+			          &search_bit_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to find block signature.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			blocks[ number_of_blocks ].compressed_data         = compressed_data;
+			blocks[ number_of_blocks ].compressed_data_size    = compressed_data_size;
+			blocks[ number_of_blocks ].start_bit_offset        = search_bit_offset;
+			blocks[ number_of_blocks ].maximum_block_data_size = maximum_block_data_size;
+			blocks[ number_of_blocks ].result                  = 0;
+
+			search_bit_offset += 1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( number_of_threads > 1 )
+		 && ( number_of_blocks > 1 ) )
+		{
+			maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+			if( (size_t) maximum_number_of_values > number_of_blocks )
+			{
+				maximum_number_of_values = (int) number_of_blocks;
+			}
+			if( assorted_thread_pool_create(
+			     &thread_pool,
+			     number_of_threads,
+			     maximum_number_of_values,
+			     (int (*)(intptr_t *, void *)) &assorted_bzip_parallel_decompress_block_callback,
+			     (void *) decoders_queue,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( block_index = 0;
+			     block_index < number_of_blocks;
+			     block_index++ )
+			{
+				if( assorted_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( blocks[ block_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push block: %" PRIzd " onto thread pool queue.",
+					 function,
+					 block_index );
+
+					goto on_error;
+				}
+			}
+			if( assorted_thread_pool_join(
+			     &thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		/* Without a thread pool only the candidate blocks that are part of the stream
+		 * are decompressed and a block that failed is decompressed again to retrieve the error
+		 */
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			if( blocks[ block_index ].start_bit_offset < next_bit_offset )
+			{
+				continue;
+			}
+			if( blocks[ block_index ].start_bit_offset > next_bit_offset )
+			{
+				break;
+			}
+			if( blocks[ block_index ].result != 1 )
+			{
+				if( assorted_bzip_parallel_decompress_block(
+				     &( blocks[ block_index ] ),
+				     decoder,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decompress block at bit offset: %" PRIu64 ".",
+					 function,
+					 next_bit_offset );
+
+					goto on_error;
+				}
+				blocks[ block_index ].result = 1;
+			}
+			if( blocks[ block_index ].uncompressed_data_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     blocks[ block_index ].uncompressed_data,
+			     blocks[ block_index ].uncompressed_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+			uncompressed_data_offset += blocks[ block_index ].uncompressed_data_size;
+
+			/* The stream CRC-32 combines the CRC-32 of the blocks
+			 */
+			calculated_checksum = ( calculated_checksum << 1 ) | ( calculated_checksum >> 31 );
+			calculated_checksum ^= blocks[ block_index ].stored_checksum;
+
+			next_bit_offset = blocks[ block_index ].end_bit_offset;
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			if( blocks[ block_index ].uncompressed_data != NULL )
+			{
+				memory_free(
+				 blocks[ block_index ].uncompressed_data );
+
+				blocks[ block_index ].uncompressed_data = NULL;
+			}
+		}
+		/* The search continues after the last candidate block, unless the next
+		 * block starts before it, which can only be the stream footer
+		 */
+		if( ( number_of_blocks == 0 )
+		 || ( next_bit_offset > search_bit_offset ) )
+		{
+			search_bit_offset = next_bit_offset;
+		}
+	}
+	while( number_of_blocks > 0 );
+
+	if( signature != 0x177245385090UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: missing block at bit offset: %" PRIu64 ".",
+		 function,
+		 next_bit_offset );
+
+		goto on_error;
+	}
+	if( assorted_bzip_read_stream_footer(
+	     bit_stream,
+	     signature,
+	     &stored_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream footer.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 blocks );
+
+	blocks = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( decoders_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &decoders_queue,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &assorted_bzip_decoder_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoders queue.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( assorted_bzip_decoder_free(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( decoders_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &decoders_queue,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &assorted_bzip_decoder_free,
+		 NULL );
+	}
+	if( thread_decoder != NULL )
+	{
+		assorted_bzip_decoder_free(
+		 &thread_decoder,
+		 NULL );
+	}
+#endif
+	if( decoder != NULL )
+	{
+		assorted_bzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( blocks != NULL )
+	{
+		for( block_index = 0;
+		     block_index < maximum_number_of_blocks;
+		     block_index++ )
+		{
+			if( blocks[ block_index ].uncompressed_data != NULL )
+			{
+				memory_free(
+				 blocks[ block_index ].uncompressed_data );
+			}
+		}
+		memory_free(
+		 blocks );
+	}
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+
+/* Compresses a block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_parallel_compress_block(
+     assorted_bzip_parallel_compression_block_t *block,
+     assorted_bzip_compressor_t *compressor,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	static char *function                           = "assorted_bzip_parallel_compress_block";
+	size_t uncompressed_data_offset                 = 0;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( block->compressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block - compressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_data_offset = block->uncompressed_data_offset;
+
+	if( assorted_bzip_compressor_compress_block(
+	     compressor,
+	     block->uncompressed_data,
+	     block->uncompressed_data_size,
+	     &uncompressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress block.",
+		 function );
+
+		goto on_error;
+	}
+	if( uncompressed_data_offset != block->uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block - uncompressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	block->compressed_block_size = compressor->compressed_block_size;
+	block->compressed_data_size  = (size_t) ( ( block->compressed_block_size + 7 ) / 8 );
+	block->checksum              = compressor->checksum;
+
+	block->compressed_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * block->compressed_data_size );
+
+	if( block->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_writer_initialize(
+	     &bit_stream_writer,
+	     block->compressed_data,
+	     block->compressed_data_size,
+	     0,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_compressor_write_block(
+	     compressor,
+	     bit_stream_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_writer_flush(
+	     bit_stream_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_writer_free(
+	     &bit_stream_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &bit_stream_writer,
+		 NULL );
+	}
+	if( block->compressed_data != NULL )
+	{
+		memory_free(
+		 block->compressed_data );
+
+		block->compressed_data = NULL;
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Compresses a block from a thread pool
+ * The arguments contain a queue of compressors, one per worker thread, a compressor
+ * is taken from the queue for the duration of the block compression
+ * The error is not available from the worker thread, the result is stored in the block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_parallel_compress_block_callback(
+     intptr_t *value,
+     void *arguments )
+{
+	assorted_bzip_compressor_t *compressor            = NULL;
+	assorted_bzip_parallel_compression_block_t *block = NULL;
+	libcthreads_queue_t *compressors_queue            = NULL;
+
+	if( ( value == NULL )
+	 || ( arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	block             = (assorted_bzip_parallel_compression_block_t *) value;
+	compressors_queue = (libcthreads_queue_t *) arguments;
+
+	if( libcthreads_queue_pop(
+	     compressors_queue,
+	     (intptr_t **) &compressor,
+	     NULL ) != 1 )
+	{
+		block->result = -1;
+
+		return( -1 );
+	}
+	block->result = assorted_bzip_parallel_compress_block(
+	                 block,
+	                 compressor,
+	                 NULL );
+
+	if( libcthreads_queue_push(
+	     compressors_queue,
+	     (intptr_t *) compressor,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( block->result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Compresses data using BZIP2 compression with the blocks compressed in parallel
+ * The block boundaries are determined by run-length encoding the data up front,
+ * hence the blocks are independent and the result is identical to that of assorted_bzip_compress
+ * The compressed blocks are not byte aligned and are joined at bit level
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_parallel_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     int number_of_threads,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_writer_t *bit_stream_writer    = NULL;
+	assorted_bzip_compressor_t *compressor             = NULL;
+	assorted_bzip_parallel_compression_block_t *blocks = NULL;
+	static char *function                              = "assorted_bzip_parallel_compress";
+	size_t block_data_offset                           = 0;
+	size_t block_data_size                             = 0;
+	size_t block_index                                 = 0;
+	size_t maximum_block_data_size                     = 0;
+	size_t number_of_blocks                            = 0;
+	size_t uncompressed_data_offset                    = 0;
+	uint64_t available_bits                            = 0;
+	uint32_t calculated_checksum                       = 0;
+	uint32_t value_32bit                               = 0;
+	uint8_t remaining_bits                             = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_bzip_compressor_t *thread_compressor      = NULL;
+	libcthreads_queue_t *compressors_queue             = NULL;
+	assorted_thread_pool_t *thread_pool                = NULL;
+	int maximum_number_of_queued_blocks                = 0;
+	int thread_index                                   = 0;
+#endif
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_level < 1 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_block_data_size = ( (size_t) compression_level * 100000 ) - 19;
+
+	/* Determine the number of blocks
+	 */
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		if( assorted_bzip_run_length_encode(
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     NULL,
+		     maximum_block_data_size,
+		     &block_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to determine size of block: %" PRIzd ".",
+			 function,
+			 number_of_blocks );
+
+			goto on_error;
+		}
+		number_of_blocks++;
+	}
+	if( number_of_blocks > 0 )
+	{
+		blocks = (assorted_bzip_parallel_compression_block_t *) memory_allocate(
+		                                                          sizeof( assorted_bzip_parallel_compression_block_t ) * number_of_blocks );
+
+		if( blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create blocks.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     blocks,
+		     0,
+		     sizeof( assorted_bzip_parallel_compression_block_t ) * number_of_blocks ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear blocks.",
+			 function );
+
+			memory_free(
+			 blocks );
+
+			return( -1 );
+		}
+	}
+	uncompressed_data_offset = 0;
+
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		blocks[ block_index ].uncompressed_data        = uncompressed_data;
+		blocks[ block_index ].uncompressed_data_offset = uncompressed_data_offset;
+		blocks[ block_index ].compression_level        = compression_level;
+
+		if( assorted_bzip_run_length_encode(
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     NULL,
+		     maximum_block_data_size,
+		     &block_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to determine size of block: %" PRIzd ".",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		blocks[ block_index ].uncompressed_data_size = uncompressed_data_offset;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_blocks > 1 ) )
+	{
+		if( libcthreads_queue_initialize(
+		     &compressors_queue,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressors queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( assorted_bzip_compressor_initialize(
+			     &thread_compressor,
+			     compression_level,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create compressor: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     compressors_queue,
+			     (intptr_t *) thread_compressor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push compressor: %d onto queue.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			thread_compressor = NULL;
+		}
+		maximum_number_of_queued_blocks = ASSORTED_BZIP_PARALLEL_NUMBER_OF_BLOCKS_PER_THREAD * number_of_threads;
+
+		if( number_of_blocks < (size_t) maximum_number_of_queued_blocks )
+		{
+			maximum_number_of_queued_blocks = (int) number_of_blocks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_queued_blocks,
+		     (int (*)(intptr_t *, void *)) &assorted_bzip_parallel_compress_block_callback,
+		     (void *) compressors_queue,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( blocks[ block_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push block: %" PRIzd " onto thread pool queue.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_free(
+		     &compressors_queue,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &assorted_bzip_compressor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressors queue.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	if( number_of_blocks > 0 )
+	{
+		if( assorted_bzip_compressor_initialize(
+		     &compressor,
+		     compression_level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressor.",
+			 function );
+
+			goto on_error;
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			blocks[ block_index ].result = assorted_bzip_parallel_compress_block(
+			                                &( blocks[ block_index ] ),
+			                                compressor,
+			                                error );
+
+			if( blocks[ block_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress block: %" PRIzd ".",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_bzip_compressor_free(
+		     &compressor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressor.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( assorted_bit_stream_writer_initialize(
+	     &bit_stream_writer,
+	     compressed_data,
+	     *compressed_data_size,
+	     0,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_write_stream_header(
+	     bit_stream_writer,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write stream header.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( blocks[ block_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress block: %" PRIzd ".",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		available_bits = ( (uint64_t) ( bit_stream_writer->byte_stream_size - bit_stream_writer->byte_stream_offset ) * 8 ) - bit_stream_writer->bit_buffer_size;
+
+		if( blocks[ block_index ].compressed_block_size > available_bits )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		/* The block is appended to the bits written so far, 32 bits at a time
+		 */
+		for( block_data_offset = 0;
+		     ( block_data_offset + 4 ) <= ( blocks[ block_index ].compressed_block_size / 8 );
+		     block_data_offset += 4 )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( blocks[ block_index ].compressed_data[ block_data_offset ] ),
+			 value_32bit );
+
+			assorted_bit_stream_writer_write_bits_front_to_back(
+			 bit_stream_writer,
+			 value_32bit,
+			 32 );
+		}
+		while( block_data_offset < ( blocks[ block_index ].compressed_block_size / 8 ) )
+		{
+			assorted_bit_stream_writer_write_bits_front_to_back(
+			 bit_stream_writer,
+			 blocks[ block_index ].compressed_data[ block_data_offset ],
+			 8 );
+
+			block_data_offset++;
+		}
+		remaining_bits = (uint8_t) ( blocks[ block_index ].compressed_block_size % 8 );
+
+		if( remaining_bits > 0 )
+		{
+			assorted_bit_stream_writer_write_bits_front_to_back(
+			 bit_stream_writer,
+			 blocks[ block_index ].compressed_data[ block_data_offset ] >> ( 8 - remaining_bits ),
+			 remaining_bits );
+		}
+		calculated_checksum = ( calculated_checksum << 1 ) | ( calculated_checksum >> 31 );
+
+		calculated_checksum ^= blocks[ block_index ].checksum;
+
+		memory_free(
+		 blocks[ block_index ].compressed_data );
+
+		blocks[ block_index ].compressed_data = NULL;
+	}
+	if( assorted_bzip_write_stream_footer(
+	     bit_stream_writer,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write stream footer.",
+		 function );
+
+		goto on_error;
+	}
+	*compressed_data_size = bit_stream_writer->byte_stream_offset;
+
+	if( assorted_bit_stream_writer_free(
+	     &bit_stream_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( blocks != NULL )
+	{
+		memory_free(
+		 blocks );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( compressors_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &compressors_queue,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &assorted_bzip_compressor_free,
+		 NULL );
+	}
+	if( thread_compressor != NULL )
+	{
+		assorted_bzip_compressor_free(
+		 &thread_compressor,
+		 NULL );
+	}
+#endif
+	if( compressor != NULL )
+	{
+		assorted_bzip_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	if( bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &bit_stream_writer,
+		 NULL );
+	}
+	if( blocks != NULL )
+	{
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			if( blocks[ block_index ].compressed_data != NULL )
+			{
+				memory_free(
+				 blocks[ block_index ].compressed_data );
+			}
+		}
+		memory_free(
+		 blocks );
+	}
+	return( -1 );
+}
+
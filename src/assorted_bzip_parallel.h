@@ -0,0 +1,175 @@
+/*
+ * BZip parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_BZIP_PARALLEL_H )
+#define _ASSORTED_BZIP_PARALLEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_bzip.h"
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of blocks that are decoded per thread before the decoded blocks are written
+ */
+#define ASSORTED_BZIP_PARALLEL_NUMBER_OF_BLOCKS_PER_THREAD	4
+
+typedef struct assorted_bzip_parallel_block assorted_bzip_parallel_block_t;
+
+struct assorted_bzip_parallel_block
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The bit offset of the block signature
+	 */
+	uint64_t start_bit_offset;
+
+	/* The bit offset after the block data
+	 */
+	uint64_t end_bit_offset;
+
+	/* The maximum size of the block data as defined by the compression level
+	 */
+	size_t maximum_block_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The CRC-32 as stored in the block header
+	 */
+	uint32_t stored_checksum;
+
+	/* The result of the block decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+typedef struct assorted_bzip_parallel_compression_block assorted_bzip_parallel_compression_block_t;
+
+struct assorted_bzip_parallel_compression_block
+{
+	/* The uncompressed data
+	 */
+	const uint8_t *uncompressed_data;
+
+	/* The end offset of the block in the uncompressed data
+	 */
+	size_t uncompressed_data_size;
+
+	/* The start offset of the block in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The number of bits of the compressed block in the compressed data
+	 */
+	uint64_t compressed_block_size;
+
+	/* The CRC-32 of the uncompressed data of the block
+	 */
+	uint32_t checksum;
+
+	/* The result of the block compression
+	 */
+	int result;
+};
+
+int assorted_bzip_parallel_find_block_signature(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t *bit_offset,
+     libcerror_error_t **error );
+
+int assorted_bzip_parallel_decompress_block(
+     assorted_bzip_parallel_block_t *block,
+     assorted_bzip_decoder_t *decoder,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_bzip_parallel_decompress_block_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_bzip_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_bzip_parallel_compress_block(
+     assorted_bzip_parallel_compression_block_t *block,
+     assorted_bzip_compressor_t *compressor,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_bzip_parallel_compress_block_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_bzip_parallel_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     int number_of_threads,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_BZIP_PARALLEL_H ) */
+
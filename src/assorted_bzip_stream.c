@@ -0,0 +1,1518 @@
+/*
+ * BZIP2 streaming decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_aligned_memory.h"
+#include "assorted_bit_stream.h"
+#include "assorted_bzip.h"
+#include "assorted_bzip_stream.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+
+/* The size of the input buffer before the compression level is known
+ */
+#define ASSORTED_BZIP_STREAM_INITIAL_INPUT_BUFFER_SIZE		16384
+
+/* The size of the buffer of the uncompressed data that is passed to a sink
+ */
+#define ASSORTED_BZIP_STREAM_OUTPUT_BUFFER_SIZE			65536
+
+/* The maximum number of bits of a block that precede the block data
+ * 48-bit signature, 32-bit CRC-32, 1-bit randomized flag, 24-bit origin pointer,
+ * 272-bit symbol stack, 3-bit number of trees, 15-bit number of selectors,
+ * 32767 selectors of at most 7 bits and 6 trees of 5 bits and 258 code sizes
+ * of at most 40 bits
+ */
+#define ASSORTED_BZIP_STREAM_MAXIMUM_BLOCK_HEADER_SIZE		( 105 + 272 + 18 + ( 32767 * 7 ) + ( 6 * ( 5 + ( 258 * 40 ) ) ) )
+
+/* Retrieves the maximum number of bits of a block
+ * Every symbol of the block data is at most 20 bits and produces at least 1 byte
+ * of block data, except for the end of block symbol
+ */
+#define assorted_bzip_stream_get_maximum_block_size( compression_level ) \
+	( (uint64_t) ASSORTED_BZIP_STREAM_MAXIMUM_BLOCK_HEADER_SIZE + ( 20 * ( ( (uint64_t) compression_level * 100000 ) + 1 ) ) )
+
+/* Retrieves the number of bits available in the bit stream
+ */
+#define assorted_bzip_stream_get_number_of_available_bits( bit_stream ) \
+	( (uint64_t) bit_stream->bit_buffer_size + ( (uint64_t) ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) * 8 ) )
+
+/* Creates a stream
+ * Make sure the value stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_stream_initialize(
+     assorted_bzip_stream_t **stream,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_stream_initialize";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*stream = memory_allocate_structure(
+	           assorted_bzip_stream_t );
+
+	if( *stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stream,
+	     0,
+	     sizeof( assorted_bzip_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		memory_free(
+		 *stream );
+
+		*stream = NULL;
+
+		return( -1 );
+	}
+	( *stream )->input_data = (uint8_t *) assorted_aligned_memory_allocate(
+	                                       sizeof( uint8_t ) * ASSORTED_BZIP_STREAM_INITIAL_INPUT_BUFFER_SIZE );
+
+	if( ( *stream )->input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input data.",
+		 function );
+
+		goto on_error;
+	}
+	( *stream )->input_data_size = ASSORTED_BZIP_STREAM_INITIAL_INPUT_BUFFER_SIZE;
+
+	if( assorted_bit_stream_initialize(
+	     &( ( *stream )->bit_stream ),
+	     ( *stream )->input_data,
+	     0,
+	     0,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bzip_decoder_initialize(
+	     &( ( *stream )->decoder ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	( *stream )->state = ASSORTED_BZIP_STREAM_STATE_STREAM_HEADER;
+
+	return( 1 );
+
+on_error:
+	if( *stream != NULL )
+	{
+		assorted_bzip_stream_free(
+		 stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a stream
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bzip_stream_free(
+     assorted_bzip_stream_t **stream,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_bzip_stream_free";
+	int result            = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		if( ( *stream )->decoder != NULL )
+		{
+			if( assorted_bzip_decoder_free(
+			     &( ( *stream )->decoder ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decoder.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *stream )->bit_stream != NULL )
+		{
+			if( assorted_bit_stream_free(
+			     &( ( *stream )->bit_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bit stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *stream )->block_data != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *stream )->block_data );
+		}
+		if( ( *stream )->input_data != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *stream )->input_data );
+		}
+		memory_free(
+		 *stream );
+
+		*stream = NULL;
+	}
+	return( result );
+}
+
+/* Reads compressed data into the input buffer
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_stream_read_input(
+     assorted_bzip_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream  = NULL;
+	static char *function              = "assorted_bzip_stream_read_input";
+	size_t move_offset                 = 0;
+	size_t move_size                   = 0;
+	size_t read_size                   = 0;
+	size_t remaining_size              = 0;
+	size_t safe_compressed_data_offset = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	remaining_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+
+	/* Move the remaining input data to the start of the buffer when the buffer
+	 * is full, since a whole block must fit. The data is moved in parts that
+	 * do not overlap
+	 */
+	if( ( bit_stream->byte_stream_offset > 0 )
+	 && ( ( remaining_size <= bit_stream->byte_stream_offset )
+	  || ( bit_stream->byte_stream_size >= stream->input_data_size ) ) )
+	{
+		move_offset = 0;
+
+		while( move_offset < remaining_size )
+		{
+			move_size = remaining_size - move_offset;
+
+			if( move_size > bit_stream->byte_stream_offset )
+			{
+				move_size = bit_stream->byte_stream_offset;
+			}
+			if( memory_copy(
+			     &( stream->input_data[ move_offset ] ),
+			     &( stream->input_data[ bit_stream->byte_stream_offset + move_offset ] ),
+			     move_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move input data.",
+				 function );
+
+				return( -1 );
+			}
+			move_offset += move_size;
+		}
+		bit_stream->byte_stream_offset = 0;
+		bit_stream->byte_stream_size   = remaining_size;
+	}
+	read_size = stream->input_data_size - bit_stream->byte_stream_size;
+
+	if( read_size > ( compressed_data_size - safe_compressed_data_offset ) )
+	{
+		read_size = compressed_data_size - safe_compressed_data_offset;
+	}
+	if( read_size > 0 )
+	{
+		if( memory_copy(
+		     &( stream->input_data[ bit_stream->byte_stream_size ] ),
+		     &( compressed_data[ safe_compressed_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy input data.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream->byte_stream_size += read_size;
+		safe_compressed_data_offset  += read_size;
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Writes the uncompressed data of the last decoded block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_stream_write_output(
+     assorted_bzip_stream_t *stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function                = "assorted_bzip_stream_write_output";
+	size_t safe_uncompressed_data_offset = 0;
+	size_t write_size                    = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	write_size = stream->block_data_end_offset - stream->output_offset;
+
+	if( write_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+	{
+		write_size = uncompressed_data_size - safe_uncompressed_data_offset;
+	}
+	if( write_size == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+	     &( stream->block_data[ stream->output_offset ] ),
+	     write_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	stream->output_offset += write_size;
+
+	*uncompressed_data_offset = safe_uncompressed_data_offset + write_size;
+
+	return( 1 );
+}
+
+/* Reads the stream header
+ * The input buffer is resized to fit the largest compressed block of the compression level
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_stream_read_stream_header(
+     assorted_bzip_stream_t *stream,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	void *reallocation                = NULL;
+	static char *function             = "assorted_bzip_stream_read_stream_header";
+	size_t input_data_size            = 0;
+	uint8_t compression_level         = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	if( assorted_bzip_read_stream_header(
+	     bit_stream->byte_stream,
+	     bit_stream->byte_stream_size,
+	     &( bit_stream->byte_stream_offset ),
+	     &compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream header.",
+		 function );
+
+		return( -1 );
+	}
+	/* The compression level defines the maximum block size in units of 100k
+	 */
+	if( assorted_bzip_decoder_resize(
+	     stream->decoder,
+	     (size_t) compression_level * 100000,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize decoder.",
+		 function );
+
+		return( -1 );
+	}
+	input_data_size = (size_t) ( ( assorted_bzip_stream_get_maximum_block_size( compression_level ) + 7 ) / 8 );
+
+	if( input_data_size > stream->input_data_size )
+	{
+		reallocation = assorted_aligned_memory_reallocate(
+		                stream->input_data,
+		                sizeof( uint8_t ) * input_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize input data.",
+			 function );
+
+			return( -1 );
+		}
+		stream->input_data      = (uint8_t *) reallocation;
+		stream->input_data_size = input_data_size;
+
+		bit_stream->byte_stream = stream->input_data;
+	}
+	stream->compression_level = compression_level;
+
+	return( 1 );
+}
+
+/* Reads a block and reverses the Burrows-Wheeler transform into the block data
+ * The signature of the block must have been read and all the data written
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_stream_read_block(
+     assorted_bzip_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *local_error      = NULL;
+	void *reallocation                  = NULL;
+	static char *function               = "assorted_bzip_stream_read_block";
+	size_t block_data_size              = 0;
+	size_t uncompressed_data_offset     = 0;
+	uint32_t calculated_block_checksum  = 0;
+	uint32_t origin_pointer             = 0;
+	uint32_t stored_block_checksum      = 0;
+	int result                          = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	stream->block_data_end_offset = 0;
+	stream->output_offset         = 0;
+
+	if( assorted_bzip_decoder_read_block(
+	     stream->decoder,
+	     stream->bit_stream,
+	     stream->signature,
+	     &origin_pointer,
+	     &stored_block_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block.",
+		 function );
+
+		return( -1 );
+	}
+	/* The run-length encoding of the block data can expand the data more than twice
+	 * in which case the exact size is determined and the block data buffer is resized
+	 */
+	if( stream->block_data == NULL )
+	{
+		block_data_size = ( stream->decoder->maximum_block_data_size * 2 ) + 1;
+
+		stream->block_data = (uint8_t *) assorted_aligned_memory_allocate(
+		                                  sizeof( uint8_t ) * block_data_size );
+
+		if( stream->block_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block data.",
+			 function );
+
+			return( -1 );
+		}
+		stream->block_data_size = block_data_size;
+	}
+	result = assorted_bzip_reverse_burrows_wheeler_transform(
+	          stream->decoder->block_data,
+	          stream->decoder->block_data_size,
+	          stream->decoder->permutations,
+	          origin_pointer,
+	          stream->block_data,
+	          stream->block_data_size,
+	          &uncompressed_data_offset,
+	          &local_error );
+
+	if( result != 1 )
+	{
+		result = libcerror_error_matches(
+		          local_error,
+		          LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		          LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE );
+
+		libcerror_error_free(
+		 &local_error );
+
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to reverse Burrows-Wheeler transform.",
+			 function );
+
+			return( -1 );
+		}
+		uncompressed_data_offset = 0;
+
+		if( assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+		     stream->decoder->block_data,
+		     stream->decoder->block_data_size,
+		     stream->decoder->permutations,
+		     origin_pointer,
+		     &calculated_block_checksum,
+		     &block_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine block data size.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = assorted_aligned_memory_reallocate(
+		                stream->block_data,
+		                sizeof( uint8_t ) * block_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize block data.",
+			 function );
+
+			return( -1 );
+		}
+		stream->block_data      = (uint8_t *) reallocation;
+		stream->block_data_size = block_data_size;
+
+		if( assorted_bzip_reverse_burrows_wheeler_transform(
+		     stream->decoder->block_data,
+		     stream->decoder->block_data_size,
+		     stream->decoder->permutations,
+		     origin_pointer,
+		     stream->block_data,
+		     stream->block_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to reverse Burrows-Wheeler transform.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	calculated_block_checksum = 0;
+
+	if( assorted_bzip_calculate_crc32(
+	     &calculated_block_checksum,
+	     stream->block_data,
+	     uncompressed_data_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate block checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_block_checksum != calculated_block_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: block checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_block_checksum,
+		 calculated_block_checksum );
+
+		return( -1 );
+	}
+	/* The stream checksum combines the checksums of the blocks
+	 */
+	stream->checksum  = ( stream->checksum << 1 ) | ( stream->checksum >> 31 );
+	stream->checksum ^= calculated_block_checksum;
+
+	stream->block_data_end_offset = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decodes the input data until the data of a block must be written,
+ * the end of the stream is reached or more input data is required
+ * A block is only decoded when all its compressed data is available
+ * Returns 1 if successful, 0 if more input data is required or -1 on error
+ */
+int assorted_bzip_stream_decode(
+     assorted_bzip_stream_t *stream,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	static char *function             = "assorted_bzip_stream_decode";
+	uint32_t stored_checksum          = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	while( stream->state != ASSORTED_BZIP_STREAM_STATE_END )
+	{
+		switch( stream->state )
+		{
+			case ASSORTED_BZIP_STREAM_STATE_STREAM_HEADER:
+				if( ( stream->input_is_final == 0 )
+				 && ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 4 ) )
+				{
+					return( 0 );
+				}
+				if( assorted_bzip_stream_read_stream_header(
+				     stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read stream header.",
+					 function );
+
+					return( -1 );
+				}
+				stream->state = ASSORTED_BZIP_STREAM_STATE_SIGNATURE;
+
+				break;
+
+			case ASSORTED_BZIP_STREAM_STATE_SIGNATURE:
+				if( ( stream->input_is_final == 0 )
+				 && ( assorted_bzip_stream_get_number_of_available_bits( bit_stream ) < 48 ) )
+				{
+					return( 0 );
+				}
+				if( assorted_bzip_read_signature(
+				     bit_stream,
+				     &( stream->signature ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read signature.",
+					 function );
+
+					return( -1 );
+				}
+				if( stream->signature == 0x314159265359UL )
+				{
+					stream->state = ASSORTED_BZIP_STREAM_STATE_BLOCK;
+				}
+				else if( stream->signature == 0x177245385090UL )
+				{
+					stream->state = ASSORTED_BZIP_STREAM_STATE_STREAM_FOOTER;
+				}
+				else
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported signature: 0x%" PRIx64 ".",
+					 function,
+					 stream->signature );
+
+					return( -1 );
+				}
+				break;
+
+			case ASSORTED_BZIP_STREAM_STATE_BLOCK:
+				/* The block data is reused hence the data of the previous block must have been written
+				 */
+				if( stream->output_offset < stream->block_data_end_offset )
+				{
+					return( 1 );
+				}
+				if( ( stream->input_is_final == 0 )
+				 && ( assorted_bzip_stream_get_number_of_available_bits( bit_stream ) < assorted_bzip_stream_get_maximum_block_size( stream->compression_level ) ) )
+				{
+					return( 0 );
+				}
+				if( assorted_bzip_stream_read_block(
+				     stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block.",
+					 function );
+
+					return( -1 );
+				}
+				stream->state = ASSORTED_BZIP_STREAM_STATE_SIGNATURE;
+
+				break;
+
+			case ASSORTED_BZIP_STREAM_STATE_STREAM_FOOTER:
+				if( ( stream->input_is_final == 0 )
+				 && ( assorted_bzip_stream_get_number_of_available_bits( bit_stream ) < 32 ) )
+				{
+					return( 0 );
+				}
+				if( assorted_bzip_read_stream_footer(
+				     bit_stream,
+				     stream->signature,
+				     &stored_checksum,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read stream footer.",
+					 function );
+
+					return( -1 );
+				}
+				if( stored_checksum != stream->checksum )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+					 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+					 function,
+					 stored_checksum,
+					 stream->checksum );
+
+					return( -1 );
+				}
+				stream->state = ASSORTED_BZIP_STREAM_STATE_END;
+
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported state.",
+				 function );
+
+				return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decompresses data using BZIP2 compression a part at a time
+ * The compressed data is consumed starting at compressed_data_offset and
+ * the offset is updated to the compressed data that has not been consumed.
+ * On input uncompressed_data_size contains the size of the uncompressed data buffer
+ * and on output the number of bytes written to it. The data of a block is made
+ * available once its CRC-32 has been verified, only the compressed and
+ * uncompressed data of a single block are kept so the memory used does not
+ * depend on the size of the compressed data.
+ * When the end of the stream is reached within compressed data the offset is
+ * set to the first byte after the end of the stream. If the call continues at
+ * the offset where the previous call with the same compressed data ended,
+ * this can precede the offset the call started at.
+ * Returns 1 if the end of the stream was reached and all data was written,
+ * 0 if more compressed data or output buffer space is required or -1 on error
+ */
+int assorted_bzip_stream_feed(
+     assorted_bzip_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_bzip_stream_feed";
+	size_t initial_compressed_offset   = 0;
+	size_t remaining_size              = 0;
+	size_t safe_compressed_data_offset = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	int result                         = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->input_is_final != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - input data already finished.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A feed that continues where the previous feed of the same compressed data
+	 * ended can return data that was read by the previous feed
+	 */
+	if( ( compressed_data != stream->feed_compressed_data )
+	 || ( safe_compressed_data_offset != stream->feed_compressed_data_end_offset ) )
+	{
+		stream->feed_compressed_data              = compressed_data;
+		stream->feed_compressed_data_start_offset = safe_compressed_data_offset;
+	}
+	initial_compressed_offset = stream->feed_compressed_data_start_offset;
+
+	while( stream->state != ASSORTED_BZIP_STREAM_STATE_END )
+	{
+		if( assorted_bzip_stream_write_output(
+		     stream,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		if( stream->output_offset < stream->block_data_end_offset )
+		{
+			break;
+		}
+		if( assorted_bzip_stream_read_input(
+		     stream,
+		     compressed_data,
+		     compressed_data_size,
+		     &safe_compressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		result = assorted_bzip_stream_decode(
+		          stream,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( safe_compressed_data_offset >= compressed_data_size ) )
+		{
+			if( assorted_bzip_stream_write_output(
+			     stream,
+			     uncompressed_data,
+			     safe_uncompressed_data_size,
+			     &uncompressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+	}
+	if( stream->state == ASSORTED_BZIP_STREAM_STATE_END )
+	{
+		if( assorted_bzip_stream_write_output(
+		     stream,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		/* Return the input data that follows the end of the stream
+		 */
+		remaining_size = ( stream->bit_stream->bit_buffer_size >> 3 )
+		               + ( stream->bit_stream->byte_stream_size - stream->bit_stream->byte_stream_offset );
+
+		if( remaining_size > ( safe_compressed_data_offset - initial_compressed_offset ) )
+		{
+			remaining_size = safe_compressed_data_offset - initial_compressed_offset;
+		}
+		safe_compressed_data_offset -= remaining_size;
+
+		stream->bit_stream->byte_stream_offset = 0;
+		stream->bit_stream->byte_stream_size   = 0;
+		stream->bit_stream->bit_buffer         = 0;
+		stream->bit_stream->bit_buffer_size    = 0;
+	}
+	stream->feed_compressed_data_end_offset = safe_compressed_data_offset;
+
+	*compressed_data_offset = safe_compressed_data_offset;
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	if( ( stream->state == ASSORTED_BZIP_STREAM_STATE_END )
+	 && ( stream->output_offset == stream->block_data_end_offset ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Finishes decompressing data after all compressed data has been provided
+ * On input uncompressed_data_size contains the size of the uncompressed data buffer
+ * and on output the number of bytes written to it
+ * Returns 1 if the end of the stream was reached and all data was written,
+ * 0 if more output buffer space is required or -1 on error
+ */
+int assorted_bzip_stream_finish(
+     assorted_bzip_stream_t *stream,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_bzip_stream_finish";
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	int result                         = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	stream->input_is_final = 1;
+
+	do
+	{
+		if( assorted_bzip_stream_write_output(
+		     stream,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		if( stream->output_offset < stream->block_data_end_offset )
+		{
+			break;
+		}
+		if( stream->state == ASSORTED_BZIP_STREAM_STATE_END )
+		{
+			break;
+		}
+		result = assorted_bzip_stream_decode(
+		          stream,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode compressed data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( 1 );
+
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	if( ( stream->state == ASSORTED_BZIP_STREAM_STATE_END )
+	 && ( stream->output_offset == stream->block_data_end_offset ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Decompresses all the compressed data and passes the uncompressed data to a sink
+ * The uncompressed data is provided to write_function in parts of at most
+ * 64 KiB, so the uncompressed data is never stored as a whole
+ * Returns 1 on success or -1 on error
+ */
+int assorted_bzip_stream_decompress(
+     assorted_bzip_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error ),
+     intptr_t *sink,
+     libcerror_error_t **error )
+{
+	uint8_t *uncompressed_data    = NULL;
+	static char *function         = "assorted_bzip_stream_decompress";
+	size_t compressed_data_offset = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write function.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_BZIP_STREAM_OUTPUT_BUFFER_SIZE );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( result == 0 )
+	{
+		uncompressed_data_size = ASSORTED_BZIP_STREAM_OUTPUT_BUFFER_SIZE;
+
+		if( compressed_data_offset < compressed_data_size )
+		{
+			result = assorted_bzip_stream_feed(
+			          stream,
+			          compressed_data,
+			          compressed_data_size,
+			          &compressed_data_offset,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          error );
+		}
+		else
+		{
+			result = assorted_bzip_stream_finish(
+			          stream,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          error );
+
+			/* Finish only requires more calls when the buffer is full
+			 */
+			if( ( result == 0 )
+			 && ( uncompressed_data_size == 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to finish stream.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+		if( uncompressed_data_size > 0 )
+		{
+			if( write_function(
+			     sink,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,178 @@
+/*
+ * BZIP2 streaming decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_BZIP_STREAM_H )
+#define _ASSORTED_BZIP_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_bit_stream.h"
+#include "assorted_bzip.h"
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The stream states
+ */
+enum ASSORTED_BZIP_STREAM_STATES
+{
+	ASSORTED_BZIP_STREAM_STATE_STREAM_HEADER	= 0x00,
+	ASSORTED_BZIP_STREAM_STATE_SIGNATURE		= 0x01,
+	ASSORTED_BZIP_STREAM_STATE_BLOCK		= 0x02,
+	ASSORTED_BZIP_STREAM_STATE_STREAM_FOOTER	= 0x03,
+	ASSORTED_BZIP_STREAM_STATE_END			= 0x04
+};
+
+typedef struct assorted_bzip_stream assorted_bzip_stream_t;
+
+struct assorted_bzip_stream
+{
+	/* The state
+	 */
+	uint8_t state;
+
+	/* Value to indicate all input data has been provided
+	 */
+	uint8_t input_is_final;
+
+	/* The compressed data of the previous feed and the offset in it at which the
+	 * stream started reading, used to return the data that follows the end of
+	 * the stream when it was read by a previous feed of the same compressed data
+	 */
+	const uint8_t *feed_compressed_data;
+
+	size_t feed_compressed_data_start_offset;
+
+	/* The compressed data offset at which the previous feed ended
+	 */
+	size_t feed_compressed_data_end_offset;
+
+	/* The compression level
+	 */
+	uint8_t compression_level;
+
+	/* The input data
+	 */
+	uint8_t *input_data;
+
+	/* The size of the input data buffer
+	 */
+	size_t input_data_size;
+
+	/* The bit stream of the input data
+	 */
+	assorted_bit_stream_t *bit_stream;
+
+	/* The decoder of the blocks
+	 */
+	assorted_bzip_decoder_t *decoder;
+
+	/* The signature of the block that is read next
+	 */
+	uint64_t signature;
+
+	/* The uncompressed data of the last decoded block
+	 */
+	uint8_t *block_data;
+
+	/* The size of the block data buffer
+	 */
+	size_t block_data_size;
+
+	/* The end offset of the uncompressed data in the block data
+	 */
+	size_t block_data_end_offset;
+
+	/* The offset of the next byte in the block data to write
+	 */
+	size_t output_offset;
+
+	/* The CRC-32 calculated from the block CRC-32 values
+	 */
+	uint32_t checksum;
+};
+
+int assorted_bzip_stream_initialize(
+     assorted_bzip_stream_t **stream,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_free(
+     assorted_bzip_stream_t **stream,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_read_input(
+     assorted_bzip_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_write_output(
+     assorted_bzip_stream_t *stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_read_stream_header(
+     assorted_bzip_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_read_block(
+     assorted_bzip_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_decode(
+     assorted_bzip_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_feed(
+     assorted_bzip_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_finish(
+     assorted_bzip_stream_t *stream,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_bzip_stream_decompress(
+     assorted_bzip_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error ),
+     intptr_t *sink,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_BZIP_STREAM_H ) */
+
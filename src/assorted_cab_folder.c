@@ -0,0 +1,489 @@
+/*
+ * Cabinet (CAB) folder decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_cab_folder.h"
+#include "assorted_deflate_stream.h"
+#include "assorted_libcerror.h"
+
+/* Determines the uncompressed size of a folder
+ * The folder data starts with the first data block (CFDATA) of the folder
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_cab_folder_get_uncompressed_size(
+     const uint8_t *folder_data,
+     size_t folder_data_size,
+     uint16_t number_of_blocks,
+     uint8_t block_reserved_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "assorted_cab_folder_get_uncompressed_size";
+	size_t block_header_size         = 0;
+	size_t folder_data_offset        = 0;
+	size_t safe_uncompressed_size    = 0;
+	uint16_t block_index             = 0;
+	uint16_t compressed_block_size   = 0;
+	uint16_t uncompressed_block_size = 0;
+
+	if( folder_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folder data.",
+		 function );
+
+		return( -1 );
+	}
+	if( folder_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid folder data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	block_header_size = ASSORTED_CAB_FOLDER_DATA_BLOCK_HEADER_SIZE + block_reserved_size;
+
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( block_header_size > ( folder_data_size - folder_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data block: %" PRIu16 " header value out of bounds.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( folder_data[ folder_data_offset + 4 ] ),
+		 compressed_block_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( folder_data[ folder_data_offset + 6 ] ),
+		 uncompressed_block_size );
+
+		folder_data_offset += block_header_size;
+
+		if( (size_t) compressed_block_size > ( folder_data_size - folder_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data block: %" PRIu16 " compressed size value out of bounds.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		/* A data block with an uncompressed size of 0 is continued in the next cabinet
+		 */
+		if( uncompressed_block_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported data block: %" PRIu16 " continued in next cabinet.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		folder_data_offset     += compressed_block_size;
+		safe_uncompressed_size += uncompressed_block_size;
+	}
+	*uncompressed_data_size = safe_uncompressed_size;
+
+	return( 1 );
+}
+
+/* Decompresses a MSZIP compressed data block
+ * A MSZIP compressed data block consists of the signature "CK" followed by a DEFLATE
+ * stream that can reference the uncompressed data of the preceding blocks of the folder.
+ * The stream retains this history in its window and is restarted for the next block.
+ * Returns 1 on success or -1 on error
+ */
+int assorted_cab_folder_decompress_mszip_block(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_cab_folder_decompress_mszip_block";
+	size_t compressed_data_offset      = 2;
+	size_t safe_uncompressed_data_size = 0;
+	int result                         = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 2 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > ASSORTED_CAB_FOLDER_MSZIP_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data[ 0 ] != (uint8_t) 'C' )
+	 || ( compressed_data[ 1 ] != (uint8_t) 'K' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported block signature.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = uncompressed_data_size;
+
+	result = assorted_deflate_stream_feed(
+	          stream,
+	          compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          &safe_uncompressed_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress block.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: invalid block - end of DEFLATE stream not found within block.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_uncompressed_data_size != uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_stream_restart(
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to restart stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses the data blocks of a folder
+ * The folder data starts with the first data block (CFDATA) of the folder
+ * The uncompressed data size must be the size determined by
+ * assorted_cab_folder_get_uncompressed_size
+ * Returns 1 on success or -1 on error
+ */
+int assorted_cab_folder_decompress(
+     const uint8_t *folder_data,
+     size_t folder_data_size,
+     uint16_t number_of_blocks,
+     uint8_t block_reserved_size,
+     uint16_t compression_type,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_stream_t *stream = NULL;
+	static char *function             = "assorted_cab_folder_decompress";
+	size_t block_header_size          = 0;
+	size_t expected_uncompressed_size = 0;
+	size_t folder_data_offset         = 0;
+	size_t uncompressed_data_offset   = 0;
+	uint16_t block_index              = 0;
+	uint16_t compressed_block_size    = 0;
+	uint16_t uncompressed_block_size  = 0;
+
+	compression_type &= 0x000f;
+
+	if( ( compression_type != ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_NONE )
+	 && ( compression_type != ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_MSZIP ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression type: %" PRIu16 ".",
+		 function,
+		 compression_type );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Validates the data blocks before any data is decompressed
+	 */
+	if( assorted_cab_folder_get_uncompressed_size(
+	     folder_data,
+	     folder_data_size,
+	     number_of_blocks,
+	     block_reserved_size,
+	     &expected_uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size != expected_uncompressed_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_type == ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_MSZIP )
+	{
+		if( assorted_deflate_stream_initialize(
+		     &stream,
+		     ASSORTED_DEFLATE_STREAM_FORMAT_DEFLATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	block_header_size = ASSORTED_CAB_FOLDER_DATA_BLOCK_HEADER_SIZE + block_reserved_size;
+
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( folder_data[ folder_data_offset + 4 ] ),
+		 compressed_block_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( folder_data[ folder_data_offset + 6 ] ),
+		 uncompressed_block_size );
+
+		folder_data_offset += block_header_size;
+
+		if( compression_type == ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_MSZIP )
+		{
+			if( assorted_cab_folder_decompress_mszip_block(
+			     stream,
+			     &( folder_data[ folder_data_offset ] ),
+			     (size_t) compressed_block_size,
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     (size_t) uncompressed_block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress data block: %" PRIu16 ".",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( compressed_block_size != uncompressed_block_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+				 "%s: mismatch in data block: %" PRIu16 " sizes.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( folder_data[ folder_data_offset ] ),
+			     (size_t) uncompressed_block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data block: %" PRIu16 ".",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		folder_data_offset       += compressed_block_size;
+		uncompressed_data_offset += uncompressed_block_size;
+	}
+	if( stream != NULL )
+	{
+		if( assorted_deflate_stream_free(
+		     &stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		assorted_deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,84 @@
+/*
+ * Cabinet (CAB) folder decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_CAB_FOLDER_H )
+#define _ASSORTED_CAB_FOLDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_deflate_stream.h"
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum uncompressed size of a MSZIP compressed data block
+ */
+#define ASSORTED_CAB_FOLDER_MSZIP_BLOCK_SIZE		32768
+
+/* The size of a data block header (CFDATA) without the reserved area
+ */
+#define ASSORTED_CAB_FOLDER_DATA_BLOCK_HEADER_SIZE	8
+
+/* The compression types, stored in the lower 4 bits of the folder compression type
+ */
+enum ASSORTED_CAB_FOLDER_COMPRESSION_TYPES
+{
+	ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_NONE	= 0x0000,
+	ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_MSZIP	= 0x0001,
+	ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_QUANTUM	= 0x0002,
+	ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_LZX	= 0x0003
+};
+
+int assorted_cab_folder_get_uncompressed_size(
+     const uint8_t *folder_data,
+     size_t folder_data_size,
+     uint16_t number_of_blocks,
+     uint8_t block_reserved_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_cab_folder_decompress_mszip_block(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_cab_folder_decompress(
+     const uint8_t *folder_data,
+     size_t folder_data_size,
+     uint16_t number_of_blocks,
+     uint8_t block_reserved_size,
+     uint16_t compression_type,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_CAB_FOLDER_H ) */
+
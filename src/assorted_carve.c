@@ -0,0 +1,1386 @@
+/*
+ * Compressed stream carving functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "assorted_bzip.h"
+#include "assorted_carve.h"
+#include "assorted_codec.h"
+#include "assorted_cpu_features.h"
+#include "assorted_deflate.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_lzma.h"
+#include "assorted_lzma_stream.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+#if defined( ASSORTED_CARVE_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_CARVE_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
+/* The initial size of the uncompressed data buffer of a candidate
+ */
+#define ASSORTED_CARVE_INITIAL_BUFFER_SIZE	( 64 * 1024 )
+
+/* Retrieves the name of a format
+ * Returns the name or NULL if the format is not supported
+ */
+const char *assorted_carve_get_format_name(
+             uint8_t format )
+{
+	switch( format )
+	{
+		case ASSORTED_CARVE_FORMAT_ZLIB:
+			return( "zlib" );
+
+		case ASSORTED_CARVE_FORMAT_GZIP:
+			return( "gzip" );
+
+		case ASSORTED_CARVE_FORMAT_BZIP2:
+			return( "bzip2" );
+
+		case ASSORTED_CARVE_FORMAT_XZ:
+			return( "xz" );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Determines the formats from a comma separated string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int assorted_carve_formats_from_string(
+     const char *string,
+     size_t string_length,
+     uint8_t *formats,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_carve_formats_from_string";
+	size_t segment_length = 0;
+	size_t string_index   = 0;
+	size_t segment_start  = 0;
+	uint8_t safe_formats  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( formats == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid formats.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != ',' ) )
+		{
+			continue;
+		}
+		segment_length = string_index - segment_start;
+
+		if( ( segment_length == 3 )
+		 && ( narrow_string_compare(
+		       &( string[ segment_start ] ),
+		       "all",
+		       3 ) == 0 ) )
+		{
+			safe_formats |= ASSORTED_CARVE_FORMAT_ALL;
+		}
+		else if( ( segment_length == 4 )
+		      && ( narrow_string_compare(
+		            &( string[ segment_start ] ),
+		            "zlib",
+		            4 ) == 0 ) )
+		{
+			safe_formats |= ASSORTED_CARVE_FORMAT_ZLIB;
+		}
+		else if( ( segment_length == 4 )
+		      && ( narrow_string_compare(
+		            &( string[ segment_start ] ),
+		            "gzip",
+		            4 ) == 0 ) )
+		{
+			safe_formats |= ASSORTED_CARVE_FORMAT_GZIP;
+		}
+		else if( ( segment_length == 5 )
+		      && ( narrow_string_compare(
+		            &( string[ segment_start ] ),
+		            "bzip2",
+		            5 ) == 0 ) )
+		{
+			safe_formats |= ASSORTED_CARVE_FORMAT_BZIP2;
+		}
+		else if( ( segment_length == 2 )
+		      && ( narrow_string_compare(
+		            &( string[ segment_start ] ),
+		            "xz",
+		            2 ) == 0 ) )
+		{
+			safe_formats |= ASSORTED_CARVE_FORMAT_XZ;
+		}
+		else
+		{
+			return( 0 );
+		}
+		segment_start = string_index + 1;
+	}
+	*formats = safe_formats;
+
+	return( 1 );
+}
+
+/* Validates the header of a compressed stream at a specific offset
+ * The validation is cheap compared to decoding and rejects most false signature matches
+ * Returns 1 if the data contains a valid header, 0 if not
+ */
+int assorted_carve_validate_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint8_t formats,
+     uint8_t *format )
+{
+	const uint8_t *header_data = NULL;
+	size_t header_data_offset  = 0;
+	size_t header_data_size    = 0;
+	size_t member_size         = 0;
+	uint8_t compression_level  = 0;
+
+	if( ( data == NULL )
+	 || ( data_offset >= data_size )
+	 || ( format == NULL ) )
+	{
+		return( 0 );
+	}
+	header_data      = &( data[ data_offset ] );
+	header_data_size = data_size - data_offset;
+
+	if( ( ( formats & ASSORTED_CARVE_FORMAT_ZLIB ) != 0 )
+	 && ( ( header_data[ 0 ] & 0x8f ) == 0x08 )
+	 && ( header_data_size >= 3 ) )
+	{
+		/* Streams that require a preset dictionary cannot be decoded and the first
+		 * deflate block after the data header cannot use the reserved block type
+		 */
+		if( ( ( ( (uint16_t) header_data[ 0 ] << 8 ) | header_data[ 1 ] ) % 31 == 0 )
+		 && ( ( header_data[ 1 ] & 0x20 ) == 0 )
+		 && ( assorted_deflate_read_data_header(
+		       header_data,
+		       header_data_size,
+		       &header_data_offset,
+		       NULL,
+		       NULL,
+		       NULL ) == 1 )
+		 && ( ( header_data[ 2 ] & 0x06 ) != 0x06 ) )
+		{
+			*format = ASSORTED_CARVE_FORMAT_ZLIB;
+
+			return( 1 );
+		}
+	}
+	else if( ( ( formats & ASSORTED_CARVE_FORMAT_GZIP ) != 0 )
+	      && ( header_data[ 0 ] == 0x1f )
+	      && ( header_data_size >= 18 ) )
+	{
+		if( assorted_deflate_read_gzip_member_header(
+		     header_data,
+		     header_data_size,
+		     &header_data_offset,
+		     &member_size,
+		     NULL ) == 1 )
+		{
+			*format = ASSORTED_CARVE_FORMAT_GZIP;
+
+			return( 1 );
+		}
+	}
+	else if( ( ( formats & ASSORTED_CARVE_FORMAT_BZIP2 ) != 0 )
+	      && ( header_data[ 0 ] == 'B' )
+	      && ( header_data_size >= 10 ) )
+	{
+		/* The stream header is followed by the block or the end of stream signature
+		 */
+		if( ( assorted_bzip_read_stream_header(
+		       header_data,
+		       header_data_size,
+		       &header_data_offset,
+		       &compression_level,
+		       NULL ) == 1 )
+		 && ( ( ( header_data[ 4 ] == 0x31 )
+		   &&   ( header_data[ 5 ] == 0x41 )
+		   &&   ( header_data[ 6 ] == 0x59 )
+		   &&   ( header_data[ 7 ] == 0x26 )
+		   &&   ( header_data[ 8 ] == 0x53 )
+		   &&   ( header_data[ 9 ] == 0x59 ) )
+		  ||  ( ( header_data[ 4 ] == 0x17 )
+		   &&   ( header_data[ 5 ] == 0x72 )
+		   &&   ( header_data[ 6 ] == 0x45 )
+		   &&   ( header_data[ 7 ] == 0x38 )
+		   &&   ( header_data[ 8 ] == 0x50 )
+		   &&   ( header_data[ 9 ] == 0x90 ) ) ) )
+		{
+			*format = ASSORTED_CARVE_FORMAT_BZIP2;
+
+			return( 1 );
+		}
+	}
+	else if( ( ( formats & ASSORTED_CARVE_FORMAT_XZ ) != 0 )
+	      && ( header_data[ 0 ] == 0xfd )
+	      && ( header_data_size >= 24 ) )
+	{
+		/* The first byte of the stream flags is reserved and only the check types
+		 * of the specification are supported
+		 */
+		if( ( assorted_lzma_read_stream_header(
+		       header_data,
+		       header_data_size,
+		       &header_data_offset,
+		       NULL ) == 1 )
+		 && ( header_data[ 6 ] == 0 )
+		 && ( ( header_data[ 7 ] == 0x00 )
+		  ||  ( header_data[ 7 ] == 0x01 )
+		  ||  ( header_data[ 7 ] == 0x04 )
+		  ||  ( header_data[ 7 ] == 0x0a ) ) )
+		{
+			*format = ASSORTED_CARVE_FORMAT_XZ;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines the offset of the first byte that can start a signature of the formats
+ * Returns the offset or the size if there is no such byte
+ */
+size_t assorted_carve_find_signature_basic(
+        const uint8_t *data,
+        size_t size,
+        uint8_t formats )
+{
+	size_t data_offset = 0;
+	uint8_t byte_value = 0;
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset++ )
+	{
+		byte_value = data[ data_offset ];
+
+		if( ( ( ( formats & ASSORTED_CARVE_FORMAT_ZLIB ) != 0 )
+		  &&  ( ( byte_value & 0x8f ) == 0x08 ) )
+		 || ( ( ( formats & ASSORTED_CARVE_FORMAT_GZIP ) != 0 )
+		  &&  ( byte_value == 0x1f ) )
+		 || ( ( ( formats & ASSORTED_CARVE_FORMAT_BZIP2 ) != 0 )
+		  &&  ( byte_value == 'B' ) )
+		 || ( ( ( formats & ASSORTED_CARVE_FORMAT_XZ ) != 0 )
+		  &&  ( byte_value == 0xfd ) ) )
+		{
+			break;
+		}
+	}
+	return( data_offset );
+}
+
+#if defined( ASSORTED_CARVE_HAVE_AVX2 )
+
+/* Determines the offset of the first byte that can start a signature of the formats using AVX2,
+ * comparing 32 bytes against all first signature bytes per iteration
+ * The size must be a multiple of 32
+ * Returns the offset or the size if there is no such byte
+ */
+__attribute__ ((target ("avx2"))) size_t assorted_carve_find_signature_avx2(
+                                          const uint8_t *data,
+                                          size_t size,
+                                          uint8_t formats )
+{
+	__m256i bzip2_signature = _mm256_set1_epi8( (char) ( ( formats & ASSORTED_CARVE_FORMAT_BZIP2 ) != 0 ? 'B' : 0x08 ) );
+	__m256i gzip_signature  = _mm256_set1_epi8( (char) ( ( formats & ASSORTED_CARVE_FORMAT_GZIP ) != 0 ? 0x1f : 0x08 ) );
+	__m256i xz_signature    = _mm256_set1_epi8( (char) ( ( formats & ASSORTED_CARVE_FORMAT_XZ ) != 0 ? 0xfd : 0x08 ) );
+	__m256i zlib_mask       = _mm256_set1_epi8( (char) ( ( formats & ASSORTED_CARVE_FORMAT_ZLIB ) != 0 ? 0x8f : 0x00 ) );
+	__m256i zlib_signature  = _mm256_set1_epi8( (char) 0x08 );
+	__m256i data_256bit;
+	__m256i matches_256bit;
+	size_t data_offset      = 0;
+	uint32_t matches_mask   = 0;
+
+	/* Formats that are not requested compare against the zlib signature,
+	 * which never matches after masking with 0 when zlib is not requested either
+	 */
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset += 32 )
+	{
+		data_256bit = _mm256_loadu_si256( (const __m256i *) &( data[ data_offset ] ) );
+
+		matches_256bit = _mm256_or_si256(
+		                  _mm256_cmpeq_epi8( _mm256_and_si256( data_256bit, zlib_mask ), zlib_signature ),
+		                  _mm256_or_si256(
+		                   _mm256_cmpeq_epi8( data_256bit, gzip_signature ),
+		                   _mm256_or_si256(
+		                    _mm256_cmpeq_epi8( data_256bit, bzip2_signature ),
+		                    _mm256_cmpeq_epi8( data_256bit, xz_signature ) ) ) );
+
+		matches_mask = (uint32_t) _mm256_movemask_epi8( matches_256bit );
+
+		if( matches_mask != 0 )
+		{
+			return( data_offset + (size_t) __builtin_ctz( matches_mask ) );
+		}
+	}
+	return( size );
+}
+
+#endif /* defined( ASSORTED_CARVE_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_CARVE_HAVE_NEON )
+
+/* Determines the offset of the first byte that can start a signature of the formats using NEON,
+ * comparing 16 bytes against all first signature bytes per iteration
+ * The size must be a multiple of 16
+ * Returns the offset or the size if there is no such byte
+ */
+size_t assorted_carve_find_signature_neon(
+        const uint8_t *data,
+        size_t size,
+        uint8_t formats )
+{
+	uint8x16_t bzip2_signature = vdupq_n_u8( ( formats & ASSORTED_CARVE_FORMAT_BZIP2 ) != 0 ? 'B' : 0x08 );
+	uint8x16_t gzip_signature  = vdupq_n_u8( ( formats & ASSORTED_CARVE_FORMAT_GZIP ) != 0 ? 0x1f : 0x08 );
+	uint8x16_t xz_signature    = vdupq_n_u8( ( formats & ASSORTED_CARVE_FORMAT_XZ ) != 0 ? 0xfd : 0x08 );
+	uint8x16_t zlib_mask       = vdupq_n_u8( ( formats & ASSORTED_CARVE_FORMAT_ZLIB ) != 0 ? 0x8f : 0x00 );
+	uint8x16_t zlib_signature  = vdupq_n_u8( 0x08 );
+	uint8x16_t data_128bit;
+	uint8x16_t matches_128bit;
+	size_t data_offset         = 0;
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset += 16 )
+	{
+		data_128bit = vld1q_u8( &( data[ data_offset ] ) );
+
+		matches_128bit = vorrq_u8(
+		                  vceqq_u8( vandq_u8( data_128bit, zlib_mask ), zlib_signature ),
+		                  vorrq_u8(
+		                   vceqq_u8( data_128bit, gzip_signature ),
+		                   vorrq_u8(
+		                    vceqq_u8( data_128bit, bzip2_signature ),
+		                    vceqq_u8( data_128bit, xz_signature ) ) ) );
+
+		if( vmaxvq_u8( matches_128bit ) != 0 )
+		{
+			return( data_offset + assorted_carve_find_signature_basic(
+			                       &( data[ data_offset ] ),
+			                       16,
+			                       formats ) );
+		}
+	}
+	return( size );
+}
+
+#endif /* defined( ASSORTED_CARVE_HAVE_NEON ) */
+
+/* Scans data for the headers of compressed streams
+ * The first bytes of the signatures of all formats are searched for at once, using
+ * the fastest SIMD kernel supported by the CPU, and every match is validated
+ * The scan starts at scan_offset, which is updated to the offset after the last
+ * byte that was scanned, so that a scan that filled the candidates can be continued
+ * Returns 1 if all data was scanned, 0 if the candidates are full or -1 on error
+ */
+int assorted_carve_scan(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t formats,
+     size_t *scan_offset,
+     assorted_carve_candidate_t *candidates,
+     size_t maximum_number_of_candidates,
+     size_t *number_of_candidates,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_carve_scan";
+	size_t data_offset                 = 0;
+	size_t safe_number_of_candidates   = 0;
+	size_t search_size                 = 0;
+	uint8_t format                     = 0;
+
+#if defined( ASSORTED_CARVE_HAVE_AVX2 ) || defined( ASSORTED_CARVE_HAVE_NEON )
+	size_t block_size                  = 0;
+	uint32_t cpu_features              = 0;
+	int simd_method                    = ASSORTED_CARVE_SIMD_METHOD_NONE;
+#endif
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( candidates == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidates.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_candidates == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of candidates value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_candidates == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of candidates.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_candidates = 0;
+
+	data_offset = *scan_offset;
+
+#if defined( ASSORTED_CARVE_HAVE_AVX2 ) || defined( ASSORTED_CARVE_HAVE_NEON )
+	cpu_features = assorted_cpu_features_get();
+
+#if defined( ASSORTED_CARVE_HAVE_AVX2 )
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		block_size  = 32;
+		simd_method = ASSORTED_CARVE_SIMD_METHOD_AVX2;
+	}
+#elif defined( ASSORTED_CARVE_HAVE_NEON )
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_NEON ) != 0 )
+	{
+		block_size  = 16;
+		simd_method = ASSORTED_CARVE_SIMD_METHOD_NEON;
+	}
+#endif
+#endif /* defined( ASSORTED_CARVE_HAVE_AVX2 ) || defined( ASSORTED_CARVE_HAVE_NEON ) */
+
+	while( data_offset < data_size )
+	{
+		search_size = data_size - data_offset;
+
+#if defined( ASSORTED_CARVE_HAVE_AVX2 ) || defined( ASSORTED_CARVE_HAVE_NEON )
+		if( ( simd_method != ASSORTED_CARVE_SIMD_METHOD_NONE )
+		 && ( search_size >= block_size ) )
+		{
+			search_size &= ~( block_size - 1 );
+
+#if defined( ASSORTED_CARVE_HAVE_AVX2 )
+			search_size = assorted_carve_find_signature_avx2(
+			               &( data[ data_offset ] ),
+			               search_size,
+			               formats );
+#elif defined( ASSORTED_CARVE_HAVE_NEON )
+			search_size = assorted_carve_find_signature_neon(
+			               &( data[ data_offset ] ),
+			               search_size,
+			               formats );
+#endif
+		}
+		else
+#endif
+		{
+			search_size = assorted_carve_find_signature_basic(
+			               &( data[ data_offset ] ),
+			               search_size,
+			               formats );
+		}
+		data_offset += search_size;
+
+		if( data_offset >= data_size )
+		{
+			break;
+		}
+		/* Without a match in the SIMD blocks the search continues at the tail
+		 */
+		if( assorted_carve_validate_header(
+		     data,
+		     data_size,
+		     data_offset,
+		     formats,
+		     &format ) == 1 )
+		{
+			if( memory_set(
+			     &( candidates[ safe_number_of_candidates ] ),
+			     0,
+			     sizeof( assorted_carve_candidate_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear candidate.",
+				 function );
+
+				return( -1 );
+			}
+			candidates[ safe_number_of_candidates ].offset = data_offset;
+			candidates[ safe_number_of_candidates ].format = format;
+
+			safe_number_of_candidates++;
+		}
+		data_offset++;
+
+		if( safe_number_of_candidates >= maximum_number_of_candidates )
+		{
+			break;
+		}
+	}
+	*scan_offset          = data_offset;
+	*number_of_candidates = safe_number_of_candidates;
+
+	if( data_offset < data_size )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Resizes the uncompressed data of a candidate to at least a specific size
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_carve_sink_resize(
+     assorted_carve_sink_t *sink,
+     size_t required_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocated_data = NULL;
+	static char *function     = "assorted_carve_sink_resize";
+	size_t allocated_size     = 0;
+
+	if( sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sink.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_size <= sink->allocated_size )
+	{
+		return( 1 );
+	}
+	if( required_size > sink->maximum_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	allocated_size = sink->allocated_size;
+
+	if( allocated_size == 0 )
+	{
+		allocated_size = ASSORTED_CARVE_INITIAL_BUFFER_SIZE;
+	}
+	while( allocated_size < required_size )
+	{
+		if( allocated_size > ( sink->maximum_size / 2 ) )
+		{
+			allocated_size = sink->maximum_size;
+
+			break;
+		}
+		allocated_size *= 2;
+	}
+	if( allocated_size > sink->maximum_size )
+	{
+		allocated_size = sink->maximum_size;
+	}
+	reallocated_data = (uint8_t *) memory_reallocate(
+	                                sink->candidate->uncompressed_data,
+	                                sizeof( uint8_t ) * allocated_size );
+
+	if( reallocated_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	sink->candidate->uncompressed_data = reallocated_data;
+	sink->allocated_size               = allocated_size;
+
+	return( 1 );
+}
+
+/* Appends uncompressed data to a candidate, used as the LZMA stream write function
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_carve_sink_write(
+     intptr_t *sink,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	assorted_carve_sink_t *carve_sink = NULL;
+	static char *function             = "assorted_carve_sink_write";
+
+	if( sink == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sink.",
+		 function );
+
+		return( -1 );
+	}
+	carve_sink = (assorted_carve_sink_t *) sink;
+
+	if( data_size > ( carve_sink->maximum_size - carve_sink->candidate->uncompressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_carve_sink_resize(
+	     carve_sink,
+	     carve_sink->candidate->uncompressed_data_size + data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( carve_sink->candidate->uncompressed_data[ carve_sink->candidate->uncompressed_data_size ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	carve_sink->candidate->uncompressed_data_size += data_size;
+
+	return( 1 );
+}
+
+/* Decodes the compressed stream of a candidate using the streaming decoder of its codec
+ * The stream can be followed by other data, the compressed data size of the candidate
+ * is set to the size of the stream if the decoder reached the end of the stream
+ * before consuming all data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_carve_candidate_decode_stream(
+     assorted_carve_candidate_t *candidate,
+     assorted_carve_sink_t *sink,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	const assorted_codec_t *codec = NULL;
+	const char *format_name       = NULL;
+	intptr_t *stream              = NULL;
+	static char *function         = "assorted_carve_candidate_decode_stream";
+	size_t compressed_data_offset = 0;
+	size_t write_size             = 0;
+	uint8_t input_is_final        = 0;
+	int result                    = 0;
+
+	format_name = assorted_carve_get_format_name(
+	               candidate->format );
+
+	if( format_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format: 0x%02" PRIx8 ".",
+		 function,
+		 candidate->format );
+
+		goto on_error;
+	}
+	if( assorted_codec_get_codec_by_name(
+	     format_name,
+	     narrow_string_length( format_name ),
+	     &codec,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codec: %s.",
+		 function,
+		 format_name );
+
+		goto on_error;
+	}
+	if( ( codec->stream_initialize == NULL )
+	 || ( codec->stream_free == NULL )
+	 || ( codec->stream_feed == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid codec: %s - missing stream functions.",
+		 function,
+		 format_name );
+
+		goto on_error;
+	}
+	if( codec->stream_initialize(
+	     &stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	while( result == 0 )
+	{
+		if( candidate->uncompressed_data_size == sink->allocated_size )
+		{
+			if( assorted_carve_sink_resize(
+			     sink,
+			     candidate->uncompressed_data_size + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		write_size = sink->allocated_size - candidate->uncompressed_data_size;
+
+		if( input_is_final == 0 )
+		{
+			result = codec->stream_feed(
+			          stream,
+			          compressed_data,
+			          compressed_data_size,
+			          &compressed_data_offset,
+			          &( candidate->uncompressed_data[ candidate->uncompressed_data_size ] ),
+			          &write_size,
+			          error );
+		}
+		else
+		{
+			result = codec->stream_finish(
+			          stream,
+			          &( candidate->uncompressed_data[ candidate->uncompressed_data_size ] ),
+			          &write_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress %s stream.",
+			 function,
+			 format_name );
+
+			goto on_error;
+		}
+		candidate->uncompressed_data_size += write_size;
+
+		/* A decoder that buffers compressed data, such as bzip2, can require all
+		 * remaining data to be consumed before the end of the stream is reached,
+		 * in which case the size of the stream is not known
+		 */
+		if( ( result == 0 )
+		 && ( input_is_final == 0 )
+		 && ( candidate->uncompressed_data_size < sink->allocated_size )
+		 && ( compressed_data_offset >= compressed_data_size ) )
+		{
+			if( codec->stream_finish == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: truncated %s stream.",
+				 function,
+				 format_name );
+
+				goto on_error;
+			}
+			input_is_final = 1;
+		}
+	}
+
+	if( codec->stream_free(
+	     &stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( input_is_final == 0 )
+	{
+		candidate->compressed_data_size = compressed_data_offset;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		codec->stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes the compressed stream of a candidate
+ * The uncompressed data of the candidate is allocated and must be freed with
+ * assorted_carve_candidate_clear
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_carve_candidate_decode(
+     assorted_carve_candidate_t *candidate,
+     const uint8_t *data,
+     size_t data_size,
+     size_t maximum_uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_carve_sink_t sink;
+
+	assorted_lzma_stream_t *lzma_stream = NULL;
+	static char *function               = "assorted_carve_candidate_decode";
+
+	if( candidate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidate.",
+		 function );
+
+		return( -1 );
+	}
+	if( candidate->uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid candidate - uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( candidate->offset >= data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_uncompressed_data_size == 0 )
+	 || ( maximum_uncompressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sink.candidate      = candidate;
+	sink.allocated_size = 0;
+	sink.maximum_size   = maximum_uncompressed_data_size;
+
+	candidate->compressed_data_size   = 0;
+	candidate->uncompressed_data_size = 0;
+
+	if( candidate->format == ASSORTED_CARVE_FORMAT_XZ )
+	{
+		/* The LZMA stream does not report the size of the stream
+		 */
+		if( assorted_lzma_stream_initialize(
+		     &lzma_stream,
+		     &assorted_carve_sink_write,
+		     (intptr_t *) &sink,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create LZMA stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_lzma_stream_decompress(
+		     lzma_stream,
+		     &( data[ candidate->offset ] ),
+		     data_size - candidate->offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress xz stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_lzma_stream_free(
+		     &lzma_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free LZMA stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( assorted_carve_candidate_decode_stream(
+	          candidate,
+	          &sink,
+	          &( data[ candidate->offset ] ),
+	          data_size - candidate->offset,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decode stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( lzma_stream != NULL )
+	{
+		assorted_lzma_stream_free(
+		 &lzma_stream,
+		 NULL );
+	}
+	if( candidate->uncompressed_data != NULL )
+	{
+		memory_free(
+		 candidate->uncompressed_data );
+
+		candidate->uncompressed_data = NULL;
+	}
+	candidate->uncompressed_data_size = 0;
+
+	return( -1 );
+}
+
+/* Frees the uncompressed data of a candidate
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_carve_candidate_clear(
+     assorted_carve_candidate_t *candidate,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_carve_candidate_clear";
+
+	if( candidate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidate.",
+		 function );
+
+		return( -1 );
+	}
+	if( candidate->uncompressed_data != NULL )
+	{
+		memory_free(
+		 candidate->uncompressed_data );
+
+		candidate->uncompressed_data = NULL;
+	}
+	candidate->uncompressed_data_size = 0;
+	candidate->result                 = 0;
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decodes the candidate of a task from a thread pool
+ * The error is not available from the worker thread, the result is stored in the candidate
+ * Returns 1 on success or -1 on error
+ */
+int assorted_carve_decode_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_carve_task_t *task = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	task = (assorted_carve_task_t *) value;
+
+	task->candidate->result = assorted_carve_candidate_decode(
+	                           task->candidate,
+	                           task->data,
+	                           task->data_size,
+	                           task->maximum_uncompressed_data_size,
+	                           NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decodes the compressed streams of candidates with the candidates decoded in parallel
+ * Every candidate is a separate thread pool task since the streams vary widely in size
+ * The result of every candidate is stored in the candidate, a candidate that failed
+ * can be decoded again with assorted_carve_candidate_decode to retrieve the error
+ * Returns 1 if all candidates were decoded, 0 if not or -1 on error
+ */
+int assorted_carve_decode_candidates(
+     assorted_carve_candidate_t *candidates,
+     size_t number_of_candidates,
+     const uint8_t *data,
+     size_t data_size,
+     size_t maximum_uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function                  = "assorted_carve_decode_candidates";
+	size_t candidate_index                 = 0;
+	int result                             = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_carve_task_t *tasks           = NULL;
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+	if( candidates == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidates.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_candidates > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of candidates value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( candidate_index = 0;
+	     candidate_index < number_of_candidates;
+	     candidate_index++ )
+	{
+		candidates[ candidate_index ].result = 0;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_candidates > 1 ) )
+	{
+		tasks = (assorted_carve_task_t *) memory_allocate(
+		                                   sizeof( assorted_carve_task_t ) * number_of_candidates );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			goto on_error;
+		}
+		for( candidate_index = 0;
+		     candidate_index < number_of_candidates;
+		     candidate_index++ )
+		{
+			tasks[ candidate_index ].data                           = data;
+			tasks[ candidate_index ].data_size                      = data_size;
+			tasks[ candidate_index ].maximum_uncompressed_data_size = maximum_uncompressed_data_size;
+			tasks[ candidate_index ].candidate                      = &( candidates[ candidate_index ] );
+		}
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_candidates )
+		{
+			maximum_number_of_values = (int) number_of_candidates;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &assorted_carve_decode_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( candidate_index = 0;
+		     candidate_index < number_of_candidates;
+		     candidate_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ candidate_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %" PRIzd " onto thread pool queue.",
+				 function,
+				 candidate_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 tasks );
+
+		tasks = NULL;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the candidates are decoded here
+	 */
+	for( candidate_index = 0;
+	     candidate_index < number_of_candidates;
+	     candidate_index++ )
+	{
+		if( candidates[ candidate_index ].result == 0 )
+		{
+			candidates[ candidate_index ].result = assorted_carve_candidate_decode(
+			                                        &( candidates[ candidate_index ] ),
+			                                        data,
+			                                        data_size,
+			                                        maximum_uncompressed_data_size,
+			                                        NULL );
+		}
+		if( candidates[ candidate_index ].result != 1 )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( tasks != NULL )
+	{
+		memory_free(
+		 tasks );
+	}
+	return( -1 );
+#endif
+}
+
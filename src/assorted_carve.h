@@ -0,0 +1,229 @@
+/*
+ * Compressed stream carving functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_CARVE_H )
+#define _ASSORTED_CARVE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SIMD signature scan is available with GCC compatible compilers on x86
+ * and on little-endian ARMv8, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __clang__ ) || ( __GNUC__ >= 5 ) )
+#define ASSORTED_CARVE_HAVE_AVX2
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ )
+#define ASSORTED_CARVE_HAVE_NEON
+
+#endif
+
+enum ASSORTED_CARVE_FORMATS
+{
+	ASSORTED_CARVE_FORMAT_ZLIB	= 0x01,
+	ASSORTED_CARVE_FORMAT_GZIP	= 0x02,
+	ASSORTED_CARVE_FORMAT_BZIP2	= 0x04,
+	ASSORTED_CARVE_FORMAT_XZ	= 0x08,
+
+	ASSORTED_CARVE_FORMAT_ALL	= 0x0f
+};
+
+enum ASSORTED_CARVE_SIMD_METHODS
+{
+	ASSORTED_CARVE_SIMD_METHOD_NONE	= 0x00,
+	ASSORTED_CARVE_SIMD_METHOD_AVX2	= 0x01,
+	ASSORTED_CARVE_SIMD_METHOD_NEON	= 0x02
+};
+
+typedef struct assorted_carve_candidate assorted_carve_candidate_t;
+
+struct assorted_carve_candidate
+{
+	/* The offset of the stream relative to the start of the data
+	 */
+	size_t offset;
+
+	/* The format
+	 */
+	uint8_t format;
+
+	/* The size of the compressed stream, 0 if not known
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the decoding, 0 if not decoded
+	 */
+	int result;
+};
+
+typedef struct assorted_carve_task assorted_carve_task_t;
+
+struct assorted_carve_task
+{
+	/* The data the candidates were found in
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The maximum uncompressed data size of a stream
+	 */
+	size_t maximum_uncompressed_data_size;
+
+	/* The candidate
+	 */
+	assorted_carve_candidate_t *candidate;
+};
+
+typedef struct assorted_carve_sink assorted_carve_sink_t;
+
+struct assorted_carve_sink
+{
+	/* The candidate the uncompressed data is appended to
+	 */
+	assorted_carve_candidate_t *candidate;
+
+	/* The allocated size of the uncompressed data
+	 */
+	size_t allocated_size;
+
+	/* The maximum uncompressed data size
+	 */
+	size_t maximum_size;
+};
+
+const char *assorted_carve_get_format_name(
+             uint8_t format );
+
+int assorted_carve_formats_from_string(
+     const char *string,
+     size_t string_length,
+     uint8_t *formats,
+     libcerror_error_t **error );
+
+int assorted_carve_validate_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint8_t formats,
+     uint8_t *format );
+
+size_t assorted_carve_find_signature_basic(
+        const uint8_t *data,
+        size_t size,
+        uint8_t formats );
+
+#if defined( ASSORTED_CARVE_HAVE_AVX2 )
+
+size_t assorted_carve_find_signature_avx2(
+        const uint8_t *data,
+        size_t size,
+        uint8_t formats );
+
+#endif /* defined( ASSORTED_CARVE_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_CARVE_HAVE_NEON )
+
+size_t assorted_carve_find_signature_neon(
+        const uint8_t *data,
+        size_t size,
+        uint8_t formats );
+
+#endif /* defined( ASSORTED_CARVE_HAVE_NEON ) */
+
+int assorted_carve_scan(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t formats,
+     size_t *scan_offset,
+     assorted_carve_candidate_t *candidates,
+     size_t maximum_number_of_candidates,
+     size_t *number_of_candidates,
+     libcerror_error_t **error );
+
+int assorted_carve_sink_resize(
+     assorted_carve_sink_t *sink,
+     size_t required_size,
+     libcerror_error_t **error );
+
+int assorted_carve_sink_write(
+     intptr_t *sink,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int assorted_carve_candidate_decode_stream(
+     assorted_carve_candidate_t *candidate,
+     assorted_carve_sink_t *sink,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_carve_candidate_decode(
+     assorted_carve_candidate_t *candidate,
+     const uint8_t *data,
+     size_t data_size,
+     size_t maximum_uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_carve_candidate_clear(
+     assorted_carve_candidate_t *candidate,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_carve_decode_task_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_carve_decode_candidates(
+     assorted_carve_candidate_t *candidates,
+     size_t number_of_candidates,
+     const uint8_t *data,
+     size_t data_size,
+     size_t maximum_uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_CARVE_H ) */
+
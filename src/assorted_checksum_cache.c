@@ -0,0 +1,1176 @@
+/*
+ * Checksum cache functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "assorted_checksum_cache.h"
+#include "assorted_libcerror.h"
+
+/* The checksum cache file is a fixed size hash table, that consists of:
+ * a 32-byte header:
+ *   signature "chkcache", format version, number of entries and entry size
+ * followed by the entries of 96 bytes:
+ *   offset  0: the key (72 bytes)
+ *   offset 72: the entry flags
+ *   offset 80: the checksum
+ *   offset 88: the FNV-1a hash of the first 88 bytes of the entry
+ *
+ * An entry is written in-place under an exclusive file lock, while entries
+ * are read without a lock from a shared memory mapping. An entry that is read
+ * while being written does not match its hash and is ignored.
+ */
+const uint8_t assorted_checksum_cache_signature[ 8 ] = { 'c', 'h', 'k', 'c', 'a', 'c', 'h', 'e' };
+
+#define ASSORTED_CHECKSUM_CACHE_FORMAT_VERSION	1
+#define ASSORTED_CHECKSUM_CACHE_KEY_SIZE	72
+#define ASSORTED_CHECKSUM_CACHE_ENTRY_IN_USE	0x00000001UL
+
+/* Creates a checksum cache
+ * Make sure the value checksum_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_checksum_cache_initialize(
+     assorted_checksum_cache_t **checksum_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_checksum_cache_initialize";
+
+	if( checksum_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checksum_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checksum cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum_cache = memory_allocate_structure(
+	                   assorted_checksum_cache_t );
+
+	if( *checksum_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checksum cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *checksum_cache,
+	     0,
+	     sizeof( assorted_checksum_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checksum cache.",
+		 function );
+
+		memory_free(
+		 *checksum_cache );
+
+		*checksum_cache = NULL;
+
+		return( -1 );
+	}
+	( *checksum_cache )->file_descriptor = -1;
+
+	return( 1 );
+}
+
+/* Frees a checksum cache
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_checksum_cache_free(
+     assorted_checksum_cache_t **checksum_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_checksum_cache_free";
+	int result            = 1;
+
+	if( checksum_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checksum_cache != NULL )
+	{
+		if( assorted_checksum_cache_close(
+		     *checksum_cache,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close checksum cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *checksum_cache );
+
+		*checksum_cache = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the 64-bit FNV-1a hash of data
+ * Returns the hash
+ */
+uint64_t assorted_checksum_cache_hash(
+          const uint8_t *data,
+          size_t data_size )
+{
+	uint64_t hash       = 0xcbf29ce484222325ULL;
+	size_t data_offset  = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		hash ^= data[ data_offset ];
+		hash *= 0x00000100000001b3ULL;
+	}
+	return( hash );
+}
+
+/* Writes a key to the first 72 bytes of entry data
+ */
+void assorted_checksum_cache_key_write(
+      const assorted_checksum_cache_key_t *key,
+      uint8_t *entry_data )
+{
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 0 ] ),
+	 key->device_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 8 ] ),
+	 key->file_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 16 ] ),
+	 key->file_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 24 ] ),
+	 (uint64_t) key->modification_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 32 ] ),
+	 key->offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 40 ] ),
+	 key->size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 48 ] ),
+	 key->initial_value );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 56 ] ),
+	 key->parameters );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 64 ] ),
+	 key->method );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 68 ] ),
+	 key->flags );
+}
+
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+
+/* Creates a new checksum cache file
+ * The file is created under a temporary name and then linked to the filename,
+ * so that a concurrent open never sees a partially initialized file.
+ * If another process created the file first, its file is used.
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_checksum_cache_create_file(
+     const char *filename,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ ASSORTED_CHECKSUM_CACHE_HEADER_SIZE ];
+
+	static char *function     = "assorted_checksum_cache_create_file";
+	char *temporary_filename  = NULL;
+	size_t filename_length    = 0;
+	off_t file_size           = 0;
+	int file_descriptor       = -1;
+	int is_created            = 0;
+
+	filename_length = narrow_string_length(
+	                   filename );
+
+	temporary_filename = narrow_string_allocate(
+	                      filename_length + 8 );
+
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     temporary_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( temporary_filename[ filename_length ] ),
+	     ".XXXXXX",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	file_descriptor = mkstemp(
+	                   temporary_filename );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	is_created = 1;
+
+	if( memory_set(
+	     header_data,
+	     0,
+	     ASSORTED_CHECKSUM_CACHE_HEADER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     header_data,
+	     assorted_checksum_cache_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 8 ] ),
+	 ASSORTED_CHECKSUM_CACHE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 12 ] ),
+	 ASSORTED_CHECKSUM_CACHE_DEFAULT_NUMBER_OF_ENTRIES );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header_data[ 16 ] ),
+	 ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE );
+
+	if( write(
+	     file_descriptor,
+	     header_data,
+	     ASSORTED_CHECKSUM_CACHE_HEADER_SIZE ) != (ssize_t) ASSORTED_CHECKSUM_CACHE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The entries are not written, the file is extended with zero bytes
+	 * which most file systems store sparse
+	 */
+	file_size = (off_t) ASSORTED_CHECKSUM_CACHE_HEADER_SIZE
+	          + ( (off_t) ASSORTED_CHECKSUM_CACHE_DEFAULT_NUMBER_OF_ENTRIES * ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE );
+
+	if( ftruncate(
+	     file_descriptor,
+	     file_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to resize temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsync(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		file_descriptor = -1;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	file_descriptor = -1;
+
+	/* Unlike rename, link does not replace a file that was created in the meantime
+	 */
+	if( link(
+	     temporary_filename,
+	     filename ) != 0 )
+	{
+		if( errno != EEXIST )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to link temporary file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	unlink(
+	 temporary_filename );
+
+	memory_free(
+	 temporary_filename );
+
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( temporary_filename != NULL )
+	{
+		if( is_created != 0 )
+		{
+			unlink(
+			 temporary_filename );
+		}
+		memory_free(
+		 temporary_filename );
+	}
+	return( -1 );
+}
+
+#endif /* defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE ) */
+
+/* Opens a checksum cache file, the file is created if it does not exist
+ * Returns 1 if successful, 0 if the checksum cache is not supported or -1 on error
+ */
+int assorted_checksum_cache_open(
+     assorted_checksum_cache_t *checksum_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+	struct stat file_statistics;
+
+	void *mapping              = NULL;
+	uint32_t entry_size        = 0;
+	uint32_t format_version    = 0;
+	uint32_t number_of_entries = 0;
+#endif
+	static char *function      = "assorted_checksum_cache_open";
+
+	if( checksum_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_cache->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checksum cache - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+	return( 0 );
+#else
+	checksum_cache->file_descriptor = open(
+	                                   (const char *) filename,
+	                                   O_RDWR );
+
+	if( ( checksum_cache->file_descriptor == -1 )
+	 && ( errno == ENOENT ) )
+	{
+		if( assorted_checksum_cache_create_file(
+		     (const char *) filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to create checksum cache file.",
+			 function );
+
+			goto on_error;
+		}
+		checksum_cache->file_descriptor = open(
+		                                   (const char *) filename,
+		                                   O_RDWR );
+	}
+	if( checksum_cache->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checksum cache file.",
+		 function );
+
+		goto on_error;
+	}
+	if( fstat(
+	     checksum_cache->file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checksum cache file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_statistics.st_size < (off_t) ASSORTED_CHECKSUM_CACHE_HEADER_SIZE )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checksum cache file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	checksum_cache->data_size = (size_t) file_statistics.st_size;
+
+	/* The mapping is shared so that entries stored by other processes are visible
+	 */
+	mapping = mmap(
+	           NULL,
+	           checksum_cache->data_size,
+	           PROT_READ,
+	           MAP_SHARED,
+	           checksum_cache->file_descriptor,
+	           0 );
+
+	if( mapping == MAP_FAILED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to map checksum cache file.",
+		 function );
+
+		goto on_error;
+	}
+	checksum_cache->data = (const uint8_t *) mapping;
+
+	if( memory_compare(
+	     checksum_cache->data,
+	     assorted_checksum_cache_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported checksum cache file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( checksum_cache->data[ 8 ] ),
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( checksum_cache->data[ 12 ] ),
+	 number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( checksum_cache->data[ 16 ] ),
+	 entry_size );
+
+	if( ( format_version != ASSORTED_CHECKSUM_CACHE_FORMAT_VERSION )
+	 || ( entry_size != ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum cache file format version.",
+		 function );
+
+		goto on_error;
+	}
+	/* The number of entries must be a power of 2
+	 */
+	if( ( number_of_entries < ASSORTED_CHECKSUM_CACHE_NUMBER_OF_PROBES )
+	 || ( ( number_of_entries & ( number_of_entries - 1 ) ) != 0 )
+	 || ( (size64_t) number_of_entries > ( ( (size64_t) checksum_cache->data_size - ASSORTED_CHECKSUM_CACHE_HEADER_SIZE ) / ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	checksum_cache->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	assorted_checksum_cache_close(
+	 checksum_cache,
+	 NULL );
+
+	return( -1 );
+
+#endif /* !defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE ) */
+}
+
+/* Closes a checksum cache
+ * Returns 0 if successful or -1 on error
+ */
+int assorted_checksum_cache_close(
+     assorted_checksum_cache_t *checksum_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_checksum_cache_close";
+	int result            = 0;
+
+	if( checksum_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+	if( checksum_cache->data != NULL )
+	{
+		if( munmap(
+		     (void *) checksum_cache->data,
+		     checksum_cache->data_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap checksum cache file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( checksum_cache->file_descriptor != -1 )
+	{
+		if( close(
+		     checksum_cache->file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close checksum cache file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	checksum_cache->data              = NULL;
+	checksum_cache->data_size         = 0;
+	checksum_cache->number_of_entries = 0;
+	checksum_cache->file_descriptor   = -1;
+
+	return( result );
+}
+
+/* Sets the identity of the file in a key, that is the device and file identifier,
+ * the file size and the modification time
+ * Returns 1 if successful, 0 if the checksum cache is not supported or -1 on error
+ */
+int assorted_checksum_cache_key_set_file_identity(
+     assorted_checksum_cache_key_t *key,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+	struct stat file_statistics;
+#endif
+
+	static char *function = "assorted_checksum_cache_key_set_file_identity";
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+	return( 0 );
+#else
+	if( stat(
+	     (const char *) filename,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	key->device_identifier = (uint64_t) file_statistics.st_dev;
+	key->file_identifier   = (uint64_t) file_statistics.st_ino;
+	key->file_size         = (uint64_t) file_statistics.st_size;
+	key->modification_time = (int64_t) file_statistics.st_mtime * 1000000000;
+
+#if defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	key->modification_time += (int64_t) file_statistics.st_mtim.tv_nsec;
+#endif
+	return( 1 );
+
+#endif /* !defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE ) */
+}
+
+/* Retrieves a cached checksum
+ * The identity of the file is set in the key before the lookup
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int assorted_checksum_cache_get_checksum(
+     assorted_checksum_cache_t *checksum_cache,
+     const system_character_t *filename,
+     assorted_checksum_cache_key_t *key,
+     uint64_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ ASSORTED_CHECKSUM_CACHE_KEY_SIZE ];
+
+	const uint8_t *entry_data = NULL;
+	static char *function     = "assorted_checksum_cache_get_checksum";
+	uint64_t entry_hash       = 0;
+	uint64_t hash             = 0;
+	uint32_t entry_flags      = 0;
+	uint32_t entry_index      = 0;
+	uint32_t probe_index      = 0;
+	int result                = 0;
+
+	if( checksum_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	result = assorted_checksum_cache_key_set_file_identity(
+	          key,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file identity in key.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( checksum_cache->data == NULL ) )
+	{
+		return( 0 );
+	}
+	assorted_checksum_cache_key_write(
+	 key,
+	 key_data );
+
+	hash = assorted_checksum_cache_hash(
+	        key_data,
+	        ASSORTED_CHECKSUM_CACHE_KEY_SIZE );
+
+	for( probe_index = 0;
+	     probe_index < ASSORTED_CHECKSUM_CACHE_NUMBER_OF_PROBES;
+	     probe_index++ )
+	{
+		entry_index = ( (uint32_t) hash + probe_index ) & ( checksum_cache->number_of_entries - 1 );
+		entry_data  = &( checksum_cache->data[ ASSORTED_CHECKSUM_CACHE_HEADER_SIZE + ( (size_t) entry_index * ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 72 ] ),
+		 entry_flags );
+
+		if( ( entry_flags & ASSORTED_CHECKSUM_CACHE_ENTRY_IN_USE ) == 0 )
+		{
+			continue;
+		}
+		if( memory_compare(
+		     entry_data,
+		     key_data,
+		     ASSORTED_CHECKSUM_CACHE_KEY_SIZE ) != 0 )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( entry_data[ 88 ] ),
+		 entry_hash );
+
+		/* An entry that does not match its hash is being written or is corrupted
+		 */
+		if( entry_hash != assorted_checksum_cache_hash(
+		                   entry_data,
+		                   88 ) )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( entry_data[ 80 ] ),
+		 *checksum );
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Stores a checksum in the cache
+ * The checksum is only stored if the identity of the file did not change since
+ * it was set in the key and the file was not modified too recently
+ * Returns 1 if successful, 0 if not stored or -1 on error
+ */
+int assorted_checksum_cache_set_checksum(
+     assorted_checksum_cache_t *checksum_cache,
+     const system_character_t *filename,
+     const assorted_checksum_cache_key_t *key,
+     uint64_t checksum,
+     libcerror_error_t **error )
+{
+	uint8_t entry_data[ ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE ];
+
+	assorted_checksum_cache_key_t current_key;
+
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+	struct flock file_lock;
+
+	const uint8_t *probe_data = NULL;
+	uint32_t entry_flags      = 0;
+	uint32_t entry_index      = 0;
+	uint32_t probe_index      = 0;
+	uint32_t selected_index   = 0;
+	uint8_t is_locked         = 0;
+#endif
+	static char *function     = "assorted_checksum_cache_set_checksum";
+	uint64_t hash             = 0;
+	int result                = 0;
+
+	if( checksum_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &current_key,
+	     key,
+	     sizeof( assorted_checksum_cache_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		return( -1 );
+	}
+	result = assorted_checksum_cache_key_set_file_identity(
+	          &current_key,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file identity in key.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( checksum_cache->data == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( current_key.device_identifier != key->device_identifier )
+	 || ( current_key.file_identifier != key->file_identifier )
+	 || ( current_key.file_size != key->file_size )
+	 || ( current_key.modification_time != key->modification_time ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_TIME_H )
+	if( ( key->modification_time / 1000000000 ) > ( (int64_t) time( NULL ) - ASSORTED_CHECKSUM_CACHE_MINIMUM_AGE ) )
+	{
+		return( 0 );
+	}
+#endif
+	if( memory_set(
+	     entry_data,
+	     0,
+	     ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry data.",
+		 function );
+
+		return( -1 );
+	}
+	assorted_checksum_cache_key_write(
+	 key,
+	 entry_data );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 72 ] ),
+	 ASSORTED_CHECKSUM_CACHE_ENTRY_IN_USE );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 80 ] ),
+	 checksum );
+
+	hash = assorted_checksum_cache_hash(
+	        entry_data,
+	        88 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entry_data[ 88 ] ),
+	 hash );
+
+	hash = assorted_checksum_cache_hash(
+	        entry_data,
+	        ASSORTED_CHECKSUM_CACHE_KEY_SIZE );
+
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+	/* The lock serializes the selection and writing of an entry between processes
+	 */
+	file_lock.l_type   = F_WRLCK;
+	file_lock.l_whence = SEEK_SET;
+	file_lock.l_start  = 0;
+	file_lock.l_len    = 0;
+
+	if( fcntl(
+	     checksum_cache->file_descriptor,
+	     F_SETLKW,
+	     &file_lock ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to lock checksum cache file.",
+		 function );
+
+		goto on_error;
+	}
+	is_locked = 1;
+
+	/* An entry with the same key or an unused entry is reused,
+	 * otherwise the first probed entry is replaced
+	 */
+	selected_index = (uint32_t) hash & ( checksum_cache->number_of_entries - 1 );
+
+	for( probe_index = 0;
+	     probe_index < ASSORTED_CHECKSUM_CACHE_NUMBER_OF_PROBES;
+	     probe_index++ )
+	{
+		entry_index = ( (uint32_t) hash + probe_index ) & ( checksum_cache->number_of_entries - 1 );
+		probe_data  = &( checksum_cache->data[ ASSORTED_CHECKSUM_CACHE_HEADER_SIZE + ( (size_t) entry_index * ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( probe_data[ 72 ] ),
+		 entry_flags );
+
+		if( ( ( entry_flags & ASSORTED_CHECKSUM_CACHE_ENTRY_IN_USE ) == 0 )
+		 || ( memory_compare(
+		       probe_data,
+		       entry_data,
+		       ASSORTED_CHECKSUM_CACHE_KEY_SIZE ) == 0 ) )
+		{
+			selected_index = entry_index;
+
+			break;
+		}
+	}
+	if( pwrite(
+	     checksum_cache->file_descriptor,
+	     entry_data,
+	     ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE,
+	     (off_t) ASSORTED_CHECKSUM_CACHE_HEADER_SIZE + ( (off_t) selected_index * ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE ) ) != (ssize_t) ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry.",
+		 function );
+
+		goto on_error;
+	}
+	file_lock.l_type = F_UNLCK;
+
+	if( fcntl(
+	     checksum_cache->file_descriptor,
+	     F_SETLK,
+	     &file_lock ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to unlock checksum cache file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( is_locked != 0 )
+	{
+		file_lock.l_type = F_UNLCK;
+
+		fcntl(
+		 checksum_cache->file_descriptor,
+		 F_SETLK,
+		 &file_lock );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE ) */
+}
+
@@ -0,0 +1,190 @@
+/*
+ * Checksum cache functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_CHECKSUM_CACHE_H )
+#define _ASSORTED_CHECKSUM_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The checksum cache is supported on POSIX systems with mmap and fcntl
+ * that use narrow system strings
+ */
+#if !defined( WINAPI ) && defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_FCNTL_H ) && defined( HAVE_SYS_STAT_H ) \
+ && defined( HAVE_FCNTL ) && defined( HAVE_FSYNC ) && defined( HAVE_LINK ) && defined( HAVE_MKSTEMP ) && defined( HAVE_PWRITE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define ASSORTED_CHECKSUM_CACHE_HAVE_CACHE	1
+#endif
+
+/* The number of entries of a new checksum cache file
+ */
+#define ASSORTED_CHECKSUM_CACHE_DEFAULT_NUMBER_OF_ENTRIES	65536
+
+/* The number of entries that are probed for a key
+ */
+#define ASSORTED_CHECKSUM_CACHE_NUMBER_OF_PROBES		8
+
+/* The size of the checksum cache file header and entries
+ */
+#define ASSORTED_CHECKSUM_CACHE_HEADER_SIZE			32
+#define ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE			96
+
+/* The number of seconds a file must be unmodified before its checksum is stored,
+ * to prevent a modification within the modification time granularity to go unnoticed
+ */
+#define ASSORTED_CHECKSUM_CACHE_MINIMUM_AGE			2
+
+enum ASSORTED_CHECKSUM_CACHE_METHODS
+{
+	ASSORTED_CHECKSUM_CACHE_METHOD_ADLER32	= 1,
+	ASSORTED_CHECKSUM_CACHE_METHOD_CRC32	= 2,
+	ASSORTED_CHECKSUM_CACHE_METHOD_CRC64	= 3
+};
+
+typedef struct assorted_checksum_cache_key assorted_checksum_cache_key_t;
+
+struct assorted_checksum_cache_key
+{
+	/* The identifier of the device that contains the file
+	 */
+	uint64_t device_identifier;
+
+	/* The file identifier, such as the inode number
+	 */
+	uint64_t file_identifier;
+
+	/* The file size
+	 */
+	uint64_t file_size;
+
+	/* The modification time in nanoseconds since January 1, 1970
+	 */
+	int64_t modification_time;
+
+	/* The offset of the data of which the checksum is calculated
+	 */
+	uint64_t offset;
+
+	/* The size of the data of which the checksum is calculated
+	 */
+	uint64_t size;
+
+	/* The initial value
+	 */
+	uint64_t initial_value;
+
+	/* The method specific parameters, such as the polynomial
+	 */
+	uint64_t parameters;
+
+	/* The checksum method
+	 */
+	uint32_t method;
+
+	/* The method specific flags, such as weak CRC and the calculation method
+	 */
+	uint32_t flags;
+};
+
+typedef struct assorted_checksum_cache assorted_checksum_cache_t;
+
+struct assorted_checksum_cache
+{
+	/* The mapped cache file data
+	 */
+	const uint8_t *data;
+
+	/* The size of the mapped cache file data
+	 */
+	size_t data_size;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+};
+
+int assorted_checksum_cache_initialize(
+     assorted_checksum_cache_t **checksum_cache,
+     libcerror_error_t **error );
+
+int assorted_checksum_cache_free(
+     assorted_checksum_cache_t **checksum_cache,
+     libcerror_error_t **error );
+
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+
+int assorted_checksum_cache_create_file(
+     const char *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE ) */
+
+int assorted_checksum_cache_open(
+     assorted_checksum_cache_t *checksum_cache,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int assorted_checksum_cache_close(
+     assorted_checksum_cache_t *checksum_cache,
+     libcerror_error_t **error );
+
+int assorted_checksum_cache_key_set_file_identity(
+     assorted_checksum_cache_key_t *key,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+void assorted_checksum_cache_key_write(
+      const assorted_checksum_cache_key_t *key,
+      uint8_t *entry_data );
+
+uint64_t assorted_checksum_cache_hash(
+          const uint8_t *data,
+          size_t data_size );
+
+int assorted_checksum_cache_get_checksum(
+     assorted_checksum_cache_t *checksum_cache,
+     const system_character_t *filename,
+     assorted_checksum_cache_key_t *key,
+     uint64_t *checksum,
+     libcerror_error_t **error );
+
+int assorted_checksum_cache_set_checksum(
+     assorted_checksum_cache_t *checksum_cache,
+     const system_character_t *filename,
+     const assorted_checksum_cache_key_t *key,
+     uint64_t checksum,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_CHECKSUM_CACHE_H ) */
+
@@ -0,0 +1,1353 @@
+/*
+ * Codec registry functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "assorted_ascii7.h"
+#include "assorted_bzip.h"
+#include "assorted_bzip_stream.h"
+#include "assorted_codec.h"
+#include "assorted_deflate.h"
+#include "assorted_deflate_stream.h"
+#include "assorted_libcerror.h"
+#include "assorted_libfmos.h"
+#include "assorted_libfwnt.h"
+#include "assorted_lzfu.h"
+#include "assorted_lzma.h"
+#include "assorted_mssearch.h"
+#include "assorted_unused.h"
+
+/* Estimates the uncompressed data size of a codec that cannot determine it
+ * Returns 0 since the size is an estimate or -1 on error
+ */
+static int assorted_codec_get_default_output_size_hint(
+            const uint8_t *compressed_data ASSORTED_ATTRIBUTE_UNUSED,
+            size_t compressed_data_size,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_get_default_output_size_hint";
+
+	ASSORTED_UNREFERENCED_PARAMETER( compressed_data )
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > ( (size_t) SSIZE_MAX / 8 ) )
+	{
+		*uncompressed_data_size = (size_t) SSIZE_MAX;
+	}
+	else
+	{
+		*uncompressed_data_size = compressed_data_size * 8;
+	}
+	if( *uncompressed_data_size < ASSORTED_CODEC_MINIMUM_OUTPUT_SIZE_HINT )
+	{
+		*uncompressed_data_size = ASSORTED_CODEC_MINIMUM_OUTPUT_SIZE_HINT;
+	}
+	return( 0 );
+}
+
+/* Determines if the data starts with a zlib data header
+ * Returns 1 if the data starts with the signature, 0 if not or -1 on error
+ */
+static int assorted_codec_zlib_probe(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_zlib_probe";
+	uint16_t data_header  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 2 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 compressed_data,
+	 data_header );
+
+	/* The compression method must be deflate with a window size of at most 32 KiB,
+	 * no preset dictionary and a valid header check value
+	 */
+	if( ( ( compressed_data[ 0 ] & 0x0f ) != 8 )
+	 || ( ( compressed_data[ 0 ] >> 4 ) > 7 )
+	 || ( ( compressed_data[ 1 ] & 0x20 ) != 0 )
+	 || ( ( data_header % 31 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the data starts with a gzip member header
+ * Returns 1 if the data starts with the signature, 0 if not or -1 on error
+ */
+static int assorted_codec_gzip_probe(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_gzip_probe";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 3 )
+	 || ( compressed_data[ 0 ] != 0x1f )
+	 || ( compressed_data[ 1 ] != 0x8b )
+	 || ( compressed_data[ 2 ] != 0x08 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Estimates the uncompressed data size from the size in the gzip member footer
+ * Returns 0 since the size is an estimate or -1 on error
+ */
+static int assorted_codec_gzip_get_output_size_hint(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_gzip_get_output_size_hint";
+	uint32_t member_size  = 0;
+
+	if( assorted_codec_get_default_output_size_hint(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data_size,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine default output size hint.",
+		 function );
+
+		return( -1 );
+	}
+	/* The last 4 bytes contain the uncompressed size of the last member modulo 2^32
+	 */
+	if( ( compressed_data != NULL )
+	 && ( compressed_data_size >= 18 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_size - 4 ] ),
+		 member_size );
+
+		if( (size_t) member_size > *uncompressed_data_size )
+		{
+			*uncompressed_data_size = (size_t) member_size;
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if the data starts with a bzip2 stream header
+ * Returns 1 if the data starts with the signature, 0 if not or -1 on error
+ */
+static int assorted_codec_bzip_probe(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_bzip_probe";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 4 )
+	 || ( compressed_data[ 0 ] != 'B' )
+	 || ( compressed_data[ 1 ] != 'Z' )
+	 || ( compressed_data[ 2 ] != 'h' )
+	 || ( compressed_data[ 3 ] < '1' )
+	 || ( compressed_data[ 3 ] > '9' ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the data starts with a xz stream header
+ * Returns 1 if the data starts with the signature, 0 if not or -1 on error
+ */
+static int assorted_codec_xz_probe(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_xz_probe";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 6 )
+	 || ( compressed_data[ 0 ] != 0xfd )
+	 || ( compressed_data[ 1 ] != '7' )
+	 || ( compressed_data[ 2 ] != 'z' )
+	 || ( compressed_data[ 3 ] != 'X' )
+	 || ( compressed_data[ 4 ] != 'Z' )
+	 || ( compressed_data[ 5 ] != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the uncompressed data size from the xz stream index
+ * Returns 1 since the size is an upper bound or -1 on error
+ */
+static int assorted_codec_xz_get_output_size_hint(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function                = "assorted_codec_xz_get_output_size_hint";
+	uint64_t safe_uncompressed_data_size = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzma_get_uncompressed_data_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_uncompressed_data_size > (uint64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = (size_t) safe_uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Determines if the data starts with a LZFu header
+ * Returns 1 if the data starts with the signature, 0 if not or -1 on error
+ */
+static int assorted_codec_lzfu_probe(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_lzfu_probe";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 16 )
+	{
+		return( 0 );
+	}
+	if( ( ( compressed_data[ 8 ] == 'L' )
+	  &&  ( compressed_data[ 9 ] == 'Z' )
+	  &&  ( compressed_data[ 10 ] == 'F' )
+	  &&  ( compressed_data[ 11 ] == 'u' ) )
+	 || ( ( compressed_data[ 8 ] == 'M' )
+	  &&  ( compressed_data[ 9 ] == 'E' )
+	  &&  ( compressed_data[ 10 ] == 'L' )
+	  &&  ( compressed_data[ 11 ] == 'A' ) ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines the uncompressed data size from the LZFu header
+ * Returns 1 since the size is an upper bound or -1 on error
+ */
+static int assorted_codec_lzfu_get_output_size_hint(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_lzfu_get_output_size_hint";
+
+	if( assorted_lzfu_get_uncompressed_data_size(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the uncompressed data size of 7-bit ASCII compressed data
+ * Returns 1 since the size is an upper bound or -1 on error
+ */
+static int assorted_codec_ascii7_get_output_size_hint(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_ascii7_get_output_size_hint";
+
+	if( assorted_ascii7_get_uncompressed_data_size(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses raw deflate compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_deflate_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( assorted_deflate_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         NULL,
+	         error ) );
+}
+
+/* Determines the uncompressed data size of MS Search byte-indexed compressed data
+ * Returns 1 since the size is an upper bound or -1 on error
+ */
+static int assorted_codec_mssearch_byte_index_get_output_size_hint(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_mssearch_byte_index_get_output_size_hint";
+
+	if( assorted_mssearch_get_byte_index_uncompressed_data_size(
+	     (uint8_t *) compressed_data,
+	     compressed_data_size,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses MS Search byte-indexed compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_mssearch_byte_index_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_mssearch_byte_index_decompress";
+
+	if( assorted_mssearch_decompress_byte_indexed(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress byte-indexed compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the uncompressed data size of a MS Search run-length compressed UTF-16 string
+ * Returns 1 since the size is an upper bound or -1 on error
+ */
+static int assorted_codec_mssearch_run_length_get_output_size_hint(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_mssearch_run_length_get_output_size_hint";
+
+	if( assorted_mssearch_get_run_length_uncompressed_utf16_string_size(
+	     (uint8_t *) compressed_data,
+	     compressed_data_size,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses a MS Search run-length compressed UTF-16 string
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_mssearch_run_length_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function                  = "assorted_codec_mssearch_run_length_decompress";
+	size_t required_uncompressed_data_size = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_mssearch_get_run_length_uncompressed_utf16_string_size(
+	     (uint8_t *) compressed_data,
+	     compressed_data_size,
+	     &required_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_uncompressed_data_size > *uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_mssearch_decompress_run_length_compressed_utf16_string(
+	     uncompressed_data,
+	     required_uncompressed_data_size,
+	     (uint8_t *) compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress run-length compressed UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = required_uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Decompresses LZNT1 compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_lznt1_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( libfwnt_lznt1_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Decompresses LZX compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_lzx_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( libfwnt_lzx_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Decompresses LZXPRESS compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_lzxpress_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( libfwnt_lzxpress_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Decompresses LZXPRESS Huffman compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_lzxpress_huffman_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( libfwnt_lzxpress_huffman_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Decompresses ADC compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_adc_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( libfmos_adc_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Determines if the data starts with a LZFSE block header
+ * Returns 1 if the data starts with the signature, 0 if not or -1 on error
+ */
+static int assorted_codec_lzfse_probe(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_lzfse_probe";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 4 )
+	 || ( compressed_data[ 0 ] != 'b' )
+	 || ( compressed_data[ 1 ] != 'v' )
+	 || ( compressed_data[ 2 ] != 'x' ) )
+	{
+		return( 0 );
+	}
+	if( ( compressed_data[ 3 ] != '-' )
+	 && ( compressed_data[ 3 ] != '1' )
+	 && ( compressed_data[ 3 ] != '2' )
+	 && ( compressed_data[ 3 ] != 'n' ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Decompresses LZFSE compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_lzfse_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( libfmos_lzfse_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Decompresses LZVN compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int assorted_codec_lzvn_decompress(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( libfmos_lzvn_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Creates a raw deflate stream
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_codec_deflate_stream_initialize(
+            intptr_t **stream,
+            libcerror_error_t **error )
+{
+	return( assorted_deflate_stream_initialize(
+	         (assorted_deflate_stream_t **) stream,
+	         ASSORTED_DEFLATE_STREAM_FORMAT_DEFLATE,
+	         error ) );
+}
+
+/* Creates a zlib stream
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_codec_zlib_stream_initialize(
+            intptr_t **stream,
+            libcerror_error_t **error )
+{
+	return( assorted_deflate_stream_initialize(
+	         (assorted_deflate_stream_t **) stream,
+	         ASSORTED_DEFLATE_STREAM_FORMAT_ZLIB,
+	         error ) );
+}
+
+/* Creates a gzip stream
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_codec_gzip_stream_initialize(
+            intptr_t **stream,
+            libcerror_error_t **error )
+{
+	return( assorted_deflate_stream_initialize(
+	         (assorted_deflate_stream_t **) stream,
+	         ASSORTED_DEFLATE_STREAM_FORMAT_GZIP,
+	         error ) );
+}
+
+/* Frees a deflate stream
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_codec_deflate_stream_free(
+            intptr_t **stream,
+            libcerror_error_t **error )
+{
+	return( assorted_deflate_stream_free(
+	         (assorted_deflate_stream_t **) stream,
+	         error ) );
+}
+
+/* Feeds compressed data to a deflate stream
+ * Returns 1 if the end of the stream was reached, 0 if more data is needed or -1 on error
+ */
+static int assorted_codec_deflate_stream_feed(
+            intptr_t *stream,
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *compressed_data_offset,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( assorted_deflate_stream_feed(
+	         (assorted_deflate_stream_t *) stream,
+	         compressed_data,
+	         compressed_data_size,
+	         compressed_data_offset,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Finishes a deflate stream
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_codec_deflate_stream_finish(
+            intptr_t *stream,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( assorted_deflate_stream_finish(
+	         (assorted_deflate_stream_t *) stream,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Creates a bzip2 stream
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_codec_bzip_stream_initialize(
+            intptr_t **stream,
+            libcerror_error_t **error )
+{
+	return( assorted_bzip_stream_initialize(
+	         (assorted_bzip_stream_t **) stream,
+	         error ) );
+}
+
+/* Frees a bzip2 stream
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_codec_bzip_stream_free(
+            intptr_t **stream,
+            libcerror_error_t **error )
+{
+	return( assorted_bzip_stream_free(
+	         (assorted_bzip_stream_t **) stream,
+	         error ) );
+}
+
+/* Feeds compressed data to a bzip2 stream
+ * Returns 1 if the end of the stream was reached, 0 if more data is needed or -1 on error
+ */
+static int assorted_codec_bzip_stream_feed(
+            intptr_t *stream,
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *compressed_data_offset,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( assorted_bzip_stream_feed(
+	         (assorted_bzip_stream_t *) stream,
+	         compressed_data,
+	         compressed_data_size,
+	         compressed_data_offset,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Finishes a bzip2 stream
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_codec_bzip_stream_finish(
+            intptr_t *stream,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	return( assorted_bzip_stream_finish(
+	         (assorted_bzip_stream_t *) stream,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* The registered codecs
+ * Codecs with a stronger signature are probed before codecs with a weaker one
+ */
+static const assorted_codec_t assorted_codec_codecs[] = {
+	{ "gzip", "gzip (RFC 1952)", 0,
+	  &assorted_codec_gzip_probe,
+	  &assorted_codec_gzip_get_output_size_hint,
+	  &assorted_deflate_decompress_gzip,
+	  &assorted_codec_gzip_stream_initialize,
+	  &assorted_codec_deflate_stream_free,
+	  &assorted_codec_deflate_stream_feed,
+	  &assorted_codec_deflate_stream_finish },
+
+	{ "bzip2", "bzip2", 0,
+	  &assorted_codec_bzip_probe,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_bzip_decompress,
+	  &assorted_codec_bzip_stream_initialize,
+	  &assorted_codec_bzip_stream_free,
+	  &assorted_codec_bzip_stream_feed,
+	  &assorted_codec_bzip_stream_finish },
+
+	{ "xz", "xz (LZMA2)", 0,
+	  &assorted_codec_xz_probe,
+	  &assorted_codec_xz_get_output_size_hint,
+	  &assorted_lzma_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "lzfse", "LZFSE", ASSORTED_CODEC_FLAG_EXTERNAL,
+	  &assorted_codec_lzfse_probe,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_codec_lzfse_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "lzfu", "LZFu (compressed RTF)", 0,
+	  &assorted_codec_lzfu_probe,
+	  &assorted_codec_lzfu_get_output_size_hint,
+	  &assorted_lzfu_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "zlib", "zlib (RFC 1950)", 0,
+	  &assorted_codec_zlib_probe,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_deflate_decompress_zlib,
+	  &assorted_codec_zlib_stream_initialize,
+	  &assorted_codec_deflate_stream_free,
+	  &assorted_codec_deflate_stream_feed,
+	  &assorted_codec_deflate_stream_finish },
+
+	{ "deflate", "Raw deflate (RFC 1951)", 0,
+	  NULL,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_codec_deflate_decompress,
+	  &assorted_codec_deflate_stream_initialize,
+	  &assorted_codec_deflate_stream_free,
+	  &assorted_codec_deflate_stream_feed,
+	  &assorted_codec_deflate_stream_finish },
+
+	{ "ascii7", "7-bit ASCII", 0,
+	  NULL,
+	  &assorted_codec_ascii7_get_output_size_hint,
+	  &assorted_ascii7_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "mssearch_byte_index", "MS Search byte-indexed", 0,
+	  NULL,
+	  &assorted_codec_mssearch_byte_index_get_output_size_hint,
+	  &assorted_codec_mssearch_byte_index_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "mssearch_run_length", "MS Search run-length UTF-16", 0,
+	  NULL,
+	  &assorted_codec_mssearch_run_length_get_output_size_hint,
+	  &assorted_codec_mssearch_run_length_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "lznt1", "LZNT1", ASSORTED_CODEC_FLAG_EXTERNAL,
+	  NULL,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_codec_lznt1_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "lzx", "LZX", ASSORTED_CODEC_FLAG_EXTERNAL,
+	  NULL,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_codec_lzx_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "lzxpress", "LZXPRESS", ASSORTED_CODEC_FLAG_EXTERNAL,
+	  NULL,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_codec_lzxpress_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "lzxpress_huffman", "LZXPRESS Huffman", ASSORTED_CODEC_FLAG_EXTERNAL,
+	  NULL,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_codec_lzxpress_huffman_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "adc", "Apple Data Compression (ADC)", ASSORTED_CODEC_FLAG_EXTERNAL,
+	  NULL,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_codec_adc_decompress,
+	  NULL, NULL, NULL, NULL },
+
+	{ "lzvn", "LZVN", ASSORTED_CODEC_FLAG_EXTERNAL,
+	  NULL,
+	  &assorted_codec_get_default_output_size_hint,
+	  &assorted_codec_lzvn_decompress,
+	  NULL, NULL, NULL, NULL } };
+
+#define ASSORTED_CODEC_NUMBER_OF_CODECS \
+	(int) ( sizeof( assorted_codec_codecs ) / sizeof( assorted_codec_t ) )
+
+/* Retrieves the number of registered codecs
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_codec_get_number_of_codecs(
+     int *number_of_codecs,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_get_number_of_codecs";
+
+	if( number_of_codecs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of codecs.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_codecs = ASSORTED_CODEC_NUMBER_OF_CODECS;
+
+	return( 1 );
+}
+
+/* Retrieves a specific registered codec
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_codec_get_codec_by_index(
+     int codec_index,
+     const assorted_codec_t **codec,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_get_codec_by_index";
+
+	if( ( codec_index < 0 )
+	 || ( codec_index >= ASSORTED_CODEC_NUMBER_OF_CODECS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid codec index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( codec == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codec.",
+		 function );
+
+		return( -1 );
+	}
+	*codec = &( assorted_codec_codecs[ codec_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the registered codec with a specific name
+ * Returns 1 if successful, 0 if no such codec or -1 on error
+ */
+int assorted_codec_get_codec_by_name(
+     const char *name,
+     size_t name_length,
+     const assorted_codec_t **codec,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_get_codec_by_name";
+	int codec_index       = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( codec == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codec.",
+		 function );
+
+		return( -1 );
+	}
+	for( codec_index = 0;
+	     codec_index < ASSORTED_CODEC_NUMBER_OF_CODECS;
+	     codec_index++ )
+	{
+		if( ( narrow_string_length( assorted_codec_codecs[ codec_index ].name ) == name_length )
+		 && ( narrow_string_compare(
+		       assorted_codec_codecs[ codec_index ].name,
+		       name,
+		       name_length ) == 0 ) )
+		{
+			*codec = &( assorted_codec_codecs[ codec_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines the codec of compressed data from its signature
+ * Codecs without a signature are never detected
+ * Returns 1 if successful, 0 if no codec was detected or -1 on error
+ */
+int assorted_codec_probe(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const assorted_codec_t **codec,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_probe";
+	int codec_index       = 0;
+	int result            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( codec == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codec.",
+		 function );
+
+		return( -1 );
+	}
+	for( codec_index = 0;
+	     codec_index < ASSORTED_CODEC_NUMBER_OF_CODECS;
+	     codec_index++ )
+	{
+		if( assorted_codec_codecs[ codec_index ].probe == NULL )
+		{
+			continue;
+		}
+		result = assorted_codec_codecs[ codec_index ].probe(
+		          compressed_data,
+		          compressed_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe codec: %s.",
+			 function,
+			 assorted_codec_codecs[ codec_index ].name );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*codec = &( assorted_codec_codecs[ codec_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the size of the buffer to decompress data into
+ * Returns 1 if the size is an upper bound, 0 if it is an estimate or -1 on error
+ */
+int assorted_codec_get_output_size_hint(
+     const assorted_codec_t *codec,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_get_output_size_hint";
+	int result            = 0;
+
+	if( codec == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codec.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( codec->get_output_size_hint == NULL )
+	{
+		result = assorted_codec_get_default_output_size_hint(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data_size,
+		          error );
+	}
+	else
+	{
+		result = codec->get_output_size_hint(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine output size hint of codec: %s.",
+		 function,
+		 codec->name );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Decompresses data using a specific codec
+ * Returns 1 on success or -1 on error
+ */
+int assorted_codec_decompress(
+     const assorted_codec_t *codec,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_codec_decompress";
+
+	if( codec == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codec.",
+		 function );
+
+		return( -1 );
+	}
+	if( codec->decompress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid codec - missing decompress function.",
+		 function );
+
+		return( -1 );
+	}
+	if( codec->decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data using codec: %s.",
+		 function,
+		 codec->name );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
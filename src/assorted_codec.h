@@ -0,0 +1,159 @@
+/*
+ * Codec registry functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_CODEC_H )
+#define _ASSORTED_CODEC_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum output size hint of codecs that cannot determine the uncompressed data size
+ */
+#define ASSORTED_CODEC_MINIMUM_OUTPUT_SIZE_HINT		( 64 * 1024 )
+
+/* The codec flags
+ */
+enum ASSORTED_CODEC_FLAGS
+{
+	/* The codec is implemented by an external library
+	 */
+	ASSORTED_CODEC_FLAG_EXTERNAL	= 0x01
+};
+
+typedef struct assorted_codec assorted_codec_t;
+
+struct assorted_codec
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The description
+	 */
+	const char *description;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The probe function, NULL if the format has no signature
+	 * Returns 1 if the data starts with the format signature, 0 if not or -1 on error
+	 */
+	int (*probe)(
+	       const uint8_t *compressed_data,
+	       size_t compressed_data_size,
+	       libcerror_error_t **error );
+
+	/* The output size hint function
+	 * Returns 1 if the size is an upper bound, 0 if it is an estimate or -1 on error
+	 */
+	int (*get_output_size_hint)(
+	       const uint8_t *compressed_data,
+	       size_t compressed_data_size,
+	       size_t *uncompressed_data_size,
+	       libcerror_error_t **error );
+
+	/* The decompress function
+	 * Returns 1 on success or -1 on error
+	 */
+	int (*decompress)(
+	       const uint8_t *compressed_data,
+	       size_t compressed_data_size,
+	       uint8_t *uncompressed_data,
+	       size_t *uncompressed_data_size,
+	       libcerror_error_t **error );
+
+	/* The streaming functions, NULL if the codec does not support streaming
+	 * The feed and finish functions follow assorted_deflate_stream_feed and
+	 * assorted_deflate_stream_finish
+	 */
+	int (*stream_initialize)(
+	       intptr_t **stream,
+	       libcerror_error_t **error );
+
+	int (*stream_free)(
+	       intptr_t **stream,
+	       libcerror_error_t **error );
+
+	int (*stream_feed)(
+	       intptr_t *stream,
+	       const uint8_t *compressed_data,
+	       size_t compressed_data_size,
+	       size_t *compressed_data_offset,
+	       uint8_t *uncompressed_data,
+	       size_t *uncompressed_data_size,
+	       libcerror_error_t **error );
+
+	int (*stream_finish)(
+	       intptr_t *stream,
+	       uint8_t *uncompressed_data,
+	       size_t *uncompressed_data_size,
+	       libcerror_error_t **error );
+};
+
+int assorted_codec_get_number_of_codecs(
+     int *number_of_codecs,
+     libcerror_error_t **error );
+
+int assorted_codec_get_codec_by_index(
+     int codec_index,
+     const assorted_codec_t **codec,
+     libcerror_error_t **error );
+
+int assorted_codec_get_codec_by_name(
+     const char *name,
+     size_t name_length,
+     const assorted_codec_t **codec,
+     libcerror_error_t **error );
+
+int assorted_codec_probe(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const assorted_codec_t **codec,
+     libcerror_error_t **error );
+
+int assorted_codec_get_output_size_hint(
+     const assorted_codec_t *codec,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_codec_decompress(
+     const assorted_codec_t *codec,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_CODEC_H ) */
+
@@ -0,0 +1,183 @@
+/*
+ * CPU feature functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#if defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __linux__ )
+#include <sys/auxv.h>
+
+#if !defined( HWCAP_ASIMD )
+#define HWCAP_ASIMD	( 1 << 1 )
+#endif
+
+#if !defined( HWCAP_PMULL )
+#define HWCAP_PMULL	( 1 << 4 )
+#endif
+
+#endif
+
+#include "assorted_cpu_features.h"
+
+/* The detected CPU features
+ */
+static uint32_t assorted_cpu_features_detected = 0;
+
+/* Value to indicate the CPU features were detected
+ */
+static int assorted_cpu_features_are_detected = 0;
+
+/* The mask applied to the detected CPU features
+ */
+static uint32_t assorted_cpu_features_mask = ASSORTED_CPU_FEATURE_ALL;
+
+/* The lock that serializes the detection of the CPU features
+ */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( WINAPI ) && ( WINVER >= 0x0600 )
+static SRWLOCK assorted_cpu_features_lock = SRWLOCK_INIT;
+
+#define assorted_cpu_features_lock_grab() \
+	AcquireSRWLockExclusive( &assorted_cpu_features_lock )
+
+#define assorted_cpu_features_lock_release() \
+	ReleaseSRWLockExclusive( &assorted_cpu_features_lock )
+
+#elif defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+static pthread_mutex_t assorted_cpu_features_lock = PTHREAD_MUTEX_INITIALIZER;
+
+#define assorted_cpu_features_lock_grab() \
+	pthread_mutex_lock( &assorted_cpu_features_lock )
+
+#define assorted_cpu_features_lock_release() \
+	pthread_mutex_unlock( &assorted_cpu_features_lock )
+
+#else
+#define assorted_cpu_features_lock_grab()
+#define assorted_cpu_features_lock_release()
+
+#endif
+
+/* Detects the features of the CPU
+ * Returns the CPU features
+ */
+static uint32_t assorted_cpu_features_detect(
+                 void )
+{
+	uint32_t cpu_features = 0;
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "sse2" ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_SSE2;
+	}
+	if( __builtin_cpu_supports( "ssse3" ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_SSSE3;
+	}
+	if( __builtin_cpu_supports( "sse4.1" ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_SSE4_1;
+	}
+	if( __builtin_cpu_supports( "sse4.2" ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_SSE4_2;
+	}
+	if( __builtin_cpu_supports( "pclmul" ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_PCLMUL;
+	}
+	if( __builtin_cpu_supports( "avx2" ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_AVX2;
+	}
+	if( __builtin_cpu_supports( "avx512f" ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_AVX512F;
+	}
+#if defined( __clang__ ) || ( __GNUC__ >= 9 )
+	if( __builtin_cpu_supports( "vpclmulqdq" ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_VPCLMUL;
+	}
+#endif
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __linux__ )
+	unsigned long hardware_capabilities = getauxval( AT_HWCAP );
+
+	if( ( hardware_capabilities & HWCAP_ASIMD ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_NEON;
+	}
+	if( ( hardware_capabilities & HWCAP_PMULL ) != 0 )
+	{
+		cpu_features |= ASSORTED_CPU_FEATURE_PMULL;
+	}
+#elif defined( __aarch64__ )
+	/* NEON is part of the ARMv8 base architecture
+	 */
+	cpu_features |= ASSORTED_CPU_FEATURE_NEON;
+#endif
+	return( cpu_features );
+}
+
+/* Retrieves the features of the CPU
+ * The features are detected once and are masked by the features mask
+ * Returns the CPU features
+ */
+uint32_t assorted_cpu_features_get(
+          void )
+{
+	uint32_t cpu_features = 0;
+
+	assorted_cpu_features_lock_grab();
+
+	if( assorted_cpu_features_are_detected == 0 )
+	{
+		assorted_cpu_features_detected = assorted_cpu_features_detect();
+
+		assorted_cpu_features_are_detected = 1;
+	}
+	cpu_features = assorted_cpu_features_detected & assorted_cpu_features_mask;
+
+	assorted_cpu_features_lock_release();
+
+	return( cpu_features );
+}
+
+/* Sets the mask applied to the detected CPU features
+ * This allows to benchmark the kernels for a subset of the CPU features,
+ * ASSORTED_CPU_FEATURE_ALL enables all and 0 only the portable kernels
+ */
+void assorted_cpu_features_set_mask(
+      uint32_t features_mask )
+{
+	assorted_cpu_features_lock_grab();
+
+	assorted_cpu_features_mask = features_mask;
+
+	assorted_cpu_features_lock_release();
+}
+
@@ -0,0 +1,61 @@
+/*
+ * CPU feature functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_CPU_FEATURES_H )
+#define _ASSORTED_CPU_FEATURES_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum ASSORTED_CPU_FEATURES
+{
+	ASSORTED_CPU_FEATURE_SSE2		= 0x00000001UL,
+	ASSORTED_CPU_FEATURE_SSSE3		= 0x00000002UL,
+	ASSORTED_CPU_FEATURE_SSE4_1		= 0x00000004UL,
+	ASSORTED_CPU_FEATURE_SSE4_2		= 0x00000008UL,
+	ASSORTED_CPU_FEATURE_PCLMUL		= 0x00000010UL,
+	ASSORTED_CPU_FEATURE_AVX2		= 0x00000020UL,
+	ASSORTED_CPU_FEATURE_AVX512F		= 0x00000040UL,
+	ASSORTED_CPU_FEATURE_VPCLMUL		= 0x00000080UL,
+	ASSORTED_CPU_FEATURE_NEON		= 0x00000100UL,
+	ASSORTED_CPU_FEATURE_PMULL		= 0x00000200UL
+};
+
+/* The features mask to enable all CPU features
+ */
+#define ASSORTED_CPU_FEATURE_ALL		0xffffffffUL
+
+uint32_t assorted_cpu_features_get(
+          void );
+
+void assorted_cpu_features_set_mask(
+      uint32_t features_mask );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_CPU_FEATURES_H ) */
+
@@ -20,11 +20,26 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
+#include "assorted_cpu_features.h"
 #include "assorted_crc32.h"
 #include "assorted_libcerror.h"
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#if defined( ASSORTED_CRC32_HAVE_PCLMUL )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_CRC32_HAVE_PMULL )
+#include <arm_neon.h>
+
+#endif
+
 /* Polynomials
  *
  * RFC 1952
@@ -43,16 +58,1090 @@
  * reverse of reciprocal: 0xba0dc66b
  */
 
+/* Tables of the CRC-32 of all 8-bit messages followed by 0 to 15 zero bytes
+ * of the reversed polynomial 0xedb88320, used when no other polynomial was initialized
+ * The tables are constant so they can be used by multiple threads without initialization
+ */
+static const uint32_t assorted_crc32_default_slicing_table[ 16 ][ 256 ] = {
+	{
+		0x00000000UL, 0x77073096UL, 0xee0e612cUL, 0x990951baUL,
+		0x076dc419UL, 0x706af48fUL, 0xe963a535UL, 0x9e6495a3UL,
+		0x0edb8832UL, 0x79dcb8a4UL, 0xe0d5e91eUL, 0x97d2d988UL,
+		0x09b64c2bUL, 0x7eb17cbdUL, 0xe7b82d07UL, 0x90bf1d91UL,
+		0x1db71064UL, 0x6ab020f2UL, 0xf3b97148UL, 0x84be41deUL,
+		0x1adad47dUL, 0x6ddde4ebUL, 0xf4d4b551UL, 0x83d385c7UL,
+		0x136c9856UL, 0x646ba8c0UL, 0xfd62f97aUL, 0x8a65c9ecUL,
+		0x14015c4fUL, 0x63066cd9UL, 0xfa0f3d63UL, 0x8d080df5UL,
+		0x3b6e20c8UL, 0x4c69105eUL, 0xd56041e4UL, 0xa2677172UL,
+		0x3c03e4d1UL, 0x4b04d447UL, 0xd20d85fdUL, 0xa50ab56bUL,
+		0x35b5a8faUL, 0x42b2986cUL, 0xdbbbc9d6UL, 0xacbcf940UL,
+		0x32d86ce3UL, 0x45df5c75UL, 0xdcd60dcfUL, 0xabd13d59UL,
+		0x26d930acUL, 0x51de003aUL, 0xc8d75180UL, 0xbfd06116UL,
+		0x21b4f4b5UL, 0x56b3c423UL, 0xcfba9599UL, 0xb8bda50fUL,
+		0x2802b89eUL, 0x5f058808UL, 0xc60cd9b2UL, 0xb10be924UL,
+		0x2f6f7c87UL, 0x58684c11UL, 0xc1611dabUL, 0xb6662d3dUL,
+		0x76dc4190UL, 0x01db7106UL, 0x98d220bcUL, 0xefd5102aUL,
+		0x71b18589UL, 0x06b6b51fUL, 0x9fbfe4a5UL, 0xe8b8d433UL,
+		0x7807c9a2UL, 0x0f00f934UL, 0x9609a88eUL, 0xe10e9818UL,
+		0x7f6a0dbbUL, 0x086d3d2dUL, 0x91646c97UL, 0xe6635c01UL,
+		0x6b6b51f4UL, 0x1c6c6162UL, 0x856530d8UL, 0xf262004eUL,
+		0x6c0695edUL, 0x1b01a57bUL, 0x8208f4c1UL, 0xf50fc457UL,
+		0x65b0d9c6UL, 0x12b7e950UL, 0x8bbeb8eaUL, 0xfcb9887cUL,
+		0x62dd1ddfUL, 0x15da2d49UL, 0x8cd37cf3UL, 0xfbd44c65UL,
+		0x4db26158UL, 0x3ab551ceUL, 0xa3bc0074UL, 0xd4bb30e2UL,
+		0x4adfa541UL, 0x3dd895d7UL, 0xa4d1c46dUL, 0xd3d6f4fbUL,
+		0x4369e96aUL, 0x346ed9fcUL, 0xad678846UL, 0xda60b8d0UL,
+		0x44042d73UL, 0x33031de5UL, 0xaa0a4c5fUL, 0xdd0d7cc9UL,
+		0x5005713cUL, 0x270241aaUL, 0xbe0b1010UL, 0xc90c2086UL,
+		0x5768b525UL, 0x206f85b3UL, 0xb966d409UL, 0xce61e49fUL,
+		0x5edef90eUL, 0x29d9c998UL, 0xb0d09822UL, 0xc7d7a8b4UL,
+		0x59b33d17UL, 0x2eb40d81UL, 0xb7bd5c3bUL, 0xc0ba6cadUL,
+		0xedb88320UL, 0x9abfb3b6UL, 0x03b6e20cUL, 0x74b1d29aUL,
+		0xead54739UL, 0x9dd277afUL, 0x04db2615UL, 0x73dc1683UL,
+		0xe3630b12UL, 0x94643b84UL, 0x0d6d6a3eUL, 0x7a6a5aa8UL,
+		0xe40ecf0bUL, 0x9309ff9dUL, 0x0a00ae27UL, 0x7d079eb1UL,
+		0xf00f9344UL, 0x8708a3d2UL, 0x1e01f268UL, 0x6906c2feUL,
+		0xf762575dUL, 0x806567cbUL, 0x196c3671UL, 0x6e6b06e7UL,
+		0xfed41b76UL, 0x89d32be0UL, 0x10da7a5aUL, 0x67dd4accUL,
+		0xf9b9df6fUL, 0x8ebeeff9UL, 0x17b7be43UL, 0x60b08ed5UL,
+		0xd6d6a3e8UL, 0xa1d1937eUL, 0x38d8c2c4UL, 0x4fdff252UL,
+		0xd1bb67f1UL, 0xa6bc5767UL, 0x3fb506ddUL, 0x48b2364bUL,
+		0xd80d2bdaUL, 0xaf0a1b4cUL, 0x36034af6UL, 0x41047a60UL,
+		0xdf60efc3UL, 0xa867df55UL, 0x316e8eefUL, 0x4669be79UL,
+		0xcb61b38cUL, 0xbc66831aUL, 0x256fd2a0UL, 0x5268e236UL,
+		0xcc0c7795UL, 0xbb0b4703UL, 0x220216b9UL, 0x5505262fUL,
+		0xc5ba3bbeUL, 0xb2bd0b28UL, 0x2bb45a92UL, 0x5cb36a04UL,
+		0xc2d7ffa7UL, 0xb5d0cf31UL, 0x2cd99e8bUL, 0x5bdeae1dUL,
+		0x9b64c2b0UL, 0xec63f226UL, 0x756aa39cUL, 0x026d930aUL,
+		0x9c0906a9UL, 0xeb0e363fUL, 0x72076785UL, 0x05005713UL,
+		0x95bf4a82UL, 0xe2b87a14UL, 0x7bb12baeUL, 0x0cb61b38UL,
+		0x92d28e9bUL, 0xe5d5be0dUL, 0x7cdcefb7UL, 0x0bdbdf21UL,
+		0x86d3d2d4UL, 0xf1d4e242UL, 0x68ddb3f8UL, 0x1fda836eUL,
+		0x81be16cdUL, 0xf6b9265bUL, 0x6fb077e1UL, 0x18b74777UL,
+		0x88085ae6UL, 0xff0f6a70UL, 0x66063bcaUL, 0x11010b5cUL,
+		0x8f659effUL, 0xf862ae69UL, 0x616bffd3UL, 0x166ccf45UL,
+		0xa00ae278UL, 0xd70dd2eeUL, 0x4e048354UL, 0x3903b3c2UL,
+		0xa7672661UL, 0xd06016f7UL, 0x4969474dUL, 0x3e6e77dbUL,
+		0xaed16a4aUL, 0xd9d65adcUL, 0x40df0b66UL, 0x37d83bf0UL,
+		0xa9bcae53UL, 0xdebb9ec5UL, 0x47b2cf7fUL, 0x30b5ffe9UL,
+		0xbdbdf21cUL, 0xcabac28aUL, 0x53b39330UL, 0x24b4a3a6UL,
+		0xbad03605UL, 0xcdd70693UL, 0x54de5729UL, 0x23d967bfUL,
+		0xb3667a2eUL, 0xc4614ab8UL, 0x5d681b02UL, 0x2a6f2b94UL,
+		0xb40bbe37UL, 0xc30c8ea1UL, 0x5a05df1bUL, 0x2d02ef8dUL
+	},
+	{
+		0x00000000UL, 0x191b3141UL, 0x32366282UL, 0x2b2d53c3UL,
+		0x646cc504UL, 0x7d77f445UL, 0x565aa786UL, 0x4f4196c7UL,
+		0xc8d98a08UL, 0xd1c2bb49UL, 0xfaefe88aUL, 0xe3f4d9cbUL,
+		0xacb54f0cUL, 0xb5ae7e4dUL, 0x9e832d8eUL, 0x87981ccfUL,
+		0x4ac21251UL, 0x53d92310UL, 0x78f470d3UL, 0x61ef4192UL,
+		0x2eaed755UL, 0x37b5e614UL, 0x1c98b5d7UL, 0x05838496UL,
+		0x821b9859UL, 0x9b00a918UL, 0xb02dfadbUL, 0xa936cb9aUL,
+		0xe6775d5dUL, 0xff6c6c1cUL, 0xd4413fdfUL, 0xcd5a0e9eUL,
+		0x958424a2UL, 0x8c9f15e3UL, 0xa7b24620UL, 0xbea97761UL,
+		0xf1e8e1a6UL, 0xe8f3d0e7UL, 0xc3de8324UL, 0xdac5b265UL,
+		0x5d5daeaaUL, 0x44469febUL, 0x6f6bcc28UL, 0x7670fd69UL,
+		0x39316baeUL, 0x202a5aefUL, 0x0b07092cUL, 0x121c386dUL,
+		0xdf4636f3UL, 0xc65d07b2UL, 0xed705471UL, 0xf46b6530UL,
+		0xbb2af3f7UL, 0xa231c2b6UL, 0x891c9175UL, 0x9007a034UL,
+		0x179fbcfbUL, 0x0e848dbaUL, 0x25a9de79UL, 0x3cb2ef38UL,
+		0x73f379ffUL, 0x6ae848beUL, 0x41c51b7dUL, 0x58de2a3cUL,
+		0xf0794f05UL, 0xe9627e44UL, 0xc24f2d87UL, 0xdb541cc6UL,
+		0x94158a01UL, 0x8d0ebb40UL, 0xa623e883UL, 0xbf38d9c2UL,
+		0x38a0c50dUL, 0x21bbf44cUL, 0x0a96a78fUL, 0x138d96ceUL,
+		0x5ccc0009UL, 0x45d73148UL, 0x6efa628bUL, 0x77e153caUL,
+		0xbabb5d54UL, 0xa3a06c15UL, 0x888d3fd6UL, 0x91960e97UL,
+		0xded79850UL, 0xc7cca911UL, 0xece1fad2UL, 0xf5facb93UL,
+		0x7262d75cUL, 0x6b79e61dUL, 0x4054b5deUL, 0x594f849fUL,
+		0x160e1258UL, 0x0f152319UL, 0x243870daUL, 0x3d23419bUL,
+		0x65fd6ba7UL, 0x7ce65ae6UL, 0x57cb0925UL, 0x4ed03864UL,
+		0x0191aea3UL, 0x188a9fe2UL, 0x33a7cc21UL, 0x2abcfd60UL,
+		0xad24e1afUL, 0xb43fd0eeUL, 0x9f12832dUL, 0x8609b26cUL,
+		0xc94824abUL, 0xd05315eaUL, 0xfb7e4629UL, 0xe2657768UL,
+		0x2f3f79f6UL, 0x362448b7UL, 0x1d091b74UL, 0x04122a35UL,
+		0x4b53bcf2UL, 0x52488db3UL, 0x7965de70UL, 0x607eef31UL,
+		0xe7e6f3feUL, 0xfefdc2bfUL, 0xd5d0917cUL, 0xcccba03dUL,
+		0x838a36faUL, 0x9a9107bbUL, 0xb1bc5478UL, 0xa8a76539UL,
+		0x3b83984bUL, 0x2298a90aUL, 0x09b5fac9UL, 0x10aecb88UL,
+		0x5fef5d4fUL, 0x46f46c0eUL, 0x6dd93fcdUL, 0x74c20e8cUL,
+		0xf35a1243UL, 0xea412302UL, 0xc16c70c1UL, 0xd8774180UL,
+		0x9736d747UL, 0x8e2de606UL, 0xa500b5c5UL, 0xbc1b8484UL,
+		0x71418a1aUL, 0x685abb5bUL, 0x4377e898UL, 0x5a6cd9d9UL,
+		0x152d4f1eUL, 0x0c367e5fUL, 0x271b2d9cUL, 0x3e001cddUL,
+		0xb9980012UL, 0xa0833153UL, 0x8bae6290UL, 0x92b553d1UL,
+		0xddf4c516UL, 0xc4eff457UL, 0xefc2a794UL, 0xf6d996d5UL,
+		0xae07bce9UL, 0xb71c8da8UL, 0x9c31de6bUL, 0x852aef2aUL,
+		0xca6b79edUL, 0xd37048acUL, 0xf85d1b6fUL, 0xe1462a2eUL,
+		0x66de36e1UL, 0x7fc507a0UL, 0x54e85463UL, 0x4df36522UL,
+		0x02b2f3e5UL, 0x1ba9c2a4UL, 0x30849167UL, 0x299fa026UL,
+		0xe4c5aeb8UL, 0xfdde9ff9UL, 0xd6f3cc3aUL, 0xcfe8fd7bUL,
+		0x80a96bbcUL, 0x99b25afdUL, 0xb29f093eUL, 0xab84387fUL,
+		0x2c1c24b0UL, 0x350715f1UL, 0x1e2a4632UL, 0x07317773UL,
+		0x4870e1b4UL, 0x516bd0f5UL, 0x7a468336UL, 0x635db277UL,
+		0xcbfad74eUL, 0xd2e1e60fUL, 0xf9ccb5ccUL, 0xe0d7848dUL,
+		0xaf96124aUL, 0xb68d230bUL, 0x9da070c8UL, 0x84bb4189UL,
+		0x03235d46UL, 0x1a386c07UL, 0x31153fc4UL, 0x280e0e85UL,
+		0x674f9842UL, 0x7e54a903UL, 0x5579fac0UL, 0x4c62cb81UL,
+		0x8138c51fUL, 0x9823f45eUL, 0xb30ea79dUL, 0xaa1596dcUL,
+		0xe554001bUL, 0xfc4f315aUL, 0xd7626299UL, 0xce7953d8UL,
+		0x49e14f17UL, 0x50fa7e56UL, 0x7bd72d95UL, 0x62cc1cd4UL,
+		0x2d8d8a13UL, 0x3496bb52UL, 0x1fbbe891UL, 0x06a0d9d0UL,
+		0x5e7ef3ecUL, 0x4765c2adUL, 0x6c48916eUL, 0x7553a02fUL,
+		0x3a1236e8UL, 0x230907a9UL, 0x0824546aUL, 0x113f652bUL,
+		0x96a779e4UL, 0x8fbc48a5UL, 0xa4911b66UL, 0xbd8a2a27UL,
+		0xf2cbbce0UL, 0xebd08da1UL, 0xc0fdde62UL, 0xd9e6ef23UL,
+		0x14bce1bdUL, 0x0da7d0fcUL, 0x268a833fUL, 0x3f91b27eUL,
+		0x70d024b9UL, 0x69cb15f8UL, 0x42e6463bUL, 0x5bfd777aUL,
+		0xdc656bb5UL, 0xc57e5af4UL, 0xee530937UL, 0xf7483876UL,
+		0xb809aeb1UL, 0xa1129ff0UL, 0x8a3fcc33UL, 0x9324fd72UL
+	},
+	{
+		0x00000000UL, 0x01c26a37UL, 0x0384d46eUL, 0x0246be59UL,
+		0x0709a8dcUL, 0x06cbc2ebUL, 0x048d7cb2UL, 0x054f1685UL,
+		0x0e1351b8UL, 0x0fd13b8fUL, 0x0d9785d6UL, 0x0c55efe1UL,
+		0x091af964UL, 0x08d89353UL, 0x0a9e2d0aUL, 0x0b5c473dUL,
+		0x1c26a370UL, 0x1de4c947UL, 0x1fa2771eUL, 0x1e601d29UL,
+		0x1b2f0bacUL, 0x1aed619bUL, 0x18abdfc2UL, 0x1969b5f5UL,
+		0x1235f2c8UL, 0x13f798ffUL, 0x11b126a6UL, 0x10734c91UL,
+		0x153c5a14UL, 0x14fe3023UL, 0x16b88e7aUL, 0x177ae44dUL,
+		0x384d46e0UL, 0x398f2cd7UL, 0x3bc9928eUL, 0x3a0bf8b9UL,
+		0x3f44ee3cUL, 0x3e86840bUL, 0x3cc03a52UL, 0x3d025065UL,
+		0x365e1758UL, 0x379c7d6fUL, 0x35dac336UL, 0x3418a901UL,
+		0x3157bf84UL, 0x3095d5b3UL, 0x32d36beaUL, 0x331101ddUL,
+		0x246be590UL, 0x25a98fa7UL, 0x27ef31feUL, 0x262d5bc9UL,
+		0x23624d4cUL, 0x22a0277bUL, 0x20e69922UL, 0x2124f315UL,
+		0x2a78b428UL, 0x2bbade1fUL, 0x29fc6046UL, 0x283e0a71UL,
+		0x2d711cf4UL, 0x2cb376c3UL, 0x2ef5c89aUL, 0x2f37a2adUL,
+		0x709a8dc0UL, 0x7158e7f7UL, 0x731e59aeUL, 0x72dc3399UL,
+		0x7793251cUL, 0x76514f2bUL, 0x7417f172UL, 0x75d59b45UL,
+		0x7e89dc78UL, 0x7f4bb64fUL, 0x7d0d0816UL, 0x7ccf6221UL,
+		0x798074a4UL, 0x78421e93UL, 0x7a04a0caUL, 0x7bc6cafdUL,
+		0x6cbc2eb0UL, 0x6d7e4487UL, 0x6f38fadeUL, 0x6efa90e9UL,
+		0x6bb5866cUL, 0x6a77ec5bUL, 0x68315202UL, 0x69f33835UL,
+		0x62af7f08UL, 0x636d153fUL, 0x612bab66UL, 0x60e9c151UL,
+		0x65a6d7d4UL, 0x6464bde3UL, 0x662203baUL, 0x67e0698dUL,
+		0x48d7cb20UL, 0x4915a117UL, 0x4b531f4eUL, 0x4a917579UL,
+		0x4fde63fcUL, 0x4e1c09cbUL, 0x4c5ab792UL, 0x4d98dda5UL,
+		0x46c49a98UL, 0x4706f0afUL, 0x45404ef6UL, 0x448224c1UL,
+		0x41cd3244UL, 0x400f5873UL, 0x4249e62aUL, 0x438b8c1dUL,
+		0x54f16850UL, 0x55330267UL, 0x5775bc3eUL, 0x56b7d609UL,
+		0x53f8c08cUL, 0x523aaabbUL, 0x507c14e2UL, 0x51be7ed5UL,
+		0x5ae239e8UL, 0x5b2053dfUL, 0x5966ed86UL, 0x58a487b1UL,
+		0x5deb9134UL, 0x5c29fb03UL, 0x5e6f455aUL, 0x5fad2f6dUL,
+		0xe1351b80UL, 0xe0f771b7UL, 0xe2b1cfeeUL, 0xe373a5d9UL,
+		0xe63cb35cUL, 0xe7fed96bUL, 0xe5b86732UL, 0xe47a0d05UL,
+		0xef264a38UL, 0xeee4200fUL, 0xeca29e56UL, 0xed60f461UL,
+		0xe82fe2e4UL, 0xe9ed88d3UL, 0xebab368aUL, 0xea695cbdUL,
+		0xfd13b8f0UL, 0xfcd1d2c7UL, 0xfe976c9eUL, 0xff5506a9UL,
+		0xfa1a102cUL, 0xfbd87a1bUL, 0xf99ec442UL, 0xf85cae75UL,
+		0xf300e948UL, 0xf2c2837fUL, 0xf0843d26UL, 0xf1465711UL,
+		0xf4094194UL, 0xf5cb2ba3UL, 0xf78d95faUL, 0xf64fffcdUL,
+		0xd9785d60UL, 0xd8ba3757UL, 0xdafc890eUL, 0xdb3ee339UL,
+		0xde71f5bcUL, 0xdfb39f8bUL, 0xddf521d2UL, 0xdc374be5UL,
+		0xd76b0cd8UL, 0xd6a966efUL, 0xd4efd8b6UL, 0xd52db281UL,
+		0xd062a404UL, 0xd1a0ce33UL, 0xd3e6706aUL, 0xd2241a5dUL,
+		0xc55efe10UL, 0xc49c9427UL, 0xc6da2a7eUL, 0xc7184049UL,
+		0xc25756ccUL, 0xc3953cfbUL, 0xc1d382a2UL, 0xc011e895UL,
+		0xcb4dafa8UL, 0xca8fc59fUL, 0xc8c97bc6UL, 0xc90b11f1UL,
+		0xcc440774UL, 0xcd866d43UL, 0xcfc0d31aUL, 0xce02b92dUL,
+		0x91af9640UL, 0x906dfc77UL, 0x922b422eUL, 0x93e92819UL,
+		0x96a63e9cUL, 0x976454abUL, 0x9522eaf2UL, 0x94e080c5UL,
+		0x9fbcc7f8UL, 0x9e7eadcfUL, 0x9c381396UL, 0x9dfa79a1UL,
+		0x98b56f24UL, 0x99770513UL, 0x9b31bb4aUL, 0x9af3d17dUL,
+		0x8d893530UL, 0x8c4b5f07UL, 0x8e0de15eUL, 0x8fcf8b69UL,
+		0x8a809decUL, 0x8b42f7dbUL, 0x89044982UL, 0x88c623b5UL,
+		0x839a6488UL, 0x82580ebfUL, 0x801eb0e6UL, 0x81dcdad1UL,
+		0x8493cc54UL, 0x8551a663UL, 0x8717183aUL, 0x86d5720dUL,
+		0xa9e2d0a0UL, 0xa820ba97UL, 0xaa6604ceUL, 0xaba46ef9UL,
+		0xaeeb787cUL, 0xaf29124bUL, 0xad6fac12UL, 0xacadc625UL,
+		0xa7f18118UL, 0xa633eb2fUL, 0xa4755576UL, 0xa5b73f41UL,
+		0xa0f829c4UL, 0xa13a43f3UL, 0xa37cfdaaUL, 0xa2be979dUL,
+		0xb5c473d0UL, 0xb40619e7UL, 0xb640a7beUL, 0xb782cd89UL,
+		0xb2cddb0cUL, 0xb30fb13bUL, 0xb1490f62UL, 0xb08b6555UL,
+		0xbbd72268UL, 0xba15485fUL, 0xb853f606UL, 0xb9919c31UL,
+		0xbcde8ab4UL, 0xbd1ce083UL, 0xbf5a5edaUL, 0xbe9834edUL
+	},
+	{
+		0x00000000UL, 0xb8bc6765UL, 0xaa09c88bUL, 0x12b5afeeUL,
+		0x8f629757UL, 0x37def032UL, 0x256b5fdcUL, 0x9dd738b9UL,
+		0xc5b428efUL, 0x7d084f8aUL, 0x6fbde064UL, 0xd7018701UL,
+		0x4ad6bfb8UL, 0xf26ad8ddUL, 0xe0df7733UL, 0x58631056UL,
+		0x5019579fUL, 0xe8a530faUL, 0xfa109f14UL, 0x42acf871UL,
+		0xdf7bc0c8UL, 0x67c7a7adUL, 0x75720843UL, 0xcdce6f26UL,
+		0x95ad7f70UL, 0x2d111815UL, 0x3fa4b7fbUL, 0x8718d09eUL,
+		0x1acfe827UL, 0xa2738f42UL, 0xb0c620acUL, 0x087a47c9UL,
+		0xa032af3eUL, 0x188ec85bUL, 0x0a3b67b5UL, 0xb28700d0UL,
+		0x2f503869UL, 0x97ec5f0cUL, 0x8559f0e2UL, 0x3de59787UL,
+		0x658687d1UL, 0xdd3ae0b4UL, 0xcf8f4f5aUL, 0x7733283fUL,
+		0xeae41086UL, 0x525877e3UL, 0x40edd80dUL, 0xf851bf68UL,
+		0xf02bf8a1UL, 0x48979fc4UL, 0x5a22302aUL, 0xe29e574fUL,
+		0x7f496ff6UL, 0xc7f50893UL, 0xd540a77dUL, 0x6dfcc018UL,
+		0x359fd04eUL, 0x8d23b72bUL, 0x9f9618c5UL, 0x272a7fa0UL,
+		0xbafd4719UL, 0x0241207cUL, 0x10f48f92UL, 0xa848e8f7UL,
+		0x9b14583dUL, 0x23a83f58UL, 0x311d90b6UL, 0x89a1f7d3UL,
+		0x1476cf6aUL, 0xaccaa80fUL, 0xbe7f07e1UL, 0x06c36084UL,
+		0x5ea070d2UL, 0xe61c17b7UL, 0xf4a9b859UL, 0x4c15df3cUL,
+		0xd1c2e785UL, 0x697e80e0UL, 0x7bcb2f0eUL, 0xc377486bUL,
+		0xcb0d0fa2UL, 0x73b168c7UL, 0x6104c729UL, 0xd9b8a04cUL,
+		0x446f98f5UL, 0xfcd3ff90UL, 0xee66507eUL, 0x56da371bUL,
+		0x0eb9274dUL, 0xb6054028UL, 0xa4b0efc6UL, 0x1c0c88a3UL,
+		0x81dbb01aUL, 0x3967d77fUL, 0x2bd27891UL, 0x936e1ff4UL,
+		0x3b26f703UL, 0x839a9066UL, 0x912f3f88UL, 0x299358edUL,
+		0xb4446054UL, 0x0cf80731UL, 0x1e4da8dfUL, 0xa6f1cfbaUL,
+		0xfe92dfecUL, 0x462eb889UL, 0x549b1767UL, 0xec277002UL,
+		0x71f048bbUL, 0xc94c2fdeUL, 0xdbf98030UL, 0x6345e755UL,
+		0x6b3fa09cUL, 0xd383c7f9UL, 0xc1366817UL, 0x798a0f72UL,
+		0xe45d37cbUL, 0x5ce150aeUL, 0x4e54ff40UL, 0xf6e89825UL,
+		0xae8b8873UL, 0x1637ef16UL, 0x048240f8UL, 0xbc3e279dUL,
+		0x21e91f24UL, 0x99557841UL, 0x8be0d7afUL, 0x335cb0caUL,
+		0xed59b63bUL, 0x55e5d15eUL, 0x47507eb0UL, 0xffec19d5UL,
+		0x623b216cUL, 0xda874609UL, 0xc832e9e7UL, 0x708e8e82UL,
+		0x28ed9ed4UL, 0x9051f9b1UL, 0x82e4565fUL, 0x3a58313aUL,
+		0xa78f0983UL, 0x1f336ee6UL, 0x0d86c108UL, 0xb53aa66dUL,
+		0xbd40e1a4UL, 0x05fc86c1UL, 0x1749292fUL, 0xaff54e4aUL,
+		0x322276f3UL, 0x8a9e1196UL, 0x982bbe78UL, 0x2097d91dUL,
+		0x78f4c94bUL, 0xc048ae2eUL, 0xd2fd01c0UL, 0x6a4166a5UL,
+		0xf7965e1cUL, 0x4f2a3979UL, 0x5d9f9697UL, 0xe523f1f2UL,
+		0x4d6b1905UL, 0xf5d77e60UL, 0xe762d18eUL, 0x5fdeb6ebUL,
+		0xc2098e52UL, 0x7ab5e937UL, 0x680046d9UL, 0xd0bc21bcUL,
+		0x88df31eaUL, 0x3063568fUL, 0x22d6f961UL, 0x9a6a9e04UL,
+		0x07bda6bdUL, 0xbf01c1d8UL, 0xadb46e36UL, 0x15080953UL,
+		0x1d724e9aUL, 0xa5ce29ffUL, 0xb77b8611UL, 0x0fc7e174UL,
+		0x9210d9cdUL, 0x2aacbea8UL, 0x38191146UL, 0x80a57623UL,
+		0xd8c66675UL, 0x607a0110UL, 0x72cfaefeUL, 0xca73c99bUL,
+		0x57a4f122UL, 0xef189647UL, 0xfdad39a9UL, 0x45115eccUL,
+		0x764dee06UL, 0xcef18963UL, 0xdc44268dUL, 0x64f841e8UL,
+		0xf92f7951UL, 0x41931e34UL, 0x5326b1daUL, 0xeb9ad6bfUL,
+		0xb3f9c6e9UL, 0x0b45a18cUL, 0x19f00e62UL, 0xa14c6907UL,
+		0x3c9b51beUL, 0x842736dbUL, 0x96929935UL, 0x2e2efe50UL,
+		0x2654b999UL, 0x9ee8defcUL, 0x8c5d7112UL, 0x34e11677UL,
+		0xa9362eceUL, 0x118a49abUL, 0x033fe645UL, 0xbb838120UL,
+		0xe3e09176UL, 0x5b5cf613UL, 0x49e959fdUL, 0xf1553e98UL,
+		0x6c820621UL, 0xd43e6144UL, 0xc68bceaaUL, 0x7e37a9cfUL,
+		0xd67f4138UL, 0x6ec3265dUL, 0x7c7689b3UL, 0xc4caeed6UL,
+		0x591dd66fUL, 0xe1a1b10aUL, 0xf3141ee4UL, 0x4ba87981UL,
+		0x13cb69d7UL, 0xab770eb2UL, 0xb9c2a15cUL, 0x017ec639UL,
+		0x9ca9fe80UL, 0x241599e5UL, 0x36a0360bUL, 0x8e1c516eUL,
+		0x866616a7UL, 0x3eda71c2UL, 0x2c6fde2cUL, 0x94d3b949UL,
+		0x090481f0UL, 0xb1b8e695UL, 0xa30d497bUL, 0x1bb12e1eUL,
+		0x43d23e48UL, 0xfb6e592dUL, 0xe9dbf6c3UL, 0x516791a6UL,
+		0xccb0a91fUL, 0x740cce7aUL, 0x66b96194UL, 0xde0506f1UL
+	},
+	{
+		0x00000000UL, 0x3d6029b0UL, 0x7ac05360UL, 0x47a07ad0UL,
+		0xf580a6c0UL, 0xc8e08f70UL, 0x8f40f5a0UL, 0xb220dc10UL,
+		0x30704bc1UL, 0x0d106271UL, 0x4ab018a1UL, 0x77d03111UL,
+		0xc5f0ed01UL, 0xf890c4b1UL, 0xbf30be61UL, 0x825097d1UL,
+		0x60e09782UL, 0x5d80be32UL, 0x1a20c4e2UL, 0x2740ed52UL,
+		0x95603142UL, 0xa80018f2UL, 0xefa06222UL, 0xd2c04b92UL,
+		0x5090dc43UL, 0x6df0f5f3UL, 0x2a508f23UL, 0x1730a693UL,
+		0xa5107a83UL, 0x98705333UL, 0xdfd029e3UL, 0xe2b00053UL,
+		0xc1c12f04UL, 0xfca106b4UL, 0xbb017c64UL, 0x866155d4UL,
+		0x344189c4UL, 0x0921a074UL, 0x4e81daa4UL, 0x73e1f314UL,
+		0xf1b164c5UL, 0xccd14d75UL, 0x8b7137a5UL, 0xb6111e15UL,
+		0x0431c205UL, 0x3951ebb5UL, 0x7ef19165UL, 0x4391b8d5UL,
+		0xa121b886UL, 0x9c419136UL, 0xdbe1ebe6UL, 0xe681c256UL,
+		0x54a11e46UL, 0x69c137f6UL, 0x2e614d26UL, 0x13016496UL,
+		0x9151f347UL, 0xac31daf7UL, 0xeb91a027UL, 0xd6f18997UL,
+		0x64d15587UL, 0x59b17c37UL, 0x1e1106e7UL, 0x23712f57UL,
+		0x58f35849UL, 0x659371f9UL, 0x22330b29UL, 0x1f532299UL,
+		0xad73fe89UL, 0x9013d739UL, 0xd7b3ade9UL, 0xead38459UL,
+		0x68831388UL, 0x55e33a38UL, 0x124340e8UL, 0x2f236958UL,
+		0x9d03b548UL, 0xa0639cf8UL, 0xe7c3e628UL, 0xdaa3cf98UL,
+		0x3813cfcbUL, 0x0573e67bUL, 0x42d39cabUL, 0x7fb3b51bUL,
+		0xcd93690bUL, 0xf0f340bbUL, 0xb7533a6bUL, 0x8a3313dbUL,
+		0x0863840aUL, 0x3503adbaUL, 0x72a3d76aUL, 0x4fc3fedaUL,
+		0xfde322caUL, 0xc0830b7aUL, 0x872371aaUL, 0xba43581aUL,
+		0x9932774dUL, 0xa4525efdUL, 0xe3f2242dUL, 0xde920d9dUL,
+		0x6cb2d18dUL, 0x51d2f83dUL, 0x167282edUL, 0x2b12ab5dUL,
+		0xa9423c8cUL, 0x9422153cUL, 0xd3826fecUL, 0xeee2465cUL,
+		0x5cc29a4cUL, 0x61a2b3fcUL, 0x2602c92cUL, 0x1b62e09cUL,
+		0xf9d2e0cfUL, 0xc4b2c97fUL, 0x8312b3afUL, 0xbe729a1fUL,
+		0x0c52460fUL, 0x31326fbfUL, 0x7692156fUL, 0x4bf23cdfUL,
+		0xc9a2ab0eUL, 0xf4c282beUL, 0xb362f86eUL, 0x8e02d1deUL,
+		0x3c220dceUL, 0x0142247eUL, 0x46e25eaeUL, 0x7b82771eUL,
+		0xb1e6b092UL, 0x8c869922UL, 0xcb26e3f2UL, 0xf646ca42UL,
+		0x44661652UL, 0x79063fe2UL, 0x3ea64532UL, 0x03c66c82UL,
+		0x8196fb53UL, 0xbcf6d2e3UL, 0xfb56a833UL, 0xc6368183UL,
+		0x74165d93UL, 0x49767423UL, 0x0ed60ef3UL, 0x33b62743UL,
+		0xd1062710UL, 0xec660ea0UL, 0xabc67470UL, 0x96a65dc0UL,
+		0x248681d0UL, 0x19e6a860UL, 0x5e46d2b0UL, 0x6326fb00UL,
+		0xe1766cd1UL, 0xdc164561UL, 0x9bb63fb1UL, 0xa6d61601UL,
+		0x14f6ca11UL, 0x2996e3a1UL, 0x6e369971UL, 0x5356b0c1UL,
+		0x70279f96UL, 0x4d47b626UL, 0x0ae7ccf6UL, 0x3787e546UL,
+		0x85a73956UL, 0xb8c710e6UL, 0xff676a36UL, 0xc2074386UL,
+		0x4057d457UL, 0x7d37fde7UL, 0x3a978737UL, 0x07f7ae87UL,
+		0xb5d77297UL, 0x88b75b27UL, 0xcf1721f7UL, 0xf2770847UL,
+		0x10c70814UL, 0x2da721a4UL, 0x6a075b74UL, 0x576772c4UL,
+		0xe547aed4UL, 0xd8278764UL, 0x9f87fdb4UL, 0xa2e7d404UL,
+		0x20b743d5UL, 0x1dd76a65UL, 0x5a7710b5UL, 0x67173905UL,
+		0xd537e515UL, 0xe857cca5UL, 0xaff7b675UL, 0x92979fc5UL,
+		0xe915e8dbUL, 0xd475c16bUL, 0x93d5bbbbUL, 0xaeb5920bUL,
+		0x1c954e1bUL, 0x21f567abUL, 0x66551d7bUL, 0x5b3534cbUL,
+		0xd965a31aUL, 0xe4058aaaUL, 0xa3a5f07aUL, 0x9ec5d9caUL,
+		0x2ce505daUL, 0x11852c6aUL, 0x562556baUL, 0x6b457f0aUL,
+		0x89f57f59UL, 0xb49556e9UL, 0xf3352c39UL, 0xce550589UL,
+		0x7c75d999UL, 0x4115f029UL, 0x06b58af9UL, 0x3bd5a349UL,
+		0xb9853498UL, 0x84e51d28UL, 0xc34567f8UL, 0xfe254e48UL,
+		0x4c059258UL, 0x7165bbe8UL, 0x36c5c138UL, 0x0ba5e888UL,
+		0x28d4c7dfUL, 0x15b4ee6fUL, 0x521494bfUL, 0x6f74bd0fUL,
+		0xdd54611fUL, 0xe03448afUL, 0xa794327fUL, 0x9af41bcfUL,
+		0x18a48c1eUL, 0x25c4a5aeUL, 0x6264df7eUL, 0x5f04f6ceUL,
+		0xed242adeUL, 0xd044036eUL, 0x97e479beUL, 0xaa84500eUL,
+		0x4834505dUL, 0x755479edUL, 0x32f4033dUL, 0x0f942a8dUL,
+		0xbdb4f69dUL, 0x80d4df2dUL, 0xc774a5fdUL, 0xfa148c4dUL,
+		0x78441b9cUL, 0x4524322cUL, 0x028448fcUL, 0x3fe4614cUL,
+		0x8dc4bd5cUL, 0xb0a494ecUL, 0xf704ee3cUL, 0xca64c78cUL
+	},
+	{
+		0x00000000UL, 0xcb5cd3a5UL, 0x4dc8a10bUL, 0x869472aeUL,
+		0x9b914216UL, 0x50cd91b3UL, 0xd659e31dUL, 0x1d0530b8UL,
+		0xec53826dUL, 0x270f51c8UL, 0xa19b2366UL, 0x6ac7f0c3UL,
+		0x77c2c07bUL, 0xbc9e13deUL, 0x3a0a6170UL, 0xf156b2d5UL,
+		0x03d6029bUL, 0xc88ad13eUL, 0x4e1ea390UL, 0x85427035UL,
+		0x9847408dUL, 0x531b9328UL, 0xd58fe186UL, 0x1ed33223UL,
+		0xef8580f6UL, 0x24d95353UL, 0xa24d21fdUL, 0x6911f258UL,
+		0x7414c2e0UL, 0xbf481145UL, 0x39dc63ebUL, 0xf280b04eUL,
+		0x07ac0536UL, 0xccf0d693UL, 0x4a64a43dUL, 0x81387798UL,
+		0x9c3d4720UL, 0x57619485UL, 0xd1f5e62bUL, 0x1aa9358eUL,
+		0xebff875bUL, 0x20a354feUL, 0xa6372650UL, 0x6d6bf5f5UL,
+		0x706ec54dUL, 0xbb3216e8UL, 0x3da66446UL, 0xf6fab7e3UL,
+		0x047a07adUL, 0xcf26d408UL, 0x49b2a6a6UL, 0x82ee7503UL,
+		0x9feb45bbUL, 0x54b7961eUL, 0xd223e4b0UL, 0x197f3715UL,
+		0xe82985c0UL, 0x23755665UL, 0xa5e124cbUL, 0x6ebdf76eUL,
+		0x73b8c7d6UL, 0xb8e41473UL, 0x3e7066ddUL, 0xf52cb578UL,
+		0x0f580a6cUL, 0xc404d9c9UL, 0x4290ab67UL, 0x89cc78c2UL,
+		0x94c9487aUL, 0x5f959bdfUL, 0xd901e971UL, 0x125d3ad4UL,
+		0xe30b8801UL, 0x28575ba4UL, 0xaec3290aUL, 0x659ffaafUL,
+		0x789aca17UL, 0xb3c619b2UL, 0x35526b1cUL, 0xfe0eb8b9UL,
+		0x0c8e08f7UL, 0xc7d2db52UL, 0x4146a9fcUL, 0x8a1a7a59UL,
+		0x971f4ae1UL, 0x5c439944UL, 0xdad7ebeaUL, 0x118b384fUL,
+		0xe0dd8a9aUL, 0x2b81593fUL, 0xad152b91UL, 0x6649f834UL,
+		0x7b4cc88cUL, 0xb0101b29UL, 0x36846987UL, 0xfdd8ba22UL,
+		0x08f40f5aUL, 0xc3a8dcffUL, 0x453cae51UL, 0x8e607df4UL,
+		0x93654d4cUL, 0x58399ee9UL, 0xdeadec47UL, 0x15f13fe2UL,
+		0xe4a78d37UL, 0x2ffb5e92UL, 0xa96f2c3cUL, 0x6233ff99UL,
+		0x7f36cf21UL, 0xb46a1c84UL, 0x32fe6e2aUL, 0xf9a2bd8fUL,
+		0x0b220dc1UL, 0xc07ede64UL, 0x46eaaccaUL, 0x8db67f6fUL,
+		0x90b34fd7UL, 0x5bef9c72UL, 0xdd7beedcUL, 0x16273d79UL,
+		0xe7718facUL, 0x2c2d5c09UL, 0xaab92ea7UL, 0x61e5fd02UL,
+		0x7ce0cdbaUL, 0xb7bc1e1fUL, 0x31286cb1UL, 0xfa74bf14UL,
+		0x1eb014d8UL, 0xd5ecc77dUL, 0x5378b5d3UL, 0x98246676UL,
+		0x852156ceUL, 0x4e7d856bUL, 0xc8e9f7c5UL, 0x03b52460UL,
+		0xf2e396b5UL, 0x39bf4510UL, 0xbf2b37beUL, 0x7477e41bUL,
+		0x6972d4a3UL, 0xa22e0706UL, 0x24ba75a8UL, 0xefe6a60dUL,
+		0x1d661643UL, 0xd63ac5e6UL, 0x50aeb748UL, 0x9bf264edUL,
+		0x86f75455UL, 0x4dab87f0UL, 0xcb3ff55eUL, 0x006326fbUL,
+		0xf135942eUL, 0x3a69478bUL, 0xbcfd3525UL, 0x77a1e680UL,
+		0x6aa4d638UL, 0xa1f8059dUL, 0x276c7733UL, 0xec30a496UL,
+		0x191c11eeUL, 0xd240c24bUL, 0x54d4b0e5UL, 0x9f886340UL,
+		0x828d53f8UL, 0x49d1805dUL, 0xcf45f2f3UL, 0x04192156UL,
+		0xf54f9383UL, 0x3e134026UL, 0xb8873288UL, 0x73dbe12dUL,
+		0x6eded195UL, 0xa5820230UL, 0x2316709eUL, 0xe84aa33bUL,
+		0x1aca1375UL, 0xd196c0d0UL, 0x5702b27eUL, 0x9c5e61dbUL,
+		0x815b5163UL, 0x4a0782c6UL, 0xcc93f068UL, 0x07cf23cdUL,
+		0xf6999118UL, 0x3dc542bdUL, 0xbb513013UL, 0x700de3b6UL,
+		0x6d08d30eUL, 0xa65400abUL, 0x20c07205UL, 0xeb9ca1a0UL,
+		0x11e81eb4UL, 0xdab4cd11UL, 0x5c20bfbfUL, 0x977c6c1aUL,
+		0x8a795ca2UL, 0x41258f07UL, 0xc7b1fda9UL, 0x0ced2e0cUL,
+		0xfdbb9cd9UL, 0x36e74f7cUL, 0xb0733dd2UL, 0x7b2fee77UL,
+		0x662adecfUL, 0xad760d6aUL, 0x2be27fc4UL, 0xe0beac61UL,
+		0x123e1c2fUL, 0xd962cf8aUL, 0x5ff6bd24UL, 0x94aa6e81UL,
+		0x89af5e39UL, 0x42f38d9cUL, 0xc467ff32UL, 0x0f3b2c97UL,
+		0xfe6d9e42UL, 0x35314de7UL, 0xb3a53f49UL, 0x78f9ececUL,
+		0x65fcdc54UL, 0xaea00ff1UL, 0x28347d5fUL, 0xe368aefaUL,
+		0x16441b82UL, 0xdd18c827UL, 0x5b8cba89UL, 0x90d0692cUL,
+		0x8dd55994UL, 0x46898a31UL, 0xc01df89fUL, 0x0b412b3aUL,
+		0xfa1799efUL, 0x314b4a4aUL, 0xb7df38e4UL, 0x7c83eb41UL,
+		0x6186dbf9UL, 0xaada085cUL, 0x2c4e7af2UL, 0xe712a957UL,
+		0x15921919UL, 0xdececabcUL, 0x585ab812UL, 0x93066bb7UL,
+		0x8e035b0fUL, 0x455f88aaUL, 0xc3cbfa04UL, 0x089729a1UL,
+		0xf9c19b74UL, 0x329d48d1UL, 0xb4093a7fUL, 0x7f55e9daUL,
+		0x6250d962UL, 0xa90c0ac7UL, 0x2f987869UL, 0xe4c4abccUL
+	},
+	{
+		0x00000000UL, 0xa6770bb4UL, 0x979f1129UL, 0x31e81a9dUL,
+		0xf44f2413UL, 0x52382fa7UL, 0x63d0353aUL, 0xc5a73e8eUL,
+		0x33ef4e67UL, 0x959845d3UL, 0xa4705f4eUL, 0x020754faUL,
+		0xc7a06a74UL, 0x61d761c0UL, 0x503f7b5dUL, 0xf64870e9UL,
+		0x67de9cceUL, 0xc1a9977aUL, 0xf0418de7UL, 0x56368653UL,
+		0x9391b8ddUL, 0x35e6b369UL, 0x040ea9f4UL, 0xa279a240UL,
+		0x5431d2a9UL, 0xf246d91dUL, 0xc3aec380UL, 0x65d9c834UL,
+		0xa07ef6baUL, 0x0609fd0eUL, 0x37e1e793UL, 0x9196ec27UL,
+		0xcfbd399cUL, 0x69ca3228UL, 0x582228b5UL, 0xfe552301UL,
+		0x3bf21d8fUL, 0x9d85163bUL, 0xac6d0ca6UL, 0x0a1a0712UL,
+		0xfc5277fbUL, 0x5a257c4fUL, 0x6bcd66d2UL, 0xcdba6d66UL,
+		0x081d53e8UL, 0xae6a585cUL, 0x9f8242c1UL, 0x39f54975UL,
+		0xa863a552UL, 0x0e14aee6UL, 0x3ffcb47bUL, 0x998bbfcfUL,
+		0x5c2c8141UL, 0xfa5b8af5UL, 0xcbb39068UL, 0x6dc49bdcUL,
+		0x9b8ceb35UL, 0x3dfbe081UL, 0x0c13fa1cUL, 0xaa64f1a8UL,
+		0x6fc3cf26UL, 0xc9b4c492UL, 0xf85cde0fUL, 0x5e2bd5bbUL,
+		0x440b7579UL, 0xe27c7ecdUL, 0xd3946450UL, 0x75e36fe4UL,
+		0xb044516aUL, 0x16335adeUL, 0x27db4043UL, 0x81ac4bf7UL,
+		0x77e43b1eUL, 0xd19330aaUL, 0xe07b2a37UL, 0x460c2183UL,
+		0x83ab1f0dUL, 0x25dc14b9UL, 0x14340e24UL, 0xb2430590UL,
+		0x23d5e9b7UL, 0x85a2e203UL, 0xb44af89eUL, 0x123df32aUL,
+		0xd79acda4UL, 0x71edc610UL, 0x4005dc8dUL, 0xe672d739UL,
+		0x103aa7d0UL, 0xb64dac64UL, 0x87a5b6f9UL, 0x21d2bd4dUL,
+		0xe47583c3UL, 0x42028877UL, 0x73ea92eaUL, 0xd59d995eUL,
+		0x8bb64ce5UL, 0x2dc14751UL, 0x1c295dccUL, 0xba5e5678UL,
+		0x7ff968f6UL, 0xd98e6342UL, 0xe86679dfUL, 0x4e11726bUL,
+		0xb8590282UL, 0x1e2e0936UL, 0x2fc613abUL, 0x89b1181fUL,
+		0x4c162691UL, 0xea612d25UL, 0xdb8937b8UL, 0x7dfe3c0cUL,
+		0xec68d02bUL, 0x4a1fdb9fUL, 0x7bf7c102UL, 0xdd80cab6UL,
+		0x1827f438UL, 0xbe50ff8cUL, 0x8fb8e511UL, 0x29cfeea5UL,
+		0xdf879e4cUL, 0x79f095f8UL, 0x48188f65UL, 0xee6f84d1UL,
+		0x2bc8ba5fUL, 0x8dbfb1ebUL, 0xbc57ab76UL, 0x1a20a0c2UL,
+		0x8816eaf2UL, 0x2e61e146UL, 0x1f89fbdbUL, 0xb9fef06fUL,
+		0x7c59cee1UL, 0xda2ec555UL, 0xebc6dfc8UL, 0x4db1d47cUL,
+		0xbbf9a495UL, 0x1d8eaf21UL, 0x2c66b5bcUL, 0x8a11be08UL,
+		0x4fb68086UL, 0xe9c18b32UL, 0xd82991afUL, 0x7e5e9a1bUL,
+		0xefc8763cUL, 0x49bf7d88UL, 0x78576715UL, 0xde206ca1UL,
+		0x1b87522fUL, 0xbdf0599bUL, 0x8c184306UL, 0x2a6f48b2UL,
+		0xdc27385bUL, 0x7a5033efUL, 0x4bb82972UL, 0xedcf22c6UL,
+		0x28681c48UL, 0x8e1f17fcUL, 0xbff70d61UL, 0x198006d5UL,
+		0x47abd36eUL, 0xe1dcd8daUL, 0xd034c247UL, 0x7643c9f3UL,
+		0xb3e4f77dUL, 0x1593fcc9UL, 0x247be654UL, 0x820cede0UL,
+		0x74449d09UL, 0xd23396bdUL, 0xe3db8c20UL, 0x45ac8794UL,
+		0x800bb91aUL, 0x267cb2aeUL, 0x1794a833UL, 0xb1e3a387UL,
+		0x20754fa0UL, 0x86024414UL, 0xb7ea5e89UL, 0x119d553dUL,
+		0xd43a6bb3UL, 0x724d6007UL, 0x43a57a9aUL, 0xe5d2712eUL,
+		0x139a01c7UL, 0xb5ed0a73UL, 0x840510eeUL, 0x22721b5aUL,
+		0xe7d525d4UL, 0x41a22e60UL, 0x704a34fdUL, 0xd63d3f49UL,
+		0xcc1d9f8bUL, 0x6a6a943fUL, 0x5b828ea2UL, 0xfdf58516UL,
+		0x3852bb98UL, 0x9e25b02cUL, 0xafcdaab1UL, 0x09baa105UL,
+		0xfff2d1ecUL, 0x5985da58UL, 0x686dc0c5UL, 0xce1acb71UL,
+		0x0bbdf5ffUL, 0xadcafe4bUL, 0x9c22e4d6UL, 0x3a55ef62UL,
+		0xabc30345UL, 0x0db408f1UL, 0x3c5c126cUL, 0x9a2b19d8UL,
+		0x5f8c2756UL, 0xf9fb2ce2UL, 0xc813367fUL, 0x6e643dcbUL,
+		0x982c4d22UL, 0x3e5b4696UL, 0x0fb35c0bUL, 0xa9c457bfUL,
+		0x6c636931UL, 0xca146285UL, 0xfbfc7818UL, 0x5d8b73acUL,
+		0x03a0a617UL, 0xa5d7ada3UL, 0x943fb73eUL, 0x3248bc8aUL,
+		0xf7ef8204UL, 0x519889b0UL, 0x6070932dUL, 0xc6079899UL,
+		0x304fe870UL, 0x9638e3c4UL, 0xa7d0f959UL, 0x01a7f2edUL,
+		0xc400cc63UL, 0x6277c7d7UL, 0x539fdd4aUL, 0xf5e8d6feUL,
+		0x647e3ad9UL, 0xc209316dUL, 0xf3e12bf0UL, 0x55962044UL,
+		0x90311ecaUL, 0x3646157eUL, 0x07ae0fe3UL, 0xa1d90457UL,
+		0x579174beUL, 0xf1e67f0aUL, 0xc00e6597UL, 0x66796e23UL,
+		0xa3de50adUL, 0x05a95b19UL, 0x34414184UL, 0x92364a30UL
+	},
+	{
+		0x00000000UL, 0xccaa009eUL, 0x4225077dUL, 0x8e8f07e3UL,
+		0x844a0efaUL, 0x48e00e64UL, 0xc66f0987UL, 0x0ac50919UL,
+		0xd3e51bb5UL, 0x1f4f1b2bUL, 0x91c01cc8UL, 0x5d6a1c56UL,
+		0x57af154fUL, 0x9b0515d1UL, 0x158a1232UL, 0xd92012acUL,
+		0x7cbb312bUL, 0xb01131b5UL, 0x3e9e3656UL, 0xf23436c8UL,
+		0xf8f13fd1UL, 0x345b3f4fUL, 0xbad438acUL, 0x767e3832UL,
+		0xaf5e2a9eUL, 0x63f42a00UL, 0xed7b2de3UL, 0x21d12d7dUL,
+		0x2b142464UL, 0xe7be24faUL, 0x69312319UL, 0xa59b2387UL,
+		0xf9766256UL, 0x35dc62c8UL, 0xbb53652bUL, 0x77f965b5UL,
+		0x7d3c6cacUL, 0xb1966c32UL, 0x3f196bd1UL, 0xf3b36b4fUL,
+		0x2a9379e3UL, 0xe639797dUL, 0x68b67e9eUL, 0xa41c7e00UL,
+		0xaed97719UL, 0x62737787UL, 0xecfc7064UL, 0x205670faUL,
+		0x85cd537dUL, 0x496753e3UL, 0xc7e85400UL, 0x0b42549eUL,
+		0x01875d87UL, 0xcd2d5d19UL, 0x43a25afaUL, 0x8f085a64UL,
+		0x562848c8UL, 0x9a824856UL, 0x140d4fb5UL, 0xd8a74f2bUL,
+		0xd2624632UL, 0x1ec846acUL, 0x9047414fUL, 0x5ced41d1UL,
+		0x299dc2edUL, 0xe537c273UL, 0x6bb8c590UL, 0xa712c50eUL,
+		0xadd7cc17UL, 0x617dcc89UL, 0xeff2cb6aUL, 0x2358cbf4UL,
+		0xfa78d958UL, 0x36d2d9c6UL, 0xb85dde25UL, 0x74f7debbUL,
+		0x7e32d7a2UL, 0xb298d73cUL, 0x3c17d0dfUL, 0xf0bdd041UL,
+		0x5526f3c6UL, 0x998cf358UL, 0x1703f4bbUL, 0xdba9f425UL,
+		0xd16cfd3cUL, 0x1dc6fda2UL, 0x9349fa41UL, 0x5fe3fadfUL,
+		0x86c3e873UL, 0x4a69e8edUL, 0xc4e6ef0eUL, 0x084cef90UL,
+		0x0289e689UL, 0xce23e617UL, 0x40ace1f4UL, 0x8c06e16aUL,
+		0xd0eba0bbUL, 0x1c41a025UL, 0x92cea7c6UL, 0x5e64a758UL,
+		0x54a1ae41UL, 0x980baedfUL, 0x1684a93cUL, 0xda2ea9a2UL,
+		0x030ebb0eUL, 0xcfa4bb90UL, 0x412bbc73UL, 0x8d81bcedUL,
+		0x8744b5f4UL, 0x4beeb56aUL, 0xc561b289UL, 0x09cbb217UL,
+		0xac509190UL, 0x60fa910eUL, 0xee7596edUL, 0x22df9673UL,
+		0x281a9f6aUL, 0xe4b09ff4UL, 0x6a3f9817UL, 0xa6959889UL,
+		0x7fb58a25UL, 0xb31f8abbUL, 0x3d908d58UL, 0xf13a8dc6UL,
+		0xfbff84dfUL, 0x37558441UL, 0xb9da83a2UL, 0x7570833cUL,
+		0x533b85daUL, 0x9f918544UL, 0x111e82a7UL, 0xddb48239UL,
+		0xd7718b20UL, 0x1bdb8bbeUL, 0x95548c5dUL, 0x59fe8cc3UL,
+		0x80de9e6fUL, 0x4c749ef1UL, 0xc2fb9912UL, 0x0e51998cUL,
+		0x04949095UL, 0xc83e900bUL, 0x46b197e8UL, 0x8a1b9776UL,
+		0x2f80b4f1UL, 0xe32ab46fUL, 0x6da5b38cUL, 0xa10fb312UL,
+		0xabcaba0bUL, 0x6760ba95UL, 0xe9efbd76UL, 0x2545bde8UL,
+		0xfc65af44UL, 0x30cfafdaUL, 0xbe40a839UL, 0x72eaa8a7UL,
+		0x782fa1beUL, 0xb485a120UL, 0x3a0aa6c3UL, 0xf6a0a65dUL,
+		0xaa4de78cUL, 0x66e7e712UL, 0xe868e0f1UL, 0x24c2e06fUL,
+		0x2e07e976UL, 0xe2ade9e8UL, 0x6c22ee0bUL, 0xa088ee95UL,
+		0x79a8fc39UL, 0xb502fca7UL, 0x3b8dfb44UL, 0xf727fbdaUL,
+		0xfde2f2c3UL, 0x3148f25dUL, 0xbfc7f5beUL, 0x736df520UL,
+		0xd6f6d6a7UL, 0x1a5cd639UL, 0x94d3d1daUL, 0x5879d144UL,
+		0x52bcd85dUL, 0x9e16d8c3UL, 0x1099df20UL, 0xdc33dfbeUL,
+		0x0513cd12UL, 0xc9b9cd8cUL, 0x4736ca6fUL, 0x8b9ccaf1UL,
+		0x8159c3e8UL, 0x4df3c376UL, 0xc37cc495UL, 0x0fd6c40bUL,
+		0x7aa64737UL, 0xb60c47a9UL, 0x3883404aUL, 0xf42940d4UL,
+		0xfeec49cdUL, 0x32464953UL, 0xbcc94eb0UL, 0x70634e2eUL,
+		0xa9435c82UL, 0x65e95c1cUL, 0xeb665bffUL, 0x27cc5b61UL,
+		0x2d095278UL, 0xe1a352e6UL, 0x6f2c5505UL, 0xa386559bUL,
+		0x061d761cUL, 0xcab77682UL, 0x44387161UL, 0x889271ffUL,
+		0x825778e6UL, 0x4efd7878UL, 0xc0727f9bUL, 0x0cd87f05UL,
+		0xd5f86da9UL, 0x19526d37UL, 0x97dd6ad4UL, 0x5b776a4aUL,
+		0x51b26353UL, 0x9d1863cdUL, 0x1397642eUL, 0xdf3d64b0UL,
+		0x83d02561UL, 0x4f7a25ffUL, 0xc1f5221cUL, 0x0d5f2282UL,
+		0x079a2b9bUL, 0xcb302b05UL, 0x45bf2ce6UL, 0x89152c78UL,
+		0x50353ed4UL, 0x9c9f3e4aUL, 0x121039a9UL, 0xdeba3937UL,
+		0xd47f302eUL, 0x18d530b0UL, 0x965a3753UL, 0x5af037cdUL,
+		0xff6b144aUL, 0x33c114d4UL, 0xbd4e1337UL, 0x71e413a9UL,
+		0x7b211ab0UL, 0xb78b1a2eUL, 0x39041dcdUL, 0xf5ae1d53UL,
+		0x2c8e0fffUL, 0xe0240f61UL, 0x6eab0882UL, 0xa201081cUL,
+		0xa8c40105UL, 0x646e019bUL, 0xeae10678UL, 0x264b06e6UL
+	},
+	{
+		0x00000000UL, 0x177b1443UL, 0x2ef62886UL, 0x398d3cc5UL,
+		0x5dec510cUL, 0x4a97454fUL, 0x731a798aUL, 0x64616dc9UL,
+		0xbbd8a218UL, 0xaca3b65bUL, 0x952e8a9eUL, 0x82559eddUL,
+		0xe634f314UL, 0xf14fe757UL, 0xc8c2db92UL, 0xdfb9cfd1UL,
+		0xacc04271UL, 0xbbbb5632UL, 0x82366af7UL, 0x954d7eb4UL,
+		0xf12c137dUL, 0xe657073eUL, 0xdfda3bfbUL, 0xc8a12fb8UL,
+		0x1718e069UL, 0x0063f42aUL, 0x39eec8efUL, 0x2e95dcacUL,
+		0x4af4b165UL, 0x5d8fa526UL, 0x640299e3UL, 0x73798da0UL,
+		0x82f182a3UL, 0x958a96e0UL, 0xac07aa25UL, 0xbb7cbe66UL,
+		0xdf1dd3afUL, 0xc866c7ecUL, 0xf1ebfb29UL, 0xe690ef6aUL,
+		0x392920bbUL, 0x2e5234f8UL, 0x17df083dUL, 0x00a41c7eUL,
+		0x64c571b7UL, 0x73be65f4UL, 0x4a335931UL, 0x5d484d72UL,
+		0x2e31c0d2UL, 0x394ad491UL, 0x00c7e854UL, 0x17bcfc17UL,
+		0x73dd91deUL, 0x64a6859dUL, 0x5d2bb958UL, 0x4a50ad1bUL,
+		0x95e962caUL, 0x82927689UL, 0xbb1f4a4cUL, 0xac645e0fUL,
+		0xc80533c6UL, 0xdf7e2785UL, 0xe6f31b40UL, 0xf1880f03UL,
+		0xde920307UL, 0xc9e91744UL, 0xf0642b81UL, 0xe71f3fc2UL,
+		0x837e520bUL, 0x94054648UL, 0xad887a8dUL, 0xbaf36eceUL,
+		0x654aa11fUL, 0x7231b55cUL, 0x4bbc8999UL, 0x5cc79ddaUL,
+		0x38a6f013UL, 0x2fdde450UL, 0x1650d895UL, 0x012bccd6UL,
+		0x72524176UL, 0x65295535UL, 0x5ca469f0UL, 0x4bdf7db3UL,
+		0x2fbe107aUL, 0x38c50439UL, 0x014838fcUL, 0x16332cbfUL,
+		0xc98ae36eUL, 0xdef1f72dUL, 0xe77ccbe8UL, 0xf007dfabUL,
+		0x9466b262UL, 0x831da621UL, 0xba909ae4UL, 0xadeb8ea7UL,
+		0x5c6381a4UL, 0x4b1895e7UL, 0x7295a922UL, 0x65eebd61UL,
+		0x018fd0a8UL, 0x16f4c4ebUL, 0x2f79f82eUL, 0x3802ec6dUL,
+		0xe7bb23bcUL, 0xf0c037ffUL, 0xc94d0b3aUL, 0xde361f79UL,
+		0xba5772b0UL, 0xad2c66f3UL, 0x94a15a36UL, 0x83da4e75UL,
+		0xf0a3c3d5UL, 0xe7d8d796UL, 0xde55eb53UL, 0xc92eff10UL,
+		0xad4f92d9UL, 0xba34869aUL, 0x83b9ba5fUL, 0x94c2ae1cUL,
+		0x4b7b61cdUL, 0x5c00758eUL, 0x658d494bUL, 0x72f65d08UL,
+		0x169730c1UL, 0x01ec2482UL, 0x38611847UL, 0x2f1a0c04UL,
+		0x6655004fUL, 0x712e140cUL, 0x48a328c9UL, 0x5fd83c8aUL,
+		0x3bb95143UL, 0x2cc24500UL, 0x154f79c5UL, 0x02346d86UL,
+		0xdd8da257UL, 0xcaf6b614UL, 0xf37b8ad1UL, 0xe4009e92UL,
+		0x8061f35bUL, 0x971ae718UL, 0xae97dbddUL, 0xb9eccf9eUL,
+		0xca95423eUL, 0xddee567dUL, 0xe4636ab8UL, 0xf3187efbUL,
+		0x97791332UL, 0x80020771UL, 0xb98f3bb4UL, 0xaef42ff7UL,
+		0x714de026UL, 0x6636f465UL, 0x5fbbc8a0UL, 0x48c0dce3UL,
+		0x2ca1b12aUL, 0x3bdaa569UL, 0x025799acUL, 0x152c8defUL,
+		0xe4a482ecUL, 0xf3df96afUL, 0xca52aa6aUL, 0xdd29be29UL,
+		0xb948d3e0UL, 0xae33c7a3UL, 0x97befb66UL, 0x80c5ef25UL,
+		0x5f7c20f4UL, 0x480734b7UL, 0x718a0872UL, 0x66f11c31UL,
+		0x029071f8UL, 0x15eb65bbUL, 0x2c66597eUL, 0x3b1d4d3dUL,
+		0x4864c09dUL, 0x5f1fd4deUL, 0x6692e81bUL, 0x71e9fc58UL,
+		0x15889191UL, 0x02f385d2UL, 0x3b7eb917UL, 0x2c05ad54UL,
+		0xf3bc6285UL, 0xe4c776c6UL, 0xdd4a4a03UL, 0xca315e40UL,
+		0xae503389UL, 0xb92b27caUL, 0x80a61b0fUL, 0x97dd0f4cUL,
+		0xb8c70348UL, 0xafbc170bUL, 0x96312bceUL, 0x814a3f8dUL,
+		0xe52b5244UL, 0xf2504607UL, 0xcbdd7ac2UL, 0xdca66e81UL,
+		0x031fa150UL, 0x1464b513UL, 0x2de989d6UL, 0x3a929d95UL,
+		0x5ef3f05cUL, 0x4988e41fUL, 0x7005d8daUL, 0x677ecc99UL,
+		0x14074139UL, 0x037c557aUL, 0x3af169bfUL, 0x2d8a7dfcUL,
+		0x49eb1035UL, 0x5e900476UL, 0x671d38b3UL, 0x70662cf0UL,
+		0xafdfe321UL, 0xb8a4f762UL, 0x8129cba7UL, 0x9652dfe4UL,
+		0xf233b22dUL, 0xe548a66eUL, 0xdcc59aabUL, 0xcbbe8ee8UL,
+		0x3a3681ebUL, 0x2d4d95a8UL, 0x14c0a96dUL, 0x03bbbd2eUL,
+		0x67dad0e7UL, 0x70a1c4a4UL, 0x492cf861UL, 0x5e57ec22UL,
+		0x81ee23f3UL, 0x969537b0UL, 0xaf180b75UL, 0xb8631f36UL,
+		0xdc0272ffUL, 0xcb7966bcUL, 0xf2f45a79UL, 0xe58f4e3aUL,
+		0x96f6c39aUL, 0x818dd7d9UL, 0xb800eb1cUL, 0xaf7bff5fUL,
+		0xcb1a9296UL, 0xdc6186d5UL, 0xe5ecba10UL, 0xf297ae53UL,
+		0x2d2e6182UL, 0x3a5575c1UL, 0x03d84904UL, 0x14a35d47UL,
+		0x70c2308eUL, 0x67b924cdUL, 0x5e341808UL, 0x494f0c4bUL
+	},
+	{
+		0x00000000UL, 0xefc26b3eUL, 0x04f5d03dUL, 0xeb37bb03UL,
+		0x09eba07aUL, 0xe629cb44UL, 0x0d1e7047UL, 0xe2dc1b79UL,
+		0x13d740f4UL, 0xfc152bcaUL, 0x172290c9UL, 0xf8e0fbf7UL,
+		0x1a3ce08eUL, 0xf5fe8bb0UL, 0x1ec930b3UL, 0xf10b5b8dUL,
+		0x27ae81e8UL, 0xc86cead6UL, 0x235b51d5UL, 0xcc993aebUL,
+		0x2e452192UL, 0xc1874aacUL, 0x2ab0f1afUL, 0xc5729a91UL,
+		0x3479c11cUL, 0xdbbbaa22UL, 0x308c1121UL, 0xdf4e7a1fUL,
+		0x3d926166UL, 0xd2500a58UL, 0x3967b15bUL, 0xd6a5da65UL,
+		0x4f5d03d0UL, 0xa09f68eeUL, 0x4ba8d3edUL, 0xa46ab8d3UL,
+		0x46b6a3aaUL, 0xa974c894UL, 0x42437397UL, 0xad8118a9UL,
+		0x5c8a4324UL, 0xb348281aUL, 0x587f9319UL, 0xb7bdf827UL,
+		0x5561e35eUL, 0xbaa38860UL, 0x51943363UL, 0xbe56585dUL,
+		0x68f38238UL, 0x8731e906UL, 0x6c065205UL, 0x83c4393bUL,
+		0x61182242UL, 0x8eda497cUL, 0x65edf27fUL, 0x8a2f9941UL,
+		0x7b24c2ccUL, 0x94e6a9f2UL, 0x7fd112f1UL, 0x901379cfUL,
+		0x72cf62b6UL, 0x9d0d0988UL, 0x763ab28bUL, 0x99f8d9b5UL,
+		0x9eba07a0UL, 0x71786c9eUL, 0x9a4fd79dUL, 0x758dbca3UL,
+		0x9751a7daUL, 0x7893cce4UL, 0x93a477e7UL, 0x7c661cd9UL,
+		0x8d6d4754UL, 0x62af2c6aUL, 0x89989769UL, 0x665afc57UL,
+		0x8486e72eUL, 0x6b448c10UL, 0x80733713UL, 0x6fb15c2dUL,
+		0xb9148648UL, 0x56d6ed76UL, 0xbde15675UL, 0x52233d4bUL,
+		0xb0ff2632UL, 0x5f3d4d0cUL, 0xb40af60fUL, 0x5bc89d31UL,
+		0xaac3c6bcUL, 0x4501ad82UL, 0xae361681UL, 0x41f47dbfUL,
+		0xa32866c6UL, 0x4cea0df8UL, 0xa7ddb6fbUL, 0x481fddc5UL,
+		0xd1e70470UL, 0x3e256f4eUL, 0xd512d44dUL, 0x3ad0bf73UL,
+		0xd80ca40aUL, 0x37cecf34UL, 0xdcf97437UL, 0x333b1f09UL,
+		0xc2304484UL, 0x2df22fbaUL, 0xc6c594b9UL, 0x2907ff87UL,
+		0xcbdbe4feUL, 0x24198fc0UL, 0xcf2e34c3UL, 0x20ec5ffdUL,
+		0xf6498598UL, 0x198beea6UL, 0xf2bc55a5UL, 0x1d7e3e9bUL,
+		0xffa225e2UL, 0x10604edcUL, 0xfb57f5dfUL, 0x14959ee1UL,
+		0xe59ec56cUL, 0x0a5cae52UL, 0xe16b1551UL, 0x0ea97e6fUL,
+		0xec756516UL, 0x03b70e28UL, 0xe880b52bUL, 0x0742de15UL,
+		0xe6050901UL, 0x09c7623fUL, 0xe2f0d93cUL, 0x0d32b202UL,
+		0xefeea97bUL, 0x002cc245UL, 0xeb1b7946UL, 0x04d91278UL,
+		0xf5d249f5UL, 0x1a1022cbUL, 0xf12799c8UL, 0x1ee5f2f6UL,
+		0xfc39e98fUL, 0x13fb82b1UL, 0xf8cc39b2UL, 0x170e528cUL,
+		0xc1ab88e9UL, 0x2e69e3d7UL, 0xc55e58d4UL, 0x2a9c33eaUL,
+		0xc8402893UL, 0x278243adUL, 0xccb5f8aeUL, 0x23779390UL,
+		0xd27cc81dUL, 0x3dbea323UL, 0xd6891820UL, 0x394b731eUL,
+		0xdb976867UL, 0x34550359UL, 0xdf62b85aUL, 0x30a0d364UL,
+		0xa9580ad1UL, 0x469a61efUL, 0xadaddaecUL, 0x426fb1d2UL,
+		0xa0b3aaabUL, 0x4f71c195UL, 0xa4467a96UL, 0x4b8411a8UL,
+		0xba8f4a25UL, 0x554d211bUL, 0xbe7a9a18UL, 0x51b8f126UL,
+		0xb364ea5fUL, 0x5ca68161UL, 0xb7913a62UL, 0x5853515cUL,
+		0x8ef68b39UL, 0x6134e007UL, 0x8a035b04UL, 0x65c1303aUL,
+		0x871d2b43UL, 0x68df407dUL, 0x83e8fb7eUL, 0x6c2a9040UL,
+		0x9d21cbcdUL, 0x72e3a0f3UL, 0x99d41bf0UL, 0x761670ceUL,
+		0x94ca6bb7UL, 0x7b080089UL, 0x903fbb8aUL, 0x7ffdd0b4UL,
+		0x78bf0ea1UL, 0x977d659fUL, 0x7c4ade9cUL, 0x9388b5a2UL,
+		0x7154aedbUL, 0x9e96c5e5UL, 0x75a17ee6UL, 0x9a6315d8UL,
+		0x6b684e55UL, 0x84aa256bUL, 0x6f9d9e68UL, 0x805ff556UL,
+		0x6283ee2fUL, 0x8d418511UL, 0x66763e12UL, 0x89b4552cUL,
+		0x5f118f49UL, 0xb0d3e477UL, 0x5be45f74UL, 0xb426344aUL,
+		0x56fa2f33UL, 0xb938440dUL, 0x520fff0eUL, 0xbdcd9430UL,
+		0x4cc6cfbdUL, 0xa304a483UL, 0x48331f80UL, 0xa7f174beUL,
+		0x452d6fc7UL, 0xaaef04f9UL, 0x41d8bffaUL, 0xae1ad4c4UL,
+		0x37e20d71UL, 0xd820664fUL, 0x3317dd4cUL, 0xdcd5b672UL,
+		0x3e09ad0bUL, 0xd1cbc635UL, 0x3afc7d36UL, 0xd53e1608UL,
+		0x24354d85UL, 0xcbf726bbUL, 0x20c09db8UL, 0xcf02f686UL,
+		0x2ddeedffUL, 0xc21c86c1UL, 0x292b3dc2UL, 0xc6e956fcUL,
+		0x104c8c99UL, 0xff8ee7a7UL, 0x14b95ca4UL, 0xfb7b379aUL,
+		0x19a72ce3UL, 0xf66547ddUL, 0x1d52fcdeUL, 0xf29097e0UL,
+		0x039bcc6dUL, 0xec59a753UL, 0x076e1c50UL, 0xe8ac776eUL,
+		0x0a706c17UL, 0xe5b20729UL, 0x0e85bc2aUL, 0xe147d714UL
+	},
+	{
+		0x00000000UL, 0xc18edfc0UL, 0x586cb9c1UL, 0x99e26601UL,
+		0xb0d97382UL, 0x7157ac42UL, 0xe8b5ca43UL, 0x293b1583UL,
+		0xbac3e145UL, 0x7b4d3e85UL, 0xe2af5884UL, 0x23218744UL,
+		0x0a1a92c7UL, 0xcb944d07UL, 0x52762b06UL, 0x93f8f4c6UL,
+		0xaef6c4cbUL, 0x6f781b0bUL, 0xf69a7d0aUL, 0x3714a2caUL,
+		0x1e2fb749UL, 0xdfa16889UL, 0x46430e88UL, 0x87cdd148UL,
+		0x1435258eUL, 0xd5bbfa4eUL, 0x4c599c4fUL, 0x8dd7438fUL,
+		0xa4ec560cUL, 0x656289ccUL, 0xfc80efcdUL, 0x3d0e300dUL,
+		0x869c8fd7UL, 0x47125017UL, 0xdef03616UL, 0x1f7ee9d6UL,
+		0x3645fc55UL, 0xf7cb2395UL, 0x6e294594UL, 0xafa79a54UL,
+		0x3c5f6e92UL, 0xfdd1b152UL, 0x6433d753UL, 0xa5bd0893UL,
+		0x8c861d10UL, 0x4d08c2d0UL, 0xd4eaa4d1UL, 0x15647b11UL,
+		0x286a4b1cUL, 0xe9e494dcUL, 0x7006f2ddUL, 0xb1882d1dUL,
+		0x98b3389eUL, 0x593de75eUL, 0xc0df815fUL, 0x01515e9fUL,
+		0x92a9aa59UL, 0x53277599UL, 0xcac51398UL, 0x0b4bcc58UL,
+		0x2270d9dbUL, 0xe3fe061bUL, 0x7a1c601aUL, 0xbb92bfdaUL,
+		0xd64819efUL, 0x17c6c62fUL, 0x8e24a02eUL, 0x4faa7feeUL,
+		0x66916a6dUL, 0xa71fb5adUL, 0x3efdd3acUL, 0xff730c6cUL,
+		0x6c8bf8aaUL, 0xad05276aUL, 0x34e7416bUL, 0xf5699eabUL,
+		0xdc528b28UL, 0x1ddc54e8UL, 0x843e32e9UL, 0x45b0ed29UL,
+		0x78bedd24UL, 0xb93002e4UL, 0x20d264e5UL, 0xe15cbb25UL,
+		0xc867aea6UL, 0x09e97166UL, 0x900b1767UL, 0x5185c8a7UL,
+		0xc27d3c61UL, 0x03f3e3a1UL, 0x9a1185a0UL, 0x5b9f5a60UL,
+		0x72a44fe3UL, 0xb32a9023UL, 0x2ac8f622UL, 0xeb4629e2UL,
+		0x50d49638UL, 0x915a49f8UL, 0x08b82ff9UL, 0xc936f039UL,
+		0xe00de5baUL, 0x21833a7aUL, 0xb8615c7bUL, 0x79ef83bbUL,
+		0xea17777dUL, 0x2b99a8bdUL, 0xb27bcebcUL, 0x73f5117cUL,
+		0x5ace04ffUL, 0x9b40db3fUL, 0x02a2bd3eUL, 0xc32c62feUL,
+		0xfe2252f3UL, 0x3fac8d33UL, 0xa64eeb32UL, 0x67c034f2UL,
+		0x4efb2171UL, 0x8f75feb1UL, 0x169798b0UL, 0xd7194770UL,
+		0x44e1b3b6UL, 0x856f6c76UL, 0x1c8d0a77UL, 0xdd03d5b7UL,
+		0xf438c034UL, 0x35b61ff4UL, 0xac5479f5UL, 0x6ddaa635UL,
+		0x77e1359fUL, 0xb66fea5fUL, 0x2f8d8c5eUL, 0xee03539eUL,
+		0xc738461dUL, 0x06b699ddUL, 0x9f54ffdcUL, 0x5eda201cUL,
+		0xcd22d4daUL, 0x0cac0b1aUL, 0x954e6d1bUL, 0x54c0b2dbUL,
+		0x7dfba758UL, 0xbc757898UL, 0x25971e99UL, 0xe419c159UL,
+		0xd917f154UL, 0x18992e94UL, 0x817b4895UL, 0x40f59755UL,
+		0x69ce82d6UL, 0xa8405d16UL, 0x31a23b17UL, 0xf02ce4d7UL,
+		0x63d41011UL, 0xa25acfd1UL, 0x3bb8a9d0UL, 0xfa367610UL,
+		0xd30d6393UL, 0x1283bc53UL, 0x8b61da52UL, 0x4aef0592UL,
+		0xf17dba48UL, 0x30f36588UL, 0xa9110389UL, 0x689fdc49UL,
+		0x41a4c9caUL, 0x802a160aUL, 0x19c8700bUL, 0xd846afcbUL,
+		0x4bbe5b0dUL, 0x8a3084cdUL, 0x13d2e2ccUL, 0xd25c3d0cUL,
+		0xfb67288fUL, 0x3ae9f74fUL, 0xa30b914eUL, 0x62854e8eUL,
+		0x5f8b7e83UL, 0x9e05a143UL, 0x07e7c742UL, 0xc6691882UL,
+		0xef520d01UL, 0x2edcd2c1UL, 0xb73eb4c0UL, 0x76b06b00UL,
+		0xe5489fc6UL, 0x24c64006UL, 0xbd242607UL, 0x7caaf9c7UL,
+		0x5591ec44UL, 0x941f3384UL, 0x0dfd5585UL, 0xcc738a45UL,
+		0xa1a92c70UL, 0x6027f3b0UL, 0xf9c595b1UL, 0x384b4a71UL,
+		0x11705ff2UL, 0xd0fe8032UL, 0x491ce633UL, 0x889239f3UL,
+		0x1b6acd35UL, 0xdae412f5UL, 0x430674f4UL, 0x8288ab34UL,
+		0xabb3beb7UL, 0x6a3d6177UL, 0xf3df0776UL, 0x3251d8b6UL,
+		0x0f5fe8bbUL, 0xced1377bUL, 0x5733517aUL, 0x96bd8ebaUL,
+		0xbf869b39UL, 0x7e0844f9UL, 0xe7ea22f8UL, 0x2664fd38UL,
+		0xb59c09feUL, 0x7412d63eUL, 0xedf0b03fUL, 0x2c7e6fffUL,
+		0x05457a7cUL, 0xc4cba5bcUL, 0x5d29c3bdUL, 0x9ca71c7dUL,
+		0x2735a3a7UL, 0xe6bb7c67UL, 0x7f591a66UL, 0xbed7c5a6UL,
+		0x97ecd025UL, 0x56620fe5UL, 0xcf8069e4UL, 0x0e0eb624UL,
+		0x9df642e2UL, 0x5c789d22UL, 0xc59afb23UL, 0x041424e3UL,
+		0x2d2f3160UL, 0xeca1eea0UL, 0x754388a1UL, 0xb4cd5761UL,
+		0x89c3676cUL, 0x484db8acUL, 0xd1afdeadUL, 0x1021016dUL,
+		0x391a14eeUL, 0xf894cb2eUL, 0x6176ad2fUL, 0xa0f872efUL,
+		0x33008629UL, 0xf28e59e9UL, 0x6b6c3fe8UL, 0xaae2e028UL,
+		0x83d9f5abUL, 0x42572a6bUL, 0xdbb54c6aUL, 0x1a3b93aaUL
+	},
+	{
+		0x00000000UL, 0x9ba54c6fUL, 0xec3b9e9fUL, 0x779ed2f0UL,
+		0x03063b7fUL, 0x98a37710UL, 0xef3da5e0UL, 0x7498e98fUL,
+		0x060c76feUL, 0x9da93a91UL, 0xea37e861UL, 0x7192a40eUL,
+		0x050a4d81UL, 0x9eaf01eeUL, 0xe931d31eUL, 0x72949f71UL,
+		0x0c18edfcUL, 0x97bda193UL, 0xe0237363UL, 0x7b863f0cUL,
+		0x0f1ed683UL, 0x94bb9aecUL, 0xe325481cUL, 0x78800473UL,
+		0x0a149b02UL, 0x91b1d76dUL, 0xe62f059dUL, 0x7d8a49f2UL,
+		0x0912a07dUL, 0x92b7ec12UL, 0xe5293ee2UL, 0x7e8c728dUL,
+		0x1831dbf8UL, 0x83949797UL, 0xf40a4567UL, 0x6faf0908UL,
+		0x1b37e087UL, 0x8092ace8UL, 0xf70c7e18UL, 0x6ca93277UL,
+		0x1e3dad06UL, 0x8598e169UL, 0xf2063399UL, 0x69a37ff6UL,
+		0x1d3b9679UL, 0x869eda16UL, 0xf10008e6UL, 0x6aa54489UL,
+		0x14293604UL, 0x8f8c7a6bUL, 0xf812a89bUL, 0x63b7e4f4UL,
+		0x172f0d7bUL, 0x8c8a4114UL, 0xfb1493e4UL, 0x60b1df8bUL,
+		0x122540faUL, 0x89800c95UL, 0xfe1ede65UL, 0x65bb920aUL,
+		0x11237b85UL, 0x8a8637eaUL, 0xfd18e51aUL, 0x66bda975UL,
+		0x3063b7f0UL, 0xabc6fb9fUL, 0xdc58296fUL, 0x47fd6500UL,
+		0x33658c8fUL, 0xa8c0c0e0UL, 0xdf5e1210UL, 0x44fb5e7fUL,
+		0x366fc10eUL, 0xadca8d61UL, 0xda545f91UL, 0x41f113feUL,
+		0x3569fa71UL, 0xaeccb61eUL, 0xd95264eeUL, 0x42f72881UL,
+		0x3c7b5a0cUL, 0xa7de1663UL, 0xd040c493UL, 0x4be588fcUL,
+		0x3f7d6173UL, 0xa4d82d1cUL, 0xd346ffecUL, 0x48e3b383UL,
+		0x3a772cf2UL, 0xa1d2609dUL, 0xd64cb26dUL, 0x4de9fe02UL,
+		0x3971178dUL, 0xa2d45be2UL, 0xd54a8912UL, 0x4eefc57dUL,
+		0x28526c08UL, 0xb3f72067UL, 0xc469f297UL, 0x5fccbef8UL,
+		0x2b545777UL, 0xb0f11b18UL, 0xc76fc9e8UL, 0x5cca8587UL,
+		0x2e5e1af6UL, 0xb5fb5699UL, 0xc2658469UL, 0x59c0c806UL,
+		0x2d582189UL, 0xb6fd6de6UL, 0xc163bf16UL, 0x5ac6f379UL,
+		0x244a81f4UL, 0xbfefcd9bUL, 0xc8711f6bUL, 0x53d45304UL,
+		0x274cba8bUL, 0xbce9f6e4UL, 0xcb772414UL, 0x50d2687bUL,
+		0x2246f70aUL, 0xb9e3bb65UL, 0xce7d6995UL, 0x55d825faUL,
+		0x2140cc75UL, 0xbae5801aUL, 0xcd7b52eaUL, 0x56de1e85UL,
+		0x60c76fe0UL, 0xfb62238fUL, 0x8cfcf17fUL, 0x1759bd10UL,
+		0x63c1549fUL, 0xf86418f0UL, 0x8ffaca00UL, 0x145f866fUL,
+		0x66cb191eUL, 0xfd6e5571UL, 0x8af08781UL, 0x1155cbeeUL,
+		0x65cd2261UL, 0xfe686e0eUL, 0x89f6bcfeUL, 0x1253f091UL,
+		0x6cdf821cUL, 0xf77ace73UL, 0x80e41c83UL, 0x1b4150ecUL,
+		0x6fd9b963UL, 0xf47cf50cUL, 0x83e227fcUL, 0x18476b93UL,
+		0x6ad3f4e2UL, 0xf176b88dUL, 0x86e86a7dUL, 0x1d4d2612UL,
+		0x69d5cf9dUL, 0xf27083f2UL, 0x85ee5102UL, 0x1e4b1d6dUL,
+		0x78f6b418UL, 0xe353f877UL, 0x94cd2a87UL, 0x0f6866e8UL,
+		0x7bf08f67UL, 0xe055c308UL, 0x97cb11f8UL, 0x0c6e5d97UL,
+		0x7efac2e6UL, 0xe55f8e89UL, 0x92c15c79UL, 0x09641016UL,
+		0x7dfcf999UL, 0xe659b5f6UL, 0x91c76706UL, 0x0a622b69UL,
+		0x74ee59e4UL, 0xef4b158bUL, 0x98d5c77bUL, 0x03708b14UL,
+		0x77e8629bUL, 0xec4d2ef4UL, 0x9bd3fc04UL, 0x0076b06bUL,
+		0x72e22f1aUL, 0xe9476375UL, 0x9ed9b185UL, 0x057cfdeaUL,
+		0x71e41465UL, 0xea41580aUL, 0x9ddf8afaUL, 0x067ac695UL,
+		0x50a4d810UL, 0xcb01947fUL, 0xbc9f468fUL, 0x273a0ae0UL,
+		0x53a2e36fUL, 0xc807af00UL, 0xbf997df0UL, 0x243c319fUL,
+		0x56a8aeeeUL, 0xcd0de281UL, 0xba933071UL, 0x21367c1eUL,
+		0x55ae9591UL, 0xce0bd9feUL, 0xb9950b0eUL, 0x22304761UL,
+		0x5cbc35ecUL, 0xc7197983UL, 0xb087ab73UL, 0x2b22e71cUL,
+		0x5fba0e93UL, 0xc41f42fcUL, 0xb381900cUL, 0x2824dc63UL,
+		0x5ab04312UL, 0xc1150f7dUL, 0xb68bdd8dUL, 0x2d2e91e2UL,
+		0x59b6786dUL, 0xc2133402UL, 0xb58de6f2UL, 0x2e28aa9dUL,
+		0x489503e8UL, 0xd3304f87UL, 0xa4ae9d77UL, 0x3f0bd118UL,
+		0x4b933897UL, 0xd03674f8UL, 0xa7a8a608UL, 0x3c0dea67UL,
+		0x4e997516UL, 0xd53c3979UL, 0xa2a2eb89UL, 0x3907a7e6UL,
+		0x4d9f4e69UL, 0xd63a0206UL, 0xa1a4d0f6UL, 0x3a019c99UL,
+		0x448dee14UL, 0xdf28a27bUL, 0xa8b6708bUL, 0x33133ce4UL,
+		0x478bd56bUL, 0xdc2e9904UL, 0xabb04bf4UL, 0x3015079bUL,
+		0x428198eaUL, 0xd924d485UL, 0xaeba0675UL, 0x351f4a1aUL,
+		0x4187a395UL, 0xda22effaUL, 0xadbc3d0aUL, 0x36197165UL
+	},
+	{
+		0x00000000UL, 0xdd96d985UL, 0x605cb54bUL, 0xbdca6cceUL,
+		0xc0b96a96UL, 0x1d2fb313UL, 0xa0e5dfddUL, 0x7d730658UL,
+		0x5a03d36dUL, 0x87950ae8UL, 0x3a5f6626UL, 0xe7c9bfa3UL,
+		0x9abab9fbUL, 0x472c607eUL, 0xfae60cb0UL, 0x2770d535UL,
+		0xb407a6daUL, 0x69917f5fUL, 0xd45b1391UL, 0x09cdca14UL,
+		0x74becc4cUL, 0xa92815c9UL, 0x14e27907UL, 0xc974a082UL,
+		0xee0475b7UL, 0x3392ac32UL, 0x8e58c0fcUL, 0x53ce1979UL,
+		0x2ebd1f21UL, 0xf32bc6a4UL, 0x4ee1aa6aUL, 0x937773efUL,
+		0xb37e4bf5UL, 0x6ee89270UL, 0xd322febeUL, 0x0eb4273bUL,
+		0x73c72163UL, 0xae51f8e6UL, 0x139b9428UL, 0xce0d4dadUL,
+		0xe97d9898UL, 0x34eb411dUL, 0x89212dd3UL, 0x54b7f456UL,
+		0x29c4f20eUL, 0xf4522b8bUL, 0x49984745UL, 0x940e9ec0UL,
+		0x0779ed2fUL, 0xdaef34aaUL, 0x67255864UL, 0xbab381e1UL,
+		0xc7c087b9UL, 0x1a565e3cUL, 0xa79c32f2UL, 0x7a0aeb77UL,
+		0x5d7a3e42UL, 0x80ece7c7UL, 0x3d268b09UL, 0xe0b0528cUL,
+		0x9dc354d4UL, 0x40558d51UL, 0xfd9fe19fUL, 0x2009381aUL,
+		0xbd8d91abUL, 0x601b482eUL, 0xddd124e0UL, 0x0047fd65UL,
+		0x7d34fb3dUL, 0xa0a222b8UL, 0x1d684e76UL, 0xc0fe97f3UL,
+		0xe78e42c6UL, 0x3a189b43UL, 0x87d2f78dUL, 0x5a442e08UL,
+		0x27372850UL, 0xfaa1f1d5UL, 0x476b9d1bUL, 0x9afd449eUL,
+		0x098a3771UL, 0xd41ceef4UL, 0x69d6823aUL, 0xb4405bbfUL,
+		0xc9335de7UL, 0x14a58462UL, 0xa96fe8acUL, 0x74f93129UL,
+		0x5389e41cUL, 0x8e1f3d99UL, 0x33d55157UL, 0xee4388d2UL,
+		0x93308e8aUL, 0x4ea6570fUL, 0xf36c3bc1UL, 0x2efae244UL,
+		0x0ef3da5eUL, 0xd36503dbUL, 0x6eaf6f15UL, 0xb339b690UL,
+		0xce4ab0c8UL, 0x13dc694dUL, 0xae160583UL, 0x7380dc06UL,
+		0x54f00933UL, 0x8966d0b6UL, 0x34acbc78UL, 0xe93a65fdUL,
+		0x944963a5UL, 0x49dfba20UL, 0xf415d6eeUL, 0x29830f6bUL,
+		0xbaf47c84UL, 0x6762a501UL, 0xdaa8c9cfUL, 0x073e104aUL,
+		0x7a4d1612UL, 0xa7dbcf97UL, 0x1a11a359UL, 0xc7877adcUL,
+		0xe0f7afe9UL, 0x3d61766cUL, 0x80ab1aa2UL, 0x5d3dc327UL,
+		0x204ec57fUL, 0xfdd81cfaUL, 0x40127034UL, 0x9d84a9b1UL,
+		0xa06a2517UL, 0x7dfcfc92UL, 0xc036905cUL, 0x1da049d9UL,
+		0x60d34f81UL, 0xbd459604UL, 0x008ffacaUL, 0xdd19234fUL,
+		0xfa69f67aUL, 0x27ff2fffUL, 0x9a354331UL, 0x47a39ab4UL,
+		0x3ad09cecUL, 0xe7464569UL, 0x5a8c29a7UL, 0x871af022UL,
+		0x146d83cdUL, 0xc9fb5a48UL, 0x74313686UL, 0xa9a7ef03UL,
+		0xd4d4e95bUL, 0x094230deUL, 0xb4885c10UL, 0x691e8595UL,
+		0x4e6e50a0UL, 0x93f88925UL, 0x2e32e5ebUL, 0xf3a43c6eUL,
+		0x8ed73a36UL, 0x5341e3b3UL, 0xee8b8f7dUL, 0x331d56f8UL,
+		0x13146ee2UL, 0xce82b767UL, 0x7348dba9UL, 0xaede022cUL,
+		0xd3ad0474UL, 0x0e3bddf1UL, 0xb3f1b13fUL, 0x6e6768baUL,
+		0x4917bd8fUL, 0x9481640aUL, 0x294b08c4UL, 0xf4ddd141UL,
+		0x89aed719UL, 0x54380e9cUL, 0xe9f26252UL, 0x3464bbd7UL,
+		0xa713c838UL, 0x7a8511bdUL, 0xc74f7d73UL, 0x1ad9a4f6UL,
+		0x67aaa2aeUL, 0xba3c7b2bUL, 0x07f617e5UL, 0xda60ce60UL,
+		0xfd101b55UL, 0x2086c2d0UL, 0x9d4cae1eUL, 0x40da779bUL,
+		0x3da971c3UL, 0xe03fa846UL, 0x5df5c488UL, 0x80631d0dUL,
+		0x1de7b4bcUL, 0xc0716d39UL, 0x7dbb01f7UL, 0xa02dd872UL,
+		0xdd5ede2aUL, 0x00c807afUL, 0xbd026b61UL, 0x6094b2e4UL,
+		0x47e467d1UL, 0x9a72be54UL, 0x27b8d29aUL, 0xfa2e0b1fUL,
+		0x875d0d47UL, 0x5acbd4c2UL, 0xe701b80cUL, 0x3a976189UL,
+		0xa9e01266UL, 0x7476cbe3UL, 0xc9bca72dUL, 0x142a7ea8UL,
+		0x695978f0UL, 0xb4cfa175UL, 0x0905cdbbUL, 0xd493143eUL,
+		0xf3e3c10bUL, 0x2e75188eUL, 0x93bf7440UL, 0x4e29adc5UL,
+		0x335aab9dUL, 0xeecc7218UL, 0x53061ed6UL, 0x8e90c753UL,
+		0xae99ff49UL, 0x730f26ccUL, 0xcec54a02UL, 0x13539387UL,
+		0x6e2095dfUL, 0xb3b64c5aUL, 0x0e7c2094UL, 0xd3eaf911UL,
+		0xf49a2c24UL, 0x290cf5a1UL, 0x94c6996fUL, 0x495040eaUL,
+		0x342346b2UL, 0xe9b59f37UL, 0x547ff3f9UL, 0x89e92a7cUL,
+		0x1a9e5993UL, 0xc7088016UL, 0x7ac2ecd8UL, 0xa754355dUL,
+		0xda273305UL, 0x07b1ea80UL, 0xba7b864eUL, 0x67ed5fcbUL,
+		0x409d8afeUL, 0x9d0b537bUL, 0x20c13fb5UL, 0xfd57e630UL,
+		0x8024e068UL, 0x5db239edUL, 0xe0785523UL, 0x3dee8ca6UL
+	},
+	{
+		0x00000000UL, 0x9d0fe176UL, 0xe16ec4adUL, 0x7c6125dbUL,
+		0x19ac8f1bUL, 0x84a36e6dUL, 0xf8c24bb6UL, 0x65cdaac0UL,
+		0x33591e36UL, 0xae56ff40UL, 0xd237da9bUL, 0x4f383bedUL,
+		0x2af5912dUL, 0xb7fa705bUL, 0xcb9b5580UL, 0x5694b4f6UL,
+		0x66b23c6cUL, 0xfbbddd1aUL, 0x87dcf8c1UL, 0x1ad319b7UL,
+		0x7f1eb377UL, 0xe2115201UL, 0x9e7077daUL, 0x037f96acUL,
+		0x55eb225aUL, 0xc8e4c32cUL, 0xb485e6f7UL, 0x298a0781UL,
+		0x4c47ad41UL, 0xd1484c37UL, 0xad2969ecUL, 0x3026889aUL,
+		0xcd6478d8UL, 0x506b99aeUL, 0x2c0abc75UL, 0xb1055d03UL,
+		0xd4c8f7c3UL, 0x49c716b5UL, 0x35a6336eUL, 0xa8a9d218UL,
+		0xfe3d66eeUL, 0x63328798UL, 0x1f53a243UL, 0x825c4335UL,
+		0xe791e9f5UL, 0x7a9e0883UL, 0x06ff2d58UL, 0x9bf0cc2eUL,
+		0xabd644b4UL, 0x36d9a5c2UL, 0x4ab88019UL, 0xd7b7616fUL,
+		0xb27acbafUL, 0x2f752ad9UL, 0x53140f02UL, 0xce1bee74UL,
+		0x988f5a82UL, 0x0580bbf4UL, 0x79e19e2fUL, 0xe4ee7f59UL,
+		0x8123d599UL, 0x1c2c34efUL, 0x604d1134UL, 0xfd42f042UL,
+		0x41b9f7f1UL, 0xdcb61687UL, 0xa0d7335cUL, 0x3dd8d22aUL,
+		0x581578eaUL, 0xc51a999cUL, 0xb97bbc47UL, 0x24745d31UL,
+		0x72e0e9c7UL, 0xefef08b1UL, 0x938e2d6aUL, 0x0e81cc1cUL,
+		0x6b4c66dcUL, 0xf64387aaUL, 0x8a22a271UL, 0x172d4307UL,
+		0x270bcb9dUL, 0xba042aebUL, 0xc6650f30UL, 0x5b6aee46UL,
+		0x3ea74486UL, 0xa3a8a5f0UL, 0xdfc9802bUL, 0x42c6615dUL,
+		0x1452d5abUL, 0x895d34ddUL, 0xf53c1106UL, 0x6833f070UL,
+		0x0dfe5ab0UL, 0x90f1bbc6UL, 0xec909e1dUL, 0x719f7f6bUL,
+		0x8cdd8f29UL, 0x11d26e5fUL, 0x6db34b84UL, 0xf0bcaaf2UL,
+		0x95710032UL, 0x087ee144UL, 0x741fc49fUL, 0xe91025e9UL,
+		0xbf84911fUL, 0x228b7069UL, 0x5eea55b2UL, 0xc3e5b4c4UL,
+		0xa6281e04UL, 0x3b27ff72UL, 0x4746daa9UL, 0xda493bdfUL,
+		0xea6fb345UL, 0x77605233UL, 0x0b0177e8UL, 0x960e969eUL,
+		0xf3c33c5eUL, 0x6eccdd28UL, 0x12adf8f3UL, 0x8fa21985UL,
+		0xd936ad73UL, 0x44394c05UL, 0x385869deUL, 0xa55788a8UL,
+		0xc09a2268UL, 0x5d95c31eUL, 0x21f4e6c5UL, 0xbcfb07b3UL,
+		0x8373efe2UL, 0x1e7c0e94UL, 0x621d2b4fUL, 0xff12ca39UL,
+		0x9adf60f9UL, 0x07d0818fUL, 0x7bb1a454UL, 0xe6be4522UL,
+		0xb02af1d4UL, 0x2d2510a2UL, 0x51443579UL, 0xcc4bd40fUL,
+		0xa9867ecfUL, 0x34899fb9UL, 0x48e8ba62UL, 0xd5e75b14UL,
+		0xe5c1d38eUL, 0x78ce32f8UL, 0x04af1723UL, 0x99a0f655UL,
+		0xfc6d5c95UL, 0x6162bde3UL, 0x1d039838UL, 0x800c794eUL,
+		0xd698cdb8UL, 0x4b972cceUL, 0x37f60915UL, 0xaaf9e863UL,
+		0xcf3442a3UL, 0x523ba3d5UL, 0x2e5a860eUL, 0xb3556778UL,
+		0x4e17973aUL, 0xd318764cUL, 0xaf795397UL, 0x3276b2e1UL,
+		0x57bb1821UL, 0xcab4f957UL, 0xb6d5dc8cUL, 0x2bda3dfaUL,
+		0x7d4e890cUL, 0xe041687aUL, 0x9c204da1UL, 0x012facd7UL,
+		0x64e20617UL, 0xf9ede761UL, 0x858cc2baUL, 0x188323ccUL,
+		0x28a5ab56UL, 0xb5aa4a20UL, 0xc9cb6ffbUL, 0x54c48e8dUL,
+		0x3109244dUL, 0xac06c53bUL, 0xd067e0e0UL, 0x4d680196UL,
+		0x1bfcb560UL, 0x86f35416UL, 0xfa9271cdUL, 0x679d90bbUL,
+		0x02503a7bUL, 0x9f5fdb0dUL, 0xe33efed6UL, 0x7e311fa0UL,
+		0xc2ca1813UL, 0x5fc5f965UL, 0x23a4dcbeUL, 0xbeab3dc8UL,
+		0xdb669708UL, 0x4669767eUL, 0x3a0853a5UL, 0xa707b2d3UL,
+		0xf1930625UL, 0x6c9ce753UL, 0x10fdc288UL, 0x8df223feUL,
+		0xe83f893eUL, 0x75306848UL, 0x09514d93UL, 0x945eace5UL,
+		0xa478247fUL, 0x3977c509UL, 0x4516e0d2UL, 0xd81901a4UL,
+		0xbdd4ab64UL, 0x20db4a12UL, 0x5cba6fc9UL, 0xc1b58ebfUL,
+		0x97213a49UL, 0x0a2edb3fUL, 0x764ffee4UL, 0xeb401f92UL,
+		0x8e8db552UL, 0x13825424UL, 0x6fe371ffUL, 0xf2ec9089UL,
+		0x0fae60cbUL, 0x92a181bdUL, 0xeec0a466UL, 0x73cf4510UL,
+		0x1602efd0UL, 0x8b0d0ea6UL, 0xf76c2b7dUL, 0x6a63ca0bUL,
+		0x3cf77efdUL, 0xa1f89f8bUL, 0xdd99ba50UL, 0x40965b26UL,
+		0x255bf1e6UL, 0xb8541090UL, 0xc435354bUL, 0x593ad43dUL,
+		0x691c5ca7UL, 0xf413bdd1UL, 0x8872980aUL, 0x157d797cUL,
+		0x70b0d3bcUL, 0xedbf32caUL, 0x91de1711UL, 0x0cd1f667UL,
+		0x5a454291UL, 0xc74aa3e7UL, 0xbb2b863cUL, 0x2624674aUL,
+		0x43e9cd8aUL, 0xdee62cfcUL, 0xa2870927UL, 0x3f88e851UL
+	},
+	{
+		0x00000000UL, 0xb9fbdbe8UL, 0xa886b191UL, 0x117d6a79UL,
+		0x8a7c6563UL, 0x3387be8bUL, 0x22fad4f2UL, 0x9b010f1aUL,
+		0xcf89cc87UL, 0x7672176fUL, 0x670f7d16UL, 0xdef4a6feUL,
+		0x45f5a9e4UL, 0xfc0e720cUL, 0xed731875UL, 0x5488c39dUL,
+		0x44629f4fUL, 0xfd9944a7UL, 0xece42edeUL, 0x551ff536UL,
+		0xce1efa2cUL, 0x77e521c4UL, 0x66984bbdUL, 0xdf639055UL,
+		0x8beb53c8UL, 0x32108820UL, 0x236de259UL, 0x9a9639b1UL,
+		0x019736abUL, 0xb86ced43UL, 0xa911873aUL, 0x10ea5cd2UL,
+		0x88c53e9eUL, 0x313ee576UL, 0x20438f0fUL, 0x99b854e7UL,
+		0x02b95bfdUL, 0xbb428015UL, 0xaa3fea6cUL, 0x13c43184UL,
+		0x474cf219UL, 0xfeb729f1UL, 0xefca4388UL, 0x56319860UL,
+		0xcd30977aUL, 0x74cb4c92UL, 0x65b626ebUL, 0xdc4dfd03UL,
+		0xcca7a1d1UL, 0x755c7a39UL, 0x64211040UL, 0xdddacba8UL,
+		0x46dbc4b2UL, 0xff201f5aUL, 0xee5d7523UL, 0x57a6aecbUL,
+		0x032e6d56UL, 0xbad5b6beUL, 0xaba8dcc7UL, 0x1253072fUL,
+		0x89520835UL, 0x30a9d3ddUL, 0x21d4b9a4UL, 0x982f624cUL,
+		0xcafb7b7dUL, 0x7300a095UL, 0x627dcaecUL, 0xdb861104UL,
+		0x40871e1eUL, 0xf97cc5f6UL, 0xe801af8fUL, 0x51fa7467UL,
+		0x0572b7faUL, 0xbc896c12UL, 0xadf4066bUL, 0x140fdd83UL,
+		0x8f0ed299UL, 0x36f50971UL, 0x27886308UL, 0x9e73b8e0UL,
+		0x8e99e432UL, 0x37623fdaUL, 0x261f55a3UL, 0x9fe48e4bUL,
+		0x04e58151UL, 0xbd1e5ab9UL, 0xac6330c0UL, 0x1598eb28UL,
+		0x411028b5UL, 0xf8ebf35dUL, 0xe9969924UL, 0x506d42ccUL,
+		0xcb6c4dd6UL, 0x7297963eUL, 0x63eafc47UL, 0xda1127afUL,
+		0x423e45e3UL, 0xfbc59e0bUL, 0xeab8f472UL, 0x53432f9aUL,
+		0xc8422080UL, 0x71b9fb68UL, 0x60c49111UL, 0xd93f4af9UL,
+		0x8db78964UL, 0x344c528cUL, 0x253138f5UL, 0x9ccae31dUL,
+		0x07cbec07UL, 0xbe3037efUL, 0xaf4d5d96UL, 0x16b6867eUL,
+		0x065cdaacUL, 0xbfa70144UL, 0xaeda6b3dUL, 0x1721b0d5UL,
+		0x8c20bfcfUL, 0x35db6427UL, 0x24a60e5eUL, 0x9d5dd5b6UL,
+		0xc9d5162bUL, 0x702ecdc3UL, 0x6153a7baUL, 0xd8a87c52UL,
+		0x43a97348UL, 0xfa52a8a0UL, 0xeb2fc2d9UL, 0x52d41931UL,
+		0x4e87f0bbUL, 0xf77c2b53UL, 0xe601412aUL, 0x5ffa9ac2UL,
+		0xc4fb95d8UL, 0x7d004e30UL, 0x6c7d2449UL, 0xd586ffa1UL,
+		0x810e3c3cUL, 0x38f5e7d4UL, 0x29888dadUL, 0x90735645UL,
+		0x0b72595fUL, 0xb28982b7UL, 0xa3f4e8ceUL, 0x1a0f3326UL,
+		0x0ae56ff4UL, 0xb31eb41cUL, 0xa263de65UL, 0x1b98058dUL,
+		0x80990a97UL, 0x3962d17fUL, 0x281fbb06UL, 0x91e460eeUL,
+		0xc56ca373UL, 0x7c97789bUL, 0x6dea12e2UL, 0xd411c90aUL,
+		0x4f10c610UL, 0xf6eb1df8UL, 0xe7967781UL, 0x5e6dac69UL,
+		0xc642ce25UL, 0x7fb915cdUL, 0x6ec47fb4UL, 0xd73fa45cUL,
+		0x4c3eab46UL, 0xf5c570aeUL, 0xe4b81ad7UL, 0x5d43c13fUL,
+		0x09cb02a2UL, 0xb030d94aUL, 0xa14db333UL, 0x18b668dbUL,
+		0x83b767c1UL, 0x3a4cbc29UL, 0x2b31d650UL, 0x92ca0db8UL,
+		0x8220516aUL, 0x3bdb8a82UL, 0x2aa6e0fbUL, 0x935d3b13UL,
+		0x085c3409UL, 0xb1a7efe1UL, 0xa0da8598UL, 0x19215e70UL,
+		0x4da99dedUL, 0xf4524605UL, 0xe52f2c7cUL, 0x5cd4f794UL,
+		0xc7d5f88eUL, 0x7e2e2366UL, 0x6f53491fUL, 0xd6a892f7UL,
+		0x847c8bc6UL, 0x3d87502eUL, 0x2cfa3a57UL, 0x9501e1bfUL,
+		0x0e00eea5UL, 0xb7fb354dUL, 0xa6865f34UL, 0x1f7d84dcUL,
+		0x4bf54741UL, 0xf20e9ca9UL, 0xe373f6d0UL, 0x5a882d38UL,
+		0xc1892222UL, 0x7872f9caUL, 0x690f93b3UL, 0xd0f4485bUL,
+		0xc01e1489UL, 0x79e5cf61UL, 0x6898a518UL, 0xd1637ef0UL,
+		0x4a6271eaUL, 0xf399aa02UL, 0xe2e4c07bUL, 0x5b1f1b93UL,
+		0x0f97d80eUL, 0xb66c03e6UL, 0xa711699fUL, 0x1eeab277UL,
+		0x85ebbd6dUL, 0x3c106685UL, 0x2d6d0cfcUL, 0x9496d714UL,
+		0x0cb9b558UL, 0xb5426eb0UL, 0xa43f04c9UL, 0x1dc4df21UL,
+		0x86c5d03bUL, 0x3f3e0bd3UL, 0x2e4361aaUL, 0x97b8ba42UL,
+		0xc33079dfUL, 0x7acba237UL, 0x6bb6c84eUL, 0xd24d13a6UL,
+		0x494c1cbcUL, 0xf0b7c754UL, 0xe1caad2dUL, 0x583176c5UL,
+		0x48db2a17UL, 0xf120f1ffUL, 0xe05d9b86UL, 0x59a6406eUL,
+		0xc2a74f74UL, 0x7b5c949cUL, 0x6a21fee5UL, 0xd3da250dUL,
+		0x8752e690UL, 0x3ea93d78UL, 0x2fd45701UL, 0x962f8ce9UL,
+		0x0d2e83f3UL, 0xb4d5581bUL, 0xa5a83262UL, 0x1c53e98aUL
+	},
+	{
+		0x00000000UL, 0xae689191UL, 0x87a02563UL, 0x29c8b4f2UL,
+		0xd4314c87UL, 0x7a59dd16UL, 0x539169e4UL, 0xfdf9f875UL,
+		0x73139f4fUL, 0xdd7b0edeUL, 0xf4b3ba2cUL, 0x5adb2bbdUL,
+		0xa722d3c8UL, 0x094a4259UL, 0x2082f6abUL, 0x8eea673aUL,
+		0xe6273e9eUL, 0x484faf0fUL, 0x61871bfdUL, 0xcfef8a6cUL,
+		0x32167219UL, 0x9c7ee388UL, 0xb5b6577aUL, 0x1bdec6ebUL,
+		0x9534a1d1UL, 0x3b5c3040UL, 0x129484b2UL, 0xbcfc1523UL,
+		0x4105ed56UL, 0xef6d7cc7UL, 0xc6a5c835UL, 0x68cd59a4UL,
+		0x173f7b7dUL, 0xb957eaecUL, 0x909f5e1eUL, 0x3ef7cf8fUL,
+		0xc30e37faUL, 0x6d66a66bUL, 0x44ae1299UL, 0xeac68308UL,
+		0x642ce432UL, 0xca4475a3UL, 0xe38cc151UL, 0x4de450c0UL,
+		0xb01da8b5UL, 0x1e753924UL, 0x37bd8dd6UL, 0x99d51c47UL,
+		0xf11845e3UL, 0x5f70d472UL, 0x76b86080UL, 0xd8d0f111UL,
+		0x25290964UL, 0x8b4198f5UL, 0xa2892c07UL, 0x0ce1bd96UL,
+		0x820bdaacUL, 0x2c634b3dUL, 0x05abffcfUL, 0xabc36e5eUL,
+		0x563a962bUL, 0xf85207baUL, 0xd19ab348UL, 0x7ff222d9UL,
+		0x2e7ef6faUL, 0x8016676bUL, 0xa9ded399UL, 0x07b64208UL,
+		0xfa4fba7dUL, 0x54272becUL, 0x7def9f1eUL, 0xd3870e8fUL,
+		0x5d6d69b5UL, 0xf305f824UL, 0xdacd4cd6UL, 0x74a5dd47UL,
+		0x895c2532UL, 0x2734b4a3UL, 0x0efc0051UL, 0xa09491c0UL,
+		0xc859c864UL, 0x663159f5UL, 0x4ff9ed07UL, 0xe1917c96UL,
+		0x1c6884e3UL, 0xb2001572UL, 0x9bc8a180UL, 0x35a03011UL,
+		0xbb4a572bUL, 0x1522c6baUL, 0x3cea7248UL, 0x9282e3d9UL,
+		0x6f7b1bacUL, 0xc1138a3dUL, 0xe8db3ecfUL, 0x46b3af5eUL,
+		0x39418d87UL, 0x97291c16UL, 0xbee1a8e4UL, 0x10893975UL,
+		0xed70c100UL, 0x43185091UL, 0x6ad0e463UL, 0xc4b875f2UL,
+		0x4a5212c8UL, 0xe43a8359UL, 0xcdf237abUL, 0x639aa63aUL,
+		0x9e635e4fUL, 0x300bcfdeUL, 0x19c37b2cUL, 0xb7abeabdUL,
+		0xdf66b319UL, 0x710e2288UL, 0x58c6967aUL, 0xf6ae07ebUL,
+		0x0b57ff9eUL, 0xa53f6e0fUL, 0x8cf7dafdUL, 0x229f4b6cUL,
+		0xac752c56UL, 0x021dbdc7UL, 0x2bd50935UL, 0x85bd98a4UL,
+		0x784460d1UL, 0xd62cf140UL, 0xffe445b2UL, 0x518cd423UL,
+		0x5cfdedf4UL, 0xf2957c65UL, 0xdb5dc897UL, 0x75355906UL,
+		0x88cca173UL, 0x26a430e2UL, 0x0f6c8410UL, 0xa1041581UL,
+		0x2fee72bbUL, 0x8186e32aUL, 0xa84e57d8UL, 0x0626c649UL,
+		0xfbdf3e3cUL, 0x55b7afadUL, 0x7c7f1b5fUL, 0xd2178aceUL,
+		0xbadad36aUL, 0x14b242fbUL, 0x3d7af609UL, 0x93126798UL,
+		0x6eeb9fedUL, 0xc0830e7cUL, 0xe94bba8eUL, 0x47232b1fUL,
+		0xc9c94c25UL, 0x67a1ddb4UL, 0x4e696946UL, 0xe001f8d7UL,
+		0x1df800a2UL, 0xb3909133UL, 0x9a5825c1UL, 0x3430b450UL,
+		0x4bc29689UL, 0xe5aa0718UL, 0xcc62b3eaUL, 0x620a227bUL,
+		0x9ff3da0eUL, 0x319b4b9fUL, 0x1853ff6dUL, 0xb63b6efcUL,
+		0x38d109c6UL, 0x96b99857UL, 0xbf712ca5UL, 0x1119bd34UL,
+		0xece04541UL, 0x4288d4d0UL, 0x6b406022UL, 0xc528f1b3UL,
+		0xade5a817UL, 0x038d3986UL, 0x2a458d74UL, 0x842d1ce5UL,
+		0x79d4e490UL, 0xd7bc7501UL, 0xfe74c1f3UL, 0x501c5062UL,
+		0xdef63758UL, 0x709ea6c9UL, 0x5956123bUL, 0xf73e83aaUL,
+		0x0ac77bdfUL, 0xa4afea4eUL, 0x8d675ebcUL, 0x230fcf2dUL,
+		0x72831b0eUL, 0xdceb8a9fUL, 0xf5233e6dUL, 0x5b4baffcUL,
+		0xa6b25789UL, 0x08dac618UL, 0x211272eaUL, 0x8f7ae37bUL,
+		0x01908441UL, 0xaff815d0UL, 0x8630a122UL, 0x285830b3UL,
+		0xd5a1c8c6UL, 0x7bc95957UL, 0x5201eda5UL, 0xfc697c34UL,
+		0x94a42590UL, 0x3accb401UL, 0x130400f3UL, 0xbd6c9162UL,
+		0x40956917UL, 0xeefdf886UL, 0xc7354c74UL, 0x695ddde5UL,
+		0xe7b7badfUL, 0x49df2b4eUL, 0x60179fbcUL, 0xce7f0e2dUL,
+		0x3386f658UL, 0x9dee67c9UL, 0xb426d33bUL, 0x1a4e42aaUL,
+		0x65bc6073UL, 0xcbd4f1e2UL, 0xe21c4510UL, 0x4c74d481UL,
+		0xb18d2cf4UL, 0x1fe5bd65UL, 0x362d0997UL, 0x98459806UL,
+		0x16afff3cUL, 0xb8c76eadUL, 0x910fda5fUL, 0x3f674bceUL,
+		0xc29eb3bbUL, 0x6cf6222aUL, 0x453e96d8UL, 0xeb560749UL,
+		0x839b5eedUL, 0x2df3cf7cUL, 0x043b7b8eUL, 0xaa53ea1fUL,
+		0x57aa126aUL, 0xf9c283fbUL, 0xd00a3709UL, 0x7e62a698UL,
+		0xf088c1a2UL, 0x5ee05033UL, 0x7728e4c1UL, 0xd9407550UL,
+		0x24b98d25UL, 0x8ad11cb4UL, 0xa319a846UL, 0x0d7139d7UL
+	}
+};
+
 /* Table of the CRC-32 of all 8-bit messages.
  */
 uint32_t assorted_crc32_table[ 256 ];
 
-/* Value to indicate the CRC-32 table been computed
+/* Value to indicate the CRC-32 table was initialized with a specific polynomial
  */
 int assorted_crc32_table_computed = 0;
 
+/* Tables of the CRC-32 of all 8-bit messages followed by 1 to 15 zero bytes
+ * used to process 8 or 16 bytes at a time
+ */
+uint32_t assorted_crc32_slicing_table[ 16 ][ 256 ];
+
+/* Value to indicate the CRC-32 slicing table was initialized with a specific polynomial
+ */
+int assorted_crc32_slicing_table_computed = 0;
+
 /* Initializes the internal CRC-32 table
  * The table speeds up the CRC-32 calculation
+ * Without initialization the constant table of polynomial 0xedb88320 is used
+ * This function is not thread-safe, call it before calculating CRC-32 from multiple threads
  * Use the reversed polynomial
  */
 void assorted_crc32_initialize_table(
@@ -86,6 +1175,247 @@ void assorted_crc32_initialize_table(
 	assorted_crc32_table_computed = 1;
 }
 
+/* Computes CRC-32 slicing tables
+ * The first table is the same as the CRC-32 table, every next table
+ * contains the CRC-32 of the previous table followed by a zero byte
+ * Use the reversed polynomial
+ */
+static void assorted_crc32_compute_slicing_table(
+             uint32_t slicing_table[ 16 ][ 256 ],
+             uint32_t polynomial )
+{
+	uint32_t crc32             = 0;
+	uint16_t crc32_table_index = 0;
+	uint8_t bit_iterator       = 0;
+	uint8_t table_index        = 0;
+
+	for( crc32_table_index = 0;
+	     crc32_table_index < 256;
+	     crc32_table_index++ )
+	{
+		crc32 = (uint32_t) crc32_table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( crc32 & 1 )
+			{
+				crc32 = polynomial ^ ( crc32 >> 1 );
+			}
+			else
+			{
+				crc32 = crc32 >> 1;
+			}
+		}
+		slicing_table[ 0 ][ crc32_table_index ] = crc32;
+	}
+	for( table_index = 1;
+	     table_index < 16;
+	     table_index++ )
+	{
+		for( crc32_table_index = 0;
+		     crc32_table_index < 256;
+		     crc32_table_index++ )
+		{
+			crc32 = slicing_table[ table_index - 1 ][ crc32_table_index ];
+
+			slicing_table[ table_index ][ crc32_table_index ] = slicing_table[ 0 ][ crc32 & 0x000000ffUL ] ^ ( crc32 >> 8 );
+		}
+	}
+}
+
+/* Initializes the internal CRC-32 slicing table
+ * Without initialization the constant tables of polynomial 0xedb88320 are used
+ * This function is not thread-safe, call it before calculating CRC-32 from multiple threads
+ * Use the reversed polynomial
+ */
+void assorted_crc32_initialize_slicing_table(
+      uint32_t polynomial )
+{
+	assorted_crc32_compute_slicing_table(
+	 assorted_crc32_slicing_table,
+	 polynomial );
+
+	assorted_crc32_slicing_table_computed = 1;
+}
+
+/* Computes the tables to shift a CRC-32 over a number of zero bytes
+ * Since the shift is linear it is the XOR of the shifts of the individual bytes
+ * of the CRC-32, hence a table per byte
+ */
+static void assorted_crc32_compute_shift_table(
+             uint32_t shift_table[ 4 ][ 256 ],
+             size_t size,
+             uint32_t polynomial )
+{
+	uint32_t power_of_x        = 0;
+	uint16_t crc32_table_index = 0;
+	uint8_t table_index        = 0;
+
+	/* Determine x^(8 * size) by combining with an empty CRC-32 of size bytes
+	 */
+	assorted_crc32_combine(
+	 &power_of_x,
+	 0x80000000UL,
+	 0,
+	 (size64_t) size,
+	 polynomial,
+	 NULL );
+
+	for( table_index = 0;
+	     table_index < 4;
+	     table_index++ )
+	{
+		for( crc32_table_index = 0;
+		     crc32_table_index < 256;
+		     crc32_table_index++ )
+		{
+			shift_table[ table_index ][ crc32_table_index ] = assorted_crc32_multiply_modulo(
+			                                                   power_of_x,
+			                                                   (uint32_t) crc32_table_index << ( 8 * table_index ),
+			                                                   polynomial );
+		}
+	}
+}
+
+/* Shifts a CRC-32 using a shift table
+ */
+#define assorted_crc32_shift( shift_table, crc32 ) \
+	( shift_table[ 0 ][ ( crc32 ) & 0x000000ffUL ] \
+	^ shift_table[ 1 ][ ( ( crc32 ) >> 8 ) & 0x000000ffUL ] \
+	^ shift_table[ 2 ][ ( ( crc32 ) >> 16 ) & 0x000000ffUL ] \
+	^ shift_table[ 3 ][ ( crc32 ) >> 24 ] )
+
+/* Computes the tables of a polynomial
+ * Use the reversed polynomial
+ */
+static void assorted_crc32_compute_polynomial_table(
+             assorted_crc32_polynomial_table_t *polynomial_table,
+             uint32_t polynomial )
+{
+	assorted_crc32_compute_slicing_table(
+	 polynomial_table->slicing_table,
+	 polynomial );
+
+	assorted_crc32_compute_shift_table(
+	 polynomial_table->long_shift_table,
+	 ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE,
+	 polynomial );
+
+	assorted_crc32_compute_shift_table(
+	 polynomial_table->short_shift_table,
+	 ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE,
+	 polynomial );
+
+	polynomial_table->polynomial = polynomial;
+}
+
+/* The cached polynomial tables
+ */
+static assorted_crc32_polynomial_table_t assorted_crc32_cached_tables[ ASSORTED_CRC32_NUMBER_OF_CACHED_TABLES ];
+
+/* The number of cached polynomial tables
+ */
+static int assorted_crc32_number_of_cached_tables = 0;
+
+/* The lock that serializes the lookup and computation of the cached polynomial tables
+ * A statically initialized lock is used since there is no other place to initialize it once
+ */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( WINAPI ) && ( WINVER >= 0x0600 )
+static SRWLOCK assorted_crc32_cached_tables_lock = SRWLOCK_INIT;
+
+#define assorted_crc32_cached_tables_lock_grab() \
+	AcquireSRWLockExclusive( &assorted_crc32_cached_tables_lock )
+
+#define assorted_crc32_cached_tables_lock_release() \
+	ReleaseSRWLockExclusive( &assorted_crc32_cached_tables_lock )
+
+#elif defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+static pthread_mutex_t assorted_crc32_cached_tables_lock = PTHREAD_MUTEX_INITIALIZER;
+
+#define assorted_crc32_cached_tables_lock_grab() \
+	pthread_mutex_lock( &assorted_crc32_cached_tables_lock )
+
+#define assorted_crc32_cached_tables_lock_release() \
+	pthread_mutex_unlock( &assorted_crc32_cached_tables_lock )
+
+#else
+#define assorted_crc32_cached_tables_lock_grab()
+#define assorted_crc32_cached_tables_lock_release()
+
+#endif
+
+/* Retrieves the tables of a polynomial
+ * The tables are computed on first use and cached, cached tables are never
+ * replaced hence they can be used by multiple threads
+ * Use the reversed polynomial
+ * Returns 1 if successful, 0 if the cache is full or -1 on error
+ */
+int assorted_crc32_get_polynomial_table(
+     uint32_t polynomial,
+     const assorted_crc32_polynomial_table_t **polynomial_table,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc32_get_polynomial_table";
+	int result            = 0;
+	int table_index       = 0;
+
+	if( polynomial_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid polynomial table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( polynomial & 0x80000000UL ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported polynomial.",
+		 function );
+
+		return( -1 );
+	}
+	assorted_crc32_cached_tables_lock_grab();
+
+	for( table_index = 0;
+	     table_index < assorted_crc32_number_of_cached_tables;
+	     table_index++ )
+	{
+		if( assorted_crc32_cached_tables[ table_index ].polynomial == polynomial )
+		{
+			*polynomial_table = &( assorted_crc32_cached_tables[ table_index ] );
+
+			result = 1;
+
+			break;
+		}
+	}
+	if( ( result == 0 )
+	 && ( assorted_crc32_number_of_cached_tables < ASSORTED_CRC32_NUMBER_OF_CACHED_TABLES ) )
+	{
+		assorted_crc32_compute_polynomial_table(
+		 &( assorted_crc32_cached_tables[ assorted_crc32_number_of_cached_tables ] ),
+		 polynomial );
+
+		*polynomial_table = &( assorted_crc32_cached_tables[ assorted_crc32_number_of_cached_tables ] );
+
+		assorted_crc32_number_of_cached_tables++;
+
+		result = 1;
+	}
+	assorted_crc32_cached_tables_lock_release();
+
+	return( result );
+}
+
 /* Calculates the CRC-32 of a buffer
  * Uses modulo 2 caluculations, instead of a lookup table
  * The polynomial used is: 0x04c11db7UL
@@ -223,10 +1553,11 @@ int assorted_crc32_calculate(
      uint8_t weak_crc,
      libcerror_error_t **error )
 {
-	static char *function      = "assorted_crc32_calculate";
-	size_t buffer_offset       = 0;
-	uint32_t crc32_table_index = 0;
-	uint32_t safe_crc32        = 0;
+	const uint32_t *crc32_table = NULL;
+	static char *function       = "assorted_crc32_calculate";
+	size_t buffer_offset        = 0;
+	uint32_t crc32_table_index  = 0;
+	uint32_t safe_crc32         = 0;
 
 	if( crc32 == NULL )
 	{
@@ -261,10 +1592,13 @@ int assorted_crc32_calculate(
 
 		return( -1 );
 	}
-        if( assorted_crc32_table_computed == 0 )
+	if( assorted_crc32_table_computed != 0 )
+	{
+		crc32_table = assorted_crc32_table;
+	}
+	else
 	{
-		assorted_crc32_initialize_table(
-		 0xedb88320UL );
+		crc32_table = assorted_crc32_default_slicing_table[ 0 ];
 	}
 	safe_crc32 = initial_value;
 
@@ -278,7 +1612,7 @@ int assorted_crc32_calculate(
 	{
 		crc32_table_index = ( safe_crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL;
 
-		safe_crc32 = assorted_crc32_table[ crc32_table_index ] ^ ( safe_crc32 >> 8 );
+		safe_crc32 = crc32_table[ crc32_table_index ] ^ ( safe_crc32 >> 8 );
         }
 	if( weak_crc == 0 )
 	{
@@ -289,67 +1623,37 @@ int assorted_crc32_calculate(
 	return( 1 );
 }
 
-/* Check the CRC-32 checksum for single-bit errors
- * Returns 1 if successful, 0 if no error was found or -1 on error
+/* Calculates the CRC-32 of a buffer
+ * Uses slicing-by-8, which processes 8 bytes per iteration with 8 table lookups
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
  */
-int assorted_crc32_validate(
-     uint32_t crc32,
-     uint32_t calculated_crc32,
-     uint8_t *bit_index,
+int assorted_crc32_calculate_slicing_by_8(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
      libcerror_error_t **error )
 {
-	static char *function      = "assorted_crc32_validate";
-	uint32_t crc32_xor_pattern = 0;
-	uint8_t safe_bit_index     = 0;
-	
-	if( bit_index == NULL )
+	const uint32_t (*slicing_table)[ 256 ] = NULL;
+	static char *function                  = "assorted_crc32_calculate_slicing_by_8";
+	size_t buffer_offset                   = 0;
+	uint32_t crc32_table_index             = 0;
+	uint32_t safe_crc32                    = 0;
+	uint32_t value_32bit                   = 0;
+
+	if( crc32 == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bit index.",
+		 "%s: invalid CRC-32.",
 		 function );
 
 		return( -1 );
 	}
-	crc32 ^= calculated_crc32;
-
-	crc32_xor_pattern = 1;
-
-        for( safe_bit_index = 0;
-	     safe_bit_index < 32;
-	     safe_bit_index += 1 )
-	{
-		if( crc32_xor_pattern == crc32 )
-		{
-			*bit_index = safe_bit_index;
-
-			return( 1 );
-		}
-		crc32_xor_pattern = ( crc32_xor_pattern << 1 ) ^ ( 0x04c11db7UL & ( crc32_xor_pattern >> 31 ) );
-	}
-	return( 0 );
-}
-
-/* Tries to locate the error offset using a CRC-32
- * Returns 1 if successful, 0 if no error was found or -1 on error
- */
-int assorted_crc32_locate_error_offset(
-     uint32_t crc32,
-     uint32_t calculated_crc32,
-     const uint8_t *buffer,
-     size_t size,
-     uint32_t initial_value,
-     libcerror_error_t **error )
-{
-	static char *function      = "assorted_crc32_locate_error_offset";
-	size_t buffer_offset       = 0;
-	uint32_t crc32_xor_pattern = 0;
-	uint32_t mirror_value      = 0;
-	uint8_t bit_index          = 0;
-	uint8_t byte_value         = 0;
-
 	if( buffer == NULL )
 	{
 		libcerror_error_set(
@@ -372,70 +1676,1543 @@ int assorted_crc32_locate_error_offset(
 
 		return( -1 );
 	}
-	crc32_xor_pattern = crc32 ^ calculated_crc32;
-
-	calculated_crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+	if( assorted_crc32_slicing_table_computed != 0 )
+	{
+		slicing_table = (const uint32_t (*)[ 256 ]) assorted_crc32_slicing_table;
+	}
+	else
+	{
+		slicing_table = assorted_crc32_default_slicing_table;
+	}
+	safe_crc32 = initial_value;
 
-	/* Perform a byte for byte modulo-2 division
-	 */
-        for( buffer_offset = 0;
-	     buffer_offset < size;
-	     buffer_offset++ )
+	if( weak_crc == 0 )
 	{
-		byte_value   = buffer[ buffer_offset ];
-		mirror_value = 0;
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	while( ( size - buffer_offset ) >= 8 )
+	{
+		byte_stream_load_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit );
 
-		/* Mirror the bit order of the byte value from the center
-		 */
-		for( bit_index = 0;
-		     bit_index < 8;
-		     bit_index++ )
-		{
-			if( ( byte_value & 0x01 ) != 0 )
-			{
-				mirror_value |= ( 1 << ( 7 - bit_index ) );
-			}
-			byte_value = byte_value >> 1;
-		}
-		calculated_crc32 ^= mirror_value << 24;
+		safe_crc32 ^= value_32bit;
 
-		/* Perform a bit for bit modulo-2 division
-		*/
-		for( bit_index = 0;
-		     bit_index < 8;
-		     bit_index++ )
-		{
-			if( ( calculated_crc32 & 0x80000000UL ) != 0 )
-			{
-				calculated_crc32 <<= 1;
-				calculated_crc32  ^= 0x04c11db7UL;
+		byte_stream_load_uint32_little_endian(
+		 &( buffer[ buffer_offset + 4 ] ),
+		 value_32bit );
 
-				crc32_xor_pattern <<= 1;
-				crc32_xor_pattern  ^= 0x04c11db7UL;
-			}
-			else
-			{
-				calculated_crc32 <<= 1;
+		safe_crc32 = slicing_table[ 7 ][ safe_crc32 & 0x000000ffUL ]
+		           ^ slicing_table[ 6 ][ ( safe_crc32 >> 8 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 5 ][ ( safe_crc32 >> 16 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 4 ][ safe_crc32 >> 24 ]
+		           ^ slicing_table[ 3 ][ value_32bit & 0x000000ffUL ]
+		           ^ slicing_table[ 2 ][ ( value_32bit >> 8 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 1 ][ ( value_32bit >> 16 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 0 ][ value_32bit >> 24 ];
 
-				crc32_xor_pattern <<= 1;
-			}
-			crc32_xor_pattern <<= 1;
-		}
+		buffer_offset += 8;
 	}
-	/* Mirror the bit order of the CRC-32 value from the center
-	 */
-	for( bit_index = 0;
-	     bit_index < 32;
-	     bit_index++ )
+	while( buffer_offset < size )
 	{
-		if( ( calculated_crc32 & 0x00000001UL ) != 0 )
-		{
-			mirror_value |= ( 1 << ( 31 - bit_index ) );
-		}
-		calculated_crc32 = calculated_crc32 >> 1;
+		crc32_table_index = ( safe_crc32 ^ buffer[ buffer_offset++ ] ) & 0x000000ffUL;
+
+		safe_crc32 = slicing_table[ 0 ][ crc32_table_index ] ^ ( safe_crc32 >> 8 );
 	}
-	calculated_crc32 = mirror_value ^ (uint32_t) 0xffffffffUL;
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= 0xffffffffUL;
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
 
+/* Updates a CRC-32 with the data of a buffer using slicing-by-16
+ * The CRC-32 is the value without the initial and final XOR
+ * Returns the updated CRC-32
+ */
+static uint32_t assorted_crc32_update_slicing_by_16(
+                 const uint32_t slicing_table[ 16 ][ 256 ],
+                 uint32_t crc32,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	size_t buffer_offset       = 0;
+	uint32_t crc32_table_index = 0;
+	uint32_t value_32bit_1     = 0;
+	uint32_t value_32bit_2     = 0;
+	uint32_t value_32bit_3     = 0;
+	uint32_t value_32bit_4     = 0;
+
+	while( ( size - buffer_offset ) >= 16 )
+	{
+		byte_stream_load_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit_1 );
+
+		byte_stream_load_uint32_little_endian(
+		 &( buffer[ buffer_offset + 4 ] ),
+		 value_32bit_2 );
+
+		byte_stream_load_uint32_little_endian(
+		 &( buffer[ buffer_offset + 8 ] ),
+		 value_32bit_3 );
+
+		byte_stream_load_uint32_little_endian(
+		 &( buffer[ buffer_offset + 12 ] ),
+		 value_32bit_4 );
+
+		crc32 ^= value_32bit_1;
+
+		crc32 = slicing_table[ 15 ][ crc32 & 0x000000ffUL ]
+		           ^ slicing_table[ 14 ][ ( crc32 >> 8 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 13 ][ ( crc32 >> 16 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 12 ][ crc32 >> 24 ]
+		           ^ slicing_table[ 11 ][ value_32bit_2 & 0x000000ffUL ]
+		           ^ slicing_table[ 10 ][ ( value_32bit_2 >> 8 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 9 ][ ( value_32bit_2 >> 16 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 8 ][ value_32bit_2 >> 24 ]
+		           ^ slicing_table[ 7 ][ value_32bit_3 & 0x000000ffUL ]
+		           ^ slicing_table[ 6 ][ ( value_32bit_3 >> 8 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 5 ][ ( value_32bit_3 >> 16 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 4 ][ value_32bit_3 >> 24 ]
+		           ^ slicing_table[ 3 ][ value_32bit_4 & 0x000000ffUL ]
+		           ^ slicing_table[ 2 ][ ( value_32bit_4 >> 8 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 1 ][ ( value_32bit_4 >> 16 ) & 0x000000ffUL ]
+		           ^ slicing_table[ 0 ][ value_32bit_4 >> 24 ];
+
+		buffer_offset += 16;
+	}
+	while( buffer_offset < size )
+	{
+		crc32_table_index = ( crc32 ^ buffer[ buffer_offset++ ] ) & 0x000000ffUL;
+
+		crc32 = slicing_table[ 0 ][ crc32_table_index ] ^ ( crc32 >> 8 );
+	}
+	return( crc32 );
+}
+
+/* Calculates the CRC-32 of a buffer
+ * Uses slicing-by-16, which processes 16 bytes per iteration with 16 table lookups
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_calculate_slicing_by_16(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	const uint32_t (*slicing_table)[ 256 ] = NULL;
+	static char *function                  = "assorted_crc32_calculate_slicing_by_16";
+	uint32_t safe_crc32                    = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_crc32_slicing_table_computed != 0 )
+	{
+		slicing_table = (const uint32_t (*)[ 256 ]) assorted_crc32_slicing_table;
+	}
+	else
+	{
+		slicing_table = assorted_crc32_default_slicing_table;
+	}
+	safe_crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	safe_crc32 = assorted_crc32_update_slicing_by_16(
+	              slicing_table,
+	              safe_crc32,
+	              buffer,
+	              size );
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= 0xffffffffUL;
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
+
+/* Retrieves the carry-less multiplication fold method supported by the CPU
+ * Returns the fold method
+ */
+int assorted_crc32_get_fold_method(
+     void )
+{
+#if defined( ASSORTED_CRC32_HAVE_PCLMUL ) || defined( ASSORTED_CRC32_HAVE_PMULL )
+	uint32_t cpu_features = 0;
+#endif
+	int fold_method       = ASSORTED_CRC32_FOLD_METHOD_NONE;
+
+#if defined( ASSORTED_CRC32_HAVE_PCLMUL )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( ( cpu_features & ASSORTED_CPU_FEATURE_PCLMUL ) != 0 )
+	 && ( ( cpu_features & ASSORTED_CPU_FEATURE_SSE4_1 ) != 0 ) )
+	{
+		fold_method = ASSORTED_CRC32_FOLD_METHOD_PCLMUL;
+
+#if defined( ASSORTED_CRC32_HAVE_VPCLMUL )
+		if( ( ( cpu_features & ASSORTED_CPU_FEATURE_AVX512F ) != 0 )
+		 && ( ( cpu_features & ASSORTED_CPU_FEATURE_VPCLMUL ) != 0 ) )
+		{
+			fold_method = ASSORTED_CRC32_FOLD_METHOD_VPCLMUL;
+		}
+#endif
+	}
+#elif defined( ASSORTED_CRC32_HAVE_PMULL )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_PMULL ) != 0 )
+	{
+		fold_method = ASSORTED_CRC32_FOLD_METHOD_PMULL;
+	}
+#endif
+	return( fold_method );
+}
+
+/* The folding constants of the reversed polynomial 0xedb88320, where
+ * the constants to fold over a distance of n bits are x^(n+32) and x^(n-32) mod P(x),
+ * bit-reflected and shifted left by 1, see "Fast CRC Computation for Generic
+ * Polynomials Using PCLMULQDQ Instruction" by Gopal et al.
+ */
+#define ASSORTED_CRC32_FOLD_2048_LOWER	0x000000011542778aULL
+#define ASSORTED_CRC32_FOLD_2048_UPPER	0x00000001322d1430ULL
+#define ASSORTED_CRC32_FOLD_512_LOWER	0x0000000154442bd4ULL
+#define ASSORTED_CRC32_FOLD_512_UPPER	0x00000001c6e41596ULL
+#define ASSORTED_CRC32_FOLD_128_LOWER	0x00000001751997d0ULL
+#define ASSORTED_CRC32_FOLD_128_UPPER	0x00000000ccaa009eULL
+#define ASSORTED_CRC32_FOLD_64		0x0000000163cd6124ULL
+
+/* The Barrett reduction constants, P(x) and floor(x^64 / P(x)), bit-reflected
+ */
+#define ASSORTED_CRC32_BARRETT_POLYNOMIAL	0x00000001db710641ULL
+#define ASSORTED_CRC32_BARRETT_MU		0x00000001f7011641ULL
+
+#if defined( ASSORTED_CRC32_HAVE_PCLMUL )
+
+/* Folds the remaining 16-byte blocks into a 128-bit value and reduces it to the CRC-32
+ * The size must be a multiple of 16
+ * Returns the CRC-32
+ */
+static inline __attribute__ ((target ("sse4.1,pclmul"))) uint32_t assorted_crc32_fold_pclmul_reduce(
+                                                                     __m128i value_128bit,
+                                                                     const uint8_t *buffer,
+                                                                     size_t size )
+{
+	__m128i constants_128bit = _mm_set_epi64x( (long long) ASSORTED_CRC32_FOLD_128_UPPER, (long long) ASSORTED_CRC32_FOLD_128_LOWER );
+	__m128i mask_128bit      = _mm_setr_epi32( -1, 0, -1, 0 );
+	__m128i folded_128bit;
+
+	while( size >= 16 )
+	{
+		folded_128bit = _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x00 );
+		value_128bit  = _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x11 );
+		value_128bit  = _mm_xor_si128( value_128bit, folded_128bit );
+		value_128bit  = _mm_xor_si128( value_128bit, _mm_loadu_si128( (const __m128i *) buffer ) );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	/* Fold 128-bit to 64-bit
+	 */
+	folded_128bit = _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x10 );
+	value_128bit  = _mm_srli_si128( value_128bit, 8 );
+	value_128bit  = _mm_xor_si128( value_128bit, folded_128bit );
+
+	constants_128bit = _mm_set_epi64x( 0, (long long) ASSORTED_CRC32_FOLD_64 );
+
+	folded_128bit = _mm_srli_si128( value_128bit, 4 );
+	value_128bit  = _mm_and_si128( value_128bit, mask_128bit );
+	value_128bit  = _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x00 );
+	value_128bit  = _mm_xor_si128( value_128bit, folded_128bit );
+
+	/* Barrett reduce 64-bit to 32-bit
+	 */
+	constants_128bit = _mm_set_epi64x( (long long) ASSORTED_CRC32_BARRETT_MU, (long long) ASSORTED_CRC32_BARRETT_POLYNOMIAL );
+
+	folded_128bit = _mm_and_si128( value_128bit, mask_128bit );
+	folded_128bit = _mm_clmulepi64_si128( folded_128bit, constants_128bit, 0x10 );
+	folded_128bit = _mm_and_si128( folded_128bit, mask_128bit );
+	folded_128bit = _mm_clmulepi64_si128( folded_128bit, constants_128bit, 0x00 );
+	value_128bit  = _mm_xor_si128( value_128bit, folded_128bit );
+
+	return( (uint32_t) _mm_extract_epi32( value_128bit, 1 ) );
+}
+
+/* Calculates the CRC-32 of a buffer using PCLMULQDQ folding of 4 x 128-bit
+ * The CRC-32 is the value without the initial and final XOR
+ * The size must be at least 64 and a multiple of 16
+ * Returns the CRC-32
+ */
+__attribute__ ((target ("sse4.1,pclmul"))) uint32_t assorted_crc32_fold_pclmul(
+                                                     uint32_t crc32,
+                                                     const uint8_t *buffer,
+                                                     size_t size )
+{
+	__m128i constants_128bit = _mm_set_epi64x( (long long) ASSORTED_CRC32_FOLD_512_UPPER, (long long) ASSORTED_CRC32_FOLD_512_LOWER );
+	__m128i folded_128bit1;
+	__m128i folded_128bit2;
+	__m128i folded_128bit3;
+	__m128i folded_128bit4;
+	__m128i value_128bit1;
+	__m128i value_128bit2;
+	__m128i value_128bit3;
+	__m128i value_128bit4;
+
+	value_128bit1 = _mm_loadu_si128( (const __m128i *) buffer );
+	value_128bit2 = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+	value_128bit3 = _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) );
+	value_128bit4 = _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) );
+
+	value_128bit1 = _mm_xor_si128( value_128bit1, _mm_cvtsi32_si128( (int) crc32 ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	while( size >= 64 )
+	{
+		folded_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x00 );
+		folded_128bit2 = _mm_clmulepi64_si128( value_128bit2, constants_128bit, 0x00 );
+		folded_128bit3 = _mm_clmulepi64_si128( value_128bit3, constants_128bit, 0x00 );
+		folded_128bit4 = _mm_clmulepi64_si128( value_128bit4, constants_128bit, 0x00 );
+
+		value_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x11 );
+		value_128bit2 = _mm_clmulepi64_si128( value_128bit2, constants_128bit, 0x11 );
+		value_128bit3 = _mm_clmulepi64_si128( value_128bit3, constants_128bit, 0x11 );
+		value_128bit4 = _mm_clmulepi64_si128( value_128bit4, constants_128bit, 0x11 );
+
+		value_128bit1 = _mm_xor_si128( value_128bit1, folded_128bit1 );
+		value_128bit2 = _mm_xor_si128( value_128bit2, folded_128bit2 );
+		value_128bit3 = _mm_xor_si128( value_128bit3, folded_128bit3 );
+		value_128bit4 = _mm_xor_si128( value_128bit4, folded_128bit4 );
+
+		value_128bit1 = _mm_xor_si128( value_128bit1, _mm_loadu_si128( (const __m128i *) buffer ) );
+		value_128bit2 = _mm_xor_si128( value_128bit2, _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ) );
+		value_128bit3 = _mm_xor_si128( value_128bit3, _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ) );
+		value_128bit4 = _mm_xor_si128( value_128bit4, _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold 4 x 128-bit into 128-bit
+	 */
+	constants_128bit = _mm_set_epi64x( (long long) ASSORTED_CRC32_FOLD_128_UPPER, (long long) ASSORTED_CRC32_FOLD_128_LOWER );
+
+	folded_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x00 );
+	value_128bit1  = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x11 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, folded_128bit1 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, value_128bit2 );
+
+	folded_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x00 );
+	value_128bit1  = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x11 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, folded_128bit1 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, value_128bit3 );
+
+	folded_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x00 );
+	value_128bit1  = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x11 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, folded_128bit1 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, value_128bit4 );
+
+	return( assorted_crc32_fold_pclmul_reduce(
+	         value_128bit1,
+	         buffer,
+	         size ) );
+}
+
+/* Copies a buffer and calculates its CRC-32 using PCLMULQDQ folding of 4 x 128-bit
+ * Every 128-bit value that is folded is also stored in the destination,
+ * so that the source is read only once
+ * The CRC-32 is the value without the initial and final XOR
+ * The size must be at least 64 and a multiple of 16
+ * Returns the CRC-32
+ */
+__attribute__ ((target ("sse4.1,pclmul"))) uint32_t assorted_crc32_copy_fold_pclmul(
+                                                     uint32_t crc32,
+                                                     uint8_t *destination,
+                                                     const uint8_t *source,
+                                                     size_t size )
+{
+	__m128i constants_128bit = _mm_set_epi64x( (long long) ASSORTED_CRC32_FOLD_512_UPPER, (long long) ASSORTED_CRC32_FOLD_512_LOWER );
+	__m128i data_128bit1;
+	__m128i data_128bit2;
+	__m128i data_128bit3;
+	__m128i data_128bit4;
+	__m128i folded_128bit1;
+	__m128i folded_128bit2;
+	__m128i folded_128bit3;
+	__m128i folded_128bit4;
+	__m128i value_128bit1;
+	__m128i value_128bit2;
+	__m128i value_128bit3;
+	__m128i value_128bit4;
+
+	value_128bit1 = _mm_loadu_si128( (const __m128i *) source );
+	value_128bit2 = _mm_loadu_si128( (const __m128i *) &( source[ 16 ] ) );
+	value_128bit3 = _mm_loadu_si128( (const __m128i *) &( source[ 32 ] ) );
+	value_128bit4 = _mm_loadu_si128( (const __m128i *) &( source[ 48 ] ) );
+
+	_mm_storeu_si128( (__m128i *) destination, value_128bit1 );
+	_mm_storeu_si128( (__m128i *) &( destination[ 16 ] ), value_128bit2 );
+	_mm_storeu_si128( (__m128i *) &( destination[ 32 ] ), value_128bit3 );
+	_mm_storeu_si128( (__m128i *) &( destination[ 48 ] ), value_128bit4 );
+
+	value_128bit1 = _mm_xor_si128( value_128bit1, _mm_cvtsi32_si128( (int) crc32 ) );
+
+	destination += 64;
+	source      += 64;
+	size        -= 64;
+
+	while( size >= 64 )
+	{
+		data_128bit1 = _mm_loadu_si128( (const __m128i *) source );
+		data_128bit2 = _mm_loadu_si128( (const __m128i *) &( source[ 16 ] ) );
+		data_128bit3 = _mm_loadu_si128( (const __m128i *) &( source[ 32 ] ) );
+		data_128bit4 = _mm_loadu_si128( (const __m128i *) &( source[ 48 ] ) );
+
+		_mm_storeu_si128( (__m128i *) destination, data_128bit1 );
+		_mm_storeu_si128( (__m128i *) &( destination[ 16 ] ), data_128bit2 );
+		_mm_storeu_si128( (__m128i *) &( destination[ 32 ] ), data_128bit3 );
+		_mm_storeu_si128( (__m128i *) &( destination[ 48 ] ), data_128bit4 );
+
+		folded_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x00 );
+		folded_128bit2 = _mm_clmulepi64_si128( value_128bit2, constants_128bit, 0x00 );
+		folded_128bit3 = _mm_clmulepi64_si128( value_128bit3, constants_128bit, 0x00 );
+		folded_128bit4 = _mm_clmulepi64_si128( value_128bit4, constants_128bit, 0x00 );
+
+		value_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x11 );
+		value_128bit2 = _mm_clmulepi64_si128( value_128bit2, constants_128bit, 0x11 );
+		value_128bit3 = _mm_clmulepi64_si128( value_128bit3, constants_128bit, 0x11 );
+		value_128bit4 = _mm_clmulepi64_si128( value_128bit4, constants_128bit, 0x11 );
+
+		value_128bit1 = _mm_xor_si128( value_128bit1, folded_128bit1 );
+		value_128bit2 = _mm_xor_si128( value_128bit2, folded_128bit2 );
+		value_128bit3 = _mm_xor_si128( value_128bit3, folded_128bit3 );
+		value_128bit4 = _mm_xor_si128( value_128bit4, folded_128bit4 );
+
+		value_128bit1 = _mm_xor_si128( value_128bit1, data_128bit1 );
+		value_128bit2 = _mm_xor_si128( value_128bit2, data_128bit2 );
+		value_128bit3 = _mm_xor_si128( value_128bit3, data_128bit3 );
+		value_128bit4 = _mm_xor_si128( value_128bit4, data_128bit4 );
+
+		destination += 64;
+		source      += 64;
+		size        -= 64;
+	}
+	/* Fold 4 x 128-bit into 128-bit
+	 */
+	constants_128bit = _mm_set_epi64x( (long long) ASSORTED_CRC32_FOLD_128_UPPER, (long long) ASSORTED_CRC32_FOLD_128_LOWER );
+
+	folded_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x00 );
+	value_128bit1  = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x11 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, folded_128bit1 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, value_128bit2 );
+
+	folded_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x00 );
+	value_128bit1  = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x11 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, folded_128bit1 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, value_128bit3 );
+
+	folded_128bit1 = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x00 );
+	value_128bit1  = _mm_clmulepi64_si128( value_128bit1, constants_128bit, 0x11 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, folded_128bit1 );
+	value_128bit1  = _mm_xor_si128( value_128bit1, value_128bit4 );
+
+	/* The remaining less than 4 x 128-bit are copied and then folded from the cached destination
+	 */
+	if( size > 0 )
+	{
+		memory_copy(
+		 destination,
+		 source,
+		 size );
+	}
+	return( assorted_crc32_fold_pclmul_reduce(
+	         value_128bit1,
+	         destination,
+	         size ) );
+}
+
+#endif /* defined( ASSORTED_CRC32_HAVE_PCLMUL ) */
+
+#if defined( ASSORTED_CRC32_HAVE_VPCLMUL )
+
+/* Calculates the CRC-32 of a buffer using VPCLMULQDQ folding of 4 x 512-bit
+ * The CRC-32 is the value without the initial and final XOR
+ * The size must be at least 256 and a multiple of 16
+ * Returns the CRC-32
+ */
+__attribute__ ((target ("avx512f,vpclmulqdq,sse4.1,pclmul"))) uint32_t assorted_crc32_fold_vpclmul(
+                                                                    uint32_t crc32,
+                                                                    const uint8_t *buffer,
+                                                                    size_t size )
+{
+	__m512i constants_512bit = _mm512_broadcast_i32x4( _mm_set_epi64x( (long long) ASSORTED_CRC32_FOLD_2048_UPPER, (long long) ASSORTED_CRC32_FOLD_2048_LOWER ) );
+	__m128i constants_128bit;
+	__m128i value_128bit;
+	__m512i folded_512bit1;
+	__m512i folded_512bit2;
+	__m512i folded_512bit3;
+	__m512i folded_512bit4;
+	__m512i value_512bit1;
+	__m512i value_512bit2;
+	__m512i value_512bit3;
+	__m512i value_512bit4;
+
+	value_512bit1 = _mm512_loadu_si512( (const void *) buffer );
+	value_512bit2 = _mm512_loadu_si512( (const void *) &( buffer[ 64 ] ) );
+	value_512bit3 = _mm512_loadu_si512( (const void *) &( buffer[ 128 ] ) );
+	value_512bit4 = _mm512_loadu_si512( (const void *) &( buffer[ 192 ] ) );
+
+	value_512bit1 = _mm512_xor_si512( value_512bit1, _mm512_inserti32x4( _mm512_setzero_si512(), _mm_cvtsi32_si128( (int) crc32 ), 0 ) );
+
+	buffer += 256;
+	size   -= 256;
+
+	while( size >= 256 )
+	{
+		folded_512bit1 = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x00 );
+		folded_512bit2 = _mm512_clmulepi64_epi128( value_512bit2, constants_512bit, 0x00 );
+		folded_512bit3 = _mm512_clmulepi64_epi128( value_512bit3, constants_512bit, 0x00 );
+		folded_512bit4 = _mm512_clmulepi64_epi128( value_512bit4, constants_512bit, 0x00 );
+
+		value_512bit1 = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x11 );
+		value_512bit2 = _mm512_clmulepi64_epi128( value_512bit2, constants_512bit, 0x11 );
+		value_512bit3 = _mm512_clmulepi64_epi128( value_512bit3, constants_512bit, 0x11 );
+		value_512bit4 = _mm512_clmulepi64_epi128( value_512bit4, constants_512bit, 0x11 );
+
+		/* A ternary logic value of 0x96 represents the XOR of the 3 operands
+		 */
+		value_512bit1 = _mm512_ternarylogic_epi64( value_512bit1, folded_512bit1, _mm512_loadu_si512( (const void *) buffer ), 0x96 );
+		value_512bit2 = _mm512_ternarylogic_epi64( value_512bit2, folded_512bit2, _mm512_loadu_si512( (const void *) &( buffer[ 64 ] ) ), 0x96 );
+		value_512bit3 = _mm512_ternarylogic_epi64( value_512bit3, folded_512bit3, _mm512_loadu_si512( (const void *) &( buffer[ 128 ] ) ), 0x96 );
+		value_512bit4 = _mm512_ternarylogic_epi64( value_512bit4, folded_512bit4, _mm512_loadu_si512( (const void *) &( buffer[ 192 ] ) ), 0x96 );
+
+		buffer += 256;
+		size   -= 256;
+	}
+	/* Fold 4 x 512-bit into 512-bit
+	 */
+	constants_512bit = _mm512_broadcast_i32x4( _mm_set_epi64x( (long long) ASSORTED_CRC32_FOLD_512_UPPER, (long long) ASSORTED_CRC32_FOLD_512_LOWER ) );
+
+	folded_512bit1 = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x00 );
+	value_512bit1  = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x11 );
+	value_512bit1  = _mm512_ternarylogic_epi64( value_512bit1, folded_512bit1, value_512bit2, 0x96 );
+
+	folded_512bit1 = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x00 );
+	value_512bit1  = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x11 );
+	value_512bit1  = _mm512_ternarylogic_epi64( value_512bit1, folded_512bit1, value_512bit3, 0x96 );
+
+	folded_512bit1 = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x00 );
+	value_512bit1  = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x11 );
+	value_512bit1  = _mm512_ternarylogic_epi64( value_512bit1, folded_512bit1, value_512bit4, 0x96 );
+
+	while( size >= 64 )
+	{
+		folded_512bit1 = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x00 );
+		value_512bit1  = _mm512_clmulepi64_epi128( value_512bit1, constants_512bit, 0x11 );
+		value_512bit1  = _mm512_ternarylogic_epi64( value_512bit1, folded_512bit1, _mm512_loadu_si512( (const void *) buffer ), 0x96 );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold the 4 x 128-bit of the 512-bit value into 128-bit
+	 */
+	constants_128bit = _mm_set_epi64x( (long long) ASSORTED_CRC32_FOLD_128_UPPER, (long long) ASSORTED_CRC32_FOLD_128_LOWER );
+
+	value_128bit = _mm512_extracti32x4_epi32( value_512bit1, 0 );
+
+	value_128bit = _mm_xor_si128(
+	                _mm_xor_si128(
+	                 _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x00 ),
+	                 _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x11 ) ),
+	                _mm512_extracti32x4_epi32( value_512bit1, 1 ) );
+
+	value_128bit = _mm_xor_si128(
+	                _mm_xor_si128(
+	                 _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x00 ),
+	                 _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x11 ) ),
+	                _mm512_extracti32x4_epi32( value_512bit1, 2 ) );
+
+	value_128bit = _mm_xor_si128(
+	                _mm_xor_si128(
+	                 _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x00 ),
+	                 _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x11 ) ),
+	                _mm512_extracti32x4_epi32( value_512bit1, 3 ) );
+
+	return( assorted_crc32_fold_pclmul_reduce(
+	         value_128bit,
+	         buffer,
+	         size ) );
+}
+
+#endif /* defined( ASSORTED_CRC32_HAVE_VPCLMUL ) */
+
+#if defined( ASSORTED_CRC32_HAVE_PMULL )
+
+#if defined( __clang__ )
+#define ASSORTED_CRC32_TARGET_PMULL	__attribute__ ((target ("aes")))
+#else
+#define ASSORTED_CRC32_TARGET_PMULL	__attribute__ ((target ("+crypto")))
+#endif
+
+/* Multiplies the lower 64-bit of 2 128-bit values without carry
+ */
+static inline ASSORTED_CRC32_TARGET_PMULL uint64x2_t assorted_crc32_pmull_lower(
+                                                      uint64x2_t value_128bit1,
+                                                      uint64x2_t value_128bit2 )
+{
+	return( vreinterpretq_u64_p128( vmull_p64( (poly64_t) vgetq_lane_u64( value_128bit1, 0 ), (poly64_t) vgetq_lane_u64( value_128bit2, 0 ) ) ) );
+}
+
+/* Multiplies the upper 64-bit of 2 128-bit values without carry
+ */
+static inline ASSORTED_CRC32_TARGET_PMULL uint64x2_t assorted_crc32_pmull_upper(
+                                                      uint64x2_t value_128bit1,
+                                                      uint64x2_t value_128bit2 )
+{
+	return( vreinterpretq_u64_p128( vmull_p64( (poly64_t) vgetq_lane_u64( value_128bit1, 1 ), (poly64_t) vgetq_lane_u64( value_128bit2, 1 ) ) ) );
+}
+
+/* Multiplies the lower 64-bit of the first with the upper 64-bit of the second 128-bit value without carry
+ */
+static inline ASSORTED_CRC32_TARGET_PMULL uint64x2_t assorted_crc32_pmull_lower_upper(
+                                                      uint64x2_t value_128bit1,
+                                                      uint64x2_t value_128bit2 )
+{
+	return( vreinterpretq_u64_p128( vmull_p64( (poly64_t) vgetq_lane_u64( value_128bit1, 0 ), (poly64_t) vgetq_lane_u64( value_128bit2, 1 ) ) ) );
+}
+
+/* Folds a 128-bit value over a distance and adds the next 128-bit value
+ */
+#define assorted_crc32_pmull_fold( value_128bit, constants_128bit, next_value_128bit ) \
+	veorq_u64( veorq_u64( assorted_crc32_pmull_lower( value_128bit, constants_128bit ), assorted_crc32_pmull_upper( value_128bit, constants_128bit ) ), next_value_128bit )
+
+/* Calculates the CRC-32 of a buffer using PMULL folding of 4 x 128-bit
+ * The CRC-32 is the value without the initial and final XOR
+ * The size must be at least 64 and a multiple of 16
+ * Returns the CRC-32
+ */
+ASSORTED_CRC32_TARGET_PMULL uint32_t assorted_crc32_fold_pmull(
+                                      uint32_t crc32,
+                                      const uint8_t *buffer,
+                                      size_t size )
+{
+	uint64x2_t constants_128bit = vcombine_u64( vcreate_u64( ASSORTED_CRC32_FOLD_512_LOWER ), vcreate_u64( ASSORTED_CRC32_FOLD_512_UPPER ) );
+	uint64x2_t mask_128bit      = vreinterpretq_u64_u32( vcombine_u32( vcreate_u32( 0x00000000ffffffffULL ), vcreate_u32( 0x00000000ffffffffULL ) ) );
+	uint64x2_t zero_128bit      = vdupq_n_u64( 0 );
+	uint64x2_t folded_128bit;
+	uint64x2_t value_128bit1;
+	uint64x2_t value_128bit2;
+	uint64x2_t value_128bit3;
+	uint64x2_t value_128bit4;
+
+	value_128bit1 = vld1q_u64( (const uint64_t *) buffer );
+	value_128bit2 = vld1q_u64( (const uint64_t *) &( buffer[ 16 ] ) );
+	value_128bit3 = vld1q_u64( (const uint64_t *) &( buffer[ 32 ] ) );
+	value_128bit4 = vld1q_u64( (const uint64_t *) &( buffer[ 48 ] ) );
+
+	value_128bit1 = veorq_u64( value_128bit1, vcombine_u64( vcreate_u64( (uint64_t) crc32 ), vcreate_u64( 0 ) ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	while( size >= 64 )
+	{
+		value_128bit1 = assorted_crc32_pmull_fold( value_128bit1, constants_128bit, vld1q_u64( (const uint64_t *) buffer ) );
+		value_128bit2 = assorted_crc32_pmull_fold( value_128bit2, constants_128bit, vld1q_u64( (const uint64_t *) &( buffer[ 16 ] ) ) );
+		value_128bit3 = assorted_crc32_pmull_fold( value_128bit3, constants_128bit, vld1q_u64( (const uint64_t *) &( buffer[ 32 ] ) ) );
+		value_128bit4 = assorted_crc32_pmull_fold( value_128bit4, constants_128bit, vld1q_u64( (const uint64_t *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold 4 x 128-bit into 128-bit
+	 */
+	constants_128bit = vcombine_u64( vcreate_u64( ASSORTED_CRC32_FOLD_128_LOWER ), vcreate_u64( ASSORTED_CRC32_FOLD_128_UPPER ) );
+
+	value_128bit1 = assorted_crc32_pmull_fold( value_128bit1, constants_128bit, value_128bit2 );
+	value_128bit1 = assorted_crc32_pmull_fold( value_128bit1, constants_128bit, value_128bit3 );
+	value_128bit1 = assorted_crc32_pmull_fold( value_128bit1, constants_128bit, value_128bit4 );
+
+	while( size >= 16 )
+	{
+		value_128bit1 = assorted_crc32_pmull_fold( value_128bit1, constants_128bit, vld1q_u64( (const uint64_t *) buffer ) );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	/* Fold 128-bit to 64-bit
+	 */
+	folded_128bit = assorted_crc32_pmull_lower_upper( value_128bit1, constants_128bit );
+	value_128bit1 = vreinterpretq_u64_u8( vextq_u8( vreinterpretq_u8_u64( value_128bit1 ), vreinterpretq_u8_u64( zero_128bit ), 8 ) );
+	value_128bit1 = veorq_u64( value_128bit1, folded_128bit );
+
+	constants_128bit = vcombine_u64( vcreate_u64( ASSORTED_CRC32_FOLD_64 ), vcreate_u64( 0 ) );
+
+	folded_128bit = vreinterpretq_u64_u8( vextq_u8( vreinterpretq_u8_u64( value_128bit1 ), vreinterpretq_u8_u64( zero_128bit ), 4 ) );
+	value_128bit1 = vandq_u64( value_128bit1, mask_128bit );
+	value_128bit1 = assorted_crc32_pmull_lower( value_128bit1, constants_128bit );
+	value_128bit1 = veorq_u64( value_128bit1, folded_128bit );
+
+	/* Barrett reduce 64-bit to 32-bit
+	 */
+	constants_128bit = vcombine_u64( vcreate_u64( ASSORTED_CRC32_BARRETT_POLYNOMIAL ), vcreate_u64( ASSORTED_CRC32_BARRETT_MU ) );
+
+	folded_128bit = vandq_u64( value_128bit1, mask_128bit );
+	folded_128bit = assorted_crc32_pmull_lower_upper( folded_128bit, constants_128bit );
+	folded_128bit = vandq_u64( folded_128bit, mask_128bit );
+	folded_128bit = assorted_crc32_pmull_lower( folded_128bit, constants_128bit );
+	value_128bit1 = veorq_u64( value_128bit1, folded_128bit );
+
+	return( vgetq_lane_u32( vreinterpretq_u32_u64( value_128bit1 ), 1 ) );
+}
+
+#endif /* defined( ASSORTED_CRC32_HAVE_PMULL ) */
+
+/* Calculates the CRC-32 of a buffer
+ * Uses carry-less multiplication folding when supported by the CPU,
+ * otherwise or for the remaining bytes slicing-by-16
+ * The folding constants are those of the reversed polynomial 0xedb88320
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_calculate_folded(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc32_calculate_folded";
+	size_t buffer_offset  = 0;
+	uint32_t safe_crc32   = 0;
+	int fold_method       = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	fold_method = assorted_crc32_get_fold_method();
+
+#if defined( ASSORTED_CRC32_HAVE_VPCLMUL )
+	if( ( fold_method == ASSORTED_CRC32_FOLD_METHOD_VPCLMUL )
+	 && ( size >= 256 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		safe_crc32 = assorted_crc32_fold_vpclmul(
+		              safe_crc32,
+		              buffer,
+		              buffer_offset );
+	}
+	else
+#endif
+#if defined( ASSORTED_CRC32_HAVE_PCLMUL )
+	if( ( ( fold_method == ASSORTED_CRC32_FOLD_METHOD_PCLMUL )
+	  ||  ( fold_method == ASSORTED_CRC32_FOLD_METHOD_VPCLMUL ) )
+	 && ( size >= 64 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		safe_crc32 = assorted_crc32_fold_pclmul(
+		              safe_crc32,
+		              buffer,
+		              buffer_offset );
+	}
+#endif
+#if defined( ASSORTED_CRC32_HAVE_PMULL )
+	if( ( fold_method == ASSORTED_CRC32_FOLD_METHOD_PMULL )
+	 && ( size >= 64 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		safe_crc32 = assorted_crc32_fold_pmull(
+		              safe_crc32,
+		              buffer,
+		              buffer_offset );
+	}
+#endif
+	safe_crc32 = assorted_crc32_update_slicing_by_16(
+	              assorted_crc32_default_slicing_table,
+	              safe_crc32,
+	              &( buffer[ buffer_offset ] ),
+	              size - buffer_offset );
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= 0xffffffffUL;
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
+
+/* The size of the blocks that are copied before the CRC-32 is calculated from
+ * the cached destination, when the CPU does not support copy folding
+ */
+#define ASSORTED_CRC32_COPY_BLOCK_SIZE	16384
+
+/* Copies a buffer and calculates its CRC-32 in a single pass over the source
+ * Uses carry-less multiplication folding that stores the folded values when
+ * supported by the CPU, otherwise the buffer is copied in blocks that are small
+ * enough for the CRC-32 to be calculated from the cached destination
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_copy_calculate(
+     uint32_t *crc32,
+     uint8_t *destination,
+     const uint8_t *source,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc32_copy_calculate";
+	size_t block_size     = 0;
+	size_t buffer_offset  = 0;
+	uint32_t safe_crc32   = 0;
+	int fold_method       = 0;
+
+#if defined( ASSORTED_CRC32_HAVE_PMULL )
+	size_t fold_size      = 0;
+#endif
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	fold_method = assorted_crc32_get_fold_method();
+
+#if defined( ASSORTED_CRC32_HAVE_PCLMUL )
+	if( ( ( fold_method == ASSORTED_CRC32_FOLD_METHOD_PCLMUL )
+	  ||  ( fold_method == ASSORTED_CRC32_FOLD_METHOD_VPCLMUL ) )
+	 && ( size >= 64 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		safe_crc32 = assorted_crc32_copy_fold_pclmul(
+		              safe_crc32,
+		              destination,
+		              source,
+		              buffer_offset );
+	}
+#endif
+	while( buffer_offset < size )
+	{
+		block_size = size - buffer_offset;
+
+		if( block_size > ASSORTED_CRC32_COPY_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_CRC32_COPY_BLOCK_SIZE;
+		}
+		if( memory_copy(
+		     &( destination[ buffer_offset ] ),
+		     &( source[ buffer_offset ] ),
+		     block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( ASSORTED_CRC32_HAVE_PMULL )
+		if( ( fold_method == ASSORTED_CRC32_FOLD_METHOD_PMULL )
+		 && ( block_size >= 64 ) )
+		{
+			fold_size = block_size & ~( (size_t) 15 );
+
+			safe_crc32 = assorted_crc32_fold_pmull(
+			              safe_crc32,
+			              &( destination[ buffer_offset ] ),
+			              fold_size );
+
+			buffer_offset += fold_size;
+			block_size    -= fold_size;
+		}
+#endif
+		safe_crc32 = assorted_crc32_update_slicing_by_16(
+		              assorted_crc32_default_slicing_table,
+		              safe_crc32,
+		              &( destination[ buffer_offset ] ),
+		              block_size );
+
+		buffer_offset += block_size;
+	}
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= 0xffffffffUL;
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
+
+/* Multiplies 2 bit-reflected polynomials modulo the reversed polynomial
+ * Where 0x80000000 represents x^0
+ * Returns the product
+ */
+uint32_t assorted_crc32_multiply_modulo(
+          uint32_t first_value,
+          uint32_t second_value,
+          uint32_t polynomial )
+{
+	uint32_t bit_mask = 0x80000000UL;
+	uint32_t product  = 0;
+
+	while( ( first_value != 0 )
+	    && ( bit_mask != 0 ) )
+	{
+		if( ( first_value & bit_mask ) != 0 )
+		{
+			product     ^= second_value;
+			first_value ^= bit_mask;
+		}
+		bit_mask >>= 1;
+
+		if( ( second_value & 0x00000001UL ) != 0 )
+		{
+			second_value = polynomial ^ ( second_value >> 1 );
+		}
+		else
+		{
+			second_value >>= 1;
+		}
+	}
+	return( product );
+}
+
+/* Combines the CRC-32 of 2 consecutive buffers into the CRC-32 of the concatenated buffers
+ * The CRC-32 of the second buffer must be calculated with an initial value of 0
+ * and the same weak CRC setting as the first buffer
+ * The first CRC-32 is multiplied by x^(8 * second_size) modulo the polynomial, where
+ * the power is determined by repeated squaring in O(log(second_size))
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_combine(
+     uint32_t *crc32,
+     uint32_t first_crc32,
+     uint32_t second_crc32,
+     size64_t second_size,
+     uint32_t polynomial,
+     libcerror_error_t **error )
+{
+	static char *function  = "assorted_crc32_combine";
+	uint32_t power_of_x    = 0;
+	uint32_t squared_power = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( polynomial & 0x80000000UL ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported polynomial.",
+		 function );
+
+		return( -1 );
+	}
+	/* Start with x^0 and x^8, which represents a single byte
+	 */
+	power_of_x    = 0x80000000UL;
+	squared_power = 0x00800000UL;
+
+	while( second_size != 0 )
+	{
+		if( ( second_size & 1 ) != 0 )
+		{
+			power_of_x = assorted_crc32_multiply_modulo(
+			              squared_power,
+			              power_of_x,
+			              polynomial );
+		}
+		squared_power = assorted_crc32_multiply_modulo(
+		                 squared_power,
+		                 squared_power,
+		                 polynomial );
+
+		second_size >>= 1;
+	}
+	*crc32 = assorted_crc32_multiply_modulo(
+	          power_of_x,
+	          first_crc32,
+	          polynomial ) ^ second_crc32;
+
+	return( 1 );
+}
+
+/* Determines if the CPU supports the CRC-32C instruction
+ * Returns 1 if supported or 0 if not
+ */
+int assorted_crc32_have_castagnoli_instruction(
+     void )
+{
+	int have_instruction = 0;
+
+#if defined( ASSORTED_CRC32_HAVE_SSE42 )
+	if( ( assorted_cpu_features_get() & ASSORTED_CPU_FEATURE_SSE4_2 ) != 0 )
+	{
+		have_instruction = 1;
+	}
+#endif
+	return( have_instruction );
+}
+
+#if defined( ASSORTED_CRC32_HAVE_SSE42 )
+
+/* Calculates the CRC-32C of a buffer using the SSE4.2 CRC-32 instruction
+ * The instruction has a latency of 3 cycles and a throughput of 1 per cycle,
+ * hence 3 streams are interleaved, after which the CRC-32C of the first
+ * streams are shifted over the next streams using the shift tables
+ * The CRC-32C is the value without the initial and final XOR
+ * Returns the CRC-32C
+ */
+__attribute__ ((target ("sse4.2"))) uint32_t assorted_crc32_castagnoli_sse42(
+                                              const assorted_crc32_polynomial_table_t *polynomial_table,
+                                              uint32_t crc32,
+                                              const uint8_t *buffer,
+                                              size_t size )
+{
+	const uint8_t *stream_end = NULL;
+	uint64_t crc32_stream1    = crc32;
+	uint64_t crc32_stream2    = 0;
+	uint64_t crc32_stream3    = 0;
+	uint64_t value_64bit1     = 0;
+	uint64_t value_64bit2     = 0;
+	uint64_t value_64bit3     = 0;
+
+	/* Align the buffer to 8 bytes
+	 */
+	while( ( size > 0 )
+	    && ( ( (intptr_t) buffer & 7 ) != 0 ) )
+	{
+		crc32_stream1 = _mm_crc32_u8( (uint32_t) crc32_stream1, *buffer );
+
+		buffer++;
+		size--;
+	}
+	while( size >= ( 3 * ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE ) )
+	{
+		crc32_stream2 = 0;
+		crc32_stream3 = 0;
+		stream_end    = &( buffer[ ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE ] );
+
+		do
+		{
+			memory_copy( &value_64bit1, buffer, 8 );
+			memory_copy( &value_64bit2, &( buffer[ ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE ] ), 8 );
+			memory_copy( &value_64bit3, &( buffer[ 2 * ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE ] ), 8 );
+
+			crc32_stream1 = _mm_crc32_u64( crc32_stream1, value_64bit1 );
+			crc32_stream2 = _mm_crc32_u64( crc32_stream2, value_64bit2 );
+			crc32_stream3 = _mm_crc32_u64( crc32_stream3, value_64bit3 );
+
+			buffer += 8;
+		}
+		while( buffer < stream_end );
+
+		crc32_stream1 = assorted_crc32_shift( polynomial_table->long_shift_table, crc32_stream1 ) ^ crc32_stream2;
+		crc32_stream1 = assorted_crc32_shift( polynomial_table->long_shift_table, crc32_stream1 ) ^ crc32_stream3;
+
+		buffer += 2 * ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE;
+		size   -= 3 * ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE;
+	}
+	while( size >= ( 3 * ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE ) )
+	{
+		crc32_stream2 = 0;
+		crc32_stream3 = 0;
+		stream_end    = &( buffer[ ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE ] );
+
+		do
+		{
+			memory_copy( &value_64bit1, buffer, 8 );
+			memory_copy( &value_64bit2, &( buffer[ ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE ] ), 8 );
+			memory_copy( &value_64bit3, &( buffer[ 2 * ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE ] ), 8 );
+
+			crc32_stream1 = _mm_crc32_u64( crc32_stream1, value_64bit1 );
+			crc32_stream2 = _mm_crc32_u64( crc32_stream2, value_64bit2 );
+			crc32_stream3 = _mm_crc32_u64( crc32_stream3, value_64bit3 );
+
+			buffer += 8;
+		}
+		while( buffer < stream_end );
+
+		crc32_stream1 = assorted_crc32_shift( polynomial_table->short_shift_table, crc32_stream1 ) ^ crc32_stream2;
+		crc32_stream1 = assorted_crc32_shift( polynomial_table->short_shift_table, crc32_stream1 ) ^ crc32_stream3;
+
+		buffer += 2 * ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE;
+		size   -= 3 * ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE;
+	}
+	while( size >= 8 )
+	{
+		memory_copy( &value_64bit1, buffer, 8 );
+
+		crc32_stream1 = _mm_crc32_u64( crc32_stream1, value_64bit1 );
+
+		buffer += 8;
+		size   -= 8;
+	}
+	while( size > 0 )
+	{
+		crc32_stream1 = _mm_crc32_u8( (uint32_t) crc32_stream1, *buffer );
+
+		buffer++;
+		size--;
+	}
+	return( (uint32_t) crc32_stream1 );
+}
+
+#endif /* defined( ASSORTED_CRC32_HAVE_SSE42 ) */
+
+/* Calculates the CRC-32C (Castagnoli) of a buffer
+ * Uses the SSE4.2 CRC-32 instruction when supported by the CPU, otherwise slicing-by-16
+ * Use a previous key of 0 to calculate a new CRC-32C
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_calculate_castagnoli(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	assorted_crc32_polynomial_table_t *temporary_table        = NULL;
+	const assorted_crc32_polynomial_table_t *polynomial_table = NULL;
+	static char *function                                     = "assorted_crc32_calculate_castagnoli";
+	uint32_t safe_crc32                                       = 0;
+	int result                                                = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = assorted_crc32_get_polynomial_table(
+	          ASSORTED_CRC32_POLYNOMIAL_CASTAGNOLI,
+	          &polynomial_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve polynomial table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* The cache is full, compute the tables for this calculation only
+		 */
+		temporary_table = memory_allocate_structure(
+		                   assorted_crc32_polynomial_table_t );
+
+		if( temporary_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create polynomial table.",
+			 function );
+
+			return( -1 );
+		}
+		assorted_crc32_compute_polynomial_table(
+		 temporary_table,
+		 ASSORTED_CRC32_POLYNOMIAL_CASTAGNOLI );
+
+		polynomial_table = temporary_table;
+	}
+	safe_crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+#if defined( ASSORTED_CRC32_HAVE_SSE42 )
+	if( assorted_crc32_have_castagnoli_instruction() != 0 )
+	{
+		safe_crc32 = assorted_crc32_castagnoli_sse42(
+		              polynomial_table,
+		              safe_crc32,
+		              buffer,
+		              size );
+	}
+	else
+#endif
+	{
+		safe_crc32 = assorted_crc32_update_slicing_by_16(
+		              polynomial_table->slicing_table,
+		              safe_crc32,
+		              buffer,
+		              size );
+	}
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= 0xffffffffUL;
+	}
+	if( temporary_table != NULL )
+	{
+		memory_free(
+		 temporary_table );
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
+
+/* Calculates the CRC-32 of a buffer with a specific polynomial
+ * Uses the fastest method available for the polynomial: folding for 0xedb88320,
+ * the CRC-32C instruction for 0x82f63b78 and otherwise slicing-by-16 using
+ * the cached tables of the polynomial or temporary tables if the cache is full
+ * Use the reversed polynomial
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_calculate_with_polynomial(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     uint32_t polynomial,
+     libcerror_error_t **error )
+{
+	assorted_crc32_polynomial_table_t *temporary_table        = NULL;
+	const assorted_crc32_polynomial_table_t *polynomial_table = NULL;
+	static char *function                                     = "assorted_crc32_calculate_with_polynomial";
+	uint32_t safe_crc32                                       = 0;
+	int result                                                = 0;
+
+	if( polynomial == ASSORTED_CRC32_POLYNOMIAL )
+	{
+		return( assorted_crc32_calculate_folded(
+		         crc32,
+		         buffer,
+		         size,
+		         initial_value,
+		         weak_crc,
+		         error ) );
+	}
+	else if( polynomial == ASSORTED_CRC32_POLYNOMIAL_CASTAGNOLI )
+	{
+		return( assorted_crc32_calculate_castagnoli(
+		         crc32,
+		         buffer,
+		         size,
+		         initial_value,
+		         weak_crc,
+		         error ) );
+	}
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = assorted_crc32_get_polynomial_table(
+	          polynomial,
+	          &polynomial_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve polynomial table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* The cache is full, compute the tables for this calculation only
+		 */
+		temporary_table = memory_allocate_structure(
+		                   assorted_crc32_polynomial_table_t );
+
+		if( temporary_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create polynomial table.",
+			 function );
+
+			return( -1 );
+		}
+		assorted_crc32_compute_polynomial_table(
+		 temporary_table,
+		 polynomial );
+
+		polynomial_table = temporary_table;
+	}
+	safe_crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	safe_crc32 = assorted_crc32_update_slicing_by_16(
+	              polynomial_table->slicing_table,
+	              safe_crc32,
+	              buffer,
+	              size );
+
+	if( weak_crc == 0 )
+	{
+		safe_crc32 ^= 0xffffffffUL;
+	}
+	if( temporary_table != NULL )
+	{
+		memory_free(
+		 temporary_table );
+	}
+	*crc32 = safe_crc32;
+
+	return( 1 );
+}
+
+/* Check the CRC-32 checksum for single-bit errors
+ * Returns 1 if successful, 0 if no error was found or -1 on error
+ */
+int assorted_crc32_validate(
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     uint8_t *bit_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "assorted_crc32_validate";
+	uint32_t crc32_xor_pattern = 0;
+	uint8_t safe_bit_index     = 0;
+	
+	if( bit_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit index.",
+		 function );
+
+		return( -1 );
+	}
+	crc32 ^= calculated_crc32;
+
+	crc32_xor_pattern = 1;
+
+        for( safe_bit_index = 0;
+	     safe_bit_index < 32;
+	     safe_bit_index += 1 )
+	{
+		if( crc32_xor_pattern == crc32 )
+		{
+			*bit_index = safe_bit_index;
+
+			return( 1 );
+		}
+		crc32_xor_pattern = ( crc32_xor_pattern << 1 ) ^ ( 0x04c11db7UL & ( crc32_xor_pattern >> 31 ) );
+	}
 	return( 0 );
 }
 
@@ -31,9 +31,79 @@
 extern "C" {
 #endif
 
+/* The carry-less multiplication folding kernels are available with GCC compatible
+ * compilers on x86 and on little-endian ARMv8 Linux, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define ASSORTED_CRC32_HAVE_PCLMUL
+
+#if defined( __clang__ ) || ( __GNUC__ >= 9 )
+#define ASSORTED_CRC32_HAVE_VPCLMUL
+#endif
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ ) && defined( __linux__ )
+#define ASSORTED_CRC32_HAVE_PMULL
+
+#endif
+
+/* The SSE4.2 CRC-32C instruction kernel is available with GCC compatible compilers on x86-64
+ */
+#if defined( __GNUC__ ) && defined( __x86_64__ )
+#define ASSORTED_CRC32_HAVE_SSE42
+#endif
+
+/* The reversed polynomials of CRC-32 and CRC-32C (Castagnoli)
+ */
+#define ASSORTED_CRC32_POLYNOMIAL		0xedb88320UL
+#define ASSORTED_CRC32_POLYNOMIAL_CASTAGNOLI	0x82f63b78UL
+
+/* The number of polynomial tables that are cached
+ */
+#define ASSORTED_CRC32_NUMBER_OF_CACHED_TABLES	4
+
+/* The sizes of the interleaved streams of the CRC-32C instruction kernel
+ */
+#define ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE	8192
+#define ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE	256
+
+enum ASSORTED_CRC32_FOLD_METHODS
+{
+	ASSORTED_CRC32_FOLD_METHOD_NONE		= 0x00,
+	ASSORTED_CRC32_FOLD_METHOD_PCLMUL	= 0x01,
+	ASSORTED_CRC32_FOLD_METHOD_VPCLMUL	= 0x02,
+	ASSORTED_CRC32_FOLD_METHOD_PMULL	= 0x03
+};
+
+typedef struct assorted_crc32_polynomial_table assorted_crc32_polynomial_table_t;
+
+struct assorted_crc32_polynomial_table
+{
+	/* The reversed polynomial
+	 */
+	uint32_t polynomial;
+
+	/* Tables of the CRC-32 of all 8-bit messages followed by 0 to 15 zero bytes
+	 */
+	uint32_t slicing_table[ 16 ][ 256 ];
+
+	/* Tables to shift a CRC-32 over the long and short interleaved stream sizes,
+	 * one per byte of the CRC-32
+	 */
+	uint32_t long_shift_table[ 4 ][ 256 ];
+	uint32_t short_shift_table[ 4 ][ 256 ];
+};
+
 void assorted_crc32_initialize_table(
       uint32_t polynomial );
 
+void assorted_crc32_initialize_slicing_table(
+      uint32_t polynomial );
+
+int assorted_crc32_get_polynomial_table(
+     uint32_t polynomial,
+     const assorted_crc32_polynomial_table_t **polynomial_table,
+     libcerror_error_t **error );
+
 int assorted_crc32_calculate_modulo2(
      uint32_t *crc32,
      const uint8_t *buffer,
@@ -50,18 +120,122 @@ int assorted_crc32_calculate(
      uint8_t weak_crc,
      libcerror_error_t **error );
 
-int assorted_crc32_validate(
-     uint32_t crc32,
-     uint32_t calculated_crc32,
-     uint8_t *bit_index,
+int assorted_crc32_calculate_slicing_by_8(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
      libcerror_error_t **error );
 
-int assorted_crc32_locate_error_offset(
-     uint32_t crc32,
-     uint32_t calculated_crc32,
+int assorted_crc32_calculate_slicing_by_16(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+int assorted_crc32_get_fold_method(
+     void );
+
+#if defined( ASSORTED_CRC32_HAVE_PCLMUL )
+
+uint32_t assorted_crc32_fold_pclmul(
+          uint32_t crc32,
+          const uint8_t *buffer,
+          size_t size );
+
+uint32_t assorted_crc32_copy_fold_pclmul(
+          uint32_t crc32,
+          uint8_t *destination,
+          const uint8_t *source,
+          size_t size );
+
+#endif /* defined( ASSORTED_CRC32_HAVE_PCLMUL ) */
+
+#if defined( ASSORTED_CRC32_HAVE_VPCLMUL )
+
+uint32_t assorted_crc32_fold_vpclmul(
+          uint32_t crc32,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_CRC32_HAVE_VPCLMUL ) */
+
+#if defined( ASSORTED_CRC32_HAVE_PMULL )
+
+uint32_t assorted_crc32_fold_pmull(
+          uint32_t crc32,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_CRC32_HAVE_PMULL ) */
+
+int assorted_crc32_calculate_folded(
+     uint32_t *crc32,
      const uint8_t *buffer,
      size_t size,
      uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+int assorted_crc32_copy_calculate(
+     uint32_t *crc32,
+     uint8_t *destination,
+     const uint8_t *source,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+uint32_t assorted_crc32_multiply_modulo(
+          uint32_t first_value,
+          uint32_t second_value,
+          uint32_t polynomial );
+
+int assorted_crc32_combine(
+     uint32_t *crc32,
+     uint32_t first_crc32,
+     uint32_t second_crc32,
+     size64_t second_size,
+     uint32_t polynomial,
+     libcerror_error_t **error );
+
+int assorted_crc32_have_castagnoli_instruction(
+     void );
+
+#if defined( ASSORTED_CRC32_HAVE_SSE42 )
+
+uint32_t assorted_crc32_castagnoli_sse42(
+          const assorted_crc32_polynomial_table_t *polynomial_table,
+          uint32_t crc32,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_CRC32_HAVE_SSE42 ) */
+
+int assorted_crc32_calculate_castagnoli(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+int assorted_crc32_calculate_with_polynomial(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     uint32_t polynomial,
+     libcerror_error_t **error );
+
+int assorted_crc32_validate(
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     uint8_t *bit_index,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
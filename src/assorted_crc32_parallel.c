@@ -0,0 +1,753 @@
+/*
+ * CRC-32 parallel calculation functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_crc32.h"
+#include "assorted_crc32_parallel.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+/* Calculates the CRC-32 of a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_parallel_calculate_chunk(
+     assorted_crc32_parallel_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc32_parallel_calculate_chunk";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_crc32_calculate_with_polynomial(
+	     &( chunk->crc32 ),
+	     chunk->buffer,
+	     chunk->size,
+	     chunk->initial_value,
+	     chunk->weak_crc,
+	     chunk->polynomial,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Calculates the CRC-32 of a chunk from a thread pool
+ * The error is not available from the worker thread, the result is stored in the chunk
+ * Returns 1 on success or -1 on error
+ */
+int assorted_crc32_parallel_calculate_chunk_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_crc32_parallel_chunk_t *chunk = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	chunk = (assorted_crc32_parallel_chunk_t *) value;
+
+	chunk->result = assorted_crc32_parallel_calculate_chunk(
+	                 chunk,
+	                 NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Calculates the CRC-32 of every block in a block range
+ * The last block can be smaller than the block size
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_parallel_calculate_block_range(
+     assorted_crc32_parallel_block_range_t *block_range,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc32_parallel_calculate_block_range";
+	size_t block_index    = 0;
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+
+	if( block_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block range.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_range->buffer == NULL )
+	 || ( block_range->crc32_values == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block range - missing buffer or CRC-32 values.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_range->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block range - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < block_range->size )
+	{
+		read_size = block_range->size - buffer_offset;
+
+		if( read_size > block_range->block_size )
+		{
+			read_size = block_range->block_size;
+		}
+		if( assorted_crc32_calculate_with_polynomial(
+		     &( block_range->crc32_values[ block_index ] ),
+		     &( block_range->buffer[ buffer_offset ] ),
+		     read_size,
+		     block_range->initial_value,
+		     block_range->weak_crc,
+		     block_range->polynomial,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate CRC-32 of block: %" PRIzd ".",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		buffer_offset += read_size;
+
+		block_index++;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Calculates the CRC-32 of every block in a block range from a thread pool
+ * The error is not available from the worker thread, the result is stored in the block range
+ * Returns 1 on success or -1 on error
+ */
+int assorted_crc32_parallel_calculate_block_range_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_crc32_parallel_block_range_t *block_range = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	block_range = (assorted_crc32_parallel_block_range_t *) value;
+
+	block_range->result = assorted_crc32_parallel_calculate_block_range(
+	                       block_range,
+	                       NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Calculates the CRC-32 of a buffer with chunks of the buffer calculated in parallel
+ * The buffer is split into a chunk per thread, where every chunk except the first
+ * is calculated with an initial value of 0, after which the CRC-32 of the chunks
+ * are combined in order
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_parallel_calculate(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     uint32_t polynomial,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	assorted_crc32_parallel_chunk_t *chunks = NULL;
+	static char *function                   = "assorted_crc32_parallel_calculate";
+	size_t buffer_offset                    = 0;
+	size_t chunk_index                      = 0;
+	size_t chunk_size                       = 0;
+	size_t number_of_chunks                 = 0;
+	uint32_t safe_crc32                     = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool     = NULL;
+	int maximum_number_of_values            = 0;
+#endif
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Round the chunk size up to a multiple of 64 to use the full folding width
+	 */
+	chunk_size = ( size + number_of_threads - 1 ) / number_of_threads;
+
+	if( chunk_size < ASSORTED_CRC32_PARALLEL_MINIMUM_CHUNK_SIZE )
+	{
+		chunk_size = ASSORTED_CRC32_PARALLEL_MINIMUM_CHUNK_SIZE;
+	}
+	chunk_size = ( chunk_size + 63 ) & ~( (size_t) 63 );
+
+	number_of_chunks = ( size + chunk_size - 1 ) / chunk_size;
+
+	if( number_of_chunks == 0 )
+	{
+		number_of_chunks = 1;
+	}
+	chunks = (assorted_crc32_parallel_chunk_t *) memory_allocate(
+	                                              sizeof( assorted_crc32_parallel_chunk_t ) * number_of_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunks[ chunk_index ].buffer        = &( buffer[ buffer_offset ] );
+		chunks[ chunk_index ].size          = size - buffer_offset;
+		chunks[ chunk_index ].initial_value = 0;
+		chunks[ chunk_index ].weak_crc      = weak_crc;
+		chunks[ chunk_index ].polynomial    = polynomial;
+		chunks[ chunk_index ].crc32         = 0;
+		chunks[ chunk_index ].result        = 0;
+
+		if( chunks[ chunk_index ].size > chunk_size )
+		{
+			chunks[ chunk_index ].size = chunk_size;
+		}
+		buffer_offset += chunks[ chunk_index ].size;
+	}
+	chunks[ 0 ].initial_value = initial_value;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_chunks > 1 ) )
+	{
+		if( number_of_chunks > (size_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chunks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_chunks )
+		{
+			maximum_number_of_values = (int) number_of_chunks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &assorted_crc32_parallel_calculate_chunk_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( chunks[ chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push chunk: %" PRIzd " onto thread pool queue.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		/* Without a thread pool or if the chunk failed the chunk is calculated here
+		 * to retrieve the error
+		 */
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			chunks[ chunk_index ].result = assorted_crc32_parallel_calculate_chunk(
+			                                &( chunks[ chunk_index ] ),
+			                                error );
+
+			if( chunks[ chunk_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate CRC-32 of chunk: %" PRIzd ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( chunk_index == 0 )
+		{
+			safe_crc32 = chunks[ chunk_index ].crc32;
+		}
+		else if( assorted_crc32_combine(
+		          &safe_crc32,
+		          safe_crc32,
+		          chunks[ chunk_index ].crc32,
+		          (size64_t) chunks[ chunk_index ].size,
+		          polynomial,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to combine CRC-32 of chunk: %" PRIzd ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 chunks );
+
+	*crc32 = safe_crc32;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
+	}
+	return( -1 );
+}
+
+/* Calculates the CRC-32 of every block of a buffer with ranges of blocks calculated in parallel
+ * The CRC-32 of every block is calculated independently with the same initial value,
+ * where the last block can be smaller than the block size
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_parallel_calculate_blocks(
+     uint32_t *crc32_values,
+     size_t number_of_crc32_values,
+     const uint8_t *buffer,
+     size_t size,
+     size_t block_size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     uint32_t polynomial,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	assorted_crc32_parallel_block_range_t *block_ranges = NULL;
+	static char *function                               = "assorted_crc32_parallel_calculate_blocks";
+	size_t blocks_per_range                             = 0;
+	size_t buffer_offset                                = 0;
+	size_t number_of_blocks                             = 0;
+	size_t number_of_block_ranges                       = 0;
+	size_t range_index                                  = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool                 = NULL;
+	int maximum_number_of_values                        = 0;
+#endif
+
+	if( crc32_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32 values.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = ( size / block_size ) + ( ( size % block_size ) != 0 ? 1 : 0 );
+
+	if( number_of_crc32_values < number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of CRC-32 values value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == 0 )
+	{
+		return( 1 );
+	}
+	/* Every range contains whole blocks and is at least the minimum chunk size
+	 * so that small blocks do not result in a thread pool task per block
+	 */
+	blocks_per_range = ( number_of_blocks + number_of_threads - 1 ) / number_of_threads;
+
+	if( ( blocks_per_range * block_size ) < ASSORTED_CRC32_PARALLEL_MINIMUM_CHUNK_SIZE )
+	{
+		blocks_per_range = ( ASSORTED_CRC32_PARALLEL_MINIMUM_CHUNK_SIZE + block_size - 1 ) / block_size;
+	}
+	number_of_block_ranges = ( number_of_blocks + blocks_per_range - 1 ) / blocks_per_range;
+
+	block_ranges = (assorted_crc32_parallel_block_range_t *) memory_allocate(
+	                                                          sizeof( assorted_crc32_parallel_block_range_t ) * number_of_block_ranges );
+
+	if( block_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block ranges.",
+		 function );
+
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_block_ranges;
+	     range_index++ )
+	{
+		block_ranges[ range_index ].buffer        = &( buffer[ buffer_offset ] );
+		block_ranges[ range_index ].size          = size - buffer_offset;
+		block_ranges[ range_index ].block_size    = block_size;
+		block_ranges[ range_index ].initial_value = initial_value;
+		block_ranges[ range_index ].weak_crc      = weak_crc;
+		block_ranges[ range_index ].polynomial    = polynomial;
+		block_ranges[ range_index ].crc32_values  = &( crc32_values[ range_index * blocks_per_range ] );
+		block_ranges[ range_index ].result        = 0;
+
+		if( block_ranges[ range_index ].size > ( blocks_per_range * block_size ) )
+		{
+			block_ranges[ range_index ].size = blocks_per_range * block_size;
+		}
+		buffer_offset += block_ranges[ range_index ].size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_block_ranges > 1 ) )
+	{
+		if( number_of_block_ranges > (size_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of block ranges value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_block_ranges )
+		{
+			maximum_number_of_values = (int) number_of_block_ranges;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &assorted_crc32_parallel_calculate_block_range_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( range_index = 0;
+		     range_index < number_of_block_ranges;
+		     range_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( block_ranges[ range_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push block range: %" PRIzd " onto thread pool queue.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( range_index = 0;
+	     range_index < number_of_block_ranges;
+	     range_index++ )
+	{
+		/* Without a thread pool or if the block range failed the block range
+		 * is calculated here to retrieve the error
+		 */
+		if( block_ranges[ range_index ].result != 1 )
+		{
+			block_ranges[ range_index ].result = assorted_crc32_parallel_calculate_block_range(
+			                                      &( block_ranges[ range_index ] ),
+			                                      error );
+
+			if( block_ranges[ range_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate CRC-32 of block range: %" PRIzd ".",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 block_ranges );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( block_ranges != NULL )
+	{
+		memory_free(
+		 block_ranges );
+	}
+	return( -1 );
+}
+
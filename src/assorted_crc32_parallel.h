@@ -0,0 +1,159 @@
+/*
+ * CRC-32 parallel calculation functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_CRC32_PARALLEL_H )
+#define _ASSORTED_CRC32_PARALLEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum size of a chunk that is calculated by a thread pool task
+ */
+#define ASSORTED_CRC32_PARALLEL_MINIMUM_CHUNK_SIZE	( 1024 * 1024 )
+
+typedef struct assorted_crc32_parallel_chunk assorted_crc32_parallel_chunk_t;
+
+struct assorted_crc32_parallel_chunk
+{
+	/* The buffer
+	 */
+	const uint8_t *buffer;
+
+	/* The size of the buffer
+	 */
+	size_t size;
+
+	/* The initial value
+	 */
+	uint32_t initial_value;
+
+	/* Value to indicate a weak CRC-32 should be calculated
+	 */
+	uint8_t weak_crc;
+
+	/* The polynomial
+	 */
+	uint32_t polynomial;
+
+	/* The calculated CRC-32
+	 */
+	uint32_t crc32;
+
+	/* The result of the chunk calculation, 0 if not calculated
+	 */
+	int result;
+};
+
+typedef struct assorted_crc32_parallel_block_range assorted_crc32_parallel_block_range_t;
+
+struct assorted_crc32_parallel_block_range
+{
+	/* The buffer
+	 */
+	const uint8_t *buffer;
+
+	/* The size of the buffer
+	 */
+	size_t size;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The initial value of every block
+	 */
+	uint32_t initial_value;
+
+	/* Value to indicate a weak CRC-32 should be calculated
+	 */
+	uint8_t weak_crc;
+
+	/* The polynomial
+	 */
+	uint32_t polynomial;
+
+	/* The calculated CRC-32 values, one per block
+	 */
+	uint32_t *crc32_values;
+
+	/* The result of the block range calculation, 0 if not calculated
+	 */
+	int result;
+};
+
+int assorted_crc32_parallel_calculate_chunk(
+     assorted_crc32_parallel_chunk_t *chunk,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_crc32_parallel_calculate_chunk_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_crc32_parallel_calculate_block_range(
+     assorted_crc32_parallel_block_range_t *block_range,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_crc32_parallel_calculate_block_range_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_crc32_parallel_calculate(
+     uint32_t *crc32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     uint32_t polynomial,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int assorted_crc32_parallel_calculate_blocks(
+     uint32_t *crc32_values,
+     size_t number_of_crc32_values,
+     const uint8_t *buffer,
+     size_t size,
+     size_t block_size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     uint32_t polynomial,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_CRC32_PARALLEL_H ) */
+
@@ -0,0 +1,566 @@
+/*
+ * CRC-32 single-bit error syndrome table functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_crc32.h"
+#include "assorted_crc32_syndrome_table.h"
+#include "assorted_libcerror.h"
+
+/* A single-bit error d bits before the end of a buffer changes the CRC-32 by
+ * x^(32 + d) modulo the polynomial, independent of the data and initial value.
+ * The syndrome table stores x^(32 + j * step_size) for every step index j
+ * in a hash table, locating an error takes at most step_size multiplications
+ * of the syndrome by x until it matches a stored syndrome, where a step size
+ * of 1 results in a single lookup.
+ */
+
+/* Multiplies a bit-reflected value by x modulo the reversed polynomial
+ */
+#define assorted_crc32_syndrome_table_multiply_by_x( value, polynomial ) \
+	( ( ( value ) >> 1 ) ^ ( ( ( value ) & 0x00000001UL ) != 0 ? ( polynomial ) : 0 ) )
+
+/* Retrieves the hash table entry index of a syndrome
+ */
+#define assorted_crc32_syndrome_table_get_hash_value( syndrome, number_of_entries ) \
+	( (uint32_t) ( ( syndrome ) * 0x9e3779b1UL ) & ( ( number_of_entries ) - 1 ) )
+
+/* Determines x^exponent modulo the reversed polynomial using repeated squaring
+ * Returns the bit-reflected power of x
+ */
+static uint32_t assorted_crc32_syndrome_table_get_power_of_x(
+                 uint64_t exponent,
+                 uint32_t polynomial )
+{
+	uint32_t power_of_x    = 0x80000000UL;
+	uint32_t squared_power = 0x40000000UL;
+
+	while( exponent != 0 )
+	{
+		if( ( exponent & 1 ) != 0 )
+		{
+			power_of_x = assorted_crc32_multiply_modulo(
+			              squared_power,
+			              power_of_x,
+			              polynomial );
+		}
+		squared_power = assorted_crc32_multiply_modulo(
+		                 squared_power,
+		                 squared_power,
+		                 polynomial );
+
+		exponent >>= 1;
+	}
+	return( power_of_x );
+}
+
+/* Creates a syndrome table
+ * Make sure the value syndrome_table is referencing, is set to NULL
+ * The maximum number of steps determines the memory usage, which is
+ * 16 bytes per step, and the step size; for a buffer size of n bytes
+ * a maximum number of 8 * n steps or more results in a lookup per error
+ * and a maximum number of steps of sqrt( 8 * n ) results in the least
+ * work to build the table and locate a single error
+ * Use the reversed polynomial
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_syndrome_table_initialize(
+     assorted_crc32_syndrome_table_t **syndrome_table,
+     size_t size,
+     uint32_t polynomial,
+     uint32_t maximum_number_of_steps,
+     libcerror_error_t **error )
+{
+	static char *function   = "assorted_crc32_syndrome_table_initialize";
+	size_t array_size       = 0;
+	uint64_t number_of_bits = 0;
+	uint64_t step_size      = 0;
+	uint32_t entry_index    = 0;
+	uint32_t power_of_x     = 0;
+	uint32_t step_index     = 0;
+	uint32_t syndrome       = 0;
+
+	if( syndrome_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid syndrome table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *syndrome_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid syndrome table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( polynomial & 0x80000000UL ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported polynomial.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_steps == 0 )
+	 || ( maximum_number_of_steps > ( (uint32_t) INT32_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of steps value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*syndrome_table = memory_allocate_structure(
+	                   assorted_crc32_syndrome_table_t );
+
+	if( *syndrome_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create syndrome table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *syndrome_table,
+	     0,
+	     sizeof( assorted_crc32_syndrome_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear syndrome table.",
+		 function );
+
+		memory_free(
+		 *syndrome_table );
+
+		*syndrome_table = NULL;
+
+		return( -1 );
+	}
+	number_of_bits = (uint64_t) size * 8;
+
+	/* The step size is chosen so that the steps cover the bits of the buffer
+	 */
+	step_size = ( number_of_bits + maximum_number_of_steps - 1 ) / maximum_number_of_steps;
+
+	( *syndrome_table )->polynomial      = polynomial;
+	( *syndrome_table )->size            = size;
+	( *syndrome_table )->number_of_bits  = number_of_bits;
+	( *syndrome_table )->step_size       = step_size;
+	( *syndrome_table )->number_of_steps = (uint32_t) ( ( ( number_of_bits - 1 ) + step_size - 1 ) / step_size ) + 1;
+
+	/* Use a hash table that is at most half full
+	 */
+	( *syndrome_table )->number_of_entries = 1;
+
+	while( ( *syndrome_table )->number_of_entries < ( 2 * ( *syndrome_table )->number_of_steps ) )
+	{
+		( *syndrome_table )->number_of_entries <<= 1;
+	}
+	array_size = sizeof( uint32_t ) * ( *syndrome_table )->number_of_entries;
+
+	( *syndrome_table )->syndromes = (uint32_t *) memory_allocate(
+	                                               array_size );
+
+	if( ( *syndrome_table )->syndromes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create syndromes.",
+		 function );
+
+		goto on_error;
+	}
+	( *syndrome_table )->step_indexes = (uint32_t *) memory_allocate(
+	                                                  array_size );
+
+	if( ( *syndrome_table )->step_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create step indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *syndrome_table )->step_indexes,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear step indexes.",
+		 function );
+
+		goto on_error;
+	}
+	power_of_x = assorted_crc32_syndrome_table_get_power_of_x(
+	              step_size,
+	              polynomial );
+
+	/* x^32 modulo the polynomial is the polynomial without the x^32 term
+	 */
+	syndrome = polynomial;
+
+	for( step_index = 0;
+	     step_index < ( *syndrome_table )->number_of_steps;
+	     step_index++ )
+	{
+		entry_index = assorted_crc32_syndrome_table_get_hash_value(
+		               syndrome,
+		               ( *syndrome_table )->number_of_entries );
+
+		while( ( *syndrome_table )->step_indexes[ entry_index ] != 0 )
+		{
+			if( ( *syndrome_table )->syndromes[ entry_index ] == syndrome )
+			{
+				break;
+			}
+			entry_index = ( entry_index + 1 ) & ( ( *syndrome_table )->number_of_entries - 1 );
+		}
+		/* If the syndromes repeat within the buffer, which happens when the buffer
+		 * is larger than the period of the polynomial, keep the first step index
+		 */
+		if( ( *syndrome_table )->step_indexes[ entry_index ] == 0 )
+		{
+			( *syndrome_table )->syndromes[ entry_index ]    = syndrome;
+			( *syndrome_table )->step_indexes[ entry_index ] = step_index + 1;
+		}
+		syndrome = assorted_crc32_multiply_modulo(
+		            power_of_x,
+		            syndrome,
+		            polynomial );
+	}
+	return( 1 );
+
+on_error:
+	if( *syndrome_table != NULL )
+	{
+		if( ( *syndrome_table )->step_indexes != NULL )
+		{
+			memory_free(
+			 ( *syndrome_table )->step_indexes );
+		}
+		if( ( *syndrome_table )->syndromes != NULL )
+		{
+			memory_free(
+			 ( *syndrome_table )->syndromes );
+		}
+		memory_free(
+		 *syndrome_table );
+
+		*syndrome_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a syndrome table
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc32_syndrome_table_free(
+     assorted_crc32_syndrome_table_t **syndrome_table,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc32_syndrome_table_free";
+
+	if( syndrome_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid syndrome table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *syndrome_table != NULL )
+	{
+		if( ( *syndrome_table )->step_indexes != NULL )
+		{
+			memory_free(
+			 ( *syndrome_table )->step_indexes );
+		}
+		if( ( *syndrome_table )->syndromes != NULL )
+		{
+			memory_free(
+			 ( *syndrome_table )->syndromes );
+		}
+		memory_free(
+		 *syndrome_table );
+
+		*syndrome_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset of a single-bit error in the buffer
+ * The error bit is the index of the bit in the byte, where 0 is the least significant bit
+ * The CRC-32 must be calculated with the polynomial of the syndrome table
+ * over a buffer of the size of the syndrome table
+ * Returns 1 if successful, 0 if no single-bit error was found or -1 on error
+ */
+int assorted_crc32_syndrome_table_get_error_offset(
+     assorted_crc32_syndrome_table_t *syndrome_table,
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t *error_offset,
+     uint8_t *error_bit,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc32_syndrome_table_get_error_offset";
+	uint64_t bit_distance = 0;
+	uint64_t step         = 0;
+	uint32_t entry_index  = 0;
+	uint32_t step_index   = 0;
+	uint32_t syndrome     = 0;
+
+	if( syndrome_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid syndrome table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( syndrome_table->syndromes == NULL )
+	 || ( syndrome_table->step_indexes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid syndrome table - missing hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error bit.",
+		 function );
+
+		return( -1 );
+	}
+	syndrome = crc32 ^ calculated_crc32;
+
+	if( syndrome == 0 )
+	{
+		return( 0 );
+	}
+	/* Multiply the syndrome by x until it matches x^(32 + step_index * step_size),
+	 * then the error is step_index * step_size - step bits before the end of the buffer
+	 */
+	for( step = 0;
+	     step < syndrome_table->step_size;
+	     step++ )
+	{
+		entry_index = assorted_crc32_syndrome_table_get_hash_value(
+		               syndrome,
+		               syndrome_table->number_of_entries );
+
+		while( syndrome_table->step_indexes[ entry_index ] != 0 )
+		{
+			if( syndrome_table->syndromes[ entry_index ] == syndrome )
+			{
+				step_index = syndrome_table->step_indexes[ entry_index ] - 1;
+
+				bit_distance = ( (uint64_t) step_index * syndrome_table->step_size ) - step;
+
+				if( ( ( (uint64_t) step_index * syndrome_table->step_size ) >= step )
+				 && ( bit_distance < syndrome_table->number_of_bits ) )
+				{
+					*error_offset = syndrome_table->size - 1 - (size_t) ( bit_distance / 8 );
+					*error_bit    = (uint8_t) ( 7 - ( bit_distance % 8 ) );
+
+					return( 1 );
+				}
+				break;
+			}
+			entry_index = ( entry_index + 1 ) & ( syndrome_table->number_of_entries - 1 );
+		}
+		syndrome = assorted_crc32_syndrome_table_multiply_by_x(
+		            syndrome,
+		            syndrome_table->polynomial );
+	}
+	return( 0 );
+}
+
+/* Locates a single-bit error in a buffer using a syndrome table that is only used once
+ * The syndrome table is sized to minimize the work of building the table and the lookup
+ * Use a syndrome table to locate the errors in multiple buffers of the same size
+ * Returns 1 if successful, 0 if no single-bit error was found or -1 on error
+ */
+int assorted_crc32_syndrome_table_locate_error_offset(
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t size,
+     uint32_t polynomial,
+     size_t *error_offset,
+     uint8_t *error_bit,
+     libcerror_error_t **error )
+{
+	assorted_crc32_syndrome_table_t *syndrome_table = NULL;
+	static char *function                           = "assorted_crc32_syndrome_table_locate_error_offset";
+	uint64_t number_of_bits                         = 0;
+	uint32_t maximum_number_of_steps                = 1;
+	int result                                      = 0;
+
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bits = (uint64_t) size * 8;
+
+	/* Determine the integer square root of the number of bits
+	 */
+	while( ( ( (uint64_t) maximum_number_of_steps * maximum_number_of_steps ) < number_of_bits )
+	    && ( maximum_number_of_steps < ASSORTED_CRC32_SYNDROME_TABLE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		maximum_number_of_steps <<= 1;
+	}
+	if( assorted_crc32_syndrome_table_initialize(
+	     &syndrome_table,
+	     size,
+	     polynomial,
+	     maximum_number_of_steps,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create syndrome table.",
+		 function );
+
+		goto on_error;
+	}
+	result = assorted_crc32_syndrome_table_get_error_offset(
+	          syndrome_table,
+	          crc32,
+	          calculated_crc32,
+	          error_offset,
+	          error_bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve error offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_crc32_syndrome_table_free(
+	     &syndrome_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free syndrome table.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( syndrome_table != NULL )
+	{
+		assorted_crc32_syndrome_table_free(
+		 &syndrome_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
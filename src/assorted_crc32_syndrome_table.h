@@ -0,0 +1,108 @@
+/*
+ * CRC-32 single-bit error syndrome table functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_CRC32_SYNDROME_TABLE_H )
+#define _ASSORTED_CRC32_SYNDROME_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default maximum number of entries of a syndrome table
+ */
+#define ASSORTED_CRC32_SYNDROME_TABLE_MAXIMUM_NUMBER_OF_ENTRIES	( 1024 * 1024 )
+
+typedef struct assorted_crc32_syndrome_table assorted_crc32_syndrome_table_t;
+
+struct assorted_crc32_syndrome_table
+{
+	/* The reversed polynomial
+	 */
+	uint32_t polynomial;
+
+	/* The size of the buffer
+	 */
+	size_t size;
+
+	/* The number of bits of the buffer
+	 */
+	uint64_t number_of_bits;
+
+	/* The number of bits between the syndromes stored in the table
+	 */
+	uint64_t step_size;
+
+	/* The number of syndromes stored in the table
+	 */
+	uint32_t number_of_steps;
+
+	/* The number of hash table entries, which is a power of 2
+	 */
+	uint32_t number_of_entries;
+
+	/* The syndromes of the hash table entries
+	 */
+	uint32_t *syndromes;
+
+	/* The step index + 1 of the hash table entries, 0 if not set
+	 */
+	uint32_t *step_indexes;
+};
+
+int assorted_crc32_syndrome_table_initialize(
+     assorted_crc32_syndrome_table_t **syndrome_table,
+     size_t size,
+     uint32_t polynomial,
+     uint32_t maximum_number_of_steps,
+     libcerror_error_t **error );
+
+int assorted_crc32_syndrome_table_free(
+     assorted_crc32_syndrome_table_t **syndrome_table,
+     libcerror_error_t **error );
+
+int assorted_crc32_syndrome_table_get_error_offset(
+     assorted_crc32_syndrome_table_t *syndrome_table,
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t *error_offset,
+     uint8_t *error_bit,
+     libcerror_error_t **error );
+
+int assorted_crc32_syndrome_table_locate_error_offset(
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t size,
+     uint32_t polynomial,
+     size_t *error_offset,
+     uint8_t *error_bit,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_CRC32_SYNDROME_TABLE_H ) */
+
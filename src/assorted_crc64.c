@@ -20,13 +20,27 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#include "assorted_cpu_features.h"
 #include "assorted_crc64.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#if defined( ASSORTED_CRC64_HAVE_PCLMUL )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_CRC64_HAVE_PMULL )
+#include <arm_neon.h>
+
+#endif
+
 /* Table of the CRC-64 of all 8-bit messages.
  * Polynomial: 0x92c64265d32139a4
  */
@@ -167,7 +181,1149 @@ uint64_t assorted_crc64_table2[ 256 ] = {
 	0x5dedc41a34bbeeb2ULL, 0x1f1d25f19d51d821ULL, 0xd80c07cd676f8394ULL, 0x9afce626ce85b507ULL
 };
 
-/* Value to indicate the CRC-64 table been computed
+/* Table of the CRC-64 of all 8-bit messages in reverse bit-order
+ * Polynomial: 0x9a6c9329ac4bc9b5
+ */
+const uint64_t assorted_crc64_table3[ 256 ] = {
+	0x0000000000000000ULL, 0x7f6ef0c830358979ULL, 0xfedde190606b12f2ULL, 0x81b31158505e9b8bULL,
+	0xc962e5739841b68fULL, 0xb60c15bba8743ff6ULL, 0x37bf04e3f82aa47dULL, 0x48d1f42bc81f2d04ULL,
+	0xa61cecb46814fe75ULL, 0xd9721c7c5821770cULL, 0x58c10d24087fec87ULL, 0x27affdec384a65feULL,
+	0x6f7e09c7f05548faULL, 0x1010f90fc060c183ULL, 0x91a3e857903e5a08ULL, 0xeecd189fa00bd371ULL,
+	0x78e0ff3b88be6f81ULL, 0x078e0ff3b88be6f8ULL, 0x863d1eabe8d57d73ULL, 0xf953ee63d8e0f40aULL,
+	0xb1821a4810ffd90eULL, 0xceecea8020ca5077ULL, 0x4f5ffbd87094cbfcULL, 0x30310b1040a14285ULL,
+	0xdefc138fe0aa91f4ULL, 0xa192e347d09f188dULL, 0x2021f21f80c18306ULL, 0x5f4f02d7b0f40a7fULL,
+	0x179ef6fc78eb277bULL, 0x68f0063448deae02ULL, 0xe943176c18803589ULL, 0x962de7a428b5bcf0ULL,
+	0xf1c1fe77117cdf02ULL, 0x8eaf0ebf2149567bULL, 0x0f1c1fe77117cdf0ULL, 0x7072ef2f41224489ULL,
+	0x38a31b04893d698dULL, 0x47cdebccb908e0f4ULL, 0xc67efa94e9567b7fULL, 0xb9100a5cd963f206ULL,
+	0x57dd12c379682177ULL, 0x28b3e20b495da80eULL, 0xa900f35319033385ULL, 0xd66e039b2936bafcULL,
+	0x9ebff7b0e12997f8ULL, 0xe1d10778d11c1e81ULL, 0x606216208142850aULL, 0x1f0ce6e8b1770c73ULL,
+	0x8921014c99c2b083ULL, 0xf64ff184a9f739faULL, 0x77fce0dcf9a9a271ULL, 0x08921014c99c2b08ULL,
+	0x4043e43f0183060cULL, 0x3f2d14f731b68f75ULL, 0xbe9e05af61e814feULL, 0xc1f0f56751dd9d87ULL,
+	0x2f3dedf8f1d64ef6ULL, 0x50531d30c1e3c78fULL, 0xd1e00c6891bd5c04ULL, 0xae8efca0a188d57dULL,
+	0xe65f088b6997f879ULL, 0x9931f84359a27100ULL, 0x1882e91b09fcea8bULL, 0x67ec19d339c963f2ULL,
+	0xd75adabd7a6e2d6fULL, 0xa8342a754a5ba416ULL, 0x29873b2d1a053f9dULL, 0x56e9cbe52a30b6e4ULL,
+	0x1e383fcee22f9be0ULL, 0x6156cf06d21a1299ULL, 0xe0e5de5e82448912ULL, 0x9f8b2e96b271006bULL,
+	0x71463609127ad31aULL, 0x0e28c6c1224f5a63ULL, 0x8f9bd7997211c1e8ULL, 0xf0f5275142244891ULL,
+	0xb824d37a8a3b6595ULL, 0xc74a23b2ba0eececULL, 0x46f932eaea507767ULL, 0x3997c222da65fe1eULL,
+	0xafba2586f2d042eeULL, 0xd0d4d54ec2e5cb97ULL, 0x5167c41692bb501cULL, 0x2e0934dea28ed965ULL,
+	0x66d8c0f56a91f461ULL, 0x19b6303d5aa47d18ULL, 0x980521650afae693ULL, 0xe76bd1ad3acf6feaULL,
+	0x09a6c9329ac4bc9bULL, 0x76c839faaaf135e2ULL, 0xf77b28a2faafae69ULL, 0x8815d86aca9a2710ULL,
+	0xc0c42c4102850a14ULL, 0xbfaadc8932b0836dULL, 0x3e19cdd162ee18e6ULL, 0x41773d1952db919fULL,
+	0x269b24ca6b12f26dULL, 0x59f5d4025b277b14ULL, 0xd846c55a0b79e09fULL, 0xa72835923b4c69e6ULL,
+	0xeff9c1b9f35344e2ULL, 0x90973171c366cd9bULL, 0x1124202993385610ULL, 0x6e4ad0e1a30ddf69ULL,
+	0x8087c87e03060c18ULL, 0xffe938b633338561ULL, 0x7e5a29ee636d1eeaULL, 0x0134d92653589793ULL,
+	0x49e52d0d9b47ba97ULL, 0x368bddc5ab7233eeULL, 0xb738cc9dfb2ca865ULL, 0xc8563c55cb19211cULL,
+	0x5e7bdbf1e3ac9decULL, 0x21152b39d3991495ULL, 0xa0a63a6183c78f1eULL, 0xdfc8caa9b3f20667ULL,
+	0x97193e827bed2b63ULL, 0xe877ce4a4bd8a21aULL, 0x69c4df121b863991ULL, 0x16aa2fda2bb3b0e8ULL,
+	0xf86737458bb86399ULL, 0x8709c78dbb8deae0ULL, 0x06bad6d5ebd3716bULL, 0x79d4261ddbe6f812ULL,
+	0x3105d23613f9d516ULL, 0x4e6b22fe23cc5c6fULL, 0xcfd833a67392c7e4ULL, 0xb0b6c36e43a74e9dULL,
+	0x9a6c9329ac4bc9b5ULL, 0xe50263e19c7e40ccULL, 0x64b172b9cc20db47ULL, 0x1bdf8271fc15523eULL,
+	0x530e765a340a7f3aULL, 0x2c608692043ff643ULL, 0xadd397ca54616dc8ULL, 0xd2bd67026454e4b1ULL,
+	0x3c707f9dc45f37c0ULL, 0x431e8f55f46abeb9ULL, 0xc2ad9e0da4342532ULL, 0xbdc36ec59401ac4bULL,
+	0xf5129aee5c1e814fULL, 0x8a7c6a266c2b0836ULL, 0x0bcf7b7e3c7593bdULL, 0x74a18bb60c401ac4ULL,
+	0xe28c6c1224f5a634ULL, 0x9de29cda14c02f4dULL, 0x1c518d82449eb4c6ULL, 0x633f7d4a74ab3dbfULL,
+	0x2bee8961bcb410bbULL, 0x548079a98c8199c2ULL, 0xd53368f1dcdf0249ULL, 0xaa5d9839ecea8b30ULL,
+	0x449080a64ce15841ULL, 0x3bfe706e7cd4d138ULL, 0xba4d61362c8a4ab3ULL, 0xc52391fe1cbfc3caULL,
+	0x8df265d5d4a0eeceULL, 0xf29c951de49567b7ULL, 0x732f8445b4cbfc3cULL, 0x0c41748d84fe7545ULL,
+	0x6bad6d5ebd3716b7ULL, 0x14c39d968d029fceULL, 0x95708ccedd5c0445ULL, 0xea1e7c06ed698d3cULL,
+	0xa2cf882d2576a038ULL, 0xdda178e515432941ULL, 0x5c1269bd451db2caULL, 0x237c997575283bb3ULL,
+	0xcdb181ead523e8c2ULL, 0xb2df7122e51661bbULL, 0x336c607ab548fa30ULL, 0x4c0290b2857d7349ULL,
+	0x04d364994d625e4dULL, 0x7bbd94517d57d734ULL, 0xfa0e85092d094cbfULL, 0x856075c11d3cc5c6ULL,
+	0x134d926535897936ULL, 0x6c2362ad05bcf04fULL, 0xed9073f555e26bc4ULL, 0x92fe833d65d7e2bdULL,
+	0xda2f7716adc8cfb9ULL, 0xa54187de9dfd46c0ULL, 0x24f29686cda3dd4bULL, 0x5b9c664efd965432ULL,
+	0xb5517ed15d9d8743ULL, 0xca3f8e196da80e3aULL, 0x4b8c9f413df695b1ULL, 0x34e26f890dc31cc8ULL,
+	0x7c339ba2c5dc31ccULL, 0x035d6b6af5e9b8b5ULL, 0x82ee7a32a5b7233eULL, 0xfd808afa9582aa47ULL,
+	0x4d364994d625e4daULL, 0x3258b95ce6106da3ULL, 0xb3eba804b64ef628ULL, 0xcc8558cc867b7f51ULL,
+	0x8454ace74e645255ULL, 0xfb3a5c2f7e51db2cULL, 0x7a894d772e0f40a7ULL, 0x05e7bdbf1e3ac9deULL,
+	0xeb2aa520be311aafULL, 0x944455e88e0493d6ULL, 0x15f744b0de5a085dULL, 0x6a99b478ee6f8124ULL,
+	0x224840532670ac20ULL, 0x5d26b09b16452559ULL, 0xdc95a1c3461bbed2ULL, 0xa3fb510b762e37abULL,
+	0x35d6b6af5e9b8b5bULL, 0x4ab846676eae0222ULL, 0xcb0b573f3ef099a9ULL, 0xb465a7f70ec510d0ULL,
+	0xfcb453dcc6da3dd4ULL, 0x83daa314f6efb4adULL, 0x0269b24ca6b12f26ULL, 0x7d0742849684a65fULL,
+	0x93ca5a1b368f752eULL, 0xeca4aad306bafc57ULL, 0x6d17bb8b56e467dcULL, 0x12794b4366d1eea5ULL,
+	0x5aa8bf68aecec3a1ULL, 0x25c64fa09efb4ad8ULL, 0xa4755ef8cea5d153ULL, 0xdb1bae30fe90582aULL,
+	0xbcf7b7e3c7593bd8ULL, 0xc399472bf76cb2a1ULL, 0x422a5673a732292aULL, 0x3d44a6bb9707a053ULL,
+	0x759552905f188d57ULL, 0x0afba2586f2d042eULL, 0x8b48b3003f739fa5ULL, 0xf42643c80f4616dcULL,
+	0x1aeb5b57af4dc5adULL, 0x6585ab9f9f784cd4ULL, 0xe436bac7cf26d75fULL, 0x9b584a0fff135e26ULL,
+	0xd389be24370c7322ULL, 0xace74eec0739fa5bULL, 0x2d545fb4576761d0ULL, 0x523aaf7c6752e8a9ULL,
+	0xc41748d84fe75459ULL, 0xbb79b8107fd2dd20ULL, 0x3acaa9482f8c46abULL, 0x45a459801fb9cfd2ULL,
+	0x0d75adabd7a6e2d6ULL, 0x721b5d63e7936bafULL, 0xf3a84c3bb7cdf024ULL, 0x8cc6bcf387f8795dULL,
+	0x620ba46c27f3aa2cULL, 0x1d6554a417c62355ULL, 0x9cd645fc4798b8deULL, 0xe3b8b53477ad31a7ULL,
+	0xab69411fbfb21ca3ULL, 0xd407b1d78f8795daULL, 0x55b4a08fdfd90e51ULL, 0x2ada5047efec8728ULL
+};
+
+/* Tables of the CRC-64 of all 8-bit messages followed by 0 to 7 zero bytes
+ * used to calculate the ECMA-182 CRC-64 with slicing-by-8
+ * Polynomial: 0x42f0e1eba9ea3693
+ * Table N contains the CRC-64 of the 8-bit message followed by N zero bytes
+ */
+static const uint64_t assorted_crc64_ecma182_slicing_table[ 8 ][ 256 ] = {
+	{
+		0x0000000000000000ULL, 0x42f0e1eba9ea3693ULL, 0x85e1c3d753d46d26ULL, 0xc711223cfa3e5bb5ULL,
+		0x493366450e42ecdfULL, 0x0bc387aea7a8da4cULL, 0xccd2a5925d9681f9ULL, 0x8e224479f47cb76aULL,
+		0x9266cc8a1c85d9beULL, 0xd0962d61b56fef2dULL, 0x17870f5d4f51b498ULL, 0x5577eeb6e6bb820bULL,
+		0xdb55aacf12c73561ULL, 0x99a54b24bb2d03f2ULL, 0x5eb4691841135847ULL, 0x1c4488f3e8f96ed4ULL,
+		0x663d78ff90e185efULL, 0x24cd9914390bb37cULL, 0xe3dcbb28c335e8c9ULL, 0xa12c5ac36adfde5aULL,
+		0x2f0e1eba9ea36930ULL, 0x6dfeff5137495fa3ULL, 0xaaefdd6dcd770416ULL, 0xe81f3c86649d3285ULL,
+		0xf45bb4758c645c51ULL, 0xb6ab559e258e6ac2ULL, 0x71ba77a2dfb03177ULL, 0x334a9649765a07e4ULL,
+		0xbd68d2308226b08eULL, 0xff9833db2bcc861dULL, 0x388911e7d1f2dda8ULL, 0x7a79f00c7818eb3bULL,
+		0xcc7af1ff21c30bdeULL, 0x8e8a101488293d4dULL, 0x499b3228721766f8ULL, 0x0b6bd3c3dbfd506bULL,
+		0x854997ba2f81e701ULL, 0xc7b97651866bd192ULL, 0x00a8546d7c558a27ULL, 0x4258b586d5bfbcb4ULL,
+		0x5e1c3d753d46d260ULL, 0x1cecdc9e94ace4f3ULL, 0xdbfdfea26e92bf46ULL, 0x990d1f49c77889d5ULL,
+		0x172f5b3033043ebfULL, 0x55dfbadb9aee082cULL, 0x92ce98e760d05399ULL, 0xd03e790cc93a650aULL,
+		0xaa478900b1228e31ULL, 0xe8b768eb18c8b8a2ULL, 0x2fa64ad7e2f6e317ULL, 0x6d56ab3c4b1cd584ULL,
+		0xe374ef45bf6062eeULL, 0xa1840eae168a547dULL, 0x66952c92ecb40fc8ULL, 0x2465cd79455e395bULL,
+		0x3821458aada7578fULL, 0x7ad1a461044d611cULL, 0xbdc0865dfe733aa9ULL, 0xff3067b657990c3aULL,
+		0x711223cfa3e5bb50ULL, 0x33e2c2240a0f8dc3ULL, 0xf4f3e018f031d676ULL, 0xb60301f359dbe0e5ULL,
+		0xda050215ea6c212fULL, 0x98f5e3fe438617bcULL, 0x5fe4c1c2b9b84c09ULL, 0x1d14202910527a9aULL,
+		0x93366450e42ecdf0ULL, 0xd1c685bb4dc4fb63ULL, 0x16d7a787b7faa0d6ULL, 0x5427466c1e109645ULL,
+		0x4863ce9ff6e9f891ULL, 0x0a932f745f03ce02ULL, 0xcd820d48a53d95b7ULL, 0x8f72eca30cd7a324ULL,
+		0x0150a8daf8ab144eULL, 0x43a04931514122ddULL, 0x84b16b0dab7f7968ULL, 0xc6418ae602954ffbULL,
+		0xbc387aea7a8da4c0ULL, 0xfec89b01d3679253ULL, 0x39d9b93d2959c9e6ULL, 0x7b2958d680b3ff75ULL,
+		0xf50b1caf74cf481fULL, 0xb7fbfd44dd257e8cULL, 0x70eadf78271b2539ULL, 0x321a3e938ef113aaULL,
+		0x2e5eb66066087d7eULL, 0x6cae578bcfe24bedULL, 0xabbf75b735dc1058ULL, 0xe94f945c9c3626cbULL,
+		0x676dd025684a91a1ULL, 0x259d31cec1a0a732ULL, 0xe28c13f23b9efc87ULL, 0xa07cf2199274ca14ULL,
+		0x167ff3eacbaf2af1ULL, 0x548f120162451c62ULL, 0x939e303d987b47d7ULL, 0xd16ed1d631917144ULL,
+		0x5f4c95afc5edc62eULL, 0x1dbc74446c07f0bdULL, 0xdaad56789639ab08ULL, 0x985db7933fd39d9bULL,
+		0x84193f60d72af34fULL, 0xc6e9de8b7ec0c5dcULL, 0x01f8fcb784fe9e69ULL, 0x43081d5c2d14a8faULL,
+		0xcd2a5925d9681f90ULL, 0x8fdab8ce70822903ULL, 0x48cb9af28abc72b6ULL, 0x0a3b7b1923564425ULL,
+		0x70428b155b4eaf1eULL, 0x32b26afef2a4998dULL, 0xf5a348c2089ac238ULL, 0xb753a929a170f4abULL,
+		0x3971ed50550c43c1ULL, 0x7b810cbbfce67552ULL, 0xbc902e8706d82ee7ULL, 0xfe60cf6caf321874ULL,
+		0xe224479f47cb76a0ULL, 0xa0d4a674ee214033ULL, 0x67c58448141f1b86ULL, 0x253565a3bdf52d15ULL,
+		0xab1721da49899a7fULL, 0xe9e7c031e063acecULL, 0x2ef6e20d1a5df759ULL, 0x6c0603e6b3b7c1caULL,
+		0xf6fae5c07d3274cdULL, 0xb40a042bd4d8425eULL, 0x731b26172ee619ebULL, 0x31ebc7fc870c2f78ULL,
+		0xbfc9838573709812ULL, 0xfd39626eda9aae81ULL, 0x3a28405220a4f534ULL, 0x78d8a1b9894ec3a7ULL,
+		0x649c294a61b7ad73ULL, 0x266cc8a1c85d9be0ULL, 0xe17dea9d3263c055ULL, 0xa38d0b769b89f6c6ULL,
+		0x2daf4f0f6ff541acULL, 0x6f5faee4c61f773fULL, 0xa84e8cd83c212c8aULL, 0xeabe6d3395cb1a19ULL,
+		0x90c79d3fedd3f122ULL, 0xd2377cd44439c7b1ULL, 0x15265ee8be079c04ULL, 0x57d6bf0317edaa97ULL,
+		0xd9f4fb7ae3911dfdULL, 0x9b041a914a7b2b6eULL, 0x5c1538adb04570dbULL, 0x1ee5d94619af4648ULL,
+		0x02a151b5f156289cULL, 0x4051b05e58bc1e0fULL, 0x87409262a28245baULL, 0xc5b073890b687329ULL,
+		0x4b9237f0ff14c443ULL, 0x0962d61b56fef2d0ULL, 0xce73f427acc0a965ULL, 0x8c8315cc052a9ff6ULL,
+		0x3a80143f5cf17f13ULL, 0x7870f5d4f51b4980ULL, 0xbf61d7e80f251235ULL, 0xfd913603a6cf24a6ULL,
+		0x73b3727a52b393ccULL, 0x31439391fb59a55fULL, 0xf652b1ad0167feeaULL, 0xb4a25046a88dc879ULL,
+		0xa8e6d8b54074a6adULL, 0xea16395ee99e903eULL, 0x2d071b6213a0cb8bULL, 0x6ff7fa89ba4afd18ULL,
+		0xe1d5bef04e364a72ULL, 0xa3255f1be7dc7ce1ULL, 0x64347d271de22754ULL, 0x26c49cccb40811c7ULL,
+		0x5cbd6cc0cc10fafcULL, 0x1e4d8d2b65facc6fULL, 0xd95caf179fc497daULL, 0x9bac4efc362ea149ULL,
+		0x158e0a85c2521623ULL, 0x577eeb6e6bb820b0ULL, 0x906fc95291867b05ULL, 0xd29f28b9386c4d96ULL,
+		0xcedba04ad0952342ULL, 0x8c2b41a1797f15d1ULL, 0x4b3a639d83414e64ULL, 0x09ca82762aab78f7ULL,
+		0x87e8c60fded7cf9dULL, 0xc51827e4773df90eULL, 0x020905d88d03a2bbULL, 0x40f9e43324e99428ULL,
+		0x2cffe7d5975e55e2ULL, 0x6e0f063e3eb46371ULL, 0xa91e2402c48a38c4ULL, 0xebeec5e96d600e57ULL,
+		0x65cc8190991cb93dULL, 0x273c607b30f68faeULL, 0xe02d4247cac8d41bULL, 0xa2dda3ac6322e288ULL,
+		0xbe992b5f8bdb8c5cULL, 0xfc69cab42231bacfULL, 0x3b78e888d80fe17aULL, 0x7988096371e5d7e9ULL,
+		0xf7aa4d1a85996083ULL, 0xb55aacf12c735610ULL, 0x724b8ecdd64d0da5ULL, 0x30bb6f267fa73b36ULL,
+		0x4ac29f2a07bfd00dULL, 0x08327ec1ae55e69eULL, 0xcf235cfd546bbd2bULL, 0x8dd3bd16fd818bb8ULL,
+		0x03f1f96f09fd3cd2ULL, 0x41011884a0170a41ULL, 0x86103ab85a2951f4ULL, 0xc4e0db53f3c36767ULL,
+		0xd8a453a01b3a09b3ULL, 0x9a54b24bb2d03f20ULL, 0x5d45907748ee6495ULL, 0x1fb5719ce1045206ULL,
+		0x919735e51578e56cULL, 0xd367d40ebc92d3ffULL, 0x1476f63246ac884aULL, 0x568617d9ef46bed9ULL,
+		0xe085162ab69d5e3cULL, 0xa275f7c11f7768afULL, 0x6564d5fde549331aULL, 0x279434164ca30589ULL,
+		0xa9b6706fb8dfb2e3ULL, 0xeb46918411358470ULL, 0x2c57b3b8eb0bdfc5ULL, 0x6ea7525342e1e956ULL,
+		0x72e3daa0aa188782ULL, 0x30133b4b03f2b111ULL, 0xf7021977f9cceaa4ULL, 0xb5f2f89c5026dc37ULL,
+		0x3bd0bce5a45a6b5dULL, 0x79205d0e0db05dceULL, 0xbe317f32f78e067bULL, 0xfcc19ed95e6430e8ULL,
+		0x86b86ed5267cdbd3ULL, 0xc4488f3e8f96ed40ULL, 0x0359ad0275a8b6f5ULL, 0x41a94ce9dc428066ULL,
+		0xcf8b0890283e370cULL, 0x8d7be97b81d4019fULL, 0x4a6acb477bea5a2aULL, 0x089a2aacd2006cb9ULL,
+		0x14dea25f3af9026dULL, 0x562e43b4931334feULL, 0x913f6188692d6f4bULL, 0xd3cf8063c0c759d8ULL,
+		0x5dedc41a34bbeeb2ULL, 0x1f1d25f19d51d821ULL, 0xd80c07cd676f8394ULL, 0x9afce626ce85b507ULL
+	},
+	{
+		0x0000000000000000ULL, 0xaf052a6b538edf09ULL, 0x1cfab53d0ef78881ULL, 0xb3ff9f565d795788ULL,
+		0x39f56a7a1def1102ULL, 0x96f040114e61ce0bULL, 0x250fdf4713189983ULL, 0x8a0af52c4096468aULL,
+		0x73ead4f43bde2204ULL, 0xdceffe9f6850fd0dULL, 0x6f1061c93529aa85ULL, 0xc0154ba266a7758cULL,
+		0x4a1fbe8e26313306ULL, 0xe51a94e575bfec0fULL, 0x56e50bb328c6bb87ULL, 0xf9e021d87b48648eULL,
+		0xe7d5a9e877bc4408ULL, 0x48d0838324329b01ULL, 0xfb2f1cd5794bcc89ULL, 0x542a36be2ac51380ULL,
+		0xde20c3926a53550aULL, 0x7125e9f939dd8a03ULL, 0xc2da76af64a4dd8bULL, 0x6ddf5cc4372a0282ULL,
+		0x943f7d1c4c62660cULL, 0x3b3a57771fecb905ULL, 0x88c5c8214295ee8dULL, 0x27c0e24a111b3184ULL,
+		0xadca1766518d770eULL, 0x02cf3d0d0203a807ULL, 0xb130a25b5f7aff8fULL, 0x1e3588300cf42086ULL,
+		0x8d5bb23b4692be83ULL, 0x225e9850151c618aULL, 0x91a1070648653602ULL, 0x3ea42d6d1bebe90bULL,
+		0xb4aed8415b7daf81ULL, 0x1babf22a08f37088ULL, 0xa8546d7c558a2700ULL, 0x075147170604f809ULL,
+		0xfeb166cf7d4c9c87ULL, 0x51b44ca42ec2438eULL, 0xe24bd3f273bb1406ULL, 0x4d4ef9992035cb0fULL,
+		0xc7440cb560a38d85ULL, 0x684126de332d528cULL, 0xdbbeb9886e540504ULL, 0x74bb93e33ddada0dULL,
+		0x6a8e1bd3312efa8bULL, 0xc58b31b862a02582ULL, 0x7674aeee3fd9720aULL, 0xd97184856c57ad03ULL,
+		0x537b71a92cc1eb89ULL, 0xfc7e5bc27f4f3480ULL, 0x4f81c49422366308ULL, 0xe084eeff71b8bc01ULL,
+		0x1964cf270af0d88fULL, 0xb661e54c597e0786ULL, 0x059e7a1a0407500eULL, 0xaa9b507157898f07ULL,
+		0x2091a55d171fc98dULL, 0x8f948f3644911684ULL, 0x3c6b106019e8410cULL, 0x936e3a0b4a669e05ULL,
+		0x5847859d24cf4b95ULL, 0xf742aff67741949cULL, 0x44bd30a02a38c314ULL, 0xebb81acb79b61c1dULL,
+		0x61b2efe739205a97ULL, 0xceb7c58c6aae859eULL, 0x7d485ada37d7d216ULL, 0xd24d70b164590d1fULL,
+		0x2bad51691f116991ULL, 0x84a87b024c9fb698ULL, 0x3757e45411e6e110ULL, 0x9852ce3f42683e19ULL,
+		0x12583b1302fe7893ULL, 0xbd5d11785170a79aULL, 0x0ea28e2e0c09f012ULL, 0xa1a7a4455f872f1bULL,
+		0xbf922c7553730f9dULL, 0x1097061e00fdd094ULL, 0xa36899485d84871cULL, 0x0c6db3230e0a5815ULL,
+		0x8667460f4e9c1e9fULL, 0x29626c641d12c196ULL, 0x9a9df332406b961eULL, 0x3598d95913e54917ULL,
+		0xcc78f88168ad2d99ULL, 0x637dd2ea3b23f290ULL, 0xd0824dbc665aa518ULL, 0x7f8767d735d47a11ULL,
+		0xf58d92fb75423c9bULL, 0x5a88b89026cce392ULL, 0xe97727c67bb5b41aULL, 0x46720dad283b6b13ULL,
+		0xd51c37a6625df516ULL, 0x7a191dcd31d32a1fULL, 0xc9e6829b6caa7d97ULL, 0x66e3a8f03f24a29eULL,
+		0xece95ddc7fb2e414ULL, 0x43ec77b72c3c3b1dULL, 0xf013e8e171456c95ULL, 0x5f16c28a22cbb39cULL,
+		0xa6f6e3525983d712ULL, 0x09f3c9390a0d081bULL, 0xba0c566f57745f93ULL, 0x15097c0404fa809aULL,
+		0x9f038928446cc610ULL, 0x3006a34317e21919ULL, 0x83f93c154a9b4e91ULL, 0x2cfc167e19159198ULL,
+		0x32c99e4e15e1b11eULL, 0x9dccb425466f6e17ULL, 0x2e332b731b16399fULL, 0x813601184898e696ULL,
+		0x0b3cf434080ea01cULL, 0xa439de5f5b807f15ULL, 0x17c6410906f9289dULL, 0xb8c36b625577f794ULL,
+		0x41234aba2e3f931aULL, 0xee2660d17db14c13ULL, 0x5dd9ff8720c81b9bULL, 0xf2dcd5ec7346c492ULL,
+		0x78d620c033d08218ULL, 0xd7d30aab605e5d11ULL, 0x642c95fd3d270a99ULL, 0xcb29bf966ea9d590ULL,
+		0xb08f0b3a499e972aULL, 0x1f8a21511a104823ULL, 0xac75be0747691fabULL, 0x0370946c14e7c0a2ULL,
+		0x897a614054718628ULL, 0x267f4b2b07ff5921ULL, 0x9580d47d5a860ea9ULL, 0x3a85fe160908d1a0ULL,
+		0xc365dfce7240b52eULL, 0x6c60f5a521ce6a27ULL, 0xdf9f6af37cb73dafULL, 0x709a40982f39e2a6ULL,
+		0xfa90b5b46fafa42cULL, 0x55959fdf3c217b25ULL, 0xe66a008961582cadULL, 0x496f2ae232d6f3a4ULL,
+		0x575aa2d23e22d322ULL, 0xf85f88b96dac0c2bULL, 0x4ba017ef30d55ba3ULL, 0xe4a53d84635b84aaULL,
+		0x6eafc8a823cdc220ULL, 0xc1aae2c370431d29ULL, 0x72557d952d3a4aa1ULL, 0xdd5057fe7eb495a8ULL,
+		0x24b0762605fcf126ULL, 0x8bb55c4d56722e2fULL, 0x384ac31b0b0b79a7ULL, 0x974fe9705885a6aeULL,
+		0x1d451c5c1813e024ULL, 0xb24036374b9d3f2dULL, 0x01bfa96116e468a5ULL, 0xaeba830a456ab7acULL,
+		0x3dd4b9010f0c29a9ULL, 0x92d1936a5c82f6a0ULL, 0x212e0c3c01fba128ULL, 0x8e2b265752757e21ULL,
+		0x0421d37b12e338abULL, 0xab24f910416de7a2ULL, 0x18db66461c14b02aULL, 0xb7de4c2d4f9a6f23ULL,
+		0x4e3e6df534d20badULL, 0xe13b479e675cd4a4ULL, 0x52c4d8c83a25832cULL, 0xfdc1f2a369ab5c25ULL,
+		0x77cb078f293d1aafULL, 0xd8ce2de47ab3c5a6ULL, 0x6b31b2b227ca922eULL, 0xc43498d974444d27ULL,
+		0xda0110e978b06da1ULL, 0x75043a822b3eb2a8ULL, 0xc6fba5d47647e520ULL, 0x69fe8fbf25c93a29ULL,
+		0xe3f47a93655f7ca3ULL, 0x4cf150f836d1a3aaULL, 0xff0ecfae6ba8f422ULL, 0x500be5c538262b2bULL,
+		0xa9ebc41d436e4fa5ULL, 0x06eeee7610e090acULL, 0xb51171204d99c724ULL, 0x1a145b4b1e17182dULL,
+		0x901eae675e815ea7ULL, 0x3f1b840c0d0f81aeULL, 0x8ce41b5a5076d626ULL, 0x23e1313103f8092fULL,
+		0xe8c88ea76d51dcbfULL, 0x47cda4cc3edf03b6ULL, 0xf4323b9a63a6543eULL, 0x5b3711f130288b37ULL,
+		0xd13de4dd70becdbdULL, 0x7e38ceb6233012b4ULL, 0xcdc751e07e49453cULL, 0x62c27b8b2dc79a35ULL,
+		0x9b225a53568ffebbULL, 0x34277038050121b2ULL, 0x87d8ef6e5878763aULL, 0x28ddc5050bf6a933ULL,
+		0xa2d730294b60efb9ULL, 0x0dd21a4218ee30b0ULL, 0xbe2d851445976738ULL, 0x1128af7f1619b831ULL,
+		0x0f1d274f1aed98b7ULL, 0xa0180d24496347beULL, 0x13e79272141a1036ULL, 0xbce2b8194794cf3fULL,
+		0x36e84d35070289b5ULL, 0x99ed675e548c56bcULL, 0x2a12f80809f50134ULL, 0x8517d2635a7bde3dULL,
+		0x7cf7f3bb2133bab3ULL, 0xd3f2d9d072bd65baULL, 0x600d46862fc43232ULL, 0xcf086ced7c4aed3bULL,
+		0x450299c13cdcabb1ULL, 0xea07b3aa6f5274b8ULL, 0x59f82cfc322b2330ULL, 0xf6fd069761a5fc39ULL,
+		0x65933c9c2bc3623cULL, 0xca9616f7784dbd35ULL, 0x796989a12534eabdULL, 0xd66ca3ca76ba35b4ULL,
+		0x5c6656e6362c733eULL, 0xf3637c8d65a2ac37ULL, 0x409ce3db38dbfbbfULL, 0xef99c9b06b5524b6ULL,
+		0x1679e868101d4038ULL, 0xb97cc20343939f31ULL, 0x0a835d551eeac8b9ULL, 0xa586773e4d6417b0ULL,
+		0x2f8c82120df2513aULL, 0x8089a8795e7c8e33ULL, 0x3376372f0305d9bbULL, 0x9c731d44508b06b2ULL,
+		0x824695745c7f2634ULL, 0x2d43bf1f0ff1f93dULL, 0x9ebc20495288aeb5ULL, 0x31b90a22010671bcULL,
+		0xbbb3ff0e41903736ULL, 0x14b6d565121ee83fULL, 0xa7494a334f67bfb7ULL, 0x084c60581ce960beULL,
+		0xf1ac418067a10430ULL, 0x5ea96beb342fdb39ULL, 0xed56f4bd69568cb1ULL, 0x4253ded63ad853b8ULL,
+		0xc8592bfa7a4e1532ULL, 0x675c019129c0ca3bULL, 0xd4a39ec774b99db3ULL, 0x7ba6b4ac273742baULL
+	},
+	{
+		0x0000000000000000ULL, 0x23eef79f3ad718c7ULL, 0x47ddef3e75ae318eULL, 0x643318a14f792949ULL,
+		0x8fbbde7ceb5c631cULL, 0xac5529e3d18b7bdbULL, 0xc86631429ef25292ULL, 0xeb88c6dda4254a55ULL,
+		0x5d875d127f52f0abULL, 0x7e69aa8d4585e86cULL, 0x1a5ab22c0afcc125ULL, 0x39b445b3302bd9e2ULL,
+		0xd23c836e940e93b7ULL, 0xf1d274f1aed98b70ULL, 0x95e16c50e1a0a239ULL, 0xb60f9bcfdb77bafeULL,
+		0xbb0eba24fea5e156ULL, 0x98e04dbbc472f991ULL, 0xfcd3551a8b0bd0d8ULL, 0xdf3da285b1dcc81fULL,
+		0x34b5645815f9824aULL, 0x175b93c72f2e9a8dULL, 0x73688b666057b3c4ULL, 0x50867cf95a80ab03ULL,
+		0xe689e73681f711fdULL, 0xc56710a9bb20093aULL, 0xa1540808f4592073ULL, 0x82baff97ce8e38b4ULL,
+		0x6932394a6aab72e1ULL, 0x4adcced5507c6a26ULL, 0x2eefd6741f05436fULL, 0x0d0121eb25d25ba8ULL,
+		0x34ed95a254a1f43fULL, 0x1703623d6e76ecf8ULL, 0x73307a9c210fc5b1ULL, 0x50de8d031bd8dd76ULL,
+		0xbb564bdebffd9723ULL, 0x98b8bc41852a8fe4ULL, 0xfc8ba4e0ca53a6adULL, 0xdf65537ff084be6aULL,
+		0x696ac8b02bf30494ULL, 0x4a843f2f11241c53ULL, 0x2eb7278e5e5d351aULL, 0x0d59d011648a2dddULL,
+		0xe6d116ccc0af6788ULL, 0xc53fe153fa787f4fULL, 0xa10cf9f2b5015606ULL, 0x82e20e6d8fd64ec1ULL,
+		0x8fe32f86aa041569ULL, 0xac0dd81990d30daeULL, 0xc83ec0b8dfaa24e7ULL, 0xebd03727e57d3c20ULL,
+		0x0058f1fa41587675ULL, 0x23b606657b8f6eb2ULL, 0x47851ec434f647fbULL, 0x646be95b0e215f3cULL,
+		0xd2647294d556e5c2ULL, 0xf18a850bef81fd05ULL, 0x95b99daaa0f8d44cULL, 0xb6576a359a2fcc8bULL,
+		0x5ddface83e0a86deULL, 0x7e315b7704dd9e19ULL, 0x1a0243d64ba4b750ULL, 0x39ecb4497173af97ULL,
+		0x69db2b44a943e87eULL, 0x4a35dcdb9394f0b9ULL, 0x2e06c47adcedd9f0ULL, 0x0de833e5e63ac137ULL,
+		0xe660f538421f8b62ULL, 0xc58e02a778c893a5ULL, 0xa1bd1a0637b1baecULL, 0x8253ed990d66a22bULL,
+		0x345c7656d61118d5ULL, 0x17b281c9ecc60012ULL, 0x73819968a3bf295bULL, 0x506f6ef79968319cULL,
+		0xbbe7a82a3d4d7bc9ULL, 0x98095fb5079a630eULL, 0xfc3a471448e34a47ULL, 0xdfd4b08b72345280ULL,
+		0xd2d5916057e60928ULL, 0xf13b66ff6d3111efULL, 0x95087e5e224838a6ULL, 0xb6e689c1189f2061ULL,
+		0x5d6e4f1cbcba6a34ULL, 0x7e80b883866d72f3ULL, 0x1ab3a022c9145bbaULL, 0x395d57bdf3c3437dULL,
+		0x8f52cc7228b4f983ULL, 0xacbc3bed1263e144ULL, 0xc88f234c5d1ac80dULL, 0xeb61d4d367cdd0caULL,
+		0x00e9120ec3e89a9fULL, 0x2307e591f93f8258ULL, 0x4734fd30b646ab11ULL, 0x64da0aaf8c91b3d6ULL,
+		0x5d36bee6fde21c41ULL, 0x7ed84979c7350486ULL, 0x1aeb51d8884c2dcfULL, 0x3905a647b29b3508ULL,
+		0xd28d609a16be7f5dULL, 0xf16397052c69679aULL, 0x95508fa463104ed3ULL, 0xb6be783b59c75614ULL,
+		0x00b1e3f482b0eceaULL, 0x235f146bb867f42dULL, 0x476c0ccaf71edd64ULL, 0x6482fb55cdc9c5a3ULL,
+		0x8f0a3d8869ec8ff6ULL, 0xace4ca17533b9731ULL, 0xc8d7d2b61c42be78ULL, 0xeb3925292695a6bfULL,
+		0xe63804c20347fd17ULL, 0xc5d6f35d3990e5d0ULL, 0xa1e5ebfc76e9cc99ULL, 0x820b1c634c3ed45eULL,
+		0x6983dabee81b9e0bULL, 0x4a6d2d21d2cc86ccULL, 0x2e5e35809db5af85ULL, 0x0db0c21fa762b742ULL,
+		0xbbbf59d07c150dbcULL, 0x9851ae4f46c2157bULL, 0xfc62b6ee09bb3c32ULL, 0xdf8c4171336c24f5ULL,
+		0x340487ac97496ea0ULL, 0x17ea7033ad9e7667ULL, 0x73d96892e2e75f2eULL, 0x50379f0dd83047e9ULL,
+		0xd3b656895287d0fcULL, 0xf058a1166850c83bULL, 0x946bb9b72729e172ULL, 0xb7854e281dfef9b5ULL,
+		0x5c0d88f5b9dbb3e0ULL, 0x7fe37f6a830cab27ULL, 0x1bd067cbcc75826eULL, 0x383e9054f6a29aa9ULL,
+		0x8e310b9b2dd52057ULL, 0xaddffc0417023890ULL, 0xc9ece4a5587b11d9ULL, 0xea02133a62ac091eULL,
+		0x018ad5e7c689434bULL, 0x22642278fc5e5b8cULL, 0x46573ad9b32772c5ULL, 0x65b9cd4689f06a02ULL,
+		0x68b8ecadac2231aaULL, 0x4b561b3296f5296dULL, 0x2f650393d98c0024ULL, 0x0c8bf40ce35b18e3ULL,
+		0xe70332d1477e52b6ULL, 0xc4edc54e7da94a71ULL, 0xa0deddef32d06338ULL, 0x83302a7008077bffULL,
+		0x353fb1bfd370c101ULL, 0x16d14620e9a7d9c6ULL, 0x72e25e81a6def08fULL, 0x510ca91e9c09e848ULL,
+		0xba846fc3382ca21dULL, 0x996a985c02fbbadaULL, 0xfd5980fd4d829393ULL, 0xdeb7776277558b54ULL,
+		0xe75bc32b062624c3ULL, 0xc4b534b43cf13c04ULL, 0xa0862c157388154dULL, 0x8368db8a495f0d8aULL,
+		0x68e01d57ed7a47dfULL, 0x4b0eeac8d7ad5f18ULL, 0x2f3df26998d47651ULL, 0x0cd305f6a2036e96ULL,
+		0xbadc9e397974d468ULL, 0x993269a643a3ccafULL, 0xfd0171070cdae5e6ULL, 0xdeef8698360dfd21ULL,
+		0x356740459228b774ULL, 0x1689b7daa8ffafb3ULL, 0x72baaf7be78686faULL, 0x515458e4dd519e3dULL,
+		0x5c55790ff883c595ULL, 0x7fbb8e90c254dd52ULL, 0x1b8896318d2df41bULL, 0x386661aeb7faecdcULL,
+		0xd3eea77313dfa689ULL, 0xf00050ec2908be4eULL, 0x9433484d66719707ULL, 0xb7ddbfd25ca68fc0ULL,
+		0x01d2241d87d1353eULL, 0x223cd382bd062df9ULL, 0x460fcb23f27f04b0ULL, 0x65e13cbcc8a81c77ULL,
+		0x8e69fa616c8d5622ULL, 0xad870dfe565a4ee5ULL, 0xc9b4155f192367acULL, 0xea5ae2c023f47f6bULL,
+		0xba6d7dcdfbc43882ULL, 0x99838a52c1132045ULL, 0xfdb092f38e6a090cULL, 0xde5e656cb4bd11cbULL,
+		0x35d6a3b110985b9eULL, 0x1638542e2a4f4359ULL, 0x720b4c8f65366a10ULL, 0x51e5bb105fe172d7ULL,
+		0xe7ea20df8496c829ULL, 0xc404d740be41d0eeULL, 0xa037cfe1f138f9a7ULL, 0x83d9387ecbefe160ULL,
+		0x6851fea36fcaab35ULL, 0x4bbf093c551db3f2ULL, 0x2f8c119d1a649abbULL, 0x0c62e60220b3827cULL,
+		0x0163c7e90561d9d4ULL, 0x228d30763fb6c113ULL, 0x46be28d770cfe85aULL, 0x6550df484a18f09dULL,
+		0x8ed81995ee3dbac8ULL, 0xad36ee0ad4eaa20fULL, 0xc905f6ab9b938b46ULL, 0xeaeb0134a1449381ULL,
+		0x5ce49afb7a33297fULL, 0x7f0a6d6440e431b8ULL, 0x1b3975c50f9d18f1ULL, 0x38d7825a354a0036ULL,
+		0xd35f4487916f4a63ULL, 0xf0b1b318abb852a4ULL, 0x9482abb9e4c17bedULL, 0xb76c5c26de16632aULL,
+		0x8e80e86faf65ccbdULL, 0xad6e1ff095b2d47aULL, 0xc95d0751dacbfd33ULL, 0xeab3f0cee01ce5f4ULL,
+		0x013b36134439afa1ULL, 0x22d5c18c7eeeb766ULL, 0x46e6d92d31979e2fULL, 0x65082eb20b4086e8ULL,
+		0xd307b57dd0373c16ULL, 0xf0e942e2eae024d1ULL, 0x94da5a43a5990d98ULL, 0xb734addc9f4e155fULL,
+		0x5cbc6b013b6b5f0aULL, 0x7f529c9e01bc47cdULL, 0x1b61843f4ec56e84ULL, 0x388f73a074127643ULL,
+		0x358e524b51c02debULL, 0x1660a5d46b17352cULL, 0x7253bd75246e1c65ULL, 0x51bd4aea1eb904a2ULL,
+		0xba358c37ba9c4ef7ULL, 0x99db7ba8804b5630ULL, 0xfde86309cf327f79ULL, 0xde069496f5e567beULL,
+		0x68090f592e92dd40ULL, 0x4be7f8c61445c587ULL, 0x2fd4e0675b3cecceULL, 0x0c3a17f861ebf409ULL,
+		0xe7b2d125c5cebe5cULL, 0xc45c26baff19a69bULL, 0xa06f3e1bb0608fd2ULL, 0x8381c9848ab79715ULL
+	},
+	{
+		0x0000000000000000ULL, 0xe59c4cf90ce5976bULL, 0x89c87819b0211845ULL, 0x6c5434e0bcc48f2eULL,
+		0x516011d8c9a80619ULL, 0xb4fc5d21c54d9172ULL, 0xd8a869c179891e5cULL, 0x3d342538756c8937ULL,
+		0xa2c023b193500c32ULL, 0x475c6f489fb59b59ULL, 0x2b085ba823711477ULL, 0xce9417512f94831cULL,
+		0xf3a032695af80a2bULL, 0x163c7e90561d9d40ULL, 0x7a684a70ead9126eULL, 0x9ff40689e63c8505ULL,
+		0x0770a6888f4a2ef7ULL, 0xe2ecea7183afb99cULL, 0x8eb8de913f6b36b2ULL, 0x6b249268338ea1d9ULL,
+		0x5610b75046e228eeULL, 0xb38cfba94a07bf85ULL, 0xdfd8cf49f6c330abULL, 0x3a4483b0fa26a7c0ULL,
+		0xa5b085391c1a22c5ULL, 0x402cc9c010ffb5aeULL, 0x2c78fd20ac3b3a80ULL, 0xc9e4b1d9a0deadebULL,
+		0xf4d094e1d5b224dcULL, 0x114cd818d957b3b7ULL, 0x7d18ecf865933c99ULL, 0x9884a0016976abf2ULL,
+		0x0ee14d111e945deeULL, 0xeb7d01e81271ca85ULL, 0x87293508aeb545abULL, 0x62b579f1a250d2c0ULL,
+		0x5f815cc9d73c5bf7ULL, 0xba1d1030dbd9cc9cULL, 0xd64924d0671d43b2ULL, 0x33d568296bf8d4d9ULL,
+		0xac216ea08dc451dcULL, 0x49bd22598121c6b7ULL, 0x25e916b93de54999ULL, 0xc0755a403100def2ULL,
+		0xfd417f78446c57c5ULL, 0x18dd33814889c0aeULL, 0x74890761f44d4f80ULL, 0x91154b98f8a8d8ebULL,
+		0x0991eb9991de7319ULL, 0xec0da7609d3be472ULL, 0x8059938021ff6b5cULL, 0x65c5df792d1afc37ULL,
+		0x58f1fa4158767500ULL, 0xbd6db6b85493e26bULL, 0xd1398258e8576d45ULL, 0x34a5cea1e4b2fa2eULL,
+		0xab51c828028e7f2bULL, 0x4ecd84d10e6be840ULL, 0x2299b031b2af676eULL, 0xc705fcc8be4af005ULL,
+		0xfa31d9f0cb267932ULL, 0x1fad9509c7c3ee59ULL, 0x73f9a1e97b076177ULL, 0x9665ed1077e2f61cULL,
+		0x1dc29a223d28bbdcULL, 0xf85ed6db31cd2cb7ULL, 0x940ae23b8d09a399ULL, 0x7196aec281ec34f2ULL,
+		0x4ca28bfaf480bdc5ULL, 0xa93ec703f8652aaeULL, 0xc56af3e344a1a580ULL, 0x20f6bf1a484432ebULL,
+		0xbf02b993ae78b7eeULL, 0x5a9ef56aa29d2085ULL, 0x36cac18a1e59afabULL, 0xd3568d7312bc38c0ULL,
+		0xee62a84b67d0b1f7ULL, 0x0bfee4b26b35269cULL, 0x67aad052d7f1a9b2ULL, 0x82369cabdb143ed9ULL,
+		0x1ab23caab262952bULL, 0xff2e7053be870240ULL, 0x937a44b302438d6eULL, 0x76e6084a0ea61a05ULL,
+		0x4bd22d727bca9332ULL, 0xae4e618b772f0459ULL, 0xc21a556bcbeb8b77ULL, 0x27861992c70e1c1cULL,
+		0xb8721f1b21329919ULL, 0x5dee53e22dd70e72ULL, 0x31ba67029113815cULL, 0xd4262bfb9df61637ULL,
+		0xe9120ec3e89a9f00ULL, 0x0c8e423ae47f086bULL, 0x60da76da58bb8745ULL, 0x85463a23545e102eULL,
+		0x1323d73323bce632ULL, 0xf6bf9bca2f597159ULL, 0x9aebaf2a939dfe77ULL, 0x7f77e3d39f78691cULL,
+		0x4243c6ebea14e02bULL, 0xa7df8a12e6f17740ULL, 0xcb8bbef25a35f86eULL, 0x2e17f20b56d06f05ULL,
+		0xb1e3f482b0ecea00ULL, 0x547fb87bbc097d6bULL, 0x382b8c9b00cdf245ULL, 0xddb7c0620c28652eULL,
+		0xe083e55a7944ec19ULL, 0x051fa9a375a17b72ULL, 0x694b9d43c965f45cULL, 0x8cd7d1bac5806337ULL,
+		0x145371bbacf6c8c5ULL, 0xf1cf3d42a0135faeULL, 0x9d9b09a21cd7d080ULL, 0x7807455b103247ebULL,
+		0x45336063655ecedcULL, 0xa0af2c9a69bb59b7ULL, 0xccfb187ad57fd699ULL, 0x29675483d99a41f2ULL,
+		0xb693520a3fa6c4f7ULL, 0x530f1ef33343539cULL, 0x3f5b2a138f87dcb2ULL, 0xdac766ea83624bd9ULL,
+		0xe7f343d2f60ec2eeULL, 0x026f0f2bfaeb5585ULL, 0x6e3b3bcb462fdaabULL, 0x8ba777324aca4dc0ULL,
+		0x3b8534447a5177b8ULL, 0xde1978bd76b4e0d3ULL, 0xb24d4c5dca706ffdULL, 0x57d100a4c695f896ULL,
+		0x6ae5259cb3f971a1ULL, 0x8f796965bf1ce6caULL, 0xe32d5d8503d869e4ULL, 0x06b1117c0f3dfe8fULL,
+		0x994517f5e9017b8aULL, 0x7cd95b0ce5e4ece1ULL, 0x108d6fec592063cfULL, 0xf511231555c5f4a4ULL,
+		0xc825062d20a97d93ULL, 0x2db94ad42c4ceaf8ULL, 0x41ed7e34908865d6ULL, 0xa47132cd9c6df2bdULL,
+		0x3cf592ccf51b594fULL, 0xd969de35f9fece24ULL, 0xb53dead5453a410aULL, 0x50a1a62c49dfd661ULL,
+		0x6d9583143cb35f56ULL, 0x8809cfed3056c83dULL, 0xe45dfb0d8c924713ULL, 0x01c1b7f48077d078ULL,
+		0x9e35b17d664b557dULL, 0x7ba9fd846aaec216ULL, 0x17fdc964d66a4d38ULL, 0xf261859dda8fda53ULL,
+		0xcf55a0a5afe35364ULL, 0x2ac9ec5ca306c40fULL, 0x469dd8bc1fc24b21ULL, 0xa30194451327dc4aULL,
+		0x3564795564c52a56ULL, 0xd0f835ac6820bd3dULL, 0xbcac014cd4e43213ULL, 0x59304db5d801a578ULL,
+		0x6404688dad6d2c4fULL, 0x81982474a188bb24ULL, 0xedcc10941d4c340aULL, 0x08505c6d11a9a361ULL,
+		0x97a45ae4f7952664ULL, 0x7238161dfb70b10fULL, 0x1e6c22fd47b43e21ULL, 0xfbf06e044b51a94aULL,
+		0xc6c44b3c3e3d207dULL, 0x235807c532d8b716ULL, 0x4f0c33258e1c3838ULL, 0xaa907fdc82f9af53ULL,
+		0x3214dfddeb8f04a1ULL, 0xd7889324e76a93caULL, 0xbbdca7c45bae1ce4ULL, 0x5e40eb3d574b8b8fULL,
+		0x6374ce05222702b8ULL, 0x86e882fc2ec295d3ULL, 0xeabcb61c92061afdULL, 0x0f20fae59ee38d96ULL,
+		0x90d4fc6c78df0893ULL, 0x7548b095743a9ff8ULL, 0x191c8475c8fe10d6ULL, 0xfc80c88cc41b87bdULL,
+		0xc1b4edb4b1770e8aULL, 0x2428a14dbd9299e1ULL, 0x487c95ad015616cfULL, 0xade0d9540db381a4ULL,
+		0x2647ae664779cc64ULL, 0xc3dbe29f4b9c5b0fULL, 0xaf8fd67ff758d421ULL, 0x4a139a86fbbd434aULL,
+		0x7727bfbe8ed1ca7dULL, 0x92bbf34782345d16ULL, 0xfeefc7a73ef0d238ULL, 0x1b738b5e32154553ULL,
+		0x84878dd7d429c056ULL, 0x611bc12ed8cc573dULL, 0x0d4ff5ce6408d813ULL, 0xe8d3b93768ed4f78ULL,
+		0xd5e79c0f1d81c64fULL, 0x307bd0f611645124ULL, 0x5c2fe416ada0de0aULL, 0xb9b3a8efa1454961ULL,
+		0x213708eec833e293ULL, 0xc4ab4417c4d675f8ULL, 0xa8ff70f77812fad6ULL, 0x4d633c0e74f76dbdULL,
+		0x70571936019be48aULL, 0x95cb55cf0d7e73e1ULL, 0xf99f612fb1bafccfULL, 0x1c032dd6bd5f6ba4ULL,
+		0x83f72b5f5b63eea1ULL, 0x666b67a6578679caULL, 0x0a3f5346eb42f6e4ULL, 0xefa31fbfe7a7618fULL,
+		0xd2973a8792cbe8b8ULL, 0x370b767e9e2e7fd3ULL, 0x5b5f429e22eaf0fdULL, 0xbec30e672e0f6796ULL,
+		0x28a6e37759ed918aULL, 0xcd3aaf8e550806e1ULL, 0xa16e9b6ee9cc89cfULL, 0x44f2d797e5291ea4ULL,
+		0x79c6f2af90459793ULL, 0x9c5abe569ca000f8ULL, 0xf00e8ab620648fd6ULL, 0x1592c64f2c8118bdULL,
+		0x8a66c0c6cabd9db8ULL, 0x6ffa8c3fc6580ad3ULL, 0x03aeb8df7a9c85fdULL, 0xe632f42676791296ULL,
+		0xdb06d11e03159ba1ULL, 0x3e9a9de70ff00ccaULL, 0x52cea907b33483e4ULL, 0xb752e5febfd1148fULL,
+		0x2fd645ffd6a7bf7dULL, 0xca4a0906da422816ULL, 0xa61e3de66686a738ULL, 0x4382711f6a633053ULL,
+		0x7eb654271f0fb964ULL, 0x9b2a18de13ea2e0fULL, 0xf77e2c3eaf2ea121ULL, 0x12e260c7a3cb364aULL,
+		0x8d16664e45f7b34fULL, 0x688a2ab749122424ULL, 0x04de1e57f5d6ab0aULL, 0xe14252aef9333c61ULL,
+		0xdc7677968c5fb556ULL, 0x39ea3b6f80ba223dULL, 0x55be0f8f3c7ead13ULL, 0xb0224376309b3a78ULL
+	},
+	{
+		0x0000000000000000ULL, 0x770a6888f4a2ef70ULL, 0xee14d111e945dee0ULL, 0x991eb9991de73190ULL,
+		0x9ed943c87b618b53ULL, 0xe9d32b408fc36423ULL, 0x70cd92d9922455b3ULL, 0x07c7fa516686bac3ULL,
+		0x7f42667b5f292035ULL, 0x08480ef3ab8bcf45ULL, 0x9156b76ab66cfed5ULL, 0xe65cdfe242ce11a5ULL,
+		0xe19b25b32448ab66ULL, 0x96914d3bd0ea4416ULL, 0x0f8ff4a2cd0d7586ULL, 0x78859c2a39af9af6ULL,
+		0xfe84ccf6be52406aULL, 0x898ea47e4af0af1aULL, 0x10901de757179e8aULL, 0x679a756fa3b571faULL,
+		0x605d8f3ec533cb39ULL, 0x1757e7b631912449ULL, 0x8e495e2f2c7615d9ULL, 0xf94336a7d8d4faa9ULL,
+		0x81c6aa8de17b605fULL, 0xf6ccc20515d98f2fULL, 0x6fd27b9c083ebebfULL, 0x18d81314fc9c51cfULL,
+		0x1f1fe9459a1aeb0cULL, 0x681581cd6eb8047cULL, 0xf10b3854735f35ecULL, 0x860150dc87fdda9cULL,
+		0xbff97806d54eb647ULL, 0xc8f3108e21ec5937ULL, 0x51eda9173c0b68a7ULL, 0x26e7c19fc8a987d7ULL,
+		0x21203bceae2f3d14ULL, 0x562a53465a8dd264ULL, 0xcf34eadf476ae3f4ULL, 0xb83e8257b3c80c84ULL,
+		0xc0bb1e7d8a679672ULL, 0xb7b176f57ec57902ULL, 0x2eafcf6c63224892ULL, 0x59a5a7e49780a7e2ULL,
+		0x5e625db5f1061d21ULL, 0x2968353d05a4f251ULL, 0xb0768ca41843c3c1ULL, 0xc77ce42cece12cb1ULL,
+		0x417db4f06b1cf62dULL, 0x3677dc789fbe195dULL, 0xaf6965e1825928cdULL, 0xd8630d6976fbc7bdULL,
+		0xdfa4f738107d7d7eULL, 0xa8ae9fb0e4df920eULL, 0x31b02629f938a39eULL, 0x46ba4ea10d9a4ceeULL,
+		0x3e3fd28b3435d618ULL, 0x4935ba03c0973968ULL, 0xd02b039add7008f8ULL, 0xa7216b1229d2e788ULL,
+		0xa0e691434f545d4bULL, 0xd7ecf9cbbbf6b23bULL, 0x4ef24052a61183abULL, 0x39f828da52b36cdbULL,
+		0x3d0211e603775a1dULL, 0x4a08796ef7d5b56dULL, 0xd316c0f7ea3284fdULL, 0xa41ca87f1e906b8dULL,
+		0xa3db522e7816d14eULL, 0xd4d13aa68cb43e3eULL, 0x4dcf833f91530faeULL, 0x3ac5ebb765f1e0deULL,
+		0x4240779d5c5e7a28ULL, 0x354a1f15a8fc9558ULL, 0xac54a68cb51ba4c8ULL, 0xdb5ece0441b94bb8ULL,
+		0xdc993455273ff17bULL, 0xab935cddd39d1e0bULL, 0x328de544ce7a2f9bULL, 0x45878dcc3ad8c0ebULL,
+		0xc386dd10bd251a77ULL, 0xb48cb5984987f507ULL, 0x2d920c015460c497ULL, 0x5a986489a0c22be7ULL,
+		0x5d5f9ed8c6449124ULL, 0x2a55f65032e67e54ULL, 0xb34b4fc92f014fc4ULL, 0xc4412741dba3a0b4ULL,
+		0xbcc4bb6be20c3a42ULL, 0xcbced3e316aed532ULL, 0x52d06a7a0b49e4a2ULL, 0x25da02f2ffeb0bd2ULL,
+		0x221df8a3996db111ULL, 0x5517902b6dcf5e61ULL, 0xcc0929b270286ff1ULL, 0xbb03413a848a8081ULL,
+		0x82fb69e0d639ec5aULL, 0xf5f10168229b032aULL, 0x6cefb8f13f7c32baULL, 0x1be5d079cbdeddcaULL,
+		0x1c222a28ad586709ULL, 0x6b2842a059fa8879ULL, 0xf236fb39441db9e9ULL, 0x853c93b1b0bf5699ULL,
+		0xfdb90f9b8910cc6fULL, 0x8ab367137db2231fULL, 0x13adde8a6055128fULL, 0x64a7b60294f7fdffULL,
+		0x63604c53f271473cULL, 0x146a24db06d3a84cULL, 0x8d749d421b3499dcULL, 0xfa7ef5caef9676acULL,
+		0x7c7fa516686bac30ULL, 0x0b75cd9e9cc94340ULL, 0x926b7407812e72d0ULL, 0xe5611c8f758c9da0ULL,
+		0xe2a6e6de130a2763ULL, 0x95ac8e56e7a8c813ULL, 0x0cb237cffa4ff983ULL, 0x7bb85f470eed16f3ULL,
+		0x033dc36d37428c05ULL, 0x7437abe5c3e06375ULL, 0xed29127cde0752e5ULL, 0x9a237af42aa5bd95ULL,
+		0x9de480a54c230756ULL, 0xeaeee82db881e826ULL, 0x73f051b4a566d9b6ULL, 0x04fa393c51c436c6ULL,
+		0x7a0423cc06eeb43aULL, 0x0d0e4b44f24c5b4aULL, 0x9410f2ddefab6adaULL, 0xe31a9a551b0985aaULL,
+		0xe4dd60047d8f3f69ULL, 0x93d7088c892dd019ULL, 0x0ac9b11594cae189ULL, 0x7dc3d99d60680ef9ULL,
+		0x054645b759c7940fULL, 0x724c2d3fad657b7fULL, 0xeb5294a6b0824aefULL, 0x9c58fc2e4420a59fULL,
+		0x9b9f067f22a61f5cULL, 0xec956ef7d604f02cULL, 0x758bd76ecbe3c1bcULL, 0x0281bfe63f412eccULL,
+		0x8480ef3ab8bcf450ULL, 0xf38a87b24c1e1b20ULL, 0x6a943e2b51f92ab0ULL, 0x1d9e56a3a55bc5c0ULL,
+		0x1a59acf2c3dd7f03ULL, 0x6d53c47a377f9073ULL, 0xf44d7de32a98a1e3ULL, 0x8347156bde3a4e93ULL,
+		0xfbc28941e795d465ULL, 0x8cc8e1c913373b15ULL, 0x15d658500ed00a85ULL, 0x62dc30d8fa72e5f5ULL,
+		0x651bca899cf45f36ULL, 0x1211a2016856b046ULL, 0x8b0f1b9875b181d6ULL, 0xfc05731081136ea6ULL,
+		0xc5fd5bcad3a0027dULL, 0xb2f733422702ed0dULL, 0x2be98adb3ae5dc9dULL, 0x5ce3e253ce4733edULL,
+		0x5b241802a8c1892eULL, 0x2c2e708a5c63665eULL, 0xb530c913418457ceULL, 0xc23aa19bb526b8beULL,
+		0xbabf3db18c892248ULL, 0xcdb55539782bcd38ULL, 0x54abeca065ccfca8ULL, 0x23a18428916e13d8ULL,
+		0x24667e79f7e8a91bULL, 0x536c16f1034a466bULL, 0xca72af681ead77fbULL, 0xbd78c7e0ea0f988bULL,
+		0x3b79973c6df24217ULL, 0x4c73ffb49950ad67ULL, 0xd56d462d84b79cf7ULL, 0xa2672ea570157387ULL,
+		0xa5a0d4f41693c944ULL, 0xd2aabc7ce2312634ULL, 0x4bb405e5ffd617a4ULL, 0x3cbe6d6d0b74f8d4ULL,
+		0x443bf14732db6222ULL, 0x333199cfc6798d52ULL, 0xaa2f2056db9ebcc2ULL, 0xdd2548de2f3c53b2ULL,
+		0xdae2b28f49bae971ULL, 0xade8da07bd180601ULL, 0x34f6639ea0ff3791ULL, 0x43fc0b16545dd8e1ULL,
+		0x4706322a0599ee27ULL, 0x300c5aa2f13b0157ULL, 0xa912e33becdc30c7ULL, 0xde188bb3187edfb7ULL,
+		0xd9df71e27ef86574ULL, 0xaed5196a8a5a8a04ULL, 0x37cba0f397bdbb94ULL, 0x40c1c87b631f54e4ULL,
+		0x384454515ab0ce12ULL, 0x4f4e3cd9ae122162ULL, 0xd6508540b3f510f2ULL, 0xa15aedc84757ff82ULL,
+		0xa69d179921d14541ULL, 0xd1977f11d573aa31ULL, 0x4889c688c8949ba1ULL, 0x3f83ae003c3674d1ULL,
+		0xb982fedcbbcbae4dULL, 0xce8896544f69413dULL, 0x57962fcd528e70adULL, 0x209c4745a62c9fddULL,
+		0x275bbd14c0aa251eULL, 0x5051d59c3408ca6eULL, 0xc94f6c0529effbfeULL, 0xbe45048ddd4d148eULL,
+		0xc6c098a7e4e28e78ULL, 0xb1caf02f10406108ULL, 0x28d449b60da75098ULL, 0x5fde213ef905bfe8ULL,
+		0x5819db6f9f83052bULL, 0x2f13b3e76b21ea5bULL, 0xb60d0a7e76c6dbcbULL, 0xc10762f6826434bbULL,
+		0xf8ff4a2cd0d75860ULL, 0x8ff522a42475b710ULL, 0x16eb9b3d39928680ULL, 0x61e1f3b5cd3069f0ULL,
+		0x662609e4abb6d333ULL, 0x112c616c5f143c43ULL, 0x8832d8f542f30dd3ULL, 0xff38b07db651e2a3ULL,
+		0x87bd2c578ffe7855ULL, 0xf0b744df7b5c9725ULL, 0x69a9fd4666bba6b5ULL, 0x1ea395ce921949c5ULL,
+		0x19646f9ff49ff306ULL, 0x6e6e0717003d1c76ULL, 0xf770be8e1dda2de6ULL, 0x807ad606e978c296ULL,
+		0x067b86da6e85180aULL, 0x7171ee529a27f77aULL, 0xe86f57cb87c0c6eaULL, 0x9f653f437362299aULL,
+		0x98a2c51215e49359ULL, 0xefa8ad9ae1467c29ULL, 0x76b61403fca14db9ULL, 0x01bc7c8b0803a2c9ULL,
+		0x7939e0a131ac383fULL, 0x0e338829c50ed74fULL, 0x972d31b0d8e9e6dfULL, 0xe02759382c4b09afULL,
+		0xe7e0a3694acdb36cULL, 0x90eacbe1be6f5c1cULL, 0x09f47278a3886d8cULL, 0x7efe1af0572a82fcULL
+	},
+	{
+		0x0000000000000000ULL, 0xf40847980ddd6874ULL, 0xaae06edbb250e67bULL, 0x5ee82943bf8d8e0fULL,
+		0x17303c5ccd4bfa65ULL, 0xe3387bc4c0969211ULL, 0xbdd052877f1b1c1eULL, 0x49d8151f72c6746aULL,
+		0x2e6078b99a97f4caULL, 0xda683f21974a9cbeULL, 0x8480166228c712b1ULL, 0x708851fa251a7ac5ULL,
+		0x395044e557dc0eafULL, 0xcd58037d5a0166dbULL, 0x93b02a3ee58ce8d4ULL, 0x67b86da6e85180a0ULL,
+		0x5cc0f173352fe994ULL, 0xa8c8b6eb38f281e0ULL, 0xf6209fa8877f0fefULL, 0x0228d8308aa2679bULL,
+		0x4bf0cd2ff86413f1ULL, 0xbff88ab7f5b97b85ULL, 0xe110a3f44a34f58aULL, 0x1518e46c47e99dfeULL,
+		0x72a089caafb81d5eULL, 0x86a8ce52a265752aULL, 0xd840e7111de8fb25ULL, 0x2c48a08910359351ULL,
+		0x6590b59662f3e73bULL, 0x9198f20e6f2e8f4fULL, 0xcf70db4dd0a30140ULL, 0x3b789cd5dd7e6934ULL,
+		0xb981e2e66a5fd328ULL, 0x4d89a57e6782bb5cULL, 0x13618c3dd80f3553ULL, 0xe769cba5d5d25d27ULL,
+		0xaeb1debaa714294dULL, 0x5ab99922aac94139ULL, 0x0451b0611544cf36ULL, 0xf059f7f91899a742ULL,
+		0x97e19a5ff0c827e2ULL, 0x63e9ddc7fd154f96ULL, 0x3d01f4844298c199ULL, 0xc909b31c4f45a9edULL,
+		0x80d1a6033d83dd87ULL, 0x74d9e19b305eb5f3ULL, 0x2a31c8d88fd33bfcULL, 0xde398f40820e5388ULL,
+		0xe54113955f703abcULL, 0x1149540d52ad52c8ULL, 0x4fa17d4eed20dcc7ULL, 0xbba93ad6e0fdb4b3ULL,
+		0xf2712fc9923bc0d9ULL, 0x067968519fe6a8adULL, 0x58914112206b26a2ULL, 0xac99068a2db64ed6ULL,
+		0xcb216b2cc5e7ce76ULL, 0x3f292cb4c83aa602ULL, 0x61c105f777b7280dULL, 0x95c9426f7a6a4079ULL,
+		0xdc11577008ac3413ULL, 0x281910e805715c67ULL, 0x76f139abbafcd268ULL, 0x82f97e33b721ba1cULL,
+		0x31f324277d5590c3ULL, 0xc5fb63bf7088f8b7ULL, 0x9b134afccf0576b8ULL, 0x6f1b0d64c2d81eccULL,
+		0x26c3187bb01e6aa6ULL, 0xd2cb5fe3bdc302d2ULL, 0x8c2376a0024e8cddULL, 0x782b31380f93e4a9ULL,
+		0x1f935c9ee7c26409ULL, 0xeb9b1b06ea1f0c7dULL, 0xb573324555928272ULL, 0x417b75dd584fea06ULL,
+		0x08a360c22a899e6cULL, 0xfcab275a2754f618ULL, 0xa2430e1998d97817ULL, 0x564b498195041063ULL,
+		0x6d33d554487a7957ULL, 0x993b92cc45a71123ULL, 0xc7d3bb8ffa2a9f2cULL, 0x33dbfc17f7f7f758ULL,
+		0x7a03e90885318332ULL, 0x8e0bae9088eceb46ULL, 0xd0e387d337616549ULL, 0x24ebc04b3abc0d3dULL,
+		0x4353adedd2ed8d9dULL, 0xb75bea75df30e5e9ULL, 0xe9b3c33660bd6be6ULL, 0x1dbb84ae6d600392ULL,
+		0x546391b11fa677f8ULL, 0xa06bd629127b1f8cULL, 0xfe83ff6aadf69183ULL, 0x0a8bb8f2a02bf9f7ULL,
+		0x8872c6c1170a43ebULL, 0x7c7a81591ad72b9fULL, 0x2292a81aa55aa590ULL, 0xd69aef82a887cde4ULL,
+		0x9f42fa9dda41b98eULL, 0x6b4abd05d79cd1faULL, 0x35a2944668115ff5ULL, 0xc1aad3de65cc3781ULL,
+		0xa612be788d9db721ULL, 0x521af9e08040df55ULL, 0x0cf2d0a33fcd515aULL, 0xf8fa973b3210392eULL,
+		0xb122822440d64d44ULL, 0x452ac5bc4d0b2530ULL, 0x1bc2ecfff286ab3fULL, 0xefcaab67ff5bc34bULL,
+		0xd4b237b22225aa7fULL, 0x20ba702a2ff8c20bULL, 0x7e52596990754c04ULL, 0x8a5a1ef19da82470ULL,
+		0xc3820beeef6e501aULL, 0x378a4c76e2b3386eULL, 0x696265355d3eb661ULL, 0x9d6a22ad50e3de15ULL,
+		0xfad24f0bb8b25eb5ULL, 0x0eda0893b56f36c1ULL, 0x503221d00ae2b8ceULL, 0xa43a6648073fd0baULL,
+		0xede2735775f9a4d0ULL, 0x19ea34cf7824cca4ULL, 0x47021d8cc7a942abULL, 0xb30a5a14ca742adfULL,
+		0x63e6484efaab2186ULL, 0x97ee0fd6f77649f2ULL, 0xc906269548fbc7fdULL, 0x3d0e610d4526af89ULL,
+		0x74d6741237e0dbe3ULL, 0x80de338a3a3db397ULL, 0xde361ac985b03d98ULL, 0x2a3e5d51886d55ecULL,
+		0x4d8630f7603cd54cULL, 0xb98e776f6de1bd38ULL, 0xe7665e2cd26c3337ULL, 0x136e19b4dfb15b43ULL,
+		0x5ab60cabad772f29ULL, 0xaebe4b33a0aa475dULL, 0xf05662701f27c952ULL, 0x045e25e812faa126ULL,
+		0x3f26b93dcf84c812ULL, 0xcb2efea5c259a066ULL, 0x95c6d7e67dd42e69ULL, 0x61ce907e7009461dULL,
+		0x2816856102cf3277ULL, 0xdc1ec2f90f125a03ULL, 0x82f6ebbab09fd40cULL, 0x76feac22bd42bc78ULL,
+		0x1146c18455133cd8ULL, 0xe54e861c58ce54acULL, 0xbba6af5fe743daa3ULL, 0x4faee8c7ea9eb2d7ULL,
+		0x0676fdd89858c6bdULL, 0xf27eba409585aec9ULL, 0xac9693032a0820c6ULL, 0x589ed49b27d548b2ULL,
+		0xda67aaa890f4f2aeULL, 0x2e6fed309d299adaULL, 0x7087c47322a414d5ULL, 0x848f83eb2f797ca1ULL,
+		0xcd5796f45dbf08cbULL, 0x395fd16c506260bfULL, 0x67b7f82fefefeeb0ULL, 0x93bfbfb7e23286c4ULL,
+		0xf407d2110a630664ULL, 0x000f958907be6e10ULL, 0x5ee7bccab833e01fULL, 0xaaeffb52b5ee886bULL,
+		0xe337ee4dc728fc01ULL, 0x173fa9d5caf59475ULL, 0x49d7809675781a7aULL, 0xbddfc70e78a5720eULL,
+		0x86a75bdba5db1b3aULL, 0x72af1c43a806734eULL, 0x2c473500178bfd41ULL, 0xd84f72981a569535ULL,
+		0x919767876890e15fULL, 0x659f201f654d892bULL, 0x3b77095cdac00724ULL, 0xcf7f4ec4d71d6f50ULL,
+		0xa8c723623f4ceff0ULL, 0x5ccf64fa32918784ULL, 0x02274db98d1c098bULL, 0xf62f0a2180c161ffULL,
+		0xbff71f3ef2071595ULL, 0x4bff58a6ffda7de1ULL, 0x151771e54057f3eeULL, 0xe11f367d4d8a9b9aULL,
+		0x52156c6987feb145ULL, 0xa61d2bf18a23d931ULL, 0xf8f502b235ae573eULL, 0x0cfd452a38733f4aULL,
+		0x452550354ab54b20ULL, 0xb12d17ad47682354ULL, 0xefc53eeef8e5ad5bULL, 0x1bcd7976f538c52fULL,
+		0x7c7514d01d69458fULL, 0x887d534810b42dfbULL, 0xd6957a0baf39a3f4ULL, 0x229d3d93a2e4cb80ULL,
+		0x6b45288cd022bfeaULL, 0x9f4d6f14ddffd79eULL, 0xc1a5465762725991ULL, 0x35ad01cf6faf31e5ULL,
+		0x0ed59d1ab2d158d1ULL, 0xfaddda82bf0c30a5ULL, 0xa435f3c10081beaaULL, 0x503db4590d5cd6deULL,
+		0x19e5a1467f9aa2b4ULL, 0xedede6de7247cac0ULL, 0xb305cf9dcdca44cfULL, 0x470d8805c0172cbbULL,
+		0x20b5e5a32846ac1bULL, 0xd4bda23b259bc46fULL, 0x8a558b789a164a60ULL, 0x7e5dcce097cb2214ULL,
+		0x3785d9ffe50d567eULL, 0xc38d9e67e8d03e0aULL, 0x9d65b724575db005ULL, 0x696df0bc5a80d871ULL,
+		0xeb948e8feda1626dULL, 0x1f9cc917e07c0a19ULL, 0x4174e0545ff18416ULL, 0xb57ca7cc522cec62ULL,
+		0xfca4b2d320ea9808ULL, 0x08acf54b2d37f07cULL, 0x5644dc0892ba7e73ULL, 0xa24c9b909f671607ULL,
+		0xc5f4f636773696a7ULL, 0x31fcb1ae7aebfed3ULL, 0x6f1498edc56670dcULL, 0x9b1cdf75c8bb18a8ULL,
+		0xd2c4ca6aba7d6cc2ULL, 0x26cc8df2b7a004b6ULL, 0x7824a4b1082d8ab9ULL, 0x8c2ce32905f0e2cdULL,
+		0xb7547ffcd88e8bf9ULL, 0x435c3864d553e38dULL, 0x1db411276ade6d82ULL, 0xe9bc56bf670305f6ULL,
+		0xa06443a015c5719cULL, 0x546c0438181819e8ULL, 0x0a842d7ba79597e7ULL, 0xfe8c6ae3aa48ff93ULL,
+		0x9934074542197f33ULL, 0x6d3c40dd4fc41747ULL, 0x33d4699ef0499948ULL, 0xc7dc2e06fd94f13cULL,
+		0x8e043b198f528556ULL, 0x7a0c7c81828fed22ULL, 0x24e455c23d02632dULL, 0xd0ec125a30df0b59ULL
+	},
+	{
+		0x0000000000000000ULL, 0xc7cc909df556430cULL, 0xcd69c0d04346b08bULL, 0x0aa5504db610f387ULL,
+		0xd823604b2f675785ULL, 0x1feff0d6da311489ULL, 0x154aa09b6c21e70eULL, 0xd28630069977a402ULL,
+		0xf2b6217df7249999ULL, 0x357ab1e00272da95ULL, 0x3fdfe1adb4622912ULL, 0xf813713041346a1eULL,
+		0x2a954136d843ce1cULL, 0xed59d1ab2d158d10ULL, 0xe7fc81e69b057e97ULL, 0x2030117b6e533d9bULL,
+		0xa79ca31047a305a1ULL, 0x6050338db2f546adULL, 0x6af563c004e5b52aULL, 0xad39f35df1b3f626ULL,
+		0x7fbfc35b68c45224ULL, 0xb87353c69d921128ULL, 0xb2d6038b2b82e2afULL, 0x751a9316ded4a1a3ULL,
+		0x552a826db0879c38ULL, 0x92e612f045d1df34ULL, 0x984342bdf3c12cb3ULL, 0x5f8fd22006976fbfULL,
+		0x8d09e2269fe0cbbdULL, 0x4ac572bb6ab688b1ULL, 0x406022f6dca67b36ULL, 0x87acb26b29f0383aULL,
+		0x0dc9a7cb26ac3dd1ULL, 0xca053756d3fa7eddULL, 0xc0a0671b65ea8d5aULL, 0x076cf78690bcce56ULL,
+		0xd5eac78009cb6a54ULL, 0x1226571dfc9d2958ULL, 0x188307504a8ddadfULL, 0xdf4f97cdbfdb99d3ULL,
+		0xff7f86b6d188a448ULL, 0x38b3162b24dee744ULL, 0x3216466692ce14c3ULL, 0xf5dad6fb679857cfULL,
+		0x275ce6fdfeeff3cdULL, 0xe09076600bb9b0c1ULL, 0xea35262dbda94346ULL, 0x2df9b6b048ff004aULL,
+		0xaa5504db610f3870ULL, 0x6d99944694597b7cULL, 0x673cc40b224988fbULL, 0xa0f05496d71fcbf7ULL,
+		0x727664904e686ff5ULL, 0xb5baf40dbb3e2cf9ULL, 0xbf1fa4400d2edf7eULL, 0x78d334ddf8789c72ULL,
+		0x58e325a6962ba1e9ULL, 0x9f2fb53b637de2e5ULL, 0x958ae576d56d1162ULL, 0x524675eb203b526eULL,
+		0x80c045edb94cf66cULL, 0x470cd5704c1ab560ULL, 0x4da9853dfa0a46e7ULL, 0x8a6515a00f5c05ebULL,
+		0x1b934f964d587ba2ULL, 0xdc5fdf0bb80e38aeULL, 0xd6fa8f460e1ecb29ULL, 0x11361fdbfb488825ULL,
+		0xc3b02fdd623f2c27ULL, 0x047cbf4097696f2bULL, 0x0ed9ef0d21799cacULL, 0xc9157f90d42fdfa0ULL,
+		0xe9256eebba7ce23bULL, 0x2ee9fe764f2aa137ULL, 0x244cae3bf93a52b0ULL, 0xe3803ea60c6c11bcULL,
+		0x31060ea0951bb5beULL, 0xf6ca9e3d604df6b2ULL, 0xfc6fce70d65d0535ULL, 0x3ba35eed230b4639ULL,
+		0xbc0fec860afb7e03ULL, 0x7bc37c1bffad3d0fULL, 0x71662c5649bdce88ULL, 0xb6aabccbbceb8d84ULL,
+		0x642c8ccd259c2986ULL, 0xa3e01c50d0ca6a8aULL, 0xa9454c1d66da990dULL, 0x6e89dc80938cda01ULL,
+		0x4eb9cdfbfddfe79aULL, 0x89755d660889a496ULL, 0x83d00d2bbe995711ULL, 0x441c9db64bcf141dULL,
+		0x969aadb0d2b8b01fULL, 0x51563d2d27eef313ULL, 0x5bf36d6091fe0094ULL, 0x9c3ffdfd64a84398ULL,
+		0x165ae85d6bf44673ULL, 0xd19678c09ea2057fULL, 0xdb33288d28b2f6f8ULL, 0x1cffb810dde4b5f4ULL,
+		0xce798816449311f6ULL, 0x09b5188bb1c552faULL, 0x031048c607d5a17dULL, 0xc4dcd85bf283e271ULL,
+		0xe4ecc9209cd0dfeaULL, 0x232059bd69869ce6ULL, 0x298509f0df966f61ULL, 0xee49996d2ac02c6dULL,
+		0x3ccfa96bb3b7886fULL, 0xfb0339f646e1cb63ULL, 0xf1a669bbf0f138e4ULL, 0x366af92605a77be8ULL,
+		0xb1c64b4d2c5743d2ULL, 0x760adbd0d90100deULL, 0x7caf8b9d6f11f359ULL, 0xbb631b009a47b055ULL,
+		0x69e52b0603301457ULL, 0xae29bb9bf666575bULL, 0xa48cebd64076a4dcULL, 0x63407b4bb520e7d0ULL,
+		0x43706a30db73da4bULL, 0x84bcfaad2e259947ULL, 0x8e19aae098356ac0ULL, 0x49d53a7d6d6329ccULL,
+		0x9b530a7bf4148dceULL, 0x5c9f9ae60142cec2ULL, 0x563acaabb7523d45ULL, 0x91f65a3642047e49ULL,
+		0x37269f2c9ab0f744ULL, 0xf0ea0fb16fe6b448ULL, 0xfa4f5ffcd9f647cfULL, 0x3d83cf612ca004c3ULL,
+		0xef05ff67b5d7a0c1ULL, 0x28c96ffa4081e3cdULL, 0x226c3fb7f691104aULL, 0xe5a0af2a03c75346ULL,
+		0xc590be516d946eddULL, 0x025c2ecc98c22dd1ULL, 0x08f97e812ed2de56ULL, 0xcf35ee1cdb849d5aULL,
+		0x1db3de1a42f33958ULL, 0xda7f4e87b7a57a54ULL, 0xd0da1eca01b589d3ULL, 0x17168e57f4e3cadfULL,
+		0x90ba3c3cdd13f2e5ULL, 0x5776aca12845b1e9ULL, 0x5dd3fcec9e55426eULL, 0x9a1f6c716b030162ULL,
+		0x48995c77f274a560ULL, 0x8f55ccea0722e66cULL, 0x85f09ca7b13215ebULL, 0x423c0c3a446456e7ULL,
+		0x620c1d412a376b7cULL, 0xa5c08ddcdf612870ULL, 0xaf65dd916971dbf7ULL, 0x68a94d0c9c2798fbULL,
+		0xba2f7d0a05503cf9ULL, 0x7de3ed97f0067ff5ULL, 0x7746bdda46168c72ULL, 0xb08a2d47b340cf7eULL,
+		0x3aef38e7bc1cca95ULL, 0xfd23a87a494a8999ULL, 0xf786f837ff5a7a1eULL, 0x304a68aa0a0c3912ULL,
+		0xe2cc58ac937b9d10ULL, 0x2500c831662dde1cULL, 0x2fa5987cd03d2d9bULL, 0xe86908e1256b6e97ULL,
+		0xc859199a4b38530cULL, 0x0f958907be6e1000ULL, 0x0530d94a087ee387ULL, 0xc2fc49d7fd28a08bULL,
+		0x107a79d1645f0489ULL, 0xd7b6e94c91094785ULL, 0xdd13b9012719b402ULL, 0x1adf299cd24ff70eULL,
+		0x9d739bf7fbbfcf34ULL, 0x5abf0b6a0ee98c38ULL, 0x501a5b27b8f97fbfULL, 0x97d6cbba4daf3cb3ULL,
+		0x4550fbbcd4d898b1ULL, 0x829c6b21218edbbdULL, 0x88393b6c979e283aULL, 0x4ff5abf162c86b36ULL,
+		0x6fc5ba8a0c9b56adULL, 0xa8092a17f9cd15a1ULL, 0xa2ac7a5a4fdde626ULL, 0x6560eac7ba8ba52aULL,
+		0xb7e6dac123fc0128ULL, 0x702a4a5cd6aa4224ULL, 0x7a8f1a1160bab1a3ULL, 0xbd438a8c95ecf2afULL,
+		0x2cb5d0bad7e88ce6ULL, 0xeb79402722becfeaULL, 0xe1dc106a94ae3c6dULL, 0x261080f761f87f61ULL,
+		0xf496b0f1f88fdb63ULL, 0x335a206c0dd9986fULL, 0x39ff7021bbc96be8ULL, 0xfe33e0bc4e9f28e4ULL,
+		0xde03f1c720cc157fULL, 0x19cf615ad59a5673ULL, 0x136a3117638aa5f4ULL, 0xd4a6a18a96dce6f8ULL,
+		0x0620918c0fab42faULL, 0xc1ec0111fafd01f6ULL, 0xcb49515c4cedf271ULL, 0x0c85c1c1b9bbb17dULL,
+		0x8b2973aa904b8947ULL, 0x4ce5e337651dca4bULL, 0x4640b37ad30d39ccULL, 0x818c23e7265b7ac0ULL,
+		0x530a13e1bf2cdec2ULL, 0x94c6837c4a7a9dceULL, 0x9e63d331fc6a6e49ULL, 0x59af43ac093c2d45ULL,
+		0x799f52d7676f10deULL, 0xbe53c24a923953d2ULL, 0xb4f692072429a055ULL, 0x733a029ad17fe359ULL,
+		0xa1bc329c4808475bULL, 0x6670a201bd5e0457ULL, 0x6cd5f24c0b4ef7d0ULL, 0xab1962d1fe18b4dcULL,
+		0x217c7771f144b137ULL, 0xe6b0e7ec0412f23bULL, 0xec15b7a1b20201bcULL, 0x2bd9273c475442b0ULL,
+		0xf95f173ade23e6b2ULL, 0x3e9387a72b75a5beULL, 0x3436d7ea9d655639ULL, 0xf3fa477768331535ULL,
+		0xd3ca560c066028aeULL, 0x1406c691f3366ba2ULL, 0x1ea396dc45269825ULL, 0xd96f0641b070db29ULL,
+		0x0be9364729077f2bULL, 0xcc25a6dadc513c27ULL, 0xc680f6976a41cfa0ULL, 0x014c660a9f178cacULL,
+		0x86e0d461b6e7b496ULL, 0x412c44fc43b1f79aULL, 0x4b8914b1f5a1041dULL, 0x8c45842c00f74711ULL,
+		0x5ec3b42a9980e313ULL, 0x990f24b76cd6a01fULL, 0x93aa74fadac65398ULL, 0x5466e4672f901094ULL,
+		0x7456f51c41c32d0fULL, 0xb39a6581b4956e03ULL, 0xb93f35cc02859d84ULL, 0x7ef3a551f7d3de88ULL,
+		0xac7595576ea47a8aULL, 0x6bb905ca9bf23986ULL, 0x611c55872de2ca01ULL, 0xa6d0c51ad8b4890dULL
+	},
+	{
+		0x0000000000000000ULL, 0x6e4d3e593561ee88ULL, 0xdc9a7cb26ac3dd10ULL, 0xb2d742eb5fa23398ULL,
+		0xfbc4188f7c6d8cb3ULL, 0x958926d6490c623bULL, 0x275e643d16ae51a3ULL, 0x49135a6423cfbf2bULL,
+		0xb578d0f551312ff5ULL, 0xdb35eeac6450c17dULL, 0x69e2ac473bf2f2e5ULL, 0x07af921e0e931c6dULL,
+		0x4ebcc87a2d5ca346ULL, 0x20f1f623183d4dceULL, 0x9226b4c8479f7e56ULL, 0xfc6b8a9172fe90deULL,
+		0x280140010b886979ULL, 0x464c7e583ee987f1ULL, 0xf49b3cb3614bb469ULL, 0x9ad602ea542a5ae1ULL,
+		0xd3c5588e77e5e5caULL, 0xbd8866d742840b42ULL, 0x0f5f243c1d2638daULL, 0x61121a652847d652ULL,
+		0x9d7990f45ab9468cULL, 0xf334aead6fd8a804ULL, 0x41e3ec46307a9b9cULL, 0x2faed21f051b7514ULL,
+		0x66bd887b26d4ca3fULL, 0x08f0b62213b524b7ULL, 0xba27f4c94c17172fULL, 0xd46aca907976f9a7ULL,
+		0x500280021710d2f2ULL, 0x3e4fbe5b22713c7aULL, 0x8c98fcb07dd30fe2ULL, 0xe2d5c2e948b2e16aULL,
+		0xabc6988d6b7d5e41ULL, 0xc58ba6d45e1cb0c9ULL, 0x775ce43f01be8351ULL, 0x1911da6634df6dd9ULL,
+		0xe57a50f74621fd07ULL, 0x8b376eae7340138fULL, 0x39e02c452ce22017ULL, 0x57ad121c1983ce9fULL,
+		0x1ebe48783a4c71b4ULL, 0x70f376210f2d9f3cULL, 0xc22434ca508faca4ULL, 0xac690a9365ee422cULL,
+		0x7803c0031c98bb8bULL, 0x164efe5a29f95503ULL, 0xa499bcb1765b669bULL, 0xcad482e8433a8813ULL,
+		0x83c7d88c60f53738ULL, 0xed8ae6d55594d9b0ULL, 0x5f5da43e0a36ea28ULL, 0x31109a673f5704a0ULL,
+		0xcd7b10f64da9947eULL, 0xa3362eaf78c87af6ULL, 0x11e16c44276a496eULL, 0x7fac521d120ba7e6ULL,
+		0x36bf087931c418cdULL, 0x58f2362004a5f645ULL, 0xea2574cb5b07c5ddULL, 0x84684a926e662b55ULL,
+		0xa00500042e21a5e4ULL, 0xce483e5d1b404b6cULL, 0x7c9f7cb644e278f4ULL, 0x12d242ef7183967cULL,
+		0x5bc1188b524c2957ULL, 0x358c26d2672dc7dfULL, 0x875b6439388ff447ULL, 0xe9165a600dee1acfULL,
+		0x157dd0f17f108a11ULL, 0x7b30eea84a716499ULL, 0xc9e7ac4315d35701ULL, 0xa7aa921a20b2b989ULL,
+		0xeeb9c87e037d06a2ULL, 0x80f4f627361ce82aULL, 0x3223b4cc69bedbb2ULL, 0x5c6e8a955cdf353aULL,
+		0x8804400525a9cc9dULL, 0xe6497e5c10c82215ULL, 0x549e3cb74f6a118dULL, 0x3ad302ee7a0bff05ULL,
+		0x73c0588a59c4402eULL, 0x1d8d66d36ca5aea6ULL, 0xaf5a243833079d3eULL, 0xc1171a61066673b6ULL,
+		0x3d7c90f07498e368ULL, 0x5331aea941f90de0ULL, 0xe1e6ec421e5b3e78ULL, 0x8fabd21b2b3ad0f0ULL,
+		0xc6b8887f08f56fdbULL, 0xa8f5b6263d948153ULL, 0x1a22f4cd6236b2cbULL, 0x746fca9457575c43ULL,
+		0xf007800639317716ULL, 0x9e4abe5f0c50999eULL, 0x2c9dfcb453f2aa06ULL, 0x42d0c2ed6693448eULL,
+		0x0bc39889455cfba5ULL, 0x658ea6d0703d152dULL, 0xd759e43b2f9f26b5ULL, 0xb914da621afec83dULL,
+		0x457f50f3680058e3ULL, 0x2b326eaa5d61b66bULL, 0x99e52c4102c385f3ULL, 0xf7a8121837a26b7bULL,
+		0xbebb487c146dd450ULL, 0xd0f67625210c3ad8ULL, 0x622134ce7eae0940ULL, 0x0c6c0a974bcfe7c8ULL,
+		0xd806c00732b91e6fULL, 0xb64bfe5e07d8f0e7ULL, 0x049cbcb5587ac37fULL, 0x6ad182ec6d1b2df7ULL,
+		0x23c2d8884ed492dcULL, 0x4d8fe6d17bb57c54ULL, 0xff58a43a24174fccULL, 0x91159a631176a144ULL,
+		0x6d7e10f26388319aULL, 0x03332eab56e9df12ULL, 0xb1e46c40094bec8aULL, 0xdfa952193c2a0202ULL,
+		0x96ba087d1fe5bd29ULL, 0xf8f736242a8453a1ULL, 0x4a2074cf75266039ULL, 0x246d4a9640478eb1ULL,
+		0x02fae1e3f5a97d5bULL, 0x6cb7dfbac0c893d3ULL, 0xde609d519f6aa04bULL, 0xb02da308aa0b4ec3ULL,
+		0xf93ef96c89c4f1e8ULL, 0x9773c735bca51f60ULL, 0x25a485dee3072cf8ULL, 0x4be9bb87d666c270ULL,
+		0xb7823116a49852aeULL, 0xd9cf0f4f91f9bc26ULL, 0x6b184da4ce5b8fbeULL, 0x055573fdfb3a6136ULL,
+		0x4c462999d8f5de1dULL, 0x220b17c0ed943095ULL, 0x90dc552bb236030dULL, 0xfe916b728757ed85ULL,
+		0x2afba1e2fe211422ULL, 0x44b69fbbcb40faaaULL, 0xf661dd5094e2c932ULL, 0x982ce309a18327baULL,
+		0xd13fb96d824c9891ULL, 0xbf728734b72d7619ULL, 0x0da5c5dfe88f4581ULL, 0x63e8fb86ddeeab09ULL,
+		0x9f837117af103bd7ULL, 0xf1ce4f4e9a71d55fULL, 0x43190da5c5d3e6c7ULL, 0x2d5433fcf0b2084fULL,
+		0x64476998d37db764ULL, 0x0a0a57c1e61c59ecULL, 0xb8dd152ab9be6a74ULL, 0xd6902b738cdf84fcULL,
+		0x52f861e1e2b9afa9ULL, 0x3cb55fb8d7d84121ULL, 0x8e621d53887a72b9ULL, 0xe02f230abd1b9c31ULL,
+		0xa93c796e9ed4231aULL, 0xc7714737abb5cd92ULL, 0x75a605dcf417fe0aULL, 0x1beb3b85c1761082ULL,
+		0xe780b114b388805cULL, 0x89cd8f4d86e96ed4ULL, 0x3b1acda6d94b5d4cULL, 0x5557f3ffec2ab3c4ULL,
+		0x1c44a99bcfe50cefULL, 0x720997c2fa84e267ULL, 0xc0ded529a526d1ffULL, 0xae93eb7090473f77ULL,
+		0x7af921e0e931c6d0ULL, 0x14b41fb9dc502858ULL, 0xa6635d5283f21bc0ULL, 0xc82e630bb693f548ULL,
+		0x813d396f955c4a63ULL, 0xef700736a03da4ebULL, 0x5da745ddff9f9773ULL, 0x33ea7b84cafe79fbULL,
+		0xcf81f115b800e925ULL, 0xa1cccf4c8d6107adULL, 0x131b8da7d2c33435ULL, 0x7d56b3fee7a2dabdULL,
+		0x3445e99ac46d6596ULL, 0x5a08d7c3f10c8b1eULL, 0xe8df9528aeaeb886ULL, 0x8692ab719bcf560eULL,
+		0xa2ffe1e7db88d8bfULL, 0xccb2dfbeeee93637ULL, 0x7e659d55b14b05afULL, 0x1028a30c842aeb27ULL,
+		0x593bf968a7e5540cULL, 0x3776c7319284ba84ULL, 0x85a185dacd26891cULL, 0xebecbb83f8476794ULL,
+		0x178731128ab9f74aULL, 0x79ca0f4bbfd819c2ULL, 0xcb1d4da0e07a2a5aULL, 0xa55073f9d51bc4d2ULL,
+		0xec43299df6d47bf9ULL, 0x820e17c4c3b59571ULL, 0x30d9552f9c17a6e9ULL, 0x5e946b76a9764861ULL,
+		0x8afea1e6d000b1c6ULL, 0xe4b39fbfe5615f4eULL, 0x5664dd54bac36cd6ULL, 0x3829e30d8fa2825eULL,
+		0x713ab969ac6d3d75ULL, 0x1f778730990cd3fdULL, 0xada0c5dbc6aee065ULL, 0xc3edfb82f3cf0eedULL,
+		0x3f86711381319e33ULL, 0x51cb4f4ab45070bbULL, 0xe31c0da1ebf24323ULL, 0x8d5133f8de93adabULL,
+		0xc442699cfd5c1280ULL, 0xaa0f57c5c83dfc08ULL, 0x18d8152e979fcf90ULL, 0x76952b77a2fe2118ULL,
+		0xf2fd61e5cc980a4dULL, 0x9cb05fbcf9f9e4c5ULL, 0x2e671d57a65bd75dULL, 0x402a230e933a39d5ULL,
+		0x0939796ab0f586feULL, 0x6774473385946876ULL, 0xd5a305d8da365beeULL, 0xbbee3b81ef57b566ULL,
+		0x4785b1109da925b8ULL, 0x29c88f49a8c8cb30ULL, 0x9b1fcda2f76af8a8ULL, 0xf552f3fbc20b1620ULL,
+		0xbc41a99fe1c4a90bULL, 0xd20c97c6d4a54783ULL, 0x60dbd52d8b07741bULL, 0x0e96eb74be669a93ULL,
+		0xdafc21e4c7106334ULL, 0xb4b11fbdf2718dbcULL, 0x06665d56add3be24ULL, 0x682b630f98b250acULL,
+		0x2138396bbb7def87ULL, 0x4f7507328e1c010fULL, 0xfda245d9d1be3297ULL, 0x93ef7b80e4dfdc1fULL,
+		0x6f84f11196214cc1ULL, 0x01c9cf48a340a249ULL, 0xb31e8da3fce291d1ULL, 0xdd53b3fac9837f59ULL,
+		0x9440e99eea4cc072ULL, 0xfa0dd7c7df2d2efaULL, 0x48da952c808f1d62ULL, 0x2697ab75b5eef3eaULL
+	}
+};
+
+/* Tables of the CRC-64 of all 8-bit messages followed by 0 to 7 zero bytes
+ * used to calculate the XZ CRC-64 with slicing-by-8
+ * Polynomial: 0xc96c5795d7870f42 (reversed 0x42f0e1eba9ea3693)
+ * Table N contains the CRC-64 of the 8-bit message followed by N zero bytes
+ */
+static const uint64_t assorted_crc64_xz_slicing_table[ 8 ][ 256 ] = {
+	{
+		0x0000000000000000ULL, 0xb32e4cbe03a75f6fULL, 0xf4843657a840a05bULL, 0x47aa7ae9abe7ff34ULL,
+		0x7bd0c384ff8f5e33ULL, 0xc8fe8f3afc28015cULL, 0x8f54f5d357cffe68ULL, 0x3c7ab96d5468a107ULL,
+		0xf7a18709ff1ebc66ULL, 0x448fcbb7fcb9e309ULL, 0x0325b15e575e1c3dULL, 0xb00bfde054f94352ULL,
+		0x8c71448d0091e255ULL, 0x3f5f08330336bd3aULL, 0x78f572daa8d1420eULL, 0xcbdb3e64ab761d61ULL,
+		0x7d9ba13851336649ULL, 0xceb5ed8652943926ULL, 0x891f976ff973c612ULL, 0x3a31dbd1fad4997dULL,
+		0x064b62bcaebc387aULL, 0xb5652e02ad1b6715ULL, 0xf2cf54eb06fc9821ULL, 0x41e11855055bc74eULL,
+		0x8a3a2631ae2dda2fULL, 0x39146a8fad8a8540ULL, 0x7ebe1066066d7a74ULL, 0xcd905cd805ca251bULL,
+		0xf1eae5b551a2841cULL, 0x42c4a90b5205db73ULL, 0x056ed3e2f9e22447ULL, 0xb6409f5cfa457b28ULL,
+		0xfb374270a266cc92ULL, 0x48190ecea1c193fdULL, 0x0fb374270a266cc9ULL, 0xbc9d3899098133a6ULL,
+		0x80e781f45de992a1ULL, 0x33c9cd4a5e4ecdceULL, 0x7463b7a3f5a932faULL, 0xc74dfb1df60e6d95ULL,
+		0x0c96c5795d7870f4ULL, 0xbfb889c75edf2f9bULL, 0xf812f32ef538d0afULL, 0x4b3cbf90f69f8fc0ULL,
+		0x774606fda2f72ec7ULL, 0xc4684a43a15071a8ULL, 0x83c230aa0ab78e9cULL, 0x30ec7c140910d1f3ULL,
+		0x86ace348f355aadbULL, 0x3582aff6f0f2f5b4ULL, 0x7228d51f5b150a80ULL, 0xc10699a158b255efULL,
+		0xfd7c20cc0cdaf4e8ULL, 0x4e526c720f7dab87ULL, 0x09f8169ba49a54b3ULL, 0xbad65a25a73d0bdcULL,
+		0x710d64410c4b16bdULL, 0xc22328ff0fec49d2ULL, 0x85895216a40bb6e6ULL, 0x36a71ea8a7ace989ULL,
+		0x0adda7c5f3c4488eULL, 0xb9f3eb7bf06317e1ULL, 0xfe5991925b84e8d5ULL, 0x4d77dd2c5823b7baULL,
+		0x64b62bcaebc387a1ULL, 0xd7986774e864d8ceULL, 0x90321d9d438327faULL, 0x231c512340247895ULL,
+		0x1f66e84e144cd992ULL, 0xac48a4f017eb86fdULL, 0xebe2de19bc0c79c9ULL, 0x58cc92a7bfab26a6ULL,
+		0x9317acc314dd3bc7ULL, 0x2039e07d177a64a8ULL, 0x67939a94bc9d9b9cULL, 0xd4bdd62abf3ac4f3ULL,
+		0xe8c76f47eb5265f4ULL, 0x5be923f9e8f53a9bULL, 0x1c4359104312c5afULL, 0xaf6d15ae40b59ac0ULL,
+		0x192d8af2baf0e1e8ULL, 0xaa03c64cb957be87ULL, 0xeda9bca512b041b3ULL, 0x5e87f01b11171edcULL,
+		0x62fd4976457fbfdbULL, 0xd1d305c846d8e0b4ULL, 0x96797f21ed3f1f80ULL, 0x2557339fee9840efULL,
+		0xee8c0dfb45ee5d8eULL, 0x5da24145464902e1ULL, 0x1a083bacedaefdd5ULL, 0xa9267712ee09a2baULL,
+		0x955cce7fba6103bdULL, 0x267282c1b9c65cd2ULL, 0x61d8f8281221a3e6ULL, 0xd2f6b4961186fc89ULL,
+		0x9f8169ba49a54b33ULL, 0x2caf25044a02145cULL, 0x6b055fede1e5eb68ULL, 0xd82b1353e242b407ULL,
+		0xe451aa3eb62a1500ULL, 0x577fe680b58d4a6fULL, 0x10d59c691e6ab55bULL, 0xa3fbd0d71dcdea34ULL,
+		0x6820eeb3b6bbf755ULL, 0xdb0ea20db51ca83aULL, 0x9ca4d8e41efb570eULL, 0x2f8a945a1d5c0861ULL,
+		0x13f02d374934a966ULL, 0xa0de61894a93f609ULL, 0xe7741b60e174093dULL, 0x545a57dee2d35652ULL,
+		0xe21ac88218962d7aULL, 0x5134843c1b317215ULL, 0x169efed5b0d68d21ULL, 0xa5b0b26bb371d24eULL,
+		0x99ca0b06e7197349ULL, 0x2ae447b8e4be2c26ULL, 0x6d4e3d514f59d312ULL, 0xde6071ef4cfe8c7dULL,
+		0x15bb4f8be788911cULL, 0xa6950335e42fce73ULL, 0xe13f79dc4fc83147ULL, 0x521135624c6f6e28ULL,
+		0x6e6b8c0f1807cf2fULL, 0xdd45c0b11ba09040ULL, 0x9aefba58b0476f74ULL, 0x29c1f6e6b3e0301bULL,
+		0xc96c5795d7870f42ULL, 0x7a421b2bd420502dULL, 0x3de861c27fc7af19ULL, 0x8ec62d7c7c60f076ULL,
+		0xb2bc941128085171ULL, 0x0192d8af2baf0e1eULL, 0x4638a2468048f12aULL, 0xf516eef883efae45ULL,
+		0x3ecdd09c2899b324ULL, 0x8de39c222b3eec4bULL, 0xca49e6cb80d9137fULL, 0x7967aa75837e4c10ULL,
+		0x451d1318d716ed17ULL, 0xf6335fa6d4b1b278ULL, 0xb199254f7f564d4cULL, 0x02b769f17cf11223ULL,
+		0xb4f7f6ad86b4690bULL, 0x07d9ba1385133664ULL, 0x4073c0fa2ef4c950ULL, 0xf35d8c442d53963fULL,
+		0xcf273529793b3738ULL, 0x7c0979977a9c6857ULL, 0x3ba3037ed17b9763ULL, 0x888d4fc0d2dcc80cULL,
+		0x435671a479aad56dULL, 0xf0783d1a7a0d8a02ULL, 0xb7d247f3d1ea7536ULL, 0x04fc0b4dd24d2a59ULL,
+		0x3886b22086258b5eULL, 0x8ba8fe9e8582d431ULL, 0xcc0284772e652b05ULL, 0x7f2cc8c92dc2746aULL,
+		0x325b15e575e1c3d0ULL, 0x8175595b76469cbfULL, 0xc6df23b2dda1638bULL, 0x75f16f0cde063ce4ULL,
+		0x498bd6618a6e9de3ULL, 0xfaa59adf89c9c28cULL, 0xbd0fe036222e3db8ULL, 0x0e21ac88218962d7ULL,
+		0xc5fa92ec8aff7fb6ULL, 0x76d4de52895820d9ULL, 0x317ea4bb22bfdfedULL, 0x8250e80521188082ULL,
+		0xbe2a516875702185ULL, 0x0d041dd676d77eeaULL, 0x4aae673fdd3081deULL, 0xf9802b81de97deb1ULL,
+		0x4fc0b4dd24d2a599ULL, 0xfceef8632775faf6ULL, 0xbb44828a8c9205c2ULL, 0x086ace348f355aadULL,
+		0x34107759db5dfbaaULL, 0x873e3be7d8faa4c5ULL, 0xc094410e731d5bf1ULL, 0x73ba0db070ba049eULL,
+		0xb86133d4dbcc19ffULL, 0x0b4f7f6ad86b4690ULL, 0x4ce50583738cb9a4ULL, 0xffcb493d702be6cbULL,
+		0xc3b1f050244347ccULL, 0x709fbcee27e418a3ULL, 0x3735c6078c03e797ULL, 0x841b8ab98fa4b8f8ULL,
+		0xadda7c5f3c4488e3ULL, 0x1ef430e13fe3d78cULL, 0x595e4a08940428b8ULL, 0xea7006b697a377d7ULL,
+		0xd60abfdbc3cbd6d0ULL, 0x6524f365c06c89bfULL, 0x228e898c6b8b768bULL, 0x91a0c532682c29e4ULL,
+		0x5a7bfb56c35a3485ULL, 0xe955b7e8c0fd6beaULL, 0xaeffcd016b1a94deULL, 0x1dd181bf68bdcbb1ULL,
+		0x21ab38d23cd56ab6ULL, 0x9285746c3f7235d9ULL, 0xd52f0e859495caedULL, 0x6601423b97329582ULL,
+		0xd041dd676d77eeaaULL, 0x636f91d96ed0b1c5ULL, 0x24c5eb30c5374ef1ULL, 0x97eba78ec690119eULL,
+		0xab911ee392f8b099ULL, 0x18bf525d915feff6ULL, 0x5f1528b43ab810c2ULL, 0xec3b640a391f4fadULL,
+		0x27e05a6e926952ccULL, 0x94ce16d091ce0da3ULL, 0xd3646c393a29f297ULL, 0x604a2087398eadf8ULL,
+		0x5c3099ea6de60cffULL, 0xef1ed5546e415390ULL, 0xa8b4afbdc5a6aca4ULL, 0x1b9ae303c601f3cbULL,
+		0x56ed3e2f9e224471ULL, 0xe5c372919d851b1eULL, 0xa26908783662e42aULL, 0x114744c635c5bb45ULL,
+		0x2d3dfdab61ad1a42ULL, 0x9e13b115620a452dULL, 0xd9b9cbfcc9edba19ULL, 0x6a978742ca4ae576ULL,
+		0xa14cb926613cf817ULL, 0x1262f598629ba778ULL, 0x55c88f71c97c584cULL, 0xe6e6c3cfcadb0723ULL,
+		0xda9c7aa29eb3a624ULL, 0x69b2361c9d14f94bULL, 0x2e184cf536f3067fULL, 0x9d36004b35545910ULL,
+		0x2b769f17cf112238ULL, 0x9858d3a9ccb67d57ULL, 0xdff2a94067518263ULL, 0x6cdce5fe64f6dd0cULL,
+		0x50a65c93309e7c0bULL, 0xe388102d33392364ULL, 0xa4226ac498dedc50ULL, 0x170c267a9b79833fULL,
+		0xdcd7181e300f9e5eULL, 0x6ff954a033a8c131ULL, 0x28532e49984f3e05ULL, 0x9b7d62f79be8616aULL,
+		0xa707db9acf80c06dULL, 0x14299724cc279f02ULL, 0x5383edcd67c06036ULL, 0xe0ada17364673f59ULL
+	},
+	{
+		0x0000000000000000ULL, 0x54e979925cd0f10dULL, 0xa9d2f324b9a1e21aULL, 0xfd3b8ab6e5711317ULL,
+		0xc17d4962dc4ddab1ULL, 0x959430f0809d2bbcULL, 0x68afba4665ec38abULL, 0x3c46c3d4393cc9a6ULL,
+		0x10223dee1795abe7ULL, 0x44cb447c4b455aeaULL, 0xb9f0cecaae3449fdULL, 0xed19b758f2e4b8f0ULL,
+		0xd15f748ccbd87156ULL, 0x85b60d1e9708805bULL, 0x788d87a87279934cULL, 0x2c64fe3a2ea96241ULL,
+		0x20447bdc2f2b57ceULL, 0x74ad024e73fba6c3ULL, 0x899688f8968ab5d4ULL, 0xdd7ff16aca5a44d9ULL,
+		0xe13932bef3668d7fULL, 0xb5d04b2cafb67c72ULL, 0x48ebc19a4ac76f65ULL, 0x1c02b80816179e68ULL,
+		0x3066463238befc29ULL, 0x648f3fa0646e0d24ULL, 0x99b4b516811f1e33ULL, 0xcd5dcc84ddcfef3eULL,
+		0xf11b0f50e4f32698ULL, 0xa5f276c2b823d795ULL, 0x58c9fc745d52c482ULL, 0x0c2085e60182358fULL,
+		0x4088f7b85e56af9cULL, 0x14618e2a02865e91ULL, 0xe95a049ce7f74d86ULL, 0xbdb37d0ebb27bc8bULL,
+		0x81f5beda821b752dULL, 0xd51cc748decb8420ULL, 0x28274dfe3bba9737ULL, 0x7cce346c676a663aULL,
+		0x50aaca5649c3047bULL, 0x0443b3c41513f576ULL, 0xf9783972f062e661ULL, 0xad9140e0acb2176cULL,
+		0x91d78334958edecaULL, 0xc53efaa6c95e2fc7ULL, 0x380570102c2f3cd0ULL, 0x6cec098270ffcdddULL,
+		0x60cc8c64717df852ULL, 0x3425f5f62dad095fULL, 0xc91e7f40c8dc1a48ULL, 0x9df706d2940ceb45ULL,
+		0xa1b1c506ad3022e3ULL, 0xf558bc94f1e0d3eeULL, 0x086336221491c0f9ULL, 0x5c8a4fb0484131f4ULL,
+		0x70eeb18a66e853b5ULL, 0x2407c8183a38a2b8ULL, 0xd93c42aedf49b1afULL, 0x8dd53b3c839940a2ULL,
+		0xb193f8e8baa58904ULL, 0xe57a817ae6757809ULL, 0x18410bcc03046b1eULL, 0x4ca8725e5fd49a13ULL,
+		0x8111ef70bcad5f38ULL, 0xd5f896e2e07dae35ULL, 0x28c31c54050cbd22ULL, 0x7c2a65c659dc4c2fULL,
+		0x406ca61260e08589ULL, 0x1485df803c307484ULL, 0xe9be5536d9416793ULL, 0xbd572ca48591969eULL,
+		0x9133d29eab38f4dfULL, 0xc5daab0cf7e805d2ULL, 0x38e121ba129916c5ULL, 0x6c0858284e49e7c8ULL,
+		0x504e9bfc77752e6eULL, 0x04a7e26e2ba5df63ULL, 0xf99c68d8ced4cc74ULL, 0xad75114a92043d79ULL,
+		0xa15594ac938608f6ULL, 0xf5bced3ecf56f9fbULL, 0x088767882a27eaecULL, 0x5c6e1e1a76f71be1ULL,
+		0x6028ddce4fcbd247ULL, 0x34c1a45c131b234aULL, 0xc9fa2eeaf66a305dULL, 0x9d135778aabac150ULL,
+		0xb177a9428413a311ULL, 0xe59ed0d0d8c3521cULL, 0x18a55a663db2410bULL, 0x4c4c23f46162b006ULL,
+		0x700ae020585e79a0ULL, 0x24e399b2048e88adULL, 0xd9d81304e1ff9bbaULL, 0x8d316a96bd2f6ab7ULL,
+		0xc19918c8e2fbf0a4ULL, 0x9570615abe2b01a9ULL, 0x684bebec5b5a12beULL, 0x3ca2927e078ae3b3ULL,
+		0x00e451aa3eb62a15ULL, 0x540d28386266db18ULL, 0xa936a28e8717c80fULL, 0xfddfdb1cdbc73902ULL,
+		0xd1bb2526f56e5b43ULL, 0x85525cb4a9beaa4eULL, 0x7869d6024ccfb959ULL, 0x2c80af90101f4854ULL,
+		0x10c66c44292381f2ULL, 0x442f15d675f370ffULL, 0xb9149f60908263e8ULL, 0xedfde6f2cc5292e5ULL,
+		0xe1dd6314cdd0a76aULL, 0xb5341a8691005667ULL, 0x480f903074714570ULL, 0x1ce6e9a228a1b47dULL,
+		0x20a02a76119d7ddbULL, 0x744953e44d4d8cd6ULL, 0x8972d952a83c9fc1ULL, 0xdd9ba0c0f4ec6eccULL,
+		0xf1ff5efada450c8dULL, 0xa51627688695fd80ULL, 0x582dadde63e4ee97ULL, 0x0cc4d44c3f341f9aULL,
+		0x308217980608d63cULL, 0x646b6e0a5ad82731ULL, 0x9950e4bcbfa93426ULL, 0xcdb99d2ee379c52bULL,
+		0x90fb71cad654a0f5ULL, 0xc41208588a8451f8ULL, 0x392982ee6ff542efULL, 0x6dc0fb7c3325b3e2ULL,
+		0x518638a80a197a44ULL, 0x056f413a56c98b49ULL, 0xf854cb8cb3b8985eULL, 0xacbdb21eef686953ULL,
+		0x80d94c24c1c10b12ULL, 0xd43035b69d11fa1fULL, 0x290bbf007860e908ULL, 0x7de2c69224b01805ULL,
+		0x41a405461d8cd1a3ULL, 0x154d7cd4415c20aeULL, 0xe876f662a42d33b9ULL, 0xbc9f8ff0f8fdc2b4ULL,
+		0xb0bf0a16f97ff73bULL, 0xe4567384a5af0636ULL, 0x196df93240de1521ULL, 0x4d8480a01c0ee42cULL,
+		0x71c2437425322d8aULL, 0x252b3ae679e2dc87ULL, 0xd810b0509c93cf90ULL, 0x8cf9c9c2c0433e9dULL,
+		0xa09d37f8eeea5cdcULL, 0xf4744e6ab23aadd1ULL, 0x094fc4dc574bbec6ULL, 0x5da6bd4e0b9b4fcbULL,
+		0x61e07e9a32a7866dULL, 0x350907086e777760ULL, 0xc8328dbe8b066477ULL, 0x9cdbf42cd7d6957aULL,
+		0xd073867288020f69ULL, 0x849affe0d4d2fe64ULL, 0x79a1755631a3ed73ULL, 0x2d480cc46d731c7eULL,
+		0x110ecf10544fd5d8ULL, 0x45e7b682089f24d5ULL, 0xb8dc3c34edee37c2ULL, 0xec3545a6b13ec6cfULL,
+		0xc051bb9c9f97a48eULL, 0x94b8c20ec3475583ULL, 0x698348b826364694ULL, 0x3d6a312a7ae6b799ULL,
+		0x012cf2fe43da7e3fULL, 0x55c58b6c1f0a8f32ULL, 0xa8fe01dafa7b9c25ULL, 0xfc177848a6ab6d28ULL,
+		0xf037fdaea72958a7ULL, 0xa4de843cfbf9a9aaULL, 0x59e50e8a1e88babdULL, 0x0d0c771842584bb0ULL,
+		0x314ab4cc7b648216ULL, 0x65a3cd5e27b4731bULL, 0x989847e8c2c5600cULL, 0xcc713e7a9e159101ULL,
+		0xe015c040b0bcf340ULL, 0xb4fcb9d2ec6c024dULL, 0x49c73364091d115aULL, 0x1d2e4af655cde057ULL,
+		0x216889226cf129f1ULL, 0x7581f0b03021d8fcULL, 0x88ba7a06d550cbebULL, 0xdc53039489803ae6ULL,
+		0x11ea9eba6af9ffcdULL, 0x4503e72836290ec0ULL, 0xb8386d9ed3581dd7ULL, 0xecd1140c8f88ecdaULL,
+		0xd097d7d8b6b4257cULL, 0x847eae4aea64d471ULL, 0x794524fc0f15c766ULL, 0x2dac5d6e53c5366bULL,
+		0x01c8a3547d6c542aULL, 0x5521dac621bca527ULL, 0xa81a5070c4cdb630ULL, 0xfcf329e2981d473dULL,
+		0xc0b5ea36a1218e9bULL, 0x945c93a4fdf17f96ULL, 0x6967191218806c81ULL, 0x3d8e608044509d8cULL,
+		0x31aee56645d2a803ULL, 0x65479cf41902590eULL, 0x987c1642fc734a19ULL, 0xcc956fd0a0a3bb14ULL,
+		0xf0d3ac04999f72b2ULL, 0xa43ad596c54f83bfULL, 0x59015f20203e90a8ULL, 0x0de826b27cee61a5ULL,
+		0x218cd888524703e4ULL, 0x7565a11a0e97f2e9ULL, 0x885e2bacebe6e1feULL, 0xdcb7523eb73610f3ULL,
+		0xe0f191ea8e0ad955ULL, 0xb418e878d2da2858ULL, 0x492362ce37ab3b4fULL, 0x1dca1b5c6b7bca42ULL,
+		0x5162690234af5051ULL, 0x058b1090687fa15cULL, 0xf8b09a268d0eb24bULL, 0xac59e3b4d1de4346ULL,
+		0x901f2060e8e28ae0ULL, 0xc4f659f2b4327bedULL, 0x39cdd344514368faULL, 0x6d24aad60d9399f7ULL,
+		0x414054ec233afbb6ULL, 0x15a92d7e7fea0abbULL, 0xe892a7c89a9b19acULL, 0xbc7bde5ac64be8a1ULL,
+		0x803d1d8eff772107ULL, 0xd4d4641ca3a7d00aULL, 0x29efeeaa46d6c31dULL, 0x7d0697381a063210ULL,
+		0x712612de1b84079fULL, 0x25cf6b4c4754f692ULL, 0xd8f4e1faa225e585ULL, 0x8c1d9868fef51488ULL,
+		0xb05b5bbcc7c9dd2eULL, 0xe4b2222e9b192c23ULL, 0x1989a8987e683f34ULL, 0x4d60d10a22b8ce39ULL,
+		0x61042f300c11ac78ULL, 0x35ed56a250c15d75ULL, 0xc8d6dc14b5b04e62ULL, 0x9c3fa586e960bf6fULL,
+		0xa0796652d05c76c9ULL, 0xf4901fc08c8c87c4ULL, 0x09ab957669fd94d3ULL, 0x5d42ece4352d65deULL
+	},
+	{
+		0x0000000000000000ULL, 0x3f0be14a916a6dcbULL, 0x7e17c29522d4db96ULL, 0x411c23dfb3beb65dULL,
+		0xfc2f852a45a9b72cULL, 0xc3246460d4c3dae7ULL, 0x823847bf677d6cbaULL, 0xbd33a6f5f6170171ULL,
+		0x6a87a57f245d70ddULL, 0x558c4435b5371d16ULL, 0x149067ea0689ab4bULL, 0x2b9b86a097e3c680ULL,
+		0x96a8205561f4c7f1ULL, 0xa9a3c11ff09eaa3aULL, 0xe8bfe2c043201c67ULL, 0xd7b4038ad24a71acULL,
+		0xd50f4afe48bae1baULL, 0xea04abb4d9d08c71ULL, 0xab18886b6a6e3a2cULL, 0x94136921fb0457e7ULL,
+		0x2920cfd40d135696ULL, 0x162b2e9e9c793b5dULL, 0x57370d412fc78d00ULL, 0x683cec0bbeade0cbULL,
+		0xbf88ef816ce79167ULL, 0x80830ecbfd8dfcacULL, 0xc19f2d144e334af1ULL, 0xfe94cc5edf59273aULL,
+		0x43a76aab294e264bULL, 0x7cac8be1b8244b80ULL, 0x3db0a83e0b9afdddULL, 0x02bb49749af09016ULL,
+		0x38c63ad73e7bddf1ULL, 0x07cddb9daf11b03aULL, 0x46d1f8421caf0667ULL, 0x79da19088dc56bacULL,
+		0xc4e9bffd7bd26addULL, 0xfbe25eb7eab80716ULL, 0xbafe7d685906b14bULL, 0x85f59c22c86cdc80ULL,
+		0x52419fa81a26ad2cULL, 0x6d4a7ee28b4cc0e7ULL, 0x2c565d3d38f276baULL, 0x135dbc77a9981b71ULL,
+		0xae6e1a825f8f1a00ULL, 0x9165fbc8cee577cbULL, 0xd079d8177d5bc196ULL, 0xef72395dec31ac5dULL,
+		0xedc9702976c13c4bULL, 0xd2c29163e7ab5180ULL, 0x93deb2bc5415e7ddULL, 0xacd553f6c57f8a16ULL,
+		0x11e6f50333688b67ULL, 0x2eed1449a202e6acULL, 0x6ff1379611bc50f1ULL, 0x50fad6dc80d63d3aULL,
+		0x874ed556529c4c96ULL, 0xb845341cc3f6215dULL, 0xf95917c370489700ULL, 0xc652f689e122facbULL,
+		0x7b61507c1735fbbaULL, 0x446ab136865f9671ULL, 0x057692e935e1202cULL, 0x3a7d73a3a48b4de7ULL,
+		0x718c75ae7cf7bbe2ULL, 0x4e8794e4ed9dd629ULL, 0x0f9bb73b5e236074ULL, 0x30905671cf490dbfULL,
+		0x8da3f084395e0cceULL, 0xb2a811cea8346105ULL, 0xf3b432111b8ad758ULL, 0xccbfd35b8ae0ba93ULL,
+		0x1b0bd0d158aacb3fULL, 0x2400319bc9c0a6f4ULL, 0x651c12447a7e10a9ULL, 0x5a17f30eeb147d62ULL,
+		0xe72455fb1d037c13ULL, 0xd82fb4b18c6911d8ULL, 0x9933976e3fd7a785ULL, 0xa6387624aebdca4eULL,
+		0xa4833f50344d5a58ULL, 0x9b88de1aa5273793ULL, 0xda94fdc5169981ceULL, 0xe59f1c8f87f3ec05ULL,
+		0x58acba7a71e4ed74ULL, 0x67a75b30e08e80bfULL, 0x26bb78ef533036e2ULL, 0x19b099a5c25a5b29ULL,
+		0xce049a2f10102a85ULL, 0xf10f7b65817a474eULL, 0xb01358ba32c4f113ULL, 0x8f18b9f0a3ae9cd8ULL,
+		0x322b1f0555b99da9ULL, 0x0d20fe4fc4d3f062ULL, 0x4c3cdd90776d463fULL, 0x73373cdae6072bf4ULL,
+		0x494a4f79428c6613ULL, 0x7641ae33d3e60bd8ULL, 0x375d8dec6058bd85ULL, 0x08566ca6f132d04eULL,
+		0xb565ca530725d13fULL, 0x8a6e2b19964fbcf4ULL, 0xcb7208c625f10aa9ULL, 0xf479e98cb49b6762ULL,
+		0x23cdea0666d116ceULL, 0x1cc60b4cf7bb7b05ULL, 0x5dda28934405cd58ULL, 0x62d1c9d9d56fa093ULL,
+		0xdfe26f2c2378a1e2ULL, 0xe0e98e66b212cc29ULL, 0xa1f5adb901ac7a74ULL, 0x9efe4cf390c617bfULL,
+		0x9c4505870a3687a9ULL, 0xa34ee4cd9b5cea62ULL, 0xe252c71228e25c3fULL, 0xdd592658b98831f4ULL,
+		0x606a80ad4f9f3085ULL, 0x5f6161e7def55d4eULL, 0x1e7d42386d4beb13ULL, 0x2176a372fc2186d8ULL,
+		0xf6c2a0f82e6bf774ULL, 0xc9c941b2bf019abfULL, 0x88d5626d0cbf2ce2ULL, 0xb7de83279dd54129ULL,
+		0x0aed25d26bc24058ULL, 0x35e6c498faa82d93ULL, 0x74fae74749169bceULL, 0x4bf1060dd87cf605ULL,
+		0xe318eb5cf9ef77c4ULL, 0xdc130a1668851a0fULL, 0x9d0f29c9db3bac52ULL, 0xa204c8834a51c199ULL,
+		0x1f376e76bc46c0e8ULL, 0x203c8f3c2d2cad23ULL, 0x6120ace39e921b7eULL, 0x5e2b4da90ff876b5ULL,
+		0x899f4e23ddb20719ULL, 0xb694af694cd86ad2ULL, 0xf7888cb6ff66dc8fULL, 0xc8836dfc6e0cb144ULL,
+		0x75b0cb09981bb035ULL, 0x4abb2a430971ddfeULL, 0x0ba7099cbacf6ba3ULL, 0x34ace8d62ba50668ULL,
+		0x3617a1a2b155967eULL, 0x091c40e8203ffbb5ULL, 0x4800633793814de8ULL, 0x770b827d02eb2023ULL,
+		0xca382488f4fc2152ULL, 0xf533c5c265964c99ULL, 0xb42fe61dd628fac4ULL, 0x8b2407574742970fULL,
+		0x5c9004dd9508e6a3ULL, 0x639be59704628b68ULL, 0x2287c648b7dc3d35ULL, 0x1d8c270226b650feULL,
+		0xa0bf81f7d0a1518fULL, 0x9fb460bd41cb3c44ULL, 0xdea84362f2758a19ULL, 0xe1a3a228631fe7d2ULL,
+		0xdbded18bc794aa35ULL, 0xe4d530c156fec7feULL, 0xa5c9131ee54071a3ULL, 0x9ac2f254742a1c68ULL,
+		0x27f154a1823d1d19ULL, 0x18fab5eb135770d2ULL, 0x59e69634a0e9c68fULL, 0x66ed777e3183ab44ULL,
+		0xb15974f4e3c9dae8ULL, 0x8e5295be72a3b723ULL, 0xcf4eb661c11d017eULL, 0xf045572b50776cb5ULL,
+		0x4d76f1dea6606dc4ULL, 0x727d1094370a000fULL, 0x3361334b84b4b652ULL, 0x0c6ad20115dedb99ULL,
+		0x0ed19b758f2e4b8fULL, 0x31da7a3f1e442644ULL, 0x70c659e0adfa9019ULL, 0x4fcdb8aa3c90fdd2ULL,
+		0xf2fe1e5fca87fca3ULL, 0xcdf5ff155bed9168ULL, 0x8ce9dccae8532735ULL, 0xb3e23d8079394afeULL,
+		0x64563e0aab733b52ULL, 0x5b5ddf403a195699ULL, 0x1a41fc9f89a7e0c4ULL, 0x254a1dd518cd8d0fULL,
+		0x9879bb20eeda8c7eULL, 0xa7725a6a7fb0e1b5ULL, 0xe66e79b5cc0e57e8ULL, 0xd96598ff5d643a23ULL,
+		0x92949ef28518cc26ULL, 0xad9f7fb81472a1edULL, 0xec835c67a7cc17b0ULL, 0xd388bd2d36a67a7bULL,
+		0x6ebb1bd8c0b17b0aULL, 0x51b0fa9251db16c1ULL, 0x10acd94de265a09cULL, 0x2fa73807730fcd57ULL,
+		0xf8133b8da145bcfbULL, 0xc718dac7302fd130ULL, 0x8604f9188391676dULL, 0xb90f185212fb0aa6ULL,
+		0x043cbea7e4ec0bd7ULL, 0x3b375fed7586661cULL, 0x7a2b7c32c638d041ULL, 0x45209d785752bd8aULL,
+		0x479bd40ccda22d9cULL, 0x789035465cc84057ULL, 0x398c1699ef76f60aULL, 0x0687f7d37e1c9bc1ULL,
+		0xbbb45126880b9ab0ULL, 0x84bfb06c1961f77bULL, 0xc5a393b3aadf4126ULL, 0xfaa872f93bb52cedULL,
+		0x2d1c7173e9ff5d41ULL, 0x121790397895308aULL, 0x530bb3e6cb2b86d7ULL, 0x6c0052ac5a41eb1cULL,
+		0xd133f459ac56ea6dULL, 0xee3815133d3c87a6ULL, 0xaf2436cc8e8231fbULL, 0x902fd7861fe85c30ULL,
+		0xaa52a425bb6311d7ULL, 0x9559456f2a097c1cULL, 0xd44566b099b7ca41ULL, 0xeb4e87fa08dda78aULL,
+		0x567d210ffecaa6fbULL, 0x6976c0456fa0cb30ULL, 0x286ae39adc1e7d6dULL, 0x176102d04d7410a6ULL,
+		0xc0d5015a9f3e610aULL, 0xffdee0100e540cc1ULL, 0xbec2c3cfbdeaba9cULL, 0x81c922852c80d757ULL,
+		0x3cfa8470da97d626ULL, 0x03f1653a4bfdbbedULL, 0x42ed46e5f8430db0ULL, 0x7de6a7af6929607bULL,
+		0x7f5deedbf3d9f06dULL, 0x40560f9162b39da6ULL, 0x014a2c4ed10d2bfbULL, 0x3e41cd0440674630ULL,
+		0x83726bf1b6704741ULL, 0xbc798abb271a2a8aULL, 0xfd65a96494a49cd7ULL, 0xc26e482e05cef11cULL,
+		0x15da4ba4d78480b0ULL, 0x2ad1aaee46eeed7bULL, 0x6bcd8931f5505b26ULL, 0x54c6687b643a36edULL,
+		0xe9f5ce8e922d379cULL, 0xd6fe2fc403475a57ULL, 0x97e20c1bb0f9ec0aULL, 0xa8e9ed51219381c1ULL
+	},
+	{
+		0x0000000000000000ULL, 0x1dee8a5e222ca1dcULL, 0x3bdd14bc445943b8ULL, 0x26339ee26675e264ULL,
+		0x77ba297888b28770ULL, 0x6a54a326aa9e26acULL, 0x4c673dc4ccebc4c8ULL, 0x5189b79aeec76514ULL,
+		0xef7452f111650ee0ULL, 0xf29ad8af3349af3cULL, 0xd4a9464d553c4d58ULL, 0xc947cc137710ec84ULL,
+		0x98ce7b8999d78990ULL, 0x8520f1d7bbfb284cULL, 0xa3136f35dd8eca28ULL, 0xbefde56bffa26bf4ULL,
+		0x4c300ac98dc40345ULL, 0x51de8097afe8a299ULL, 0x77ed1e75c99d40fdULL, 0x6a03942bebb1e121ULL,
+		0x3b8a23b105768435ULL, 0x2664a9ef275a25e9ULL, 0x0057370d412fc78dULL, 0x1db9bd5363036651ULL,
+		0xa34458389ca10da5ULL, 0xbeaad266be8dac79ULL, 0x98994c84d8f84e1dULL, 0x8577c6dafad4efc1ULL,
+		0xd4fe714014138ad5ULL, 0xc910fb1e363f2b09ULL, 0xef2365fc504ac96dULL, 0xf2cdefa2726668b1ULL,
+		0x986015931b88068aULL, 0x858e9fcd39a4a756ULL, 0xa3bd012f5fd14532ULL, 0xbe538b717dfde4eeULL,
+		0xefda3ceb933a81faULL, 0xf234b6b5b1162026ULL, 0xd4072857d763c242ULL, 0xc9e9a209f54f639eULL,
+		0x771447620aed086aULL, 0x6afacd3c28c1a9b6ULL, 0x4cc953de4eb44bd2ULL, 0x5127d9806c98ea0eULL,
+		0x00ae6e1a825f8f1aULL, 0x1d40e444a0732ec6ULL, 0x3b737aa6c606cca2ULL, 0x269df0f8e42a6d7eULL,
+		0xd4501f5a964c05cfULL, 0xc9be9504b460a413ULL, 0xef8d0be6d2154677ULL, 0xf26381b8f039e7abULL,
+		0xa3ea36221efe82bfULL, 0xbe04bc7c3cd22363ULL, 0x9837229e5aa7c107ULL, 0x85d9a8c0788b60dbULL,
+		0x3b244dab87290b2fULL, 0x26cac7f5a505aaf3ULL, 0x00f95917c3704897ULL, 0x1d17d349e15ce94bULL,
+		0x4c9e64d30f9b8c5fULL, 0x5170ee8d2db72d83ULL, 0x7743706f4bc2cfe7ULL, 0x6aadfa3169ee6e3bULL,
+		0xa218840d981e1391ULL, 0xbff60e53ba32b24dULL, 0x99c590b1dc475029ULL, 0x842b1aeffe6bf1f5ULL,
+		0xd5a2ad7510ac94e1ULL, 0xc84c272b3280353dULL, 0xee7fb9c954f5d759ULL, 0xf391339776d97685ULL,
+		0x4d6cd6fc897b1d71ULL, 0x50825ca2ab57bcadULL, 0x76b1c240cd225ec9ULL, 0x6b5f481eef0eff15ULL,
+		0x3ad6ff8401c99a01ULL, 0x273875da23e53bddULL, 0x010beb384590d9b9ULL, 0x1ce5616667bc7865ULL,
+		0xee288ec415da10d4ULL, 0xf3c6049a37f6b108ULL, 0xd5f59a785183536cULL, 0xc81b102673aff2b0ULL,
+		0x9992a7bc9d6897a4ULL, 0x847c2de2bf443678ULL, 0xa24fb300d931d41cULL, 0xbfa1395efb1d75c0ULL,
+		0x015cdc3504bf1e34ULL, 0x1cb2566b2693bfe8ULL, 0x3a81c88940e65d8cULL, 0x276f42d762cafc50ULL,
+		0x76e6f54d8c0d9944ULL, 0x6b087f13ae213898ULL, 0x4d3be1f1c854dafcULL, 0x50d56bafea787b20ULL,
+		0x3a78919e8396151bULL, 0x27961bc0a1bab4c7ULL, 0x01a58522c7cf56a3ULL, 0x1c4b0f7ce5e3f77fULL,
+		0x4dc2b8e60b24926bULL, 0x502c32b8290833b7ULL, 0x761fac5a4f7dd1d3ULL, 0x6bf126046d51700fULL,
+		0xd50cc36f92f31bfbULL, 0xc8e24931b0dfba27ULL, 0xeed1d7d3d6aa5843ULL, 0xf33f5d8df486f99fULL,
+		0xa2b6ea171a419c8bULL, 0xbf586049386d3d57ULL, 0x996bfeab5e18df33ULL, 0x848574f57c347eefULL,
+		0x76489b570e52165eULL, 0x6ba611092c7eb782ULL, 0x4d958feb4a0b55e6ULL, 0x507b05b56827f43aULL,
+		0x01f2b22f86e0912eULL, 0x1c1c3871a4cc30f2ULL, 0x3a2fa693c2b9d296ULL, 0x27c12ccde095734aULL,
+		0x993cc9a61f3718beULL, 0x84d243f83d1bb962ULL, 0xa2e1dd1a5b6e5b06ULL, 0xbf0f57447942fadaULL,
+		0xee86e0de97859fceULL, 0xf3686a80b5a93e12ULL, 0xd55bf462d3dcdc76ULL, 0xc8b57e3cf1f07daaULL,
+		0xd6e9a7309f3239a7ULL, 0xcb072d6ebd1e987bULL, 0xed34b38cdb6b7a1fULL, 0xf0da39d2f947dbc3ULL,
+		0xa1538e481780bed7ULL, 0xbcbd041635ac1f0bULL, 0x9a8e9af453d9fd6fULL, 0x876010aa71f55cb3ULL,
+		0x399df5c18e573747ULL, 0x24737f9fac7b969bULL, 0x0240e17dca0e74ffULL, 0x1fae6b23e822d523ULL,
+		0x4e27dcb906e5b037ULL, 0x53c956e724c911ebULL, 0x75fac80542bcf38fULL, 0x6814425b60905253ULL,
+		0x9ad9adf912f63ae2ULL, 0x873727a730da9b3eULL, 0xa104b94556af795aULL, 0xbcea331b7483d886ULL,
+		0xed6384819a44bd92ULL, 0xf08d0edfb8681c4eULL, 0xd6be903dde1dfe2aULL, 0xcb501a63fc315ff6ULL,
+		0x75adff0803933402ULL, 0x6843755621bf95deULL, 0x4e70ebb447ca77baULL, 0x539e61ea65e6d666ULL,
+		0x0217d6708b21b372ULL, 0x1ff95c2ea90d12aeULL, 0x39cac2cccf78f0caULL, 0x24244892ed545116ULL,
+		0x4e89b2a384ba3f2dULL, 0x536738fda6969ef1ULL, 0x7554a61fc0e37c95ULL, 0x68ba2c41e2cfdd49ULL,
+		0x39339bdb0c08b85dULL, 0x24dd11852e241981ULL, 0x02ee8f674851fbe5ULL, 0x1f0005396a7d5a39ULL,
+		0xa1fde05295df31cdULL, 0xbc136a0cb7f39011ULL, 0x9a20f4eed1867275ULL, 0x87ce7eb0f3aad3a9ULL,
+		0xd647c92a1d6db6bdULL, 0xcba943743f411761ULL, 0xed9add965934f505ULL, 0xf07457c87b1854d9ULL,
+		0x02b9b86a097e3c68ULL, 0x1f5732342b529db4ULL, 0x3964acd64d277fd0ULL, 0x248a26886f0bde0cULL,
+		0x7503911281ccbb18ULL, 0x68ed1b4ca3e01ac4ULL, 0x4ede85aec595f8a0ULL, 0x53300ff0e7b9597cULL,
+		0xedcdea9b181b3288ULL, 0xf02360c53a379354ULL, 0xd610fe275c427130ULL, 0xcbfe74797e6ed0ecULL,
+		0x9a77c3e390a9b5f8ULL, 0x879949bdb2851424ULL, 0xa1aad75fd4f0f640ULL, 0xbc445d01f6dc579cULL,
+		0x74f1233d072c2a36ULL, 0x691fa96325008beaULL, 0x4f2c37814375698eULL, 0x52c2bddf6159c852ULL,
+		0x034b0a458f9ead46ULL, 0x1ea5801badb20c9aULL, 0x38961ef9cbc7eefeULL, 0x257894a7e9eb4f22ULL,
+		0x9b8571cc164924d6ULL, 0x866bfb923465850aULL, 0xa05865705210676eULL, 0xbdb6ef2e703cc6b2ULL,
+		0xec3f58b49efba3a6ULL, 0xf1d1d2eabcd7027aULL, 0xd7e24c08daa2e01eULL, 0xca0cc656f88e41c2ULL,
+		0x38c129f48ae82973ULL, 0x252fa3aaa8c488afULL, 0x031c3d48ceb16acbULL, 0x1ef2b716ec9dcb17ULL,
+		0x4f7b008c025aae03ULL, 0x52958ad220760fdfULL, 0x74a614304603edbbULL, 0x69489e6e642f4c67ULL,
+		0xd7b57b059b8d2793ULL, 0xca5bf15bb9a1864fULL, 0xec686fb9dfd4642bULL, 0xf186e5e7fdf8c5f7ULL,
+		0xa00f527d133fa0e3ULL, 0xbde1d8233113013fULL, 0x9bd246c15766e35bULL, 0x863ccc9f754a4287ULL,
+		0xec9136ae1ca42cbcULL, 0xf17fbcf03e888d60ULL, 0xd74c221258fd6f04ULL, 0xcaa2a84c7ad1ced8ULL,
+		0x9b2b1fd69416abccULL, 0x86c59588b63a0a10ULL, 0xa0f60b6ad04fe874ULL, 0xbd188134f26349a8ULL,
+		0x03e5645f0dc1225cULL, 0x1e0bee012fed8380ULL, 0x383870e3499861e4ULL, 0x25d6fabd6bb4c038ULL,
+		0x745f4d278573a52cULL, 0x69b1c779a75f04f0ULL, 0x4f82599bc12ae694ULL, 0x526cd3c5e3064748ULL,
+		0xa0a13c6791602ff9ULL, 0xbd4fb639b34c8e25ULL, 0x9b7c28dbd5396c41ULL, 0x8692a285f715cd9dULL,
+		0xd71b151f19d2a889ULL, 0xcaf59f413bfe0955ULL, 0xecc601a35d8beb31ULL, 0xf1288bfd7fa74aedULL,
+		0x4fd56e9680052119ULL, 0x523be4c8a22980c5ULL, 0x74087a2ac45c62a1ULL, 0x69e6f074e670c37dULL,
+		0x386f47ee08b7a669ULL, 0x2581cdb02a9b07b5ULL, 0x03b253524ceee5d1ULL, 0x1e5cd90c6ec2440dULL
+	},
+	{
+		0x0000000000000000ULL, 0x5c2d776033c4205eULL, 0xb85aeec0678840bcULL, 0xe47799a0544c60e2ULL,
+		0xe26d72ab601e9ffdULL, 0xbe4005cb53dabfa3ULL, 0x5a379c6b0796df41ULL, 0x061aeb0b3452ff1fULL,
+		0x56024a7d6f33217fULL, 0x0a2f3d1d5cf70121ULL, 0xee58a4bd08bb61c3ULL, 0xb275d3dd3b7f419dULL,
+		0xb46f38d60f2dbe82ULL, 0xe8424fb63ce99edcULL, 0x0c35d61668a5fe3eULL, 0x5018a1765b61de60ULL,
+		0xac0494fade6642feULL, 0xf029e39aeda262a0ULL, 0x145e7a3ab9ee0242ULL, 0x48730d5a8a2a221cULL,
+		0x4e69e651be78dd03ULL, 0x124491318dbcfd5dULL, 0xf6330891d9f09dbfULL, 0xaa1e7ff1ea34bde1ULL,
+		0xfa06de87b1556381ULL, 0xa62ba9e7829143dfULL, 0x425c3047d6dd233dULL, 0x1e714727e5190363ULL,
+		0x186bac2cd14bfc7cULL, 0x4446db4ce28fdc22ULL, 0xa03142ecb6c3bcc0ULL, 0xfc1c358c85079c9eULL,
+		0xcad186de13c29b79ULL, 0x96fcf1be2006bb27ULL, 0x728b681e744adbc5ULL, 0x2ea61f7e478efb9bULL,
+		0x28bcf47573dc0484ULL, 0x74918315401824daULL, 0x90e61ab514544438ULL, 0xcccb6dd527906466ULL,
+		0x9cd3cca37cf1ba06ULL, 0xc0febbc34f359a58ULL, 0x248922631b79fabaULL, 0x78a4550328bddae4ULL,
+		0x7ebebe081cef25fbULL, 0x2293c9682f2b05a5ULL, 0xc6e450c87b676547ULL, 0x9ac927a848a34519ULL,
+		0x66d51224cda4d987ULL, 0x3af86544fe60f9d9ULL, 0xde8ffce4aa2c993bULL, 0x82a28b8499e8b965ULL,
+		0x84b8608fadba467aULL, 0xd89517ef9e7e6624ULL, 0x3ce28e4fca3206c6ULL, 0x60cff92ff9f62698ULL,
+		0x30d75859a297f8f8ULL, 0x6cfa2f399153d8a6ULL, 0x888db699c51fb844ULL, 0xd4a0c1f9f6db981aULL,
+		0xd2ba2af2c2896705ULL, 0x8e975d92f14d475bULL, 0x6ae0c432a50127b9ULL, 0x36cdb35296c507e7ULL,
+		0x077ba297888b2877ULL, 0x5b56d5f7bb4f0829ULL, 0xbf214c57ef0368cbULL, 0xe30c3b37dcc74895ULL,
+		0xe516d03ce895b78aULL, 0xb93ba75cdb5197d4ULL, 0x5d4c3efc8f1df736ULL, 0x0161499cbcd9d768ULL,
+		0x5179e8eae7b80908ULL, 0x0d549f8ad47c2956ULL, 0xe923062a803049b4ULL, 0xb50e714ab3f469eaULL,
+		0xb3149a4187a696f5ULL, 0xef39ed21b462b6abULL, 0x0b4e7481e02ed649ULL, 0x576303e1d3eaf617ULL,
+		0xab7f366d56ed6a89ULL, 0xf752410d65294ad7ULL, 0x1325d8ad31652a35ULL, 0x4f08afcd02a10a6bULL,
+		0x491244c636f3f574ULL, 0x153f33a60537d52aULL, 0xf148aa06517bb5c8ULL, 0xad65dd6662bf9596ULL,
+		0xfd7d7c1039de4bf6ULL, 0xa1500b700a1a6ba8ULL, 0x452792d05e560b4aULL, 0x190ae5b06d922b14ULL,
+		0x1f100ebb59c0d40bULL, 0x433d79db6a04f455ULL, 0xa74ae07b3e4894b7ULL, 0xfb67971b0d8cb4e9ULL,
+		0xcdaa24499b49b30eULL, 0x91875329a88d9350ULL, 0x75f0ca89fcc1f3b2ULL, 0x29ddbde9cf05d3ecULL,
+		0x2fc756e2fb572cf3ULL, 0x73ea2182c8930cadULL, 0x979db8229cdf6c4fULL, 0xcbb0cf42af1b4c11ULL,
+		0x9ba86e34f47a9271ULL, 0xc7851954c7beb22fULL, 0x23f280f493f2d2cdULL, 0x7fdff794a036f293ULL,
+		0x79c51c9f94640d8cULL, 0x25e86bffa7a02dd2ULL, 0xc19ff25ff3ec4d30ULL, 0x9db2853fc0286d6eULL,
+		0x61aeb0b3452ff1f0ULL, 0x3d83c7d376ebd1aeULL, 0xd9f45e7322a7b14cULL, 0x85d9291311639112ULL,
+		0x83c3c21825316e0dULL, 0xdfeeb57816f54e53ULL, 0x3b992cd842b92eb1ULL, 0x67b45bb8717d0eefULL,
+		0x37acface2a1cd08fULL, 0x6b818dae19d8f0d1ULL, 0x8ff6140e4d949033ULL, 0xd3db636e7e50b06dULL,
+		0xd5c188654a024f72ULL, 0x89ecff0579c66f2cULL, 0x6d9b66a52d8a0fceULL, 0x31b611c51e4e2f90ULL,
+		0x0ef7452f111650eeULL, 0x52da324f22d270b0ULL, 0xb6adabef769e1052ULL, 0xea80dc8f455a300cULL,
+		0xec9a37847108cf13ULL, 0xb0b740e442ccef4dULL, 0x54c0d94416808fafULL, 0x08edae242544aff1ULL,
+		0x58f50f527e257191ULL, 0x04d878324de151cfULL, 0xe0afe19219ad312dULL, 0xbc8296f22a691173ULL,
+		0xba987df91e3bee6cULL, 0xe6b50a992dffce32ULL, 0x02c2933979b3aed0ULL, 0x5eefe4594a778e8eULL,
+		0xa2f3d1d5cf701210ULL, 0xfedea6b5fcb4324eULL, 0x1aa93f15a8f852acULL, 0x468448759b3c72f2ULL,
+		0x409ea37eaf6e8dedULL, 0x1cb3d41e9caaadb3ULL, 0xf8c44dbec8e6cd51ULL, 0xa4e93adefb22ed0fULL,
+		0xf4f19ba8a043336fULL, 0xa8dcecc893871331ULL, 0x4cab7568c7cb73d3ULL, 0x10860208f40f538dULL,
+		0x169ce903c05dac92ULL, 0x4ab19e63f3998cccULL, 0xaec607c3a7d5ec2eULL, 0xf2eb70a39411cc70ULL,
+		0xc426c3f102d4cb97ULL, 0x980bb4913110ebc9ULL, 0x7c7c2d31655c8b2bULL, 0x20515a515698ab75ULL,
+		0x264bb15a62ca546aULL, 0x7a66c63a510e7434ULL, 0x9e115f9a054214d6ULL, 0xc23c28fa36863488ULL,
+		0x9224898c6de7eae8ULL, 0xce09feec5e23cab6ULL, 0x2a7e674c0a6faa54ULL, 0x7653102c39ab8a0aULL,
+		0x7049fb270df97515ULL, 0x2c648c473e3d554bULL, 0xc81315e76a7135a9ULL, 0x943e628759b515f7ULL,
+		0x6822570bdcb28969ULL, 0x340f206bef76a937ULL, 0xd078b9cbbb3ac9d5ULL, 0x8c55ceab88fee98bULL,
+		0x8a4f25a0bcac1694ULL, 0xd66252c08f6836caULL, 0x3215cb60db245628ULL, 0x6e38bc00e8e07676ULL,
+		0x3e201d76b381a816ULL, 0x620d6a1680458848ULL, 0x867af3b6d409e8aaULL, 0xda5784d6e7cdc8f4ULL,
+		0xdc4d6fddd39f37ebULL, 0x806018bde05b17b5ULL, 0x6417811db4177757ULL, 0x383af67d87d35709ULL,
+		0x098ce7b8999d7899ULL, 0x55a190d8aa5958c7ULL, 0xb1d60978fe153825ULL, 0xedfb7e18cdd1187bULL,
+		0xebe19513f983e764ULL, 0xb7cce273ca47c73aULL, 0x53bb7bd39e0ba7d8ULL, 0x0f960cb3adcf8786ULL,
+		0x5f8eadc5f6ae59e6ULL, 0x03a3daa5c56a79b8ULL, 0xe7d443059126195aULL, 0xbbf93465a2e23904ULL,
+		0xbde3df6e96b0c61bULL, 0xe1cea80ea574e645ULL, 0x05b931aef13886a7ULL, 0x599446cec2fca6f9ULL,
+		0xa588734247fb3a67ULL, 0xf9a50422743f1a39ULL, 0x1dd29d8220737adbULL, 0x41ffeae213b75a85ULL,
+		0x47e501e927e5a59aULL, 0x1bc87689142185c4ULL, 0xffbfef29406de526ULL, 0xa392984973a9c578ULL,
+		0xf38a393f28c81b18ULL, 0xafa74e5f1b0c3b46ULL, 0x4bd0d7ff4f405ba4ULL, 0x17fda09f7c847bfaULL,
+		0x11e74b9448d684e5ULL, 0x4dca3cf47b12a4bbULL, 0xa9bda5542f5ec459ULL, 0xf590d2341c9ae407ULL,
+		0xc35d61668a5fe3e0ULL, 0x9f701606b99bc3beULL, 0x7b078fa6edd7a35cULL, 0x272af8c6de138302ULL,
+		0x213013cdea417c1dULL, 0x7d1d64add9855c43ULL, 0x996afd0d8dc93ca1ULL, 0xc5478a6dbe0d1cffULL,
+		0x955f2b1be56cc29fULL, 0xc9725c7bd6a8e2c1ULL, 0x2d05c5db82e48223ULL, 0x7128b2bbb120a27dULL,
+		0x773259b085725d62ULL, 0x2b1f2ed0b6b67d3cULL, 0xcf68b770e2fa1ddeULL, 0x9345c010d13e3d80ULL,
+		0x6f59f59c5439a11eULL, 0x337482fc67fd8140ULL, 0xd7031b5c33b1e1a2ULL, 0x8b2e6c3c0075c1fcULL,
+		0x8d34873734273ee3ULL, 0xd119f05707e31ebdULL, 0x356e69f753af7e5fULL, 0x69431e97606b5e01ULL,
+		0x395bbfe13b0a8061ULL, 0x6576c88108cea03fULL, 0x810151215c82c0ddULL, 0xdd2c26416f46e083ULL,
+		0xdb36cd4a5b141f9cULL, 0x871bba2a68d03fc2ULL, 0x636c238a3c9c5f20ULL, 0x3f4154ea0f587f7eULL
+	},
+	{
+		0x0000000000000000ULL, 0x6184d55f721267c6ULL, 0xc309aabee424cf8cULL, 0xa28d7fe19636a84aULL,
+		0x14cbfa566747819dULL, 0x754f2f091555e65bULL, 0xd7c250e883634e11ULL, 0xb64685b7f17129d7ULL,
+		0x2997f4acce8f033aULL, 0x481321f3bc9d64fcULL, 0xea9e5e122aabccb6ULL, 0x8b1a8b4d58b9ab70ULL,
+		0x3d5c0efaa9c882a7ULL, 0x5cd8dba5dbdae561ULL, 0xfe55a4444dec4d2bULL, 0x9fd1711b3ffe2aedULL,
+		0x532fe9599d1e0674ULL, 0x32ab3c06ef0c61b2ULL, 0x902643e7793ac9f8ULL, 0xf1a296b80b28ae3eULL,
+		0x47e4130ffa5987e9ULL, 0x2660c650884be02fULL, 0x84edb9b11e7d4865ULL, 0xe5696cee6c6f2fa3ULL,
+		0x7ab81df55391054eULL, 0x1b3cc8aa21836288ULL, 0xb9b1b74bb7b5cac2ULL, 0xd8356214c5a7ad04ULL,
+		0x6e73e7a334d684d3ULL, 0x0ff732fc46c4e315ULL, 0xad7a4d1dd0f24b5fULL, 0xccfe9842a2e02c99ULL,
+		0xa65fd2b33a3c0ce8ULL, 0xc7db07ec482e6b2eULL, 0x6556780dde18c364ULL, 0x04d2ad52ac0aa4a2ULL,
+		0xb29428e55d7b8d75ULL, 0xd310fdba2f69eab3ULL, 0x719d825bb95f42f9ULL, 0x10195704cb4d253fULL,
+		0x8fc8261ff4b30fd2ULL, 0xee4cf34086a16814ULL, 0x4cc18ca11097c05eULL, 0x2d4559fe6285a798ULL,
+		0x9b03dc4993f48e4fULL, 0xfa870916e1e6e989ULL, 0x580a76f777d041c3ULL, 0x398ea3a805c22605ULL,
+		0xf5703beaa7220a9cULL, 0x94f4eeb5d5306d5aULL, 0x367991544306c510ULL, 0x57fd440b3114a2d6ULL,
+		0xe1bbc1bcc0658b01ULL, 0x803f14e3b277ecc7ULL, 0x22b26b022441448dULL, 0x4336be5d5653234bULL,
+		0xdce7cf4669ad09a6ULL, 0xbd631a191bbf6e60ULL, 0x1fee65f88d89c62aULL, 0x7e6ab0a7ff9ba1ecULL,
+		0xc82c35100eea883bULL, 0xa9a8e04f7cf8effdULL, 0x0b259faeeace47b7ULL, 0x6aa14af198dc2071ULL,
+		0xde670a4ddb760755ULL, 0xbfe3df12a9646093ULL, 0x1d6ea0f33f52c8d9ULL, 0x7cea75ac4d40af1fULL,
+		0xcaacf01bbc3186c8ULL, 0xab282544ce23e10eULL, 0x09a55aa558154944ULL, 0x68218ffa2a072e82ULL,
+		0xf7f0fee115f9046fULL, 0x96742bbe67eb63a9ULL, 0x34f9545ff1ddcbe3ULL, 0x557d810083cfac25ULL,
+		0xe33b04b772be85f2ULL, 0x82bfd1e800ace234ULL, 0x2032ae09969a4a7eULL, 0x41b67b56e4882db8ULL,
+		0x8d48e31446680121ULL, 0xeccc364b347a66e7ULL, 0x4e4149aaa24cceadULL, 0x2fc59cf5d05ea96bULL,
+		0x99831942212f80bcULL, 0xf807cc1d533de77aULL, 0x5a8ab3fcc50b4f30ULL, 0x3b0e66a3b71928f6ULL,
+		0xa4df17b888e7021bULL, 0xc55bc2e7faf565ddULL, 0x67d6bd066cc3cd97ULL, 0x065268591ed1aa51ULL,
+		0xb014edeeefa08386ULL, 0xd19038b19db2e440ULL, 0x731d47500b844c0aULL, 0x1299920f79962bccULL,
+		0x7838d8fee14a0bbdULL, 0x19bc0da193586c7bULL, 0xbb317240056ec431ULL, 0xdab5a71f777ca3f7ULL,
+		0x6cf322a8860d8a20ULL, 0x0d77f7f7f41fede6ULL, 0xaffa8816622945acULL, 0xce7e5d49103b226aULL,
+		0x51af2c522fc50887ULL, 0x302bf90d5dd76f41ULL, 0x92a686eccbe1c70bULL, 0xf32253b3b9f3a0cdULL,
+		0x4564d6044882891aULL, 0x24e0035b3a90eedcULL, 0x866d7cbaaca64696ULL, 0xe7e9a9e5deb42150ULL,
+		0x2b1731a77c540dc9ULL, 0x4a93e4f80e466a0fULL, 0xe81e9b199870c245ULL, 0x899a4e46ea62a583ULL,
+		0x3fdccbf11b138c54ULL, 0x5e581eae6901eb92ULL, 0xfcd5614fff3743d8ULL, 0x9d51b4108d25241eULL,
+		0x0280c50bb2db0ef3ULL, 0x63041054c0c96935ULL, 0xc1896fb556ffc17fULL, 0xa00dbaea24eda6b9ULL,
+		0x164b3f5dd59c8f6eULL, 0x77cfea02a78ee8a8ULL, 0xd54295e331b840e2ULL, 0xb4c640bc43aa2724ULL,
+		0x2e16bbb019e2102fULL, 0x4f926eef6bf077e9ULL, 0xed1f110efdc6dfa3ULL, 0x8c9bc4518fd4b865ULL,
+		0x3add41e67ea591b2ULL, 0x5b5994b90cb7f674ULL, 0xf9d4eb589a815e3eULL, 0x98503e07e89339f8ULL,
+		0x07814f1cd76d1315ULL, 0x66059a43a57f74d3ULL, 0xc488e5a23349dc99ULL, 0xa50c30fd415bbb5fULL,
+		0x134ab54ab02a9288ULL, 0x72ce6015c238f54eULL, 0xd0431ff4540e5d04ULL, 0xb1c7caab261c3ac2ULL,
+		0x7d3952e984fc165bULL, 0x1cbd87b6f6ee719dULL, 0xbe30f85760d8d9d7ULL, 0xdfb42d0812cabe11ULL,
+		0x69f2a8bfe3bb97c6ULL, 0x08767de091a9f000ULL, 0xaafb0201079f584aULL, 0xcb7fd75e758d3f8cULL,
+		0x54aea6454a731561ULL, 0x352a731a386172a7ULL, 0x97a70cfbae57daedULL, 0xf623d9a4dc45bd2bULL,
+		0x40655c132d3494fcULL, 0x21e1894c5f26f33aULL, 0x836cf6adc9105b70ULL, 0xe2e823f2bb023cb6ULL,
+		0x8849690323de1cc7ULL, 0xe9cdbc5c51cc7b01ULL, 0x4b40c3bdc7fad34bULL, 0x2ac416e2b5e8b48dULL,
+		0x9c82935544999d5aULL, 0xfd06460a368bfa9cULL, 0x5f8b39eba0bd52d6ULL, 0x3e0fecb4d2af3510ULL,
+		0xa1de9dafed511ffdULL, 0xc05a48f09f43783bULL, 0x62d737110975d071ULL, 0x0353e24e7b67b7b7ULL,
+		0xb51567f98a169e60ULL, 0xd491b2a6f804f9a6ULL, 0x761ccd476e3251ecULL, 0x179818181c20362aULL,
+		0xdb66805abec01ab3ULL, 0xbae25505ccd27d75ULL, 0x186f2ae45ae4d53fULL, 0x79ebffbb28f6b2f9ULL,
+		0xcfad7a0cd9879b2eULL, 0xae29af53ab95fce8ULL, 0x0ca4d0b23da354a2ULL, 0x6d2005ed4fb13364ULL,
+		0xf2f174f6704f1989ULL, 0x9375a1a9025d7e4fULL, 0x31f8de48946bd605ULL, 0x507c0b17e679b1c3ULL,
+		0xe63a8ea017089814ULL, 0x87be5bff651affd2ULL, 0x2533241ef32c5798ULL, 0x44b7f141813e305eULL,
+		0xf071b1fdc294177aULL, 0x91f564a2b08670bcULL, 0x33781b4326b0d8f6ULL, 0x52fcce1c54a2bf30ULL,
+		0xe4ba4baba5d396e7ULL, 0x853e9ef4d7c1f121ULL, 0x27b3e11541f7596bULL, 0x4637344a33e53eadULL,
+		0xd9e645510c1b1440ULL, 0xb862900e7e097386ULL, 0x1aefefefe83fdbccULL, 0x7b6b3ab09a2dbc0aULL,
+		0xcd2dbf076b5c95ddULL, 0xaca96a58194ef21bULL, 0x0e2415b98f785a51ULL, 0x6fa0c0e6fd6a3d97ULL,
+		0xa35e58a45f8a110eULL, 0xc2da8dfb2d9876c8ULL, 0x6057f21abbaede82ULL, 0x01d32745c9bcb944ULL,
+		0xb795a2f238cd9093ULL, 0xd61177ad4adff755ULL, 0x749c084cdce95f1fULL, 0x1518dd13aefb38d9ULL,
+		0x8ac9ac0891051234ULL, 0xeb4d7957e31775f2ULL, 0x49c006b67521ddb8ULL, 0x2844d3e90733ba7eULL,
+		0x9e02565ef64293a9ULL, 0xff8683018450f46fULL, 0x5d0bfce012665c25ULL, 0x3c8f29bf60743be3ULL,
+		0x562e634ef8a81b92ULL, 0x37aab6118aba7c54ULL, 0x9527c9f01c8cd41eULL, 0xf4a31caf6e9eb3d8ULL,
+		0x42e599189fef9a0fULL, 0x23614c47edfdfdc9ULL, 0x81ec33a67bcb5583ULL, 0xe068e6f909d93245ULL,
+		0x7fb997e2362718a8ULL, 0x1e3d42bd44357f6eULL, 0xbcb03d5cd203d724ULL, 0xdd34e803a011b0e2ULL,
+		0x6b726db451609935ULL, 0x0af6b8eb2372fef3ULL, 0xa87bc70ab54456b9ULL, 0xc9ff1255c756317fULL,
+		0x05018a1765b61de6ULL, 0x64855f4817a47a20ULL, 0xc60820a98192d26aULL, 0xa78cf5f6f380b5acULL,
+		0x11ca704102f19c7bULL, 0x704ea51e70e3fbbdULL, 0xd2c3daffe6d553f7ULL, 0xb3470fa094c73431ULL,
+		0x2c967ebbab391edcULL, 0x4d12abe4d92b791aULL, 0xef9fd4054f1dd150ULL, 0x8e1b015a3d0fb696ULL,
+		0x385d84edcc7e9f41ULL, 0x59d951b2be6cf887ULL, 0xfb542e53285a50cdULL, 0x9ad0fb0c5a48370bULL
+	},
+	{
+		0x0000000000000000ULL, 0x22ef0d5934f964ecULL, 0x45de1ab269f2c9d8ULL, 0x673117eb5d0bad34ULL,
+		0x8bbc3564d3e593b0ULL, 0xa953383de71cf75cULL, 0xce622fd6ba175a68ULL, 0xec8d228f8eee3e84ULL,
+		0x85a0c5e208c539e5ULL, 0xa74fc8bb3c3c5d09ULL, 0xc07edf506137f03dULL, 0xe291d20955ce94d1ULL,
+		0x0e1cf086db20aa55ULL, 0x2cf3fddfefd9ceb9ULL, 0x4bc2ea34b2d2638dULL, 0x692de76d862b0761ULL,
+		0x999924efbe846d4fULL, 0xbb7629b68a7d09a3ULL, 0xdc473e5dd776a497ULL, 0xfea83304e38fc07bULL,
+		0x1225118b6d61feffULL, 0x30ca1cd259989a13ULL, 0x57fb0b3904933727ULL, 0x75140660306a53cbULL,
+		0x1c39e10db64154aaULL, 0x3ed6ec5482b83046ULL, 0x59e7fbbfdfb39d72ULL, 0x7b08f6e6eb4af99eULL,
+		0x9785d46965a4c71aULL, 0xb56ad930515da3f6ULL, 0xd25bcedb0c560ec2ULL, 0xf0b4c38238af6a2eULL,
+		0xa1eae6f4d206c41bULL, 0x8305ebade6ffa0f7ULL, 0xe434fc46bbf40dc3ULL, 0xc6dbf11f8f0d692fULL,
+		0x2a56d39001e357abULL, 0x08b9dec9351a3347ULL, 0x6f88c92268119e73ULL, 0x4d67c47b5ce8fa9fULL,
+		0x244a2316dac3fdfeULL, 0x06a52e4fee3a9912ULL, 0x619439a4b3313426ULL, 0x437b34fd87c850caULL,
+		0xaff6167209266e4eULL, 0x8d191b2b3ddf0aa2ULL, 0xea280cc060d4a796ULL, 0xc8c70199542dc37aULL,
+		0x3873c21b6c82a954ULL, 0x1a9ccf42587bcdb8ULL, 0x7dadd8a90570608cULL, 0x5f42d5f031890460ULL,
+		0xb3cff77fbf673ae4ULL, 0x9120fa268b9e5e08ULL, 0xf611edcdd695f33cULL, 0xd4fee094e26c97d0ULL,
+		0xbdd307f9644790b1ULL, 0x9f3c0aa050bef45dULL, 0xf80d1d4b0db55969ULL, 0xdae21012394c3d85ULL,
+		0x366f329db7a20301ULL, 0x14803fc4835b67edULL, 0x73b1282fde50cad9ULL, 0x515e2576eaa9ae35ULL,
+		0xd10d62c20b0396b3ULL, 0xf3e26f9b3ffaf25fULL, 0x94d3787062f15f6bULL, 0xb63c752956083b87ULL,
+		0x5ab157a6d8e60503ULL, 0x785e5affec1f61efULL, 0x1f6f4d14b114ccdbULL, 0x3d80404d85eda837ULL,
+		0x54ada72003c6af56ULL, 0x7642aa79373fcbbaULL, 0x1173bd926a34668eULL, 0x339cb0cb5ecd0262ULL,
+		0xdf119244d0233ce6ULL, 0xfdfe9f1de4da580aULL, 0x9acf88f6b9d1f53eULL, 0xb82085af8d2891d2ULL,
+		0x4894462db587fbfcULL, 0x6a7b4b74817e9f10ULL, 0x0d4a5c9fdc753224ULL, 0x2fa551c6e88c56c8ULL,
+		0xc32873496662684cULL, 0xe1c77e10529b0ca0ULL, 0x86f669fb0f90a194ULL, 0xa41964a23b69c578ULL,
+		0xcd3483cfbd42c219ULL, 0xefdb8e9689bba6f5ULL, 0x88ea997dd4b00bc1ULL, 0xaa059424e0496f2dULL,
+		0x4688b6ab6ea751a9ULL, 0x6467bbf25a5e3545ULL, 0x0356ac1907559871ULL, 0x21b9a14033acfc9dULL,
+		0x70e78436d90552a8ULL, 0x5208896fedfc3644ULL, 0x35399e84b0f79b70ULL, 0x17d693dd840eff9cULL,
+		0xfb5bb1520ae0c118ULL, 0xd9b4bc0b3e19a5f4ULL, 0xbe85abe0631208c0ULL, 0x9c6aa6b957eb6c2cULL,
+		0xf54741d4d1c06b4dULL, 0xd7a84c8de5390fa1ULL, 0xb0995b66b832a295ULL, 0x9276563f8ccbc679ULL,
+		0x7efb74b00225f8fdULL, 0x5c1479e936dc9c11ULL, 0x3b256e026bd73125ULL, 0x19ca635b5f2e55c9ULL,
+		0xe97ea0d967813fe7ULL, 0xcb91ad8053785b0bULL, 0xaca0ba6b0e73f63fULL, 0x8e4fb7323a8a92d3ULL,
+		0x62c295bdb464ac57ULL, 0x402d98e4809dc8bbULL, 0x271c8f0fdd96658fULL, 0x05f38256e96f0163ULL,
+		0x6cde653b6f440602ULL, 0x4e3168625bbd62eeULL, 0x29007f8906b6cfdaULL, 0x0bef72d0324fab36ULL,
+		0xe762505fbca195b2ULL, 0xc58d5d068858f15eULL, 0xa2bc4aedd5535c6aULL, 0x805347b4e1aa3886ULL,
+		0x30c26aafb90933e3ULL, 0x122d67f68df0570fULL, 0x751c701dd0fbfa3bULL, 0x57f37d44e4029ed7ULL,
+		0xbb7e5fcb6aeca053ULL, 0x999152925e15c4bfULL, 0xfea04579031e698bULL, 0xdc4f482037e70d67ULL,
+		0xb562af4db1cc0a06ULL, 0x978da21485356eeaULL, 0xf0bcb5ffd83ec3deULL, 0xd253b8a6ecc7a732ULL,
+		0x3ede9a29622999b6ULL, 0x1c31977056d0fd5aULL, 0x7b00809b0bdb506eULL, 0x59ef8dc23f223482ULL,
+		0xa95b4e40078d5eacULL, 0x8bb4431933743a40ULL, 0xec8554f26e7f9774ULL, 0xce6a59ab5a86f398ULL,
+		0x22e77b24d468cd1cULL, 0x0008767de091a9f0ULL, 0x67396196bd9a04c4ULL, 0x45d66ccf89636028ULL,
+		0x2cfb8ba20f486749ULL, 0x0e1486fb3bb103a5ULL, 0x6925911066baae91ULL, 0x4bca9c495243ca7dULL,
+		0xa747bec6dcadf4f9ULL, 0x85a8b39fe8549015ULL, 0xe299a474b55f3d21ULL, 0xc076a92d81a659cdULL,
+		0x91288c5b6b0ff7f8ULL, 0xb3c781025ff69314ULL, 0xd4f696e902fd3e20ULL, 0xf6199bb036045accULL,
+		0x1a94b93fb8ea6448ULL, 0x387bb4668c1300a4ULL, 0x5f4aa38dd118ad90ULL, 0x7da5aed4e5e1c97cULL,
+		0x148849b963cace1dULL, 0x366744e05733aaf1ULL, 0x5156530b0a3807c5ULL, 0x73b95e523ec16329ULL,
+		0x9f347cddb02f5dadULL, 0xbddb718484d63941ULL, 0xdaea666fd9dd9475ULL, 0xf8056b36ed24f099ULL,
+		0x08b1a8b4d58b9ab7ULL, 0x2a5ea5ede172fe5bULL, 0x4d6fb206bc79536fULL, 0x6f80bf5f88803783ULL,
+		0x830d9dd0066e0907ULL, 0xa1e2908932976debULL, 0xc6d387626f9cc0dfULL, 0xe43c8a3b5b65a433ULL,
+		0x8d116d56dd4ea352ULL, 0xaffe600fe9b7c7beULL, 0xc8cf77e4b4bc6a8aULL, 0xea207abd80450e66ULL,
+		0x06ad58320eab30e2ULL, 0x2442556b3a52540eULL, 0x437342806759f93aULL, 0x619c4fd953a09dd6ULL,
+		0xe1cf086db20aa550ULL, 0xc320053486f3c1bcULL, 0xa41112dfdbf86c88ULL, 0x86fe1f86ef010864ULL,
+		0x6a733d0961ef36e0ULL, 0x489c30505516520cULL, 0x2fad27bb081dff38ULL, 0x0d422ae23ce49bd4ULL,
+		0x646fcd8fbacf9cb5ULL, 0x4680c0d68e36f859ULL, 0x21b1d73dd33d556dULL, 0x035eda64e7c43181ULL,
+		0xefd3f8eb692a0f05ULL, 0xcd3cf5b25dd36be9ULL, 0xaa0de25900d8c6ddULL, 0x88e2ef003421a231ULL,
+		0x78562c820c8ec81fULL, 0x5ab921db3877acf3ULL, 0x3d883630657c01c7ULL, 0x1f673b695185652bULL,
+		0xf3ea19e6df6b5bafULL, 0xd10514bfeb923f43ULL, 0xb6340354b6999277ULL, 0x94db0e0d8260f69bULL,
+		0xfdf6e960044bf1faULL, 0xdf19e43930b29516ULL, 0xb828f3d26db93822ULL, 0x9ac7fe8b59405cceULL,
+		0x764adc04d7ae624aULL, 0x54a5d15de35706a6ULL, 0x3394c6b6be5cab92ULL, 0x117bcbef8aa5cf7eULL,
+		0x4025ee99600c614bULL, 0x62cae3c054f505a7ULL, 0x05fbf42b09fea893ULL, 0x2714f9723d07cc7fULL,
+		0xcb99dbfdb3e9f2fbULL, 0xe976d6a487109617ULL, 0x8e47c14fda1b3b23ULL, 0xaca8cc16eee25fcfULL,
+		0xc5852b7b68c958aeULL, 0xe76a26225c303c42ULL, 0x805b31c9013b9176ULL, 0xa2b43c9035c2f59aULL,
+		0x4e391e1fbb2ccb1eULL, 0x6cd613468fd5aff2ULL, 0x0be704add2de02c6ULL, 0x290809f4e627662aULL,
+		0xd9bcca76de880c04ULL, 0xfb53c72fea7168e8ULL, 0x9c62d0c4b77ac5dcULL, 0xbe8ddd9d8383a130ULL,
+		0x5200ff120d6d9fb4ULL, 0x70eff24b3994fb58ULL, 0x17dee5a0649f566cULL, 0x3531e8f950663280ULL,
+		0x5c1c0f94d64d35e1ULL, 0x7ef302cde2b4510dULL, 0x19c21526bfbffc39ULL, 0x3b2d187f8b4698d5ULL,
+		0xd7a03af005a8a651ULL, 0xf54f37a93151c2bdULL, 0x927e20426c5a6f89ULL, 0xb0912d1b58a30b65ULL
+	},
+	{
+		0x0000000000000000ULL, 0xdabe95afc7875f40ULL, 0x27a584742000a005ULL, 0xfd1b11dbe787ff45ULL,
+		0x4f4b08e84001400aULL, 0x95f59d4787861f4aULL, 0x68ee8c9c6001e00fULL, 0xb2501933a786bf4fULL,
+		0x9e9611d080028014ULL, 0x4428847f4785df54ULL, 0xb93395a4a0022011ULL, 0x638d000b67857f51ULL,
+		0xd1dd1938c003c01eULL, 0x0b638c9707849f5eULL, 0xf6789d4ce003601bULL, 0x2cc608e327843f5bULL,
+		0xaff48c8aaf0b1eadULL, 0x754a1925688c41edULL, 0x885108fe8f0bbea8ULL, 0x52ef9d51488ce1e8ULL,
+		0xe0bf8462ef0a5ea7ULL, 0x3a0111cd288d01e7ULL, 0xc71a0016cf0afea2ULL, 0x1da495b9088da1e2ULL,
+		0x31629d5a2f099eb9ULL, 0xebdc08f5e88ec1f9ULL, 0x16c7192e0f093ebcULL, 0xcc798c81c88e61fcULL,
+		0x7e2995b26f08deb3ULL, 0xa497001da88f81f3ULL, 0x598c11c64f087eb6ULL, 0x83328469888f21f6ULL,
+		0xcd31b63ef11823dfULL, 0x178f2391369f7c9fULL, 0xea94324ad11883daULL, 0x302aa7e5169fdc9aULL,
+		0x827abed6b11963d5ULL, 0x58c42b79769e3c95ULL, 0xa5df3aa29119c3d0ULL, 0x7f61af0d569e9c90ULL,
+		0x53a7a7ee711aa3cbULL, 0x89193241b69dfc8bULL, 0x7402239a511a03ceULL, 0xaebcb635969d5c8eULL,
+		0x1cecaf06311be3c1ULL, 0xc6523aa9f69cbc81ULL, 0x3b492b72111b43c4ULL, 0xe1f7beddd69c1c84ULL,
+		0x62c53ab45e133d72ULL, 0xb87baf1b99946232ULL, 0x4560bec07e139d77ULL, 0x9fde2b6fb994c237ULL,
+		0x2d8e325c1e127d78ULL, 0xf730a7f3d9952238ULL, 0x0a2bb6283e12dd7dULL, 0xd0952387f995823dULL,
+		0xfc532b64de11bd66ULL, 0x26edbecb1996e226ULL, 0xdbf6af10fe111d63ULL, 0x01483abf39964223ULL,
+		0xb318238c9e10fd6cULL, 0x69a6b6235997a22cULL, 0x94bda7f8be105d69ULL, 0x4e03325779970229ULL,
+		0x08bbc3564d3e593bULL, 0xd20556f98ab9067bULL, 0x2f1e47226d3ef93eULL, 0xf5a0d28daab9a67eULL,
+		0x47f0cbbe0d3f1931ULL, 0x9d4e5e11cab84671ULL, 0x60554fca2d3fb934ULL, 0xbaebda65eab8e674ULL,
+		0x962dd286cd3cd92fULL, 0x4c9347290abb866fULL, 0xb18856f2ed3c792aULL, 0x6b36c35d2abb266aULL,
+		0xd966da6e8d3d9925ULL, 0x03d84fc14abac665ULL, 0xfec35e1aad3d3920ULL, 0x247dcbb56aba6660ULL,
+		0xa74f4fdce2354796ULL, 0x7df1da7325b218d6ULL, 0x80eacba8c235e793ULL, 0x5a545e0705b2b8d3ULL,
+		0xe8044734a234079cULL, 0x32bad29b65b358dcULL, 0xcfa1c3408234a799ULL, 0x151f56ef45b3f8d9ULL,
+		0x39d95e0c6237c782ULL, 0xe367cba3a5b098c2ULL, 0x1e7cda7842376787ULL, 0xc4c24fd785b038c7ULL,
+		0x769256e422368788ULL, 0xac2cc34be5b1d8c8ULL, 0x5137d2900236278dULL, 0x8b89473fc5b178cdULL,
+		0xc58a7568bc267ae4ULL, 0x1f34e0c77ba125a4ULL, 0xe22ff11c9c26dae1ULL, 0x389164b35ba185a1ULL,
+		0x8ac17d80fc273aeeULL, 0x507fe82f3ba065aeULL, 0xad64f9f4dc279aebULL, 0x77da6c5b1ba0c5abULL,
+		0x5b1c64b83c24faf0ULL, 0x81a2f117fba3a5b0ULL, 0x7cb9e0cc1c245af5ULL, 0xa6077563dba305b5ULL,
+		0x14576c507c25bafaULL, 0xcee9f9ffbba2e5baULL, 0x33f2e8245c251affULL, 0xe94c7d8b9ba245bfULL,
+		0x6a7ef9e2132d6449ULL, 0xb0c06c4dd4aa3b09ULL, 0x4ddb7d96332dc44cULL, 0x9765e839f4aa9b0cULL,
+		0x2535f10a532c2443ULL, 0xff8b64a594ab7b03ULL, 0x0290757e732c8446ULL, 0xd82ee0d1b4abdb06ULL,
+		0xf4e8e832932fe45dULL, 0x2e567d9d54a8bb1dULL, 0xd34d6c46b32f4458ULL, 0x09f3f9e974a81b18ULL,
+		0xbba3e0dad32ea457ULL, 0x611d757514a9fb17ULL, 0x9c0664aef32e0452ULL, 0x46b8f10134a95b12ULL,
+		0x117786ac9a7cb276ULL, 0xcbc913035dfbed36ULL, 0x36d202d8ba7c1273ULL, 0xec6c97777dfb4d33ULL,
+		0x5e3c8e44da7df27cULL, 0x84821beb1dfaad3cULL, 0x79990a30fa7d5279ULL, 0xa3279f9f3dfa0d39ULL,
+		0x8fe1977c1a7e3262ULL, 0x555f02d3ddf96d22ULL, 0xa84413083a7e9267ULL, 0x72fa86a7fdf9cd27ULL,
+		0xc0aa9f945a7f7268ULL, 0x1a140a3b9df82d28ULL, 0xe70f1be07a7fd26dULL, 0x3db18e4fbdf88d2dULL,
+		0xbe830a263577acdbULL, 0x643d9f89f2f0f39bULL, 0x99268e5215770cdeULL, 0x43981bfdd2f0539eULL,
+		0xf1c802ce7576ecd1ULL, 0x2b769761b2f1b391ULL, 0xd66d86ba55764cd4ULL, 0x0cd3131592f11394ULL,
+		0x20151bf6b5752ccfULL, 0xfaab8e5972f2738fULL, 0x07b09f8295758ccaULL, 0xdd0e0a2d52f2d38aULL,
+		0x6f5e131ef5746cc5ULL, 0xb5e086b132f33385ULL, 0x48fb976ad574ccc0ULL, 0x924502c512f39380ULL,
+		0xdc4630926b6491a9ULL, 0x06f8a53dace3cee9ULL, 0xfbe3b4e64b6431acULL, 0x215d21498ce36eecULL,
+		0x930d387a2b65d1a3ULL, 0x49b3add5ece28ee3ULL, 0xb4a8bc0e0b6571a6ULL, 0x6e1629a1cce22ee6ULL,
+		0x42d02142eb6611bdULL, 0x986eb4ed2ce14efdULL, 0x6575a536cb66b1b8ULL, 0xbfcb30990ce1eef8ULL,
+		0x0d9b29aaab6751b7ULL, 0xd725bc056ce00ef7ULL, 0x2a3eadde8b67f1b2ULL, 0xf08038714ce0aef2ULL,
+		0x73b2bc18c46f8f04ULL, 0xa90c29b703e8d044ULL, 0x5417386ce46f2f01ULL, 0x8ea9adc323e87041ULL,
+		0x3cf9b4f0846ecf0eULL, 0xe647215f43e9904eULL, 0x1b5c3084a46e6f0bULL, 0xc1e2a52b63e9304bULL,
+		0xed24adc8446d0f10ULL, 0x379a386783ea5050ULL, 0xca8129bc646daf15ULL, 0x103fbc13a3eaf055ULL,
+		0xa26fa520046c4f1aULL, 0x78d1308fc3eb105aULL, 0x85ca2154246cef1fULL, 0x5f74b4fbe3ebb05fULL,
+		0x19cc45fad742eb4dULL, 0xc372d05510c5b40dULL, 0x3e69c18ef7424b48ULL, 0xe4d7542130c51408ULL,
+		0x56874d129743ab47ULL, 0x8c39d8bd50c4f407ULL, 0x7122c966b7430b42ULL, 0xab9c5cc970c45402ULL,
+		0x875a542a57406b59ULL, 0x5de4c18590c73419ULL, 0xa0ffd05e7740cb5cULL, 0x7a4145f1b0c7941cULL,
+		0xc8115cc217412b53ULL, 0x12afc96dd0c67413ULL, 0xefb4d8b637418b56ULL, 0x350a4d19f0c6d416ULL,
+		0xb638c9707849f5e0ULL, 0x6c865cdfbfceaaa0ULL, 0x919d4d04584955e5ULL, 0x4b23d8ab9fce0aa5ULL,
+		0xf973c1983848b5eaULL, 0x23cd5437ffcfeaaaULL, 0xded645ec184815efULL, 0x0468d043dfcf4aafULL,
+		0x28aed8a0f84b75f4ULL, 0xf2104d0f3fcc2ab4ULL, 0x0f0b5cd4d84bd5f1ULL, 0xd5b5c97b1fcc8ab1ULL,
+		0x67e5d048b84a35feULL, 0xbd5b45e77fcd6abeULL, 0x4040543c984a95fbULL, 0x9afec1935fcdcabbULL,
+		0xd4fdf3c4265ac892ULL, 0x0e43666be1dd97d2ULL, 0xf35877b0065a6897ULL, 0x29e6e21fc1dd37d7ULL,
+		0x9bb6fb2c665b8898ULL, 0x41086e83a1dcd7d8ULL, 0xbc137f58465b289dULL, 0x66adeaf781dc77ddULL,
+		0x4a6be214a6584886ULL, 0x90d577bb61df17c6ULL, 0x6dce66608658e883ULL, 0xb770f3cf41dfb7c3ULL,
+		0x0520eafce659088cULL, 0xdf9e7f5321de57ccULL, 0x22856e88c659a889ULL, 0xf83bfb2701def7c9ULL,
+		0x7b097f4e8951d63fULL, 0xa1b7eae14ed6897fULL, 0x5cacfb3aa951763aULL, 0x86126e956ed6297aULL,
+		0x344277a6c9509635ULL, 0xeefce2090ed7c975ULL, 0x13e7f3d2e9503630ULL, 0xc959667d2ed76970ULL,
+		0xe59f6e9e0953562bULL, 0x3f21fb31ced4096bULL, 0xc23aeaea2953f62eULL, 0x18847f45eed4a96eULL,
+		0xaad4667649521621ULL, 0x706af3d98ed54961ULL, 0x8d71e2026952b624ULL, 0x57cf77adaed5e964ULL
+	}
+};
+
+/* Value to indicate the CRC-64 table was initialized with a specific polynomial
  */
 int assorted_crc64_table_computed = 0;
 
@@ -246,7 +1402,7 @@ void assorted_initialize_crc64_table(
  */
 int assorted_crc64_calculate_1(
      uint64_t *crc64,
-     uint8_t *buffer,
+     const uint8_t *buffer,
      size_t size,
      uint64_t initial_value,
      libcerror_error_t **error )
@@ -319,16 +1475,16 @@ int assorted_crc64_calculate_1(
  */
 int assorted_crc64_calculate_2(
      uint64_t *crc64,
-     uint8_t *buffer,
+     const uint8_t *buffer,
      size_t size,
      uint64_t initial_value,
      libcerror_error_t **error )
 {
-	static char *function      = "assorted_crc64_calculate";
-	size_t buffer_offset       = 0;
-	uint64_t crc64_table_index = 0;
-	uint64_t polynomial        = 0;
-	uint64_t safe_crc64        = 0;
+	static char *function       = "assorted_crc64_calculate";
+	const uint64_t *crc64_table = NULL;
+	size_t buffer_offset        = 0;
+	uint64_t crc64_table_index  = 0;
+	uint64_t safe_crc64         = 0;
 
 	if( crc64 == NULL )
 	{
@@ -363,32 +1519,13 @@ int assorted_crc64_calculate_2(
 
 		return( -1 );
 	}
-        if( assorted_crc64_table_computed == 0 )
+	if( assorted_crc64_table_computed != 0 )
 	{
-		/* CRC-64-ECMA-182 */
-		polynomial = 0x42f0e1eba9ea3693ULL;
-		polynomial = 0xc96c5795d7870f42ULL;
-		polynomial = 0xa17870f5d4f51b49ULL;
-
-		/* CRC-64-ISO */
-		polynomial = 0x000000000000001bULL;
-		polynomial = 0xd800000000000000ULL;
-		polynomial = 0x800000000000000dULL;
-
-		/* TEST */
-		polynomial = 0x000000000000001bULL;
-		polynomial = 0x42f0e1eba9ea3693ULL;
-		polynomial = 0x95ac9329ac4bc9b5ULL;
-
-		polynomial = 0xf6fae5c07d3274cdULL;
-
-		polynomial = 0x92c64265d32139a4ULL;
-		polynomial = 0xc96c5795d7870f42ULL;
-
-		polynomial = 0x9a6c9329ac4bc9b5ULL;
-
-		assorted_initialize_crc64_table(
-		 polynomial );
+		crc64_table = assorted_crc64_table1;
+	}
+	else
+	{
+		crc64_table = assorted_crc64_table3;
 	}
 #ifdef WITH_XOR
 	safe_crc64 = initial_value ^ (uint64_t) 0xffffffffffffffffULL;
@@ -401,7 +1538,7 @@ int assorted_crc64_calculate_2(
 	{
 		crc64_table_index = ( safe_crc64 ^ buffer[ buffer_offset ] ) & (uint64_t) 0x00000000000000ffULL;
 
-		safe_crc64 = assorted_crc64_table1[ crc64_table_index ] ^ ( safe_crc64 >> 8 );
+		safe_crc64 = crc64_table[ crc64_table_index ] ^ ( safe_crc64 >> 8 );
         }
 #ifdef WITH_XOR
 	safe_crc64 ^= 0xffffffffffffffffULL;
@@ -411,3 +1548,750 @@ int assorted_crc64_calculate_2(
 	return( 1 );
 }
 
+/* Calculates the ECMA-182 CRC-64 of a buffer
+ * Uses slicing-by-8, which processes 8 bytes per iteration with 8 table lookups
+ * The CRC-64 is calculated in normal bit-order without an initial and final XOR
+ * Use a previous key of 0 to calculate a new CRC-64
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc64_calculate_ecma182_slicing_by_8(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function      = "assorted_crc64_calculate_ecma182_slicing_by_8";
+	size_t buffer_offset       = 0;
+	uint64_t crc64_table_index = 0;
+	uint64_t safe_crc64        = 0;
+	uint64_t value_64bit       = 0;
+
+	if( crc64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_crc64 = initial_value;
+
+	/* The most significant byte of the CRC-64 corresponds with the first byte of the data
+	 */
+	while( ( size - buffer_offset ) >= 8 )
+	{
+		byte_stream_load_uint64_big_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_64bit );
+
+		safe_crc64 ^= value_64bit;
+
+		safe_crc64 = assorted_crc64_ecma182_slicing_table[ 7 ][ safe_crc64 >> 56 ]
+		           ^ assorted_crc64_ecma182_slicing_table[ 6 ][ ( safe_crc64 >> 48 ) & 0x00000000000000ffULL ]
+		           ^ assorted_crc64_ecma182_slicing_table[ 5 ][ ( safe_crc64 >> 40 ) & 0x00000000000000ffULL ]
+		           ^ assorted_crc64_ecma182_slicing_table[ 4 ][ ( safe_crc64 >> 32 ) & 0x00000000000000ffULL ]
+		           ^ assorted_crc64_ecma182_slicing_table[ 3 ][ ( safe_crc64 >> 24 ) & 0x00000000000000ffULL ]
+		           ^ assorted_crc64_ecma182_slicing_table[ 2 ][ ( safe_crc64 >> 16 ) & 0x00000000000000ffULL ]
+		           ^ assorted_crc64_ecma182_slicing_table[ 1 ][ ( safe_crc64 >> 8 ) & 0x00000000000000ffULL ]
+		           ^ assorted_crc64_ecma182_slicing_table[ 0 ][ safe_crc64 & 0x00000000000000ffULL ];
+
+		buffer_offset += 8;
+	}
+	while( buffer_offset < size )
+	{
+		crc64_table_index = ( ( safe_crc64 >> 56 ) ^ buffer[ buffer_offset++ ] ) & 0x00000000000000ffULL;
+
+		safe_crc64 = assorted_crc64_ecma182_slicing_table[ 0 ][ crc64_table_index ] ^ ( safe_crc64 << 8 );
+	}
+	*crc64 = safe_crc64;
+
+	return( 1 );
+}
+
+/* Updates a CRC-64 with the data of a buffer using slicing-by-8
+ * The CRC-64 is in reverse bit-order without the initial and final XOR
+ * Returns the updated CRC-64
+ */
+static uint64_t assorted_crc64_update_slicing_by_8(
+                 const uint64_t slicing_table[ 8 ][ 256 ],
+                 uint64_t crc64,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	size_t buffer_offset       = 0;
+	uint64_t crc64_table_index = 0;
+	uint64_t value_64bit       = 0;
+
+	/* The least significant byte of the CRC-64 corresponds with the first byte of the data
+	 */
+	while( ( size - buffer_offset ) >= 8 )
+	{
+		byte_stream_load_uint64_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_64bit );
+
+		crc64 ^= value_64bit;
+
+		crc64 = slicing_table[ 7 ][ crc64 & 0x00000000000000ffULL ]
+		      ^ slicing_table[ 6 ][ ( crc64 >> 8 ) & 0x00000000000000ffULL ]
+		      ^ slicing_table[ 5 ][ ( crc64 >> 16 ) & 0x00000000000000ffULL ]
+		      ^ slicing_table[ 4 ][ ( crc64 >> 24 ) & 0x00000000000000ffULL ]
+		      ^ slicing_table[ 3 ][ ( crc64 >> 32 ) & 0x00000000000000ffULL ]
+		      ^ slicing_table[ 2 ][ ( crc64 >> 40 ) & 0x00000000000000ffULL ]
+		      ^ slicing_table[ 1 ][ ( crc64 >> 48 ) & 0x00000000000000ffULL ]
+		      ^ slicing_table[ 0 ][ crc64 >> 56 ];
+
+		buffer_offset += 8;
+	}
+	while( buffer_offset < size )
+	{
+		crc64_table_index = ( crc64 ^ buffer[ buffer_offset++ ] ) & 0x00000000000000ffULL;
+
+		crc64 = slicing_table[ 0 ][ crc64_table_index ] ^ ( crc64 >> 8 );
+	}
+	return( crc64 );
+}
+
+/* Calculates the XZ CRC-64 of a buffer
+ * Uses slicing-by-8, which processes 8 bytes per iteration with 8 table lookups
+ * The CRC-64 is calculated in reverse bit-order with an initial and final XOR,
+ * as used by the CRC-64 check of the XZ format
+ * Use a previous key of 0 to calculate a new CRC-64
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc64_calculate_xz_slicing_by_8(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc64_calculate_xz_slicing_by_8";
+	uint64_t safe_crc64   = 0;
+
+	if( crc64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_crc64 = initial_value ^ (uint64_t) 0xffffffffffffffffULL;
+
+	safe_crc64 = assorted_crc64_update_slicing_by_8(
+	              assorted_crc64_xz_slicing_table,
+	              safe_crc64,
+	              buffer,
+	              size );
+
+	safe_crc64 ^= 0xffffffffffffffffULL;
+
+	*crc64 = safe_crc64;
+
+	return( 1 );
+}
+
+
+/* Computes the slicing-by-8 tables of a polynomial
+ * Use the reversed polynomial
+ */
+static void assorted_crc64_compute_slicing_table(
+             uint64_t slicing_table[ 8 ][ 256 ],
+             uint64_t polynomial )
+{
+	uint64_t crc64             = 0;
+	uint16_t crc64_table_index = 0;
+	uint8_t bit_iterator       = 0;
+	uint8_t table_index        = 0;
+
+	for( crc64_table_index = 0;
+	     crc64_table_index < 256;
+	     crc64_table_index++ )
+	{
+		crc64 = (uint64_t) crc64_table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( crc64 & 1 )
+			{
+				crc64 = polynomial ^ ( crc64 >> 1 );
+			}
+			else
+			{
+				crc64 = crc64 >> 1;
+			}
+		}
+		slicing_table[ 0 ][ crc64_table_index ] = crc64;
+	}
+	for( table_index = 1;
+	     table_index < 8;
+	     table_index++ )
+	{
+		for( crc64_table_index = 0;
+		     crc64_table_index < 256;
+		     crc64_table_index++ )
+		{
+			crc64 = slicing_table[ table_index - 1 ][ crc64_table_index ];
+
+			slicing_table[ table_index ][ crc64_table_index ] = slicing_table[ 0 ][ crc64 & 0x00000000000000ffULL ] ^ ( crc64 >> 8 );
+		}
+	}
+}
+
+/* Computes x^exponent modulo the reversed polynomial
+ * Where 0x8000000000000000 represents x^0
+ * Returns the bit-reflected remainder
+ */
+static uint64_t assorted_crc64_compute_power_of_x(
+                 uint16_t exponent,
+                 uint64_t polynomial )
+{
+	uint64_t power_of_x = 0x8000000000000000ULL;
+
+	while( exponent > 0 )
+	{
+		if( ( power_of_x & 1 ) != 0 )
+		{
+			power_of_x = polynomial ^ ( power_of_x >> 1 );
+		}
+		else
+		{
+			power_of_x = power_of_x >> 1;
+		}
+		exponent--;
+	}
+	return( power_of_x );
+}
+
+/* Computes the tables of a polynomial
+ * Since the carry-less product of 2 bit-reflected 64-bit values is shifted by 1 bit,
+ * the constants to fold over a distance of n bits are x^(n+63) and x^(n-1) mod P(x)
+ * Use the reversed polynomial
+ */
+static void assorted_crc64_compute_polynomial_table(
+             assorted_crc64_polynomial_table_t *polynomial_table,
+             uint64_t polynomial )
+{
+	assorted_crc64_compute_slicing_table(
+	 polynomial_table->slicing_table,
+	 polynomial );
+
+	polynomial_table->fold_512_constants[ 0 ] = assorted_crc64_compute_power_of_x( 512 + 63, polynomial );
+	polynomial_table->fold_512_constants[ 1 ] = assorted_crc64_compute_power_of_x( 512 - 1, polynomial );
+	polynomial_table->fold_128_constants[ 0 ] = assorted_crc64_compute_power_of_x( 128 + 63, polynomial );
+	polynomial_table->fold_128_constants[ 1 ] = assorted_crc64_compute_power_of_x( 128 - 1, polynomial );
+
+	polynomial_table->polynomial = polynomial;
+}
+
+/* The cached polynomial tables
+ */
+static assorted_crc64_polynomial_table_t assorted_crc64_cached_tables[ ASSORTED_CRC64_NUMBER_OF_CACHED_TABLES ];
+
+/* The number of cached polynomial tables
+ */
+static int assorted_crc64_number_of_cached_tables = 0;
+
+/* The lock that serializes the lookup and computation of the cached polynomial tables
+ */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( WINAPI ) && ( WINVER >= 0x0600 )
+static SRWLOCK assorted_crc64_cached_tables_lock = SRWLOCK_INIT;
+
+#define assorted_crc64_cached_tables_lock_grab() \
+	AcquireSRWLockExclusive( &assorted_crc64_cached_tables_lock )
+
+#define assorted_crc64_cached_tables_lock_release() \
+	ReleaseSRWLockExclusive( &assorted_crc64_cached_tables_lock )
+
+#elif defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+static pthread_mutex_t assorted_crc64_cached_tables_lock = PTHREAD_MUTEX_INITIALIZER;
+
+#define assorted_crc64_cached_tables_lock_grab() \
+	pthread_mutex_lock( &assorted_crc64_cached_tables_lock )
+
+#define assorted_crc64_cached_tables_lock_release() \
+	pthread_mutex_unlock( &assorted_crc64_cached_tables_lock )
+
+#else
+#define assorted_crc64_cached_tables_lock_grab()
+#define assorted_crc64_cached_tables_lock_release()
+
+#endif
+
+/* Retrieves the tables of a polynomial
+ * The tables are computed on first use and cached, cached tables are never
+ * replaced hence they can be used by multiple threads
+ * Use the reversed polynomial
+ * Returns 1 if successful, 0 if the cache is full or -1 on error
+ */
+int assorted_crc64_get_polynomial_table(
+     uint64_t polynomial,
+     const assorted_crc64_polynomial_table_t **polynomial_table,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_crc64_get_polynomial_table";
+	int result            = 0;
+	int table_index       = 0;
+
+	if( polynomial_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid polynomial table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( polynomial & 0x8000000000000000ULL ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported polynomial.",
+		 function );
+
+		return( -1 );
+	}
+	assorted_crc64_cached_tables_lock_grab();
+
+	for( table_index = 0;
+	     table_index < assorted_crc64_number_of_cached_tables;
+	     table_index++ )
+	{
+		if( assorted_crc64_cached_tables[ table_index ].polynomial == polynomial )
+		{
+			*polynomial_table = &( assorted_crc64_cached_tables[ table_index ] );
+
+			result = 1;
+
+			break;
+		}
+	}
+	if( ( result == 0 )
+	 && ( assorted_crc64_number_of_cached_tables < ASSORTED_CRC64_NUMBER_OF_CACHED_TABLES ) )
+	{
+		assorted_crc64_compute_polynomial_table(
+		 &( assorted_crc64_cached_tables[ assorted_crc64_number_of_cached_tables ] ),
+		 polynomial );
+
+		*polynomial_table = &( assorted_crc64_cached_tables[ assorted_crc64_number_of_cached_tables ] );
+
+		assorted_crc64_number_of_cached_tables++;
+
+		result = 1;
+	}
+	assorted_crc64_cached_tables_lock_release();
+
+	return( result );
+}
+
+/* Determines the carry-less multiplication fold method supported by the CPU
+ * Returns the fold method
+ */
+int assorted_crc64_get_fold_method(
+     void )
+{
+#if defined( ASSORTED_CRC64_HAVE_PCLMUL ) || defined( ASSORTED_CRC64_HAVE_PMULL )
+	uint32_t cpu_features = 0;
+#endif
+	int fold_method       = ASSORTED_CRC64_FOLD_METHOD_NONE;
+
+#if defined( ASSORTED_CRC64_HAVE_PCLMUL )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( ( cpu_features & ASSORTED_CPU_FEATURE_PCLMUL ) != 0 )
+	 && ( ( cpu_features & ASSORTED_CPU_FEATURE_SSE4_1 ) != 0 ) )
+	{
+		fold_method = ASSORTED_CRC64_FOLD_METHOD_PCLMUL;
+	}
+#elif defined( ASSORTED_CRC64_HAVE_PMULL )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_PMULL ) != 0 )
+	{
+		fold_method = ASSORTED_CRC64_FOLD_METHOD_PMULL;
+	}
+#endif
+	return( fold_method );
+}
+
+#if defined( ASSORTED_CRC64_HAVE_PCLMUL )
+
+/* Folds a 128-bit value over a distance and adds the next 128-bit value
+ */
+#define assorted_crc64_pclmul_fold( value_128bit, constants_128bit, next_value_128bit ) \
+	_mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x00 ), _mm_clmulepi64_si128( value_128bit, constants_128bit, 0x11 ) ), next_value_128bit )
+
+/* Calculates the CRC-64 of a buffer using PCLMULQDQ folding of 4 x 128-bit
+ * The CRC-64 is the value without the initial and final XOR
+ * The folded 128-bit value is reduced using the slicing table instead of a Barrett
+ * reduction, since the latter would require additional constants per polynomial
+ * The size must be at least 64 and a multiple of 16
+ * Returns the CRC-64
+ */
+__attribute__ ((target ("sse4.1,pclmul"))) uint64_t assorted_crc64_fold_pclmul(
+                                                     const assorted_crc64_polynomial_table_t *polynomial_table,
+                                                     uint64_t crc64,
+                                                     const uint8_t *buffer,
+                                                     size_t size )
+{
+	uint8_t value_data[ 16 ];
+
+	__m128i constants_128bit = _mm_set_epi64x( (long long) polynomial_table->fold_512_constants[ 1 ], (long long) polynomial_table->fold_512_constants[ 0 ] );
+	__m128i value_128bit1;
+	__m128i value_128bit2;
+	__m128i value_128bit3;
+	__m128i value_128bit4;
+
+	value_128bit1 = _mm_loadu_si128( (const __m128i *) buffer );
+	value_128bit2 = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+	value_128bit3 = _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) );
+	value_128bit4 = _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) );
+
+	value_128bit1 = _mm_xor_si128( value_128bit1, _mm_set_epi64x( 0, (long long) crc64 ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	while( size >= 64 )
+	{
+		value_128bit1 = assorted_crc64_pclmul_fold( value_128bit1, constants_128bit, _mm_loadu_si128( (const __m128i *) buffer ) );
+		value_128bit2 = assorted_crc64_pclmul_fold( value_128bit2, constants_128bit, _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ) );
+		value_128bit3 = assorted_crc64_pclmul_fold( value_128bit3, constants_128bit, _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ) );
+		value_128bit4 = assorted_crc64_pclmul_fold( value_128bit4, constants_128bit, _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold 4 x 128-bit into 128-bit
+	 */
+	constants_128bit = _mm_set_epi64x( (long long) polynomial_table->fold_128_constants[ 1 ], (long long) polynomial_table->fold_128_constants[ 0 ] );
+
+	value_128bit1 = assorted_crc64_pclmul_fold( value_128bit1, constants_128bit, value_128bit2 );
+	value_128bit1 = assorted_crc64_pclmul_fold( value_128bit1, constants_128bit, value_128bit3 );
+	value_128bit1 = assorted_crc64_pclmul_fold( value_128bit1, constants_128bit, value_128bit4 );
+
+	while( size >= 16 )
+	{
+		value_128bit1 = assorted_crc64_pclmul_fold( value_128bit1, constants_128bit, _mm_loadu_si128( (const __m128i *) buffer ) );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	/* The folded 128-bit value has the same CRC-64 as the data
+	 */
+	_mm_storeu_si128( (__m128i *) value_data, value_128bit1 );
+
+	return( assorted_crc64_update_slicing_by_8(
+	         polynomial_table->slicing_table,
+	         0,
+	         value_data,
+	         16 ) );
+}
+
+#endif /* defined( ASSORTED_CRC64_HAVE_PCLMUL ) */
+
+#if defined( ASSORTED_CRC64_HAVE_PMULL )
+
+#if defined( __clang__ )
+#define ASSORTED_CRC64_TARGET_PMULL	__attribute__ ((target ("aes")))
+#else
+#define ASSORTED_CRC64_TARGET_PMULL	__attribute__ ((target ("+crypto")))
+#endif
+
+/* Multiplies the lower 64-bit of 2 128-bit values without carry
+ */
+static inline ASSORTED_CRC64_TARGET_PMULL uint64x2_t assorted_crc64_pmull_lower(
+                                                      uint64x2_t value_128bit1,
+                                                      uint64x2_t value_128bit2 )
+{
+	return( vreinterpretq_u64_p128( vmull_p64( (poly64_t) vgetq_lane_u64( value_128bit1, 0 ), (poly64_t) vgetq_lane_u64( value_128bit2, 0 ) ) ) );
+}
+
+/* Multiplies the upper 64-bit of 2 128-bit values without carry
+ */
+static inline ASSORTED_CRC64_TARGET_PMULL uint64x2_t assorted_crc64_pmull_upper(
+                                                      uint64x2_t value_128bit1,
+                                                      uint64x2_t value_128bit2 )
+{
+	return( vreinterpretq_u64_p128( vmull_p64( (poly64_t) vgetq_lane_u64( value_128bit1, 1 ), (poly64_t) vgetq_lane_u64( value_128bit2, 1 ) ) ) );
+}
+
+/* Folds a 128-bit value over a distance and adds the next 128-bit value
+ */
+#define assorted_crc64_pmull_fold( value_128bit, constants_128bit, next_value_128bit ) \
+	veorq_u64( veorq_u64( assorted_crc64_pmull_lower( value_128bit, constants_128bit ), assorted_crc64_pmull_upper( value_128bit, constants_128bit ) ), next_value_128bit )
+
+/* Calculates the CRC-64 of a buffer using PMULL folding of 4 x 128-bit
+ * The CRC-64 is the value without the initial and final XOR
+ * The folded 128-bit value is reduced using the slicing table
+ * The size must be at least 64 and a multiple of 16
+ * Returns the CRC-64
+ */
+ASSORTED_CRC64_TARGET_PMULL uint64_t assorted_crc64_fold_pmull(
+                                      const assorted_crc64_polynomial_table_t *polynomial_table,
+                                      uint64_t crc64,
+                                      const uint8_t *buffer,
+                                      size_t size )
+{
+	uint8_t value_data[ 16 ];
+
+	uint64x2_t constants_128bit = vld1q_u64( polynomial_table->fold_512_constants );
+	uint64x2_t value_128bit1;
+	uint64x2_t value_128bit2;
+	uint64x2_t value_128bit3;
+	uint64x2_t value_128bit4;
+
+	value_128bit1 = vld1q_u64( (const uint64_t *) buffer );
+	value_128bit2 = vld1q_u64( (const uint64_t *) &( buffer[ 16 ] ) );
+	value_128bit3 = vld1q_u64( (const uint64_t *) &( buffer[ 32 ] ) );
+	value_128bit4 = vld1q_u64( (const uint64_t *) &( buffer[ 48 ] ) );
+
+	value_128bit1 = veorq_u64( value_128bit1, vcombine_u64( vcreate_u64( crc64 ), vcreate_u64( 0 ) ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	while( size >= 64 )
+	{
+		value_128bit1 = assorted_crc64_pmull_fold( value_128bit1, constants_128bit, vld1q_u64( (const uint64_t *) buffer ) );
+		value_128bit2 = assorted_crc64_pmull_fold( value_128bit2, constants_128bit, vld1q_u64( (const uint64_t *) &( buffer[ 16 ] ) ) );
+		value_128bit3 = assorted_crc64_pmull_fold( value_128bit3, constants_128bit, vld1q_u64( (const uint64_t *) &( buffer[ 32 ] ) ) );
+		value_128bit4 = assorted_crc64_pmull_fold( value_128bit4, constants_128bit, vld1q_u64( (const uint64_t *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold 4 x 128-bit into 128-bit
+	 */
+	constants_128bit = vld1q_u64( polynomial_table->fold_128_constants );
+
+	value_128bit1 = assorted_crc64_pmull_fold( value_128bit1, constants_128bit, value_128bit2 );
+	value_128bit1 = assorted_crc64_pmull_fold( value_128bit1, constants_128bit, value_128bit3 );
+	value_128bit1 = assorted_crc64_pmull_fold( value_128bit1, constants_128bit, value_128bit4 );
+
+	while( size >= 16 )
+	{
+		value_128bit1 = assorted_crc64_pmull_fold( value_128bit1, constants_128bit, vld1q_u64( (const uint64_t *) buffer ) );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	/* The folded 128-bit value has the same CRC-64 as the data
+	 */
+	vst1q_u64( (uint64_t *) value_data, value_128bit1 );
+
+	return( assorted_crc64_update_slicing_by_8(
+	         polynomial_table->slicing_table,
+	         0,
+	         value_data,
+	         16 ) );
+}
+
+#endif /* defined( ASSORTED_CRC64_HAVE_PMULL ) */
+
+/* Calculates the CRC-64 of a buffer
+ * Uses carry-less multiplication folding when supported by the CPU,
+ * otherwise or for the remaining bytes slicing-by-8
+ * Use the reversed polynomial, such as ASSORTED_CRC64_POLYNOMIAL_XZ
+ * Use a previous key of 0 to calculate a new CRC-64
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_crc64_calculate_with_polynomial(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     uint8_t weak_crc,
+     uint64_t polynomial,
+     libcerror_error_t **error )
+{
+	assorted_crc64_polynomial_table_t *temporary_table       = NULL;
+	const assorted_crc64_polynomial_table_t *polynomial_table = NULL;
+	static char *function                                     = "assorted_crc64_calculate_with_polynomial";
+	size_t buffer_offset                                      = 0;
+	uint64_t safe_crc64                                       = 0;
+	int fold_method                                           = 0;
+	int result                                                = 0;
+
+	if( crc64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = assorted_crc64_get_polynomial_table(
+	          polynomial,
+	          &polynomial_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve polynomial table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		temporary_table = memory_allocate_structure(
+		                   assorted_crc64_polynomial_table_t );
+
+		if( temporary_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create polynomial table.",
+			 function );
+
+			return( -1 );
+		}
+		assorted_crc64_compute_polynomial_table(
+		 temporary_table,
+		 polynomial );
+
+		polynomial_table = temporary_table;
+	}
+	safe_crc64 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		safe_crc64 ^= (uint64_t) 0xffffffffffffffffULL;
+	}
+	fold_method = assorted_crc64_get_fold_method();
+
+#if defined( ASSORTED_CRC64_HAVE_PCLMUL )
+	if( ( fold_method == ASSORTED_CRC64_FOLD_METHOD_PCLMUL )
+	 && ( size >= 64 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		safe_crc64 = assorted_crc64_fold_pclmul(
+		              polynomial_table,
+		              safe_crc64,
+		              buffer,
+		              buffer_offset );
+	}
+#endif
+#if defined( ASSORTED_CRC64_HAVE_PMULL )
+	if( ( fold_method == ASSORTED_CRC64_FOLD_METHOD_PMULL )
+	 && ( size >= 64 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		safe_crc64 = assorted_crc64_fold_pmull(
+		              polynomial_table,
+		              safe_crc64,
+		              buffer,
+		              buffer_offset );
+	}
+#endif
+	safe_crc64 = assorted_crc64_update_slicing_by_8(
+	              polynomial_table->slicing_table,
+	              safe_crc64,
+	              &( buffer[ buffer_offset ] ),
+	              size - buffer_offset );
+
+	if( weak_crc == 0 )
+	{
+		safe_crc64 ^= 0xffffffffffffffffULL;
+	}
+	if( temporary_table != NULL )
+	{
+		memory_free(
+		 temporary_table );
+	}
+	*crc64 = safe_crc64;
+
+	return( 1 );
+}
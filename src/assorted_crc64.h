@@ -31,21 +31,118 @@
 extern "C" {
 #endif
 
+/* The carry-less multiplication folding kernels are available with GCC compatible
+ * compilers on x86 and on little-endian ARMv8 Linux, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define ASSORTED_CRC64_HAVE_PCLMUL
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ ) && defined( __linux__ )
+#define ASSORTED_CRC64_HAVE_PMULL
+
+#endif
+
+/* The reversed polynomials of CRC-64/XZ (ECMA-182) and CRC-64/NVMe
+ */
+#define ASSORTED_CRC64_POLYNOMIAL_XZ		0xc96c5795d7870f42ULL
+#define ASSORTED_CRC64_POLYNOMIAL_NVME		0x9a6c9329ac4bc9b5ULL
+
+/* The number of polynomial tables that are cached
+ */
+#define ASSORTED_CRC64_NUMBER_OF_CACHED_TABLES	4
+
+enum ASSORTED_CRC64_FOLD_METHODS
+{
+	ASSORTED_CRC64_FOLD_METHOD_NONE		= 0x00,
+	ASSORTED_CRC64_FOLD_METHOD_PCLMUL	= 0x01,
+	ASSORTED_CRC64_FOLD_METHOD_PMULL	= 0x02
+};
+
+typedef struct assorted_crc64_polynomial_table assorted_crc64_polynomial_table_t;
+
+struct assorted_crc64_polynomial_table
+{
+	/* The reversed polynomial
+	 */
+	uint64_t polynomial;
+
+	/* Tables of the CRC-64 of all 8-bit messages followed by 0 to 7 zero bytes
+	 */
+	uint64_t slicing_table[ 8 ][ 256 ];
+
+	/* The constants to fold a 128-bit value over 512 and 128 bits,
+	 * the first is multiplied with the lower and the second with the upper 64-bit
+	 */
+	uint64_t fold_512_constants[ 2 ];
+	uint64_t fold_128_constants[ 2 ];
+};
+
 void initialize_crc64_table(
       uint64_t polynomial );
 
 int assorted_crc64_calculate_1(
      uint64_t *crc64,
-     uint8_t *buffer,
+     const uint8_t *buffer,
      size_t size,
      uint64_t initial_value,
      libcerror_error_t **error );
 
 int assorted_crc64_calculate_2(
      uint64_t *crc64,
-     uint8_t *buffer,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
+int assorted_crc64_calculate_ecma182_slicing_by_8(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
+int assorted_crc64_calculate_xz_slicing_by_8(
+     uint64_t *crc64,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
+int assorted_crc64_get_polynomial_table(
+     uint64_t polynomial,
+     const assorted_crc64_polynomial_table_t **polynomial_table,
+     libcerror_error_t **error );
+
+int assorted_crc64_get_fold_method(
+     void );
+
+#if defined( ASSORTED_CRC64_HAVE_PCLMUL )
+
+uint64_t assorted_crc64_fold_pclmul(
+          const assorted_crc64_polynomial_table_t *polynomial_table,
+          uint64_t crc64,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_CRC64_HAVE_PCLMUL ) */
+
+#if defined( ASSORTED_CRC64_HAVE_PMULL )
+
+uint64_t assorted_crc64_fold_pmull(
+          const assorted_crc64_polynomial_table_t *polynomial_table,
+          uint64_t crc64,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_CRC64_HAVE_PMULL ) */
+
+int assorted_crc64_calculate_with_polynomial(
+     uint64_t *crc64,
+     const uint8_t *buffer,
      size_t size,
      uint64_t initial_value,
+     uint8_t weak_crc,
+     uint64_t polynomial,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
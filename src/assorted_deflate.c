@@ -24,11 +24,20 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_DECODE_STATISTICS )
+#include <time.h>
+#endif
+
+#include "assorted_adler32.h"
+#include "assorted_arena.h"
 #include "assorted_bit_stream.h"
+#include "assorted_bit_stream_writer.h"
+#include "assorted_crc32.h"
 #include "assorted_deflate.h"
 #include "assorted_huffman_tree.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
+#include "assorted_unused.h"
 
 const uint8_t assorted_deflate_code_sizes_sequence[ 19 ] = {
 	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
@@ -51,6 +60,333 @@ const uint16_t assorted_deflate_distance_codes_number_of_extra_bits[ 30 ] = {
 	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
 	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
 
+/* The values of the literals and lengths symbols that are stored alongside the symbols
+ * in the Huffman lookup table entries, above the 9 symbol bits. The value of a length
+ * symbol consists of: base << 3 | number of extra bits
+ */
+const uint32_t assorted_deflate_literal_symbol_values[ 288 ] = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0018, 0x0020, 0x0028, 0x0030, 0x0038, 0x0040, 0x0048,
+	0x0050, 0x0059, 0x0069, 0x0079, 0x0089, 0x009a, 0x00ba, 0x00da,
+	0x00fa, 0x011b, 0x015b, 0x019b, 0x01db, 0x021c, 0x029c, 0x031c,
+	0x039c, 0x041d, 0x051d, 0x061d, 0x071d, 0x0810, 0x0000, 0x0000 };
+
+/* The values of the distances symbols that are stored alongside the symbols
+ * in the Huffman lookup table entries, above the 5 symbol bits. The value of
+ * a distance symbol consists of: base << 4 | number of extra bits
+ */
+const uint32_t assorted_deflate_distance_symbol_values[ 30 ] = {
+	0x0010, 0x0020, 0x0030, 0x0040, 0x0051, 0x0071, 0x0092, 0x00d2,
+	0x0113, 0x0193, 0x0214, 0x0314, 0x0415, 0x0615, 0x0816, 0x0c16,
+	0x1017, 0x1817, 0x2018, 0x3018, 0x4019, 0x6019, 0x801a, 0xc01a,
+	0x1001b, 0x1801b, 0x2001c, 0x3001c, 0x4001d, 0x6001d };
+
+/* The length code, relative to 257, of a match size - 3
+ */
+const uint8_t assorted_deflate_length_codes[ 256 ] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11,
+	12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15,
+	16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17,
+	18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+	22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28 };
+/* The distance code of a distance - 1, distances of 256 and
+ * larger are stored at 256 + ( ( distance - 1 ) >> 7 )
+ */
+const uint8_t assorted_deflate_distance_codes[ 512 ] = {
+	0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+	8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	0, 0, 16, 17, 18, 18, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21,
+	22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+	28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29 };
+
+/* The fast decoding loop requires room for a match of the maximum size
+ * and the overrun of the last 8-byte word copy of the match
+ */
+#define ASSORTED_DEFLATE_DECODE_FAST_MINIMUM_OUTPUT_SIZE	( 258 + 8 )
+
+#define ASSORTED_DEFLATE_COMPRESSOR_HASH_TABLE_BITS		15
+#define ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SYMBOLS	16384
+#define ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE			32768
+
+/* The optimal parsing of compression level 10 is done per block of data
+ * of at most 256 KiB, that is split into the blocks that are written
+ */
+#define ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_BLOCK_SIZE			262144
+#define ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_MATCHES_SIZE		( 4 * ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_BLOCK_SIZE )
+#define ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_MATCHES		32
+#define ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SPLIT_BLOCKS	32
+#define ASSORTED_DEFLATE_COMPRESSOR_MINIMUM_SPLIT_NUMBER_OF_SYMBOLS	512
+#define ASSORTED_DEFLATE_COMPRESSOR_NUMBER_OF_SPLIT_POINTS		9
+
+/* Retrieves the distance code of a distance - 1
+ */
+#define assorted_deflate_get_distance_code( distance ) \
+	( ( ( distance ) < 256 ) ? assorted_deflate_distance_codes[ distance ] : assorted_deflate_distance_codes[ 256 + ( ( distance ) >> 7 ) ] )
+
+/* Calculates the hash value of the 3 bytes at an offset in the data
+ */
+#define assorted_deflate_compressor_get_hash_value( data, offset ) \
+	( ( (uint32_t) ( ( (uint32_t) ( data )[ offset ] | ( (uint32_t) ( data )[ offset + 1 ] << 8 ) | ( (uint32_t) ( data )[ offset + 2 ] << 16 ) ) * (uint32_t) 0x9e3779b1UL ) ) >> ( 32 - ASSORTED_DEFLATE_COMPRESSOR_HASH_TABLE_BITS ) )
+
+/* Calculates the hash value of a 4-byte sequence, used by compression level 1
+ */
+#define assorted_deflate_compressor_get_fast_hash_value( value ) \
+	( ( (uint32_t) ( ( value ) * (uint32_t) 0x9e3779b1UL ) ) >> ( 32 - ASSORTED_DEFLATE_COMPRESSOR_HASH_TABLE_BITS ) )
+
+/* Adds a literal to the symbols of the current block
+ */
+#define assorted_deflate_compressor_add_literal( compressor, literal ) \
+	compressor->symbols[ compressor->number_of_symbols++ ] = (uint32_t) ( literal ); \
+	compressor->literals_frequencies[ literal ] += 1; \
+	compressor->block_size                      += 1;
+
+/* Adds a match to the symbols of the current block
+ */
+#define assorted_deflate_compressor_add_match( compressor, match_size, match_distance ) \
+	compressor->symbols[ compressor->number_of_symbols++ ] = 0x80000000UL | ( (uint32_t) ( match_size - 3 ) << 16 ) | (uint32_t) ( match_distance - 1 ); \
+	compressor->literals_frequencies[ 257 + assorted_deflate_length_codes[ match_size - 3 ] ] += 1; \
+	compressor->distances_frequencies[ assorted_deflate_get_distance_code( match_distance - 1 ) ] += 1; \
+	compressor->block_size += match_size;
+
+/* Adds a symbol to literals and lengths and distances frequencies and the corresponding data size
+ */
+#define assorted_deflate_compressor_count_symbol( symbol, literals_frequencies, distances_frequencies, data_size ) \
+	if( ( ( symbol ) & 0x80000000UL ) == 0 ) \
+	{ \
+		literals_frequencies[ symbol ] += 1; \
+		data_size                      += 1; \
+	} \
+	else \
+	{ \
+		literals_frequencies[ 257 + assorted_deflate_length_codes[ ( ( symbol ) >> 16 ) & 0x00ff ] ] += 1; \
+		distances_frequencies[ assorted_deflate_get_distance_code( ( symbol ) & 0x7fff ) ] += 1; \
+		data_size += ( ( ( symbol ) >> 16 ) & 0x00ff ) + 3; \
+	}
+
+/* Determines the size of a match of the data at match_offset and data_offset,
+ * where match_size bytes are known to match and the size is limited to maximum_match_size
+ * On little-endian hosts 8 bytes are compared at a time
+ */
+#if defined( __GNUC__ ) && defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+
+#define assorted_deflate_compressor_get_match_size( data, match_offset, data_offset, match_size, maximum_match_size, value1, value2 ) \
+	while( ( match_size + 8 ) <= maximum_match_size ) \
+	{ \
+		__builtin_memcpy( &( value1 ), &( ( data )[ match_offset + match_size ] ), 8 ); \
+		__builtin_memcpy( &( value2 ), &( ( data )[ data_offset + match_size ] ), 8 ); \
+\
+		value1 ^= value2; \
+\
+		if( value1 != 0 ) \
+		{ \
+			match_size += (size_t) ( __builtin_ctzll( value1 ) >> 3 ); \
+\
+			break; \
+		} \
+		match_size += 8; \
+	} \
+	while( ( match_size < maximum_match_size ) \
+	    && ( ( data )[ match_offset + match_size ] == ( data )[ data_offset + match_size ] ) ) \
+	{ \
+		match_size++; \
+	}
+
+#else
+
+#define assorted_deflate_compressor_get_match_size( data, match_offset, data_offset, match_size, maximum_match_size, value1, value2 ) \
+	while( ( match_size < maximum_match_size ) \
+	    && ( ( data )[ match_offset + match_size ] == ( data )[ data_offset + match_size ] ) ) \
+	{ \
+		match_size++; \
+	}
+
+#endif /* defined( __GNUC__ ) && defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) */
+
+/* The lookup table of the fixed literals and lengths Huffman codes with their symbol values
+ * for a back to front bit stream, as built by assorted_huffman_tree_build_lookup_table
+ */
+const uint32_t assorted_deflate_fixed_huffman_literals_lookup_table[ 512 ] = {
+	0x00010007, 0x00005008, 0x00001008, 0x07391808, 0x01f51007, 0x00007008, 0x00003008, 0x0000c009,
+	0x00a10807, 0x00006008, 0x00002008, 0x0000a009, 0x00000008, 0x00008008, 0x00004008, 0x0000e009,
+	0x00610407, 0x00005808, 0x00001808, 0x00009009, 0x03b71407, 0x00007808, 0x00003808, 0x0000d009,
+	0x01130c07, 0x00006808, 0x00002808, 0x0000b009, 0x00000808, 0x00008808, 0x00004808, 0x0000f009,
+	0x00410207, 0x00005408, 0x00001408, 0x0e3b1c08, 0x02b71207, 0x00007408, 0x00003408, 0x0000c809,
+	0x00d30a07, 0x00006408, 0x00002408, 0x0000a809, 0x00000408, 0x00008408, 0x00004408, 0x0000e809,
+	0x00810607, 0x00005c08, 0x00001c08, 0x00009809, 0x05391607, 0x00007c08, 0x00003c08, 0x0000d809,
+	0x01750e07, 0x00006c08, 0x00002c08, 0x0000b809, 0x00000c08, 0x00008c08, 0x00004c08, 0x0000f809,
+	0x00310107, 0x00005208, 0x00001208, 0x0a3b1a08, 0x02371107, 0x00007208, 0x00003208, 0x0000c409,
+	0x00b30907, 0x00006208, 0x00002208, 0x0000a409, 0x00000208, 0x00008208, 0x00004208, 0x0000e409,
+	0x00710507, 0x00005a08, 0x00001a08, 0x00009409, 0x04391507, 0x00007a08, 0x00003a08, 0x0000d409,
+	0x01350d07, 0x00006a08, 0x00002a08, 0x0000b409, 0x00000a08, 0x00008a08, 0x00004a08, 0x0000f409,
+	0x00510307, 0x00005608, 0x00001608, 0x00011e08, 0x03371307, 0x00007608, 0x00003608, 0x0000cc09,
+	0x00f30b07, 0x00006608, 0x00002608, 0x0000ac09, 0x00000608, 0x00008608, 0x00004608, 0x0000ec09,
+	0x00910707, 0x00005e08, 0x00001e08, 0x00009c09, 0x06391707, 0x00007e08, 0x00003e08, 0x0000dc09,
+	0x01b50f07, 0x00006e08, 0x00002e08, 0x0000bc09, 0x00000e08, 0x00008e08, 0x00004e08, 0x0000fc09,
+	0x00010007, 0x00005108, 0x00001108, 0x083b1908, 0x01f51007, 0x00007108, 0x00003108, 0x0000c209,
+	0x00a10807, 0x00006108, 0x00002108, 0x0000a209, 0x00000108, 0x00008108, 0x00004108, 0x0000e209,
+	0x00610407, 0x00005908, 0x00001908, 0x00009209, 0x03b71407, 0x00007908, 0x00003908, 0x0000d209,
+	0x01130c07, 0x00006908, 0x00002908, 0x0000b209, 0x00000908, 0x00008908, 0x00004908, 0x0000f209,
+	0x00410207, 0x00005508, 0x00001508, 0x10211d08, 0x02b71207, 0x00007508, 0x00003508, 0x0000ca09,
+	0x00d30a07, 0x00006508, 0x00002508, 0x0000aa09, 0x00000508, 0x00008508, 0x00004508, 0x0000ea09,
+	0x00810607, 0x00005d08, 0x00001d08, 0x00009a09, 0x05391607, 0x00007d08, 0x00003d08, 0x0000da09,
+	0x01750e07, 0x00006d08, 0x00002d08, 0x0000ba09, 0x00000d08, 0x00008d08, 0x00004d08, 0x0000fa09,
+	0x00310107, 0x00005308, 0x00001308, 0x0c3b1b08, 0x02371107, 0x00007308, 0x00003308, 0x0000c609,
+	0x00b30907, 0x00006308, 0x00002308, 0x0000a609, 0x00000308, 0x00008308, 0x00004308, 0x0000e609,
+	0x00710507, 0x00005b08, 0x00001b08, 0x00009609, 0x04391507, 0x00007b08, 0x00003b08, 0x0000d609,
+	0x01350d07, 0x00006b08, 0x00002b08, 0x0000b609, 0x00000b08, 0x00008b08, 0x00004b08, 0x0000f609,
+	0x00510307, 0x00005708, 0x00001708, 0x00011f08, 0x03371307, 0x00007708, 0x00003708, 0x0000ce09,
+	0x00f30b07, 0x00006708, 0x00002708, 0x0000ae09, 0x00000708, 0x00008708, 0x00004708, 0x0000ee09,
+	0x00910707, 0x00005f08, 0x00001f08, 0x00009e09, 0x06391707, 0x00007f08, 0x00003f08, 0x0000de09,
+	0x01b50f07, 0x00006f08, 0x00002f08, 0x0000be09, 0x00000f08, 0x00008f08, 0x00004f08, 0x0000fe09,
+	0x00010007, 0x00005008, 0x00001008, 0x07391808, 0x01f51007, 0x00007008, 0x00003008, 0x0000c109,
+	0x00a10807, 0x00006008, 0x00002008, 0x0000a109, 0x00000008, 0x00008008, 0x00004008, 0x0000e109,
+	0x00610407, 0x00005808, 0x00001808, 0x00009109, 0x03b71407, 0x00007808, 0x00003808, 0x0000d109,
+	0x01130c07, 0x00006808, 0x00002808, 0x0000b109, 0x00000808, 0x00008808, 0x00004808, 0x0000f109,
+	0x00410207, 0x00005408, 0x00001408, 0x0e3b1c08, 0x02b71207, 0x00007408, 0x00003408, 0x0000c909,
+	0x00d30a07, 0x00006408, 0x00002408, 0x0000a909, 0x00000408, 0x00008408, 0x00004408, 0x0000e909,
+	0x00810607, 0x00005c08, 0x00001c08, 0x00009909, 0x05391607, 0x00007c08, 0x00003c08, 0x0000d909,
+	0x01750e07, 0x00006c08, 0x00002c08, 0x0000b909, 0x00000c08, 0x00008c08, 0x00004c08, 0x0000f909,
+	0x00310107, 0x00005208, 0x00001208, 0x0a3b1a08, 0x02371107, 0x00007208, 0x00003208, 0x0000c509,
+	0x00b30907, 0x00006208, 0x00002208, 0x0000a509, 0x00000208, 0x00008208, 0x00004208, 0x0000e509,
+	0x00710507, 0x00005a08, 0x00001a08, 0x00009509, 0x04391507, 0x00007a08, 0x00003a08, 0x0000d509,
+	0x01350d07, 0x00006a08, 0x00002a08, 0x0000b509, 0x00000a08, 0x00008a08, 0x00004a08, 0x0000f509,
+	0x00510307, 0x00005608, 0x00001608, 0x00011e08, 0x03371307, 0x00007608, 0x00003608, 0x0000cd09,
+	0x00f30b07, 0x00006608, 0x00002608, 0x0000ad09, 0x00000608, 0x00008608, 0x00004608, 0x0000ed09,
+	0x00910707, 0x00005e08, 0x00001e08, 0x00009d09, 0x06391707, 0x00007e08, 0x00003e08, 0x0000dd09,
+	0x01b50f07, 0x00006e08, 0x00002e08, 0x0000bd09, 0x00000e08, 0x00008e08, 0x00004e08, 0x0000fd09,
+	0x00010007, 0x00005108, 0x00001108, 0x083b1908, 0x01f51007, 0x00007108, 0x00003108, 0x0000c309,
+	0x00a10807, 0x00006108, 0x00002108, 0x0000a309, 0x00000108, 0x00008108, 0x00004108, 0x0000e309,
+	0x00610407, 0x00005908, 0x00001908, 0x00009309, 0x03b71407, 0x00007908, 0x00003908, 0x0000d309,
+	0x01130c07, 0x00006908, 0x00002908, 0x0000b309, 0x00000908, 0x00008908, 0x00004908, 0x0000f309,
+	0x00410207, 0x00005508, 0x00001508, 0x10211d08, 0x02b71207, 0x00007508, 0x00003508, 0x0000cb09,
+	0x00d30a07, 0x00006508, 0x00002508, 0x0000ab09, 0x00000508, 0x00008508, 0x00004508, 0x0000eb09,
+	0x00810607, 0x00005d08, 0x00001d08, 0x00009b09, 0x05391607, 0x00007d08, 0x00003d08, 0x0000db09,
+	0x01750e07, 0x00006d08, 0x00002d08, 0x0000bb09, 0x00000d08, 0x00008d08, 0x00004d08, 0x0000fb09,
+	0x00310107, 0x00005308, 0x00001308, 0x0c3b1b08, 0x02371107, 0x00007308, 0x00003308, 0x0000c709,
+	0x00b30907, 0x00006308, 0x00002308, 0x0000a709, 0x00000308, 0x00008308, 0x00004308, 0x0000e709,
+	0x00710507, 0x00005b08, 0x00001b08, 0x00009709, 0x04391507, 0x00007b08, 0x00003b08, 0x0000d709,
+	0x01350d07, 0x00006b08, 0x00002b08, 0x0000b709, 0x00000b08, 0x00008b08, 0x00004b08, 0x0000f709,
+	0x00510307, 0x00005708, 0x00001708, 0x00011f08, 0x03371307, 0x00007708, 0x00003708, 0x0000cf09,
+	0x00f30b07, 0x00006708, 0x00002708, 0x0000af09, 0x00000708, 0x00008708, 0x00004708, 0x0000ef09,
+	0x00910707, 0x00005f08, 0x00001f08, 0x00009f09, 0x06391707, 0x00007f08, 0x00003f08, 0x0000df09,
+	0x01b50f07, 0x00006f08, 0x00002f08, 0x0000bf09, 0x00000f08, 0x00008f08, 0x00004f08, 0x0000ff09 };
+
+/* The lookup table of the fixed distances Huffman codes with their symbol values
+ * for a back to front bit stream, as built by assorted_huffman_tree_build_lookup_table
+ */
+const uint32_t assorted_deflate_fixed_huffman_distances_lookup_table[ 32 ] = {
+	0x00020005, 0x0202f005, 0x00226805, 0x20037805, 0x000a2405, 0x08033405, 0x0082ac05, 0x8003bc05,
+	0x00060205, 0x04031205, 0x00428a05, 0x40039a05, 0x00124605, 0x10035605, 0x0102ce05, 0x00000000,
+	0x00040105, 0x0302f105, 0x00326905, 0x30037905, 0x000e2505, 0x0c033505, 0x00c2ad05, 0xc003bd05,
+	0x00080305, 0x06031305, 0x00628b05, 0x60039b05, 0x001a4705, 0x18035705, 0x0182cf05, 0x00000000 };
+
+/* The fixed literals and lengths Huffman tree
+ * The tree only contains a prebuilt lookup table and must only be used
+ * to read symbols from a back to front bit stream
+ */
+assorted_huffman_tree_t assorted_deflate_fixed_huffman_literals_tree = {
+	15,
+	NULL,
+	NULL,
+	9,
+	ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	9,
+	0,
+	(uint32_t *) assorted_deflate_fixed_huffman_literals_lookup_table,
+	512,
+	NULL,
+	assorted_deflate_literal_symbol_values,
+	288,
+	9 };
+
+/* The fixed distances Huffman tree
+ * The tree only contains a prebuilt lookup table and must only be used
+ * to read symbols from a back to front bit stream
+ */
+assorted_huffman_tree_t assorted_deflate_fixed_huffman_distances_tree = {
+	15,
+	NULL,
+	NULL,
+	5,
+	ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	5,
+	0,
+	(uint32_t *) assorted_deflate_fixed_huffman_distances_lookup_table,
+	32,
+	NULL,
+	assorted_deflate_distance_symbol_values,
+	30,
+	5 };
+
 /* Reads and builds the dynamic Huffman trees
  * Returns 1 on success or -1 on error
  */
@@ -62,6 +398,7 @@ int assorted_deflate_build_dynamic_huffman_trees(
 {
 	uint8_t code_size_array[ 316 ];
 
+	assorted_arena_t *arena                         = NULL;
 	assorted_huffman_tree_t *pre_codes_huffman_tree = NULL;
 	static char *function                           = "assorted_deflate_build_dynamic_huffman_trees";
 	uint32_t code_size                              = 0;
@@ -73,7 +410,7 @@ int assorted_deflate_build_dynamic_huffman_trees(
 	uint32_t times_to_repeat                        = 0;
 	uint16_t symbol                                 = 0;
 
-	if( assorted_bit_stream_get_value(
+	if( assorted_bit_stream_get_value_back_to_front(
 	     bit_stream,
 	     14,
 	     &number_of_code_sizes,
@@ -148,7 +485,7 @@ int assorted_deflate_build_dynamic_huffman_trees(
 	     code_size_index < number_of_code_sizes;
 	     code_size_index++ )
 	{
-		if( assorted_bit_stream_get_value(
+		if( assorted_bit_stream_get_value_back_to_front(
 		     bit_stream,
 		     3,
 		     &code_size,
@@ -201,10 +538,18 @@ int assorted_deflate_build_dynamic_huffman_trees(
 		 "\n" );
 	}
 #endif
-	if( assorted_huffman_tree_initialize(
+	if( literals_huffman_tree != NULL )
+	{
+		arena = literals_huffman_tree->arena;
+	}
+	/* The pre-codes Huffman tree is allocated from the arena of the literals
+	 * Huffman tree, if any, to prevent an allocation per dynamic block
+	 */
+	if( assorted_huffman_tree_initialize_with_arena(
 	     &pre_codes_huffman_tree,
 	     19,
 	     15,
+	     arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -295,7 +640,7 @@ int assorted_deflate_build_dynamic_huffman_trees(
 			}
 			code_size = (uint32_t) code_size_array[ code_size_index - 1 ];
 
-			if( assorted_bit_stream_get_value(
+			if( assorted_bit_stream_get_value_back_to_front(
 			     bit_stream,
 			     2,
 			     &times_to_repeat,
@@ -314,7 +659,7 @@ int assorted_deflate_build_dynamic_huffman_trees(
 		}
 		else if( symbol == 17 )
 		{
-			if( assorted_bit_stream_get_value(
+			if( assorted_bit_stream_get_value_back_to_front(
 			     bit_stream,
 			     3,
 			     &times_to_repeat,
@@ -333,7 +678,7 @@ int assorted_deflate_build_dynamic_huffman_trees(
 		}
 		else if( symbol == 18 )
 		{
-			if( assorted_bit_stream_get_value(
+			if( assorted_bit_stream_get_value_back_to_front(
 			     bit_stream,
 			     7,
 			     &times_to_repeat,
@@ -422,6 +767,22 @@ int assorted_deflate_build_dynamic_huffman_trees(
 
 		goto on_error;
 	}
+	if( assorted_huffman_tree_set_symbol_values(
+	     literals_huffman_tree,
+	     assorted_deflate_literal_symbol_values,
+	     288,
+	     9,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set literals Huffman tree symbol values.",
+		 function );
+
+		goto on_error;
+	}
 	if( assorted_huffman_tree_build(
 	     literals_huffman_tree,
 	     code_size_array,
@@ -437,6 +798,26 @@ int assorted_deflate_build_dynamic_huffman_trees(
 
 		goto on_error;
 	}
+	/* The first 256 symbols are literals that can be decoded as a pair
+	 */
+	literals_huffman_tree->number_of_literal_symbols = 256;
+
+	if( assorted_huffman_tree_set_symbol_values(
+	     distances_huffman_tree,
+	     assorted_deflate_distance_symbol_values,
+	     30,
+	     5,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set distances Huffman tree symbol values.",
+		 function );
+
+		goto on_error;
+	}
 	if( assorted_huffman_tree_build(
 	     distances_huffman_tree,
 	     &( code_size_array[ number_of_literal_codes ] ),
@@ -502,6 +883,22 @@ int assorted_deflate_build_fixed_huffman_trees(
 			code_size_array[ symbol ] = 5;
 		}
 	}
+	if( assorted_huffman_tree_set_symbol_values(
+	     literals_huffman_tree,
+	     assorted_deflate_literal_symbol_values,
+	     288,
+	     9,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set literals Huffman tree symbol values.",
+		 function );
+
+		return( -1 );
+	}
 	if( assorted_huffman_tree_build(
 	     literals_huffman_tree,
 	     code_size_array,
@@ -517,6 +914,22 @@ int assorted_deflate_build_fixed_huffman_trees(
 
 		return( -1 );
 	}
+	if( assorted_huffman_tree_set_symbol_values(
+	     distances_huffman_tree,
+	     assorted_deflate_distance_symbol_values,
+	     30,
+	     5,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set distances Huffman tree symbol values.",
+		 function );
+
+		return( -1 );
+	}
 	if( assorted_huffman_tree_build(
 	     distances_huffman_tree,
 	     &( code_size_array[ 288 ] ),
@@ -535,25 +948,29 @@ int assorted_deflate_build_fixed_huffman_trees(
 	return( 1 );
 }
 
-/* Decodes a Huffman compressed block
+/* Copies a match (back reference) in the uncompressed data
+ * The match is copied 8 bytes at a time if its distance is 8 or more and
+ * if the uncompressed data contains at least 8 bytes after the match, since
+ * the last word copy can write up to 7 bytes beyond the end of the match.
+ * Matches with a distance of 1, 2 or 4 are copied by repeating an 8-byte
+ * pattern of the distance bytes. Other matches are copied a byte at a time
  * Returns 1 on success or -1 on error
  */
-int assorted_deflate_decode_huffman(
-     assorted_bit_stream_t *bit_stream,
-     assorted_huffman_tree_t *literals_huffman_tree,
-     assorted_huffman_tree_t *distances_huffman_tree,
+int assorted_deflate_copy_match(
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
-     size_t *uncompressed_data_offset,
+     size_t uncompressed_data_offset,
+     uint16_t compression_offset,
+     uint16_t compression_size,
      libcerror_error_t **error )
 {
-	static char *function         = "assorted_deflate_decode_huffman";
-	size_t data_offset            = 0;
-	uint32_t extra_bits           = 0;
-	uint16_t compression_offset   = 0;
-	uint16_t compression_size     = 0;
-	uint16_t number_of_extra_bits = 0;
-	uint16_t symbol               = 0;
+	uint8_t pattern[ 8 ];
+
+	static char *function  = "assorted_deflate_copy_match";
+	uint8_t *match_data    = NULL;
+	uint8_t *match_end     = NULL;
+	uint8_t *output_data   = NULL;
+	uint8_t pattern_offset = 0;
 
 	if( uncompressed_data == NULL )
 	{
@@ -577,484 +994,526 @@ int assorted_deflate_decode_huffman(
 
 		return( -1 );
 	}
-	if( uncompressed_data_offset == NULL )
+	if( uncompressed_data_offset > uncompressed_data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data offset.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	data_offset = *uncompressed_data_offset;
+	if( ( compression_offset == 0 )
+	 || ( (size_t) compression_offset > uncompressed_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compression offset value out of bounds.",
+		 function );
 
-	do
+		return( -1 );
+	}
+	if( (size_t) compression_size > ( uncompressed_data_size - uncompressed_data_offset ) )
 	{
-		if( assorted_huffman_tree_get_symbol_from_bit_stream(
-		     literals_huffman_tree,
-		     bit_stream,
-		     &symbol,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve symbol from literals Huffman tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+		 "%s: invalid uncompressed data value too small.",
+		 function );
 
-			return( -1 );
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: symbol\t\t\t\t\t\t: %" PRIu16 "\n",
-			 function,
-			 symbol );
-		}
-#endif
-		if( symbol < 256 )
+		return( -1 );
+	}
+	output_data = &( uncompressed_data[ uncompressed_data_offset ] );
+	match_data  = output_data - compression_offset;
+	match_end   = &( output_data[ compression_size ] );
+
+	if( ( uncompressed_data_size - uncompressed_data_offset ) >= ( (size_t) compression_size + 8 ) )
+	{
+		if( compression_offset >= 8 )
 		{
-			if( data_offset >= uncompressed_data_size )
+			/* The 8 bytes read are always before the 8 bytes written
+			 */
+			while( output_data < match_end )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
+				memory_copy(
+				 output_data,
+				 match_data,
+				 8 );
 
-				return( -1 );
+				output_data += 8;
+				match_data  += 8;
 			}
-			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+			return( 1 );
 		}
-		else if( ( symbol > 256 )
-		      && ( symbol < 286 ) )
+		if( ( compression_offset == 1 )
+		 || ( compression_offset == 2 )
+		 || ( compression_offset == 4 ) )
 		{
-			symbol -= 257;
-
-			number_of_extra_bits = assorted_deflate_literal_codes_number_of_extra_bits[ symbol ];
-
-			if( assorted_bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
+			for( pattern_offset = 0;
+			     pattern_offset < 8;
+			     pattern_offset++ )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve literal extra value from bit stream.",
-				 function );
-
-				return( -1 );
+				pattern[ pattern_offset ] = match_data[ pattern_offset % compression_offset ];
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			while( output_data < match_end )
 			{
-				libcnotify_printf(
-				 "%s: literal code\t\t\t\t\t: %" PRIu16 "\n",
-				 function,
-				 assorted_deflate_literal_codes_base[ symbol ] );
+				memory_copy(
+				 output_data,
+				 pattern,
+				 8 );
 
-				libcnotify_printf(
-				 "%s: extra bits\t\t\t\t\t: 0x%04" PRIx16 "\n",
-				 function,
-				 extra_bits );
+				output_data += 8;
 			}
-#endif
-			compression_size = assorted_deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
-
-			if( assorted_huffman_tree_get_symbol_from_bit_stream(
-			     distances_huffman_tree,
-			     bit_stream,
-			     &symbol,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve symbol from distances Huffman tree.",
-				 function );
+			return( 1 );
+		}
+	}
+	while( output_data < match_end )
+	{
+		*output_data++ = *match_data++;
+	}
+	return( 1 );
+}
 
-				return( -1 );
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: symbol\t\t\t\t\t\t: 0x%04" PRIx16 "\n",
-				 function,
-				 symbol );
-			}
+/* Decodes the symbols of a Huffman compressed block while the buffers have margin
+ * The loop runs while at least 8 bytes of compressed data remain and the uncompressed
+ * data has room for a match of the maximum size and the 8-byte copy overrun, so that
+ * the bit buffer can be refilled with a single 64-bit read per symbol and no per symbol
+ * bounds checks are needed. The remaining symbols are decoded by
+ * assorted_deflate_decode_huffman
+ * The Huffman trees must have a lookup table for a back to front bit stream with
+ * the deflate symbol values, so that the base and number of extra bits of a match
+ * size or distance are retrieved from the lookup table entry of its Huffman code
+ * The literals and matches are added to the statistics if not NULL
+ * Returns 1 if the end-of-block symbol was reached, 0 if not or -1 on error
+ */
+int assorted_deflate_decode_huffman_fast(
+     assorted_bit_stream_t *bit_stream,
+     assorted_huffman_tree_t *literals_huffman_tree,
+     assorted_huffman_tree_t *distances_huffman_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	const uint32_t *distances_lookup_table = NULL;
+	const uint32_t *literals_lookup_table  = NULL;
+	static char *function                  = "assorted_deflate_decode_huffman_fast";
+	uint8_t *match_data                    = NULL;
+	uint8_t *match_end                     = NULL;
+	uint8_t *output_data                   = NULL;
+	size_t byte_stream_offset              = 0;
+	size_t data_offset                     = 0;
+	uint64_t bit_buffer                    = 0;
+	uint64_t read_value                    = 0;
+	uint32_t distances_lookup_mask         = 0;
+	uint32_t entry                         = 0;
+	uint32_t literals_lookup_mask          = 0;
+	uint16_t compression_offset            = 0;
+	uint16_t compression_size              = 0;
+	uint16_t symbol                        = 0;
+	uint8_t bit_buffer_size                = 0;
+	uint8_t code_size                      = 0;
+	uint8_t distances_lookup_table_bits    = 0;
+	uint8_t literals_lookup_table_bits     = 0;
+	uint8_t number_of_extra_bits           = 0;
+	uint8_t read_size                      = 0;
+	int result                             = 0;
+
+#if !defined( HAVE_DECODE_STATISTICS )
+	ASSORTED_UNREFERENCED_PARAMETER( statistics )
 #endif
-			number_of_extra_bits = assorted_deflate_distance_codes_number_of_extra_bits[ symbol ];
 
-			if( assorted_bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve distance extra value from bit stream.",
-				 function );
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
 
-				return( -1 );
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: distance code\t\t\t\t\t: %" PRIu16 "\n",
-				 function,
-				 assorted_deflate_distance_codes_base[ symbol ] );
+		return( -1 );
+	}
+	if( bit_stream->storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid bit stream - unsupported storage type.",
+		 function );
 
-				libcnotify_printf(
-				 "%s: extra bits\t\t\t\t\t: 0x%04" PRIx16 "\n",
-				 function,
-				 extra_bits );
-			}
-#endif
-			compression_offset = assorted_deflate_distance_codes_base[ symbol ] + (uint16_t) extra_bits;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: uncompressed data offset\t\t\t: %" PRIzd "\n",
-				 function,
-				 data_offset );
-
-				libcnotify_printf(
-				 "%s: compression offset\t\t\t\t: %" PRIu16 "\n",
-				 function,
-				 compression_offset );
-
-				libcnotify_printf(
-				 "%s: compression size\t\t\t\t: %" PRIu16 "\n",
-				 function,
-				 compression_size );
-			}
-#endif
-			if( compression_offset > data_offset )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid compression offset value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			if( ( data_offset + compression_size ) > uncompressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
-
-				return( -1 );
-			}
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+		return( -1 );
+	}
+	if( literals_huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literals Huffman tree.",
+		 function );
 
-				data_offset++;
-				compression_size--;
-			}
-		}
-		else if( symbol != 256 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid symbol: %" PRIu16 ".",
-			 function,
-			 symbol );
+		return( -1 );
+	}
+	if( literals_huffman_tree->lookup_table_storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid literals Huffman tree - missing lookup table.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	while( symbol != 256 );
+	if( literals_huffman_tree->symbol_values != assorted_deflate_literal_symbol_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid literals Huffman tree - unsupported symbol values.",
+		 function );
 
-	*uncompressed_data_offset = data_offset;
+		return( -1 );
+	}
+	if( distances_huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distances Huffman tree.",
+		 function );
 
-	return( 1 );
-}
+		return( -1 );
+	}
+	if( distances_huffman_tree->lookup_table_storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid distances Huffman tree - missing lookup table.",
+		 function );
 
-/* Calculates the little-endian Adler-32 of a buffer
- * It uses the initial value to calculate a new Adler-32
- * Returns 1 if successful or -1 on error
- */
-int assorted_deflate_calculate_adler32(
-     uint32_t *checksum_value,
-     const uint8_t *data,
-     size_t data_size,
-     uint32_t initial_value,
-     libcerror_error_t **error )
-{
-	static char *function = "assorted_deflate_calculate_adler32";
-	size_t data_offset    = 0;
-	uint32_t lower_word   = 0;
-	uint32_t upper_word   = 0;
-	uint32_t value_32bit  = 0;
-	int block_index       = 0;
+		return( -1 );
+	}
+	if( distances_huffman_tree->symbol_values != assorted_deflate_distance_symbol_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid distances Huffman tree - unsupported symbol values.",
+		 function );
 
-	if( checksum_value == NULL )
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid checksum value.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( data == NULL )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_size > (size_t) SSIZE_MAX )
+	if( uncompressed_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
 		 function );
 
 		return( -1 );
 	}
-	lower_word = initial_value & 0xffff;
-	upper_word = ( initial_value >> 16 ) & 0xffff;
+	if( *uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
 
-	while( data_size >= 0x15b0 )
+		return( -1 );
+	}
+	literals_lookup_table       = literals_huffman_tree->lookup_table;
+	literals_lookup_table_bits  = literals_huffman_tree->lookup_table_bits;
+	literals_lookup_mask        = ( (uint32_t) 1 << literals_lookup_table_bits ) - 1;
+	distances_lookup_table      = distances_huffman_tree->lookup_table;
+	distances_lookup_table_bits = distances_huffman_tree->lookup_table_bits;
+	distances_lookup_mask       = ( (uint32_t) 1 << distances_lookup_table_bits ) - 1;
+
+	/* The bit stream state is kept in local variables for the duration of the loop
+	 */
+	bit_buffer         = bit_stream->bit_buffer;
+	bit_buffer_size    = bit_stream->bit_buffer_size;
+	byte_stream_offset = bit_stream->byte_stream_offset;
+	data_offset        = *uncompressed_data_offset;
+
+	/* After a refill the bit buffer contains at least 56 bits, which is sufficient
+	 * for a literal and length code with extra bits (15 + 5) and a distance code
+	 * with extra bits (15 + 13)
+	 */
+	while( ( ( bit_stream->byte_stream_size - byte_stream_offset ) >= 8 )
+	    && ( ( uncompressed_data_size - data_offset ) >= ASSORTED_DEFLATE_DECODE_FAST_MINIMUM_OUTPUT_SIZE ) )
 	{
-		/* The modulo calculation is needed per 5552 (0x15b0) bytes
-		 * 5552 / 16 = 347
-		 */
-		for( block_index = 0;
-		     block_index < 347;
-		     block_index++ )
-		{
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+		read_size = ( 63 - bit_buffer_size ) & 0x38;
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+		byte_stream_load_uint64_little_endian(
+		 &( bit_stream->byte_stream[ byte_stream_offset ] ),
+		 read_value );
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+		read_value &= ( (uint64_t) 1 << read_size ) - 1;
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+		bit_buffer         |= read_value << bit_buffer_size;
+		bit_buffer_size    += read_size;
+		byte_stream_offset += read_size >> 3;
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+		entry = literals_lookup_table[ bit_buffer & literals_lookup_mask ];
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+		if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_LITERAL_PAIR ) != 0 )
+		{
+			code_size = (uint8_t) ( entry & 0x3f );
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			bit_buffer      >>= code_size;
+			bit_buffer_size  -= code_size;
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			uncompressed_data[ data_offset++ ] = (uint8_t) ( entry >> 16 );
+			uncompressed_data[ data_offset++ ] = (uint8_t) ( entry >> 24 );
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->number_of_literals += 2;
+			}
+#endif
+			continue;
+		}
+		if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE ) != 0 )
+		{
+			entry = literals_lookup_table[ ( entry >> 8 ) + ( ( bit_buffer >> literals_lookup_table_bits ) & ( ( (uint32_t) 1 << ( entry & 0x3f ) ) - 1 ) ) ];
+		}
+		code_size = (uint8_t) ( entry & 0x3f );
+		symbol    = (uint16_t) ( ( entry >> 8 ) & 0x000001ffUL );
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+		if( code_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid literals Huffman code.",
+			 function );
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			goto on_error;
+		}
+		if( symbol < 256 )
+		{
+			bit_buffer      >>= code_size;
+			bit_buffer_size  -= code_size;
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->number_of_literals += 1;
+			}
+#endif
+			continue;
+		}
+		if( symbol == 256 )
+		{
+			bit_buffer      >>= code_size;
+			bit_buffer_size  -= code_size;
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			result = 1;
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			break;
+		}
+		if( symbol >= 286 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid symbol: %" PRIu16 ".",
+			 function,
+			 symbol );
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			goto on_error;
 		}
-		/* Optimized equivalent of:
-		 * lower_word %= 0xfff1
+		symbol -= 257;
+
+		/* The base and number of extra bits of the match size are stored
+		 * in the entry, the extra bits directly follow the Huffman code
 		 */
-		value_32bit = lower_word >> 16;
-		lower_word &= 0x0000ffffUL;
-		lower_word += ( value_32bit << 4 ) - value_32bit;
+		number_of_extra_bits = (uint8_t) ( ( entry >> 17 ) & 0x00000007UL );
+		compression_size     = (uint16_t) ( entry >> 20 ) + (uint16_t) ( ( bit_buffer >> code_size ) & ( ( (uint32_t) 1 << number_of_extra_bits ) - 1 ) );
 
-		if( lower_word > 65521 )
+		bit_buffer      >>= code_size + number_of_extra_bits;
+		bit_buffer_size  -= code_size + number_of_extra_bits;
+
+#if defined( HAVE_DECODE_STATISTICS )
+		if( statistics != NULL )
 		{
-			value_32bit = lower_word >> 16;
-			lower_word &= 0x0000ffffUL;
-			lower_word += ( value_32bit << 4 ) - value_32bit;
+			statistics->match_sizes[ symbol ] += 1;
 		}
-		if( lower_word >= 65521 )
+#endif
+		entry = distances_lookup_table[ bit_buffer & distances_lookup_mask ];
+
+		if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE ) != 0 )
 		{
-			lower_word -= 65521;
+			entry = distances_lookup_table[ ( entry >> 8 ) + ( ( bit_buffer >> distances_lookup_table_bits ) & ( ( (uint32_t) 1 << ( entry & 0x3f ) ) - 1 ) ) ];
 		}
-		/* Optimized equivalent of:
-		 * upper_word %= 0xfff1
-		 */
-		value_32bit = upper_word >> 16;
-		upper_word &= 0x0000ffffUL;
-		upper_word += ( value_32bit << 4 ) - value_32bit;
+		code_size = (uint8_t) ( entry & 0x3f );
 
-		if( upper_word > 65521 )
+		if( code_size == 0 )
 		{
-			value_32bit = upper_word >> 16;
-			upper_word &= 0x0000ffffUL;
-			upper_word += ( value_32bit << 4 ) - value_32bit;
-		}
-		if( upper_word >= 65521 )
-		{
-			upper_word -= 65521;
-		}
-		data_size -= 0x15b0;
-	}
-	if( data_size > 0 )
-	{
-		while( data_size > 16 )
-		{
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distances Huffman code.",
+			 function );
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			goto on_error;
+		}
+		number_of_extra_bits = (uint8_t) ( ( entry >> 13 ) & 0x0000000fUL );
+		compression_offset   = (uint16_t) ( entry >> 17 ) + (uint16_t) ( ( bit_buffer >> code_size ) & ( ( (uint32_t) 1 << number_of_extra_bits ) - 1 ) );
 
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+		bit_buffer      >>= code_size + number_of_extra_bits;
+		bit_buffer_size  -= code_size + number_of_extra_bits;
 
-			data_size -= 16;
-		}
-		while( data_size > 0 )
+#if defined( HAVE_DECODE_STATISTICS )
+		if( statistics != NULL )
 		{
-			lower_word += data[ data_offset++ ];
-			upper_word += lower_word;
+			symbol = (uint16_t) ( ( entry >> 8 ) & 0x0000001fUL );
 
-			data_size--;
+			statistics->number_of_matches         += 1;
+			statistics->match_distances[ symbol ] += 1;
 		}
-		/* Optimized equivalent of:
-		 * lower_word %= 0xfff1
-		 */
-		value_32bit = lower_word >> 16;
-		lower_word &= 0x0000ffffUL;
-		lower_word += ( value_32bit << 4 ) - value_32bit;
-
-		if( lower_word > 65521 )
+#endif
+		if( (size_t) compression_offset > data_offset )
 		{
-			value_32bit = lower_word >> 16;
-			lower_word &= 0x0000ffffUL;
-			lower_word += ( value_32bit << 4 ) - value_32bit;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compression offset value out of bounds.",
+			 function );
+
+			goto on_error;
 		}
-		if( lower_word >= 65521 )
+		if( compression_offset >= 8 )
 		{
-			lower_word -= 65521;
-		}
-		/* Optimized equivalent of:
-		 * upper_word %= 0xfff1
-		 */
-		value_32bit = upper_word >> 16;
-		upper_word &= 0x0000ffffUL;
-		upper_word += ( value_32bit << 4 ) - value_32bit;
+			/* The 8 bytes read are always before the 8 bytes written and the
+			 * uncompressed data has room for the last word copy to overrun
+			 */
+			output_data = &( uncompressed_data[ data_offset ] );
+			match_data  = output_data - compression_offset;
+			match_end   = &( output_data[ compression_size ] );
 
-		if( upper_word > 65521 )
-		{
-			value_32bit = upper_word >> 16;
-			upper_word &= 0x0000ffffUL;
-			upper_word += ( value_32bit << 4 ) - value_32bit;
+			do
+			{
+				memory_copy(
+				 output_data,
+				 match_data,
+				 8 );
+
+				output_data += 8;
+				match_data  += 8;
+			}
+			while( output_data < match_end );
 		}
-		if( upper_word >= 65521 )
+		else if( assorted_deflate_copy_match(
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          data_offset,
+		          compression_offset,
+		          compression_size,
+		          error ) != 1 )
 		{
-			upper_word -= 65521;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy match.",
+			 function );
+
+			goto on_error;
 		}
+		data_offset += compression_size;
 	}
-	*checksum_value = ( upper_word << 16 ) | lower_word;
+	bit_stream->bit_buffer         = bit_buffer;
+	bit_stream->bit_buffer_size    = bit_buffer_size;
+	bit_stream->byte_stream_offset = byte_stream_offset;
 
-	return( 1 );
+	*uncompressed_data_offset = data_offset;
+
+	return( result );
+
+on_error:
+	bit_stream->bit_buffer         = bit_buffer;
+	bit_stream->bit_buffer_size    = bit_buffer_size;
+	bit_stream->byte_stream_offset = byte_stream_offset;
+
+	return( -1 );
 }
 
-/* Compresses data using zlib compression
+/* Decodes a Huffman compressed block
+ * The literals and matches are added to the statistics if not NULL
  * Returns 1 on success or -1 on error
  */
-int assorted_deflate_compress(
-     const uint8_t *uncompressed_data,
+int assorted_deflate_decode_huffman(
+     assorted_bit_stream_t *bit_stream,
+     assorted_huffman_tree_t *literals_huffman_tree,
+     assorted_huffman_tree_t *distances_huffman_tree,
+     uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
-     int compression_level,
-     uint8_t *compressed_data,
-     size_t *compressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_deflate_statistics_t *statistics,
      libcerror_error_t **error )
 {
-	static char *function = "assorted_deflate_compress";
+	static char *function         = "assorted_deflate_decode_huffman";
+	size_t data_offset            = 0;
+	uint32_t extra_bits           = 0;
+	uint16_t compression_offset   = 0;
+	uint16_t compression_size     = 0;
+	uint16_t number_of_extra_bits = 0;
+	uint16_t second_symbol        = 0;
+	uint16_t symbol               = 0;
+	uint8_t number_of_symbols     = 0;
+	int result                    = 0;
+
+#if !defined( HAVE_DECODE_STATISTICS )
+	ASSORTED_UNREFERENCED_PARAMETER( statistics )
+#endif
 
 	if( uncompressed_data == NULL )
 	{
@@ -1078,1038 +1537,8113 @@ int assorted_deflate_compress(
 
 		return( -1 );
 	}
-	if( compressed_data == NULL )
+	if( uncompressed_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid uncompressed data offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size == NULL )
+	/* Decode the symbols with the fast loop while the buffers have margin,
+	 * which requires the lookup tables of both Huffman trees with the deflate
+	 * symbol values
+	 */
+	if( ( bit_stream != NULL )
+	 && ( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( literals_huffman_tree != NULL )
+	 && ( literals_huffman_tree->largest_code_size > 0 )
+	 && ( literals_huffman_tree->symbol_values == assorted_deflate_literal_symbol_values )
+	 && ( distances_huffman_tree != NULL )
+	 && ( distances_huffman_tree->largest_code_size > 0 )
+	 && ( distances_huffman_tree->symbol_values == assorted_deflate_distance_symbol_values )
+	 && ( *uncompressed_data_offset <= uncompressed_data_size ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data size.",
-		 function );
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose == 0 )
+#endif
+		{
+			if( literals_huffman_tree->lookup_table_storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+			{
+				if( assorted_huffman_tree_build_lookup_table(
+				     literals_huffman_tree,
+				     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to build literals Huffman tree lookup table.",
+					 function );
 
-		return( -1 );
+					return( -1 );
+				}
+			}
+			if( distances_huffman_tree->lookup_table_storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+			{
+				if( assorted_huffman_tree_build_lookup_table(
+				     distances_huffman_tree,
+				     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to build distances Huffman tree lookup table.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			result = assorted_deflate_decode_huffman_fast(
+			          bit_stream,
+			          literals_huffman_tree,
+			          distances_huffman_tree,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          uncompressed_data_offset,
+			          statistics,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode symbols.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 1 )
+			{
+				/* The end-of-block symbol was reached
+				 */
+				symbol = 256;
+			}
+		}
 	}
-	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	data_offset = *uncompressed_data_offset;
+
+	/* Decode the remaining symbols near the end of the buffers with bounds checks
+	 */
+	while( symbol != 256 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
+		if( assorted_huffman_tree_get_symbols_from_bit_stream(
+		     literals_huffman_tree,
+		     bit_stream,
+		     &symbol,
+		     &second_symbol,
+		     &number_of_symbols,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve symbol from literals Huffman tree.",
+			 function );
 
-		return( -1 );
-	}
-/* TODO implement */
-	libcerror_error_set(
-	 error,
-	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-	 LIBCERROR_RUNTIME_ERROR_GENERIC,
-	 "%s: NOT IMPLEMENTED YET",
-	 function );
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: symbol\t\t\t\t\t\t: %" PRIu16 "\n",
+			 function,
+			 symbol );
 
-	return( -1 );
-}
+			if( number_of_symbols == 2 )
+			{
+				libcnotify_printf(
+				 "%s: symbol\t\t\t\t\t\t: %" PRIu16 "\n",
+				 function,
+				 second_symbol );
+			}
+		}
+#endif
+		if( number_of_symbols == 2 )
+		{
+			if( ( data_offset + 1 ) >= uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
 
-/* Reads the compressed data header
- * Returns 1 on success or -1 on error
- */
-int assorted_deflate_read_data_header(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *compressed_data_offset,
-     libcerror_error_t **error )
-{
-	static char *function                 = "assorted_deflate_read_data_header";
-	size_t safe_compressed_data_offset    = 0;
-	uint32_t compression_window_size      = 0;
-	uint32_t preset_dictionary_identifier = 0;
-	uint8_t compression_information       = 0;
-	uint8_t compression_level             = 0;
-	uint8_t compression_method            = 0;
-	uint8_t compression_window_bits       = 0;
-	uint8_t flags                         = 0;
+				return( -1 );
+			}
+			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+			uncompressed_data[ data_offset++ ] = (uint8_t) second_symbol;
 
-	if( compressed_data == NULL )
-	{
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->number_of_literals += 2;
+			}
+#endif
+		}
+		else if( symbol < 256 )
+		{
+			if( data_offset >= uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
+
+				return( -1 );
+			}
+			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->number_of_literals += 1;
+			}
+#endif
+		}
+		else if( ( symbol > 256 )
+		      && ( symbol < 286 ) )
+		{
+			symbol -= 257;
+
+			number_of_extra_bits = assorted_deflate_literal_codes_number_of_extra_bits[ symbol ];
+
+			if( assorted_bit_stream_get_value_back_to_front(
+			     bit_stream,
+			     (uint8_t) number_of_extra_bits,
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve literal extra value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: literal code\t\t\t\t\t: %" PRIu16 "\n",
+				 function,
+				 assorted_deflate_literal_codes_base[ symbol ] );
+
+				libcnotify_printf(
+				 "%s: extra bits\t\t\t\t\t: 0x%04" PRIx16 "\n",
+				 function,
+				 extra_bits );
+			}
+#endif
+			compression_size = assorted_deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->match_sizes[ symbol ] += 1;
+			}
+#endif
+			if( assorted_huffman_tree_get_symbol_from_bit_stream(
+			     distances_huffman_tree,
+			     bit_stream,
+			     &symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve symbol from distances Huffman tree.",
+				 function );
+
+				return( -1 );
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: symbol\t\t\t\t\t\t: 0x%04" PRIx16 "\n",
+				 function,
+				 symbol );
+			}
+#endif
+			number_of_extra_bits = assorted_deflate_distance_codes_number_of_extra_bits[ symbol ];
+
+			if( assorted_bit_stream_get_value_back_to_front(
+			     bit_stream,
+			     (uint8_t) number_of_extra_bits,
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve distance extra value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: distance code\t\t\t\t\t: %" PRIu16 "\n",
+				 function,
+				 assorted_deflate_distance_codes_base[ symbol ] );
+
+				libcnotify_printf(
+				 "%s: extra bits\t\t\t\t\t: 0x%04" PRIx16 "\n",
+				 function,
+				 extra_bits );
+			}
+#endif
+			compression_offset = assorted_deflate_distance_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->number_of_matches         += 1;
+				statistics->match_distances[ symbol ] += 1;
+			}
+#endif
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: uncompressed data offset\t\t\t: %" PRIzd "\n",
+				 function,
+				 data_offset );
+
+				libcnotify_printf(
+				 "%s: compression offset\t\t\t\t: %" PRIu16 "\n",
+				 function,
+				 compression_offset );
+
+				libcnotify_printf(
+				 "%s: compression size\t\t\t\t: %" PRIu16 "\n",
+				 function,
+				 compression_size );
+			}
+#endif
+			if( assorted_deflate_copy_match(
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     data_offset,
+			     compression_offset,
+			     compression_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy match.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += compression_size;
+		}
+		else if( symbol != 256 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid symbol: %" PRIu16 ".",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+	}
+	*uncompressed_data_offset = data_offset;
+
+	return( 1 );
+}
+
+/* Calculates the little-endian Adler-32 of a buffer
+ * It uses the initial value to calculate a new Adler-32
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_calculate_adler32(
+     uint32_t *checksum_value,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_calculate_adler32";
+	size_t data_offset    = 0;
+	uint32_t lower_word   = 0;
+	uint32_t upper_word   = 0;
+	uint32_t value_32bit  = 0;
+	int block_index       = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	lower_word = initial_value & 0xffff;
+	upper_word = ( initial_value >> 16 ) & 0xffff;
+
+	while( data_size >= 0x15b0 )
+	{
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 16 = 347
+		 */
+		for( block_index = 0;
+		     block_index < 347;
+		     block_index++ )
+		{
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+		}
+		/* Optimized equivalent of:
+		 * lower_word %= 0xfff1
+		 */
+		value_32bit = lower_word >> 16;
+		lower_word &= 0x0000ffffUL;
+		lower_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( lower_word > 65521 )
+		{
+			value_32bit = lower_word >> 16;
+			lower_word &= 0x0000ffffUL;
+			lower_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( lower_word >= 65521 )
+		{
+			lower_word -= 65521;
+		}
+		/* Optimized equivalent of:
+		 * upper_word %= 0xfff1
+		 */
+		value_32bit = upper_word >> 16;
+		upper_word &= 0x0000ffffUL;
+		upper_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( upper_word > 65521 )
+		{
+			value_32bit = upper_word >> 16;
+			upper_word &= 0x0000ffffUL;
+			upper_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( upper_word >= 65521 )
+		{
+			upper_word -= 65521;
+		}
+		data_size -= 0x15b0;
+	}
+	if( data_size > 0 )
+	{
+		while( data_size > 16 )
+		{
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			data_size -= 16;
+		}
+		while( data_size > 0 )
+		{
+			lower_word += data[ data_offset++ ];
+			upper_word += lower_word;
+
+			data_size--;
+		}
+		/* Optimized equivalent of:
+		 * lower_word %= 0xfff1
+		 */
+		value_32bit = lower_word >> 16;
+		lower_word &= 0x0000ffffUL;
+		lower_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( lower_word > 65521 )
+		{
+			value_32bit = lower_word >> 16;
+			lower_word &= 0x0000ffffUL;
+			lower_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( lower_word >= 65521 )
+		{
+			lower_word -= 65521;
+		}
+		/* Optimized equivalent of:
+		 * upper_word %= 0xfff1
+		 */
+		value_32bit = upper_word >> 16;
+		upper_word &= 0x0000ffffUL;
+		upper_word += ( value_32bit << 4 ) - value_32bit;
+
+		if( upper_word > 65521 )
+		{
+			value_32bit = upper_word >> 16;
+			upper_word &= 0x0000ffffUL;
+			upper_word += ( value_32bit << 4 ) - value_32bit;
+		}
+		if( upper_word >= 65521 )
+		{
+			upper_word -= 65521;
+		}
+	}
+	*checksum_value = ( upper_word << 16 ) | lower_word;
+
+	return( 1 );
+}
+
+/* Creates a compressor
+ * Make sure the value compressor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_compressor_initialize(
+     assorted_deflate_compressor_t **compressor,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_compressor_initialize";
+	size_t array_size     = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level == -1 )
+	{
+		compression_level = 6;
+	}
+	if( ( compression_level < 0 )
+	 || ( compression_level > 10 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level: %d.",
+		 function,
+		 compression_level );
+
+		return( -1 );
+	}
+	*compressor = memory_allocate_structure(
+	               assorted_deflate_compressor_t );
+
+	if( *compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compressor,
+	     0,
+	     sizeof( assorted_deflate_compressor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressor.",
+		 function );
+
+		memory_free(
+		 *compressor );
+
+		*compressor = NULL;
+
+		return( -1 );
+	}
+	( *compressor )->compression_level = compression_level;
+
+	if( compression_level > 0 )
+	{
+		array_size = sizeof( size_t ) * ( 1 << ASSORTED_DEFLATE_COMPRESSOR_HASH_TABLE_BITS );
+
+		( *compressor )->hash_table = (size_t *) memory_allocate(
+		                                          array_size );
+
+		if( ( *compressor )->hash_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hash table.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *compressor )->hash_table,
+		     0,
+		     array_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear hash table.",
+			 function );
+
+			goto on_error;
+		}
+		if( compression_level == 10 )
+		{
+			array_size = sizeof( uint32_t ) * ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_BLOCK_SIZE;
+		}
+		else
+		{
+			array_size = sizeof( uint32_t ) * ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SYMBOLS;
+		}
+
+		( *compressor )->symbols = (uint32_t *) memory_allocate(
+		                                         array_size );
+
+		if( ( *compressor )->symbols == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create symbols.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( compression_level > 1 )
+	 && ( compression_level < 10 ) )
+	{
+		/* The chain table does not need to be cleared since only
+		 * entries of positions added to the hash table are read
+		 */
+		array_size = sizeof( size_t ) * ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
+
+		( *compressor )->chain_table = (size_t *) memory_allocate(
+		                                           array_size );
+
+		if( ( *compressor )->chain_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chain table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( compression_level == 10 )
+	{
+		/* The match tree does not need to be cleared since the child positions
+		 * of a position are set when the position is added to the tree
+		 */
+		array_size = sizeof( size_t ) * 2 * ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
+
+		( *compressor )->match_tree = (size_t *) memory_allocate(
+		                                          array_size );
+
+		if( ( *compressor )->match_tree == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create match tree.",
+			 function );
+
+			goto on_error;
+		}
+		array_size = sizeof( uint32_t ) * ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_MATCHES_SIZE;
+
+		( *compressor )->matches = (uint32_t *) memory_allocate(
+		                                         array_size );
+
+		if( ( *compressor )->matches == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create matches.",
+			 function );
+
+			goto on_error;
+		}
+		array_size = sizeof( uint8_t ) * ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_BLOCK_SIZE;
+
+		( *compressor )->numbers_of_matches = (uint8_t *) memory_allocate(
+		                                                   array_size );
+
+		if( ( *compressor )->numbers_of_matches == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create numbers of matches.",
+			 function );
+
+			goto on_error;
+		}
+		array_size = sizeof( uint32_t ) * ( ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_BLOCK_SIZE + 1 );
+
+		( *compressor )->parse_costs = (uint32_t *) memory_allocate(
+		                                             array_size );
+
+		if( ( *compressor )->parse_costs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create parse costs.",
+			 function );
+
+			goto on_error;
+		}
+		( *compressor )->parse_symbols = (uint32_t *) memory_allocate(
+		                                               array_size );
+
+		if( ( *compressor )->parse_symbols == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create parse symbols.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The match search parameters per compression level are similar to those of zlib
+	 */
+	switch( compression_level )
+	{
+		case 2:
+			( *compressor )->maximum_chain_length    = 8;
+			( *compressor )->good_match_size         = 4;
+			( *compressor )->nice_match_size         = 16;
+			( *compressor )->maximum_lazy_match_size = 5;
+			break;
+
+		case 3:
+			( *compressor )->maximum_chain_length    = 32;
+			( *compressor )->good_match_size         = 4;
+			( *compressor )->nice_match_size         = 32;
+			( *compressor )->maximum_lazy_match_size = 6;
+			break;
+
+		case 4:
+			( *compressor )->maximum_chain_length    = 16;
+			( *compressor )->good_match_size         = 4;
+			( *compressor )->nice_match_size         = 16;
+			( *compressor )->maximum_lazy_match_size = 4;
+			( *compressor )->use_lazy_matching       = 1;
+			break;
+
+		case 5:
+			( *compressor )->maximum_chain_length    = 32;
+			( *compressor )->good_match_size         = 8;
+			( *compressor )->nice_match_size         = 32;
+			( *compressor )->maximum_lazy_match_size = 16;
+			( *compressor )->use_lazy_matching       = 1;
+			break;
+
+		case 6:
+			( *compressor )->maximum_chain_length    = 128;
+			( *compressor )->good_match_size         = 8;
+			( *compressor )->nice_match_size         = 128;
+			( *compressor )->maximum_lazy_match_size = 16;
+			( *compressor )->use_lazy_matching       = 1;
+			break;
+
+		case 7:
+			( *compressor )->maximum_chain_length    = 256;
+			( *compressor )->good_match_size         = 8;
+			( *compressor )->nice_match_size         = 128;
+			( *compressor )->maximum_lazy_match_size = 32;
+			( *compressor )->use_lazy_matching       = 1;
+			break;
+
+		case 8:
+			( *compressor )->maximum_chain_length    = 1024;
+			( *compressor )->good_match_size         = 32;
+			( *compressor )->nice_match_size         = 258;
+			( *compressor )->maximum_lazy_match_size = 128;
+			( *compressor )->use_lazy_matching       = 1;
+			break;
+
+		case 9:
+			( *compressor )->maximum_chain_length    = 4096;
+			( *compressor )->good_match_size         = 32;
+			( *compressor )->nice_match_size         = 258;
+			( *compressor )->maximum_lazy_match_size = 258;
+			( *compressor )->use_lazy_matching       = 1;
+			break;
+
+		/* The maximum chain length is used as the maximum search depth of the match tree
+		 */
+		case 10:
+			( *compressor )->maximum_chain_length    = 128;
+			( *compressor )->nice_match_size         = 258;
+			( *compressor )->number_of_parse_passes  = 4;
+			break;
+
+		default:
+			break;
+	}
+	return( 1 );
+
+on_error:
+	if( *compressor != NULL )
+	{
+		if( ( *compressor )->parse_symbols != NULL )
+		{
+			memory_free(
+			 ( *compressor )->parse_symbols );
+		}
+		if( ( *compressor )->parse_costs != NULL )
+		{
+			memory_free(
+			 ( *compressor )->parse_costs );
+		}
+		if( ( *compressor )->numbers_of_matches != NULL )
+		{
+			memory_free(
+			 ( *compressor )->numbers_of_matches );
+		}
+		if( ( *compressor )->matches != NULL )
+		{
+			memory_free(
+			 ( *compressor )->matches );
+		}
+		if( ( *compressor )->match_tree != NULL )
+		{
+			memory_free(
+			 ( *compressor )->match_tree );
+		}
+		if( ( *compressor )->chain_table != NULL )
+		{
+			memory_free(
+			 ( *compressor )->chain_table );
+		}
+		if( ( *compressor )->symbols != NULL )
+		{
+			memory_free(
+			 ( *compressor )->symbols );
+		}
+		if( ( *compressor )->hash_table != NULL )
+		{
+			memory_free(
+			 ( *compressor )->hash_table );
+		}
+		memory_free(
+		 *compressor );
+
+		*compressor = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compressor
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_compressor_free(
+     assorted_deflate_compressor_t **compressor,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_compressor_free";
+	int result            = 1;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressor != NULL )
+	{
+		if( ( *compressor )->bit_stream_writer != NULL )
+		{
+			if( assorted_bit_stream_writer_free(
+			     &( ( *compressor )->bit_stream_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bit stream writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *compressor )->parse_symbols != NULL )
+		{
+			memory_free(
+			 ( *compressor )->parse_symbols );
+		}
+		if( ( *compressor )->parse_costs != NULL )
+		{
+			memory_free(
+			 ( *compressor )->parse_costs );
+		}
+		if( ( *compressor )->numbers_of_matches != NULL )
+		{
+			memory_free(
+			 ( *compressor )->numbers_of_matches );
+		}
+		if( ( *compressor )->matches != NULL )
+		{
+			memory_free(
+			 ( *compressor )->matches );
+		}
+		if( ( *compressor )->match_tree != NULL )
+		{
+			memory_free(
+			 ( *compressor )->match_tree );
+		}
+		if( ( *compressor )->chain_table != NULL )
+		{
+			memory_free(
+			 ( *compressor )->chain_table );
+		}
+		if( ( *compressor )->symbols != NULL )
+		{
+			memory_free(
+			 ( *compressor )->symbols );
+		}
+		if( ( *compressor )->hash_table != NULL )
+		{
+			memory_free(
+			 ( *compressor )->hash_table );
+		}
+		memory_free(
+		 *compressor );
+
+		*compressor = NULL;
+	}
+	return( result );
+}
+
+/* Writes uncompressed (stored) blocks
+ * Data larger than 65535 bytes is split over multiple blocks
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_write_stored_block(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t last_block_flag,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	static char *function                           = "assorted_deflate_compressor_write_stored_block";
+	size_t block_size                               = 0;
+	size_t required_size                            = 0;
+	uint8_t block_header                            = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressor->bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressor - missing bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream_writer = compressor->bit_stream_writer;
+
+	/* Every block consists of a 3-bit header that is padded to a byte boundary,
+	 * a 4-byte size and the data
+	 */
+	required_size = ( ( bit_stream_writer->bit_buffer_size + 3 + 7 ) / 8 ) + 4 + data_size
+	              + ( ( data_size / 65535 ) * 5 );
+
+	if( required_size > ( bit_stream_writer->byte_stream_size - bit_stream_writer->byte_stream_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		block_size = data_size;
+
+		if( block_size > 65535 )
+		{
+			block_size = 65535;
+		}
+		data_size -= block_size;
+
+		block_header = ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED << 1;
+
+		if( ( last_block_flag != 0 )
+		 && ( data_size == 0 ) )
+		{
+			block_header |= 0x01;
+		}
+		assorted_bit_stream_writer_write_bits_back_to_front(
+		 bit_stream_writer,
+		 block_header,
+		 3 );
+
+		if( assorted_bit_stream_writer_flush(
+		     bit_stream_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush bit stream writer.",
+			 function );
+
+			return( -1 );
+		}
+		assorted_bit_stream_writer_write_bits_back_to_front(
+		 bit_stream_writer,
+		 (uint32_t) block_size | ( (uint32_t) ( block_size ^ 0xffff ) << 16 ),
+		 32 );
+
+		if( assorted_bit_stream_writer_write_data(
+		     bit_stream_writer,
+		     data,
+		     block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data.",
+			 function );
+
+			return( -1 );
+		}
+		data += block_size;
+	}
+	while( data_size > 0 );
+
+	return( 1 );
+}
+
+/* Writes the symbols of the current block using the current Huffman codes
+ * followed by the end-of-block code
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_write_symbols(
+     assorted_deflate_compressor_t *compressor,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	static char *function                           = "assorted_deflate_compressor_write_symbols";
+	uint32_t code_value                             = 0;
+	uint32_t symbol                                 = 0;
+	size_t symbol_index                             = 0;
+	uint16_t distance                               = 0;
+	uint16_t distance_code                          = 0;
+	uint16_t length_code                            = 0;
+	uint16_t match_size                             = 0;
+	uint8_t number_of_bits                          = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressor->bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressor - missing bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream_writer = compressor->bit_stream_writer;
+
+	for( symbol_index = 0;
+	     symbol_index < compressor->number_of_symbols;
+	     symbol_index++ )
+	{
+		symbol = compressor->symbols[ symbol_index ];
+
+		if( ( symbol & 0x80000000UL ) == 0 )
+		{
+			assorted_bit_stream_writer_write_bits_back_to_front(
+			 bit_stream_writer,
+			 compressor->literals_codes[ symbol ],
+			 compressor->literals_code_sizes[ symbol ] );
+		}
+		else
+		{
+			match_size  = (uint16_t) ( ( symbol >> 16 ) & 0x00ff );
+			distance    = (uint16_t) ( symbol & 0x7fff );
+			length_code = assorted_deflate_length_codes[ match_size ];
+
+			number_of_bits = compressor->literals_code_sizes[ 257 + length_code ];
+			code_value     = compressor->literals_codes[ 257 + length_code ]
+			               | ( (uint32_t) ( match_size + 3 - assorted_deflate_literal_codes_base[ length_code ] ) << number_of_bits );
+			number_of_bits += (uint8_t) assorted_deflate_literal_codes_number_of_extra_bits[ length_code ];
+
+			assorted_bit_stream_writer_write_bits_back_to_front(
+			 bit_stream_writer,
+			 code_value,
+			 number_of_bits );
+
+			distance_code = assorted_deflate_get_distance_code( distance );
+
+			number_of_bits = compressor->distances_code_sizes[ distance_code ];
+			code_value     = compressor->distances_codes[ distance_code ]
+			               | ( (uint32_t) ( distance + 1 - assorted_deflate_distance_codes_base[ distance_code ] ) << number_of_bits );
+			number_of_bits += (uint8_t) assorted_deflate_distance_codes_number_of_extra_bits[ distance_code ];
+
+			assorted_bit_stream_writer_write_bits_back_to_front(
+			 bit_stream_writer,
+			 code_value,
+			 number_of_bits );
+		}
+	}
+	assorted_bit_stream_writer_write_bits_back_to_front(
+	 bit_stream_writer,
+	 compressor->literals_codes[ 256 ],
+	 compressor->literals_code_sizes[ 256 ] );
+
+	return( 1 );
+}
+
+/* Run-length encodes code sizes with the code size (pre)codes
+ * A precode symbol is stored as: repeat value << 8 | precode
+ * The precode symbols must be able to contain number of code sizes entries
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_encode_code_sizes(
+     const uint8_t *code_sizes,
+     uint16_t number_of_code_sizes,
+     uint16_t *precode_symbols,
+     uint16_t *number_of_precode_symbols,
+     uint32_t *precode_frequencies,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_deflate_compressor_encode_code_sizes";
+	uint16_t code_size_index        = 0;
+	uint16_t repeat_size            = 0;
+	uint16_t run_size               = 0;
+	uint16_t safe_number_of_symbols = 0;
+	uint16_t symbol                 = 0;
+	uint8_t code_size               = 0;
+
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_code_sizes > ( 286 + 30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of code sizes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( precode_symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid precode symbols.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_precode_symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of precode symbols.",
+		 function );
+
+		return( -1 );
+	}
+	if( precode_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid precode frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     precode_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 19 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear precode frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	code_size_index = 0;
+
+	while( code_size_index < number_of_code_sizes )
+	{
+		code_size = code_sizes[ code_size_index ];
+
+		for( run_size = 1;
+		     ( code_size_index + run_size ) < number_of_code_sizes;
+		     run_size++ )
+		{
+			if( code_sizes[ code_size_index + run_size ] != code_size )
+			{
+				break;
+			}
+		}
+		if( code_size == 0 )
+		{
+			while( run_size >= 11 )
+			{
+				repeat_size = ( run_size < 138 ) ? run_size : 138;
+
+				precode_symbols[ safe_number_of_symbols++ ] = ( ( repeat_size - 11 ) << 8 ) | 18;
+
+				run_size        -= repeat_size;
+				code_size_index += repeat_size;
+			}
+			if( run_size >= 3 )
+			{
+				precode_symbols[ safe_number_of_symbols++ ] = ( ( run_size - 3 ) << 8 ) | 17;
+
+				code_size_index += run_size;
+				run_size         = 0;
+			}
+		}
+		else
+		{
+			precode_symbols[ safe_number_of_symbols++ ] = code_size;
+
+			run_size        -= 1;
+			code_size_index += 1;
+
+			while( run_size >= 3 )
+			{
+				repeat_size = ( run_size < 6 ) ? run_size : 6;
+
+				precode_symbols[ safe_number_of_symbols++ ] = ( ( repeat_size - 3 ) << 8 ) | 16;
+
+				run_size        -= repeat_size;
+				code_size_index += repeat_size;
+			}
+		}
+		while( run_size > 0 )
+		{
+			precode_symbols[ safe_number_of_symbols++ ] = code_size;
+
+			run_size        -= 1;
+			code_size_index += 1;
+		}
+	}
+	for( symbol = 0;
+	     symbol < safe_number_of_symbols;
+	     symbol++ )
+	{
+		precode_frequencies[ precode_symbols[ symbol ] & 0x00ff ] += 1;
+	}
+	*number_of_precode_symbols = safe_number_of_symbols;
+
+	return( 1 );
+}
+
+/* Writes the current block
+ * The block is written as an uncompressed, fixed Huffman or dynamic Huffman
+ * compressed block, whichever results in the smallest size
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_write_block(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     uint8_t last_block_flag,
+     libcerror_error_t **error )
+{
+	uint8_t code_sizes[ 286 + 30 ];
+	uint16_t precode_symbols[ 286 + 30 ];
+	uint32_t precode_frequencies[ 19 ];
+	uint8_t precode_code_sizes[ 19 ];
+	uint32_t precode_codes[ 19 ];
+
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	static char *function                           = "assorted_deflate_compressor_write_block";
+	uint64_t dynamic_block_size                     = 0;
+	uint64_t extra_bits_size                        = 0;
+	uint64_t fixed_block_size                       = 0;
+	uint64_t stored_block_size                      = 0;
+	uint64_t selected_block_size                    = 0;
+	uint16_t number_of_code_sizes                   = 0;
+	uint16_t number_of_distance_codes               = 0;
+	uint16_t number_of_literal_codes                = 0;
+	uint16_t number_of_precode_codes                = 0;
+	uint16_t number_of_precode_symbols              = 0;
+	uint16_t precode_symbol                         = 0;
+	uint16_t symbol                                 = 0;
+	uint8_t block_type                              = 0;
+	uint8_t code_size                               = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressor->bit_stream_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressor - missing bit stream writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream_writer = compressor->bit_stream_writer;
+
+	/* The end-of-block symbol is used once
+	 */
+	compressor->literals_frequencies[ 256 ] = 1;
+
+	if( assorted_huffman_tree_build_code_sizes(
+	     compressor->literals_frequencies,
+	     286,
+	     15,
+	     compressor->literals_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build literals code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_huffman_tree_build_code_sizes(
+	     compressor->distances_frequencies,
+	     30,
+	     15,
+	     compressor->distances_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build distances code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( number_of_literal_codes = 286;
+	     number_of_literal_codes > 257;
+	     number_of_literal_codes-- )
+	{
+		if( compressor->literals_code_sizes[ number_of_literal_codes - 1 ] != 0 )
+		{
+			break;
+		}
+	}
+	for( number_of_distance_codes = 30;
+	     number_of_distance_codes > 1;
+	     number_of_distance_codes-- )
+	{
+		if( compressor->distances_code_sizes[ number_of_distance_codes - 1 ] != 0 )
+		{
+			break;
+		}
+	}
+	for( symbol = 0;
+	     symbol < number_of_literal_codes;
+	     symbol++ )
+	{
+		code_sizes[ number_of_code_sizes++ ] = compressor->literals_code_sizes[ symbol ];
+	}
+	for( symbol = 0;
+	     symbol < number_of_distance_codes;
+	     symbol++ )
+	{
+		code_sizes[ number_of_code_sizes++ ] = compressor->distances_code_sizes[ symbol ];
+	}
+	if( assorted_deflate_compressor_encode_code_sizes(
+	     code_sizes,
+	     number_of_code_sizes,
+	     precode_symbols,
+	     &number_of_precode_symbols,
+	     precode_frequencies,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to encode code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_huffman_tree_build_code_sizes(
+	     precode_frequencies,
+	     19,
+	     7,
+	     precode_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build precode code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( number_of_precode_codes = 19;
+	     number_of_precode_codes > 4;
+	     number_of_precode_codes-- )
+	{
+		if( precode_code_sizes[ assorted_deflate_code_sizes_sequence[ number_of_precode_codes - 1 ] ] != 0 )
+		{
+			break;
+		}
+	}
+	/* Determine the size in bits of the block per block type
+	 */
+	for( symbol = 0;
+	     symbol < 29;
+	     symbol++ )
+	{
+		extra_bits_size += (uint64_t) compressor->literals_frequencies[ 257 + symbol ]
+		                 * assorted_deflate_literal_codes_number_of_extra_bits[ symbol ];
+	}
+	for( symbol = 0;
+	     symbol < 30;
+	     symbol++ )
+	{
+		extra_bits_size += (uint64_t) compressor->distances_frequencies[ symbol ]
+		                 * assorted_deflate_distance_codes_number_of_extra_bits[ symbol ];
+
+		dynamic_block_size += (uint64_t) compressor->distances_frequencies[ symbol ]
+		                    * compressor->distances_code_sizes[ symbol ];
+
+		fixed_block_size += (uint64_t) compressor->distances_frequencies[ symbol ] * 5;
+	}
+	for( symbol = 0;
+	     symbol < 286;
+	     symbol++ )
+	{
+		dynamic_block_size += (uint64_t) compressor->literals_frequencies[ symbol ]
+		                    * compressor->literals_code_sizes[ symbol ];
+
+		if( symbol < 144 )
+		{
+			code_size = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_size = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_size = 7;
+		}
+		else
+		{
+			code_size = 8;
+		}
+		fixed_block_size += (uint64_t) compressor->literals_frequencies[ symbol ] * code_size;
+	}
+	for( symbol = 0;
+	     symbol < 19;
+	     symbol++ )
+	{
+		dynamic_block_size += (uint64_t) precode_frequencies[ symbol ] * precode_code_sizes[ symbol ];
+	}
+	dynamic_block_size += 3 + 5 + 5 + 4 + ( 3 * number_of_precode_codes )
+	                    + ( 2 * precode_frequencies[ 16 ] )
+	                    + ( 3 * precode_frequencies[ 17 ] )
+	                    + ( 7 * precode_frequencies[ 18 ] )
+	                    + extra_bits_size;
+
+	fixed_block_size += 3 + extra_bits_size;
+
+	stored_block_size = ( 8 - ( ( bit_stream_writer->bit_buffer_size + 3 ) & 0x07 ) ) & 0x07;
+	stored_block_size += 3 + 32 + ( (uint64_t) compressor->block_size * 8 )
+	                   + ( ( (uint64_t) compressor->block_size / 65535 ) * 40 );
+
+	if( ( stored_block_size <= fixed_block_size )
+	 && ( stored_block_size <= dynamic_block_size ) )
+	{
+		block_type = ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED;
+	}
+	else if( fixed_block_size <= dynamic_block_size )
+	{
+		block_type          = ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED;
+		selected_block_size = fixed_block_size;
+	}
+	else
+	{
+		block_type          = ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC;
+		selected_block_size = dynamic_block_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block of %" PRIzd " bytes sizes in bits (stored: %" PRIu64 ", fixed: %" PRIu64 ", dynamic: %" PRIu64 ") using block type: %" PRIu8 "\n",
+		 function,
+		 compressor->block_size,
+		 stored_block_size,
+		 fixed_block_size,
+		 dynamic_block_size,
+		 block_type );
+	}
+#endif
+	if( block_type == ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED )
+	{
+		if( assorted_deflate_compressor_write_stored_block(
+		     compressor,
+		     &( uncompressed_data[ compressor->block_offset ] ),
+		     compressor->block_size,
+		     last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( ( ( bit_stream_writer->bit_buffer_size + selected_block_size + 7 ) / 8 ) > (uint64_t) ( bit_stream_writer->byte_stream_size - bit_stream_writer->byte_stream_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( block_type == ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
+		{
+			for( symbol = 0;
+			     symbol < 288;
+			     symbol++ )
+			{
+				if( symbol < 144 )
+				{
+					compressor->literals_code_sizes[ symbol ] = 8;
+				}
+				else if( symbol < 256 )
+				{
+					compressor->literals_code_sizes[ symbol ] = 9;
+				}
+				else if( symbol < 280 )
+				{
+					compressor->literals_code_sizes[ symbol ] = 7;
+				}
+				else
+				{
+					compressor->literals_code_sizes[ symbol ] = 8;
+				}
+			}
+			for( symbol = 0;
+			     symbol < 30;
+			     symbol++ )
+			{
+				compressor->distances_code_sizes[ symbol ] = 5;
+			}
+			number_of_literal_codes  = 288;
+			number_of_distance_codes = 30;
+		}
+		if( assorted_huffman_tree_build_codes(
+		     compressor->literals_code_sizes,
+		     number_of_literal_codes,
+		     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+		     compressor->literals_codes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build literals codes.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_huffman_tree_build_codes(
+		     compressor->distances_code_sizes,
+		     number_of_distance_codes,
+		     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+		     compressor->distances_codes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build distances codes.",
+			 function );
+
+			return( -1 );
+		}
+		assorted_bit_stream_writer_write_bits_back_to_front(
+		 bit_stream_writer,
+		 ( block_type << 1 ) | last_block_flag,
+		 3 );
+
+		if( block_type == ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC )
+		{
+			if( assorted_huffman_tree_build_codes(
+			     precode_code_sizes,
+			     19,
+			     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+			     precode_codes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to build precode codes.",
+				 function );
+
+				return( -1 );
+			}
+			assorted_bit_stream_writer_write_bits_back_to_front(
+			 bit_stream_writer,
+			 ( ( number_of_precode_codes - 4 ) << 10 ) | ( ( number_of_distance_codes - 1 ) << 5 ) | ( number_of_literal_codes - 257 ),
+			 14 );
+
+			for( symbol = 0;
+			     symbol < number_of_precode_codes;
+			     symbol++ )
+			{
+				assorted_bit_stream_writer_write_bits_back_to_front(
+				 bit_stream_writer,
+				 precode_code_sizes[ assorted_deflate_code_sizes_sequence[ symbol ] ],
+				 3 );
+			}
+			for( symbol = 0;
+			     symbol < number_of_precode_symbols;
+			     symbol++ )
+			{
+				precode_symbol = precode_symbols[ symbol ] & 0x00ff;
+
+				assorted_bit_stream_writer_write_bits_back_to_front(
+				 bit_stream_writer,
+				 precode_codes[ precode_symbol ],
+				 precode_code_sizes[ precode_symbol ] );
+
+				if( precode_symbol == 16 )
+				{
+					assorted_bit_stream_writer_write_bits_back_to_front(
+					 bit_stream_writer,
+					 precode_symbols[ symbol ] >> 8,
+					 2 );
+				}
+				else if( precode_symbol == 17 )
+				{
+					assorted_bit_stream_writer_write_bits_back_to_front(
+					 bit_stream_writer,
+					 precode_symbols[ symbol ] >> 8,
+					 3 );
+				}
+				else if( precode_symbol == 18 )
+				{
+					assorted_bit_stream_writer_write_bits_back_to_front(
+					 bit_stream_writer,
+					 precode_symbols[ symbol ] >> 8,
+					 7 );
+				}
+			}
+		}
+		if( assorted_deflate_compressor_write_symbols(
+		     compressor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write symbols.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	compressor->block_offset     += compressor->block_size;
+	compressor->block_size        = 0;
+	compressor->number_of_symbols = 0;
+
+	if( memory_set(
+	     compressor->literals_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 288 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear literals frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     compressor->distances_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 30 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear distances frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finds matches using a single entry hash table of 4-byte sequences and greedy matching
+ * This is used by compression level 1
+ * Matches are searched from the uncompressed data offset, the data before the offset
+ * is used as preset dictionary
+ * Completed blocks are written, the last block remains buffered
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_find_matches_fast(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "assorted_deflate_compressor_find_matches_fast";
+	size_t insert_offset      = 0;
+	size_t maximum_match_size = 0;
+	size_t match_offset       = 0;
+	size_t match_size         = 0;
+	uint64_t compare_value1   = 0;
+	uint64_t compare_value2         = 0;
+	uint32_t hash_value             = 0;
+	uint32_t match_value            = 0;
+	uint32_t value                  = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Add the positions of the preset dictionary to the hash table
+	 */
+	if( uncompressed_data_offset > ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE )
+	{
+		insert_offset = uncompressed_data_offset - ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
+	}
+	if( insert_offset < compressor->hashed_dictionary_size )
+	{
+		insert_offset = compressor->hashed_dictionary_size;
+	}
+	while( ( insert_offset < uncompressed_data_offset )
+	    && ( ( uncompressed_data_size - insert_offset ) >= 4 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( uncompressed_data[ insert_offset ] ),
+		 value );
+
+		hash_value = assorted_deflate_compressor_get_fast_hash_value(
+		              value );
+
+		compressor->hash_table[ hash_value ] = insert_offset + 1;
+
+		insert_offset++;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		match_size = 0;
+
+		if( ( uncompressed_data_size - uncompressed_data_offset ) >= 4 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( uncompressed_data[ uncompressed_data_offset ] ),
+			 value );
+
+			hash_value = assorted_deflate_compressor_get_fast_hash_value(
+			              value );
+
+			match_offset = compressor->hash_table[ hash_value ];
+
+			compressor->hash_table[ hash_value ] = uncompressed_data_offset + 1;
+
+			if( ( match_offset != 0 )
+			 && ( ( uncompressed_data_offset - match_offset + 1 ) <= ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE ) )
+			{
+				match_offset -= 1;
+
+				byte_stream_copy_to_uint32_little_endian(
+				 &( uncompressed_data[ match_offset ] ),
+				 match_value );
+
+				if( match_value == value )
+				{
+					maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+
+					if( maximum_match_size > 258 )
+					{
+						maximum_match_size = 258;
+					}
+					match_size = 4;
+
+					assorted_deflate_compressor_get_match_size(
+					 uncompressed_data,
+					 match_offset,
+					 uncompressed_data_offset,
+					 match_size,
+					 maximum_match_size,
+					 compare_value1,
+					 compare_value2 );
+				}
+			}
+		}
+		if( match_size != 0 )
+		{
+			assorted_deflate_compressor_add_match(
+			 compressor,
+			 match_size,
+			 uncompressed_data_offset - match_offset );
+
+			uncompressed_data_offset += match_size;
+		}
+		else
+		{
+			assorted_deflate_compressor_add_literal(
+			 compressor,
+			 uncompressed_data[ uncompressed_data_offset ] );
+
+			uncompressed_data_offset += 1;
+		}
+		if( compressor->number_of_symbols >= ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SYMBOLS )
+		{
+			if( assorted_deflate_compressor_write_block(
+			     compressor,
+			     uncompressed_data,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Finds matches using hash chains of 3-byte sequences with greedy or lazy matching
+ * This is used by compression levels 2 to 9
+ * Matches are searched from the uncompressed data offset, the data before the offset
+ * is used as preset dictionary
+ * Completed blocks are written, the last block remains buffered
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_find_matches(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function          = "assorted_deflate_compressor_find_matches";
+	size_t best_match_distance     = 0;
+	size_t best_match_size         = 0;
+	size_t chain_offset            = 0;
+	size_t insert_end_offset       = 0;
+	size_t insert_offset           = 0;
+	size_t maximum_match_size      = 0;
+	size_t match_distance          = 0;
+	size_t match_offset            = 0;
+	size_t match_size              = 0;
+	size_t nice_match_size         = 0;
+	size_t previous_match_distance = 0;
+	size_t previous_match_size     = 0;
+	uint64_t compare_value1        = 0;
+	uint64_t compare_value2        = 0;
+	uint32_t hash_value            = 0;
+	uint16_t chain_length          = 0;
+	uint8_t match_available        = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Add the positions of the preset dictionary to the hash chains
+	 */
+	if( uncompressed_data_offset > ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE )
+	{
+		insert_offset = uncompressed_data_offset - ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
+	}
+	if( insert_offset < compressor->hashed_dictionary_size )
+	{
+		insert_offset = compressor->hashed_dictionary_size;
+	}
+	while( ( insert_offset < uncompressed_data_offset )
+	    && ( ( uncompressed_data_size - insert_offset ) >= 3 ) )
+	{
+		hash_value = assorted_deflate_compressor_get_hash_value(
+		              uncompressed_data,
+		              insert_offset );
+
+		compressor->chain_table[ insert_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ] = compressor->hash_table[ hash_value ];
+		compressor->hash_table[ hash_value ]                                                        = insert_offset + 1;
+
+		insert_offset++;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		best_match_distance = 0;
+		best_match_size     = 0;
+
+		if( ( uncompressed_data_size - uncompressed_data_offset ) >= 3 )
+		{
+			hash_value = assorted_deflate_compressor_get_hash_value(
+			              uncompressed_data,
+			              uncompressed_data_offset );
+
+			chain_offset = compressor->hash_table[ hash_value ];
+
+			compressor->chain_table[ uncompressed_data_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ] = chain_offset;
+			compressor->hash_table[ hash_value ]                                                                   = uncompressed_data_offset + 1;
+
+			if( ( compressor->use_lazy_matching == 0 )
+			 || ( previous_match_size < compressor->maximum_lazy_match_size ) )
+			{
+				maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+
+				if( maximum_match_size > 258 )
+				{
+					maximum_match_size = 258;
+				}
+				nice_match_size = compressor->nice_match_size;
+
+				if( nice_match_size > maximum_match_size )
+				{
+					nice_match_size = maximum_match_size;
+				}
+				chain_length = compressor->maximum_chain_length;
+
+				/* A lazy match must be larger than the previous match
+				 */
+				if( compressor->use_lazy_matching != 0 )
+				{
+					best_match_size = previous_match_size;
+
+					if( previous_match_size >= compressor->good_match_size )
+					{
+						chain_length >>= 2;
+					}
+				}
+				if( best_match_size < 2 )
+				{
+					best_match_size = 2;
+				}
+				while( ( chain_offset != 0 )
+				    && ( chain_length > 0 )
+				    && ( best_match_size < maximum_match_size ) )
+				{
+					match_offset   = chain_offset - 1;
+					match_distance = uncompressed_data_offset - match_offset;
+
+					if( match_distance > ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE )
+					{
+						break;
+					}
+					if( ( uncompressed_data[ match_offset + best_match_size ] == uncompressed_data[ uncompressed_data_offset + best_match_size ] )
+					 && ( uncompressed_data[ match_offset + best_match_size - 1 ] == uncompressed_data[ uncompressed_data_offset + best_match_size - 1 ] )
+					 && ( uncompressed_data[ match_offset ] == uncompressed_data[ uncompressed_data_offset ] )
+					 && ( uncompressed_data[ match_offset + 1 ] == uncompressed_data[ uncompressed_data_offset + 1 ] ) )
+					{
+						match_size = 2;
+
+						assorted_deflate_compressor_get_match_size(
+						 uncompressed_data,
+						 match_offset,
+						 uncompressed_data_offset,
+						 match_size,
+						 maximum_match_size,
+						 compare_value1,
+						 compare_value2 );
+
+						if( match_size > best_match_size )
+						{
+							best_match_distance = match_distance;
+							best_match_size     = match_size;
+
+							if( match_size >= nice_match_size )
+							{
+								break;
+							}
+						}
+					}
+					chain_offset = compressor->chain_table[ match_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ];
+
+					/* Positions older than the window could have been overwritten
+					 */
+					if( chain_offset > match_offset )
+					{
+						break;
+					}
+					chain_length--;
+				}
+				if( best_match_distance == 0 )
+				{
+					best_match_size = 0;
+				}
+				/* A minimum size match at a large distance is more expensive than its literals
+				 */
+				else if( ( best_match_size == 3 )
+				      && ( best_match_distance > 4096 ) )
+				{
+					best_match_distance = 0;
+					best_match_size     = 0;
+				}
+			}
+		}
+		if( compressor->use_lazy_matching == 0 )
+		{
+			if( best_match_size != 0 )
+			{
+				assorted_deflate_compressor_add_match(
+				 compressor,
+				 best_match_size,
+				 best_match_distance );
+
+				insert_offset     = uncompressed_data_offset + 1;
+				insert_end_offset = uncompressed_data_offset + best_match_size;
+
+				uncompressed_data_offset = insert_end_offset;
+
+				/* Only the positions of smaller matches are added to the hash table
+				 */
+				if( best_match_size > compressor->maximum_lazy_match_size )
+				{
+					insert_offset = insert_end_offset;
+				}
+			}
+			else
+			{
+				assorted_deflate_compressor_add_literal(
+				 compressor,
+				 uncompressed_data[ uncompressed_data_offset ] );
+
+				uncompressed_data_offset += 1;
+
+				insert_offset     = 0;
+				insert_end_offset = 0;
+			}
+		}
+		else if( ( previous_match_size != 0 )
+		      && ( best_match_size <= previous_match_size ) )
+		{
+			/* The match at the previous position is used
+			 */
+			assorted_deflate_compressor_add_match(
+			 compressor,
+			 previous_match_size,
+			 previous_match_distance );
+
+			insert_offset     = uncompressed_data_offset + 1;
+			insert_end_offset = uncompressed_data_offset - 1 + previous_match_size;
+
+			uncompressed_data_offset = insert_end_offset;
+
+			match_available     = 0;
+			previous_match_size = 0;
+		}
+		else
+		{
+			if( match_available != 0 )
+			{
+				assorted_deflate_compressor_add_literal(
+				 compressor,
+				 uncompressed_data[ uncompressed_data_offset - 1 ] );
+			}
+			match_available         = 1;
+			previous_match_distance = best_match_distance;
+			previous_match_size     = best_match_size;
+
+			uncompressed_data_offset += 1;
+
+			insert_offset     = 0;
+			insert_end_offset = 0;
+		}
+		if( insert_end_offset > ( uncompressed_data_size - 2 ) )
+		{
+			insert_end_offset = uncompressed_data_size - 2;
+		}
+		while( insert_offset < insert_end_offset )
+		{
+			hash_value = assorted_deflate_compressor_get_hash_value(
+			              uncompressed_data,
+			              insert_offset );
+
+			compressor->chain_table[ insert_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ] = compressor->hash_table[ hash_value ];
+			compressor->hash_table[ hash_value ]                                                        = insert_offset + 1;
+
+			insert_offset++;
+		}
+		if( compressor->number_of_symbols >= ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SYMBOLS )
+		{
+			if( assorted_deflate_compressor_write_block(
+			     compressor,
+			     uncompressed_data,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( match_available != 0 )
+	{
+		assorted_deflate_compressor_add_literal(
+		 compressor,
+		 uncompressed_data[ uncompressed_data_offset - 1 ] );
+	}
+	return( 1 );
+}
+
+/* Finds the matches of a position using a binary tree of 3-byte hash sequences
+ * and adds the position to the tree
+ * This is used by compression level 10
+ * The matches are stored by increasing size as: size << 16 | distance
+ * If matches is NULL the position is only added to the tree
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_find_tree_matches(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint32_t *matches,
+     uint8_t *number_of_matches,
+     libcerror_error_t **error )
+{
+	size_t *larger_child_offset    = NULL;
+	size_t *smaller_child_offset   = NULL;
+	static char *function          = "assorted_deflate_compressor_find_tree_matches";
+	size_t best_match_size         = 0;
+	size_t larger_match_size       = 0;
+	size_t match_distance          = 0;
+	size_t match_offset            = 0;
+	size_t match_size              = 0;
+	size_t maximum_match_size      = 0;
+	size_t nice_match_size         = 0;
+	size_t smaller_match_size      = 0;
+	size_t tree_index              = 0;
+	size_t tree_offset             = 0;
+	uint64_t compare_value1        = 0;
+	uint64_t compare_value2        = 0;
+	uint32_t hash_value            = 0;
+	uint16_t search_depth          = 0;
+	uint8_t safe_number_of_matches = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressor->match_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressor - missing match tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset >= uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of matches.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+
+	if( maximum_match_size < 3 )
+	{
+		*number_of_matches = 0;
+
+		return( 1 );
+	}
+	if( maximum_match_size > 258 )
+	{
+		maximum_match_size = 258;
+	}
+	nice_match_size = compressor->nice_match_size;
+
+	if( nice_match_size > maximum_match_size )
+	{
+		nice_match_size = maximum_match_size;
+	}
+	hash_value = assorted_deflate_compressor_get_hash_value(
+	              uncompressed_data,
+	              uncompressed_data_offset );
+
+	tree_offset = compressor->hash_table[ hash_value ];
+
+	compressor->hash_table[ hash_value ] = uncompressed_data_offset + 1;
+
+	/* The position becomes the root of the tree, the previous tree is split
+	 * into the positions with smaller and larger data
+	 */
+	tree_index = 2 * ( uncompressed_data_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) );
+
+	smaller_child_offset = &( compressor->match_tree[ tree_index ] );
+	larger_child_offset  = &( compressor->match_tree[ tree_index + 1 ] );
+
+	best_match_size = 2;
+	search_depth    = compressor->maximum_chain_length;
+
+	while( ( tree_offset != 0 )
+	    && ( search_depth > 0 ) )
+	{
+		match_offset   = tree_offset - 1;
+		match_distance = uncompressed_data_offset - match_offset;
+
+		/* The child positions of positions older than the window could have been overwritten
+		 */
+		if( match_distance >= ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE )
+		{
+			break;
+		}
+		tree_index = 2 * ( match_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) );
+
+		/* The data of all the positions in the subtree matches at least the size
+		 * of the smallest of the smaller and larger match sizes
+		 */
+		match_size = ( smaller_match_size < larger_match_size ) ? smaller_match_size : larger_match_size;
+
+		if( uncompressed_data[ match_offset + match_size ] == uncompressed_data[ uncompressed_data_offset + match_size ] )
+		{
+			match_size += 1;
+
+			assorted_deflate_compressor_get_match_size(
+			 uncompressed_data,
+			 match_offset,
+			 uncompressed_data_offset,
+			 match_size,
+			 maximum_match_size,
+			 compare_value1,
+			 compare_value2 );
+
+			if( ( matches != NULL )
+			 && ( match_size > best_match_size ) )
+			{
+				best_match_size = match_size;
+
+				/* If there are too many matches the largest one replaces the last one
+				 */
+				if( safe_number_of_matches >= ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_MATCHES )
+				{
+					safe_number_of_matches--;
+				}
+				matches[ safe_number_of_matches++ ] = ( (uint32_t) match_size << 16 ) | (uint32_t) match_distance;
+			}
+			if( match_size >= nice_match_size )
+			{
+				/* The position replaces the matching position in the tree
+				 */
+				*smaller_child_offset = compressor->match_tree[ tree_index ];
+				*larger_child_offset  = compressor->match_tree[ tree_index + 1 ];
+
+				*number_of_matches = safe_number_of_matches;
+
+				return( 1 );
+			}
+		}
+		if( uncompressed_data[ match_offset + match_size ] < uncompressed_data[ uncompressed_data_offset + match_size ] )
+		{
+			*smaller_child_offset = tree_offset;
+			smaller_child_offset  = &( compressor->match_tree[ tree_index + 1 ] );
+			tree_offset           = *smaller_child_offset;
+			smaller_match_size    = match_size;
+		}
+		else
+		{
+			*larger_child_offset = tree_offset;
+			larger_child_offset  = &( compressor->match_tree[ tree_index ] );
+			tree_offset          = *larger_child_offset;
+			larger_match_size    = match_size;
+		}
+		search_depth--;
+	}
+	*smaller_child_offset = 0;
+	*larger_child_offset  = 0;
+
+	*number_of_matches = safe_number_of_matches;
+
+	return( 1 );
+}
+
+/* Determines the size in bits of a block from its frequencies
+ * The literals and lengths frequencies exclude the end-of-block symbol
+ * The size is that of the smallest of the uncompressed, fixed Huffman and dynamic
+ * Huffman compressed block types, without the alignment of an uncompressed block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_get_block_size(
+     const uint32_t *literals_frequencies,
+     const uint32_t *distances_frequencies,
+     size_t data_size,
+     uint64_t *block_size,
+     libcerror_error_t **error )
+{
+	uint8_t code_sizes[ 286 + 30 ];
+	uint32_t block_literals_frequencies[ 286 ];
+	uint8_t distances_code_sizes[ 30 ];
+	uint8_t literals_code_sizes[ 286 ];
+	uint16_t precode_symbols[ 286 + 30 ];
+	uint32_t precode_frequencies[ 19 ];
+	uint8_t precode_code_sizes[ 19 ];
+
+	static char *function              = "assorted_deflate_compressor_get_block_size";
+	uint64_t dynamic_block_size        = 0;
+	uint64_t extra_bits_size           = 0;
+	uint64_t fixed_block_size          = 0;
+	uint64_t stored_block_size         = 0;
+	uint16_t number_of_code_sizes      = 0;
+	uint16_t number_of_distance_codes  = 0;
+	uint16_t number_of_literal_codes   = 0;
+	uint16_t number_of_precode_codes   = 0;
+	uint16_t number_of_precode_symbols = 0;
+	uint16_t symbol                    = 0;
+	uint8_t code_size                  = 0;
+
+	if( literals_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literals frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( distances_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distances frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     block_literals_frequencies,
+	     literals_frequencies,
+	     sizeof( uint32_t ) * 286 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy literals frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	block_literals_frequencies[ 256 ] = 1;
+
+	if( assorted_huffman_tree_build_code_sizes(
+	     block_literals_frequencies,
+	     286,
+	     15,
+	     literals_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build literals code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_huffman_tree_build_code_sizes(
+	     distances_frequencies,
+	     30,
+	     15,
+	     distances_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build distances code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( number_of_literal_codes = 286;
+	     number_of_literal_codes > 257;
+	     number_of_literal_codes-- )
+	{
+		if( literals_code_sizes[ number_of_literal_codes - 1 ] != 0 )
+		{
+			break;
+		}
+	}
+	for( number_of_distance_codes = 30;
+	     number_of_distance_codes > 1;
+	     number_of_distance_codes-- )
+	{
+		if( distances_code_sizes[ number_of_distance_codes - 1 ] != 0 )
+		{
+			break;
+		}
+	}
+	for( symbol = 0;
+	     symbol < number_of_literal_codes;
+	     symbol++ )
+	{
+		code_sizes[ number_of_code_sizes++ ] = literals_code_sizes[ symbol ];
+	}
+	for( symbol = 0;
+	     symbol < number_of_distance_codes;
+	     symbol++ )
+	{
+		code_sizes[ number_of_code_sizes++ ] = distances_code_sizes[ symbol ];
+	}
+	if( assorted_deflate_compressor_encode_code_sizes(
+	     code_sizes,
+	     number_of_code_sizes,
+	     precode_symbols,
+	     &number_of_precode_symbols,
+	     precode_frequencies,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to encode code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_huffman_tree_build_code_sizes(
+	     precode_frequencies,
+	     19,
+	     7,
+	     precode_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build precode code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( number_of_precode_codes = 19;
+	     number_of_precode_codes > 4;
+	     number_of_precode_codes-- )
+	{
+		if( precode_code_sizes[ assorted_deflate_code_sizes_sequence[ number_of_precode_codes - 1 ] ] != 0 )
+		{
+			break;
+		}
+	}
+	for( symbol = 0;
+	     symbol < 29;
+	     symbol++ )
+	{
+		extra_bits_size += (uint64_t) block_literals_frequencies[ 257 + symbol ]
+		                 * assorted_deflate_literal_codes_number_of_extra_bits[ symbol ];
+	}
+	for( symbol = 0;
+	     symbol < 30;
+	     symbol++ )
+	{
+		extra_bits_size += (uint64_t) distances_frequencies[ symbol ]
+		                 * assorted_deflate_distance_codes_number_of_extra_bits[ symbol ];
+
+		dynamic_block_size += (uint64_t) distances_frequencies[ symbol ]
+		                    * distances_code_sizes[ symbol ];
+
+		fixed_block_size += (uint64_t) distances_frequencies[ symbol ] * 5;
+	}
+	for( symbol = 0;
+	     symbol < 286;
+	     symbol++ )
+	{
+		dynamic_block_size += (uint64_t) block_literals_frequencies[ symbol ]
+		                    * literals_code_sizes[ symbol ];
+
+		if( symbol < 144 )
+		{
+			code_size = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_size = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_size = 7;
+		}
+		else
+		{
+			code_size = 8;
+		}
+		fixed_block_size += (uint64_t) block_literals_frequencies[ symbol ] * code_size;
+	}
+	for( symbol = 0;
+	     symbol < 19;
+	     symbol++ )
+	{
+		dynamic_block_size += (uint64_t) precode_frequencies[ symbol ] * precode_code_sizes[ symbol ];
+	}
+	dynamic_block_size += 3 + 5 + 5 + 4 + ( 3 * number_of_precode_codes )
+	                    + ( 2 * precode_frequencies[ 16 ] )
+	                    + ( 3 * precode_frequencies[ 17 ] )
+	                    + ( 7 * precode_frequencies[ 18 ] )
+	                    + extra_bits_size;
+
+	fixed_block_size += 3 + extra_bits_size;
+
+	stored_block_size = 3 + 32 + ( (uint64_t) data_size * 8 )
+	                  + ( ( (uint64_t) data_size / 65535 ) * 40 );
+
+	*block_size = dynamic_block_size;
+
+	if( fixed_block_size < *block_size )
+	{
+		*block_size = fixed_block_size;
+	}
+	if( stored_block_size < *block_size )
+	{
+		*block_size = stored_block_size;
+	}
+	return( 1 );
+}
+
+/* Determines the optimal parse of part of the current optimal parsing block
+ * The parse is the sequence of literals and matches with the smallest cost,
+ * where the cost of a symbol is based on the literals and lengths and distances
+ * code sizes and a code size of 0 represents an unused symbol
+ * The optimal parsing block consists of the uncompressed data at the uncompressed
+ * data offset and the part starts at the parse offset relative to the block
+ * The symbols of the parse are stored as the symbols of the compressor
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_parse_optimal(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     size_t parse_offset,
+     size_t parse_size,
+     const uint8_t *literals_code_sizes,
+     const uint8_t *distances_code_sizes,
+     libcerror_error_t **error )
+{
+	uint32_t distance_costs[ 30 ];
+	uint32_t length_costs[ 259 ];
+	uint32_t literal_costs[ 256 ];
+
+	static char *function       = "assorted_deflate_compressor_parse_optimal";
+	size_t match_index          = 0;
+	size_t match_size           = 0;
+	size_t maximum_match_size   = 0;
+	size_t parse_index          = 0;
+	size_t symbol_index         = 0;
+	uint32_t cost               = 0;
+	uint32_t distance_cost      = 0;
+	uint32_t match              = 0;
+	uint32_t match_distance     = 0;
+	uint32_t symbol             = 0;
+	uint32_t unused_symbol_cost = 0;
+	uint16_t distance_code      = 0;
+	uint16_t length_code        = 0;
+	uint16_t symbol_value       = 0;
+	uint8_t match_number        = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressor->matches == NULL )
+	 || ( compressor->numbers_of_matches == NULL )
+	 || ( compressor->parse_costs == NULL )
+	 || ( compressor->parse_symbols == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressor - missing optimal parsing values.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parse_offset > ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_BLOCK_SIZE )
+	 || ( parse_size > ( ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_BLOCK_SIZE - parse_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parse offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( literals_code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literals code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( distances_code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distances code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	/* An unused symbol is considered more expensive than the largest code size in use
+	 */
+	unused_symbol_cost = 0;
+
+	for( symbol_value = 0;
+	     symbol_value < 286;
+	     symbol_value++ )
+	{
+		if( literals_code_sizes[ symbol_value ] > unused_symbol_cost )
+		{
+			unused_symbol_cost = literals_code_sizes[ symbol_value ];
+		}
+	}
+	unused_symbol_cost += 1;
+
+	for( symbol_value = 0;
+	     symbol_value < 256;
+	     symbol_value++ )
+	{
+		literal_costs[ symbol_value ] = literals_code_sizes[ symbol_value ];
+
+		if( literal_costs[ symbol_value ] == 0 )
+		{
+			literal_costs[ symbol_value ] = unused_symbol_cost;
+		}
+	}
+	for( match_size = 3;
+	     match_size <= 258;
+	     match_size++ )
+	{
+		length_code = assorted_deflate_length_codes[ match_size - 3 ];
+
+		length_costs[ match_size ] = literals_code_sizes[ 257 + length_code ];
+
+		if( length_costs[ match_size ] == 0 )
+		{
+			length_costs[ match_size ] = unused_symbol_cost;
+		}
+		length_costs[ match_size ] += assorted_deflate_literal_codes_number_of_extra_bits[ length_code ];
+	}
+	unused_symbol_cost = 0;
+
+	for( distance_code = 0;
+	     distance_code < 30;
+	     distance_code++ )
+	{
+		if( distances_code_sizes[ distance_code ] > unused_symbol_cost )
+		{
+			unused_symbol_cost = distances_code_sizes[ distance_code ];
+		}
+	}
+	unused_symbol_cost += 1;
+
+	for( distance_code = 0;
+	     distance_code < 30;
+	     distance_code++ )
+	{
+		distance_costs[ distance_code ] = distances_code_sizes[ distance_code ];
+
+		if( distance_costs[ distance_code ] == 0 )
+		{
+			distance_costs[ distance_code ] = unused_symbol_cost;
+		}
+		distance_costs[ distance_code ] += assorted_deflate_distance_codes_number_of_extra_bits[ distance_code ];
+	}
+	for( parse_index = 0;
+	     parse_index < parse_offset;
+	     parse_index++ )
+	{
+		match_index += compressor->numbers_of_matches[ parse_index ];
+	}
+	/* Determine the smallest cost to reach every position from the start of the part
+	 */
+	compressor->parse_costs[ 0 ] = 0;
+
+	for( parse_index = 1;
+	     parse_index <= parse_size;
+	     parse_index++ )
+	{
+		compressor->parse_costs[ parse_index ] = (uint32_t) UINT32_MAX;
+	}
+	for( parse_index = 0;
+	     parse_index < parse_size;
+	     parse_index++ )
+	{
+		cost = compressor->parse_costs[ parse_index ];
+
+		symbol = uncompressed_data[ uncompressed_data_offset + parse_offset + parse_index ];
+
+		if( ( cost + literal_costs[ symbol ] ) < compressor->parse_costs[ parse_index + 1 ] )
+		{
+			compressor->parse_costs[ parse_index + 1 ]   = cost + literal_costs[ symbol ];
+			compressor->parse_symbols[ parse_index + 1 ] = symbol;
+		}
+		/* The sizes up to that of a match are reached with the match
+		 * of the smallest distance that is large enough
+		 */
+		maximum_match_size = parse_size - parse_index;
+		match_size         = 3;
+
+		for( match_number = 0;
+		     match_number < compressor->numbers_of_matches[ parse_offset + parse_index ];
+		     match_number++ )
+		{
+			match          = compressor->matches[ match_index++ ];
+			match_distance = match & 0x0000ffffUL;
+
+			distance_code = assorted_deflate_get_distance_code( match_distance - 1 );
+			distance_cost = cost + distance_costs[ distance_code ];
+
+			while( ( match_size <= (size_t) ( match >> 16 ) )
+			    && ( match_size <= maximum_match_size ) )
+			{
+				if( ( distance_cost + length_costs[ match_size ] ) < compressor->parse_costs[ parse_index + match_size ] )
+				{
+					compressor->parse_costs[ parse_index + match_size ]   = distance_cost + length_costs[ match_size ];
+					compressor->parse_symbols[ parse_index + match_size ] = 0x80000000UL | ( (uint32_t) ( match_size - 3 ) << 16 ) | ( match_distance - 1 );
+				}
+				match_size++;
+			}
+		}
+	}
+	/* Trace back the symbols from the end of the part
+	 */
+	compressor->number_of_symbols = 0;
+
+	parse_index = parse_size;
+
+	while( parse_index > 0 )
+	{
+		symbol = compressor->parse_symbols[ parse_index ];
+
+		if( ( symbol & 0x80000000UL ) == 0 )
+		{
+			parse_index -= 1;
+		}
+		else
+		{
+			parse_index -= ( ( symbol >> 16 ) & 0x00ff ) + 3;
+		}
+		compressor->number_of_symbols += 1;
+	}
+	symbol_index = compressor->number_of_symbols;
+	parse_index  = parse_size;
+
+	while( parse_index > 0 )
+	{
+		symbol = compressor->parse_symbols[ parse_index ];
+
+		if( ( symbol & 0x80000000UL ) == 0 )
+		{
+			parse_index -= 1;
+		}
+		else
+		{
+			parse_index -= ( ( symbol >> 16 ) & 0x00ff ) + 3;
+		}
+		compressor->symbols[ --symbol_index ] = symbol;
+	}
+	return( 1 );
+}
+
+/* Determines the optimal parse of part of the current optimal parsing block iteratively
+ * Every next parse uses the Huffman code sizes of the symbols of the previous parse
+ * as its cost model, the first parse uses the literals and lengths and distances code sizes
+ * On return the symbols of the compressor contain the parse with the smallest estimated
+ * size and the code sizes contain those used to determine it
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_parse_iterative(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     size_t parse_offset,
+     size_t parse_size,
+     uint8_t *literals_code_sizes,
+     uint8_t *distances_code_sizes,
+     libcerror_error_t **error )
+{
+	uint32_t distances_frequencies[ 30 ];
+	uint32_t literals_frequencies[ 286 ];
+	uint8_t best_distances_code_sizes[ 30 ];
+	uint8_t best_literals_code_sizes[ 286 ];
+
+	static char *function    = "assorted_deflate_compressor_parse_iterative";
+	size_t data_size         = 0;
+	size_t symbol_index      = 0;
+	uint64_t best_block_size = 0;
+	uint64_t block_size      = 0;
+	uint32_t symbol          = 0;
+	uint8_t best_pass_number = 0;
+	uint8_t pass_number      = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressor->number_of_parse_passes == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressor - number of parse passes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( literals_code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literals code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( distances_code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distances code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	best_block_size = (uint64_t) UINT64_MAX;
+
+	for( pass_number = 0;
+	     pass_number < compressor->number_of_parse_passes;
+	     pass_number++ )
+	{
+		if( assorted_deflate_compressor_parse_optimal(
+		     compressor,
+		     uncompressed_data,
+		     uncompressed_data_offset,
+		     parse_offset,
+		     parse_size,
+		     literals_code_sizes,
+		     distances_code_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine optimal parse.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( memory_set(
+		       literals_frequencies,
+		       0,
+		       sizeof( uint32_t ) * 286 ) == NULL )
+		 || ( memory_set(
+		       distances_frequencies,
+		       0,
+		       sizeof( uint32_t ) * 30 ) == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear frequencies.",
+			 function );
+
+			return( -1 );
+		}
+		data_size = 0;
+
+		for( symbol_index = 0;
+		     symbol_index < compressor->number_of_symbols;
+		     symbol_index++ )
+		{
+			symbol = compressor->symbols[ symbol_index ];
+
+			assorted_deflate_compressor_count_symbol(
+			 symbol,
+			 literals_frequencies,
+			 distances_frequencies,
+			 data_size );
+		}
+		if( assorted_deflate_compressor_get_block_size(
+		     literals_frequencies,
+		     distances_frequencies,
+		     data_size,
+		     &block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine block size.",
+			 function );
+
+			return( -1 );
+		}
+		if( block_size < best_block_size )
+		{
+			if( ( memory_copy(
+			       best_literals_code_sizes,
+			       literals_code_sizes,
+			       sizeof( uint8_t ) * 286 ) == NULL )
+			 || ( memory_copy(
+			       best_distances_code_sizes,
+			       distances_code_sizes,
+			       sizeof( uint8_t ) * 30 ) == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy code sizes.",
+				 function );
+
+				return( -1 );
+			}
+			best_block_size  = block_size;
+			best_pass_number = pass_number;
+		}
+		if( ( pass_number + 1 ) == compressor->number_of_parse_passes )
+		{
+			break;
+		}
+		/* The next parse uses the code sizes of the symbols of this parse
+		 */
+		literals_frequencies[ 256 ] = 1;
+
+		if( assorted_huffman_tree_build_code_sizes(
+		     literals_frequencies,
+		     286,
+		     15,
+		     literals_code_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build literals code sizes.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_huffman_tree_build_code_sizes(
+		     distances_frequencies,
+		     30,
+		     15,
+		     distances_code_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build distances code sizes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( best_pass_number + 1 ) != compressor->number_of_parse_passes )
+	{
+		if( ( memory_copy(
+		       literals_code_sizes,
+		       best_literals_code_sizes,
+		       sizeof( uint8_t ) * 286 ) == NULL )
+		 || ( memory_copy(
+		       distances_code_sizes,
+		       best_distances_code_sizes,
+		       sizeof( uint8_t ) * 30 ) == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy code sizes.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_deflate_compressor_parse_optimal(
+		     compressor,
+		     uncompressed_data,
+		     uncompressed_data_offset,
+		     parse_offset,
+		     parse_size,
+		     literals_code_sizes,
+		     distances_code_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine optimal parse.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Splits the symbols of the compressor into blocks
+ * The split points are chosen to minimize the estimated size of the blocks
+ * The split offsets are relative to the start of the data of the symbols and
+ * must be able to contain the maximum number of blocks + 1 entries, where
+ * the last entry contains the size of the data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_split_symbols(
+     assorted_deflate_compressor_t *compressor,
+     size_t *split_offsets,
+     size_t maximum_number_of_blocks,
+     size_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	uint64_t block_sizes[ ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SPLIT_BLOCKS ];
+	uint8_t split_blocks[ ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SPLIT_BLOCKS ];
+	uint32_t distances_frequencies[ 30 ];
+	uint32_t literals_frequencies[ 286 ];
+	uint32_t right_distances_frequencies[ 30 ];
+	uint32_t right_literals_frequencies[ 286 ];
+	uint32_t total_distances_frequencies[ 30 ];
+	uint32_t total_literals_frequencies[ 286 ];
+
+	static char *function            = "assorted_deflate_compressor_split_symbols";
+	size_t best_split_offset         = 0;
+	size_t block_end_offset          = 0;
+	size_t block_index               = 0;
+	size_t block_start_offset        = 0;
+	size_t data_size                 = 0;
+	size_t largest_number_of_symbols = 0;
+	size_t number_of_symbols         = 0;
+	size_t safe_number_of_blocks     = 0;
+	size_t search_end_offset         = 0;
+	size_t search_start_offset       = 0;
+	size_t split_index               = 0;
+	size_t split_offset              = 0;
+	size_t split_step                = 0;
+	size_t symbol_index              = 0;
+	size_t total_data_size           = 0;
+	uint64_t best_left_block_size    = 0;
+	uint64_t best_right_block_size   = 0;
+	uint64_t best_split_size         = 0;
+	uint64_t left_block_size         = 0;
+	uint64_t right_block_size        = 0;
+	uint32_t symbol                  = 0;
+	uint16_t frequency_index         = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_blocks == 0 )
+	 || ( maximum_number_of_blocks > ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SPLIT_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_symbols = compressor->number_of_symbols;
+
+	if( memory_set(
+	     literals_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 286 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear literals frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     distances_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 30 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear distances frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol_index = 0;
+	     symbol_index < number_of_symbols;
+	     symbol_index++ )
+	{
+		symbol = compressor->symbols[ symbol_index ];
+
+		assorted_deflate_compressor_count_symbol(
+		 symbol,
+		 literals_frequencies,
+		 distances_frequencies,
+		 data_size );
+	}
+	if( assorted_deflate_compressor_get_block_size(
+	     literals_frequencies,
+	     distances_frequencies,
+	     data_size,
+	     &( block_sizes[ 0 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine block size.",
+		 function );
+
+		return( -1 );
+	}
+	split_offsets[ 0 ]    = 0;
+	split_offsets[ 1 ]    = number_of_symbols;
+	split_blocks[ 0 ]     = 1;
+	safe_number_of_blocks = 1;
+
+	/* Repeatedly split the largest block that can be split, while the sum of
+	 * the estimated sizes of the split blocks is smaller than that of the block
+	 */
+	while( safe_number_of_blocks < maximum_number_of_blocks )
+	{
+		block_index               = safe_number_of_blocks;
+		largest_number_of_symbols = 0;
+
+		for( split_index = 0;
+		     split_index < safe_number_of_blocks;
+		     split_index++ )
+		{
+			if( ( split_blocks[ split_index ] != 0 )
+			 && ( ( split_offsets[ split_index + 1 ] - split_offsets[ split_index ] ) > largest_number_of_symbols ) )
+			{
+				block_index               = split_index;
+				largest_number_of_symbols = split_offsets[ split_index + 1 ] - split_offsets[ split_index ];
+			}
+		}
+		if( block_index >= safe_number_of_blocks )
+		{
+			break;
+		}
+		block_start_offset = split_offsets[ block_index ];
+		block_end_offset   = split_offsets[ block_index + 1 ];
+
+		if( ( block_end_offset - block_start_offset ) < ( 2 * ASSORTED_DEFLATE_COMPRESSOR_MINIMUM_SPLIT_NUMBER_OF_SYMBOLS ) )
+		{
+			split_blocks[ block_index ] = 0;
+
+			continue;
+		}
+		if( ( memory_set(
+		       total_literals_frequencies,
+		       0,
+		       sizeof( uint32_t ) * 286 ) == NULL )
+		 || ( memory_set(
+		       total_distances_frequencies,
+		       0,
+		       sizeof( uint32_t ) * 30 ) == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear total frequencies.",
+			 function );
+
+			return( -1 );
+		}
+		total_data_size = 0;
+
+		for( symbol_index = block_start_offset;
+		     symbol_index < block_end_offset;
+		     symbol_index++ )
+		{
+			symbol = compressor->symbols[ symbol_index ];
+
+			assorted_deflate_compressor_count_symbol(
+			 symbol,
+			 total_literals_frequencies,
+			 total_distances_frequencies,
+			 total_data_size );
+		}
+		/* Search the split offset with the smallest size by sampling a number of
+		 * split offsets and refining the search around the best one
+		 */
+		best_split_offset = 0;
+		best_split_size   = (uint64_t) UINT64_MAX;
+
+		search_start_offset = block_start_offset + ASSORTED_DEFLATE_COMPRESSOR_MINIMUM_SPLIT_NUMBER_OF_SYMBOLS;
+		search_end_offset   = block_end_offset - ASSORTED_DEFLATE_COMPRESSOR_MINIMUM_SPLIT_NUMBER_OF_SYMBOLS;
+
+		do
+		{
+			split_step = ( search_end_offset - search_start_offset ) / ( ASSORTED_DEFLATE_COMPRESSOR_NUMBER_OF_SPLIT_POINTS - 1 );
+
+			if( split_step == 0 )
+			{
+				split_step = 1;
+			}
+			if( ( memory_set(
+			       literals_frequencies,
+			       0,
+			       sizeof( uint32_t ) * 286 ) == NULL )
+			 || ( memory_set(
+			       distances_frequencies,
+			       0,
+			       sizeof( uint32_t ) * 30 ) == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear frequencies.",
+				 function );
+
+				return( -1 );
+			}
+			data_size    = 0;
+			symbol_index = block_start_offset;
+
+			for( split_offset = search_start_offset;
+			     split_offset <= search_end_offset;
+			     split_offset += split_step )
+			{
+				while( symbol_index < split_offset )
+				{
+					symbol = compressor->symbols[ symbol_index++ ];
+
+					assorted_deflate_compressor_count_symbol(
+					 symbol,
+					 literals_frequencies,
+					 distances_frequencies,
+					 data_size );
+				}
+				for( frequency_index = 0;
+				     frequency_index < 286;
+				     frequency_index++ )
+				{
+					right_literals_frequencies[ frequency_index ] = total_literals_frequencies[ frequency_index ] - literals_frequencies[ frequency_index ];
+				}
+				for( frequency_index = 0;
+				     frequency_index < 30;
+				     frequency_index++ )
+				{
+					right_distances_frequencies[ frequency_index ] = total_distances_frequencies[ frequency_index ] - distances_frequencies[ frequency_index ];
+				}
+				if( assorted_deflate_compressor_get_block_size(
+				     literals_frequencies,
+				     distances_frequencies,
+				     data_size,
+				     &left_block_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine left block size.",
+					 function );
+
+					return( -1 );
+				}
+				if( assorted_deflate_compressor_get_block_size(
+				     right_literals_frequencies,
+				     right_distances_frequencies,
+				     total_data_size - data_size,
+				     &right_block_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine right block size.",
+					 function );
+
+					return( -1 );
+				}
+				if( ( left_block_size + right_block_size ) < best_split_size )
+				{
+					best_split_offset     = split_offset;
+					best_split_size       = left_block_size + right_block_size;
+					best_left_block_size  = left_block_size;
+					best_right_block_size = right_block_size;
+				}
+			}
+			if( ( best_split_offset - search_start_offset ) > split_step )
+			{
+				search_start_offset = best_split_offset - split_step;
+			}
+			if( ( search_end_offset - best_split_offset ) > split_step )
+			{
+				search_end_offset = best_split_offset + split_step;
+			}
+		}
+		while( split_step > 1 );
+
+		if( best_split_size >= block_sizes[ block_index ] )
+		{
+			split_blocks[ block_index ] = 0;
+
+			continue;
+		}
+		for( split_index = safe_number_of_blocks;
+		     split_index > block_index;
+		     split_index-- )
+		{
+			split_offsets[ split_index + 1 ] = split_offsets[ split_index ];
+			block_sizes[ split_index ]       = block_sizes[ split_index - 1 ];
+			split_blocks[ split_index ]      = split_blocks[ split_index - 1 ];
+		}
+		split_offsets[ block_index + 1 ] = best_split_offset;
+		block_sizes[ block_index ]       = best_left_block_size;
+		block_sizes[ block_index + 1 ]   = best_right_block_size;
+		split_blocks[ block_index + 1 ]  = 1;
+
+		safe_number_of_blocks++;
+	}
+	/* Convert the symbol indexes of the split offsets into data offsets
+	 */
+	data_size    = 0;
+	symbol_index = 0;
+
+	for( split_index = 1;
+	     split_index <= safe_number_of_blocks;
+	     split_index++ )
+	{
+		while( symbol_index < split_offsets[ split_index ] )
+		{
+			symbol = compressor->symbols[ symbol_index++ ];
+
+			if( ( symbol & 0x80000000UL ) == 0 )
+			{
+				data_size += 1;
+			}
+			else
+			{
+				data_size += ( ( symbol >> 16 ) & 0x00ff ) + 3;
+			}
+		}
+		split_offsets[ split_index ] = data_size;
+	}
+	*number_of_blocks = safe_number_of_blocks;
+
+	return( 1 );
+}
+
+/* Finds matches using a binary match tree with iterative optimal parsing
+ * This is used by compression level 10
+ * The data is processed per optimal parsing block, of which the parse is split
+ * into blocks, where the data of every block is parsed again with a cost model
+ * of its own
+ * Matches are searched from the uncompressed data offset, the data before the offset
+ * is used as preset dictionary
+ * Completed blocks are written, the last block remains buffered
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_find_matches_optimal(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	size_t split_offsets[ ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SPLIT_BLOCKS + 1 ];
+	uint8_t block_distances_code_sizes[ 30 ];
+	uint8_t block_literals_code_sizes[ 286 ];
+	uint8_t distances_code_sizes[ 30 ];
+	uint8_t literals_code_sizes[ 286 ];
+
+	static char *function     = "assorted_deflate_compressor_find_matches_optimal";
+	size_t block_data_size    = 0;
+	size_t block_index        = 0;
+	size_t insert_offset      = 0;
+	size_t match_size         = 0;
+	size_t matches_index      = 0;
+	size_t number_of_blocks   = 0;
+	size_t skip_size          = 0;
+	size_t symbol_index       = 0;
+	uint32_t symbol           = 0;
+	uint16_t symbol_value     = 0;
+	uint8_t number_of_matches = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressor->matches == NULL )
+	 || ( compressor->numbers_of_matches == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressor - missing matches.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Add the positions of the preset dictionary to the match tree
+	 */
+	if( uncompressed_data_offset > ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE )
+	{
+		insert_offset = uncompressed_data_offset - ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
+	}
+	if( insert_offset < compressor->hashed_dictionary_size )
+	{
+		insert_offset = compressor->hashed_dictionary_size;
+	}
+	while( insert_offset < uncompressed_data_offset )
+	{
+		if( assorted_deflate_compressor_find_tree_matches(
+		     compressor,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     insert_offset,
+		     NULL,
+		     &number_of_matches,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add position: %" PRIzd " to match tree.",
+			 function,
+			 insert_offset );
+
+			return( -1 );
+		}
+		insert_offset++;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		/* Find the matches of the positions of the optimal parsing block, positions
+		 * within a match of the nice match size are only added to the match tree
+		 */
+		block_data_size = 0;
+		matches_index   = 0;
+		skip_size       = 0;
+
+		while( ( block_data_size < ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_BLOCK_SIZE )
+		    && ( block_data_size < ( uncompressed_data_size - uncompressed_data_offset ) )
+		    && ( ( ASSORTED_DEFLATE_COMPRESSOR_OPTIMAL_MATCHES_SIZE - matches_index ) >= ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_MATCHES ) )
+		{
+			if( assorted_deflate_compressor_find_tree_matches(
+			     compressor,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     uncompressed_data_offset + block_data_size,
+			     ( skip_size == 0 ) ? &( compressor->matches[ matches_index ] ) : NULL,
+			     &number_of_matches,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to find matches of position: %" PRIzd ".",
+				 function,
+				 uncompressed_data_offset + block_data_size );
+
+				return( -1 );
+			}
+			if( skip_size > 0 )
+			{
+				skip_size--;
+			}
+			else if( number_of_matches > 0 )
+			{
+				match_size = compressor->matches[ matches_index + number_of_matches - 1 ] >> 16;
+
+				if( match_size >= compressor->nice_match_size )
+				{
+					skip_size = match_size - 1;
+				}
+			}
+			compressor->numbers_of_matches[ block_data_size++ ] = number_of_matches;
+
+			matches_index += number_of_matches;
+		}
+		/* The first parse uses the code sizes of the fixed Huffman codes
+		 */
+		for( symbol_value = 0;
+		     symbol_value < 286;
+		     symbol_value++ )
+		{
+			if( symbol_value < 144 )
+			{
+				literals_code_sizes[ symbol_value ] = 8;
+			}
+			else if( symbol_value < 256 )
+			{
+				literals_code_sizes[ symbol_value ] = 9;
+			}
+			else if( symbol_value < 280 )
+			{
+				literals_code_sizes[ symbol_value ] = 7;
+			}
+			else
+			{
+				literals_code_sizes[ symbol_value ] = 8;
+			}
+		}
+		for( symbol_value = 0;
+		     symbol_value < 30;
+		     symbol_value++ )
+		{
+			distances_code_sizes[ symbol_value ] = 5;
+		}
+		if( assorted_deflate_compressor_parse_iterative(
+		     compressor,
+		     uncompressed_data,
+		     uncompressed_data_offset,
+		     0,
+		     block_data_size,
+		     literals_code_sizes,
+		     distances_code_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine parse of optimal parsing block.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_deflate_compressor_split_symbols(
+		     compressor,
+		     split_offsets,
+		     ASSORTED_DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_SPLIT_BLOCKS,
+		     &number_of_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to split symbols into blocks.",
+			 function );
+
+			return( -1 );
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			/* The data of a split block is parsed again starting with
+			 * the cost model of the optimal parsing block
+			 */
+			if( number_of_blocks > 1 )
+			{
+				if( ( memory_copy(
+				       block_literals_code_sizes,
+				       literals_code_sizes,
+				       sizeof( uint8_t ) * 286 ) == NULL )
+				 || ( memory_copy(
+				       block_distances_code_sizes,
+				       distances_code_sizes,
+				       sizeof( uint8_t ) * 30 ) == NULL ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy code sizes.",
+					 function );
+
+					return( -1 );
+				}
+				if( assorted_deflate_compressor_parse_iterative(
+				     compressor,
+				     uncompressed_data,
+				     uncompressed_data_offset,
+				     split_offsets[ block_index ],
+				     split_offsets[ block_index + 1 ] - split_offsets[ block_index ],
+				     block_literals_code_sizes,
+				     block_distances_code_sizes,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine parse of block: %" PRIzd ".",
+					 function,
+					 block_index );
+
+					return( -1 );
+				}
+			}
+			for( symbol_index = 0;
+			     symbol_index < compressor->number_of_symbols;
+			     symbol_index++ )
+			{
+				symbol = compressor->symbols[ symbol_index ];
+
+				assorted_deflate_compressor_count_symbol(
+				 symbol,
+				 compressor->literals_frequencies,
+				 compressor->distances_frequencies,
+				 compressor->block_size );
+			}
+			if( ( ( block_index + 1 ) == number_of_blocks )
+			 && ( ( uncompressed_data_size - uncompressed_data_offset ) == block_data_size ) )
+			{
+				break;
+			}
+			if( assorted_deflate_compressor_write_block(
+			     compressor,
+			     uncompressed_data,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		uncompressed_data_offset += block_data_size;
+	}
+	return( 1 );
+}
+
+/* Adds the positions of the preset dictionary to the hash table and hash chain table or match tree
+ * Only the positions of the data of which the largest possible match lies within the dictionary
+ * are added, so that the result does not depend on the data that follows the dictionary
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_add_dictionary(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "assorted_deflate_compressor_add_dictionary";
+	size_t hashed_data_size   = 0;
+	size_t insert_offset      = 0;
+	uint32_t hash_value       = 0;
+	uint32_t value            = 0;
+	uint8_t number_of_matches = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressor->hashed_dictionary_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressor - hashed dictionary size value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid dictionary data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressor->compression_level == 0 )
+	 || ( dictionary_data_size <= 258 ) )
+	{
+		return( 1 );
+	}
+	hashed_data_size = dictionary_data_size - 258;
+
+	if( dictionary_data_size > ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE )
+	{
+		insert_offset = dictionary_data_size - ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
+	}
+	while( insert_offset < hashed_data_size )
+	{
+		if( compressor->compression_level == 1 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( dictionary_data[ insert_offset ] ),
+			 value );
+
+			hash_value = assorted_deflate_compressor_get_fast_hash_value(
+			              value );
+
+			compressor->hash_table[ hash_value ] = insert_offset + 1;
+		}
+		else if( compressor->compression_level == 10 )
+		{
+			if( assorted_deflate_compressor_find_tree_matches(
+			     compressor,
+			     dictionary_data,
+			     dictionary_data_size,
+			     insert_offset,
+			     NULL,
+			     &number_of_matches,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add position: %" PRIzd " to match tree.",
+				 function,
+				 insert_offset );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			hash_value = assorted_deflate_compressor_get_hash_value(
+			              dictionary_data,
+			              insert_offset );
+
+			compressor->chain_table[ insert_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ] = compressor->hash_table[ hash_value ];
+			compressor->hash_table[ hash_value ]                                                        = insert_offset + 1;
+		}
+		insert_offset++;
+	}
+	compressor->hashed_dictionary_size = hashed_data_size;
+
+	return( 1 );
+}
+
+/* Compresses data from the uncompressed data offset using deflate compression
+ * The data before the offset, up to 32 KiB, is used as preset dictionary
+ * The compressor can be reused if its hash tables are restored afterwards
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compressor_compress(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint8_t last_block_flag,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_compressor_compress";
+	int result            = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressor->bit_stream_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressor - bit stream writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_writer_initialize(
+	     &( compressor->bit_stream_writer ),
+	     compressed_data,
+	     *compressed_data_size,
+	     0,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	/* Clear the state of the current block, which can remain after a previous error
+	 */
+	compressor->block_offset      = uncompressed_data_offset;
+	compressor->block_size        = 0;
+	compressor->number_of_symbols = 0;
+
+	if( memory_set(
+	     compressor->literals_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 288 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear literals frequencies.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     compressor->distances_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 30 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear distances frequencies.",
+		 function );
+
+		goto on_error;
+	}
+
+	if( compressor->compression_level == 0 )
+	{
+		if( assorted_deflate_compressor_write_stored_block(
+		     compressor,
+		     &( uncompressed_data[ uncompressed_data_offset ] ),
+		     uncompressed_data_size - uncompressed_data_offset,
+		     last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( compressor->compression_level == 1 )
+		{
+			result = assorted_deflate_compressor_find_matches_fast(
+			          compressor,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          uncompressed_data_offset,
+			          error );
+		}
+		else if( compressor->compression_level == 10 )
+		{
+			result = assorted_deflate_compressor_find_matches_optimal(
+			          compressor,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          uncompressed_data_offset,
+			          error );
+		}
+		else
+		{
+			result = assorted_deflate_compressor_find_matches(
+			          compressor,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          uncompressed_data_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress data.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_deflate_compressor_write_block(
+		     compressor,
+		     uncompressed_data,
+		     last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block.",
+			 function );
+
+			goto on_error;
+		}
+		if( last_block_flag == 0 )
+		{
+			if( assorted_deflate_compressor_write_stored_block(
+			     compressor,
+			     uncompressed_data,
+			     0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write empty uncompressed block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The size of the last byte was accounted for when the block was written
+	 */
+	if( assorted_bit_stream_writer_flush(
+	     compressor->bit_stream_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	*compressed_data_size = compressor->bit_stream_writer->byte_stream_offset;
+
+	if( assorted_bit_stream_writer_free(
+	     &( compressor->bit_stream_writer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressor->bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &( compressor->bit_stream_writer ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compresses data from the uncompressed data offset using deflate compression
+ * The data before the offset, up to 32 KiB, is used as preset dictionary
+ * The compression level ranges from 0 (no compression) to 9 (best compression),
+ * -1 represents the default compression level of 6 and level 10 represents
+ * optimal parsing, which is considerably slower and intended for archival
+ * If the last block flag is not set the compressed data is terminated by an empty
+ * stored block (sync flush), so it ends at a byte boundary and can be followed by
+ * the compressed data of the data that follows
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compress_with_dictionary(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     int compression_level,
+     uint8_t last_block_flag,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_compressor_t *compressor = NULL;
+	static char *function                     = "assorted_deflate_compress_with_dictionary";
+
+	if( assorted_deflate_compressor_initialize(
+	     &compressor,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressor.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_compressor_compress(
+	     compressor,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     uncompressed_data_offset,
+	     last_block_flag,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_compressor_free(
+	     &compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressor.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressor != NULL )
+	{
+		assorted_deflate_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compresses data using deflate compression
+ * The compression level ranges from 0 (no compression) to 9 (best compression),
+ * -1 represents the default compression level of 6 and level 10 represents
+ * optimal parsing, which is considerably slower and intended for archival
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_compress";
+
+	if( assorted_deflate_compress_with_dictionary(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     0,
+	     compression_level,
+	     1,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the compressed data header
+ * The preset dictionary identifier, if any, is not written
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_write_data_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_level,
+     uint8_t preset_dictionary_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_write_data_header";
+	uint16_t data_header  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 2 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data header consists of the compression method 8 (deflate) with a 32 KiB window,
+	 * the compression level and a check value that makes the header a multiple of 31
+	 */
+	data_header = 0x7800;
+
+	if( ( compression_level == -1 )
+	 || ( compression_level == 6 ) )
+	{
+		data_header |= 2 << 6;
+	}
+	else if( compression_level >= 7 )
+	{
+		data_header |= 3 << 6;
+	}
+	else if( compression_level >= 2 )
+	{
+		data_header |= 1 << 6;
+	}
+	if( preset_dictionary_flag != 0 )
+	{
+		data_header |= 0x20;
+	}
+	data_header += 31 - ( data_header % 31 );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 compressed_data,
+	 data_header );
+
+	return( 1 );
+}
+
+/* Compresses data using zlib compression
+ * The compression level ranges from 0 (no compression) to 9 (best compression),
+ * -1 represents the default compression level of 6 and level 10 represents
+ * optimal parsing, which is considerably slower and intended for archival
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compress_zlib(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "assorted_deflate_compress_zlib";
+	size_t deflate_data_size         = 0;
+	size_t safe_compressed_data_size = 0;
+	uint32_t calculated_checksum     = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_size = *compressed_data_size;
+
+	if( safe_compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_compressed_data_size < 6 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_data_size = safe_compressed_data_size - 6;
+
+	if( assorted_deflate_compress(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compression_level,
+	     &( compressed_data[ 2 ] ),
+	     &deflate_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_calculate_adler32(
+	     &calculated_checksum,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_write_data_header(
+	     compressed_data,
+	     safe_compressed_data_size,
+	     compression_level,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data header.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( compressed_data[ 2 + deflate_data_size ] ),
+	 calculated_checksum );
+
+	*compressed_data_size = 2 + deflate_data_size + 4;
+
+	return( 1 );
+}
+
+/* Compresses data using zlib compression with a preset dictionary
+ * The last 32 KiB of the dictionary data are available to the matches of the data
+ * Use a dictionary (assorted_deflate_dictionary_t) to compress many records
+ * with the same dictionary
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_compress_zlib_with_dictionary(
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_dictionary_t *dictionary = NULL;
+	static char *function                     = "assorted_deflate_compress_zlib_with_dictionary";
+
+	if( assorted_deflate_dictionary_initialize(
+	     &dictionary,
+	     dictionary_data,
+	     dictionary_data_size,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_dictionary_compress_zlib(
+	     dictionary,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_dictionary_free(
+	     &dictionary,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( dictionary != NULL )
+	{
+		assorted_deflate_dictionary_free(
+		 &dictionary,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the compressed data header
+ * The preset dictionary flag and identifier are optional, if not provided
+ * data that requires a preset dictionary is not supported
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_read_data_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *preset_dictionary_flag,
+     uint32_t *preset_dictionary_identifier,
+     libcerror_error_t **error )
+{
+	static char *function                 = "assorted_deflate_read_data_header";
+	size_t safe_compressed_data_offset    = 0;
+	uint32_t compression_window_size      = 0;
+	uint32_t safe_dictionary_identifier   = 0;
+	uint8_t compression_information       = 0;
+	uint8_t compression_level             = 0;
+	uint8_t compression_method            = 0;
+	uint8_t compression_window_bits       = 0;
+	uint8_t flags                         = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 2 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > ( compressed_data_size - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: header data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 2,
+		 0 );
+	}
+#endif
+	compression_information   = compressed_data[ safe_compressed_data_offset++ ];
+	compression_method        = compression_information & 0x0f;
+	compression_information >>= 4;
+
+	flags             = compressed_data[ safe_compressed_data_offset++ ];
+	compression_level = flags >> 6;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compression method\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 compression_method );
+
+		libcnotify_printf(
+		 "%s: compression information\t\t\t: %" PRIu8 "\n",
+		 function,
+		 compression_information );
+
+		libcnotify_printf(
+		 "%s: check bits\t\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 flags & 0x1f );
+
+		libcnotify_printf(
+		 "%s: preset dictionary flag\t\t\t: %" PRIu8 "\n",
+		 function,
+		 ( flags >> 5 ) & 0x01 );
+
+		libcnotify_printf(
+		 "%s: compression level\t\t\t\t: %" PRIu8 " (",
+		 function,
+		 compression_level );
+
+		switch( compression_level )
+		{
+			case 0:
+				libcnotify_printf(
+				 "Fastest" );
+				break;
+
+			case 1:
+				libcnotify_printf(
+				 "Fast" );
+				break;
+
+			case 2:
+				libcnotify_printf(
+				 "Default" );
+				break;
+
+			case 3:
+			default:
+				libcnotify_printf(
+				 "Slow/Maximum" );
+				break;
+		}
+		libcnotify_printf(
+		 ")\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+/* TODO validate check bits */
+	if( ( flags & 0x20 ) != 0 )
+	{
+		if( ( compressed_data_size < 4 )
+		 || ( safe_compressed_data_offset > ( compressed_data_size - 4 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 safe_dictionary_identifier );
+
+		safe_compressed_data_offset += 4;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: preset dictionary identifier\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 safe_dictionary_identifier );
+		}
+#endif
+		if( ( preset_dictionary_flag == NULL )
+		 || ( preset_dictionary_identifier == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported preset dictionary: 0x%08" PRIx32 ".",
+			 function,
+			 safe_dictionary_identifier );
+
+			return( -1 );
+		}
+	}
+	if( compression_method != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method: %" PRIu8 ".",
+		 function,
+		 compression_method );
+
+		return( -1 );
+	}
+	compression_window_bits = (uint8_t) compression_information + 8;
+	compression_window_size = 1UL << compression_window_bits;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compression window size\t\t\t: %" PRIu32 " (%" PRIu8 ")\n",
+		 function,
+		 compression_window_size,
+		 compression_window_bits );
+	}
+#endif
+	if( compression_window_size > 32768 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression window size: %" PRIu32 ".",
+		 function,
+		 compression_window_size );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	if( preset_dictionary_flag != NULL )
+	{
+		*preset_dictionary_flag = ( flags >> 5 ) & 0x01;
+	}
+	if( preset_dictionary_identifier != NULL )
+	{
+		*preset_dictionary_identifier = safe_dictionary_identifier;
+	}
+	return( 1 );
+}
+
+/* Reads a gzip member header
+ * The member size is set to the size of the member if stored in a BGZF extra field or 0 otherwise
+ * Returns 1 on success, 0 if the compressed data does not contain the complete member header or -1 on error
+ */
+int assorted_deflate_read_gzip_member_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t *member_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_deflate_read_gzip_member_header";
+	size_t extra_data_end_offset       = 0;
+	size_t header_data_offset          = 0;
+	size_t safe_compressed_data_offset = 0;
+	size_t safe_member_size            = 0;
+	uint32_t calculated_checksum       = 0;
+	uint16_t extra_data_size           = 0;
+	uint16_t stored_checksum           = 0;
+	uint16_t subfield_data_size        = 0;
+	uint8_t compression_method         = 0;
+	uint8_t flags                      = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	header_data_offset = safe_compressed_data_offset;
+
+	/* The fixed part of the member header consists of 10 bytes
+	 */
+	if( ( compressed_data_size - safe_compressed_data_offset ) < 10 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: member header data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 10,
+		 0 );
+	}
+#endif
+	if( ( compressed_data[ safe_compressed_data_offset ] != 0x1f )
+	 || ( compressed_data[ safe_compressed_data_offset + 1 ] != 0x8b ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported member signature.",
+		 function );
+
+		return( -1 );
+	}
+	compression_method = compressed_data[ safe_compressed_data_offset + 2 ];
+	flags              = compressed_data[ safe_compressed_data_offset + 3 ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compression method\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 compression_method );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 flags );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( compression_method != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method: %" PRIu8 ".",
+		 function,
+		 compression_method );
+
+		return( -1 );
+	}
+	if( ( flags & 0xe0 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset += 10;
+
+	if( ( flags & ASSORTED_DEFLATE_GZIP_FLAG_EXTRA ) != 0 )
+	{
+		if( ( compressed_data_size - safe_compressed_data_offset ) < 2 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 extra_data_size );
+
+		safe_compressed_data_offset += 2;
+
+		if( (size_t) extra_data_size > ( compressed_data_size - safe_compressed_data_offset ) )
+		{
+			return( 0 );
+		}
+		extra_data_end_offset = safe_compressed_data_offset + extra_data_size;
+
+		/* The BGZF extra subfield "BC" contains the size of the member - 1
+		 */
+		while( ( extra_data_end_offset - safe_compressed_data_offset ) >= 4 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( compressed_data[ safe_compressed_data_offset + 2 ] ),
+			 subfield_data_size );
+
+			if( (size_t) subfield_data_size > ( extra_data_end_offset - safe_compressed_data_offset - 4 ) )
+			{
+				break;
+			}
+			if( ( compressed_data[ safe_compressed_data_offset ] == 'B' )
+			 && ( compressed_data[ safe_compressed_data_offset + 1 ] == 'C' )
+			 && ( subfield_data_size == 2 ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ safe_compressed_data_offset + 4 ] ),
+				 safe_member_size );
+
+				safe_member_size += 1;
+			}
+			safe_compressed_data_offset += 4 + (size_t) subfield_data_size;
+		}
+		safe_compressed_data_offset = extra_data_end_offset;
+	}
+	if( ( flags & ASSORTED_DEFLATE_GZIP_FLAG_NAME ) != 0 )
+	{
+		while( ( safe_compressed_data_offset < compressed_data_size )
+		    && ( compressed_data[ safe_compressed_data_offset ] != 0 ) )
+		{
+			safe_compressed_data_offset++;
+		}
+		if( safe_compressed_data_offset >= compressed_data_size )
+		{
+			return( 0 );
+		}
+		/* Skip the end-of-string character
+		 */
+		safe_compressed_data_offset++;
+	}
+	if( ( flags & ASSORTED_DEFLATE_GZIP_FLAG_COMMENT ) != 0 )
+	{
+		while( ( safe_compressed_data_offset < compressed_data_size )
+		    && ( compressed_data[ safe_compressed_data_offset ] != 0 ) )
+		{
+			safe_compressed_data_offset++;
+		}
+		if( safe_compressed_data_offset >= compressed_data_size )
+		{
+			return( 0 );
+		}
+		/* Skip the end-of-string character
+		 */
+		safe_compressed_data_offset++;
+	}
+	if( ( flags & ASSORTED_DEFLATE_GZIP_FLAG_HEADER_CRC ) != 0 )
+	{
+		if( ( compressed_data_size - safe_compressed_data_offset ) < 2 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 stored_checksum );
+
+		/* The header checksum consists of the lower 16 bits of the CRC-32 of the header
+		 */
+		if( assorted_crc32_calculate(
+		     &calculated_checksum,
+		     &( compressed_data[ header_data_offset ] ),
+		     safe_compressed_data_offset - header_data_offset,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate header checksum.",
+			 function );
+
+			return( -1 );
+		}
+		if( stored_checksum != (uint16_t) calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: header checksum does not match (stored: 0x%04" PRIx16 ", calculated: 0x%04" PRIx16 ").",
+			 function,
+			 stored_checksum,
+			 (uint16_t) calculated_checksum );
+
+			return( -1 );
+		}
+		safe_compressed_data_offset += 2;
+	}
+	if( ( safe_member_size != 0 )
+	 && ( safe_member_size < ( safe_compressed_data_offset - header_data_offset + 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid member size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+	*member_size            = safe_member_size;
+
+	return( 1 );
+}
+
+/* Reads the header of a block of compressed data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_read_block_header(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t *block_type,
+     uint8_t *last_block_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_read_block_header";
+	uint32_t value_32bit  = 0;
+
+	if( block_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block type.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_block_flag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last block flag.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_get_value_back_to_front(
+	     bit_stream,
+	     3,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	*last_block_flag = (uint8_t) ( value_32bit & 0x00000001UL );
+	value_32bit    >>= 1;
+	*block_type      = (uint8_t) value_32bit;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block header last block flag\t\t\t: %" PRIu8 "\n",
+		 function,
+		 *last_block_flag );
+
+		libcnotify_printf(
+		 "%s: block header block type\t\t\t: %" PRIu8 " (",
+		 function,
+		 *block_type );
+
+		switch( *block_type )
+		{
+			case ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+				libcnotify_printf(
+				 "Uncompressed" );
+				break;
+
+			case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+				libcnotify_printf(
+				 "Fixed Huffman" );
+				break;
+
+			case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+				libcnotify_printf(
+				 "Dynamic Huffman" );
+				break;
+
+			case ASSORTED_DEFLATE_BLOCK_TYPE_RESERVED:
+			default:
+				libcnotify_printf(
+				 "Reserved" );
+				break;
+		}
+		libcnotify_printf(
+		 ")\n" );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Reads a block of compressed data
+ * The block is added to the statistics if not NULL
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_read_block(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t block_type,
+     assorted_huffman_tree_t *fixed_huffman_literals_tree,
+     assorted_huffman_tree_t *fixed_huffman_distances_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	return( assorted_deflate_read_block_with_arena(
+	         bit_stream,
+	         block_type,
+	         fixed_huffman_literals_tree,
+	         fixed_huffman_distances_tree,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         uncompressed_data_offset,
+	         statistics,
+	         NULL,
+	         error ) );
+}
+
+/* Reads a block of compressed data
+ * The block is added to the statistics if not NULL
+ * The dynamic Huffman trees are allocated from the arena if not NULL, the
+ * arena is rewound after the block was read
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_read_block_with_arena(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t block_type,
+     assorted_huffman_tree_t *fixed_huffman_literals_tree,
+     assorted_huffman_tree_t *fixed_huffman_distances_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_deflate_statistics_t *statistics,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	assorted_huffman_tree_t *dynamic_huffman_distances_tree = NULL;
+	assorted_huffman_tree_t *dynamic_huffman_literals_tree  = NULL;
+	static char *function                                   = "assorted_deflate_read_block_with_arena";
+	size_t arena_data_offset                                = 0;
+	size_t safe_uncompressed_data_offset                    = 0;
+	uint32_t block_size                                     = 0;
+	uint32_t block_size_copy                                = 0;
+	uint32_t value_32bit                                    = 0;
+	uint8_t skip_bits                                       = 0;
+
+#if defined( HAVE_DECODE_STATISTICS )
+	clock_t start_time                                      = 0;
+#endif
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( block_type )
+	{
+		case ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+			if( uncompressed_data_offset == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+			safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+			/* Ignore the bits in the buffer upto the next byte
+			 */
+			skip_bits = bit_stream->bit_buffer_size & 0x07;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: skip bits\t\t\t\t\t\t: %" PRIu8 "\n",
+				 function,
+				 skip_bits );
+			}
+#endif
+			if( skip_bits > 0 )
+			{
+				if( assorted_bit_stream_get_value_back_to_front(
+				     bit_stream,
+				     skip_bits,
+				     &value_32bit,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value from bit stream.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( assorted_bit_stream_get_value_back_to_front(
+			     bit_stream,
+			     32,
+			     &block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			block_size_copy = block_size >> 16;
+			block_size     &= 0x0000ffffUL;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: block header unknown1\t\t\t\t: %" PRIu32 "\n",
+				 function,
+				 value_32bit );
+
+				libcnotify_printf(
+				 "%s: block header block size\t\t\t\t: %" PRIu32 "\n",
+				 function,
+				 block_size );
+
+				libcnotify_printf(
+				 "%s: block header block size copy\t\t\t: %" PRIu16 " (%" PRIu32 ")\n",
+				 function,
+				 block_size_copy ^ 0x0000ffffUL,
+				 block_size_copy );
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			block_size_copy ^= 0x0000ffffUL;
+
+			if( block_size != block_size_copy )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+				 "%s: mismatch in block size ( %" PRIu32 " != %" PRIu32 " ).",
+				 function,
+				 block_size,
+				 block_size_copy );
+
+				goto on_error;
+			}
+			/* Return the bytes remaining in the bit buffer to the byte stream
+			 */
+			bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+			bit_stream->bit_buffer          = 0;
+			bit_stream->bit_buffer_size     = 0;
+
+			if( block_size == 0 )
+			{
+#if defined( HAVE_DECODE_STATISTICS )
+				if( statistics != NULL )
+				{
+					statistics->number_of_uncompressed_blocks += 1;
+				}
+#endif
+				break;
+			}
+			if( (size_t) block_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data value too small.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( (size_t) block_size > uncompressed_data_size )
+			 || ( safe_uncompressed_data_offset > ( uncompressed_data_size - block_size ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+			     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+			     (size_t) block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to initialize lz buffer.",
+				 function );
+
+				goto on_error;
+			}
+			bit_stream->byte_stream_offset += block_size;
+			safe_uncompressed_data_offset  += block_size;
+
+			*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->number_of_uncompressed_blocks += 1;
+				statistics->uncompressed_blocks_data_size += block_size;
+			}
+#endif
+			break;
+
+		case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+#if defined( HAVE_DECODE_STATISTICS )
+			start_time = clock();
+#endif
+			if( assorted_deflate_decode_huffman(
+			     bit_stream,
+			     fixed_huffman_literals_tree,
+			     fixed_huffman_distances_tree,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     uncompressed_data_offset,
+			     statistics,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode fixed Huffman encoded bit stream.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->number_of_fixed_huffman_blocks += 1;
+				statistics->decode_time                    += (uint64_t) ( clock() - start_time );
+			}
+#endif
+			break;
+
+		case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+			if( arena != NULL )
+			{
+				arena_data_offset = arena->data_offset;
+			}
+			if( assorted_huffman_tree_initialize_with_arena(
+			     &dynamic_huffman_literals_tree,
+			     288,
+			     15,
+			     arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create dynamic literals Huffman tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( assorted_huffman_tree_initialize_with_arena(
+			     &dynamic_huffman_distances_tree,
+			     30,
+			     15,
+			     arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create dynamic distances Huffman tree.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DECODE_STATISTICS )
+			start_time = clock();
+#endif
+			if( assorted_deflate_build_dynamic_huffman_trees(
+			     bit_stream,
+			     dynamic_huffman_literals_tree,
+			     dynamic_huffman_distances_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build dynamic Huffman trees.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->build_trees_time += (uint64_t) ( clock() - start_time );
+			}
+			start_time = clock();
+#endif
+			if( assorted_deflate_decode_huffman(
+			     bit_stream,
+			     dynamic_huffman_literals_tree,
+			     dynamic_huffman_distances_tree,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     uncompressed_data_offset,
+			     statistics,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode dynamic Huffman encoded bit stream.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DECODE_STATISTICS )
+			if( statistics != NULL )
+			{
+				statistics->number_of_dynamic_huffman_blocks += 1;
+				statistics->decode_time                      += (uint64_t) ( clock() - start_time );
+			}
+#endif
+			if( assorted_huffman_tree_free(
+			     &dynamic_huffman_distances_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free dynamic distances Huffman tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( assorted_huffman_tree_free(
+			     &dynamic_huffman_literals_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free dynamic literals Huffman tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( arena != NULL )
+			{
+				if( assorted_arena_rewind(
+				     arena,
+				     arena_data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to rewind arena.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			break;
+
+		case ASSORTED_DEFLATE_BLOCK_TYPE_RESERVED:
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block type.",
+			 function );
+
+			goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( dynamic_huffman_distances_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &dynamic_huffman_distances_tree,
+		 NULL );
+	}
+	if( dynamic_huffman_literals_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &dynamic_huffman_literals_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using DEFLATE compression
+ * The decoded blocks are added to the statistics if not NULL
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	return( assorted_deflate_decompress_with_arena(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         statistics,
+	         NULL,
+	         error ) );
+}
+
+/* Decompresses data using DEFLATE compression
+ * The decoded blocks are added to the statistics if not NULL
+ * The scratch memory is allocated from the arena if not NULL, the arena is
+ * rewound on return so that it can be reused for the next call
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_decompress_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_deflate_statistics_t *statistics,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream  = NULL;
+	static char *function              = "assorted_deflate_decompress_with_arena";
+	size_t arena_data_offset           = 0;
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset >= compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		arena_data_offset = arena->data_offset;
+	}
+	if( assorted_bit_stream_initialize_with_arena(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     compressed_data_offset,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
+	{
+		if( assorted_deflate_read_block_header(
+		     bit_stream,
+		     &block_type,
+		     &last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data block header.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_deflate_read_block_with_arena(
+		     bit_stream,
+		     block_type,
+		     &assorted_deflate_fixed_huffman_literals_tree,
+		     &assorted_deflate_fixed_huffman_distances_tree,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     statistics,
+		     arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data block.",
+			 function );
+
+			goto on_error;
+		}
+		if( last_block_flag != 0 )
+		{
+			break;
+		}
+	}
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		if( assorted_arena_rewind(
+		     arena,
+		     arena_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_rewind(
+		 arena,
+		 arena_data_offset,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using DEFLATE compression stored in the zlib compressed data format
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_decompress_zlib(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( assorted_deflate_decompress_zlib_with_arena(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         NULL,
+	         error ) );
+}
+
+/* Decompresses data using DEFLATE compression stored in the zlib compressed data format
+ * The scratch memory is allocated from the arena if not NULL, the arena is
+ * rewound on return so that it can be reused for the next call
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_decompress_zlib_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	return( assorted_deflate_decompress_zlib_with_preset_dictionary(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         0,
+	         0,
+	         arena,
+	         error ) );
+}
+
+/* Decompresses data using DEFLATE compression stored in the zlib compressed data format
+ * The uncompressed data before the uncompressed data offset contains the preset dictionary,
+ * or its last 32 KiB, of which the identifier is compared to that of the compressed data
+ * The uncompressed data size contains the size of the uncompressed data including
+ * the preset dictionary and on return the size of the decompressed data
+ * The scratch memory is allocated from the arena if not NULL, the arena is
+ * rewound on return so that it can be reused for the next call
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_decompress_zlib_with_preset_dictionary(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint32_t preset_dictionary_identifier,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream     = NULL;
+	static char *function                 = "assorted_deflate_decompress_zlib_with_preset_dictionary";
+	size_t arena_data_offset              = 0;
+	size_t block_data_offset              = 0;
+	size_t compressed_data_offset         = 0;
+	size_t safe_uncompressed_data_offset  = 0;
+	size_t safe_uncompressed_data_size    = 0;
+	uint32_t calculated_checksum          = 1;
+	uint32_t stored_checksum              = 0;
+	uint32_t stored_dictionary_identifier = 0;
+	uint8_t block_type                    = 0;
+	uint8_t last_block_flag               = 0;
+	uint8_t preset_dictionary_flag        = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset > safe_uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_read_data_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     &preset_dictionary_flag,
+	     &stored_dictionary_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data header.",
+		 function );
+
+		goto on_error;
+	}
+	if( preset_dictionary_flag != 0 )
+	{
+		if( uncompressed_data_offset == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing preset dictionary: 0x%08" PRIx32 ".",
+			 function,
+			 stored_dictionary_identifier );
+
+			goto on_error;
+		}
+		if( stored_dictionary_identifier != preset_dictionary_identifier )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: preset dictionary identifier does not match (stored: 0x%08" PRIx32 ", expected: 0x%08" PRIx32 ").",
+			 function,
+			 stored_dictionary_identifier,
+			 preset_dictionary_identifier );
+
+			goto on_error;
+		}
+	}
+	safe_uncompressed_data_offset = uncompressed_data_offset;
+
+	if( compressed_data_offset >= compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		arena_data_offset = arena->data_offset;
+	}
+	if( assorted_bit_stream_initialize_with_arena(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     compressed_data_offset,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	    || ( bit_stream->bit_buffer_size >= 8 ) )
+	{
+		if( assorted_deflate_read_block_header(
+		     bit_stream,
+		     &block_type,
+		     &last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data block header.",
+			 function );
+
+			goto on_error;
+		}
+		block_data_offset = safe_uncompressed_data_offset;
+
+		if( assorted_deflate_read_block_with_arena(
+		     bit_stream,
+		     block_type,
+		     &assorted_deflate_fixed_huffman_literals_tree,
+		     &assorted_deflate_fixed_huffman_distances_tree,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &safe_uncompressed_data_offset,
+		     NULL,
+		     arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data block.",
+			 function );
+
+			goto on_error;
+		}
+		/* Update the checksum while the data of the block is still cached
+		 */
+		if( assorted_adler32_calculate_checksum_unfolded16_4(
+		     &calculated_checksum,
+		     &( uncompressed_data[ block_data_offset ] ),
+		     safe_uncompressed_data_offset - block_data_offset,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		if( last_block_flag != 0 )
+		{
+			break;
+		}
+	}
+	/* Return the bytes remaining in the bit buffer to the byte stream
+	 */
+	bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+	bit_stream->bit_buffer          = 0;
+	bit_stream->bit_buffer_size     = 0;
+
+	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: stored checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 stored_checksum );
+
+			libcnotify_printf(
+			 "%s: calculated checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 calculated_checksum );
+		}
+#endif
+		if( stored_checksum != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+
+			goto on_error;
+		}
+	}
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		if( assorted_arena_rewind(
+		     arena,
+		     arena_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*uncompressed_data_size = safe_uncompressed_data_offset - uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_rewind(
+		 arena,
+		 arena_data_offset,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using DEFLATE compression stored in the zlib compressed data format
+ * with a preset dictionary, data that does not require a preset dictionary is also supported
+ * Use a dictionary (assorted_deflate_dictionary_t) to decompress many records
+ * with the same dictionary
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_decompress_zlib_with_dictionary(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_dictionary_t *dictionary = NULL;
+	static char *function                     = "assorted_deflate_decompress_zlib_with_dictionary";
+
+	if( assorted_deflate_dictionary_initialize(
+	     &dictionary,
+	     dictionary_data,
+	     dictionary_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_dictionary_decompress_zlib(
+	     dictionary,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_dictionary_free(
+	     &dictionary,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( dictionary != NULL )
+	{
+		assorted_deflate_dictionary_free(
+		 &dictionary,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using DEFLATE compression stored in the gzip compressed data format
+ * Concatenated members are decompressed one after the other, data that follows
+ * the last member and does not start with a member signature is ignored
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_decompress_gzip(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream  = NULL;
+	static char *function              = "assorted_deflate_decompress_gzip";
+	size_t block_data_offset           = 0;
+	size_t compressed_data_offset      = 0;
+	size_t member_data_offset          = 0;
+	size_t member_offset               = 0;
+	size_t member_size                 = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t stored_checksum           = 0;
+	uint32_t stored_uncompressed_size  = 0;
+	uint8_t block_type                 = 0;
+	uint8_t last_block_flag            = 0;
+	int result                         = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_initialize(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     0,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		member_offset = compressed_data_offset;
+
+		result = assorted_deflate_read_gzip_member_header(
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          &member_size,
+		          error );
+
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read member header.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_bit_stream_set_byte_stream_offset(
+		     bit_stream,
+		     compressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set byte stream offset.",
+			 function );
+
+			goto on_error;
+		}
+		member_data_offset  = uncompressed_data_offset;
+		calculated_checksum = 0;
+		last_block_flag     = 0;
+
+		while( last_block_flag == 0 )
+		{
+			if( assorted_deflate_read_block_header(
+			     bit_stream,
+			     &block_type,
+			     &last_block_flag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data block header.",
+				 function );
+
+				goto on_error;
+			}
+			block_data_offset = uncompressed_data_offset;
+
+			if( assorted_deflate_read_block(
+			     bit_stream,
+			     block_type,
+			     &assorted_deflate_fixed_huffman_literals_tree,
+			     &assorted_deflate_fixed_huffman_distances_tree,
+			     uncompressed_data,
+			     safe_uncompressed_data_size,
+			     &uncompressed_data_offset,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data block.",
+				 function );
+
+				goto on_error;
+			}
+			/* Update the checksum while the data of the block is still cached
+			 */
+			if( assorted_crc32_calculate(
+			     &calculated_checksum,
+			     &( uncompressed_data[ block_data_offset ] ),
+			     uncompressed_data_offset - block_data_offset,
+			     calculated_checksum,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to calculate checksum.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Return the bytes remaining in the bit buffer to the byte stream
+		 */
+		bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+		bit_stream->bit_buffer          = 0;
+		bit_stream->bit_buffer_size     = 0;
+
+		compressed_data_offset = bit_stream->byte_stream_offset;
+
+		/* The member footer consists of the CRC-32 and the 32-bit uncompressed size
+		 */
+		if( ( compressed_data_size - compressed_data_offset ) < 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 stored_checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_offset + 4 ] ),
+		 stored_uncompressed_size );
+
+		compressed_data_offset += 8;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: stored checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 stored_checksum );
+
+			libcnotify_printf(
+			 "%s: calculated checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 calculated_checksum );
+
+			libcnotify_printf(
+			 "%s: stored uncompressed size\t\t\t\t: %" PRIu32 "\n",
+			 function,
+			 stored_uncompressed_size );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( stored_checksum != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+
+			goto on_error;
+		}
+		/* The stored uncompressed size contains the size modulo 2^32
+		 */
+		if( stored_uncompressed_size != (uint32_t) ( uncompressed_data_offset - member_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in uncompressed size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( member_size != 0 )
+		 && ( member_size != ( compressed_data_offset - member_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in member size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( ( ( compressed_data_size - compressed_data_offset ) >= 2 )
+	    && ( compressed_data[ compressed_data_offset ] == 0x1f )
+	    && ( compressed_data[ compressed_data_offset + 1 ] == 0x8b ) );
+
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( compressed_data_size < 2 )
-	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a decoder context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_context_initialize(
+     assorted_deflate_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_context_initialize";
+
+	if( context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid compressed data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_offset == NULL )
+	if( *context != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
 		 function );
 
 		return( -1 );
 	}
-	safe_compressed_data_offset = *compressed_data_offset;
+	*context = memory_allocate_structure(
+	            assorted_deflate_context_t );
 
-	if( safe_compressed_data_offset > ( compressed_data_size - 2 ) )
+	if( *context == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid compressed data value too small.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( assorted_deflate_context_t ) ) == NULL )
 	{
-		libcnotify_printf(
-		 "%s: header data:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
 		 function );
-		libcnotify_print_data(
-		 &( compressed_data[ safe_compressed_data_offset ] ),
-		 2,
-		 0 );
-	}
-#endif
-	compression_information   = compressed_data[ safe_compressed_data_offset++ ];
-	compression_method        = compression_information & 0x0f;
-	compression_information >>= 4;
-
-	flags             = compressed_data[ safe_compressed_data_offset++ ];
-	compression_level = flags >> 6;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: compression method\t\t\t\t: %" PRIu8 "\n",
-		 function,
-		 compression_method );
+		memory_free(
+		 *context );
 
-		libcnotify_printf(
-		 "%s: compression information\t\t\t: %" PRIu8 "\n",
-		 function,
-		 compression_information );
+		*context = NULL;
 
-		libcnotify_printf(
-		 "%s: check bits\t\t\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 flags & 0x1f );
+		return( -1 );
+	}
+	/* The slab of the arena is sized by the first reset after a stream
+	 * that did not fit
+	 */
+	if( assorted_arena_initialize(
+	     &( ( *context )->arena ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
 
-		libcnotify_printf(
-		 "%s: preset dictionary flag\t\t\t: %" PRIu8 "\n",
-		 function,
-		 ( flags >> 5 ) & 0x01 );
+		goto on_error;
+	}
+	return( 1 );
 
-		libcnotify_printf(
-		 "%s: compression level\t\t\t\t: %" PRIu8 " (",
-		 function,
-		 compression_level );
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
 
-		switch( compression_level )
-		{
-			case 0:
-				libcnotify_printf(
-				 "Fastest" );
-				break;
+		*context = NULL;
+	}
+	return( -1 );
+}
 
-			case 1:
-				libcnotify_printf(
-				 "Fast" );
-				break;
+/* Frees a decoder context
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_context_free(
+     assorted_deflate_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_context_free";
+	int result            = 1;
 
-			case 2:
-				libcnotify_printf(
-				 "Default" );
-				break;
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
-			case 3:
-			default:
-				libcnotify_printf(
-				 "Slow/Maximum" );
-				break;
-		}
-		libcnotify_printf(
-		 ")\n" );
+		return( -1 );
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-/* TODO validate check bits */
-	if( ( flags & 0x20 ) != 0 )
+	if( *context != NULL )
 	{
-		if( ( compressed_data_size < 4 )
-		 || ( safe_compressed_data_offset > ( compressed_data_size - 4 ) ) )
+		if( assorted_arena_free(
+		     &( ( *context )->arena ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid compressed data value too small.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
-		byte_stream_copy_to_uint32_big_endian(
-		 &( compressed_data[ safe_compressed_data_offset ] ),
-		 preset_dictionary_identifier );
+		memory_free(
+		 *context );
 
-		safe_compressed_data_offset += 4;
+		*context = NULL;
+	}
+	return( result );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: preset dictionary identifier\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 preset_dictionary_identifier );
-		}
-#endif
+/* Resets a decoder context
+ * The scratch memory of the previous stream is released and the arena is
+ * grown to fit it, so that a following stream of a similar size is decoded
+ * without allocating
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_context_reset(
+     assorted_deflate_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_context_reset";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
 	}
-	if( compression_method != 8 )
+	if( assorted_arena_reset(
+	     context->arena,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression method: %" PRIu8 ".",
-		 function,
-		 compression_method );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset arena.",
+		 function );
 
 		return( -1 );
 	}
-	compression_window_bits = (uint8_t) compression_information + 8;
-	compression_window_size = 1UL << compression_window_bits;
+	return( 1 );
+}
+
+/* Decompresses data using DEFLATE compression using a decoder context
+ * The context is reset before the stream is decompressed
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_context_decompress(
+     assorted_deflate_context_t *context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_context_decompress";
+
+	if( assorted_deflate_context_reset(
+	     context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset context.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_decompress_with_arena(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     statistics,
+	     context->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses data using DEFLATE compression stored in the zlib compressed data format using a decoder context
+ * The context is reset before the stream is decompressed
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_context_decompress_zlib(
+     assorted_deflate_context_t *context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_context_decompress_zlib";
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: compression window size\t\t\t: %" PRIu32 " (%" PRIu8 ")\n",
-		 function,
-		 compression_window_size,
-		 compression_window_bits );
-	}
-#endif
-	if( compression_window_size > 32768 )
+	if( assorted_deflate_context_reset(
+	     context,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression window size: %" PRIu32 ".",
-		 function,
-		 compression_window_size );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset context.",
+		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( assorted_deflate_decompress_zlib_with_arena(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     context->arena,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	*compressed_data_offset = safe_compressed_data_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Reads the header of a block of compressed data
- * Returns 1 on success or -1 on error
+/* Creates a dictionary
+ * The dictionary contains a preset dictionary shared by many small similar records,
+ * the positions of which are added to the hash tables of the compressor only once
+ * Make sure the value dictionary is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
  */
-int assorted_deflate_read_block_header(
-     assorted_bit_stream_t *bit_stream,
-     uint8_t *block_type,
-     uint8_t *last_block_flag,
+int assorted_deflate_dictionary_initialize(
+     assorted_deflate_dictionary_t **dictionary,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     int compression_level,
      libcerror_error_t **error )
 {
-	static char *function = "assorted_deflate_read_block_header";
-	uint32_t value_32bit  = 0;
+	static char *function = "assorted_deflate_dictionary_initialize";
+	size_t array_size     = 0;
 
-	if( block_type == NULL )
+	if( dictionary == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid block type.",
+		 "%s: invalid dictionary.",
 		 function );
 
 		return( -1 );
 	}
-	if( last_block_flag == NULL )
+	if( *dictionary != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid dictionary value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid last block flag.",
+		 "%s: invalid dictionary data.",
 		 function );
 
 		return( -1 );
 	}
-	if( assorted_bit_stream_get_value(
-	     bit_stream,
-	     3,
-	     &value_32bit,
+	if( ( dictionary_data_size == 0 )
+	 || ( dictionary_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid dictionary data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*dictionary = memory_allocate_structure(
+	               assorted_deflate_dictionary_t );
+
+	if( *dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *dictionary,
+	     0,
+	     sizeof( assorted_deflate_dictionary_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear dictionary.",
+		 function );
+
+		memory_free(
+		 *dictionary );
+
+		*dictionary = NULL;
+
+		return( -1 );
+	}
+	/* The identifier is calculated over all the dictionary data, as zlib does,
+	 * while only the last 32 KiB can be referenced by the compressed data
+	 */
+	if( assorted_deflate_calculate_adler32(
+	     &( ( *dictionary )->identifier ),
+	     dictionary_data,
+	     dictionary_data_size,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from bit stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate identifier.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*last_block_flag = (uint8_t) ( value_32bit & 0x00000001UL );
-	value_32bit    >>= 1;
-	*block_type      = (uint8_t) value_32bit;
+	( *dictionary )->dictionary_size = dictionary_data_size;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( *dictionary )->dictionary_size > ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE )
 	{
-		libcnotify_printf(
-		 "%s: block header last block flag\t\t\t: %" PRIu8 "\n",
-		 function,
-		 *last_block_flag );
+		( *dictionary )->dictionary_size = ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
+	}
+	( *dictionary )->data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * ( *dictionary )->dictionary_size );
 
-		libcnotify_printf(
-		 "%s: block header block type\t\t\t: %" PRIu8 " (",
-		 function,
-		 *block_type );
+	if( ( *dictionary )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
 
-		switch( *block_type )
+		goto on_error;
+	}
+	( *dictionary )->data_size = ( *dictionary )->dictionary_size;
+
+	if( memory_copy(
+	     ( *dictionary )->data,
+	     &( dictionary_data[ dictionary_data_size - ( *dictionary )->dictionary_size ] ),
+	     ( *dictionary )->dictionary_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy dictionary data.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_compressor_initialize(
+	     &( ( *dictionary )->compressor ),
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressor.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_compressor_add_dictionary(
+	     ( *dictionary )->compressor,
+	     ( *dictionary )->data,
+	     ( *dictionary )->dictionary_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add dictionary to compressor.",
+		 function );
+
+		goto on_error;
+	}
+	/* Keep a copy of the hash tables so that they can be restored after each record
+	 */
+	if( ( *dictionary )->compressor->hash_table != NULL )
+	{
+		array_size = sizeof( size_t ) * ( 1 << ASSORTED_DEFLATE_COMPRESSOR_HASH_TABLE_BITS );
+
+		( *dictionary )->hash_table = (size_t *) memory_allocate(
+		                                          array_size );
+
+		if( ( *dictionary )->hash_table == NULL )
 		{
-			case ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
-				libcnotify_printf(
-				 "Uncompressed" );
-				break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hash table.",
+			 function );
 
-			case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
-				libcnotify_printf(
-				 "Fixed Huffman" );
-				break;
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *dictionary )->hash_table,
+		     ( *dictionary )->compressor->hash_table,
+		     array_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy hash table.",
+			 function );
 
-			case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
-				libcnotify_printf(
-				 "Dynamic Huffman" );
-				break;
+			goto on_error;
+		}
+	}
+	if( ( *dictionary )->compressor->chain_table != NULL )
+	{
+		array_size = sizeof( size_t ) * ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
 
-			case ASSORTED_DEFLATE_BLOCK_TYPE_RESERVED:
-			default:
-				libcnotify_printf(
-				 "Reserved" );
-				break;
+		( *dictionary )->chain_table = (size_t *) memory_allocate(
+		                                           array_size );
+
+		if( ( *dictionary )->chain_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chain table.",
+			 function );
+
+			goto on_error;
 		}
-		libcnotify_printf(
-		 ")\n" );
+		if( memory_copy(
+		     ( *dictionary )->chain_table,
+		     ( *dictionary )->compressor->chain_table,
+		     array_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chain table.",
+			 function );
 
-		libcnotify_printf(
-		 "\n" );
+			goto on_error;
+		}
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	if( ( *dictionary )->compressor->match_tree != NULL )
+	{
+		array_size = sizeof( size_t ) * 2 * ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
+
+		( *dictionary )->match_tree = (size_t *) memory_allocate(
+		                                          array_size );
+
+		if( ( *dictionary )->match_tree == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create match tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *dictionary )->match_tree,
+		     ( *dictionary )->compressor->match_tree,
+		     array_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy match tree.",
+			 function );
 
+			goto on_error;
+		}
+	}
 	return( 1 );
+
+on_error:
+	if( *dictionary != NULL )
+	{
+		assorted_deflate_dictionary_free(
+		 dictionary,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Reads a block of compressed data
- * Returns 1 on success or -1 on error
+/* Frees a dictionary
+ * Returns 1 if successful or -1 on error
  */
-int assorted_deflate_read_block(
-     assorted_bit_stream_t *bit_stream,
-     uint8_t block_type,
-     assorted_huffman_tree_t *fixed_huffman_distances_tree,
-     assorted_huffman_tree_t *fixed_huffman_literals_tree,
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     size_t *uncompressed_data_offset,
+int assorted_deflate_dictionary_free(
+     assorted_deflate_dictionary_t **dictionary,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_dictionary_free";
+	int result            = 1;
+
+	if( dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( *dictionary != NULL )
+	{
+		if( ( *dictionary )->compressor != NULL )
+		{
+			if( assorted_deflate_compressor_free(
+			     &( ( *dictionary )->compressor ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compressor.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *dictionary )->match_tree != NULL )
+		{
+			memory_free(
+			 ( *dictionary )->match_tree );
+		}
+		if( ( *dictionary )->chain_table != NULL )
+		{
+			memory_free(
+			 ( *dictionary )->chain_table );
+		}
+		if( ( *dictionary )->hash_table != NULL )
+		{
+			memory_free(
+			 ( *dictionary )->hash_table );
+		}
+		if( ( *dictionary )->data != NULL )
+		{
+			memory_free(
+			 ( *dictionary )->data );
+		}
+		memory_free(
+		 *dictionary );
+
+		*dictionary = NULL;
+	}
+	return( result );
+}
+
+/* Resizes the data of the dictionary to contain at least the data size
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_dictionary_resize_data(
+     assorted_deflate_dictionary_t *dictionary,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	assorted_huffman_tree_t *dynamic_huffman_distances_tree = NULL;
-	assorted_huffman_tree_t *dynamic_huffman_literals_tree  = NULL;
-	static char *function                                   = "assorted_deflate_read_block";
-	size_t safe_uncompressed_data_offset                    = 0;
-	uint32_t block_size                                     = 0;
-	uint32_t block_size_copy                                = 0;
-	uint32_t value_32bit                                    = 0;
-	uint8_t skip_bits                                       = 0;
+	static char *function = "assorted_deflate_dictionary_resize_data";
+	void *reallocation    = NULL;
 
-	if( bit_stream == NULL )
+	if( dictionary == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bit stream.",
+		 "%s: invalid dictionary.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( data_size <= dictionary->data_size )
+	{
+		return( 1 );
+	}
+	reallocation = memory_reallocate(
+	                dictionary->data,
+	                sizeof( uint8_t ) * data_size );
+
+	if( reallocation == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
 		 function );
 
 		return( -1 );
 	}
-	switch( block_type )
-	{
-		case ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
-			if( uncompressed_data_offset == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-				 "%s: invalid uncompressed data.",
-				 function );
-
-				goto on_error;
-			}
-			safe_uncompressed_data_offset = *uncompressed_data_offset;
-
-			/* Ignore the bits in the buffer upto the next byte
-			 */
-			skip_bits = bit_stream->bit_buffer_size & 0x07;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: skip bits\t\t\t\t\t\t: %" PRIu8 "\n",
-				 function,
-				 skip_bits );
-			}
-#endif
-			if( skip_bits > 0 )
-			{
-				if( assorted_bit_stream_get_value(
-				     bit_stream,
-				     skip_bits,
-				     &value_32bit,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value from bit stream.",
-					 function );
-
-					goto on_error;
-				}
-			}
-			if( assorted_bit_stream_get_value(
-			     bit_stream,
-			     32,
-			     &block_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
-				 function );
-
-				goto on_error;
-			}
-			block_size_copy = block_size >> 16;
-			block_size     &= 0x0000ffffUL;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: block header unknown1\t\t\t\t: %" PRIu32 "\n",
-				 function,
-				 value_32bit );
-
-				libcnotify_printf(
-				 "%s: block header block size\t\t\t\t: %" PRIu32 "\n",
-				 function,
-				 block_size );
-
-				libcnotify_printf(
-				 "%s: block header block size copy\t\t\t: %" PRIu16 " (%" PRIu32 ")\n",
-				 function,
-				 block_size_copy ^ 0x0000ffffUL,
-				 block_size_copy );
-			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-			block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
-
-			if( block_size != block_size_copy )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_INPUT,
-				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
-				 "%s: mismatch in block size ( %" PRIu32 " != %" PRIu32 " ).",
-				 function,
-				 block_size,
-				 block_size_copy );
-
-				goto on_error;
-			}
-			if( block_size == 0 )
-			{
-				break;
-			}
-			if( (size_t) block_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid compressed data value too small.",
-				 function );
-
-				goto on_error;
-			}
-			if( ( (size_t) block_size > uncompressed_data_size )
-			 || ( safe_uncompressed_data_offset > ( uncompressed_data_size - block_size ) ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
-			     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
-			     (size_t) block_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to initialize lz buffer.",
-				 function );
-
-				goto on_error;
-			}
-			bit_stream->byte_stream_offset += block_size;
-			safe_uncompressed_data_offset  += block_size;
-
-			/* Flush the bit stream buffer
-			 */
-			bit_stream->bit_buffer      = 0;
-			bit_stream->bit_buffer_size = 0;
-
-			*uncompressed_data_offset = safe_uncompressed_data_offset;
-
-			break;
-
-		case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
-			if( assorted_deflate_decode_huffman(
-			     bit_stream,
-			     fixed_huffman_literals_tree,
-			     fixed_huffman_distances_tree,
-			     uncompressed_data,
-			     uncompressed_data_size,
-			     uncompressed_data_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to decode fixed Huffman encoded bit stream.",
-				 function );
+	dictionary->data      = (uint8_t *) reallocation;
+	dictionary->data_size = data_size;
 
-				goto on_error;
-			}
-			break;
+	return( 1 );
+}
 
-		case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
-			if( assorted_huffman_tree_initialize(
-			     &dynamic_huffman_literals_tree,
-			     288,
-			     15,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create dynamic literals Huffman tree.",
-				 function );
+/* Restores the hash tables of the compressor to those after the positions of the dictionary were added
+ * The data size is the size of the dictionary and record data that was compressed, since
+ * only the entries of the positions of the record have to be restored, apart from the match tree
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_dictionary_restore_compressor(
+     assorted_deflate_dictionary_t *dictionary,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_compressor_t *compressor = NULL;
+	static char *function                     = "assorted_deflate_dictionary_restore_compressor";
+	size_t array_size                         = 0;
+	size_t data_offset                        = 0;
+	uint32_t hash_value                       = 0;
+	uint32_t value                            = 0;
+
+	if( dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary.",
+		 function );
 
-				goto on_error;
-			}
-			if( assorted_huffman_tree_initialize(
-			     &dynamic_huffman_distances_tree,
-			     30,
-			     15,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create dynamic distances Huffman tree.",
-				 function );
+		return( -1 );
+	}
+	if( dictionary->compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid dictionary - missing compressor.",
+		 function );
 
-				goto on_error;
-			}
-			if( assorted_deflate_build_dynamic_huffman_trees(
-			     bit_stream,
-			     dynamic_huffman_literals_tree,
-			     dynamic_huffman_distances_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to build dynamic Huffman trees.",
-				 function );
+		return( -1 );
+	}
+	if( data_size > dictionary->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
 
-				goto on_error;
-			}
-			if( assorted_deflate_decode_huffman(
-			     bit_stream,
-			     dynamic_huffman_literals_tree,
-			     dynamic_huffman_distances_tree,
-			     uncompressed_data,
-			     uncompressed_data_size,
-			     uncompressed_data_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to decode dynamic Huffman encoded bit stream.",
-				 function );
+		return( -1 );
+	}
+	compressor = dictionary->compressor;
 
-				goto on_error;
-			}
-			if( assorted_huffman_tree_free(
-			     &dynamic_huffman_distances_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free dynamic distances Huffman tree.",
-				 function );
+	if( dictionary->hash_table == NULL )
+	{
+		return( 1 );
+	}
+	/* Adding a position to the match tree also changes the child positions of the positions
+	 * it is compared with, hence the entire match tree is restored
+	 */
+	if( dictionary->match_tree != NULL )
+	{
+		array_size = sizeof( size_t ) * ( 1 << ASSORTED_DEFLATE_COMPRESSOR_HASH_TABLE_BITS );
 
-				goto on_error;
-			}
-			if( assorted_huffman_tree_free(
-			     &dynamic_huffman_literals_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free dynamic literals Huffman tree.",
-				 function );
+		if( memory_copy(
+		     compressor->hash_table,
+		     dictionary->hash_table,
+		     array_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy hash table.",
+			 function );
 
-				goto on_error;
-			}
-			break;
+			return( -1 );
+		}
+		array_size = sizeof( size_t ) * 2 * ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE;
 
-		case ASSORTED_DEFLATE_BLOCK_TYPE_RESERVED:
-		default:
+		if( memory_copy(
+		     compressor->match_tree,
+		     dictionary->match_tree,
+		     array_size ) == NULL )
+		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported block type.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy match tree.",
 			 function );
 
-			goto on_error;
+			return( -1 );
+		}
+		return( 1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* The hash values are calculated from the data that is still in the dictionary data
+	 */
+	for( data_offset = compressor->hashed_dictionary_size;
+	     data_offset < data_size;
+	     data_offset++ )
 	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	return( 1 );
+		if( compressor->compression_level == 1 )
+		{
+			if( ( data_size - data_offset ) < 4 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( dictionary->data[ data_offset ] ),
+			 value );
 
-on_error:
-	if( dynamic_huffman_distances_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &dynamic_huffman_distances_tree,
-		 NULL );
-	}
-	if( dynamic_huffman_literals_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &dynamic_huffman_literals_tree,
-		 NULL );
+			hash_value = assorted_deflate_compressor_get_fast_hash_value(
+			              value );
+		}
+		else
+		{
+			if( ( data_size - data_offset ) < 3 )
+			{
+				break;
+			}
+			hash_value = assorted_deflate_compressor_get_hash_value(
+			              dictionary->data,
+			              data_offset );
+
+			compressor->chain_table[ data_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ] = dictionary->chain_table[ data_offset & ( ASSORTED_DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ];
+		}
+		compressor->hash_table[ hash_value ] = dictionary->hash_table[ hash_value ];
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Decompresses data using DEFLATE compression
+/* Compresses a record using zlib compression with the preset dictionary
+ * The hash tables of the compressor are restored afterwards, also on error,
+ * so that the dictionary can be used for the next record
  * Returns 1 on success or -1 on error
  */
-int assorted_deflate_decompress(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
+int assorted_deflate_dictionary_compress_zlib(
+     assorted_deflate_dictionary_t *dictionary,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
      libcerror_error_t **error )
 {
-	assorted_bit_stream_t *bit_stream                     = NULL;
-	assorted_huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	assorted_huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                                 = "assorted_deflate_decompress";
-	size_t compressed_data_offset                         = 0;
-	size_t safe_uncompressed_data_size                    = 0;
-	size_t uncompressed_data_offset                       = 0;
-	uint8_t block_type                                    = 0;
-	uint8_t last_block_flag                               = 0;
+	static char *function            = "assorted_deflate_dictionary_compress_zlib";
+	size_t data_size                 = 0;
+	size_t deflate_data_size         = 0;
+	size_t safe_compressed_data_size = 0;
+	uint32_t calculated_checksum     = 0;
+	int result                       = 0;
+
+	if( dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary.",
+		 function );
 
-	if( compressed_data == NULL )
+		return( -1 );
+	}
+	if( dictionary->compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid dictionary - missing compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( uncompressed_data_size > ( (size_t) SSIZE_MAX - dictionary->dictionary_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( compressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid compressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
+	safe_compressed_data_size = *compressed_data_size;
 
-	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( safe_compressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 "%s: invalid compressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_offset >= compressed_data_size )
+	/* The data header with the preset dictionary identifier consists of 6 bytes
+	 * and the checksum of 4 bytes
+	 */
+	if( safe_compressed_data_size < 10 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid compressed data value too small.",
+		 "%s: invalid compressed data size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( assorted_bit_stream_initialize(
-	     &bit_stream,
-	     compressed_data,
-	     compressed_data_size,
-	     compressed_data_offset,
-	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	data_size = dictionary->dictionary_size + uncompressed_data_size;
+
+	if( assorted_deflate_dictionary_resize_data(
+	     dictionary,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit stream.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO find optimized solution to read bit stream from bytes */
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	if( uncompressed_data_size > 0 )
 	{
-		if( assorted_deflate_read_block_header(
-		     bit_stream,
-		     &block_type,
-		     &last_block_flag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed data block header.",
-			 function );
-
-			goto on_error;
-		}
-		if( block_type == ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( assorted_huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( assorted_huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( assorted_deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
-		if( assorted_deflate_read_block(
-		     bit_stream,
-		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
+		if( memory_copy(
+		     &( dictionary->data[ dictionary->dictionary_size ] ),
 		     uncompressed_data,
-		     safe_uncompressed_data_size,
-		     &uncompressed_data_offset,
-		     error ) != 1 )
+		     uncompressed_data_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed data block.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
 			 function );
 
-			goto on_error;
-		}
-		if( last_block_flag != 0 )
-		{
-			break;
+			return( -1 );
 		}
 	}
-	if( fixed_huffman_distances_tree != NULL )
+	deflate_data_size = safe_compressed_data_size - 10;
+
+	result = assorted_deflate_compressor_compress(
+	          dictionary->compressor,
+	          dictionary->data,
+	          data_size,
+	          dictionary->dictionary_size,
+	          1,
+	          &( compressed_data[ 6 ] ),
+	          &deflate_data_size,
+	          error );
+
+	if( result != 1 )
 	{
-		if( assorted_huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
 	}
-	if( fixed_huffman_literals_tree != NULL )
+	if( assorted_deflate_dictionary_restore_compressor(
+	     dictionary,
+	     data_size,
+	     error ) != 1 )
 	{
-		if( assorted_huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to restore compressor.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
 	}
-	if( assorted_bit_stream_free(
-	     &bit_stream,
+	if( assorted_deflate_calculate_adler32(
+	     &calculated_checksum,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
 		 function );
 
-		goto on_error;
-	}
-	*uncompressed_data_size = uncompressed_data_offset;
-
-	return( 1 );
-
-on_error:
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &fixed_huffman_distances_tree,
-		 NULL );
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
+		return( -1 );
 	}
-	if( bit_stream != NULL )
+	if( assorted_deflate_write_data_header(
+	     compressed_data,
+	     safe_compressed_data_size,
+	     dictionary->compressor->compression_level,
+	     1,
+	     error ) != 1 )
 	{
-		assorted_bit_stream_free(
-		 &bit_stream,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data header.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( compressed_data[ 2 ] ),
+	 dictionary->identifier );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( compressed_data[ 6 + deflate_data_size ] ),
+	 calculated_checksum );
+
+	*compressed_data_size = 6 + deflate_data_size + 4;
+
+	return( 1 );
 }
 
-/* Decompresses data using DEFLATE compression stored in the zlib compressed data format
+/* Decompresses a record using DEFLATE compression stored in the zlib compressed data format
+ * with the preset dictionary, data that does not require a preset dictionary is also supported
  * Returns 1 on success or -1 on error
  */
-int assorted_deflate_decompress_zlib(
+int assorted_deflate_dictionary_decompress_zlib(
+     assorted_deflate_dictionary_t *dictionary,
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	assorted_bit_stream_t *bit_stream                     = NULL;
-	assorted_huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	assorted_huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                                 = "assorted_deflate_decompress_zlib";
-	size_t compressed_data_offset                         = 0;
-	size_t safe_uncompressed_data_size                    = 0;
-	size_t uncompressed_data_offset                       = 0;
-	uint32_t calculated_checksum                          = 0;
-	uint32_t stored_checksum                              = 0;
-	uint8_t block_type                                    = 0;
-	uint8_t last_block_flag                               = 0;
+	static char *function = "assorted_deflate_dictionary_decompress_zlib";
+	size_t data_size      = 0;
 
-	if( compressed_data == NULL )
+	if( dictionary == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 "%s: invalid dictionary.",
 		 function );
 
 		return( -1 );
@@ -2136,9 +9670,7 @@ int assorted_deflate_decompress_zlib(
 
 		return( -1 );
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
-
-	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( *uncompressed_data_size > ( (size_t) SSIZE_MAX - dictionary->dictionary_size ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2149,265 +9681,62 @@ int assorted_deflate_decompress_zlib(
 
 		return( -1 );
 	}
-	if( assorted_deflate_read_data_header(
-	     compressed_data,
-	     compressed_data_size,
-	     &compressed_data_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data header.",
-		 function );
+	/* The record is decompressed after the dictionary data so that matches can reference it
+	 */
+	data_size = dictionary->dictionary_size + *uncompressed_data_size;
 
-		goto on_error;
-	}
-	if( compressed_data_offset >= compressed_data_size )
+	if( assorted_deflate_dictionary_resize_data(
+	     dictionary,
+	     data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid compressed data value too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( assorted_bit_stream_initialize(
-	     &bit_stream,
+	if( assorted_deflate_decompress_zlib_with_preset_dictionary(
 	     compressed_data,
 	     compressed_data_size,
-	     compressed_data_offset,
-	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     dictionary->data,
+	     &data_size,
+	     dictionary->dictionary_size,
+	     dictionary->identifier,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit stream.",
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
 		 function );
 
-		goto on_error;
-	}
-/* TODO find optimized solution to read bit stream from bytes */
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
-	{
-		if( assorted_deflate_read_block_header(
-		     bit_stream,
-		     &block_type,
-		     &last_block_flag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed data block header.",
-			 function );
-
-			goto on_error;
-		}
-		if( block_type == ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( assorted_huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( assorted_huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( assorted_deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
-		if( assorted_deflate_read_block(
-		     bit_stream,
-		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
-		     uncompressed_data,
-		     safe_uncompressed_data_size,
-		     &uncompressed_data_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed data block.",
-			 function );
-
-			goto on_error;
-		}
-		if( last_block_flag != 0 )
-		{
-			break;
-		}
+		return( -1 );
 	}
-	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 4 )
+	if( data_size > 0 )
 	{
-		while( bit_stream->bit_buffer_size >= 8 )
-		{
-			bit_stream->byte_stream_offset -= 1;
-			bit_stream->bit_buffer_size    -= 8;
-		}
-		byte_stream_copy_to_uint32_big_endian(
-		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
-		 stored_checksum );
-
-		if( assorted_deflate_calculate_adler32(
-		     &calculated_checksum,
+		if( memory_copy(
 		     uncompressed_data,
-		     uncompressed_data_offset,
-		     1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to calculate checksum.",
-			 function );
-
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: stored checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 stored_checksum );
-
-			libcnotify_printf(
-			 "%s: calculated checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 calculated_checksum );
-		}
-#endif
-		if( stored_checksum != calculated_checksum )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
-			 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
-			 function,
-			 stored_checksum,
-			 calculated_checksum );
-
-			goto on_error;
-		}
-	}
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		if( assorted_huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		if( assorted_huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
+		     &( dictionary->data[ dictionary->dictionary_size ] ),
+		     data_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( assorted_bit_stream_free(
-	     &bit_stream,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit stream.",
-		 function );
-
-		goto on_error;
-	}
-	*uncompressed_data_size = uncompressed_data_offset;
+	*uncompressed_data_size = data_size;
 
 	return( 1 );
-
-on_error:
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &fixed_huffman_distances_tree,
-		 NULL );
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
-	}
-	if( bit_stream != NULL )
-	{
-		assorted_bit_stream_free(
-		 &bit_stream,
-		 NULL );
-	}
-	return( -1 );
 }
 
@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "assorted_arena.h"
 #include "assorted_bit_stream.h"
+#include "assorted_bit_stream_writer.h"
 #include "assorted_huffman_tree.h"
 #include "assorted_libcerror.h"
 
@@ -43,6 +45,262 @@ enum ASSORTED_DEFLATE_BLOCK_TYPES
 	ASSORTED_DEFLATE_BLOCK_TYPE_RESERVED		= 0x03
 };
 
+/* The gzip member header flags
+ */
+enum ASSORTED_DEFLATE_GZIP_FLAGS
+{
+	ASSORTED_DEFLATE_GZIP_FLAG_TEXT		= 0x01,
+	ASSORTED_DEFLATE_GZIP_FLAG_HEADER_CRC	= 0x02,
+	ASSORTED_DEFLATE_GZIP_FLAG_EXTRA	= 0x04,
+	ASSORTED_DEFLATE_GZIP_FLAG_NAME		= 0x08,
+	ASSORTED_DEFLATE_GZIP_FLAG_COMMENT	= 0x10
+};
+
+typedef struct assorted_deflate_compressor assorted_deflate_compressor_t;
+
+struct assorted_deflate_compressor
+{
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* The maximum number of hash chain entries that are searched for a match
+	 */
+	uint16_t maximum_chain_length;
+
+	/* The match size from which the hash chain search is reduced
+	 */
+	uint16_t good_match_size;
+
+	/* The match size from which the hash chain search stops
+	 */
+	uint16_t nice_match_size;
+
+	/* The match size from which no lazy match is searched for,
+	 * with greedy matching the largest match of which the positions are hashed
+	 */
+	uint16_t maximum_lazy_match_size;
+
+	/* Value to indicate lazy matching should be used
+	 */
+	uint8_t use_lazy_matching;
+
+	/* The number of optimal parsing passes
+	 */
+	uint8_t number_of_parse_passes;
+
+	/* The hash table
+	 * Contains the offset + 1 of the last position per hash value, 0 if not set
+	 */
+	size_t *hash_table;
+
+	/* The hash chain table
+	 * Contains the offset + 1 of the previous position with the same hash value
+	 * per position in the window
+	 */
+	size_t *chain_table;
+
+	/* The binary match tree, used by compression level 10
+	 * Contains per position in the window the offset + 1 of the child position
+	 * with smaller data followed by that with larger data, 0 if not set
+	 */
+	size_t *match_tree;
+
+	/* The matches of the positions of the current optimal parsing block
+	 * A match is stored as: size << 16 | distance
+	 */
+	uint32_t *matches;
+
+	/* The number of matches per position of the current optimal parsing block
+	 */
+	uint8_t *numbers_of_matches;
+
+	/* The cost in bits to reach a position of the current optimal parsing block
+	 */
+	uint32_t *parse_costs;
+
+	/* The symbol used to reach a position of the current optimal parsing block
+	 */
+	uint32_t *parse_symbols;
+
+	/* The symbols of the current block
+	 * A literal is stored as its value, a match as:
+	 * 0x80000000 | ( size - 3 ) << 16 | ( distance - 1 )
+	 */
+	uint32_t *symbols;
+
+	/* The number of symbols of the current block
+	 */
+	size_t number_of_symbols;
+
+	/* The offset of the current block in the uncompressed data
+	 */
+	size_t block_offset;
+
+	/* The size of the uncompressed data of the current block
+	 */
+	size_t block_size;
+
+	/* The literals and lengths frequencies of the current block
+	 */
+	uint32_t literals_frequencies[ 288 ];
+
+	/* The distances frequencies of the current block
+	 */
+	uint32_t distances_frequencies[ 30 ];
+
+	/* The literals and lengths code sizes
+	 */
+	uint8_t literals_code_sizes[ 288 ];
+
+	/* The literals and lengths codes
+	 */
+	uint32_t literals_codes[ 288 ];
+
+	/* The distances code sizes
+	 */
+	uint8_t distances_code_sizes[ 30 ];
+
+	/* The distances codes
+	 */
+	uint32_t distances_codes[ 30 ];
+
+	/* The size of the preset dictionary of which the positions were already added
+	 * to the hash table and hash chain table or match tree, 0 if not set
+	 */
+	size_t hashed_dictionary_size;
+
+	/* The bit stream writer of the compressed data
+	 */
+	assorted_bit_stream_writer_t *bit_stream_writer;
+};
+
+typedef struct assorted_deflate_dictionary assorted_deflate_dictionary_t;
+
+/* A preset dictionary shared by many small similar records
+ */
+struct assorted_deflate_dictionary
+{
+	/* The preset dictionary identifier, which is the Adler-32 of the dictionary data
+	 */
+	uint32_t identifier;
+
+	/* The data, which contains the last 32 KiB of the dictionary data
+	 * followed by the uncompressed data of the current record
+	 */
+	uint8_t *data;
+
+	/* The (allocated) size of the data
+	 */
+	size_t data_size;
+
+	/* The size of the dictionary data at the start of the data
+	 */
+	size_t dictionary_size;
+
+	/* The compressor, of which the hash table contains the positions of the dictionary
+	 */
+	assorted_deflate_compressor_t *compressor;
+
+	/* The hash table of the compressor after the positions of the dictionary were added
+	 */
+	size_t *hash_table;
+
+	/* The hash chain table of the compressor after the positions of the dictionary were added
+	 */
+	size_t *chain_table;
+
+	/* The match tree of the compressor after the positions of the dictionary were added
+	 */
+	size_t *match_tree;
+};
+
+typedef struct assorted_deflate_statistics assorted_deflate_statistics_t;
+
+/* The decode statistics
+ * The values are only maintained when built with --enable-decode-statistics
+ */
+struct assorted_deflate_statistics
+{
+	/* The number of uncompressed blocks
+	 */
+	uint64_t number_of_uncompressed_blocks;
+
+	/* The number of fixed Huffman compressed blocks
+	 */
+	uint64_t number_of_fixed_huffman_blocks;
+
+	/* The number of dynamic Huffman compressed blocks
+	 */
+	uint64_t number_of_dynamic_huffman_blocks;
+
+	/* The size of the data stored in uncompressed blocks
+	 */
+	uint64_t uncompressed_blocks_data_size;
+
+	/* The number of literals
+	 */
+	uint64_t number_of_literals;
+
+	/* The number of matches
+	 */
+	uint64_t number_of_matches;
+
+	/* The number of matches per length code
+	 */
+	uint64_t match_sizes[ 29 ];
+
+	/* The number of matches per distance code
+	 */
+	uint64_t match_distances[ 30 ];
+
+	/* The processor time spent building dynamic Huffman trees in clock ticks
+	 */
+	uint64_t build_trees_time;
+
+	/* The processor time spent decoding Huffman compressed blocks in clock ticks
+	 */
+	uint64_t decode_time;
+};
+
+typedef struct assorted_deflate_context assorted_deflate_context_t;
+
+/* The decoder context
+ * Holds the scratch memory of the decoder, such as the bit stream and
+ * the dynamic Huffman trees, so that it can be reused to decompress many
+ * small streams
+ */
+struct assorted_deflate_context
+{
+	/* The arena the scratch memory is allocated from
+	 */
+	assorted_arena_t *arena;
+};
+
+extern const uint16_t assorted_deflate_literal_codes_base[ 29 ];
+
+extern const uint16_t assorted_deflate_literal_codes_number_of_extra_bits[ 29 ];
+
+extern const uint16_t assorted_deflate_distance_codes_base[ 30 ];
+
+extern const uint16_t assorted_deflate_distance_codes_number_of_extra_bits[ 30 ];
+
+extern const uint32_t assorted_deflate_literal_symbol_values[ 288 ];
+
+extern const uint32_t assorted_deflate_distance_symbol_values[ 30 ];
+
+extern const uint8_t assorted_deflate_length_codes[ 256 ];
+
+extern const uint8_t assorted_deflate_distance_codes[ 512 ];
+
+extern const uint32_t assorted_deflate_fixed_huffman_literals_lookup_table[ 512 ];
+
+extern const uint32_t assorted_deflate_fixed_huffman_distances_lookup_table[ 32 ];
+
+extern assorted_huffman_tree_t assorted_deflate_fixed_huffman_literals_tree;
+
+extern assorted_huffman_tree_t assorted_deflate_fixed_huffman_distances_tree;
+
 int assorted_deflate_build_dynamic_huffman_trees(
      assorted_bit_stream_t *bit_stream,
      assorted_huffman_tree_t *literals_huffman_tree,
@@ -54,6 +312,24 @@ int assorted_deflate_build_fixed_huffman_trees(
      assorted_huffman_tree_t *distances_huffman_tree,
      libcerror_error_t **error );
 
+int assorted_deflate_copy_match(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint16_t compression_offset,
+     uint16_t compression_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_decode_huffman_fast(
+     assorted_bit_stream_t *bit_stream,
+     assorted_huffman_tree_t *literals_huffman_tree,
+     assorted_huffman_tree_t *distances_huffman_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error );
+
 int assorted_deflate_decode_huffman(
      assorted_bit_stream_t *bit_stream,
      assorted_huffman_tree_t *literals_huffman_tree,
@@ -61,6 +337,7 @@ int assorted_deflate_decode_huffman(
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
+     assorted_deflate_statistics_t *statistics,
      libcerror_error_t **error );
 
 int assorted_deflate_calculate_adler32(
@@ -70,6 +347,130 @@ int assorted_deflate_calculate_adler32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int assorted_deflate_compressor_initialize(
+     assorted_deflate_compressor_t **compressor,
+     int compression_level,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_free(
+     assorted_deflate_compressor_t **compressor,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_write_stored_block(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t last_block_flag,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_write_symbols(
+     assorted_deflate_compressor_t *compressor,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_encode_code_sizes(
+     const uint8_t *code_sizes,
+     uint16_t number_of_code_sizes,
+     uint16_t *precode_symbols,
+     uint16_t *number_of_precode_symbols,
+     uint32_t *precode_frequencies,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_write_block(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     uint8_t last_block_flag,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_find_matches_fast(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_find_matches(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_find_tree_matches(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint32_t *matches,
+     uint8_t *number_of_matches,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_get_block_size(
+     const uint32_t *literals_frequencies,
+     const uint32_t *distances_frequencies,
+     size_t data_size,
+     uint64_t *block_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_parse_optimal(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     size_t parse_offset,
+     size_t parse_size,
+     const uint8_t *literals_code_sizes,
+     const uint8_t *distances_code_sizes,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_parse_iterative(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     size_t parse_offset,
+     size_t parse_size,
+     uint8_t *literals_code_sizes,
+     uint8_t *distances_code_sizes,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_split_symbols(
+     assorted_deflate_compressor_t *compressor,
+     size_t *split_offsets,
+     size_t maximum_number_of_blocks,
+     size_t *number_of_blocks,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_find_matches_optimal(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_add_dictionary(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_compressor_compress(
+     assorted_deflate_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint8_t last_block_flag,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_compress_with_dictionary(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     int compression_level,
+     uint8_t last_block_flag,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
 int assorted_deflate_compress(
      const uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -78,10 +479,44 @@ int assorted_deflate_compress(
      size_t *compressed_data_size,
      libcerror_error_t **error );
 
+int assorted_deflate_write_data_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_level,
+     uint8_t preset_dictionary_flag,
+     libcerror_error_t **error );
+
+int assorted_deflate_compress_zlib(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_compress_zlib_with_dictionary(
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
 int assorted_deflate_read_data_header(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *compressed_data_offset,
+     uint8_t *preset_dictionary_flag,
+     uint32_t *preset_dictionary_identifier,
+     libcerror_error_t **error );
+
+int assorted_deflate_read_gzip_member_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t *member_size,
      libcerror_error_t **error );
 
 int assorted_deflate_read_block_header(
@@ -98,6 +533,19 @@ int assorted_deflate_read_block(
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int assorted_deflate_read_block_with_arena(
+     assorted_bit_stream_t *bit_stream,
+     uint8_t block_type,
+     assorted_huffman_tree_t *literals_huffman_tree,
+     assorted_huffman_tree_t *distances_huffman_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_deflate_statistics_t *statistics,
+     assorted_arena_t *arena,
      libcerror_error_t **error );
 
 int assorted_deflate_decompress(
@@ -105,6 +553,16 @@ int assorted_deflate_decompress(
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int assorted_deflate_decompress_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_deflate_statistics_t *statistics,
+     assorted_arena_t *arena,
      libcerror_error_t **error );
 
 int assorted_deflate_decompress_zlib(
@@ -114,6 +572,106 @@ int assorted_deflate_decompress_zlib(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int assorted_deflate_decompress_zlib_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
+int assorted_deflate_decompress_zlib_with_preset_dictionary(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint32_t preset_dictionary_identifier,
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
+int assorted_deflate_decompress_zlib_with_dictionary(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_decompress_gzip(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_context_initialize(
+     assorted_deflate_context_t **context,
+     libcerror_error_t **error );
+
+int assorted_deflate_context_free(
+     assorted_deflate_context_t **context,
+     libcerror_error_t **error );
+
+int assorted_deflate_context_reset(
+     assorted_deflate_context_t *context,
+     libcerror_error_t **error );
+
+int assorted_deflate_context_decompress(
+     assorted_deflate_context_t *context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int assorted_deflate_context_decompress_zlib(
+     assorted_deflate_context_t *context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_dictionary_initialize(
+     assorted_deflate_dictionary_t **dictionary,
+     const uint8_t *dictionary_data,
+     size_t dictionary_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
+int assorted_deflate_dictionary_free(
+     assorted_deflate_dictionary_t **dictionary,
+     libcerror_error_t **error );
+
+int assorted_deflate_dictionary_resize_data(
+     assorted_deflate_dictionary_t *dictionary,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_dictionary_restore_compressor(
+     assorted_deflate_dictionary_t *dictionary,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_dictionary_compress_zlib(
+     assorted_deflate_dictionary_t *dictionary,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_dictionary_decompress_zlib(
+     assorted_deflate_dictionary_t *dictionary,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,764 @@
+/*
+ * Deflate (zlib) checkpoint index functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_deflate_index.h"
+#include "assorted_libcerror.h"
+
+/* The size of the index data header
+ * The header consists of an 8-byte signature, an 8-byte checkpoint spacing
+ * and a 4-byte number of checkpoints
+ */
+#define ASSORTED_DEFLATE_INDEX_HEADER_SIZE		20
+
+/* The size of the index data checkpoint header
+ * The checkpoint header consists of an 8-byte compressed bit offset,
+ * an 8-byte uncompressed offset and a 4-byte window size, followed by the window
+ */
+#define ASSORTED_DEFLATE_INDEX_CHECKPOINT_HEADER_SIZE	20
+
+/* The index data signature
+ */
+const uint8_t assorted_deflate_index_signature[ 8 ] = {
+	'D', 'F', 'L', 'T', 'I', 'D', 'X', 0x01 };
+
+/* Creates an index
+ * Make sure the value index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_index_initialize(
+     assorted_deflate_index_t **index,
+     uint64_t spacing,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_index_initialize";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( spacing == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid spacing value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*index = memory_allocate_structure(
+	          assorted_deflate_index_t );
+
+	if( *index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index,
+	     0,
+	     sizeof( assorted_deflate_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index.",
+		 function );
+
+		goto on_error;
+	}
+	( *index )->spacing = spacing;
+
+	return( 1 );
+
+on_error:
+	if( *index != NULL )
+	{
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_index_free(
+     assorted_deflate_index_t **index,
+     libcerror_error_t **error )
+{
+	static char *function     = "assorted_deflate_index_free";
+	uint32_t checkpoint_index = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		if( ( *index )->checkpoints != NULL )
+		{
+			for( checkpoint_index = 0;
+			     checkpoint_index < ( *index )->number_of_checkpoints;
+			     checkpoint_index++ )
+			{
+				if( ( *index )->checkpoints[ checkpoint_index ].window != NULL )
+				{
+					memory_free(
+					 ( *index )->checkpoints[ checkpoint_index ].window );
+				}
+			}
+			memory_free(
+			 ( *index )->checkpoints );
+		}
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a checkpoint
+ * The uncompressed offset must be larger than that of the last checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_index_append_checkpoint(
+     assorted_deflate_index_t *index,
+     uint64_t compressed_bit_offset,
+     uint64_t uncompressed_offset,
+     const uint8_t *window,
+     uint32_t window_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_checkpoint_t *checkpoint = NULL;
+	void *reallocation                        = NULL;
+	static char *function                     = "assorted_deflate_index_append_checkpoint";
+	uint32_t number_of_allocated_checkpoints  = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window == NULL )
+	 && ( window_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window_size > ASSORTED_DEFLATE_INDEX_WINDOW_SIZE )
+	 || ( (uint64_t) window_size > uncompressed_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->number_of_checkpoints > 0 )
+	{
+		checkpoint = &( index->checkpoints[ index->number_of_checkpoints - 1 ] );
+
+		if( ( uncompressed_offset <= checkpoint->uncompressed_offset )
+		 || ( compressed_bit_offset <= checkpoint->compressed_bit_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid checkpoint offsets value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( index->number_of_checkpoints >= index->number_of_allocated_checkpoints )
+	{
+		if( index->number_of_allocated_checkpoints == 0 )
+		{
+			number_of_allocated_checkpoints = 16;
+		}
+		else if( index->number_of_allocated_checkpoints < (uint32_t) ( INT32_MAX / sizeof( assorted_deflate_checkpoint_t ) ) )
+		{
+			number_of_allocated_checkpoints = index->number_of_allocated_checkpoints * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of checkpoints value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                index->checkpoints,
+		                sizeof( assorted_deflate_checkpoint_t ) * number_of_allocated_checkpoints );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize checkpoints.",
+			 function );
+
+			return( -1 );
+		}
+		index->checkpoints                     = (assorted_deflate_checkpoint_t *) reallocation;
+		index->number_of_allocated_checkpoints = number_of_allocated_checkpoints;
+	}
+	checkpoint = &( index->checkpoints[ index->number_of_checkpoints ] );
+
+	checkpoint->compressed_bit_offset = compressed_bit_offset;
+	checkpoint->uncompressed_offset   = uncompressed_offset;
+	checkpoint->window                = NULL;
+	checkpoint->window_size           = window_size;
+
+	if( window_size > 0 )
+	{
+		checkpoint->window = (uint8_t *) memory_allocate(
+		                                  sizeof( uint8_t ) * window_size );
+
+		if( checkpoint->window == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create checkpoint window.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     checkpoint->window,
+		     window,
+		     (size_t) window_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy checkpoint window.",
+			 function );
+
+			memory_free(
+			 checkpoint->window );
+
+			checkpoint->window = NULL;
+
+			return( -1 );
+		}
+	}
+	index->number_of_checkpoints += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the last checkpoint at or before a specific uncompressed offset
+ * Returns 1 if successful, 0 if no such checkpoint or -1 on error
+ */
+int assorted_deflate_index_get_checkpoint_by_offset(
+     assorted_deflate_index_t *index,
+     uint64_t uncompressed_offset,
+     assorted_deflate_checkpoint_t **checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function  = "assorted_deflate_index_get_checkpoint_by_offset";
+	uint32_t first_index   = 0;
+	uint32_t last_index    = 0;
+	uint32_t middle_index  = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index->number_of_checkpoints == 0 )
+	 || ( uncompressed_offset < index->checkpoints[ 0 ].uncompressed_offset ) )
+	{
+		return( 0 );
+	}
+	/* Find the last checkpoint of which the uncompressed offset is not after the offset
+	 */
+	last_index = index->number_of_checkpoints - 1;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index + 1 ) / 2 );
+
+		if( index->checkpoints[ middle_index ].uncompressed_offset <= uncompressed_offset )
+		{
+			first_index = middle_index;
+		}
+		else
+		{
+			last_index = middle_index - 1;
+		}
+	}
+	*checkpoint = &( index->checkpoints[ first_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the size of the index data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_index_get_data_size(
+     assorted_deflate_index_t *index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "assorted_deflate_index_get_data_size";
+	size_t safe_data_size     = 0;
+	uint32_t checkpoint_index = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size = ASSORTED_DEFLATE_INDEX_HEADER_SIZE;
+
+	for( checkpoint_index = 0;
+	     checkpoint_index < index->number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		if( safe_data_size > ( (size_t) SSIZE_MAX - ASSORTED_DEFLATE_INDEX_CHECKPOINT_HEADER_SIZE - ASSORTED_DEFLATE_INDEX_WINDOW_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_data_size += ASSORTED_DEFLATE_INDEX_CHECKPOINT_HEADER_SIZE + index->checkpoints[ checkpoint_index ].window_size;
+	}
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the index data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_index_write_data(
+     assorted_deflate_index_t *index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_checkpoint_t *checkpoint = NULL;
+	static char *function                     = "assorted_deflate_index_write_data";
+	size_t data_offset                        = 0;
+	size_t required_data_size                 = 0;
+	uint32_t checkpoint_index                 = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_index_get_data_size(
+	     index,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     assorted_deflate_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 index->spacing );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 index->number_of_checkpoints );
+
+	data_offset = ASSORTED_DEFLATE_INDEX_HEADER_SIZE;
+
+	for( checkpoint_index = 0;
+	     checkpoint_index < index->number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		checkpoint = &( index->checkpoints[ checkpoint_index ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 checkpoint->compressed_bit_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 checkpoint->uncompressed_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 checkpoint->window_size );
+
+		data_offset += ASSORTED_DEFLATE_INDEX_CHECKPOINT_HEADER_SIZE;
+
+		if( checkpoint->window_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     checkpoint->window,
+			     (size_t) checkpoint->window_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy checkpoint: %" PRIu32 " window.",
+				 function,
+				 checkpoint_index );
+
+				return( -1 );
+			}
+			data_offset += checkpoint->window_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the index data
+ * The index must not contain checkpoints, the spacing is set to that of the data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_index_read_data(
+     assorted_deflate_index_t *index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "assorted_deflate_index_read_data";
+	size_t data_offset             = 0;
+	uint64_t compressed_bit_offset = 0;
+	uint64_t spacing               = 0;
+	uint64_t uncompressed_offset   = 0;
+	uint32_t checkpoint_index      = 0;
+	uint32_t number_of_checkpoints = 0;
+	uint32_t window_size           = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->number_of_checkpoints != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - checkpoints already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < ASSORTED_DEFLATE_INDEX_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     assorted_deflate_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 spacing );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 number_of_checkpoints );
+
+	if( spacing == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid spacing value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = ASSORTED_DEFLATE_INDEX_HEADER_SIZE;
+
+	for( checkpoint_index = 0;
+	     checkpoint_index < number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		if( ASSORTED_DEFLATE_INDEX_CHECKPOINT_HEADER_SIZE > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 compressed_bit_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 uncompressed_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 window_size );
+
+		data_offset += ASSORTED_DEFLATE_INDEX_CHECKPOINT_HEADER_SIZE;
+
+		if( (size_t) window_size > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_deflate_index_append_checkpoint(
+		     index,
+		     compressed_bit_offset,
+		     uncompressed_offset,
+		     &( data[ data_offset ] ),
+		     window_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checkpoint: %" PRIu32 ".",
+			 function,
+			 checkpoint_index );
+
+			goto on_error;
+		}
+		data_offset += window_size;
+	}
+	index->spacing = spacing;
+
+	return( 1 );
+
+on_error:
+	while( index->number_of_checkpoints > 0 )
+	{
+		index->number_of_checkpoints -= 1;
+
+		if( index->checkpoints[ index->number_of_checkpoints ].window != NULL )
+		{
+			memory_free(
+			 index->checkpoints[ index->number_of_checkpoints ].window );
+
+			index->checkpoints[ index->number_of_checkpoints ].window = NULL;
+		}
+	}
+	return( -1 );
+}
+
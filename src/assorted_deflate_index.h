@@ -0,0 +1,129 @@
+/*
+ * Deflate (zlib) checkpoint index functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_DEFLATE_INDEX_H )
+#define _ASSORTED_DEFLATE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the history window of a checkpoint
+ */
+#define ASSORTED_DEFLATE_INDEX_WINDOW_SIZE	32768
+
+/* The default spacing between checkpoints in the uncompressed data (1 MiB)
+ */
+#define ASSORTED_DEFLATE_INDEX_DEFAULT_SPACING	1048576
+
+typedef struct assorted_deflate_checkpoint assorted_deflate_checkpoint_t;
+
+struct assorted_deflate_checkpoint
+{
+	/* The offset in bits of the block in the compressed data
+	 */
+	uint64_t compressed_bit_offset;
+
+	/* The offset of the block in the uncompressed data
+	 */
+	uint64_t uncompressed_offset;
+
+	/* The history window that precedes the block
+	 */
+	uint8_t *window;
+
+	/* The size of the history window
+	 */
+	uint32_t window_size;
+};
+
+typedef struct assorted_deflate_index assorted_deflate_index_t;
+
+struct assorted_deflate_index
+{
+	/* The minimum spacing between checkpoints in the uncompressed data
+	 */
+	uint64_t spacing;
+
+	/* The checkpoints, sorted by uncompressed offset
+	 */
+	assorted_deflate_checkpoint_t *checkpoints;
+
+	/* The number of checkpoints
+	 */
+	uint32_t number_of_checkpoints;
+
+	/* The number of allocated checkpoints
+	 */
+	uint32_t number_of_allocated_checkpoints;
+};
+
+int assorted_deflate_index_initialize(
+     assorted_deflate_index_t **index,
+     uint64_t spacing,
+     libcerror_error_t **error );
+
+int assorted_deflate_index_free(
+     assorted_deflate_index_t **index,
+     libcerror_error_t **error );
+
+int assorted_deflate_index_append_checkpoint(
+     assorted_deflate_index_t *index,
+     uint64_t compressed_bit_offset,
+     uint64_t uncompressed_offset,
+     const uint8_t *window,
+     uint32_t window_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_index_get_checkpoint_by_offset(
+     assorted_deflate_index_t *index,
+     uint64_t uncompressed_offset,
+     assorted_deflate_checkpoint_t **checkpoint,
+     libcerror_error_t **error );
+
+int assorted_deflate_index_get_data_size(
+     assorted_deflate_index_t *index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_index_write_data(
+     assorted_deflate_index_t *index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_index_read_data(
+     assorted_deflate_index_t *index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_DEFLATE_INDEX_H ) */
+
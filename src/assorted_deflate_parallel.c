@@ -0,0 +1,2757 @@
+/*
+ * Deflate (zlib) parallel compression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_adler32.h"
+#include "assorted_crc32.h"
+#include "assorted_deflate.h"
+#include "assorted_deflate_parallel.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+/* The maximum number of chunks queued in the thread pool
+ */
+#define ASSORTED_DEFLATE_PARALLEL_MAXIMUM_NUMBER_OF_QUEUED_CHUNKS	256
+
+/* Compresses a chunk
+ * The data before the chunk, up to 32 KiB, is used as preset dictionary
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_compress_chunk(
+     assorted_deflate_parallel_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_parallel_compress_chunk";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->uncompressed_data_offset > chunk->uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk - uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_compress_with_dictionary(
+	     chunk->uncompressed_data,
+	     chunk->uncompressed_data_size,
+	     chunk->uncompressed_data_offset,
+	     chunk->compression_level,
+	     chunk->last_block_flag,
+	     chunk->compressed_data,
+	     &( chunk->compressed_data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_adler32_calculate_checksum_unfolded16_4(
+	     &( chunk->checksum ),
+	     &( chunk->uncompressed_data[ chunk->uncompressed_data_offset ] ),
+	     chunk->uncompressed_data_size - chunk->uncompressed_data_offset,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compresses a chunk from a thread pool
+ * The error is not available from the worker thread, the result is stored in the chunk
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_compress_chunk_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_deflate_parallel_chunk_t *chunk = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	chunk = (assorted_deflate_parallel_chunk_t *) value;
+
+	chunk->result = assorted_deflate_parallel_compress_chunk(
+	                 chunk,
+	                 NULL );
+
+	return( chunk->result );
+}
+
+/* Compresses data using zlib compression with the chunks compressed in parallel
+ * The data is split into chunks that are compressed independently, using the
+ * preceding 32 KiB as preset dictionary, and are joined at sync flush boundaries
+ * The Adler-32 values of the chunks are combined into that of the data
+ * The compression level ranges from 0 (no compression) to 9 (best compression),
+ * -1 represents the default compression level of 6 and level 10 represents
+ * optimal parsing, which is considerably slower and intended for archival
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_compress_zlib(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     int number_of_threads,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_parallel_chunk_t *chunks = NULL;
+	static char *function                     = "assorted_deflate_parallel_compress_zlib";
+	size_t chunk_data_size                    = 0;
+	size_t chunk_index                        = 0;
+	size_t compressed_data_offset             = 0;
+	size_t number_of_chunks                   = 0;
+	size_t safe_compressed_data_size          = 0;
+	uint32_t calculated_checksum              = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool       = NULL;
+	int maximum_number_of_queued_chunks       = 0;
+#endif
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_size = *compressed_data_size;
+
+	if( safe_compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_compressed_data_size < 6 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* Empty data is stored as a single empty chunk
+	 */
+	number_of_chunks = uncompressed_data_size / ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE;
+
+	if( ( ( uncompressed_data_size % ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE ) != 0 )
+	 || ( number_of_chunks == 0 ) )
+	{
+		number_of_chunks += 1;
+	}
+	chunks = (assorted_deflate_parallel_chunk_t *) memory_allocate(
+	                                                 sizeof( assorted_deflate_parallel_chunk_t ) * number_of_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     chunks,
+	     0,
+	     sizeof( assorted_deflate_parallel_chunk_t ) * number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		memory_free(
+		 chunks );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunks[ chunk_index ].uncompressed_data        = uncompressed_data;
+		chunks[ chunk_index ].uncompressed_data_offset = chunk_index * ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE;
+		chunks[ chunk_index ].compression_level        = compression_level;
+
+		chunk_data_size = uncompressed_data_size - chunks[ chunk_index ].uncompressed_data_offset;
+
+		if( chunk_data_size > ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE )
+		{
+			chunk_data_size = ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE;
+		}
+		chunks[ chunk_index ].uncompressed_data_size = chunks[ chunk_index ].uncompressed_data_offset + chunk_data_size;
+
+		if( chunk_index == ( number_of_chunks - 1 ) )
+		{
+			chunks[ chunk_index ].last_block_flag = 1;
+		}
+		/* The compressed data of a chunk is at most slightly larger than the data
+		 * stored in uncompressed blocks
+		 */
+		chunks[ chunk_index ].compressed_data_size = chunk_data_size + ( chunk_data_size / 1024 ) + 64;
+
+		chunks[ chunk_index ].compressed_data = (uint8_t *) memory_allocate(
+		                                                     sizeof( uint8_t ) * chunks[ chunk_index ].compressed_data_size );
+
+		if( chunks[ chunk_index ].compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk: %" PRIzd " compressed data.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		maximum_number_of_queued_chunks = ASSORTED_DEFLATE_PARALLEL_MAXIMUM_NUMBER_OF_QUEUED_CHUNKS;
+
+		if( number_of_chunks < (size_t) maximum_number_of_queued_chunks )
+		{
+			maximum_number_of_queued_chunks = (int) number_of_chunks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_queued_chunks,
+		     (int (*)(intptr_t *, void *)) &assorted_deflate_parallel_compress_chunk_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( chunks[ chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push chunk: %" PRIzd " onto thread pool queue.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			chunks[ chunk_index ].result = assorted_deflate_parallel_compress_chunk(
+			                                &( chunks[ chunk_index ] ),
+			                                error );
+
+			if( chunks[ chunk_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress chunk: %" PRIzd ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( assorted_deflate_write_data_header(
+	     compressed_data,
+	     safe_compressed_data_size,
+	     compression_level,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data header.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data_offset = 2;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk: %" PRIzd ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( chunks[ chunk_index ].compressed_data_size > ( safe_compressed_data_size - compressed_data_offset - 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     chunks[ chunk_index ].compressed_data,
+		     chunks[ chunk_index ].compressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk: %" PRIzd " compressed data.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		compressed_data_offset += chunks[ chunk_index ].compressed_data_size;
+
+		if( chunk_index == 0 )
+		{
+			calculated_checksum = chunks[ chunk_index ].checksum;
+		}
+		else if( assorted_adler32_combine(
+		          &calculated_checksum,
+		          calculated_checksum,
+		          chunks[ chunk_index ].checksum,
+		          (size64_t) ( chunks[ chunk_index ].uncompressed_data_size - chunks[ chunk_index ].uncompressed_data_offset ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to combine checksum of chunk: %" PRIzd ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		memory_free(
+		 chunks[ chunk_index ].compressed_data );
+
+		chunks[ chunk_index ].compressed_data = NULL;
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( compressed_data[ compressed_data_offset ] ),
+	 calculated_checksum );
+
+	*compressed_data_size = compressed_data_offset + 4;
+
+	memory_free(
+	 chunks );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( chunks != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			if( chunks[ chunk_index ].compressed_data != NULL )
+			{
+				memory_free(
+				 chunks[ chunk_index ].compressed_data );
+			}
+		}
+		memory_free(
+		 chunks );
+	}
+	return( -1 );
+}
+
+/* Sets the bit stream at a specific bit offset in the byte stream
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_set_bit_offset(
+     assorted_bit_stream_t *bit_stream,
+     uint64_t bit_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_parallel_set_bit_offset";
+	uint32_t value_32bit  = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_offset / 8 ) > (uint64_t) bit_stream->byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bit offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_bit_stream_set_byte_stream_offset(
+	     bit_stream,
+	     (size_t) ( bit_offset / 8 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set byte stream offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_offset & 0x07 ) != 0 )
+	{
+		if( assorted_bit_stream_get_value_back_to_front(
+		     bit_stream,
+		     (uint8_t) ( bit_offset & 0x07 ),
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Resizes the symbols of a decompression chunk to contain at least a specific number of symbols
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_resize_symbols(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     size_t number_of_symbols,
+     libcerror_error_t **error )
+{
+	void *reallocation                  = NULL;
+	static char *function               = "assorted_deflate_parallel_resize_symbols";
+	size_t number_of_allocated_symbols  = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols <= chunk->number_of_allocated_symbols )
+	{
+		return( 1 );
+	}
+	if( number_of_symbols > chunk->maximum_number_of_symbols )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+		 "%s: invalid uncompressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_allocated_symbols = chunk->number_of_allocated_symbols;
+
+	if( number_of_allocated_symbols < 65536 )
+	{
+		number_of_allocated_symbols = 65536;
+	}
+	while( number_of_allocated_symbols < number_of_symbols )
+	{
+		number_of_allocated_symbols *= 2;
+	}
+	if( number_of_allocated_symbols > chunk->maximum_number_of_symbols )
+	{
+		number_of_allocated_symbols = chunk->maximum_number_of_symbols;
+	}
+	if( number_of_allocated_symbols > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of allocated symbols value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                chunk->symbols,
+	                sizeof( uint16_t ) * number_of_allocated_symbols );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize symbols.",
+		 function );
+
+		return( -1 );
+	}
+	chunk->symbols                     = (uint16_t *) reallocation;
+	chunk->number_of_allocated_symbols = number_of_allocated_symbols;
+
+	return( 1 );
+}
+
+/* Decodes the symbols of a Huffman compressed block into the symbols of a decompression chunk
+ * A match that refers to data before the chunk is stored as references into the preceding window
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_decode_huffman(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     assorted_bit_stream_t *bit_stream,
+     assorted_huffman_tree_t *literals_huffman_tree,
+     assorted_huffman_tree_t *distances_huffman_tree,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_deflate_parallel_decode_huffman";
+	size_t data_offset            = 0;
+	size_t match_end_offset       = 0;
+	uint32_t extra_bits           = 0;
+	uint16_t compression_offset   = 0;
+	uint16_t compression_size     = 0;
+	uint16_t second_symbol        = 0;
+	uint16_t symbol               = 0;
+	uint8_t number_of_symbols     = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = chunk->number_of_symbols;
+
+	do
+	{
+		if( assorted_huffman_tree_get_symbols_from_bit_stream(
+		     literals_huffman_tree,
+		     bit_stream,
+		     &symbol,
+		     &second_symbol,
+		     &number_of_symbols,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve symbol from literals Huffman tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( number_of_symbols == 2 )
+		 || ( symbol < 256 ) )
+		{
+			if( ( data_offset + 2 ) > chunk->number_of_allocated_symbols )
+			{
+				if( assorted_deflate_parallel_resize_symbols(
+				     chunk,
+				     data_offset + number_of_symbols,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize symbols.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			chunk->symbols[ data_offset++ ] = symbol;
+
+			if( number_of_symbols == 2 )
+			{
+				chunk->symbols[ data_offset++ ] = second_symbol;
+			}
+		}
+		else if( ( symbol > 256 )
+		      && ( symbol < 286 ) )
+		{
+			symbol -= 257;
+
+			if( assorted_bit_stream_get_value_back_to_front(
+			     bit_stream,
+			     (uint8_t) assorted_deflate_literal_codes_number_of_extra_bits[ symbol ],
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve literal extra value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			compression_size = assorted_deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+			if( assorted_huffman_tree_get_symbol_from_bit_stream(
+			     distances_huffman_tree,
+			     bit_stream,
+			     &symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve symbol from distances Huffman tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( symbol >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid distance symbol: %" PRIu16 ".",
+				 function,
+				 symbol );
+
+				goto on_error;
+			}
+			if( assorted_bit_stream_get_value_back_to_front(
+			     bit_stream,
+			     (uint8_t) assorted_deflate_distance_codes_number_of_extra_bits[ symbol ],
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve distance extra value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			compression_offset = assorted_deflate_distance_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+			if( (size_t) compression_offset > ( data_offset + 32768 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid compression offset value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			match_end_offset = data_offset + compression_size;
+
+			if( match_end_offset > chunk->number_of_allocated_symbols )
+			{
+				if( assorted_deflate_parallel_resize_symbols(
+				     chunk,
+				     match_end_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize symbols.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* The part of the match that precedes the chunk refers to the window
+			 */
+			while( ( data_offset < match_end_offset )
+			    && ( data_offset < (size_t) compression_offset ) )
+			{
+				chunk->symbols[ data_offset ] = (uint16_t) ( 256 + 32768 + data_offset - compression_offset );
+
+				data_offset++;
+			}
+			while( data_offset < match_end_offset )
+			{
+				chunk->symbols[ data_offset ] = chunk->symbols[ data_offset - compression_offset ];
+
+				data_offset++;
+			}
+		}
+		else if( symbol != 256 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid symbol: %" PRIu16 ".",
+			 function,
+			 symbol );
+
+			goto on_error;
+		}
+	}
+	while( symbol != 256 );
+
+	chunk->number_of_symbols = data_offset;
+
+	return( 1 );
+
+on_error:
+	chunk->number_of_symbols = data_offset;
+
+	return( -1 );
+}
+
+/* Decodes an uncompressed block into the symbols of a decompression chunk
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_decode_uncompressed_block(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     assorted_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	static char *function   = "assorted_deflate_parallel_decode_uncompressed_block";
+	size_t byte_index       = 0;
+	uint32_t block_size     = 0;
+	uint32_t value_32bit    = 0;
+	uint8_t skip_bits       = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore the bits in the buffer upto the next byte
+	 */
+	skip_bits = bit_stream->bit_buffer_size & 0x07;
+
+	if( skip_bits > 0 )
+	{
+		if( assorted_bit_stream_get_value_back_to_front(
+		     bit_stream,
+		     skip_bits,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( assorted_bit_stream_get_value_back_to_front(
+	     bit_stream,
+	     32,
+	     &block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size >> 16 ) != ( ( block_size & 0x0000ffffUL ) ^ 0x0000ffffUL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in block size.",
+		 function );
+
+		return( -1 );
+	}
+	block_size &= 0x0000ffffUL;
+
+	/* Return the bytes remaining in the bit buffer to the byte stream
+	 */
+	bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+	bit_stream->bit_buffer          = 0;
+	bit_stream->bit_buffer_size     = 0;
+
+	if( (size_t) block_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->number_of_symbols + block_size ) > chunk->number_of_allocated_symbols )
+	{
+		if( assorted_deflate_parallel_resize_symbols(
+		     chunk,
+		     chunk->number_of_symbols + block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize symbols.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( byte_index = 0;
+	     byte_index < (size_t) block_size;
+	     byte_index++ )
+	{
+		chunk->symbols[ chunk->number_of_symbols++ ] = bit_stream->byte_stream[ bit_stream->byte_stream_offset++ ];
+	}
+	return( 1 );
+}
+
+/* Decodes the blocks of a decompression chunk from a specific bit offset
+ * Decoding stops at the first block that starts at or after the end bit offset limit
+ * or after the last block of the stream
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_decode_blocks(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     uint64_t start_bit_offset,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream                       = NULL;
+	assorted_huffman_tree_t *dynamic_huffman_distances_tree = NULL;
+	assorted_huffman_tree_t *dynamic_huffman_literals_tree  = NULL;
+	static char *function                                   = "assorted_deflate_parallel_decode_blocks";
+	uint64_t bit_offset                                     = 0;
+	uint8_t block_type                                      = 0;
+	uint8_t last_block_flag                                 = 0;
+	int result                                              = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	chunk->start_bit_offset  = start_bit_offset;
+	chunk->end_bit_offset    = start_bit_offset;
+	chunk->last_block_flag   = 0;
+	chunk->number_of_symbols = 0;
+
+	if( assorted_bit_stream_initialize(
+	     &bit_stream,
+	     chunk->compressed_data,
+	     chunk->compressed_data_size,
+	     0,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_deflate_parallel_set_bit_offset(
+	     bit_stream,
+	     start_bit_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set bit offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_huffman_tree_initialize(
+	     &dynamic_huffman_literals_tree,
+	     288,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dynamic literals Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_huffman_tree_initialize(
+	     &dynamic_huffman_distances_tree,
+	     30,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dynamic distances Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	while( last_block_flag == 0 )
+	{
+		bit_offset = ( (uint64_t) bit_stream->byte_stream_offset * 8 ) - bit_stream->bit_buffer_size;
+
+		if( bit_offset >= chunk->end_bit_offset_limit )
+		{
+			break;
+		}
+		if( assorted_deflate_read_block_header(
+		     bit_stream,
+		     &block_type,
+		     &last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header.",
+			 function );
+
+			goto on_error;
+		}
+		switch( block_type )
+		{
+			case ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+				result = assorted_deflate_parallel_decode_uncompressed_block(
+				          chunk,
+				          bit_stream,
+				          error );
+				break;
+
+			case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+				result = assorted_deflate_parallel_decode_huffman(
+				          chunk,
+				          bit_stream,
+				          &assorted_deflate_fixed_huffman_literals_tree,
+				          &assorted_deflate_fixed_huffman_distances_tree,
+				          error );
+				break;
+
+			case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+				result = assorted_deflate_build_dynamic_huffman_trees(
+				          bit_stream,
+				          dynamic_huffman_literals_tree,
+				          dynamic_huffman_distances_tree,
+				          error );
+
+				if( result == 1 )
+				{
+					result = assorted_deflate_parallel_decode_huffman(
+					          chunk,
+					          bit_stream,
+					          dynamic_huffman_literals_tree,
+					          dynamic_huffman_distances_tree,
+					          error );
+				}
+				break;
+
+			case ASSORTED_DEFLATE_BLOCK_TYPE_RESERVED:
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported block type.",
+				 function );
+
+				goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	chunk->end_bit_offset  = ( (uint64_t) bit_stream->byte_stream_offset * 8 ) - bit_stream->bit_buffer_size;
+	chunk->last_block_flag = last_block_flag;
+
+	if( assorted_huffman_tree_free(
+	     &dynamic_huffman_distances_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free dynamic distances Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_huffman_tree_free(
+	     &dynamic_huffman_literals_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free dynamic literals Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( dynamic_huffman_distances_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &dynamic_huffman_distances_tree,
+		 NULL );
+	}
+	if( dynamic_huffman_literals_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &dynamic_huffman_literals_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	chunk->number_of_symbols = 0;
+
+	return( -1 );
+}
+
+/* Determines if a block boundary could be at a specific bit offset
+ * Only uncompressed blocks with a matching block size copy and dynamic Huffman
+ * blocks with valid number of codes are considered, since fixed Huffman blocks
+ * cannot be distinguished from other data
+ * Returns 1 if a block could start at the bit offset or 0 if not
+ */
+int assorted_deflate_parallel_is_block_start(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t bit_offset )
+{
+	size_t byte_offset   = 0;
+	uint32_t value_32bit = 0;
+	uint16_t block_size  = 0;
+	uint8_t byte_index   = 0;
+	uint8_t block_type   = 0;
+
+	if( compressed_data == NULL )
+	{
+		return( 0 );
+	}
+	byte_offset = (size_t) ( bit_offset / 8 );
+
+	if( byte_offset >= compressed_data_size )
+	{
+		return( 0 );
+	}
+	/* Read the next 24 bits of which the missing bits are 0
+	 */
+	for( byte_index = 0;
+	     byte_index < 3;
+	     byte_index++ )
+	{
+		if( ( byte_offset + byte_index ) < compressed_data_size )
+		{
+			value_32bit |= (uint32_t) compressed_data[ byte_offset + byte_index ] << ( byte_index * 8 );
+		}
+	}
+	value_32bit >>= bit_offset & 0x07;
+
+	block_type = (uint8_t) ( ( value_32bit >> 1 ) & 0x03 );
+
+	if( block_type == ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC )
+	{
+		/* The number of literal codes and distance codes are stored as value - 257
+		 * and value - 1 in 5 bits, values larger than 286 and 30 are invalid
+		 */
+		if( ( ( ( value_32bit >> 3 ) & 0x1f ) > 29 )
+		 || ( ( ( value_32bit >> 8 ) & 0x1f ) > 29 ) )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	else if( block_type == ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED )
+	{
+		byte_offset = (size_t) ( ( bit_offset + 3 + 7 ) / 8 );
+
+		if( ( compressed_data_size < 4 )
+		 || ( byte_offset > ( compressed_data_size - 4 ) ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ byte_offset ] ),
+		 block_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ byte_offset + 2 ] ),
+		 value_32bit );
+
+		if( ( block_size ^ 0xffff ) != (uint16_t) value_32bit )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Decompresses a decompression chunk
+ * If the chunk is speculative the first bit offset from the search bit offset
+ * at which the blocks can be decoded is used as the start of the chunk
+ * Returns 1 on success, 0 if no block boundary was found or -1 on error
+ */
+int assorted_deflate_parallel_decompress_chunk(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *speculative_error = NULL;
+	static char *function                = "assorted_deflate_parallel_decompress_chunk";
+	uint64_t bit_offset                  = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk - missing compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->is_speculative == 0 )
+	{
+		if( assorted_deflate_parallel_decode_blocks(
+		     chunk,
+		     chunk->search_bit_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode blocks.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* A false block boundary is very likely to result in invalid compressed data
+	 * and therefore a decoding error, in which case the next bit offset is tried
+	 */
+	for( bit_offset = chunk->search_bit_offset;
+	     bit_offset < chunk->end_bit_offset_limit;
+	     bit_offset++ )
+	{
+		if( assorted_deflate_parallel_is_block_start(
+		     chunk->compressed_data,
+		     chunk->compressed_data_size,
+		     bit_offset ) == 0 )
+		{
+			continue;
+		}
+		if( assorted_deflate_parallel_decode_blocks(
+		     chunk,
+		     bit_offset,
+		     &speculative_error ) == 1 )
+		{
+			return( 1 );
+		}
+		libcerror_error_free(
+		 &speculative_error );
+	}
+	return( 0 );
+}
+
+/* Decompresses a decompression chunk from a thread pool
+ * The error is not available from the worker thread, the result is stored in the chunk
+ * Returns 1 on success, 0 if no block boundary was found or -1 on error
+ */
+int assorted_deflate_parallel_decompress_chunk_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_deflate_parallel_decompression_chunk_t *chunk = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	chunk = (assorted_deflate_parallel_decompression_chunk_t *) value;
+
+	chunk->result = assorted_deflate_parallel_decompress_chunk(
+	                 chunk,
+	                 NULL );
+
+	/* The thread pool stops on a failing callback, which is not needed
+	 * since the chunk is decoded again if speculation failed
+	 */
+	return( 1 );
+}
+
+/* Resolves the symbols of a decompression chunk into the uncompressed data
+ * The uncompressed data offset contains the offset of the chunk and is updated
+ * to the end of the chunk, the references into the window are resolved using
+ * the uncompressed data that precedes the offset
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_resolve_chunk(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "assorted_deflate_parallel_resolve_chunk";
+	size_t data_offset         = 0;
+	size_t symbol_index        = 0;
+	size_t window_data_offset  = 0;
+	uint16_t symbol            = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = *uncompressed_data_offset;
+
+	if( ( data_offset > uncompressed_data_size )
+	 || ( chunk->number_of_symbols > ( uncompressed_data_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+		 "%s: invalid uncompressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol_index = 0;
+	     symbol_index < chunk->number_of_symbols;
+	     symbol_index++ )
+	{
+		symbol = chunk->symbols[ symbol_index ];
+
+		if( symbol >= 256 )
+		{
+			/* The window consists of the 32 KiB that precede the chunk
+			 */
+			window_data_offset = (size_t) ( symbol - 256 );
+
+			if( ( *uncompressed_data_offset + window_data_offset ) < 32768 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid compression offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			symbol = uncompressed_data[ *uncompressed_data_offset + window_data_offset - 32768 ];
+		}
+		uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+	}
+	*uncompressed_data_offset = data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses data using DEFLATE compression with parts of the data decoded in parallel
+ * The compressed data is split into chunks of which, except for the first,
+ * the start is not known. A chunk is decoded from the first bit offset where
+ * the blocks can be decoded, while the data before the chunk is not known
+ * yet. A chunk is used when it starts where the previous chunk ended,
+ * otherwise it is decoded again from the end of the previous chunk.
+ * On input compressed_data_offset contains the offset of the DEFLATE compressed
+ * data and on output the offset of the first byte after its last block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_parallel_decompression_chunk_t *chunks = NULL;
+	static char *function                                   = "assorted_deflate_parallel_decompress";
+	size_t chunk_data_size                                  = 0;
+	size_t chunk_index                                      = 0;
+	size_t number_of_chunks                                 = 0;
+	size_t safe_compressed_data_offset                      = 0;
+	size_t safe_uncompressed_data_size                      = 0;
+	size_t uncompressed_data_offset                         = 0;
+	uint64_t end_bit_offset                                 = 0;
+	uint8_t last_block_flag                                 = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool                     = NULL;
+	int maximum_number_of_values                            = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset >= compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a chunk per thread, unless the chunks would become too small
+	 */
+	number_of_chunks = ( compressed_data_size - safe_compressed_data_offset ) / ASSORTED_DEFLATE_PARALLEL_MINIMUM_DECOMPRESSION_CHUNK_SIZE;
+
+	if( number_of_chunks > (size_t) number_of_threads )
+	{
+		number_of_chunks = (size_t) number_of_threads;
+	}
+	if( number_of_chunks == 0 )
+	{
+		number_of_chunks = 1;
+	}
+	chunk_data_size = ( compressed_data_size - safe_compressed_data_offset ) / number_of_chunks;
+
+	chunks = (assorted_deflate_parallel_decompression_chunk_t *) memory_allocate(
+	                                                               sizeof( assorted_deflate_parallel_decompression_chunk_t ) * number_of_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     chunks,
+	     0,
+	     sizeof( assorted_deflate_parallel_decompression_chunk_t ) * number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		memory_free(
+		 chunks );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunks[ chunk_index ].compressed_data           = compressed_data;
+		chunks[ chunk_index ].compressed_data_size      = compressed_data_size;
+		chunks[ chunk_index ].search_bit_offset         = (uint64_t) ( safe_compressed_data_offset + ( chunk_index * chunk_data_size ) ) * 8;
+		chunks[ chunk_index ].maximum_number_of_symbols = safe_uncompressed_data_size;
+
+		if( chunk_index == ( number_of_chunks - 1 ) )
+		{
+			chunks[ chunk_index ].end_bit_offset_limit = (uint64_t) compressed_data_size * 8;
+		}
+		else
+		{
+			chunks[ chunk_index ].end_bit_offset_limit = (uint64_t) ( safe_compressed_data_offset + ( ( chunk_index + 1 ) * chunk_data_size ) ) * 8;
+		}
+		if( chunk_index > 0 )
+		{
+			chunks[ chunk_index ].is_speculative = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_chunks > 1 )
+	{
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_chunks )
+		{
+			maximum_number_of_values = (int) number_of_chunks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &assorted_deflate_parallel_decompress_chunk_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( chunks[ chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push chunk: %" PRIzd " onto thread pool queue.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the chunks are decoded one after the other below
+	 */
+	end_bit_offset = (uint64_t) safe_compressed_data_offset * 8;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( ( chunks[ chunk_index ].result != 1 )
+		 || ( chunks[ chunk_index ].start_bit_offset != end_bit_offset ) )
+		{
+			chunks[ chunk_index ].is_speculative    = 0;
+			chunks[ chunk_index ].search_bit_offset = end_bit_offset;
+
+			chunks[ chunk_index ].result = assorted_deflate_parallel_decompress_chunk(
+			                                &( chunks[ chunk_index ] ),
+			                                error );
+
+			if( chunks[ chunk_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress chunk: %" PRIzd ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_deflate_parallel_resolve_chunk(
+		     &( chunks[ chunk_index ] ),
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to resolve chunk: %" PRIzd ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		end_bit_offset  = chunks[ chunk_index ].end_bit_offset;
+		last_block_flag = chunks[ chunk_index ].last_block_flag;
+
+		if( chunks[ chunk_index ].symbols != NULL )
+		{
+			memory_free(
+			 chunks[ chunk_index ].symbols );
+
+			chunks[ chunk_index ].symbols = NULL;
+		}
+		if( last_block_flag != 0 )
+		{
+			break;
+		}
+	}
+	if( last_block_flag == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ].symbols != NULL )
+		{
+			memory_free(
+			 chunks[ chunk_index ].symbols );
+		}
+	}
+	memory_free(
+	 chunks );
+
+	*compressed_data_offset = (size_t) ( ( end_bit_offset + 7 ) / 8 );
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( chunks != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			if( chunks[ chunk_index ].symbols != NULL )
+			{
+				memory_free(
+				 chunks[ chunk_index ].symbols );
+			}
+		}
+		memory_free(
+		 chunks );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using DEFLATE compression stored in the zlib compressed data format
+ * with parts of the data decoded in parallel
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_decompress_zlib(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_deflate_parallel_decompress_zlib";
+	size_t compressed_data_offset = 0;
+	uint32_t calculated_checksum  = 0;
+	uint32_t stored_checksum      = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_read_data_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data header.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_parallel_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     number_of_threads,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size - compressed_data_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 stored_checksum );
+
+		if( assorted_adler32_calculate_checksum_unfolded16_4(
+		     &calculated_checksum,
+		     uncompressed_data,
+		     *uncompressed_data_size,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+		if( stored_checksum != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the members of gzip compressed data
+ * The member boundaries can only be determined without decompressing
+ * when every member header contains the member size in a BGZF extra field
+ * Returns 1 on success, 0 if the member boundaries cannot be determined or -1 on error
+ */
+int assorted_deflate_parallel_scan_gzip_members(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     assorted_deflate_parallel_gzip_member_t **members,
+     size_t *number_of_members,
+     libcerror_error_t **error )
+{
+	assorted_deflate_parallel_gzip_member_t *safe_members = NULL;
+	void *reallocation                                    = NULL;
+	static char *function                                 = "assorted_deflate_parallel_scan_gzip_members";
+	size_t compressed_data_offset                         = 0;
+	size_t member_end_offset                              = 0;
+	size_t member_offset                                  = 0;
+	size_t member_size                                    = 0;
+	size_t number_of_allocated_members                    = 0;
+	size_t safe_number_of_members                         = 0;
+	uint32_t value_32bit                                  = 0;
+	int result                                            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( members == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid members.",
+		 function );
+
+		return( -1 );
+	}
+	if( *members != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid members value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_members == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of members.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		member_offset = compressed_data_offset;
+
+		result = assorted_deflate_read_gzip_member_header(
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          &member_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read member header.",
+			 function );
+
+			goto on_error;
+		}
+		/* The member header read guarantees the member size can contain
+		 * the member header and footer
+		 */
+		if( ( result == 0 )
+		 || ( member_size == 0 )
+		 || ( member_size > ( compressed_data_size - member_offset ) ) )
+		{
+			if( safe_members != NULL )
+			{
+				memory_free(
+				 safe_members );
+			}
+			return( 0 );
+		}
+		if( safe_number_of_members >= number_of_allocated_members )
+		{
+			if( number_of_allocated_members == 0 )
+			{
+				number_of_allocated_members = 16;
+			}
+			else
+			{
+				number_of_allocated_members *= 2;
+			}
+			if( number_of_allocated_members > ( (size_t) SSIZE_MAX / sizeof( assorted_deflate_parallel_gzip_member_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated members value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = memory_reallocate(
+			                safe_members,
+			                sizeof( assorted_deflate_parallel_gzip_member_t ) * number_of_allocated_members );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize members.",
+				 function );
+
+				goto on_error;
+			}
+			safe_members = (assorted_deflate_parallel_gzip_member_t *) reallocation;
+		}
+		member_end_offset = member_offset + member_size;
+
+		if( memory_set(
+		     &( safe_members[ safe_number_of_members ] ),
+		     0,
+		     sizeof( assorted_deflate_parallel_gzip_member_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear member.",
+			 function );
+
+			goto on_error;
+		}
+		safe_members[ safe_number_of_members ].compressed_data      = &( compressed_data[ compressed_data_offset ] );
+		safe_members[ safe_number_of_members ].compressed_data_size = member_end_offset - 8 - compressed_data_offset;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ member_end_offset - 8 ] ),
+		 safe_members[ safe_number_of_members ].stored_checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ member_end_offset - 4 ] ),
+		 value_32bit );
+
+		safe_members[ safe_number_of_members ].uncompressed_data_size = (size_t) value_32bit;
+
+		safe_number_of_members++;
+
+		compressed_data_offset = member_end_offset;
+	}
+	while( ( ( compressed_data_size - compressed_data_offset ) >= 2 )
+	    && ( compressed_data[ compressed_data_offset ] == 0x1f )
+	    && ( compressed_data[ compressed_data_offset + 1 ] == 0x8b ) );
+
+	*members           = safe_members;
+	*number_of_members = safe_number_of_members;
+
+	return( 1 );
+
+on_error:
+	if( safe_members != NULL )
+	{
+		memory_free(
+		 safe_members );
+	}
+	return( -1 );
+}
+
+/* Decompresses a gzip member into its preassigned part of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_decompress_gzip_member(
+     assorted_deflate_parallel_gzip_member_t *member,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_deflate_parallel_decompress_gzip_member";
+	size_t uncompressed_data_size = 0;
+	uint32_t calculated_checksum  = 0;
+
+	if( member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_data_size = member->uncompressed_data_size;
+
+	if( assorted_deflate_decompress(
+	     member->compressed_data,
+	     member->compressed_data_size,
+	     member->uncompressed_data,
+	     &uncompressed_data_size,
+	     NULL,
+	     error ) != 1 )
+	{
+		/* The part of the uncompressed data of the member is sized from
+		 * the member footer, hence insufficient space indicates a corrupt
+		 * footer rather than the uncompressed data being too small
+		 */
+		if( ( error != NULL )
+		 && ( libcerror_error_matches(
+		       *error,
+		       LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		       LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in uncompressed size.",
+			 function );
+
+			return( -1 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size != member->uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in uncompressed size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_crc32_calculate(
+	     &calculated_checksum,
+	     member->uncompressed_data,
+	     uncompressed_data_size,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( member->stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 member->stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses a gzip member from a thread pool
+ * The error is not available from the worker thread, the result is stored in the member
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_decompress_gzip_member_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_deflate_parallel_gzip_member_t *member = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	member = (assorted_deflate_parallel_gzip_member_t *) value;
+
+	member->result = assorted_deflate_parallel_decompress_gzip_member(
+	                  member,
+	                  NULL );
+
+	/* A failed member is decompressed again to retrieve the error
+	 */
+	return( 1 );
+}
+
+/* Decompresses data using DEFLATE compression stored in the gzip compressed data format
+ * with parts of the data decoded in parallel
+ * If the member boundaries are known, as with BGZF, the members are decompressed
+ * in parallel into preassigned parts of the uncompressed data, otherwise the members
+ * are decompressed one after the other, each with the parallel DEFLATE decompression
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_parallel_decompress_gzip(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_parallel_gzip_member_t *members = NULL;
+	static char *function                            = "assorted_deflate_parallel_decompress_gzip";
+	size_t compressed_data_offset                    = 0;
+	size_t member_data_size                          = 0;
+	size_t member_index                              = 0;
+	size_t member_size                               = 0;
+	size_t number_of_members                         = 0;
+	size_t safe_uncompressed_data_size               = 0;
+	size_t uncompressed_data_offset                  = 0;
+	uint32_t calculated_checksum                     = 0;
+	uint32_t stored_checksum                         = 0;
+	uint32_t stored_uncompressed_size                = 0;
+	int result                                       = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool              = NULL;
+	int maximum_number_of_queued_members             = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = assorted_deflate_parallel_scan_gzip_members(
+	          compressed_data,
+	          compressed_data_size,
+	          &members,
+	          &number_of_members,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to scan members.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* Assign each member its part of the uncompressed data
+		 */
+		for( member_index = 0;
+		     member_index < number_of_members;
+		     member_index++ )
+		{
+			member_data_size = members[ member_index ].uncompressed_data_size;
+
+			if( member_data_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
+
+				goto on_error;
+			}
+			members[ member_index ].uncompressed_data = &( uncompressed_data[ uncompressed_data_offset ] );
+
+			uncompressed_data_offset += member_data_size;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( number_of_threads > 1 )
+		 && ( number_of_members > 1 ) )
+		{
+			maximum_number_of_queued_members = ASSORTED_DEFLATE_PARALLEL_MAXIMUM_NUMBER_OF_QUEUED_CHUNKS;
+
+			if( number_of_members < (size_t) maximum_number_of_queued_members )
+			{
+				maximum_number_of_queued_members = (int) number_of_members;
+			}
+			if( assorted_thread_pool_create(
+			     &thread_pool,
+			     number_of_threads,
+			     maximum_number_of_queued_members,
+			     (int (*)(intptr_t *, void *)) &assorted_deflate_parallel_decompress_gzip_member_callback,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( member_index = 0;
+			     member_index < number_of_members;
+			     member_index++ )
+			{
+				if( assorted_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( members[ member_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push member: %" PRIzd " onto thread pool queue.",
+					 function,
+					 member_index );
+
+					goto on_error;
+				}
+			}
+			if( assorted_thread_pool_join(
+			     &thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		/* Without a thread pool the members are decompressed one after the other
+		 * and a member that failed is decompressed again to retrieve the error
+		 */
+		for( member_index = 0;
+		     member_index < number_of_members;
+		     member_index++ )
+		{
+			if( members[ member_index ].result != 1 )
+			{
+				if( assorted_deflate_parallel_decompress_gzip_member(
+				     &( members[ member_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decompress member: %" PRIzd ".",
+					 function,
+					 member_index );
+
+					goto on_error;
+				}
+				members[ member_index ].result = 1;
+			}
+		}
+		memory_free(
+		 members );
+
+		members = NULL;
+	}
+	else
+	{
+		do
+		{
+			if( assorted_deflate_read_gzip_member_header(
+			     compressed_data,
+			     compressed_data_size,
+			     &compressed_data_offset,
+			     &member_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read member header.",
+				 function );
+
+				goto on_error;
+			}
+			member_data_size = safe_uncompressed_data_size - uncompressed_data_offset;
+
+			if( assorted_deflate_parallel_decompress(
+			     compressed_data,
+			     compressed_data_size,
+			     &compressed_data_offset,
+			     number_of_threads,
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &member_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress data.",
+				 function );
+
+				goto on_error;
+			}
+			/* The member footer consists of the CRC-32 and the 32-bit uncompressed size
+			 */
+			if( ( compressed_data_size - compressed_data_offset ) < 8 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data value too small.",
+				 function );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 stored_checksum );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( compressed_data[ compressed_data_offset + 4 ] ),
+			 stored_uncompressed_size );
+
+			compressed_data_offset += 8;
+
+			if( assorted_crc32_calculate(
+			     &calculated_checksum,
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     member_data_size,
+			     0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to calculate checksum.",
+				 function );
+
+				goto on_error;
+			}
+			if( stored_checksum != calculated_checksum )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+				 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+				 function,
+				 stored_checksum,
+				 calculated_checksum );
+
+				goto on_error;
+			}
+			/* The stored uncompressed size contains the size modulo 2^32
+			 */
+			if( stored_uncompressed_size != (uint32_t) member_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+				 "%s: mismatch in uncompressed size.",
+				 function );
+
+				goto on_error;
+			}
+			uncompressed_data_offset += member_data_size;
+		}
+		while( ( ( compressed_data_size - compressed_data_offset ) >= 2 )
+		    && ( compressed_data[ compressed_data_offset ] == 0x1f )
+		    && ( compressed_data[ compressed_data_offset + 1 ] == 0x8b ) );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( members != NULL )
+	{
+		memory_free(
+		 members );
+	}
+	return( -1 );
+}
+
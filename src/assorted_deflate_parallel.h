@@ -0,0 +1,284 @@
+/*
+ * Deflate (zlib) parallel compression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_DEFLATE_PARALLEL_H )
+#define _ASSORTED_DEFLATE_PARALLEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_bit_stream.h"
+#include "assorted_huffman_tree.h"
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the uncompressed data of a chunk (128 KiB)
+ */
+#define ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE	131072
+
+/* The minimum size of the compressed data of a decompression chunk (64 KiB)
+ */
+#define ASSORTED_DEFLATE_PARALLEL_MINIMUM_DECOMPRESSION_CHUNK_SIZE	65536
+
+typedef struct assorted_deflate_parallel_chunk assorted_deflate_parallel_chunk_t;
+
+struct assorted_deflate_parallel_chunk
+{
+	/* The uncompressed data
+	 */
+	const uint8_t *uncompressed_data;
+
+	/* The end offset of the chunk in the uncompressed data
+	 */
+	size_t uncompressed_data_size;
+
+	/* The start offset of the chunk in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* The last block flag
+	 */
+	uint8_t last_block_flag;
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The Adler-32 of the uncompressed data of the chunk
+	 */
+	uint32_t checksum;
+
+	/* The result of the chunk compression
+	 */
+	int result;
+};
+
+typedef struct assorted_deflate_parallel_decompression_chunk assorted_deflate_parallel_decompression_chunk_t;
+
+struct assorted_deflate_parallel_decompression_chunk
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* Value to indicate the start of the chunk is not known and
+	 * a block boundary is searched for from the search bit offset
+	 */
+	uint8_t is_speculative;
+
+	/* The bit offset from which the chunk is decoded or, if speculative,
+	 * from which a block boundary is searched for
+	 */
+	uint64_t search_bit_offset;
+
+	/* The bit offset limit, decoding stops before the first block that starts at or after it
+	 */
+	uint64_t end_bit_offset_limit;
+
+	/* The bit offset of the first block that was decoded
+	 */
+	uint64_t start_bit_offset;
+
+	/* The bit offset after the last block that was decoded
+	 */
+	uint64_t end_bit_offset;
+
+	/* Value to indicate the last block of the stream was decoded
+	 */
+	uint8_t last_block_flag;
+
+	/* The decoded symbols
+	 * Contains a byte value or 256 + the offset of a byte in the 32 KiB
+	 * window that precedes the chunk, which is not known while decoding
+	 */
+	uint16_t *symbols;
+
+	/* The number of decoded symbols
+	 */
+	size_t number_of_symbols;
+
+	/* The number of allocated symbols
+	 */
+	size_t number_of_allocated_symbols;
+
+	/* The maximum number of symbols
+	 */
+	size_t maximum_number_of_symbols;
+
+	/* The result of the chunk decompression
+	 */
+	int result;
+};
+
+typedef struct assorted_deflate_parallel_gzip_member assorted_deflate_parallel_gzip_member_t;
+
+struct assorted_deflate_parallel_gzip_member
+{
+	/* The DEFLATE compressed data of the member
+	 */
+	const uint8_t *compressed_data;
+
+	/* The DEFLATE compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data of the member
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size as stored in the member footer
+	 */
+	size_t uncompressed_data_size;
+
+	/* The CRC-32 as stored in the member footer
+	 */
+	uint32_t stored_checksum;
+
+	/* The result of the member decompression
+	 */
+	int result;
+};
+
+int assorted_deflate_parallel_compress_chunk(
+     assorted_deflate_parallel_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_compress_chunk_callback(
+     intptr_t *value,
+     void *arguments );
+
+int assorted_deflate_parallel_compress_zlib(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     int number_of_threads,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_set_bit_offset(
+     assorted_bit_stream_t *bit_stream,
+     uint64_t bit_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_resize_symbols(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     size_t number_of_symbols,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_decode_huffman(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     assorted_bit_stream_t *bit_stream,
+     assorted_huffman_tree_t *literals_huffman_tree,
+     assorted_huffman_tree_t *distances_huffman_tree,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_decode_uncompressed_block(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     assorted_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_decode_blocks(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     uint64_t start_bit_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_is_block_start(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t bit_offset );
+
+int assorted_deflate_parallel_decompress_chunk(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_decompress_chunk_callback(
+     intptr_t *value,
+     void *arguments );
+
+int assorted_deflate_parallel_resolve_chunk(
+     assorted_deflate_parallel_decompression_chunk_t *chunk,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_decompress_zlib(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_scan_gzip_members(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     assorted_deflate_parallel_gzip_member_t **members,
+     size_t *number_of_members,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_decompress_gzip_member(
+     assorted_deflate_parallel_gzip_member_t *member,
+     libcerror_error_t **error );
+
+int assorted_deflate_parallel_decompress_gzip_member_callback(
+     intptr_t *value,
+     void *arguments );
+
+int assorted_deflate_parallel_decompress_gzip(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_DEFLATE_PARALLEL_H ) */
+
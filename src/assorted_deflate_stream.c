@@ -0,0 +1,2988 @@
+/*
+ * Deflate (zlib) streaming decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_DECODE_STATISTICS )
+#include <time.h>
+#endif
+
+#include "assorted_adler32.h"
+#include "assorted_aligned_memory.h"
+#include "assorted_bit_stream.h"
+#include "assorted_crc32.h"
+#include "assorted_deflate.h"
+#include "assorted_deflate_stream.h"
+#include "assorted_huffman_tree.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+
+/* The size of the input buffer
+ */
+#define ASSORTED_DEFLATE_STREAM_INPUT_BUFFER_SIZE		16384
+
+/* The size of the history window
+ */
+#define ASSORTED_DEFLATE_STREAM_WINDOW_SIZE			32768
+
+/* The maximum number of bits of a block header, including the dynamic Huffman code sizes
+ * 3-bit block header, 14-bit number of codes, 19 x 3-bit pre-code sizes and
+ * 286 + 30 code sizes of at most a 7-bit pre-code and 7 extra bits
+ */
+#define ASSORTED_DEFLATE_STREAM_MAXIMUM_BLOCK_HEADER_SIZE	4498
+
+/* The maximum number of bits of a length and distance, including extra bits
+ */
+#define ASSORTED_DEFLATE_STREAM_MAXIMUM_SYMBOL_SIZE		48
+
+/* The maximum number of bytes a single Huffman symbol adds to the window
+ */
+#define ASSORTED_DEFLATE_STREAM_MAXIMUM_MATCH_SIZE		258
+
+/* The size of the window buffer, this contains the history window, the data
+ * decoded after it and room for the last symbol that fills the buffer
+ */
+#define ASSORTED_DEFLATE_STREAM_WINDOW_BUFFER_SIZE		( ( 2 * ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ) + ASSORTED_DEFLATE_STREAM_MAXIMUM_MATCH_SIZE )
+
+/* Retrieves the number of bits available in the bit stream
+ */
+#define assorted_deflate_stream_get_number_of_available_bits( bit_stream ) \
+	( (uint64_t) bit_stream->bit_buffer_size + ( (uint64_t) ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) * 8 ) )
+
+/* Creates a stream
+ * Make sure the value stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_stream_initialize(
+     assorted_deflate_stream_t **stream,
+     uint8_t format,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_stream_initialize";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != ASSORTED_DEFLATE_STREAM_FORMAT_DEFLATE )
+	 && ( format != ASSORTED_DEFLATE_STREAM_FORMAT_ZLIB )
+	 && ( format != ASSORTED_DEFLATE_STREAM_FORMAT_GZIP ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*stream = memory_allocate_structure(
+	           assorted_deflate_stream_t );
+
+	if( *stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stream,
+	     0,
+	     sizeof( assorted_deflate_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		memory_free(
+		 *stream );
+
+		*stream = NULL;
+
+		return( -1 );
+	}
+	( *stream )->input_data = (uint8_t *) assorted_aligned_memory_allocate(
+	                                       sizeof( uint8_t ) * ASSORTED_DEFLATE_STREAM_INPUT_BUFFER_SIZE );
+
+	if( ( *stream )->input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input data.",
+		 function );
+
+		goto on_error;
+	}
+	( *stream )->window = (uint8_t *) assorted_aligned_memory_allocate(
+	                                   sizeof( uint8_t ) * ASSORTED_DEFLATE_STREAM_WINDOW_BUFFER_SIZE );
+
+	if( ( *stream )->window == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create window.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_bit_stream_initialize(
+	     &( ( *stream )->bit_stream ),
+	     ( *stream )->input_data,
+	     0,
+	     0,
+	     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_huffman_tree_initialize(
+	     &( ( *stream )->dynamic_literals_huffman_tree ),
+	     288,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dynamic literals Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_huffman_tree_initialize(
+	     &( ( *stream )->dynamic_distances_huffman_tree ),
+	     30,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dynamic distances Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	( *stream )->format   = format;
+	( *stream )->checksum = 1;
+
+	if( format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+	{
+		( *stream )->checksum = 0;
+	}
+	if( ( format == ASSORTED_DEFLATE_STREAM_FORMAT_ZLIB )
+	 || ( format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP ) )
+	{
+		( *stream )->state = ASSORTED_DEFLATE_STREAM_STATE_DATA_HEADER;
+	}
+	else
+	{
+		( *stream )->state = ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+	}
+	return( 1 );
+
+on_error:
+	if( *stream != NULL )
+	{
+		assorted_deflate_stream_free(
+		 stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a stream
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_stream_free(
+     assorted_deflate_stream_t **stream,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_stream_free";
+	int result            = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		if( ( *stream )->dynamic_distances_huffman_tree != NULL )
+		{
+			if( assorted_huffman_tree_free(
+			     &( ( *stream )->dynamic_distances_huffman_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free dynamic distances Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *stream )->dynamic_literals_huffman_tree != NULL )
+		{
+			if( assorted_huffman_tree_free(
+			     &( ( *stream )->dynamic_literals_huffman_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free dynamic literals Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *stream )->bit_stream != NULL )
+		{
+			if( assorted_bit_stream_free(
+			     &( ( *stream )->bit_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bit stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *stream )->window != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *stream )->window );
+		}
+		if( ( *stream )->input_data != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *stream )->input_data );
+		}
+		memory_free(
+		 *stream );
+
+		*stream = NULL;
+	}
+	return( result );
+}
+
+/* Sets the index to which checkpoints are added while decoding
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_stream_set_index(
+     assorted_deflate_stream_t *stream,
+     assorted_deflate_index_t *index,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_stream_set_index";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	stream->index = index;
+
+	return( 1 );
+}
+
+/* Sets the statistics to which the decoded blocks are added
+ * The statistics are only maintained when built with --enable-decode-statistics
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_deflate_stream_set_statistics(
+     assorted_deflate_stream_t *stream,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_stream_set_statistics";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	stream->statistics = statistics;
+
+	return( 1 );
+}
+
+/* Resumes decoding at a checkpoint
+ * The stream must not have decoded any data. The compressed data must start at
+ * the byte that contains the compressed bit offset of the checkpoint, if the
+ * checkpoint is not byte aligned the first byte is consumed.
+ * The checksum of the data footer is not verified after resuming.
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_resume(
+     assorted_deflate_stream_t *stream,
+     assorted_deflate_checkpoint_t *checkpoint,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_deflate_stream_resume";
+	size_t safe_compressed_data_offset = 0;
+	uint8_t number_of_skipped_bits     = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream->window_offset != 0 )
+	 || ( stream->compressed_offset != 0 )
+	 || ( stream->input_is_final != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - decoding already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checkpoint->window_size > ASSORTED_DEFLATE_STREAM_WINDOW_SIZE )
+	 || ( (uint64_t) checkpoint->window_size > checkpoint->uncompressed_offset )
+	 || ( ( checkpoint->window == NULL )
+	  && ( checkpoint->window_size > 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint - window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_skipped_bits = (uint8_t) ( checkpoint->compressed_bit_offset & 0x07 );
+
+	if( ( number_of_skipped_bits != 0 )
+	 && ( safe_compressed_data_offset >= compressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint->window_size > 0 )
+	{
+		if( memory_copy(
+		     stream->window,
+		     checkpoint->window,
+		     (size_t) checkpoint->window_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy checkpoint window.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	stream->window_offset      = (size_t) checkpoint->window_size;
+	stream->output_offset      = (size_t) checkpoint->window_size;
+	stream->window_data_offset = checkpoint->uncompressed_offset - checkpoint->window_size;
+	stream->compressed_offset  = checkpoint->compressed_bit_offset / 8;
+
+	/* The data footer checksum covers data that precedes the checkpoint
+	 */
+	stream->format = ASSORTED_DEFLATE_STREAM_FORMAT_DEFLATE;
+	stream->state  = ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+
+	stream->bit_stream->byte_stream_offset = 0;
+	stream->bit_stream->byte_stream_size   = 0;
+	stream->bit_stream->bit_buffer         = 0;
+	stream->bit_stream->bit_buffer_size    = 0;
+
+	if( number_of_skipped_bits != 0 )
+	{
+		stream->bit_stream->bit_buffer      = compressed_data[ safe_compressed_data_offset ] >> number_of_skipped_bits;
+		stream->bit_stream->bit_buffer_size = 8 - number_of_skipped_bits;
+
+		safe_compressed_data_offset += 1;
+		stream->compressed_offset   += 1;
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Restarts a stream after the end of a DEFLATE stream was reached
+ * The history window is retained in place so that the next DEFLATE stream
+ * can reference the data of the previous one, as used by MSZIP where every
+ * block is a separate DEFLATE stream
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_restart(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_stream_restart";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->format != ASSORTED_DEFLATE_STREAM_FORMAT_DEFLATE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid stream - unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream->state != ASSORTED_DEFLATE_STREAM_STATE_END )
+	 || ( stream->output_offset != stream->window_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream - end of stream not reached.",
+		 function );
+
+		return( -1 );
+	}
+	stream->state                             = ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+	stream->last_block_flag                   = 0;
+	stream->input_is_final                    = 0;
+	stream->feed_compressed_data              = NULL;
+	stream->feed_compressed_data_start_offset = 0;
+	stream->feed_compressed_data_end_offset   = 0;
+
+	stream->bit_stream->byte_stream_offset = 0;
+	stream->bit_stream->byte_stream_size   = 0;
+	stream->bit_stream->bit_buffer         = 0;
+	stream->bit_stream->bit_buffer_size    = 0;
+
+	return( 1 );
+}
+
+/* Reads compressed data into the input buffer
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_read_input(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream  = NULL;
+	static char *function              = "assorted_deflate_stream_read_input";
+	size_t read_size                   = 0;
+	size_t remaining_size              = 0;
+	size_t safe_compressed_data_offset = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	remaining_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+
+	/* Move the remaining input data to the start of the buffer
+	 * if this does not overlap with the data that was consumed
+	 */
+	if( ( bit_stream->byte_stream_offset > 0 )
+	 && ( remaining_size <= bit_stream->byte_stream_offset ) )
+	{
+		if( remaining_size > 0 )
+		{
+			if( memory_copy(
+			     stream->input_data,
+			     &( stream->input_data[ bit_stream->byte_stream_offset ] ),
+			     remaining_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move input data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		bit_stream->byte_stream_offset = 0;
+		bit_stream->byte_stream_size   = remaining_size;
+	}
+	read_size = ASSORTED_DEFLATE_STREAM_INPUT_BUFFER_SIZE - bit_stream->byte_stream_size;
+
+	if( read_size > ( compressed_data_size - safe_compressed_data_offset ) )
+	{
+		read_size = compressed_data_size - safe_compressed_data_offset;
+	}
+	if( read_size > 0 )
+	{
+		if( memory_copy(
+		     &( stream->input_data[ bit_stream->byte_stream_size ] ),
+		     &( compressed_data[ safe_compressed_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy input data.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream->byte_stream_size += read_size;
+		safe_compressed_data_offset  += read_size;
+		stream->compressed_offset    += read_size;
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Updates the checksum with data that is written
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_update_checksum(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_stream_update_checksum";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->format == ASSORTED_DEFLATE_STREAM_FORMAT_ZLIB )
+	{
+		if( assorted_adler32_calculate_checksum_unfolded16_4(
+		     &( stream->checksum ),
+		     data,
+		     data_size,
+		     stream->checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( stream->format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+	{
+		if( assorted_crc32_calculate(
+		     &( stream->checksum ),
+		     data,
+		     data_size,
+		     stream->checksum,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+		stream->member_data_size += (uint32_t) data_size;
+	}
+	return( 1 );
+}
+
+/* Writes the decoded data from the window
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_write_output(
+     assorted_deflate_stream_t *stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function                = "assorted_deflate_stream_write_output";
+	size_t safe_uncompressed_data_offset = 0;
+	size_t write_size                    = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	write_size = stream->window_offset - stream->output_offset;
+
+	if( write_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+	{
+		write_size = uncompressed_data_size - safe_uncompressed_data_offset;
+	}
+	if( write_size == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+	     &( stream->window[ stream->output_offset ] ),
+	     write_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_stream_update_checksum(
+	     stream,
+	     &( stream->window[ stream->output_offset ] ),
+	     write_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update checksum.",
+		 function );
+
+		return( -1 );
+	}
+	stream->output_offset += write_size;
+
+	*uncompressed_data_offset = safe_uncompressed_data_offset + write_size;
+
+	return( 1 );
+}
+
+/* Reads a gzip member header
+ * The end of the stream is reached when the data that follows a member
+ * does not start with a member signature
+ * Returns 1 on success, 0 if more compressed data is required or -1 on error
+ */
+int assorted_deflate_stream_read_gzip_member_header(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	static char *function             = "assorted_deflate_stream_read_gzip_member_header";
+	size_t member_size                = 0;
+	size_t remaining_size             = 0;
+	int result                        = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	remaining_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+
+	if( stream->number_of_members > 0 )
+	{
+		if( remaining_size < 2 )
+		{
+			if( stream->input_is_final == 0 )
+			{
+				return( 0 );
+			}
+			stream->state = ASSORTED_DEFLATE_STREAM_STATE_END;
+
+			return( 1 );
+		}
+		if( ( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] != 0x1f )
+		 || ( bit_stream->byte_stream[ bit_stream->byte_stream_offset + 1 ] != 0x8b ) )
+		{
+			stream->state = ASSORTED_DEFLATE_STREAM_STATE_END;
+
+			return( 1 );
+		}
+	}
+	result = assorted_deflate_read_gzip_member_header(
+	          bit_stream->byte_stream,
+	          bit_stream->byte_stream_size,
+	          &( bit_stream->byte_stream_offset ),
+	          &member_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member header.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( stream->input_is_final != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		/* The member header must fit in the input buffer
+		 */
+		if( bit_stream->byte_stream_size >= ASSORTED_DEFLATE_STREAM_INPUT_BUFFER_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid member header size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	stream->checksum         = 0;
+	stream->member_data_size = 0;
+	stream->state            = ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+
+	return( 1 );
+}
+
+/* Reads a block header
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_read_block_header(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	static char *function    = "assorted_deflate_stream_read_block_header";
+	uint32_t block_size      = 0;
+	uint32_t block_size_copy = 0;
+	uint32_t value_32bit     = 0;
+	uint8_t block_type       = 0;
+
+#if defined( HAVE_DECODE_STATISTICS )
+	clock_t start_time       = 0;
+#endif
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_read_block_header(
+	     stream->bit_stream,
+	     &block_type,
+	     &( stream->last_block_flag ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block header.",
+		 function );
+
+		return( -1 );
+	}
+	switch( block_type )
+	{
+		case ASSORTED_DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+			/* Ignore the bits in the buffer upto the next byte
+			 */
+			if( assorted_bit_stream_get_value_back_to_front(
+			     stream->bit_stream,
+			     stream->bit_stream->bit_buffer_size & 0x07,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( assorted_bit_stream_get_value_back_to_front(
+			     stream->bit_stream,
+			     32,
+			     &block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
+			block_size     &= 0x0000ffffUL;
+
+			if( block_size != block_size_copy )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+				 "%s: mismatch in block size ( %" PRIu32 " != %" PRIu32 " ).",
+				 function,
+				 block_size,
+				 block_size_copy );
+
+				return( -1 );
+			}
+			stream->block_size = block_size;
+			stream->state      = ASSORTED_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( stream->statistics != NULL )
+			{
+				stream->statistics->number_of_uncompressed_blocks += 1;
+			}
+#endif
+			break;
+
+		case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+			stream->literals_huffman_tree  = &assorted_deflate_fixed_huffman_literals_tree;
+			stream->distances_huffman_tree = &assorted_deflate_fixed_huffman_distances_tree;
+			stream->state                  = ASSORTED_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( stream->statistics != NULL )
+			{
+				stream->statistics->number_of_fixed_huffman_blocks += 1;
+			}
+#endif
+			break;
+
+		case ASSORTED_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+#if defined( HAVE_DECODE_STATISTICS )
+			start_time = clock();
+#endif
+			if( assorted_deflate_build_dynamic_huffman_trees(
+			     stream->bit_stream,
+			     stream->dynamic_literals_huffman_tree,
+			     stream->dynamic_distances_huffman_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build dynamic Huffman trees.",
+				 function );
+
+				return( -1 );
+			}
+			stream->literals_huffman_tree  = stream->dynamic_literals_huffman_tree;
+			stream->distances_huffman_tree = stream->dynamic_distances_huffman_tree;
+			stream->state                  = ASSORTED_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( stream->statistics != NULL )
+			{
+				stream->statistics->number_of_dynamic_huffman_blocks += 1;
+				stream->statistics->build_trees_time                 += (uint64_t) ( clock() - start_time );
+			}
+#endif
+			break;
+
+		case ASSORTED_DEFLATE_BLOCK_TYPE_RESERVED:
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block type.",
+			 function );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of an uncompressed block into the window
+ * Returns 1 if successful, 0 if more input data is required or -1 on error
+ */
+int assorted_deflate_stream_read_uncompressed_block(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	static char *function             = "assorted_deflate_stream_read_uncompressed_block";
+	size_t read_size                  = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	/* The bit buffer contains whole bytes that precede the data in the input buffer
+	 */
+	while( ( stream->block_size > 0 )
+	    && ( bit_stream->bit_buffer_size >= 8 )
+	    && ( stream->window_offset < ( 2 * ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ) ) )
+	{
+		stream->window[ stream->window_offset++ ] = (uint8_t) ( bit_stream->bit_buffer & 0xff );
+
+		bit_stream->bit_buffer     >>= 8;
+		bit_stream->bit_buffer_size -= 8;
+		stream->block_size          -= 1;
+
+#if defined( HAVE_DECODE_STATISTICS )
+		if( stream->statistics != NULL )
+		{
+			stream->statistics->uncompressed_blocks_data_size += 1;
+		}
+#endif
+	}
+	read_size = ( 2 * ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ) - stream->window_offset;
+
+	if( read_size > (size_t) stream->block_size )
+	{
+		read_size = (size_t) stream->block_size;
+	}
+	if( read_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
+	{
+		read_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+	}
+	if( read_size > 0 )
+	{
+		if( memory_copy(
+		     &( stream->window[ stream->window_offset ] ),
+		     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream->byte_stream_offset += read_size;
+		stream->window_offset          += read_size;
+		stream->block_size             -= (uint32_t) read_size;
+
+#if defined( HAVE_DECODE_STATISTICS )
+		if( stream->statistics != NULL )
+		{
+			stream->statistics->uncompressed_blocks_data_size += read_size;
+		}
+#endif
+	}
+	if( stream->block_size == 0 )
+	{
+		if( stream->last_block_flag != 0 )
+		{
+			stream->state = ASSORTED_DEFLATE_STREAM_STATE_DATA_FOOTER;
+		}
+		else
+		{
+			stream->state = ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+		}
+		return( 1 );
+	}
+	if( stream->window_offset >= ( 2 * ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ) )
+	{
+		return( 1 );
+	}
+	if( stream->input_is_final != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Appends data that bypassed the window to the history window
+ * Only the last window size bytes of the data are retained
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_append_history(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_deflate_stream_append_history";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->output_offset != stream->window_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream - window contains data that has not been written.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size >= ASSORTED_DEFLATE_STREAM_WINDOW_SIZE )
+	{
+		stream->window_data_offset += stream->window_offset + data_size - ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+		stream->window_offset       = 0;
+
+		data     += data_size - ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+		data_size = ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+	}
+	else if( ( stream->window_offset + data_size ) > ( 2 * ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ) )
+	{
+		/* Slide the window so that the history and the data fit in the window size
+		 */
+		if( memory_move(
+		     stream->window,
+		     &( stream->window[ stream->window_offset + data_size - ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ] ),
+		     ASSORTED_DEFLATE_STREAM_WINDOW_SIZE - data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to slide window.",
+			 function );
+
+			return( -1 );
+		}
+		stream->window_data_offset += stream->window_offset + data_size - ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+		stream->window_offset       = ASSORTED_DEFLATE_STREAM_WINDOW_SIZE - data_size;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( stream->window[ stream->window_offset ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to window.",
+			 function );
+
+			return( -1 );
+		}
+		stream->window_offset += data_size;
+	}
+	stream->output_offset = stream->window_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the data of an uncompressed block directly from the compressed data
+ * This is only possible when the input buffer, the bit buffer and the window
+ * contain no data that precedes it, in which case the data is consumed, its
+ * checksum is updated and its last window size bytes are added to the history
+ * window, so the caller can use the data without it being copied by the stream
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int assorted_deflate_stream_read_uncompressed_block_data(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t maximum_data_size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream  = NULL;
+	static char *function              = "assorted_deflate_stream_read_uncompressed_block_data";
+	size_t read_size                   = 0;
+	size_t safe_compressed_data_offset = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	if( ( stream->state != ASSORTED_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK )
+	 || ( stream->block_size == 0 )
+	 || ( stream->output_offset != stream->window_offset )
+	 || ( bit_stream->bit_buffer_size != 0 )
+	 || ( bit_stream->byte_stream_offset != bit_stream->byte_stream_size ) )
+	{
+		return( 0 );
+	}
+	read_size = compressed_data_size - safe_compressed_data_offset;
+
+	if( read_size > (size_t) stream->block_size )
+	{
+		read_size = (size_t) stream->block_size;
+	}
+	if( read_size > maximum_data_size )
+	{
+		read_size = maximum_data_size;
+	}
+	if( read_size == 0 )
+	{
+		return( 0 );
+	}
+	if( assorted_deflate_stream_update_checksum(
+	     stream,
+	     &( compressed_data[ safe_compressed_data_offset ] ),
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_deflate_stream_append_history(
+	     stream,
+	     &( compressed_data[ safe_compressed_data_offset ] ),
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append history.",
+		 function );
+
+		return( -1 );
+	}
+	stream->block_size        -= (uint32_t) read_size;
+	stream->compressed_offset += read_size;
+
+#if defined( HAVE_DECODE_STATISTICS )
+	if( stream->statistics != NULL )
+	{
+		stream->statistics->uncompressed_blocks_data_size += read_size;
+	}
+#endif
+	if( stream->block_size == 0 )
+	{
+		if( stream->last_block_flag != 0 )
+		{
+			stream->state = ASSORTED_DEFLATE_STREAM_STATE_DATA_FOOTER;
+		}
+		else
+		{
+			stream->state = ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+		}
+	}
+	*data                   = &( compressed_data[ safe_compressed_data_offset ] );
+	*data_size              = read_size;
+	*compressed_data_offset = safe_compressed_data_offset + read_size;
+
+	return( 1 );
+}
+
+/* Decodes the symbols of a Huffman compressed block into the window
+ * Returns 1 if successful, 0 if more input data is required or -1 on error
+ */
+int assorted_deflate_stream_decode_huffman(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	static char *function             = "assorted_deflate_stream_decode_huffman";
+	uint32_t extra_bits               = 0;
+	uint16_t compression_offset       = 0;
+	uint16_t compression_size         = 0;
+	uint16_t second_symbol            = 0;
+	uint16_t symbol                   = 0;
+	uint64_t saved_bit_buffer         = 0;
+	size_t saved_byte_stream_offset   = 0;
+	uint8_t number_of_symbols         = 0;
+	uint8_t is_partial                = 0;
+	uint8_t saved_bit_buffer_size     = 0;
+
+#if defined( HAVE_DECODE_STATISTICS )
+	clock_t start_time                = clock();
+#endif
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	while( stream->window_offset < ( 2 * ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ) )
+	{
+		/* If not all the bits of the symbol are guaranteed to be available
+		 * the bit stream is restored when the symbol cannot be decoded
+		 */
+		is_partial = 0;
+
+		if( ( stream->input_is_final == 0 )
+		 && ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < ( ASSORTED_DEFLATE_STREAM_MAXIMUM_SYMBOL_SIZE / 8 ) ) )
+		{
+			if( assorted_deflate_stream_get_number_of_available_bits( bit_stream ) < ASSORTED_DEFLATE_STREAM_MAXIMUM_SYMBOL_SIZE )
+			{
+				saved_byte_stream_offset = bit_stream->byte_stream_offset;
+				saved_bit_buffer         = bit_stream->bit_buffer;
+				saved_bit_buffer_size    = bit_stream->bit_buffer_size;
+				is_partial               = 1;
+			}
+		}
+		if( assorted_huffman_tree_get_symbols_from_bit_stream(
+		     stream->literals_huffman_tree,
+		     bit_stream,
+		     &symbol,
+		     &second_symbol,
+		     &number_of_symbols,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve symbol from literals Huffman tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_symbols == 2 )
+		{
+			stream->window[ stream->window_offset++ ] = (uint8_t) symbol;
+			stream->window[ stream->window_offset++ ] = (uint8_t) second_symbol;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( stream->statistics != NULL )
+			{
+				stream->statistics->number_of_literals += 2;
+			}
+#endif
+		}
+		else if( symbol < 256 )
+		{
+			stream->window[ stream->window_offset++ ] = (uint8_t) symbol;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( stream->statistics != NULL )
+			{
+				stream->statistics->number_of_literals += 1;
+			}
+#endif
+		}
+		else if( symbol == 256 )
+		{
+			if( stream->last_block_flag != 0 )
+			{
+				stream->state = ASSORTED_DEFLATE_STREAM_STATE_DATA_FOOTER;
+			}
+			else
+			{
+				stream->state = ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+			}
+			break;
+		}
+		else if( symbol < 286 )
+		{
+			symbol -= 257;
+
+			if( assorted_bit_stream_get_value_back_to_front(
+			     bit_stream,
+			     (uint8_t) assorted_deflate_literal_codes_number_of_extra_bits[ symbol ],
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve literal extra value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			compression_size = assorted_deflate_literal_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+			if( assorted_huffman_tree_get_symbol_from_bit_stream(
+			     stream->distances_huffman_tree,
+			     bit_stream,
+			     &symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve symbol from distances Huffman tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( symbol >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance symbol: %" PRIu16 ".",
+				 function,
+				 symbol );
+
+				goto on_error;
+			}
+			if( assorted_bit_stream_get_value_back_to_front(
+			     bit_stream,
+			     (uint8_t) assorted_deflate_distance_codes_number_of_extra_bits[ symbol ],
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve distance extra value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			compression_offset = assorted_deflate_distance_codes_base[ symbol ] + (uint16_t) extra_bits;
+
+			if( assorted_deflate_copy_match(
+			     stream->window,
+			     ASSORTED_DEFLATE_STREAM_WINDOW_BUFFER_SIZE,
+			     stream->window_offset,
+			     compression_offset,
+			     compression_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy match.",
+				 function );
+
+				goto on_error;
+			}
+			stream->window_offset += compression_size;
+
+#if defined( HAVE_DECODE_STATISTICS )
+			if( stream->statistics != NULL )
+			{
+				stream->statistics->number_of_matches                                                += 1;
+				stream->statistics->match_sizes[ assorted_deflate_length_codes[ compression_size - 3 ] ] += 1;
+				stream->statistics->match_distances[ symbol ]                                        += 1;
+			}
+#endif
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid symbol: %" PRIu16 ".",
+			 function,
+			 symbol );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DECODE_STATISTICS )
+	if( stream->statistics != NULL )
+	{
+		stream->statistics->decode_time += (uint64_t) ( clock() - start_time );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( is_partial != 0 )
+	{
+		bit_stream->byte_stream_offset = saved_byte_stream_offset;
+		bit_stream->bit_buffer         = saved_bit_buffer;
+		bit_stream->bit_buffer_size    = saved_bit_buffer_size;
+
+		libcerror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	return( -1 );
+}
+
+/* Reads the data footer
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_read_data_footer(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	static char *function    = "assorted_deflate_stream_read_data_footer";
+	uint32_t stored_checksum = 0;
+	uint32_t value_32bit     = 0;
+	uint8_t byte_index       = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore the bits in the buffer upto the next byte
+	 */
+	if( assorted_bit_stream_get_value_back_to_front(
+	     stream->bit_stream,
+	     stream->bit_stream->bit_buffer_size & 0x07,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Similar to assorted_deflate_decompress_zlib a missing checksum is ignored
+	 */
+	if( ( stream->format == ASSORTED_DEFLATE_STREAM_FORMAT_ZLIB )
+	 && ( assorted_deflate_stream_get_number_of_available_bits( stream->bit_stream ) >= 32 ) )
+	{
+		/* The checksum is stored in big-endian
+		 */
+		for( byte_index = 0;
+		     byte_index < 4;
+		     byte_index++ )
+		{
+			if( assorted_bit_stream_get_value_back_to_front(
+			     stream->bit_stream,
+			     8,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			stored_checksum = ( stored_checksum << 8 ) | value_32bit;
+		}
+		if( stored_checksum != stream->checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_checksum,
+			 stream->checksum );
+
+			return( -1 );
+		}
+	}
+	else if( stream->format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+	{
+		/* The member footer consists of the CRC-32 and the 32-bit uncompressed size
+		 * stored in little-endian
+		 */
+		if( assorted_bit_stream_get_value_back_to_front(
+		     stream->bit_stream,
+		     32,
+		     &stored_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve checksum from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_bit_stream_get_value_back_to_front(
+		     stream->bit_stream,
+		     32,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed size from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( stored_checksum != stream->checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_checksum,
+			 stream->checksum );
+
+			return( -1 );
+		}
+		if( value_32bit != stream->member_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in uncompressed size.",
+			 function );
+
+			return( -1 );
+		}
+		/* Return the bytes remaining in the bit buffer to the byte stream
+		 * so that the next member header can be read from the byte stream
+		 */
+		stream->bit_stream->byte_stream_offset -= stream->bit_stream->bit_buffer_size >> 3;
+		stream->bit_stream->bit_buffer          = 0;
+		stream->bit_stream->bit_buffer_size     = 0;
+
+		stream->number_of_members += 1;
+		stream->state              = ASSORTED_DEFLATE_STREAM_STATE_DATA_HEADER;
+
+		return( 1 );
+	}
+	stream->state = ASSORTED_DEFLATE_STREAM_STATE_END;
+
+	return( 1 );
+}
+
+/* Adds a checkpoint at the start of the next block to the index
+ * A checkpoint is only added when the distance to the last checkpoint
+ * is at least the spacing of the index
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_add_checkpoint(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	assorted_deflate_checkpoint_t *last_checkpoint = NULL;
+	static char *function                          = "assorted_deflate_stream_add_checkpoint";
+	uint64_t compressed_bit_offset                 = 0;
+	uint64_t uncompressed_offset                   = 0;
+	size_t window_size                             = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->index == NULL )
+	{
+		return( 1 );
+	}
+	uncompressed_offset = stream->window_data_offset + stream->window_offset;
+
+	if( stream->index->number_of_checkpoints > 0 )
+	{
+		last_checkpoint = &( stream->index->checkpoints[ stream->index->number_of_checkpoints - 1 ] );
+
+		if( uncompressed_offset < last_checkpoint->uncompressed_offset )
+		{
+			return( 1 );
+		}
+		if( ( uncompressed_offset - last_checkpoint->uncompressed_offset ) < stream->index->spacing )
+		{
+			return( 1 );
+		}
+	}
+	compressed_bit_offset = ( stream->compressed_offset * 8 )
+	                      - assorted_deflate_stream_get_number_of_available_bits( stream->bit_stream );
+
+	window_size = stream->window_offset;
+
+	if( window_size > ASSORTED_DEFLATE_STREAM_WINDOW_SIZE )
+	{
+		window_size = ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+	}
+	if( assorted_deflate_index_append_checkpoint(
+	     stream->index,
+	     compressed_bit_offset,
+	     uncompressed_offset,
+	     &( stream->window[ stream->window_offset - window_size ] ),
+	     (uint32_t) window_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes the input data into the window until the window is full,
+ * the end of the stream is reached or more input data is required
+ * Returns 1 if successful, 0 if more input data is required or -1 on error
+ */
+int assorted_deflate_stream_decode(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	static char *function             = "assorted_deflate_stream_decode";
+	uint64_t required_size            = 0;
+	uint64_t saved_bit_buffer         = 0;
+	size_t saved_byte_stream_offset   = 0;
+	uint8_t is_partial                = 0;
+	uint8_t saved_bit_buffer_size     = 0;
+	int result                        = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = stream->bit_stream;
+
+	/* Slide the window when it is full and all the data in it has been written
+	 */
+	if( ( stream->window_offset >= ( 2 * ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ) )
+	 && ( stream->output_offset == stream->window_offset ) )
+	{
+		if( memory_copy(
+		     stream->window,
+		     &( stream->window[ stream->window_offset - ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ] ),
+		     ASSORTED_DEFLATE_STREAM_WINDOW_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to slide window.",
+			 function );
+
+			return( -1 );
+		}
+		stream->window_data_offset += stream->window_offset - ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+		stream->window_offset       = ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+		stream->output_offset       = ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+	}
+	while( stream->state != ASSORTED_DEFLATE_STREAM_STATE_END )
+	{
+		switch( stream->state )
+		{
+			case ASSORTED_DEFLATE_STREAM_STATE_DATA_HEADER:
+				if( stream->format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+				{
+					result = assorted_deflate_stream_read_gzip_member_header(
+					          stream,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read member header.",
+						 function );
+
+						return( -1 );
+					}
+					else if( result == 0 )
+					{
+						return( 0 );
+					}
+					break;
+				}
+				/* The data header consists of 2 bytes and an optional 4-byte preset dictionary identifier
+				 */
+				if( ( stream->input_is_final == 0 )
+				 && ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 6 ) )
+				{
+					return( 0 );
+				}
+				if( assorted_deflate_read_data_header(
+				     bit_stream->byte_stream,
+				     bit_stream->byte_stream_size,
+				     &( bit_stream->byte_stream_offset ),
+				     NULL,
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read data header.",
+					 function );
+
+					return( -1 );
+				}
+				stream->state = ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER;
+
+				break;
+
+			case ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER:
+				if( assorted_deflate_stream_add_checkpoint(
+				     stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add checkpoint.",
+					 function );
+
+					return( -1 );
+				}
+				/* If not all the bits of the block header are guaranteed to be available
+				 * the bit stream is restored when the block header cannot be read
+				 */
+				is_partial = 0;
+
+				if( ( stream->input_is_final == 0 )
+				 && ( assorted_deflate_stream_get_number_of_available_bits( bit_stream ) < ASSORTED_DEFLATE_STREAM_MAXIMUM_BLOCK_HEADER_SIZE ) )
+				{
+					saved_byte_stream_offset = bit_stream->byte_stream_offset;
+					saved_bit_buffer         = bit_stream->bit_buffer;
+					saved_bit_buffer_size    = bit_stream->bit_buffer_size;
+					is_partial               = 1;
+				}
+				if( assorted_deflate_stream_read_block_header(
+				     stream,
+				     error ) != 1 )
+				{
+					if( is_partial != 0 )
+					{
+						bit_stream->byte_stream_offset = saved_byte_stream_offset;
+						bit_stream->bit_buffer         = saved_bit_buffer;
+						bit_stream->bit_buffer_size    = saved_bit_buffer_size;
+
+						libcerror_error_free(
+						 error );
+
+						return( 0 );
+					}
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block header.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+
+			case ASSORTED_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK:
+				result = assorted_deflate_stream_read_uncompressed_block(
+				          stream,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read uncompressed block.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					return( 0 );
+				}
+				if( stream->state == ASSORTED_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK )
+				{
+					/* The window is full
+					 */
+					return( 1 );
+				}
+				break;
+
+			case ASSORTED_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK:
+				result = assorted_deflate_stream_decode_huffman(
+				          stream,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to decode Huffman compressed block.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					return( 0 );
+				}
+				if( stream->state == ASSORTED_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK )
+				{
+					/* The window is full
+					 */
+					return( 1 );
+				}
+				break;
+
+			case ASSORTED_DEFLATE_STREAM_STATE_DATA_FOOTER:
+				/* The checksum can only be verified after all data has been written
+				 */
+				if( stream->output_offset != stream->window_offset )
+				{
+					return( 1 );
+				}
+				if( stream->format == ASSORTED_DEFLATE_STREAM_FORMAT_ZLIB )
+				{
+					required_size = ( bit_stream->bit_buffer_size & 0x07 ) + 32;
+				}
+				else if( stream->format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+				{
+					required_size = ( bit_stream->bit_buffer_size & 0x07 ) + 64;
+				}
+				else
+				{
+					required_size = bit_stream->bit_buffer_size & 0x07;
+				}
+				if( ( stream->input_is_final == 0 )
+				 && ( assorted_deflate_stream_get_number_of_available_bits( bit_stream ) < required_size ) )
+				{
+					return( 0 );
+				}
+				if( assorted_deflate_stream_read_data_footer(
+				     stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read data footer.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported state.",
+				 function );
+
+				return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decompresses data using DEFLATE compression a part at a time
+ * The compressed data is consumed starting at compressed_data_offset and
+ * the offset is updated to the compressed data that has not been consumed.
+ * On input uncompressed_data_size contains the size of the uncompressed data buffer
+ * and on output the number of bytes written to it. History is kept in a 32 KiB window
+ * so the memory used does not depend on the size of the compressed data.
+ * When the end of the stream is reached within compressed data the offset is
+ * set to the first byte after the end of the stream. If the call continues at
+ * the offset where the previous call with the same compressed data ended,
+ * this can precede the offset the call started at.
+ * Returns 1 if the end of the stream was reached and all data was written,
+ * 0 if more compressed data or output buffer space is required or -1 on error
+ */
+int assorted_deflate_stream_feed(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *block_data            = NULL;
+	static char *function                = "assorted_deflate_stream_feed";
+	size_t block_data_size               = 0;
+	size_t initial_compressed_offset     = 0;
+	size_t remaining_size                = 0;
+	size_t safe_compressed_data_offset   = 0;
+	size_t safe_uncompressed_data_size   = 0;
+	size_t uncompressed_data_offset      = 0;
+	int result                           = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->input_is_final != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - input data already finished.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A feed that continues where the previous feed of the same compressed data
+	 * ended can return data that was read by the previous feed
+	 */
+	if( ( compressed_data != stream->feed_compressed_data )
+	 || ( safe_compressed_data_offset != stream->feed_compressed_data_end_offset ) )
+	{
+		stream->feed_compressed_data              = compressed_data;
+		stream->feed_compressed_data_start_offset = safe_compressed_data_offset;
+	}
+	initial_compressed_offset = stream->feed_compressed_data_start_offset;
+
+	while( stream->state != ASSORTED_DEFLATE_STREAM_STATE_END )
+	{
+		if( assorted_deflate_stream_write_output(
+		     stream,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		if( stream->output_offset < stream->window_offset )
+		{
+			break;
+		}
+		/* The data of an uncompressed block is copied directly from the compressed data
+		 */
+		result = assorted_deflate_stream_read_uncompressed_block_data(
+		          stream,
+		          compressed_data,
+		          compressed_data_size,
+		          &safe_compressed_data_offset,
+		          safe_uncompressed_data_size - uncompressed_data_offset,
+		          &block_data,
+		          &block_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read uncompressed block data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     block_data,
+			     block_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			uncompressed_data_offset += block_data_size;
+
+			continue;
+		}
+		if( assorted_deflate_stream_read_input(
+		     stream,
+		     compressed_data,
+		     compressed_data_size,
+		     &safe_compressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		result = assorted_deflate_stream_decode(
+		          stream,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( safe_compressed_data_offset >= compressed_data_size ) )
+		{
+			if( assorted_deflate_stream_write_output(
+			     stream,
+			     uncompressed_data,
+			     safe_uncompressed_data_size,
+			     &uncompressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+	}
+	if( stream->state == ASSORTED_DEFLATE_STREAM_STATE_END )
+	{
+		if( assorted_deflate_stream_write_output(
+		     stream,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		/* Return the input data that follows the end of the stream
+		 */
+		remaining_size = ( stream->bit_stream->bit_buffer_size >> 3 )
+		               + ( stream->bit_stream->byte_stream_size - stream->bit_stream->byte_stream_offset );
+
+		if( remaining_size > ( safe_compressed_data_offset - initial_compressed_offset ) )
+		{
+			remaining_size = safe_compressed_data_offset - initial_compressed_offset;
+		}
+		safe_compressed_data_offset -= remaining_size;
+
+		stream->bit_stream->byte_stream_offset = 0;
+		stream->bit_stream->byte_stream_size   = 0;
+		stream->bit_stream->bit_buffer         = 0;
+		stream->bit_stream->bit_buffer_size    = 0;
+	}
+	stream->feed_compressed_data_end_offset = safe_compressed_data_offset;
+
+	*compressed_data_offset = safe_compressed_data_offset;
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	if( ( stream->state == ASSORTED_DEFLATE_STREAM_STATE_END )
+	 && ( stream->output_offset == stream->window_offset ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Finishes decompressing data after all compressed data has been provided
+ * On input uncompressed_data_size contains the size of the uncompressed data buffer
+ * and on output the number of bytes written to it
+ * Returns 1 if the end of the stream was reached and all data was written,
+ * 0 if more output buffer space is required or -1 on error
+ */
+int assorted_deflate_stream_finish(
+     assorted_deflate_stream_t *stream,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_deflate_stream_finish";
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	int result                         = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	stream->input_is_final = 1;
+
+	do
+	{
+		if( assorted_deflate_stream_write_output(
+		     stream,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		if( stream->output_offset < stream->window_offset )
+		{
+			break;
+		}
+		if( stream->state == ASSORTED_DEFLATE_STREAM_STATE_END )
+		{
+			break;
+		}
+		result = assorted_deflate_stream_decode(
+		          stream,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode compressed data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( 1 );
+
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	if( ( stream->state == ASSORTED_DEFLATE_STREAM_STATE_END )
+	 && ( stream->output_offset == stream->window_offset ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Decompresses all the compressed data and passes the uncompressed data to a sink
+ * The uncompressed data is provided to write_function in parts of at most
+ * the window size, so the uncompressed data is never stored as a whole
+ * The data of uncompressed blocks is provided directly from the compressed data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_deflate_stream_decompress(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error ),
+     intptr_t *sink,
+     libcerror_error_t **error )
+{
+	const uint8_t *block_data     = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	static char *function         = "assorted_deflate_stream_decompress";
+	size_t block_data_size        = 0;
+	size_t compressed_data_offset = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write function.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_DEFLATE_STREAM_WINDOW_SIZE );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( result == 0 )
+	{
+		/* The data of an uncompressed block is passed to the sink directly
+		 * from the compressed data without being copied
+		 */
+		result = assorted_deflate_stream_read_uncompressed_block_data(
+		          stream,
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          (size_t) SSIZE_MAX,
+		          &block_data,
+		          &block_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read uncompressed block data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 1 )
+		{
+			if( write_function(
+			     sink,
+			     block_data,
+			     block_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+			result = 0;
+
+			continue;
+		}
+		uncompressed_data_size = ASSORTED_DEFLATE_STREAM_WINDOW_SIZE;
+
+		if( compressed_data_offset < compressed_data_size )
+		{
+			result = assorted_deflate_stream_feed(
+			          stream,
+			          compressed_data,
+			          compressed_data_size,
+			          &compressed_data_offset,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          error );
+		}
+		else
+		{
+			result = assorted_deflate_stream_finish(
+			          stream,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          error );
+
+			/* Finish only requires more calls when the buffer is full
+			 */
+			if( ( result == 0 )
+			 && ( uncompressed_data_size == 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to finish stream.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+		if( uncompressed_data_size > 0 )
+		{
+			if( write_function(
+			     sink,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,284 @@
+/*
+ * Deflate (zlib) streaming decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_DEFLATE_STREAM_H )
+#define _ASSORTED_DEFLATE_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_bit_stream.h"
+#include "assorted_deflate.h"
+#include "assorted_deflate_index.h"
+#include "assorted_huffman_tree.h"
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The stream formats
+ */
+enum ASSORTED_DEFLATE_STREAM_FORMATS
+{
+	ASSORTED_DEFLATE_STREAM_FORMAT_DEFLATE	= 0x00,
+	ASSORTED_DEFLATE_STREAM_FORMAT_ZLIB	= 0x01,
+	ASSORTED_DEFLATE_STREAM_FORMAT_GZIP	= 0x02
+};
+
+/* The stream states
+ */
+enum ASSORTED_DEFLATE_STREAM_STATES
+{
+	ASSORTED_DEFLATE_STREAM_STATE_DATA_HEADER		= 0x00,
+	ASSORTED_DEFLATE_STREAM_STATE_BLOCK_HEADER		= 0x01,
+	ASSORTED_DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK	= 0x02,
+	ASSORTED_DEFLATE_STREAM_STATE_HUFFMAN_BLOCK		= 0x03,
+	ASSORTED_DEFLATE_STREAM_STATE_DATA_FOOTER		= 0x04,
+	ASSORTED_DEFLATE_STREAM_STATE_END			= 0x05
+};
+
+typedef struct assorted_deflate_stream assorted_deflate_stream_t;
+
+struct assorted_deflate_stream
+{
+	/* The format
+	 */
+	uint8_t format;
+
+	/* The state
+	 */
+	uint8_t state;
+
+	/* The last block flag
+	 */
+	uint8_t last_block_flag;
+
+	/* Value to indicate all input data has been provided
+	 */
+	uint8_t input_is_final;
+
+	/* The compressed data of the previous feed and the offset in it at which the
+	 * stream started reading, used to return the data that follows the end of
+	 * the stream when it was read by a previous feed of the same compressed data
+	 */
+	const uint8_t *feed_compressed_data;
+
+	size_t feed_compressed_data_start_offset;
+
+	/* The compressed data offset at which the previous feed ended
+	 */
+	size_t feed_compressed_data_end_offset;
+
+	/* The input data
+	 */
+	uint8_t *input_data;
+
+	/* The bit stream of the input data
+	 */
+	assorted_bit_stream_t *bit_stream;
+
+	/* The offset of the compressed data that follows the input data
+	 */
+	uint64_t compressed_offset;
+
+	/* The window that contains the history and the data that has not been written
+	 */
+	uint8_t *window;
+
+	/* The window offset of the next byte to decode
+	 */
+	size_t window_offset;
+
+	/* The window offset of the next byte to write
+	 */
+	size_t output_offset;
+
+	/* The uncompressed offset of the start of the window
+	 */
+	uint64_t window_data_offset;
+
+	/* The remaining size of the current uncompressed block
+	 */
+	uint32_t block_size;
+
+	/* The literals Huffman tree of the current block
+	 */
+	assorted_huffman_tree_t *literals_huffman_tree;
+
+	/* The distances Huffman tree of the current block
+	 */
+	assorted_huffman_tree_t *distances_huffman_tree;
+
+	/* The dynamic literals Huffman tree
+	 */
+	assorted_huffman_tree_t *dynamic_literals_huffman_tree;
+
+	/* The dynamic distances Huffman tree
+	 */
+	assorted_huffman_tree_t *dynamic_distances_huffman_tree;
+
+	/* The Adler-32 of the data that has been written
+	 * or the CRC-32 of the data of the current gzip member
+	 */
+	uint32_t checksum;
+
+	/* The size of the data of the current gzip member that has been written, modulo 2^32
+	 */
+	uint32_t member_data_size;
+
+	/* The number of gzip members that have been read
+	 */
+	uint32_t number_of_members;
+
+	/* The index to which checkpoints are added, or NULL if not set
+	 */
+	assorted_deflate_index_t *index;
+
+	/* The statistics to which the decoded blocks are added, or NULL if not set
+	 */
+	assorted_deflate_statistics_t *statistics;
+};
+
+int assorted_deflate_stream_initialize(
+     assorted_deflate_stream_t **stream,
+     uint8_t format,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_free(
+     assorted_deflate_stream_t **stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_set_index(
+     assorted_deflate_stream_t *stream,
+     assorted_deflate_index_t *index,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_set_statistics(
+     assorted_deflate_stream_t *stream,
+     assorted_deflate_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_resume(
+     assorted_deflate_stream_t *stream,
+     assorted_deflate_checkpoint_t *checkpoint,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_restart(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_read_input(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_update_checksum(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_write_output(
+     assorted_deflate_stream_t *stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_read_gzip_member_header(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_read_block_header(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_read_uncompressed_block(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_append_history(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_read_uncompressed_block_data(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t maximum_data_size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_decode_huffman(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_read_data_footer(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_add_checkpoint(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_decode(
+     assorted_deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_feed(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_finish(
+     assorted_deflate_stream_t *stream,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_deflate_stream_decompress(
+     assorted_deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error ),
+     intptr_t *sink,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_DEFLATE_STREAM_H ) */
+
@@ -0,0 +1,276 @@
+/*
+ * Apple Disk Image (DMG) block table (mish) functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_dmg_block_table.h"
+#include "assorted_libcerror.h"
+
+/* The maximum number of sectors that fits in a 64-bit signed offset
+ */
+#define ASSORTED_DMG_BLOCK_TABLE_MAXIMUM_NUMBER_OF_SECTORS \
+	( (uint64_t) INT64_MAX / ASSORTED_DMG_BLOCK_TABLE_SECTOR_SIZE )
+
+/* Retrieves the number of entries in a block table
+ * The block table data starts with the "mish" signature and is stored big-endian
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_dmg_block_table_get_number_of_entries(
+     const uint8_t *block_table_data,
+     size_t block_table_data_size,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_dmg_block_table_get_number_of_entries";
+	uint32_t format_version         = 0;
+	uint32_t safe_number_of_entries = 0;
+
+	if( block_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_table_data_size < ASSORTED_DMG_BLOCK_TABLE_HEADER_SIZE )
+	 || ( block_table_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block table data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     block_table_data,
+	     "mish",
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported block table signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 &( block_table_data[ 4 ] ),
+	 format_version );
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block table format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 &( block_table_data[ 200 ] ),
+	 safe_number_of_entries );
+
+	if( (size_t) safe_number_of_entries > ( ( block_table_data_size - ASSORTED_DMG_BLOCK_TABLE_HEADER_SIZE ) / ASSORTED_DMG_BLOCK_TABLE_ENTRY_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = safe_number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the entries of a block table
+ * The sector numbers of the entries are relative to the first sector of the block table
+ * and are converted into offsets in the disk image, the compressed data offsets are
+ * relative to the data offset of the block table and are converted into offsets
+ * relative to the start of the data fork
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_dmg_block_table_get_entries(
+     const uint8_t *block_table_data,
+     size_t block_table_data_size,
+     assorted_dmg_block_table_entry_t *entries,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_dmg_block_table_get_entries";
+	size_t block_table_offset       = 0;
+	uint64_t compressed_offset      = 0;
+	uint64_t compressed_size        = 0;
+	uint64_t data_offset            = 0;
+	uint64_t entry_sector_number    = 0;
+	uint64_t number_of_sectors      = 0;
+	uint64_t sector_number          = 0;
+	uint32_t entry_index            = 0;
+	uint32_t safe_number_of_entries = 0;
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_dmg_block_table_get_number_of_entries(
+	     block_table_data,
+	     block_table_data_size,
+	     &safe_number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries != safe_number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 &( block_table_data[ 8 ] ),
+	 sector_number );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( block_table_data[ 24 ] ),
+	 data_offset );
+
+	if( ( sector_number > ASSORTED_DMG_BLOCK_TABLE_MAXIMUM_NUMBER_OF_SECTORS )
+	 || ( data_offset > (uint64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block table sector number or data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_table_offset = ASSORTED_DMG_BLOCK_TABLE_HEADER_SIZE;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( block_table_data[ block_table_offset ] ),
+		 entries[ entry_index ].type );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( block_table_data[ block_table_offset + 8 ] ),
+		 entry_sector_number );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( block_table_data[ block_table_offset + 16 ] ),
+		 number_of_sectors );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( block_table_data[ block_table_offset + 24 ] ),
+		 compressed_offset );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( block_table_data[ block_table_offset + 32 ] ),
+		 compressed_size );
+
+		block_table_offset += ASSORTED_DMG_BLOCK_TABLE_ENTRY_SIZE;
+
+		if( ( entry_sector_number > ( ASSORTED_DMG_BLOCK_TABLE_MAXIMUM_NUMBER_OF_SECTORS - sector_number ) )
+		 || ( number_of_sectors > ( ASSORTED_DMG_BLOCK_TABLE_MAXIMUM_NUMBER_OF_SECTORS - sector_number - entry_sector_number ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %" PRIu32 " sector range value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( compressed_offset > ( (uint64_t) INT64_MAX - data_offset ) )
+		 || ( compressed_size > ( (uint64_t) INT64_MAX - data_offset - compressed_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %" PRIu32 " compressed data range value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		entries[ entry_index ].uncompressed_data_offset = (off64_t) ( ( sector_number + entry_sector_number ) * ASSORTED_DMG_BLOCK_TABLE_SECTOR_SIZE );
+		entries[ entry_index ].uncompressed_data_size   = (size64_t) ( number_of_sectors * ASSORTED_DMG_BLOCK_TABLE_SECTOR_SIZE );
+		entries[ entry_index ].compressed_data_offset   = (off64_t) ( data_offset + compressed_offset );
+		entries[ entry_index ].compressed_data_size     = (size64_t) compressed_size;
+	}
+	return( 1 );
+}
+
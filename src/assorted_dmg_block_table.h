@@ -0,0 +1,105 @@
+/*
+ * Apple Disk Image (DMG) block table (mish) functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_DMG_BLOCK_TABLE_H )
+#define _ASSORTED_DMG_BLOCK_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a sector
+ */
+#define ASSORTED_DMG_BLOCK_TABLE_SECTOR_SIZE		512
+
+/* The size of the block table header
+ */
+#define ASSORTED_DMG_BLOCK_TABLE_HEADER_SIZE		204
+
+/* The size of a block table entry
+ */
+#define ASSORTED_DMG_BLOCK_TABLE_ENTRY_SIZE		40
+
+/* The block table entry types
+ */
+enum ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPES
+{
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_SPARSE	= 0x00000000UL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_RAW		= 0x00000001UL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_IGNORE	= 0x00000002UL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_COMMENT	= 0x7ffffffeUL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_ADC		= 0x80000004UL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_ZLIB	= 0x80000005UL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_BZIP2	= 0x80000006UL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_LZFSE	= 0x80000007UL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_LZMA	= 0x80000008UL,
+	ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_TERMINATOR	= 0xffffffffUL
+};
+
+typedef struct assorted_dmg_block_table_entry assorted_dmg_block_table_entry_t;
+
+struct assorted_dmg_block_table_entry
+{
+	/* The entry type
+	 */
+	uint32_t type;
+
+	/* The offset of the uncompressed data in the disk image
+	 */
+	off64_t uncompressed_data_offset;
+
+	/* The size of the uncompressed data
+	 */
+	size64_t uncompressed_data_size;
+
+	/* The offset of the compressed data relative to the start of the data fork
+	 */
+	off64_t compressed_data_offset;
+
+	/* The size of the compressed data
+	 */
+	size64_t compressed_data_size;
+};
+
+int assorted_dmg_block_table_get_number_of_entries(
+     const uint8_t *block_table_data,
+     size_t block_table_data_size,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
+int assorted_dmg_block_table_get_entries(
+     const uint8_t *block_table_data,
+     size_t block_table_data_size,
+     assorted_dmg_block_table_entry_t *entries,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_DMG_BLOCK_TABLE_H ) */
+
@@ -22,8 +22,18 @@
 #include <common.h>
 #include <types.h>
 
+#include "assorted_cpu_features.h"
 #include "assorted_fletcher32.h"
 #include "assorted_libcerror.h"
+#include "assorted_unused.h"
+
+#if defined( ASSORTED_FLETCHER32_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_FLETCHER32_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
 
 /* Calculates the Fletcher-32 of a buffer
  * Use a previous key of 0 to calculate a new Fletcher-32
@@ -116,3 +126,384 @@ int assorted_fletcher32_calculate(
 	return( 1 );
 }
 
+/* The number of bytes after which the modulo calculation is needed,
+ * rounded down to a multiple of the 64 bytes processed per iteration
+ * 5552 (0x15b0) & ~63 = 5504 (0x1580)
+ */
+#define ASSORTED_FLETCHER32_SIMD_BLOCK_SIZE	0x1580
+
+#if defined( ASSORTED_FLETCHER32_HAVE_AVX2 )
+
+/* Calculates the Fletcher-32 of a buffer using AVX2, 64 bytes per iteration
+ * The size must be a multiple of 64
+ * Returns the Fletcher-32 with the sums reduced modulo 65535
+ */
+__attribute__ ((target ("avx2"))) uint32_t assorted_fletcher32_simd_avx2(
+                                            uint32_t fletcher32,
+                                            const uint8_t *buffer,
+                                            size_t size )
+{
+	__m256i lower_multipliers_256bit = _mm256_setr_epi8( 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33 );
+	__m256i upper_multipliers_256bit = _mm256_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+	__m256i ones_256bit              = _mm256_set1_epi16( 1 );
+	__m256i zero_256bit              = _mm256_setzero_si256();
+	__m256i lower_sum_256bit;
+	__m256i previous_sum_256bit;
+	__m256i upper_sum_256bit;
+	__m256i value_256bit1;
+	__m256i value_256bit2;
+	__m128i lower_sum_128bit;
+	__m128i upper_sum_128bit;
+
+	size_t block_size   = 0;
+	size_t block_offset = 0;
+	uint32_t lower_word = fletcher32 & 0xffff;
+	uint32_t upper_word = ( fletcher32 >> 16 ) & 0xffff;
+
+	while( size > 0 )
+	{
+		block_size = size;
+
+		if( block_size > ASSORTED_FLETCHER32_SIMD_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_FLETCHER32_SIMD_BLOCK_SIZE;
+		}
+		/* Every byte of the block adds the lower word to the upper word
+		 */
+		upper_word += lower_word * (uint32_t) block_size;
+
+		lower_sum_256bit    = _mm256_setzero_si256();
+		previous_sum_256bit = _mm256_setzero_si256();
+		upper_sum_256bit    = _mm256_setzero_si256();
+
+		for( block_offset = 0;
+		     block_offset < block_size;
+		     block_offset += 64 )
+		{
+			value_256bit1 = _mm256_loadu_si256( (const __m256i *) buffer );
+			value_256bit2 = _mm256_loadu_si256( (const __m256i *) &( buffer[ 32 ] ) );
+
+			/* Every 64 bytes add the lower sum of the previous iterations to the upper sum
+			 */
+			previous_sum_256bit = _mm256_add_epi32( previous_sum_256bit, lower_sum_256bit );
+
+			lower_sum_256bit = _mm256_add_epi32( lower_sum_256bit, _mm256_sad_epu8( value_256bit1, zero_256bit ) );
+			lower_sum_256bit = _mm256_add_epi32( lower_sum_256bit, _mm256_sad_epu8( value_256bit2, zero_256bit ) );
+
+			value_256bit1 = _mm256_maddubs_epi16( value_256bit1, lower_multipliers_256bit );
+			value_256bit2 = _mm256_maddubs_epi16( value_256bit2, upper_multipliers_256bit );
+
+			upper_sum_256bit = _mm256_add_epi32( upper_sum_256bit, _mm256_madd_epi16( value_256bit1, ones_256bit ) );
+			upper_sum_256bit = _mm256_add_epi32( upper_sum_256bit, _mm256_madd_epi16( value_256bit2, ones_256bit ) );
+
+			buffer += 64;
+		}
+		upper_sum_256bit = _mm256_add_epi32( upper_sum_256bit, _mm256_slli_epi32( previous_sum_256bit, 6 ) );
+
+		/* Add the 32-bit values of the sums horizontally
+		 */
+		lower_sum_128bit = _mm_add_epi32( _mm256_castsi256_si128( lower_sum_256bit ), _mm256_extracti128_si256( lower_sum_256bit, 1 ) );
+		upper_sum_128bit = _mm_add_epi32( _mm256_castsi256_si128( upper_sum_256bit ), _mm256_extracti128_si256( upper_sum_256bit, 1 ) );
+
+		lower_sum_128bit = _mm_add_epi32( lower_sum_128bit, _mm_shuffle_epi32( lower_sum_128bit, 0x4e ) );
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_shuffle_epi32( upper_sum_128bit, 0x4e ) );
+		upper_sum_128bit = _mm_add_epi32( upper_sum_128bit, _mm_shuffle_epi32( upper_sum_128bit, 0xb1 ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32( lower_sum_128bit );
+		upper_word += (uint32_t) _mm_cvtsi128_si32( upper_sum_128bit );
+
+		lower_word %= 0xffff;
+		upper_word %= 0xffff;
+
+		size -= block_size;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#endif /* defined( ASSORTED_FLETCHER32_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_FLETCHER32_HAVE_NEON )
+
+/* Calculates the Fletcher-32 of a buffer using NEON, 32 bytes per iteration
+ * The size must be a multiple of 32
+ * Returns the Fletcher-32 with the sums reduced modulo 65535
+ */
+uint32_t assorted_fletcher32_simd_neon(
+          uint32_t fletcher32,
+          const uint8_t *buffer,
+          size_t size )
+{
+	static const uint16_t multipliers[ 32 ] = {
+		32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+		16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+	uint32x4_t lower_sum_128bit;
+	uint32x4_t previous_sum_128bit;
+	uint32x4_t upper_sum_128bit;
+	uint16x8_t column_sum_128bit1;
+	uint16x8_t column_sum_128bit2;
+	uint16x8_t column_sum_128bit3;
+	uint16x8_t column_sum_128bit4;
+	uint16x8_t byte_sum_128bit;
+	uint8x16_t value_128bit1;
+	uint8x16_t value_128bit2;
+
+	size_t block_size   = 0;
+	size_t block_offset = 0;
+	uint32_t lower_word = fletcher32 & 0xffff;
+	uint32_t upper_word = ( fletcher32 >> 16 ) & 0xffff;
+
+	while( size > 0 )
+	{
+		block_size = size;
+
+		if( block_size > ASSORTED_FLETCHER32_SIMD_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_FLETCHER32_SIMD_BLOCK_SIZE;
+		}
+		/* Every byte of the block adds the lower word to the upper word
+		 */
+		upper_word += lower_word * (uint32_t) block_size;
+
+		lower_sum_128bit    = vdupq_n_u32( 0 );
+		previous_sum_128bit = vdupq_n_u32( 0 );
+		column_sum_128bit1  = vdupq_n_u16( 0 );
+		column_sum_128bit2  = vdupq_n_u16( 0 );
+		column_sum_128bit3  = vdupq_n_u16( 0 );
+		column_sum_128bit4  = vdupq_n_u16( 0 );
+
+		/* The column sums cannot overflow since at most 172 x 255 is added per block
+		 */
+		for( block_offset = 0;
+		     block_offset < block_size;
+		     block_offset += 32 )
+		{
+			value_128bit1 = vld1q_u8( buffer );
+			value_128bit2 = vld1q_u8( &( buffer[ 16 ] ) );
+
+			/* Every 32 bytes add the lower sum of the previous iterations to the upper sum
+			 */
+			previous_sum_128bit = vaddq_u32( previous_sum_128bit, lower_sum_128bit );
+
+			byte_sum_128bit  = vpaddlq_u8( value_128bit1 );
+			byte_sum_128bit  = vpadalq_u8( byte_sum_128bit, value_128bit2 );
+			lower_sum_128bit = vpadalq_u16( lower_sum_128bit, byte_sum_128bit );
+
+			column_sum_128bit1 = vaddw_u8( column_sum_128bit1, vget_low_u8( value_128bit1 ) );
+			column_sum_128bit2 = vaddw_u8( column_sum_128bit2, vget_high_u8( value_128bit1 ) );
+			column_sum_128bit3 = vaddw_u8( column_sum_128bit3, vget_low_u8( value_128bit2 ) );
+			column_sum_128bit4 = vaddw_u8( column_sum_128bit4, vget_high_u8( value_128bit2 ) );
+
+			buffer += 32;
+		}
+		upper_sum_128bit = vshlq_n_u32( previous_sum_128bit, 5 );
+
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_low_u16( column_sum_128bit1 ), vld1_u16( &( multipliers[ 0 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_high_u16( column_sum_128bit1 ), vld1_u16( &( multipliers[ 4 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_low_u16( column_sum_128bit2 ), vld1_u16( &( multipliers[ 8 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_high_u16( column_sum_128bit2 ), vld1_u16( &( multipliers[ 12 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_low_u16( column_sum_128bit3 ), vld1_u16( &( multipliers[ 16 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_high_u16( column_sum_128bit3 ), vld1_u16( &( multipliers[ 20 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_low_u16( column_sum_128bit4 ), vld1_u16( &( multipliers[ 24 ] ) ) );
+		upper_sum_128bit = vmlal_u16( upper_sum_128bit, vget_high_u16( column_sum_128bit4 ), vld1_u16( &( multipliers[ 28 ] ) ) );
+
+		lower_word += vaddvq_u32( lower_sum_128bit );
+		upper_word += vaddvq_u32( upper_sum_128bit );
+
+		lower_word %= 0xffff;
+		upper_word %= 0xffff;
+
+		size -= block_size;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#endif /* defined( ASSORTED_FLETCHER32_HAVE_NEON ) */
+
+/* Calculates the Fletcher-32 of a buffer
+ * Uses the fastest SIMD kernel supported by the CPU, otherwise or for
+ * the remaining bytes a byte for byte calculation
+ * Like assorted_fletcher32_calculate the previous key is currently not used
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_fletcher32_calculate_simd(
+     uint32_t *fletcher32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t previous_key ASSORTED_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_fletcher32_calculate_simd";
+	size_t block_size     = 0;
+	size_t buffer_offset  = 0;
+	uint32_t lower_word   = 0;
+	uint32_t upper_word   = 0;
+
+#if defined( ASSORTED_FLETCHER32_HAVE_AVX2 ) || defined( ASSORTED_FLETCHER32_HAVE_NEON )
+	uint32_t cpu_features = 0;
+	uint32_t sums         = 0;
+#endif
+
+	ASSORTED_UNREFERENCED_PARAMETER( previous_key )
+
+	if( fletcher32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Fletcher-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	lower_word = 0xffff;
+	upper_word = 0xffff;
+
+#if defined( ASSORTED_FLETCHER32_HAVE_AVX2 )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		buffer_offset = size & ~( (size_t) 63 );
+
+		sums = assorted_fletcher32_simd_avx2(
+		        ( upper_word << 16 ) | lower_word,
+		        buffer,
+		        buffer_offset );
+
+		lower_word = sums & 0xffff;
+		upper_word = sums >> 16;
+	}
+#elif defined( ASSORTED_FLETCHER32_HAVE_NEON )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_NEON ) != 0 )
+	{
+		buffer_offset = size & ~( (size_t) 31 );
+
+		sums = assorted_fletcher32_simd_neon(
+		        ( upper_word << 16 ) | lower_word,
+		        buffer,
+		        buffer_offset );
+
+		lower_word = sums & 0xffff;
+		upper_word = sums >> 16;
+	}
+#endif
+	while( buffer_offset < size )
+	{
+		block_size = size - buffer_offset;
+
+		if( block_size > 360 )
+		{
+			block_size = 360;
+		}
+		while( block_size > 0 )
+		{
+			lower_word += buffer[ buffer_offset++ ];
+			upper_word += lower_word;
+
+			block_size--;
+		}
+		lower_word = ( lower_word & 0xffff ) + ( lower_word >> 16 );
+		upper_word = ( upper_word & 0xffff ) + ( upper_word >> 16 );
+	}
+	lower_word = ( lower_word & 0xffff ) + ( lower_word >> 16 );
+	upper_word = ( upper_word & 0xffff ) + ( upper_word >> 16 );
+
+	/* The sums start at 0xffff and never become 0, hence a sum that
+	 * the SIMD kernels reduced to 0 modulo 65535 is represented as 0xffff
+	 */
+	if( lower_word == 0 )
+	{
+		lower_word = 0xffff;
+	}
+	if( upper_word == 0 )
+	{
+		upper_word = 0xffff;
+	}
+	*fletcher32 = ( upper_word << 16 ) | lower_word;
+
+	return( 1 );
+}
+
+/* Combines the Fletcher-32 of two consecutive buffers
+ * The second Fletcher-32 must be calculated with a previous key of 0
+ * Since the sums are calculated modulo 65535 with an initial value of 0xffff,
+ * which is equivalent to 0, a sum that is 0 modulo 65535 is represented as 0xffff
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_fletcher32_combine(
+     uint32_t *fletcher32,
+     uint32_t first_fletcher32,
+     uint32_t second_fletcher32,
+     size64_t second_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_fletcher32_combine";
+	uint64_t lower_word   = 0;
+	uint64_t remainder    = 0;
+	uint64_t upper_word   = 0;
+
+	if( fletcher32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Fletcher-32.",
+		 function );
+
+		return( -1 );
+	}
+	/* The upper word of the second Fletcher-32 lacks the lower word of the first
+	 * Fletcher-32 added for every byte of the second buffer
+	 */
+	remainder = second_size % 0xffff;
+
+	lower_word = ( first_fletcher32 & 0xffff )
+	           + ( second_fletcher32 & 0xffff );
+
+	upper_word = ( ( first_fletcher32 >> 16 ) & 0xffff )
+	           + ( ( second_fletcher32 >> 16 ) & 0xffff )
+	           + ( remainder * ( first_fletcher32 & 0xffff ) );
+
+	lower_word %= 0xffff;
+	upper_word %= 0xffff;
+
+	if( lower_word == 0 )
+	{
+		lower_word = 0xffff;
+	}
+	if( upper_word == 0 )
+	{
+		upper_word = 0xffff;
+	}
+	*fletcher32 = (uint32_t) ( ( upper_word << 16 ) | lower_word );
+
+	return( 1 );
+}
+
@@ -31,6 +31,17 @@
 extern "C" {
 #endif
 
+/* The SIMD kernels are available with GCC compatible compilers on x86
+ * and on little-endian ARMv8, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __clang__ ) || ( __GNUC__ >= 5 ) )
+#define ASSORTED_FLETCHER32_HAVE_AVX2
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ )
+#define ASSORTED_FLETCHER32_HAVE_NEON
+
+#endif
+
 int assorted_fletcher32_calculate(
      uint32_t *fletcher32,
      const uint8_t *buffer,
@@ -38,6 +49,38 @@ int assorted_fletcher32_calculate(
      uint32_t previous_key,
      libcerror_error_t **error );
 
+#if defined( ASSORTED_FLETCHER32_HAVE_AVX2 )
+
+uint32_t assorted_fletcher32_simd_avx2(
+          uint32_t fletcher32,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_FLETCHER32_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_FLETCHER32_HAVE_NEON )
+
+uint32_t assorted_fletcher32_simd_neon(
+          uint32_t fletcher32,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_FLETCHER32_HAVE_NEON ) */
+
+int assorted_fletcher32_calculate_simd(
+     uint32_t *fletcher32,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t previous_key,
+     libcerror_error_t **error );
+
+int assorted_fletcher32_combine(
+     uint32_t *fletcher32,
+     uint32_t first_fletcher32,
+     uint32_t second_fletcher32,
+     size64_t second_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
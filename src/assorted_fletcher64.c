@@ -23,9 +23,24 @@
 #include <byte_stream.h>
 #include <types.h>
 
+#include "assorted_cpu_features.h"
 #include "assorted_fletcher64.h"
 #include "assorted_libcerror.h"
 
+#if defined( ASSORTED_FLETCHER64_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_FLETCHER64_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
+/* The number of bytes after which the modulo calculation is needed
+ * With sums below 2^32 at the start of a block the upper sum of
+ * a block of 32768 words remains below 2^62
+ */
+#define ASSORTED_FLETCHER64_BLOCK_SIZE	0x20000
+
 /* Calculates the Fletcher-64 of a buffer of data
  * Use a previous key of 0 to calculate a new Fletcher-64
  * Returns 1 if successful or -1 on error
@@ -38,6 +53,7 @@ int assorted_fletcher64_calculate(
      libcerror_error_t **error )
 {
 	static char *function = "assorted_fletcher64_calculate";
+	size_t block_size     = 0;
 	size_t data_offset    = 0;
 	uint64_t lower_32bit  = 0;
 	uint64_t upper_32bit  = 0;
@@ -90,9 +106,327 @@ int assorted_fletcher64_calculate(
 	lower_32bit = previous_key & 0xffffffffUL;
 	upper_32bit = ( previous_key >> 32 ) & 0xffffffffUL;
 
-        for( data_offset = 0;
-	     data_offset < data_size;
-	     data_offset += 4 )
+	while( data_offset < data_size )
+	{
+		/* The modulo calculation is needed before the upper sum can overflow
+		 */
+		block_size = data_size - data_offset;
+
+		if( block_size > ASSORTED_FLETCHER64_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_FLETCHER64_BLOCK_SIZE;
+		}
+		while( block_size > 0 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 value_32bit );
+
+			lower_32bit += value_32bit;
+			upper_32bit += lower_32bit;
+
+			data_offset += 4;
+			block_size  -= 4;
+		}
+		lower_32bit %= 0xffffffffUL;
+		upper_32bit %= 0xffffffffUL;
+	}
+	lower_32bit %= 0xffffffffUL;
+	upper_32bit %= 0xffffffffUL;
+
+	*fletcher64 = ( upper_32bit << 32 ) | lower_32bit;
+
+	return( 1 );
+}
+
+#if defined( ASSORTED_FLETCHER64_HAVE_AVX2 )
+
+/* Calculates the Fletcher-64 of a buffer of data using AVX2, 8 words per iteration
+ * The data size must be a multiple of 32
+ * Returns the Fletcher-64 with the sums reduced modulo 0xffffffff
+ */
+__attribute__ ((target ("avx2"))) uint64_t assorted_fletcher64_simd_avx2(
+                                            uint64_t fletcher64,
+                                            const uint8_t *data,
+                                            size_t data_size )
+{
+	uint64_t lower_sums[ 8 ];
+	uint64_t previous_sums[ 4 ];
+
+	__m256i lower_sum_256bit1;
+	__m256i lower_sum_256bit2;
+	__m256i previous_sum_256bit1;
+	__m256i previous_sum_256bit2;
+	__m256i value_256bit1;
+	__m256i value_256bit2;
+
+	size_t block_size    = 0;
+	size_t block_offset  = 0;
+	uint64_t lower_32bit = fletcher64 & 0xffffffffUL;
+	uint64_t upper_32bit = ( fletcher64 >> 32 ) & 0xffffffffUL;
+	uint8_t word_index   = 0;
+
+	while( data_size > 0 )
+	{
+		block_size = data_size;
+
+		if( block_size > ASSORTED_FLETCHER64_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_FLETCHER64_BLOCK_SIZE;
+		}
+		/* Every word of the block adds the lower sum to the upper sum
+		 */
+		upper_32bit += lower_32bit * (uint64_t) ( block_size / 4 );
+
+		lower_sum_256bit1    = _mm256_setzero_si256();
+		lower_sum_256bit2    = _mm256_setzero_si256();
+		previous_sum_256bit1 = _mm256_setzero_si256();
+		previous_sum_256bit2 = _mm256_setzero_si256();
+
+		for( block_offset = 0;
+		     block_offset < block_size;
+		     block_offset += 32 )
+		{
+			value_256bit1 = _mm256_cvtepu32_epi64( _mm_loadu_si128( (const __m128i *) data ) );
+			value_256bit2 = _mm256_cvtepu32_epi64( _mm_loadu_si128( (const __m128i *) &( data[ 16 ] ) ) );
+
+			/* Every 8 words add the lower sums of the previous iterations to the upper sum
+			 */
+			previous_sum_256bit1 = _mm256_add_epi64( previous_sum_256bit1, lower_sum_256bit1 );
+			previous_sum_256bit2 = _mm256_add_epi64( previous_sum_256bit2, lower_sum_256bit2 );
+
+			lower_sum_256bit1 = _mm256_add_epi64( lower_sum_256bit1, value_256bit1 );
+			lower_sum_256bit2 = _mm256_add_epi64( lower_sum_256bit2, value_256bit2 );
+
+			data += 32;
+		}
+		previous_sum_256bit1 = _mm256_add_epi64( previous_sum_256bit1, previous_sum_256bit2 );
+		previous_sum_256bit1 = _mm256_slli_epi64( previous_sum_256bit1, 3 );
+
+		_mm256_storeu_si256( (__m256i *) previous_sums, previous_sum_256bit1 );
+		_mm256_storeu_si256( (__m256i *) &( lower_sums[ 0 ] ), lower_sum_256bit1 );
+		_mm256_storeu_si256( (__m256i *) &( lower_sums[ 4 ] ), lower_sum_256bit2 );
+
+		upper_32bit += previous_sums[ 0 ] + previous_sums[ 1 ] + previous_sums[ 2 ] + previous_sums[ 3 ];
+
+		/* Word 0 to 7 of the last iteration add their value 8 to 1 times to the upper sum
+		 */
+		for( word_index = 0;
+		     word_index < 8;
+		     word_index++ )
+		{
+			lower_32bit += lower_sums[ word_index ];
+			upper_32bit += lower_sums[ word_index ] * (uint64_t) ( 8 - word_index );
+		}
+		lower_32bit %= 0xffffffffUL;
+		upper_32bit %= 0xffffffffUL;
+
+		data_size -= block_size;
+	}
+	return( ( upper_32bit << 32 ) | lower_32bit );
+}
+
+#endif /* defined( ASSORTED_FLETCHER64_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_FLETCHER64_HAVE_NEON )
+
+/* Calculates the Fletcher-64 of a buffer of data using NEON, 8 words per iteration
+ * The data size must be a multiple of 32
+ * Returns the Fletcher-64 with the sums reduced modulo 0xffffffff
+ */
+uint64_t assorted_fletcher64_simd_neon(
+          uint64_t fletcher64,
+          const uint8_t *data,
+          size_t data_size )
+{
+	uint64x2_t lower_sum_128bit1;
+	uint64x2_t lower_sum_128bit2;
+	uint64x2_t lower_sum_128bit3;
+	uint64x2_t lower_sum_128bit4;
+	uint64x2_t previous_sum_128bit1;
+	uint64x2_t previous_sum_128bit2;
+	uint64x2_t previous_sum_128bit3;
+	uint64x2_t previous_sum_128bit4;
+	uint32x4_t value_128bit1;
+	uint32x4_t value_128bit2;
+
+	size_t block_size    = 0;
+	size_t block_offset  = 0;
+	uint64_t lower_32bit = fletcher64 & 0xffffffffUL;
+	uint64_t upper_32bit = ( fletcher64 >> 32 ) & 0xffffffffUL;
+
+	while( data_size > 0 )
+	{
+		block_size = data_size;
+
+		if( block_size > ASSORTED_FLETCHER64_BLOCK_SIZE )
+		{
+			block_size = ASSORTED_FLETCHER64_BLOCK_SIZE;
+		}
+		/* Every word of the block adds the lower sum to the upper sum
+		 */
+		upper_32bit += lower_32bit * (uint64_t) ( block_size / 4 );
+
+		lower_sum_128bit1    = vdupq_n_u64( 0 );
+		lower_sum_128bit2    = vdupq_n_u64( 0 );
+		lower_sum_128bit3    = vdupq_n_u64( 0 );
+		lower_sum_128bit4    = vdupq_n_u64( 0 );
+		previous_sum_128bit1 = vdupq_n_u64( 0 );
+		previous_sum_128bit2 = vdupq_n_u64( 0 );
+		previous_sum_128bit3 = vdupq_n_u64( 0 );
+		previous_sum_128bit4 = vdupq_n_u64( 0 );
+
+		for( block_offset = 0;
+		     block_offset < block_size;
+		     block_offset += 32 )
+		{
+			value_128bit1 = vld1q_u32( (const uint32_t *) data );
+			value_128bit2 = vld1q_u32( (const uint32_t *) &( data[ 16 ] ) );
+
+			/* Every 8 words add the lower sums of the previous iterations to the upper sum
+			 */
+			previous_sum_128bit1 = vaddq_u64( previous_sum_128bit1, lower_sum_128bit1 );
+			previous_sum_128bit2 = vaddq_u64( previous_sum_128bit2, lower_sum_128bit2 );
+			previous_sum_128bit3 = vaddq_u64( previous_sum_128bit3, lower_sum_128bit3 );
+			previous_sum_128bit4 = vaddq_u64( previous_sum_128bit4, lower_sum_128bit4 );
+
+			lower_sum_128bit1 = vaddw_u32( lower_sum_128bit1, vget_low_u32( value_128bit1 ) );
+			lower_sum_128bit2 = vaddw_u32( lower_sum_128bit2, vget_high_u32( value_128bit1 ) );
+			lower_sum_128bit3 = vaddw_u32( lower_sum_128bit3, vget_low_u32( value_128bit2 ) );
+			lower_sum_128bit4 = vaddw_u32( lower_sum_128bit4, vget_high_u32( value_128bit2 ) );
+
+			data += 32;
+		}
+		previous_sum_128bit1 = vaddq_u64( previous_sum_128bit1, previous_sum_128bit2 );
+		previous_sum_128bit3 = vaddq_u64( previous_sum_128bit3, previous_sum_128bit4 );
+		previous_sum_128bit1 = vaddq_u64( previous_sum_128bit1, previous_sum_128bit3 );
+
+		upper_32bit += vaddvq_u64( previous_sum_128bit1 ) << 3;
+
+		/* Word 0 to 7 of the last iteration add their value 8 to 1 times to the upper sum
+		 */
+		lower_32bit += vaddvq_u64( lower_sum_128bit1 )
+		             + vaddvq_u64( lower_sum_128bit2 )
+		             + vaddvq_u64( lower_sum_128bit3 )
+		             + vaddvq_u64( lower_sum_128bit4 );
+
+		upper_32bit += ( vgetq_lane_u64( lower_sum_128bit1, 0 ) * 8 )
+		             + ( vgetq_lane_u64( lower_sum_128bit1, 1 ) * 7 )
+		             + ( vgetq_lane_u64( lower_sum_128bit2, 0 ) * 6 )
+		             + ( vgetq_lane_u64( lower_sum_128bit2, 1 ) * 5 )
+		             + ( vgetq_lane_u64( lower_sum_128bit3, 0 ) * 4 )
+		             + ( vgetq_lane_u64( lower_sum_128bit3, 1 ) * 3 )
+		             + ( vgetq_lane_u64( lower_sum_128bit4, 0 ) * 2 )
+		             + vgetq_lane_u64( lower_sum_128bit4, 1 );
+
+		lower_32bit %= 0xffffffffUL;
+		upper_32bit %= 0xffffffffUL;
+
+		data_size -= block_size;
+	}
+	return( ( upper_32bit << 32 ) | lower_32bit );
+}
+
+#endif /* defined( ASSORTED_FLETCHER64_HAVE_NEON ) */
+
+/* Calculates the Fletcher-64 of a buffer of data
+ * Uses the fastest SIMD kernel supported by the CPU, otherwise or for
+ * the remaining words a word for word calculation
+ * Use a previous key of 0 to calculate a new Fletcher-64
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_fletcher64_calculate_simd(
+     uint64_t *fletcher64,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t previous_key,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_fletcher64_calculate_simd";
+	size_t data_offset    = 0;
+	uint64_t lower_32bit  = 0;
+	uint64_t upper_32bit  = 0;
+	uint32_t value_32bit  = 0;
+
+#if defined( ASSORTED_FLETCHER64_HAVE_AVX2 ) || defined( ASSORTED_FLETCHER64_HAVE_NEON )
+	uint32_t cpu_features = 0;
+#endif
+
+	if( fletcher64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Fletcher-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size % 4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( ASSORTED_FLETCHER64_HAVE_AVX2 )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		data_offset = data_size & ~( (size_t) 31 );
+
+		previous_key = assorted_fletcher64_simd_avx2(
+		                previous_key,
+		                data,
+		                data_offset );
+	}
+#elif defined( ASSORTED_FLETCHER64_HAVE_NEON )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_NEON ) != 0 )
+	{
+		data_offset = data_size & ~( (size_t) 31 );
+
+		previous_key = assorted_fletcher64_simd_neon(
+		                previous_key,
+		                data,
+		                data_offset );
+	}
+#endif
+	lower_32bit = previous_key & 0xffffffffUL;
+	upper_32bit = ( previous_key >> 32 ) & 0xffffffffUL;
+
+	/* At most 7 words remain, which cannot overflow the sums
+	 */
+	while( data_offset < data_size )
 	{
 		byte_stream_copy_to_uint32_little_endian(
 		 &( data[ data_offset ] ),
@@ -100,6 +434,8 @@ int assorted_fletcher64_calculate(
 
 		lower_32bit += value_32bit;
 		upper_32bit += lower_32bit;
+
+		data_offset += 4;
 	}
 	lower_32bit %= 0xffffffffUL;
 	upper_32bit %= 0xffffffffUL;
@@ -109,3 +445,65 @@ int assorted_fletcher64_calculate(
 	return( 1 );
 }
 
+/* Combines the Fletcher-64 of two consecutive buffers of data
+ * The second Fletcher-64 must be calculated with a previous key of 0
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_fletcher64_combine(
+     uint64_t *fletcher64,
+     uint64_t first_fletcher64,
+     uint64_t second_fletcher64,
+     size64_t second_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_fletcher64_combine";
+	uint64_t first_lower  = 0;
+	uint64_t lower_32bit  = 0;
+	uint64_t remainder    = 0;
+	uint64_t upper_32bit  = 0;
+
+	if( fletcher64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Fletcher-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( second_data_size % 4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid second data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The upper 32-bit of the second Fletcher-64 lacks the lower 32-bit of the first
+	 * Fletcher-64 added for every 32-bit value of the second data
+	 */
+	remainder   = ( second_data_size / 4 ) % 0xffffffffUL;
+	first_lower = ( first_fletcher64 & 0xffffffffUL ) % 0xffffffffUL;
+
+	lower_32bit = first_lower
+	            + ( ( second_fletcher64 & 0xffffffffUL ) % 0xffffffffUL );
+
+	upper_32bit = ( ( ( first_fletcher64 >> 32 ) & 0xffffffffUL ) % 0xffffffffUL )
+	            + ( ( ( second_fletcher64 >> 32 ) & 0xffffffffUL ) % 0xffffffffUL );
+
+	upper_32bit %= 0xffffffffUL;
+	upper_32bit += ( remainder * first_lower ) % 0xffffffffUL;
+
+	lower_32bit %= 0xffffffffUL;
+	upper_32bit %= 0xffffffffUL;
+
+	*fletcher64 = ( upper_32bit << 32 ) | lower_32bit;
+
+	return( 1 );
+}
+
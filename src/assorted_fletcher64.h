@@ -31,6 +31,17 @@
 extern "C" {
 #endif
 
+/* The SIMD kernels are available with GCC compatible compilers on x86
+ * and on little-endian ARMv8, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __clang__ ) || ( __GNUC__ >= 5 ) )
+#define ASSORTED_FLETCHER64_HAVE_AVX2
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ )
+#define ASSORTED_FLETCHER64_HAVE_NEON
+
+#endif
+
 int assorted_fletcher64_calculate(
      uint64_t *fletcher64,
      const uint8_t *buffer,
@@ -38,6 +49,38 @@ int assorted_fletcher64_calculate(
      uint64_t previous_key,
      libcerror_error_t **error );
 
+#if defined( ASSORTED_FLETCHER64_HAVE_AVX2 )
+
+uint64_t assorted_fletcher64_simd_avx2(
+          uint64_t fletcher64,
+          const uint8_t *data,
+          size_t data_size );
+
+#endif /* defined( ASSORTED_FLETCHER64_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_FLETCHER64_HAVE_NEON )
+
+uint64_t assorted_fletcher64_simd_neon(
+          uint64_t fletcher64,
+          const uint8_t *data,
+          size_t data_size );
+
+#endif /* defined( ASSORTED_FLETCHER64_HAVE_NEON ) */
+
+int assorted_fletcher64_calculate_simd(
+     uint64_t *fletcher64,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t previous_key,
+     libcerror_error_t **error );
+
+int assorted_fletcher64_combine(
+     uint64_t *fletcher64,
+     uint64_t first_fletcher64,
+     uint64_t second_fletcher64,
+     size64_t second_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "assorted_arena.h"
 #include "assorted_bit_stream.h"
 #include "assorted_huffman_tree.h"
 #include "assorted_libcerror.h"
@@ -38,7 +39,29 @@ int assorted_huffman_tree_initialize(
      uint8_t maximum_code_size,
      libcerror_error_t **error )
 {
-	static char *function = "assorted_huffman_tree_initialize";
+	return( assorted_huffman_tree_initialize_with_arena(
+	         huffman_tree,
+	         number_of_symbols,
+	         maximum_code_size,
+	         NULL,
+	         error ) );
+}
+
+/* Creates a Huffman tree of which the memory is allocated from an arena
+ * If arena is NULL the memory is allocated separately
+ * The memory of a tree allocated from an arena is released with the arena,
+ * not by assorted_huffman_tree_free
+ * Make sure the value huffman_tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_huffman_tree_initialize_with_arena(
+     assorted_huffman_tree_t **huffman_tree,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_huffman_tree_initialize_with_arena";
 	size_t array_size     = 0;
 
 	if( huffman_tree == NULL )
@@ -86,9 +109,22 @@ int assorted_huffman_tree_initialize(
 
 		return( -1 );
 	}
-	*huffman_tree = memory_allocate_structure(
-	                 assorted_huffman_tree_t );
-
+	if( arena != NULL )
+	{
+		if( assorted_arena_allocate(
+		     arena,
+		     sizeof( assorted_huffman_tree_t ),
+		     (void **) huffman_tree,
+		     error ) != 1 )
+		{
+			*huffman_tree = NULL;
+		}
+	}
+	else
+	{
+		*huffman_tree = memory_allocate_structure(
+		                 assorted_huffman_tree_t );
+	}
 	if( *huffman_tree == NULL )
 	{
 		libcerror_error_set(
@@ -112,18 +148,35 @@ int assorted_huffman_tree_initialize(
 		 "%s: unable to clear Huffman tree.",
 		 function );
 
-		memory_free(
-		 *huffman_tree );
-
+		if( arena == NULL )
+		{
+			memory_free(
+			 *huffman_tree );
+		}
 		*huffman_tree = NULL;
 
 		return( -1 );
 	}
-	array_size = sizeof( uint16_t ) * number_of_symbols;
+	( *huffman_tree )->arena = arena;
 
-	( *huffman_tree )->symbols = (uint16_t *) memory_allocate(
-	                                           array_size );
+	array_size = sizeof( uint16_t ) * number_of_symbols;
 
+	if( arena != NULL )
+	{
+		if( assorted_arena_allocate(
+		     arena,
+		     array_size,
+		     (void **) &( ( *huffman_tree )->symbols ),
+		     error ) != 1 )
+		{
+			( *huffman_tree )->symbols = NULL;
+		}
+	}
+	else
+	{
+		( *huffman_tree )->symbols = (uint16_t *) memory_allocate(
+		                                           array_size );
+	}
 	if( ( *huffman_tree )->symbols == NULL )
 	{
 		libcerror_error_set(
@@ -151,9 +204,22 @@ int assorted_huffman_tree_initialize(
 	}
 	array_size = sizeof( int ) * ( maximum_code_size + 1 );
 
-	( *huffman_tree )->code_size_counts = (int *) memory_allocate(
-	                                               array_size );
-
+	if( arena != NULL )
+	{
+		if( assorted_arena_allocate(
+		     arena,
+		     array_size,
+		     (void **) &( ( *huffman_tree )->code_size_counts ),
+		     error ) != 1 )
+		{
+			( *huffman_tree )->code_size_counts = NULL;
+		}
+	}
+	else
+	{
+		( *huffman_tree )->code_size_counts = (int *) memory_allocate(
+		                                               array_size );
+	}
 	if( ( *huffman_tree )->code_size_counts == NULL )
 	{
 		libcerror_error_set(
@@ -179,12 +245,14 @@ int assorted_huffman_tree_initialize(
 
 		goto on_error;
 	}
-	( *huffman_tree )->maximum_code_size = maximum_code_size;
+	( *huffman_tree )->maximum_code_size     = maximum_code_size;
+	( *huffman_tree )->number_of_symbol_bits = 24;
 
 	return( 1 );
 
 on_error:
-	if( *huffman_tree != NULL )
+	if( ( *huffman_tree != NULL )
+	 && ( arena == NULL ) )
 	{
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
@@ -198,9 +266,9 @@ on_error:
 		}
 		memory_free(
 		 *huffman_tree );
-
-		*huffman_tree = NULL;
 	}
+	*huffman_tree = NULL;
+
 	return( -1 );
 }
 
@@ -224,8 +292,14 @@ int assorted_huffman_tree_free(
 
 		return( -1 );
 	}
-	if( *huffman_tree != NULL )
+	if( ( *huffman_tree != NULL )
+	 && ( ( *huffman_tree )->arena == NULL ) )
 	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -238,9 +312,101 @@ int assorted_huffman_tree_free(
 		}
 		memory_free(
 		 *huffman_tree );
+	}
+	*huffman_tree = NULL;
 
-		*huffman_tree = NULL;
+	return( 1 );
+}
+
+/* Sets the values that are stored alongside the symbols in the lookup table entries
+ * The value of a symbol is stored above the number of symbol bits, which allows
+ * a decoder to retrieve additional information of a symbol, such as the base
+ * and number of extra bits of a match size, from the entry of its Huffman code
+ * Symbols retrieved from the tree do not contain the value
+ * Returns 1 on success or -1 on error
+ */
+int assorted_huffman_tree_set_symbol_values(
+     assorted_huffman_tree_t *huffman_tree,
+     const uint32_t *symbol_values,
+     int number_of_symbol_values,
+     uint8_t number_of_symbol_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_huffman_tree_set_symbol_values";
+	int symbol            = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_symbol_bits == 0 )
+	 || ( number_of_symbol_bits > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbol bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_symbol_values < 0 )
+	 || ( number_of_symbol_values > ( 1 << number_of_symbol_bits ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbol values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The symbol and its value are stored in the 24-bit value of an entry
+	 */
+	for( symbol = 0;
+	     symbol < number_of_symbol_values;
+	     symbol++ )
+	{
+		if( ( symbol_values[ symbol ] >> ( 24 - number_of_symbol_bits ) ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %d value out of bounds.",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
 	}
+	/* The lookup table needs to be rebuilt for the new entries
+	 */
+	huffman_tree->lookup_table_storage_type = ASSORTED_BIT_STREAM_STORAGE_TYPE_UNKNOWN;
+	huffman_tree->symbol_values             = symbol_values;
+	huffman_tree->number_of_symbol_values   = number_of_symbol_values;
+	huffman_tree->number_of_symbol_bits     = number_of_symbol_bits;
+
 	return( 1 );
 }
 
@@ -253,7 +419,8 @@ int assorted_huffman_tree_build(
      int number_of_code_sizes,
      libcerror_error_t **error )
 {
-	int *symbol_offsets   = NULL;
+	int symbol_offsets[ 33 ];
+
 	static char *function = "assorted_huffman_tree_build";
 	size_t array_size     = 0;
 	uint16_t symbol       = 0;
@@ -296,6 +463,23 @@ int assorted_huffman_tree_build(
 
 		return( -1 );
 	}
+	if( ( huffman_tree->symbol_values != NULL )
+	 && ( number_of_code_sizes > huffman_tree->number_of_symbol_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of code sizes value exceeds number of symbol values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The lookup table needs to be rebuilt for the new code sizes
+	 */
+	huffman_tree->lookup_table_storage_type = ASSORTED_BIT_STREAM_STORAGE_TYPE_UNKNOWN;
+	huffman_tree->largest_code_size         = 0;
+
 	/* Determine the code size frequencies
 	 */
 	array_size = sizeof( int ) * ( huffman_tree->maximum_code_size + 1 );
@@ -334,6 +518,11 @@ int assorted_huffman_tree_build(
 			goto on_error;
 		}
 		huffman_tree->code_size_counts[ code_size ] += 1;
+
+		if( code_size > huffman_tree->largest_code_size )
+		{
+			huffman_tree->largest_code_size = code_size;
+		}
 	}
 	/* The tree has no codes
 	 */
@@ -377,20 +566,6 @@ int assorted_huffman_tree_build(
 		goto on_error;
 	}
 */
-	symbol_offsets = (int *) memory_allocate(
-	                          array_size );
-
-	if( symbol_offsets == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create symbol offsets.",
-		 function );
-
-		goto on_error;
-	}
 	/* Calculate the offsets to sort the symbols per code size
 	 */
 	symbol_offsets[ 0 ] = 0;
@@ -434,124 +609,1399 @@ int assorted_huffman_tree_build(
 
 		huffman_tree->symbols[ code_offset ] = symbol;
 	}
-	memory_free(
-	 symbol_offsets );
-
 	return( 1 );
 
 on_error:
-	if( symbol_offsets != NULL )
+	return( -1 );
+}
+
+/* Reverses the order of the bits of a Huffman code
+ * Returns the reversed Huffman code
+ */
+uint32_t assorted_huffman_tree_reverse_code(
+          uint32_t huffman_code,
+          uint8_t code_size )
+{
+	uint32_t reversed_code = 0;
+
+	while( code_size > 0 )
 	{
-		memory_free(
-		 symbol_offsets );
+		reversed_code <<= 1;
+		reversed_code  |= huffman_code & 0x00000001UL;
+		huffman_code   >>= 1;
+
+		code_size--;
 	}
-	return( -1 );
+	return( reversed_code );
 }
 
-/* Retrieves a symbol based on the Huffman code read from the bit-stream
+/* Builds the code sizes of a length limited Huffman code from the symbol frequencies
+ * The code sizes are determined in-place without allocating memory
+ * Symbols with a frequency of 0 get a code size of 0, if less than 2 symbols
+ * are used additional symbols are assigned a code size of 1 to keep the code complete
  * Returns 1 on success or -1 on error
  */
-int assorted_huffman_tree_get_symbol_from_bit_stream(
-     assorted_huffman_tree_t *huffman_tree,
-     assorted_bit_stream_t *bit_stream,
-     uint16_t *symbol,
+int assorted_huffman_tree_build_code_sizes(
+     const uint32_t *frequencies,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     uint8_t *code_sizes,
      libcerror_error_t **error )
 {
-	static char *function  = "assorted_huffman_tree_get_symbol_from_bit_stream";
-	uint32_t value_32bit   = 0;
-	uint16_t safe_symbol   = 0;
-	uint8_t bit_index      = 0;
-	int code_size_count    = 0;
-	int first_huffman_code = 0;
-	int first_index        = 0;
-	int huffman_code       = 0;
-	int result             = 0;
-
-	if( huffman_tree == NULL )
+	uint32_t weights[ 1024 ];
+	uint16_t sorted_symbols[ 1024 ];
+
+	const int shell_sort_gaps[ 8 ] = { 701, 301, 132, 57, 23, 10, 4, 1 };
+
+	static char *function       = "assorted_huffman_tree_build_code_sizes";
+	uint64_t code_space         = 0;
+	uint64_t maximum_code_space = 0;
+	uint32_t frequency          = 0;
+	uint16_t symbol             = 0;
+	int available_nodes         = 0;
+	int depth                   = 0;
+	int gap                     = 0;
+	int gap_index               = 0;
+	int leaf_index              = 0;
+	int next_index              = 0;
+	int number_of_used_symbols  = 0;
+	int root_index              = 0;
+	int sorted_index            = 0;
+	int symbol_index            = 0;
+	int used_nodes              = 0;
+
+	if( frequencies == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid Huffman tree.",
+		 "%s: invalid frequencies.",
 		 function );
 
 		return( -1 );
 	}
-	if( bit_stream == NULL )
+	if( ( number_of_symbols < 2 )
+	 || ( number_of_symbols > 1024 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bit stream.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( symbol == NULL )
+	if( ( maximum_code_size == 0 )
+	 || ( maximum_code_size > 31 )
+	 || ( ( (uint32_t) 1 << maximum_code_size ) < (uint32_t) number_of_symbols ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid symbol.",
+		 "%s: invalid code sizes.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO get maximum_code_size of bits into local bit buffer */
+	for( symbol_index = 0;
+	     symbol_index < number_of_symbols;
+	     symbol_index++ )
+	{
+		code_sizes[ symbol_index ] = 0;
 
-	for( bit_index = 1;
-	     bit_index <= huffman_tree->maximum_code_size;
-	     bit_index++ )
+		if( frequencies[ symbol_index ] != 0 )
+		{
+			sorted_symbols[ number_of_used_symbols++ ] = (uint16_t) symbol_index;
+		}
+	}
+	if( number_of_used_symbols < 2 )
 	{
-		if( assorted_bit_stream_get_value(
-		     bit_stream,
-		     1,
-		     &value_32bit,
-		     error ) != 1 )
+		if( number_of_used_symbols == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from bit stream.",
-			 function );
+			code_sizes[ 0 ] = 1;
+			code_sizes[ 1 ] = 1;
+		}
+		else
+		{
+			symbol = sorted_symbols[ 0 ];
+
+			code_sizes[ symbol ] = 1;
+
+			if( symbol == 0 )
+			{
+				code_sizes[ 1 ] = 1;
+			}
+			else
+			{
+				code_sizes[ 0 ] = 1;
+			}
+		}
+		return( 1 );
+	}
+	/* Sort the used symbols by ascending frequency
+	 */
+	for( gap_index = 0;
+	     gap_index < 8;
+	     gap_index++ )
+	{
+		gap = shell_sort_gaps[ gap_index ];
 
-			return( -1 );
+		for( sorted_index = gap;
+		     sorted_index < number_of_used_symbols;
+		     sorted_index++ )
+		{
+			symbol    = sorted_symbols[ sorted_index ];
+			frequency = frequencies[ symbol ];
+
+			for( symbol_index = sorted_index;
+			     symbol_index >= gap;
+			     symbol_index -= gap )
+			{
+				if( frequencies[ sorted_symbols[ symbol_index - gap ] ] <= frequency )
+				{
+					break;
+				}
+				sorted_symbols[ symbol_index ] = sorted_symbols[ symbol_index - gap ];
+			}
+			sorted_symbols[ symbol_index ] = symbol;
 		}
-		huffman_code <<= 1;
-		huffman_code  |= (int) value_32bit;
+	}
+	for( sorted_index = 0;
+	     sorted_index < number_of_used_symbols;
+	     sorted_index++ )
+	{
+		weights[ sorted_index ] = frequencies[ sorted_symbols[ sorted_index ] ];
+	}
+	/* Determine the code sizes in-place using the algorithm of Moffat and Katajainen
+	 * The first pass combines the weights and sets the parent indexes of the internal nodes
+	 */
+	weights[ 0 ] += weights[ 1 ];
 
-		code_size_count = huffman_tree->code_size_counts[ bit_index ];
+	root_index = 0;
+	leaf_index = 2;
 
-		if( ( huffman_code - code_size_count ) < first_huffman_code )
+	for( next_index = 1;
+	     next_index < ( number_of_used_symbols - 1 );
+	     next_index++ )
+	{
+		if( ( leaf_index >= number_of_used_symbols )
+		 || ( weights[ root_index ] < weights[ leaf_index ] ) )
+		{
+			weights[ next_index ]   = weights[ root_index ];
+			weights[ root_index++ ] = (uint32_t) next_index;
+		}
+		else
 		{
-			safe_symbol = huffman_tree->symbols[ first_index + ( huffman_code - first_huffman_code ) ];
+			weights[ next_index ] = weights[ leaf_index++ ];
+		}
+		if( ( leaf_index >= number_of_used_symbols )
+		 || ( ( root_index < next_index )
+		  &&  ( weights[ root_index ] < weights[ leaf_index ] ) ) )
+		{
+			weights[ next_index ]  += weights[ root_index ];
+			weights[ root_index++ ] = (uint32_t) next_index;
+		}
+		else
+		{
+			weights[ next_index ] += weights[ leaf_index++ ];
+		}
+	}
+	/* The second pass determines the depths of the internal nodes
+	 */
+	weights[ number_of_used_symbols - 2 ] = 0;
+
+	for( next_index = number_of_used_symbols - 3;
+	     next_index >= 0;
+	     next_index-- )
+	{
+		weights[ next_index ] = weights[ weights[ next_index ] ] + 1;
+	}
+	/* The third pass determines the depths of the leaf nodes, which are the code sizes
+	 */
+	available_nodes = 1;
+	depth           = 0;
+	root_index      = number_of_used_symbols - 2;
+	next_index      = number_of_used_symbols - 1;
+
+	while( available_nodes > 0 )
+	{
+		used_nodes = 0;
 
-			result = 1;
+		while( ( root_index >= 0 )
+		    && ( weights[ root_index ] == (uint32_t) depth ) )
+		{
+			used_nodes++;
+			root_index--;
+		}
+		while( available_nodes > used_nodes )
+		{
+			weights[ next_index-- ] = (uint32_t) depth;
 
-			break;
+			available_nodes--;
 		}
-		first_huffman_code  += code_size_count;
-		first_huffman_code <<= 1;
-		first_index         += code_size_count;
+		available_nodes = 2 * used_nodes;
+
+		depth++;
 	}
-	if( result != 1 )
+	/* Limit the code sizes to the maximum code size, the least frequent symbols
+	 * have the largest code sizes and are stored first
+	 */
+	if( weights[ 0 ] > maximum_code_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
-		 function,
-		 huffman_code );
+		maximum_code_space = (uint64_t) 1 << maximum_code_size;
+		code_space         = 0;
 
-		return( -1 );
-	}
-	*symbol = safe_symbol;
+		for( sorted_index = 0;
+		     sorted_index < number_of_used_symbols;
+		     sorted_index++ )
+		{
+			if( weights[ sorted_index ] > maximum_code_size )
+			{
+				weights[ sorted_index ] = maximum_code_size;
+			}
+			code_space += (uint64_t) 1 << ( maximum_code_size - weights[ sorted_index ] );
+		}
+		/* Lengthen the codes of the least frequent symbols until the code is no longer oversubscribed
+		 */
+		sorted_index = 0;
+
+		while( code_space > maximum_code_space )
+		{
+			while( weights[ sorted_index ] >= maximum_code_size )
+			{
+				sorted_index++;
+			}
+			weights[ sorted_index ] += 1;
+
+			code_space -= (uint64_t) 1 << ( maximum_code_size - weights[ sorted_index ] );
+		}
+		/* Shorten the codes of the most frequent symbols while that keeps the code complete
+		 */
+		for( sorted_index = number_of_used_symbols - 1;
+		     sorted_index >= 0;
+		     sorted_index-- )
+		{
+			while( ( weights[ sorted_index ] > 1 )
+			    && ( ( code_space + ( (uint64_t) 1 << ( maximum_code_size - weights[ sorted_index ] ) ) ) <= maximum_code_space ) )
+			{
+				code_space += (uint64_t) 1 << ( maximum_code_size - weights[ sorted_index ] );
 
+				weights[ sorted_index ] -= 1;
+			}
+		}
+	}
+	for( sorted_index = 0;
+	     sorted_index < number_of_used_symbols;
+	     sorted_index++ )
+	{
+		code_sizes[ sorted_symbols[ sorted_index ] ] = (uint8_t) weights[ sorted_index ];
+	}
 	return( 1 );
 }
 
+/* Builds the canonical Huffman codes from the code sizes
+ * For a back to front bit stream the codes are stored bit reversed,
+ * so they can be written least significant bit first
+ * Returns 1 on success or -1 on error
+ */
+int assorted_huffman_tree_build_codes(
+     const uint8_t *code_sizes,
+     int number_of_symbols,
+     uint8_t storage_type,
+     uint32_t *codes,
+     libcerror_error_t **error )
+{
+	int code_size_counts[ 32 ];
+	uint32_t next_codes[ 32 ];
+
+	static char *function = "assorted_huffman_tree_build_codes";
+	uint32_t code         = 0;
+	uint8_t code_size     = 0;
+	int symbol            = 0;
+
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_symbols < 0 )
+	 || ( number_of_symbols > 1024 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported storage type.",
+		 function );
+
+		return( -1 );
+	}
+	if( codes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_size_counts,
+	     0,
+	     sizeof( int ) * 32 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size > 31 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %d code size: %" PRIu8 " value out of bounds.",
+			 function,
+			 symbol,
+			 code_size );
+
+			return( -1 );
+		}
+		code_size_counts[ code_size ] += 1;
+	}
+	code_size_counts[ 0 ] = 0;
+
+	for( code_size = 1;
+	     code_size < 32;
+	     code_size++ )
+	{
+		code = ( code + code_size_counts[ code_size - 1 ] ) << 1;
+
+		next_codes[ code_size ] = code;
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size == 0 )
+		{
+			codes[ symbol ] = 0;
+
+			continue;
+		}
+		code = next_codes[ code_size ]++;
+
+		if( storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+		{
+			code = assorted_huffman_tree_reverse_code(
+			        code,
+			        code_size );
+		}
+		codes[ symbol ] = code;
+	}
+	return( 1 );
+}
+
+/* Resizes the lookup table of the Huffman tree
+ * The entries of the current lookup table are preserved
+ * Returns 1 on success or -1 on error
+ */
+int assorted_huffman_tree_resize_lookup_table(
+     assorted_huffman_tree_t *huffman_tree,
+     int lookup_table_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_huffman_tree_resize_lookup_table";
+	void *reallocation    = NULL;
+	size_t array_size     = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lookup_table_size <= huffman_tree->lookup_table_size )
+	 || ( lookup_table_size > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid lookup table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	array_size = sizeof( uint32_t ) * lookup_table_size;
+
+	/* A lookup table allocated from an arena cannot be resized, a larger
+	 * one is allocated instead
+	 */
+	if( huffman_tree->arena != NULL )
+	{
+		if( assorted_arena_allocate(
+		     huffman_tree->arena,
+		     array_size,
+		     &reallocation,
+		     error ) != 1 )
+		{
+			reallocation = NULL;
+		}
+		else if( huffman_tree->lookup_table != NULL )
+		{
+			if( memory_copy(
+			     reallocation,
+			     huffman_tree->lookup_table,
+			     sizeof( uint32_t ) * huffman_tree->lookup_table_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy lookup table.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		reallocation = memory_reallocate(
+		                huffman_tree->lookup_table,
+		                array_size );
+	}
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	huffman_tree->lookup_table      = (uint32_t *) reallocation;
+	huffman_tree->lookup_table_size = lookup_table_size;
+
+	return( 1 );
+}
+
+/* Builds the lookup table of the Huffman tree
+ * The lookup table consists of a primary table indexed by the first lookup table bits
+ * of a Huffman code and sub tables for the Huffman codes that are larger
+ * The layout of the table depends on the storage type of the bit stream that is
+ * read from, hence the table is built on first use by
+ * assorted_huffman_tree_get_symbol_from_bit_stream
+ * The entries are written in a single pass over the symbols sorted by code size,
+ * where a sub table is added when the first Huffman code of its prefix is reached.
+ * Only the entries of an incomplete code need to be cleared
+ * Returns 1 on success or -1 on error
+ */
+int assorted_huffman_tree_build_lookup_table(
+     assorted_huffman_tree_t *huffman_tree,
+     uint8_t storage_type,
+     libcerror_error_t **error )
+{
+	uint16_t pair_literal_reversed_codes[ 1 << ( ASSORTED_HUFFMAN_TREE_LITERAL_PAIR_LOOKUP_TABLE_BITS - 1 ) ];
+	uint8_t pair_literal_code_sizes[ 1 << ( ASSORTED_HUFFMAN_TREE_LITERAL_PAIR_LOOKUP_TABLE_BITS - 1 ) ];
+	uint8_t pair_literal_symbols[ 1 << ( ASSORTED_HUFFMAN_TREE_LITERAL_PAIR_LOOKUP_TABLE_BITS - 1 ) ];
+	int remaining_code_size_counts[ 33 ];
+
+	static char *function          = "assorted_huffman_tree_build_lookup_table";
+	uint32_t entry                 = 0;
+	uint32_t entry_index           = 0;
+	uint32_t fill_index            = 0;
+	uint32_t fill_step             = 0;
+	uint32_t huffman_code          = 0;
+	uint32_t number_of_fills       = 0;
+	uint32_t prefix                = 0;
+	uint32_t reversed_code         = 0;
+	uint32_t reversed_code_bit     = 0;
+	uint32_t sub_table_prefix      = 0;
+	uint32_t table_offset          = 0;
+	uint8_t code_size              = 0;
+	uint8_t lookup_table_bits      = 0;
+	uint8_t next_code_size         = 0;
+	uint8_t number_of_table_bits   = 0;
+	uint8_t second_code_size       = 0;
+	uint8_t sub_table_bits         = 0;
+	uint8_t suffix_size            = 0;
+	int first_literal_index        = 0;
+	int is_incomplete              = 0;
+	int left_value                 = 0;
+	int lookup_table_size          = 0;
+	int new_lookup_table_size      = 0;
+	int number_of_pair_literals    = 0;
+	int second_literal_index       = 0;
+	int symbol_index               = 0;
+	int use_literal_pairs          = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported storage type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( huffman_tree->largest_code_size == 0 )
+	 || ( huffman_tree->largest_code_size > 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Huffman tree - missing codes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( huffman_tree->number_of_literal_symbols > 0 ) )
+	{
+		/* Use a wider primary table so that more literal pairs fit in an entry,
+		 * even if it is wider than the largest Huffman code
+		 */
+		lookup_table_bits = ASSORTED_HUFFMAN_TREE_LITERAL_PAIR_LOOKUP_TABLE_BITS;
+		use_literal_pairs = 1;
+	}
+	else
+	{
+		lookup_table_bits = huffman_tree->largest_code_size;
+
+		if( lookup_table_bits > ASSORTED_HUFFMAN_TREE_LOOKUP_TABLE_BITS )
+		{
+			lookup_table_bits = ASSORTED_HUFFMAN_TREE_LOOKUP_TABLE_BITS;
+		}
+	}
+	/* Determine the number of Huffman codes per code size that remain to be filled,
+	 * these are used to determine the size of a sub table, and if the code is
+	 * incomplete, in which case not every entry is filled
+	 */
+	left_value = 1;
+
+	for( code_size = 1;
+	     code_size <= huffman_tree->largest_code_size;
+	     code_size++ )
+	{
+		remaining_code_size_counts[ code_size ] = huffman_tree->code_size_counts[ code_size ];
+
+		left_value <<= 1;
+		left_value  -= huffman_tree->code_size_counts[ code_size ];
+	}
+	is_incomplete = (int) ( left_value != 0 );
+
+	lookup_table_size = 1 << lookup_table_bits;
+
+	if( lookup_table_size > huffman_tree->lookup_table_size )
+	{
+		if( assorted_huffman_tree_resize_lookup_table(
+		     huffman_tree,
+		     lookup_table_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize lookup table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( is_incomplete != 0 )
+	{
+		if( memory_set(
+		     huffman_tree->lookup_table,
+		     0,
+		     sizeof( uint32_t ) * lookup_table_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear lookup table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Fill the primary and sub table entries of the Huffman codes in canonical order,
+	 * for a back to front bit stream the bit reversed Huffman code is maintained
+	 * alongside since the first bit of the Huffman code is stored in the least
+	 * significant bit
+	 */
+	code_size = 1;
+
+	while( remaining_code_size_counts[ code_size ] == 0 )
+	{
+		code_size++;
+	}
+	sub_table_prefix = (uint32_t) 1 << lookup_table_bits;
+
+	for( symbol_index = 0;
+	     ;
+	     symbol_index++ )
+	{
+		entry = huffman_tree->symbols[ symbol_index ];
+
+		if( huffman_tree->symbol_values != NULL )
+		{
+			entry |= huffman_tree->symbol_values[ entry ] << huffman_tree->number_of_symbol_bits;
+		}
+		entry = ( entry << 8 ) | code_size;
+
+		if( code_size <= lookup_table_bits )
+		{
+			table_offset         = 0;
+			suffix_size          = code_size;
+			number_of_table_bits = lookup_table_bits;
+		}
+		else
+		{
+			suffix_size = code_size - lookup_table_bits;
+
+			if( storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+			{
+				prefix = reversed_code & ( ( (uint32_t) 1 << lookup_table_bits ) - 1 );
+			}
+			else
+			{
+				prefix = huffman_code >> suffix_size;
+			}
+			if( prefix != sub_table_prefix )
+			{
+				/* The sub table needs to fit the remaining Huffman codes with the prefix,
+				 * the Huffman codes that do not fit the sub table entries left after
+				 * the codes of a specific size have a larger code size
+				 */
+				sub_table_bits = suffix_size;
+				left_value     = 1 << sub_table_bits;
+
+				while( ( lookup_table_bits + sub_table_bits ) < huffman_tree->largest_code_size )
+				{
+					left_value -= remaining_code_size_counts[ lookup_table_bits + sub_table_bits ];
+
+					if( left_value <= 0 )
+					{
+						break;
+					}
+					sub_table_bits++;
+
+					left_value <<= 1;
+				}
+				table_offset           = (uint32_t) lookup_table_size;
+				new_lookup_table_size  = lookup_table_size + ( 1 << sub_table_bits );
+
+				if( new_lookup_table_size > huffman_tree->lookup_table_size )
+				{
+					if( assorted_huffman_tree_resize_lookup_table(
+					     huffman_tree,
+					     ( new_lookup_table_size > ( 2 * huffman_tree->lookup_table_size ) ) ? new_lookup_table_size : ( 2 * huffman_tree->lookup_table_size ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize lookup table.",
+						 function );
+
+						return( -1 );
+					}
+				}
+				if( is_incomplete != 0 )
+				{
+					if( memory_set(
+					     &( huffman_tree->lookup_table[ table_offset ] ),
+					     0,
+					     sizeof( uint32_t ) * ( 1 << sub_table_bits ) ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear sub table.",
+						 function );
+
+						return( -1 );
+					}
+				}
+				huffman_tree->lookup_table[ prefix ] = ( table_offset << 8 )
+				                                     | ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE
+				                                     | sub_table_bits;
+
+				lookup_table_size = new_lookup_table_size;
+				sub_table_prefix  = prefix;
+			}
+			table_offset         = huffman_tree->lookup_table[ prefix ] >> 8;
+			number_of_table_bits = sub_table_bits;
+		}
+		number_of_fills = (uint32_t) 1 << ( number_of_table_bits - suffix_size );
+
+		if( storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+		{
+			/* The entries of a Huffman code are every 2^suffix size entries
+			 */
+			entry_index = table_offset + ( reversed_code >> ( code_size - suffix_size ) );
+			fill_step   = (uint32_t) 1 << suffix_size;
+		}
+		else
+		{
+			/* The entries of a Huffman code are consecutive
+			 */
+			entry_index = table_offset + ( ( huffman_code & ( ( (uint32_t) 1 << suffix_size ) - 1 ) ) << ( number_of_table_bits - suffix_size ) );
+			fill_step   = 1;
+		}
+		for( fill_index = 0;
+		     fill_index < number_of_fills;
+		     fill_index++ )
+		{
+			huffman_tree->lookup_table[ entry_index ] = entry;
+
+			entry_index += fill_step;
+		}
+		/* Keep track of the literals that can be the first or second literal of a pair,
+		 * which requires a Huffman code smaller than the primary table
+		 */
+		if( ( use_literal_pairs != 0 )
+		 && ( code_size < lookup_table_bits )
+		 && ( huffman_tree->symbols[ symbol_index ] < huffman_tree->number_of_literal_symbols ) )
+		{
+			pair_literal_symbols[ number_of_pair_literals ]        = (uint8_t) huffman_tree->symbols[ symbol_index ];
+			pair_literal_code_sizes[ number_of_pair_literals ]     = code_size;
+			pair_literal_reversed_codes[ number_of_pair_literals ] = (uint16_t) reversed_code;
+
+			number_of_pair_literals++;
+		}
+		remaining_code_size_counts[ code_size ] -= 1;
+
+		next_code_size = code_size;
+
+		if( remaining_code_size_counts[ code_size ] == 0 )
+		{
+			do
+			{
+				if( next_code_size == huffman_tree->largest_code_size )
+				{
+					break;
+				}
+				next_code_size++;
+			}
+			while( remaining_code_size_counts[ next_code_size ] == 0 );
+
+			if( remaining_code_size_counts[ next_code_size ] == 0 )
+			{
+				break;
+			}
+		}
+		/* Increment the bit reversed Huffman code by adding 1 to its most
+		 * significant bit and propagating the carry towards the least
+		 * significant bit
+		 */
+		reversed_code_bit = (uint32_t) 1 << ( code_size - 1 );
+
+		while( ( reversed_code & reversed_code_bit ) != 0 )
+		{
+			reversed_code_bit >>= 1;
+		}
+		if( reversed_code_bit != 0 )
+		{
+			reversed_code &= reversed_code_bit - 1;
+			reversed_code += reversed_code_bit;
+		}
+		else
+		{
+			reversed_code = 0;
+		}
+		huffman_code = ( huffman_code + 1 ) << ( next_code_size - code_size );
+		code_size    = next_code_size;
+	}
+	/* Combine primary table entries of two consecutive literals whose Huffman codes
+	 * together fit in the primary table. The entries of a pair are those of which
+	 * the first code size bits contain the bit reversed Huffman code of the first
+	 * literal followed by that of the second literal
+	 */
+	for( first_literal_index = 0;
+	     first_literal_index < number_of_pair_literals;
+	     first_literal_index++ )
+	{
+		code_size = pair_literal_code_sizes[ first_literal_index ];
+
+		for( second_literal_index = 0;
+		     second_literal_index < number_of_pair_literals;
+		     second_literal_index++ )
+		{
+			second_code_size = pair_literal_code_sizes[ second_literal_index ];
+
+			/* The literals are sorted by code size
+			 */
+			if( ( code_size + second_code_size ) > lookup_table_bits )
+			{
+				break;
+			}
+			entry = ( (uint32_t) pair_literal_symbols[ second_literal_index ] << 24 )
+			      | ( (uint32_t) pair_literal_symbols[ first_literal_index ] << 16 )
+			      | ( (uint32_t) code_size << 8 )
+			      | ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_LITERAL_PAIR
+			      | ( code_size + second_code_size );
+
+			entry_index     = pair_literal_reversed_codes[ first_literal_index ]
+			                | ( pair_literal_reversed_codes[ second_literal_index ] << code_size );
+			fill_step       = (uint32_t) 1 << ( code_size + second_code_size );
+			number_of_fills = (uint32_t) 1 << ( lookup_table_bits - code_size - second_code_size );
+
+			for( fill_index = 0;
+			     fill_index < number_of_fills;
+			     fill_index++ )
+			{
+				huffman_tree->lookup_table[ entry_index ] = entry;
+
+				entry_index += fill_step;
+			}
+		}
+	}
+	huffman_tree->lookup_table_bits         = lookup_table_bits;
+	huffman_tree->lookup_table_storage_type = storage_type;
+
+	return( 1 );
+}
+
+/* Retrieves a symbol based on the Huffman code read from the bit-stream
+ * Returns 1 on success or -1 on error
+ */
+int assorted_huffman_tree_get_symbol_from_bit_stream(
+     assorted_huffman_tree_t *huffman_tree,
+     assorted_bit_stream_t *bit_stream,
+     uint16_t *symbol,
+     libcerror_error_t **error )
+{
+	static char *function  = "assorted_huffman_tree_get_symbol_from_bit_stream";
+	uint32_t entry         = 0;
+	uint32_t value_32bit   = 0;
+	uint8_t code_size      = 0;
+	uint8_t sub_table_bits = 0;
+	int result             = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_tree->lookup_table_storage_type != bit_stream->storage_type )
+	{
+		if( assorted_huffman_tree_build_lookup_table(
+		     huffman_tree,
+		     bit_stream->storage_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build lookup table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Peek the bits of the largest Huffman code, a single peek suffices
+	 * for both the primary table and the sub table lookup
+	 */
+	code_size = huffman_tree->largest_code_size;
+
+	if( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		/* The primary table of a tree with literal pairs can be wider than the largest Huffman code
+		 */
+		if( code_size < huffman_tree->lookup_table_bits )
+		{
+			code_size = huffman_tree->lookup_table_bits;
+		}
+		if( assorted_bit_stream_peek_bits_back_to_front(
+		     bit_stream,
+		     code_size,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		entry = huffman_tree->lookup_table[ value_32bit & ( ( (uint32_t) 1 << huffman_tree->lookup_table_bits ) - 1 ) ];
+
+		if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE ) != 0 )
+		{
+			sub_table_bits = (uint8_t) ( entry & 0x3f );
+			value_32bit  >>= huffman_tree->lookup_table_bits;
+
+			entry = huffman_tree->lookup_table[ ( entry >> 8 ) + ( value_32bit & ( ( (uint32_t) 1 << sub_table_bits ) - 1 ) ) ];
+		}
+		else if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_LITERAL_PAIR ) != 0 )
+		{
+			/* Only use the first literal of a literal pair
+			 */
+			entry = ( ( ( entry >> 16 ) & 0x000000ffUL ) << 8 )
+			      | ( ( entry >> 8 ) & 0x0000000fUL );
+		}
+		code_size = (uint8_t) ( entry & 0x3f );
+
+		if( code_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+			 function,
+			 value_32bit );
+
+			return( -1 );
+		}
+		result = assorted_bit_stream_skip_bits_back_to_front(
+		          bit_stream,
+		          code_size,
+		          error );
+	}
+	else
+	{
+		if( assorted_bit_stream_peek_bits_front_to_back(
+		     bit_stream,
+		     code_size,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		code_size -= huffman_tree->lookup_table_bits;
+
+		entry = huffman_tree->lookup_table[ value_32bit >> code_size ];
+
+		if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE ) != 0 )
+		{
+			sub_table_bits = (uint8_t) ( entry & 0x3f );
+			value_32bit   &= ( (uint32_t) 1 << code_size ) - 1;
+
+			entry = huffman_tree->lookup_table[ ( entry >> 8 ) + ( value_32bit >> ( code_size - sub_table_bits ) ) ];
+		}
+		code_size = (uint8_t) ( entry & 0x3f );
+
+		if( code_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+			 function,
+			 value_32bit );
+
+			return( -1 );
+		}
+		result = assorted_bit_stream_skip_bits_front_to_back(
+		          bit_stream,
+		          code_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to skip bits in bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	*symbol = (uint16_t) ( ( entry >> 8 ) & ( ( (uint32_t) 1 << huffman_tree->number_of_symbol_bits ) - 1 ) );
+
+	return( 1 );
+}
+
+/* Retrieves a symbol based on the Huffman code stored in a value
+ * The value contains the next largest code size number of bits, most significant bit first,
+ * which allows a caller that maintains its own bit buffer to use the lookup table
+ * The number of bits of the Huffman code is returned in code size
+ * Returns 1 on success or -1 on error
+ */
+int assorted_huffman_tree_get_symbol_from_value(
+     assorted_huffman_tree_t *huffman_tree,
+     uint32_t value_32bit,
+     uint16_t *symbol,
+     uint8_t *code_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "assorted_huffman_tree_get_symbol_from_value";
+	uint32_t entry         = 0;
+	uint8_t sub_table_bits = 0;
+	uint8_t suffix_size    = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code size.",
+		 function );
+
+		return( -1 );
+	}
+	if( huffman_tree->lookup_table_storage_type != ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+	{
+		if( assorted_huffman_tree_build_lookup_table(
+		     huffman_tree,
+		     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build lookup table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	value_32bit &= ( (uint32_t) 1 << huffman_tree->largest_code_size ) - 1;
+
+	suffix_size = huffman_tree->largest_code_size - huffman_tree->lookup_table_bits;
+
+	entry = huffman_tree->lookup_table[ value_32bit >> suffix_size ];
+
+	if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE ) != 0 )
+	{
+		sub_table_bits = (uint8_t) ( entry & 0x3f );
+		value_32bit   &= ( (uint32_t) 1 << suffix_size ) - 1;
+
+		entry = huffman_tree->lookup_table[ ( entry >> 8 ) + ( value_32bit >> ( suffix_size - sub_table_bits ) ) ];
+	}
+	if( ( entry & 0x3f ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+		 function,
+		 value_32bit );
+
+		return( -1 );
+	}
+	*symbol    = (uint16_t) ( ( entry >> 8 ) & ( ( (uint32_t) 1 << huffman_tree->number_of_symbol_bits ) - 1 ) );
+	*code_size = (uint8_t) ( entry & 0x3f );
+
+	return( 1 );
+}
+
+/* Retrieves one or two symbols based on the Huffman codes read from the bit-stream
+ * Two symbols are only retrieved for a pair of literals that is stored in
+ * a single lookup table entry, which requires number_of_literal_symbols
+ * to be set and a back to front bit stream
+ * Returns 1 on success or -1 on error
+ */
+int assorted_huffman_tree_get_symbols_from_bit_stream(
+     assorted_huffman_tree_t *huffman_tree,
+     assorted_bit_stream_t *bit_stream,
+     uint16_t *symbol,
+     uint16_t *second_symbol,
+     uint8_t *number_of_symbols,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_huffman_tree_get_symbols_from_bit_stream";
+	uint32_t entry        = 0;
+	uint32_t value_32bit  = 0;
+	uint8_t code_size     = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second symbol.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of symbols.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( huffman_tree->number_of_literal_symbols > 0 )
+	 && ( bit_stream->storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( huffman_tree->lookup_table_storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT ) )
+	{
+		code_size = huffman_tree->largest_code_size;
+
+		if( code_size < huffman_tree->lookup_table_bits )
+		{
+			code_size = huffman_tree->lookup_table_bits;
+		}
+		if( assorted_bit_stream_peek_bits_back_to_front(
+		     bit_stream,
+		     code_size,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		entry     = huffman_tree->lookup_table[ value_32bit & ( ( (uint32_t) 1 << huffman_tree->lookup_table_bits ) - 1 ) ];
+		code_size = (uint8_t) ( entry & 0x3f );
+
+		*number_of_symbols = 1;
+
+		if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE ) != 0 )
+		{
+			value_32bit >>= huffman_tree->lookup_table_bits;
+
+			entry     = huffman_tree->lookup_table[ ( entry >> 8 ) + ( value_32bit & ( ( (uint32_t) 1 << code_size ) - 1 ) ) ];
+			code_size = (uint8_t) ( entry & 0x3f );
+		}
+		else if( ( entry & ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_LITERAL_PAIR ) != 0 )
+		{
+			/* The peek returns 0 for bits beyond the end of the byte stream
+			 * hence only use a literal pair if all its bits are available
+			 */
+			if( code_size <= bit_stream->bit_buffer_size )
+			{
+				*second_symbol     = (uint16_t) ( entry >> 24 );
+				*number_of_symbols = 2;
+			}
+			else
+			{
+				code_size = (uint8_t) ( ( entry >> 8 ) & 0x0000000fUL );
+			}
+			entry = ( ( entry >> 16 ) & 0x000000ffUL ) << 8;
+		}
+		if( code_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+			 function,
+			 value_32bit );
+
+			return( -1 );
+		}
+		if( assorted_bit_stream_skip_bits_back_to_front(
+		     bit_stream,
+		     code_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to skip bits in bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		*symbol = (uint16_t) ( ( entry >> 8 ) & ( ( (uint32_t) 1 << huffman_tree->number_of_symbol_bits ) - 1 ) );
+
+		return( 1 );
+	}
+	if( assorted_huffman_tree_get_symbol_from_bit_stream(
+	     huffman_tree,
+	     bit_stream,
+	     symbol,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve symbol from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_symbols = 1;
+
+	return( 1 );
+}
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "assorted_arena.h"
 #include "assorted_bit_stream.h"
 #include "assorted_libcerror.h"
 
@@ -32,6 +33,19 @@
 extern "C" {
 #endif
 
+/* The maximum number of bits used to index the primary lookup table
+ */
+#define ASSORTED_HUFFMAN_TREE_LOOKUP_TABLE_BITS			10
+
+/* The number of bits used to index the primary lookup table of a tree with literal pairs
+ */
+#define ASSORTED_HUFFMAN_TREE_LITERAL_PAIR_LOOKUP_TABLE_BITS	11
+
+/* The lookup table entry flags
+ */
+#define ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE	0x80
+#define ASSORTED_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_LITERAL_PAIR	0x40
+
 typedef struct assorted_huffman_tree assorted_huffman_tree_t;
 
 struct assorted_huffman_tree
@@ -47,6 +61,54 @@ struct assorted_huffman_tree
 	/* The code size counts array
 	 */
 	int *code_size_counts;
+
+	/* The largest code size used by a symbol
+	 */
+	uint8_t largest_code_size;
+
+	/* The storage type of the bit stream the lookup table was built for
+	 */
+	uint8_t lookup_table_storage_type;
+
+	/* The number of bits used to index the primary lookup table
+	 */
+	uint8_t lookup_table_bits;
+
+	/* The number of symbols, starting at 0, that are literals which can
+	 * be decoded as a pair, 0 if pairs are not used
+	 */
+	uint16_t number_of_literal_symbols;
+
+	/* The lookup table
+	 * Contains the primary table followed by the sub tables
+	 * An entry consists of: value << 8 | flags | code size, where value is
+	 * the symbol, combined with its symbol value if set, or the offset of a sub table
+	 * A literal pair entry consists of: second literal << 24 | first literal << 16
+	 * | first code size << 8 | flags | combined code size
+	 */
+	uint32_t *lookup_table;
+
+	/* The number of lookup table entries allocated
+	 */
+	int lookup_table_size;
+
+	/* The arena the tree is allocated from, NULL if allocated separately
+	 */
+	assorted_arena_t *arena;
+
+	/* The values stored alongside the symbols in the lookup table entries,
+	 * NULL if not used
+	 */
+	const uint32_t *symbol_values;
+
+	/* The number of symbol values
+	 */
+	int number_of_symbol_values;
+
+	/* The number of bits of the value of a lookup table entry that contain the symbol,
+	 * the symbol value is stored above these bits
+	 */
+	uint8_t number_of_symbol_bits;
 };
 
 int assorted_huffman_tree_initialize(
@@ -55,22 +117,79 @@ int assorted_huffman_tree_initialize(
      uint8_t maximum_code_size,
      libcerror_error_t **error );
 
+int assorted_huffman_tree_initialize_with_arena(
+     assorted_huffman_tree_t **huffman_tree,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
 int assorted_huffman_tree_free(
      assorted_huffman_tree_t **huffman_tree,
      libcerror_error_t **error );
 
+int assorted_huffman_tree_set_symbol_values(
+     assorted_huffman_tree_t *huffman_tree,
+     const uint32_t *symbol_values,
+     int number_of_symbol_values,
+     uint8_t number_of_symbol_bits,
+     libcerror_error_t **error );
+
 int assorted_huffman_tree_build(
      assorted_huffman_tree_t *huffman_tree,
      const uint8_t *code_sizes_array,
      int number_of_code_sizes,
      libcerror_error_t **error );
 
+uint32_t assorted_huffman_tree_reverse_code(
+          uint32_t huffman_code,
+          uint8_t code_size );
+
+int assorted_huffman_tree_build_code_sizes(
+     const uint32_t *frequencies,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     uint8_t *code_sizes,
+     libcerror_error_t **error );
+
+int assorted_huffman_tree_build_codes(
+     const uint8_t *code_sizes,
+     int number_of_symbols,
+     uint8_t storage_type,
+     uint32_t *codes,
+     libcerror_error_t **error );
+
+int assorted_huffman_tree_resize_lookup_table(
+     assorted_huffman_tree_t *huffman_tree,
+     int lookup_table_size,
+     libcerror_error_t **error );
+
+int assorted_huffman_tree_build_lookup_table(
+     assorted_huffman_tree_t *huffman_tree,
+     uint8_t storage_type,
+     libcerror_error_t **error );
+
 int assorted_huffman_tree_get_symbol_from_bit_stream(
      assorted_huffman_tree_t *huffman_tree,
      assorted_bit_stream_t *bit_stream,
      uint16_t *symbol,
      libcerror_error_t **error );
 
+int assorted_huffman_tree_get_symbol_from_value(
+     assorted_huffman_tree_t *huffman_tree,
+     uint32_t value_32bit,
+     uint16_t *symbol,
+     uint8_t *code_size,
+     libcerror_error_t **error );
+
+int assorted_huffman_tree_get_symbols_from_bit_stream(
+     assorted_huffman_tree_t *huffman_tree,
+     assorted_bit_stream_t *bit_stream,
+     uint16_t *symbol,
+     uint16_t *second_symbol,
+     uint8_t *number_of_symbols,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
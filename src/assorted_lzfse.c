@@ -0,0 +1,2067 @@
+/*
+ * LZFSE decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_lzfse.h"
+#include "assorted_lzvn.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+/* The number of bits of the frequency values, indexed by the lower 5 bits of the value
+ */
+static const uint8_t assorted_lzfse_frequency_number_of_bits[ 32 ] = {
+	2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14,
+	2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14 };
+
+/* The frequency values, indexed by the lower 5 bits of the value
+ */
+static const uint8_t assorted_lzfse_frequency_values[ 32 ] = {
+	0, 2, 1, 4, 0, 3, 1, 0, 0, 2, 1, 5, 0, 3, 1, 0,
+	0, 2, 1, 6, 0, 3, 1, 0, 0, 2, 1, 7, 0, 3, 1, 0 };
+
+static const uint8_t assorted_lzfse_l_value_bits[ 20 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 3, 5, 8 };
+
+static const int32_t assorted_lzfse_l_value_base[ 20 ] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+	10, 11, 12, 13, 14, 15, 16, 20, 28, 60 };
+
+static const uint8_t assorted_lzfse_m_value_bits[ 20 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 5, 8, 11 };
+
+static const int32_t assorted_lzfse_m_value_base[ 20 ] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+	10, 11, 12, 13, 14, 15, 16, 24, 56, 312 };
+
+static const uint8_t assorted_lzfse_d_value_bits[ 64 ] = {
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+	4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+	8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11,
+	12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15 };
+
+static const int32_t assorted_lzfse_d_value_base[ 64 ] = {
+	0, 1, 2, 3, 4, 6, 8, 10,
+	12, 16, 20, 24, 28, 36, 44, 52,
+	60, 76, 92, 108, 124, 156, 188, 220,
+	252, 316, 380, 444, 508, 636, 764, 892,
+	1020, 1276, 1532, 1788, 2044, 2556, 3068, 3580,
+	4092, 5116, 6140, 7164, 8188, 10236, 12284, 14332,
+	16380, 20476, 24572, 28668, 32764, 40956, 49148, 57340,
+	65532, 81916, 98300, 114684, 131068, 163836, 196604, 229372 };
+
+/* Retrieves bits from a back to front bit stream
+ * The bit buffer is expected to contain at least the number of bits
+ */
+#define assorted_lzfse_bit_stream_get_bits( bit_stream, number_of_bits, value_32bit ) \
+	( bit_stream )->bit_buffer_size -= number_of_bits; \
+	value_32bit = (uint32_t) ( ( bit_stream )->bit_buffer >> ( bit_stream )->bit_buffer_size ); \
+	( bit_stream )->bit_buffer &= ( (uint64_t) 1 << ( bit_stream )->bit_buffer_size ) - 1;
+
+/* Decodes a value from a back to front bit stream using a value decoder table
+ */
+#define assorted_lzfse_decode_value( bit_stream, decoder_table, state, value, value_32bit ) \
+	assorted_lzfse_bit_stream_get_bits( bit_stream, (int) decoder_table[ state ].number_of_bits, value_32bit ) \
+	value  = (uint32_t) decoder_table[ state ].value_base + ( value_32bit & ( ( (uint32_t) 1 << decoder_table[ state ].number_of_value_bits ) - 1 ) ); \
+	state  = (uint16_t) ( decoder_table[ state ].delta + (int32_t) ( value_32bit >> decoder_table[ state ].number_of_value_bits ) );
+
+/* Initializes a back to front bit stream
+ * The bit stream starts at the end of the data with the first 7 or 8 bytes
+ * where number of bits, that is 0 or negative, is the number of unused bits
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfse_bit_stream_initialize(
+     assorted_lzfse_bit_stream_t *bit_stream,
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzfse_bit_stream_initialize";
+	size_t read_size      = 7;
+	size_t byte_index     = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_bits < -7 )
+	 || ( number_of_bits > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits != 0 )
+	{
+		read_size = 8;
+	}
+	if( data_size < read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream->data            = data;
+	bit_stream->data_offset     = data_size - read_size;
+	bit_stream->bit_buffer      = 0;
+	bit_stream->bit_buffer_size = (int) ( read_size * 8 ) + number_of_bits;
+
+	for( byte_index = read_size;
+	     byte_index > 0;
+	     byte_index-- )
+	{
+		bit_stream->bit_buffer <<= 8;
+		bit_stream->bit_buffer  |= data[ bit_stream->data_offset + byte_index - 1 ];
+	}
+	if( ( bit_stream->bit_buffer_size < 56 )
+	 || ( bit_stream->bit_buffer_size >= 64 )
+	 || ( ( bit_stream->bit_buffer >> bit_stream->bit_buffer_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Refills the bit buffer of a back to front bit stream with whole bytes
+ * After a refill the bit buffer contains at least 56 bits
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfse_bit_stream_refill(
+     assorted_lzfse_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzfse_bit_stream_refill";
+	uint64_t read_value   = 0;
+	size_t byte_index     = 0;
+	size_t read_size      = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = (size_t) ( ( 63 - bit_stream->bit_buffer_size ) & 0x38 ) >> 3;
+
+	if( read_size > bit_stream->data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid bit stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == 0 )
+	{
+		return( 1 );
+	}
+	bit_stream->data_offset -= read_size;
+
+	for( byte_index = read_size;
+	     byte_index > 0;
+	     byte_index-- )
+	{
+		read_value <<= 8;
+		read_value  |= bit_stream->data[ bit_stream->data_offset + byte_index - 1 ];
+	}
+	bit_stream->bit_buffer      <<= read_size * 8;
+	bit_stream->bit_buffer       |= read_value;
+	bit_stream->bit_buffer_size  += (int) ( read_size * 8 );
+
+	return( 1 );
+}
+
+/* Reads a block header
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfse_read_block_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint32_t *block_type,
+     size_t *block_size,
+     size_t *uncompressed_block_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzfse_read_block_header";
+	size_t header_size                 = 0;
+	size_t payload_size                = 0;
+	uint64_t packed_fields1            = 0;
+	uint64_t packed_fields2            = 0;
+	uint64_t packed_fields3            = 0;
+	uint32_t safe_block_type           = 0;
+	uint32_t safe_uncompressed_size    = 0;
+	uint32_t value_32bit               = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 4 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block type.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed block size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 compressed_data,
+	 safe_block_type );
+
+	switch( safe_block_type )
+	{
+		case ASSORTED_LZFSE_BLOCK_TYPE_END_OF_STREAM:
+			header_size = 4;
+			break;
+
+		case ASSORTED_LZFSE_BLOCK_TYPE_UNCOMPRESSED:
+			header_size = 8;
+			break;
+
+		case ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_LZVN:
+			header_size = 12;
+			break;
+
+		case ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V2:
+			header_size = ASSORTED_LZFSE_COMPRESSED_V2_BLOCK_HEADER_SIZE;
+			break;
+
+		case ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V1:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compressed (version 1) block.",
+			 function );
+
+			return( -1 );
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: unsupported block signature: 0x%08" PRIx32 ".",
+			 function,
+			 safe_block_type );
+
+			return( -1 );
+	}
+	if( header_size > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_size > 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ 4 ] ),
+		 safe_uncompressed_size );
+	}
+	if( safe_block_type == ASSORTED_LZFSE_BLOCK_TYPE_UNCOMPRESSED )
+	{
+		payload_size = (size_t) safe_uncompressed_size;
+	}
+	else if( safe_block_type == ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_LZVN )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ 8 ] ),
+		 value_32bit );
+
+		payload_size = (size_t) value_32bit;
+	}
+	else if( safe_block_type == ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V2 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( compressed_data[ 8 ] ),
+		 packed_fields1 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( compressed_data[ 16 ] ),
+		 packed_fields2 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( compressed_data[ 24 ] ),
+		 packed_fields3 );
+
+		/* The header size includes the frequency tables
+		 */
+		header_size = (size_t) ( packed_fields3 & 0xffffffffUL );
+
+		if( ( header_size < ASSORTED_LZFSE_COMPRESSED_V2_BLOCK_HEADER_SIZE )
+		 || ( header_size > compressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid header size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		payload_size = (size_t) ( ( packed_fields1 >> 20 ) & 0x000fffffUL )
+		             + (size_t) ( ( packed_fields2 >> 40 ) & 0x000fffffUL );
+	}
+	if( payload_size > ( compressed_data_size - header_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block payload size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*block_type              = safe_block_type;
+	*block_size              = header_size + payload_size;
+	*uncompressed_block_size = (size_t) safe_uncompressed_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of blocks in LZFSE compressed data
+ * The blocks are determined from the block headers, the block data is not decompressed
+ * The end of stream block is not included
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzfse_get_number_of_blocks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function          = "assorted_lzfse_get_number_of_blocks";
+	size_t block_size              = 0;
+	size_t compressed_data_offset  = 0;
+	size_t safe_number_of_blocks   = 0;
+	size_t uncompressed_block_size = 0;
+	uint32_t block_type            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( assorted_lzfse_read_block_header(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_data_size - compressed_data_offset,
+		     &block_type,
+		     &block_size,
+		     &uncompressed_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read block: %" PRIzd " header at offset: %" PRIzd ".",
+			 function,
+			 safe_number_of_blocks,
+			 compressed_data_offset );
+
+			return( -1 );
+		}
+		compressed_data_offset += block_size;
+
+		if( block_type != ASSORTED_LZFSE_BLOCK_TYPE_END_OF_STREAM )
+		{
+			safe_number_of_blocks++;
+		}
+	}
+	while( block_type != ASSORTED_LZFSE_BLOCK_TYPE_END_OF_STREAM );
+
+	*number_of_blocks = safe_number_of_blocks;
+
+	return( 1 );
+}
+
+/* Determines the blocks in LZFSE compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzfse_get_blocks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     assorted_lzfse_block_t *blocks,
+     size_t number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_lzfse_get_blocks";
+	size_t block_index              = 0;
+	size_t block_size               = 0;
+	size_t compressed_data_offset   = 0;
+	size_t uncompressed_block_size  = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t block_type             = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks > (size_t) ( SSIZE_MAX / sizeof( assorted_lzfse_block_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of blocks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( assorted_lzfse_read_block_header(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_data_size - compressed_data_offset,
+		     &block_type,
+		     &block_size,
+		     &uncompressed_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read block: %" PRIzd " header at offset: %" PRIzd ".",
+			 function,
+			 block_index,
+			 compressed_data_offset );
+
+			return( -1 );
+		}
+		if( block_type == ASSORTED_LZFSE_BLOCK_TYPE_END_OF_STREAM )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of blocks value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( uncompressed_block_size > ( (size_t) SSIZE_MAX - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid block: %" PRIzd " uncompressed size value exceeds maximum.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		blocks[ block_index ].block_type               = block_type;
+		blocks[ block_index ].compressed_data          = &( compressed_data[ compressed_data_offset ] );
+		blocks[ block_index ].compressed_data_size     = block_size;
+		blocks[ block_index ].uncompressed_data_offset = uncompressed_data_offset;
+		blocks[ block_index ].uncompressed_data_size   = uncompressed_block_size;
+		blocks[ block_index ].literals                 = NULL;
+		blocks[ block_index ].number_of_literals       = 0;
+		blocks[ block_index ].matches                  = NULL;
+		blocks[ block_index ].number_of_matches        = 0;
+		blocks[ block_index ].result                   = 0;
+
+		compressed_data_offset   += block_size;
+		uncompressed_data_offset += uncompressed_block_size;
+	}
+	return( 1 );
+}
+
+/* Builds a FSE decoder table
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzfse_build_decoder_table(
+     uint16_t number_of_states,
+     uint16_t number_of_symbols,
+     const uint16_t *frequencies,
+     assorted_lzfse_decoder_entry_t *decoder_table,
+     libcerror_error_t **error )
+{
+	static char *function       = "assorted_lzfse_build_decoder_table";
+	uint32_t frequency          = 0;
+	uint32_t sum_of_frequencies = 0;
+	uint16_t entry_index        = 0;
+	uint16_t symbol             = 0;
+	int number_of_bits          = 0;
+	int first_index             = 0;
+	int state_index             = 0;
+
+	if( ( number_of_states == 0 )
+	 || ( ( number_of_states & ( number_of_states - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of states.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols > 256 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     decoder_table,
+	     0,
+	     sizeof( assorted_lzfse_decoder_entry_t ) * number_of_states ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		frequency = frequencies[ symbol ];
+
+		if( frequency == 0 )
+		{
+			continue;
+		}
+		sum_of_frequencies += frequency;
+
+		if( sum_of_frequencies > number_of_states )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid sum of frequencies value exceeds number of states.",
+			 function );
+
+			return( -1 );
+		}
+		/* The number of bits is the shift that is needed to ensure that
+		 * number of states <= ( frequency << number of bits ) < 2 * number of states
+		 */
+		for( number_of_bits = 0;
+		     ( frequency << number_of_bits ) < number_of_states;
+		     number_of_bits++ )
+		{
+		}
+		first_index = (int) ( ( 2 * (uint32_t) number_of_states ) >> number_of_bits ) - (int) frequency;
+
+		for( state_index = 0;
+		     state_index < (int) frequency;
+		     state_index++ )
+		{
+			decoder_table[ entry_index ].symbol = (uint8_t) symbol;
+
+			if( state_index < first_index )
+			{
+				decoder_table[ entry_index ].number_of_bits = (int8_t) number_of_bits;
+				decoder_table[ entry_index ].delta          = (int16_t) ( ( ( (int) frequency + state_index ) << number_of_bits ) - (int) number_of_states );
+			}
+			else
+			{
+				decoder_table[ entry_index ].number_of_bits = (int8_t) ( number_of_bits - 1 );
+				decoder_table[ entry_index ].delta          = (int16_t) ( ( state_index - first_index ) << ( number_of_bits - 1 ) );
+			}
+			entry_index++;
+		}
+	}
+	return( 1 );
+}
+
+/* Builds a FSE value decoder table
+ * Every symbol maps onto a base value and a number of additional value bits
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzfse_build_value_decoder_table(
+     uint16_t number_of_states,
+     uint16_t number_of_symbols,
+     const uint16_t *frequencies,
+     const uint8_t *value_bits,
+     const int32_t *value_base,
+     assorted_lzfse_value_decoder_entry_t *decoder_table,
+     libcerror_error_t **error )
+{
+	static char *function       = "assorted_lzfse_build_value_decoder_table";
+	uint32_t frequency          = 0;
+	uint32_t sum_of_frequencies = 0;
+	uint16_t entry_index        = 0;
+	uint16_t symbol             = 0;
+	int number_of_bits          = 0;
+	int first_index             = 0;
+	int state_index             = 0;
+
+	if( ( number_of_states == 0 )
+	 || ( ( number_of_states & ( number_of_states - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of states.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols > 256 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_bits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value bits.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_base == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value base.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     decoder_table,
+	     0,
+	     sizeof( assorted_lzfse_value_decoder_entry_t ) * number_of_states ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		frequency = frequencies[ symbol ];
+
+		if( frequency == 0 )
+		{
+			continue;
+		}
+		sum_of_frequencies += frequency;
+
+		if( sum_of_frequencies > number_of_states )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid sum of frequencies value exceeds number of states.",
+			 function );
+
+			return( -1 );
+		}
+		for( number_of_bits = 0;
+		     ( frequency << number_of_bits ) < number_of_states;
+		     number_of_bits++ )
+		{
+		}
+		first_index = (int) ( ( 2 * (uint32_t) number_of_states ) >> number_of_bits ) - (int) frequency;
+
+		for( state_index = 0;
+		     state_index < (int) frequency;
+		     state_index++ )
+		{
+			decoder_table[ entry_index ].number_of_value_bits = value_bits[ symbol ];
+			decoder_table[ entry_index ].value_base           = value_base[ symbol ];
+
+			if( state_index < first_index )
+			{
+				decoder_table[ entry_index ].number_of_bits = (uint8_t) ( number_of_bits + value_bits[ symbol ] );
+				decoder_table[ entry_index ].delta          = (int16_t) ( ( ( (int) frequency + state_index ) << number_of_bits ) - (int) number_of_states );
+			}
+			else
+			{
+				decoder_table[ entry_index ].number_of_bits = (uint8_t) ( number_of_bits - 1 + value_bits[ symbol ] );
+				decoder_table[ entry_index ].delta          = (int16_t) ( ( state_index - first_index ) << ( number_of_bits - 1 ) );
+			}
+			entry_index++;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the frequency tables of a compressed (version 2) block header
+ * The frequencies of the L, M, D and literal symbols are stored consecutively
+ * as variable length values of 2 to 14 bits
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzfse_read_frequencies(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *frequencies,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_lzfse_read_frequencies";
+	size_t compressed_data_offset = 0;
+	uint32_t bit_buffer           = 0;
+	uint16_t frequency_index      = 0;
+	uint8_t bit_buffer_size       = 0;
+	uint8_t number_of_bits        = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	for( frequency_index = 0;
+	     frequency_index < ( ASSORTED_LZFSE_NUMBER_OF_L_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_M_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_D_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_LITERAL_SYMBOLS );
+	     frequency_index++ )
+	{
+		while( ( compressed_data_offset < compressed_data_size )
+		    && ( bit_buffer_size <= 24 ) )
+		{
+			bit_buffer      |= (uint32_t) compressed_data[ compressed_data_offset++ ] << bit_buffer_size;
+			bit_buffer_size += 8;
+		}
+		number_of_bits = assorted_lzfse_frequency_number_of_bits[ bit_buffer & 0x1f ];
+
+		if( number_of_bits > bit_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid frequency: %" PRIu16 " value exceeds compressed data size.",
+			 function,
+			 frequency_index );
+
+			return( -1 );
+		}
+		if( number_of_bits == 8 )
+		{
+			frequencies[ frequency_index ] = (uint16_t) ( 8 + ( ( bit_buffer >> 4 ) & 0x000f ) );
+		}
+		else if( number_of_bits == 14 )
+		{
+			frequencies[ frequency_index ] = (uint16_t) ( 24 + ( ( bit_buffer >> 4 ) & 0x03ff ) );
+		}
+		else
+		{
+			frequencies[ frequency_index ] = assorted_lzfse_frequency_values[ bit_buffer & 0x1f ];
+		}
+		bit_buffer     >>= number_of_bits;
+		bit_buffer_size -= number_of_bits;
+	}
+	if( ( bit_buffer_size >= 8 )
+	 || ( compressed_data_offset != compressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid frequency tables size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Entropy decodes the literals and matches of a compressed (version 2) block
+ * The decoding only depends on the block data, hence blocks can be decoded independently
+ * Other types of blocks are not decoded
+ * The result is stored in the block
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzfse_decode_block(
+     assorted_lzfse_block_t *block,
+     libcerror_error_t **error )
+{
+	assorted_lzfse_decoder_entry_t literal_decoder_table[ ASSORTED_LZFSE_NUMBER_OF_LITERAL_STATES ];
+	assorted_lzfse_value_decoder_entry_t d_decoder_table[ ASSORTED_LZFSE_NUMBER_OF_D_STATES ];
+	assorted_lzfse_value_decoder_entry_t l_decoder_table[ ASSORTED_LZFSE_NUMBER_OF_L_STATES ];
+	assorted_lzfse_value_decoder_entry_t m_decoder_table[ ASSORTED_LZFSE_NUMBER_OF_M_STATES ];
+	uint16_t frequencies[ ASSORTED_LZFSE_NUMBER_OF_L_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_M_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_D_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint16_t literal_states[ 4 ];
+
+	assorted_lzfse_bit_stream_t bit_stream;
+
+	const uint8_t *payload_data       = NULL;
+	static char *function             = "assorted_lzfse_decode_block";
+	size_t header_size                = 0;
+	size_t literal_index              = 0;
+	size_t literal_payload_size       = 0;
+	size_t lmd_payload_size           = 0;
+	size_t match_index                = 0;
+	uint64_t packed_fields1           = 0;
+	uint64_t packed_fields2           = 0;
+	uint64_t packed_fields3           = 0;
+	uint32_t distance                 = 0;
+	uint32_t value_32bit              = 0;
+	uint16_t d_state                  = 0;
+	uint16_t l_state                  = 0;
+	uint16_t literal_state            = 0;
+	uint16_t m_state                  = 0;
+	uint8_t state_index               = 0;
+	int literal_bits                  = 0;
+	int lmd_bits                      = 0;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	assorted_lzfse_block_clear(
+	 block );
+
+	block->result = -1;
+
+	if( block->block_type != ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V2 )
+	{
+		block->result = 1;
+
+		return( 1 );
+	}
+	if( ( block->compressed_data == NULL )
+	 || ( block->compressed_data_size < ASSORTED_LZFSE_COMPRESSED_V2_BLOCK_HEADER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block - missing compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( block->compressed_data[ 8 ] ),
+	 packed_fields1 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( block->compressed_data[ 16 ] ),
+	 packed_fields2 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( block->compressed_data[ 24 ] ),
+	 packed_fields3 );
+
+	block->number_of_literals = (size_t) ( packed_fields1 & 0x000fffffUL );
+	literal_payload_size      = (size_t) ( ( packed_fields1 >> 20 ) & 0x000fffffUL );
+	block->number_of_matches  = (size_t) ( ( packed_fields1 >> 40 ) & 0x000fffffUL );
+	literal_bits              = (int) ( ( packed_fields1 >> 60 ) & 0x07 ) - 7;
+
+	for( state_index = 0;
+	     state_index < 4;
+	     state_index++ )
+	{
+		literal_states[ state_index ] = (uint16_t) ( ( packed_fields2 >> ( state_index * 10 ) ) & 0x03ff );
+	}
+	lmd_payload_size = (size_t) ( ( packed_fields2 >> 40 ) & 0x000fffffUL );
+	lmd_bits         = (int) ( ( packed_fields2 >> 60 ) & 0x07 ) - 7;
+
+	header_size = (size_t) ( packed_fields3 & 0xffffffffUL );
+	l_state     = (uint16_t) ( ( packed_fields3 >> 32 ) & 0x03ff );
+	m_state     = (uint16_t) ( ( packed_fields3 >> 42 ) & 0x03ff );
+	d_state     = (uint16_t) ( ( packed_fields3 >> 52 ) & 0x03ff );
+
+	if( ( header_size < ASSORTED_LZFSE_COMPRESSED_V2_BLOCK_HEADER_SIZE )
+	 || ( header_size > block->compressed_data_size )
+	 || ( literal_payload_size > ( block->compressed_data_size - header_size ) )
+	 || ( lmd_payload_size > ( block->compressed_data_size - header_size - literal_payload_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block payload size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( l_state >= ASSORTED_LZFSE_NUMBER_OF_L_STATES )
+	 || ( m_state >= ASSORTED_LZFSE_NUMBER_OF_M_STATES )
+	 || ( d_state >= ASSORTED_LZFSE_NUMBER_OF_D_STATES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initial state value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     frequencies,
+	     0,
+	     sizeof( uint16_t ) * ( ASSORTED_LZFSE_NUMBER_OF_L_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_M_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_D_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_LITERAL_SYMBOLS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frequencies.",
+		 function );
+
+		goto on_error;
+	}
+	if( header_size > ASSORTED_LZFSE_COMPRESSED_V2_BLOCK_HEADER_SIZE )
+	{
+		if( assorted_lzfse_read_frequencies(
+		     &( block->compressed_data[ ASSORTED_LZFSE_COMPRESSED_V2_BLOCK_HEADER_SIZE ] ),
+		     header_size - ASSORTED_LZFSE_COMPRESSED_V2_BLOCK_HEADER_SIZE,
+		     frequencies,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read frequencies.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( assorted_lzfse_build_value_decoder_table(
+	     ASSORTED_LZFSE_NUMBER_OF_L_STATES,
+	     ASSORTED_LZFSE_NUMBER_OF_L_SYMBOLS,
+	     frequencies,
+	     assorted_lzfse_l_value_bits,
+	     assorted_lzfse_l_value_base,
+	     l_decoder_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build L decoder table.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzfse_build_value_decoder_table(
+	     ASSORTED_LZFSE_NUMBER_OF_M_STATES,
+	     ASSORTED_LZFSE_NUMBER_OF_M_SYMBOLS,
+	     &( frequencies[ ASSORTED_LZFSE_NUMBER_OF_L_SYMBOLS ] ),
+	     assorted_lzfse_m_value_bits,
+	     assorted_lzfse_m_value_base,
+	     m_decoder_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build M decoder table.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzfse_build_value_decoder_table(
+	     ASSORTED_LZFSE_NUMBER_OF_D_STATES,
+	     ASSORTED_LZFSE_NUMBER_OF_D_SYMBOLS,
+	     &( frequencies[ ASSORTED_LZFSE_NUMBER_OF_L_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_M_SYMBOLS ] ),
+	     assorted_lzfse_d_value_bits,
+	     assorted_lzfse_d_value_base,
+	     d_decoder_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build D decoder table.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzfse_build_decoder_table(
+	     ASSORTED_LZFSE_NUMBER_OF_LITERAL_STATES,
+	     ASSORTED_LZFSE_NUMBER_OF_LITERAL_SYMBOLS,
+	     &( frequencies[ ASSORTED_LZFSE_NUMBER_OF_L_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_M_SYMBOLS + ASSORTED_LZFSE_NUMBER_OF_D_SYMBOLS ] ),
+	     literal_decoder_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literal decoder table.",
+		 function );
+
+		goto on_error;
+	}
+	payload_data = &( block->compressed_data[ header_size ] );
+
+	/* The literals are decoded in groups of 4 with 4 interleaved states
+	 */
+	block->literals = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ( ( block->number_of_literals + 3 ) & ~( (size_t) 3 ) ) + 1 );
+
+	if( block->literals == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create literals.",
+		 function );
+
+		goto on_error;
+	}
+	if( block->number_of_literals > 0 )
+	{
+		for( state_index = 0;
+		     state_index < 4;
+		     state_index++ )
+		{
+			if( literal_states[ state_index ] >= ASSORTED_LZFSE_NUMBER_OF_LITERAL_STATES )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid literal state: %" PRIu8 " value out of bounds.",
+				 function,
+				 state_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_lzfse_bit_stream_initialize(
+		     &bit_stream,
+		     payload_data,
+		     literal_payload_size,
+		     literal_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize literals bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		for( literal_index = 0;
+		     literal_index < block->number_of_literals;
+		     literal_index += 4 )
+		{
+			if( assorted_lzfse_bit_stream_refill(
+			     &bit_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to refill literals bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			/* A refill provides at least 56 bits and 4 literals use at most 40 bits
+			 */
+			for( state_index = 0;
+			     state_index < 4;
+			     state_index++ )
+			{
+				literal_state = literal_states[ state_index ];
+
+				assorted_lzfse_bit_stream_get_bits(
+				 &bit_stream,
+				 literal_decoder_table[ literal_state ].number_of_bits,
+				 value_32bit )
+
+				block->literals[ literal_index + state_index ] = literal_decoder_table[ literal_state ].symbol;
+
+				literal_states[ state_index ] = (uint16_t) ( literal_decoder_table[ literal_state ].delta + (int32_t) value_32bit );
+			}
+		}
+	}
+	if( block->number_of_matches > 0 )
+	{
+		if( block->number_of_matches > (size_t) ( SSIZE_MAX / sizeof( assorted_lzfse_match_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of matches value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		block->matches = (assorted_lzfse_match_t *) memory_allocate(
+		                                             sizeof( assorted_lzfse_match_t ) * block->number_of_matches );
+
+		if( block->matches == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create matches.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_lzfse_bit_stream_initialize(
+		     &bit_stream,
+		     &( payload_data[ literal_payload_size ] ),
+		     lmd_payload_size,
+		     lmd_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize matches bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		for( match_index = 0;
+		     match_index < block->number_of_matches;
+		     match_index++ )
+		{
+			if( assorted_lzfse_bit_stream_refill(
+			     &bit_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to refill matches bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			/* A refill provides at least 56 bits and the L, M and D values use at most 54 bits
+			 */
+			assorted_lzfse_decode_value(
+			 &bit_stream,
+			 l_decoder_table,
+			 l_state,
+			 block->matches[ match_index ].literal_size,
+			 value_32bit )
+
+			assorted_lzfse_decode_value(
+			 &bit_stream,
+			 m_decoder_table,
+			 m_state,
+			 block->matches[ match_index ].match_size,
+			 value_32bit )
+
+			assorted_lzfse_decode_value(
+			 &bit_stream,
+			 d_decoder_table,
+			 d_state,
+			 block->matches[ match_index ].distance,
+			 value_32bit )
+
+			/* A distance of 0 repeats the distance of the previous match
+			 */
+			if( block->matches[ match_index ].distance == 0 )
+			{
+				block->matches[ match_index ].distance = distance;
+			}
+			distance = block->matches[ match_index ].distance;
+		}
+	}
+	block->result = 1;
+
+	return( 1 );
+
+on_error:
+	assorted_lzfse_block_clear(
+	 block );
+
+	block->result = -1;
+
+	return( -1 );
+}
+
+/* Entropy decodes blocks
+ * The result of every block is stored in the block
+ * Returns 1 if all blocks were decoded, 0 if not or -1 on error
+ */
+int assorted_lzfse_decode_blocks(
+     assorted_lzfse_block_t *blocks,
+     size_t number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzfse_decode_blocks";
+	size_t block_index    = 0;
+	int result            = 1;
+
+	if( blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks > (size_t) ( SSIZE_MAX / sizeof( assorted_lzfse_block_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of blocks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( assorted_lzfse_decode_block(
+		     &( blocks[ block_index ] ),
+		     NULL ) != 1 )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+/* Frees the decoded literals and matches of a block
+ */
+void assorted_lzfse_block_clear(
+      assorted_lzfse_block_t *block )
+{
+	if( block == NULL )
+	{
+		return;
+	}
+	if( block->literals != NULL )
+	{
+		memory_free(
+		 block->literals );
+
+		block->literals = NULL;
+	}
+	if( block->matches != NULL )
+	{
+		memory_free(
+		 block->matches );
+
+		block->matches = NULL;
+	}
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Entropy decodes a block from a thread pool
+ * The error is not available from the worker thread, the result is stored in the block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfse_decode_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_lzfse_block_t *block = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	block = (assorted_lzfse_block_t *) value;
+
+	assorted_lzfse_decode_block(
+	 block,
+	 NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Copies the literals and matches of a decoded block into the uncompressed data
+ * Matches can refer to the uncompressed data of preceding blocks, hence blocks
+ * are copied in order
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfse_copy_block(
+     assorted_lzfse_block_t *block,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_lzfse_copy_block";
+	size_t literal_index            = 0;
+	size_t literal_size             = 0;
+	size_t match_index              = 0;
+	size_t match_offset             = 0;
+	size_t match_size               = 0;
+	size_t uncompressed_data_end    = 0;
+	size_t uncompressed_data_offset = 0;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( block->result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block - not decoded.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size > (size_t) SSIZE_MAX )
+	 || ( block->uncompressed_data_offset > uncompressed_data_size )
+	 || ( block->uncompressed_data_size > ( uncompressed_data_size - block->uncompressed_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_data_offset = block->uncompressed_data_offset;
+	uncompressed_data_end    = uncompressed_data_offset + block->uncompressed_data_size;
+
+	switch( block->block_type )
+	{
+		case ASSORTED_LZFSE_BLOCK_TYPE_UNCOMPRESSED:
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( block->compressed_data[ 8 ] ),
+			     block->uncompressed_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed block data.",
+				 function );
+
+				return( -1 );
+			}
+			uncompressed_data_offset = uncompressed_data_end;
+
+			break;
+
+		case ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_LZVN:
+			if( assorted_lzvn_decompress_block(
+			     &( block->compressed_data[ 12 ] ),
+			     block->compressed_data_size - 12,
+			     uncompressed_data,
+			     uncompressed_data_end,
+			     &uncompressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress LZVN compressed block.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V2:
+			for( match_index = 0;
+			     match_index < block->number_of_matches;
+			     match_index++ )
+			{
+				literal_size = (size_t) block->matches[ match_index ].literal_size;
+				match_size   = (size_t) block->matches[ match_index ].match_size;
+
+				if( ( literal_size > ( block->number_of_literals - literal_index ) )
+				 || ( literal_size > ( uncompressed_data_end - uncompressed_data_offset ) )
+				 || ( match_size > ( uncompressed_data_end - uncompressed_data_offset - literal_size ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid match: %" PRIzd " size value out of bounds.",
+					 function,
+					 match_index );
+
+					return( -1 );
+				}
+				if( literal_size > 0 )
+				{
+					memory_copy(
+					 &( uncompressed_data[ uncompressed_data_offset ] ),
+					 &( block->literals[ literal_index ] ),
+					 literal_size );
+
+					literal_index            += literal_size;
+					uncompressed_data_offset += literal_size;
+				}
+				if( match_size > 0 )
+				{
+					if( ( block->matches[ match_index ].distance == 0 )
+					 || ( (size_t) block->matches[ match_index ].distance > uncompressed_data_offset ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid match: %" PRIzd " distance value out of bounds.",
+						 function,
+						 match_index );
+
+						return( -1 );
+					}
+					match_offset = uncompressed_data_offset - (size_t) block->matches[ match_index ].distance;
+
+					/* A match that overlaps with its own output is copied per byte
+					 */
+					if( (size_t) block->matches[ match_index ].distance >= match_size )
+					{
+						memory_copy(
+						 &( uncompressed_data[ uncompressed_data_offset ] ),
+						 &( uncompressed_data[ match_offset ] ),
+						 match_size );
+
+						uncompressed_data_offset += match_size;
+					}
+					else
+					{
+						while( match_size > 0 )
+						{
+							uncompressed_data[ uncompressed_data_offset++ ] = uncompressed_data[ match_offset++ ];
+
+							match_size--;
+						}
+					}
+				}
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( uncompressed_data_offset != uncompressed_data_end )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in block uncompressed size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses LZFSE compressed data
+ * The block headers are walked first to determine the compressed data and
+ * uncompressed data offset of every block. The entropy decoding of the literals
+ * and matches of compressed blocks is independent per block and done in parallel,
+ * the matches can refer to preceding blocks and are copied in order afterwards.
+ * The blocks are processed in batches to bound the memory used by decoded blocks
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfse_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	assorted_lzfse_block_t *blocks         = NULL;
+	static char *function                  = "assorted_lzfse_decompress";
+	size_t batch_block_index               = 0;
+	size_t batch_size                      = 0;
+	size_t block_index                     = 0;
+	size_t number_of_batch_blocks          = 0;
+	size_t number_of_blocks                = 0;
+	size_t safe_uncompressed_data_size     = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+#endif
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzfse_get_number_of_blocks(
+	     compressed_data,
+	     compressed_data_size,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == 0 )
+	{
+		*uncompressed_data_size = 0;
+
+		return( 1 );
+	}
+	if( number_of_blocks > (size_t) ( SSIZE_MAX / sizeof( assorted_lzfse_block_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of blocks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	blocks = (assorted_lzfse_block_t *) memory_allocate(
+	                                     sizeof( assorted_lzfse_block_t ) * number_of_blocks );
+
+	if( blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzfse_get_blocks(
+	     compressed_data,
+	     compressed_data_size,
+	     blocks,
+	     number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve blocks.",
+		 function );
+
+		memory_free(
+		 blocks );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = blocks[ number_of_blocks - 1 ].uncompressed_data_offset
+	                            + blocks[ number_of_blocks - 1 ].uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > *uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	batch_size = (size_t) number_of_threads * ASSORTED_LZFSE_MAXIMUM_NUMBER_OF_BLOCKS_PER_THREAD;
+
+	for( batch_block_index = 0;
+	     batch_block_index < number_of_blocks;
+	     batch_block_index += number_of_batch_blocks )
+	{
+		number_of_batch_blocks = number_of_blocks - batch_block_index;
+
+		if( number_of_batch_blocks > batch_size )
+		{
+			number_of_batch_blocks = batch_size;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( number_of_threads > 1 )
+		 && ( number_of_batch_blocks > 1 ) )
+		{
+			if( assorted_thread_pool_create(
+			     &thread_pool,
+			     number_of_threads,
+			     (int) number_of_batch_blocks,
+			     (int (*)(intptr_t *, void *)) &assorted_lzfse_decode_task_callback,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( block_index = batch_block_index;
+			     block_index < ( batch_block_index + number_of_batch_blocks );
+			     block_index++ )
+			{
+				if( blocks[ block_index ].block_type != ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V2 )
+				{
+					continue;
+				}
+				if( assorted_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( blocks[ block_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push block: %" PRIzd " onto thread pool queue.",
+					 function,
+					 block_index );
+
+					goto on_error;
+				}
+			}
+			if( assorted_thread_pool_join(
+			     &thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		/* Without a thread pool the blocks are decoded here, a block that failed
+		 * to decode is decoded again to retrieve the error
+		 */
+		for( block_index = batch_block_index;
+		     block_index < ( batch_block_index + number_of_batch_blocks );
+		     block_index++ )
+		{
+			if( blocks[ block_index ].result != 1 )
+			{
+				if( assorted_lzfse_decode_block(
+				     &( blocks[ block_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decode block: %" PRIzd ".",
+					 function,
+					 block_index );
+
+					goto on_error;
+				}
+			}
+			if( assorted_lzfse_copy_block(
+			     &( blocks[ block_index ] ),
+			     uncompressed_data,
+			     *uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress block: %" PRIzd ".",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+			assorted_lzfse_block_clear(
+			 &( blocks[ block_index ] ) );
+		}
+	}
+	memory_free(
+	 blocks );
+
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( blocks != NULL )
+	{
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			assorted_lzfse_block_clear(
+			 &( blocks[ block_index ] ) );
+		}
+		memory_free(
+		 blocks );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,279 @@
+/*
+ * LZFSE decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_LZFSE_H )
+#define _ASSORTED_LZFSE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The block types, stored as the signature of the block
+ */
+enum ASSORTED_LZFSE_BLOCK_TYPES
+{
+	ASSORTED_LZFSE_BLOCK_TYPE_END_OF_STREAM		= 0x24787662UL,
+	ASSORTED_LZFSE_BLOCK_TYPE_UNCOMPRESSED		= 0x2d787662UL,
+	ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V1		= 0x31787662UL,
+	ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V2		= 0x32787662UL,
+	ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_LZVN	= 0x6e787662UL
+};
+
+/* The size of the compressed (version 2) block header without the frequency tables
+ */
+#define ASSORTED_LZFSE_COMPRESSED_V2_BLOCK_HEADER_SIZE	32
+
+/* The number of symbols and states of the entropy encoded values
+ */
+#define ASSORTED_LZFSE_NUMBER_OF_L_SYMBOLS		20
+#define ASSORTED_LZFSE_NUMBER_OF_M_SYMBOLS		20
+#define ASSORTED_LZFSE_NUMBER_OF_D_SYMBOLS		64
+#define ASSORTED_LZFSE_NUMBER_OF_LITERAL_SYMBOLS	256
+
+#define ASSORTED_LZFSE_NUMBER_OF_L_STATES		64
+#define ASSORTED_LZFSE_NUMBER_OF_M_STATES		64
+#define ASSORTED_LZFSE_NUMBER_OF_D_STATES		256
+#define ASSORTED_LZFSE_NUMBER_OF_LITERAL_STATES		1024
+
+/* The maximum number of blocks that are entropy decoded before their matches are copied
+ */
+#define ASSORTED_LZFSE_MAXIMUM_NUMBER_OF_BLOCKS_PER_THREAD	4
+
+typedef struct assorted_lzfse_bit_stream assorted_lzfse_bit_stream_t;
+
+struct assorted_lzfse_bit_stream
+{
+	/* The data, that is read from back to front
+	 */
+	const uint8_t *data;
+
+	/* The data offset of the bytes that have not been read
+	 */
+	size_t data_offset;
+
+	/* The bit buffer
+	 */
+	uint64_t bit_buffer;
+
+	/* The number of bits in the bit buffer
+	 */
+	int bit_buffer_size;
+};
+
+typedef struct assorted_lzfse_decoder_entry assorted_lzfse_decoder_entry_t;
+
+struct assorted_lzfse_decoder_entry
+{
+	/* The number of bits to read for the next state
+	 */
+	int8_t number_of_bits;
+
+	/* The symbol
+	 */
+	uint8_t symbol;
+
+	/* The delta of the next state
+	 */
+	int16_t delta;
+};
+
+typedef struct assorted_lzfse_value_decoder_entry assorted_lzfse_value_decoder_entry_t;
+
+struct assorted_lzfse_value_decoder_entry
+{
+	/* The number of bits to read for the next state and the value
+	 */
+	uint8_t number_of_bits;
+
+	/* The number of value bits
+	 */
+	uint8_t number_of_value_bits;
+
+	/* The delta of the next state
+	 */
+	int16_t delta;
+
+	/* The base of the value
+	 */
+	int32_t value_base;
+};
+
+typedef struct assorted_lzfse_match assorted_lzfse_match_t;
+
+struct assorted_lzfse_match
+{
+	/* The number of literals that precede the match
+	 */
+	uint32_t literal_size;
+
+	/* The size of the match
+	 */
+	uint32_t match_size;
+
+	/* The distance of the match
+	 */
+	uint32_t distance;
+};
+
+typedef struct assorted_lzfse_block assorted_lzfse_block_t;
+
+struct assorted_lzfse_block
+{
+	/* The block type
+	 */
+	uint32_t block_type;
+
+	/* The compressed data, including the block header
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size, including the block header
+	 */
+	size_t compressed_data_size;
+
+	/* The offset of the block in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The decoded literals of a compressed (version 2) block
+	 */
+	uint8_t *literals;
+
+	/* The number of literals
+	 */
+	size_t number_of_literals;
+
+	/* The decoded matches of a compressed (version 2) block
+	 */
+	assorted_lzfse_match_t *matches;
+
+	/* The number of matches
+	 */
+	size_t number_of_matches;
+
+	/* The result of the block decoding, 0 if not decoded
+	 */
+	int result;
+};
+
+int assorted_lzfse_bit_stream_initialize(
+     assorted_lzfse_bit_stream_t *bit_stream,
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_bits,
+     libcerror_error_t **error );
+
+int assorted_lzfse_bit_stream_refill(
+     assorted_lzfse_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
+int assorted_lzfse_read_block_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint32_t *block_type,
+     size_t *block_size,
+     size_t *uncompressed_block_size,
+     libcerror_error_t **error );
+
+int assorted_lzfse_get_number_of_blocks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *number_of_blocks,
+     libcerror_error_t **error );
+
+int assorted_lzfse_get_blocks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     assorted_lzfse_block_t *blocks,
+     size_t number_of_blocks,
+     libcerror_error_t **error );
+
+int assorted_lzfse_build_decoder_table(
+     uint16_t number_of_states,
+     uint16_t number_of_symbols,
+     const uint16_t *frequencies,
+     assorted_lzfse_decoder_entry_t *decoder_table,
+     libcerror_error_t **error );
+
+int assorted_lzfse_build_value_decoder_table(
+     uint16_t number_of_states,
+     uint16_t number_of_symbols,
+     const uint16_t *frequencies,
+     const uint8_t *value_bits,
+     const int32_t *value_base,
+     assorted_lzfse_value_decoder_entry_t *decoder_table,
+     libcerror_error_t **error );
+
+int assorted_lzfse_read_frequencies(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *frequencies,
+     libcerror_error_t **error );
+
+int assorted_lzfse_decode_block(
+     assorted_lzfse_block_t *block,
+     libcerror_error_t **error );
+
+int assorted_lzfse_decode_blocks(
+     assorted_lzfse_block_t *blocks,
+     size_t number_of_blocks,
+     libcerror_error_t **error );
+
+void assorted_lzfse_block_clear(
+      assorted_lzfse_block_t *block );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_lzfse_decode_task_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_lzfse_copy_block(
+     assorted_lzfse_block_t *block,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_lzfse_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_LZFSE_H ) */
+
@@ -32,13 +32,34 @@
 #define ASSORTED_LZFU_SIGNATURE_COMPRESSED        0x75465a4c
 #define ASSORTED_LZFU_SIGNATURE_UNCOMPRESSED      0x414c454d
 
-const char *assorted_lzfu_rtf_dictionary = \
+/* The size of the RTF dictionary without the padding
+ */
+#define ASSORTED_LZFU_RTF_DICTIONARY_SIZE         207
+
+/* The RTF dictionary that pre-seeds the lz buffer, padded with zero bytes
+ * to the size of the lz buffer so that the lz buffer is initialized with a single copy
+ */
+const uint8_t assorted_lzfu_rtf_dictionary[ 4096 ] = \
 	"{\\rtf1\\ansi\\mac\\deff0\\deftab720"
 	"{\\fonttbl;}"
 	"{\\f0\\fnil \\froman \\fswiss \\fmodern \\fscript \\fdecor MS Sans SerifSymbolArialTimes New RomanCourier"
 	"{\\colortbl\\red0\\green0\\blue0\r\n\\par \\pard\\plain\\f0\\fs20\\b\\i\\u\\tab\\tx";
 
+#define ASSORTED_LZFU_COMPRESSOR_HASH_TABLE_BITS	12
+#define ASSORTED_LZFU_COMPRESSOR_MAXIMUM_CHAIN_LENGTH	32
+
+/* Retrieves the byte at an offset in the RTF dictionary followed by the uncompressed data
+ */
+#define assorted_lzfu_compressor_get_byte( data, offset ) \
+	( ( ( offset ) < ASSORTED_LZFU_RTF_DICTIONARY_SIZE ) ? assorted_lzfu_rtf_dictionary[ offset ] : ( data )[ ( offset ) - ASSORTED_LZFU_RTF_DICTIONARY_SIZE ] )
+
+/* Calculates the hash value of 3 bytes
+ */
+#define assorted_lzfu_compressor_get_hash_value( byte_value1, byte_value2, byte_value3 ) \
+	( ( (uint32_t) ( ( (uint32_t) ( byte_value1 ) | ( (uint32_t) ( byte_value2 ) << 8 ) | ( (uint32_t) ( byte_value3 ) << 16 ) ) * (uint32_t) 0x9e3779b1UL ) ) >> ( 32 - ASSORTED_LZFU_COMPRESSOR_HASH_TABLE_BITS ) )
+
 /* Determines the uncompressed data size from the LZFu header in the compressed data
+ * The uncompressed data size includes the 2 trailing zero bytes of the end marker
  * Return 1 on success or -1 on error
  */
 int assorted_lzfu_get_uncompressed_data_size(
@@ -49,20 +70,113 @@ int assorted_lzfu_get_uncompressed_data_size(
 {
 	assorted_lzfu_header_t lzfu_header;
 
-	uint8_t *lzfu_data                = 0;
-	static char *function             = "lzfu_get_uncompressed_data_size";
+	static char *function = "lzfu_get_uncompressed_data_size";
 
-	uint8_t lz_buffer[ 4096 ];
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < sizeof( assorted_lzfu_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 4 ] ),
+	 lzfu_header.uncompressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 8 ] ),
+	 lzfu_header.signature );
+
+	if( ( lzfu_header.signature != ASSORTED_LZFU_SIGNATURE_COMPRESSED )
+	 && ( lzfu_header.signature != ASSORTED_LZFU_SIGNATURE_UNCOMPRESSED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
+		 function,
+		 lzfu_header.signature );
+
+		return( -1 );
+	}
+	/* Compensate for the 2 trailing zero bytes
+	 */
+	*uncompressed_data_size = (size_t) lzfu_header.uncompressed_data_size + 2;
+
+	return( 1 );
+}
 
-	uint8_t *lzfu_reference_data      = 0;
-	size_t compressed_data_iterator   = 0;
-	size_t uncompressed_data_iterator = 0;
-	uint16_t lz_buffer_iterator       = 0;
-	uint16_t reference_offset         = 0;
-	uint16_t reference_size           = 0;
-	uint16_t reference_iterator       = 0;
-	uint8_t flag_byte_bit_mask        = 0;
-	uint8_t flag_byte                 = 0;
+/* Compresses data using LZFu compression
+ * The lz buffer is pre-seeded with the RTF dictionary and matches are found
+ * using hash chains of 3-byte sequences. The CRC of the compressed data is
+ * calculated per run of 8 literals and references, when its flag byte is final
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfu_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	uint32_t chain_table[ 4096 ];
+	uint32_t hash_table[ 1 << ASSORTED_LZFU_COMPRESSOR_HASH_TABLE_BITS ];
+
+	static char *function            = "lzfu_compress";
+	size_t compressed_data_offset    = 0;
+	size_t flag_byte_offset          = 0;
+	size_t insert_offset             = 0;
+	size_t maximum_match_size        = 0;
+	size_t match_offset              = 0;
+	size_t match_size                = 0;
+	size_t safe_compressed_data_size = 0;
+	size_t uncompressed_data_offset  = 0;
+	uint32_t best_match_offset       = 0;
+	uint32_t calculated_crc          = 0;
+	uint32_t chain_offset            = 0;
+	uint32_t hash_value              = 0;
+	uint16_t best_match_size         = 0;
+	uint16_t chain_length            = 0;
+	uint16_t reference               = 0;
+	uint8_t flag_byte_bit_mask       = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -75,7 +189,20 @@ int assorted_lzfu_get_uncompressed_data_size(
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_size = *compressed_data_size;
+
+	if( safe_compressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
@@ -86,6 +213,334 @@ int assorted_lzfu_get_uncompressed_data_size(
 
 		return( -1 );
 	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sizes in the header and the offsets in the hash chains are 32-bit
+	 */
+	if( uncompressed_data_size > (size_t) ( UINT32_MAX - ASSORTED_LZFU_RTF_DICTIONARY_SIZE - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_compressed_data_size < sizeof( assorted_lzfu_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * ( 1 << ASSORTED_LZFU_COMPRESSOR_HASH_TABLE_BITS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chain table does not need to be cleared since only entries
+	 * of offsets that were added are read
+	 */
+
+	/* Offsets in the hash chains are relative to the start of the RTF dictionary
+	 * and stored + 1 so that 0 represents an empty entry
+	 */
+	for( insert_offset = 0;
+	     insert_offset < ( ASSORTED_LZFU_RTF_DICTIONARY_SIZE - 2 );
+	     insert_offset++ )
+	{
+		hash_value = assorted_lzfu_compressor_get_hash_value(
+		              assorted_lzfu_rtf_dictionary[ insert_offset ],
+		              assorted_lzfu_rtf_dictionary[ insert_offset + 1 ],
+		              assorted_lzfu_rtf_dictionary[ insert_offset + 2 ] );
+
+		chain_table[ insert_offset & 0x0fff ] = hash_table[ hash_value ];
+		hash_table[ hash_value ]              = (uint32_t) ( insert_offset + 1 );
+	}
+	compressed_data_offset = sizeof( assorted_lzfu_header_t );
+	flag_byte_offset       = compressed_data_offset;
+	flag_byte_bit_mask     = 0;
+	insert_offset          = ASSORTED_LZFU_RTF_DICTIONARY_SIZE - 2;
+
+	/* The last iteration adds the end marker reference
+	 */
+	while( uncompressed_data_offset <= uncompressed_data_size )
+	{
+		if( flag_byte_bit_mask == 0 )
+		{
+			if( compressed_data_offset > flag_byte_offset )
+			{
+				if( assorted_crc32_calculate(
+				     &calculated_crc,
+				     &( compressed_data[ flag_byte_offset ] ),
+				     compressed_data_offset - flag_byte_offset,
+				     calculated_crc,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to calculate weak CRC.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( compressed_data_offset >= safe_compressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			flag_byte_offset   = compressed_data_offset++;
+			flag_byte_bit_mask = 0x01;
+
+			compressed_data[ flag_byte_offset ] = 0;
+		}
+		best_match_size = 0;
+
+		if( uncompressed_data_offset == uncompressed_data_size )
+		{
+			/* The end marker is a reference to the current lz buffer offset
+			 */
+			best_match_offset = (uint32_t) ( uncompressed_data_offset + ASSORTED_LZFU_RTF_DICTIONARY_SIZE );
+			best_match_size   = 2;
+		}
+		else if( ( uncompressed_data_offset + 3 ) <= uncompressed_data_size )
+		{
+			match_offset = uncompressed_data_offset + ASSORTED_LZFU_RTF_DICTIONARY_SIZE;
+
+			/* Add the offsets up to and including the current offset to the hash chains
+			 */
+			while( insert_offset <= match_offset )
+			{
+				hash_value = assorted_lzfu_compressor_get_hash_value(
+				              assorted_lzfu_compressor_get_byte( uncompressed_data, insert_offset ),
+				              assorted_lzfu_compressor_get_byte( uncompressed_data, insert_offset + 1 ),
+				              assorted_lzfu_compressor_get_byte( uncompressed_data, insert_offset + 2 ) );
+
+				chain_offset = hash_table[ hash_value ];
+
+				chain_table[ insert_offset & 0x0fff ] = chain_offset;
+				hash_table[ hash_value ]              = (uint32_t) ( insert_offset + 1 );
+
+				insert_offset++;
+			}
+			maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+
+			if( maximum_match_size > 17 )
+			{
+				maximum_match_size = 17;
+			}
+			chain_length = ASSORTED_LZFU_COMPRESSOR_MAXIMUM_CHAIN_LENGTH;
+
+			/* A reference can address the previous 4095 bytes, the lz buffer
+			 * offset of the current byte is reserved for the end marker
+			 */
+			while( ( chain_offset != 0 )
+			    && ( chain_length > 0 ) )
+			{
+				chain_offset -= 1;
+
+				if( ( match_offset - chain_offset ) > 4095 )
+				{
+					break;
+				}
+				/* The bytes of a reference are copied one at a time so the match
+				 * can overlap with the bytes it produces
+				 */
+				match_size = 0;
+
+				while( ( match_size < maximum_match_size )
+				    && ( assorted_lzfu_compressor_get_byte( uncompressed_data, chain_offset + match_size ) == uncompressed_data[ uncompressed_data_offset + match_size ] ) )
+				{
+					match_size++;
+				}
+				if( match_size > best_match_size )
+				{
+					best_match_offset = chain_offset;
+					best_match_size   = (uint16_t) match_size;
+
+					if( match_size == maximum_match_size )
+					{
+						break;
+					}
+				}
+				chain_offset = chain_table[ chain_offset & 0x0fff ];
+
+				chain_length--;
+			}
+			if( best_match_size < 3 )
+			{
+				best_match_size = 0;
+			}
+		}
+		if( best_match_size == 0 )
+		{
+			if( compressed_data_offset >= safe_compressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_data[ compressed_data_offset++ ] = uncompressed_data[ uncompressed_data_offset++ ];
+		}
+		else
+		{
+			if( ( compressed_data_offset + 1 ) >= safe_compressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			reference = (uint16_t) ( ( ( best_match_offset & 0x0fff ) << 4 ) | ( best_match_size - 2 ) );
+
+			byte_stream_copy_from_uint16_big_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 reference );
+
+			compressed_data[ flag_byte_offset ] |= flag_byte_bit_mask;
+			compressed_data_offset              += 2;
+
+			if( uncompressed_data_offset == uncompressed_data_size )
+			{
+				break;
+			}
+			uncompressed_data_offset += best_match_size;
+		}
+		flag_byte_bit_mask <<= 1;
+	}
+	if( assorted_crc32_calculate(
+	     &calculated_crc,
+	     &( compressed_data[ flag_byte_offset ] ),
+	     compressed_data_offset - flag_byte_offset,
+	     calculated_crc,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate weak CRC.",
+		 function );
+
+		return( -1 );
+	}
+	/* The compressed data size in the header includes 12 bytes of the header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 compressed_data,
+	 (uint32_t) ( compressed_data_offset - 4 ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 4 ] ),
+	 (uint32_t) uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 8 ] ),
+	 ASSORTED_LZFU_SIGNATURE_COMPRESSED );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 12 ] ),
+	 calculated_crc );
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses data using LZFu compression
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfu_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t lz_buffer[ 4096 ];
+
+	assorted_lzfu_header_t lzfu_header;
+
+	const uint8_t *lzfu_data           = NULL;
+	const uint8_t *lzfu_reference_data = NULL;
+	static char *function              = "lzfu_decompress";
+	size_t compressed_data_iterator    = 0;
+	size_t flag_byte_offset            = 0;
+	size_t uncompressed_data_iterator  = 0;
+	uint32_t calculated_crc            = 0;
+	uint16_t lz_buffer_iterator        = 0;
+	uint16_t reference_iterator        = 0;
+	uint16_t reference_offset          = 0;
+	uint16_t reference_size            = 0;
+	uint8_t flag_byte                  = 0;
+	uint8_t flag_byte_bit_mask         = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
 	if( uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
@@ -97,6 +552,54 @@ int assorted_lzfu_get_uncompressed_data_size(
 
 		return( -1 );
 	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < sizeof( assorted_lzfu_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     lz_buffer,
+	     assorted_lzfu_rtf_dictionary,
+	     4096 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to initialize lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	lz_buffer_iterator = ASSORTED_LZFU_RTF_DICTIONARY_SIZE;
 	lzfu_data = compressed_data;
 
 	byte_stream_copy_to_uint32_little_endian(
@@ -115,15 +618,43 @@ int assorted_lzfu_get_uncompressed_data_size(
 	 lzfu_data,
 	 lzfu_header.signature );
 
-	lzfu_data += 8;
+	lzfu_data += 4;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 lzfu_data,
+	 lzfu_header.crc );
+
+	lzfu_data += 4;
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: lzfu header compressed data size\t: %" PRIu32 "\n",
+		 function,
+		 lzfu_header.compressed_data_size );
+
+		libcnotify_printf(
+		 "%s: lzfu header uncompressed data size\t: %" PRIu32 "\n",
+		 function,
+		 lzfu_header.uncompressed_data_size );
+
+		libcnotify_printf(
+		 "%s: lzfu header signature\t\t\t: 0x08%" PRIx32 "\n",
+		 function,
+		 lzfu_header.signature );
 
+		libcnotify_printf(
+		 "%s: lzfu header crc\t\t\t: %" PRIu32 "\n",
+		 function,
+		 lzfu_header.crc );
+	}
 	if( ( lzfu_header.signature != ASSORTED_LZFU_SIGNATURE_COMPRESSED )
 	 && ( lzfu_header.signature != ASSORTED_LZFU_SIGNATURE_UNCOMPRESSED ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
 		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
 		 function,
 		 lzfu_header.signature );
@@ -134,62 +665,99 @@ int assorted_lzfu_get_uncompressed_data_size(
 
 	/* The compressed data size includes 12 bytes of the header
 	 */
-	lzfu_header.compressed_data_size -= 12;
-
-#ifdef X
-	if( (size_t) lzfu_header.compressed_data_size != compressed_data_size )
+	if( ( lzfu_header.compressed_data_size < 12 )
+	 || ( (size_t) ( lzfu_header.compressed_data_size - 12 ) > compressed_data_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
-		 "%s: mismatch in compressed data size (%" PRIu32 " != %" PRIzd ").",
-		 function,
-		 lzfu_header.compressed_data_size,
-		 compressed_data_size );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-#endif
-	if( memory_copy(
-	     lz_buffer,
-	     assorted_lzfu_rtf_dictionary,
-	     207 ) == NULL )
+	lzfu_header.compressed_data_size -= 12;
+
+	/* Make sure the uncompressed buffer is large enough
+	 */
+	if( *uncompressed_data_size < lzfu_header.uncompressed_data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to initialize lz buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data too small.",
 		 function );
 
+		*uncompressed_data_size = lzfu_header.uncompressed_data_size;
+
 		return( -1 );
 	}
-	lz_buffer_iterator = 207;
-
-	if( memory_set(
-	     &( lz_buffer[ lz_buffer_iterator ] ),
-	     0,
-	     ( 4096 - lz_buffer_iterator ) ) == NULL )
+	/* Uncompressed data is stored as-is, it is copied and its weak CRC calculated in a single pass
+	 */
+	if( lzfu_header.signature == ASSORTED_LZFU_SIGNATURE_UNCOMPRESSED )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear lz buffer.",
-		 function );
+		if( lzfu_header.uncompressed_data_size > lzfu_header.compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_crc32_copy_calculate(
+		     &calculated_crc,
+		     uncompressed_data,
+		     lzfu_data,
+		     (size_t) lzfu_header.uncompressed_data_size,
+		     0,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy uncompressed data and calculate weak CRC.",
+			 function );
+
+			return( -1 );
+		}
+		/* The CRC of uncompressed data should be 0
+		 */
+		if( ( lzfu_header.crc != 0 )
+		 && ( lzfu_header.crc != calculated_crc ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in crc ( %" PRIu32 " != %" PRIu32 " ).",
+			 function,
+			 lzfu_header.crc,
+			 calculated_crc );
 
-		return( -1 );
+			return( -1 );
+		}
+		*uncompressed_data_size = (size_t) lzfu_header.uncompressed_data_size;
+
+		return( 1 );
 	}
+	/* The CRC is calculated per run of a flag byte and its literals and references
+	 * while the data is still in cache, instead of in a separate pass
+	 */
 	while( compressed_data_iterator < (size_t) lzfu_header.compressed_data_size )
 	{
-		flag_byte = lzfu_data[ compressed_data_iterator++ ];
+		flag_byte_offset = compressed_data_iterator;
+		flag_byte        = lzfu_data[ compressed_data_iterator++ ];
 
 		/* Check every bit in the chunk flag byte from LSB to MSB
 		 */
-		for( flag_byte_bit_mask = 0x01;
-		     flag_byte_bit_mask != 0x00;
-		     flag_byte_bit_mask <<= 1 )
+		for( flag_byte_bit_mask = 0x01; flag_byte_bit_mask != 0x00; flag_byte_bit_mask <<= 1 )
 		{
 			if( compressed_data_iterator == (size_t) lzfu_header.compressed_data_size )
 			{
@@ -199,9 +767,22 @@ int assorted_lzfu_get_uncompressed_data_size(
 			 */
 			if( ( flag_byte & flag_byte_bit_mask ) == 0 )
 			{
-				lz_buffer[ lz_buffer_iterator++ ] = lzfu_data[ compressed_data_iterator ];
+				if( uncompressed_data_iterator >= *uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					*uncompressed_data_size = uncompressed_data_iterator;
+
+					return( -1 );
+				}
+				lz_buffer[ lz_buffer_iterator++ ]                 = lzfu_data[ compressed_data_iterator ];
+				uncompressed_data[ uncompressed_data_iterator++ ] = lzfu_data[ compressed_data_iterator ];
 
-				uncompressed_data_iterator++;
 				compressed_data_iterator++;
 
 				/* Make sure the lz buffer iterator wraps around
@@ -212,6 +793,19 @@ int assorted_lzfu_get_uncompressed_data_size(
 			}
 			else
 			{
+				if( ( compressed_data_iterator + 1 ) >= (size_t) lzfu_header.compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: missing compressed data.",
+					 function );
+
+					*uncompressed_data_size = 0;
+
+					return( -1 );
+				}
 				lzfu_reference_data = &( lzfu_data[ compressed_data_iterator ] );
 
 				compressed_data_iterator += 2;
@@ -223,116 +817,81 @@ int assorted_lzfu_get_uncompressed_data_size(
 				reference_size     = ( reference_offset & 0x000f ) + 2;
 				reference_offset >>= 4;
 
-				for( reference_iterator = 0; reference_iterator < reference_size; reference_iterator++ )
+				if( ( uncompressed_data_iterator + reference_size - 1 ) >= *uncompressed_data_size )
 				{
-					lz_buffer[ lz_buffer_iterator++ ] = lz_buffer[ reference_offset ];
-
-					uncompressed_data_iterator++;
-					reference_offset++;
-
-					/* Make sure the lz buffer iterator and reference offset wrap around
-					 */
-					lz_buffer_iterator %= 4096;
-					reference_offset   %= 4096;
-
-					lz_buffer[ lz_buffer_iterator ] = 0;
-				}
-			}
-		}
-	}
-	if( (size_t) ( lzfu_header.uncompressed_data_size + 2 ) != uncompressed_data_iterator )
-	{
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: mismatch in uncompressed data size (in header: %" PRIu32 " != required: %" PRIzd ").\n",
-			 function,
-			 lzfu_header.uncompressed_data_size + 2,
-			 uncompressed_data_iterator );
-		}
-	}
-	/* Compensate for the 2 trailing zero bytes
-	 */
-	*uncompressed_data_size = lzfu_header.uncompressed_data_size + 2;
-
-	return( 1 );
-}
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
 
-/* Compresses data using LZFu compression
- * Returns 1 on success or -1 on error
- */
-int assorted_lzfu_compress(
-     const uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t *compressed_data_size,
-     libcerror_error_t **error )
-{
-	static char *function = "lzfu_compress";
+					*uncompressed_data_size = uncompressed_data_iterator + reference_size;
 
-	if( compressed_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
-		 function );
+					return( -1 );
+				}
+				for( reference_iterator = 0; reference_iterator < reference_size; reference_iterator++ )
+				{
+					lz_buffer[ lz_buffer_iterator++ ]                 = lz_buffer[ reference_offset ];
+					uncompressed_data[ uncompressed_data_iterator++ ] = lz_buffer[ reference_offset ];
 
-		return( -1 );
-	}
-	if( compressed_data_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data size.",
-		 function );
+					reference_offset++;
 
-		return( -1 );
-	}
-	if( uncompressed_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
-		 function );
+					/* Make sure the lz buffer iterator and reference offset wrap around
+					 */
+					lz_buffer_iterator %= 4096;
+					reference_offset   %= 4096;
 
-		return( -1 );
+					lz_buffer[ lz_buffer_iterator ] = 0;
+				}
+			}
+		}
+		if( assorted_crc32_calculate(
+		     &calculated_crc,
+		     &( lzfu_data[ flag_byte_offset ] ),
+		     compressed_data_iterator - flag_byte_offset,
+		     calculated_crc,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate weak CRC.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( lzfu_header.crc != calculated_crc )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in crc ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 lzfu_header.crc,
+		 calculated_crc );
 
 		return( -1 );
 	}
-/* TODO implement */
-	libcerror_error_set(
-	 error,
-	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-	 LIBCERROR_RUNTIME_ERROR_GENERIC,
-	 "%s: NOT IMPLEMENTED YET",
-	 function );
+	*uncompressed_data_size = uncompressed_data_iterator;
 
-	return( -1 );
+	return( 1 );
 }
 
-/* Decompresses data using LZFu compression
+/* Decompresses data using LZFu compression and passes the uncompressed data to a sink
+ * The uncompressed data is provided to write_function from the lz buffer, in parts
+ * of at most 4096 bytes, so the uncompressed data is never stored as a whole
  * Returns 1 on success or -1 on error
  */
-int assorted_lzfu_decompress(
+int assorted_lzfu_decompress_to_sink(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
+     int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error ),
+     intptr_t *sink,
      libcerror_error_t **error )
 {
 	uint8_t lz_buffer[ 4096 ];
@@ -341,57 +900,60 @@ int assorted_lzfu_decompress(
 
 	const uint8_t *lzfu_data           = NULL;
 	const uint8_t *lzfu_reference_data = NULL;
-	static char *function              = "lzfu_decompress";
+	static char *function              = "assorted_lzfu_decompress_to_sink";
 	size_t compressed_data_iterator    = 0;
-	size_t uncompressed_data_iterator  = 0;
+	size_t flag_byte_offset            = 0;
+	size_t part_size                   = 0;
 	uint32_t calculated_crc            = 0;
 	uint16_t lz_buffer_iterator        = 0;
 	uint16_t reference_iterator        = 0;
 	uint16_t reference_offset          = 0;
 	uint16_t reference_size            = 0;
+	uint16_t write_offset              = 0;
+	uint8_t end_of_data                = 0;
 	uint8_t flag_byte                  = 0;
 	uint8_t flag_byte_bit_mask         = 0;
 
-	if( uncompressed_data == NULL )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( compressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data == NULL )
+	if( compressed_data_size < sizeof( assorted_lzfu_header_t ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( write_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write function.",
 		 function );
 
 		return( -1 );
@@ -399,7 +961,7 @@ int assorted_lzfu_decompress(
 	if( memory_copy(
 	     lz_buffer,
 	     assorted_lzfu_rtf_dictionary,
-	     207 ) == NULL )
+	     4096 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -410,23 +972,9 @@ int assorted_lzfu_decompress(
 
 		return( -1 );
 	}
-	lz_buffer_iterator = 207;
-
-	if( memory_set(
-	     &( lz_buffer[ lz_buffer_iterator ] ),
-	     0,
-	     ( 4096 - lz_buffer_iterator ) ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear lz buffer.",
-		 function );
-
-		return( -1 );
-	}
-	lzfu_data = compressed_data;
+	lz_buffer_iterator = ASSORTED_LZFU_RTF_DICTIONARY_SIZE;
+	write_offset       = ASSORTED_LZFU_RTF_DICTIONARY_SIZE;
+	lzfu_data          = compressed_data;
 
 	byte_stream_copy_to_uint32_little_endian(
 	 lzfu_data,
@@ -452,28 +1000,6 @@ int assorted_lzfu_decompress(
 
 	lzfu_data += 4;
 
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: lzfu header compressed data size\t: %" PRIu32 "\n",
-		 function,
-		 lzfu_header.compressed_data_size );
-
-		libcnotify_printf(
-		 "%s: lzfu header uncompressed data size\t: %" PRIu32 "\n",
-		 function,
-		 lzfu_header.uncompressed_data_size );
-
-		libcnotify_printf(
-		 "%s: lzfu header signature\t\t\t: 0x08%" PRIx32 "\n",
-		 function,
-		 lzfu_header.signature );
-
-		libcnotify_printf(
-		 "%s: lzfu header crc\t\t\t: %" PRIu32 "\n",
-		 function,
-		 lzfu_header.crc );
-	}
 	if( ( lzfu_header.signature != ASSORTED_LZFU_SIGNATURE_COMPRESSED )
 	 && ( lzfu_header.signature != ASSORTED_LZFU_SIGNATURE_UNCOMPRESSED ) )
 	{
@@ -491,77 +1017,113 @@ int assorted_lzfu_decompress(
 
 	/* The compressed data size includes 12 bytes of the header
 	 */
-	lzfu_header.compressed_data_size -= 12;
-
-#ifdef X
-	if( lzfu_header.compressed_data_size != compressed_data_size )
+	if( ( lzfu_header.compressed_data_size < 12 )
+	 || ( (size_t) ( lzfu_header.compressed_data_size - 12 ) > compressed_data_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
-		 "%s: mismatch in compressed data size (%" PRIu32 " != %" PRIzd ").",
-		 function,
-		 lzfu_header.compressed_data_size,
-		 compressed_data_size );
-
-		return( -1 );
-	}
-#endif
-	/* Make sure the uncompressed buffer is large enough
-	 */
-	if( *uncompressed_data_size < lzfu_header.uncompressed_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: uncompressed data too small.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
 		 function );
 
-		*uncompressed_data_size = lzfu_header.uncompressed_data_size;
-
 		return( -1 );
 	}
-	if( assorted_crc32_calculate(
-	     &calculated_crc,
-	     lzfu_data,
-	     (size_t) lzfu_header.compressed_data_size,
-	     0,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to calculate weak CRC.",
-		 function );
+	lzfu_header.compressed_data_size -= 12;
 
-		return( -1 );
-	}
-	if( lzfu_header.crc != calculated_crc )
+	/* Uncompressed data is stored as-is, it is copied to the lz buffer and its
+	 * weak CRC calculated in a single pass, in parts of at most 4096 bytes
+	 */
+	if( lzfu_header.signature == ASSORTED_LZFU_SIGNATURE_UNCOMPRESSED )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
-		 "%s: mismatch in crc ( %" PRIu32 " != %" PRIu32 " ).",
-		 function,
-		 lzfu_header.crc,
-		 calculated_crc );
+		if( lzfu_header.uncompressed_data_size > lzfu_header.compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		while( compressed_data_iterator < (size_t) lzfu_header.uncompressed_data_size )
+		{
+			part_size = (size_t) lzfu_header.uncompressed_data_size - compressed_data_iterator;
 
-		return( -1 );
+			if( part_size > 4096 )
+			{
+				part_size = 4096;
+			}
+			if( assorted_crc32_copy_calculate(
+			     &calculated_crc,
+			     lz_buffer,
+			     &( lzfu_data[ compressed_data_iterator ] ),
+			     part_size,
+			     calculated_crc,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to copy uncompressed data and calculate weak CRC.",
+				 function );
+
+				return( -1 );
+			}
+			if( write_function(
+			     sink,
+			     lz_buffer,
+			     part_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_data_iterator += part_size;
+		}
+		/* The CRC of uncompressed data should be 0
+		 */
+		if( ( lzfu_header.crc != 0 )
+		 && ( lzfu_header.crc != calculated_crc ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in crc ( %" PRIu32 " != %" PRIu32 " ).",
+			 function,
+			 lzfu_header.crc,
+			 calculated_crc );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
-	while( compressed_data_iterator < (size_t) lzfu_header.compressed_data_size )
+	/* The uncompressed data is written to the lz buffer first, the part of
+	 * the lz buffer that was not yet passed to the sink is written every time
+	 * the lz buffer iterator wraps around, before it is overwritten
+	 */
+	while( ( end_of_data == 0 )
+	    && ( compressed_data_iterator < (size_t) lzfu_header.compressed_data_size ) )
 	{
-		flag_byte = lzfu_data[ compressed_data_iterator++ ];
+		flag_byte_offset = compressed_data_iterator;
+		flag_byte        = lzfu_data[ compressed_data_iterator++ ];
 
 		/* Check every bit in the chunk flag byte from LSB to MSB
 		 */
 		for( flag_byte_bit_mask = 0x01; flag_byte_bit_mask != 0x00; flag_byte_bit_mask <<= 1 )
 		{
-			if( compressed_data_iterator == (size_t) lzfu_header.compressed_data_size )
+			if( ( end_of_data != 0 )
+			 || ( compressed_data_iterator == (size_t) lzfu_header.compressed_data_size ) )
 			{
 				break;
 			}
@@ -569,42 +1131,10 @@ int assorted_lzfu_decompress(
 			 */
 			if( ( flag_byte & flag_byte_bit_mask ) == 0 )
 			{
-				if( compressed_data_iterator >= (size_t) lzfu_header.compressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: missing compressed data.",
-					 function );
-
-					*uncompressed_data_size = 0;
-
-					return( -1 );
-				}
-				if( uncompressed_data_iterator >= *uncompressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: uncompressed data too small.",
-					 function );
+				reference_offset = lz_buffer_iterator;
+				reference_size   = 1;
 
-					*uncompressed_data_size = uncompressed_data_iterator;
-
-					return( -1 );
-				}
-				lz_buffer[ lz_buffer_iterator++ ]                 = lzfu_data[ compressed_data_iterator ];
-				uncompressed_data[ uncompressed_data_iterator++ ] = lzfu_data[ compressed_data_iterator ];
-
-				compressed_data_iterator++;
-
-				/* Make sure the lz buffer iterator wraps around
-				 */
-				lz_buffer_iterator %= 4096;
-
-				lz_buffer[ lz_buffer_iterator ] = 0;
+				lz_buffer[ lz_buffer_iterator ] = lzfu_data[ compressed_data_iterator++ ];
 			}
 			else
 			{
@@ -617,8 +1147,6 @@ int assorted_lzfu_decompress(
 					 "%s: missing compressed data.",
 					 function );
 
-					*uncompressed_data_size = 0;
-
 					return( -1 );
 				}
 				lzfu_reference_data = &( lzfu_data[ compressed_data_iterator ] );
@@ -632,38 +1160,96 @@ int assorted_lzfu_decompress(
 				reference_size     = ( reference_offset & 0x000f ) + 2;
 				reference_offset >>= 4;
 
-				if( ( uncompressed_data_iterator + reference_size - 1 ) >= *uncompressed_data_size )
+				/* A reference to the current position in the lz buffer marks the end
+				 * of the data, it is not part of the uncompressed data
+				 */
+				if( reference_offset == lz_buffer_iterator )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: uncompressed data too small.",
-					 function );
-
-					*uncompressed_data_size = uncompressed_data_iterator + reference_size;
-
-					return( -1 );
+					end_of_data    = 1;
+					reference_size = 0;
 				}
-				for( reference_iterator = 0; reference_iterator < reference_size; reference_iterator++ )
-				{
-					lz_buffer[ lz_buffer_iterator++ ]                 = lz_buffer[ reference_offset ];
-					uncompressed_data[ uncompressed_data_iterator++ ] = lz_buffer[ reference_offset ];
+			}
+			for( reference_iterator = 0; reference_iterator < reference_size; reference_iterator++ )
+			{
+				lz_buffer[ lz_buffer_iterator++ ] = lz_buffer[ reference_offset ];
 
-					reference_offset++;
+				reference_offset++;
 
-					/* Make sure the lz buffer iterator and reference offset wrap around
-					 */
-					lz_buffer_iterator %= 4096;
-					reference_offset   %= 4096;
+				/* Make sure the lz buffer iterator and reference offset wrap around
+				 */
+				lz_buffer_iterator %= 4096;
+				reference_offset   %= 4096;
 
-					lz_buffer[ lz_buffer_iterator ] = 0;
+				if( lz_buffer_iterator == 0 )
+				{
+					if( write_function(
+					     sink,
+					     &( lz_buffer[ write_offset ] ),
+					     (size_t) ( 4096 - write_offset ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					write_offset = 0;
 				}
+				lz_buffer[ lz_buffer_iterator ] = 0;
 			}
 		}
+		if( assorted_crc32_calculate(
+		     &calculated_crc,
+		     &( lzfu_data[ flag_byte_offset ] ),
+		     compressed_data_iterator - flag_byte_offset,
+		     calculated_crc,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate weak CRC.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	*uncompressed_data_size = uncompressed_data_iterator;
+	if( lzfu_header.crc != calculated_crc )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in crc ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 lzfu_header.crc,
+		 calculated_crc );
 
+		return( -1 );
+	}
+	if( lz_buffer_iterator > write_offset )
+	{
+		if( write_function(
+		     sink,
+		     &( lz_buffer[ write_offset ] ),
+		     (size_t) ( lz_buffer_iterator - write_offset ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
-
@@ -74,6 +74,13 @@ int assorted_lzfu_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int assorted_lzfu_decompress_to_sink(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error ),
+     intptr_t *sink,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,344 @@
+/*
+ * LZFu parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_lzfu.h"
+#include "assorted_lzfu_parallel.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+/* Decompresses items
+ * The result of every item is stored in the item, an item that failed
+ * can be decompressed again with assorted_lzfu_decompress to retrieve the error
+ * Returns 1 if all items were decompressed, 0 if not or -1 on error
+ */
+int assorted_lzfu_parallel_decompress_items(
+     assorted_lzfu_parallel_item_t *items,
+     size_t number_of_items,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzfu_parallel_decompress_items";
+	size_t item_index     = 0;
+	int result            = 1;
+
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items > (size_t) ( SSIZE_MAX / sizeof( assorted_lzfu_parallel_item_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of items value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		items[ item_index ].result = assorted_lzfu_decompress(
+		                              items[ item_index ].compressed_data,
+		                              items[ item_index ].compressed_data_size,
+		                              items[ item_index ].uncompressed_data,
+		                              &( items[ item_index ].uncompressed_data_size ),
+		                              NULL );
+
+		if( items[ item_index ].result != 1 )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the items of a task from a thread pool
+ * The error is not available from the worker thread, the result is stored in the items
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzfu_parallel_decompress_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_lzfu_parallel_task_t *task = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	task = (assorted_lzfu_parallel_task_t *) value;
+
+	if( assorted_lzfu_parallel_decompress_items(
+	     task->items,
+	     task->number_of_items,
+	     NULL ) == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses a batch of LZFu compressed items with the items decompressed in parallel
+ * Every item is decompressed in a single pass, using the pre-padded RTF dictionary
+ * to initialize the lz buffer and calculating the CRC while decompressing
+ * The items are distributed over the thread pool in tasks of consecutive items
+ * to limit the thread pool overhead per item
+ * The result of every item is stored in the item, an item that failed
+ * can be decompressed again with assorted_lzfu_decompress to retrieve the error
+ * Returns 1 if all items were decompressed, 0 if not or -1 on error
+ */
+int assorted_lzfu_parallel_decompress(
+     assorted_lzfu_parallel_item_t *items,
+     size_t number_of_items,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function                  = "assorted_lzfu_parallel_decompress";
+	size_t item_index                      = 0;
+	int result                             = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_lzfu_parallel_task_t *tasks   = NULL;
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+	size_t number_of_items_per_task        = 0;
+	size_t number_of_tasks                 = 0;
+	size_t task_index                      = 0;
+#endif
+
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items > (size_t) ( SSIZE_MAX / sizeof( assorted_lzfu_parallel_item_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of items value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		items[ item_index ].result = 0;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		number_of_items_per_task = ( number_of_items + number_of_threads - 1 ) / number_of_threads;
+
+		if( number_of_items_per_task > ASSORTED_LZFU_PARALLEL_NUMBER_OF_ITEMS_PER_TASK )
+		{
+			number_of_items_per_task = ASSORTED_LZFU_PARALLEL_NUMBER_OF_ITEMS_PER_TASK;
+		}
+		if( number_of_items_per_task > 0 )
+		{
+			number_of_tasks = ( number_of_items + number_of_items_per_task - 1 ) / number_of_items_per_task;
+		}
+	}
+	if( number_of_tasks > 1 )
+	{
+		if( number_of_tasks > (size_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of tasks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		tasks = (assorted_lzfu_parallel_task_t *) memory_allocate(
+		                                           sizeof( assorted_lzfu_parallel_task_t ) * number_of_tasks );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			item_index = task_index * number_of_items_per_task;
+
+			tasks[ task_index ].items           = &( items[ item_index ] );
+			tasks[ task_index ].number_of_items = number_of_items - item_index;
+
+			if( tasks[ task_index ].number_of_items > number_of_items_per_task )
+			{
+				tasks[ task_index ].number_of_items = number_of_items_per_task;
+			}
+		}
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = (int) number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &assorted_lzfu_parallel_decompress_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %" PRIzd " onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 tasks );
+
+		tasks = NULL;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the items are decompressed here
+	 */
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( items[ item_index ].result == 0 )
+		{
+			items[ item_index ].result = assorted_lzfu_decompress(
+			                              items[ item_index ].compressed_data,
+			                              items[ item_index ].compressed_data_size,
+			                              items[ item_index ].uncompressed_data,
+			                              &( items[ item_index ].uncompressed_data_size ),
+			                              NULL );
+		}
+		if( items[ item_index ].result != 1 )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( tasks != NULL )
+	{
+		memory_free(
+		 tasks );
+	}
+	return( -1 );
+#endif
+}
+
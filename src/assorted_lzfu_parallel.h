@@ -0,0 +1,101 @@
+/*
+ * LZFu parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_LZFU_PARALLEL_H )
+#define _ASSORTED_LZFU_PARALLEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of items that are decompressed per thread pool task
+ */
+#define ASSORTED_LZFU_PARALLEL_NUMBER_OF_ITEMS_PER_TASK	256
+
+typedef struct assorted_lzfu_parallel_item assorted_lzfu_parallel_item_t;
+
+struct assorted_lzfu_parallel_item
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size, on input the size of the uncompressed data
+	 * and on output the size of the decompressed data
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the item decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+typedef struct assorted_lzfu_parallel_task assorted_lzfu_parallel_task_t;
+
+struct assorted_lzfu_parallel_task
+{
+	/* The first item of the task
+	 */
+	assorted_lzfu_parallel_item_t *items;
+
+	/* The number of items of the task
+	 */
+	size_t number_of_items;
+};
+
+int assorted_lzfu_parallel_decompress_items(
+     assorted_lzfu_parallel_item_t *items,
+     size_t number_of_items,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_lzfu_parallel_decompress_task_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_lzfu_parallel_decompress(
+     assorted_lzfu_parallel_item_t *items,
+     size_t number_of_items,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_LZFU_PARALLEL_H ) */
+
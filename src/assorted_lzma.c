@@ -24,21 +24,130 @@
 #include <memory.h>
 #include <types.h>
 
-#include "assorted_bit_stream.h"
+#include "assorted_aligned_memory.h"
+#include "assorted_arena.h"
+#include "assorted_crc32.h"
+#include "assorted_crc64.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
 #include "assorted_lzma.h"
 
-enum ASSORTED_LZMA_CONTROL_CODES
+
+/* Reads a variable-size integer
+ * The integer is stored in 1 to 9 bytes, of which the lower 7 bits contain
+ * the value and the upper bit indicates another byte follows
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_read_variable_size_integer(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
 {
-	ASSORTED_LZMA_CONTROL_CODE_LITERAL	= 0x00,
-	ASSORTED_LZMA_CONTROL_CODE_MATCH	= 0x02,
-	ASSORTED_LZMA_CONTROL_CODE_SHORTREP	= 0x0c,
-	ASSORTED_LZMA_CONTROL_CODE_REP0		= 0x0d,
-	ASSORTED_LZMA_CONTROL_CODE_REP1		= 0x0e,
-	ASSORTED_LZMA_CONTROL_CODE_REP2		= 0x1e,
-	ASSORTED_LZMA_CONTROL_CODE_REP3		= 0x1f,
-};
+	static char *function   = "assorted_lzma_read_variable_size_integer";
+	size_t safe_data_offset = 0;
+	uint64_t safe_value     = 0;
+	uint8_t byte_index      = 0;
+	uint8_t byte_value      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	do
+	{
+		if( safe_data_offset >= data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( byte_index >= 9 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid variable-size integer value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_value = data[ safe_data_offset++ ];
+
+		/* A byte other than the first with value 0 indicates a non-minimal encoding
+		 */
+		if( ( byte_index > 0 )
+		 && ( byte_value == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported variable-size integer encoding.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value |= (uint64_t) ( byte_value & 0x7f ) << ( byte_index * 7 );
+
+		byte_index++;
+	}
+	while( ( byte_value & 0x80 ) != 0 );
+
+	*data_offset = safe_data_offset;
+	*value_64bit = safe_value;
+
+	return( 1 );
+}
 
 /* Reads the stream header
  * Returns 1 on success or -1 on error
@@ -178,11 +287,20 @@ int assorted_lzma_read_block_header(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *compressed_data_offset,
+     uint32_t *dictionary_size,
      libcerror_error_t **error )
 {
 	static char *function              = "assorted_lzma_read_block_header";
-	size_t safe_compressed_data_offset = 0;
+	size_t header_data_offset          = 0;
+	size_t header_end_offset           = 0;
 	size_t header_size                 = 0;
+	size_t safe_compressed_data_offset = 0;
+	uint64_t filter_identifier         = 0;
+	uint64_t value_64bit               = 0;
+	uint8_t block_flags                = 0;
+	uint8_t dictionary_size_value      = 0;
+	uint8_t filter_index               = 0;
+	uint8_t number_of_filters          = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t value_32bit               = 0;
@@ -222,6 +340,17 @@ int assorted_lzma_read_block_header(
 
 		return( -1 );
 	}
+	if( dictionary_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary size.",
+		 function );
+
+		return( -1 );
+	}
 	safe_compressed_data_offset = *compressed_data_offset;
 
 	if( safe_compressed_data_offset > ( compressed_data_size - 1 ) )
@@ -288,11 +417,209 @@ int assorted_lzma_read_block_header(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-/* TODO implement */
+	/* The block header ends with a 32-bit checksum
+	 */
+	header_data_offset = safe_compressed_data_offset + 2;
+	header_end_offset  = safe_compressed_data_offset + header_size - 4;
+
+	block_flags = compressed_data[ safe_compressed_data_offset + 1 ];
+
+	if( ( block_flags & 0x3c ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported header flags: 0x%02" PRIx8 ".",
+		 function,
+		 block_flags );
+
+		return( -1 );
+	}
+	if( ( block_flags & 0x40 ) != 0 )
+	{
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     header_end_offset,
+		     &header_data_offset,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed size.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compressed size\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 value_64bit );
+		}
+#endif
+	}
+	if( ( block_flags & 0x80 ) != 0 )
+	{
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     header_end_offset,
+		     &header_data_offset,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read uncompressed size.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: uncompressed size\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 value_64bit );
+		}
+#endif
+	}
+	number_of_filters = ( block_flags & 0x03 ) + 1;
+
+	for( filter_index = 0;
+	     filter_index < number_of_filters;
+	     filter_index++ )
+	{
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     header_end_offset,
+		     &header_data_offset,
+		     &filter_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read filter: %" PRIu8 " identifier.",
+			 function,
+			 filter_index );
+
+			return( -1 );
+		}
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     header_end_offset,
+		     &header_data_offset,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read filter: %" PRIu8 " properties size.",
+			 function,
+			 filter_index );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: filter: %" PRIu8 " identifier\t\t\t: 0x%08" PRIx64 "\n",
+			 function,
+			 filter_index,
+			 filter_identifier );
+
+			libcnotify_printf(
+			 "%s: filter: %" PRIu8 " properties size\t\t: %" PRIu64 "\n",
+			 function,
+			 filter_index,
+			 value_64bit );
+		}
+#endif
+		if( value_64bit > (uint64_t) ( header_end_offset - header_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filter: %" PRIu8 " properties size value out of bounds.",
+			 function,
+			 filter_index );
+
+			return( -1 );
+		}
+		header_data_offset += (size_t) value_64bit;
+	}
+	/* Only blocks that consist of a single LZMA2 filter are supported
+	 */
+	if( ( number_of_filters != 1 )
+	 || ( filter_identifier != 0x21 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported filters.",
+		 function );
+
+		return( -1 );
+	}
+	/* The LZMA2 filter properties consist of the dictionary size value
+	 */
+	if( value_64bit != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported LZMA2 filter properties size.",
+		 function );
+
+		return( -1 );
+	}
+	dictionary_size_value = compressed_data[ header_data_offset - 1 ];
+
+	if( dictionary_size_value > 40 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported dictionary size value: %" PRIu8 ".",
+		 function,
+		 dictionary_size_value );
+
+		return( -1 );
+	}
+	else if( dictionary_size_value == 40 )
+	{
+		*dictionary_size = 0xffffffffUL;
+	}
+	else
+	{
+		*dictionary_size = (uint32_t) ( 2 | ( dictionary_size_value & 1 ) ) << ( ( dictionary_size_value / 2 ) + 11 );
+	}
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
+		libcnotify_printf(
+		 "%s: dictionary size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 *dictionary_size );
+
 		byte_stream_copy_to_uint32_little_endian(
 		 &( compressed_data[ safe_compressed_data_offset + header_size - 4 ] ),
 		 value_32bit );
@@ -311,1033 +638,5550 @@ int assorted_lzma_read_block_header(
 	return( 1 );
 }
 
-/* Reads a LZMA encoded block
- * Returns 1 on success or -1 on error
+/* Creates a decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
  */
-int assorted_lzma_read_lzma(
-     assorted_bit_stream_t *bit_stream,
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     size_t *uncompressed_data_offset,
+int assorted_lzma_decoder_initialize(
+     assorted_lzma_decoder_t **decoder,
      libcerror_error_t **error )
 {
-	static char *function                = "assorted_lzma_read_lzma";
-	size_t safe_uncompressed_data_offset = 0;
-	size_t current_distance              = 0;
-	size_t last_distance0                = 0;
-	size_t last_distance1                = 0;
-	size_t last_distance2                = 0;
-	size_t last_distance3                = 0;
-	uint32_t value_32bit                 = 0;
-	uint16_t length                      = 0;
-	uint8_t bit_index                    = 0;
-	uint8_t code_sequence                = 0;
-	uint8_t length_number_of_bits        = 0;
-	uint8_t length_sequence              = 0;
+	return( assorted_lzma_decoder_initialize_with_arena(
+	         decoder,
+	         NULL,
+	         error ) );
+}
+
+/* Creates a decoder of which the memory is allocated from an arena
+ * If arena is NULL the memory is allocated separately
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_decoder_initialize_with_arena(
+     assorted_lzma_decoder_t **decoder,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_decoder_initialize_with_arena";
+	size_t alignment_size = 0;
 
-	if( bit_stream == NULL )
+	if( decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bit stream.",
+		 "%s: invalid decoder.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( *decoder != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( arena != NULL )
+	{
+		if( assorted_arena_allocate(
+		     arena,
+		     sizeof( assorted_lzma_decoder_t ),
+		     (void **) decoder,
+		     error ) != 1 )
+		{
+			*decoder = NULL;
+		}
+	}
+	else
+	{
+		*decoder = memory_allocate_structure(
+		            assorted_lzma_decoder_t );
+	}
+	if( *decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( uncompressed_data_offset == NULL )
+	if( memory_set(
+	     *decoder,
+	     0,
+	     sizeof( assorted_lzma_decoder_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data offset.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder.",
+		 function );
+
+		if( arena == NULL )
+		{
+			memory_free(
+			 *decoder );
+		}
+		*decoder = NULL;
+
+		return( -1 );
+	}
+	( *decoder )->arena = arena;
+
+	alignment_size = (size_t) ( (intptr_t) ( *decoder )->probabilities_data % 64 );
+
+	if( alignment_size > 0 )
+	{
+		alignment_size = 64 - alignment_size;
+	}
+	( *decoder )->probabilities = (uint16_t *) &( ( ( *decoder )->probabilities_data )[ alignment_size ] );
+
+	return( 1 );
+
+on_error:
+	if( ( *decoder != NULL )
+	 && ( arena == NULL ) )
+	{
+		memory_free(
+		 *decoder );
+	}
+	*decoder = NULL;
+
+	return( -1 );
+}
+
+/* Frees a decoder
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_decoder_free(
+     assorted_lzma_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_decoder_free";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *decoder != NULL )
+	 && ( ( *decoder )->arena == NULL ) )
+	{
+		memory_free(
+		 *decoder );
+	}
+	*decoder = NULL;
+
+	return( 1 );
+}
+
+/* Sets the literal context (lc), literal position (lp) and position (pb) bits from a properties value
+ * The properties value is calculated as: ( pb * 5 + lp ) * 9 + lc
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_decoder_set_properties(
+     assorted_lzma_decoder_t *decoder,
+     uint8_t properties_value,
+     libcerror_error_t **error )
+{
+	static char *function                   = "assorted_lzma_decoder_set_properties";
+	uint8_t number_of_literal_context_bits  = 0;
+	uint8_t number_of_literal_position_bits = 0;
+	uint8_t number_of_position_bits         = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( properties_value >= ( 9 * 5 * 5 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported properties value: 0x%02" PRIx8 ".",
+		 function,
+		 properties_value );
+
+		return( -1 );
+	}
+	number_of_position_bits         = properties_value / ( 9 * 5 );
+	properties_value               -= number_of_position_bits * 9 * 5;
+	number_of_literal_position_bits = properties_value / 9;
+	number_of_literal_context_bits  = properties_value - ( number_of_literal_position_bits * 9 );
+
+	/* LZMA2 restricts the number of literal states to 16
+	 */
+	if( ( number_of_literal_context_bits + number_of_literal_position_bits ) > 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of literal context and position bits.",
+		 function );
+
+		return( -1 );
+	}
+	decoder->number_of_literal_context_bits  = number_of_literal_context_bits;
+	decoder->number_of_literal_position_bits = number_of_literal_position_bits;
+	decoder->number_of_position_bits         = number_of_position_bits;
+
+	return( 1 );
+}
+
+/* Resets the state, distances and probabilities of a decoder
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_decoder_reset_state(
+     assorted_lzma_decoder_t *decoder,
+     libcerror_error_t **error )
+{
+	uint16_t *probabilities = NULL;
+	static char *function   = "assorted_lzma_decoder_reset_state";
+	size_t number_of_values = 0;
+	size_t value_index      = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	decoder->state          = 0;
+	decoder->distances[ 0 ] = 0;
+	decoder->distances[ 1 ] = 0;
+	decoder->distances[ 2 ] = 0;
+	decoder->distances[ 3 ] = 0;
+
+	/* Only the literal probabilities of the literal states in use are reset
+	 */
+	probabilities    = decoder->probabilities;
+	number_of_values = ASSORTED_LZMA_PROBABILITIES_LITERALS
+	                 + ( (size_t) 0x300 << ( decoder->number_of_literal_context_bits + decoder->number_of_literal_position_bits ) );
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		probabilities[ value_index ] = ASSORTED_LZMA_INITIAL_PROBABILITY;
+	}
+	return( 1 );
+}
+
+/* Reads LZMA encoded data
+ * The encoded data starts with the 5-byte range decoder initialization and is decoded until
+ * the uncompressed data size is reached or an end of stream marker is read
+ * Matches can refer back to data in the uncompressed data from the dictionary offset onwards
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_read_lzma(
+     assorted_lzma_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     size_t dictionary_offset,
+     libcerror_error_t **error )
+{
+	assorted_lzma_range_decoder_t range_decoder;
+
+	uint16_t *decoder_probabilities                = NULL;
+	uint16_t *probabilities                        = NULL;
+	static char *function                          = "assorted_lzma_read_lzma";
+	size_t match_offset                            = 0;
+	size_t position                                = 0;
+	size_t safe_compressed_data_offset             = 0;
+	size_t safe_uncompressed_data_offset           = 0;
+	uint32_t bit                                   = 0;
+	uint32_t distance                              = 0;
+	uint32_t distance0                             = 0;
+	uint32_t distance1                             = 0;
+	uint32_t distance2                             = 0;
+	uint32_t distance3                             = 0;
+	uint32_t distance_slot                         = 0;
+	uint32_t length                                = 0;
+	uint32_t literal_position_mask                 = 0;
+	uint32_t literal_state                         = 0;
+	uint32_t match_byte                            = 0;
+	uint32_t number_of_direct_bits                 = 0;
+	uint32_t position_mask                         = 0;
+	uint32_t position_state                        = 0;
+	uint32_t symbol                                = 0;
+	uint8_t number_of_literal_context_bits         = 0;
+	uint8_t state                                  = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( ( compressed_data_size < 5 )
+	 || ( safe_compressed_data_offset > ( compressed_data_size - 5 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_offset > safe_uncompressed_data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid dictionary offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first byte of the encoded data should be 0
+	 */
+	if( compressed_data[ safe_compressed_data_offset ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported first encoded byte value.",
+		 function );
+
+		return( -1 );
+	}
+	range_decoder.data        = compressed_data;
+	range_decoder.data_size   = compressed_data_size;
+	range_decoder.data_offset = safe_compressed_data_offset + 5;
+	range_decoder.range       = 0xffffffffUL;
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( compressed_data[ safe_compressed_data_offset + 1 ] ),
+	 range_decoder.code );
+
+	number_of_literal_context_bits = decoder->number_of_literal_context_bits;
+	literal_position_mask          = ( (uint32_t) 1 << decoder->number_of_literal_position_bits ) - 1;
+	position_mask                  = ( (uint32_t) 1 << decoder->number_of_position_bits ) - 1;
+	decoder_probabilities          = decoder->probabilities;
+	state                          = decoder->state;
+	distance0                      = decoder->distances[ 0 ];
+	distance1                      = decoder->distances[ 1 ];
+	distance2                      = decoder->distances[ 2 ];
+	distance3                      = decoder->distances[ 3 ];
+
+	while( safe_uncompressed_data_offset < uncompressed_data_size )
+	{
+		position       = safe_uncompressed_data_offset - dictionary_offset;
+		position_state = (uint32_t) position & position_mask;
+
+		assorted_lzma_range_decoder_decode_bit( range_decoder, decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_MATCH + ( state << 4 ) + position_state ], bit )
+
+		if( bit == 0 )
+		{
+			literal_state = ( (uint32_t) position & literal_position_mask ) << number_of_literal_context_bits;
+
+			if( safe_uncompressed_data_offset > dictionary_offset )
+			{
+				literal_state += uncompressed_data[ safe_uncompressed_data_offset - 1 ] >> ( 8 - number_of_literal_context_bits );
+			}
+			probabilities = &( decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_LITERALS + ( literal_state * 0x300 ) ] );
+
+			if( state < 7 )
+			{
+				assorted_lzma_range_decoder_decode_tree( range_decoder, probabilities, 8, symbol )
+			}
+			else
+			{
+				if( distance0 >= position )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid distance value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				match_byte = uncompressed_data[ safe_uncompressed_data_offset - distance0 - 1 ];
+
+				assorted_lzma_range_decoder_decode_matched_literal( range_decoder, probabilities, match_byte, symbol )
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: literal\t\t\t\t\t: 0x%02" PRIx32 "\n",
+				 function,
+				 symbol );
+			}
+#endif
+			uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) symbol;
+
+			if( state < 4 )
+			{
+				state = 0;
+			}
+			else if( state < 10 )
+			{
+				state -= 3;
+			}
+			else
+			{
+				state -= 6;
+			}
+			continue;
+		}
+		assorted_lzma_range_decoder_decode_bit( range_decoder, decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP + state ], bit )
+
+		if( bit == 0 )
+		{
+			probabilities = &( decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_MATCH_LENGTH ] );
+
+			assorted_lzma_length_decoder_decode( range_decoder, probabilities, position_state, length )
+
+			if( length < ( ASSORTED_LZMA_NUMBER_OF_LENGTH_TO_POSITION_STATES + 2 ) )
+			{
+				probabilities = &( decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_DISTANCE_SLOTS + ( ( length - 2 ) << 6 ) ] );
+			}
+			else
+			{
+				probabilities = &( decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_DISTANCE_SLOTS + ( ( ASSORTED_LZMA_NUMBER_OF_LENGTH_TO_POSITION_STATES - 1 ) << 6 ) ] );
+			}
+			assorted_lzma_range_decoder_decode_tree( range_decoder, probabilities, 6, distance_slot )
+
+			if( distance_slot < 4 )
+			{
+				distance = distance_slot;
+			}
+			else
+			{
+				number_of_direct_bits = ( distance_slot >> 1 ) - 1;
+				distance              = ( 2 | ( distance_slot & 1 ) ) << number_of_direct_bits;
+
+				if( distance_slot < ASSORTED_LZMA_END_POSITION_MODEL_INDEX )
+				{
+					probabilities = &( decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_DISTANCE_SPECIAL + distance - distance_slot ] );
+
+					assorted_lzma_range_decoder_decode_reverse_tree( range_decoder, probabilities, number_of_direct_bits, symbol )
+
+					distance += symbol;
+				}
+				else
+				{
+					symbol = 0;
+
+					for( number_of_direct_bits -= ASSORTED_LZMA_NUMBER_OF_ALIGN_BITS;
+					     number_of_direct_bits > 0;
+					     number_of_direct_bits-- )
+					{
+						assorted_lzma_range_decoder_decode_direct_bit( range_decoder, bit )
+
+						symbol = ( symbol << 1 ) | bit;
+					}
+					distance += symbol << ASSORTED_LZMA_NUMBER_OF_ALIGN_BITS;
+
+					assorted_lzma_range_decoder_decode_reverse_tree( range_decoder, &( decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_DISTANCE_ALIGN ] ), ASSORTED_LZMA_NUMBER_OF_ALIGN_BITS, symbol )
+
+					distance += symbol;
+
+					/* A distance of 0xffffffff marks the end of the stream
+					 */
+					if( distance == 0xffffffffUL )
+					{
+#if defined( HAVE_DEBUG_OUTPUT )
+						if( libcnotify_verbose != 0 )
+						{
+							libcnotify_printf(
+							 "%s: end of stream marker\n",
+							 function );
+						}
+#endif
+						break;
+					}
+				}
+			}
+			distance3 = distance2;
+			distance2 = distance1;
+			distance1 = distance0;
+			distance0 = distance;
+
+			state = ( state < 7 ) ? 7 : 10;
+		}
+		else
+		{
+			length = 0;
+
+			assorted_lzma_range_decoder_decode_bit( range_decoder, decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP0 + state ], bit )
+
+			if( bit == 0 )
+			{
+				assorted_lzma_range_decoder_decode_bit( range_decoder, decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP0_LONG + ( state << 4 ) + position_state ], bit )
+
+				if( bit == 0 )
+				{
+					/* A short rep is a single byte match at rep0
+					 */
+					length = 1;
+				}
+			}
+			else
+			{
+				assorted_lzma_range_decoder_decode_bit( range_decoder, decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP1 + state ], bit )
+
+				if( bit == 0 )
+				{
+					distance = distance1;
+				}
+				else
+				{
+					assorted_lzma_range_decoder_decode_bit( range_decoder, decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP2 + state ], bit )
+
+					if( bit == 0 )
+					{
+						distance = distance2;
+					}
+					else
+					{
+						distance  = distance3;
+						distance3 = distance2;
+					}
+					distance2 = distance1;
+				}
+				distance1 = distance0;
+				distance0 = distance;
+			}
+			if( length == 1 )
+			{
+				state = ( state < 7 ) ? 9 : 11;
+			}
+			else
+			{
+				probabilities = &( decoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_REP_LENGTH ] );
+
+				assorted_lzma_length_decoder_decode( range_decoder, probabilities, position_state, length )
+
+				state = ( state < 7 ) ? 8 : 11;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: match\t\t\t\t\t: distance: %" PRIu32 ", length: %" PRIu32 "\n",
+			 function,
+			 distance0 + 1,
+			 length );
+		}
+#endif
+		if( distance0 >= position )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distance value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( length > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid length value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		match_offset = safe_uncompressed_data_offset - distance0 - 1;
+
+		/* Longer matches that do not overlap their own output are copied at once,
+		 * short matches are faster to copy byte by byte
+		 */
+		if( ( length > 32 )
+		 && ( length <= ( distance0 + 1 ) ) )
+		{
+			if( memory_copy(
+			     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+			     &( uncompressed_data[ match_offset ] ),
+			     (size_t) length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy match to uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			safe_uncompressed_data_offset += length;
+		}
+		else
+		{
+			while( length > 0 )
+			{
+				uncompressed_data[ safe_uncompressed_data_offset++ ] = uncompressed_data[ match_offset++ ];
+
+				length--;
+			}
+		}
+	}
+	if( range_decoder.data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	decoder->state          = state;
+	decoder->distances[ 0 ] = distance0;
+	decoder->distances[ 1 ] = distance1;
+	decoder->distances[ 2 ] = distance2;
+	decoder->distances[ 3 ] = distance3;
+
+	*compressed_data_offset   = range_decoder.data_offset;
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Reads a LZMA2 chunk using a decoder
+ * Matches can refer back to data in the uncompressed data from the dictionary offset onwards,
+ * the dictionary offset is set to the uncompressed data offset when the chunk resets the dictionary
+ * Returns 1 if a chunk was read, 0 if the end of chunks control code was read or -1 on error
+ */
+int assorted_lzma_decoder_read_lzma2_chunk(
+     assorted_lzma_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     size_t *dictionary_offset,
+     libcerror_error_t **error )
+{
+	static char *function                = "assorted_lzma_decoder_read_lzma2_chunk";
+	size_t chunk_end_offset              = 0;
+	size_t encoded_data_offset           = 0;
+	size_t safe_compressed_data_offset   = 0;
+	size_t safe_dictionary_offset        = 0;
+	size_t safe_uncompressed_data_offset = 0;
+	uint32_t chunk_data_size             = 0;
+	uint32_t uncompressed_chunk_size     = 0;
+	uint8_t control_code                 = 0;
+	uint8_t properties_value             = 0;
+	uint8_t read_properties              = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	size_t block_data_offset             = 0;
+#endif
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 1 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_dictionary_offset = *dictionary_offset;
+
+	if( safe_dictionary_offset > safe_uncompressed_data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid dictionary offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_compressed_data_offset > ( compressed_data_size - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	control_code = compressed_data[ safe_compressed_data_offset++ ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: control code\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 control_code );
+	}
+#endif
+	if( control_code == 0x00 )
+	{
+		*compressed_data_offset = safe_compressed_data_offset;
+
+		return( 0 );
+	}
+	if( ( control_code >= 0x03 )
+	 && ( control_code <= 0x7f ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unsupported control code value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Control codes 0x01 and 0xe0 - 0xff reset the dictionary, which is required for the first chunk
+	 */
+	if( ( control_code == 0x01 )
+	 || ( control_code >= 0xe0 ) )
+	{
+		safe_dictionary_offset              = safe_uncompressed_data_offset;
+		decoder->requires_dictionary_reset = 0;
+		decoder->requires_properties       = 1;
+	}
+	else if( decoder->requires_dictionary_reset != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing dictionary reset.",
+		 function );
+
+		return( -1 );
+	}
+	if( control_code >= 0x80 )
+	{
+		if( control_code >= 0xc0 )
+		{
+			read_properties                = 1;
+			decoder->requires_properties = 0;
+		}
+		else if( decoder->requires_properties != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing properties.",
+			 function );
+
+			return( -1 );
+		}
+		if( safe_compressed_data_offset > ( compressed_data_size - 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		uncompressed_chunk_size  = (uint32_t) ( control_code & 0x1f ) << 16;
+		uncompressed_chunk_size |= (uint32_t) compressed_data[ safe_compressed_data_offset++ ] << 8;
+		uncompressed_chunk_size |= compressed_data[ safe_compressed_data_offset++ ];
+		uncompressed_chunk_size += 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: uncompressed chunk size\t\t\t: %" PRIu32 "\n",
+			 function,
+			 uncompressed_chunk_size );
+		}
+#endif
+	}
+	if( safe_compressed_data_offset > ( compressed_data_size - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data_size  = (uint32_t) compressed_data[ safe_compressed_data_offset++ ] << 8;
+	chunk_data_size |= compressed_data[ safe_compressed_data_offset++ ];
+	chunk_data_size += 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: chunk data size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 chunk_data_size );
+	}
+#endif
+	if( read_properties != 0 )
+	{
+		if( safe_compressed_data_offset > ( compressed_data_size - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		properties_value = compressed_data[ safe_compressed_data_offset++ ];
+
+		if( assorted_lzma_decoder_set_properties(
+		     decoder,
+		     properties_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set properties.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: properties value\t\t\t: 0x%02" PRIx8 " (pb: %" PRIu8 ", lp: %" PRIu8 ", lc: %" PRIu8 ")\n",
+			 function,
+			 properties_value,
+			 decoder->number_of_position_bits,
+			 decoder->number_of_literal_position_bits,
+			 decoder->number_of_literal_context_bits );
+		}
+#endif
+		read_properties = 0;
+	}
+	if( ( chunk_data_size > compressed_data_size )
+	 || ( safe_compressed_data_offset > ( compressed_data_size - chunk_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compressed chunk data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 chunk_data_size,
+		 0 );
+	}
+	block_data_offset = safe_uncompressed_data_offset;
+#endif
+	if( control_code >= 0x80 )
+	{
+		/* Control codes 0xa0 - 0xff reset the state
+		 */
+		if( control_code >= 0xa0 )
+		{
+			if( assorted_lzma_decoder_reset_state(
+			     decoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reset state.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( uncompressed_chunk_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+			 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+			 "%s: invalid uncompressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		chunk_end_offset    = safe_uncompressed_data_offset + uncompressed_chunk_size;
+		encoded_data_offset = safe_compressed_data_offset;
+
+		if( assorted_lzma_read_lzma(
+		     decoder,
+		     compressed_data,
+		     safe_compressed_data_offset + chunk_data_size,
+		     &encoded_data_offset,
+		     uncompressed_data,
+		     chunk_end_offset,
+		     &safe_uncompressed_data_offset,
+		     safe_dictionary_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read LZMA encoded data.",
+			 function );
+
+			return( -1 );
+		}
+		/* LZMA2 does not use end of stream markers
+		 */
+		if( safe_uncompressed_data_offset != chunk_end_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed chunk size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( chunk_data_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+			 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+			 "%s: invalid uncompressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+		     &( compressed_data[ safe_compressed_data_offset ] ),
+		     (size_t) chunk_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed chunk data.",
+			 function );
+
+			return( -1 );
+		}
+		safe_uncompressed_data_offset += chunk_data_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: chunk data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( uncompressed_data[ block_data_offset ] ),
+		 safe_uncompressed_data_offset - block_data_offset,
+		 0 );
+	}
+#endif
+	safe_compressed_data_offset += chunk_data_size;
+
+	*compressed_data_offset   = safe_compressed_data_offset;
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+	*dictionary_offset        = safe_dictionary_offset;
+
+	return( 1 );
+}
+
+/* Reads LZMA2 chunks using a decoder
+ * The chunks are read until the end of chunks control code or until the compressed data size is reached,
+ * where the compressed data size must coincide with the start of a chunk. The first chunk must reset
+ * the dictionary, hence any sequence of chunks that starts with a dictionary reset can be read independently
+ * The check, if not NULL, is updated with the uncompressed data of every chunk while it is still in the cache
+ * Returns 1 if the end of chunks control code was read, 0 if the compressed data size was reached or -1 on error
+ */
+int assorted_lzma_decoder_read_lzma2_chunks(
+     assorted_lzma_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_lzma_check_t *check,
+     libcerror_error_t **error )
+{
+	static char *function                = "assorted_lzma_decoder_read_lzma2_chunks";
+	size_t chunk_data_offset             = 0;
+	size_t dictionary_offset             = 0;
+	size_t safe_compressed_data_offset   = 0;
+	size_t safe_uncompressed_data_offset = 0;
+	int result                           = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset   = *compressed_data_offset;
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+	dictionary_offset             = safe_uncompressed_data_offset;
+
+	decoder->requires_dictionary_reset = 1;
+	decoder->requires_properties       = 1;
+
+	do
+	{
+		chunk_data_offset = safe_uncompressed_data_offset;
+
+		result = assorted_lzma_decoder_read_lzma2_chunk(
+		          decoder,
+		          compressed_data,
+		          compressed_data_size,
+		          &safe_compressed_data_offset,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          &safe_uncompressed_data_offset,
+		          &dictionary_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read LZMA2 chunk.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( check != NULL )
+		 && ( safe_uncompressed_data_offset > chunk_data_offset ) )
+		{
+			if( assorted_lzma_check_update(
+			     check,
+			     &( uncompressed_data[ chunk_data_offset ] ),
+			     safe_uncompressed_data_offset - chunk_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update check.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( ( result == 1 )
+	    && ( safe_compressed_data_offset < compressed_data_size ) );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	*compressed_data_offset   = safe_compressed_data_offset;
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	if( result != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a LZMA2 encoded block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_read_lzma2_block(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	return( assorted_lzma_read_lzma2_block_with_arena(
+	         compressed_data,
+	         compressed_data_size,
+	         compressed_data_offset,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         uncompressed_data_offset,
+	         NULL,
+	         NULL,
+	         error ) );
+}
+
+/* Reads a LZMA2 encoded block
+ * The decoder is allocated from the arena if not NULL, the arena is rewound
+ * after the block was read
+ * The check, if not NULL, is updated with the uncompressed data of the block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_read_lzma2_block_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_arena_t *arena,
+     assorted_lzma_check_t *check,
+     libcerror_error_t **error )
+{
+	assorted_lzma_decoder_t *decoder = NULL;
+	static char *function            = "assorted_lzma_read_lzma2_block_with_arena";
+	size_t arena_data_offset         = 0;
+	int result                       = 0;
+
+	if( arena != NULL )
+	{
+		arena_data_offset = arena->data_offset;
+	}
+	if( assorted_lzma_decoder_initialize_with_arena(
+	     &decoder,
+	     arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	result = assorted_lzma_decoder_read_lzma2_chunks(
+	          decoder,
+	          compressed_data,
+	          compressed_data_size,
+	          compressed_data_offset,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          uncompressed_data_offset,
+	          check,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read LZMA2 chunks.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzma_decoder_free(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		if( assorted_arena_rewind(
+		     arena,
+		     arena_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( decoder != NULL )
+	{
+		assorted_lzma_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_rewind(
+		 arena,
+		 arena_data_offset,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the index
+ * The index contains a record for every block and is padded to a multiple of 4 bytes
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_read_index(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_read_index";
+	size_t index_data_offset           = 0;
+	size_t safe_compressed_data_offset = 0;
+	uint64_t number_of_records         = 0;
+	uint64_t record_index              = 0;
+	uint64_t uncompressed_size         = 0;
+	uint64_t unpadded_size             = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 1 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > ( compressed_data_size - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index starts with an index indicator of 0x00
+	 */
+	if( compressed_data[ safe_compressed_data_offset ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index indicator.",
+		 function );
+
+		return( -1 );
+	}
+	index_data_offset = safe_compressed_data_offset + 1;
+
+	if( assorted_lzma_read_variable_size_integer(
+	     compressed_data,
+	     compressed_data_size,
+	     &index_data_offset,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read number of records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of records\t\t\t: %" PRIu64 "\n",
+		 function,
+		 number_of_records );
+	}
+#endif
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     compressed_data_size,
+		     &index_data_offset,
+		     &unpadded_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu64 " unpadded size.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     compressed_data_size,
+		     &index_data_offset,
+		     &uncompressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu64 " uncompressed size.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record: %" PRIu64 " unpadded size\t\t: %" PRIu64 "\n",
+			 function,
+			 record_index,
+			 unpadded_size );
+
+			libcnotify_printf(
+			 "%s: record: %" PRIu64 " uncompressed size\t\t: %" PRIu64 "\n",
+			 function,
+			 record_index,
+			 uncompressed_size );
+		}
+#endif
+	}
+	/* The index is padded to a multiple of 4 bytes and ends with a 32-bit checksum
+	 */
+	index_data_offset = safe_compressed_data_offset + ( ( index_data_offset - safe_compressed_data_offset + 3 ) & ~( (size_t) 3 ) );
+
+	if( ( index_data_offset > compressed_data_size )
+	 || ( ( compressed_data_size - index_data_offset ) < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	*compressed_data_offset = index_data_offset + 4;
+
+	return( 1 );
+}
+
+/* Reads the stream footer
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_read_stream_footer(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_read_stream_footer";
+	size_t safe_compressed_data_offset = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit               = 0;
+	uint16_t value_16bit               = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 12 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > ( compressed_data_size - 12 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: stream footer data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 12,
+		 0 );
+	}
+#endif
+	if( ( compressed_data[ safe_compressed_data_offset + 10 ] != 'Y' )
+	 || ( compressed_data[ safe_compressed_data_offset + 11 ] != 'Z' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset + 4 ] ),
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: backwards size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset + 8 ] ),
+		 value_16bit );
+		libcnotify_printf(
+		 "%s: stream flags\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 value_16bit );
+
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t: %c%c\n",
+		 function,
+		 compressed_data[ safe_compressed_data_offset + 10 ],
+		 compressed_data[ safe_compressed_data_offset + 11 ] );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	*compressed_data_offset = safe_compressed_data_offset + 12;
+
+	return( 1 );
+}
+
+/* Retrieves the uncompressed data size from the index of the last stream
+ * The index, that precedes the stream footer, contains the uncompressed size of every block
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int assorted_lzma_get_uncompressed_data_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "assorted_lzma_get_uncompressed_data_size";
+	size_t index_data_offset         = 0;
+	size_t index_data_size           = 0;
+	size_t index_end_offset          = 0;
+	uint64_t block_uncompressed_size = 0;
+	uint64_t number_of_records       = 0;
+	uint64_t record_index            = 0;
+	uint64_t safe_uncompressed_size  = 0;
+	uint64_t unpadded_size           = 0;
+	uint32_t backward_size           = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The stream header and footer are 12 bytes each
+	 */
+	if( compressed_data_size < 24 )
+	{
+		return( 0 );
+	}
+	if( ( compressed_data[ compressed_data_size - 2 ] != 'Y' )
+	 || ( compressed_data[ compressed_data_size - 1 ] != 'Z' ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ compressed_data_size - 8 ] ),
+	 backward_size );
+
+	index_data_size  = ( (size_t) backward_size + 1 ) * 4;
+	index_end_offset = compressed_data_size - 12;
+
+	if( index_data_size > ( index_end_offset - 12 ) )
+	{
+		return( 0 );
+	}
+	index_data_offset = index_end_offset - index_data_size;
+
+	/* The index starts with an index indicator of 0x00
+	 */
+	if( compressed_data[ index_data_offset ] != 0 )
+	{
+		return( 0 );
+	}
+	index_data_offset += 1;
+
+	/* The index ends with a 32-bit checksum
+	 */
+	index_end_offset -= 4;
+
+	if( assorted_lzma_read_variable_size_integer(
+	     compressed_data,
+	     index_end_offset,
+	     &index_data_offset,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read number of records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     index_end_offset,
+		     &index_data_offset,
+		     &unpadded_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu64 " unpadded size.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     index_end_offset,
+		     &index_data_offset,
+		     &block_uncompressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu64 " uncompressed size.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( block_uncompressed_size > ( UINT64_MAX - safe_uncompressed_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu64 " uncompressed size value out of bounds.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		safe_uncompressed_size += block_uncompressed_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of records\t\t\t: %" PRIu64 "\n",
+		 function,
+		 number_of_records );
+
+		libcnotify_printf(
+		 "%s: uncompressed size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 safe_uncompressed_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	*uncompressed_data_size = safe_uncompressed_size;
+
+	return( 1 );
+}
+
+/* Creates a check
+ * Make sure the value check is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_check_initialize(
+     assorted_lzma_check_t **check,
+     uint8_t check_type,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_check_initialize";
+
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	if( *check != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid check value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_type > 0x0f )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported check type.",
+		 function );
+
+		return( -1 );
+	}
+	*check = memory_allocate_structure(
+	          assorted_lzma_check_t );
+
+	if( *check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create check.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *check,
+	     0,
+	     sizeof( assorted_lzma_check_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear check.",
+		 function );
+
+		memory_free(
+		 *check );
+
+		*check = NULL;
+
+		return( -1 );
+	}
+	( *check )->check_type = check_type;
+
+	/* The check size is determined by the check type, also for check types
+	 * that are not supported and hence are skipped
+	 */
+	if( check_type != ASSORTED_LZMA_CHECK_TYPE_NONE )
+	{
+		( *check )->check_size = (size_t) 4 << ( ( check_type - 1 ) / 3 );
+	}
+	if( check_type == ASSORTED_LZMA_CHECK_TYPE_SHA256 )
+	{
+		if( libhmac_sha256_initialize(
+		     &( ( *check )->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create SHA-256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *check != NULL )
+	{
+		memory_free(
+		 *check );
+
+		*check = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a check
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_check_free(
+     assorted_lzma_check_t **check,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_check_free";
+	int result            = 1;
+
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	if( *check != NULL )
+	{
+		if( ( *check )->sha256_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *check )->sha256_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA-256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *check );
+
+		*check = NULL;
+	}
+	return( result );
+}
+
+/* Resets a check for the uncompressed data of the next block
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_check_reset(
+     assorted_lzma_check_t *check,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_check_reset";
+
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	check->crc32 = 0;
+	check->crc64 = 0;
+
+	/* The SHA-256 context cannot be reused after it was finalized
+	 */
+	if( check->check_type == ASSORTED_LZMA_CHECK_TYPE_SHA256 )
+	{
+		if( check->sha256_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( check->sha256_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA-256 context.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libhmac_sha256_initialize(
+		     &( check->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create SHA-256 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Updates a check with uncompressed data
+ * The data is expected to directly follow the data of the previous update
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_check_update(
+     assorted_lzma_check_t *check,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_check_update";
+
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The previous value is passed as the initial value to continue the CRC
+	 */
+	if( check->check_type == ASSORTED_LZMA_CHECK_TYPE_CRC32 )
+	{
+		if( assorted_crc32_calculate_folded(
+		     &( check->crc32 ),
+		     data,
+		     data_size,
+		     check->crc32,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( check->check_type == ASSORTED_LZMA_CHECK_TYPE_CRC64 )
+	{
+		if( assorted_crc64_calculate_with_polynomial(
+		     &( check->crc64 ),
+		     data,
+		     data_size,
+		     check->crc64,
+		     0,
+		     ASSORTED_CRC64_POLYNOMIAL_XZ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate CRC-64.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( check->check_type == ASSORTED_LZMA_CHECK_TYPE_SHA256 )
+	{
+		if( libhmac_sha256_update(
+		     check->sha256_context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to update SHA-256.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the check that follows a block and verifies it against the check
+ * Check types other than CRC-32, CRC-64 and SHA-256 are skipped
+ * The check must be reset before it is updated with the next block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_check_read(
+     assorted_lzma_check_t *check,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	static char *function              = "assorted_lzma_check_read";
+	size_t safe_compressed_data_offset = 0;
+	uint64_t stored_crc64              = 0;
+	uint32_t stored_crc32              = 0;
+
+	if( check == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( ( safe_compressed_data_offset > compressed_data_size )
+	 || ( check->check_size > ( compressed_data_size - safe_compressed_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( check->check_type == ASSORTED_LZMA_CHECK_TYPE_CRC32 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 stored_crc32 );
+
+		if( stored_crc32 != check->crc32 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: CRC-32 does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_crc32,
+			 check->crc32 );
+
+			return( -1 );
+		}
+	}
+	else if( check->check_type == ASSORTED_LZMA_CHECK_TYPE_CRC64 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 stored_crc64 );
+
+		if( stored_crc64 != check->crc64 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: CRC-64 does not match (stored: 0x%08" PRIx64 ", calculated: 0x%08" PRIx64 ").",
+			 function,
+			 stored_crc64,
+			 check->crc64 );
+
+			return( -1 );
+		}
+	}
+	else if( check->check_type == ASSORTED_LZMA_CHECK_TYPE_SHA256 )
+	{
+		if( libhmac_sha256_finalize(
+		     check->sha256_context,
+		     calculated_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to finalize SHA-256.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     &( compressed_data[ safe_compressed_data_offset ] ),
+		     calculated_hash,
+		     LIBHMAC_SHA256_HASH_SIZE ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: SHA-256 does not match.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*compressed_data_offset = safe_compressed_data_offset + check->check_size;
+
+	return( 1 );
+}
+
+/* Reads the check that follows a block
+ * The check is verified against the uncompressed data of the block,
+ * check types other than CRC-32, CRC-64 and SHA-256 are skipped
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_read_block_check(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t check_type,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_lzma_check_t *check = NULL;
+	static char *function        = "assorted_lzma_read_block_check";
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzma_check_initialize(
+	     &check,
+	     check_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create check.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzma_check_update(
+	     check,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update check.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzma_check_read(
+	     check,
+	     compressed_data,
+	     compressed_data_size,
+	     compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read check.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzma_check_free(
+	     &check,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free check.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( check != NULL )
+	{
+		assorted_lzma_check_free(
+		 &check,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses LZMA compressed data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( assorted_lzma_decompress_with_arena(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         NULL,
+	         error ) );
+}
+
+/* Decompresses LZMA compressed data
+ * The decoders are allocated from the arena if not NULL
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_decompress_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_arena_t *arena,
+     libcerror_error_t **error )
+{
+	assorted_lzma_check_t *check       = NULL;
+	static char *function              = "assorted_lzma_decompress_with_arena";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint32_t dictionary_size           = 0;
+	uint8_t check_type                 = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( assorted_lzma_read_stream_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream header.",
+		 function );
+
+		return( -1 );
+	}
+	/* The type of the check that follows every block is determined by the stream flags
+	 */
+	check_type = compressed_data[ 7 ] & 0x0f;
+
+	if( assorted_lzma_check_initialize(
+	     &check,
+	     check_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create check.",
+		 function );
+
+		goto on_error;
+	}
+	/* A block header size of 0 indicates the start of the index
+	 */
+	while( ( compressed_data_offset < compressed_data_size )
+	    && ( compressed_data[ compressed_data_offset ] != 0 ) )
+	{
+		if( assorted_lzma_read_block_header(
+		     compressed_data,
+		     compressed_data_size,
+		     &compressed_data_offset,
+		     &dictionary_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_lzma_check_reset(
+		     check,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset check.",
+			 function );
+
+			goto on_error;
+		}
+		/* The check is updated with the uncompressed data of every LZMA2 chunk
+		 * directly after it was decoded, instead of after the block was read
+		 */
+		if( assorted_lzma_read_lzma2_block_with_arena(
+		     compressed_data,
+		     compressed_data_size,
+		     &compressed_data_offset,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     arena,
+		     check,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read LZMA2 block.",
+			 function );
+
+			goto on_error;
+		}
+		/* The block is padded to a multiple of 4 bytes and followed by the check
+		 */
+		compressed_data_offset = ( compressed_data_offset + 3 ) & ~( (size_t) 3 );
+
+		if( assorted_lzma_check_read(
+		     check,
+		     compressed_data,
+		     compressed_data_size,
+		     &compressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block check.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( assorted_lzma_read_index(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzma_read_stream_footer(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream footer.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzma_check_free(
+	     &check,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free check.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( check != NULL )
+	{
+		assorted_lzma_check_free(
+		 &check,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a decoder context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_context_initialize(
+     assorted_lzma_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            assorted_lzma_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( assorted_lzma_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+
+		return( -1 );
+	}
+	/* The slab of the arena is sized by the first reset after a stream
+	 * that did not fit
+	 */
+	if( assorted_arena_initialize(
+	     &( ( *context )->arena ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decoder context
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_context_free(
+     assorted_lzma_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_context_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( assorted_arena_free(
+		     &( ( *context )->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Resets a decoder context
+ * The scratch memory of the previous stream is released and the arena is
+ * grown to fit it, so that a following stream of a similar size is decoded
+ * without allocating
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_context_reset(
+     assorted_lzma_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_context_reset";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_arena_reset(
+	     context->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset arena.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses LZMA compressed data using a decoder context
+ * The context is reset before the stream is decompressed
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_context_decompress(
+     assorted_lzma_context_t *context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_context_decompress";
+
+	if( assorted_lzma_context_reset(
+	     context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset context.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzma_decompress_with_arena(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     context->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the hash value of the 3 bytes at the offset
+ */
+#define assorted_lzma_encoder_get_hash_value( data, offset, number_of_hash_bits ) \
+	( ( (uint32_t) ( ( (uint32_t) ( data )[ offset ] | ( (uint32_t) ( data )[ offset + 1 ] << 8 ) | ( (uint32_t) ( data )[ offset + 2 ] << 16 ) ) * (uint32_t) 0x9e3779b1UL ) ) >> ( 32 - ( number_of_hash_bits ) ) )
+
+/* Determines the length of a match of the data at match_offset and data_offset,
+ * where match_length bytes are known to match and the length is limited to maximum_match_length
+ * On little-endian hosts 8 bytes are compared at a time
+ */
+#if defined( __GNUC__ ) && defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+
+#define assorted_lzma_encoder_get_match_length( data, match_offset, data_offset, match_length, maximum_match_length, value1, value2 ) \
+	while( ( match_length + 8 ) <= maximum_match_length ) \
+	{ \
+		__builtin_memcpy( &( value1 ), &( ( data )[ match_offset + match_length ] ), 8 ); \
+		__builtin_memcpy( &( value2 ), &( ( data )[ data_offset + match_length ] ), 8 ); \
+\
+		value1 ^= value2; \
+\
+		if( value1 != 0 ) \
+		{ \
+			match_length += (uint32_t) ( __builtin_ctzll( value1 ) >> 3 ); \
+\
+			break; \
+		} \
+		match_length += 8; \
+	} \
+	while( ( match_length < maximum_match_length ) \
+	    && ( ( data )[ match_offset + match_length ] == ( data )[ data_offset + match_length ] ) ) \
+	{ \
+		match_length++; \
+	}
+
+#else
+
+#define assorted_lzma_encoder_get_match_length( data, match_offset, data_offset, match_length, maximum_match_length, value1, value2 ) \
+	while( ( match_length < maximum_match_length ) \
+	    && ( ( data )[ match_offset + match_length ] == ( data )[ data_offset + match_length ] ) ) \
+	{ \
+		match_length++; \
+	}
+
+#endif /* defined( __GNUC__ ) && defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) */
+
+/* Adds the positions up to the end offset to the hash chains of an encoder
+ * Only positions that are followed by at least 3 bytes are added
+ */
+#define assorted_lzma_encoder_add_positions( encoder, data, data_size, end_offset ) \
+	while( ( encoder->hashed_data_offset < ( end_offset ) ) \
+	    && ( ( ( data_size ) - encoder->hashed_data_offset ) >= 3 ) ) \
+	{ \
+		uint32_t encoder_hash_value = 0; \
+\
+		encoder_hash_value = assorted_lzma_encoder_get_hash_value( data, encoder->hashed_data_offset, encoder->number_of_hash_bits ); \
+\
+		encoder->chain_table[ encoder->hashed_data_offset & ( encoder->dictionary_size - 1 ) ] = encoder->hash_table[ encoder_hash_value ]; \
+		encoder->hash_table[ encoder_hash_value ]                                             = (uint32_t) ( encoder->hashed_data_offset + 1 ); \
+\
+		encoder->hashed_data_offset += 1; \
+	}
+
+/* Writes a variable-size integer
+ * The integer is stored in 1 to 9 bytes, of which the lower 7 bits contain
+ * the value and the upper bit indicates another byte follows
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_write_variable_size_integer(
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function   = "assorted_lzma_write_variable_size_integer";
+	size_t safe_data_offset = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value is limited to 63 bits
+	 */
+	if( value_64bit > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	do
+	{
+		if( safe_data_offset >= data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		data[ safe_data_offset ] = (uint8_t) ( value_64bit & 0x7f );
+
+		value_64bit >>= 7;
+
+		if( value_64bit != 0 )
+		{
+			data[ safe_data_offset ] |= 0x80;
+		}
+		safe_data_offset++;
+	}
+	while( value_64bit != 0 );
+
+	*data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Writes the stream header
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_write_stream_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t check_type,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_write_stream_header";
+	size_t safe_compressed_data_offset = 0;
+	uint32_t checksum                  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 12 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_type > 0x0f )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported check type.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > ( compressed_data_size - 12 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data[ safe_compressed_data_offset ]     = 0xfd;
+	compressed_data[ safe_compressed_data_offset + 1 ] = '7';
+	compressed_data[ safe_compressed_data_offset + 2 ] = 'z';
+	compressed_data[ safe_compressed_data_offset + 3 ] = 'X';
+	compressed_data[ safe_compressed_data_offset + 4 ] = 'Z';
+	compressed_data[ safe_compressed_data_offset + 5 ] = 0;
+
+	/* The stream flags consist of a 0-byte followed by the check type
+	 */
+	compressed_data[ safe_compressed_data_offset + 6 ] = 0;
+	compressed_data[ safe_compressed_data_offset + 7 ] = check_type;
+
+	if( assorted_crc32_calculate(
+	     &checksum,
+	     &( compressed_data[ safe_compressed_data_offset + 6 ] ),
+	     2,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ safe_compressed_data_offset + 8 ] ),
+	 checksum );
+
+	*compressed_data_offset = safe_compressed_data_offset + 12;
+
+	return( 1 );
+}
+
+/* Writes the block header
+ * The block header contains a single LZMA2 filter and no compressed and uncompressed size,
+ * which are stored in the index
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_write_block_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint32_t dictionary_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_write_block_header";
+	size_t safe_compressed_data_offset = 0;
+	uint32_t checksum                  = 0;
+	uint8_t dictionary_size_value      = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 12 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > ( compressed_data_size - 12 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The dictionary size value is the smallest value that represents the dictionary size
+	 * as 2 or 3 times a power of 2
+	 */
+	while( ( dictionary_size_value < 40 )
+	    && ( ( (uint32_t) ( 2 | ( dictionary_size_value & 1 ) ) << ( ( dictionary_size_value / 2 ) + 11 ) ) < dictionary_size ) )
+	{
+		dictionary_size_value++;
+	}
+	/* The header size is stored as ( size / 4 ) - 1 and the flags indicate 1 filter
+	 */
+	compressed_data[ safe_compressed_data_offset ]      = 2;
+	compressed_data[ safe_compressed_data_offset + 1 ]  = 0;
+
+	/* The LZMA2 filter identifier, the properties size and the dictionary size value
+	 */
+	compressed_data[ safe_compressed_data_offset + 2 ]  = 0x21;
+	compressed_data[ safe_compressed_data_offset + 3 ]  = 1;
+	compressed_data[ safe_compressed_data_offset + 4 ]  = dictionary_size_value;
+
+	/* The header is padded to a multiple of 4 bytes
+	 */
+	compressed_data[ safe_compressed_data_offset + 5 ]  = 0;
+	compressed_data[ safe_compressed_data_offset + 6 ]  = 0;
+	compressed_data[ safe_compressed_data_offset + 7 ]  = 0;
+
+	if( assorted_crc32_calculate(
+	     &checksum,
+	     &( compressed_data[ safe_compressed_data_offset ] ),
+	     8,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ safe_compressed_data_offset + 8 ] ),
+	 checksum );
+
+	*compressed_data_offset = safe_compressed_data_offset + 12;
+
+	return( 1 );
+}
+
+/* Writes the check that follows a block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_write_block_check(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t check_type,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_write_block_check";
+	size_t check_size                  = 0;
+	size_t safe_compressed_data_offset = 0;
+	uint64_t check_value_64bit         = 0;
+	uint32_t check_value_32bit         = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( check_type != ASSORTED_LZMA_CHECK_TYPE_NONE )
+	 && ( check_type != ASSORTED_LZMA_CHECK_TYPE_CRC32 )
+	 && ( check_type != ASSORTED_LZMA_CHECK_TYPE_CRC64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported check type.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( check_type != ASSORTED_LZMA_CHECK_TYPE_NONE )
+	{
+		check_size = (size_t) 4 << ( ( check_type - 1 ) / 3 );
+	}
+	if( ( safe_compressed_data_offset > compressed_data_size )
+	 || ( check_size > ( compressed_data_size - safe_compressed_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_type == ASSORTED_LZMA_CHECK_TYPE_CRC32 )
+	{
+		if( assorted_crc32_calculate(
+		     &check_value_32bit,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 check_value_32bit );
+	}
+	else if( check_type == ASSORTED_LZMA_CHECK_TYPE_CRC64 )
+	{
+		if( assorted_crc64_calculate_with_polynomial(
+		     &check_value_64bit,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     0,
+		     0,
+		     ASSORTED_CRC64_POLYNOMIAL_XZ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate CRC-64.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( compressed_data[ safe_compressed_data_offset ] ),
+		 check_value_64bit );
+	}
+	*compressed_data_offset = safe_compressed_data_offset + check_size;
+
+	return( 1 );
+}
+
+/* Writes the index
+ * The index contains a record for every block and is padded to a multiple of 4 bytes
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_write_index(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     const assorted_lzma_index_record_t *records,
+     size_t number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_write_index";
+	size_t index_data_offset           = 0;
+	size_t record_index                = 0;
+	size_t safe_compressed_data_offset = 0;
+	uint32_t checksum                  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( records == NULL )
+	 && ( number_of_records > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset >= compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index starts with an index indicator of 0x00
+	 */
+	compressed_data[ safe_compressed_data_offset ] = 0;
+
+	index_data_offset = safe_compressed_data_offset + 1;
+
+	if( assorted_lzma_write_variable_size_integer(
+	     compressed_data,
+	     compressed_data_size,
+	     &index_data_offset,
+	     (uint64_t) number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write number of records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( assorted_lzma_write_variable_size_integer(
+		     compressed_data,
+		     compressed_data_size,
+		     &index_data_offset,
+		     records[ record_index ].unpadded_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record: %" PRIzd " unpadded size.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( assorted_lzma_write_variable_size_integer(
+		     compressed_data,
+		     compressed_data_size,
+		     &index_data_offset,
+		     records[ record_index ].uncompressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record: %" PRIzd " uncompressed size.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	/* The index is padded to a multiple of 4 bytes and ends with a 32-bit checksum
+	 */
+	while( ( ( index_data_offset - safe_compressed_data_offset ) % 4 ) != 0 )
+	{
+		if( index_data_offset >= compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data[ index_data_offset++ ] = 0;
+	}
+	if( ( compressed_data_size - index_data_offset ) < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_crc32_calculate(
+	     &checksum,
+	     &( compressed_data[ safe_compressed_data_offset ] ),
+	     index_data_offset - safe_compressed_data_offset,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ index_data_offset ] ),
+	 checksum );
+
+	*compressed_data_offset = index_data_offset + 4;
+
+	return( 1 );
+}
+
+/* Writes the stream footer
+ * The backward size is determined from the size of the index that precedes the stream footer
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_write_stream_footer(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t index_size,
+     uint8_t check_type,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_write_stream_footer";
+	size_t safe_compressed_data_offset = 0;
+	uint32_t checksum                  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 12 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The backward size is stored as ( size / 4 ) - 1
+	 */
+	if( ( index_size < 8 )
+	 || ( ( index_size % 4 ) != 0 )
+	 || ( index_size > ( (size_t) UINT32_MAX + 1 ) * 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_type > 0x0f )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported check type.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > ( compressed_data_size - 12 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ safe_compressed_data_offset + 4 ] ),
+	 (uint32_t) ( ( index_size / 4 ) - 1 ) );
+
+	/* The stream flags must match those of the stream header
+	 */
+	compressed_data[ safe_compressed_data_offset + 8 ]  = 0;
+	compressed_data[ safe_compressed_data_offset + 9 ]  = check_type;
+	compressed_data[ safe_compressed_data_offset + 10 ] = 'Y';
+	compressed_data[ safe_compressed_data_offset + 11 ] = 'Z';
+
+	/* The checksum is calculated over the backward size and the stream flags
+	 */
+	if( assorted_crc32_calculate(
+	     &checksum,
+	     &( compressed_data[ safe_compressed_data_offset + 4 ] ),
+	     6,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ safe_compressed_data_offset ] ),
+	 checksum );
+
+	*compressed_data_offset = safe_compressed_data_offset + 12;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the blocks that the uncompressed data is split into for a compression preset
+ * The blocks are compressed independently, like xz the block size is 3 times the dictionary size
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_get_compression_block_size(
+     int compression_preset,
+     size_t *block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_get_compression_block_size";
+
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_preset == ASSORTED_LZMA_COMPRESSION_PRESET_FAST )
+	{
+		*block_size = (size_t) 3 * ASSORTED_LZMA_ENCODER_FAST_DICTIONARY_SIZE;
+	}
+	else if( compression_preset == ASSORTED_LZMA_COMPRESSION_PRESET_NORMAL )
+	{
+		*block_size = (size_t) 3 * ASSORTED_LZMA_ENCODER_NORMAL_DICTIONARY_SIZE;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression preset.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates an encoder
+ * Make sure the value encoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_encoder_initialize(
+     assorted_lzma_encoder_t **encoder,
+     int compression_preset,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_encoder_initialize";
+	size_t alignment_size = 0;
+
+	if( encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *encoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid encoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_preset != ASSORTED_LZMA_COMPRESSION_PRESET_FAST )
+	 && ( compression_preset != ASSORTED_LZMA_COMPRESSION_PRESET_NORMAL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression preset.",
+		 function );
+
+		return( -1 );
+	}
+	*encoder = memory_allocate_structure(
+	            assorted_lzma_encoder_t );
+
+	if( *encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create encoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *encoder,
+	     0,
+	     sizeof( assorted_lzma_encoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear encoder.",
+		 function );
+
+		memory_free(
+		 *encoder );
+
+		*encoder = NULL;
+
+		return( -1 );
+	}
+	/* The properties match those of the xz presets: lc=3, lp=0, pb=2
+	 */
+	( *encoder )->number_of_literal_context_bits  = 3;
+	( *encoder )->number_of_literal_position_bits = 0;
+	( *encoder )->number_of_position_bits         = 2;
+
+	if( compression_preset == ASSORTED_LZMA_COMPRESSION_PRESET_FAST )
+	{
+		( *encoder )->dictionary_size      = ASSORTED_LZMA_ENCODER_FAST_DICTIONARY_SIZE;
+		( *encoder )->number_of_hash_bits  = 16;
+		( *encoder )->maximum_chain_length = 8;
+		( *encoder )->nice_length          = 32;
+		( *encoder )->use_lazy_matching    = 0;
+	}
+	else
+	{
+		( *encoder )->dictionary_size      = ASSORTED_LZMA_ENCODER_NORMAL_DICTIONARY_SIZE;
+		( *encoder )->number_of_hash_bits  = 20;
+		( *encoder )->maximum_chain_length = 48;
+		( *encoder )->nice_length          = 64;
+		( *encoder )->use_lazy_matching    = 1;
+	}
+	( *encoder )->hash_table = (uint32_t *) assorted_aligned_memory_allocate(
+	                                         sizeof( uint32_t ) << ( *encoder )->number_of_hash_bits );
+
+	if( ( *encoder )->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	( *encoder )->chain_table = (uint32_t *) assorted_aligned_memory_allocate(
+	                                          sizeof( uint32_t ) * ( *encoder )->dictionary_size );
+
+	if( ( *encoder )->chain_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chain table.",
+		 function );
+
+		goto on_error;
+	}
+	( *encoder )->chunk_data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * ASSORTED_LZMA_MAXIMUM_COMPRESSED_CHUNK_SIZE );
+
+	if( ( *encoder )->chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	alignment_size = (size_t) ( (intptr_t) ( *encoder )->probabilities_data % 64 );
+
+	if( alignment_size > 0 )
+	{
+		alignment_size = 64 - alignment_size;
+	}
+	( *encoder )->probabilities = (uint16_t *) &( ( ( *encoder )->probabilities_data )[ alignment_size ] );
+
+	return( 1 );
+
+on_error:
+	if( *encoder != NULL )
+	{
+		if( ( *encoder )->chain_table != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *encoder )->chain_table );
+		}
+		if( ( *encoder )->hash_table != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *encoder )->hash_table );
+		}
+		memory_free(
+		 *encoder );
+
+		*encoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an encoder
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_encoder_free(
+     assorted_lzma_encoder_t **encoder,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_encoder_free";
+
+	if( encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *encoder != NULL )
+	{
+		memory_free(
+		 ( *encoder )->chunk_data );
+
+		assorted_aligned_memory_free(
+		 ( *encoder )->chain_table );
+
+		assorted_aligned_memory_free(
+		 ( *encoder )->hash_table );
+
+		memory_free(
+		 *encoder );
+
+		*encoder = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets the state, distances and probabilities of an encoder
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_encoder_reset_state(
+     assorted_lzma_encoder_t *encoder,
+     libcerror_error_t **error )
+{
+	uint16_t *probabilities = NULL;
+	static char *function   = "assorted_lzma_encoder_reset_state";
+	size_t number_of_values = 0;
+	size_t value_index      = 0;
+
+	if( encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoder.",
+		 function );
+
+		return( -1 );
+	}
+	encoder->state          = 0;
+	encoder->distances[ 0 ] = 0;
+	encoder->distances[ 1 ] = 0;
+	encoder->distances[ 2 ] = 0;
+	encoder->distances[ 3 ] = 0;
+
+	/* Only the literal probabilities of the literal states in use are reset
+	 */
+	probabilities    = encoder->probabilities;
+	number_of_values = ASSORTED_LZMA_PROBABILITIES_LITERALS
+	                 + ( (size_t) 0x300 << ( encoder->number_of_literal_context_bits + encoder->number_of_literal_position_bits ) );
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		probabilities[ value_index ] = ASSORTED_LZMA_INITIAL_PROBABILITY;
+	}
+	return( 1 );
+}
+
+/* Finds the longest match of the data at the data offset in the hash chains of an encoder
+ * The positions before the data offset must have been added to the hash chains
+ * The match distance is stored as distance - 1, as used by the range encoder
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_encoder_find_match(
+     assorted_lzma_encoder_t *encoder,
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint32_t *match_length,
+     uint32_t *match_distance,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_lzma_encoder_find_match";
+	size_t chain_match_offset     = 0;
+	uint64_t value1               = 0;
+	uint64_t value2               = 0;
+	uint32_t best_match_distance  = 0;
+	uint32_t best_match_length    = 0;
+	uint32_t chain_entry          = 0;
+	uint32_t hash_value           = 0;
+	uint32_t maximum_match_length = 0;
+	uint32_t next_chain_entry     = 0;
+	uint32_t safe_match_length    = 0;
+	uint16_t chain_length         = 0;
+
+	if( encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match length.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_distance == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match distance.",
+		 function );
+
+		return( -1 );
+	}
+	*match_length   = 0;
+	*match_distance = 0;
+
+	if( ( data_size - data_offset ) < 3 )
+	{
+		return( 1 );
+	}
+	maximum_match_length = ASSORTED_LZMA_MAXIMUM_MATCH_LENGTH;
+
+	if( (size_t) maximum_match_length > ( data_size - data_offset ) )
+	{
+		maximum_match_length = (uint32_t) ( data_size - data_offset );
+	}
+	hash_value   = assorted_lzma_encoder_get_hash_value( data, data_offset, encoder->number_of_hash_bits );
+	chain_entry  = encoder->hash_table[ hash_value ];
+	chain_length = encoder->maximum_chain_length;
+
+	while( ( chain_entry != 0 )
+	    && ( chain_length > 0 ) )
+	{
+		chain_match_offset = (size_t) chain_entry - 1;
+
+		/* Stop at chain entries of positions that are not before the data offset
+		 * or no longer in the dictionary
+		 */
+		if( ( chain_match_offset >= data_offset )
+		 || ( ( data_offset - chain_match_offset ) > encoder->dictionary_size ) )
+		{
+			break;
+		}
+		/* Only a candidate that matches the byte after the best match can be longer
+		 */
+		if( data[ chain_match_offset + best_match_length ] == data[ data_offset + best_match_length ] )
+		{
+			safe_match_length = 0;
+
+			assorted_lzma_encoder_get_match_length( data, chain_match_offset, data_offset, safe_match_length, maximum_match_length, value1, value2 )
+
+			if( safe_match_length > best_match_length )
+			{
+				best_match_length   = safe_match_length;
+				best_match_distance = (uint32_t) ( data_offset - chain_match_offset - 1 );
+
+				if( ( best_match_length >= encoder->nice_length )
+				 || ( best_match_length >= maximum_match_length ) )
+				{
+					break;
+				}
+			}
+		}
+		next_chain_entry = encoder->chain_table[ chain_match_offset & ( encoder->dictionary_size - 1 ) ];
+
+		/* A chain entry that does not refer back is stale, since its position was overwritten
+		 * by a position that is a dictionary size further
+		 */
+		if( next_chain_entry >= chain_entry )
+		{
+			break;
+		}
+		chain_entry = next_chain_entry;
+
+		chain_length--;
+	}
+	if( best_match_length >= ASSORTED_LZMA_MINIMUM_MATCH_LENGTH )
+	{
+		*match_length   = best_match_length;
+		*match_distance = best_match_distance;
+	}
+	return( 1 );
+}
+
+/* Writes LZMA encoded data of an LZMA2 chunk
+ * The data is encoded from the uncompressed data offset onwards until the end of the uncompressed data
+ * or until the chunk reaches the maximum uncompressed or compressed chunk size. The uncompressed data
+ * starts at the last dictionary reset and the encoder state is continued from the previous chunk
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_encoder_write_lzma(
+     assorted_lzma_encoder_t *encoder,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	assorted_lzma_range_encoder_t range_encoder;
+
+	uint16_t *encoder_probabilities        = NULL;
+	uint16_t *probabilities                = NULL;
+	static char *function                  = "assorted_lzma_encoder_write_lzma";
+	size_t chunk_start_offset              = 0;
+	size_t match_offset                    = 0;
+	size_t next_match_offset               = 0;
+	size_t safe_uncompressed_data_offset   = 0;
+	uint64_t value1                        = 0;
+	uint64_t value2                        = 0;
+	uint32_t distance                      = 0;
+	uint32_t distance_base                 = 0;
+	uint32_t distance_slot                 = 0;
+	uint32_t distances[ 4 ];
+	uint32_t length                        = 0;
+	uint32_t literal_position_mask         = 0;
+	uint32_t literal_state                 = 0;
+	uint32_t match_distance                = 0;
+	uint32_t match_length                  = 0;
+	uint32_t maximum_match_length          = 0;
+	uint32_t most_significant_bit          = 0;
+	uint32_t next_match_distance           = 0;
+	uint32_t next_match_length             = 0;
+	uint32_t number_of_direct_bits         = 0;
+	uint32_t position_mask                 = 0;
+	uint32_t position_state                = 0;
+	uint32_t rep_index                     = 0;
+	uint32_t rep_length                    = 0;
+	uint8_t has_next_match                 = 0;
+	uint8_t number_of_literal_context_bits = 0;
+	uint8_t state                          = 0;
+	int distance_index                     = 0;
+
+	if( encoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
 		 function );
 
 		return( -1 );
 	}
 	safe_uncompressed_data_offset = *uncompressed_data_offset;
 
-	if( safe_uncompressed_data_offset > (size_t) SSIZE_MAX )
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data offset value exceeds maximum.",
+		 "%s: invalid compressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( assorted_bit_stream_get_value(
-	     bit_stream,
-	     8,
-	     &value_32bit,
-	     error ) != 1 )
+	if( compressed_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from bit stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
 		 function );
 
 		return( -1 );
 	}
-	/* The first byte in the encoded bit-stream should be 0
-	 */
-	if( value_32bit != 0 )
+	if( ( *compressed_data_offset > compressed_data_size )
+	 || ( ( compressed_data_size - *compressed_data_offset ) < ( 5 + ASSORTED_LZMA_ENCODER_MAXIMUM_SYMBOL_SIZE ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: unsupported first encoded byte value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
 		 function );
 
 		return( -1 );
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	range_encoder.data        = compressed_data;
+	range_encoder.data_size   = compressed_data_size;
+	range_encoder.data_offset = *compressed_data_offset;
+	range_encoder.low         = 0;
+	range_encoder.range       = 0xffffffffUL;
+	range_encoder.cache       = 0;
+	range_encoder.cache_size  = 1;
+
+	number_of_literal_context_bits = encoder->number_of_literal_context_bits;
+	literal_position_mask          = ( (uint32_t) 1 << encoder->number_of_literal_position_bits ) - 1;
+	position_mask                  = ( (uint32_t) 1 << encoder->number_of_position_bits ) - 1;
+	encoder_probabilities          = encoder->probabilities;
+	state                          = encoder->state;
+	distances[ 0 ]                 = encoder->distances[ 0 ];
+	distances[ 1 ]                 = encoder->distances[ 1 ];
+	distances[ 2 ]                 = encoder->distances[ 2 ];
+	distances[ 3 ]                 = encoder->distances[ 3 ];
+	chunk_start_offset             = safe_uncompressed_data_offset;
+
+	while( safe_uncompressed_data_offset < uncompressed_data_size )
 	{
-		code_sequence = 0;
+		/* Stop when the next symbol could exceed the maximum uncompressed or compressed chunk size
+		 */
+		if( ( safe_uncompressed_data_offset - chunk_start_offset ) > ( ASSORTED_LZMA_MAXIMUM_UNCOMPRESSED_CHUNK_SIZE - ASSORTED_LZMA_MAXIMUM_MATCH_LENGTH ) )
+		{
+			break;
+		}
+		if( ( range_encoder.data_offset + range_encoder.cache_size + 4 + ASSORTED_LZMA_ENCODER_MAXIMUM_SYMBOL_SIZE ) > compressed_data_size )
+		{
+			break;
+		}
+		position_state       = (uint32_t) safe_uncompressed_data_offset & position_mask;
+		maximum_match_length = ASSORTED_LZMA_MAXIMUM_MATCH_LENGTH;
 
-		for( bit_index = 0;
-		     bit_index < 5;
-		     bit_index++ )
+		if( (size_t) maximum_match_length > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
 		{
-			if( assorted_bit_stream_get_value(
-			     bit_stream,
-			     1,
-			     &value_32bit,
-			     error ) != 1 )
+			maximum_match_length = (uint32_t) ( uncompressed_data_size - safe_uncompressed_data_offset );
+		}
+		/* Determine the longest match at one of the last 4 match distances
+		 */
+		rep_index  = 0;
+		rep_length = 0;
+
+		if( maximum_match_length >= ASSORTED_LZMA_MINIMUM_MATCH_LENGTH )
+		{
+			for( distance_index = 0;
+			     distance_index < 4;
+			     distance_index++ )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
-				 function );
+				if( distances[ distance_index ] >= safe_uncompressed_data_offset )
+				{
+					continue;
+				}
+				match_offset = safe_uncompressed_data_offset - distances[ distance_index ] - 1;
 
-				return( -1 );
-			}
-			code_sequence <<= 1;
-			code_sequence  |= (uint8_t) value_32bit;
+				if( ( uncompressed_data[ match_offset ] != uncompressed_data[ safe_uncompressed_data_offset ] )
+				 || ( uncompressed_data[ match_offset + 1 ] != uncompressed_data[ safe_uncompressed_data_offset + 1 ] ) )
+				{
+					continue;
+				}
+				length = 2;
 
-			if( value_32bit == 0 )
-			{
-				break;
+				assorted_lzma_encoder_get_match_length( uncompressed_data, match_offset, safe_uncompressed_data_offset, length, maximum_match_length, value1, value2 )
+
+				if( length > rep_length )
+				{
+					rep_index  = (uint32_t) distance_index;
+					rep_length = length;
+				}
 			}
 		}
-		if( code_sequence == 0x06 )
+		/* Determine the longest match in the hash chains, which was already determined
+		 * when the previous position was deferred by lazy matching
+		 */
+		if( ( has_next_match != 0 )
+		 && ( next_match_offset == safe_uncompressed_data_offset ) )
+		{
+			match_length   = next_match_length;
+			match_distance = next_match_distance;
+		}
+		else
 		{
-			if( assorted_bit_stream_get_value(
-			     bit_stream,
-			     1,
-			     &value_32bit,
+			assorted_lzma_encoder_add_positions( encoder, uncompressed_data, uncompressed_data_size, safe_uncompressed_data_offset )
+
+			if( assorted_lzma_encoder_find_match(
+			     encoder,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     safe_uncompressed_data_offset,
+			     &match_length,
+			     &match_distance,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
+				 "%s: unable to find match.",
 				 function );
 
 				return( -1 );
 			}
-			code_sequence <<= 1;
-			code_sequence  |= (uint8_t) value_32bit;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		has_next_match = 0;
+
+		/* A match of 2 bytes at a large distance costs more than 2 literals
+		 */
+		if( ( match_length == 2 )
+		 && ( match_distance >= 128 ) )
 		{
-			libcnotify_printf(
-			 "%s: code sequence\t\t\t\t\t: 0x%02" PRIx8 "\n",
-			 function,
-			 code_sequence );
+			match_length = 0;
 		}
-#endif
-		if( code_sequence == ASSORTED_LZMA_CONTROL_CODE_LITERAL )
+		if( ( rep_length >= ASSORTED_LZMA_MINIMUM_MATCH_LENGTH )
+		 && ( ( rep_length + 1 ) >= match_length ) )
 		{
-			if( assorted_bit_stream_get_value(
-			     bit_stream,
-			     8,
-			     &value_32bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
-				 function );
+			assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_MATCH + ( state << 4 ) + position_state ], 1 )
+			assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP + state ], 1 )
 
-				return( -1 );
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( rep_index == 0 )
 			{
-				libcnotify_printf(
-				 "%s: literal\t\t\t\t\t: 0x%02" PRIx32 "\n",
-				 function,
-				 value_32bit );
+				assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP0 + state ], 0 )
+				assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP0_LONG + ( state << 4 ) + position_state ], 1 )
 			}
-#endif
-			if( safe_uncompressed_data_offset >= uncompressed_data_size )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
+				assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP0 + state ], 1 )
 
-				return( -1 );
+				if( rep_index == 1 )
+				{
+					assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP1 + state ], 0 )
+				}
+				else
+				{
+					assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP1 + state ], 1 )
+					assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP2 + state ], rep_index - 2 )
+				}
+				distance = distances[ rep_index ];
+
+				if( rep_index == 3 )
+				{
+					distances[ 3 ] = distances[ 2 ];
+				}
+				if( rep_index >= 2 )
+				{
+					distances[ 2 ] = distances[ 1 ];
+				}
+				distances[ 1 ] = distances[ 0 ];
+				distances[ 0 ] = distance;
 			}
-			current_distance = safe_uncompressed_data_offset;
+			probabilities = &( encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_REP_LENGTH ] );
 
-			uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) value_32bit;
-		}
-		else if( code_sequence == ASSORTED_LZMA_CONTROL_CODE_MATCH )
-		{
-/* TODO implement */
-			break;
+			assorted_lzma_length_encoder_encode( range_encoder, probabilities, position_state, rep_length )
+
+			state = ( state < 7 ) ? 8 : 11;
+
+			safe_uncompressed_data_offset += rep_length;
+
+			continue;
 		}
-		else if( code_sequence == ASSORTED_LZMA_CONTROL_CODE_SHORTREP )
+		if( match_length >= ASSORTED_LZMA_MINIMUM_MATCH_LENGTH )
 		{
-			if( safe_uncompressed_data_offset >= uncompressed_data_size )
+			/* With lazy matching the match is deferred by a literal when the next position
+			 * has a longer match
+			 */
+			if( ( encoder->use_lazy_matching != 0 )
+			 && ( match_length < encoder->nice_length )
+			 && ( match_length < maximum_match_length ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
+				next_match_offset = safe_uncompressed_data_offset + 1;
 
-				return( -1 );
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: shortrep\t\t\t\t\t: 0x%02" PRIx8 "\n",
-				 function,
-				 uncompressed_data[ current_distance ] );
-			}
-#endif
-			uncompressed_data[ safe_uncompressed_data_offset++ ] = uncompressed_data[ current_distance ];
-/* TODO determine what current_distance is */
-		}
-		else if( ( code_sequence == ASSORTED_LZMA_CONTROL_CODE_REP0 )
-		      || ( code_sequence == ASSORTED_LZMA_CONTROL_CODE_REP1 )
-		      || ( code_sequence == ASSORTED_LZMA_CONTROL_CODE_REP2 )
-		      || ( code_sequence == ASSORTED_LZMA_CONTROL_CODE_REP3 ) )
-		{
-			length_sequence = 0;
+				assorted_lzma_encoder_add_positions( encoder, uncompressed_data, uncompressed_data_size, next_match_offset )
 
-			for( bit_index = 0;
-			     bit_index < 2;
-			     bit_index++ )
-			{
-				if( assorted_bit_stream_get_value(
-				     bit_stream,
-				     1,
-				     &value_32bit,
+				if( assorted_lzma_encoder_find_match(
+				     encoder,
+				     uncompressed_data,
+				     uncompressed_data_size,
+				     next_match_offset,
+				     &next_match_length,
+				     &next_match_distance,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value from bit stream.",
+					 "%s: unable to find match.",
 					 function );
 
 					return( -1 );
 				}
-				length_sequence <<= 1;
-				length_sequence  |= (uint8_t) value_32bit;
+				has_next_match = 1;
 
-				if( value_32bit == 0 )
+				if( next_match_length > match_length )
 				{
-					break;
+					match_length = 0;
 				}
 			}
-			if( length_sequence == 0x00 )
-			{
-				length_number_of_bits = 3;
-				length                = 2;
-			}
-			else if( length_sequence == 0x02 )
-			{
-				length_number_of_bits = 3;
-				length                = 10;
-			}
-			else if( length_sequence == 0x03 )
-			{
-				length_number_of_bits = 8;
-				length                = 18;
-			}
-			if( assorted_bit_stream_get_value(
-			     bit_stream,
-			     length_number_of_bits,
-			     &value_32bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
-				 function );
+		}
+		if( match_length >= ASSORTED_LZMA_MINIMUM_MATCH_LENGTH )
+		{
+			assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_MATCH + ( state << 4 ) + position_state ], 1 )
+			assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP + state ], 0 )
 
-				return( -1 );
-			}
-			length += (uint16_t) value_32bit;
+			probabilities = &( encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_MATCH_LENGTH ] );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: length sequence\t\t\t\t: 0x%02" PRIx8 "\n",
-				 function,
-				 length_sequence );
+			assorted_lzma_length_encoder_encode( range_encoder, probabilities, position_state, match_length )
 
-				libcnotify_printf(
-				 "%s: length\t\t\t\t\t\t: %" PRIu16 "\n",
-				 function,
-				 length );
-			}
-#endif
-			if( code_sequence == ASSORTED_LZMA_CONTROL_CODE_REP0 )
-			{
-				current_distance = last_distance0;
-			}
-			else if( code_sequence == ASSORTED_LZMA_CONTROL_CODE_REP1 )
+			if( match_length < ( ASSORTED_LZMA_NUMBER_OF_LENGTH_TO_POSITION_STATES + 2 ) )
 			{
-				current_distance = last_distance1;
+				probabilities = &( encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_DISTANCE_SLOTS + ( ( match_length - 2 ) << 6 ) ] );
 			}
-			else if( code_sequence == ASSORTED_LZMA_CONTROL_CODE_REP2 )
+			else
 			{
-				current_distance = last_distance2;
+				probabilities = &( encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_DISTANCE_SLOTS + ( ( ASSORTED_LZMA_NUMBER_OF_LENGTH_TO_POSITION_STATES - 1 ) << 6 ) ] );
 			}
-			else if( code_sequence == ASSORTED_LZMA_CONTROL_CODE_REP3 )
+			/* The distance slot consists of the index of the most significant bit
+			 * and the bit that follows it
+			 */
+			if( match_distance < 4 )
 			{
-				current_distance = last_distance3;
+				distance_slot = match_distance;
 			}
-			if( ( length > uncompressed_data_size )
-			 || ( safe_uncompressed_data_offset >= ( uncompressed_data_size - length ) ) )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
+#if defined( __GNUC__ )
+				most_significant_bit = 31 - (uint32_t) __builtin_clz( match_distance );
+#else
+				most_significant_bit = 0;
 
-				return( -1 );
+				for( distance = match_distance >> 1;
+				     distance != 0;
+				     distance >>= 1 )
+				{
+					most_significant_bit++;
+				}
+#endif
+				distance_slot = ( most_significant_bit << 1 ) | ( ( match_distance >> ( most_significant_bit - 1 ) ) & 1 );
 			}
-			while( length > 0 )
+			assorted_lzma_range_encoder_encode_tree( range_encoder, probabilities, 6, distance_slot )
+
+			if( distance_slot >= 4 )
 			{
-				uncompressed_data[ safe_uncompressed_data_offset++ ] = uncompressed_data[ current_distance++ ];
+				number_of_direct_bits = ( distance_slot >> 1 ) - 1;
+				distance_base         = ( 2 | ( distance_slot & 1 ) ) << number_of_direct_bits;
+				distance              = match_distance - distance_base;
+
+				if( distance_slot < ASSORTED_LZMA_END_POSITION_MODEL_INDEX )
+				{
+					probabilities = &( encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_DISTANCE_SPECIAL + distance_base - distance_slot ] );
+
+					assorted_lzma_range_encoder_encode_reverse_tree( range_encoder, probabilities, number_of_direct_bits, distance )
+				}
+				else
+				{
+					assorted_lzma_range_encoder_encode_direct_bits( range_encoder, distance >> ASSORTED_LZMA_NUMBER_OF_ALIGN_BITS, number_of_direct_bits - ASSORTED_LZMA_NUMBER_OF_ALIGN_BITS )
 
-				length--;
+					probabilities = &( encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_DISTANCE_ALIGN ] );
+
+					assorted_lzma_range_encoder_encode_reverse_tree( range_encoder, probabilities, ASSORTED_LZMA_NUMBER_OF_ALIGN_BITS, distance & 0x0f )
+				}
 			}
+			distances[ 3 ] = distances[ 2 ];
+			distances[ 2 ] = distances[ 1 ];
+			distances[ 1 ] = distances[ 0 ];
+			distances[ 0 ] = match_distance;
+
+			state = ( state < 7 ) ? 7 : 10;
+
+			safe_uncompressed_data_offset += match_length;
+
+			continue;
 		}
-		else
+		/* A short rep is a single byte match at rep0, which is cheaper than a literal
+		 */
+		if( ( distances[ 0 ] < safe_uncompressed_data_offset )
+		 && ( uncompressed_data[ safe_uncompressed_data_offset - distances[ 0 ] - 1 ] == uncompressed_data[ safe_uncompressed_data_offset ] ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported code sequence: 0x%02" PRIx8 ".",
-			 function,
-			 code_sequence );
+			assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_MATCH + ( state << 4 ) + position_state ], 1 )
+			assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP + state ], 1 )
+			assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP0 + state ], 0 )
+			assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_REP0_LONG + ( state << 4 ) + position_state ], 0 )
 
-			return( -1 );
+			state = ( state < 7 ) ? 9 : 11;
+
+			safe_uncompressed_data_offset += 1;
+
+			continue;
+		}
+		assorted_lzma_range_encoder_encode_bit( range_encoder, encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_MATCH + ( state << 4 ) + position_state ], 0 )
+
+		literal_state = ( (uint32_t) safe_uncompressed_data_offset & literal_position_mask ) << number_of_literal_context_bits;
+
+		if( safe_uncompressed_data_offset > 0 )
+		{
+			literal_state += uncompressed_data[ safe_uncompressed_data_offset - 1 ] >> ( 8 - number_of_literal_context_bits );
+		}
+		probabilities = &( encoder_probabilities[ ASSORTED_LZMA_PROBABILITIES_LITERALS + ( literal_state * 0x300 ) ] );
+
+		if( state < 7 )
+		{
+			assorted_lzma_range_encoder_encode_tree( range_encoder, probabilities, 8, uncompressed_data[ safe_uncompressed_data_offset ] )
+		}
+		else
+		{
+			assorted_lzma_range_encoder_encode_matched_literal( range_encoder, probabilities, uncompressed_data[ safe_uncompressed_data_offset - distances[ 0 ] - 1 ], uncompressed_data[ safe_uncompressed_data_offset ] )
+		}
+		if( state < 4 )
+		{
+			state = 0;
+		}
+		else if( state < 10 )
+		{
+			state -= 3;
+		}
+		else
+		{
+			state -= 6;
 		}
-/* TODO determine what when last_distance[0-3] should be updated is */
-		last_distance3 = last_distance2;
-		last_distance2 = last_distance1;
-		last_distance1 = last_distance0;
-		last_distance0 = current_distance;
+		safe_uncompressed_data_offset += 1;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* Flush the low value and the pending bytes
+	 */
+	for( distance_index = 0;
+	     distance_index < 5;
+	     distance_index++ )
 	{
-		libcnotify_printf(
-		 "\n" );
+		assorted_lzma_range_encoder_shift_low( range_encoder )
 	}
-#endif
+	if( range_encoder.data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	encoder->state          = state;
+	encoder->distances[ 0 ] = distances[ 0 ];
+	encoder->distances[ 1 ] = distances[ 1 ];
+	encoder->distances[ 2 ] = distances[ 2 ];
+	encoder->distances[ 3 ] = distances[ 3 ];
+
+	*compressed_data_offset   = range_encoder.data_offset;
 	*uncompressed_data_offset = safe_uncompressed_data_offset;
 
 	return( 1 );
 }
 
-/* Reads a LZMA2 encoded block
+/* Writes LZMA2 chunks using an encoder
+ * The first chunk resets the dictionary, hence the chunks can be decoded independently.
+ * A chunk that does not compress is stored as uncompressed chunks
  * Returns 1 on success or -1 on error
  */
-int assorted_lzma_read_lzma2_block(
-     const uint8_t *compressed_data,
+int assorted_lzma_encoder_write_lzma2_chunks(
+     assorted_lzma_encoder_t *encoder,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *compressed_data_offset,
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
-	assorted_bit_stream_t *bit_stream    = NULL;
-	static char *function                = "assorted_lzma_read_lzma2_block";
+	static char *function                = "assorted_lzma_encoder_write_lzma2_chunks";
+	size_t chunk_data_offset             = 0;
+	size_t chunk_start_offset            = 0;
 	size_t safe_compressed_data_offset   = 0;
 	size_t safe_uncompressed_data_offset = 0;
-	uint32_t chunk_data_size             = 0;
+	size_t stored_data_size              = 0;
 	uint32_t uncompressed_chunk_size     = 0;
 	uint8_t control_code                 = 0;
-	uint8_t properties_value             = 0;
-	uint8_t read_encoded_data            = 0;
-	uint8_t read_properties              = 0;
-	uint8_t read_uncompressed_chunk_size = 0;
-	uint8_t reset_dictionary             = 0;
-
-	uint8_t pb_value                     = 0;
-	uint8_t lp_value                     = 0;
-	uint8_t lc_value                     = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	size_t block_data_offset             = 0;
-#endif
+	uint8_t requires_dictionary_reset    = 1;
+	uint8_t requires_properties          = 1;
+	uint8_t requires_state_reset         = 1;
 
-	if( compressed_data == NULL )
+	if( encoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid encoder.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( compressed_data_size < 1 )
-	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid compressed data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_offset == NULL )
+	if( uncompressed_data_size >= (size_t) UINT32_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data offset.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	safe_compressed_data_offset = *compressed_data_offset;
-
-	if( uncompressed_data == NULL )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( compressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 "%s: invalid compressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_offset == NULL )
+	if( compressed_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data offset.",
+		 "%s: invalid compressed data offset.",
 		 function );
 
 		return( -1 );
 	}
-	safe_uncompressed_data_offset = *uncompressed_data_offset;
+	safe_compressed_data_offset = *compressed_data_offset;
 
-	if( safe_uncompressed_data_offset > (size_t) SSIZE_MAX )
+	if( safe_compressed_data_offset > compressed_data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data offset value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	while( safe_compressed_data_offset < compressed_data_size )
+	/* The dictionary is reset, hence the hash chains start empty
+	 */
+	if( memory_set(
+	     encoder->hash_table,
+	     0,
+	     sizeof( uint32_t ) << encoder->number_of_hash_bits ) == NULL )
 	{
-		if( safe_compressed_data_offset > ( compressed_data_size - 1 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid compressed data value too small.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
 
-			goto on_error;
-		}
-		control_code = compressed_data[ safe_compressed_data_offset++ ];
+		return( -1 );
+	}
+	encoder->hashed_data_offset = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: control code\t\t\t\t: 0x%02" PRIx8 "\n",
-			 function,
-			 control_code );
-		}
-#endif
-		if( control_code == 0x00 )
+	while( safe_uncompressed_data_offset < uncompressed_data_size )
+	{
+		/* The state must be reset after the dictionary is reset and after an uncompressed chunk
+		 */
+		if( requires_state_reset != 0 )
 		{
-			break;
+			if( assorted_lzma_encoder_reset_state(
+			     encoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reset state.",
+				 function );
+
+				return( -1 );
+			}
 		}
-		if( ( control_code >= 0x02 )
-		 && ( control_code <= 0x7f ) )
+		chunk_start_offset = safe_uncompressed_data_offset;
+		chunk_data_offset  = 0;
+
+		if( assorted_lzma_encoder_write_lzma(
+		     encoder,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     &safe_uncompressed_data_offset,
+		     encoder->chunk_data,
+		     ASSORTED_LZMA_MAXIMUM_COMPRESSED_CHUNK_SIZE,
+		     &chunk_data_offset,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: unsupported control code value out of bounds.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write LZMA encoded data.",
 			 function );
 
-			goto on_error;
-		}
-		if( control_code == 0x01 )
-		{
-			reset_dictionary  = 1;
-			read_encoded_data = 0;
+			return( -1 );
 		}
-		else
+		uncompressed_chunk_size = (uint32_t) ( safe_uncompressed_data_offset - chunk_start_offset );
+
+		if( chunk_data_offset < (size_t) uncompressed_chunk_size )
 		{
-			if( control_code >= 0xe0 )
+			if( requires_dictionary_reset != 0 )
 			{
-				reset_dictionary = 1;
+				control_code = 0xe0;
 			}
-			if( control_code >= 0xc0 )
+			else if( requires_properties != 0 )
 			{
-				read_properties = 1;
+				control_code = 0xc0;
 			}
-			if( control_code >= 0xa0 )
+			else if( requires_state_reset != 0 )
 			{
-/* TODO implement */
+				control_code = 0xa0;
 			}
-			read_uncompressed_chunk_size = 1;
-			read_encoded_data            = 1;
-		}
-		if( read_uncompressed_chunk_size != 0 )
-		{
-			if( safe_compressed_data_offset > ( compressed_data_size - 2 ) )
+			else
+			{
+				control_code = 0x80;
+			}
+			if( ( compressed_data_size - safe_compressed_data_offset ) < ( chunk_data_offset + 6 ) )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
 				 "%s: invalid compressed data value too small.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			uncompressed_chunk_size  = (uint32_t) ( control_code & 0x1f ) << 8;
-			uncompressed_chunk_size += (uint32_t) compressed_data[ safe_compressed_data_offset++ ] << 8;
-			uncompressed_chunk_size |= compressed_data[ safe_compressed_data_offset++ ];
-			uncompressed_chunk_size += 1;
+			compressed_data[ safe_compressed_data_offset++ ] = control_code | (uint8_t) ( ( uncompressed_chunk_size - 1 ) >> 16 );
+			compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( ( uncompressed_chunk_size - 1 ) >> 8 );
+			compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( uncompressed_chunk_size - 1 );
+			compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( ( chunk_data_offset - 1 ) >> 8 );
+			compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( chunk_data_offset - 1 );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( control_code >= 0xc0 )
 			{
-				libcnotify_printf(
-				 "%s: uncompressed chunk size\t\t\t: %" PRIu32 "\n",
-				 function,
-				 uncompressed_chunk_size );
+				compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( ( ( ( encoder->number_of_position_bits * 5 ) + encoder->number_of_literal_position_bits ) * 9 ) + encoder->number_of_literal_context_bits );
 			}
-#endif
-			read_uncompressed_chunk_size = 0;
-		}
-		if( safe_compressed_data_offset > ( compressed_data_size - 2 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid compressed data value too small.",
-			 function );
-
-			goto on_error;
-		}
-		chunk_data_size  = (uint32_t) compressed_data[ safe_compressed_data_offset++ ] << 8;
-		chunk_data_size |= compressed_data[ safe_compressed_data_offset++ ];
-		chunk_data_size += 1;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: chunk data size\t\t\t\t: %" PRIu32 "\n",
-			 function,
-			 chunk_data_size );
-		}
-#endif
-		if( read_properties != 0 )
-		{
-			if( safe_compressed_data_offset > ( compressed_data_size - 1 ) )
+			if( memory_copy(
+			     &( compressed_data[ safe_compressed_data_offset ] ),
+			     encoder->chunk_data,
+			     chunk_data_offset ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid compressed data value too small.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chunk data.",
 				 function );
 
-				goto on_error;
-			}
-			properties_value = compressed_data[ safe_compressed_data_offset++ ];
-
-/* TODO implement */
-			pb_value          = properties_value / ( 9 * 5 );
-			properties_value -= pb_value * 9 * 5;
-			lp_value          = properties_value / 9;
-			lc_value          = properties_value - ( properties_value * 9 );
-			properties_value += pb_value * 9 * 5;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: properties value\t\t\t: 0x%02" PRIx8 " (pb: %" PRId8 ", lp: %" PRId8 ", lc: %" PRId8 ")\n",
-				 function,
-				 properties_value,
-				 pb_value,
-				 lp_value,
-				 lc_value );
+				return( -1 );
 			}
-#endif
-			read_properties = 0;
-		}
-		if( ( chunk_data_size > compressed_data_size )
-		 || ( safe_compressed_data_offset > ( compressed_data_size - chunk_data_size ) ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid compressed data value too small.",
-			 function );
+			safe_compressed_data_offset += chunk_data_offset;
 
-			goto on_error;
+			requires_dictionary_reset = 0;
+			requires_properties       = 0;
+			requires_state_reset      = 0;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		else
 		{
-			libcnotify_printf(
-			 "%s: compressed chunk data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( compressed_data[ safe_compressed_data_offset ] ),
-			 chunk_data_size,
-			 0 );
-		}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-		block_data_offset = safe_uncompressed_data_offset;
-#endif
-		if( read_encoded_data != 0 )
-		{
-			if( assorted_bit_stream_initialize(
-			     &bit_stream,
-			     compressed_data,
-			     compressed_data_size,
-			     safe_compressed_data_offset,
-			     ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
-			     error ) != 1 )
+			/* An uncompressed chunk contains at most 64 KiB
+			 */
+			while( chunk_start_offset < safe_uncompressed_data_offset )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create bit stream.",
-				 function );
+				stored_data_size = safe_uncompressed_data_offset - chunk_start_offset;
 
-				goto on_error;
-			}
-			if( assorted_lzma_read_lzma(
-			     bit_stream,
-			     uncompressed_data,
-			     uncompressed_data_size,
-			     &safe_uncompressed_data_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read LZMA encoded data.",
-				 function );
+				if( stored_data_size > 65536 )
+				{
+					stored_data_size = 65536;
+				}
+				if( ( compressed_data_size - safe_compressed_data_offset ) < ( stored_data_size + 3 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+					 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+					 "%s: invalid compressed data value too small.",
+					 function );
 
-				goto on_error;
-			}
-			if( assorted_bit_stream_free(
-			     &bit_stream,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free bit stream.",
-				 function );
+					return( -1 );
+				}
+				/* Control code 0x01 resets the dictionary, which requires the next LZMA chunk to set the properties
+				 */
+				if( requires_dictionary_reset != 0 )
+				{
+					compressed_data[ safe_compressed_data_offset++ ] = 0x01;
+				}
+				else
+				{
+					compressed_data[ safe_compressed_data_offset++ ] = 0x02;
+				}
+				compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( ( stored_data_size - 1 ) >> 8 );
+				compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( stored_data_size - 1 );
 
-				goto on_error;
-			}
-		}
-		else
-		{
-/* TODO implement read uncompressed data */
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: chunk data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( uncompressed_data[ block_data_offset ] ),
-			 safe_uncompressed_data_offset - block_data_offset,
-			 0 );
+				if( memory_copy(
+				     &( compressed_data[ safe_compressed_data_offset ] ),
+				     &( uncompressed_data[ chunk_start_offset ] ),
+				     stored_data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy uncompressed chunk data.",
+					 function );
+
+					return( -1 );
+				}
+				safe_compressed_data_offset += stored_data_size;
+				chunk_start_offset          += stored_data_size;
+
+				requires_dictionary_reset = 0;
+			}
+			requires_state_reset = 1;
 		}
-#endif
-		safe_compressed_data_offset += chunk_data_size;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( safe_compressed_data_offset >= compressed_data_size )
 	{
-		libcnotify_printf(
-		 "\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
 	}
-#endif
+	/* The end of chunks control code
+	 */
+	compressed_data[ safe_compressed_data_offset++ ] = 0x00;
+
 	*compressed_data_offset = safe_compressed_data_offset;
 
 	return( 1 );
-
-on_error:
-	if( bit_stream != NULL )
-	{
-		assorted_bit_stream_free(
-		 &bit_stream,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Reads the stream footer
+/* Writes a block using an encoder
+ * The block consists of the block header, the LZMA2 chunks, the padding and a CRC-64 check
  * Returns 1 on success or -1 on error
  */
-int assorted_lzma_read_stream_footer(
-     const uint8_t *compressed_data,
+int assorted_lzma_encoder_write_block(
+     assorted_lzma_encoder_t *encoder,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *compressed_data_offset,
+     uint64_t *unpadded_size,
      libcerror_error_t **error )
 {
-	static char *function              = "assorted_lzma_read_stream_footer";
+	static char *function              = "assorted_lzma_encoder_write_block";
+	size_t block_start_offset          = 0;
 	size_t safe_compressed_data_offset = 0;
+	size_t safe_unpadded_size          = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit               = 0;
-	uint16_t value_16bit               = 0;
-#endif
-
-	if( compressed_data == NULL )
+	if( encoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid encoder.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( compressed_data_size < 12 )
-	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	if( compressed_data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid compressed data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_offset == NULL )
+	if( unpadded_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data offset.",
+		 "%s: invalid unpadded size.",
 		 function );
 
 		return( -1 );
 	}
-	safe_compressed_data_offset = *compressed_data_offset;
+	block_start_offset          = *compressed_data_offset;
+	safe_compressed_data_offset = block_start_offset;
 
-	if( safe_compressed_data_offset > ( compressed_data_size - 12 ) )
+	if( assorted_lzma_write_block_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_compressed_data_offset,
+	     encoder->dictionary_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid compressed data value too small.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block header.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: stream footer data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( compressed_data[ safe_compressed_data_offset ] ),
-		 12,
-		 0 );
-	}
-#endif
-	if( ( compressed_data[ safe_compressed_data_offset + 10 ] != 'Y' )
-	 || ( compressed_data[ safe_compressed_data_offset + 11 ] != 'Z' ) )
+	if( assorted_lzma_encoder_write_lzma2_chunks(
+	     encoder,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_compressed_data_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported signature.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write LZMA2 chunks.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( compressed_data[ safe_compressed_data_offset ] ),
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 &( compressed_data[ safe_compressed_data_offset + 4 ] ),
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: backwards size\t\t\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-
-		byte_stream_copy_to_uint16_little_endian(
-		 &( compressed_data[ safe_compressed_data_offset + 8 ] ),
-		 value_16bit );
-		libcnotify_printf(
-		 "%s: stream flags\t\t\t\t: 0x%04" PRIx16 "\n",
-		 function,
-		 value_16bit );
+	safe_unpadded_size = safe_compressed_data_offset - block_start_offset;
 
-		libcnotify_printf(
-		 "%s: signature\t\t\t\t: %c%c\n",
-		 function,
-		 compressed_data[ safe_compressed_data_offset + 10 ],
-		 compressed_data[ safe_compressed_data_offset + 11 ] );
+	/* The block data is padded to a multiple of 4 bytes, the padding is not part of the unpadded size
+	 */
+	while( ( ( safe_compressed_data_offset - block_start_offset ) % 4 ) != 0 )
+	{
+		if( safe_compressed_data_offset >= compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+			 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+			 "%s: invalid compressed data value too small.",
+			 function );
 
-		libcnotify_printf(
-		 "\n" );
+			return( -1 );
+		}
+		compressed_data[ safe_compressed_data_offset++ ] = 0;
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	if( assorted_lzma_write_block_check(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_compressed_data_offset,
+	     ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block check.",
+		 function );
 
-	*compressed_data_offset = safe_compressed_data_offset + 12;
+		return( -1 );
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+	*unpadded_size          = (uint64_t) safe_unpadded_size + 8;
 
 	return( 1 );
 }
 
-/* Decompresses LZMA compressed data
+/* Compresses data using LZMA2 compression into a XZ stream
+ * The data is split into blocks of the block size of the compression preset,
+ * which are compressed independently and described by the index
  * Returns 1 on success or -1 on error
  */
-int assorted_lzma_decompress(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
+int assorted_lzma_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_preset,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function              = "assorted_lzma_decompress";
-	size_t compressed_data_offset      = 0;
-	size_t safe_uncompressed_data_size = 0;
-	size_t uncompressed_data_offset    = 0;
+	assorted_lzma_encoder_t *encoder      = NULL;
+	assorted_lzma_index_record_t *records = NULL;
+	static char *function                 = "assorted_lzma_compress";
+	size_t block_data_size                = 0;
+	size_t block_index                    = 0;
+	size_t block_size                     = 0;
+	size_t index_offset                   = 0;
+	size_t number_of_blocks               = 0;
+	size_t safe_compressed_data_offset    = 0;
+	size_t uncompressed_data_offset       = 0;
 
-	if( compressed_data == NULL )
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( compressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid compressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
 
-	if( assorted_lzma_read_stream_header(
-	     compressed_data,
-	     compressed_data_size,
-	     &compressed_data_offset,
+		return( -1 );
+	}
+	if( assorted_lzma_get_compression_block_size(
+	     compression_preset,
+	     &block_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read stream header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression block size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	while( compressed_data_offset < compressed_data_size )
+	number_of_blocks = uncompressed_data_size / block_size;
+
+	if( ( uncompressed_data_size % block_size ) != 0 )
 	{
-		if( assorted_lzma_read_block_header(
-		     compressed_data,
-		     compressed_data_size,
-		     &compressed_data_offset,
+		number_of_blocks += 1;
+	}
+	if( number_of_blocks > 0 )
+	{
+		records = (assorted_lzma_index_record_t *) memory_allocate(
+		                                            sizeof( assorted_lzma_index_record_t ) * number_of_blocks );
+
+		if( records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index records.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_lzma_encoder_initialize(
+		     &encoder,
+		     compression_preset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read block header.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create encoder.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-/* TODO make sure LZMA2 filter is present */
-		if( assorted_lzma_read_lzma2_block(
+	}
+	if( assorted_lzma_write_stream_header(
+	     compressed_data,
+	     *compressed_data_size,
+	     &safe_compressed_data_offset,
+	     ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write stream header.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		block_data_size = uncompressed_data_size - uncompressed_data_offset;
+
+		if( block_data_size > block_size )
+		{
+			block_data_size = block_size;
+		}
+		if( assorted_lzma_encoder_write_block(
+		     encoder,
+		     &( uncompressed_data[ uncompressed_data_offset ] ),
+		     block_data_size,
 		     compressed_data,
-		     compressed_data_size,
-		     &compressed_data_offset,
-		     uncompressed_data,
-		     safe_uncompressed_data_size,
-		     &uncompressed_data_offset,
+		     *compressed_data_size,
+		     &safe_compressed_data_offset,
+		     &( records[ block_index ].unpadded_size ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read LZMA2 block.",
-			 function );
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block: %" PRIzd ".",
+			 function,
+			 block_index );
 
-			return( -1 );
+			goto on_error;
 		}
+		records[ block_index ].uncompressed_size = (uint64_t) block_data_size;
+
+		uncompressed_data_offset += block_data_size;
 	}
-	if( assorted_lzma_read_stream_footer(
+	index_offset = safe_compressed_data_offset;
+
+	if( assorted_lzma_write_index(
 	     compressed_data,
-	     compressed_data_size,
-	     &compressed_data_offset,
+	     *compressed_data_size,
+	     &safe_compressed_data_offset,
+	     records,
+	     number_of_blocks,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read stream footer.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*uncompressed_data_size = uncompressed_data_offset;
+	if( assorted_lzma_write_stream_footer(
+	     compressed_data,
+	     *compressed_data_size,
+	     &safe_compressed_data_offset,
+	     safe_compressed_data_offset - index_offset,
+	     ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write stream footer.",
+		 function );
+
+		goto on_error;
+	}
+	if( encoder != NULL )
+	{
+		if( assorted_lzma_encoder_free(
+		     &encoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free encoder.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( records != NULL )
+	{
+		memory_free(
+		 records );
+	}
+	*compressed_data_size = safe_compressed_data_offset;
 
 	return( 1 );
+
+on_error:
+	if( encoder != NULL )
+	{
+		assorted_lzma_encoder_free(
+		 &encoder,
+		 NULL );
+	}
+	if( records != NULL )
+	{
+		memory_free(
+		 records );
+	}
+	return( -1 );
 }
 
@@ -25,15 +25,731 @@
 #include <common.h>
 #include <types.h>
 
-#include "assorted_bit_stream.h"
+#include "assorted_arena.h"
 #include "assorted_libcerror.h"
+#include "assorted_libhmac.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-#define ASSORTED_LZMA_NUMBER_OF_STATES		12
-#define ASSORTED_LZMA_NUMBER_OF_POSITION_STATES	16
+#define ASSORTED_LZMA_NUMBER_OF_STATES				12
+#define ASSORTED_LZMA_NUMBER_OF_POSITION_STATES			16
+#define ASSORTED_LZMA_NUMBER_OF_LITERAL_STATES			16
+#define ASSORTED_LZMA_NUMBER_OF_LENGTH_TO_POSITION_STATES	4
+#define ASSORTED_LZMA_NUMBER_OF_DISTANCE_SLOTS			64
+#define ASSORTED_LZMA_NUMBER_OF_FULL_DISTANCES			128
+#define ASSORTED_LZMA_END_POSITION_MODEL_INDEX			14
+#define ASSORTED_LZMA_NUMBER_OF_ALIGN_BITS			4
+
+/* The check types of the XZ stream flags
+ */
+#define ASSORTED_LZMA_CHECK_TYPE_NONE				0x00
+#define ASSORTED_LZMA_CHECK_TYPE_CRC32				0x01
+#define ASSORTED_LZMA_CHECK_TYPE_CRC64				0x04
+#define ASSORTED_LZMA_CHECK_TYPE_SHA256				0x0a
+
+/* The compression presets of the encoder
+ */
+#define ASSORTED_LZMA_COMPRESSION_PRESET_FAST			1
+#define ASSORTED_LZMA_COMPRESSION_PRESET_NORMAL			2
+
+/* The dictionary sizes of the compression presets
+ */
+#define ASSORTED_LZMA_ENCODER_FAST_DICTIONARY_SIZE		( 1024 * 1024 )
+#define ASSORTED_LZMA_ENCODER_NORMAL_DICTIONARY_SIZE		( 8 * 1024 * 1024 )
+
+/* The limits of a LZMA2 chunk
+ */
+#define ASSORTED_LZMA_MAXIMUM_UNCOMPRESSED_CHUNK_SIZE		( 2 * 1024 * 1024 )
+#define ASSORTED_LZMA_MAXIMUM_COMPRESSED_CHUNK_SIZE		65536
+
+/* The match lengths of the encoder
+ */
+#define ASSORTED_LZMA_MINIMUM_MATCH_LENGTH			2
+#define ASSORTED_LZMA_MAXIMUM_MATCH_LENGTH			273
+
+/* The maximum number of bytes the encoding of a single literal or match adds to a chunk
+ */
+#define ASSORTED_LZMA_ENCODER_MAXIMUM_SYMBOL_SIZE		32
+
+/* The range decoder normalizes the range to 2^24 and stores probabilities as 11-bit values
+ */
+#define ASSORTED_LZMA_RANGE_DECODER_TOP_VALUE			0x01000000UL
+#define ASSORTED_LZMA_NUMBER_OF_PROBABILITY_BITS		11
+#define ASSORTED_LZMA_NUMBER_OF_MOVE_BITS			5
+#define ASSORTED_LZMA_INITIAL_PROBABILITY			( 1 << ( ASSORTED_LZMA_NUMBER_OF_PROBABILITY_BITS - 1 ) )
+
+/* The offsets of the probabilities of a length decoder
+ * The low and mid bit-trees consist of 8 probabilities per position state
+ */
+#define ASSORTED_LZMA_LENGTH_PROBABILITIES_CHOICE		0
+#define ASSORTED_LZMA_LENGTH_PROBABILITIES_CHOICE2		1
+#define ASSORTED_LZMA_LENGTH_PROBABILITIES_LOW			2
+#define ASSORTED_LZMA_LENGTH_PROBABILITIES_MID			( ASSORTED_LZMA_LENGTH_PROBABILITIES_LOW + ( ASSORTED_LZMA_NUMBER_OF_POSITION_STATES << 3 ) )
+#define ASSORTED_LZMA_LENGTH_PROBABILITIES_HIGH			( ASSORTED_LZMA_LENGTH_PROBABILITIES_MID + ( ASSORTED_LZMA_NUMBER_OF_POSITION_STATES << 3 ) )
+#define ASSORTED_LZMA_NUMBER_OF_LENGTH_PROBABILITIES		( ASSORTED_LZMA_LENGTH_PROBABILITIES_HIGH + 256 )
+
+/* The offsets of the probabilities in the probabilities block of a decoder
+ * The is match and is rep probabilities, used for every symbol, are stored first
+ * so that they share cache lines, the literal probabilities start at a 64-byte boundary
+ */
+#define ASSORTED_LZMA_PROBABILITIES_IS_MATCH			0
+#define ASSORTED_LZMA_PROBABILITIES_IS_REP0_LONG		( ASSORTED_LZMA_PROBABILITIES_IS_MATCH + ( ASSORTED_LZMA_NUMBER_OF_STATES * ASSORTED_LZMA_NUMBER_OF_POSITION_STATES ) )
+#define ASSORTED_LZMA_PROBABILITIES_IS_REP			( ASSORTED_LZMA_PROBABILITIES_IS_REP0_LONG + ( ASSORTED_LZMA_NUMBER_OF_STATES * ASSORTED_LZMA_NUMBER_OF_POSITION_STATES ) )
+#define ASSORTED_LZMA_PROBABILITIES_IS_REP0			( ASSORTED_LZMA_PROBABILITIES_IS_REP + ASSORTED_LZMA_NUMBER_OF_STATES )
+#define ASSORTED_LZMA_PROBABILITIES_IS_REP1			( ASSORTED_LZMA_PROBABILITIES_IS_REP0 + ASSORTED_LZMA_NUMBER_OF_STATES )
+#define ASSORTED_LZMA_PROBABILITIES_IS_REP2			( ASSORTED_LZMA_PROBABILITIES_IS_REP1 + ASSORTED_LZMA_NUMBER_OF_STATES )
+#define ASSORTED_LZMA_PROBABILITIES_DISTANCE_SLOTS		( ASSORTED_LZMA_PROBABILITIES_IS_REP2 + ASSORTED_LZMA_NUMBER_OF_STATES )
+#define ASSORTED_LZMA_PROBABILITIES_DISTANCE_SPECIAL		( ASSORTED_LZMA_PROBABILITIES_DISTANCE_SLOTS + ( ASSORTED_LZMA_NUMBER_OF_LENGTH_TO_POSITION_STATES * ASSORTED_LZMA_NUMBER_OF_DISTANCE_SLOTS ) )
+#define ASSORTED_LZMA_PROBABILITIES_DISTANCE_ALIGN		( ASSORTED_LZMA_PROBABILITIES_DISTANCE_SPECIAL + ( ASSORTED_LZMA_NUMBER_OF_FULL_DISTANCES - ASSORTED_LZMA_END_POSITION_MODEL_INDEX ) )
+#define ASSORTED_LZMA_PROBABILITIES_MATCH_LENGTH		( ASSORTED_LZMA_PROBABILITIES_DISTANCE_ALIGN + ( 1 << ASSORTED_LZMA_NUMBER_OF_ALIGN_BITS ) )
+#define ASSORTED_LZMA_PROBABILITIES_REP_LENGTH			( ASSORTED_LZMA_PROBABILITIES_MATCH_LENGTH + ASSORTED_LZMA_NUMBER_OF_LENGTH_PROBABILITIES )
+#define ASSORTED_LZMA_PROBABILITIES_LITERALS			( ( ASSORTED_LZMA_PROBABILITIES_REP_LENGTH + ASSORTED_LZMA_NUMBER_OF_LENGTH_PROBABILITIES + 31 ) & ~31 )
+#define ASSORTED_LZMA_NUMBER_OF_PROBABILITIES			( ASSORTED_LZMA_PROBABILITIES_LITERALS + ( ASSORTED_LZMA_NUMBER_OF_LITERAL_STATES * 0x300 ) )
+
+typedef struct assorted_lzma_range_decoder assorted_lzma_range_decoder_t;
+
+struct assorted_lzma_range_decoder
+{
+	/* The compressed data
+	 */
+	const uint8_t *data;
+
+	/* The compressed data size
+	 */
+	size_t data_size;
+
+	/* The compressed data offset
+	 * Note that the offset can exceed the size, in which case 0-byte values are read
+	 */
+	size_t data_offset;
+
+	/* The range
+	 */
+	uint32_t range;
+
+	/* The code
+	 */
+	uint32_t code;
+};
+
+/* Normalizes the range decoder
+ * Reading past the end of the data returns 0-byte values, the caller is
+ * responsible for checking the data offset after decoding
+ */
+#define assorted_lzma_range_decoder_normalize( range_decoder ) \
+	if( ( range_decoder ).range < ASSORTED_LZMA_RANGE_DECODER_TOP_VALUE ) \
+	{ \
+		( range_decoder ).range <<= 8; \
+		( range_decoder ).code    = ( ( range_decoder ).code << 8 ) \
+		                          | ( ( ( range_decoder ).data_offset < ( range_decoder ).data_size ) ? ( range_decoder ).data[ ( range_decoder ).data_offset ] : 0 ); \
+		( range_decoder ).data_offset += 1; \
+	}
+
+/* Decodes a bit using the value of an adaptive probability and stores the updated probability
+ * The range, code and probability are updated with a mask instead of branches,
+ * where the mask is 0xffffffff for a 1-bit and 0 for a 0-bit
+ * The range decoder must be normalized before
+ */
+#define assorted_lzma_range_decoder_decode_masked_bit( range_decoder, probability_value, probability, mask ) \
+	{ \
+		uint32_t range_decoder_bound = 0; \
+\
+		range_decoder_bound = ( ( range_decoder ).range >> ASSORTED_LZMA_NUMBER_OF_PROBABILITY_BITS ) * ( probability_value ); \
+		mask                = (uint32_t) 0 - (uint32_t) ( ( range_decoder ).code >= range_decoder_bound ); \
+\
+		( range_decoder ).range = ( ( range_decoder ).code >= range_decoder_bound ) ? ( range_decoder ).range - range_decoder_bound : range_decoder_bound; \
+		( range_decoder ).code -= range_decoder_bound & mask; \
+\
+		( probability ) = (uint16_t) ( ( probability_value ) \
+		                + ( ( ( ( 1 << ASSORTED_LZMA_NUMBER_OF_PROBABILITY_BITS ) - ( probability_value ) ) >> ASSORTED_LZMA_NUMBER_OF_MOVE_BITS ) & ~mask ) \
+		                - ( ( ( probability_value ) >> ASSORTED_LZMA_NUMBER_OF_MOVE_BITS ) & mask ) ); \
+	}
+
+/* Decodes a bit using an adaptive probability
+ */
+#define assorted_lzma_range_decoder_decode_bit( range_decoder, probability, bit ) \
+	{ \
+		uint32_t range_decoder_mask  = 0; \
+		uint32_t range_decoder_value = 0; \
+\
+		assorted_lzma_range_decoder_normalize( range_decoder ) \
+\
+		range_decoder_value = ( probability ); \
+\
+		assorted_lzma_range_decoder_decode_masked_bit( range_decoder, range_decoder_value, probability, range_decoder_mask ) \
+\
+		bit = range_decoder_mask & 1; \
+	}
+
+/* Decodes a bit with a fixed probability of 0.5
+ */
+#define assorted_lzma_range_decoder_decode_direct_bit( range_decoder, bit ) \
+	{ \
+		uint32_t range_decoder_mask = 0; \
+\
+		assorted_lzma_range_decoder_normalize( range_decoder ) \
+\
+		( range_decoder ).range >>= 1; \
+		( range_decoder ).code   -= ( range_decoder ).range; \
+\
+		range_decoder_mask = (uint32_t) 0 - ( ( range_decoder ).code >> 31 ); \
+\
+		( range_decoder ).code += ( range_decoder ).range & range_decoder_mask; \
+\
+		bit = ( range_decoder_mask + 1 ) & 1; \
+	}
+
+/* Decodes a symbol of number_of_bits using a bit-tree of probabilities, most significant bit first
+ * The probabilities of both children are read before the bit is known, which keeps reading
+ * the probability out of the dependency chain between consecutive bits
+ */
+#define assorted_lzma_range_decoder_decode_tree( range_decoder, probabilities, number_of_bits, symbol ) \
+	{ \
+		uint32_t range_decoder_child0 = 0; \
+		uint32_t range_decoder_child1 = 0; \
+		uint32_t range_decoder_mask   = 0; \
+		uint32_t range_decoder_value  = 0; \
+\
+		symbol              = 1; \
+		range_decoder_value = ( probabilities )[ 1 ]; \
+\
+		while( symbol < ( (uint32_t) 1 << ( ( number_of_bits ) - 1 ) ) ) \
+		{ \
+			assorted_lzma_range_decoder_normalize( range_decoder ) \
+\
+			range_decoder_child0 = ( probabilities )[ symbol << 1 ]; \
+			range_decoder_child1 = ( probabilities )[ ( symbol << 1 ) | 1 ]; \
+\
+			assorted_lzma_range_decoder_decode_masked_bit( range_decoder, range_decoder_value, ( probabilities )[ symbol ], range_decoder_mask ) \
+\
+			symbol              = ( symbol << 1 ) | ( range_decoder_mask & 1 ); \
+			range_decoder_value = range_decoder_child0 ^ ( ( range_decoder_child0 ^ range_decoder_child1 ) & range_decoder_mask ); \
+		} \
+		assorted_lzma_range_decoder_normalize( range_decoder ) \
+\
+		assorted_lzma_range_decoder_decode_masked_bit( range_decoder, range_decoder_value, ( probabilities )[ symbol ], range_decoder_mask ) \
+\
+		symbol = ( ( symbol << 1 ) | ( range_decoder_mask & 1 ) ) - ( (uint32_t) 1 << ( number_of_bits ) ); \
+	}
+
+/* Decodes an 8-bit literal using a bit-tree of probabilities and the byte at rep0 as context
+ * The bits of the match byte are used as context for as long as they match the decoded bits
+ */
+#define assorted_lzma_range_decoder_decode_matched_literal( range_decoder, probabilities, match_byte, symbol ) \
+	{ \
+		uint32_t range_decoder_match_bit   = 0; \
+		uint32_t range_decoder_match_byte  = 0; \
+		uint32_t range_decoder_match_mask  = 0x100; \
+		uint32_t range_decoder_mask        = 0; \
+		uint32_t range_decoder_value       = 0; \
+		uint32_t range_decoder_value_index = 0; \
+\
+		range_decoder_match_byte = ( match_byte ); \
+		symbol                   = 1; \
+\
+		do \
+		{ \
+			assorted_lzma_range_decoder_normalize( range_decoder ) \
+\
+			range_decoder_match_byte <<= 1; \
+			range_decoder_match_bit    = range_decoder_match_mask; \
+			range_decoder_match_mask  &= range_decoder_match_byte; \
+			range_decoder_value_index  = range_decoder_match_mask + range_decoder_match_bit + symbol; \
+			range_decoder_value        = ( probabilities )[ range_decoder_value_index ]; \
+\
+			assorted_lzma_range_decoder_decode_masked_bit( range_decoder, range_decoder_value, ( probabilities )[ range_decoder_value_index ], range_decoder_mask ) \
+\
+			symbol                    = ( symbol << 1 ) | ( range_decoder_mask & 1 ); \
+			range_decoder_match_mask ^= range_decoder_match_bit & ~range_decoder_mask; \
+		} \
+		while( symbol < 0x100 ); \
+\
+		symbol -= 0x100; \
+	}
+
+/* Decodes a symbol of number_of_bits using a bit-tree of probabilities, least significant bit first
+ * Note that unlike the most significant bit first bit-tree the probabilities are indexed from 0
+ */
+#define assorted_lzma_range_decoder_decode_reverse_tree( range_decoder, probabilities, number_of_bits, symbol ) \
+	{ \
+		uint32_t range_decoder_tree_bit   = 0; \
+		uint32_t range_decoder_tree_index = 1; \
+		uint8_t range_decoder_bit_index   = 0; \
+\
+		symbol = 0; \
+\
+		for( range_decoder_bit_index = 0; \
+		     range_decoder_bit_index < ( number_of_bits ); \
+		     range_decoder_bit_index++ ) \
+		{ \
+			assorted_lzma_range_decoder_decode_bit( range_decoder, ( probabilities )[ range_decoder_tree_index - 1 ], range_decoder_tree_bit ) \
+\
+			range_decoder_tree_index = ( range_decoder_tree_index << 1 ) | range_decoder_tree_bit; \
+			symbol                  |= range_decoder_tree_bit << range_decoder_bit_index; \
+		} \
+	}
+
+/* Decodes a match length of 2 to 273 using the probabilities of a length decoder
+ */
+#define assorted_lzma_length_decoder_decode( range_decoder, probabilities, position_state, length ) \
+	{ \
+		uint32_t length_decoder_bit = 0; \
+\
+		assorted_lzma_range_decoder_decode_bit( range_decoder, ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_CHOICE ], length_decoder_bit ) \
+\
+		if( length_decoder_bit == 0 ) \
+		{ \
+			assorted_lzma_range_decoder_decode_tree( range_decoder, &( ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_LOW + ( ( position_state ) << 3 ) ] ), 3, length ) \
+\
+			length += 2; \
+		} \
+		else \
+		{ \
+			assorted_lzma_range_decoder_decode_bit( range_decoder, ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_CHOICE2 ], length_decoder_bit ) \
+\
+			if( length_decoder_bit == 0 ) \
+			{ \
+				assorted_lzma_range_decoder_decode_tree( range_decoder, &( ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_MID + ( ( position_state ) << 3 ) ] ), 3, length ) \
+\
+				length += 10; \
+			} \
+			else \
+			{ \
+				assorted_lzma_range_decoder_decode_tree( range_decoder, &( ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_HIGH ] ), 8, length ) \
+\
+				length += 18; \
+			} \
+		} \
+	}
+
+typedef struct assorted_lzma_range_encoder assorted_lzma_range_encoder_t;
+
+struct assorted_lzma_range_encoder
+{
+	/* The compressed data
+	 */
+	uint8_t *data;
+
+	/* The compressed data size
+	 */
+	size_t data_size;
+
+	/* The compressed data offset
+	 * Note that the offset can exceed the size, in which case the bytes are not written
+	 */
+	size_t data_offset;
+
+	/* The low value, of which bit 32 contains the carry
+	 */
+	uint64_t low;
+
+	/* The range
+	 */
+	uint32_t range;
+
+	/* The byte that is not yet written, since a carry can still change it
+	 */
+	uint8_t cache;
+
+	/* The number of bytes that are not yet written, the cache byte followed by 0xff bytes
+	 */
+	size_t cache_size;
+};
+
+/* Shifts the upper byte out of the low value of the range encoder
+ * A byte is only written when a carry can no longer change it, hence a run of 0xff bytes
+ * is kept pending. Writing past the end of the data is skipped, the caller is
+ * responsible for checking the data offset after encoding
+ */
+#define assorted_lzma_range_encoder_shift_low( range_encoder ) \
+	{ \
+		uint8_t range_encoder_byte = 0; \
+\
+		if( ( (uint32_t) ( range_encoder ).low < 0xff000000UL ) \
+		 || ( ( ( range_encoder ).low >> 32 ) != 0 ) ) \
+		{ \
+			range_encoder_byte = ( range_encoder ).cache; \
+\
+			do \
+			{ \
+				if( ( range_encoder ).data_offset < ( range_encoder ).data_size ) \
+				{ \
+					( range_encoder ).data[ ( range_encoder ).data_offset ] = (uint8_t) ( range_encoder_byte + (uint8_t) ( ( range_encoder ).low >> 32 ) ); \
+				} \
+				( range_encoder ).data_offset += 1; \
+\
+				range_encoder_byte = 0xff; \
+			} \
+			while( --( ( range_encoder ).cache_size ) != 0 ); \
+\
+			( range_encoder ).cache = (uint8_t) ( ( range_encoder ).low >> 24 ); \
+		} \
+		( range_encoder ).cache_size += 1; \
+		( range_encoder ).low         = ( ( range_encoder ).low & 0x00ffffffUL ) << 8; \
+	}
+
+/* Normalizes the range encoder
+ */
+#define assorted_lzma_range_encoder_normalize( range_encoder ) \
+	if( ( range_encoder ).range < ASSORTED_LZMA_RANGE_DECODER_TOP_VALUE ) \
+	{ \
+		( range_encoder ).range <<= 8; \
+\
+		assorted_lzma_range_encoder_shift_low( range_encoder ) \
+	}
+
+/* Encodes a bit using an adaptive probability
+ */
+#define assorted_lzma_range_encoder_encode_bit( range_encoder, probability, bit ) \
+	{ \
+		uint32_t range_encoder_bound = 0; \
+\
+		range_encoder_bound = ( ( range_encoder ).range >> ASSORTED_LZMA_NUMBER_OF_PROBABILITY_BITS ) * ( probability ); \
+\
+		if( ( bit ) == 0 ) \
+		{ \
+			( range_encoder ).range = range_encoder_bound; \
+\
+			( probability ) += ( ( 1 << ASSORTED_LZMA_NUMBER_OF_PROBABILITY_BITS ) - ( probability ) ) >> ASSORTED_LZMA_NUMBER_OF_MOVE_BITS; \
+		} \
+		else \
+		{ \
+			( range_encoder ).low   += range_encoder_bound; \
+			( range_encoder ).range -= range_encoder_bound; \
+\
+			( probability ) -= ( probability ) >> ASSORTED_LZMA_NUMBER_OF_MOVE_BITS; \
+		} \
+		assorted_lzma_range_encoder_normalize( range_encoder ) \
+	}
+
+/* Encodes the number_of_bits least significant bits of value with a fixed probability of 0.5,
+ * most significant bit first
+ */
+#define assorted_lzma_range_encoder_encode_direct_bits( range_encoder, value, number_of_bits ) \
+	{ \
+		uint32_t range_encoder_bit_index = 0; \
+\
+		for( range_encoder_bit_index = ( number_of_bits ); \
+		     range_encoder_bit_index > 0; \
+		     range_encoder_bit_index-- ) \
+		{ \
+			( range_encoder ).range >>= 1; \
+			( range_encoder ).low    += ( range_encoder ).range & ( (uint32_t) 0 - ( ( ( value ) >> ( range_encoder_bit_index - 1 ) ) & 1 ) ); \
+\
+			assorted_lzma_range_encoder_normalize( range_encoder ) \
+		} \
+	}
+
+/* Encodes a symbol of number_of_bits using a bit-tree of probabilities, most significant bit first
+ */
+#define assorted_lzma_range_encoder_encode_tree( range_encoder, probabilities, number_of_bits, symbol ) \
+	{ \
+		uint32_t range_encoder_tree_bit   = 0; \
+		uint32_t range_encoder_tree_index = 1; \
+		uint32_t range_encoder_bit_index  = 0; \
+\
+		for( range_encoder_bit_index = ( number_of_bits ); \
+		     range_encoder_bit_index > 0; \
+		     range_encoder_bit_index-- ) \
+		{ \
+			range_encoder_tree_bit = ( ( symbol ) >> ( range_encoder_bit_index - 1 ) ) & 1; \
+\
+			assorted_lzma_range_encoder_encode_bit( range_encoder, ( probabilities )[ range_encoder_tree_index ], range_encoder_tree_bit ) \
+\
+			range_encoder_tree_index = ( range_encoder_tree_index << 1 ) | range_encoder_tree_bit; \
+		} \
+	}
+
+/* Encodes an 8-bit literal using a bit-tree of probabilities and the byte at rep0 as context
+ * The bits of the match byte are used as context for as long as they match the encoded bits
+ */
+#define assorted_lzma_range_encoder_encode_matched_literal( range_encoder, probabilities, match_byte, symbol ) \
+	{ \
+		uint32_t range_encoder_literal     = 0; \
+		uint32_t range_encoder_literal_bit = 0; \
+		uint32_t range_encoder_match_bit   = 0; \
+		uint32_t range_encoder_match_byte  = 0; \
+		uint32_t range_encoder_match_mask  = 0x100; \
+		uint32_t range_encoder_value_index = 0; \
+\
+		range_encoder_literal    = ( symbol ) | 0x100; \
+		range_encoder_match_byte = ( match_byte ); \
+\
+		do \
+		{ \
+			range_encoder_match_byte <<= 1; \
+			range_encoder_match_bit    = range_encoder_match_byte & range_encoder_match_mask; \
+			range_encoder_value_index  = range_encoder_match_mask + range_encoder_match_bit + ( range_encoder_literal >> 8 ); \
+			range_encoder_literal_bit  = ( range_encoder_literal >> 7 ) & 1; \
+\
+			assorted_lzma_range_encoder_encode_bit( range_encoder, ( probabilities )[ range_encoder_value_index ], range_encoder_literal_bit ) \
+\
+			range_encoder_literal    <<= 1; \
+			range_encoder_match_mask  &= ~( range_encoder_match_byte ^ range_encoder_literal ); \
+		} \
+		while( range_encoder_literal < 0x10000 ); \
+	}
+
+/* Encodes a symbol of number_of_bits using a bit-tree of probabilities, least significant bit first
+ * Note that unlike the most significant bit first bit-tree the probabilities are indexed from 0
+ */
+#define assorted_lzma_range_encoder_encode_reverse_tree( range_encoder, probabilities, number_of_bits, symbol ) \
+	{ \
+		uint32_t range_encoder_tree_bit   = 0; \
+		uint32_t range_encoder_tree_index = 1; \
+		uint8_t range_encoder_bit_index   = 0; \
+\
+		for( range_encoder_bit_index = 0; \
+		     range_encoder_bit_index < ( number_of_bits ); \
+		     range_encoder_bit_index++ ) \
+		{ \
+			range_encoder_tree_bit = ( ( symbol ) >> range_encoder_bit_index ) & 1; \
+\
+			assorted_lzma_range_encoder_encode_bit( range_encoder, ( probabilities )[ range_encoder_tree_index - 1 ], range_encoder_tree_bit ) \
+\
+			range_encoder_tree_index = ( range_encoder_tree_index << 1 ) | range_encoder_tree_bit; \
+		} \
+	}
+
+/* Encodes a match length of 2 to 273 using the probabilities of a length encoder
+ */
+#define assorted_lzma_length_encoder_encode( range_encoder, probabilities, position_state, length ) \
+	{ \
+		uint32_t length_encoder_value = 0; \
+\
+		length_encoder_value = ( length ) - 2; \
+\
+		if( length_encoder_value < 8 ) \
+		{ \
+			assorted_lzma_range_encoder_encode_bit( range_encoder, ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_CHOICE ], 0 ) \
+\
+			assorted_lzma_range_encoder_encode_tree( range_encoder, &( ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_LOW + ( ( position_state ) << 3 ) ] ), 3, length_encoder_value ) \
+		} \
+		else \
+		{ \
+			assorted_lzma_range_encoder_encode_bit( range_encoder, ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_CHOICE ], 1 ) \
+\
+			if( length_encoder_value < 16 ) \
+			{ \
+				assorted_lzma_range_encoder_encode_bit( range_encoder, ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_CHOICE2 ], 0 ) \
+\
+				assorted_lzma_range_encoder_encode_tree( range_encoder, &( ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_MID + ( ( position_state ) << 3 ) ] ), 3, length_encoder_value - 8 ) \
+			} \
+			else \
+			{ \
+				assorted_lzma_range_encoder_encode_bit( range_encoder, ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_CHOICE2 ], 1 ) \
+\
+				assorted_lzma_range_encoder_encode_tree( range_encoder, &( ( probabilities )[ ASSORTED_LZMA_LENGTH_PROBABILITIES_HIGH ] ), 8, length_encoder_value - 16 ) \
+			} \
+		} \
+	}
+
+typedef struct assorted_lzma_decoder assorted_lzma_decoder_t;
+
+struct assorted_lzma_decoder
+{
+	/* The number of literal context bits (lc)
+	 */
+	uint8_t number_of_literal_context_bits;
+
+	/* The number of literal position bits (lp)
+	 */
+	uint8_t number_of_literal_position_bits;
+
+	/* The number of position bits (pb)
+	 */
+	uint8_t number_of_position_bits;
+
+	/* The state
+	 */
+	uint8_t state;
+
+	/* The last 4 match distances (rep0 to rep3)
+	 */
+	uint32_t distances[ 4 ];
+
+	/* Value to indicate the next LZMA2 chunk must reset the dictionary
+	 */
+	uint8_t requires_dictionary_reset;
+
+	/* Value to indicate the next LZMA2 chunk must set the properties
+	 */
+	uint8_t requires_properties;
+
+	/* The probabilities, stored at the ASSORTED_LZMA_PROBABILITIES_ offsets
+	 * Points into the probabilities data at a 64-byte boundary
+	 */
+	uint16_t *probabilities;
+
+	/* The arena the decoder is allocated from, NULL if allocated separately
+	 */
+	assorted_arena_t *arena;
+
+	/* The probabilities data, which includes room for the alignment
+	 */
+	uint8_t probabilities_data[ ( ASSORTED_LZMA_NUMBER_OF_PROBABILITIES * sizeof( uint16_t ) ) + 64 ];
+};
+
+typedef struct assorted_lzma_encoder assorted_lzma_encoder_t;
+
+struct assorted_lzma_encoder
+{
+	/* The number of literal context bits (lc)
+	 */
+	uint8_t number_of_literal_context_bits;
+
+	/* The number of literal position bits (lp)
+	 */
+	uint8_t number_of_literal_position_bits;
+
+	/* The number of position bits (pb)
+	 */
+	uint8_t number_of_position_bits;
+
+	/* The state
+	 */
+	uint8_t state;
+
+	/* The last 4 match distances (rep0 to rep3)
+	 */
+	uint32_t distances[ 4 ];
+
+	/* The dictionary size, which is a power of 2
+	 */
+	uint32_t dictionary_size;
+
+	/* The number of bits of a hash value
+	 */
+	uint8_t number_of_hash_bits;
+
+	/* The maximum number of hash chain entries that are searched for a match
+	 */
+	uint16_t maximum_chain_length;
+
+	/* The match length from which the hash chain search stops
+	 */
+	uint16_t nice_length;
+
+	/* Value to indicate lazy matching should be used
+	 */
+	uint8_t use_lazy_matching;
+
+	/* The hash table
+	 * Contains the offset + 1 of the last position per hash value, 0 if not set
+	 */
+	uint32_t *hash_table;
+
+	/* The hash chain table
+	 * Contains the offset + 1 of the previous position with the same hash value
+	 * per position in the dictionary
+	 */
+	uint32_t *chain_table;
+
+	/* The offset up to which the positions are added to the hash chains
+	 */
+	size_t hashed_data_offset;
+
+	/* The encoded data of the current chunk
+	 */
+	uint8_t *chunk_data;
+
+	/* The probabilities, stored at the ASSORTED_LZMA_PROBABILITIES_ offsets
+	 * Points into the probabilities data at a 64-byte boundary
+	 */
+	uint16_t *probabilities;
+
+	/* The probabilities data, which includes room for the alignment
+	 */
+	uint8_t probabilities_data[ ( ASSORTED_LZMA_NUMBER_OF_PROBABILITIES * sizeof( uint16_t ) ) + 64 ];
+};
+
+typedef struct assorted_lzma_index_record assorted_lzma_index_record_t;
+
+/* A record of the index, which describes a block
+ */
+struct assorted_lzma_index_record
+{
+	/* The unpadded size, the size of the block header, compressed data and check
+	 */
+	uint64_t unpadded_size;
+
+	/* The uncompressed size
+	 */
+	uint64_t uncompressed_size;
+};
+
+typedef struct assorted_lzma_check assorted_lzma_check_t;
+
+/* The block check
+ * Is updated with the uncompressed data of a block as it is decoded
+ */
+struct assorted_lzma_check
+{
+	/* The check type
+	 */
+	uint8_t check_type;
+
+	/* The size of the check
+	 */
+	size_t check_size;
+
+	/* The CRC-32 of the uncompressed data
+	 */
+	uint32_t crc32;
+
+	/* The CRC-64 of the uncompressed data
+	 */
+	uint64_t crc64;
+
+	/* The SHA-256 context of the uncompressed data
+	 */
+	libhmac_sha256_context_t *sha256_context;
+};
+
+typedef struct assorted_lzma_context assorted_lzma_context_t;
+
+/* The decoder context
+ * Holds the scratch memory of the decoder, such as the probabilities of
+ * the range decoder, so that it can be reused to decompress many small
+ * streams
+ */
+struct assorted_lzma_context
+{
+	/* The arena the scratch memory is allocated from
+	 */
+	assorted_arena_t *arena;
+};
+
+int assorted_lzma_decoder_initialize(
+     assorted_lzma_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int assorted_lzma_decoder_initialize_with_arena(
+     assorted_lzma_decoder_t **decoder,
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
+int assorted_lzma_decoder_free(
+     assorted_lzma_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int assorted_lzma_decoder_set_properties(
+     assorted_lzma_decoder_t *decoder,
+     uint8_t properties_value,
+     libcerror_error_t **error );
+
+int assorted_lzma_decoder_reset_state(
+     assorted_lzma_decoder_t *decoder,
+     libcerror_error_t **error );
+
+int assorted_lzma_read_variable_size_integer(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
 
 int assorted_lzma_read_stream_header(
      const uint8_t *compressed_data,
@@ -45,13 +761,40 @@ int assorted_lzma_read_block_header(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *compressed_data_offset,
+     uint32_t *dictionary_size,
      libcerror_error_t **error );
 
 int assorted_lzma_read_lzma(
-     assorted_bit_stream_t *bit_stream,
+     assorted_lzma_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     size_t dictionary_offset,
+     libcerror_error_t **error );
+
+int assorted_lzma_decoder_read_lzma2_chunk(
+     assorted_lzma_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     size_t *dictionary_offset,
+     libcerror_error_t **error );
+
+int assorted_lzma_decoder_read_lzma2_chunks(
+     assorted_lzma_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
+     assorted_lzma_check_t *check,
      libcerror_error_t **error );
 
 int assorted_lzma_read_lzma2_block(
@@ -63,12 +806,70 @@ int assorted_lzma_read_lzma2_block(
      size_t *uncompressed_data_offset,
      libcerror_error_t **error );
 
+int assorted_lzma_read_lzma2_block_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     assorted_arena_t *arena,
+     assorted_lzma_check_t *check,
+     libcerror_error_t **error );
+
+int assorted_lzma_check_initialize(
+     assorted_lzma_check_t **check,
+     uint8_t check_type,
+     libcerror_error_t **error );
+
+int assorted_lzma_check_free(
+     assorted_lzma_check_t **check,
+     libcerror_error_t **error );
+
+int assorted_lzma_check_reset(
+     assorted_lzma_check_t *check,
+     libcerror_error_t **error );
+
+int assorted_lzma_check_update(
+     assorted_lzma_check_t *check,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_check_read(
+     assorted_lzma_check_t *check,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_lzma_read_block_check(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t check_type,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_read_index(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
 int assorted_lzma_read_stream_footer(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *compressed_data_offset,
      libcerror_error_t **error );
 
+int assorted_lzma_get_uncompressed_data_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 int assorted_lzma_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -76,6 +877,144 @@ int assorted_lzma_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int assorted_lzma_decompress_with_arena(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     assorted_arena_t *arena,
+     libcerror_error_t **error );
+
+int assorted_lzma_context_initialize(
+     assorted_lzma_context_t **context,
+     libcerror_error_t **error );
+
+int assorted_lzma_context_free(
+     assorted_lzma_context_t **context,
+     libcerror_error_t **error );
+
+int assorted_lzma_context_reset(
+     assorted_lzma_context_t *context,
+     libcerror_error_t **error );
+
+int assorted_lzma_context_decompress(
+     assorted_lzma_context_t *context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_write_variable_size_integer(
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int assorted_lzma_write_stream_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t check_type,
+     libcerror_error_t **error );
+
+int assorted_lzma_write_block_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint32_t dictionary_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_write_block_check(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t check_type,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_write_index(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     const assorted_lzma_index_record_t *records,
+     size_t number_of_records,
+     libcerror_error_t **error );
+
+int assorted_lzma_write_stream_footer(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t index_size,
+     uint8_t check_type,
+     libcerror_error_t **error );
+
+int assorted_lzma_get_compression_block_size(
+     int compression_preset,
+     size_t *block_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_encoder_initialize(
+     assorted_lzma_encoder_t **encoder,
+     int compression_preset,
+     libcerror_error_t **error );
+
+int assorted_lzma_encoder_free(
+     assorted_lzma_encoder_t **encoder,
+     libcerror_error_t **error );
+
+int assorted_lzma_encoder_reset_state(
+     assorted_lzma_encoder_t *encoder,
+     libcerror_error_t **error );
+
+int assorted_lzma_encoder_find_match(
+     assorted_lzma_encoder_t *encoder,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     uint32_t *match_length,
+     uint32_t *match_distance,
+     libcerror_error_t **error );
+
+int assorted_lzma_encoder_write_lzma(
+     assorted_lzma_encoder_t *encoder,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_lzma_encoder_write_lzma2_chunks(
+     assorted_lzma_encoder_t *encoder,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_lzma_encoder_write_block(
+     assorted_lzma_encoder_t *encoder,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint64_t *unpadded_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_preset,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
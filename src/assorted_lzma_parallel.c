@@ -0,0 +1,1817 @@
+/*
+ * LZMA parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_lzma.h"
+#include "assorted_lzma_parallel.h"
+#include "assorted_thread_pool.h"
+
+/* Appends a segment
+ * The segments array is allocated or resized as needed
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_parallel_append_segment(
+     assorted_lzma_parallel_segment_t **segments,
+     size_t *number_of_segments,
+     size_t *maximum_number_of_segments,
+     assorted_lzma_parallel_segment_t **segment,
+     libcerror_error_t **error )
+{
+	void *reallocation                     = NULL;
+	static char *function                  = "assorted_lzma_parallel_append_segment";
+	size_t safe_maximum_number_of_segments = 0;
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_segments > *maximum_number_of_segments )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of segments value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_segments == *maximum_number_of_segments )
+	{
+		safe_maximum_number_of_segments = *maximum_number_of_segments;
+
+		if( safe_maximum_number_of_segments == 0 )
+		{
+			safe_maximum_number_of_segments = 16;
+		}
+		else if( safe_maximum_number_of_segments > ( (size_t) SSIZE_MAX / ( 2 * sizeof( assorted_lzma_parallel_segment_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			safe_maximum_number_of_segments *= 2;
+		}
+		reallocation = memory_reallocate(
+		                *segments,
+		                sizeof( assorted_lzma_parallel_segment_t ) * safe_maximum_number_of_segments );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segments.",
+			 function );
+
+			return( -1 );
+		}
+		*segments                   = (assorted_lzma_parallel_segment_t *) reallocation;
+		*maximum_number_of_segments = safe_maximum_number_of_segments;
+	}
+	*segment = &( ( *segments )[ *number_of_segments ] );
+
+	if( memory_set(
+	     *segment,
+	     0,
+	     sizeof( assorted_lzma_parallel_segment_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment.",
+		 function );
+
+		*segment = NULL;
+
+		return( -1 );
+	}
+	*number_of_segments += 1;
+
+	return( 1 );
+}
+
+/* Splits the LZMA2 chunks of a block into segments that can be decompressed independently
+ * The chunk headers are read without decoding the chunk data. A chunk that resets the dictionary
+ * starts a new segment when the current segment contains at least the minimum segment size
+ * of uncompressed data. The compressed data size is the offset of the end of the LZMA2 data
+ * of the block, which must end with the end of chunks control code.
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_parallel_split_block(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     size_t uncompressed_block_size,
+     size_t minimum_segment_size,
+     assorted_lzma_parallel_segment_t **segments,
+     size_t *number_of_segments,
+     size_t *maximum_number_of_segments,
+     libcerror_error_t **error )
+{
+	assorted_lzma_parallel_segment_t *segment = NULL;
+	static char *function                     = "assorted_lzma_parallel_split_block";
+	size_t chunk_header_size                  = 0;
+	size_t safe_compressed_data_offset        = 0;
+	size_t safe_uncompressed_data_offset      = 0;
+	size_t segment_compressed_data_offset     = 0;
+	size_t segment_uncompressed_data_offset   = 0;
+	size_t uncompressed_block_end_offset      = 0;
+	uint32_t chunk_data_size                  = 0;
+	uint32_t uncompressed_chunk_size          = 0;
+	uint8_t control_code                      = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset >= compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_offset > (size_t) SSIZE_MAX )
+	 || ( uncompressed_block_size > ( (size_t) SSIZE_MAX - uncompressed_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset      = compressed_data_offset;
+	safe_uncompressed_data_offset    = uncompressed_data_offset;
+	segment_compressed_data_offset   = compressed_data_offset;
+	segment_uncompressed_data_offset = uncompressed_data_offset;
+	uncompressed_block_end_offset    = uncompressed_data_offset + uncompressed_block_size;
+
+	while( safe_compressed_data_offset < compressed_data_size )
+	{
+		control_code = compressed_data[ safe_compressed_data_offset ];
+
+		if( control_code == 0x00 )
+		{
+			break;
+		}
+		if( ( control_code >= 0x03 )
+		 && ( control_code <= 0x7f ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: unsupported control code value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* Control codes 0x01 and 0xe0 - 0xff reset the dictionary, hence no data
+		 * before the chunk is needed to decompress it
+		 */
+		if( ( ( control_code == 0x01 )
+		  || ( control_code >= 0xe0 ) )
+		 && ( ( safe_uncompressed_data_offset - segment_uncompressed_data_offset ) >= minimum_segment_size )
+		 && ( safe_compressed_data_offset > segment_compressed_data_offset ) )
+		{
+			if( assorted_lzma_parallel_append_segment(
+			     segments,
+			     number_of_segments,
+			     maximum_number_of_segments,
+			     &segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment.",
+				 function );
+
+				return( -1 );
+			}
+			segment->compressed_data              = compressed_data;
+			segment->compressed_data_offset       = segment_compressed_data_offset;
+			segment->compressed_data_end_offset   = safe_compressed_data_offset;
+			segment->uncompressed_data            = uncompressed_data;
+			segment->uncompressed_data_offset     = segment_uncompressed_data_offset;
+			segment->uncompressed_data_end_offset = safe_uncompressed_data_offset;
+
+			segment_compressed_data_offset   = safe_compressed_data_offset;
+			segment_uncompressed_data_offset = safe_uncompressed_data_offset;
+		}
+		if( control_code >= 0x80 )
+		{
+			/* Control codes 0xc0 - 0xff are followed by a properties value
+			 */
+			if( control_code >= 0xc0 )
+			{
+				chunk_header_size = 6;
+			}
+			else
+			{
+				chunk_header_size = 5;
+			}
+		}
+		else
+		{
+			chunk_header_size = 3;
+		}
+		if( chunk_header_size > ( compressed_data_size - safe_compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( control_code >= 0x80 )
+		{
+			uncompressed_chunk_size  = (uint32_t) ( control_code & 0x1f ) << 16;
+			uncompressed_chunk_size |= (uint32_t) compressed_data[ safe_compressed_data_offset + 1 ] << 8;
+			uncompressed_chunk_size |= compressed_data[ safe_compressed_data_offset + 2 ];
+			uncompressed_chunk_size += 1;
+
+			chunk_data_size  = (uint32_t) compressed_data[ safe_compressed_data_offset + 3 ] << 8;
+			chunk_data_size |= compressed_data[ safe_compressed_data_offset + 4 ];
+			chunk_data_size += 1;
+		}
+		else
+		{
+			chunk_data_size  = (uint32_t) compressed_data[ safe_compressed_data_offset + 1 ] << 8;
+			chunk_data_size |= compressed_data[ safe_compressed_data_offset + 2 ];
+			chunk_data_size += 1;
+
+			uncompressed_chunk_size = chunk_data_size;
+		}
+		safe_compressed_data_offset += chunk_header_size;
+
+		if( chunk_data_size > ( compressed_data_size - safe_compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		safe_compressed_data_offset += chunk_data_size;
+
+		if( uncompressed_chunk_size > ( uncompressed_block_end_offset - safe_uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed chunk size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_uncompressed_data_offset += uncompressed_chunk_size;
+	}
+	/* The end of chunks control code must be the last byte of the LZMA2 data
+	 */
+	if( safe_compressed_data_offset != ( compressed_data_size - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in end of chunks control code offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_uncompressed_data_offset != uncompressed_block_end_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in uncompressed block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzma_parallel_append_segment(
+	     segments,
+	     number_of_segments,
+	     maximum_number_of_segments,
+	     &segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment.",
+		 function );
+
+		return( -1 );
+	}
+	segment->compressed_data              = compressed_data;
+	segment->compressed_data_offset       = segment_compressed_data_offset;
+	segment->compressed_data_end_offset   = compressed_data_size;
+	segment->uncompressed_data            = uncompressed_data;
+	segment->uncompressed_data_offset     = segment_uncompressed_data_offset;
+	segment->uncompressed_data_end_offset = uncompressed_block_end_offset;
+	segment->is_last_segment              = 1;
+
+	return( 1 );
+}
+
+/* Decompresses a segment using a decoder
+ * The segment is decompressed directly into its part of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_parallel_decompress_segment(
+     assorted_lzma_parallel_segment_t *segment,
+     assorted_lzma_decoder_t *decoder,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_lzma_parallel_decompress_segment";
+	size_t compressed_data_offset   = 0;
+	size_t uncompressed_data_offset = 0;
+	int result                      = 0;
+
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment - missing compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment->uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment - missing uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset   = segment->compressed_data_offset;
+	uncompressed_data_offset = segment->uncompressed_data_offset;
+
+	/* A segment can contain only part of a block, hence the check is not updated
+	 */
+	result = assorted_lzma_decoder_read_lzma2_chunks(
+	          decoder,
+	          segment->compressed_data,
+	          segment->compressed_data_end_offset,
+	          &compressed_data_offset,
+	          segment->uncompressed_data,
+	          segment->uncompressed_data_end_offset,
+	          &uncompressed_data_offset,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read LZMA2 chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result != (int) segment->is_last_segment )
+	 || ( compressed_data_offset != segment->compressed_data_end_offset )
+	 || ( uncompressed_data_offset != segment->uncompressed_data_end_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in segment size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses a segment from a thread pool
+ * The arguments contain a queue of decoders, one per worker thread, a decoder
+ * is taken from the queue for the duration of the segment decompression
+ * The error is not available from the worker thread, the result is stored in the segment
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_parallel_decompress_segment_callback(
+     intptr_t *value,
+     void *arguments )
+{
+	assorted_lzma_decoder_t *decoder          = NULL;
+	assorted_lzma_parallel_segment_t *segment = NULL;
+	libcthreads_queue_t *decoders_queue       = NULL;
+
+	if( ( value == NULL )
+	 || ( arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	segment        = (assorted_lzma_parallel_segment_t *) value;
+	decoders_queue = (libcthreads_queue_t *) arguments;
+
+	if( libcthreads_queue_pop(
+	     decoders_queue,
+	     (intptr_t **) &decoder,
+	     NULL ) != 1 )
+	{
+		segment->result = -1;
+
+		return( -1 );
+	}
+	segment->result = assorted_lzma_parallel_decompress_segment(
+	                   segment,
+	                   decoder,
+	                   NULL );
+
+	if( libcthreads_queue_push(
+	     decoders_queue,
+	     (intptr_t *) decoder,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	/* A failed segment is decompressed again to retrieve the error
+	 */
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses LZMA compressed data with the blocks decoded in parallel
+ * The index, located from the stream footer, provides the offset and uncompressed size
+ * of every block, hence all blocks are decompressed directly into their part of
+ * the uncompressed data. Blocks are further split at LZMA2 dictionary resets.
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_lzma_decoder_t *decoder            = NULL;
+	assorted_lzma_parallel_segment_t *segments  = NULL;
+	static char *function                       = "assorted_lzma_parallel_decompress";
+	size_t block_data_end_offset                = 0;
+	size_t block_data_offset                    = 0;
+	size_t block_offset                         = 0;
+	size_t check_size                           = 0;
+	size_t compressed_data_offset               = 0;
+	size_t index_data_offset                    = 0;
+	size_t index_end_offset                     = 0;
+	size_t index_offset                         = 0;
+	size_t index_size                           = 0;
+	size_t maximum_number_of_segments           = 0;
+	size_t number_of_segments                   = 0;
+	size_t safe_uncompressed_data_size          = 0;
+	size_t segment_index                        = 0;
+	size_t uncompressed_data_offset             = 0;
+	uint64_t number_of_records                  = 0;
+	uint64_t record_index                       = 0;
+	uint64_t uncompressed_size                  = 0;
+	uint64_t unpadded_size                      = 0;
+	uint32_t backward_size                      = 0;
+	uint32_t dictionary_size                    = 0;
+	uint8_t check_type                          = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_lzma_decoder_t *thread_decoder     = NULL;
+	libcthreads_queue_t *decoders_queue         = NULL;
+	assorted_thread_pool_t *thread_pool         = NULL;
+	int maximum_number_of_values                = 0;
+	int thread_index                            = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The stream header and footer are 12 bytes each and the index is at least 8 bytes
+	 */
+	if( ( compressed_data_size < 32 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzma_read_stream_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The size of the check that follows every block is determined by the stream flags
+	 */
+	check_type = compressed_data[ 7 ] & 0x0f;
+
+	if( check_type != 0 )
+	{
+		check_size = (size_t) 4 << ( ( check_type - 1 ) / 3 );
+	}
+	index_end_offset = compressed_data_size - 12;
+
+	if( assorted_lzma_read_stream_footer(
+	     compressed_data,
+	     compressed_data_size,
+	     &index_end_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream footer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The backward size in the stream footer contains the size of the index
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ compressed_data_size - 8 ] ),
+	 backward_size );
+
+	index_size       = ( (size_t) backward_size + 1 ) * 4;
+	index_end_offset = compressed_data_size - 12;
+
+	if( index_size > ( index_end_offset - compressed_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid backward size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	index_offset      = index_end_offset - index_size;
+	index_data_offset = index_offset;
+
+	if( assorted_lzma_read_index(
+	     compressed_data,
+	     index_end_offset,
+	     &index_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_data_offset != index_end_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in index size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The index was validated above, the records are read again to determine the segments
+	 */
+	index_data_offset = index_offset + 1;
+
+	if( assorted_lzma_read_variable_size_integer(
+	     compressed_data,
+	     index_end_offset,
+	     &index_data_offset,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read number of records.",
+		 function );
+
+		goto on_error;
+	}
+	block_offset = compressed_data_offset;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     index_end_offset,
+		     &index_data_offset,
+		     &unpadded_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu64 " unpadded size.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( assorted_lzma_read_variable_size_integer(
+		     compressed_data,
+		     index_end_offset,
+		     &index_data_offset,
+		     &uncompressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu64 " uncompressed size.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* The unpadded size contains the block header, the compressed data and the check
+		 */
+		if( ( unpadded_size <= (uint64_t) check_size )
+		 || ( unpadded_size > (uint64_t) ( index_offset - block_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu64 " unpadded size value out of bounds.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( uncompressed_size > (uint64_t) ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+			 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+			 "%s: invalid uncompressed data value too small.",
+			 function );
+
+			goto on_error;
+		}
+		block_data_offset     = block_offset;
+		block_data_end_offset = block_offset + (size_t) unpadded_size - check_size;
+
+		if( assorted_lzma_read_block_header(
+		     compressed_data,
+		     block_data_end_offset,
+		     &block_data_offset,
+		     &dictionary_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu64 " header.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( assorted_lzma_parallel_split_block(
+		     compressed_data,
+		     block_data_end_offset,
+		     block_data_offset,
+		     uncompressed_data,
+		     uncompressed_data_offset,
+		     (size_t) uncompressed_size,
+		     ASSORTED_LZMA_PARALLEL_MINIMUM_SEGMENT_SIZE,
+		     &segments,
+		     &number_of_segments,
+		     &maximum_number_of_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to split block: %" PRIu64 " into segments.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* The block is padded to a multiple of 4 bytes, the check size is a multiple of 4
+		 */
+		block_offset             += ( (size_t) unpadded_size + 3 ) & ~( (size_t) 3 );
+		uncompressed_data_offset += (size_t) uncompressed_size;
+	}
+	if( block_offset != index_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in index offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzma_decoder_initialize(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_segments > 1 ) )
+	{
+		if( libcthreads_queue_initialize(
+		     &decoders_queue,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decoders queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( assorted_lzma_decoder_initialize(
+			     &thread_decoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create decoder: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     decoders_queue,
+			     (intptr_t *) thread_decoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push decoder: %d onto queue.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			thread_decoder = NULL;
+		}
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_segments )
+		{
+			maximum_number_of_values = (int) number_of_segments;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &assorted_lzma_parallel_decompress_segment_callback,
+		     (void *) decoders_queue,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( segments[ segment_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push segment: %" PRIzd " onto thread pool queue.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_free(
+		     &decoders_queue,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &assorted_lzma_decoder_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoders queue.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the segments are decompressed here and a segment
+	 * that failed in the thread pool is decompressed again to retrieve the error
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( segments[ segment_index ].result == 1 )
+		{
+			continue;
+		}
+		if( assorted_lzma_parallel_decompress_segment(
+		     &( segments[ segment_index ] ),
+		     decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress segment at offset: %" PRIzd ".",
+			 function,
+			 segments[ segment_index ].compressed_data_offset );
+
+			goto on_error;
+		}
+		segments[ segment_index ].result = 1;
+	}
+	if( assorted_lzma_decoder_free(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( segments != NULL )
+	{
+		memory_free(
+		 segments );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( decoders_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &decoders_queue,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &assorted_lzma_decoder_free,
+		 NULL );
+	}
+	if( thread_decoder != NULL )
+	{
+		assorted_lzma_decoder_free(
+		 &thread_decoder,
+		 NULL );
+	}
+#endif
+	if( decoder != NULL )
+	{
+		assorted_lzma_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( segments != NULL )
+	{
+		memory_free(
+		 segments );
+	}
+	return( -1 );
+}
+
+/* Compresses a block using an encoder
+ * The compressed data of the block is allocated and must be freed by the caller
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_parallel_compress_block(
+     assorted_lzma_parallel_compression_block_t *block,
+     assorted_lzma_encoder_t *encoder,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_lzma_parallel_compress_block";
+	size_t compressed_data_offset = 0;
+	size_t compressed_data_size   = 0;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( block->compressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block - compressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block->uncompressed_data_size > (size_t) ( SSIZE_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block - uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Data that does not compress is stored in uncompressed chunks, which add 3 bytes per 64 KiB,
+	 * in addition to the block header, end of chunks control code, padding and check
+	 */
+	compressed_data_size = block->uncompressed_data_size + ( block->uncompressed_data_size >> 12 ) + 64;
+
+	block->compressed_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * compressed_data_size );
+
+	if( block->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzma_encoder_write_block(
+	     encoder,
+	     block->uncompressed_data,
+	     block->uncompressed_data_size,
+	     block->compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     &( block->unpadded_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block.",
+		 function );
+
+		goto on_error;
+	}
+	block->compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( block->compressed_data != NULL )
+	{
+		memory_free(
+		 block->compressed_data );
+
+		block->compressed_data = NULL;
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Compresses a block from a thread pool
+ * The arguments contain a queue of encoders, one per worker thread, an encoder
+ * is taken from the queue for the duration of the block compression
+ * The error is not available from the worker thread, the result is stored in the block
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_parallel_compress_block_callback(
+     intptr_t *value,
+     void *arguments )
+{
+	assorted_lzma_encoder_t *encoder                  = NULL;
+	assorted_lzma_parallel_compression_block_t *block = NULL;
+	libcthreads_queue_t *encoders_queue               = NULL;
+
+	if( ( value == NULL )
+	 || ( arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	block          = (assorted_lzma_parallel_compression_block_t *) value;
+	encoders_queue = (libcthreads_queue_t *) arguments;
+
+	if( libcthreads_queue_pop(
+	     encoders_queue,
+	     (intptr_t **) &encoder,
+	     NULL ) != 1 )
+	{
+		block->result = -1;
+
+		return( -1 );
+	}
+	block->result = assorted_lzma_parallel_compress_block(
+	                 block,
+	                 encoder,
+	                 NULL );
+
+	if( libcthreads_queue_push(
+	     encoders_queue,
+	     (intptr_t *) encoder,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Compresses data using LZMA2 compression into a XZ stream with the blocks compressed in parallel
+ * The data is split into the same blocks as assorted_lzma_compress, which are independent since
+ * every block resets the dictionary, hence the result is identical to that of assorted_lzma_compress.
+ * The blocks are retrieved from the thread pool in order as they complete and are appended to the
+ * compressed data while the next blocks are compressed, after which the index is written
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_parallel_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_preset,
+     int number_of_threads,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                               = "assorted_lzma_parallel_compress";
+	size_t block_size                                   = 0;
+	size_t number_of_blocks                             = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_lzma_encoder_t *thread_encoder             = NULL;
+	assorted_lzma_index_record_t *records               = NULL;
+	assorted_lzma_parallel_compression_block_t *block   = NULL;
+	assorted_lzma_parallel_compression_block_t *blocks  = NULL;
+	assorted_thread_pool_t *thread_pool                 = NULL;
+	libcthreads_queue_t *encoders_queue                 = NULL;
+	size_t block_index                                  = 0;
+	size_t index_offset                                 = 0;
+	size_t maximum_number_of_blocks                     = 0;
+	size_t number_of_completed_blocks                   = 0;
+	size_t safe_compressed_data_offset                  = 0;
+	size_t uncompressed_data_offset                     = 0;
+	int thread_index                                    = 0;
+#endif
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzma_get_compression_block_size(
+	     compression_preset,
+	     &block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression block size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = uncompressed_data_size / block_size;
+
+	if( ( uncompressed_data_size % block_size ) != 0 )
+	{
+		number_of_blocks += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_blocks > 1 ) )
+	{
+		blocks = (assorted_lzma_parallel_compression_block_t *) memory_allocate(
+		                                                         sizeof( assorted_lzma_parallel_compression_block_t ) * number_of_blocks );
+
+		if( blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create blocks.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     blocks,
+		     0,
+		     sizeof( assorted_lzma_parallel_compression_block_t ) * number_of_blocks ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear blocks.",
+			 function );
+
+			goto on_error;
+		}
+		records = (assorted_lzma_index_record_t *) memory_allocate(
+		                                            sizeof( assorted_lzma_index_record_t ) * number_of_blocks );
+
+		if( records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index records.",
+			 function );
+
+			goto on_error;
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			blocks[ block_index ].uncompressed_data      = &( uncompressed_data[ uncompressed_data_offset ] );
+			blocks[ block_index ].uncompressed_data_size = uncompressed_data_size - uncompressed_data_offset;
+
+			if( blocks[ block_index ].uncompressed_data_size > block_size )
+			{
+				blocks[ block_index ].uncompressed_data_size = block_size;
+			}
+			uncompressed_data_offset += blocks[ block_index ].uncompressed_data_size;
+		}
+		if( (size_t) number_of_threads > number_of_blocks )
+		{
+			number_of_threads = (int) number_of_blocks;
+		}
+		if( libcthreads_queue_initialize(
+		     &encoders_queue,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create encoders queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( assorted_lzma_encoder_initialize(
+			     &thread_encoder,
+			     compression_preset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create encoder: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     encoders_queue,
+			     (intptr_t *) thread_encoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push encoder: %d onto queue.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			thread_encoder = NULL;
+		}
+		maximum_number_of_blocks = (size_t) number_of_threads * ASSORTED_LZMA_PARALLEL_NUMBER_OF_BLOCKS_PER_THREAD;
+
+		if( maximum_number_of_blocks > number_of_blocks )
+		{
+			maximum_number_of_blocks = number_of_blocks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     (int) maximum_number_of_blocks,
+		     (int (*)(intptr_t *, void *)) &assorted_lzma_parallel_compress_block_callback,
+		     (void *) encoders_queue,
+		     ASSORTED_THREAD_POOL_FLAG_ORDERED_COMPLETION,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_lzma_write_stream_header(
+		     compressed_data,
+		     *compressed_data_size,
+		     &safe_compressed_data_offset,
+		     ASSORTED_LZMA_CHECK_TYPE_CRC64,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write stream header.",
+			 function );
+
+			goto on_error;
+		}
+		block_index = 0;
+
+		while( number_of_completed_blocks < number_of_blocks )
+		{
+			/* Keep at most the maximum number of blocks in the thread pool
+			 * since pushing more would block until a block is retrieved
+			 */
+			while( ( block_index < number_of_blocks )
+			    && ( ( block_index - number_of_completed_blocks ) < maximum_number_of_blocks ) )
+			{
+				if( assorted_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( blocks[ block_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push block: %" PRIzd " onto thread pool.",
+					 function,
+					 block_index );
+
+					goto on_error;
+				}
+				block_index++;
+			}
+			if( assorted_thread_pool_pop_completed(
+			     thread_pool,
+			     (intptr_t **) &block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve completed block: %" PRIzd " from thread pool.",
+				 function,
+				 number_of_completed_blocks );
+
+				goto on_error;
+			}
+			if( block->result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress block: %" PRIzd ".",
+				 function,
+				 number_of_completed_blocks );
+
+				goto on_error;
+			}
+			if( block->compressed_data_size > ( *compressed_data_size - safe_compressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data value too small.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( compressed_data[ safe_compressed_data_offset ] ),
+			     block->compressed_data,
+			     block->compressed_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block: %" PRIzd " compressed data.",
+				 function,
+				 number_of_completed_blocks );
+
+				goto on_error;
+			}
+			safe_compressed_data_offset += block->compressed_data_size;
+
+			records[ number_of_completed_blocks ].unpadded_size     = block->unpadded_size;
+			records[ number_of_completed_blocks ].uncompressed_size = (uint64_t) block->uncompressed_data_size;
+
+			memory_free(
+			 block->compressed_data );
+
+			block->compressed_data = NULL;
+
+			number_of_completed_blocks++;
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_free(
+		     &encoders_queue,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &assorted_lzma_encoder_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free encoders queue.",
+			 function );
+
+			goto on_error;
+		}
+		index_offset = safe_compressed_data_offset;
+
+		if( assorted_lzma_write_index(
+		     compressed_data,
+		     *compressed_data_size,
+		     &safe_compressed_data_offset,
+		     records,
+		     number_of_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write index.",
+			 function );
+
+			goto on_error;
+		}
+		if( assorted_lzma_write_stream_footer(
+		     compressed_data,
+		     *compressed_data_size,
+		     &safe_compressed_data_offset,
+		     safe_compressed_data_offset - index_offset,
+		     ASSORTED_LZMA_CHECK_TYPE_CRC64,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write stream footer.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 records );
+
+		memory_free(
+		 blocks );
+
+		*compressed_data_size = safe_compressed_data_offset;
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the blocks are compressed here
+	 */
+	if( assorted_lzma_compress(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compression_preset,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( encoders_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &encoders_queue,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &assorted_lzma_encoder_free,
+		 NULL );
+	}
+	if( thread_encoder != NULL )
+	{
+		assorted_lzma_encoder_free(
+		 &thread_encoder,
+		 NULL );
+	}
+	if( blocks != NULL )
+	{
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			if( blocks[ block_index ].compressed_data != NULL )
+			{
+				memory_free(
+				 blocks[ block_index ].compressed_data );
+			}
+		}
+		memory_free(
+		 blocks );
+	}
+	if( records != NULL )
+	{
+		memory_free(
+		 records );
+	}
+	return( -1 );
+#endif
+}
+
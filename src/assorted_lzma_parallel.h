@@ -0,0 +1,177 @@
+/*
+ * LZMA parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_LZMA_PARALLEL_H )
+#define _ASSORTED_LZMA_PARALLEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_lzma.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum uncompressed size of a segment that is split off at a dictionary reset inside a block
+ */
+#define ASSORTED_LZMA_PARALLEL_MINIMUM_SEGMENT_SIZE	( 1024 * 1024 )
+
+/* The maximum number of blocks per thread that are compressed at the same time
+ */
+#define ASSORTED_LZMA_PARALLEL_NUMBER_OF_BLOCKS_PER_THREAD	2
+
+typedef struct assorted_lzma_parallel_segment assorted_lzma_parallel_segment_t;
+
+struct assorted_lzma_parallel_segment
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The offset of the first LZMA2 chunk of the segment in the compressed data
+	 */
+	size_t compressed_data_offset;
+
+	/* The offset of the end of the segment in the compressed data
+	 */
+	size_t compressed_data_end_offset;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The offset of the segment in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The offset of the end of the segment in the uncompressed data
+	 */
+	size_t uncompressed_data_end_offset;
+
+	/* Value to indicate the segment ends with the end of chunks control code of the block
+	 */
+	uint8_t is_last_segment;
+
+	/* The result of the segment decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+typedef struct assorted_lzma_parallel_compression_block assorted_lzma_parallel_compression_block_t;
+
+struct assorted_lzma_parallel_compression_block
+{
+	/* The uncompressed data
+	 */
+	const uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The compressed data, which contains the block header, LZMA2 chunks, padding and check
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The unpadded size of the block
+	 */
+	uint64_t unpadded_size;
+
+	/* The result of the block compression, 0 if not compressed
+	 */
+	int result;
+};
+
+int assorted_lzma_parallel_append_segment(
+     assorted_lzma_parallel_segment_t **segments,
+     size_t *number_of_segments,
+     size_t *maximum_number_of_segments,
+     assorted_lzma_parallel_segment_t **segment,
+     libcerror_error_t **error );
+
+int assorted_lzma_parallel_split_block(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_offset,
+     size_t uncompressed_block_size,
+     size_t minimum_segment_size,
+     assorted_lzma_parallel_segment_t **segments,
+     size_t *number_of_segments,
+     size_t *maximum_number_of_segments,
+     libcerror_error_t **error );
+
+int assorted_lzma_parallel_decompress_segment(
+     assorted_lzma_parallel_segment_t *segment,
+     assorted_lzma_decoder_t *decoder,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_lzma_parallel_decompress_segment_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_lzma_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int number_of_threads,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_parallel_compress_block(
+     assorted_lzma_parallel_compression_block_t *block,
+     assorted_lzma_encoder_t *encoder,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_lzma_parallel_compress_block_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_lzma_parallel_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_preset,
+     int number_of_threads,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_LZMA_PARALLEL_H ) */
+
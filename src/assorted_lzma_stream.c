@@ -0,0 +1,1156 @@
+/*
+ * LZMA streaming decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_aligned_memory.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_lzma.h"
+#include "assorted_lzma_stream.h"
+
+/* Creates a stream
+ * The uncompressed data is passed to the write function in chunks, if the write function
+ * is NULL the uncompressed data is only decoded, for example to verify the compressed data
+ * Make sure the value stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_stream_initialize(
+     assorted_lzma_stream_t **stream,
+     int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error ),
+     intptr_t *sink,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_stream_initialize";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*stream = memory_allocate_structure(
+	           assorted_lzma_stream_t );
+
+	if( *stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stream,
+	     0,
+	     sizeof( assorted_lzma_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		memory_free(
+		 *stream );
+
+		*stream = NULL;
+
+		return( -1 );
+	}
+	if( assorted_lzma_decoder_initialize(
+	     &( ( *stream )->decoder ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	( *stream )->write_function = write_function;
+	( *stream )->sink           = sink;
+
+	return( 1 );
+
+on_error:
+	if( *stream != NULL )
+	{
+		assorted_lzma_stream_free(
+		 stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a stream
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_stream_free(
+     assorted_lzma_stream_t **stream,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_stream_free";
+	int result            = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		if( ( *stream )->decoder != NULL )
+		{
+			if( assorted_lzma_decoder_free(
+			     &( ( *stream )->decoder ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decoder.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *stream )->check != NULL )
+		{
+			if( assorted_lzma_check_free(
+			     &( ( *stream )->check ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free check.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *stream )->window != NULL )
+		{
+			assorted_aligned_memory_free(
+			 ( *stream )->window );
+		}
+		memory_free(
+		 *stream );
+
+		*stream = NULL;
+	}
+	return( result );
+}
+
+/* Sets the dictionary size of the block that is read next
+ * The window keeps the dictionary size, rounded up to a multiple of 16, of history
+ * so that the window can be moved without changing the position bits of the data
+ * Any data in the window that has not been written is written first
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_stream_set_dictionary_size(
+     assorted_lzma_stream_t *stream,
+     uint32_t dictionary_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_stream_set_dictionary_size";
+	size_t history_size   = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) dictionary_size > ( ( ( (size_t) SSIZE_MAX - ASSORTED_LZMA_STREAM_MAXIMUM_CHUNK_SIZE ) / 2 ) - 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid dictionary size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzma_stream_write_output(
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output.",
+		 function );
+
+		return( -1 );
+	}
+	/* The 16 additional bytes cover the bytes that are lost when the start
+	 * of the dictionary is aligned after the window was moved
+	 */
+	history_size = ( ( (size_t) dictionary_size + 15 ) & ~( (size_t) 15 ) ) + 16;
+
+	stream->history_size        = history_size;
+	stream->maximum_window_size = ( history_size * 2 ) + ASSORTED_LZMA_STREAM_MAXIMUM_CHUNK_SIZE;
+	stream->window_offset       = 0;
+	stream->output_offset       = 0;
+	stream->dictionary_offset   = 0;
+
+	return( 1 );
+}
+
+/* Writes the data in the window that has not been written
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_stream_write_output(
+     assorted_lzma_stream_t *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_stream_write_output";
+	size_t write_size     = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->output_offset > stream->window_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream - output offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	write_size = stream->window_offset - stream->output_offset;
+
+	if( write_size == 0 )
+	{
+		return( 1 );
+	}
+	if( stream->write_function != NULL )
+	{
+		if( stream->write_function(
+		     stream->sink,
+		     &( stream->window[ stream->output_offset ] ),
+		     write_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	stream->output_offset           = stream->window_offset;
+	stream->uncompressed_data_size += write_size;
+
+	return( 1 );
+}
+
+/* Prepares the window for a LZMA2 chunk
+ * The data that has not been written is written and, if the remaining space in the window
+ * cannot hold a chunk, the window is grown up to its maximum size or the history is moved
+ * to the start of the window
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzma_stream_prepare_window(
+     assorted_lzma_stream_t *stream,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "assorted_lzma_stream_prepare_window";
+	size_t move_offset    = 0;
+	size_t window_size    = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->window_offset > stream->window_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream - window offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzma_stream_write_output(
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream->window_size - stream->window_offset ) >= ASSORTED_LZMA_STREAM_MAXIMUM_CHUNK_SIZE )
+	{
+		return( 1 );
+	}
+	/* The window is grown as needed so that small blocks do not require a window of the full dictionary size
+	 */
+	if( stream->window_size < stream->maximum_window_size )
+	{
+		window_size = stream->window_size * 2;
+
+		if( window_size < ( 2 * ASSORTED_LZMA_STREAM_MAXIMUM_CHUNK_SIZE ) )
+		{
+			window_size = 2 * ASSORTED_LZMA_STREAM_MAXIMUM_CHUNK_SIZE;
+		}
+		if( window_size > stream->maximum_window_size )
+		{
+			window_size = stream->maximum_window_size;
+		}
+		reallocation = (uint8_t *) assorted_aligned_memory_reallocate(
+		                            stream->window,
+		                            sizeof( uint8_t ) * window_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize window.",
+			 function );
+
+			return( -1 );
+		}
+		stream->window      = reallocation;
+		stream->window_size = window_size;
+
+		if( ( stream->window_size - stream->window_offset ) >= ASSORTED_LZMA_STREAM_MAXIMUM_CHUNK_SIZE )
+		{
+			return( 1 );
+		}
+	}
+	if( stream->window_offset <= stream->history_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream - history size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The history is moved by a multiple of 16 bytes so that the position bits
+	 * of the data relative to the dictionary offset remain the same
+	 */
+	move_offset = ( stream->window_offset - stream->history_size ) & ~( (size_t) 15 );
+
+	if( memory_move(
+	     stream->window,
+	     &( stream->window[ move_offset ] ),
+	     stream->window_offset - move_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to move history to start of window.",
+		 function );
+
+		return( -1 );
+	}
+	stream->window_offset -= move_offset;
+	stream->output_offset  = stream->window_offset;
+
+	if( stream->dictionary_offset >= move_offset )
+	{
+		stream->dictionary_offset -= move_offset;
+	}
+	else
+	{
+		stream->dictionary_offset &= 15;
+	}
+	return( 1 );
+}
+
+/* Reads a LZMA2 encoded block into the window
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_stream_read_lzma2_block(
+     assorted_lzma_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_stream_read_lzma2_block";
+	size_t chunk_data_offset           = 0;
+	size_t safe_compressed_data_offset = 0;
+	int result                         = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->history_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing dictionary size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	stream->decoder->requires_dictionary_reset = 1;
+	stream->decoder->requires_properties       = 1;
+
+	do
+	{
+		if( assorted_lzma_stream_prepare_window(
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to prepare window.",
+			 function );
+
+			return( -1 );
+		}
+		chunk_data_offset = stream->window_offset;
+
+		result = assorted_lzma_decoder_read_lzma2_chunk(
+		          stream->decoder,
+		          compressed_data,
+		          compressed_data_size,
+		          &safe_compressed_data_offset,
+		          stream->window,
+		          stream->window_size,
+		          &( stream->window_offset ),
+		          &( stream->dictionary_offset ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read LZMA2 chunk.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( stream->check != NULL )
+		 && ( stream->window_offset > chunk_data_offset ) )
+		{
+			if( assorted_lzma_check_update(
+			     stream->check,
+			     &( stream->window[ chunk_data_offset ] ),
+			     stream->window_offset - chunk_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update check.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( result == 1 );
+
+	if( assorted_lzma_stream_write_output(
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Determines the compressed size of a LZMA2 chunk from the chunk header
+ * Returns 1 if successful, 0 if more compressed data is required or -1 on error
+ */
+int assorted_lzma_stream_get_lzma2_chunk_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzma_stream_get_lzma2_chunk_size";
+	size_t header_size    = 0;
+	uint16_t data_size    = 0;
+	uint8_t control_code  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 1 )
+	{
+		return( 0 );
+	}
+	control_code = compressed_data[ 0 ];
+
+	if( control_code == 0x00 )
+	{
+		*chunk_size = 1;
+
+		return( 1 );
+	}
+	/* An uncompressed chunk contains the data size in bytes 1 and 2
+	 * and a LZMA chunk the compressed data size in bytes 3 and 4
+	 * followed by a properties byte if the chunk resets the state with new properties
+	 */
+	if( ( control_code == 0x01 )
+	 || ( control_code == 0x02 ) )
+	{
+		header_size = 3;
+	}
+	else if( control_code >= 0x80 )
+	{
+		header_size = 5;
+
+		if( control_code >= 0xc0 )
+		{
+			header_size = 6;
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported control code: 0x%02" PRIx8 ".",
+		 function,
+		 control_code );
+
+		return( -1 );
+	}
+	if( compressed_data_size < header_size )
+	{
+		return( 0 );
+	}
+	if( control_code < 0x80 )
+	{
+		byte_stream_copy_to_uint16_big_endian(
+		 &( compressed_data[ 1 ] ),
+		 data_size );
+	}
+	else
+	{
+		byte_stream_copy_to_uint16_big_endian(
+		 &( compressed_data[ 3 ] ),
+		 data_size );
+	}
+	*chunk_size = header_size + (size_t) data_size + 1;
+
+	return( 1 );
+}
+
+/* Feeds LZMA compressed data to the stream
+ * Only complete parts of the stream, such as headers and LZMA2 chunks, are read, the compressed data
+ * offset is set to the start of the first part that is incomplete, which must be provided again together
+ * with the data that follows it. The index and stream footer are only read when the input is final.
+ * The uncompressed data is written as it becomes available
+ * Returns 1 if the end of the stream was reached, 0 if more compressed data is required or -1 on error
+ */
+int assorted_lzma_stream_feed(
+     assorted_lzma_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t input_is_final,
+     libcerror_error_t **error )
+{
+	static char *function              = "assorted_lzma_stream_feed";
+	size_t chunk_data_offset           = 0;
+	size_t chunk_size                  = 0;
+	size_t header_size                 = 0;
+	size_t padding_size                = 0;
+	size_t remaining_size              = 0;
+	size_t safe_compressed_data_offset = 0;
+	uint32_t dictionary_size           = 0;
+	uint8_t check_type                 = 0;
+	uint8_t requires_input             = 0;
+	int result                         = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( stream->state != ASSORTED_LZMA_STREAM_STATE_END )
+	    && ( requires_input == 0 ) )
+	{
+		remaining_size = compressed_data_size - safe_compressed_data_offset;
+
+		if( stream->state == ASSORTED_LZMA_STREAM_STATE_STREAM_HEADER )
+		{
+			if( remaining_size < 12 )
+			{
+				requires_input = 1;
+
+				continue;
+			}
+			if( assorted_lzma_read_stream_header(
+			     compressed_data,
+			     compressed_data_size,
+			     &safe_compressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream header.",
+				 function );
+
+				return( -1 );
+			}
+			/* The type of the check that follows every block is determined by the stream flags
+			 */
+			check_type = compressed_data[ safe_compressed_data_offset - 5 ] & 0x0f;
+
+			if( stream->check != NULL )
+			{
+				if( assorted_lzma_check_free(
+				     &( stream->check ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free check.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( assorted_lzma_check_initialize(
+			     &( stream->check ),
+			     check_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create check.",
+				 function );
+
+				return( -1 );
+			}
+			stream->state = ASSORTED_LZMA_STREAM_STATE_BLOCK_HEADER;
+		}
+		else if( stream->state == ASSORTED_LZMA_STREAM_STATE_BLOCK_HEADER )
+		{
+			if( remaining_size < 1 )
+			{
+				requires_input = 1;
+
+				continue;
+			}
+			/* A block header size of 0 indicates the start of the index
+			 */
+			if( compressed_data[ safe_compressed_data_offset ] == 0 )
+			{
+				stream->state = ASSORTED_LZMA_STREAM_STATE_INDEX;
+
+				continue;
+			}
+			header_size = ( (size_t) compressed_data[ safe_compressed_data_offset ] + 1 ) * 4;
+
+			if( remaining_size < header_size )
+			{
+				requires_input = 1;
+
+				continue;
+			}
+			if( assorted_lzma_read_block_header(
+			     compressed_data,
+			     safe_compressed_data_offset + header_size,
+			     &safe_compressed_data_offset,
+			     &dictionary_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block header.",
+				 function );
+
+				return( -1 );
+			}
+			if( assorted_lzma_stream_set_dictionary_size(
+			     stream,
+			     dictionary_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set dictionary size.",
+				 function );
+
+				return( -1 );
+			}
+			if( assorted_lzma_check_reset(
+			     stream->check,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reset check.",
+				 function );
+
+				return( -1 );
+			}
+			stream->decoder->requires_dictionary_reset = 1;
+			stream->decoder->requires_properties       = 1;
+
+			stream->block_data_size = 0;
+			stream->state           = ASSORTED_LZMA_STREAM_STATE_LZMA2_CHUNK;
+		}
+		else if( stream->state == ASSORTED_LZMA_STREAM_STATE_LZMA2_CHUNK )
+		{
+			result = assorted_lzma_stream_get_lzma2_chunk_size(
+			          &( compressed_data[ safe_compressed_data_offset ] ),
+			          remaining_size,
+			          &chunk_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine LZMA2 chunk size.",
+				 function );
+
+				return( -1 );
+			}
+			else if( ( result == 0 )
+			      || ( remaining_size < chunk_size ) )
+			{
+				requires_input = 1;
+
+				continue;
+			}
+			if( assorted_lzma_stream_prepare_window(
+			     stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to prepare window.",
+				 function );
+
+				return( -1 );
+			}
+			chunk_data_offset = stream->window_offset;
+
+			result = assorted_lzma_decoder_read_lzma2_chunk(
+			          stream->decoder,
+			          compressed_data,
+			          safe_compressed_data_offset + chunk_size,
+			          &safe_compressed_data_offset,
+			          stream->window,
+			          stream->window_size,
+			          &( stream->window_offset ),
+			          &( stream->dictionary_offset ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read LZMA2 chunk.",
+				 function );
+
+				return( -1 );
+			}
+			/* The check is updated while the decoded chunk is still in the cache
+			 */
+			if( stream->window_offset > chunk_data_offset )
+			{
+				if( assorted_lzma_check_update(
+				     stream->check,
+				     &( stream->window[ chunk_data_offset ] ),
+				     stream->window_offset - chunk_data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update check.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			stream->block_data_size += chunk_size;
+
+			if( result == 0 )
+			{
+				stream->state = ASSORTED_LZMA_STREAM_STATE_BLOCK_CHECK;
+			}
+		}
+		else if( stream->state == ASSORTED_LZMA_STREAM_STATE_BLOCK_CHECK )
+		{
+			/* The block is padded to a multiple of 4 bytes and followed by the check,
+			 * where the size of the block header is a multiple of 4 bytes
+			 */
+			padding_size = (size_t) ( ( 4 - ( stream->block_data_size % 4 ) ) % 4 );
+
+			if( remaining_size < ( padding_size + stream->check->check_size ) )
+			{
+				requires_input = 1;
+
+				continue;
+			}
+			safe_compressed_data_offset += padding_size;
+
+			if( assorted_lzma_check_read(
+			     stream->check,
+			     compressed_data,
+			     compressed_data_size,
+			     &safe_compressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block check.",
+				 function );
+
+				return( -1 );
+			}
+
+			stream->state = ASSORTED_LZMA_STREAM_STATE_BLOCK_HEADER;
+		}
+		else if( stream->state == ASSORTED_LZMA_STREAM_STATE_INDEX )
+		{
+			/* The size of the index is only known after it has been read
+			 * hence the index and stream footer are read from the final input
+			 */
+			if( input_is_final == 0 )
+			{
+				requires_input = 1;
+
+				continue;
+			}
+			if( assorted_lzma_read_index(
+			     compressed_data,
+			     compressed_data_size,
+			     &safe_compressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read index.",
+				 function );
+
+				return( -1 );
+			}
+			if( assorted_lzma_read_stream_footer(
+			     compressed_data,
+			     compressed_data_size,
+			     &safe_compressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream footer.",
+				 function );
+
+				return( -1 );
+			}
+			stream->state = ASSORTED_LZMA_STREAM_STATE_END;
+		}
+	}
+	if( assorted_lzma_stream_write_output(
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	if( stream->state == ASSORTED_LZMA_STREAM_STATE_END )
+	{
+		return( 1 );
+	}
+	if( input_is_final != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Decompresses LZMA compressed data
+ * The uncompressed data is written in chunks, where only the dictionary of the current block is kept in memory
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzma_stream_decompress(
+     assorted_lzma_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_lzma_stream_decompress";
+	size_t compressed_data_offset = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	stream->state = ASSORTED_LZMA_STREAM_STATE_STREAM_HEADER;
+
+	if( assorted_lzma_stream_feed(
+	     stream,
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
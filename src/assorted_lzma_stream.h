@@ -0,0 +1,168 @@
+/*
+ * LZMA streaming decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_LZMA_STREAM_H )
+#define _ASSORTED_LZMA_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_lzma.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum uncompressed size of a LZMA2 chunk
+ */
+#define ASSORTED_LZMA_STREAM_MAXIMUM_CHUNK_SIZE		( 2 * 1024 * 1024 )
+
+/* The feed states
+ */
+enum ASSORTED_LZMA_STREAM_STATES
+{
+	ASSORTED_LZMA_STREAM_STATE_STREAM_HEADER	= 0x00,
+	ASSORTED_LZMA_STREAM_STATE_BLOCK_HEADER		= 0x01,
+	ASSORTED_LZMA_STREAM_STATE_LZMA2_CHUNK		= 0x02,
+	ASSORTED_LZMA_STREAM_STATE_BLOCK_CHECK		= 0x03,
+	ASSORTED_LZMA_STREAM_STATE_INDEX		= 0x04,
+	ASSORTED_LZMA_STREAM_STATE_END			= 0x05
+};
+
+typedef struct assorted_lzma_stream assorted_lzma_stream_t;
+
+struct assorted_lzma_stream
+{
+	/* The decoder
+	 */
+	assorted_lzma_decoder_t *decoder;
+
+	/* The window that contains the history and the data that has not been written
+	 */
+	uint8_t *window;
+
+	/* The size of the window
+	 */
+	size_t window_size;
+
+	/* The size of the history that is kept in the window
+	 */
+	size_t history_size;
+
+	/* The size the window can grow to, after which the history is moved to the start of the window
+	 */
+	size_t maximum_window_size;
+
+	/* The window offset of the next byte to decode
+	 */
+	size_t window_offset;
+
+	/* The window offset of the next byte to write
+	 */
+	size_t output_offset;
+
+	/* The window offset of the last dictionary reset
+	 */
+	size_t dictionary_offset;
+
+	/* The function that writes the uncompressed data to the sink
+	 */
+	int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error );
+
+	/* The sink, or NULL if not set
+	 */
+	intptr_t *sink;
+
+	/* The size of the uncompressed data that has been written
+	 */
+	uint64_t uncompressed_data_size;
+
+	/* The feed state
+	 */
+	uint8_t state;
+
+	/* The check that follows every block, which is updated with the uncompressed data
+	 * of every LZMA2 chunk directly after it was decoded
+	 */
+	assorted_lzma_check_t *check;
+
+	/* The size of the LZMA2 data of the current block, used to determine the block padding
+	 */
+	uint64_t block_data_size;
+};
+
+int assorted_lzma_stream_initialize(
+     assorted_lzma_stream_t **stream,
+     int (*write_function)( intptr_t *sink, const uint8_t *data, size_t data_size, libcerror_error_t **error ),
+     intptr_t *sink,
+     libcerror_error_t **error );
+
+int assorted_lzma_stream_free(
+     assorted_lzma_stream_t **stream,
+     libcerror_error_t **error );
+
+int assorted_lzma_stream_set_dictionary_size(
+     assorted_lzma_stream_t *stream,
+     uint32_t dictionary_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_stream_write_output(
+     assorted_lzma_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_lzma_stream_prepare_window(
+     assorted_lzma_stream_t *stream,
+     libcerror_error_t **error );
+
+int assorted_lzma_stream_read_lzma2_block(
+     assorted_lzma_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_lzma_stream_get_lzma2_chunk_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *chunk_size,
+     libcerror_error_t **error );
+
+int assorted_lzma_stream_feed(
+     assorted_lzma_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t input_is_final,
+     libcerror_error_t **error );
+
+int assorted_lzma_stream_decompress(
+     assorted_lzma_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_LZMA_STREAM_H ) */
+
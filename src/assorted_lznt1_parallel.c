@@ -0,0 +1,786 @@
+/*
+ * LZNT1 parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_libfwnt.h"
+#include "assorted_lznt1_parallel.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+/* Retrieves the number of chunks in LZNT1 compressed data
+ * The chunks are determined from the chunk headers, the chunk data is not decompressed
+ * A chunk header of 0 marks the end of the compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lznt1_parallel_get_number_of_chunks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function             = "assorted_lznt1_parallel_get_number_of_chunks";
+	size_t compressed_data_offset     = 0;
+	size_t safe_number_of_chunks      = 0;
+	uint16_t compression_chunk_header = 0;
+	uint16_t compression_chunk_size   = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( compressed_data_offset + 2 ) <= compressed_data_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_chunk_header );
+
+		if( compression_chunk_header == 0 )
+		{
+			break;
+		}
+		/* The chunk size is stored in the lower 12 bits of the chunk header
+		 * as the size of the chunk data - 1
+		 */
+		compression_chunk_size = ( compression_chunk_header & 0x0fff ) + 1;
+
+		if( (size_t) compression_chunk_size > ( compressed_data_size - ( compressed_data_offset + 2 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %" PRIzd " size value out of bounds.",
+			 function,
+			 safe_number_of_chunks );
+
+			return( -1 );
+		}
+		compressed_data_offset += 2 + (size_t) compression_chunk_size;
+
+		safe_number_of_chunks++;
+	}
+	*number_of_chunks = safe_number_of_chunks;
+
+	return( 1 );
+}
+
+/* Determines the chunks in LZNT1 compressed data
+ * Every chunk, except for the last, decompresses into ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE bytes
+ * hence the uncompressed data of a chunk is assigned at chunk index * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lznt1_parallel_get_chunks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     assorted_lznt1_parallel_chunk_t *chunks,
+     size_t number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function             = "assorted_lznt1_parallel_get_chunks";
+	size_t chunk_index                = 0;
+	size_t compressed_data_offset     = 0;
+	size_t uncompressed_data_offset   = 0;
+	uint16_t compression_chunk_header = 0;
+	uint16_t compression_chunk_size   = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks > (size_t) ( SSIZE_MAX / sizeof( assorted_lznt1_parallel_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( ( compressed_data_offset + 2 ) > compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_chunk_header );
+
+		compression_chunk_size = ( compression_chunk_header & 0x0fff ) + 1;
+
+		if( ( compression_chunk_header == 0 )
+		 || ( (size_t) compression_chunk_size > ( compressed_data_size - ( compressed_data_offset + 2 ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %" PRIzd " size value out of bounds.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( uncompressed_data_offset >= uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid uncompressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		chunks[ chunk_index ].compressed_data        = &( compressed_data[ compressed_data_offset ] );
+		chunks[ chunk_index ].compressed_data_size   = 2 + (size_t) compression_chunk_size;
+		chunks[ chunk_index ].uncompressed_data      = &( uncompressed_data[ uncompressed_data_offset ] );
+		chunks[ chunk_index ].uncompressed_data_size = uncompressed_data_size - uncompressed_data_offset;
+		chunks[ chunk_index ].result                 = 0;
+
+		if( chunks[ chunk_index ].uncompressed_data_size > ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE )
+		{
+			chunks[ chunk_index ].uncompressed_data_size = ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE;
+		}
+		compressed_data_offset   += chunks[ chunk_index ].compressed_data_size;
+		uncompressed_data_offset += ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decompresses chunks
+ * The result of every chunk is stored in the chunk
+ * Returns 1 if all chunks were decompressed, 0 if not or -1 on error
+ */
+int assorted_lznt1_parallel_decompress_chunks(
+     assorted_lznt1_parallel_chunk_t *chunks,
+     size_t number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lznt1_parallel_decompress_chunks";
+	size_t chunk_index    = 0;
+	int result            = 1;
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks > (size_t) ( SSIZE_MAX / sizeof( assorted_lznt1_parallel_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunks[ chunk_index ].result = libfwnt_lznt1_decompress(
+		                                chunks[ chunk_index ].compressed_data,
+		                                chunks[ chunk_index ].compressed_data_size,
+		                                chunks[ chunk_index ].uncompressed_data,
+		                                &( chunks[ chunk_index ].uncompressed_data_size ),
+		                                NULL );
+
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+/* Places decompressed chunks in the uncompressed data
+ * A chunk that is not decompressed is decompressed first
+ * A chunk that follows a chunk that decompressed into less than
+ * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE bytes is moved into place
+ * Returns 1 if successful, 0 if a chunk failed to decompress or -1 on error
+ */
+int assorted_lznt1_parallel_place_chunks(
+     assorted_lznt1_parallel_chunk_t *chunks,
+     size_t number_of_chunks,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function                = "assorted_lznt1_parallel_place_chunks";
+	size_t chunk_index                   = 0;
+	size_t safe_uncompressed_data_offset = 0;
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ].result == 0 )
+		{
+			chunks[ chunk_index ].result = libfwnt_lznt1_decompress(
+			                                chunks[ chunk_index ].compressed_data,
+			                                chunks[ chunk_index ].compressed_data_size,
+			                                chunks[ chunk_index ].uncompressed_data,
+			                                &( chunks[ chunk_index ].uncompressed_data_size ),
+			                                NULL );
+		}
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			return( 0 );
+		}
+		if( chunks[ chunk_index ].uncompressed_data != &( uncompressed_data[ safe_uncompressed_data_offset ] ) )
+		{
+			if( memory_move(
+			     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+			     chunks[ chunk_index ].uncompressed_data,
+			     chunks[ chunk_index ].uncompressed_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move chunk: %" PRIzd " uncompressed data.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+		}
+		safe_uncompressed_data_offset += chunks[ chunk_index ].uncompressed_data_size;
+
+		*uncompressed_data_offset = safe_uncompressed_data_offset;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the chunks of a task from a thread pool
+ * The error is not available from the worker thread, the result is stored in the chunks
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lznt1_parallel_decompress_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_lznt1_parallel_task_t *task = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	task = (assorted_lznt1_parallel_task_t *) value;
+
+	if( assorted_lznt1_parallel_decompress_chunks(
+	     task->chunks,
+	     task->number_of_chunks,
+	     NULL ) == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses LZNT1 compressed data with the chunks decompressed in parallel
+ * The chunk headers are walked first to determine the compressed data and
+ * uncompressed data offset of every chunk. Since the back-references of a chunk
+ * do not cross the chunk boundary the chunks can be decompressed independently.
+ * The tasks are retrieved from the thread pool in order as they complete, so
+ * the chunks that follow a chunk that decompressed into less than
+ * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE bytes are moved into place while the
+ * chunks of the next tasks are decompressed
+ * If a chunk fails to decompress the data is decompressed again sequentially to retrieve the error
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lznt1_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	assorted_lznt1_parallel_chunk_t *chunks = NULL;
+	static char *function                   = "assorted_lznt1_parallel_decompress";
+	size_t number_of_chunks                 = 0;
+	size_t uncompressed_data_offset         = 0;
+	int result                              = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_lznt1_parallel_task_t *task    = NULL;
+	assorted_lznt1_parallel_task_t *tasks   = NULL;
+	assorted_thread_pool_t *thread_pool     = NULL;
+	size_t chunk_index                      = 0;
+	size_t maximum_number_of_tasks          = 0;
+	size_t number_of_chunks_per_task        = 0;
+	size_t number_of_completed_tasks        = 0;
+	size_t number_of_tasks                  = 0;
+	size_t task_index                       = 0;
+#endif
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lznt1_parallel_get_number_of_chunks(
+	     compressed_data,
+	     compressed_data_size,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == 0 )
+	{
+		*uncompressed_data_size = 0;
+
+		return( 1 );
+	}
+	if( number_of_chunks > (size_t) ( SSIZE_MAX / sizeof( assorted_lznt1_parallel_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	chunks = (assorted_lznt1_parallel_chunk_t *) memory_allocate(
+	                                              sizeof( assorted_lznt1_parallel_chunk_t ) * number_of_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lznt1_parallel_get_chunks(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     *uncompressed_data_size,
+	     chunks,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunks.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		number_of_chunks_per_task = ( number_of_chunks + number_of_threads - 1 ) / number_of_threads;
+
+		if( number_of_chunks_per_task > ASSORTED_LZNT1_PARALLEL_NUMBER_OF_CHUNKS_PER_TASK )
+		{
+			number_of_chunks_per_task = ASSORTED_LZNT1_PARALLEL_NUMBER_OF_CHUNKS_PER_TASK;
+		}
+		number_of_tasks = ( number_of_chunks + number_of_chunks_per_task - 1 ) / number_of_chunks_per_task;
+	}
+	if( number_of_tasks > 1 )
+	{
+		tasks = (assorted_lznt1_parallel_task_t *) memory_allocate(
+		                                            sizeof( assorted_lznt1_parallel_task_t ) * number_of_tasks );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			chunk_index = task_index * number_of_chunks_per_task;
+
+			tasks[ task_index ].chunks           = &( chunks[ chunk_index ] );
+			tasks[ task_index ].number_of_chunks = number_of_chunks - chunk_index;
+
+			if( tasks[ task_index ].number_of_chunks > number_of_chunks_per_task )
+			{
+				tasks[ task_index ].number_of_chunks = number_of_chunks_per_task;
+			}
+		}
+		maximum_number_of_tasks = (size_t) number_of_threads * ASSORTED_LZNT1_PARALLEL_NUMBER_OF_TASKS_PER_THREAD;
+
+		if( maximum_number_of_tasks > number_of_tasks )
+		{
+			maximum_number_of_tasks = number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     (int) maximum_number_of_tasks,
+		     (int (*)(intptr_t *, void *)) &assorted_lznt1_parallel_decompress_task_callback,
+		     NULL,
+		     ASSORTED_THREAD_POOL_FLAG_ORDERED_COMPLETION,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		result     = 1;
+		task_index = 0;
+
+		while( number_of_completed_tasks < number_of_tasks )
+		{
+			/* Keep at most the maximum number of tasks in the thread pool
+			 * since pushing more would block until a task is retrieved
+			 */
+			while( ( task_index < number_of_tasks )
+			    && ( ( task_index - number_of_completed_tasks ) < maximum_number_of_tasks ) )
+			{
+				if( assorted_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( tasks[ task_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push task: %" PRIzd " onto thread pool.",
+					 function,
+					 task_index );
+
+					goto on_error;
+				}
+				task_index++;
+			}
+			if( assorted_thread_pool_pop_completed(
+			     thread_pool,
+			     (intptr_t **) &task,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve completed task: %" PRIzd " from thread pool.",
+				 function,
+				 number_of_completed_tasks );
+
+				goto on_error;
+			}
+			number_of_completed_tasks++;
+
+			result = assorted_lznt1_parallel_place_chunks(
+			          task->chunks,
+			          task->number_of_chunks,
+			          uncompressed_data,
+			          &uncompressed_data_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to place chunks of task: %" PRIzd ".",
+				 function,
+				 number_of_completed_tasks - 1 );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 tasks );
+
+		tasks = NULL;
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		/* Without a thread pool the chunks are decompressed here
+		 */
+		result = assorted_lznt1_parallel_place_chunks(
+		          chunks,
+		          number_of_chunks,
+		          uncompressed_data,
+		          &uncompressed_data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to place chunks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 chunks );
+
+	chunks = NULL;
+
+	if( result != 1 )
+	{
+		return( libfwnt_lznt1_decompress(
+		         compressed_data,
+		         compressed_data_size,
+		         uncompressed_data,
+		         uncompressed_data_size,
+		         error ) );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( tasks != NULL )
+	{
+		memory_free(
+		 tasks );
+	}
+#endif
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
+	}
+	return( -1 );
+}
+
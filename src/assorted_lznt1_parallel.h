@@ -0,0 +1,133 @@
+/*
+ * LZNT1 parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_LZNT1_PARALLEL_H )
+#define _ASSORTED_LZNT1_PARALLEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The uncompressed size of a LZNT1 chunk
+ */
+#define ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE			4096
+
+/* The maximum number of chunks that are decompressed per thread pool task
+ */
+#define ASSORTED_LZNT1_PARALLEL_NUMBER_OF_CHUNKS_PER_TASK	64
+
+/* The maximum number of tasks per thread that are in the thread pool at the same time
+ */
+#define ASSORTED_LZNT1_PARALLEL_NUMBER_OF_TASKS_PER_THREAD	4
+
+typedef struct assorted_lznt1_parallel_chunk assorted_lznt1_parallel_chunk_t;
+
+struct assorted_lznt1_parallel_chunk
+{
+	/* The compressed data, including the chunk header
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size, including the chunk header
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size, on input the size of the uncompressed data
+	 * and on output the size of the decompressed data
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the chunk decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+typedef struct assorted_lznt1_parallel_task assorted_lznt1_parallel_task_t;
+
+struct assorted_lznt1_parallel_task
+{
+	/* The first chunk of the task
+	 */
+	assorted_lznt1_parallel_chunk_t *chunks;
+
+	/* The number of chunks of the task
+	 */
+	size_t number_of_chunks;
+};
+
+int assorted_lznt1_parallel_get_number_of_chunks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *number_of_chunks,
+     libcerror_error_t **error );
+
+int assorted_lznt1_parallel_get_chunks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     assorted_lznt1_parallel_chunk_t *chunks,
+     size_t number_of_chunks,
+     libcerror_error_t **error );
+
+int assorted_lznt1_parallel_decompress_chunks(
+     assorted_lznt1_parallel_chunk_t *chunks,
+     size_t number_of_chunks,
+     libcerror_error_t **error );
+
+int assorted_lznt1_parallel_place_chunks(
+     assorted_lznt1_parallel_chunk_t *chunks,
+     size_t number_of_chunks,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_lznt1_parallel_decompress_task_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_lznt1_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_LZNT1_PARALLEL_H ) */
+
@@ -0,0 +1,400 @@
+/*
+ * LZVN decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_lzvn.h"
+
+/* The opcode type of every opcode byte, see ASSORTED_LZVN_OPCODE_TYPES
+ */
+static const uint8_t assorted_lzvn_opcode_types[ 256 ] = {
+	 0,  0,  0,  0,  0,  0,  8,  2,  0,  0,  0,  0,  0,  0,  9,  2,
+	 0,  0,  0,  0,  0,  0,  9,  2,  0,  0,  0,  0,  0,  0, 10,  2,
+	 0,  0,  0,  0,  0,  0, 10,  2,  0,  0,  0,  0,  0,  0, 10,  2,
+	 0,  0,  0,  0,  0,  0, 10,  2,  0,  0,  0,  0,  0,  0, 10,  2,
+	 0,  0,  0,  0,  0,  0,  3,  2,  0,  0,  0,  0,  0,  0,  3,  2,
+	 0,  0,  0,  0,  0,  0,  3,  2,  0,  0,  0,  0,  0,  0,  3,  2,
+	 0,  0,  0,  0,  0,  0,  3,  2,  0,  0,  0,  0,  0,  0,  3,  2,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	 0,  0,  0,  0,  0,  0,  3,  2,  0,  0,  0,  0,  0,  0,  3,  2,
+	 0,  0,  0,  0,  0,  0,  3,  2,  0,  0,  0,  0,  0,  0,  3,  2,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 0,  0,  0,  0,  0,  0,  3,  2,  0,  0,  0,  0,  0,  0,  3,  2,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	 5,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+	 7,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6 };
+
+/* Decompresses a LZVN compressed block
+ * Decompression starts at the uncompressed data offset, matches can refer
+ * to the uncompressed data that precedes it
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzvn_decompress_block(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function                = "assorted_lzvn_decompress_block";
+	size_t compressed_data_offset        = 0;
+	size_t distance                      = 0;
+	size_t literal_size                  = 0;
+	size_t match_offset                  = 0;
+	size_t match_size                    = 0;
+	size_t opcode_size                   = 0;
+	size_t safe_uncompressed_data_offset = 0;
+	uint16_t value_16bit                 = 0;
+	uint8_t opcode                       = 0;
+	uint8_t opcode_type                  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_offset < compressed_data_size )
+	{
+		opcode      = compressed_data[ compressed_data_offset ];
+		opcode_type = assorted_lzvn_opcode_types[ opcode ];
+
+		switch( opcode_type )
+		{
+			case ASSORTED_LZVN_OPCODE_TYPE_SMALL_DISTANCE:
+			case ASSORTED_LZVN_OPCODE_TYPE_LARGE_DISTANCE:
+			case ASSORTED_LZVN_OPCODE_TYPE_LARGE_LITERAL:
+			case ASSORTED_LZVN_OPCODE_TYPE_LARGE_MATCH:
+				opcode_size = 2;
+
+				if( opcode_type == ASSORTED_LZVN_OPCODE_TYPE_LARGE_DISTANCE )
+				{
+					opcode_size = 3;
+				}
+				break;
+
+			case ASSORTED_LZVN_OPCODE_TYPE_MEDIUM_DISTANCE:
+				opcode_size = 3;
+				break;
+
+			case ASSORTED_LZVN_OPCODE_TYPE_END_OF_STREAM:
+				*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+				return( 1 );
+
+			case ASSORTED_LZVN_OPCODE_TYPE_UNDEFINED:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+				 "%s: undefined opcode: 0x%02" PRIx8 " at offset: %" PRIzd ".",
+				 function,
+				 opcode,
+				 compressed_data_offset );
+
+				return( -1 );
+
+			default:
+				opcode_size = 1;
+				break;
+		}
+		if( opcode_size > ( compressed_data_size - compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: opcode: 0x%02" PRIx8 " at offset: %" PRIzd " exceeds compressed data size.",
+			 function,
+			 opcode,
+			 compressed_data_offset );
+
+			return( -1 );
+		}
+		literal_size = 0;
+		match_size   = 0;
+
+		switch( opcode_type )
+		{
+			/* LLMMMDDD DDDDDDDD
+			 */
+			case ASSORTED_LZVN_OPCODE_TYPE_SMALL_DISTANCE:
+				literal_size = (size_t) ( opcode >> 6 );
+				match_size   = (size_t) ( ( opcode >> 3 ) & 0x07 ) + 3;
+				distance     = ( (size_t) ( opcode & 0x07 ) << 8 )
+				             | compressed_data[ compressed_data_offset + 1 ];
+				break;
+
+			/* 101LLMMM DDDDDDMM DDDDDDDD
+			 */
+			case ASSORTED_LZVN_OPCODE_TYPE_MEDIUM_DISTANCE:
+				value_16bit = ( (uint16_t) compressed_data[ compressed_data_offset + 2 ] << 8 )
+				            | compressed_data[ compressed_data_offset + 1 ];
+
+				literal_size = (size_t) ( ( opcode >> 3 ) & 0x03 );
+				match_size   = ( ( (size_t) ( opcode & 0x07 ) << 2 ) | ( value_16bit & 0x0003 ) ) + 3;
+				distance     = (size_t) ( value_16bit >> 2 );
+				break;
+
+			/* LLMMM111 DDDDDDDD DDDDDDDD
+			 */
+			case ASSORTED_LZVN_OPCODE_TYPE_LARGE_DISTANCE:
+				literal_size = (size_t) ( opcode >> 6 );
+				match_size   = (size_t) ( ( opcode >> 3 ) & 0x07 ) + 3;
+				distance     = ( (size_t) compressed_data[ compressed_data_offset + 2 ] << 8 )
+				             | compressed_data[ compressed_data_offset + 1 ];
+				break;
+
+			/* LLMMM110, uses the distance of the previous match
+			 */
+			case ASSORTED_LZVN_OPCODE_TYPE_PREVIOUS_DISTANCE:
+				literal_size = (size_t) ( opcode >> 6 );
+				match_size   = (size_t) ( ( opcode >> 3 ) & 0x07 ) + 3;
+				break;
+
+			/* 1110LLLL
+			 */
+			case ASSORTED_LZVN_OPCODE_TYPE_SMALL_LITERAL:
+				literal_size = (size_t) ( opcode & 0x0f );
+				break;
+
+			/* 11100000 LLLLLLLL
+			 */
+			case ASSORTED_LZVN_OPCODE_TYPE_LARGE_LITERAL:
+				literal_size = (size_t) compressed_data[ compressed_data_offset + 1 ] + 16;
+				break;
+
+			/* 1111MMMM, uses the distance of the previous match
+			 */
+			case ASSORTED_LZVN_OPCODE_TYPE_SMALL_MATCH:
+				match_size = (size_t) ( opcode & 0x0f );
+				break;
+
+			/* 11110000 MMMMMMMM, uses the distance of the previous match
+			 */
+			case ASSORTED_LZVN_OPCODE_TYPE_LARGE_MATCH:
+				match_size = (size_t) compressed_data[ compressed_data_offset + 1 ] + 16;
+				break;
+
+			default:
+				break;
+		}
+		compressed_data_offset += opcode_size;
+
+		if( literal_size > 0 )
+		{
+			if( ( literal_size > ( compressed_data_size - compressed_data_offset ) )
+			 || ( literal_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: literal size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+			     &( compressed_data[ compressed_data_offset ] ),
+			     literal_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy literals.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_data_offset        += literal_size;
+			safe_uncompressed_data_offset += literal_size;
+		}
+		if( match_size > 0 )
+		{
+			if( ( distance == 0 )
+			 || ( distance > safe_uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: match distance: %" PRIzd " value out of bounds.",
+				 function,
+				 distance );
+
+				return( -1 );
+			}
+			if( match_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: match size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			match_offset = safe_uncompressed_data_offset - distance;
+
+			/* A match that overlaps with its own output is copied per byte
+			 */
+			if( distance >= match_size )
+			{
+				memory_copy(
+				 &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+				 &( uncompressed_data[ match_offset ] ),
+				 match_size );
+
+				safe_uncompressed_data_offset += match_size;
+			}
+			else
+			{
+				while( match_size > 0 )
+				{
+					uncompressed_data[ safe_uncompressed_data_offset++ ] = uncompressed_data[ match_offset++ ];
+
+					match_size--;
+				}
+			}
+		}
+	}
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses LZVN compressed data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzvn_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_lzvn_decompress";
+	size_t uncompressed_data_offset = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_lzvn_decompress_block(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     *uncompressed_data_size,
+	     &uncompressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress LZVN compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
@@ -0,0 +1,75 @@
+/*
+ * LZVN decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_LZVN_H )
+#define _ASSORTED_LZVN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the end of stream opcode including its padding
+ */
+#define ASSORTED_LZVN_END_OF_STREAM_SIZE	8
+
+/* The opcode types
+ */
+enum ASSORTED_LZVN_OPCODE_TYPES
+{
+	ASSORTED_LZVN_OPCODE_TYPE_SMALL_DISTANCE	= 0,
+	ASSORTED_LZVN_OPCODE_TYPE_MEDIUM_DISTANCE	= 1,
+	ASSORTED_LZVN_OPCODE_TYPE_LARGE_DISTANCE	= 2,
+	ASSORTED_LZVN_OPCODE_TYPE_PREVIOUS_DISTANCE	= 3,
+	ASSORTED_LZVN_OPCODE_TYPE_SMALL_LITERAL		= 4,
+	ASSORTED_LZVN_OPCODE_TYPE_LARGE_LITERAL		= 5,
+	ASSORTED_LZVN_OPCODE_TYPE_SMALL_MATCH		= 6,
+	ASSORTED_LZVN_OPCODE_TYPE_LARGE_MATCH		= 7,
+	ASSORTED_LZVN_OPCODE_TYPE_END_OF_STREAM		= 8,
+	ASSORTED_LZVN_OPCODE_TYPE_NOP			= 9,
+	ASSORTED_LZVN_OPCODE_TYPE_UNDEFINED		= 10
+};
+
+int assorted_lzvn_decompress_block(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_lzvn_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_LZVN_H ) */
+
@@ -0,0 +1,979 @@
+/*
+ * LZX parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_libfwnt.h"
+#include "assorted_lzx_parallel.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+/* Retrieves the reset offsets from a reset table
+ * The reset table consists of little-endian compressed data offsets of 4 or 8 bytes,
+ * one for every reset point. A WIM chunk table does not contain the offset of
+ * the first chunk hence if the first entry is not 0 a reset offset of 0 is implied.
+ * The reset offsets should be freed with memory_free
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzx_parallel_get_reset_offsets(
+     const uint8_t *reset_table_data,
+     size_t reset_table_data_size,
+     uint8_t entry_size,
+     size_t compressed_data_size,
+     uint64_t **reset_offsets,
+     size_t *number_of_reset_offsets,
+     libcerror_error_t **error )
+{
+	uint64_t *safe_reset_offsets        = NULL;
+	static char *function               = "assorted_lzx_parallel_get_reset_offsets";
+	size_t entry_index                  = 0;
+	size_t number_of_entries            = 0;
+	size_t reset_index                  = 0;
+	size_t safe_number_of_reset_offsets = 0;
+	uint64_t reset_offset               = 0;
+
+	if( reset_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reset table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( reset_table_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid reset table data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_size != 4 )
+	 && ( entry_size != 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( reset_table_data_size % entry_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid reset table data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( reset_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reset offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( *reset_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid reset offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reset_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reset offsets.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = reset_table_data_size / entry_size;
+
+	safe_number_of_reset_offsets = number_of_entries;
+
+	if( number_of_entries == 0 )
+	{
+		safe_number_of_reset_offsets = 1;
+	}
+	else
+	{
+		if( entry_size == 4 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 reset_table_data,
+			 reset_offset );
+		}
+		else
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 reset_table_data,
+			 reset_offset );
+		}
+		if( reset_offset != 0 )
+		{
+			safe_number_of_reset_offsets += 1;
+		}
+	}
+	safe_reset_offsets = (uint64_t *) memory_allocate(
+	                                   sizeof( uint64_t ) * safe_number_of_reset_offsets );
+
+	if( safe_reset_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create reset offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_number_of_reset_offsets > number_of_entries )
+	{
+		safe_reset_offsets[ 0 ] = 0;
+
+		reset_index = 1;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( entry_size == 4 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( reset_table_data[ entry_index * 4 ] ),
+			 reset_offset );
+		}
+		else
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( reset_table_data[ entry_index * 8 ] ),
+			 reset_offset );
+		}
+		/* Every frame must contain compressed data hence the reset offsets
+		 * must be increasing and within the compressed data
+		 */
+		if( ( reset_offset >= (uint64_t) compressed_data_size )
+		 || ( ( reset_index > 0 )
+		  &&  ( reset_offset <= safe_reset_offsets[ reset_index - 1 ] ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid reset offset: %" PRIzd " value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		safe_reset_offsets[ reset_index++ ] = reset_offset;
+	}
+	*reset_offsets           = safe_reset_offsets;
+	*number_of_reset_offsets = safe_number_of_reset_offsets;
+
+	return( 1 );
+
+on_error:
+	if( safe_reset_offsets != NULL )
+	{
+		memory_free(
+		 safe_reset_offsets );
+	}
+	return( -1 );
+}
+
+/* Determines the frames of LZX compressed data
+ * A frame consists of the compressed data between two successive reset points
+ * and, except for the last frame, decompresses into reset interval bytes.
+ * The frames start at the first reset index and their uncompressed data is
+ * assigned at frame index * reset interval
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_lzx_parallel_get_frames(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint64_t *reset_offsets,
+     size_t number_of_reset_offsets,
+     size_t reset_interval,
+     size_t first_reset_index,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     assorted_lzx_parallel_frame_t *frames,
+     size_t number_of_frames,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_lzx_parallel_get_frames";
+	size_t compressed_data_end      = 0;
+	size_t compressed_data_offset   = 0;
+	size_t frame_index              = 0;
+	size_t reset_index              = 0;
+	size_t uncompressed_data_offset = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( reset_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reset offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( reset_interval == 0 )
+	 || ( reset_interval > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid reset interval value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_reset_index > number_of_reset_offsets )
+	 || ( number_of_frames > ( number_of_reset_offsets - first_reset_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first reset index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( frames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frames.",
+		 function );
+
+		return( -1 );
+	}
+	for( frame_index = 0;
+	     frame_index < number_of_frames;
+	     frame_index++ )
+	{
+		reset_index = first_reset_index + frame_index;
+
+		compressed_data_end = compressed_data_size;
+
+		if( ( reset_index + 1 ) < number_of_reset_offsets )
+		{
+			if( reset_offsets[ reset_index + 1 ] < (uint64_t) compressed_data_size )
+			{
+				compressed_data_end = (size_t) reset_offsets[ reset_index + 1 ];
+			}
+		}
+		if( reset_offsets[ reset_index ] >= (uint64_t) compressed_data_end )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid reset offset: %" PRIzd " value out of bounds.",
+			 function,
+			 reset_index );
+
+			return( -1 );
+		}
+		compressed_data_offset = (size_t) reset_offsets[ reset_index ];
+
+		if( uncompressed_data_offset >= uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid uncompressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		frames[ frame_index ].compressed_data        = &( compressed_data[ compressed_data_offset ] );
+		frames[ frame_index ].compressed_data_size   = compressed_data_end - compressed_data_offset;
+		frames[ frame_index ].uncompressed_data      = &( uncompressed_data[ uncompressed_data_offset ] );
+		frames[ frame_index ].uncompressed_data_size = uncompressed_data_size - uncompressed_data_offset;
+		frames[ frame_index ].result                 = 0;
+
+		if( frames[ frame_index ].uncompressed_data_size > reset_interval )
+		{
+			frames[ frame_index ].uncompressed_data_size = reset_interval;
+		}
+		uncompressed_data_offset += frames[ frame_index ].uncompressed_data_size;
+	}
+	return( 1 );
+}
+
+/* Decompresses frames
+ * The result of every frame is stored in the frame
+ * Returns 1 if all frames were decompressed, 0 if not or -1 on error
+ */
+int assorted_lzx_parallel_decompress_frames(
+     assorted_lzx_parallel_frame_t *frames,
+     size_t number_of_frames,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_lzx_parallel_decompress_frames";
+	size_t frame_index    = 0;
+	int result            = 1;
+
+	if( frames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_frames > (size_t) ( SSIZE_MAX / sizeof( assorted_lzx_parallel_frame_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of frames value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( frame_index = 0;
+	     frame_index < number_of_frames;
+	     frame_index++ )
+	{
+		frames[ frame_index ].result = libfwnt_lzx_decompress(
+		                                frames[ frame_index ].compressed_data,
+		                                frames[ frame_index ].compressed_data_size,
+		                                frames[ frame_index ].uncompressed_data,
+		                                &( frames[ frame_index ].uncompressed_data_size ),
+		                                NULL );
+
+		if( frames[ frame_index ].result != 1 )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the frames of a task from a thread pool
+ * The error is not available from the worker thread, the result is stored in the frames
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzx_parallel_decompress_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_lzx_parallel_task_t *task = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	task = (assorted_lzx_parallel_task_t *) value;
+
+	if( assorted_lzx_parallel_decompress_frames(
+	     task->frames,
+	     task->number_of_frames,
+	     NULL ) == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses a range of LZX compressed data with the frames decompressed in parallel
+ * Since the decoder state is reset at every reset point the frames can be decompressed
+ * independently. Only the frames that cover the uncompressed range of uncompressed
+ * data size bytes starting at the uncompressed offset are decompressed.
+ * On return the uncompressed data size contains the size of the decompressed range,
+ * which is smaller than requested if the range extends beyond the end of the data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzx_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint64_t *reset_offsets,
+     size_t number_of_reset_offsets,
+     size_t reset_interval,
+     size64_t uncompressed_offset,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	assorted_lzx_parallel_frame_t *frames  = NULL;
+	uint8_t *frames_data                   = NULL;
+	static char *function                  = "assorted_lzx_parallel_decompress";
+	size64_t uncompressed_end_offset       = 0;
+	size_t first_reset_index               = 0;
+	size_t frame_index                     = 0;
+	size_t frames_data_offset              = 0;
+	size_t frames_data_size                = 0;
+	size_t last_reset_index                = 0;
+	size_t number_of_frames                = 0;
+	size_t safe_uncompressed_data_size     = 0;
+	int result                             = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_lzx_parallel_task_t *tasks    = NULL;
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+	size_t number_of_frames_per_task       = 0;
+	size_t number_of_tasks                 = 0;
+	size_t task_index                      = 0;
+#endif
+
+	if( reset_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reset offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_reset_offsets == 0 )
+	 || ( number_of_reset_offsets > (size_t) ( SSIZE_MAX / sizeof( assorted_lzx_parallel_frame_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of reset offsets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( reset_interval == 0 )
+	 || ( reset_interval > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid reset interval value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_offset > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the reset points that cover the requested range
+	 */
+	if( ( *uncompressed_data_size == 0 )
+	 || ( ( uncompressed_offset / reset_interval ) >= (size64_t) number_of_reset_offsets ) )
+	{
+		*uncompressed_data_size = 0;
+
+		return( 1 );
+	}
+	first_reset_index = (size_t) ( uncompressed_offset / reset_interval );
+
+	uncompressed_end_offset = uncompressed_offset + *uncompressed_data_size;
+
+	if( ( ( uncompressed_end_offset - 1 ) / reset_interval ) >= (size64_t) number_of_reset_offsets )
+	{
+		last_reset_index = number_of_reset_offsets - 1;
+	}
+	else
+	{
+		last_reset_index = (size_t) ( ( uncompressed_end_offset - 1 ) / reset_interval );
+	}
+	number_of_frames = last_reset_index - first_reset_index + 1;
+
+	if( number_of_frames > (size_t) ( SSIZE_MAX / reset_interval ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of frames value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	frames_data_offset = (size_t) ( uncompressed_offset - ( (size64_t) first_reset_index * reset_interval ) );
+	frames_data_size   = number_of_frames * reset_interval;
+
+	/* The frames are decompressed directly into the uncompressed data if
+	 * the range is reset aligned, otherwise into a separate buffer
+	 */
+	if( ( frames_data_offset == 0 )
+	 && ( *uncompressed_data_size >= frames_data_size ) )
+	{
+		frames_data = uncompressed_data;
+	}
+	else
+	{
+		frames_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * frames_data_size );
+
+		if( frames_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create frames data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	frames = (assorted_lzx_parallel_frame_t *) memory_allocate(
+	                                            sizeof( assorted_lzx_parallel_frame_t ) * number_of_frames );
+
+	if( frames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create frames.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_lzx_parallel_get_frames(
+	     compressed_data,
+	     compressed_data_size,
+	     reset_offsets,
+	     number_of_reset_offsets,
+	     reset_interval,
+	     first_reset_index,
+	     frames_data,
+	     frames_data_size,
+	     frames,
+	     number_of_frames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve frames.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		number_of_frames_per_task = ( number_of_frames + number_of_threads - 1 ) / number_of_threads;
+
+		if( number_of_frames_per_task > ASSORTED_LZX_PARALLEL_NUMBER_OF_FRAMES_PER_TASK )
+		{
+			number_of_frames_per_task = ASSORTED_LZX_PARALLEL_NUMBER_OF_FRAMES_PER_TASK;
+		}
+		number_of_tasks = ( number_of_frames + number_of_frames_per_task - 1 ) / number_of_frames_per_task;
+	}
+	if( number_of_tasks > 1 )
+	{
+		if( number_of_tasks > (size_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of tasks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		tasks = (assorted_lzx_parallel_task_t *) memory_allocate(
+		                                          sizeof( assorted_lzx_parallel_task_t ) * number_of_tasks );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			frame_index = task_index * number_of_frames_per_task;
+
+			tasks[ task_index ].frames           = &( frames[ frame_index ] );
+			tasks[ task_index ].number_of_frames = number_of_frames - frame_index;
+
+			if( tasks[ task_index ].number_of_frames > number_of_frames_per_task )
+			{
+				tasks[ task_index ].number_of_frames = number_of_frames_per_task;
+			}
+		}
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = (int) number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &assorted_lzx_parallel_decompress_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %" PRIzd " onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 tasks );
+
+		tasks = NULL;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the frames are decompressed here
+	 */
+	for( frame_index = 0;
+	     frame_index < number_of_frames;
+	     frame_index++ )
+	{
+		if( frames[ frame_index ].result == 0 )
+		{
+			frames[ frame_index ].result = libfwnt_lzx_decompress(
+			                                frames[ frame_index ].compressed_data,
+			                                frames[ frame_index ].compressed_data_size,
+			                                frames[ frame_index ].uncompressed_data,
+			                                &( frames[ frame_index ].uncompressed_data_size ),
+			                                NULL );
+		}
+		if( frames[ frame_index ].result != 1 )
+		{
+			result = 0;
+
+			break;
+		}
+		/* Only the frame of the last reset point can be smaller than the reset interval
+		 */
+		if( ( ( first_reset_index + frame_index ) < ( number_of_reset_offsets - 1 ) )
+		 && ( frames[ frame_index ].uncompressed_data_size != reset_interval ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid frame: %" PRIzd " uncompressed data size value out of bounds.",
+			 function,
+			 first_reset_index + frame_index );
+
+			goto on_error;
+		}
+	}
+	if( result != 1 )
+	{
+		/* Decompress the failed frame again to retrieve the error
+		 */
+		frames[ frame_index ].uncompressed_data_size = reset_interval;
+
+		libfwnt_lzx_decompress(
+		 frames[ frame_index ].compressed_data,
+		 frames[ frame_index ].compressed_data_size,
+		 frames[ frame_index ].uncompressed_data,
+		 &( frames[ frame_index ].uncompressed_data_size ),
+		 error );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress frame: %" PRIzd ".",
+		 function,
+		 first_reset_index + frame_index );
+
+		goto on_error;
+	}
+	safe_uncompressed_data_size = ( ( number_of_frames - 1 ) * reset_interval )
+	                            + frames[ number_of_frames - 1 ].uncompressed_data_size;
+
+	memory_free(
+	 frames );
+
+	frames = NULL;
+
+	if( frames_data_offset >= safe_uncompressed_data_size )
+	{
+		safe_uncompressed_data_size = 0;
+	}
+	else
+	{
+		safe_uncompressed_data_size -= frames_data_offset;
+	}
+	if( safe_uncompressed_data_size > *uncompressed_data_size )
+	{
+		safe_uncompressed_data_size = *uncompressed_data_size;
+	}
+	if( frames_data != uncompressed_data )
+	{
+		if( memory_copy(
+		     uncompressed_data,
+		     &( frames_data[ frames_data_offset ] ),
+		     safe_uncompressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 frames_data );
+
+		frames_data = NULL;
+	}
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( tasks != NULL )
+	{
+		memory_free(
+		 tasks );
+	}
+#endif
+	if( frames != NULL )
+	{
+		memory_free(
+		 frames );
+	}
+	if( ( frames_data != NULL )
+	 && ( frames_data != uncompressed_data ) )
+	{
+		memory_free(
+		 frames_data );
+	}
+	return( -1 );
+}
+
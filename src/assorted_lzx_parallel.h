@@ -0,0 +1,133 @@
+/*
+ * LZX parallel decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_LZX_PARALLEL_H )
+#define _ASSORTED_LZX_PARALLEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default uncompressed size between reset points, as used by WIM
+ */
+#define ASSORTED_LZX_PARALLEL_DEFAULT_RESET_INTERVAL		32768
+
+/* The maximum number of frames that are decompressed per thread pool task
+ */
+#define ASSORTED_LZX_PARALLEL_NUMBER_OF_FRAMES_PER_TASK		16
+
+typedef struct assorted_lzx_parallel_frame assorted_lzx_parallel_frame_t;
+
+struct assorted_lzx_parallel_frame
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size, on input the size of the uncompressed data
+	 * and on output the size of the decompressed data
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the frame decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+typedef struct assorted_lzx_parallel_task assorted_lzx_parallel_task_t;
+
+struct assorted_lzx_parallel_task
+{
+	/* The first frame of the task
+	 */
+	assorted_lzx_parallel_frame_t *frames;
+
+	/* The number of frames of the task
+	 */
+	size_t number_of_frames;
+};
+
+int assorted_lzx_parallel_get_reset_offsets(
+     const uint8_t *reset_table_data,
+     size_t reset_table_data_size,
+     uint8_t entry_size,
+     size_t compressed_data_size,
+     uint64_t **reset_offsets,
+     size_t *number_of_reset_offsets,
+     libcerror_error_t **error );
+
+int assorted_lzx_parallel_get_frames(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint64_t *reset_offsets,
+     size_t number_of_reset_offsets,
+     size_t reset_interval,
+     size_t first_reset_index,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     assorted_lzx_parallel_frame_t *frames,
+     size_t number_of_frames,
+     libcerror_error_t **error );
+
+int assorted_lzx_parallel_decompress_frames(
+     assorted_lzx_parallel_frame_t *frames,
+     size_t number_of_frames,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_lzx_parallel_decompress_task_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_lzx_parallel_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint64_t *reset_offsets,
+     size_t number_of_reset_offsets,
+     size_t reset_interval,
+     size64_t uncompressed_offset,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_LZX_PARALLEL_H ) */
+
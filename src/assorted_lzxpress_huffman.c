@@ -0,0 +1,534 @@
+/*
+ * LZXPRESS Huffman decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "assorted_huffman_tree.h"
+#include "assorted_libcerror.h"
+#include "assorted_lzxpress_huffman.h"
+
+/* Reads a 16-bit little-endian value from the compressed data
+ * Bytes beyond the end of the compressed data are read as 0, since the
+ * bit buffer is read ahead of the Huffman codes that are decoded
+ */
+#define assorted_lzxpress_huffman_read_16bit( compressed_data, compressed_data_size, compressed_data_offset, value_32bit ) \
+	if( ( compressed_data_offset + 2 ) <= compressed_data_size ) \
+	{ \
+		value_32bit = ( (uint32_t) compressed_data[ compressed_data_offset + 1 ] << 8 ) \
+		            | compressed_data[ compressed_data_offset ]; \
+	} \
+	else if( compressed_data_offset < compressed_data_size ) \
+	{ \
+		value_32bit = compressed_data[ compressed_data_offset ]; \
+	} \
+	else \
+	{ \
+		value_32bit = 0; \
+	} \
+	compressed_data_offset += 2;
+
+/* Decompresses a LZXPRESS Huffman compressed chunk
+ * A chunk consists of a table with the 4-bit code sizes of the 512 symbols followed by
+ * a bit stream of 16-bit little-endian values that decompresses into 65536 bytes,
+ * except for the last chunk. The Huffman tree is built once per chunk and can be
+ * reused for subsequent chunks.
+ * Back-references can refer to data of previous chunks hence the uncompressed data
+ * offset is relative to the start of the uncompressed data
+ * Returns 1 if the chunk was decompressed, 0 if the end of the data was reached or -1 on error
+ */
+int assorted_lzxpress_huffman_decompress_chunk(
+     assorted_huffman_tree_t *huffman_tree,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	uint8_t code_sizes[ ASSORTED_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS ];
+
+	static char *function                = "assorted_lzxpress_huffman_decompress_chunk";
+	size_t chunk_end_offset              = 0;
+	size_t safe_compressed_data_offset   = 0;
+	size_t safe_uncompressed_data_offset = 0;
+	uint32_t compression_offset          = 0;
+	uint32_t compression_size            = 0;
+	uint32_t next_bits                   = 0;
+	uint32_t value_32bit                 = 0;
+	uint16_t symbol                      = 0;
+	uint8_t code_size                    = 0;
+	uint8_t compression_offset_size      = 0;
+	int extra_bit_count                  = 0;
+	int symbol_index                     = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) ( SSIZE_MAX - 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The end of the data is reached if the uncompressed data is full
+	 * or if the compressed data has no room for another chunk
+	 */
+	if( ( safe_uncompressed_data_offset == uncompressed_data_size )
+	 || ( ( compressed_data_size - safe_compressed_data_offset ) < ( ASSORTED_LZXPRESS_HUFFMAN_TABLE_SIZE + 4 ) ) )
+	{
+		return( 0 );
+	}
+	for( symbol_index = 0;
+	     symbol_index < ASSORTED_LZXPRESS_HUFFMAN_TABLE_SIZE;
+	     symbol_index++ )
+	{
+		value_32bit = compressed_data[ safe_compressed_data_offset++ ];
+
+		code_sizes[ 2 * symbol_index ]       = (uint8_t) ( value_32bit & 0x0f );
+		code_sizes[ ( 2 * symbol_index ) + 1 ] = (uint8_t) ( value_32bit >> 4 );
+	}
+	if( assorted_huffman_tree_build(
+	     huffman_tree,
+	     code_sizes,
+	     ASSORTED_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bit buffer contains the next 32 bits, of which extra bit count bits
+	 * have not been consumed by the Huffman code that precedes them
+	 */
+	assorted_lzxpress_huffman_read_16bit(
+	 compressed_data,
+	 compressed_data_size,
+	 safe_compressed_data_offset,
+	 next_bits );
+
+	assorted_lzxpress_huffman_read_16bit(
+	 compressed_data,
+	 compressed_data_size,
+	 safe_compressed_data_offset,
+	 value_32bit );
+
+	next_bits       = ( next_bits << 16 ) | value_32bit;
+	extra_bit_count = 16;
+
+	chunk_end_offset = safe_uncompressed_data_offset + ASSORTED_LZXPRESS_HUFFMAN_CHUNK_SIZE;
+
+	if( chunk_end_offset > uncompressed_data_size )
+	{
+		chunk_end_offset = uncompressed_data_size;
+	}
+	while( safe_uncompressed_data_offset < chunk_end_offset )
+	{
+		if( safe_compressed_data_offset > ( compressed_data_size + 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compressed data too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_huffman_tree_get_symbol_from_value(
+		     huffman_tree,
+		     next_bits >> ( 32 - huffman_tree->largest_code_size ),
+		     &symbol,
+		     &code_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve symbol.",
+			 function );
+
+			return( -1 );
+		}
+		next_bits      <<= code_size;
+		extra_bit_count -= code_size;
+
+		if( extra_bit_count < 0 )
+		{
+			assorted_lzxpress_huffman_read_16bit(
+			 compressed_data,
+			 compressed_data_size,
+			 safe_compressed_data_offset,
+			 value_32bit );
+
+			next_bits       |= value_32bit << -extra_bit_count;
+			extra_bit_count += 16;
+		}
+		if( symbol < 256 )
+		{
+			uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		/* Symbol 256 at the end of the compressed data marks the end of the data
+		 */
+		if( ( symbol == 256 )
+		 && ( safe_compressed_data_offset >= compressed_data_size ) )
+		{
+			*compressed_data_offset   = compressed_data_size;
+			*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+			return( 0 );
+		}
+		symbol -= 256;
+
+		compression_size        = symbol & 0x0f;
+		compression_offset_size = (uint8_t) ( symbol >> 4 );
+
+		/* Larger match sizes are stored in the bytes that follow the 16-bit values read so far
+		 */
+		if( compression_size == 15 )
+		{
+			if( safe_compressed_data_offset >= compressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: compressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			compression_size = compressed_data[ safe_compressed_data_offset++ ];
+
+			if( compression_size == 255 )
+			{
+				if( ( safe_compressed_data_offset + 2 ) > compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ safe_compressed_data_offset ] ),
+				 compression_size );
+
+				safe_compressed_data_offset += 2;
+
+				if( compression_size == 0 )
+				{
+					if( ( safe_compressed_data_offset + 4 ) > compressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: compressed data too small.",
+						 function );
+
+						return( -1 );
+					}
+					byte_stream_copy_to_uint32_little_endian(
+					 &( compressed_data[ safe_compressed_data_offset ] ),
+					 compression_size );
+
+					safe_compressed_data_offset += 4;
+				}
+				if( ( compression_size < 15 )
+				 || ( compression_size > (uint32_t) ( SSIZE_MAX - 3 ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid compression size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				compression_size -= 15;
+			}
+			compression_size += 15;
+		}
+		compression_size += 3;
+
+		compression_offset = (uint32_t) 1 << compression_offset_size;
+
+		if( compression_offset_size > 0 )
+		{
+			compression_offset |= next_bits >> ( 32 - compression_offset_size );
+
+			next_bits      <<= compression_offset_size;
+			extra_bit_count -= compression_offset_size;
+
+			if( extra_bit_count < 0 )
+			{
+				assorted_lzxpress_huffman_read_16bit(
+				 compressed_data,
+				 compressed_data_size,
+				 safe_compressed_data_offset,
+				 value_32bit );
+
+				next_bits       |= value_32bit << -extra_bit_count;
+				extra_bit_count += 16;
+			}
+		}
+		if( (size_t) compression_offset > safe_uncompressed_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compression offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* A match can extend beyond the end of the chunk, it is truncated
+		 * at the end of the uncompressed data
+		 */
+		if( (size_t) compression_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+		{
+			compression_size = (uint32_t) ( uncompressed_data_size - safe_uncompressed_data_offset );
+		}
+		while( compression_size > 0 )
+		{
+			uncompressed_data[ safe_uncompressed_data_offset ] = uncompressed_data[ safe_uncompressed_data_offset - compression_offset ];
+
+			safe_uncompressed_data_offset++;
+			compression_size--;
+		}
+	}
+	if( safe_compressed_data_offset > compressed_data_size )
+	{
+		safe_compressed_data_offset = compressed_data_size;
+	}
+	*compressed_data_offset   = safe_compressed_data_offset;
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses LZXPRESS Huffman compressed data
+ * The Huffman tree is allocated once and rebuilt for every chunk
+ * Returns 1 on success or -1 on error
+ */
+int assorted_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	static char *function                 = "assorted_lzxpress_huffman_decompress";
+	size_t compressed_data_offset         = 0;
+	size_t uncompressed_data_offset       = 0;
+	int result                            = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_huffman_tree_initialize(
+	     &huffman_tree,
+	     ASSORTED_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS,
+	     ASSORTED_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = assorted_lzxpress_huffman_decompress_chunk(
+		          huffman_tree,
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          uncompressed_data,
+		          *uncompressed_data_size,
+		          &uncompressed_data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			goto on_error;
+		}
+	}
+	while( result == 1 );
+
+	if( assorted_huffman_tree_free(
+	     &huffman_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,73 @@
+/*
+ * LZXPRESS Huffman decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_LZXPRESS_HUFFMAN_H )
+#define _ASSORTED_LZXPRESS_HUFFMAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_huffman_tree.h"
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The uncompressed size of a LZXPRESS Huffman chunk
+ */
+#define ASSORTED_LZXPRESS_HUFFMAN_CHUNK_SIZE		65536
+
+/* The size of the Huffman code sizes table at the start of a chunk
+ */
+#define ASSORTED_LZXPRESS_HUFFMAN_TABLE_SIZE		256
+
+/* The number of symbols, 256 literals and 256 match symbols
+ */
+#define ASSORTED_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS	512
+
+/* The maximum number of bits of a Huffman code
+ */
+#define ASSORTED_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE	15
+
+int assorted_lzxpress_huffman_decompress_chunk(
+     assorted_huffman_tree_t *huffman_tree,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int assorted_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_LZXPRESS_HUFFMAN_H ) */
+
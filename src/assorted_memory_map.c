@@ -0,0 +1,575 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "assorted_libcerror.h"
+#include "assorted_memory_map.h"
+#include "assorted_unused.h"
+
+/* Creates a memory map
+ * Make sure the value memory_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_memory_map_initialize(
+     assorted_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_memory_map_initialize";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_map = memory_allocate_structure(
+	               assorted_memory_map_t );
+
+	if( *memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *memory_map,
+	     0,
+	     sizeof( assorted_memory_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory map.",
+		 function );
+
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	( *memory_map )->file_handle = INVALID_HANDLE_VALUE;
+#else
+	( *memory_map )->file_descriptor = -1;
+#endif
+	return( 1 );
+}
+
+/* Frees a memory map
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_memory_map_free(
+     assorted_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_memory_map_free";
+	int result            = 1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		if( assorted_memory_map_close(
+		     *memory_map,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close memory map.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( result );
+}
+
+/* Opens a memory map of a part of a file
+ * The mapping is read-only and the kernel is advised that the data is read sequentially,
+ * where a size of 0 represents the remainder of the file from the offset
+ * Returns 1 if successful, 0 if memory mapping is not supported or -1 on error
+ */
+int assorted_memory_map_open(
+     assorted_memory_map_t *memory_map,
+     const system_character_t *filename,
+     off64_t offset,
+     size64_t size ASSORTED_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER large_integer;
+	SYSTEM_INFO system_info;
+
+#elif defined( ASSORTED_MEMORY_MAP_HAVE_MAPPING )
+	struct stat file_statistics;
+
+#endif
+	static char *function  = "assorted_memory_map_open";
+
+#if defined( ASSORTED_MEMORY_MAP_HAVE_MAPPING )
+	size64_t file_size     = 0;
+	size64_t granularity   = 0;
+	off64_t mapping_offset = 0;
+#endif
+#if defined( ASSORTED_MEMORY_MAP_HAVE_MAPPING ) && !defined( WINAPI )
+	long page_size         = 0;
+#endif
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->mapping != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - mapping value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( ASSORTED_MEMORY_MAP_HAVE_MAPPING )
+	ASSORTED_UNREFERENCED_PARAMETER( size )
+
+	return( 0 );
+#else
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	memory_map->file_handle = CreateFileW(
+	                           (LPCWSTR) filename,
+	                           GENERIC_READ,
+	                           FILE_SHARE_READ,
+	                           NULL,
+	                           OPEN_EXISTING,
+	                           FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+	                           NULL );
+#else
+	memory_map->file_handle = CreateFileA(
+	                           (LPCSTR) filename,
+	                           GENERIC_READ,
+	                           FILE_SHARE_READ,
+	                           NULL,
+	                           OPEN_EXISTING,
+	                           FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+	                           NULL );
+#endif
+	if( memory_map->file_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( GetFileSizeEx(
+	     memory_map->file_handle,
+	     &large_integer ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	file_size = (size64_t) large_integer.QuadPart;
+
+	/* Views must start at a multiple of the allocation granularity
+	 */
+	GetSystemInfo(
+	 &system_info );
+
+	granularity = (size64_t) system_info.dwAllocationGranularity;
+#else
+	memory_map->file_descriptor = open(
+	                               (const char *) filename,
+	                               O_RDONLY );
+
+	if( memory_map->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( fstat(
+	     memory_map->file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	file_size = (size64_t) file_statistics.st_size;
+
+	/* Mappings must start at a multiple of the page size
+	 */
+	page_size = sysconf(
+	             _SC_PAGESIZE );
+
+	if( page_size <= 0 )
+	{
+		page_size = 4096;
+	}
+	granularity = (size64_t) page_size;
+#endif
+	if( (size64_t) offset >= file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( size == 0 )
+	{
+		size = file_size - (size64_t) offset;
+	}
+	if( size > ( file_size - (size64_t) offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	mapping_offset = offset - (off64_t) ( (size64_t) offset % granularity );
+
+	if( ( size + (size64_t) ( offset - mapping_offset ) ) > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	memory_map->mapping_size = (size_t) ( size + (size64_t) ( offset - mapping_offset ) );
+
+#if defined( WINAPI )
+	/* Large pages cannot be used for views of files on Windows
+	 */
+	memory_map->mapping_handle = CreateFileMapping(
+	                              memory_map->file_handle,
+	                              NULL,
+	                              PAGE_READONLY,
+	                              0,
+	                              0,
+	                              NULL );
+
+	if( memory_map->mapping_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	memory_map->mapping = MapViewOfFile(
+	                       memory_map->mapping_handle,
+	                       FILE_MAP_READ,
+	                       (DWORD) ( (uint64_t) mapping_offset >> 32 ),
+	                       (DWORD) ( (uint64_t) mapping_offset & 0xffffffffUL ),
+	                       (SIZE_T) memory_map->mapping_size );
+
+	if( memory_map->mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to map view of file.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	memory_map->mapping = mmap(
+	                       NULL,
+	                       memory_map->mapping_size,
+	                       PROT_READ,
+	                       MAP_PRIVATE,
+	                       memory_map->file_descriptor,
+	                       (off_t) mapping_offset );
+
+	if( memory_map->mapping == MAP_FAILED )
+	{
+		memory_map->mapping = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to map file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MADVISE )
+	/* The advice is a hint, hence failures are ignored, for example
+	 * huge pages are only used for files on file systems that support them
+	 */
+	madvise(
+	 memory_map->mapping,
+	 memory_map->mapping_size,
+	 MADV_SEQUENTIAL );
+
+#if defined( MADV_HUGEPAGE )
+	madvise(
+	 memory_map->mapping,
+	 memory_map->mapping_size,
+	 MADV_HUGEPAGE );
+#endif
+#endif /* defined( HAVE_MADVISE ) */
+
+#endif /* defined( WINAPI ) */
+
+	memory_map->data      = &( ( (const uint8_t *) memory_map->mapping )[ offset - mapping_offset ] );
+	memory_map->data_size = (size_t) size;
+
+	return( 1 );
+
+on_error:
+	assorted_memory_map_close(
+	 memory_map,
+	 NULL );
+
+	return( -1 );
+
+#endif /* !defined( ASSORTED_MEMORY_MAP_HAVE_MAPPING ) */
+}
+
+/* Closes a memory map
+ * Returns 0 if successful or -1 on error
+ */
+int assorted_memory_map_close(
+     assorted_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_memory_map_close";
+	int result            = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( memory_map->mapping != NULL )
+	{
+		if( UnmapViewOfFile(
+		     memory_map->mapping ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap view of file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( memory_map->mapping_handle != NULL )
+	{
+		CloseHandle(
+		 memory_map->mapping_handle );
+
+		memory_map->mapping_handle = NULL;
+	}
+	if( memory_map->file_handle != INVALID_HANDLE_VALUE )
+	{
+		if( CloseHandle(
+		     memory_map->file_handle ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		memory_map->file_handle = INVALID_HANDLE_VALUE;
+	}
+#elif defined( ASSORTED_MEMORY_MAP_HAVE_MAPPING )
+	if( memory_map->mapping != NULL )
+	{
+		if( munmap(
+		     memory_map->mapping,
+		     memory_map->mapping_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( memory_map->file_descriptor != -1 )
+	{
+		if( close(
+		     memory_map->file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		memory_map->file_descriptor = -1;
+	}
+#endif
+	memory_map->data         = NULL;
+	memory_map->data_size    = 0;
+	memory_map->mapping      = NULL;
+	memory_map->mapping_size = 0;
+
+	return( result );
+}
+
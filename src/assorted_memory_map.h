@@ -0,0 +1,104 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_MEMORY_MAP_H )
+#define _ASSORTED_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Memory mapping is supported on Windows and on POSIX systems with mmap
+ * that use narrow system strings
+ */
+#if defined( WINAPI )
+#define ASSORTED_MEMORY_MAP_HAVE_MAPPING	1
+
+#elif defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define ASSORTED_MEMORY_MAP_HAVE_MAPPING	1
+
+#endif
+
+typedef struct assorted_memory_map assorted_memory_map_t;
+
+struct assorted_memory_map
+{
+	/* The mapped data at the requested offset
+	 */
+	const uint8_t *data;
+
+	/* The size of the mapped data at the requested offset
+	 */
+	size_t data_size;
+
+	/* The start of the mapping, which is aligned to the mapping granularity
+	 */
+	void *mapping;
+
+	/* The size of the mapping
+	 */
+	size_t mapping_size;
+
+#if defined( WINAPI )
+	/* The file handle
+	 */
+	HANDLE file_handle;
+
+	/* The file mapping handle
+	 */
+	HANDLE mapping_handle;
+#else
+	/* The file descriptor
+	 */
+	int file_descriptor;
+#endif
+};
+
+int assorted_memory_map_initialize(
+     assorted_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int assorted_memory_map_free(
+     assorted_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int assorted_memory_map_open(
+     assorted_memory_map_t *memory_map,
+     const system_character_t *filename,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int assorted_memory_map_close(
+     assorted_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_MEMORY_MAP_H ) */
+
@@ -24,11 +24,140 @@
 #include <memory.h>
 #include <types.h>
 
+#include "assorted_cpu_features.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
+#include "assorted_lzxpress_huffman.h"
 #include "assorted_mssearch.h"
 
+#if defined( ASSORTED_MSSEARCH_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_MSSEARCH_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
+/* Determines the SIMD method supported by the CPU
+ * Returns the SIMD method
+ */
+int assorted_mssearch_get_simd_method(
+     void )
+{
+#if defined( ASSORTED_MSSEARCH_HAVE_AVX2 ) || defined( ASSORTED_MSSEARCH_HAVE_NEON )
+	uint32_t cpu_features = 0;
+#endif
+	int simd_method       = ASSORTED_MSSEARCH_SIMD_METHOD_NONE;
+
+#if defined( ASSORTED_MSSEARCH_HAVE_AVX2 )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		simd_method = ASSORTED_MSSEARCH_SIMD_METHOD_AVX2;
+	}
+#elif defined( ASSORTED_MSSEARCH_HAVE_NEON )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_NEON ) != 0 )
+	{
+		simd_method = ASSORTED_MSSEARCH_SIMD_METHOD_NEON;
+	}
+#endif
+	return( simd_method );
+}
+
+/* The key stream byte at offset N is byte N % 4 of the 32-bit little-endian
+ * bitmask XOR the lower 8 bits of N. Since the lower 8 bits of the offsets of
+ * a vector that starts at a multiple of its size do not overflow, the key
+ * stream of a vector is the broadcasted bitmask XOR a vector of byte offsets,
+ * which is advanced by adding the vector size to every byte.
+ */
+
+#if defined( ASSORTED_MSSEARCH_HAVE_AVX2 )
+
+/* Decodes data using AVX2, 64 bytes per iteration
+ * The size must be a multiple of 64, the data and encoded data can be the same buffer
+ */
+__attribute__ ((target ("avx2"))) void assorted_mssearch_decode_simd_avx2(
+                                        uint8_t *data,
+                                        const uint8_t *encoded_data,
+                                        size_t size,
+                                        uint32_t bitmask32 )
+{
+	__m256i bitmask_256bit   = _mm256_set1_epi32( (int) bitmask32 );
+	__m256i increment_256bit = _mm256_set1_epi8( 64 );
+	__m256i offsets_256bit1  = _mm256_setr_epi8(
+	                            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	                            16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31 );
+	__m256i offsets_256bit2  = _mm256_add_epi8( offsets_256bit1, _mm256_set1_epi8( 32 ) );
+	__m256i value_256bit1;
+	__m256i value_256bit2;
+
+	while( size > 0 )
+	{
+		value_256bit1 = _mm256_loadu_si256( (const __m256i *) encoded_data );
+		value_256bit2 = _mm256_loadu_si256( (const __m256i *) &( encoded_data[ 32 ] ) );
+
+		value_256bit1 = _mm256_xor_si256( value_256bit1, _mm256_xor_si256( bitmask_256bit, offsets_256bit1 ) );
+		value_256bit2 = _mm256_xor_si256( value_256bit2, _mm256_xor_si256( bitmask_256bit, offsets_256bit2 ) );
+
+		_mm256_storeu_si256( (__m256i *) data, value_256bit1 );
+		_mm256_storeu_si256( (__m256i *) &( data[ 32 ] ), value_256bit2 );
+
+		offsets_256bit1 = _mm256_add_epi8( offsets_256bit1, increment_256bit );
+		offsets_256bit2 = _mm256_add_epi8( offsets_256bit2, increment_256bit );
+
+		data         += 64;
+		encoded_data += 64;
+		size         -= 64;
+	}
+}
+
+#endif /* defined( ASSORTED_MSSEARCH_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_MSSEARCH_HAVE_NEON )
+
+/* Decodes data using NEON, 64 bytes per iteration
+ * The size must be a multiple of 64, the data and encoded data can be the same buffer
+ */
+void assorted_mssearch_decode_simd_neon(
+      uint8_t *data,
+      const uint8_t *encoded_data,
+      size_t size,
+      uint32_t bitmask32 )
+{
+	static const uint8_t offsets[ 16 ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+	uint8x16_t bitmask_128bit   = vreinterpretq_u8_u32( vdupq_n_u32( bitmask32 ) );
+	uint8x16_t increment_128bit = vdupq_n_u8( 64 );
+	uint8x16_t offsets_128bit1  = vld1q_u8( offsets );
+	uint8x16_t offsets_128bit2  = vaddq_u8( offsets_128bit1, vdupq_n_u8( 16 ) );
+	uint8x16_t offsets_128bit3  = vaddq_u8( offsets_128bit1, vdupq_n_u8( 32 ) );
+	uint8x16_t offsets_128bit4  = vaddq_u8( offsets_128bit1, vdupq_n_u8( 48 ) );
+
+	while( size > 0 )
+	{
+		vst1q_u8( data, veorq_u8( vld1q_u8( encoded_data ), veorq_u8( bitmask_128bit, offsets_128bit1 ) ) );
+		vst1q_u8( &( data[ 16 ] ), veorq_u8( vld1q_u8( &( encoded_data[ 16 ] ) ), veorq_u8( bitmask_128bit, offsets_128bit2 ) ) );
+		vst1q_u8( &( data[ 32 ] ), veorq_u8( vld1q_u8( &( encoded_data[ 32 ] ) ), veorq_u8( bitmask_128bit, offsets_128bit3 ) ) );
+		vst1q_u8( &( data[ 48 ] ), veorq_u8( vld1q_u8( &( encoded_data[ 48 ] ) ), veorq_u8( bitmask_128bit, offsets_128bit4 ) ) );
+
+		offsets_128bit1 = vaddq_u8( offsets_128bit1, increment_128bit );
+		offsets_128bit2 = vaddq_u8( offsets_128bit2, increment_128bit );
+		offsets_128bit3 = vaddq_u8( offsets_128bit3, increment_128bit );
+		offsets_128bit4 = vaddq_u8( offsets_128bit4, increment_128bit );
+
+		data         += 64;
+		encoded_data += 64;
+		size         -= 64;
+	}
+}
+
+#endif /* defined( ASSORTED_MSSEARCH_HAVE_NEON ) */
+
 /* Decode data using Windows Search encoding
+ * The data and encoded data can be the same buffer to decode in place
  * Returns 1 on success or -1 on error
  */
 int assorted_mssearch_decode(
@@ -38,12 +167,30 @@ int assorted_mssearch_decode(
      size_t encoded_data_size,
      libcerror_error_t **error )
 {
-	static char *function        = "assorted_mssearch_decode";
-	size_t data_iterator         = 0;
-	size_t encoded_data_iterator = 0;
-	uint32_t bitmask32           = 0;
-	uint8_t bitmask              = 0;
+	static char *function = "assorted_mssearch_decode";
+	size_t data_offset    = 0;
+	uint64_t bitmask64    = 0;
+	uint64_t offsets64    = 0;
+	uint64_t value_64bit  = 0;
+	uint32_t bitmask32    = 0;
+	uint8_t bitmask       = 0;
+
+#if defined( ASSORTED_MSSEARCH_HAVE_AVX2 ) || defined( ASSORTED_MSSEARCH_HAVE_NEON )
+	size_t simd_data_size = 0;
+	int simd_method       = 0;
+#endif
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
+		return( -1 );
+	}
 	if( encoded_data == NULL )
 	{
 		libcerror_error_set(
@@ -79,29 +226,99 @@ int assorted_mssearch_decode(
 	}
 	bitmask32 = 0x05000113 ^ (uint32_t) encoded_data_size;
 
-	for( encoded_data_iterator = 0;
-	     encoded_data_iterator < encoded_data_size;
-	     encoded_data_iterator++ )
+#if defined( ASSORTED_MSSEARCH_HAVE_AVX2 ) || defined( ASSORTED_MSSEARCH_HAVE_NEON )
+	simd_data_size = encoded_data_size - ( encoded_data_size % ASSORTED_MSSEARCH_SIMD_BLOCK_SIZE );
+
+	if( simd_data_size > 0 )
 	{
-		switch( encoded_data_iterator & 0x03 )
+		simd_method = assorted_mssearch_get_simd_method();
+
+#if defined( ASSORTED_MSSEARCH_HAVE_AVX2 )
+		if( simd_method == ASSORTED_MSSEARCH_SIMD_METHOD_AVX2 )
 		{
-			case 3:
-				bitmask = (uint8_t) ( ( bitmask32 >> 24 ) & 0xff );
-				break;
-			case 2:
-				bitmask = (uint8_t) ( ( bitmask32 >> 16 ) & 0xff );
-				break;
-			case 1:
-				bitmask = (uint8_t) ( ( bitmask32 >> 8 ) & 0xff );
-				break;
-			default:
-				bitmask = (uint8_t) ( bitmask32 & 0xff );
-				break;
+			assorted_mssearch_decode_simd_avx2(
+			 data,
+			 encoded_data,
+			 simd_data_size,
+			 bitmask32 );
+		}
+#endif
+#if defined( ASSORTED_MSSEARCH_HAVE_NEON )
+		if( simd_method == ASSORTED_MSSEARCH_SIMD_METHOD_NEON )
+		{
+			assorted_mssearch_decode_simd_neon(
+			 data,
+			 encoded_data,
+			 simd_data_size,
+			 bitmask32 );
 		}
-		bitmask ^= encoded_data_iterator;
+#endif
+		if( simd_method != ASSORTED_MSSEARCH_SIMD_METHOD_NONE )
+		{
+			data_offset = simd_data_size;
+		}
+	}
+#endif /* defined( ASSORTED_MSSEARCH_HAVE_AVX2 ) || defined( ASSORTED_MSSEARCH_HAVE_NEON ) */
 
-		data[ data_iterator++ ] = encoded_data[ encoded_data_iterator ]
-		                        ^ bitmask;
+	/* Decode 8 bytes at a time, the key stream of the 8 bytes is the bitmask
+	 * repeated twice XOR the lower 8 bits of the offsets of the bytes
+	 */
+	bitmask64 = ( (uint64_t) bitmask32 << 32 ) | bitmask32;
+
+	while( ( data_offset + 8 ) <= encoded_data_size )
+	{
+		offsets64 = ( (uint64_t) ( data_offset & 0xff ) * 0x0101010101010101ULL ) + 0x0706050403020100ULL;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( encoded_data[ data_offset ] ),
+		 value_64bit );
+
+		value_64bit ^= bitmask64 ^ offsets64;
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		data_offset += 8;
+	}
+	while( data_offset < encoded_data_size )
+	{
+		bitmask = (uint8_t) ( ( bitmask32 >> ( ( data_offset & 0x03 ) * 8 ) ) & 0xff );
+
+		bitmask ^= (uint8_t) ( data_offset & 0xff );
+
+		data[ data_offset ] = encoded_data[ data_offset ] ^ bitmask;
+
+		data_offset++;
+	}
+	return( 1 );
+}
+
+/* Decode data in place using Windows Search encoding
+ * Returns 1 on success or -1 on error
+ */
+int assorted_mssearch_decode_in_place(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_mssearch_decode_in_place";
+
+	if( assorted_mssearch_decode(
+	     data,
+	     data_size,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode data.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
@@ -342,17 +559,19 @@ int assorted_mssearch_decompress_run_length_compressed_utf16_string(
 	return( 1 );
 }
 
-/* Determines the uncompressed data size of a run-length compressed UTF-16 string
+/* Determines the maximum UTF-8 string size of a run-length compressed UTF-16 string
+ * Every compressed byte contributes at most 1 UTF-16 character, which is at most
+ * 3 bytes in UTF-8 since a surrogate pair of 2 characters is 4 bytes in UTF-8
+ * The size includes the end-of-string character
  * Returns 1 on success or -1 on error
  */
-int assorted_mssearch_get_byte_index_uncompressed_data_size(
-     uint8_t *compressed_data,
+int assorted_mssearch_get_run_length_utf8_string_size(
+     const uint8_t *compressed_data,
      size_t compressed_data_size,
-     size_t *uncompressed_data_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function                  = "assorted_mssearch_get_byte_index_uncompressed_size";
-	uint16_t stored_uncompressed_data_size = 0;
+	static char *function = "assorted_mssearch_get_run_length_utf8_string_size";
 
 	if( compressed_data == NULL )
 	{
@@ -365,7 +584,7 @@ int assorted_mssearch_get_byte_index_uncompressed_data_size(
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( compressed_data_size > ( ( (size_t) SSIZE_MAX - 1 ) / 3 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -376,86 +595,118 @@ int assorted_mssearch_get_byte_index_uncompressed_data_size(
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-	/* The first 2 bytes contain the uncompressed data size
-	 */
-	byte_stream_copy_to_uint16_little_endian(
-	 compressed_data,
-	 stored_uncompressed_data_size );
-
-	*uncompressed_data_size = (size_t) stored_uncompressed_data_size;
+	*utf8_string_size = ( compressed_data_size * 3 ) + 1;
 
 	return( 1 );
 }
 
-/* Decompresses byte-index compressed data
+/* Copies an Unicode character to an UTF-8 string
  * Returns 1 on success or -1 on error
  */
-int assorted_mssearch_decompress_byte_indexed_compressed_data(
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     libcerror_error_t **error )
+static int assorted_mssearch_copy_unicode_character_to_utf8(
+            uint32_t unicode_character,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            size_t *utf8_string_index,
+            libcerror_error_t **error )
 {
-	uint16_t compression_value_table[ 2048 ];
-
-	uint32_t nibble_count_table[ 16 ]       = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-	uint32_t total_nibble_count_table[ 16 ] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-
-	static char *function                   = "assorted_mssearch_decompress_byte_indexed_compressed_data";
-	size_t compressed_data_iterator         = 0;
-	size_t compression_iterator             = 0;
-	size_t uncompressed_data_iterator       = 0;
-
-	uint32_t compressed_data_bit_stream     = 0;
-	uint32_t compression_offset             = 0;
-	uint32_t nibble_count                   = 0;
-	uint32_t total_nibble_count             = 0;
-	uint32_t value_32bit                    = 0;
-	int32_t compression_value_table_index   = 0;
-	uint16_t compression_size               = 0;
-	uint16_t compression_value              = 0;
-	uint16_t stored_uncompressed_data_size  = 0;
-	uint16_t value_0x0400                   = 0;
-	uint16_t value_0x0800                   = 0;
-	uint16_t value_0x2000                   = 0;
-	uint8_t nibble_count_table_index        = 0;
-	int8_t number_of_bits_available         = 0;
-	int8_t number_of_bits_used              = 0;
+	static char *function         = "assorted_mssearch_copy_unicode_character_to_utf8";
+	size_t safe_utf8_string_index = *utf8_string_index;
+	size_t utf8_character_size    = 1;
 
-	if( uncompressed_data == NULL )
+	if( unicode_character >= 0x00010000UL )
+	{
+		utf8_character_size = 4;
+	}
+	else if( unicode_character >= 0x00000800UL )
+	{
+		utf8_character_size = 3;
+	}
+	else if( unicode_character >= 0x00000080UL )
+	{
+		utf8_character_size = 2;
+	}
+	/* Keep room for the end-of-string character
+	 */
+	if( utf8_character_size >= ( utf8_string_size - safe_utf8_string_index ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	switch( utf8_character_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
-		 function );
+		case 4:
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			break;
 
-		return( -1 );
+		case 3:
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			break;
+
+		case 2:
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+			break;
+
+		default:
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) unicode_character;
+			break;
 	}
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Decompresses a run-length compressed UTF-16 string directly into an UTF-8 string
+ * The run-length compression is expanded and the UTF-16 characters are converted
+ * to UTF-8 in a single pass. Runs of ASCII characters, which have an upper byte
+ * of 0, are copied 8 bytes at a time.
+ * Unpaired surrogates are replaced by U+FFFD, except for a high surrogate at the end
+ * of a cut-off string which is ignored. The string is terminated at the first
+ * NUL character.
+ * On input utf8_string_size contains the size of the UTF-8 string buffer,
+ * on output it contains the size of the UTF-8 string including the end-of-string character
+ * Returns 1 on success or -1 on error
+ */
+int assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8";
+	size_t compressed_data_offset = 0;
+	size_t safe_utf8_string_size  = 0;
+	size_t utf8_string_index      = 0;
+	uint64_t value_64bit          = 0;
+	uint32_t high_surrogate       = 0;
+	uint32_t unicode_character    = 0;
+	uint8_t compression_byte      = 0;
+	uint8_t compression_size      = 0;
+
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -478,591 +729,456 @@ int assorted_mssearch_decompress_byte_indexed_compressed_data(
 
 		return( -1 );
 	}
-	if( compressed_data_size <= 1 )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_set(
-	     compression_value_table,
-	     0,
-	     2048 * 2 ) == NULL )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear compression value table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: compressed data header:\n",
-		 function );
-		libcnotify_print_data(
-		 compressed_data,
-		 258,
-		 0 );
-	}
-#endif
-	/* Byte 0 - 1 contain the uncompressed data size
-	 */
-	byte_stream_copy_to_uint16_little_endian(
-	 compressed_data,
-	 stored_uncompressed_data_size );
+	safe_utf8_string_size = *utf8_string_size;
 
-	if( uncompressed_data_size < stored_uncompressed_data_size )
+	if( ( safe_utf8_string_size == 0 )
+	 || ( safe_utf8_string_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: uncompressed data size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	/* Byte 2 - 257 contain the compression table
-	 *
-	 * The table contains a compression value for every byte
-	 * bits 0 - 3 contain ???
-	 * bits 4 - 7 contain the number of bits used to store the compressed data
-	 */
-	for( compressed_data_iterator = 0;
-	     compressed_data_iterator < 256;
-	     compressed_data_iterator++ )
+	while( compressed_data_offset < compressed_data_size )
 	{
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ];
+		compression_size = compressed_data[ compressed_data_offset++ ];
 
-		nibble_count_table[ nibble_count_table_index & 0x0f ] += 1;
-		nibble_count_table[ nibble_count_table_index >> 4 ]   += 1;
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: uncompressed data size:\t%" PRIu16 "\n",
-		 function,
-		 stored_uncompressed_data_size );
+		/* Check if the last byte in the compressed string was the compression size
+		 * or the run-length byte value
+		 */
+		if( ( compressed_data_offset + 1 ) >= compressed_data_size )
+		{
+			break;
+		}
+		/* Check if the compressed string was cut-short at the end
+		 */
+		if( ( compressed_data_offset + 1 + compression_size ) > compressed_data_size )
+		{
+			compression_size = (uint8_t) ( compressed_data_size - compressed_data_offset - 1 );
+		}
+		compression_byte = compressed_data[ compressed_data_offset++ ];
+
+		/* The characters of a run with an upper byte of 0 are ASCII when the lower
+		 * byte is less than 0x80. Copy 8 of them at a time while none of the lower
+		 * bytes has the most significant bit set or is 0, where a byte that is 0
+		 * sets the most significant bit of the byte minus 1.
+		 */
+		if( ( compression_byte == 0 )
+		 && ( high_surrogate == 0 ) )
+		{
+			while( ( compression_size >= 8 )
+			    && ( ( safe_utf8_string_size - utf8_string_index ) > 8 ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( compressed_data[ compressed_data_offset ] ),
+				 value_64bit );
 
-		for( nibble_count_table_index = 0;
-		     nibble_count_table_index < 16;
-		     nibble_count_table_index++ )
+				if( ( ( value_64bit | ( value_64bit - 0x0101010101010101ULL ) ) & 0x8080808080808080ULL ) != 0 )
+				{
+					break;
+				}
+				byte_stream_copy_from_uint64_little_endian(
+				 &( utf8_string[ utf8_string_index ] ),
+				 value_64bit );
+
+				compressed_data_offset += 8;
+				utf8_string_index      += 8;
+				compression_size       -= 8;
+			}
+		}
+		while( compression_size > 0 )
 		{
-			libcnotify_printf(
-			 "%s: nibble count table index: %02d value:\t\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-			 function,
-			 nibble_count_table_index,
-			 nibble_count_table[ nibble_count_table_index ],
-			 nibble_count_table[ nibble_count_table_index ] );
+			unicode_character = ( (uint32_t) compression_byte << 8 ) | compressed_data[ compressed_data_offset++ ];
+
+			compression_size--;
+
+			if( unicode_character == 0 )
+			{
+				compressed_data_offset = compressed_data_size;
+				high_surrogate         = 0;
+
+				break;
+			}
+			if( high_surrogate != 0 )
+			{
+				if( ( unicode_character >= 0xdc00 )
+				 && ( unicode_character <= 0xdfff ) )
+				{
+					unicode_character = 0x00010000UL + ( ( high_surrogate - 0xd800 ) << 10 ) + ( unicode_character - 0xdc00 );
+					high_surrogate    = 0;
+				}
+				else
+				{
+					high_surrogate = 0;
+
+					if( assorted_mssearch_copy_unicode_character_to_utf8(
+					     0xfffd,
+					     utf8_string,
+					     safe_utf8_string_size,
+					     &utf8_string_index,
+					     error ) != 1 )
+					{
+						return( -1 );
+					}
+				}
+			}
+			if( ( unicode_character >= 0xd800 )
+			 && ( unicode_character <= 0xdbff ) )
+			{
+				high_surrogate = unicode_character;
+
+				continue;
+			}
+			else if( ( unicode_character >= 0xdc00 )
+			      && ( unicode_character <= 0xdfff ) )
+			{
+				unicode_character = 0xfffd;
+			}
+			if( assorted_mssearch_copy_unicode_character_to_utf8(
+			     unicode_character,
+			     utf8_string,
+			     safe_utf8_string_size,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
 		}
-		libcnotify_printf(
-		 "\n" );
 	}
-#endif
-	if( nibble_count_table[ 0 ] >= 0x01ff )
+	utf8_string[ utf8_string_index++ ] = 0;
+
+	*utf8_string_size = utf8_string_index;
+
+	return( 1 );
+}
+
+/* Decompresses a run-length compressed UTF-16 string directly into an UTF-16 string
+ * The string is terminated at the first NUL character and a high surrogate at
+ * the end of a cut-off string is ignored
+ * On input utf16_string_size contains the number of characters in the UTF-16 string buffer,
+ * which needs to be at least the compressed data size + 1, on output it contains
+ * the size of the UTF-16 string including the end-of-string character
+ * Returns 1 on success or -1 on error
+ */
+int assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16";
+	size_t compressed_data_offset = 0;
+	size_t utf16_string_index     = 0;
+	uint16_t compression_value    = 0;
+	uint16_t utf16_character      = 0;
+	uint8_t compression_size      = 0;
+
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: first nibble count table entry value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	/* Make copy of the nibble count table
-	 */
-	for( nibble_count_table_index = 0;
-	     nibble_count_table_index < 16;
-	     nibble_count_table_index++ )
-	{
-		total_nibble_count_table[ nibble_count_table_index ] = nibble_count_table[ nibble_count_table_index ];
-	}
-	/* TODO why this loop */
-	nibble_count = 0;
-
-	for( nibble_count_table_index = 15;
-	     nibble_count_table_index > 0;
-	     nibble_count_table_index-- )
+	if( compressed_data_size > (size_t) SSIZE_MAX )
 	{
-		nibble_count += total_nibble_count_table[ nibble_count_table_index ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
 
-		if( nibble_count == 1 )
-		{
-			break;
-		}
-		nibble_count >>= 1;
+		return( -1 );
 	}
-	if( nibble_count != 1 )
+	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: nibble count value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	/* Determine the total nible counts
-	 */
-	nibble_count = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: total nibble count table index: %02d value:\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-		 function,
-		 0,
-		 total_nibble_count_table[ 0 ],
-		 total_nibble_count_table[ 0 ] );
-	}
-#endif
-
-	for( nibble_count_table_index = 1;
-	     nibble_count_table_index < 16;
-	     nibble_count_table_index++ )
+	if( utf16_string_size == NULL )
 	{
-		total_nibble_count_table[ nibble_count_table_index ] += nibble_count;
-		nibble_count                                          = total_nibble_count_table[ nibble_count_table_index ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: total nibble count table index: %02d value:\t0x%08" PRIx32 " (%" PRIu32 ")\n",
-			 function,
-			 nibble_count_table_index,
-			 total_nibble_count_table[ nibble_count_table_index ],
-			 total_nibble_count_table[ nibble_count_table_index ] );
-		}
-#endif
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( *utf16_string_size <= compressed_data_size )
 	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-
-	total_nibble_count = nibble_count;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-16 string size value too small.",
+		 function );
 
-	/* Fill the compression value table
+		return( -1 );
+	}
+	/* Every compressed byte contributes at most 1 character, hence no bounds
+	 * checks are needed on the UTF-16 string
 	 */
-	value_0x2000 = 0x2000;
-
-	while( value_0x2000 > 0 )
+	while( compressed_data_offset < compressed_data_size )
 	{
-		value_0x2000 -= 0x10;
-
-		compressed_data_iterator = value_0x2000 >> 5;
+		compression_size = compressed_data[ compressed_data_offset++ ];
 
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ] >> 4;
+		if( ( compressed_data_offset + 1 ) >= compressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_offset + 1 + compression_size ) > compressed_data_size )
+		{
+			compression_size = (uint8_t) ( compressed_data_size - compressed_data_offset - 1 );
+		}
+		compression_value = (uint16_t) compressed_data[ compressed_data_offset++ ] << 8;
 
-		if( nibble_count_table_index > 0 )
+		while( compression_size > 0 )
 		{
-			total_nibble_count_table[ nibble_count_table_index ] -= 1;
-			compression_value_table_index                         = total_nibble_count_table[ nibble_count_table_index ];
+			utf16_character = compression_value | compressed_data[ compressed_data_offset++ ];
 
-			if( compression_value_table_index > 2048 )
+			if( utf16_character == 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression value table index value exceeds maximum.",
-				 function );
+				compressed_data_offset = compressed_data_size;
 
-				return( -1 );
+				break;
 			}
-			compression_value_table[ compression_value_table_index ] = value_0x2000 | nibble_count_table_index;
+			utf16_string[ utf16_string_index++ ] = utf16_character;
+
+			compression_size--;
 		}
-		value_0x2000 -= 0x10;
+	}
+	if( ( utf16_string_index > 0 )
+	 && ( utf16_string[ utf16_string_index - 1 ] >= 0xd800 )
+	 && ( utf16_string[ utf16_string_index - 1 ] <= 0xdbff ) )
+	{
+		utf16_string_index--;
+	}
+	utf16_string[ utf16_string_index++ ] = 0;
 
-		compressed_data_iterator = value_0x2000 >> 5;
+	*utf16_string_size = utf16_string_index;
 
-		nibble_count_table_index = compressed_data[ 2 + compressed_data_iterator ] & 0x0f;
+	return( 1 );
+}
 
-		if( nibble_count_table_index > 0 )
-		{
-			total_nibble_count_table[ nibble_count_table_index ] -= 1;
-			compression_value_table_index                         = total_nibble_count_table[ nibble_count_table_index ];
+/* Determines the uncompressed data size of a run-length compressed UTF-16 string
+ * Returns 1 on success or -1 on error
+ */
+int assorted_mssearch_get_byte_index_uncompressed_data_size(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                  = "assorted_mssearch_get_byte_index_uncompressed_size";
+	uint16_t stored_uncompressed_data_size = 0;
 
-			if( compression_value_table_index > 2048 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression value table index value exceeds maximum.",
-				 function );
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
 
-				return( -1 );
-			}
-			compression_value_table[ compression_value_table_index ] = value_0x2000 | nibble_count_table_index;
-		}
+		return( -1 );
 	}
-	compression_value_table_index = 0x0800;
-	value_0x0800                  = 0x0800;
-	value_0x0400                  = 0x0400;
-
-	if( total_nibble_count > 2048 )
+	if( compressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: total nibble count value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	for( nibble_count_table_index = 15;
-	     nibble_count_table_index > 10;
-	     nibble_count_table_index-- )
+	if( uncompressed_data_size == NULL )
 	{
-		if( value_0x0800 > compression_value_table_index )
-		{
-			value_0x0800                  -= 2;
-			compression_value_table_index -= 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
 
-			compression_value_table[ compression_value_table_index ] = value_0x0800 | 0x8000;
-		}
-		for( nibble_count = nibble_count_table[ nibble_count_table_index ];
-		     nibble_count > 0;
-		     nibble_count-- )
-		{
-			total_nibble_count -= 1;
+		return( -1 );
+	}
+	/* The first 2 bytes contain the uncompressed data size
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 compressed_data,
+	 stored_uncompressed_data_size );
+
+	*uncompressed_data_size = (size_t) stored_uncompressed_data_size;
 
-			compression_value              = compression_value_table[ total_nibble_count ];
-			compression_value_table_index -= 1;
+	return( 1 );
+}
 
-			compression_value_table[ compression_value_table_index ] = compression_value;
-		}
-	}
-	while( value_0x0800 > compression_value_table_index )
+/* Decompresses byte-index compressed data in a single pass
+ * The byte-index compressed data consists of a 16-bit little-endian uncompressed data size
+ * followed by a single LZXPRESS Huffman chunk, which is decoded using the table-driven
+ * Huffman decoder
+ * On input uncompressed_data_size contains the size of the uncompressed data buffer,
+ * which must be at least the stored uncompressed data size, on output it contains
+ * the actual size of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_mssearch_decompress_byte_indexed(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                  = "assorted_mssearch_decompress_byte_indexed";
+	size_t safe_uncompressed_data_size     = 0;
+	uint16_t stored_uncompressed_data_size = 0;
+
+	if( compressed_data == NULL )
 	{
-		value_0x0800 -= 2;
-		value_0x0400 -= 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
 
-		compression_value_table[ value_0x0400 ] = value_0x0800 | 0x8000;
+		return( -1 );
 	}
-	while( total_nibble_count > 0 )
+	if( compressed_data_size > (size_t) SSIZE_MAX )
 	{
-		total_nibble_count -= 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
 
-		compression_value             = compression_value_table[ total_nibble_count ];
-		compression_value_table_index = value_0x0400 - ( 0x0400 >> ( compression_value & 0x0f ) );
+		return( -1 );
+	}
+	if( compressed_data_size < ( 2 + ASSORTED_LZXPRESS_HUFFMAN_TABLE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
 
-		do
-		{
-			value_0x0400 -= 1;
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
 
-			compression_value_table[ value_0x0400 ] = compression_value;
-		}
-		while( value_0x0400 > compression_value_table_index );
+		return( -1 );
 	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
-		libcnotify_printf(
-		 "%s: compression value table:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
-		libcnotify_print_data(
-		 (uint8_t *) compression_value_table,
-		 2 * 2048,
-		 0 );
+
+		return( -1 );
 	}
-#endif
-	/* Byte 258 - end contain the compression data bit stream
+	/* Byte 0 - 1 contain the uncompressed data size
 	 */
-	compressed_data_iterator = 2 + 0x100;
+	byte_stream_copy_to_uint16_little_endian(
+	 compressed_data,
+	 stored_uncompressed_data_size );
 
-	if( ( compressed_data_iterator + 3 ) >= compressed_data_size )
+	if( *uncompressed_data_size < (size_t) stored_uncompressed_data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data size value too small.",
+		 "%s: uncompressed data size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	/* Read the data as 16-bit little endian values
+	/* Byte 2 - 257 contain the Huffman code sizes of the 512 symbols
+	 * and byte 258 - end the compressed data bit stream
 	 */
-	compressed_data_bit_stream   = compressed_data[ compressed_data_iterator + 1 ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator + 3 ];
-	compressed_data_bit_stream <<= 8;
-	compressed_data_bit_stream  += compressed_data[ compressed_data_iterator + 2 ];
-
-	compressed_data_iterator += 4;
-
-	number_of_bits_available = 0x10;
-
-	/* The compression data is stored a 16-bit little-endian values
-	 * it contains a bit stream which contains the following values
-	 * starting with the first bit in the stream
-	 * 0 - 9 compression value table index (where 0 is the MSB of the value)
-	 */
-	while( compressed_data_iterator < compressed_data_size )
+	safe_uncompressed_data_size = (size_t) stored_uncompressed_data_size;
+
+	if( assorted_lzxpress_huffman_decompress(
+	     &( compressed_data[ 2 ] ),
+	     compressed_data_size - 2,
+	     uncompressed_data,
+	     &safe_uncompressed_data_size,
+	     error ) != 1 )
 	{
-		/* Read a 10-bit table index from the decoded data
-		 * maximum index of 1023
-		 */
-		compression_value_table_index = compressed_data_bit_stream >> 0x16;
-
-		/* Check if the table entry contains an ignore index flag (bit 15)
-		 */
-		if( ( compression_value_table[ compression_value_table_index ] & 0x8000 ) != 0 )
-		{
-			/* Ignore the 10-bit index
-			 */
-			compressed_data_bit_stream <<= 10;
-
-			do
-			{
-				compression_value_table_index = compression_value_table[ compression_value_table_index ] & 0x7fff;
-
-				/* Add the MSB of the compressed data bit stream to the
-				 * compression value table index
-				 */
-				compression_value_table_index += compressed_data_bit_stream >> 31;
-
-				/* Ignore 1 bit for empty compression values
-				 */
-				compressed_data_bit_stream <<= 1;
-
-				if( compression_value_table_index > 2048 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: compression value table index value exceeds maximum.",
-					 function );
-
-					return( -1 );
-				}
-			}
-			while( compression_value_table[ compression_value_table_index ] == 0 );
-
-			/* Retrieve the number of bits used (lower 4-bit) of from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( compression_value_table[ compression_value_table_index ] & 0x0f );
-
-			/* Retrieve the compression value from the table entry
-			 */
-			compression_value = compression_value_table[ compression_value_table_index ] >> 4;
-
-			number_of_bits_available -= number_of_bits_used;
-		}
-		else
-		{
-			/* Retrieve the number of bits used (lower 4-bit) of from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( compression_value_table[ compression_value_table_index ] & 0x0f );
-
-			/* Retrieve the compression value from the table entry
-			 */
-			compression_value = compression_value_table[ compression_value_table_index ] >> 4;
-
-			number_of_bits_available    -= number_of_bits_used;
-			compressed_data_bit_stream <<= number_of_bits_used;
-		}
-		if( number_of_bits_available < 0 )
-		{
-			number_of_bits_used = -1 * number_of_bits_available;
-
-			if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: compressed data size value too small.",
-				 function );
-
-				return( -1 );
-			}
-			/* Read the data as 16-bit little endian values
-			 */
-			value_32bit   = compressed_data[ compressed_data_iterator + 1 ];
-			value_32bit <<= 8;
-			value_32bit  += compressed_data[ compressed_data_iterator ];
-
-			compressed_data_iterator += 2;
-
-			value_32bit               <<= number_of_bits_used;
-			compressed_data_bit_stream += value_32bit;
-
-			number_of_bits_available += 0x10;
-		}
-		/* Check if the table entry contains a compression tuple flag (bit 12)
-		 */
-		if( ( compression_value_table[ compression_value_table_index ] & 0x1000 ) != 0 )
-		{
-			/* Retrieve the size of the compression (bit 4-7) from the table entry
-			 */
-			compression_size = (uint16_t) ( ( compression_value_table[ compression_value_table_index ] >> 4 ) & 0x0f );
-
-			/* Retrieve the size of the compression (bit 8-11) from the table entry
-			 */
-			number_of_bits_used = (int8_t) ( ( compression_value_table[ compression_value_table_index ] >> 8 ) & 0x0f );
-
-			/* Break if the end of the compressed data is reached
-			 * and both the compression size and number of bits used for the compression offset are 0
-			 */
-			if( ( compressed_data_iterator == compressed_data_size )
-			 && ( compression_size == 0 )
-			 && ( number_of_bits_used == 0 ) )
-			{
-				break;
-			}
-			/* Retrieve the compression offset from the decoded data
-			 */
-			compression_offset = ( compressed_data_bit_stream >> 1 ) | 0x80000000;
-
-			compression_offset = ( compression_offset >> ( 31 - number_of_bits_used ) );
-
-			compressed_data_bit_stream <<= number_of_bits_used;
-			number_of_bits_available    -= number_of_bits_used;
-
-			if( compression_size == 0x0f )
-			{
-				if( compressed_data_iterator >= compressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				compression_size += compressed_data[ compressed_data_iterator ];
-
-				compressed_data_iterator += 1;
-			}
-			if( compression_size == ( 0xff + 0x0f ) )
-			{
-				if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				byte_stream_copy_to_uint16_little_endian(
-				 &( compressed_data[ compressed_data_iterator ] ),
-				 compression_size );
-
-				compressed_data_iterator += 2;
-
-				if( compression_size < ( 0xff + 0x0f ) )
-				{
-					/* TODO error */
-					return( -1 );
-				}
-			}
-			compression_size += 3;
-
-			if( number_of_bits_available < 0 )
-			{
-				number_of_bits_used = -1 * number_of_bits_available;
-
-				if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data size value too small.",
-					 function );
-
-					return( -1 );
-				}
-				/* Read the data as 16-bit little endian values
-				 */
-				value_32bit   = compressed_data[ compressed_data_iterator + 1 ];
-				value_32bit <<= 8;
-				value_32bit  += compressed_data[ compressed_data_iterator ];
-
-				compressed_data_iterator += 2;
-
-				value_32bit               <<= number_of_bits_used;
-				compressed_data_bit_stream += value_32bit;
-
-				number_of_bits_available += 0x10;
-			}
-			if( ( uncompressed_data_iterator + compression_size ) > uncompressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data size value too small.",
-				 function );
-
-				return( -1 );
-			}
-			if( compression_offset > uncompressed_data_iterator )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compression offset value exceeds uncompressed data iterator.",
-				 function );
-
-				return( -1 );
-			}
-			compression_iterator = uncompressed_data_iterator - compression_offset;
-
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ uncompressed_data_iterator++ ] = uncompressed_data[ compression_iterator++ ];
-
-				compression_size--;
-			}
-		}
-		else
-		{
-			if( uncompressed_data_iterator >= uncompressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data size value too small.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress LZXPRESS Huffman compressed data.",
+		 function );
 
-				return( -1 );
-			}
-			uncompressed_data[ uncompressed_data_iterator++ ] = (uint8_t) ( compression_value & 0xff );
-		}
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1072,10 +1188,43 @@ int assorted_mssearch_decompress_byte_indexed_compressed_data(
 		 function );
 		libcnotify_print_data(
 		 uncompressed_data,
-		 uncompressed_data_iterator,
+		 safe_uncompressed_data_size,
 		 0 );
 	}
 #endif
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Decompresses byte-index compressed data
+ * Returns 1 on success or -1 on error
+ */
+int assorted_mssearch_decompress_byte_indexed_compressed_data(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_mssearch_decompress_byte_indexed_compressed_data";
+
+	if( assorted_mssearch_decompress_byte_indexed(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress byte-index compressed data.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
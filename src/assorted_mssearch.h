@@ -31,6 +31,51 @@
 extern "C" {
 #endif
 
+/* The SIMD kernels are available with GCC compatible compilers on x86
+ * and on little-endian ARMv8, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __clang__ ) || ( __GNUC__ >= 5 ) )
+#define ASSORTED_MSSEARCH_HAVE_AVX2
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ )
+#define ASSORTED_MSSEARCH_HAVE_NEON
+
+#endif
+
+/* The number of bytes decoded per iteration by the SIMD kernels
+ */
+#define ASSORTED_MSSEARCH_SIMD_BLOCK_SIZE	64
+
+enum ASSORTED_MSSEARCH_SIMD_METHODS
+{
+	ASSORTED_MSSEARCH_SIMD_METHOD_NONE	= 0x00,
+	ASSORTED_MSSEARCH_SIMD_METHOD_AVX2	= 0x01,
+	ASSORTED_MSSEARCH_SIMD_METHOD_NEON	= 0x02
+};
+
+int assorted_mssearch_get_simd_method(
+     void );
+
+#if defined( ASSORTED_MSSEARCH_HAVE_AVX2 )
+
+void assorted_mssearch_decode_simd_avx2(
+      uint8_t *data,
+      const uint8_t *encoded_data,
+      size_t size,
+      uint32_t bitmask32 );
+
+#endif /* defined( ASSORTED_MSSEARCH_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_MSSEARCH_HAVE_NEON )
+
+void assorted_mssearch_decode_simd_neon(
+      uint8_t *data,
+      const uint8_t *encoded_data,
+      size_t size,
+      uint32_t bitmask32 );
+
+#endif /* defined( ASSORTED_MSSEARCH_HAVE_NEON ) */
+
 int assorted_mssearch_decode(
      uint8_t *data,
      size_t data_size,
@@ -38,6 +83,11 @@ int assorted_mssearch_decode(
      size_t encoded_data_size,
      libcerror_error_t **error );
 
+int assorted_mssearch_decode_in_place(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int assorted_mssearch_get_run_length_uncompressed_utf16_string_size(
      uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -51,12 +101,39 @@ int assorted_mssearch_decompress_run_length_compressed_utf16_string(
      size_t compressed_data_size,
      libcerror_error_t **error );
 
+int assorted_mssearch_get_run_length_utf8_string_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
 int assorted_mssearch_get_byte_index_uncompressed_data_size(
      uint8_t *compressed_data,
      size_t compressed_data_size,
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int assorted_mssearch_decompress_byte_indexed(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 int assorted_mssearch_decompress_byte_indexed_compressed_data(
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
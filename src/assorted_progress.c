@@ -0,0 +1,268 @@
+/*
+ * Progress reporting functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_progress.h"
+#include "assorted_timer.h"
+
+/* Creates a progress
+ * Make sure the value progress is referencing, is set to NULL
+ * The callback is invoked every interval bytes read or written, where
+ * a NULL callback only tracks the counters and the abort flag
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_progress_initialize(
+     assorted_progress_t **progress,
+     uint64_t interval,
+     int (*callback)(
+            void *callback_data,
+            uint64_t bytes_read,
+            uint64_t bytes_written,
+            uint64_t elapsed_time ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_progress_initialize";
+
+	if( progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( *progress != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid progress value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( interval == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid interval value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*progress = memory_allocate_structure(
+	             assorted_progress_t );
+
+	if( *progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *progress,
+	     0,
+	     sizeof( assorted_progress_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear progress.",
+		 function );
+
+		memory_free(
+		 *progress );
+
+		*progress = NULL;
+
+		return( -1 );
+	}
+	( *progress )->interval      = interval;
+	( *progress )->next_report   = interval;
+	( *progress )->start_time    = assorted_timer_get_time();
+	( *progress )->callback      = callback;
+	( *progress )->callback_data = callback_data;
+
+	return( 1 );
+}
+
+/* Frees a progress
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_progress_free(
+     assorted_progress_t **progress,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_progress_free";
+
+	if( progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( *progress != NULL )
+	{
+		memory_free(
+		 *progress );
+
+		*progress = NULL;
+	}
+	return( 1 );
+}
+
+/* Signals the progress to abort
+ * This function only sets the abort flag so it is safe to call from a signal handler
+ */
+void assorted_progress_signal_abort(
+      assorted_progress_t *progress )
+{
+	if( progress != NULL )
+	{
+		progress->abort = 1;
+	}
+}
+
+/* Updates the total number of bytes read and written
+ * and invokes the callback when the next interval has been reached
+ * Returns 1 if successful, 0 if the operation should be aborted or -1 on error
+ */
+int assorted_progress_update(
+     assorted_progress_t *progress,
+     uint64_t bytes_read,
+     uint64_t bytes_written,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_progress_update";
+	uint64_t total_size   = 0;
+
+	if( progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( progress->abort != 0 )
+	{
+		return( 0 );
+	}
+	progress->bytes_read    = bytes_read;
+	progress->bytes_written = bytes_written;
+
+	total_size = progress->bytes_read;
+
+	if( progress->bytes_written > total_size )
+	{
+		total_size = progress->bytes_written;
+	}
+	if( total_size < progress->next_report )
+	{
+		return( 1 );
+	}
+	progress->next_report = ( ( total_size / progress->interval ) + 1 ) * progress->interval;
+
+	if( progress->callback != NULL )
+	{
+		if( progress->callback(
+		     progress->callback_data,
+		     progress->bytes_read,
+		     progress->bytes_written,
+		     assorted_timer_get_time() - progress->start_time ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report progress.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prints the progress to a file stream, the callback data is the FILE *
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_progress_fprint(
+     void *callback_data,
+     uint64_t bytes_read,
+     uint64_t bytes_written,
+     uint64_t elapsed_time )
+{
+	FILE *stream           = NULL;
+	double elapsed_seconds = 0.0;
+	double read_rate       = 0.0;
+	double write_rate      = 0.0;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	stream = (FILE *) callback_data;
+
+	elapsed_seconds = (double) elapsed_time / 1000000000.0;
+
+	if( elapsed_seconds > 0.0 )
+	{
+		read_rate  = (double) bytes_read / ( elapsed_seconds * 1024.0 * 1024.0 );
+		write_rate = (double) bytes_written / ( elapsed_seconds * 1024.0 * 1024.0 );
+	}
+	fprintf(
+	 stream,
+	 "Progress: %" PRIu64 " MiB read (%.1f MiB/s), %" PRIu64 " MiB written (%.1f MiB/s) in %.1f seconds\n",
+	 bytes_read / ( 1024 * 1024 ),
+	 read_rate,
+	 bytes_written / ( 1024 * 1024 ),
+	 write_rate,
+	 elapsed_seconds );
+
+	return( 1 );
+}
+
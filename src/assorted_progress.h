@@ -0,0 +1,113 @@
+/*
+ * Progress reporting functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#if !defined( _ASSORTED_PROGRESS_H )
+#define _ASSORTED_PROGRESS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of bytes between progress reports
+ */
+#define ASSORTED_PROGRESS_DEFAULT_INTERVAL	( 64 * 1024 * 1024 )
+
+typedef struct assorted_progress assorted_progress_t;
+
+struct assorted_progress
+{
+	/* The number of bytes between progress reports
+	 */
+	uint64_t interval;
+
+	/* The number of bytes at which the next progress report is made
+	 */
+	uint64_t next_report;
+
+	/* The start time in nanoseconds
+	 */
+	uint64_t start_time;
+
+	/* The number of bytes read
+	 */
+	uint64_t bytes_read;
+
+	/* The number of bytes written
+	 */
+	uint64_t bytes_written;
+
+	/* The progress callback function
+	 */
+	int (*callback)(
+	       void *callback_data,
+	       uint64_t bytes_read,
+	       uint64_t bytes_written,
+	       uint64_t elapsed_time );
+
+	/* The progress callback data
+	 */
+	void *callback_data;
+
+	/* Value to indicate the operation should be aborted
+	 */
+	volatile int abort;
+};
+
+int assorted_progress_initialize(
+     assorted_progress_t **progress,
+     uint64_t interval,
+     int (*callback)(
+            void *callback_data,
+            uint64_t bytes_read,
+            uint64_t bytes_written,
+            uint64_t elapsed_time ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int assorted_progress_free(
+     assorted_progress_t **progress,
+     libcerror_error_t **error );
+
+void assorted_progress_signal_abort(
+      assorted_progress_t *progress );
+
+int assorted_progress_update(
+     assorted_progress_t *progress,
+     uint64_t bytes_read,
+     uint64_t bytes_written,
+     libcerror_error_t **error );
+
+int assorted_progress_fprint(
+     void *callback_data,
+     uint64_t bytes_read,
+     uint64_t bytes_written,
+     uint64_t elapsed_time );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_PROGRESS_H ) */
+
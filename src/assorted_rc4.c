@@ -0,0 +1,212 @@
+/*
+ * RC4 stream cipher functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_rc4.h"
+
+/* Sets the key of a key schedule
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_rc4_key_schedule_set_key(
+     assorted_rc4_key_schedule_t *key_schedule,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_rc4_key_schedule_set_key";
+	size_t key_index      = 0;
+	uint16_t byte_index   = 0;
+	uint8_t permutation   = 0;
+	uint8_t value_j       = 0;
+
+	if( key_schedule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key schedule.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > ASSORTED_RC4_MAXIMUM_KEY_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_index = 0;
+	     byte_index < 256;
+	     byte_index++ )
+	{
+		key_schedule->permutations[ byte_index ] = (uint8_t) byte_index;
+	}
+	for( byte_index = 0;
+	     byte_index < 256;
+	     byte_index++ )
+	{
+		permutation = key_schedule->permutations[ byte_index ];
+		value_j    += permutation + key[ key_index ];
+
+		key_schedule->permutations[ byte_index ] = key_schedule->permutations[ value_j ];
+		key_schedule->permutations[ value_j ]    = permutation;
+
+		key_index++;
+
+		if( key_index >= key_size )
+		{
+			key_index = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* De- or encrypts data from the start of the key stream
+ * The key schedule is copied so that it can be shared by multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_rc4_crypt(
+     const assorted_rc4_key_schedule_t *key_schedule,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t permutations[ 256 ];
+
+	static char *function = "assorted_rc4_crypt";
+	size_t data_offset    = 0;
+	uint8_t permutation_i = 0;
+	uint8_t permutation_j = 0;
+	uint8_t value_i       = 0;
+	uint8_t value_j       = 0;
+
+	if( key_schedule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key schedule.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data_size < input_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid output data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     permutations,
+	     key_schedule->permutations,
+	     256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy permutations.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < input_data_size;
+	     data_offset++ )
+	{
+		value_i += 1;
+
+		permutation_i = permutations[ value_i ];
+		value_j      += permutation_i;
+		permutation_j = permutations[ value_j ];
+
+		permutations[ value_i ] = permutation_j;
+		permutations[ value_j ] = permutation_i;
+
+		output_data[ data_offset ] = input_data[ data_offset ]
+		                           ^ permutations[ (uint8_t) ( permutation_i + permutation_j ) ];
+	}
+	return( 1 );
+}
+
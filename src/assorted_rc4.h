@@ -0,0 +1,69 @@
+/*
+ * RC4 stream cipher functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_RC4_H )
+#define _ASSORTED_RC4_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a RC4 key
+ */
+#define ASSORTED_RC4_MAXIMUM_KEY_SIZE	256
+
+typedef struct assorted_rc4_key_schedule assorted_rc4_key_schedule_t;
+
+/* The key schedule is the permutation produced by the key-scheduling algorithm,
+ * it is not modified by de- or encryption and can be shared by multiple threads
+ */
+struct assorted_rc4_key_schedule
+{
+	/* The permutations
+	 */
+	uint8_t permutations[ 256 ];
+};
+
+int assorted_rc4_key_schedule_set_key(
+     assorted_rc4_key_schedule_t *key_schedule,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+int assorted_rc4_crypt(
+     const assorted_rc4_key_schedule_t *key_schedule,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_RC4_H ) */
+
@@ -0,0 +1,1580 @@
+/*
+ * Serpent block cipher functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_cpu_features.h"
+#include "assorted_libcerror.h"
+#include "assorted_serpent.h"
+
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_SERPENT_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
+/* Serpent is implemented in bitsliced form, word N of a block contains bit N
+ * of every 4-bit S-box input. The S-boxes below are the boolean circuits of
+ * Dag Arne Osvik, "Speeding up Serpent", so that the same macros operate on
+ * a single block in 32-bit integers or on multiple blocks in the lanes of
+ * a vector, where lane M of vector N contains word N of block M.
+ * T is the type of the variables x0 to x3, which are replaced by the output.
+ */
+
+/* S-box 0
+ */
+#define ASSORTED_SERPENT_SBOX0( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r3; \
+		r3 |= r0; \
+		r0 ^= r4; \
+		r4 ^= r2; \
+		r4  = ~r4; \
+		r3 ^= r1; \
+		r1 &= r0; \
+		r1 ^= r4; \
+		r2 ^= r0; \
+		r0 ^= r3; \
+		r4 |= r0; \
+		r0 ^= r2; \
+		r2 &= r1; \
+		r3 ^= r2; \
+		r1  = ~r1; \
+		r2 ^= r4; \
+		r1 ^= r2; \
+	\
+		x0 = r2; \
+		x1 = r1; \
+		x2 = r3; \
+		x3 = r0; \
+	} \
+	while( 0 )
+
+/* S-box 1
+ */
+#define ASSORTED_SERPENT_SBOX1( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r1; \
+		r1 ^= r0; \
+		r0 ^= r3; \
+		r3  = ~r3; \
+		r4 &= r1; \
+		r0 |= r1; \
+		r3 ^= r2; \
+		r0 ^= r3; \
+		r1 ^= r3; \
+		r3 ^= r4; \
+		r1 |= r4; \
+		r4 ^= r2; \
+		r2 &= r0; \
+		r2 ^= r1; \
+		r1 |= r0; \
+		r0  = ~r0; \
+		r0 ^= r2; \
+		r4 ^= r1; \
+	\
+		x0 = r4; \
+		x1 = r2; \
+		x2 = r3; \
+		x3 = r0; \
+	} \
+	while( 0 )
+
+/* S-box 2
+ */
+#define ASSORTED_SERPENT_SBOX2( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r3  = ~r3; \
+		r1 ^= r0; \
+		r4  = r0; \
+		r0 &= r2; \
+		r0 ^= r3; \
+		r3 |= r4; \
+		r2 ^= r1; \
+		r3 ^= r1; \
+		r1 &= r0; \
+		r0 ^= r2; \
+		r2 &= r3; \
+		r3 |= r1; \
+		r0  = ~r0; \
+		r3 ^= r0; \
+		r4 ^= r0; \
+		r0 ^= r2; \
+		r1 |= r2; \
+	\
+		x0 = r4; \
+		x1 = r1; \
+		x2 = r0; \
+		x3 = r3; \
+	} \
+	while( 0 )
+
+/* S-box 3
+ */
+#define ASSORTED_SERPENT_SBOX3( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r1; \
+		r1 ^= r3; \
+		r3 |= r0; \
+		r4 &= r0; \
+		r0 ^= r2; \
+		r2 ^= r1; \
+		r1 &= r3; \
+		r2 ^= r3; \
+		r0 |= r4; \
+		r4 ^= r3; \
+		r1 ^= r0; \
+		r0 &= r3; \
+		r3 &= r4; \
+		r3 ^= r2; \
+		r4 |= r1; \
+		r2 &= r1; \
+		r4 ^= r3; \
+		r0 ^= r3; \
+		r3 ^= r2; \
+	\
+		x0 = r3; \
+		x1 = r4; \
+		x2 = r1; \
+		x3 = r0; \
+	} \
+	while( 0 )
+
+/* S-box 4
+ */
+#define ASSORTED_SERPENT_SBOX4( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r3; \
+		r3 &= r0; \
+		r0 ^= r4; \
+		r3 ^= r2; \
+		r2 |= r4; \
+		r0 ^= r1; \
+		r4 ^= r3; \
+		r2 |= r0; \
+		r2 ^= r1; \
+		r1 &= r0; \
+		r1 ^= r4; \
+		r4 &= r2; \
+		r2 ^= r3; \
+		r4 ^= r0; \
+		r3 |= r1; \
+		r1  = ~r1; \
+		r3 ^= r0; \
+	\
+		x0 = r1; \
+		x1 = r2; \
+		x2 = r3; \
+		x3 = r4; \
+	} \
+	while( 0 )
+
+/* S-box 5
+ */
+#define ASSORTED_SERPENT_SBOX5( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r1; \
+		r1 |= r0; \
+		r2 ^= r1; \
+		r3  = ~r3; \
+		r4 ^= r0; \
+		r0 ^= r2; \
+		r1 &= r4; \
+		r4 |= r3; \
+		r4 ^= r0; \
+		r0 &= r3; \
+		r1 ^= r3; \
+		r3 ^= r2; \
+		r0 ^= r1; \
+		r2 &= r4; \
+		r1 ^= r2; \
+		r2 &= r0; \
+		r3 ^= r2; \
+	\
+		x0 = r4; \
+		x1 = r0; \
+		x2 = r1; \
+		x3 = r3; \
+	} \
+	while( 0 )
+
+/* S-box 6
+ */
+#define ASSORTED_SERPENT_SBOX6( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r1; \
+		r3 ^= r0; \
+		r1 ^= r2; \
+		r2 ^= r0; \
+		r0 &= r3; \
+		r1 |= r3; \
+		r4  = ~r4; \
+		r0 ^= r1; \
+		r1 ^= r2; \
+		r3 ^= r4; \
+		r4 ^= r0; \
+		r2 &= r0; \
+		r4 ^= r1; \
+		r2 ^= r3; \
+		r3 &= r1; \
+		r3 ^= r0; \
+		r1 ^= r2; \
+	\
+		x0 = r2; \
+		x1 = r4; \
+		x2 = r1; \
+		x3 = r3; \
+	} \
+	while( 0 )
+
+/* S-box 7
+ */
+#define ASSORTED_SERPENT_SBOX7( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r1  = ~r1; \
+		r4  = r1; \
+		r0  = ~r0; \
+		r1 &= r2; \
+		r1 ^= r3; \
+		r3 |= r4; \
+		r4 ^= r2; \
+		r2 ^= r3; \
+		r3 ^= r0; \
+		r0 |= r1; \
+		r2 &= r0; \
+		r0 ^= r4; \
+		r4 ^= r3; \
+		r3 &= r0; \
+		r4 ^= r1; \
+		r2 ^= r4; \
+		r3 ^= r1; \
+		r4 |= r0; \
+		r4 ^= r1; \
+	\
+		x0 = r4; \
+		x1 = r2; \
+		x2 = r3; \
+		x3 = r0; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 0
+ */
+#define ASSORTED_SERPENT_INVERSE_SBOX0( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r3; \
+		r1 ^= r0; \
+		r3 |= r1; \
+		r4 ^= r1; \
+		r0  = ~r0; \
+		r2 ^= r3; \
+		r3 ^= r0; \
+		r0 &= r1; \
+		r0 ^= r2; \
+		r2 &= r3; \
+		r3 ^= r4; \
+		r2 ^= r3; \
+		r1 ^= r3; \
+		r3 &= r0; \
+		r1 ^= r0; \
+		r0 ^= r2; \
+		r4 ^= r3; \
+	\
+		x0 = r2; \
+		x1 = r4; \
+		x2 = r1; \
+		x3 = r0; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 1
+ */
+#define ASSORTED_SERPENT_INVERSE_SBOX1( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r1 ^= r3; \
+		r4  = r0; \
+		r0 ^= r2; \
+		r2  = ~r2; \
+		r4 |= r1; \
+		r4 ^= r3; \
+		r3 &= r1; \
+		r1 ^= r2; \
+		r2 &= r4; \
+		r4 ^= r1; \
+		r1 |= r3; \
+		r3 ^= r0; \
+		r2 ^= r0; \
+		r0 |= r4; \
+		r2 ^= r4; \
+		r1 ^= r0; \
+		r4 ^= r1; \
+	\
+		x0 = r4; \
+		x1 = r1; \
+		x2 = r2; \
+		x3 = r3; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 2
+ */
+#define ASSORTED_SERPENT_INVERSE_SBOX2( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r2 ^= r1; \
+		r4  = r3; \
+		r3  = ~r3; \
+		r3 |= r2; \
+		r2 ^= r4; \
+		r4 ^= r0; \
+		r3 ^= r1; \
+		r1 |= r2; \
+		r2 ^= r0; \
+		r1 ^= r4; \
+		r4 |= r3; \
+		r2 ^= r3; \
+		r4 ^= r2; \
+		r2 &= r1; \
+		r2 ^= r3; \
+		r3 ^= r4; \
+		r4 ^= r0; \
+	\
+		x0 = r1; \
+		x1 = r4; \
+		x2 = r3; \
+		x3 = r2; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 3
+ */
+#define ASSORTED_SERPENT_INVERSE_SBOX3( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r2 ^= r1; \
+		r4  = r1; \
+		r1 &= r2; \
+		r1 ^= r0; \
+		r0 |= r4; \
+		r4 ^= r3; \
+		r0 ^= r3; \
+		r3 |= r1; \
+		r1 ^= r2; \
+		r1 ^= r3; \
+		r0 ^= r2; \
+		r2 ^= r3; \
+		r3 &= r1; \
+		r1 ^= r0; \
+		r0 &= r2; \
+		r4 ^= r3; \
+		r3 ^= r0; \
+		r0 ^= r1; \
+	\
+		x0 = r2; \
+		x1 = r0; \
+		x2 = r4; \
+		x3 = r3; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 4
+ */
+#define ASSORTED_SERPENT_INVERSE_SBOX4( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r2 ^= r3; \
+		r4  = r0; \
+		r0 &= r1; \
+		r0 ^= r2; \
+		r2 |= r3; \
+		r4  = ~r4; \
+		r1 ^= r0; \
+		r0 ^= r2; \
+		r2 &= r4; \
+		r2 ^= r0; \
+		r0 |= r4; \
+		r0 ^= r3; \
+		r3 &= r2; \
+		r4 ^= r3; \
+		r3 ^= r1; \
+		r1 &= r0; \
+		r4 ^= r1; \
+		r0 ^= r3; \
+	\
+		x0 = r0; \
+		x1 = r2; \
+		x2 = r4; \
+		x3 = r3; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 5
+ */
+#define ASSORTED_SERPENT_INVERSE_SBOX5( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r1; \
+		r1 |= r2; \
+		r2 ^= r4; \
+		r1 ^= r3; \
+		r3 &= r4; \
+		r2 ^= r3; \
+		r3 |= r0; \
+		r0  = ~r0; \
+		r3 ^= r2; \
+		r2 |= r0; \
+		r4 ^= r1; \
+		r2 ^= r4; \
+		r4 &= r0; \
+		r0 ^= r1; \
+		r1 ^= r3; \
+		r0 &= r2; \
+		r2 ^= r3; \
+		r0 ^= r2; \
+		r2 ^= r4; \
+		r4 ^= r3; \
+	\
+		x0 = r1; \
+		x1 = r4; \
+		x2 = r0; \
+		x3 = r2; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 6
+ */
+#define ASSORTED_SERPENT_INVERSE_SBOX6( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r0 ^= r2; \
+		r4  = r0; \
+		r0 &= r3; \
+		r2 ^= r3; \
+		r0 ^= r2; \
+		r3 ^= r1; \
+		r2 |= r4; \
+		r2 ^= r3; \
+		r3 &= r0; \
+		r0  = ~r0; \
+		r3 ^= r1; \
+		r1 &= r2; \
+		r4 ^= r0; \
+		r3 ^= r4; \
+		r4 ^= r2; \
+		r0 ^= r1; \
+		r2 ^= r0; \
+	\
+		x0 = r2; \
+		x1 = r4; \
+		x2 = r3; \
+		x3 = r0; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 7
+ */
+#define ASSORTED_SERPENT_INVERSE_SBOX7( T, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T r0 = x0; \
+		T r1 = x1; \
+		T r2 = x2; \
+		T r3 = x3; \
+		T r4; \
+	\
+		r4  = r3; \
+		r3 &= r0; \
+		r0 ^= r2; \
+		r2 |= r4; \
+		r4 ^= r1; \
+		r0  = ~r0; \
+		r1 |= r3; \
+		r4 ^= r0; \
+		r0 &= r2; \
+		r0 ^= r1; \
+		r1 &= r2; \
+		r3 ^= r2; \
+		r4 ^= r3; \
+		r2 &= r3; \
+		r3 |= r0; \
+		r1 ^= r4; \
+		r3 ^= r4; \
+		r4 &= r0; \
+		r4 ^= r2; \
+	\
+		x0 = r1; \
+		x1 = r3; \
+		x2 = r0; \
+		x3 = r4; \
+	} \
+	while( 0 )
+
+#define ASSORTED_SERPENT_ROTATE_LEFT( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 32 - ( number_of_bits ) ) ) )
+
+#define ASSORTED_SERPENT_ROTATE_RIGHT( value, number_of_bits ) \
+	( ( ( value ) >> ( number_of_bits ) ) | ( ( value ) << ( 32 - ( number_of_bits ) ) ) )
+
+/* The linear transformation
+ */
+#define ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		x0  = ASSORTED_SERPENT_ROTATE_LEFT( x0, 13 ); \
+		x2  = ASSORTED_SERPENT_ROTATE_LEFT( x2, 3 ); \
+		x1 ^= x0 ^ x2; \
+		x3 ^= x2 ^ ( x0 << 3 ); \
+		x1  = ASSORTED_SERPENT_ROTATE_LEFT( x1, 1 ); \
+		x3  = ASSORTED_SERPENT_ROTATE_LEFT( x3, 7 ); \
+		x0 ^= x1 ^ x3; \
+		x2 ^= x3 ^ ( x1 << 7 ); \
+		x0  = ASSORTED_SERPENT_ROTATE_LEFT( x0, 5 ); \
+		x2  = ASSORTED_SERPENT_ROTATE_LEFT( x2, 22 ); \
+	} \
+	while( 0 )
+
+/* The inverse linear transformation
+ */
+#define ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		x2  = ASSORTED_SERPENT_ROTATE_RIGHT( x2, 22 ); \
+		x0  = ASSORTED_SERPENT_ROTATE_RIGHT( x0, 5 ); \
+		x2 ^= x3 ^ ( x1 << 7 ); \
+		x0 ^= x1 ^ x3; \
+		x3  = ASSORTED_SERPENT_ROTATE_RIGHT( x3, 7 ); \
+		x1  = ASSORTED_SERPENT_ROTATE_RIGHT( x1, 1 ); \
+		x3 ^= x2 ^ ( x0 << 3 ); \
+		x1 ^= x0 ^ x2; \
+		x2  = ASSORTED_SERPENT_ROTATE_RIGHT( x2, 3 ); \
+		x0  = ASSORTED_SERPENT_ROTATE_RIGHT( x0, 13 ); \
+	} \
+	while( 0 )
+
+/* Mixes in a round key, for vectors the key words are broadcast to all lanes
+ */
+#define ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_key ) \
+	do \
+	{ \
+		x0 ^= ( round_key )[ 0 ]; \
+		x1 ^= ( round_key )[ 1 ]; \
+		x2 ^= ( round_key )[ 2 ]; \
+		x3 ^= ( round_key )[ 3 ]; \
+	} \
+	while( 0 )
+
+/* Encrypts the bitsliced blocks in x0 to x3 using 32 rounds
+ */
+#define ASSORTED_SERPENT_ENCRYPT( T, round_keys, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		int round_index = 0; \
+	\
+		for( round_index = 0; \
+		     round_index < 32; \
+		     round_index += 8 ) \
+		{ \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index ] ); \
+			ASSORTED_SERPENT_SBOX0( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 1 ] ); \
+			ASSORTED_SERPENT_SBOX1( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 2 ] ); \
+			ASSORTED_SERPENT_SBOX2( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 3 ] ); \
+			ASSORTED_SERPENT_SBOX3( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 4 ] ); \
+			ASSORTED_SERPENT_SBOX4( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 5 ] ); \
+			ASSORTED_SERPENT_SBOX5( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 6 ] ); \
+			ASSORTED_SERPENT_SBOX6( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 7 ] ); \
+			ASSORTED_SERPENT_SBOX7( T, x0, x1, x2, x3 ); \
+	\
+			/* The last round has a key mix instead of a linear transformation \
+			 */ \
+			if( round_index < 24 ) \
+			{ \
+				ASSORTED_SERPENT_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			} \
+		} \
+		ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ 32 ] ); \
+	} \
+	while( 0 )
+
+/* Decrypts the bitsliced blocks in x0 to x3 using 32 rounds
+ */
+#define ASSORTED_SERPENT_DECRYPT( T, round_keys, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		int round_index = 0; \
+	\
+		ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ 32 ] ); \
+	\
+		for( round_index = 24; \
+		     round_index >= 0; \
+		     round_index -= 8 ) \
+		{ \
+			if( round_index < 24 ) \
+			{ \
+				ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			} \
+			ASSORTED_SERPENT_INVERSE_SBOX7( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 7 ] ); \
+			ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_INVERSE_SBOX6( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 6 ] ); \
+			ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_INVERSE_SBOX5( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 5 ] ); \
+			ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_INVERSE_SBOX4( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 4 ] ); \
+			ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_INVERSE_SBOX3( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 3 ] ); \
+			ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_INVERSE_SBOX2( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 2 ] ); \
+			ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_INVERSE_SBOX1( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index + 1 ] ); \
+			ASSORTED_SERPENT_INVERSE_LINEAR_TRANSFORM( x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_INVERSE_SBOX0( T, x0, x1, x2, x3 ); \
+			ASSORTED_SERPENT_KEY_MIX( x0, x1, x2, x3, round_keys[ round_index ] ); \
+		} \
+	} \
+	while( 0 )
+
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD ) || defined( ASSORTED_SERPENT_HAVE_NEON )
+
+/* The vector types, operators on these types apply to every 32-bit lane
+ * and a 32-bit scalar operand is broadcast to all lanes
+ */
+typedef uint32_t assorted_serpent_vector128_t __attribute__ ((vector_size (16)));
+
+#endif
+
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD )
+
+typedef uint32_t assorted_serpent_vector256_t __attribute__ ((vector_size (32)));
+typedef uint32_t assorted_serpent_vector512_t __attribute__ ((vector_size (64)));
+
+/* Transposes 4 vectors of 4 blocks into 4 vectors of 4 words per 128-bit lane
+ * The transposition is its own inverse
+ */
+#define ASSORTED_SERPENT_TRANSPOSE( T, prefix, x0, x1, x2, x3 ) \
+	do \
+	{ \
+		T t0 = prefix ## _unpacklo_epi32( x0, x1 ); \
+		T t1 = prefix ## _unpacklo_epi32( x2, x3 ); \
+		T t2 = prefix ## _unpackhi_epi32( x0, x1 ); \
+		T t3 = prefix ## _unpackhi_epi32( x2, x3 ); \
+	\
+		x0 = prefix ## _unpacklo_epi64( t0, t1 ); \
+		x1 = prefix ## _unpackhi_epi64( t0, t1 ); \
+		x2 = prefix ## _unpacklo_epi64( t2, t3 ); \
+		x3 = prefix ## _unpackhi_epi64( t2, t3 ); \
+	} \
+	while( 0 )
+
+#endif /* defined( ASSORTED_SERPENT_HAVE_X86_SIMD ) */
+
+/* Determines the SIMD method supported by the CPU
+ * Returns the SIMD method
+ */
+int assorted_serpent_get_simd_method(
+     void )
+{
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD ) || defined( ASSORTED_SERPENT_HAVE_NEON )
+	uint32_t cpu_features = 0;
+#endif
+	int simd_method       = ASSORTED_SERPENT_SIMD_METHOD_NONE;
+
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX512F ) != 0 )
+	{
+		simd_method = ASSORTED_SERPENT_SIMD_METHOD_AVX512;
+	}
+	else if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		simd_method = ASSORTED_SERPENT_SIMD_METHOD_AVX2;
+	}
+	else if( ( cpu_features & ASSORTED_CPU_FEATURE_SSE2 ) != 0 )
+	{
+		simd_method = ASSORTED_SERPENT_SIMD_METHOD_SSE2;
+	}
+#elif defined( ASSORTED_SERPENT_HAVE_NEON )
+	cpu_features = assorted_cpu_features_get();
+
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_NEON ) != 0 )
+	{
+		simd_method = ASSORTED_SERPENT_SIMD_METHOD_NEON;
+	}
+#endif
+	return( simd_method );
+}
+
+/* Creates a context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_serpent_context_initialize(
+     assorted_serpent_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_serpent_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            assorted_serpent_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( assorted_serpent_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+
+		return( -1 );
+	}
+	( *context )->simd_method = assorted_serpent_get_simd_method();
+
+	return( 1 );
+}
+
+/* Frees a context
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_serpent_context_free(
+     assorted_serpent_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_serpent_context_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( memory_set(
+		     *context,
+		     0,
+		     sizeof( assorted_serpent_context_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Sets the key
+ * The key is padded to 256 bits and expanded into the round keys
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_serpent_context_set_key(
+     assorted_serpent_context_t *context,
+     const uint8_t *key,
+     size_t key_bit_size,
+     libcerror_error_t **error )
+{
+	uint32_t prekeys[ 8 + ( 4 * ASSORTED_SERPENT_NUMBER_OF_ROUND_KEYS ) ];
+
+	static char *function = "assorted_serpent_context_set_key";
+	size_t key_byte_index = 0;
+	uint32_t x0           = 0;
+	uint32_t x1           = 0;
+	uint32_t x2           = 0;
+	uint32_t x3           = 0;
+	int prekey_index      = 0;
+	int round_key_index   = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_bit_size != 128 )
+	 && ( key_bit_size != 192 )
+	 && ( key_bit_size != 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key bit size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     prekeys,
+	     0,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear prekeys.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key is stored little-endian, a key shorter than 256 bits
+	 * is padded with a single 1 bit
+	 */
+	for( key_byte_index = 0;
+	     key_byte_index < ( key_bit_size / 8 );
+	     key_byte_index += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( key[ key_byte_index ] ),
+		 prekeys[ key_byte_index / 4 ] );
+	}
+	if( key_bit_size < 256 )
+	{
+		prekeys[ key_bit_size / 32 ] |= (uint32_t) 1UL << ( key_bit_size % 32 );
+	}
+	for( prekey_index = 8;
+	     prekey_index < ( 8 + ( 4 * ASSORTED_SERPENT_NUMBER_OF_ROUND_KEYS ) );
+	     prekey_index++ )
+	{
+		x0 = prekeys[ prekey_index - 8 ]
+		   ^ prekeys[ prekey_index - 5 ]
+		   ^ prekeys[ prekey_index - 3 ]
+		   ^ prekeys[ prekey_index - 1 ]
+		   ^ 0x9e3779b9UL
+		   ^ (uint32_t) ( prekey_index - 8 );
+
+		prekeys[ prekey_index ] = ASSORTED_SERPENT_ROTATE_LEFT( x0, 11 );
+	}
+	/* Round key N is the prekeys passed through S-box ( 3 - N ) modulo 8
+	 */
+	for( round_key_index = 0;
+	     round_key_index < ASSORTED_SERPENT_NUMBER_OF_ROUND_KEYS;
+	     round_key_index++ )
+	{
+		prekey_index = 8 + ( 4 * round_key_index );
+
+		x0 = prekeys[ prekey_index ];
+		x1 = prekeys[ prekey_index + 1 ];
+		x2 = prekeys[ prekey_index + 2 ];
+		x3 = prekeys[ prekey_index + 3 ];
+
+		switch( ( 35 - round_key_index ) % 8 )
+		{
+			case 0:
+				ASSORTED_SERPENT_SBOX0( uint32_t, x0, x1, x2, x3 );
+				break;
+
+			case 1:
+				ASSORTED_SERPENT_SBOX1( uint32_t, x0, x1, x2, x3 );
+				break;
+
+			case 2:
+				ASSORTED_SERPENT_SBOX2( uint32_t, x0, x1, x2, x3 );
+				break;
+
+			case 3:
+				ASSORTED_SERPENT_SBOX3( uint32_t, x0, x1, x2, x3 );
+				break;
+
+			case 4:
+				ASSORTED_SERPENT_SBOX4( uint32_t, x0, x1, x2, x3 );
+				break;
+
+			case 5:
+				ASSORTED_SERPENT_SBOX5( uint32_t, x0, x1, x2, x3 );
+				break;
+
+			case 6:
+				ASSORTED_SERPENT_SBOX6( uint32_t, x0, x1, x2, x3 );
+				break;
+
+			case 7:
+				ASSORTED_SERPENT_SBOX7( uint32_t, x0, x1, x2, x3 );
+				break;
+		}
+		context->round_keys[ round_key_index ][ 0 ] = x0;
+		context->round_keys[ round_key_index ][ 1 ] = x1;
+		context->round_keys[ round_key_index ][ 2 ] = x2;
+		context->round_keys[ round_key_index ][ 3 ] = x3;
+	}
+	memory_set(
+	 prekeys,
+	 0,
+	 sizeof( uint32_t ) * ( 8 + ( 4 * ASSORTED_SERPENT_NUMBER_OF_ROUND_KEYS ) ) );
+
+	return( 1 );
+}
+
+/* De- or encrypts blocks one at a time
+ */
+void assorted_serpent_crypt_blocks(
+      assorted_serpent_context_t *context,
+      int crypt_mode,
+      const uint8_t *input_data,
+      uint8_t *output_data,
+      size_t number_of_blocks )
+{
+	uint32_t x0 = 0;
+	uint32_t x1 = 0;
+	uint32_t x2 = 0;
+	uint32_t x3 = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 input_data,
+		 x0 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( input_data[ 4 ] ),
+		 x1 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( input_data[ 8 ] ),
+		 x2 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( input_data[ 12 ] ),
+		 x3 );
+
+		if( crypt_mode == ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			ASSORTED_SERPENT_ENCRYPT( uint32_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		else
+		{
+			ASSORTED_SERPENT_DECRYPT( uint32_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 output_data,
+		 x0 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( output_data[ 4 ] ),
+		 x1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( output_data[ 8 ] ),
+		 x2 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( output_data[ 12 ] ),
+		 x3 );
+
+		input_data       += ASSORTED_SERPENT_BLOCK_SIZE;
+		output_data      += ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD )
+
+/* De- or encrypts blocks using SSE2, 4 blocks per iteration
+ * Any remaining blocks are not processed
+ */
+__attribute__ ((target ("sse2"))) void assorted_serpent_crypt_blocks_sse2(
+                                        assorted_serpent_context_t *context,
+                                        int crypt_mode,
+                                        const uint8_t *input_data,
+                                        uint8_t *output_data,
+                                        size_t number_of_blocks )
+{
+	assorted_serpent_vector128_t x0;
+	assorted_serpent_vector128_t x1;
+	assorted_serpent_vector128_t x2;
+	assorted_serpent_vector128_t x3;
+	__m128i v0;
+	__m128i v1;
+	__m128i v2;
+	__m128i v3;
+
+	while( number_of_blocks >= 4 )
+	{
+		v0 = _mm_loadu_si128( (__m128i *) input_data );
+		v1 = _mm_loadu_si128( (__m128i *) &( input_data[ 16 ] ) );
+		v2 = _mm_loadu_si128( (__m128i *) &( input_data[ 32 ] ) );
+		v3 = _mm_loadu_si128( (__m128i *) &( input_data[ 48 ] ) );
+
+		ASSORTED_SERPENT_TRANSPOSE( __m128i, _mm, v0, v1, v2, v3 );
+
+		x0 = (assorted_serpent_vector128_t) v0;
+		x1 = (assorted_serpent_vector128_t) v1;
+		x2 = (assorted_serpent_vector128_t) v2;
+		x3 = (assorted_serpent_vector128_t) v3;
+
+		if( crypt_mode == ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			ASSORTED_SERPENT_ENCRYPT( assorted_serpent_vector128_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		else
+		{
+			ASSORTED_SERPENT_DECRYPT( assorted_serpent_vector128_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		v0 = (__m128i) x0;
+		v1 = (__m128i) x1;
+		v2 = (__m128i) x2;
+		v3 = (__m128i) x3;
+
+		ASSORTED_SERPENT_TRANSPOSE( __m128i, _mm, v0, v1, v2, v3 );
+
+		_mm_storeu_si128( (__m128i *) output_data, v0 );
+		_mm_storeu_si128( (__m128i *) &( output_data[ 16 ] ), v1 );
+		_mm_storeu_si128( (__m128i *) &( output_data[ 32 ] ), v2 );
+		_mm_storeu_si128( (__m128i *) &( output_data[ 48 ] ), v3 );
+
+		input_data       += 4 * ASSORTED_SERPENT_BLOCK_SIZE;
+		output_data      += 4 * ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= 4;
+	}
+}
+
+/* De- or encrypts blocks using AVX2, 8 blocks per iteration
+ * Any remaining blocks are not processed
+ */
+__attribute__ ((target ("avx2"))) void assorted_serpent_crypt_blocks_avx2(
+                                        assorted_serpent_context_t *context,
+                                        int crypt_mode,
+                                        const uint8_t *input_data,
+                                        uint8_t *output_data,
+                                        size_t number_of_blocks )
+{
+	assorted_serpent_vector256_t x0;
+	assorted_serpent_vector256_t x1;
+	assorted_serpent_vector256_t x2;
+	assorted_serpent_vector256_t x3;
+	__m256i v0;
+	__m256i v1;
+	__m256i v2;
+	__m256i v3;
+
+	while( number_of_blocks >= 8 )
+	{
+		v0 = _mm256_loadu_si256( (__m256i *) input_data );
+		v1 = _mm256_loadu_si256( (__m256i *) &( input_data[ 32 ] ) );
+		v2 = _mm256_loadu_si256( (__m256i *) &( input_data[ 64 ] ) );
+		v3 = _mm256_loadu_si256( (__m256i *) &( input_data[ 96 ] ) );
+
+		ASSORTED_SERPENT_TRANSPOSE( __m256i, _mm256, v0, v1, v2, v3 );
+
+		x0 = (assorted_serpent_vector256_t) v0;
+		x1 = (assorted_serpent_vector256_t) v1;
+		x2 = (assorted_serpent_vector256_t) v2;
+		x3 = (assorted_serpent_vector256_t) v3;
+
+		if( crypt_mode == ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			ASSORTED_SERPENT_ENCRYPT( assorted_serpent_vector256_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		else
+		{
+			ASSORTED_SERPENT_DECRYPT( assorted_serpent_vector256_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		v0 = (__m256i) x0;
+		v1 = (__m256i) x1;
+		v2 = (__m256i) x2;
+		v3 = (__m256i) x3;
+
+		ASSORTED_SERPENT_TRANSPOSE( __m256i, _mm256, v0, v1, v2, v3 );
+
+		_mm256_storeu_si256( (__m256i *) output_data, v0 );
+		_mm256_storeu_si256( (__m256i *) &( output_data[ 32 ] ), v1 );
+		_mm256_storeu_si256( (__m256i *) &( output_data[ 64 ] ), v2 );
+		_mm256_storeu_si256( (__m256i *) &( output_data[ 96 ] ), v3 );
+
+		input_data       += 8 * ASSORTED_SERPENT_BLOCK_SIZE;
+		output_data      += 8 * ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= 8;
+	}
+}
+
+/* De- or encrypts blocks using AVX-512, 16 blocks per iteration
+ * Any remaining blocks are not processed
+ */
+__attribute__ ((target ("avx512f"))) void assorted_serpent_crypt_blocks_avx512(
+                                           assorted_serpent_context_t *context,
+                                           int crypt_mode,
+                                           const uint8_t *input_data,
+                                           uint8_t *output_data,
+                                           size_t number_of_blocks )
+{
+	assorted_serpent_vector512_t x0;
+	assorted_serpent_vector512_t x1;
+	assorted_serpent_vector512_t x2;
+	assorted_serpent_vector512_t x3;
+	__m512i v0;
+	__m512i v1;
+	__m512i v2;
+	__m512i v3;
+
+	while( number_of_blocks >= 16 )
+	{
+		v0 = _mm512_loadu_si512( (void *) input_data );
+		v1 = _mm512_loadu_si512( (void *) &( input_data[ 64 ] ) );
+		v2 = _mm512_loadu_si512( (void *) &( input_data[ 128 ] ) );
+		v3 = _mm512_loadu_si512( (void *) &( input_data[ 192 ] ) );
+
+		ASSORTED_SERPENT_TRANSPOSE( __m512i, _mm512, v0, v1, v2, v3 );
+
+		x0 = (assorted_serpent_vector512_t) v0;
+		x1 = (assorted_serpent_vector512_t) v1;
+		x2 = (assorted_serpent_vector512_t) v2;
+		x3 = (assorted_serpent_vector512_t) v3;
+
+		if( crypt_mode == ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			ASSORTED_SERPENT_ENCRYPT( assorted_serpent_vector512_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		else
+		{
+			ASSORTED_SERPENT_DECRYPT( assorted_serpent_vector512_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		v0 = (__m512i) x0;
+		v1 = (__m512i) x1;
+		v2 = (__m512i) x2;
+		v3 = (__m512i) x3;
+
+		ASSORTED_SERPENT_TRANSPOSE( __m512i, _mm512, v0, v1, v2, v3 );
+
+		_mm512_storeu_si512( (void *) output_data, v0 );
+		_mm512_storeu_si512( (void *) &( output_data[ 64 ] ), v1 );
+		_mm512_storeu_si512( (void *) &( output_data[ 128 ] ), v2 );
+		_mm512_storeu_si512( (void *) &( output_data[ 192 ] ), v3 );
+
+		input_data       += 16 * ASSORTED_SERPENT_BLOCK_SIZE;
+		output_data      += 16 * ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= 16;
+	}
+}
+
+#endif /* defined( ASSORTED_SERPENT_HAVE_X86_SIMD ) */
+
+#if defined( ASSORTED_SERPENT_HAVE_NEON )
+
+/* De- or encrypts blocks using NEON, 4 blocks per iteration
+ * The blocks are transposed by the de-interleaving load and interleaving store
+ * Any remaining blocks are not processed
+ */
+void assorted_serpent_crypt_blocks_neon(
+      assorted_serpent_context_t *context,
+      int crypt_mode,
+      const uint8_t *input_data,
+      uint8_t *output_data,
+      size_t number_of_blocks )
+{
+	assorted_serpent_vector128_t x0;
+	assorted_serpent_vector128_t x1;
+	assorted_serpent_vector128_t x2;
+	assorted_serpent_vector128_t x3;
+	uint32x4x4_t blocks;
+
+	while( number_of_blocks >= 4 )
+	{
+		blocks = vld4q_u32( (const uint32_t *) input_data );
+
+		x0 = (assorted_serpent_vector128_t) blocks.val[ 0 ];
+		x1 = (assorted_serpent_vector128_t) blocks.val[ 1 ];
+		x2 = (assorted_serpent_vector128_t) blocks.val[ 2 ];
+		x3 = (assorted_serpent_vector128_t) blocks.val[ 3 ];
+
+		if( crypt_mode == ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			ASSORTED_SERPENT_ENCRYPT( assorted_serpent_vector128_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		else
+		{
+			ASSORTED_SERPENT_DECRYPT( assorted_serpent_vector128_t, context->round_keys, x0, x1, x2, x3 );
+		}
+		blocks.val[ 0 ] = (uint32x4_t) x0;
+		blocks.val[ 1 ] = (uint32x4_t) x1;
+		blocks.val[ 2 ] = (uint32x4_t) x2;
+		blocks.val[ 3 ] = (uint32x4_t) x3;
+
+		vst4q_u32( (uint32_t *) output_data, blocks );
+
+		input_data       += 4 * ASSORTED_SERPENT_BLOCK_SIZE;
+		output_data      += 4 * ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= 4;
+	}
+}
+
+#endif /* defined( ASSORTED_SERPENT_HAVE_NEON ) */
+
+/* De- or encrypts data in electronic codebook (ECB) mode
+ * The blocks are processed by the widest SIMD kernel supported by the CPU
+ * and the remaining blocks one at a time. The input and output data can be
+ * the same buffer.
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_serpent_crypt_ecb(
+     assorted_serpent_context_t *context,
+     int crypt_mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "assorted_serpent_crypt_ecb";
+	size_t data_offset      = 0;
+	size_t number_of_blocks = 0;
+
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD ) || defined( ASSORTED_SERPENT_HAVE_NEON )
+	size_t simd_blocks      = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( crypt_mode != ASSORTED_SERPENT_CRYPT_MODE_DECRYPT )
+	 && ( crypt_mode != ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported crypt mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_data_size > (size_t) SSIZE_MAX )
+	 || ( ( input_data_size % ASSORTED_SERPENT_BLOCK_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size > (size_t) SSIZE_MAX )
+	 || ( output_data_size < input_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = input_data_size / ASSORTED_SERPENT_BLOCK_SIZE;
+
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD )
+	if( context->simd_method == ASSORTED_SERPENT_SIMD_METHOD_AVX512 )
+	{
+		simd_blocks = number_of_blocks - ( number_of_blocks % 16 );
+
+		assorted_serpent_crypt_blocks_avx512(
+		 context,
+		 crypt_mode,
+		 input_data,
+		 output_data,
+		 simd_blocks );
+
+		data_offset      += simd_blocks * ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= simd_blocks;
+	}
+	if( ( context->simd_method == ASSORTED_SERPENT_SIMD_METHOD_AVX512 )
+	 || ( context->simd_method == ASSORTED_SERPENT_SIMD_METHOD_AVX2 ) )
+	{
+		simd_blocks = number_of_blocks - ( number_of_blocks % 8 );
+
+		assorted_serpent_crypt_blocks_avx2(
+		 context,
+		 crypt_mode,
+		 &( input_data[ data_offset ] ),
+		 &( output_data[ data_offset ] ),
+		 simd_blocks );
+
+		data_offset      += simd_blocks * ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= simd_blocks;
+	}
+	if( context->simd_method != ASSORTED_SERPENT_SIMD_METHOD_NONE )
+	{
+		simd_blocks = number_of_blocks - ( number_of_blocks % 4 );
+
+		assorted_serpent_crypt_blocks_sse2(
+		 context,
+		 crypt_mode,
+		 &( input_data[ data_offset ] ),
+		 &( output_data[ data_offset ] ),
+		 simd_blocks );
+
+		data_offset      += simd_blocks * ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= simd_blocks;
+	}
+#elif defined( ASSORTED_SERPENT_HAVE_NEON )
+	if( context->simd_method == ASSORTED_SERPENT_SIMD_METHOD_NEON )
+	{
+		simd_blocks = number_of_blocks - ( number_of_blocks % 4 );
+
+		assorted_serpent_crypt_blocks_neon(
+		 context,
+		 crypt_mode,
+		 input_data,
+		 output_data,
+		 simd_blocks );
+
+		data_offset      += simd_blocks * ASSORTED_SERPENT_BLOCK_SIZE;
+		number_of_blocks -= simd_blocks;
+	}
+#endif
+	assorted_serpent_crypt_blocks(
+	 context,
+	 crypt_mode,
+	 &( input_data[ data_offset ] ),
+	 &( output_data[ data_offset ] ),
+	 number_of_blocks );
+
+	return( 1 );
+}
+
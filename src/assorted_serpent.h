@@ -0,0 +1,153 @@
+/*
+ * Serpent block cipher functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_SERPENT_H )
+#define _ASSORTED_SERPENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The bitsliced SIMD kernels are available with GCC compatible compilers on x86
+ * and on little-endian ARMv8, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define ASSORTED_SERPENT_HAVE_X86_SIMD
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ )
+#define ASSORTED_SERPENT_HAVE_NEON
+
+#endif
+
+#define ASSORTED_SERPENT_BLOCK_SIZE		16
+
+/* The number of round keys
+ */
+#define ASSORTED_SERPENT_NUMBER_OF_ROUND_KEYS	33
+
+enum ASSORTED_SERPENT_CRYPT_MODES
+{
+	ASSORTED_SERPENT_CRYPT_MODE_DECRYPT	= 0,
+	ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT	= 1
+};
+
+enum ASSORTED_SERPENT_SIMD_METHODS
+{
+	ASSORTED_SERPENT_SIMD_METHOD_NONE	= 0x00,
+	ASSORTED_SERPENT_SIMD_METHOD_SSE2	= 0x01,
+	ASSORTED_SERPENT_SIMD_METHOD_AVX2	= 0x02,
+	ASSORTED_SERPENT_SIMD_METHOD_AVX512	= 0x03,
+	ASSORTED_SERPENT_SIMD_METHOD_NEON	= 0x04
+};
+
+typedef struct assorted_serpent_context assorted_serpent_context_t;
+
+struct assorted_serpent_context
+{
+	/* The round keys, 4 32-bit words per round
+	 */
+	uint32_t round_keys[ ASSORTED_SERPENT_NUMBER_OF_ROUND_KEYS ][ 4 ];
+
+	/* The SIMD method
+	 */
+	int simd_method;
+};
+
+int assorted_serpent_get_simd_method(
+     void );
+
+int assorted_serpent_context_initialize(
+     assorted_serpent_context_t **context,
+     libcerror_error_t **error );
+
+int assorted_serpent_context_free(
+     assorted_serpent_context_t **context,
+     libcerror_error_t **error );
+
+int assorted_serpent_context_set_key(
+     assorted_serpent_context_t *context,
+     const uint8_t *key,
+     size_t key_bit_size,
+     libcerror_error_t **error );
+
+void assorted_serpent_crypt_blocks(
+      assorted_serpent_context_t *context,
+      int crypt_mode,
+      const uint8_t *input_data,
+      uint8_t *output_data,
+      size_t number_of_blocks );
+
+#if defined( ASSORTED_SERPENT_HAVE_X86_SIMD )
+
+void assorted_serpent_crypt_blocks_sse2(
+      assorted_serpent_context_t *context,
+      int crypt_mode,
+      const uint8_t *input_data,
+      uint8_t *output_data,
+      size_t number_of_blocks );
+
+void assorted_serpent_crypt_blocks_avx2(
+      assorted_serpent_context_t *context,
+      int crypt_mode,
+      const uint8_t *input_data,
+      uint8_t *output_data,
+      size_t number_of_blocks );
+
+void assorted_serpent_crypt_blocks_avx512(
+      assorted_serpent_context_t *context,
+      int crypt_mode,
+      const uint8_t *input_data,
+      uint8_t *output_data,
+      size_t number_of_blocks );
+
+#endif /* defined( ASSORTED_SERPENT_HAVE_X86_SIMD ) */
+
+#if defined( ASSORTED_SERPENT_HAVE_NEON )
+
+void assorted_serpent_crypt_blocks_neon(
+      assorted_serpent_context_t *context,
+      int crypt_mode,
+      const uint8_t *input_data,
+      uint8_t *output_data,
+      size_t number_of_blocks );
+
+#endif /* defined( ASSORTED_SERPENT_HAVE_NEON ) */
+
+int assorted_serpent_crypt_ecb(
+     assorted_serpent_context_t *context,
+     int crypt_mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_SERPENT_H ) */
+
@@ -0,0 +1,538 @@
+/*
+ * Suffix array functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_suffix_array.h"
+
+/* The suffix types
+ */
+#define ASSORTED_SUFFIX_ARRAY_TYPE_L	0
+#define ASSORTED_SUFFIX_ARRAY_TYPE_S	1
+
+/* Determines if the suffix at the index is a leftmost S-type (LMS) suffix
+ */
+#define assorted_suffix_array_is_lms( types, index ) \
+	( ( ( index ) > 0 ) \
+	 && ( types[ index ] == ASSORTED_SUFFIX_ARRAY_TYPE_S ) \
+	 && ( types[ ( index ) - 1 ] == ASSORTED_SUFFIX_ARRAY_TYPE_L ) )
+
+/* Determines the start or end offsets of the character buckets
+ */
+void assorted_suffix_array_get_buckets(
+      const int32_t *text,
+      int32_t text_size,
+      int32_t alphabet_size,
+      int32_t *buckets,
+      uint8_t end_of_buckets )
+{
+	int32_t bucket_index     = 0;
+	int32_t number_of_values = 0;
+	int32_t sum              = 0;
+	int32_t text_index       = 0;
+
+	for( bucket_index = 0;
+	     bucket_index < alphabet_size;
+	     bucket_index++ )
+	{
+		buckets[ bucket_index ] = 0;
+	}
+	for( text_index = 0;
+	     text_index < text_size;
+	     text_index++ )
+	{
+		buckets[ text[ text_index ] ] += 1;
+	}
+	for( bucket_index = 0;
+	     bucket_index < alphabet_size;
+	     bucket_index++ )
+	{
+		number_of_values = buckets[ bucket_index ];
+
+		if( end_of_buckets != 0 )
+		{
+			sum += number_of_values;
+
+			buckets[ bucket_index ] = sum;
+		}
+		else
+		{
+			buckets[ bucket_index ] = sum;
+
+			sum += number_of_values;
+		}
+	}
+}
+
+/* Induces the order of the L-type suffixes from the sorted suffixes, by scanning
+ * from front to back, followed by the order of the S-type suffixes, by scanning
+ * from back to front
+ */
+void assorted_suffix_array_induce(
+      const int32_t *text,
+      const uint8_t *types,
+      int32_t text_size,
+      int32_t alphabet_size,
+      int32_t *buckets,
+      int32_t *suffix_array )
+{
+	int32_t suffix_index = 0;
+	int32_t text_index   = 0;
+
+	assorted_suffix_array_get_buckets(
+	 text,
+	 text_size,
+	 alphabet_size,
+	 buckets,
+	 0 );
+
+	for( suffix_index = 0;
+	     suffix_index < text_size;
+	     suffix_index++ )
+	{
+		text_index = suffix_array[ suffix_index ] - 1;
+
+		if( ( text_index >= 0 )
+		 && ( types[ text_index ] == ASSORTED_SUFFIX_ARRAY_TYPE_L ) )
+		{
+			suffix_array[ buckets[ text[ text_index ] ]++ ] = text_index;
+		}
+	}
+	assorted_suffix_array_get_buckets(
+	 text,
+	 text_size,
+	 alphabet_size,
+	 buckets,
+	 1 );
+
+	for( suffix_index = text_size - 1;
+	     suffix_index >= 0;
+	     suffix_index-- )
+	{
+		text_index = suffix_array[ suffix_index ] - 1;
+
+		if( ( text_index >= 0 )
+		 && ( types[ text_index ] == ASSORTED_SUFFIX_ARRAY_TYPE_S ) )
+		{
+			suffix_array[ --buckets[ text[ text_index ] ] ] = text_index;
+		}
+	}
+}
+
+/* Sorts the suffixes of a text using induced sorting (SA-IS)
+ * The last character of the text must be a unique sentinel of value 0
+ * The reduced text of the LMS substrings is sorted recursively and is stored
+ * at the end of the suffix array, which is at most half the size of the text
+ * Returns 1 on success or -1 on error
+ */
+int assorted_suffix_array_sort(
+     const int32_t *text,
+     int32_t text_size,
+     int32_t alphabet_size,
+     int32_t *suffix_array,
+     libcerror_error_t **error )
+{
+	int32_t *buckets            = NULL;
+	int32_t *reduced_text       = NULL;
+	uint8_t *types              = NULL;
+	static char *function       = "assorted_suffix_array_sort";
+	int32_t character_index     = 0;
+	int32_t lms_index           = 0;
+	int32_t name                = 0;
+	int32_t number_of_lms       = 0;
+	int32_t previous_text_index = 0;
+	int32_t suffix_index        = 0;
+	int32_t text_index          = 0;
+	uint8_t is_different        = 0;
+
+	if( text_size == 1 )
+	{
+		suffix_array[ 0 ] = 0;
+
+		return( 1 );
+	}
+	types = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * text_size );
+
+	if( types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create types.",
+		 function );
+
+		goto on_error;
+	}
+	buckets = (int32_t *) memory_allocate(
+	                       sizeof( int32_t ) * alphabet_size );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	/* A suffix is S-type if it is smaller than the next suffix and L-type otherwise
+	 * The sentinel is S-type and hence the suffix before it is L-type
+	 */
+	types[ text_size - 1 ] = ASSORTED_SUFFIX_ARRAY_TYPE_S;
+	types[ text_size - 2 ] = ASSORTED_SUFFIX_ARRAY_TYPE_L;
+
+	for( text_index = text_size - 3;
+	     text_index >= 0;
+	     text_index-- )
+	{
+		if( ( text[ text_index ] < text[ text_index + 1 ] )
+		 || ( ( text[ text_index ] == text[ text_index + 1 ] )
+		  &&  ( types[ text_index + 1 ] == ASSORTED_SUFFIX_ARRAY_TYPE_S ) ) )
+		{
+			types[ text_index ] = ASSORTED_SUFFIX_ARRAY_TYPE_S;
+		}
+		else
+		{
+			types[ text_index ] = ASSORTED_SUFFIX_ARRAY_TYPE_L;
+		}
+	}
+	/* Sort the LMS substrings by placing the LMS suffixes at the end of their buckets
+	 * and inducing the order of the other suffixes
+	 */
+	assorted_suffix_array_get_buckets(
+	 text,
+	 text_size,
+	 alphabet_size,
+	 buckets,
+	 1 );
+
+	for( suffix_index = 0;
+	     suffix_index < text_size;
+	     suffix_index++ )
+	{
+		suffix_array[ suffix_index ] = -1;
+	}
+	for( text_index = 1;
+	     text_index < text_size;
+	     text_index++ )
+	{
+		if( assorted_suffix_array_is_lms( types, text_index ) )
+		{
+			suffix_array[ --buckets[ text[ text_index ] ] ] = text_index;
+		}
+	}
+	assorted_suffix_array_induce(
+	 text,
+	 types,
+	 text_size,
+	 alphabet_size,
+	 buckets,
+	 suffix_array );
+
+	/* Move the sorted LMS substrings to the front of the suffix array
+	 */
+	for( suffix_index = 0;
+	     suffix_index < text_size;
+	     suffix_index++ )
+	{
+		text_index = suffix_array[ suffix_index ];
+
+		if( assorted_suffix_array_is_lms( types, text_index ) )
+		{
+			suffix_array[ number_of_lms++ ] = text_index;
+		}
+	}
+	for( suffix_index = number_of_lms;
+	     suffix_index < text_size;
+	     suffix_index++ )
+	{
+		suffix_array[ suffix_index ] = -1;
+	}
+	/* Name the LMS substrings, equal substrings get the same name, the name
+	 * is stored at half the text index since LMS suffixes are at least 2 apart
+	 */
+	previous_text_index = -1;
+
+	for( suffix_index = 0;
+	     suffix_index < number_of_lms;
+	     suffix_index++ )
+	{
+		text_index   = suffix_array[ suffix_index ];
+		is_different = 0;
+
+		for( character_index = 0;
+		     character_index < text_size;
+		     character_index++ )
+		{
+			if( ( previous_text_index == -1 )
+			 || ( text[ text_index + character_index ] != text[ previous_text_index + character_index ] )
+			 || ( types[ text_index + character_index ] != types[ previous_text_index + character_index ] ) )
+			{
+				is_different = 1;
+
+				break;
+			}
+			else if( ( character_index > 0 )
+			      && ( ( assorted_suffix_array_is_lms( types, text_index + character_index ) )
+			       ||  ( assorted_suffix_array_is_lms( types, previous_text_index + character_index ) ) ) )
+			{
+				break;
+			}
+		}
+		if( is_different != 0 )
+		{
+			name++;
+
+			previous_text_index = text_index;
+		}
+		suffix_array[ number_of_lms + ( text_index / 2 ) ] = name - 1;
+	}
+	suffix_index = text_size - 1;
+
+	for( lms_index = text_size - 1;
+	     lms_index >= number_of_lms;
+	     lms_index-- )
+	{
+		if( suffix_array[ lms_index ] >= 0 )
+		{
+			suffix_array[ suffix_index-- ] = suffix_array[ lms_index ];
+		}
+	}
+	/* Sort the suffixes of the reduced text, recursively if the names are not unique
+	 */
+	reduced_text = &( suffix_array[ text_size - number_of_lms ] );
+
+	if( name < number_of_lms )
+	{
+		if( assorted_suffix_array_sort(
+		     reduced_text,
+		     number_of_lms,
+		     name,
+		     suffix_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort reduced text.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		for( lms_index = 0;
+		     lms_index < number_of_lms;
+		     lms_index++ )
+		{
+			suffix_array[ reduced_text[ lms_index ] ] = lms_index;
+		}
+	}
+	/* Map the sorted reduced suffixes to the LMS suffixes and induce the order
+	 * of the other suffixes from them
+	 */
+	lms_index = 0;
+
+	for( text_index = 1;
+	     text_index < text_size;
+	     text_index++ )
+	{
+		if( assorted_suffix_array_is_lms( types, text_index ) )
+		{
+			reduced_text[ lms_index++ ] = text_index;
+		}
+	}
+	for( suffix_index = 0;
+	     suffix_index < number_of_lms;
+	     suffix_index++ )
+	{
+		suffix_array[ suffix_index ] = reduced_text[ suffix_array[ suffix_index ] ];
+	}
+	for( suffix_index = number_of_lms;
+	     suffix_index < text_size;
+	     suffix_index++ )
+	{
+		suffix_array[ suffix_index ] = -1;
+	}
+	assorted_suffix_array_get_buckets(
+	 text,
+	 text_size,
+	 alphabet_size,
+	 buckets,
+	 1 );
+
+	for( suffix_index = number_of_lms - 1;
+	     suffix_index >= 0;
+	     suffix_index-- )
+	{
+		text_index = suffix_array[ suffix_index ];
+
+		suffix_array[ suffix_index ] = -1;
+
+		suffix_array[ --buckets[ text[ text_index ] ] ] = text_index;
+	}
+	assorted_suffix_array_induce(
+	 text,
+	 types,
+	 text_size,
+	 alphabet_size,
+	 buckets,
+	 suffix_array );
+
+	memory_free(
+	 buckets );
+
+	memory_free(
+	 types );
+
+	return( 1 );
+
+on_error:
+	if( buckets != NULL )
+	{
+		memory_free(
+		 buckets );
+	}
+	if( types != NULL )
+	{
+		memory_free(
+		 types );
+	}
+	return( -1 );
+}
+
+/* Builds the suffix array of a text in linear time
+ * The characters of the text must be in the range 1 to alphabet size - 1
+ * except for the last character, which must be a sentinel of value 0
+ * Returns 1 on success or -1 on error
+ */
+int assorted_suffix_array_build(
+     const int32_t *text,
+     size_t text_size,
+     int32_t alphabet_size,
+     int32_t *suffix_array,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_suffix_array_build";
+	size_t text_index     = 0;
+
+	if( text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( text_size == 0 )
+	 || ( text_size > (size_t) INT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid text size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( alphabet_size < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid alphabet size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( suffix_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid suffix array.",
+		 function );
+
+		return( -1 );
+	}
+	if( text[ text_size - 1 ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported text - missing sentinel.",
+		 function );
+
+		return( -1 );
+	}
+	for( text_index = 0;
+	     text_index < ( text_size - 1 );
+	     text_index++ )
+	{
+		if( ( text[ text_index ] < 1 )
+		 || ( text[ text_index ] >= alphabet_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid text - character: %" PRIzd " value out of bounds.",
+			 function,
+			 text_index );
+
+			return( -1 );
+		}
+	}
+	if( assorted_suffix_array_sort(
+	     text,
+	     (int32_t) text_size,
+	     alphabet_size,
+	     suffix_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort suffixes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,68 @@
+/*
+ * Suffix array functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_SUFFIX_ARRAY_H )
+#define _ASSORTED_SUFFIX_ARRAY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+void assorted_suffix_array_get_buckets(
+      const int32_t *text,
+      int32_t text_size,
+      int32_t alphabet_size,
+      int32_t *buckets,
+      uint8_t end_of_buckets );
+
+void assorted_suffix_array_induce(
+      const int32_t *text,
+      const uint8_t *types,
+      int32_t text_size,
+      int32_t alphabet_size,
+      int32_t *buckets,
+      int32_t *suffix_array );
+
+int assorted_suffix_array_sort(
+     const int32_t *text,
+     int32_t text_size,
+     int32_t alphabet_size,
+     int32_t *suffix_array,
+     libcerror_error_t **error );
+
+int assorted_suffix_array_build(
+     const int32_t *text,
+     size_t text_size,
+     int32_t alphabet_size,
+     int32_t *suffix_array,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_SUFFIX_ARRAY_H ) */
+
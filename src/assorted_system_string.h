@@ -37,6 +37,18 @@ extern "C" {
 	atol( string )
 #endif
 
+/* Converts a string to a 64-bit value, where the base is determined by the prefix
+ * such as 0x for hexadecimal, since values with the most significant bit set
+ * cannot be represented by a long
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define system_string_copy_to_64bit( string ) \
+	(uint64_t) _wcstoui64( string, NULL, 0 )
+#else
+#define system_string_copy_to_64bit( string ) \
+	(uint64_t) strtoull( string, NULL, 0 )
+#endif
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1055 @@
+/*
+ * Work stealing thread pool functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_thread_pool.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a thread pool
+ * Every thread has its own queue, values are pushed onto the queues in turn
+ * and a thread that has no values in its own queue takes values from the
+ * queues of the other threads. At most maximum_number_of_values values are
+ * pushed and not finished, or with ordered completion not retrieved,
+ * pushing more values blocks until values are finished or retrieved
+ * Make sure the value thread_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_thread_pool_create(
+     assorted_thread_pool_t **thread_pool,
+     int number_of_threads,
+     int maximum_number_of_values,
+     int (*callback_function)( intptr_t *value, void *arguments ),
+     void *callback_function_arguments,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	assorted_thread_pool_worker_t *worker = NULL;
+	static char *function                 = "assorted_thread_pool_create";
+	int number_of_started_threads         = 0;
+	int worker_index                      = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > ASSORTED_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_values < 1 )
+	 || ( (size_t) maximum_number_of_values > (size_t) ( SSIZE_MAX / ( (size_t) number_of_threads * sizeof( uint64_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	*thread_pool = memory_allocate_structure(
+	                assorted_thread_pool_t );
+
+	if( *thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *thread_pool,
+	     0,
+	     sizeof( assorted_thread_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread pool.",
+		 function );
+
+		memory_free(
+		 *thread_pool );
+
+		*thread_pool = NULL;
+
+		return( -1 );
+	}
+	( *thread_pool )->flags                       = flags;
+	( *thread_pool )->number_of_threads           = number_of_threads;
+	( *thread_pool )->maximum_number_of_values    = maximum_number_of_values;
+	( *thread_pool )->callback_function           = callback_function;
+	( *thread_pool )->callback_function_arguments = callback_function_arguments;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *thread_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *thread_pool )->queued_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create queued condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *thread_pool )->finished_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create finished condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( flags & ASSORTED_THREAD_POOL_FLAG_ORDERED_COMPLETION ) != 0 )
+	{
+		( *thread_pool )->completed_values = (intptr_t **) memory_allocate(
+		                                                    sizeof( intptr_t * ) * maximum_number_of_values );
+
+		if( ( *thread_pool )->completed_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create completed values.",
+			 function );
+
+			goto on_error;
+		}
+		( *thread_pool )->completed_flags = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * maximum_number_of_values );
+
+		if( ( *thread_pool )->completed_flags == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create completed flags.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *thread_pool )->completed_flags,
+		     0,
+		     sizeof( uint8_t ) * maximum_number_of_values ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear completed flags.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *thread_pool )->workers = (assorted_thread_pool_worker_t *) memory_allocate(
+	                                                               sizeof( assorted_thread_pool_worker_t ) * number_of_threads );
+
+	if( ( *thread_pool )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *thread_pool )->workers,
+	     0,
+	     sizeof( assorted_thread_pool_worker_t ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 ( *thread_pool )->workers );
+
+		( *thread_pool )->workers = NULL;
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		worker = &( ( *thread_pool )->workers[ worker_index ] );
+
+		worker->thread_pool = *thread_pool;
+
+		if( libcthreads_mutex_initialize(
+		     &( worker->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d mutex.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		/* A single queue can contain all the values that are not finished
+		 */
+		worker->values = (intptr_t **) memory_allocate(
+		                                sizeof( intptr_t * ) * maximum_number_of_values );
+
+		if( worker->values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create worker: %d values.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		worker->sequence_numbers = (uint64_t *) memory_allocate(
+		                                         sizeof( uint64_t ) * maximum_number_of_values );
+
+		if( worker->sequence_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create worker: %d sequence numbers.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		worker = &( ( *thread_pool )->workers[ worker_index ] );
+
+		if( libcthreads_thread_create(
+		     &( worker->thread ),
+		     NULL,
+		     (int (*)(void *)) &assorted_thread_pool_worker_callback,
+		     (void *) worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d thread.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		number_of_started_threads++;
+	}
+	return( 1 );
+
+on_error:
+	if( *thread_pool != NULL )
+	{
+		/* The join skips the workers of which the thread was not started
+		 */
+		if( number_of_started_threads > 0 )
+		{
+			assorted_thread_pool_join(
+			 thread_pool,
+			 NULL );
+		}
+		else
+		{
+			assorted_thread_pool_free(
+			 thread_pool,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Frees a thread pool
+ * The threads of the thread pool must have been joined
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_thread_pool_free(
+     assorted_thread_pool_t **thread_pool,
+     libcerror_error_t **error )
+{
+	assorted_thread_pool_worker_t *worker = NULL;
+	static char *function                 = "assorted_thread_pool_free";
+	int result                            = 1;
+	int worker_index                      = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+		if( ( *thread_pool )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *thread_pool )->number_of_threads;
+			     worker_index++ )
+			{
+				worker = &( ( *thread_pool )->workers[ worker_index ] );
+
+				if( worker->mutex != NULL )
+				{
+					if( libcthreads_mutex_free(
+					     &( worker->mutex ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free worker: %d mutex.",
+						 function,
+						 worker_index );
+
+						result = -1;
+					}
+				}
+				if( worker->values != NULL )
+				{
+					memory_free(
+					 worker->values );
+				}
+				if( worker->sequence_numbers != NULL )
+				{
+					memory_free(
+					 worker->sequence_numbers );
+				}
+			}
+			memory_free(
+			 ( *thread_pool )->workers );
+		}
+		if( ( *thread_pool )->completed_flags != NULL )
+		{
+			memory_free(
+			 ( *thread_pool )->completed_flags );
+		}
+		if( ( *thread_pool )->completed_values != NULL )
+		{
+			memory_free(
+			 ( *thread_pool )->completed_values );
+		}
+		if( ( *thread_pool )->finished_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *thread_pool )->finished_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free finished condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *thread_pool )->queued_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *thread_pool )->queued_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free queued condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *thread_pool )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *thread_pool )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *thread_pool );
+
+		*thread_pool = NULL;
+	}
+	return( result );
+}
+
+/* Takes the first value from the queue of a worker
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+int assorted_thread_pool_worker_take_value(
+     assorted_thread_pool_worker_t *worker,
+     intptr_t **value,
+     uint64_t *sequence_number )
+{
+	int result = 0;
+
+	if( ( worker == NULL )
+	 || ( value == NULL )
+	 || ( sequence_number == NULL ) )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( worker->number_of_values > 0 )
+	{
+		*value           = worker->values[ worker->first_index ];
+		*sequence_number = worker->sequence_numbers[ worker->first_index ];
+
+		worker->first_index      = ( worker->first_index + 1 ) % worker->thread_pool->maximum_number_of_values;
+		worker->number_of_values -= 1;
+
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Processes values until the thread pool is joined and all values are processed
+ * A value is claimed from the number of queued values first, so that a value
+ * is available in one of the queues, and then taken from the queue of the
+ * worker or, if that is empty, from the queue of another worker
+ * The error is not available from the worker thread, the callback function
+ * is expected to store its result with the value
+ * Returns 1 on success or -1 on error
+ */
+int assorted_thread_pool_worker_callback(
+     assorted_thread_pool_worker_t *worker )
+{
+	assorted_thread_pool_t *thread_pool = NULL;
+	intptr_t *value                     = NULL;
+	uint64_t sequence_number            = 0;
+	int result                          = 0;
+	int value_index                     = 0;
+	int worker_index                    = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	thread_pool = worker->thread_pool;
+
+	do
+	{
+		if( libcthreads_mutex_grab(
+		     thread_pool->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		while( ( thread_pool->number_of_queued_values == 0 )
+		    && ( thread_pool->is_joining == 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     thread_pool->queued_condition,
+			     thread_pool->mutex,
+			     NULL ) != 1 )
+			{
+				libcthreads_mutex_release(
+				 thread_pool->mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( thread_pool->number_of_queued_values == 0 )
+		{
+			if( libcthreads_mutex_release(
+			     thread_pool->mutex,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+			break;
+		}
+		thread_pool->number_of_queued_values -= 1;
+
+		if( libcthreads_mutex_release(
+		     thread_pool->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		worker_index = (int) ( worker - thread_pool->workers );
+
+		do
+		{
+			result = assorted_thread_pool_worker_take_value(
+			          &( thread_pool->workers[ worker_index ] ),
+			          &value,
+			          &sequence_number );
+
+			if( result == -1 )
+			{
+				return( -1 );
+			}
+			worker_index = ( worker_index + 1 ) % thread_pool->number_of_threads;
+		}
+		while( result == 0 );
+
+		thread_pool->callback_function(
+		 value,
+		 thread_pool->callback_function_arguments );
+
+		if( libcthreads_mutex_grab(
+		     thread_pool->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( thread_pool->flags & ASSORTED_THREAD_POOL_FLAG_ORDERED_COMPLETION ) != 0 )
+		{
+			value_index = (int) ( sequence_number % (uint64_t) thread_pool->maximum_number_of_values );
+
+			thread_pool->completed_values[ value_index ] = value;
+			thread_pool->completed_flags[ value_index ]  = 1;
+
+			result = ( sequence_number == thread_pool->pop_sequence_number );
+		}
+		else
+		{
+			thread_pool->number_of_values -= 1;
+
+			result = 1;
+		}
+		if( result != 0 )
+		{
+			if( libcthreads_condition_broadcast(
+			     thread_pool->finished_condition,
+			     NULL ) != 1 )
+			{
+				libcthreads_mutex_release(
+				 thread_pool->mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( libcthreads_mutex_release(
+		     thread_pool->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	while( 1 );
+
+	return( 1 );
+}
+
+/* Pushes a value onto the thread pool
+ * Blocks while the maximum number of values are pushed and not finished,
+ * or with ordered completion not retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_thread_pool_push(
+     assorted_thread_pool_t *thread_pool,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	assorted_thread_pool_worker_t *worker = NULL;
+	static char *function                 = "assorted_thread_pool_push";
+	uint64_t sequence_number              = 0;
+	int value_index                       = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     thread_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( thread_pool->number_of_values >= thread_pool->maximum_number_of_values )
+	{
+		if( libcthreads_condition_wait(
+		     thread_pool->finished_condition,
+		     thread_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for finished condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	sequence_number = thread_pool->push_sequence_number;
+	worker          = &( thread_pool->workers[ thread_pool->push_worker_index ] );
+
+	thread_pool->push_sequence_number += 1;
+	thread_pool->push_worker_index     = ( thread_pool->push_worker_index + 1 ) % thread_pool->number_of_threads;
+	thread_pool->number_of_values     += 1;
+
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab worker mutex.",
+		 function );
+
+		goto on_error;
+	}
+	value_index = ( worker->first_index + worker->number_of_values ) % thread_pool->maximum_number_of_values;
+
+	worker->values[ value_index ]           = value;
+	worker->sequence_numbers[ value_index ] = sequence_number;
+	worker->number_of_values               += 1;
+
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release worker mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* The value is only claimable after it has been added to a queue
+	 */
+	thread_pool->number_of_queued_values += 1;
+
+	if( libcthreads_condition_signal(
+	     thread_pool->queued_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to signal queued condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     thread_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 thread_pool->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the next completed value in the order the values were pushed
+ * Blocks until the value is completed
+ * Returns 1 if successful, 0 if no values are pushed and not retrieved or -1 on error
+ */
+int assorted_thread_pool_pop_completed(
+     assorted_thread_pool_t *thread_pool,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_thread_pool_pop_completed";
+	int result            = 0;
+	int value_index       = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( thread_pool->flags & ASSORTED_THREAD_POOL_FLAG_ORDERED_COMPLETION ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid thread pool - missing ordered completion flag.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     thread_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_pool->number_of_values > 0 )
+	{
+		value_index = (int) ( thread_pool->pop_sequence_number % (uint64_t) thread_pool->maximum_number_of_values );
+
+		while( thread_pool->completed_flags[ value_index ] == 0 )
+		{
+			if( libcthreads_condition_wait(
+			     thread_pool->finished_condition,
+			     thread_pool->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for finished condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		*value = thread_pool->completed_values[ value_index ];
+
+		thread_pool->completed_flags[ value_index ] = 0;
+		thread_pool->pop_sequence_number           += 1;
+		thread_pool->number_of_values              -= 1;
+
+		/* Wake a push that waits for the number of values to decrease
+		 */
+		if( libcthreads_condition_broadcast(
+		     thread_pool->finished_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast finished condition.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     thread_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 thread_pool->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Joins the threads of a thread pool and frees the thread pool
+ * The values that are pushed are processed before the threads stop,
+ * completed values that are not retrieved are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_thread_pool_join(
+     assorted_thread_pool_t **thread_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_thread_pool_join";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     ( *thread_pool )->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		( *thread_pool )->is_joining = 1;
+
+		if( libcthreads_condition_broadcast(
+		     ( *thread_pool )->queued_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast queued condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     ( *thread_pool )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < ( *thread_pool )->number_of_threads;
+	     worker_index++ )
+	{
+		if( ( *thread_pool )->workers[ worker_index ].thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( ( *thread_pool )->workers[ worker_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join worker: %d thread.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	if( assorted_thread_pool_free(
+	     thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free thread pool.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
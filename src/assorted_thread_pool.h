@@ -0,0 +1,203 @@
+/*
+ * Work stealing thread pool functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_THREAD_POOL_H )
+#define _ASSORTED_THREAD_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of threads of a thread pool
+ */
+#define ASSORTED_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* The number of values per thread that are kept in a thread pool
+ * when the number of values grows with the size of the input
+ */
+#define ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD	16
+
+enum ASSORTED_THREAD_POOL_FLAGS
+{
+	/* The values are retrieved with assorted_thread_pool_pop_completed
+	 * in the order they were pushed
+	 */
+	ASSORTED_THREAD_POOL_FLAG_ORDERED_COMPLETION	= 0x01
+};
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct assorted_thread_pool_worker assorted_thread_pool_worker_t;
+typedef struct assorted_thread_pool assorted_thread_pool_t;
+
+struct assorted_thread_pool_worker
+{
+	/* The thread pool
+	 */
+	assorted_thread_pool_t *thread_pool;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The mutex that protects the queue
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The queue values, a circular buffer of maximum number of values entries
+	 */
+	intptr_t **values;
+
+	/* The queue sequence numbers, used for ordered completion
+	 */
+	uint64_t *sequence_numbers;
+
+	/* The index of the first value in the queue
+	 */
+	int first_index;
+
+	/* The number of values in the queue
+	 */
+	int number_of_values;
+};
+
+struct assorted_thread_pool
+{
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The workers, one per thread
+	 */
+	assorted_thread_pool_worker_t *workers;
+
+	/* The maximum number of values that are pushed and not finished
+	 * or with ordered completion not retrieved
+	 */
+	int maximum_number_of_values;
+
+	/* The callback function that processes a value
+	 */
+	int (*callback_function)( intptr_t *value, void *arguments );
+
+	/* The callback function arguments
+	 */
+	void *callback_function_arguments;
+
+	/* The mutex that protects the counts, the completion status and the status
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals values are queued or the pool is joined
+	 */
+	libcthreads_condition_t *queued_condition;
+
+	/* The condition that signals values are finished or retrieved
+	 */
+	libcthreads_condition_t *finished_condition;
+
+	/* The number of values that are pushed and not finished
+	 * or with ordered completion not retrieved
+	 */
+	int number_of_values;
+
+	/* The number of queued values that are not yet claimed by a worker
+	 */
+	int number_of_queued_values;
+
+	/* The index of the worker the next value is pushed to
+	 */
+	int push_worker_index;
+
+	/* The sequence number of the next value that is pushed
+	 */
+	uint64_t push_sequence_number;
+
+	/* The sequence number of the next value that is retrieved
+	 */
+	uint64_t pop_sequence_number;
+
+	/* The completed values, indexed by sequence number modulo the maximum number of values
+	 */
+	intptr_t **completed_values;
+
+	/* Values to indicate the completed values are completed
+	 */
+	uint8_t *completed_flags;
+
+	/* Value to indicate the thread pool is being joined
+	 */
+	uint8_t is_joining;
+};
+
+int assorted_thread_pool_create(
+     assorted_thread_pool_t **thread_pool,
+     int number_of_threads,
+     int maximum_number_of_values,
+     int (*callback_function)( intptr_t *value, void *arguments ),
+     void *callback_function_arguments,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int assorted_thread_pool_free(
+     assorted_thread_pool_t **thread_pool,
+     libcerror_error_t **error );
+
+int assorted_thread_pool_worker_take_value(
+     assorted_thread_pool_worker_t *worker,
+     intptr_t **value,
+     uint64_t *sequence_number );
+
+int assorted_thread_pool_worker_callback(
+     assorted_thread_pool_worker_t *worker );
+
+int assorted_thread_pool_push(
+     assorted_thread_pool_t *thread_pool,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int assorted_thread_pool_pop_completed(
+     assorted_thread_pool_t *thread_pool,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int assorted_thread_pool_join(
+     assorted_thread_pool_t **thread_pool,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_THREAD_POOL_H ) */
+
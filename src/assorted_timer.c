@@ -0,0 +1,82 @@
+/*
+ * Timer functions for benchmarking
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <x86intrin.h>
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#include <intrin.h>
+
+#endif
+
+#include "assorted_timer.h"
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ * Falls back to the processor time if no monotonic clock is available
+ */
+uint64_t assorted_timer_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceCounter(
+	 &counter );
+	QueryPerformanceFrequency(
+	 &frequency );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &time_value );
+
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( (uint64_t) ( ( (double) clock() * 1000000000.0 ) / (double) CLOCKS_PER_SEC ) );
+
+#endif
+}
+
+/* Retrieves the current value of the cycle counter
+ * Returns 0 if not available
+ */
+uint64_t assorted_timer_get_cycles(
+          void )
+{
+#if defined( ASSORTED_TIMER_HAVE_CYCLE_COUNTER )
+	return( (uint64_t) __rdtsc() );
+#else
+	return( 0 );
+#endif
+}
+
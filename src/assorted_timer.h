@@ -0,0 +1,53 @@
+/*
+ * Timer functions for benchmarking
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#if !defined( _ASSORTED_TIMER_H )
+#define _ASSORTED_TIMER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The time stamp counter is used as cycle counter, note that on most modern
+ * CPUs it counts at a constant reference rate instead of the core clock rate
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define ASSORTED_TIMER_HAVE_CYCLE_COUNTER	1
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#define ASSORTED_TIMER_HAVE_CYCLE_COUNTER	1
+
+#endif
+
+uint64_t assorted_timer_get_time(
+          void );
+
+uint64_t assorted_timer_get_cycles(
+          void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_TIMER_H ) */
+
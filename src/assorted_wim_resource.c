@@ -0,0 +1,720 @@
+/*
+ * WIM resource decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_libfwnt.h"
+#include "assorted_lzxpress_huffman.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+#include "assorted_wim_resource.h"
+
+/* Retrieves the number of chunks of a compressed WIM resource
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_wim_resource_get_number_of_chunks(
+     size64_t uncompressed_size,
+     size_t *number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_wim_resource_get_number_of_chunks";
+
+	if( uncompressed_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = (size_t) ( ( uncompressed_size + ASSORTED_WIM_RESOURCE_CHUNK_SIZE - 1 ) / ASSORTED_WIM_RESOURCE_CHUNK_SIZE );
+
+	return( 1 );
+}
+
+/* Determines the chunks of a compressed WIM resource
+ * The resource starts with a chunk table with the offsets of the chunks, except
+ * for the first chunk, relative to the end of the chunk table. The entries are
+ * 8 bytes in size if the uncompressed size exceeds 4 GiB and 4 bytes otherwise.
+ * Every chunk, except for the last, decompresses into ASSORTED_WIM_RESOURCE_CHUNK_SIZE
+ * bytes hence the uncompressed data of a chunk is assigned at chunk index * ASSORTED_WIM_RESOURCE_CHUNK_SIZE
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_wim_resource_get_chunks(
+     const uint8_t *resource_data,
+     size_t resource_data_size,
+     int compression_method,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     assorted_wim_resource_chunk_t *chunks,
+     size_t number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function           = "assorted_wim_resource_get_chunks";
+	size_t chunk_data_end_offset    = 0;
+	size_t chunk_data_offset        = 0;
+	size_t chunk_index              = 0;
+	size_t chunk_table_size         = 0;
+	size_t expected_number_of_chunks = 0;
+	size_t uncompressed_data_offset = 0;
+	uint64_t chunk_offset           = 0;
+	uint8_t entry_size              = 4;
+
+	if( resource_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource data.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid resource data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_method != ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS )
+	 && ( compression_method != ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_LZX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_wim_resource_get_number_of_chunks(
+	     (size64_t) uncompressed_data_size,
+	     &expected_number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunks == 0 )
+	 || ( number_of_chunks != expected_number_of_chunks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_SIZE_T > 4
+	if( uncompressed_data_size > (size_t) UINT32_MAX )
+	{
+		entry_size = 8;
+	}
+#endif
+	chunk_table_size = ( number_of_chunks - 1 ) * entry_size;
+
+	if( chunk_table_size > resource_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid resource data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( ( chunk_index + 1 ) < number_of_chunks )
+		{
+			if( entry_size == 4 )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( resource_data[ chunk_index * 4 ] ),
+				 chunk_offset );
+			}
+			else
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( resource_data[ chunk_index * 8 ] ),
+				 chunk_offset );
+			}
+			if( chunk_offset > (uint64_t) ( resource_data_size - chunk_table_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid chunk: %" PRIzd " offset value out of bounds.",
+				 function,
+				 chunk_index + 1 );
+
+				return( -1 );
+			}
+			chunk_data_end_offset = chunk_table_size + (size_t) chunk_offset;
+		}
+		else
+		{
+			chunk_data_end_offset = resource_data_size;
+		}
+		if( chunk_index == 0 )
+		{
+			chunk_data_offset = chunk_table_size;
+		}
+		if( chunk_data_end_offset <= chunk_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %" PRIzd " size value out of bounds.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		chunks[ chunk_index ].compressed_data        = &( resource_data[ chunk_data_offset ] );
+		chunks[ chunk_index ].compressed_data_size   = chunk_data_end_offset - chunk_data_offset;
+		chunks[ chunk_index ].uncompressed_data      = &( uncompressed_data[ uncompressed_data_offset ] );
+		chunks[ chunk_index ].uncompressed_data_size = uncompressed_data_size - uncompressed_data_offset;
+		chunks[ chunk_index ].compression_method     = compression_method;
+		chunks[ chunk_index ].result                 = 0;
+
+		if( chunks[ chunk_index ].uncompressed_data_size > ASSORTED_WIM_RESOURCE_CHUNK_SIZE )
+		{
+			chunks[ chunk_index ].uncompressed_data_size = ASSORTED_WIM_RESOURCE_CHUNK_SIZE;
+		}
+		chunk_data_offset         = chunk_data_end_offset;
+		uncompressed_data_offset += chunks[ chunk_index ].uncompressed_data_size;
+	}
+	return( 1 );
+}
+
+/* Decompresses a chunk
+ * A chunk that did not compress is stored as-is, which is the case
+ * if the compressed data size equals the uncompressed data size
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_wim_resource_decompress_chunk(
+     assorted_wim_resource_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function         = "assorted_wim_resource_decompress_chunk";
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->compressed_data_size == chunk->uncompressed_data_size )
+	{
+		if( memory_copy(
+		     chunk->uncompressed_data,
+		     chunk->compressed_data,
+		     chunk->uncompressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed chunk.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	uncompressed_data_size = chunk->uncompressed_data_size;
+
+	if( chunk->compression_method == ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS )
+	{
+		result = assorted_lzxpress_huffman_decompress(
+		          chunk->compressed_data,
+		          chunk->compressed_data_size,
+		          chunk->uncompressed_data,
+		          &uncompressed_data_size,
+		          error );
+	}
+	else if( chunk->compression_method == ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_LZX )
+	{
+		result = libfwnt_lzx_decompress(
+		          chunk->compressed_data,
+		          chunk->compressed_data_size,
+		          chunk->uncompressed_data,
+		          &uncompressed_data_size,
+		          error );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size != chunk->uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses chunks
+ * The result of every chunk is stored in the chunk
+ * Returns 1 if all chunks were decompressed, 0 if not or -1 on error
+ */
+int assorted_wim_resource_decompress_chunks(
+     assorted_wim_resource_chunk_t *chunks,
+     size_t number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_wim_resource_decompress_chunks";
+	size_t chunk_index    = 0;
+	int result            = 1;
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks > (size_t) ( SSIZE_MAX / sizeof( assorted_wim_resource_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunks[ chunk_index ].result = assorted_wim_resource_decompress_chunk(
+		                                &( chunks[ chunk_index ] ),
+		                                NULL );
+
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the chunks of a task from a thread pool
+ * The error is not available from the worker thread, the result is stored in the chunks
+ * Returns 1 on success or -1 on error
+ */
+int assorted_wim_resource_decompress_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	assorted_wim_resource_task_t *task = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	task = (assorted_wim_resource_task_t *) value;
+
+	if( assorted_wim_resource_decompress_chunks(
+	     task->chunks,
+	     task->number_of_chunks,
+	     NULL ) == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses a compressed WIM resource with the chunks decompressed in parallel
+ * The chunks are compressed independently hence the chunk table provides
+ * the compressed data of every chunk and the uncompressed data is preallocated
+ * Returns 1 on success or -1 on error
+ */
+int assorted_wim_resource_decompress(
+     const uint8_t *resource_data,
+     size_t resource_data_size,
+     int compression_method,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	assorted_wim_resource_chunk_t *chunks  = NULL;
+	static char *function                  = "assorted_wim_resource_decompress";
+	size_t chunk_index                     = 0;
+	size_t number_of_chunks                = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_wim_resource_task_t *tasks    = NULL;
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+	size_t number_of_chunks_per_task       = 0;
+	size_t number_of_tasks                 = 0;
+	size_t task_index                      = 0;
+#endif
+
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_wim_resource_get_number_of_chunks(
+	     (size64_t) uncompressed_data_size,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == 0 )
+	{
+		return( 1 );
+	}
+	if( number_of_chunks > (size_t) ( SSIZE_MAX / sizeof( assorted_wim_resource_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	chunks = (assorted_wim_resource_chunk_t *) memory_allocate(
+	                                            sizeof( assorted_wim_resource_chunk_t ) * number_of_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_wim_resource_get_chunks(
+	     resource_data,
+	     resource_data_size,
+	     compression_method,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     chunks,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunks.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		number_of_chunks_per_task = ( number_of_chunks + number_of_threads - 1 ) / number_of_threads;
+
+		if( number_of_chunks_per_task > ASSORTED_WIM_RESOURCE_NUMBER_OF_CHUNKS_PER_TASK )
+		{
+			number_of_chunks_per_task = ASSORTED_WIM_RESOURCE_NUMBER_OF_CHUNKS_PER_TASK;
+		}
+		number_of_tasks = ( number_of_chunks + number_of_chunks_per_task - 1 ) / number_of_chunks_per_task;
+	}
+	if( number_of_tasks > 1 )
+	{
+		if( number_of_tasks > (size_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of tasks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		tasks = (assorted_wim_resource_task_t *) memory_allocate(
+		                                          sizeof( assorted_wim_resource_task_t ) * number_of_tasks );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			chunk_index = task_index * number_of_chunks_per_task;
+
+			tasks[ task_index ].chunks           = &( chunks[ chunk_index ] );
+			tasks[ task_index ].number_of_chunks = number_of_chunks - chunk_index;
+
+			if( tasks[ task_index ].number_of_chunks > number_of_chunks_per_task )
+			{
+				tasks[ task_index ].number_of_chunks = number_of_chunks_per_task;
+			}
+		}
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = (int) number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &assorted_wim_resource_decompress_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %" PRIzd " onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 tasks );
+
+		tasks = NULL;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the chunks are decompressed here, a chunk that
+	 * failed is decompressed again to retrieve the error
+	 */
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			chunks[ chunk_index ].result = assorted_wim_resource_decompress_chunk(
+			                                &( chunks[ chunk_index ] ),
+			                                error );
+		}
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk: %" PRIzd ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 chunks );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( tasks != NULL )
+	{
+		memory_free(
+		 tasks );
+	}
+#endif
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
+	}
+	return( -1 );
+}
+
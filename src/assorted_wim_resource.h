@@ -0,0 +1,137 @@
+/*
+ * WIM resource decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_WIM_RESOURCE_H )
+#define _ASSORTED_WIM_RESOURCE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The uncompressed size of a WIM resource chunk
+ */
+#define ASSORTED_WIM_RESOURCE_CHUNK_SIZE			32768
+
+/* The maximum number of chunks that are decompressed per thread pool task
+ */
+#define ASSORTED_WIM_RESOURCE_NUMBER_OF_CHUNKS_PER_TASK		16
+
+enum ASSORTED_WIM_RESOURCE_COMPRESSION_METHODS
+{
+	ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_NONE	= 0,
+	ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS	= 1,
+	ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_LZX	= 2
+};
+
+typedef struct assorted_wim_resource_chunk assorted_wim_resource_chunk_t;
+
+struct assorted_wim_resource_chunk
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The compression method
+	 */
+	int compression_method;
+
+	/* The result of the chunk decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+typedef struct assorted_wim_resource_task assorted_wim_resource_task_t;
+
+struct assorted_wim_resource_task
+{
+	/* The first chunk of the task
+	 */
+	assorted_wim_resource_chunk_t *chunks;
+
+	/* The number of chunks of the task
+	 */
+	size_t number_of_chunks;
+};
+
+int assorted_wim_resource_get_number_of_chunks(
+     size64_t uncompressed_size,
+     size_t *number_of_chunks,
+     libcerror_error_t **error );
+
+int assorted_wim_resource_get_chunks(
+     const uint8_t *resource_data,
+     size_t resource_data_size,
+     int compression_method,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     assorted_wim_resource_chunk_t *chunks,
+     size_t number_of_chunks,
+     libcerror_error_t **error );
+
+int assorted_wim_resource_decompress_chunk(
+     assorted_wim_resource_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int assorted_wim_resource_decompress_chunks(
+     assorted_wim_resource_chunk_t *chunks,
+     size_t number_of_chunks,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_wim_resource_decompress_task_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_wim_resource_decompress(
+     const uint8_t *resource_data,
+     size_t resource_data_size,
+     int compression_method,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_WIM_RESOURCE_H ) */
+
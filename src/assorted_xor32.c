@@ -23,9 +23,18 @@
 #include <byte_stream.h>
 #include <types.h>
 
+#include "assorted_cpu_features.h"
 #include "assorted_libcerror.h"
 #include "assorted_xor32.h"
 
+#if defined( ASSORTED_XOR32_HAVE_AVX2 )
+#include <immintrin.h>
+
+#elif defined( ASSORTED_XOR32_HAVE_NEON )
+#include <arm_neon.h>
+
+#endif
+
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
  */
@@ -361,3 +370,279 @@ int assorted_xor32_calculate_checksum_little_endian_cpu_aligned(
 	return( 1 );
 }
 
+#if defined( ASSORTED_XOR32_HAVE_AVX2 )
+
+/* Calculates the little-endian XOR-32 of a buffer using AVX2, 64 bytes per iteration
+ * The buffer must be 32-byte aligned and the size a multiple of 64
+ * Returns the XOR-32
+ */
+__attribute__ ((target ("avx2"))) uint32_t assorted_xor32_simd_avx2(
+                                            const uint8_t *buffer,
+                                            size_t size )
+{
+	__m256i xor_256bit1 = _mm256_setzero_si256();
+	__m256i xor_256bit2 = _mm256_setzero_si256();
+	__m128i xor_128bit;
+
+	while( size > 0 )
+	{
+		xor_256bit1 = _mm256_xor_si256( xor_256bit1, _mm256_load_si256( (const __m256i *) buffer ) );
+		xor_256bit2 = _mm256_xor_si256( xor_256bit2, _mm256_load_si256( (const __m256i *) &( buffer[ 32 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	xor_256bit1 = _mm256_xor_si256( xor_256bit1, xor_256bit2 );
+
+	/* Fold the 256-bit value into a 32-bit value
+	 */
+	xor_128bit = _mm_xor_si128( _mm256_castsi256_si128( xor_256bit1 ), _mm256_extracti128_si256( xor_256bit1, 1 ) );
+	xor_128bit = _mm_xor_si128( xor_128bit, _mm_shuffle_epi32( xor_128bit, 0x4e ) );
+	xor_128bit = _mm_xor_si128( xor_128bit, _mm_shuffle_epi32( xor_128bit, 0xb1 ) );
+
+	return( (uint32_t) _mm_cvtsi128_si32( xor_128bit ) );
+}
+
+#endif /* defined( ASSORTED_XOR32_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_XOR32_HAVE_AVX512 )
+
+/* Calculates the little-endian XOR-32 of a buffer using AVX-512, 128 bytes per iteration
+ * The buffer must be 64-byte aligned and the size a multiple of 128
+ * Returns the XOR-32
+ */
+__attribute__ ((target ("avx512f"))) uint32_t assorted_xor32_simd_avx512(
+                                               const uint8_t *buffer,
+                                               size_t size )
+{
+	__m512i xor_512bit1 = _mm512_setzero_si512();
+	__m512i xor_512bit2 = _mm512_setzero_si512();
+	__m256i xor_256bit;
+	__m128i xor_128bit;
+
+	while( size > 0 )
+	{
+		xor_512bit1 = _mm512_xor_si512( xor_512bit1, _mm512_load_si512( (const void *) buffer ) );
+		xor_512bit2 = _mm512_xor_si512( xor_512bit2, _mm512_load_si512( (const void *) &( buffer[ 64 ] ) ) );
+
+		buffer += 128;
+		size   -= 128;
+	}
+	xor_512bit1 = _mm512_xor_si512( xor_512bit1, xor_512bit2 );
+
+	/* Fold the 512-bit value into a 32-bit value
+	 */
+	xor_256bit = _mm256_xor_si256( _mm512_castsi512_si256( xor_512bit1 ), _mm512_extracti64x4_epi64( xor_512bit1, 1 ) );
+	xor_128bit = _mm_xor_si128( _mm256_castsi256_si128( xor_256bit ), _mm256_extracti128_si256( xor_256bit, 1 ) );
+	xor_128bit = _mm_xor_si128( xor_128bit, _mm_shuffle_epi32( xor_128bit, 0x4e ) );
+	xor_128bit = _mm_xor_si128( xor_128bit, _mm_shuffle_epi32( xor_128bit, 0xb1 ) );
+
+	return( (uint32_t) _mm_cvtsi128_si32( xor_128bit ) );
+}
+
+#endif /* defined( ASSORTED_XOR32_HAVE_AVX512 ) */
+
+#if defined( ASSORTED_XOR32_HAVE_NEON )
+
+/* Calculates the little-endian XOR-32 of a buffer using NEON, 64 bytes per iteration
+ * The buffer must be 16-byte aligned and the size a multiple of 64
+ * Returns the XOR-32
+ */
+uint32_t assorted_xor32_simd_neon(
+          const uint8_t *buffer,
+          size_t size )
+{
+	uint32x4_t xor_128bit1 = vdupq_n_u32( 0 );
+	uint32x4_t xor_128bit2 = vdupq_n_u32( 0 );
+	uint32x4_t xor_128bit3 = vdupq_n_u32( 0 );
+	uint32x4_t xor_128bit4 = vdupq_n_u32( 0 );
+
+	while( size > 0 )
+	{
+		xor_128bit1 = veorq_u32( xor_128bit1, vld1q_u32( (const uint32_t *) buffer ) );
+		xor_128bit2 = veorq_u32( xor_128bit2, vld1q_u32( (const uint32_t *) &( buffer[ 16 ] ) ) );
+		xor_128bit3 = veorq_u32( xor_128bit3, vld1q_u32( (const uint32_t *) &( buffer[ 32 ] ) ) );
+		xor_128bit4 = veorq_u32( xor_128bit4, vld1q_u32( (const uint32_t *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	xor_128bit1 = veorq_u32( xor_128bit1, xor_128bit2 );
+	xor_128bit3 = veorq_u32( xor_128bit3, xor_128bit4 );
+	xor_128bit1 = veorq_u32( xor_128bit1, xor_128bit3 );
+
+	return( vgetq_lane_u32( xor_128bit1, 0 )
+	      ^ vgetq_lane_u32( xor_128bit1, 1 )
+	      ^ vgetq_lane_u32( xor_128bit1, 2 )
+	      ^ vgetq_lane_u32( xor_128bit1, 3 ) );
+}
+
+#endif /* defined( ASSORTED_XOR32_HAVE_NEON ) */
+
+/* Calculates the little-endian XOR-32 of a buffer
+ * Uses the fastest SIMD kernel supported by the CPU on the aligned part of
+ * the buffer, otherwise or for the unaligned head and tail a word or byte
+ * for byte calculation
+ * It uses the initial value to calculate a new XOR-32
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_xor32_calculate_checksum_little_endian_simd(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_xor32_calculate_checksum_little_endian_simd";
+	size_t buffer_offset  = 0;
+	uint32_t value_32bit  = 0;
+
+#if defined( ASSORTED_XOR32_HAVE_AVX2 ) || defined( ASSORTED_XOR32_HAVE_NEON )
+	size_t alignment_size = 0;
+	size_t block_size     = 0;
+	size_t head_size      = 0;
+	uint32_t cpu_features = 0;
+	int simd_method       = ASSORTED_XOR32_SIMD_METHOD_NONE;
+#endif
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum_value = initial_value;
+
+#if defined( ASSORTED_XOR32_HAVE_AVX2 ) || defined( ASSORTED_XOR32_HAVE_NEON )
+	cpu_features = assorted_cpu_features_get();
+
+#if defined( ASSORTED_XOR32_HAVE_AVX512 )
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX512F ) != 0 )
+	{
+		alignment_size = 64;
+		block_size     = 128;
+		simd_method    = ASSORTED_XOR32_SIMD_METHOD_AVX512;
+	}
+	else
+#endif
+#if defined( ASSORTED_XOR32_HAVE_AVX2 )
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		alignment_size = 32;
+		block_size     = 64;
+		simd_method    = ASSORTED_XOR32_SIMD_METHOD_AVX2;
+	}
+#elif defined( ASSORTED_XOR32_HAVE_NEON )
+	if( ( cpu_features & ASSORTED_CPU_FEATURE_NEON ) != 0 )
+	{
+		alignment_size = 16;
+		block_size     = 64;
+		simd_method    = ASSORTED_XOR32_SIMD_METHOD_NEON;
+	}
+#endif
+	if( simd_method != ASSORTED_XOR32_SIMD_METHOD_NONE )
+	{
+		/* XOR the bytes of the unaligned head into their position in the 32-bit value
+		 */
+		head_size = (size_t) ( ( alignment_size - ( (intptr_t) buffer % alignment_size ) ) % alignment_size );
+
+		if( head_size > size )
+		{
+			head_size = size;
+		}
+		while( buffer_offset < head_size )
+		{
+			*checksum_value ^= (uint32_t) buffer[ buffer_offset ] << ( ( buffer_offset % 4 ) * 8 );
+
+			buffer_offset++;
+		}
+		block_size = ( size - head_size ) & ~( block_size - 1 );
+	}
+	if( block_size > 0 )
+	{
+#if defined( ASSORTED_XOR32_HAVE_AVX512 )
+		if( simd_method == ASSORTED_XOR32_SIMD_METHOD_AVX512 )
+		{
+			value_32bit = assorted_xor32_simd_avx512(
+			               &( buffer[ buffer_offset ] ),
+			               block_size );
+		}
+#endif
+#if defined( ASSORTED_XOR32_HAVE_AVX2 )
+		if( simd_method == ASSORTED_XOR32_SIMD_METHOD_AVX2 )
+		{
+			value_32bit = assorted_xor32_simd_avx2(
+			               &( buffer[ buffer_offset ] ),
+			               block_size );
+		}
+#elif defined( ASSORTED_XOR32_HAVE_NEON )
+		if( simd_method == ASSORTED_XOR32_SIMD_METHOD_NEON )
+		{
+			value_32bit = assorted_xor32_simd_neon(
+			               &( buffer[ buffer_offset ] ),
+			               block_size );
+		}
+#endif
+		/* The XOR-32 of the aligned part starts at the head size, rotate
+		 * it to the position of its bytes relative to the start of the buffer
+		 */
+		if( ( buffer_offset % 4 ) != 0 )
+		{
+			value_32bit = ( value_32bit << ( ( buffer_offset % 4 ) * 8 ) )
+			            | ( value_32bit >> ( 32 - ( ( buffer_offset % 4 ) * 8 ) ) );
+		}
+		*checksum_value ^= value_32bit;
+
+		buffer_offset += block_size;
+	}
+#endif /* defined( ASSORTED_XOR32_HAVE_AVX2 ) || defined( ASSORTED_XOR32_HAVE_NEON ) */
+
+	if( ( buffer_offset % 4 ) == 0 )
+	{
+		while( ( size - buffer_offset ) >= 4 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 value_32bit );
+
+			*checksum_value ^= value_32bit;
+
+			buffer_offset += 4;
+		}
+	}
+	while( buffer_offset < size )
+	{
+		*checksum_value ^= (uint32_t) buffer[ buffer_offset ] << ( ( buffer_offset % 4 ) * 8 );
+
+		buffer_offset++;
+	}
+	return( 1 );
+}
+
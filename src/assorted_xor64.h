@@ -31,6 +31,26 @@
 extern "C" {
 #endif
 
+/* The SIMD kernels are available with GCC compatible compilers on x86
+ * and on little-endian ARMv8, the CPU support is determined at runtime
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __clang__ ) || ( __GNUC__ >= 5 ) )
+#define ASSORTED_XOR64_HAVE_AVX2
+#define ASSORTED_XOR64_HAVE_AVX512
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __AARCH64EL__ )
+#define ASSORTED_XOR64_HAVE_NEON
+
+#endif
+
+enum ASSORTED_XOR64_SIMD_METHODS
+{
+	ASSORTED_XOR64_SIMD_METHOD_NONE	= 0x00,
+	ASSORTED_XOR64_SIMD_METHOD_AVX2	= 0x01,
+	ASSORTED_XOR64_SIMD_METHOD_AVX512	= 0x02,
+	ASSORTED_XOR64_SIMD_METHOD_NEON	= 0x03
+};
+
 int assorted_xor64_calculate_checksum_little_endian_basic(
      uint64_t *checksum_value,
      const uint8_t *buffer,
@@ -45,6 +65,37 @@ int assorted_xor64_calculate_checksum_little_endian_cpu_aligned(
      uint64_t initial_value,
      libcerror_error_t **error );
 
+#if defined( ASSORTED_XOR64_HAVE_AVX2 )
+
+uint64_t assorted_xor64_simd_avx2(
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_XOR64_HAVE_AVX2 ) */
+
+#if defined( ASSORTED_XOR64_HAVE_AVX512 )
+
+uint64_t assorted_xor64_simd_avx512(
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_XOR64_HAVE_AVX512 ) */
+
+#if defined( ASSORTED_XOR64_HAVE_NEON )
+
+uint64_t assorted_xor64_simd_neon(
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( ASSORTED_XOR64_HAVE_NEON ) */
+
+int assorted_xor64_calculate_checksum_little_endian_simd(
+     uint64_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,280 @@
+/*
+ * ZIP archive member decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_crc32.h"
+#include "assorted_deflate.h"
+#include "assorted_libcerror.h"
+#include "assorted_zip_member.h"
+
+/* Reads a local file header
+ * The header size includes the name and extra field that precede the member data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_zip_member_read_local_file_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *header_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "assorted_zip_member_read_local_file_header";
+	uint16_t extra_field_size  = 0;
+	uint16_t name_size         = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < ASSORTED_ZIP_MEMBER_LOCAL_FILE_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     "PK\x03\x04",
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported local file header signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 26 ] ),
+	 name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 28 ] ),
+	 extra_field_size );
+
+	*header_size = ASSORTED_ZIP_MEMBER_LOCAL_FILE_HEADER_SIZE + (size_t) name_size + (size_t) extra_field_size;
+
+	return( 1 );
+}
+
+/* Decompresses the data of a member and verifies its checksum
+ * The sizes and checksum are those stored in the central directory, since
+ * the local file header does not contain them if a data descriptor is used
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_zip_member_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t compression_method,
+     uint32_t checksum,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function             = "assorted_zip_member_decompress";
+	size_t decompressed_data_size     = 0;
+	uint32_t calculated_checksum      = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_method == ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_STORED )
+	{
+		if( compressed_data_size != uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in stored data size.",
+			 function );
+
+			return( -1 );
+		}
+		/* The stored data is copied and its checksum calculated in a single pass
+		 */
+		if( assorted_crc32_copy_calculate(
+		     &calculated_checksum,
+		     uncompressed_data,
+		     compressed_data,
+		     uncompressed_data_size,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy stored data and calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( compression_method == ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_DEFLATE )
+	{
+		decompressed_data_size = uncompressed_data_size;
+
+		if( assorted_deflate_decompress(
+		     compressed_data,
+		     compressed_data_size,
+		     uncompressed_data,
+		     &decompressed_data_size,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress DEFLATE compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		if( decompressed_data_size != uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in uncompressed data size.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_crc32_calculate(
+		     &calculated_checksum,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method: %" PRIu16 ".",
+		 function,
+		 compression_method );
+
+		return( -1 );
+	}
+	if( checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
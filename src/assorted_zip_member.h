@@ -0,0 +1,66 @@
+/*
+ * ZIP archive member decompression functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_ZIP_MEMBER_H )
+#define _ASSORTED_ZIP_MEMBER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a local file header without the name and extra field
+ */
+#define ASSORTED_ZIP_MEMBER_LOCAL_FILE_HEADER_SIZE	30
+
+/* The compression methods
+ */
+enum ASSORTED_ZIP_MEMBER_COMPRESSION_METHODS
+{
+	ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_STORED	= 0,
+	ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_DEFLATE	= 8
+};
+
+int assorted_zip_member_read_local_file_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *header_size,
+     libcerror_error_t **error );
+
+int assorted_zip_member_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t compression_method,
+     uint32_t checksum,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_ZIP_MEMBER_H ) */
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -32,15 +33,103 @@
 
 #include <math.h>
 
+/* The constant block detection uses SSE2 on x86-64 and NEON on ARMv8,
+ * which are available on every CPU of these architectures
+ */
+#if defined( __GNUC__ ) && defined( __x86_64__ )
+#define BANALYZE_HAVE_SSE2
+#include <emmintrin.h>
+
+#elif defined( __GNUC__ ) && defined( __aarch64__ )
+#define BANALYZE_HAVE_NEON
+#include <arm_neon.h>
+
+#endif
+
+#include "assorted_adler32_rolling.h"
+#include "assorted_async_file.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_libhmac.h"
 #include "assorted_output.h"
-#include "digest_hash.h"
+#include "assorted_system_string.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+#include "banalyze_block.h"
+#include "banalyze_chunk_set.h"
+#include "banalyze_output.h"
+
+/* The number of blocks per thread that are read in a batch
+ */
+#define BANALYZE_BLOCKS_PER_THREAD		256
+
+/* The size of the data of the content-defined chunks that are calculated as a single
+ * value of the thread pool, so that small chunks are not synchronized one at a time
+ */
+#define BANALYZE_CHUNK_RUN_SIZE			( 64 * 1024 )
+
+/* The number of runs of content-defined chunks per thread that are pushed onto
+ * the thread pool and not yet retrieved
+ */
+#define BANALYZE_NUMBER_OF_QUEUED_RUNS_PER_THREAD	4
+
+/* The minimum size of the data of a batch, so that small blocks are read with large reads
+ */
+#define BANALYZE_MINIMUM_BATCH_SIZE		( 4 * 1024 * 1024 )
+
+/* The maximum size of the data of a batch
+ */
+#define BANALYZE_MAXIMUM_BATCH_SIZE		( 64 * 1024 * 1024 )
+
+/* The size of the chunks that are read ahead by asynchronous direct I/O
+ */
+#define BANALYZE_ASYNCHRONOUS_READ_SIZE		( 1024 * 1024 )
+
+/* The maximum number of threads
+ */
+#define BANALYZE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum number of bits of the hash table used to estimate the compressibility
+ */
+#define BANALYZE_COMPRESSIBILITY_HASH_BITS	12
+
+/* The size of the segments of which the bytes are counted in 32-bit sub tables
+ */
+#define BANALYZE_DISTRIBUTION_SEGMENT_SIZE	( 1024 * 1024 * 1024 )
+
+/* The maximum block size for which a n * log2( n ) table is used
+ */
+#define BANALYZE_MAXIMUM_ENTROPY_TABLE_BLOCK_SIZE	( 1024 * 1024 )
+
+/* The minimum size of the data that is read ahead of a sliding window
+ */
+#define BANALYZE_SLIDING_WINDOW_READ_SIZE		( 1024 * 1024 )
+
+/* The number of sliding window steps after which the incrementally updated
+ * entropy sum is recalculated from the distribution table to limit rounding errors
+ */
+#define BANALYZE_SLIDING_WINDOW_RESYNC_INTERVAL		4096
+
+/* The number of bytes that are compared per step of the constant block detection
+ */
+#define BANALYZE_CONSTANT_BLOCK_LANE_SIZE		64
+
+/* The size of the rolling window of which the content-defined chunk boundaries are determined
+ */
+#define BANALYZE_CHUNK_WINDOW_SIZE			64
 
-#define DIGEST_HASH_STRING_SIZE_MD5	33
+/* The minimum and maximum average chunk size, where the maximum is limited
+ * by the 16-bit upper word of the Adler-32 that determines the boundaries
+ */
+#define BANALYZE_MINIMUM_AVERAGE_CHUNK_SIZE		256
+#define BANALYZE_MAXIMUM_AVERAGE_CHUNK_SIZE		65536
+
+/* The maximum number of chunk boundaries that are retrieved per scan
+ */
+#define BANALYZE_MAXIMUM_NUMBER_OF_BOUNDARIES		1024
 
 /* Prints the executable usage information
  */
@@ -53,24 +142,115 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use banalyze to analyze blocks of data.\n\n" );
 
-	fprintf( stream, "Usage: banalyze [-b block_size] [ -o offset ] [ -s size ] [-12hrvV] source\n\n" );
+	fprintf( stream, "Usage: banalyze [-b block_size] [ -c chunk_size ] [ -f format ] [ -o offset ]\n"
+	                 "                [ -s size ] [ -j number_of_threads ] [ -w stride ]\n"
+	                 "                [-1234AhrvV] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     calculate block entropy (default)\n" );
-	fprintf( stream, "\t-2:     calculate block message digest hashes\n" );
+	fprintf( stream, "\t-2:     calculate block MD5 message digest hashes\n" );
+	fprintf( stream, "\t-3:     calculate block SHA-256 message digest hashes\n" );
+	fprintf( stream, "\t-4:     estimate block compressibility, as the fraction of bytes\n"
+	                 "\t        that repeat an earlier 4-byte sequence in the block\n" );
+	fprintf( stream, "\t        Multiple of -1, -2, -3 and -4 can be combined to calculate\n"
+	                 "\t        them in a single pass\n" );
+	fprintf( stream, "\t-A:     use asynchronous direct I/O instead of reading the source file\n" );
 	fprintf( stream, "\t-b:     specify the block size (default is: 512)\n" );
+	fprintf( stream, "\t-c:     analyze content-defined chunks of the average chunk size,\n"
+	                 "\t        a power of 2 from 256 to 65536, instead of blocks, where\n"
+	                 "\t        chunks with the same MD5 or SHA-256 (default is MD5) are\n"
+	                 "\t        reported as duplicate and the deduplication ratio is printed\n" );
+	fprintf( stream, "\t-f:     output format, options: text (default), jsonl, binary,\n"
+	                 "\t        where other output than the results is written to stderr\n"
+	                 "\t        for jsonl and binary\n" );
 	fprintf( stream, "\t-h:     shows this usage information\n" );
+	fprintf( stream, "\t-j:     number of threads used to analyze the blocks, where the\n"
+	                 "\t        results are printed in block order (default is 1)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-r:     output the offset relative from the data offset instead of the data\n"
 	                 "\t        offset.\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-w:     calculate the block entropy of a sliding window of the block\n"
+	                 "\t        size that moves stride bytes at a time, where the stride\n"
+	                 "\t        must be smaller than the block size\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Determines the output format from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int banalyze_output_format_from_string(
+     const system_character_t *string,
+     uint8_t *output_format,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_output_format_from_string";
+	size_t string_length  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output format.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 4 )
+	 && ( system_string_compare(
+	       string,
+	       _SYSTEM_STRING( "text" ),
+	       4 ) == 0 ) )
+	{
+		*output_format = BANALYZE_OUTPUT_FORMAT_TEXT;
+	}
+	else if( ( string_length == 5 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "jsonl" ),
+	            5 ) == 0 ) )
+	{
+		*output_format = BANALYZE_OUTPUT_FORMAT_JSONL;
+	}
+	else if( ( string_length == 6 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "binary" ),
+	            6 ) == 0 ) )
+	{
+		*output_format = BANALYZE_OUTPUT_FORMAT_BINARY;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Determines the byte distribution (frequency)
+ * The bytes are counted in 4 interleaved 32-bit sub tables so that consecutive
+ * identical bytes do not wait on the store of the same counter, the sub tables
+ * are added to the distribution table per segment before they can overflow
  * Returns 1 if successful or -1 on error
  */
 int banalyze_determine_byte_distribution(
@@ -79,9 +259,12 @@ int banalyze_determine_byte_distribution(
      uint64_t distribution_table[ 256 ],
      libcerror_error_t **error )
 {
+	uint32_t sub_tables[ 4 ][ 256 ];
+
 	static char *function = "banalyze_determine_byte_distribution";
 	size_t block_offset   = 0;
-	uint8_t byte_value    = 0;
+	size_t segment_end    = 0;
+	uint16_t byte_value   = 0;
 
 	if( block_buffer == NULL )
 	{
@@ -119,23 +302,136 @@ int banalyze_determine_byte_distribution(
 
 		return( -1 );
 	}
-	for( block_offset = 0;
-	     block_offset < block_size;
-	     block_offset++ )
+	while( block_offset < block_size )
+	{
+		if( memory_set(
+		     sub_tables,
+		     0,
+		     sizeof( uint32_t ) * 4 * 256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear sub tables.",
+			 function );
+
+			return( -1 );
+		}
+		segment_end = block_size;
+
+		if( ( segment_end - block_offset ) > BANALYZE_DISTRIBUTION_SEGMENT_SIZE )
+		{
+			segment_end = block_offset + BANALYZE_DISTRIBUTION_SEGMENT_SIZE;
+		}
+		while( ( segment_end - block_offset ) >= 4 )
+		{
+			sub_tables[ 0 ][ block_buffer[ block_offset ] ] += 1;
+			sub_tables[ 1 ][ block_buffer[ block_offset + 1 ] ] += 1;
+			sub_tables[ 2 ][ block_buffer[ block_offset + 2 ] ] += 1;
+			sub_tables[ 3 ][ block_buffer[ block_offset + 3 ] ] += 1;
+
+			block_offset += 4;
+		}
+		while( block_offset < segment_end )
+		{
+			sub_tables[ 0 ][ block_buffer[ block_offset ] ] += 1;
+
+			block_offset++;
+		}
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			distribution_table[ byte_value ] += (uint64_t) sub_tables[ 0 ][ byte_value ]
+			                                  + (uint64_t) sub_tables[ 1 ][ byte_value ]
+			                                  + (uint64_t) sub_tables[ 2 ][ byte_value ]
+			                                  + (uint64_t) sub_tables[ 3 ][ byte_value ];
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a table with n * log2( n ) for every n from 0 to the block size
+ * Make sure the value entropy_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_entropy_table_initialize(
+     double **entropy_table,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_entropy_table_initialize";
+	size_t count          = 0;
+
+	if( entropy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entropy_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entropy table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > BANALYZE_MAXIMUM_ENTROPY_TABLE_BLOCK_SIZE ) )
 	{
-		byte_value = block_buffer[ block_offset ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*entropy_table = (double *) memory_allocate(
+	                             sizeof( double ) * ( block_size + 1 ) );
+
+	if( *entropy_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entropy table.",
+		 function );
+
+		return( -1 );
+	}
+	( *entropy_table )[ 0 ] = 0.0;
 
-		distribution_table[ byte_value ] += 1;
+	for( count = 1;
+	     count <= block_size;
+	     count++ )
+	{
+		( *entropy_table )[ count ] = (double) count * ( log( (double) count ) / log( 2 ) );
 	}
 	return( 1 );
 }
 
 /* Calculates the byte entropy value
+ * The entropy table is optional and must contain n * log2( n ) for every n up to the block size,
+ * in which case the entropy is calculated as ( N * log2( N ) - sum( n * log2( n ) ) ) / N
  * Returns 1 if successful or -1 on error
  */
 int banalyze_calculate_byte_entropy(
      size_t block_size,
      uint64_t distribution_table[ 256 ],
+     const double *entropy_table,
      double_t *byte_entropy,
      libcerror_error_t **error )
 {
@@ -143,6 +439,7 @@ int banalyze_calculate_byte_entropy(
 	uint16_t byte_value   = 0;
 	double entropy        = 0.0;
 	double probability    = 0.0;
+	double sum            = 0.0;
 
 	if( distribution_table == NULL )
 	{
@@ -166,6 +463,19 @@ int banalyze_calculate_byte_entropy(
 
 		return( -1 );
 	}
+	if( ( entropy_table != NULL )
+	 && ( block_size > 0 ) )
+	{
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			sum += entropy_table[ distribution_table[ byte_value ] ];
+		}
+		*byte_entropy = ( entropy_table[ block_size ] - sum ) / (double) block_size;
+
+		return( 1 );
+	}
 	for( byte_value = 0;
 	     byte_value < 256;
 	     byte_value++ )
@@ -185,111 +495,2463 @@ int banalyze_calculate_byte_entropy(
 	return( 1 );
 }
 
-/* Analyzes a block
+/* Estimates the compressibility of a block
+ * The compressibility is estimated as the fraction of the bytes that are part of a match
+ * with an earlier 4-byte sequence in the block, as found by a single entry hash table
+ * similar to that of a fast LZ compressor
  * Returns 1 if successful or -1 on error
  */
-int banalyze_analyze_block(
-     int analysis_method,
+int banalyze_estimate_compressibility(
      const uint8_t *block_buffer,
      size_t block_size,
-     off64_t block_offset,
+     double *compressibility,
      libcerror_error_t **error )
 {
-	uint64_t distribution_table[ 256 ];
-	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
-	system_character_t md5_hash_string[ DIGEST_HASH_STRING_SIZE_MD5 ];
+	uint32_t hash_table[ 1 << BANALYZE_COMPRESSIBILITY_HASH_BITS ];
 
-	static char *function = "banalyze_analyze_block";
-	double entropy        = 0.0;
+	static char *function      = "banalyze_estimate_compressibility";
+	size_t block_offset        = 0;
+	size_t match_offset        = 0;
+	size_t match_size          = 0;
+	size_t matched_size        = 0;
+	size_t number_of_hash_bits = 8;
+	uint32_t hash_value        = 0;
+	uint32_t sequence          = 0;
 
-	switch( analysis_method )
+	if( block_buffer == NULL )
 	{
-		case 1:
-			if( banalyze_determine_byte_distribution(
-			     block_buffer,
-			     block_size,
-			     distribution_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine byte distribution.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block buffer.",
+		 function );
 
-				return( -1 );
-			}
-			if( banalyze_calculate_byte_entropy(
-			     block_size,
-			     distribution_table,
-			     &entropy,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to calculate byte entropy.",
-				 function );
+		return( -1 );
+	}
+	if( block_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
 
-				return( -1 );
+		return( -1 );
+	}
+	if( compressibility == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressibility.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size < 4 )
+	{
+		*compressibility = 0.0;
+
+		return( 1 );
+	}
+	/* Scale the hash table with the block size so small blocks do not pay for clearing a large table
+	 */
+	while( ( number_of_hash_bits < BANALYZE_COMPRESSIBILITY_HASH_BITS )
+	    && ( ( (size_t) 1 << number_of_hash_bits ) < block_size ) )
+	{
+		number_of_hash_bits++;
+	}
+	/* The hash table contains the block offset + 1 of the last sequence with the hash, 0 if not set
+	 */
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * ( (size_t) 1 << number_of_hash_bits ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( block_offset + 4 ) <= block_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( block_buffer[ block_offset ] ),
+		 sequence );
+
+		hash_value = (uint32_t) ( sequence * 0x9e3779b1UL ) >> ( 32 - number_of_hash_bits );
+
+		match_offset = (size_t) hash_table[ hash_value ];
+
+		hash_table[ hash_value ] = (uint32_t) ( block_offset + 1 );
+
+		if( ( match_offset != 0 )
+		 && ( memory_compare(
+		       &( block_buffer[ match_offset - 1 ] ),
+		       &( block_buffer[ block_offset ] ),
+		       4 ) == 0 ) )
+		{
+			match_offset -= 1;
+			match_size    = 4;
+
+			while( ( ( block_offset + match_size ) < block_size )
+			    && ( block_buffer[ match_offset + match_size ] == block_buffer[ block_offset + match_size ] ) )
+			{
+				match_size++;
 			}
-			fprintf(
-			 stdout,
-			 "block 0x%08" PRIx64 " - 0x%08" PRIx64 ": byte entropy: %f\n",
-			 block_offset,
-			 block_offset + block_size,
-			 entropy );
+			matched_size += match_size;
+			block_offset += match_size;
+		}
+		else
+		{
+			block_offset++;
+		}
+	}
+	*compressibility = (double) matched_size / (double) block_size;
 
-			break;
+	return( 1 );
+}
+
+/* Determines if all bytes of a block have the same value
+ * The bytes are compared with the first byte in 64-byte lanes, where the differences
+ * of a lane are combined with OR so that only a single test is needed per lane
+ * Returns 1 if the block is constant, 0 if not or -1 on error
+ */
+int banalyze_block_is_constant(
+     const uint8_t *block_buffer,
+     size_t block_size,
+     uint8_t *byte_value,
+     libcerror_error_t **error )
+{
+#if defined( BANALYZE_HAVE_SSE2 )
+	__m128i differences   = _mm_setzero_si128();
+	__m128i pattern       = _mm_setzero_si128();
+
+#elif defined( BANALYZE_HAVE_NEON )
+	uint8x16_t differences;
+	uint8x16_t pattern;
+
+#else
+	size_t lane_offset    = 0;
+	uint8_t differences   = 0;
+
+#endif
+	static char *function = "banalyze_block_is_constant";
+	size_t block_offset   = 0;
+	uint8_t first_byte    = 0;
+
+	if( block_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		return( 0 );
+	}
+	first_byte = block_buffer[ 0 ];
+
+#if defined( BANALYZE_HAVE_SSE2 )
+	pattern = _mm_set1_epi8(
+	           (char) first_byte );
+
+	while( ( block_size - block_offset ) >= BANALYZE_CONSTANT_BLOCK_LANE_SIZE )
+	{
+		differences = _mm_or_si128(
+		               _mm_or_si128(
+		                _mm_xor_si128(
+		                 _mm_loadu_si128(
+		                  (const __m128i *) &( block_buffer[ block_offset ] ) ),
+		                 pattern ),
+		                _mm_xor_si128(
+		                 _mm_loadu_si128(
+		                  (const __m128i *) &( block_buffer[ block_offset + 16 ] ) ),
+		                 pattern ) ),
+		               _mm_or_si128(
+		                _mm_xor_si128(
+		                 _mm_loadu_si128(
+		                  (const __m128i *) &( block_buffer[ block_offset + 32 ] ) ),
+		                 pattern ),
+		                _mm_xor_si128(
+		                 _mm_loadu_si128(
+		                  (const __m128i *) &( block_buffer[ block_offset + 48 ] ) ),
+		                 pattern ) ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      differences,
+		      _mm_setzero_si128() ) ) != 0xffff )
+		{
+			return( 0 );
+		}
+		block_offset += BANALYZE_CONSTANT_BLOCK_LANE_SIZE;
+	}
+#elif defined( BANALYZE_HAVE_NEON )
+	pattern = vdupq_n_u8(
+	           first_byte );
+
+	while( ( block_size - block_offset ) >= BANALYZE_CONSTANT_BLOCK_LANE_SIZE )
+	{
+		differences = vorrq_u8(
+		               vorrq_u8(
+		                veorq_u8(
+		                 vld1q_u8(
+		                  &( block_buffer[ block_offset ] ) ),
+		                 pattern ),
+		                veorq_u8(
+		                 vld1q_u8(
+		                  &( block_buffer[ block_offset + 16 ] ) ),
+		                 pattern ) ),
+		               vorrq_u8(
+		                veorq_u8(
+		                 vld1q_u8(
+		                  &( block_buffer[ block_offset + 32 ] ) ),
+		                 pattern ),
+		                veorq_u8(
+		                 vld1q_u8(
+		                  &( block_buffer[ block_offset + 48 ] ) ),
+		                 pattern ) ) );
+
+		if( vmaxvq_u8(
+		     differences ) != 0 )
+		{
+			return( 0 );
+		}
+		block_offset += BANALYZE_CONSTANT_BLOCK_LANE_SIZE;
+	}
+#else
+	while( ( block_size - block_offset ) >= BANALYZE_CONSTANT_BLOCK_LANE_SIZE )
+	{
+		for( lane_offset = 0;
+		     lane_offset < BANALYZE_CONSTANT_BLOCK_LANE_SIZE;
+		     lane_offset++ )
+		{
+			differences |= block_buffer[ block_offset + lane_offset ] ^ first_byte;
+		}
+		if( differences != 0 )
+		{
+			return( 0 );
+		}
+		block_offset += BANALYZE_CONSTANT_BLOCK_LANE_SIZE;
+	}
+#endif
+	while( block_offset < block_size )
+	{
+		if( block_buffer[ block_offset ] != first_byte )
+		{
+			return( 0 );
+		}
+		block_offset++;
+	}
+	*byte_value = first_byte;
+
+	return( 1 );
+}
+
+/* Calculates the analysis of a block
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_calculate_block(
+     banalyze_block_t *block,
+     libcerror_error_t **error )
+{
+	uint64_t distribution_table[ 256 ];
+
+	static char *function = "banalyze_calculate_block";
+	int result            = 0;
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	result = banalyze_block_is_constant(
+	          block->data,
+	          block->size,
+	          &( block->constant_byte_value ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if block is constant.",
+		 function );
+
+		return( -1 );
+	}
+	block->is_constant = (uint8_t) result;
+
+	/* A constant block has an entropy of 0 and all bytes after the first are part of a match,
+	 * its hashes are retrieved from the constant block hashes when the block is written
+	 */
+	if( block->is_constant != 0 )
+	{
+		block->entropy = 0.0;
+
+		if( block->size >= 4 )
+		{
+			block->compressibility = (double) ( block->size - 1 ) / (double) block->size;
+		}
+		else
+		{
+			block->compressibility = 0.0;
+		}
+		return( 1 );
+	}
+	if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_ENTROPY ) != 0 )
+	{
+		if( banalyze_determine_byte_distribution(
+		     block->data,
+		     block->size,
+		     distribution_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine byte distribution.",
+			 function );
+
+			return( -1 );
+		}
+		if( banalyze_calculate_byte_entropy(
+		     block->size,
+		     distribution_table,
+		     block->entropy_table,
+		     &( block->entropy ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate byte entropy.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_MD5 ) != 0 )
+	{
+		if( libhmac_md5_calculate(
+		     block->data,
+		     block->size,
+		     block->md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate MD5.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_SHA256 ) != 0 )
+	{
+		if( libhmac_sha256_calculate(
+		     block->data,
+		     block->size,
+		     block->sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate SHA-256.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_COMPRESSIBILITY ) != 0 )
+	{
+		if( banalyze_estimate_compressibility(
+		     block->data,
+		     block->size,
+		     &( block->compressibility ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to estimate compressibility.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Calculates the analysis of a block from a thread pool
+ * The error is not available from the worker thread, the result is stored in the block
+ * Returns 1 on success or -1 on error
+ */
+int banalyze_calculate_block_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	banalyze_block_t *block = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	block = (banalyze_block_t *) value;
+
+	block->result = banalyze_calculate_block(
+	                 block,
+	                 NULL );
+
+	return( 1 );
+}
+
+/* Calculates the analysis of a run of blocks from a thread pool
+ * The error is not available from the worker thread, the result is stored in the blocks
+ * Returns 1 on success or -1 on error
+ */
+int banalyze_calculate_block_run_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	banalyze_block_run_t *run = NULL;
+	size_t block_index        = 0;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	run = (banalyze_block_run_t *) value;
+
+	for( block_index = 0;
+	     block_index < run->number_of_blocks;
+	     block_index++ )
+	{
+		run->blocks[ block_index ].result = banalyze_calculate_block(
+		                                     &( run->blocks[ block_index ] ),
+		                                     NULL );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the hashes of a constant block
+ * The hashes of constant blocks of the stored block size are calculated once per byte value
+ * and stored in the constant block hashes, other constant blocks are calculated directly
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_get_constant_block_hashes(
+     banalyze_constant_block_hashes_t *constant_block_hashes,
+     banalyze_block_t *block,
+     libcerror_error_t **error )
+{
+	uint8_t *md5_hash          = NULL;
+	uint8_t *sha256_hash       = NULL;
+	static char *function      = "banalyze_get_constant_block_hashes";
+	uint8_t analysis_methods   = 0;
+	uint8_t byte_value         = 0;
+	uint8_t is_stored          = 0;
+
+	if( constant_block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid constant block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	byte_value = block->constant_byte_value;
+
+	if( block->size == constant_block_hashes->block_size )
+	{
+		is_stored   = 1;
+		md5_hash    = constant_block_hashes->md5_hashes[ byte_value ];
+		sha256_hash = constant_block_hashes->sha256_hashes[ byte_value ];
+
+		analysis_methods = block->analysis_methods & ~( constant_block_hashes->analysis_methods[ byte_value ] );
+	}
+	else
+	{
+		md5_hash    = block->md5_hash;
+		sha256_hash = block->sha256_hash;
+
+		analysis_methods = block->analysis_methods;
+	}
+	if( ( analysis_methods & BANALYZE_ANALYSIS_METHOD_MD5 ) != 0 )
+	{
+		if( libhmac_md5_calculate(
+		     block->data,
+		     block->size,
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate MD5.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( analysis_methods & BANALYZE_ANALYSIS_METHOD_SHA256 ) != 0 )
+	{
+		if( libhmac_sha256_calculate(
+		     block->data,
+		     block->size,
+		     sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate SHA-256.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( is_stored != 0 )
+	{
+		constant_block_hashes->analysis_methods[ byte_value ] |= analysis_methods;
+
+		if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_MD5 ) != 0 )
+		{
+			if( memory_copy(
+			     block->md5_hash,
+			     md5_hash,
+			     LIBHMAC_MD5_HASH_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy MD5.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_SHA256 ) != 0 )
+		{
+			if( memory_copy(
+			     block->sha256_hash,
+			     sha256_hash,
+			     LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy SHA-256.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a batch of blocks
+ * The block data is stored consecutively in the buffer
+ * The blocks are read from the asynchronous file if set, otherwise from the source file
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_read_batch(
+     libcfile_file_t *source_file,
+     assorted_async_file_t *async_file,
+     uint8_t analysis_methods,
+     const double *entropy_table,
+     uint8_t *buffer,
+     size_t block_size,
+     banalyze_block_t *blocks,
+     size_t maximum_number_of_blocks,
+     size64_t remaining_size,
+     off64_t block_offset,
+     size_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_read_batch";
+	size_t block_index    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = block_size * maximum_number_of_blocks;
+
+	if( (size64_t) read_size > remaining_size )
+	{
+		read_size = (size_t) remaining_size;
+	}
+	/* Clear buffer before read since in some cases like volsnap.sys
+	 * read will return successful without actually filling the buffer
+	 */
+	if( memory_set(
+	     buffer,
+	     0,
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size > 0 )
+	{
+		if( async_file != NULL )
+		{
+			read_count = assorted_async_file_read_buffer(
+			              async_file,
+			              buffer,
+			              read_size,
+			              error );
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              buffer,
+			              read_size,
+			              error );
+		}
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read blocks from source file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( block_index = 0;
+	     ( block_index * block_size ) < read_size;
+	     block_index++ )
+	{
+		blocks[ block_index ].analysis_methods = analysis_methods;
+		blocks[ block_index ].data             = &( buffer[ block_index * block_size ] );
+		blocks[ block_index ].size             = read_size - ( block_index * block_size );
+		blocks[ block_index ].offset           = block_offset + (off64_t) ( block_index * block_size );
+		blocks[ block_index ].entropy_table    = entropy_table;
+		blocks[ block_index ].entropy          = 0.0;
+		blocks[ block_index ].compressibility  = 0.0;
+		blocks[ block_index ].is_constant      = 0;
+		blocks[ block_index ].result           = 0;
+
+		if( blocks[ block_index ].size > block_size )
+		{
+			blocks[ block_index ].size = block_size;
+		}
+	}
+	*number_of_blocks = block_index;
+
+	return( 1 );
+}
+
+/* Analyzes the blocks of the source file in batches, where the blocks of a batch are
+ * calculated by a thread pool while the next batch is read, so that reading and
+ * calculating overlap also when a single thread is used
+ * The blocks are written in block order after the batch has been calculated
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_analyze_blocks(
+     banalyze_output_t *output,
+     libcfile_file_t *source_file,
+     assorted_async_file_t *async_file,
+     uint8_t analysis_methods,
+     const double *entropy_table,
+     size_t block_size,
+     size64_t source_size,
+     off64_t output_offset,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	banalyze_constant_block_hashes_t *constant_block_hashes = NULL;
+	banalyze_block_t *blocks[ 2 ]                           = { NULL, NULL };
+	uint8_t *buffers[ 2 ]                                   = { NULL, NULL };
+	static char *function                                   = "banalyze_analyze_blocks";
+	size64_t read_offset                                    = 0;
+	size_t block_index                                      = 0;
+	size_t maximum_number_of_blocks                         = 0;
+	size_t number_of_blocks[ 2 ]                            = { 0, 0 };
+	int batch_index                                         = 0;
+	int read_result                                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+#endif
+
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > BANALYZE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_blocks = (size_t) number_of_threads * BANALYZE_BLOCKS_PER_THREAD;
+
+	if( maximum_number_of_blocks < ( BANALYZE_MINIMUM_BATCH_SIZE / block_size ) )
+	{
+		maximum_number_of_blocks = BANALYZE_MINIMUM_BATCH_SIZE / block_size;
+	}
+	if( maximum_number_of_blocks > ( BANALYZE_MAXIMUM_BATCH_SIZE / block_size ) )
+	{
+		maximum_number_of_blocks = BANALYZE_MAXIMUM_BATCH_SIZE / block_size;
+	}
+	if( maximum_number_of_blocks == 0 )
+	{
+		maximum_number_of_blocks = 1;
+	}
+	for( batch_index = 0;
+	     batch_index < 2;
+	     batch_index++ )
+	{
+		buffers[ batch_index ] = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * block_size * maximum_number_of_blocks );
+
+		if( buffers[ batch_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+		blocks[ batch_index ] = (banalyze_block_t *) memory_allocate(
+		                                              sizeof( banalyze_block_t ) * maximum_number_of_blocks );
+
+		if( blocks[ batch_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create blocks: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+	}
+	constant_block_hashes = memory_allocate_structure(
+	                         banalyze_constant_block_hashes_t );
+
+	if( constant_block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create constant block hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     constant_block_hashes->analysis_methods,
+	     0,
+	     sizeof( uint8_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear constant block hashes.",
+		 function );
+
+		goto on_error;
+	}
+	constant_block_hashes->block_size = block_size;
+
+	batch_index = 0;
+
+	if( banalyze_read_batch(
+	     source_file,
+	     async_file,
+	     analysis_methods,
+	     entropy_table,
+	     buffers[ batch_index ],
+	     block_size,
+	     blocks[ batch_index ],
+	     maximum_number_of_blocks,
+	     source_size,
+	     output_offset,
+	     &( number_of_blocks[ batch_index ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read batch at offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	read_offset = (size64_t) block_size * number_of_blocks[ batch_index ];
+
+	if( read_offset > source_size )
+	{
+		read_offset = source_size;
+	}
+	while( number_of_blocks[ batch_index ] > 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     (int) number_of_blocks[ batch_index ],
+		     (int (*)(intptr_t *, void *)) &banalyze_calculate_block_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks[ batch_index ];
+		     block_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( blocks[ batch_index ][ block_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push block: %" PRIzd " onto thread pool queue.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		/* Read the next batch while the current batch is being calculated
+		 * on a read error the current batch is still written before failing
+		 */
+		read_result = banalyze_read_batch(
+		               source_file,
+		               async_file,
+		               analysis_methods,
+		               entropy_table,
+		               buffers[ 1 - batch_index ],
+		               block_size,
+		               blocks[ 1 - batch_index ],
+		               maximum_number_of_blocks,
+		               source_size - read_offset,
+		               output_offset + (off64_t) read_offset,
+		               &( number_of_blocks[ 1 - batch_index ] ),
+		               error );
+
+		if( read_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read batch at offset: %" PRIu64 ".",
+			 function,
+			 read_offset );
+
+			number_of_blocks[ 1 - batch_index ] = 0;
+		}
+		read_offset += (size64_t) block_size * number_of_blocks[ 1 - batch_index ];
+
+		if( read_offset > source_size )
+		{
+			read_offset = source_size;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		for( block_index = 0;
+		     block_index < number_of_blocks[ batch_index ];
+		     block_index++ )
+		{
+			/* Blocks that were not calculated by the thread pool are calculated here,
+			 * which also provides the error of a failed calculation
+			 */
+			if( blocks[ batch_index ][ block_index ].result != 1 )
+			{
+				if( banalyze_calculate_block(
+				     &( blocks[ batch_index ][ block_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to calculate block at offset: %" PRIi64 ".",
+					 function,
+					 blocks[ batch_index ][ block_index ].offset );
+
+					goto on_error;
+				}
+			}
+			if( ( blocks[ batch_index ][ block_index ].is_constant != 0 )
+			 && ( ( analysis_methods & ( BANALYZE_ANALYSIS_METHOD_MD5 | BANALYZE_ANALYSIS_METHOD_SHA256 ) ) != 0 ) )
+			{
+				if( banalyze_get_constant_block_hashes(
+				     constant_block_hashes,
+				     &( blocks[ batch_index ][ block_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve constant block hashes at offset: %" PRIi64 ".",
+					 function,
+					 blocks[ batch_index ][ block_index ].offset );
+
+					goto on_error;
+				}
+			}
+			if( banalyze_output_write_block(
+			     output,
+			     &( blocks[ batch_index ][ block_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to write block at offset: %" PRIi64 ".",
+				 function,
+				 blocks[ batch_index ][ block_index ].offset );
+
+				goto on_error;
+			}
+		}
+		if( read_result != 1 )
+		{
+			goto on_error;
+		}
+		batch_index = 1 - batch_index;
+	}
+	for( batch_index = 0;
+	     batch_index < 2;
+	     batch_index++ )
+	{
+		memory_free(
+		 blocks[ batch_index ] );
+		memory_free(
+		 buffers[ batch_index ] );
+	}
+	memory_free(
+	 constant_block_hashes );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	for( batch_index = 0;
+	     batch_index < 2;
+	     batch_index++ )
+	{
+		if( blocks[ batch_index ] != NULL )
+		{
+			memory_free(
+			 blocks[ batch_index ] );
+		}
+		if( buffers[ batch_index ] != NULL )
+		{
+			memory_free(
+			 buffers[ batch_index ] );
+		}
+	}
+	if( constant_block_hashes != NULL )
+	{
+		memory_free(
+		 constant_block_hashes );
+	}
+	return( -1 );
+}
+
+/* Sets a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_set_chunk(
+     banalyze_block_t *chunks,
+     size_t maximum_number_of_chunks,
+     size_t *number_of_chunks,
+     uint8_t analysis_methods,
+     const double *entropy_table,
+     const uint8_t *buffer,
+     size_t chunk_offset,
+     size_t chunk_size,
+     off64_t buffer_offset,
+     libcerror_error_t **error )
+{
+	banalyze_block_t *chunk = NULL;
+	static char *function   = "banalyze_set_chunk";
+
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_chunks >= maximum_number_of_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk = &( chunks[ *number_of_chunks ] );
+
+	chunk->analysis_methods = analysis_methods;
+	chunk->data             = &( buffer[ chunk_offset ] );
+	chunk->size             = chunk_size;
+	chunk->offset           = buffer_offset + (off64_t) chunk_offset;
+	chunk->entropy_table    = entropy_table;
+	chunk->entropy          = 0.0;
+	chunk->compressibility  = 0.0;
+	chunk->is_constant      = 0;
+	chunk->is_duplicate     = 0;
+	chunk->duplicate_offset = 0;
+	chunk->result           = 0;
+
+	*number_of_chunks += 1;
+
+	return( 1 );
+}
+
+/* Reads a batch of content-defined chunks
+ * The data is read into the buffer after the carry size bytes of the previous batch,
+ * that are the start of the first chunk. A chunk ends after a full window of which the
+ * masked Adler-32 is 0, where chunks are at least 1/4 and at most 4 times the average
+ * chunk size. The data after the last chunk is carried over to the next batch, except
+ * for the last batch of which all data is part of a chunk
+ * The data is read from the asynchronous file if set, otherwise from the source file
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_read_chunks(
+     libcfile_file_t *source_file,
+     assorted_async_file_t *async_file,
+     assorted_adler32_rolling_t *rolling,
+     uint8_t analysis_methods,
+     const double *entropy_table,
+     uint8_t *buffer,
+     size_t carry_size,
+     size_t batch_size,
+     size_t average_chunk_size,
+     banalyze_block_t *chunks,
+     size_t maximum_number_of_chunks,
+     size64_t remaining_size,
+     off64_t buffer_offset,
+     size_t *number_of_chunks,
+     size_t *data_size,
+     size_t *remainder_offset,
+     libcerror_error_t **error )
+{
+	size_t boundary_offsets[ BANALYZE_MAXIMUM_NUMBER_OF_BOUNDARIES ];
+
+	static char *function        = "banalyze_read_chunks";
+	size_t boundary_index        = 0;
+	size_t boundary_offset       = 0;
+	size_t chunk_offset          = 0;
+	size_t maximum_chunk_size    = 0;
+	size_t minimum_chunk_size    = 0;
+	size_t number_of_boundaries  = 0;
+	size_t read_size             = 0;
+	size_t scan_offset           = 0;
+	size_t scanned_size          = 0;
+	ssize_t read_count           = 0;
+	uint32_t mask                = 0;
+
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( remainder_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid remainder offset.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = batch_size;
+
+	if( (size64_t) read_size > remaining_size )
+	{
+		read_size = (size_t) remaining_size;
+	}
+	/* Clear buffer before read since in some cases like volsnap.sys
+	 * read will return successful without actually filling the buffer
+	 */
+	if( memory_set(
+	     &( buffer[ carry_size ] ),
+	     0,
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size > 0 )
+	{
+		if( async_file != NULL )
+		{
+			read_count = assorted_async_file_read_buffer(
+			              async_file,
+			              &( buffer[ carry_size ] ),
+			              read_size,
+			              error );
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              &( buffer[ carry_size ] ),
+			              read_size,
+			              error );
+		}
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunks from source file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*number_of_chunks = 0;
+	*data_size        = carry_size + read_size;
+
+	/* The boundaries are determined by the upper word of the Adler-32, since the lower word,
+	 * the sum of the bytes in the window, is not evenly distributed
+	 */
+	mask               = (uint32_t) ( average_chunk_size - 1 ) << 16;
+	minimum_chunk_size = average_chunk_size / 4;
+	maximum_chunk_size = average_chunk_size * 4;
+	scan_offset        = carry_size;
+
+	while( scan_offset < *data_size )
+	{
+		if( assorted_adler32_rolling_scan(
+		     rolling,
+		     &( buffer[ scan_offset ] ),
+		     *data_size - scan_offset,
+		     mask,
+		     boundary_offsets,
+		     BANALYZE_MAXIMUM_NUMBER_OF_BOUNDARIES,
+		     &number_of_boundaries,
+		     &scanned_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan for chunk boundaries.",
+			 function );
+
+			return( -1 );
+		}
+		for( boundary_index = 0;
+		     boundary_index < number_of_boundaries;
+		     boundary_index++ )
+		{
+			boundary_offset = scan_offset + boundary_offsets[ boundary_index ];
+
+			while( ( boundary_offset - chunk_offset ) > maximum_chunk_size )
+			{
+				if( banalyze_set_chunk(
+				     chunks,
+				     maximum_number_of_chunks,
+				     number_of_chunks,
+				     analysis_methods,
+				     entropy_table,
+				     buffer,
+				     chunk_offset,
+				     maximum_chunk_size,
+				     buffer_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set chunk.",
+					 function );
+
+					return( -1 );
+				}
+				chunk_offset += maximum_chunk_size;
+			}
+			if( ( boundary_offset - chunk_offset ) >= minimum_chunk_size )
+			{
+				if( banalyze_set_chunk(
+				     chunks,
+				     maximum_number_of_chunks,
+				     number_of_chunks,
+				     analysis_methods,
+				     entropy_table,
+				     buffer,
+				     chunk_offset,
+				     boundary_offset - chunk_offset,
+				     buffer_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set chunk.",
+					 function );
+
+					return( -1 );
+				}
+				chunk_offset = boundary_offset;
+			}
+		}
+		if( scanned_size == 0 )
+		{
+			break;
+		}
+		scan_offset += scanned_size;
+	}
+	/* Data without boundaries is split into chunks of the maximum chunk size,
+	 * the last chunk of the data is smaller if needed
+	 */
+	while( ( *data_size - chunk_offset ) > maximum_chunk_size )
+	{
+		if( banalyze_set_chunk(
+		     chunks,
+		     maximum_number_of_chunks,
+		     number_of_chunks,
+		     analysis_methods,
+		     entropy_table,
+		     buffer,
+		     chunk_offset,
+		     maximum_chunk_size,
+		     buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk.",
+			 function );
+
+			return( -1 );
+		}
+		chunk_offset += maximum_chunk_size;
+	}
+	if( ( (size64_t) read_size == remaining_size )
+	 && ( chunk_offset < *data_size ) )
+	{
+		if( banalyze_set_chunk(
+		     chunks,
+		     maximum_number_of_chunks,
+		     number_of_chunks,
+		     analysis_methods,
+		     entropy_table,
+		     buffer,
+		     chunk_offset,
+		     *data_size - chunk_offset,
+		     buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk.",
+			 function );
+
+			return( -1 );
+		}
+		chunk_offset = *data_size;
+	}
+	*remainder_offset = chunk_offset;
+
+	return( 1 );
+}
+
+/* Analyzes the content-defined chunks of the source file for deduplication
+ * The chunks of a batch are calculated in runs by a thread pool while the next batch is
+ * read and split into chunks. The runs are retrieved from the thread pool in order as they
+ * complete, and their chunks looked up by their hash in a chunk set and written while
+ * the next runs are calculated. The summary of the deduplication is printed to the notify stream
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_analyze_chunks(
+     banalyze_output_t *output,
+     FILE *notify_stream,
+     libcfile_file_t *source_file,
+     assorted_async_file_t *async_file,
+     uint8_t analysis_methods,
+     const double *entropy_table,
+     size_t average_chunk_size,
+     size64_t source_size,
+     off64_t output_offset,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	assorted_adler32_rolling_t *rolling                     = NULL;
+	banalyze_block_t *chunks[ 2 ]                           = { NULL, NULL };
+	banalyze_chunk_set_t *chunk_set                         = NULL;
+	banalyze_constant_block_hashes_t *constant_block_hashes = NULL;
+	uint8_t *buffers[ 2 ]                                   = { NULL, NULL };
+	static char *function                                   = "banalyze_analyze_chunks";
+	size64_t duplicate_size                                 = 0;
+	size64_t read_offset                                    = 0;
+	size64_t total_size                                     = 0;
+	size_t batch_size                                       = 0;
+	size_t carry_size                                       = 0;
+	size_t chunk_index                                      = 0;
+	size_t data_size[ 2 ]                                   = { 0, 0 };
+	size_t maximum_number_of_chunks                         = 0;
+	size_t number_of_chunks[ 2 ]                            = { 0, 0 };
+	size_t number_of_duplicate_chunks                       = 0;
+	size_t remainder_offset[ 2 ]                            = { 0, 0 };
+	size_t total_number_of_chunks                           = 0;
+	uint64_t first_offset                                   = 0;
+	uint64_t fingerprint                                    = 0;
+	int batch_index                                         = 0;
+	int read_result                                         = 0;
+	int result                                              = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool  = NULL;
+	banalyze_block_run_t *run            = NULL;
+	banalyze_block_run_t *runs           = NULL;
+	size_t maximum_number_of_queued_runs = 0;
+	size_t maximum_number_of_runs        = 0;
+	size_t number_of_chunks_per_run      = 0;
+	size_t number_of_pushed_runs         = 0;
+	size_t number_of_runs                = 0;
+	size_t run_index                     = 0;
+#endif
+
+	if( notify_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid notify stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( average_chunk_size < BANALYZE_MINIMUM_AVERAGE_CHUNK_SIZE )
+	 || ( average_chunk_size > BANALYZE_MAXIMUM_AVERAGE_CHUNK_SIZE )
+	 || ( ( average_chunk_size & ( average_chunk_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid average chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( analysis_methods & ( BANALYZE_ANALYSIS_METHOD_MD5 | BANALYZE_ANALYSIS_METHOD_SHA256 ) ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported analysis methods, MD5 or SHA-256 required.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > BANALYZE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	batch_size = (size_t) number_of_threads * BANALYZE_BLOCKS_PER_THREAD * average_chunk_size;
+
+	if( batch_size < BANALYZE_MINIMUM_BATCH_SIZE )
+	{
+		batch_size = BANALYZE_MINIMUM_BATCH_SIZE;
+	}
+	if( batch_size > BANALYZE_MAXIMUM_BATCH_SIZE )
+	{
+		batch_size = BANALYZE_MAXIMUM_BATCH_SIZE;
+	}
+	/* The buffer also contains the data carried over from the previous batch,
+	 * which is less than the maximum chunk size
+	 */
+	maximum_number_of_chunks = ( ( batch_size + ( average_chunk_size * 4 ) ) / ( average_chunk_size / 4 ) ) + 1;
+
+	for( batch_index = 0;
+	     batch_index < 2;
+	     batch_index++ )
+	{
+		buffers[ batch_index ] = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * ( batch_size + ( average_chunk_size * 4 ) ) );
+
+		if( buffers[ batch_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+		chunks[ batch_index ] = (banalyze_block_t *) memory_allocate(
+		                                              sizeof( banalyze_block_t ) * maximum_number_of_chunks );
+
+		if( chunks[ batch_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunks: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_chunks_per_run = BANALYZE_CHUNK_RUN_SIZE / average_chunk_size;
+
+	if( number_of_chunks_per_run == 0 )
+	{
+		number_of_chunks_per_run = 1;
+	}
+	maximum_number_of_runs = ( maximum_number_of_chunks + number_of_chunks_per_run - 1 ) / number_of_chunks_per_run;
+
+	runs = (banalyze_block_run_t *) memory_allocate(
+	                                 sizeof( banalyze_block_run_t ) * maximum_number_of_runs );
+
+	if( runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create runs.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( assorted_adler32_rolling_initialize(
+	     &rolling,
+	     BANALYZE_CHUNK_WINDOW_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create rolling Adler-32.",
+		 function );
+
+		goto on_error;
+	}
+	if( banalyze_chunk_set_initialize(
+	     &chunk_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunk set.",
+		 function );
+
+		goto on_error;
+	}
+	/* Constant data without boundaries is split into chunks of the maximum chunk size
+	 */
+	constant_block_hashes = memory_allocate_structure(
+	                         banalyze_constant_block_hashes_t );
+
+	if( constant_block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create constant block hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     constant_block_hashes->analysis_methods,
+	     0,
+	     sizeof( uint8_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear constant block hashes.",
+		 function );
+
+		goto on_error;
+	}
+	constant_block_hashes->block_size = average_chunk_size * 4;
+
+	batch_index = 0;
+
+	if( banalyze_read_chunks(
+	     source_file,
+	     async_file,
+	     rolling,
+	     analysis_methods,
+	     entropy_table,
+	     buffers[ batch_index ],
+	     0,
+	     batch_size,
+	     average_chunk_size,
+	     chunks[ batch_index ],
+	     maximum_number_of_chunks,
+	     source_size,
+	     output_offset,
+	     &( number_of_chunks[ batch_index ] ),
+	     &( data_size[ batch_index ] ),
+	     &( remainder_offset[ batch_index ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunks at offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	read_offset = (size64_t) data_size[ batch_index ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	maximum_number_of_queued_runs = (size_t) number_of_threads * BANALYZE_NUMBER_OF_QUEUED_RUNS_PER_THREAD;
+
+	if( assorted_thread_pool_create(
+	     &thread_pool,
+	     number_of_threads,
+	     (int) maximum_number_of_queued_runs,
+	     (int (*)(intptr_t *, void *)) &banalyze_calculate_block_run_callback,
+	     NULL,
+	     ASSORTED_THREAD_POOL_FLAG_ORDERED_COMPLETION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	while( number_of_chunks[ batch_index ] > 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		number_of_runs = ( number_of_chunks[ batch_index ] + number_of_chunks_per_run - 1 ) / number_of_chunks_per_run;
+
+		for( run_index = 0;
+		     run_index < number_of_runs;
+		     run_index++ )
+		{
+			chunk_index = run_index * number_of_chunks_per_run;
+
+			runs[ run_index ].blocks           = &( chunks[ batch_index ][ chunk_index ] );
+			runs[ run_index ].number_of_blocks = number_of_chunks[ batch_index ] - chunk_index;
+
+			if( runs[ run_index ].number_of_blocks > number_of_chunks_per_run )
+			{
+				runs[ run_index ].number_of_blocks = number_of_chunks_per_run;
+			}
+		}
+		/* Keep at most the maximum number of runs in the thread pool
+		 * since pushing more would block until a run is retrieved
+		 */
+		number_of_pushed_runs = 0;
+
+		while( ( number_of_pushed_runs < number_of_runs )
+		    && ( number_of_pushed_runs < maximum_number_of_queued_runs ) )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( runs[ number_of_pushed_runs ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push run: %" PRIzd " onto thread pool.",
+				 function,
+				 number_of_pushed_runs );
+
+				goto on_error;
+			}
+			number_of_pushed_runs++;
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		/* The data after the last chunk is the start of the first chunk of the next batch
+		 */
+		carry_size = data_size[ batch_index ] - remainder_offset[ batch_index ];
+
+		if( carry_size > 0 )
+		{
+			if( memory_copy(
+			     buffers[ 1 - batch_index ],
+			     &( buffers[ batch_index ][ remainder_offset[ batch_index ] ] ),
+			     carry_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy remainder of batch.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Read the next batch while the current batch is being calculated
+		 * on a read error the current batch is still written before failing
+		 */
+		read_result = banalyze_read_chunks(
+		               source_file,
+		               async_file,
+		               rolling,
+		               analysis_methods,
+		               entropy_table,
+		               buffers[ 1 - batch_index ],
+		               carry_size,
+		               batch_size,
+		               average_chunk_size,
+		               chunks[ 1 - batch_index ],
+		               maximum_number_of_chunks,
+		               source_size - read_offset,
+		               output_offset + (off64_t) ( read_offset - carry_size ),
+		               &( number_of_chunks[ 1 - batch_index ] ),
+		               &( data_size[ 1 - batch_index ] ),
+		               &( remainder_offset[ 1 - batch_index ] ),
+		               error );
+
+		if( read_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunks at offset: %" PRIu64 ".",
+			 function,
+			 read_offset );
+
+			number_of_chunks[ 1 - batch_index ] = 0;
+		}
+		else
+		{
+			read_offset += (size64_t) ( data_size[ 1 - batch_index ] - carry_size );
+		}
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks[ batch_index ];
+		     chunk_index++ )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			/* The runs are retrieved in the order they were pushed,
+			 * after which the next run of the batch is pushed
+			 */
+			if( ( chunk_index % number_of_chunks_per_run ) == 0 )
+			{
+				if( assorted_thread_pool_pop_completed(
+				     thread_pool,
+				     (intptr_t **) &run,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve run of chunk: %" PRIzd " from thread pool.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				if( number_of_pushed_runs < number_of_runs )
+				{
+					if( assorted_thread_pool_push(
+					     thread_pool,
+					     (intptr_t *) &( runs[ number_of_pushed_runs ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to push run: %" PRIzd " onto thread pool.",
+						 function,
+						 number_of_pushed_runs );
+
+						goto on_error;
+					}
+					number_of_pushed_runs++;
+				}
+			}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+			/* Chunks that were not calculated by the thread pool are calculated here,
+			 * which also provides the error of a failed calculation
+			 */
+			if( chunks[ batch_index ][ chunk_index ].result != 1 )
+			{
+				if( banalyze_calculate_block(
+				     &( chunks[ batch_index ][ chunk_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to calculate chunk at offset: %" PRIi64 ".",
+					 function,
+					 chunks[ batch_index ][ chunk_index ].offset );
+
+					goto on_error;
+				}
+			}
+			if( chunks[ batch_index ][ chunk_index ].is_constant != 0 )
+			{
+				if( banalyze_get_constant_block_hashes(
+				     constant_block_hashes,
+				     &( chunks[ batch_index ][ chunk_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve constant block hashes at offset: %" PRIi64 ".",
+					 function,
+					 chunks[ batch_index ][ chunk_index ].offset );
+
+					goto on_error;
+				}
+			}
+			/* The fingerprint is the first 64 bits of the MD5 or otherwise the SHA-256 of the chunk
+			 */
+			if( ( analysis_methods & BANALYZE_ANALYSIS_METHOD_MD5 ) != 0 )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 chunks[ batch_index ][ chunk_index ].md5_hash,
+				 fingerprint );
+			}
+			else
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 chunks[ batch_index ][ chunk_index ].sha256_hash,
+				 fingerprint );
+			}
+			result = banalyze_chunk_set_insert(
+			          chunk_set,
+			          fingerprint,
+			          (uint64_t) chunks[ batch_index ][ chunk_index ].offset,
+			          &first_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert chunk at offset: %" PRIi64 " into chunk set.",
+				 function,
+				 chunks[ batch_index ][ chunk_index ].offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				chunks[ batch_index ][ chunk_index ].is_duplicate     = 1;
+				chunks[ batch_index ][ chunk_index ].duplicate_offset = (off64_t) first_offset;
+
+				number_of_duplicate_chunks += 1;
+				duplicate_size             += chunks[ batch_index ][ chunk_index ].size;
+			}
+			total_number_of_chunks += 1;
+			total_size             += chunks[ batch_index ][ chunk_index ].size;
+
+			if( banalyze_output_write_block(
+			     output,
+			     &( chunks[ batch_index ][ chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to write chunk at offset: %" PRIi64 ".",
+				 function,
+				 chunks[ batch_index ][ chunk_index ].offset );
+
+				goto on_error;
+			}
+		}
+		if( read_result != 1 )
+		{
+			goto on_error;
+		}
+		batch_index = 1 - batch_index;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( assorted_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 runs );
+
+	runs = NULL;
+#endif
+	/* Write the chunks before the summary since both can be written to the same stream
+	 */
+	if( banalyze_output_flush(
+	     output,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 notify_stream,
+	 "Number of chunks: %" PRIzu ", of which duplicate: %" PRIzu ".\n",
+	 total_number_of_chunks,
+	 number_of_duplicate_chunks );
+
+	fprintf(
+	 notify_stream,
+	 "Size of chunks: %" PRIu64 " bytes, of which duplicate: %" PRIu64 " bytes.\n",
+	 total_size,
+	 duplicate_size );
+
+	if( total_size > duplicate_size )
+	{
+		fprintf(
+		 notify_stream,
+		 "Deduplication ratio: %.2f.\n",
+		 (double) total_size / (double) ( total_size - duplicate_size ) );
+	}
+	memory_free(
+	 constant_block_hashes );
+
+	if( banalyze_chunk_set_free(
+	     &chunk_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk set.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_adler32_rolling_free(
+	     &rolling,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free rolling Adler-32.",
+		 function );
+
+		goto on_error;
+	}
+	for( batch_index = 0;
+	     batch_index < 2;
+	     batch_index++ )
+	{
+		memory_free(
+		 chunks[ batch_index ] );
+		memory_free(
+		 buffers[ batch_index ] );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( runs != NULL )
+	{
+		memory_free(
+		 runs );
+	}
+#endif
+	if( constant_block_hashes != NULL )
+	{
+		memory_free(
+		 constant_block_hashes );
+	}
+	if( chunk_set != NULL )
+	{
+		banalyze_chunk_set_free(
+		 &chunk_set,
+		 NULL );
+	}
+	if( rolling != NULL )
+	{
+		assorted_adler32_rolling_free(
+		 &rolling,
+		 NULL );
+	}
+	for( batch_index = 0;
+	     batch_index < 2;
+	     batch_index++ )
+	{
+		if( chunks[ batch_index ] != NULL )
+		{
+			memory_free(
+			 chunks[ batch_index ] );
+		}
+		if( buffers[ batch_index ] != NULL )
+		{
+			memory_free(
+			 buffers[ batch_index ] );
+		}
+	}
+	return( -1 );
+}
+
+/* Retrieves n * log2( n ) from the entropy table or calculates it if no table is available
+ * Returns n * log2( n )
+ */
+double banalyze_get_n_log2_n(
+        const double *entropy_table,
+        uint64_t count )
+{
+	if( entropy_table != NULL )
+	{
+		return( entropy_table[ count ] );
+	}
+	if( count == 0 )
+	{
+		return( 0.0 );
+	}
+	return( (double) count * ( log( (double) count ) / log( 2 ) ) );
+}
+
+/* Analyzes the byte entropy of overlapping blocks (a sliding window) that start every stride bytes
+ * The distribution table and the sum of n * log2( n ) are updated for the bytes that leave
+ * and enter the window instead of recalculating the entire window
+ * The entropy table is optional and must contain n * log2( n ) for every n up to the block size
+ * The data is read from the asynchronous file if set, otherwise from the source file
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_analyze_sliding_window(
+     banalyze_output_t *output,
+     libcfile_file_t *source_file,
+     assorted_async_file_t *async_file,
+     const double *entropy_table,
+     size_t block_size,
+     size_t stride,
+     size64_t source_size,
+     off64_t output_offset,
+     libcerror_error_t **error )
+{
+	banalyze_block_t window_block;
+	uint64_t distribution_table[ 256 ];
+
+	uint8_t *buffer         = NULL;
+	static char *function   = "banalyze_analyze_sliding_window";
+	size64_t read_offset    = 0;
+	size64_t window_offset  = 0;
+	size_t buffer_offset    = 0;
+	size_t buffer_size      = 0;
+	size_t data_size        = 0;
+	size_t read_size        = 0;
+	size_t stride_index     = 0;
+	size_t window_size      = 0;
+	ssize_t read_count      = 0;
+	double entropy          = 0.0;
+	double sum              = 0.0;
+	uint16_t byte_value     = 0;
+	uint8_t entering_byte   = 0;
+	uint8_t leaving_byte    = 0;
+	int number_of_steps     = 0;
+
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) ( SSIZE_MAX - BANALYZE_SLIDING_WINDOW_READ_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stride == 0 )
+	 || ( stride >= block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stride value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	window_size = block_size;
+
+	if( (size64_t) window_size > source_size )
+	{
+		window_size = (size_t) source_size;
+	}
+	if( window_size == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     &window_block,
+	     0,
+	     sizeof( banalyze_block_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear window block.",
+		 function );
+
+		return( -1 );
+	}
+	window_block.analysis_methods = BANALYZE_ANALYSIS_METHOD_ENTROPY;
+	window_block.size             = window_size;
+
+	buffer_size = block_size + BANALYZE_SLIDING_WINDOW_READ_SIZE;
+
+	if( stride > BANALYZE_SLIDING_WINDOW_READ_SIZE )
+	{
+		buffer_size = block_size + stride;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		/* Make sure the window and the bytes entering it with the next step are in the buffer
+		 */
+		if( ( read_offset < source_size )
+		 && ( ( buffer_offset + window_size + stride ) > data_size ) )
+		{
+			if( buffer_offset > 0 )
+			{
+				if( memory_move(
+				     buffer,
+				     &( buffer[ buffer_offset ] ),
+				     data_size - buffer_offset ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to move window data.",
+					 function );
+
+					goto on_error;
+				}
+				data_size    -= buffer_offset;
+				buffer_offset = 0;
+			}
+			read_size = buffer_size - data_size;
+
+			if( (size64_t) read_size > ( source_size - read_offset ) )
+			{
+				read_size = (size_t) ( source_size - read_offset );
+			}
+			/* Clear buffer before read since in some cases like volsnap.sys
+			 * read will return successful without actually filling the buffer
+			 */
+			if( memory_set(
+			     &( buffer[ data_size ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				goto on_error;
+			}
+			if( async_file != NULL )
+			{
+				read_count = assorted_async_file_read_buffer(
+				              async_file,
+				              &( buffer[ data_size ] ),
+				              read_size,
+				              error );
+			}
+			else
+			{
+				read_count = libcfile_file_read_buffer(
+				              source_file,
+				              &( buffer[ data_size ] ),
+				              read_size,
+				              error );
+			}
 
-		case 2:
-			if( libhmac_md5_calculate(
-			     block_buffer,
-			     block_size,
-			     md5_hash,
-			     LIBHMAC_MD5_HASH_SIZE,
-			     error ) != 1 )
+			if( read_count != (ssize_t) read_size )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to calculate MD5.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIu64 " from source file.",
+				 function,
+				 read_offset );
 
-				return( -1 );
+				goto on_error;
 			}
-			if( digest_hash_copy_to_string(
-			     md5_hash,
-			     LIBHMAC_MD5_HASH_SIZE,
-			     md5_hash_string,
-			     DIGEST_HASH_STRING_SIZE_MD5,
+			data_size   += read_size;
+			read_offset += read_size;
+		}
+		if( window_offset == 0 )
+		{
+			if( banalyze_determine_byte_distribution(
+			     buffer,
+			     window_size,
+			     distribution_table,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set MD5 hash string.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine byte distribution.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
-			fprintf(
-			 stdout,
-			 "block 0x%08" PRIx64 " - 0x%08" PRIx64 ": MD5: %" PRIs_SYSTEM "\n",
-			 block_offset,
-			 block_offset + block_size,
-			 md5_hash_string );
+		}
+		else
+		{
+			for( stride_index = 0;
+			     stride_index < stride;
+			     stride_index++ )
+			{
+				leaving_byte  = buffer[ buffer_offset + stride_index ];
+				entering_byte = buffer[ buffer_offset + window_size + stride_index ];
+
+				if( leaving_byte != entering_byte )
+				{
+					sum -= banalyze_get_n_log2_n(
+					        entropy_table,
+					        distribution_table[ leaving_byte ] );
+					sum -= banalyze_get_n_log2_n(
+					        entropy_table,
+					        distribution_table[ entering_byte ] );
+
+					distribution_table[ leaving_byte ]  -= 1;
+					distribution_table[ entering_byte ] += 1;
+
+					sum += banalyze_get_n_log2_n(
+					        entropy_table,
+					        distribution_table[ leaving_byte ] );
+					sum += banalyze_get_n_log2_n(
+					        entropy_table,
+					        distribution_table[ entering_byte ] );
+				}
+			}
+			buffer_offset += stride;
+		}
+		if( number_of_steps == 0 )
+		{
+			sum = 0.0;
 
-			break;
+			for( byte_value = 0;
+			     byte_value < 256;
+			     byte_value++ )
+			{
+				sum += banalyze_get_n_log2_n(
+				        entropy_table,
+				        distribution_table[ byte_value ] );
+			}
+			number_of_steps = BANALYZE_SLIDING_WINDOW_RESYNC_INTERVAL;
+		}
+		number_of_steps--;
 
-		default:
-			break;
+		entropy = ( banalyze_get_n_log2_n(
+		             entropy_table,
+		             window_size ) - sum ) / (double) window_size;
+
+		if( entropy < 0.0 )
+		{
+			entropy = 0.0;
+		}
+		window_block.offset  = output_offset + (off64_t) window_offset;
+		window_block.entropy = entropy;
+
+		if( banalyze_output_write_block(
+		     output,
+		     &window_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to write window at offset: %" PRIu64 ".",
+			 function,
+			 window_offset );
+
+			goto on_error;
+		}
+		window_offset += stride;
 	}
+	while( ( window_offset + window_size ) <= source_size );
+
+	memory_free(
+	 buffer );
+
 	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
 }
 
 /* The main program
@@ -300,37 +2962,43 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "banalyze";
-	system_integer_t option      = 0;
-	size64_t block_size          = 512;
-	size64_t source_size         = 0;
-	size_t buffer_size           = 0;
-	size_t read_size             = 0;
-	ssize_t read_count           = 0;
-	off64_t block_offset         = 0;
-	off64_t source_offset        = 0;
-	int analysis_method          = 1;
-	int output_relative_offset   = 0;
-	int result                   = 0;
-	int verbose                  = 0;
-
-	assorted_output_version_fprint(
-	 stdout,
-	 program );
+	assorted_async_file_t *async_file = NULL;
+	banalyze_output_t *output         = NULL;
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *source_file      = NULL;
+	FILE *notify_stream               = stdout;
+	system_character_t *format        = NULL;
+	system_character_t *source        = NULL;
+	double *entropy_table             = NULL;
+	char *program                     = "banalyze";
+	system_integer_t option           = 0;
+	uint8_t analysis_methods          = 0;
+	uint8_t output_format             = BANALYZE_OUTPUT_FORMAT_TEXT;
+	size64_t block_size               = 512;
+	size64_t source_size              = 0;
+	size_t chunk_size                 = 0;
+	size_t stride                     = 0;
+	off64_t block_offset              = 0;
+	off64_t source_offset             = 0;
+	int number_of_threads             = 1;
+	int output_relative_offset        = 0;
+	int result                        = 0;
+	int use_asynchronous_io           = 0;
+	int verbose                       = 0;
 
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12b:ho:rs:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "1234Ab:c:f:hj:o:rs:t:vVw:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case '?':
 			default:
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -343,12 +3011,27 @@ int main( int argc, char * const argv[] )
 
 
 			case '1':
-				analysis_method = 1;
+				analysis_methods |= BANALYZE_ANALYSIS_METHOD_ENTROPY;
 
 				break;
 
 			case '2':
-				analysis_method = 2;
+				analysis_methods |= BANALYZE_ANALYSIS_METHOD_MD5;
+
+				break;
+
+			case '3':
+				analysis_methods |= BANALYZE_ANALYSIS_METHOD_SHA256;
+
+				break;
+
+			case '4':
+				analysis_methods |= BANALYZE_ANALYSIS_METHOD_COMPRESSIBILITY;
+
+				break;
+
+			case 'A':
+				use_asynchronous_io = 1;
 
 				break;
 
@@ -360,7 +3043,21 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 'c':
+				chunk_size = (size_t) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'f':
+				format = optarg;
+
+				break;
+
 			case 'h':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
@@ -387,6 +3084,11 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
 
 			case 'v':
 				verbose = 1;
@@ -394,12 +3096,57 @@ int main( int argc, char * const argv[] )
 				break;
 
 			case 'V':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				assorted_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case 'w':
+				stride = (size_t) system_string_copy_to_long( optarg );
+
+				break;
+		}
+	}
+	if( format != NULL )
+	{
+		result = banalyze_output_format_from_string(
+		          format,
+		          &output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format: %" PRIs_SYSTEM ".\n",
+			 format );
+
+			return( EXIT_FAILURE );
+		}
+		if( output_format != BANALYZE_OUTPUT_FORMAT_TEXT )
+		{
+			notify_stream = stderr;
 		}
 	}
+	/* The results are written to stdout, other output is written to stderr
+	 * when the output format is not text
+	 */
+	assorted_output_version_fprint(
+	 notify_stream,
+	 program );
+
 	if( optind == argc )
 	{
 		fprintf(
@@ -413,6 +3160,85 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( chunk_size != 0 )
+	{
+		if( ( chunk_size < BANALYZE_MINIMUM_AVERAGE_CHUNK_SIZE )
+		 || ( chunk_size > BANALYZE_MAXIMUM_AVERAGE_CHUNK_SIZE )
+		 || ( ( chunk_size & ( chunk_size - 1 ) ) != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid chunk size value not a power of 2 from 256 to 65536.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( stride != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Sliding window not supported for chunks.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		/* The duplicate chunks are determined by their MD5 or SHA-256
+		 */
+		if( ( analysis_methods & ( BANALYZE_ANALYSIS_METHOD_MD5 | BANALYZE_ANALYSIS_METHOD_SHA256 ) ) == 0 )
+		{
+			analysis_methods |= BANALYZE_ANALYSIS_METHOD_MD5;
+		}
+		analysis_methods |= BANALYZE_ANALYSIS_METHOD_DEDUPLICATION;
+
+		/* The largest chunk is 4 times the average chunk size
+		 */
+		block_size = (size64_t) chunk_size * 4;
+	}
+	if( analysis_methods == 0 )
+	{
+		analysis_methods = BANALYZE_ANALYSIS_METHOD_ENTROPY;
+	}
+	if( number_of_threads < 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value zero or less.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_threads > BANALYZE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value exceeds maximum.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( stride != 0 )
+	{
+		if( analysis_methods != BANALYZE_ANALYSIS_METHOD_ENTROPY )
+		{
+			fprintf(
+			 stderr,
+			 "Sliding window only supported for block entropy.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( stride >= block_size )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid stride value exceeds block size.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( number_of_threads > 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Sliding window does not support multiple threads.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -482,28 +3308,39 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Create the input buffer
-	 */
-	if( block_size > (size_t) SSIZE_MAX )
+	if( block_size == 0 )
 	{
 		fprintf(
 		 stderr,
-		 "Invalid block size value exceeds maximum.\n" );
+		 "Invalid block size value is zero.\n" );
 
 		goto on_error;
 	}
-	buffer_size = block_size;
-
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
+	if( block_size > (size_t) SSIZE_MAX )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create buffer.\n" );
+		 "Invalid block size value exceeds maximum.\n" );
 
-		return( EXIT_FAILURE );
+		goto on_error;
+	}
+	/* The entropy of small blocks is dominated by the logarithms of the byte counts,
+	 * which are calculated once for every possible byte count
+	 */
+	if( ( ( analysis_methods & BANALYZE_ANALYSIS_METHOD_ENTROPY ) != 0 )
+	 && ( block_size <= BANALYZE_MAXIMUM_ENTROPY_TABLE_BLOCK_SIZE ) )
+	{
+		if( banalyze_entropy_table_initialize(
+		     &entropy_table,
+		     (size_t) block_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create entropy table.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Position the source file at the right offset
 	 */
@@ -519,81 +3356,193 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( use_asynchronous_io != 0 )
+	{
+		if( assorted_async_file_initialize(
+		     &async_file,
+		     BANALYZE_ASYNCHRONOUS_READ_SIZE,
+		     ASSORTED_ASYNC_FILE_DEFAULT_QUEUE_DEPTH,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create asynchronous file.\n" );
+
+			goto on_error;
+		}
+		result = assorted_async_file_open(
+		          async_file,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file for asynchronous I/O.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Asynchronous I/O not supported, reading source file instead.\n" );
+
+			if( assorted_async_file_free(
+			     &async_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free asynchronous file.\n" );
+
+				goto on_error;
+			}
+		}
+	}
 	fprintf(
-	 stdout,
+	 notify_stream,
 	 "Starting block analysis of: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
 	 source,
 	 source_offset,
 	 source_offset );
 
-	while( (size64_t) block_offset < source_size )
+	if( banalyze_output_initialize(
+	     &output,
+	     stdout,
+	     output_format,
+	     analysis_methods,
+	     &error ) != 1 )
 	{
-		/* Clear buffer before read since in some cases like volsnap.sys
-		 * read will return successful without actually filling the buffer
-		 */
-		if( memory_set(
-		     buffer,
-		     0,
-		     buffer_size ) == NULL )
+		fprintf(
+		 stderr,
+		 "Unable to create output.\n" );
+
+		goto on_error;
+	}
+	if( banalyze_output_write_header(
+	     output,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write output header.\n" );
+
+		goto on_error;
+	}
+	if( chunk_size != 0 )
+	{
+		if( output_relative_offset == 0 )
+		{
+			block_offset = source_offset;
+		}
+		if( banalyze_analyze_chunks(
+		     output,
+		     notify_stream,
+		     source_file,
+		     async_file,
+		     analysis_methods,
+		     entropy_table,
+		     chunk_size,
+		     source_size,
+		     block_offset,
+		     number_of_threads,
+		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to clear read buffer.\n" );
+			 "Unable to analyze chunks.\n" );
 
 			goto on_error;
 		}
-		read_size = buffer_size;
-
-		if( read_size > ( source_size - block_offset ) )
+	}
+	else if( stride != 0 )
+	{
+		if( output_relative_offset == 0 )
 		{
-			read_size = (size_t) ( source_size - block_offset );
+			block_offset = source_offset;
 		}
-		read_count = libcfile_file_read_buffer(
-			      source_file,
-			      buffer,
-			      read_size,
-		              &error );
-
-		if( read_count != (ssize_t) read_size )
+		if( banalyze_analyze_sliding_window(
+		     output,
+		     source_file,
+		     async_file,
+		     entropy_table,
+		     (size_t) block_size,
+		     stride,
+		     source_size,
+		     block_offset,
+		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to read block from source file.\n" );
+			 "Unable to analyze sliding window.\n" );
 
 			goto on_error;
 		}
-		if( output_relative_offset != 0 )
-		{
-			result = banalyze_analyze_block(
-			          analysis_method,
-			          buffer,
-			          read_size,
-			          block_offset,
-			          &error );
-		}
-		else
+	}
+	else
+	{
+		if( output_relative_offset == 0 )
 		{
-			result = banalyze_analyze_block(
-			          analysis_method,
-			          buffer,
-			          read_size,
-			          source_offset + block_offset,
-			          &error );
+			block_offset = source_offset;
 		}
-		if( result != 1 )
+		if( banalyze_analyze_blocks(
+		     output,
+		     source_file,
+		     async_file,
+		     analysis_methods,
+		     entropy_table,
+		     (size_t) block_size,
+		     source_size,
+		     block_offset,
+		     number_of_threads,
+		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to analyze block at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 source_offset + block_offset,
-			 source_offset + block_offset );
+			 "Unable to analyze blocks.\n" );
 
 			goto on_error;
 		}
-		block_offset += read_size;
+	}
+	if( banalyze_output_flush(
+	     output,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write output.\n" );
+
+		goto on_error;
 	}
 	/* Clean up
 	 */
+	if( banalyze_output_free(
+	     &output,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free output.\n" );
+
+		goto on_error;
+	}
+	if( async_file != NULL )
+	{
+		if( assorted_async_file_free(
+		     &async_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free asynchronous file.\n" );
+
+			goto on_error;
+		}
+	}
 	if( libcfile_file_close(
 	     source_file,
 	     &error ) != 0 )
@@ -614,9 +3563,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 buffer );
-
+	if( entropy_table != NULL )
+	{
+		memory_free(
+		 entropy_table );
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -627,10 +3578,22 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( buffer != NULL )
+	if( output != NULL )
+	{
+		banalyze_output_free(
+		 &output,
+		 NULL );
+	}
+	if( async_file != NULL )
+	{
+		assorted_async_file_free(
+		 &async_file,
+		 NULL );
+	}
+	if( entropy_table != NULL )
 	{
 		memory_free(
-		 buffer );
+		 entropy_table );
 	}
 	if( source_file != NULL )
 	{
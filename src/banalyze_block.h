@@ -0,0 +1,143 @@
+/*
+ * Analyzed block
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BANALYZE_BLOCK_H )
+#define _BANALYZE_BLOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum BANALYZE_ANALYSIS_METHODS
+{
+	BANALYZE_ANALYSIS_METHOD_ENTROPY		= 0x01,
+	BANALYZE_ANALYSIS_METHOD_MD5			= 0x02,
+	BANALYZE_ANALYSIS_METHOD_SHA256			= 0x04,
+	BANALYZE_ANALYSIS_METHOD_COMPRESSIBILITY	= 0x08,
+	BANALYZE_ANALYSIS_METHOD_DEDUPLICATION		= 0x10
+};
+
+typedef struct banalyze_block banalyze_block_t;
+
+struct banalyze_block
+{
+	/* The analysis methods
+	 */
+	uint8_t analysis_methods;
+
+	/* The block data
+	 */
+	const uint8_t *data;
+
+	/* The block size
+	 */
+	size_t size;
+
+	/* The (printed) block offset
+	 */
+	off64_t offset;
+
+	/* The n * log2( n ) table or NULL if not available
+	 */
+	const double *entropy_table;
+
+	/* The calculated byte entropy
+	 */
+	double entropy;
+
+	/* The calculated MD5 hash
+	 */
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* The calculated SHA-256 hash
+	 */
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	/* The estimated compressibility
+	 */
+	double compressibility;
+
+	/* Value to indicate all bytes of the block have the same value
+	 */
+	uint8_t is_constant;
+
+	/* The byte value of a constant block
+	 */
+	uint8_t constant_byte_value;
+
+	/* Value to indicate an earlier block has the same content
+	 */
+	uint8_t is_duplicate;
+
+	/* The (printed) offset of the first block with the same content
+	 */
+	off64_t duplicate_offset;
+
+	/* The result of the block calculation, 0 if not calculated
+	 */
+	int result;
+};
+
+typedef struct banalyze_block_run banalyze_block_run_t;
+
+struct banalyze_block_run
+{
+	/* The consecutive blocks
+	 */
+	banalyze_block_t *blocks;
+
+	/* The number of blocks
+	 */
+	size_t number_of_blocks;
+};
+
+typedef struct banalyze_constant_block_hashes banalyze_constant_block_hashes_t;
+
+struct banalyze_constant_block_hashes
+{
+	/* The size of the blocks of which the hashes are stored
+	 */
+	size_t block_size;
+
+	/* The analysis methods of which the hash is stored per byte value
+	 */
+	uint8_t analysis_methods[ 256 ];
+
+	/* The MD5 hash per byte value
+	 */
+	uint8_t md5_hashes[ 256 ][ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* The SHA-256 hash per byte value
+	 */
+	uint8_t sha256_hashes[ 256 ][ LIBHMAC_SHA256_HASH_SIZE ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BANALYZE_BLOCK_H ) */
+
@@ -0,0 +1,342 @@
+/*
+ * Set of chunk fingerprints used for deduplication analysis
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "banalyze_chunk_set.h"
+
+/* Creates a chunk set
+ * Make sure the value chunk_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_chunk_set_initialize(
+     banalyze_chunk_set_t **chunk_set,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_chunk_set_initialize";
+
+	if( chunk_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_set = memory_allocate_structure(
+	              banalyze_chunk_set_t );
+
+	if( *chunk_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_set,
+	     0,
+	     sizeof( banalyze_chunk_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk set.",
+		 function );
+
+		memory_free(
+		 *chunk_set );
+
+		*chunk_set = NULL;
+
+		return( -1 );
+	}
+	if( banalyze_chunk_set_resize(
+	     *chunk_set,
+	     BANALYZE_CHUNK_SET_INITIAL_NUMBER_OF_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize chunk set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_set != NULL )
+	{
+		memory_free(
+		 *chunk_set );
+
+		*chunk_set = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk set
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_chunk_set_free(
+     banalyze_chunk_set_t **chunk_set,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_chunk_set_free";
+
+	if( chunk_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_set != NULL )
+	{
+		if( ( *chunk_set )->entries != NULL )
+		{
+			memory_free(
+			 ( *chunk_set )->entries );
+		}
+		memory_free(
+		 *chunk_set );
+
+		*chunk_set = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the entries of a chunk set
+ * The used entries are reinserted into the resized entries
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_chunk_set_resize(
+     banalyze_chunk_set_t *chunk_set,
+     size_t number_of_entries,
+     libcerror_error_t **error )
+{
+	banalyze_chunk_set_entry_t *entries = NULL;
+	static char *function               = "banalyze_chunk_set_resize";
+	size_t entry_index                  = 0;
+	size_t entry_mask                   = 0;
+	size_t old_entry_index              = 0;
+
+	if( chunk_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( ( number_of_entries & ( number_of_entries - 1 ) ) != 0 )
+	 || ( number_of_entries <= chunk_set->number_of_used_entries )
+	 || ( number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( banalyze_chunk_set_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries = (banalyze_chunk_set_entry_t *) memory_allocate(
+	                                          sizeof( banalyze_chunk_set_entry_t ) * number_of_entries );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     sizeof( banalyze_chunk_set_entry_t ) * number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		memory_free(
+		 entries );
+
+		return( -1 );
+	}
+	entry_mask = number_of_entries - 1;
+
+	for( old_entry_index = 0;
+	     old_entry_index < chunk_set->number_of_entries;
+	     old_entry_index++ )
+	{
+		if( chunk_set->entries[ old_entry_index ].fingerprint == 0 )
+		{
+			continue;
+		}
+		entry_index = (size_t) chunk_set->entries[ old_entry_index ].fingerprint & entry_mask;
+
+		while( entries[ entry_index ].fingerprint != 0 )
+		{
+			entry_index = ( entry_index + 1 ) & entry_mask;
+		}
+		entries[ entry_index ] = chunk_set->entries[ old_entry_index ];
+	}
+	if( chunk_set->entries != NULL )
+	{
+		memory_free(
+		 chunk_set->entries );
+	}
+	chunk_set->entries           = entries;
+	chunk_set->number_of_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Inserts a chunk fingerprint into the chunk set
+ * The fingerprint is used as hash, so it should be taken from a cryptographic hash of the chunk
+ * If the fingerprint is already in the set the offset of the first chunk is returned
+ * Returns 1 if inserted, 0 if already in the set or -1 on error
+ */
+int banalyze_chunk_set_insert(
+     banalyze_chunk_set_t *chunk_set,
+     uint64_t fingerprint,
+     uint64_t offset,
+     uint64_t *first_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_chunk_set_insert";
+	size_t entry_index    = 0;
+	size_t entry_mask     = 0;
+
+	if( chunk_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk set.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The fingerprint 0 marks an unused entry
+	 */
+	if( fingerprint == 0 )
+	{
+		fingerprint = 1;
+	}
+	entry_mask  = chunk_set->number_of_entries - 1;
+	entry_index = (size_t) fingerprint & entry_mask;
+
+	while( chunk_set->entries[ entry_index ].fingerprint != 0 )
+	{
+		if( chunk_set->entries[ entry_index ].fingerprint == fingerprint )
+		{
+			*first_offset = chunk_set->entries[ entry_index ].offset;
+
+			return( 0 );
+		}
+		entry_index = ( entry_index + 1 ) & entry_mask;
+	}
+	chunk_set->entries[ entry_index ].fingerprint = fingerprint;
+	chunk_set->entries[ entry_index ].offset      = offset;
+
+	chunk_set->number_of_used_entries += 1;
+
+	*first_offset = offset;
+
+	/* Keep the load factor at 3/4 or less so that the linear probe sequences remain short
+	 */
+	if( chunk_set->number_of_used_entries > ( ( chunk_set->number_of_entries / 4 ) * 3 ) )
+	{
+		if( banalyze_chunk_set_resize(
+		     chunk_set,
+		     chunk_set->number_of_entries * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize chunk set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
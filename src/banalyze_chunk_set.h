@@ -0,0 +1,94 @@
+/*
+ * Set of chunk fingerprints used for deduplication analysis
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _BANALYZE_CHUNK_SET_H )
+#define _BANALYZE_CHUNK_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of entries of the chunk set
+ */
+#define BANALYZE_CHUNK_SET_INITIAL_NUMBER_OF_ENTRIES	65536
+
+typedef struct banalyze_chunk_set_entry banalyze_chunk_set_entry_t;
+
+struct banalyze_chunk_set_entry
+{
+	/* The chunk fingerprint, 0 if the entry is not used
+	 */
+	uint64_t fingerprint;
+
+	/* The offset of the first chunk with the fingerprint
+	 */
+	uint64_t offset;
+};
+
+typedef struct banalyze_chunk_set banalyze_chunk_set_t;
+
+struct banalyze_chunk_set
+{
+	/* The entries
+	 */
+	banalyze_chunk_set_entry_t *entries;
+
+	/* The number of entries, which is a power of 2
+	 */
+	size_t number_of_entries;
+
+	/* The number of used entries
+	 */
+	size_t number_of_used_entries;
+};
+
+int banalyze_chunk_set_initialize(
+     banalyze_chunk_set_t **chunk_set,
+     libcerror_error_t **error );
+
+int banalyze_chunk_set_free(
+     banalyze_chunk_set_t **chunk_set,
+     libcerror_error_t **error );
+
+int banalyze_chunk_set_resize(
+     banalyze_chunk_set_t *chunk_set,
+     size_t number_of_entries,
+     libcerror_error_t **error );
+
+int banalyze_chunk_set_insert(
+     banalyze_chunk_set_t *chunk_set,
+     uint64_t fingerprint,
+     uint64_t offset,
+     uint64_t *first_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BANALYZE_CHUNK_SET_H ) */
+
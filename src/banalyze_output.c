@@ -0,0 +1,740 @@
+/*
+ * Block analysis output
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libhmac.h"
+#include "banalyze_block.h"
+#include "banalyze_output.h"
+
+/* Creates an output
+ * Make sure the value output is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_output_initialize(
+     banalyze_output_t **output,
+     FILE *stream,
+     uint8_t format,
+     uint8_t analysis_methods,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_output_initialize";
+
+	if( output == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != BANALYZE_OUTPUT_FORMAT_TEXT )
+	 && ( format != BANALYZE_OUTPUT_FORMAT_JSONL )
+	 && ( format != BANALYZE_OUTPUT_FORMAT_BINARY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*output = memory_allocate_structure(
+	           banalyze_output_t );
+
+	if( *output == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output,
+	     0,
+	     sizeof( banalyze_output_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output.",
+		 function );
+
+		memory_free(
+		 *output );
+
+		*output = NULL;
+
+		return( -1 );
+	}
+	( *output )->buffer = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * BANALYZE_OUTPUT_BUFFER_SIZE );
+
+	if( ( *output )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output )->stream           = stream;
+	( *output )->format           = format;
+	( *output )->analysis_methods = analysis_methods;
+
+	return( 1 );
+
+on_error:
+	if( *output != NULL )
+	{
+		memory_free(
+		 *output );
+
+		*output = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output
+ * Data in the buffer that has not been flushed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_output_free(
+     banalyze_output_t **output,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_output_free";
+
+	if( output == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output != NULL )
+	{
+		memory_free(
+		 ( *output )->buffer );
+
+		memory_free(
+		 *output );
+
+		*output = NULL;
+	}
+	return( 1 );
+}
+
+/* Writes the buffered data to the stream
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_output_flush(
+     banalyze_output_t *output,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_output_flush";
+	size_t write_count    = 0;
+
+	if( output == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output.",
+		 function );
+
+		return( -1 );
+	}
+	if( output->buffer_offset > 0 )
+	{
+		write_count = file_stream_write(
+		               output->stream,
+		               output->buffer,
+		               output->buffer_offset );
+
+		if( write_count != output->buffer_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer.",
+			 function );
+
+			return( -1 );
+		}
+		output->buffer_offset = 0;
+	}
+	return( 1 );
+}
+
+/* Appends a string to the buffer
+ * The caller must ensure there is sufficient space in the buffer
+ */
+void banalyze_output_append_string(
+      banalyze_output_t *output,
+      const char *string,
+      size_t string_length )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		output->buffer[ output->buffer_offset++ ] = (uint8_t) string[ string_index ];
+	}
+}
+
+/* Appends a lower case hexadecimal value, without prefix, to the buffer
+ * The caller must ensure there is sufficient space in the buffer
+ */
+void banalyze_output_append_hexadecimal(
+      banalyze_output_t *output,
+      uint64_t value,
+      int minimum_number_of_digits )
+{
+	uint8_t digits[ 16 ];
+
+	uint8_t nibble        = 0;
+	int number_of_digits  = 0;
+
+	do
+	{
+		nibble = (uint8_t) ( value & 0x0f );
+
+		if( nibble <= 9 )
+		{
+			digits[ number_of_digits++ ] = (uint8_t) '0' + nibble;
+		}
+		else
+		{
+			digits[ number_of_digits++ ] = (uint8_t) 'a' + nibble - 10;
+		}
+		value >>= 4;
+	}
+	while( value != 0 );
+
+	while( number_of_digits < minimum_number_of_digits )
+	{
+		digits[ number_of_digits++ ] = (uint8_t) '0';
+	}
+	while( number_of_digits > 0 )
+	{
+		output->buffer[ output->buffer_offset++ ] = digits[ --number_of_digits ];
+	}
+}
+
+/* Appends a decimal value to the buffer
+ * The caller must ensure there is sufficient space in the buffer
+ */
+void banalyze_output_append_decimal(
+      banalyze_output_t *output,
+      uint64_t value )
+{
+	uint8_t digits[ 20 ];
+
+	int number_of_digits = 0;
+
+	do
+	{
+		digits[ number_of_digits++ ] = (uint8_t) '0' + (uint8_t) ( value % 10 );
+
+		value /= 10;
+	}
+	while( value != 0 );
+
+	while( number_of_digits > 0 )
+	{
+		output->buffer[ output->buffer_offset++ ] = digits[ --number_of_digits ];
+	}
+}
+
+/* Appends a floating-point value with 6 decimals to the buffer
+ * The caller must ensure there is sufficient space in the buffer
+ */
+void banalyze_output_append_double(
+      banalyze_output_t *output,
+      double value )
+{
+	int print_count = 0;
+
+	print_count = narrow_string_snprintf(
+	               (char *) &( output->buffer[ output->buffer_offset ] ),
+	               BANALYZE_OUTPUT_BUFFER_SIZE - output->buffer_offset,
+	               "%f",
+	               value );
+
+	if( ( print_count > 0 )
+	 && ( (size_t) print_count < ( BANALYZE_OUTPUT_BUFFER_SIZE - output->buffer_offset ) ) )
+	{
+		output->buffer_offset += (size_t) print_count;
+	}
+}
+
+/* Appends a hash as a lower case hexadecimal string to the buffer
+ * The caller must ensure there is sufficient space in the buffer
+ */
+void banalyze_output_append_hash_string(
+      banalyze_output_t *output,
+      const uint8_t *hash,
+      size_t hash_size )
+{
+	size_t hash_index = 0;
+
+	for( hash_index = 0;
+	     hash_index < hash_size;
+	     hash_index++ )
+	{
+		banalyze_output_append_hexadecimal(
+		 output,
+		 (uint64_t) hash[ hash_index ],
+		 2 );
+	}
+}
+
+/* Appends a 64-bit little-endian value to the buffer
+ * The caller must ensure there is sufficient space in the buffer
+ */
+void banalyze_output_append_uint64(
+      banalyze_output_t *output,
+      uint64_t value )
+{
+	byte_stream_copy_from_uint64_little_endian(
+	 &( output->buffer[ output->buffer_offset ] ),
+	 value );
+
+	output->buffer_offset += 8;
+}
+
+/* Appends a floating-point value as its 64-bit little-endian IEEE 754 representation to the buffer
+ * The caller must ensure there is sufficient space in the buffer
+ */
+void banalyze_output_append_binary_double(
+      banalyze_output_t *output,
+      double value )
+{
+	uint64_t value_64bit = 0;
+
+	memory_copy(
+	 &value_64bit,
+	 &value,
+	 sizeof( uint64_t ) );
+
+	banalyze_output_append_uint64(
+	 output,
+	 value_64bit );
+}
+
+/* Writes the header of the output, which is only used by the binary format
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_output_write_header(
+     banalyze_output_t *output,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_output_write_header";
+
+	if( output == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output.",
+		 function );
+
+		return( -1 );
+	}
+	if( output->format != BANALYZE_OUTPUT_FORMAT_BINARY )
+	{
+		return( 1 );
+	}
+	banalyze_output_append_string(
+	 output,
+	 BANALYZE_OUTPUT_BINARY_SIGNATURE,
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( output->buffer[ output->buffer_offset ] ),
+	 BANALYZE_OUTPUT_BINARY_FORMAT_VERSION );
+
+	output->buffer_offset += 4;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( output->buffer[ output->buffer_offset ] ),
+	 output->analysis_methods );
+
+	output->buffer_offset += 4;
+
+	return( 1 );
+}
+
+/* Writes the analysis of a block
+ * The record is buffered and the buffer is written when it is nearly full
+ * Returns 1 if successful or -1 on error
+ */
+int banalyze_output_write_block(
+     banalyze_output_t *output,
+     banalyze_block_t *block,
+     libcerror_error_t **error )
+{
+	static char *function = "banalyze_output_write_block";
+	const char *separator = "";
+
+	if( output == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( BANALYZE_OUTPUT_BUFFER_SIZE - output->buffer_offset ) < BANALYZE_OUTPUT_MAXIMUM_RECORD_SIZE )
+	{
+		if( banalyze_output_flush(
+		     output,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	switch( output->format )
+	{
+		case BANALYZE_OUTPUT_FORMAT_TEXT:
+			banalyze_output_append_string(
+			 output,
+			 "block 0x",
+			 8 );
+			banalyze_output_append_hexadecimal(
+			 output,
+			 (uint64_t) block->offset,
+			 8 );
+			banalyze_output_append_string(
+			 output,
+			 " - 0x",
+			 5 );
+			banalyze_output_append_hexadecimal(
+			 output,
+			 (uint64_t) block->offset + block->size,
+			 8 );
+			banalyze_output_append_string(
+			 output,
+			 ":",
+			 1 );
+
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_ENTROPY ) != 0 )
+			{
+				banalyze_output_append_string(
+				 output,
+				 " byte entropy: ",
+				 15 );
+				banalyze_output_append_double(
+				 output,
+				 block->entropy );
+
+				separator = ",";
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_MD5 ) != 0 )
+			{
+				banalyze_output_append_string(
+				 output,
+				 separator,
+				 narrow_string_length( separator ) );
+				banalyze_output_append_string(
+				 output,
+				 " MD5: ",
+				 6 );
+				banalyze_output_append_hash_string(
+				 output,
+				 block->md5_hash,
+				 LIBHMAC_MD5_HASH_SIZE );
+
+				separator = ",";
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_SHA256 ) != 0 )
+			{
+				banalyze_output_append_string(
+				 output,
+				 separator,
+				 narrow_string_length( separator ) );
+				banalyze_output_append_string(
+				 output,
+				 " SHA-256: ",
+				 10 );
+				banalyze_output_append_hash_string(
+				 output,
+				 block->sha256_hash,
+				 LIBHMAC_SHA256_HASH_SIZE );
+
+				separator = ",";
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_COMPRESSIBILITY ) != 0 )
+			{
+				banalyze_output_append_string(
+				 output,
+				 separator,
+				 narrow_string_length( separator ) );
+				banalyze_output_append_string(
+				 output,
+				 " compressibility: ",
+				 18 );
+				banalyze_output_append_double(
+				 output,
+				 block->compressibility );
+
+				separator = ",";
+			}
+			if( ( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_DEDUPLICATION ) != 0 )
+			 && ( block->is_duplicate != 0 ) )
+			{
+				banalyze_output_append_string(
+				 output,
+				 separator,
+				 narrow_string_length( separator ) );
+				banalyze_output_append_string(
+				 output,
+				 " duplicate of: 0x",
+				 17 );
+				banalyze_output_append_hexadecimal(
+				 output,
+				 (uint64_t) block->duplicate_offset,
+				 8 );
+			}
+			banalyze_output_append_string(
+			 output,
+			 "\n",
+			 1 );
+
+			break;
+
+		case BANALYZE_OUTPUT_FORMAT_JSONL:
+			banalyze_output_append_string(
+			 output,
+			 "{\"offset\":",
+			 10 );
+			banalyze_output_append_decimal(
+			 output,
+			 (uint64_t) block->offset );
+			banalyze_output_append_string(
+			 output,
+			 ",\"size\":",
+			 8 );
+			banalyze_output_append_decimal(
+			 output,
+			 (uint64_t) block->size );
+
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_ENTROPY ) != 0 )
+			{
+				banalyze_output_append_string(
+				 output,
+				 ",\"entropy\":",
+				 11 );
+				banalyze_output_append_double(
+				 output,
+				 block->entropy );
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_MD5 ) != 0 )
+			{
+				banalyze_output_append_string(
+				 output,
+				 ",\"md5\":\"",
+				 8 );
+				banalyze_output_append_hash_string(
+				 output,
+				 block->md5_hash,
+				 LIBHMAC_MD5_HASH_SIZE );
+				banalyze_output_append_string(
+				 output,
+				 "\"",
+				 1 );
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_SHA256 ) != 0 )
+			{
+				banalyze_output_append_string(
+				 output,
+				 ",\"sha256\":\"",
+				 11 );
+				banalyze_output_append_hash_string(
+				 output,
+				 block->sha256_hash,
+				 LIBHMAC_SHA256_HASH_SIZE );
+				banalyze_output_append_string(
+				 output,
+				 "\"",
+				 1 );
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_COMPRESSIBILITY ) != 0 )
+			{
+				banalyze_output_append_string(
+				 output,
+				 ",\"compressibility\":",
+				 19 );
+				banalyze_output_append_double(
+				 output,
+				 block->compressibility );
+			}
+			if( ( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_DEDUPLICATION ) != 0 )
+			 && ( block->is_duplicate != 0 ) )
+			{
+				banalyze_output_append_string(
+				 output,
+				 ",\"duplicate_of\":",
+				 16 );
+				banalyze_output_append_decimal(
+				 output,
+				 (uint64_t) block->duplicate_offset );
+			}
+			banalyze_output_append_string(
+			 output,
+			 "}\n",
+			 2 );
+
+			break;
+
+		case BANALYZE_OUTPUT_FORMAT_BINARY:
+			banalyze_output_append_uint64(
+			 output,
+			 (uint64_t) block->offset );
+			banalyze_output_append_uint64(
+			 output,
+			 (uint64_t) block->size );
+
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_ENTROPY ) != 0 )
+			{
+				banalyze_output_append_binary_double(
+				 output,
+				 block->entropy );
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_MD5 ) != 0 )
+			{
+				memory_copy(
+				 &( output->buffer[ output->buffer_offset ] ),
+				 block->md5_hash,
+				 LIBHMAC_MD5_HASH_SIZE );
+
+				output->buffer_offset += LIBHMAC_MD5_HASH_SIZE;
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_SHA256 ) != 0 )
+			{
+				memory_copy(
+				 &( output->buffer[ output->buffer_offset ] ),
+				 block->sha256_hash,
+				 LIBHMAC_SHA256_HASH_SIZE );
+
+				output->buffer_offset += LIBHMAC_SHA256_HASH_SIZE;
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_COMPRESSIBILITY ) != 0 )
+			{
+				banalyze_output_append_binary_double(
+				 output,
+				 block->compressibility );
+			}
+			if( ( block->analysis_methods & BANALYZE_ANALYSIS_METHOD_DEDUPLICATION ) != 0 )
+			{
+				if( block->is_duplicate != 0 )
+				{
+					banalyze_output_append_uint64(
+					 output,
+					 (uint64_t) block->duplicate_offset );
+				}
+				else
+				{
+					banalyze_output_append_uint64(
+					 output,
+					 0xffffffffffffffffULL );
+				}
+			}
+			break;
+
+		default:
+			break;
+	}
+	return( 1 );
+}
+
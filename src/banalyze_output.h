@@ -0,0 +1,155 @@
+/*
+ * Block analysis output
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BANALYZE_OUTPUT_H )
+#define _BANALYZE_OUTPUT_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "banalyze_block.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the output buffer
+ */
+#define BANALYZE_OUTPUT_BUFFER_SIZE		( 1024 * 1024 )
+
+/* The maximum size of a single record, the buffer is written when less space remains
+ */
+#define BANALYZE_OUTPUT_MAXIMUM_RECORD_SIZE	512
+
+/* The binary output starts with a 16 byte header:
+ *   the signature "banalyze" (8 bytes)
+ *   the format version, 32-bit little-endian
+ *   the analysis methods, 32-bit little-endian
+ *
+ * followed by a record per block:
+ *   the block offset, 64-bit little-endian
+ *   the block size, 64-bit little-endian
+ *   the byte entropy, IEEE 754 double 64-bit little-endian, if requested
+ *   the MD5 hash (16 bytes), if requested
+ *   the SHA-256 hash (32 bytes), if requested
+ *   the compressibility, IEEE 754 double 64-bit little-endian, if requested
+ *   the offset of the first block with the same content, 64-bit little-endian,
+ *   or 0xffffffffffffffff if the content was not seen before, if deduplication
+ *   is requested
+ */
+#define BANALYZE_OUTPUT_BINARY_SIGNATURE	"banalyze"
+#define BANALYZE_OUTPUT_BINARY_FORMAT_VERSION	1
+
+enum BANALYZE_OUTPUT_FORMATS
+{
+	BANALYZE_OUTPUT_FORMAT_TEXT	= 0,
+	BANALYZE_OUTPUT_FORMAT_JSONL	= 1,
+	BANALYZE_OUTPUT_FORMAT_BINARY	= 2
+};
+
+typedef struct banalyze_output banalyze_output_t;
+
+struct banalyze_output
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The output format
+	 */
+	uint8_t format;
+
+	/* The analysis methods
+	 */
+	uint8_t analysis_methods;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The offset of the unwritten data in the buffer
+	 */
+	size_t buffer_offset;
+};
+
+int banalyze_output_initialize(
+     banalyze_output_t **output,
+     FILE *stream,
+     uint8_t format,
+     uint8_t analysis_methods,
+     libcerror_error_t **error );
+
+int banalyze_output_free(
+     banalyze_output_t **output,
+     libcerror_error_t **error );
+
+int banalyze_output_flush(
+     banalyze_output_t *output,
+     libcerror_error_t **error );
+
+void banalyze_output_append_string(
+      banalyze_output_t *output,
+      const char *string,
+      size_t string_length );
+
+void banalyze_output_append_hexadecimal(
+      banalyze_output_t *output,
+      uint64_t value,
+      int minimum_number_of_digits );
+
+void banalyze_output_append_decimal(
+      banalyze_output_t *output,
+      uint64_t value );
+
+void banalyze_output_append_double(
+      banalyze_output_t *output,
+      double value );
+
+void banalyze_output_append_hash_string(
+      banalyze_output_t *output,
+      const uint8_t *hash,
+      size_t hash_size );
+
+void banalyze_output_append_uint64(
+      banalyze_output_t *output,
+      uint64_t value );
+
+void banalyze_output_append_binary_double(
+      banalyze_output_t *output,
+      double value );
+
+int banalyze_output_write_header(
+     banalyze_output_t *output,
+     libcerror_error_t **error );
+
+int banalyze_output_write_block(
+     banalyze_output_t *output,
+     banalyze_block_t *block,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BANALYZE_OUTPUT_H ) */
+
@@ -0,0 +1,1030 @@
+/*
+ * Decompresses the compressed chunks listed in a manifest
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_codec.h"
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "assorted_memory_map.h"
+#include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+#include "decompression_manifest.h"
+
+/* The number of entries that are decompressed at a time
+ */
+#define BATCHDECOMPRESS_NUMBER_OF_TASKS			1024
+
+#define BATCHDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS	64
+
+#define BATCHDECOMPRESS_DEFAULT_MAXIMUM_SIZE		( 64 * 1024 * 1024 )
+
+typedef struct batchdecompress_task batchdecompress_task_t;
+
+struct batchdecompress_task
+{
+	/* The manifest entry
+	 */
+	const decompression_manifest_entry_t *entry;
+
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data buffer, used if the source is not memory mapped
+	 */
+	uint8_t *compressed_data_buffer;
+
+	/* The maximum uncompressed data size
+	 */
+	size_t maximum_uncompressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	const assorted_codec_t *codec = NULL;
+	int codec_index               = 0;
+	int number_of_codecs          = 0;
+
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use batchdecompress to decompress the compressed chunks listed in\n"
+	                 "a manifest.\n\n" );
+
+	fprintf( stream, "Usage: batchdecompress -m manifest [ -M maximum_size ] [ -o output ]\n"
+	                 "                       [ -p prefix ] [ -j number_of_threads ] [ -hvV ]\n"
+	                 "                       source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to decompress the chunks (default\n"
+	                 "\t        is 1)\n" );
+	fprintf( stream, "\t-m:     the manifest, every line contains the offset, the compressed\n"
+	                 "\t        size, the uncompressed size or 0 if not known and the codec\n"
+	                 "\t        of a chunk, separated by whitespace\n" );
+	fprintf( stream, "\t-M:     maximum uncompressed size of a chunk of which the\n"
+	                 "\t        uncompressed size is not known (default is 64 MiB)\n" );
+	fprintf( stream, "\t-o:     the output file the uncompressed chunks are concatenated\n"
+	                 "\t        in (default is source.batchdecompressed)\n" );
+	fprintf( stream, "\t-p:     write every uncompressed chunk to a separate file named:\n"
+	                 "\t        prefix.<entry number> instead\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+
+	fprintf( stream, "Supported codecs:" );
+
+	if( assorted_codec_get_number_of_codecs(
+	     &number_of_codecs,
+	     NULL ) == 1 )
+	{
+		for( codec_index = 0;
+		     codec_index < number_of_codecs;
+		     codec_index++ )
+		{
+			if( assorted_codec_get_codec_by_index(
+			     codec_index,
+			     &codec,
+			     NULL ) == 1 )
+			{
+				fprintf( stream, " %s", codec->name );
+			}
+		}
+	}
+	fprintf( stream, "\n\n" );
+}
+
+/* Decompresses the chunk of a task
+ */
+void batchdecompress_task_decompress(
+      batchdecompress_task_t *task )
+{
+	if( task == NULL )
+	{
+		return;
+	}
+	task->result = decompression_manifest_entry_decompress(
+	                task->entry,
+	                task->compressed_data,
+	                task->maximum_uncompressed_data_size,
+	                &( task->uncompressed_data ),
+	                &( task->uncompressed_data_size ),
+	                NULL );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the chunk of a task from a thread pool
+ * Returns 1 on success or -1 on error
+ */
+int batchdecompress_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	batchdecompress_task_decompress(
+	 (batchdecompress_task_t *) value );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses the chunks of tasks
+ * Returns 1 if successful or -1 on error
+ */
+int batchdecompress_decompress_tasks(
+     batchdecompress_task_t *tasks,
+     int number_of_tasks,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function                  = "batchdecompress_decompress_tasks";
+	int task_index                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+	if( tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tasks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &batchdecompress_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	ASSORTED_UNREFERENCED_PARAMETER( number_of_threads )
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the chunks are decompressed here
+	 */
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( tasks[ task_index ].result == 0 )
+		{
+			batchdecompress_task_decompress(
+			 &( tasks[ task_index ] ) );
+		}
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Opens a file for writing
+ * Returns 1 if successful or -1 on error
+ */
+int batchdecompress_open_output(
+     libcfile_file_t **output_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "batchdecompress_open_output";
+
+	if( libcfile_file_initialize(
+	     output_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_open(
+	     *output_file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file: %s.",
+		 function,
+		 filename );
+
+		libcfile_file_free(
+		 output_file,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes a file opened for writing
+ * Returns 1 if successful or -1 on error
+ */
+int batchdecompress_close_output(
+     libcfile_file_t **output_file,
+     libcerror_error_t **error )
+{
+	static char *function = "batchdecompress_close_output";
+
+	if( libcfile_file_close(
+	     *output_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		libcfile_file_free(
+		 output_file,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcfile_file_free(
+	     output_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	char destination[ 256 ];
+
+	assorted_memory_map_t *memory_map         = NULL;
+	batchdecompress_task_t *tasks             = NULL;
+	decompression_manifest_entry_t *entry     = NULL;
+	decompression_manifest_t *manifest        = NULL;
+	libcerror_error_t *error                  = NULL;
+	libcfile_file_t *output_file              = NULL;
+	libcfile_file_t *source_file              = NULL;
+	system_character_t *manifest_filename     = NULL;
+	system_character_t *source                = NULL;
+	const char *output_filename               = NULL;
+	const char *prefix                        = NULL;
+	char *program                             = "batchdecompress";
+	system_integer_t option                   = 0;
+	size64_t source_size                      = 0;
+	size64_t total_uncompressed_size          = 0;
+	size_t maximum_size                       = BATCHDECOMPRESS_DEFAULT_MAXIMUM_SIZE;
+	ssize_t read_count                        = 0;
+	ssize_t write_count                       = 0;
+	int entry_index                           = 0;
+	int number_of_failed_entries              = 0;
+	int number_of_tasks                       = 0;
+	int number_of_threads                     = 1;
+	int print_count                           = 0;
+	int result                                = 0;
+	int task_index                            = 0;
+	int verbose                               = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hj:m:M:o:p:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				manifest_filename = optarg;
+
+				break;
+
+			case 'M':
+				maximum_size = (size_t) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'o':
+				output_filename = (const char *) optarg;
+
+				break;
+
+			case 'p':
+				prefix = (const char *) optarg;
+
+				break;
+
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( manifest_filename == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing manifest.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( output_filename != NULL )
+	 && ( prefix != NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Output file and prefix cannot be combined.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > BATCHDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( maximum_size == 0 )
+	 || ( maximum_size > (size_t) SSIZE_MAX ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid maximum size value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( decompression_manifest_initialize(
+	     &manifest,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create manifest.\n" );
+
+		goto on_error;
+	}
+	if( decompression_manifest_read_file(
+	     manifest,
+	     manifest_filename,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read manifest.\n" );
+
+		goto on_error;
+	}
+	/* The source stays open for all entries, it is memory mapped if supported
+	 * otherwise the compressed data of every entry is read
+	 */
+	if( assorted_memory_map_initialize(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create memory map.\n" );
+
+		goto on_error;
+	}
+	result = assorted_memory_map_open(
+	          memory_map,
+	          source,
+	          0,
+	          0,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open memory map.\n" );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		source_size = (size64_t) memory_map->data_size;
+	}
+	else
+	{
+		if( libcfile_file_initialize(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create source file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#endif
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < manifest->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( manifest->entries[ entry_index ] );
+
+		if( ( (size64_t) entry->offset > source_size )
+		 || ( (size64_t) entry->compressed_data_size > ( source_size - (size64_t) entry->offset ) ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid entry: %d - range exceeds source size.\n",
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( prefix == NULL )
+	{
+		if( output_filename == NULL )
+		{
+			print_count = narrow_string_snprintf(
+			               destination,
+			               256,
+			               "%s.batchdecompressed",
+			               source );
+
+			if( ( print_count < 0 )
+			 || ( print_count > 256 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set output filename.\n" );
+
+				goto on_error;
+			}
+			output_filename = destination;
+		}
+		if( batchdecompress_open_output(
+		     &output_file,
+		     output_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open output file.\n" );
+
+			goto on_error;
+		}
+	}
+	tasks = (batchdecompress_task_t *) memory_allocate(
+	                                    sizeof( batchdecompress_task_t ) * BATCHDECOMPRESS_NUMBER_OF_TASKS );
+
+	if( tasks == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create tasks.\n" );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     tasks,
+	     0,
+	     sizeof( batchdecompress_task_t ) * BATCHDECOMPRESS_NUMBER_OF_TASKS ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear tasks.\n" );
+
+		goto on_error;
+	}
+	/* The entries are decompressed in batches, the entries of a batch are
+	 * decompressed in parallel and written in the order of the manifest
+	 */
+	for( entry_index = 0;
+	     entry_index < manifest->number_of_entries;
+	     entry_index += number_of_tasks )
+	{
+		number_of_tasks = manifest->number_of_entries - entry_index;
+
+		if( number_of_tasks > BATCHDECOMPRESS_NUMBER_OF_TASKS )
+		{
+			number_of_tasks = BATCHDECOMPRESS_NUMBER_OF_TASKS;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			entry = &( manifest->entries[ entry_index + task_index ] );
+
+			tasks[ task_index ].entry                          = entry;
+			tasks[ task_index ].maximum_uncompressed_data_size = maximum_size;
+			tasks[ task_index ].result                         = 0;
+
+			if( source_file == NULL )
+			{
+				tasks[ task_index ].compressed_data = &( memory_map->data[ entry->offset ] );
+
+				continue;
+			}
+			tasks[ task_index ].compressed_data_buffer = (uint8_t *) memory_allocate(
+			                                                          sizeof( uint8_t ) * entry->compressed_data_size );
+
+			if( tasks[ task_index ].compressed_data_buffer == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create compressed data buffer.\n" );
+
+				goto on_error;
+			}
+			if( libcfile_file_seek_offset(
+			     source_file,
+			     entry->offset,
+			     SEEK_SET,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to seek entry: %d in source file.\n",
+				 entry_index + task_index );
+
+				goto on_error;
+			}
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              tasks[ task_index ].compressed_data_buffer,
+			              entry->compressed_data_size,
+			              &error );
+
+			if( read_count != (ssize_t) entry->compressed_data_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read entry: %d from source file.\n",
+				 entry_index + task_index );
+
+				goto on_error;
+			}
+			tasks[ task_index ].compressed_data = tasks[ task_index ].compressed_data_buffer;
+		}
+		if( batchdecompress_decompress_tasks(
+		     tasks,
+		     number_of_tasks,
+		     number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress entries.\n" );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress entry: %d at offset: %" PRIi64 " with codec: %s.\n",
+				 entry_index + task_index,
+				 (int64_t) tasks[ task_index ].entry->offset,
+				 tasks[ task_index ].entry->codec->name );
+
+				number_of_failed_entries++;
+			}
+			else
+			{
+				if( prefix != NULL )
+				{
+					print_count = narrow_string_snprintf(
+					               destination,
+					               256,
+					               "%s.%d",
+					               prefix,
+					               entry_index + task_index );
+
+					if( ( print_count < 0 )
+					 || ( print_count > 256 ) )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to set output filename.\n" );
+
+						goto on_error;
+					}
+					if( batchdecompress_open_output(
+					     &output_file,
+					     destination,
+					     &error ) != 1 )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to open output file.\n" );
+
+						goto on_error;
+					}
+				}
+				write_count = libcfile_file_write_buffer(
+				               output_file,
+				               tasks[ task_index ].uncompressed_data,
+				               tasks[ task_index ].uncompressed_data_size,
+				               &error );
+
+				if( write_count != (ssize_t) tasks[ task_index ].uncompressed_data_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write to output file.\n" );
+
+					goto on_error;
+				}
+				if( prefix != NULL )
+				{
+					if( batchdecompress_close_output(
+					     &output_file,
+					     &error ) != 1 )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to close output file.\n" );
+
+						goto on_error;
+					}
+				}
+				total_uncompressed_size += tasks[ task_index ].uncompressed_data_size;
+
+				memory_free(
+				 tasks[ task_index ].uncompressed_data );
+
+				tasks[ task_index ].uncompressed_data = NULL;
+			}
+			if( tasks[ task_index ].compressed_data_buffer != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].compressed_data_buffer );
+
+				tasks[ task_index ].compressed_data_buffer = NULL;
+			}
+		}
+	}
+	fprintf(
+	 stdout,
+	 "Decompressed %d of %d entries into %" PRIu64 " bytes.\n",
+	 manifest->number_of_entries - number_of_failed_entries,
+	 manifest->number_of_entries,
+	 total_uncompressed_size );
+
+	/* Clean up
+	 */
+	memory_free(
+	 tasks );
+
+	tasks = NULL;
+
+	if( output_file != NULL )
+	{
+		if( batchdecompress_close_output(
+		     &output_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close output file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( source_file != NULL )
+	{
+		if( libcfile_file_close(
+		     source_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( assorted_memory_map_free(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free memory map.\n" );
+
+		goto on_error;
+	}
+	if( decompression_manifest_free(
+	     &manifest,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free manifest.\n" );
+
+		goto on_error;
+	}
+	if( number_of_failed_entries > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( tasks != NULL )
+	{
+		for( task_index = 0;
+		     task_index < BATCHDECOMPRESS_NUMBER_OF_TASKS;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].uncompressed_data != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].uncompressed_data );
+			}
+			if( tasks[ task_index ].compressed_data_buffer != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].compressed_data_buffer );
+			}
+		}
+		memory_free(
+		 tasks );
+	}
+	if( output_file != NULL )
+	{
+		libcfile_file_free(
+		 &output_file,
+		 NULL );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( manifest != NULL )
+	{
+		decompression_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
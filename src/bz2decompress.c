@@ -35,12 +35,21 @@
 #endif
 
 #include "assorted_bzip.h"
+#include "assorted_bzip_parallel.h"
+#include "assorted_bzip_stream.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "assorted_progress.h"
+#include "assorted_signal.h"
 #include "assorted_system_string.h"
+#include "assorted_unused.h"
+
+#define BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE	65536
+
+assorted_progress_t *bz2decompress_progress = NULL;
 
 /* Prints the executable usage information
  */
@@ -53,23 +62,311 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use bz2decompress to decompress data as bzip2 compressed data.\n\n" );
 
-	fprintf( stream, "Usage: bz2decompress [ -d size ] [ -o offset ] [ -s size ] [ -12hvV ]\n"
-	                 "       source\n\n" );
+	fprintf( stream, "Usage: bz2decompress [ -d size ] [ -o offset ] [ -s size ]\n"
+	                 "                     [ -j number_of_threads ] [ -12ThvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the bzlib decompression method\n" );
 	fprintf( stream, "\t-2:     use the internal decompression method (default)\n" );
-	fprintf( stream, "\t-d:     size of the decompressed data (default is 16 times the size\n"
-	                 "\t        of the data)).\n" );
+	fprintf( stream, "\t-d:     size of the decompressed data buffer of the multi-threaded\n"
+	                 "\t        internal decompression method (default is to grow the\n"
+	                 "\t        decompressed data buffer as needed), the other methods\n"
+	                 "\t        decompress the data a part at a time\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used by the internal decompression\n"
+	                 "\t        method (default is 1)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-T:     only verify the compressed data, the decompressed data\n"
+	                 "\t        is not stored, cannot be combined with multiple threads\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Signal handler for bz2decompress
+ */
+void bz2decompress_signal_handler(
+      assorted_signal_t signal ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( signal )
+
+	assorted_progress_signal_abort(
+	 bz2decompress_progress );
+}
+
+/* Decompresses the compressed data from the source file with bzlib, the source file
+ * is read a part at a time and the uncompressed data is written to the destination
+ * file, if set, as it is decoded
+ * Returns 1 on success or -1 on error
+ */
+int bz2decompress_decompress_bzlib(
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     libcfile_file_t *destination_file,
+     uint64_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+	bz_stream bzip2_stream;
+
+	uint8_t *compressed_data           = NULL;
+	uint8_t *uncompressed_data         = NULL;
+	size64_t remaining_size            = 0;
+	uint64_t safe_uncompressed_size    = 0;
+	size_t read_size                   = 0;
+	size_t write_size                  = 0;
+	ssize_t read_count                 = 0;
+	ssize_t write_count                = 0;
+	int bzip2_initialized              = 0;
+	int bzip2_result                   = 0;
+	int result                         = 0;
+#endif
+	static char *function              = "bz2decompress_decompress_bzlib";
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_BZLIB ) && !defined( BZ_DLL )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: missing bzlib support.",
+	 function );
+
+	return( -1 );
+#else
+	if( memory_set(
+	     &bzip2_stream,
+	     0,
+	     sizeof( bz_stream ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The uncompressed data is decoded into a buffer that is overwritten
+	 * for every part, bzlib verifies the block and stream checksums
+	 */
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( BZ2_bzDecompressInit(
+	     &bzip2_stream,
+	     0,
+	     0 ) != BZ_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize stream.",
+		 function );
+
+		goto on_error;
+	}
+	bzip2_initialized = 1;
+	remaining_size    = source_size;
+
+	do
+	{
+		if( ( bzip2_stream.avail_in == 0 )
+		 && ( remaining_size > 0 ) )
+		{
+			read_size = BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE;
+
+			if( (size64_t) read_size > remaining_size )
+			{
+				read_size = (size_t) remaining_size;
+			}
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              compressed_data,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data from source file.",
+				 function );
+
+				goto on_error;
+			}
+			remaining_size -= read_size;
+
+			bzip2_stream.next_in  = (char *) compressed_data;
+			bzip2_stream.avail_in = (unsigned int) read_size;
+		}
+		bzip2_stream.next_out  = (char *) uncompressed_data;
+		bzip2_stream.avail_out = (unsigned int) BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE;
+
+		bzip2_result = BZ2_bzDecompress(
+		                &bzip2_stream );
+
+		if( ( bzip2_result != BZ_OK )
+		 && ( bzip2_result != BZ_STREAM_END ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data with error: %d.",
+			 function,
+			 bzip2_result );
+
+			goto on_error;
+		}
+		write_size = BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE - bzip2_stream.avail_out;
+
+		/* The compressed data is truncated if no more data can be decoded
+		 */
+		if( ( bzip2_result == BZ_OK )
+		 && ( bzip2_stream.avail_in == 0 )
+		 && ( remaining_size == 0 )
+		 && ( write_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data with error: %d.",
+			 function,
+			 BZ_UNEXPECTED_EOF );
+
+			goto on_error;
+		}
+		if( ( destination_file != NULL )
+		 && ( write_size > 0 ) )
+		{
+			write_count = libcfile_file_write_buffer(
+			               destination_file,
+			               uncompressed_data,
+			               write_size,
+			               error );
+
+			if( write_count != (ssize_t) write_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data to destination file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		safe_uncompressed_size += write_size;
+
+		result = assorted_progress_update(
+		          bz2decompress_progress,
+		          (uint64_t) ( source_size - remaining_size ),
+		          safe_uncompressed_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( bzip2_result != BZ_STREAM_END );
+
+	BZ2_bzDecompressEnd(
+	 &bzip2_stream );
+
+	memory_free(
+	 uncompressed_data );
+	memory_free(
+	 compressed_data );
+
+	*uncompressed_data_size = safe_uncompressed_size;
+
+	return( 1 );
+
+on_error:
+	if( bzip2_initialized != 0 )
+	{
+		BZ2_bzDecompressEnd(
+		 &bzip2_stream );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+
+#endif /* !defined( HAVE_BZLIB ) && !defined( BZ_DLL ) */
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -80,27 +377,34 @@ int main( int argc, char * const argv[] )
 {
 	char destination[ 128 ];
 
-	libcerror_error_t *error                  = NULL;
-	libcfile_file_t *destination_file         = NULL;
-	libcfile_file_t *source_file              = NULL;
-	system_character_t *source                = NULL;
-	uint8_t *buffer                           = NULL;
-	uint8_t *uncompressed_data                = NULL;
-	char *program                             = "bz2decompress";
-	system_integer_t option                   = 0;
-	size64_t source_size                      = 0;
-	size_t uncompressed_data_size             = 0;
-	ssize_t read_count                        = 0;
-	ssize_t write_count                       = 0;
-	off_t source_offset                       = 0;
-	int decompression_method                  = 2;
-	int print_count                           = 0;
-	int result                                = 0;
-	int verbose                               = 0;
-
-#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
-	unsigned int bzip2_uncompressed_data_size = 0;
-#endif
+	assorted_bzip_stream_t *stream     = NULL;
+	libcerror_error_t *error           = NULL;
+	libcfile_file_t *destination_file  = NULL;
+	libcfile_file_t *source_file       = NULL;
+	system_character_t *source         = NULL;
+	uint8_t *buffer                    = NULL;
+	uint8_t *uncompressed_data         = NULL;
+	void *reallocation                 = NULL;
+	char *program                      = "bz2decompress";
+	system_integer_t option            = 0;
+	size64_t remaining_size            = 0;
+	size64_t source_size               = 0;
+	uint64_t stream_offset             = 0;
+	size_t compressed_data_offset      = 0;
+	size_t read_size                   = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_size      = 0;
+	ssize_t read_count                 = 0;
+	ssize_t write_count                = 0;
+	off_t source_offset                = 0;
+	uint8_t grow_uncompressed_data     = 0;
+	uint8_t verify_data                = 0;
+	int decompression_method           = 2;
+	int number_of_threads              = 1;
+	int print_count                    = 0;
+	int progress_result                = 0;
+	int result                         = 0;
+	int verbose                        = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -109,7 +413,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12d:ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12d:hj:o:s:t:TvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -156,6 +460,17 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'T':
+				verify_data = 1;
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -181,12 +496,54 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( number_of_threads < 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value zero or less.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( verify_data != 0 )
+	 && ( number_of_threads > 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Verify mode not supported with multiple threads.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	/* The progress is only reported in verbose mode but the abort flag is always checked
+	 */
+	if( assorted_progress_initialize(
+	     &bz2decompress_progress,
+	     ASSORTED_PROGRESS_DEFAULT_INTERVAL,
+	     ( verbose != 0 ) ? &assorted_progress_fprint : NULL,
+	     (void *) stderr,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create progress.\n" );
+
+		goto on_error;
+	}
+	if( assorted_signal_attach(
+	     bz2decompress_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
@@ -242,40 +599,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX / 16 )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
-	}
-	if( uncompressed_data_size == 0 )
-	{
-		uncompressed_data_size = source_size * 16;
-	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
 	/* Position the source file at the right offset
 	 */
 	if( libcfile_file_seek_offset(
@@ -305,137 +628,417 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Read and decompress the data
-	 */
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
+	if( verify_data == 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		/* Open the destination file
+		 */
+		if( libcfile_file_initialize(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create destination file.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          destination_file,
+		          destination,
+		          LIBCFILE_OPEN_WRITE,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          destination_file,
+		          destination,
+		          LIBCFILE_OPEN_WRITE,
+		          &error );
+#endif
+	 	if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open destination file.\n" );
+
+			goto on_error;
+		}
 	}
-	if( decompression_method == 1 )
+	if( ( decompression_method == 2 )
+	 && ( number_of_threads == 1 ) )
 	{
-#if !defined( HAVE_BZLIB ) && !defined( BZ_DLL )
-		fprintf(
-		 stderr,
-		 "Missing bzlib support.\n" );
+		/* The data is decompressed a part at a time so the memory used
+		 * does not depend on the size of the compressed data
+		 */
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE );
 
-		goto on_error;
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
 
-#else
-		bzip2_uncompressed_data_size = (unsigned int) uncompressed_data_size;
-
-		if( BZ2_bzBuffToBuffDecompress(
-		     (char *) uncompressed_data,
-		     &bzip2_uncompressed_data_size,
-		     (char *) buffer,
-		     (unsigned int) source_size,
-		     0,
-		     0 ) != BZ_OK )
+			goto on_error;
+		}
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE );
+
+		if( uncompressed_data == NULL )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to decompress data.\n" );
+			 "Unable to create uncompressed data buffer.\n" );
 
 			goto on_error;
 		}
-		uncompressed_data_size = (size_t) bzip2_uncompressed_data_size;
+		if( assorted_bzip_stream_initialize(
+		     &stream,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create stream.\n" );
 
-#endif /* !defined( HAVE_BZLIB ) && !defined( BZ_DLL ) */
-	}
-	else if( decompression_method == 2 )
-	{
-		if( assorted_bzip_decompress(
-		     buffer,
-		     source_size,
-		     uncompressed_data,
-		     &uncompressed_data_size,
+			goto on_error;
+		}
+		remaining_size = source_size;
+		result         = 0;
+
+		while( result == 0 )
+		{
+			if( ( compressed_data_offset >= read_size )
+			 && ( remaining_size > 0 ) )
+			{
+				read_size = BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE;
+
+				if( (size64_t) read_size > remaining_size )
+				{
+					read_size = (size_t) remaining_size;
+				}
+				read_count = libcfile_file_read_buffer(
+					      source_file,
+					      buffer,
+					      read_size,
+				              &error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to read from source file.\n" );
+
+					goto on_error;
+				}
+				remaining_size        -= read_size;
+				compressed_data_offset = 0;
+			}
+			uncompressed_data_size = BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE;
+
+			if( ( compressed_data_offset >= read_size )
+			 && ( remaining_size == 0 ) )
+			{
+				result = assorted_bzip_stream_finish(
+				          stream,
+				          uncompressed_data,
+				          &uncompressed_data_size,
+				          &error );
+			}
+			else
+			{
+				result = assorted_bzip_stream_feed(
+				          stream,
+				          buffer,
+				          read_size,
+				          &compressed_data_offset,
+				          uncompressed_data,
+				          &uncompressed_data_size,
+				          &error );
+			}
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+
+				goto on_error;
+			}
+			if( ( verify_data == 0 )
+			 && ( uncompressed_data_size > 0 ) )
+			{
+				write_count = libcfile_file_write_buffer(
+					       destination_file,
+					       uncompressed_data,
+					       uncompressed_data_size,
+					       &error );
+
+				if( write_count != (ssize_t) uncompressed_data_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write to destination file.\n" );
+
+					goto on_error;
+				}
+			}
+			stream_offset += uncompressed_data_size;
+
+			progress_result = assorted_progress_update(
+			                   bz2decompress_progress,
+			                   (uint64_t) ( source_size - remaining_size ),
+			                   stream_offset,
+			                   &error );
+
+			if( progress_result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to update progress.\n" );
+
+				goto on_error;
+			}
+			else if( progress_result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Aborted.\n" );
+
+				goto on_error;
+			}
+		}
+		if( verify_data != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Verified %" PRIu64 " bytes of uncompressed data.\n",
+			 stream_offset );
+		}
+		if( assorted_bzip_stream_free(
+		     &stream,
 		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to decompress data.\n" );
+			 "Unable to free stream.\n" );
 
 			goto on_error;
 		}
 	}
-	/* Open the destination file
-	 */
-	if( libcfile_file_initialize(
-	     &destination_file,
-	     &error ) != 1 )
+	else if( decompression_method == 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create destination file.\n" );
-
-		goto on_error;
+		if( bz2decompress_decompress_bzlib(
+		     source_file,
+		     source_size,
+		     destination_file,
+		     &stream_offset,
+		     &error ) != 1 )
+		{
+			if( bz2decompress_progress->abort != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Aborted.\n" );
+			}
+			else
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+			}
+			goto on_error;
+		}
+		if( verify_data != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Verified %" PRIu64 " bytes of uncompressed data.\n",
+			 stream_offset );
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          destination_file,
-	          destination,
-	          LIBCFILE_OPEN_WRITE,
-	          &error );
-#else
-	result = libcfile_file_open(
-	          destination_file,
-	          destination,
-	          LIBCFILE_OPEN_WRITE,
-	          &error );
-#endif
- 	if( result != 1 )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open destination file.\n" );
+		/* The multi-threaded internal decompression method requires all compressed data
+		 */
+		if( source_size > (size64_t) SSIZE_MAX / 4 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
 
-		goto on_error;
-	}
-	write_count = libcfile_file_write_buffer(
-		       destination_file,
-		       uncompressed_data,
-		       uncompressed_data_size,
-		       &error );
+			goto on_error;
+		}
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * source_size );
 
-	if( write_count != (ssize_t) uncompressed_data_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to write to destination file.\n" );
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		/* Read and decompress the data
+		 */
+		read_count = libcfile_file_read_buffer(
+		              source_file,
+		              buffer,
+		              (size_t) source_size,
+		              &error );
+
+		if( read_count != (ssize_t) source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		/* Without an explicit size the uncompressed data buffer starts at 4 times
+		 * the size of the compressed data and is doubled when the data does not fit
+		 */
+		if( uncompressed_data_size == 0 )
+		{
+			grow_uncompressed_data = 1;
+			uncompressed_data_size = (size_t) source_size * 4;
+
+			if( uncompressed_data_size < BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE )
+			{
+				uncompressed_data_size = BZ2DECOMPRESS_MINIMUM_BUFFER_SIZE;
+			}
+		}
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		do
+		{
+			safe_uncompressed_data_size = uncompressed_data_size;
+
+			/* A single thread is handled by the stream decompression above
+			 */
+			result = assorted_bzip_parallel_decompress(
+			          buffer,
+			          source_size,
+			          number_of_threads,
+			          uncompressed_data,
+			          &safe_uncompressed_data_size,
+			          &error );
+
+			if( result == 1 )
+			{
+				uncompressed_data_size = safe_uncompressed_data_size;
+			}
+			else if( ( grow_uncompressed_data == 0 )
+			      || ( libcerror_error_matches(
+			            error,
+			            LIBCERROR_ERROR_DOMAIN_OUTPUT,
+			            LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE ) == 0 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+
+				goto on_error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &error );
+
+				if( uncompressed_data_size > ( (size_t) SSIZE_MAX / 2 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid uncompressed data size value exceeds maximum.\n" );
+
+					goto on_error;
+				}
+				uncompressed_data_size *= 2;
+
+				reallocation = memory_reallocate(
+				                uncompressed_data,
+				                sizeof( uint8_t ) * uncompressed_data_size );
+
+				if( reallocation == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to resize uncompressed data buffer.\n" );
+
+					goto on_error;
+				}
+				uncompressed_data = (uint8_t *) reallocation;
+			}
+		}
+		while( result != 1 );
+
+		write_count = libcfile_file_write_buffer(
+		               destination_file,
+		               uncompressed_data,
+		               uncompressed_data_size,
+		               &error );
+
+		if( write_count != (ssize_t) uncompressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
-	if( libcfile_file_close(
-	     destination_file,
-	     &error ) != 0 )
+	if( assorted_signal_detach(
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to close destination file.\n" );
+		 "Unable to detach signal handler.\n" );
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
-	     &destination_file,
+	if( assorted_progress_free(
+	     &bz2decompress_progress,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to free destination file.\n" );
+		 "Unable to free progress.\n" );
 
 		goto on_error;
 	}
+	if( destination_file != NULL )
+	{
+		if( libcfile_file_close(
+		     destination_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close destination file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free destination file.\n" );
+
+			goto on_error;
+		}
+	}
 	if( libcfile_file_close(
 	     source_file,
 	     &error ) != 0 )
@@ -456,9 +1059,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 uncompressed_data );
-
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
 	memory_free(
 	 buffer );
 
@@ -484,6 +1089,20 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( bz2decompress_progress != NULL )
+	{
+		assorted_signal_detach(
+		 NULL );
+		assorted_progress_free(
+		 &bz2decompress_progress,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		assorted_bzip_stream_free(
+		 &stream,
+		 NULL );
+	}
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
@@ -0,0 +1,1405 @@
+/*
+ * Decompresses the folders of a Cabinet (CAB) file
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_cab_folder.h"
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "assorted_memory_map.h"
+#include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+#define CABDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS		64
+
+#define CABDECOMPRESS_FILE_HEADER_SIZE			36
+
+#define CABDECOMPRESS_FOLDER_ENTRY_SIZE			8
+
+#define CABDECOMPRESS_FILE_ENTRY_SIZE			16
+
+#define CABDECOMPRESS_FLAG_PREVIOUS_CABINET		0x0001
+#define CABDECOMPRESS_FLAG_NEXT_CABINET			0x0002
+#define CABDECOMPRESS_FLAG_RESERVE_PRESENT		0x0004
+
+typedef struct cabdecompress_task cabdecompress_task_t;
+
+struct cabdecompress_task
+{
+	/* The folder index
+	 */
+	int folder_index;
+
+	/* The folder data, which starts with the first data block of the folder
+	 */
+	const uint8_t *folder_data;
+
+	/* The folder data buffer, used if the source is not memory mapped
+	 */
+	uint8_t *folder_data_buffer;
+
+	/* The folder data size
+	 */
+	size_t folder_data_size;
+
+	/* The number of data blocks
+	 */
+	uint16_t number_of_blocks;
+
+	/* The size of the reserved area of a data block
+	 */
+	uint8_t block_reserved_size;
+
+	/* The compression type
+	 */
+	uint16_t compression_type;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the decompression, 0 if not decompressed
+	 */
+	int result;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use cabdecompress to decompress the folders of a Cabinet (CAB) file.\n\n" );
+
+	fprintf( stream, "Usage: cabdecompress [ -i index ] [ -p prefix ] [ -j number_of_threads ]\n"
+	                 "                     [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     only decompress the folder with the index\n" );
+	fprintf( stream, "\t-j:     number of threads used to decompress folders\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-p:     write every uncompressed folder to a separate file\n"
+	                 "\t        named: prefix.<folder index> (default is source)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr, including the files\n"
+	                 "\t        stored in the folders\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Retrieves data from the source
+ * If the source is memory mapped data points into the memory map otherwise
+ * the data is read into data buffer, which must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int cabdecompress_get_data(
+     assorted_memory_map_t *memory_map,
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     off64_t offset,
+     size64_t size,
+     const uint8_t **data,
+     uint8_t **data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "cabdecompress_get_data";
+	ssize_t read_count    = 0;
+
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > source_size )
+	 || ( size > ( source_size - (size64_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range exceeds source size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file == NULL )
+	{
+		*data = &( memory_map->data[ offset ] );
+
+		return( 1 );
+	}
+	*data_buffer = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * ( (size_t) size + 1 ) );
+
+	if( *data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_seek_offset(
+	     source_file,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              source_file,
+	              *data_buffer,
+	              (size_t) size,
+	              error );
+
+	if( read_count != (ssize_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	*data = *data_buffer;
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 *data_buffer );
+
+	*data_buffer = NULL;
+
+	return( -1 );
+}
+
+/* Skips a string terminated by an end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int cabdecompress_skip_string(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function    = "cabdecompress_skip_string";
+	size_t safe_data_offset  = 0;
+
+	safe_data_offset = *data_offset;
+
+	while( safe_data_offset < data_size )
+	{
+		if( data[ safe_data_offset++ ] == 0 )
+		{
+			*data_offset = safe_data_offset;
+
+			return( 1 );
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid string value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Prints the file entries (CFFILE)
+ * Returns 1 if successful or -1 on error
+ */
+int cabdecompress_file_entries_fprint(
+     FILE *stream,
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t number_of_files,
+     libcerror_error_t **error )
+{
+	static char *function       = "cabdecompress_file_entries_fprint";
+	size_t data_offset          = 0;
+	size_t name_offset          = 0;
+	uint32_t file_size          = 0;
+	uint32_t uncompressed_offset = 0;
+	uint16_t file_index         = 0;
+	uint16_t folder_index       = 0;
+
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( CABDECOMPRESS_FILE_ENTRY_SIZE > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file entry: %" PRIu16 " value out of bounds.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 file_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 4 ] ),
+		 uncompressed_offset );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 folder_index );
+
+		data_offset += CABDECOMPRESS_FILE_ENTRY_SIZE;
+		name_offset  = data_offset;
+
+		if( cabdecompress_skip_string(
+		     data,
+		     data_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %" PRIu16 " name.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		fprintf(
+		 stream,
+		 "File: %s in folder: %" PRIu16 " at offset: %" PRIu32 " of size: %" PRIu32 "\n",
+		 (char *) &( data[ name_offset ] ),
+		 folder_index,
+		 uncompressed_offset,
+		 file_size );
+	}
+	return( 1 );
+}
+
+/* Decompresses the folder of a task
+ */
+void cabdecompress_task_decompress(
+      cabdecompress_task_t *task )
+{
+	if( task == NULL )
+	{
+		return;
+	}
+	task->result = -1;
+
+	if( assorted_cab_folder_get_uncompressed_size(
+	     task->folder_data,
+	     task->folder_data_size,
+	     task->number_of_blocks,
+	     task->block_reserved_size,
+	     &( task->uncompressed_data_size ),
+	     NULL ) != 1 )
+	{
+		return;
+	}
+	task->uncompressed_data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * ( task->uncompressed_data_size + 1 ) );
+
+	if( task->uncompressed_data == NULL )
+	{
+		return;
+	}
+	task->result = assorted_cab_folder_decompress(
+	                task->folder_data,
+	                task->folder_data_size,
+	                task->number_of_blocks,
+	                task->block_reserved_size,
+	                task->compression_type,
+	                task->uncompressed_data,
+	                task->uncompressed_data_size,
+	                NULL );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the folder of a task from a thread pool
+ * Returns 1 on success or -1 on error
+ */
+int cabdecompress_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	cabdecompress_task_decompress(
+	 (cabdecompress_task_t *) value );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses the folders of tasks
+ * Every folder is decoded by a single thread, since the data blocks of
+ * a folder depend on the uncompressed data of the preceding blocks
+ * Returns 1 if successful or -1 on error
+ */
+int cabdecompress_decompress_tasks(
+     cabdecompress_task_t *tasks,
+     int number_of_tasks,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function                  = "cabdecompress_decompress_tasks";
+	int task_index                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+	if( tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tasks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &cabdecompress_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	ASSORTED_UNREFERENCED_PARAMETER( number_of_threads )
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the folders are decompressed here
+	 */
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( tasks[ task_index ].result == 0 )
+		{
+			cabdecompress_task_decompress(
+			 &( tasks[ task_index ] ) );
+		}
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int cabdecompress_write_output(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *output_file = NULL;
+	static char *function        = "cabdecompress_write_output";
+	ssize_t write_count          = 0;
+
+	if( libcfile_file_initialize(
+	     &output_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_open(
+	     output_file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               output_file,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     output_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &output_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( output_file != NULL )
+	{
+		libcfile_file_free(
+		 &output_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	char destination[ 256 ];
+
+	assorted_memory_map_t *memory_map         = NULL;
+	cabdecompress_task_t *tasks               = NULL;
+	libcerror_error_t *error                  = NULL;
+	libcfile_file_t *source_file              = NULL;
+	system_character_t *option_index          = NULL;
+	system_character_t *source                = NULL;
+	const uint8_t *files_data                 = NULL;
+	const uint8_t *header_data                = NULL;
+	const char *prefix                        = NULL;
+	char *program                             = "cabdecompress";
+	uint8_t *files_data_buffer                = NULL;
+	uint8_t *header_data_buffer               = NULL;
+	system_integer_t option                   = 0;
+	size64_t cabinet_size                     = 0;
+	size64_t folder_data_end_offset           = 0;
+	size64_t source_size                      = 0;
+	size64_t total_uncompressed_size          = 0;
+	size_t folder_entry_size                  = 0;
+	size_t folders_offset                     = 0;
+	size_t header_data_offset                 = 0;
+	uint32_t files_offset                     = 0;
+	uint32_t folder_data_offset               = 0;
+	uint32_t value_32bit                      = 0;
+	uint16_t flags                            = 0;
+	uint16_t header_reserved_size             = 0;
+	uint16_t number_of_files                  = 0;
+	uint16_t number_of_folders                = 0;
+	uint8_t block_reserved_size               = 0;
+	uint8_t folder_reserved_size              = 0;
+	int folder_index                          = 0;
+	int folder_index_value                    = -1;
+	int number_of_decompressed_folders        = 0;
+	int number_of_failed_folders              = 0;
+	int number_of_tasks                       = 0;
+	int number_of_threads                     = 1;
+	int print_count                           = 0;
+	int result                                = 0;
+	int task_index                            = 0;
+	int verbose                               = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:j:p:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'i':
+				option_index = optarg;
+
+				break;
+
+			case 'p':
+				prefix = (const char *) optarg;
+
+				break;
+
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( prefix == NULL )
+	{
+		prefix = (const char *) source;
+	}
+	if( option_index != NULL )
+	{
+		folder_index_value = (int) system_string_copy_to_long( option_index );
+
+		if( folder_index_value < 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid index value out of bounds.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > CABDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	/* The source stays open for all folders, it is memory mapped if supported
+	 * otherwise the data of every folder is read
+	 */
+	if( assorted_memory_map_initialize(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create memory map.\n" );
+
+		goto on_error;
+	}
+	result = assorted_memory_map_open(
+	          memory_map,
+	          source,
+	          0,
+	          0,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open memory map.\n" );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		source_size = (size64_t) memory_map->data_size;
+	}
+	else
+	{
+		if( libcfile_file_initialize(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create source file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#endif
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( cabdecompress_get_data(
+	     memory_map,
+	     source_file,
+	     source_size,
+	     0,
+	     CABDECOMPRESS_FILE_HEADER_SIZE,
+	     &header_data,
+	     &header_data_buffer,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read file header.\n" );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     header_data,
+	     "MSCF",
+	     4 ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported file signature.\n" );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 8 ] ),
+	 value_32bit );
+
+	cabinet_size = (size64_t) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( header_data[ 16 ] ),
+	 files_offset );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( header_data[ 26 ] ),
+	 number_of_folders );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( header_data[ 28 ] ),
+	 number_of_files );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( header_data[ 30 ] ),
+	 flags );
+
+	if( header_data[ 25 ] != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported format version: %" PRIu8 ".%" PRIu8 ".\n",
+		 header_data[ 25 ],
+		 header_data[ 24 ] );
+
+		goto on_error;
+	}
+	if( header_data_buffer != NULL )
+	{
+		memory_free(
+		 header_data_buffer );
+
+		header_data_buffer = NULL;
+	}
+	if( ( cabinet_size == 0 )
+	 || ( cabinet_size > source_size ) )
+	{
+		cabinet_size = source_size;
+	}
+	if( ( files_offset < CABDECOMPRESS_FILE_HEADER_SIZE )
+	 || ( (size64_t) files_offset > cabinet_size ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid first file entry offset value out of bounds.\n" );
+
+		goto on_error;
+	}
+	/* The file header, including the optional fields, and the folder entries
+	 * precede the file entries
+	 */
+	if( cabdecompress_get_data(
+	     memory_map,
+	     source_file,
+	     source_size,
+	     0,
+	     (size64_t) files_offset,
+	     &header_data,
+	     &header_data_buffer,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read folder entries.\n" );
+
+		goto on_error;
+	}
+	header_data_offset = CABDECOMPRESS_FILE_HEADER_SIZE;
+
+	if( ( flags & CABDECOMPRESS_FLAG_RESERVE_PRESENT ) != 0 )
+	{
+		if( ( (size_t) files_offset - header_data_offset ) < 4 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid reserved sizes value out of bounds.\n" );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( header_data[ header_data_offset ] ),
+		 header_reserved_size );
+
+		folder_reserved_size = header_data[ header_data_offset + 2 ];
+		block_reserved_size  = header_data[ header_data_offset + 3 ];
+
+		header_data_offset += 4 + (size_t) header_reserved_size;
+	}
+	/* Skip the names of the previous and next cabinet and disk
+	 */
+	if( ( flags & CABDECOMPRESS_FLAG_PREVIOUS_CABINET ) != 0 )
+	{
+		if( ( cabdecompress_skip_string(
+		       header_data,
+		       (size_t) files_offset,
+		       &header_data_offset,
+		       &error ) != 1 )
+		 || ( cabdecompress_skip_string(
+		       header_data,
+		       (size_t) files_offset,
+		       &header_data_offset,
+		       &error ) != 1 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read previous cabinet name.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( flags & CABDECOMPRESS_FLAG_NEXT_CABINET ) != 0 )
+	{
+		if( ( cabdecompress_skip_string(
+		       header_data,
+		       (size_t) files_offset,
+		       &header_data_offset,
+		       &error ) != 1 )
+		 || ( cabdecompress_skip_string(
+		       header_data,
+		       (size_t) files_offset,
+		       &header_data_offset,
+		       &error ) != 1 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read next cabinet name.\n" );
+
+			goto on_error;
+		}
+	}
+	folders_offset    = header_data_offset;
+	folder_entry_size = CABDECOMPRESS_FOLDER_ENTRY_SIZE + folder_reserved_size;
+
+	if( ( folders_offset > (size_t) files_offset )
+	 || ( ( (size_t) number_of_folders * folder_entry_size ) > ( (size_t) files_offset - folders_offset ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of folders value out of bounds.\n" );
+
+		goto on_error;
+	}
+	if( ( folder_index_value >= 0 )
+	 && ( folder_index_value >= (int) number_of_folders ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid index value out of bounds.\n" );
+
+		goto on_error;
+	}
+	if( verbose != 0 )
+	{
+		/* The file entries are followed by the data blocks of the first folder
+		 */
+		folder_data_end_offset = cabinet_size;
+
+		for( folder_index = 0;
+		     folder_index < (int) number_of_folders;
+		     folder_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( header_data[ folders_offset + ( folder_index * folder_entry_size ) ] ),
+			 folder_data_offset );
+
+			if( ( folder_data_offset >= files_offset )
+			 && ( (size64_t) folder_data_offset < folder_data_end_offset ) )
+			{
+				folder_data_end_offset = (size64_t) folder_data_offset;
+			}
+		}
+		if( cabdecompress_get_data(
+		     memory_map,
+		     source_file,
+		     source_size,
+		     (off64_t) files_offset,
+		     folder_data_end_offset - files_offset,
+		     &files_data,
+		     &files_data_buffer,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read file entries.\n" );
+
+			goto on_error;
+		}
+		if( cabdecompress_file_entries_fprint(
+		     stderr,
+		     files_data,
+		     (size_t) ( folder_data_end_offset - files_offset ),
+		     number_of_files,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print file entries.\n" );
+
+			goto on_error;
+		}
+		if( files_data_buffer != NULL )
+		{
+			memory_free(
+			 files_data_buffer );
+
+			files_data_buffer = NULL;
+		}
+	}
+	tasks = (cabdecompress_task_t *) memory_allocate(
+	                                  sizeof( cabdecompress_task_t ) * number_of_threads );
+
+	if( tasks == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create tasks.\n" );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     tasks,
+	     0,
+	     sizeof( cabdecompress_task_t ) * number_of_threads ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear tasks.\n" );
+
+		goto on_error;
+	}
+	/* The folders are decompressed in batches of a folder per thread
+	 */
+	folder_index = 0;
+
+	while( folder_index < (int) number_of_folders )
+	{
+		number_of_tasks = 0;
+
+		while( ( folder_index < (int) number_of_folders )
+		    && ( number_of_tasks < number_of_threads ) )
+		{
+			if( ( folder_index_value >= 0 )
+			 && ( folder_index != folder_index_value ) )
+			{
+				folder_index++;
+
+				continue;
+			}
+			header_data_offset = folders_offset + ( folder_index * folder_entry_size );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( header_data[ header_data_offset ] ),
+			 folder_data_offset );
+
+			tasks[ number_of_tasks ].folder_index = folder_index;
+			tasks[ number_of_tasks ].result       = 0;
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( header_data[ header_data_offset + 4 ] ),
+			 tasks[ number_of_tasks ].number_of_blocks );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( header_data[ header_data_offset + 6 ] ),
+			 tasks[ number_of_tasks ].compression_type );
+
+			tasks[ number_of_tasks ].block_reserved_size = block_reserved_size;
+
+			if( verbose != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Folder: %d at offset: %" PRIu32 " with: %" PRIu16 " data blocks and compression type: 0x%04" PRIx16 "\n",
+				 folder_index,
+				 folder_data_offset,
+				 tasks[ number_of_tasks ].number_of_blocks,
+				 tasks[ number_of_tasks ].compression_type );
+			}
+			if( (size64_t) folder_data_offset > cabinet_size )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid folder: %d data offset value out of bounds.\n",
+				 folder_index );
+
+				number_of_failed_folders++;
+				folder_index++;
+
+				continue;
+			}
+			/* The data blocks of the folder end at the start of the data blocks
+			 * of the next folder if stored in order, otherwise at the end of the cabinet
+			 */
+			folder_data_end_offset = cabinet_size;
+
+			if( ( folder_index + 1 ) < (int) number_of_folders )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( header_data[ header_data_offset + folder_entry_size ] ),
+				 value_32bit );
+
+				if( ( value_32bit > folder_data_offset )
+				 && ( (size64_t) value_32bit < cabinet_size ) )
+				{
+					folder_data_end_offset = (size64_t) value_32bit;
+				}
+			}
+			tasks[ number_of_tasks ].folder_data_size = (size_t) ( folder_data_end_offset - folder_data_offset );
+
+			if( cabdecompress_get_data(
+			     memory_map,
+			     source_file,
+			     source_size,
+			     (off64_t) folder_data_offset,
+			     folder_data_end_offset - folder_data_offset,
+			     &( tasks[ number_of_tasks ].folder_data ),
+			     &( tasks[ number_of_tasks ].folder_data_buffer ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read folder: %d data.\n",
+				 folder_index );
+
+				goto on_error;
+			}
+			number_of_tasks++;
+			folder_index++;
+		}
+		if( cabdecompress_decompress_tasks(
+		     tasks,
+		     number_of_tasks,
+		     number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress folders.\n" );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress folder: %d with compression type: 0x%04" PRIx16 ".\n",
+				 tasks[ task_index ].folder_index,
+				 tasks[ task_index ].compression_type );
+
+				number_of_failed_folders++;
+			}
+			else
+			{
+				print_count = narrow_string_snprintf(
+				               destination,
+				               256,
+				               "%s.%d",
+				               prefix,
+				               tasks[ task_index ].folder_index );
+
+				if( ( print_count < 0 )
+				 || ( print_count > 256 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to set output filename.\n" );
+
+					goto on_error;
+				}
+				if( cabdecompress_write_output(
+				     destination,
+				     tasks[ task_index ].uncompressed_data,
+				     tasks[ task_index ].uncompressed_data_size,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write output file.\n" );
+
+					goto on_error;
+				}
+				total_uncompressed_size += tasks[ task_index ].uncompressed_data_size;
+
+				number_of_decompressed_folders++;
+			}
+			if( tasks[ task_index ].uncompressed_data != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].uncompressed_data );
+
+				tasks[ task_index ].uncompressed_data = NULL;
+			}
+			if( tasks[ task_index ].folder_data_buffer != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].folder_data_buffer );
+
+				tasks[ task_index ].folder_data_buffer = NULL;
+			}
+		}
+	}
+	fprintf(
+	 stdout,
+	 "Decompressed %d folders into %" PRIu64 " bytes.\n",
+	 number_of_decompressed_folders,
+	 total_uncompressed_size );
+
+	/* Clean up
+	 */
+	memory_free(
+	 tasks );
+
+	tasks = NULL;
+
+	if( header_data_buffer != NULL )
+	{
+		memory_free(
+		 header_data_buffer );
+
+		header_data_buffer = NULL;
+	}
+	if( source_file != NULL )
+	{
+		if( libcfile_file_close(
+		     source_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( assorted_memory_map_free(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free memory map.\n" );
+
+		goto on_error;
+	}
+	if( number_of_failed_folders > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( tasks != NULL )
+	{
+		for( task_index = 0;
+		     task_index < number_of_threads;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].uncompressed_data != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].uncompressed_data );
+			}
+			if( tasks[ task_index ].folder_data_buffer != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].folder_data_buffer );
+			}
+		}
+		memory_free(
+		 tasks );
+	}
+	if( files_data_buffer != NULL )
+	{
+		memory_free(
+		 files_data_buffer );
+	}
+	if( header_data_buffer != NULL )
+	{
+		memory_free(
+		 header_data_buffer );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
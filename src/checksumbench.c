@@ -0,0 +1,676 @@
+/*
+ * Benchmarks the checksum calculation methods
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_adler32.h"
+#include "assorted_cpu_features.h"
+#include "assorted_crc32.h"
+#include "assorted_crc64.h"
+#include "assorted_fletcher32.h"
+#include "assorted_fletcher64.h"
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "assorted_timer.h"
+#include "assorted_xor32.h"
+#include "assorted_xor64.h"
+
+/* The default minimum and maximum buffer size
+ */
+#define CHECKSUMBENCH_MINIMUM_BUFFER_SIZE	64
+#define CHECKSUMBENCH_MAXIMUM_BUFFER_SIZE	( 256 * 1024 * 1024 )
+
+/* The alignment of the start of the buffer, the benchmarked alignments are
+ * relative to it
+ */
+#define CHECKSUMBENCH_BUFFER_ALIGNMENT		64
+
+/* The size of the buffer that is written to evict the benchmarked data from
+ * the CPU caches, which should exceed the size of the last level cache
+ */
+#define CHECKSUMBENCH_EVICTION_BUFFER_SIZE	( 64 * 1024 * 1024 )
+
+/* The maximum number of runs of a cold cache measurement
+ */
+#define CHECKSUMBENCH_MAXIMUM_NUMBER_OF_COLD_RUNS	8
+
+/* The benchmarked alignments
+ */
+static size_t checksumbench_alignments[ 3 ] = { 0, 1, 8 };
+
+typedef int (*checksumbench_calculate_function_t)(
+               const uint8_t *buffer,
+               size_t size,
+               uint64_t *checksum,
+               libcerror_error_t **error );
+
+typedef struct checksumbench_kernel checksumbench_kernel_t;
+
+struct checksumbench_kernel
+{
+	/* The name
+	 */
+	const system_character_t *name;
+
+	/* The calculation function
+	 */
+	checksumbench_calculate_function_t calculate;
+
+	/* The maximum buffer size or 0 if not limited,
+	 * used to keep the bit-wise reference methods within reasonable time
+	 */
+	size_t maximum_buffer_size;
+};
+
+/* Defines a wrapper of a calculation function with a 32-bit checksum and initial value
+ */
+#define CHECKSUMBENCH_WRAPPER_32BIT( wrapper_name, function_name ) \
+	static int wrapper_name( \
+	            const uint8_t *buffer, \
+	            size_t size, \
+	            uint64_t *checksum, \
+	            libcerror_error_t **error ) \
+	{ \
+		uint32_t checksum_value = 0; \
+		int result              = function_name( &checksum_value, buffer, size, 0, error ); \
+		*checksum               = (uint64_t) checksum_value; \
+		return( result ); \
+	}
+
+/* Defines a wrapper of a CRC-32 calculation function
+ */
+#define CHECKSUMBENCH_WRAPPER_CRC32( wrapper_name, function_name ) \
+	static int wrapper_name( \
+	            const uint8_t *buffer, \
+	            size_t size, \
+	            uint64_t *checksum, \
+	            libcerror_error_t **error ) \
+	{ \
+		uint32_t checksum_value = 0; \
+		int result              = function_name( &checksum_value, buffer, size, 0, 0, error ); \
+		*checksum               = (uint64_t) checksum_value; \
+		return( result ); \
+	}
+
+/* Defines a wrapper of a calculation function with a 64-bit checksum and initial value
+ */
+#define CHECKSUMBENCH_WRAPPER_64BIT( wrapper_name, function_name ) \
+	static int wrapper_name( \
+	            const uint8_t *buffer, \
+	            size_t size, \
+	            uint64_t *checksum, \
+	            libcerror_error_t **error ) \
+	{ \
+		return( function_name( checksum, buffer, size, 0, error ) ); \
+	}
+
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_basic1, assorted_adler32_calculate_checksum_basic1 )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_basic2, assorted_adler32_calculate_checksum_basic2 )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_unfolded4_1, assorted_adler32_calculate_checksum_unfolded4_1 )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_unfolded4_2, assorted_adler32_calculate_checksum_unfolded4_2 )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_unfolded16_1, assorted_adler32_calculate_checksum_unfolded16_1 )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_unfolded16_2, assorted_adler32_calculate_checksum_unfolded16_2 )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_unfolded16_3, assorted_adler32_calculate_checksum_unfolded16_3 )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_unfolded16_4, assorted_adler32_calculate_checksum_unfolded16_4 )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_cpu_aligned, assorted_adler32_calculate_checksum_cpu_aligned )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_adler32_simd, assorted_adler32_calculate_checksum_simd )
+
+CHECKSUMBENCH_WRAPPER_CRC32( checksumbench_crc32_modulo2, assorted_crc32_calculate_modulo2 )
+CHECKSUMBENCH_WRAPPER_CRC32( checksumbench_crc32_table, assorted_crc32_calculate )
+CHECKSUMBENCH_WRAPPER_CRC32( checksumbench_crc32_slicing_by_8, assorted_crc32_calculate_slicing_by_8 )
+CHECKSUMBENCH_WRAPPER_CRC32( checksumbench_crc32_slicing_by_16, assorted_crc32_calculate_slicing_by_16 )
+CHECKSUMBENCH_WRAPPER_CRC32( checksumbench_crc32_folded, assorted_crc32_calculate_folded )
+CHECKSUMBENCH_WRAPPER_CRC32( checksumbench_crc32_castagnoli, assorted_crc32_calculate_castagnoli )
+
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_crc64_1, assorted_crc64_calculate_1 )
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_crc64_2, assorted_crc64_calculate_2 )
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_crc64_ecma182_slicing_by_8, assorted_crc64_calculate_ecma182_slicing_by_8 )
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_crc64_xz_slicing_by_8, assorted_crc64_calculate_xz_slicing_by_8 )
+
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_fletcher32_basic, assorted_fletcher32_calculate )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_fletcher32_simd, assorted_fletcher32_calculate_simd )
+
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_fletcher64_basic, assorted_fletcher64_calculate )
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_fletcher64_simd, assorted_fletcher64_calculate_simd )
+
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_xor32_basic, assorted_xor32_calculate_checksum_little_endian_basic )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_xor32_cpu_aligned, assorted_xor32_calculate_checksum_little_endian_cpu_aligned )
+CHECKSUMBENCH_WRAPPER_32BIT( checksumbench_xor32_simd, assorted_xor32_calculate_checksum_little_endian_simd )
+
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_xor64_basic, assorted_xor64_calculate_checksum_little_endian_basic )
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_xor64_cpu_aligned, assorted_xor64_calculate_checksum_little_endian_cpu_aligned )
+CHECKSUMBENCH_WRAPPER_64BIT( checksumbench_xor64_simd, assorted_xor64_calculate_checksum_little_endian_simd )
+
+/* The benchmarked calculation methods
+ */
+static checksumbench_kernel_t checksumbench_kernels[] = {
+	{ _SYSTEM_STRING( "adler32_basic1" ), checksumbench_adler32_basic1, 0 },
+	{ _SYSTEM_STRING( "adler32_basic2" ), checksumbench_adler32_basic2, 0 },
+	{ _SYSTEM_STRING( "adler32_unfolded4_1" ), checksumbench_adler32_unfolded4_1, 0 },
+	{ _SYSTEM_STRING( "adler32_unfolded4_2" ), checksumbench_adler32_unfolded4_2, 0 },
+	{ _SYSTEM_STRING( "adler32_unfolded16_1" ), checksumbench_adler32_unfolded16_1, 0 },
+	{ _SYSTEM_STRING( "adler32_unfolded16_2" ), checksumbench_adler32_unfolded16_2, 0 },
+	{ _SYSTEM_STRING( "adler32_unfolded16_3" ), checksumbench_adler32_unfolded16_3, 0 },
+	{ _SYSTEM_STRING( "adler32_unfolded16_4" ), checksumbench_adler32_unfolded16_4, 0 },
+	{ _SYSTEM_STRING( "adler32_cpu_aligned" ), checksumbench_adler32_cpu_aligned, 0 },
+	{ _SYSTEM_STRING( "adler32_simd" ), checksumbench_adler32_simd, 0 },
+	{ _SYSTEM_STRING( "crc32_modulo2" ), checksumbench_crc32_modulo2, 4 * 1024 * 1024 },
+	{ _SYSTEM_STRING( "crc32_table" ), checksumbench_crc32_table, 0 },
+	{ _SYSTEM_STRING( "crc32_slicing_by_8" ), checksumbench_crc32_slicing_by_8, 0 },
+	{ _SYSTEM_STRING( "crc32_slicing_by_16" ), checksumbench_crc32_slicing_by_16, 0 },
+	{ _SYSTEM_STRING( "crc32_folded" ), checksumbench_crc32_folded, 0 },
+	{ _SYSTEM_STRING( "crc32_castagnoli" ), checksumbench_crc32_castagnoli, 0 },
+	{ _SYSTEM_STRING( "crc64_1" ), checksumbench_crc64_1, 0 },
+	{ _SYSTEM_STRING( "crc64_2" ), checksumbench_crc64_2, 0 },
+	{ _SYSTEM_STRING( "crc64_ecma182_slicing_by_8" ), checksumbench_crc64_ecma182_slicing_by_8, 0 },
+	{ _SYSTEM_STRING( "crc64_xz_slicing_by_8" ), checksumbench_crc64_xz_slicing_by_8, 0 },
+	{ _SYSTEM_STRING( "fletcher32_basic" ), checksumbench_fletcher32_basic, 0 },
+	{ _SYSTEM_STRING( "fletcher32_simd" ), checksumbench_fletcher32_simd, 0 },
+	{ _SYSTEM_STRING( "fletcher64_basic" ), checksumbench_fletcher64_basic, 0 },
+	{ _SYSTEM_STRING( "fletcher64_simd" ), checksumbench_fletcher64_simd, 0 },
+	{ _SYSTEM_STRING( "xor32_basic" ), checksumbench_xor32_basic, 0 },
+	{ _SYSTEM_STRING( "xor32_cpu_aligned" ), checksumbench_xor32_cpu_aligned, 0 },
+	{ _SYSTEM_STRING( "xor32_simd" ), checksumbench_xor32_simd, 0 },
+	{ _SYSTEM_STRING( "xor64_basic" ), checksumbench_xor64_basic, 0 },
+	{ _SYSTEM_STRING( "xor64_cpu_aligned" ), checksumbench_xor64_cpu_aligned, 0 },
+	{ _SYSTEM_STRING( "xor64_simd" ), checksumbench_xor64_simd, 0 },
+	{ NULL, NULL, 0 } };
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use checksumbench to benchmark the checksum calculation methods.\n\n" );
+
+	fprintf( stream, "Usage: checksumbench [ -f filter ] [ -m features_mask ] [ -n minimum_size ]\n"
+	                 "                     [ -s maximum_size ] [ -t minimum_time ] [ -hvV ]\n\n" );
+
+	fprintf( stream, "\t-f:     only benchmark the calculation methods of which the name\n"
+	                 "\t        contains the filter, such as crc32 or simd\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     mask of the CPU features used by the calculation methods,\n"
+	                 "\t        where 0 only uses portable code (default is all supported\n"
+	                 "\t        CPU features)\n" );
+	fprintf( stream, "\t-n:     minimum buffer size (default is 64)\n" );
+	fprintf( stream, "\t-s:     maximum buffer size (default is 268435456)\n" );
+	fprintf( stream, "\t-t:     minimum time of a warm cache measurement in milliseconds\n"
+	                 "\t        (default is 50)\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+	fprintf( stream, "The results are written to stdout as comma separated values with\n"
+	                 "the columns: method, size, alignment, cache, iterations, seconds,\n"
+	                 "GB/s and cycles/byte. The buffer sizes increase by a factor 4 from\n"
+	                 "the minimum to the maximum size. A cold cache measurement evicts\n"
+	                 "the data from the CPU caches before every run.\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Evicts the benchmarked data from the CPU caches by writing a buffer that
+ * exceeds the size of the last level cache
+ */
+static void checksumbench_evict_caches(
+             uint8_t *eviction_buffer,
+             uint8_t byte_value )
+{
+	memory_set(
+	 eviction_buffer,
+	 byte_value,
+	 CHECKSUMBENCH_EVICTION_BUFFER_SIZE );
+}
+
+/* Benchmarks a calculation method for a specific buffer
+ * Returns 1 if successful or -1 on error
+ */
+static int checksumbench_run(
+            checksumbench_kernel_t *kernel,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            size_t alignment,
+            int cold_cache,
+            uint64_t minimum_time,
+            uint8_t *eviction_buffer,
+            uint64_t *checksum_sum,
+            libcerror_error_t **error )
+{
+	static char *function      = "checksumbench_run";
+	uint64_t checksum          = 0;
+	uint64_t elapsed_cycles    = 0;
+	uint64_t elapsed_time      = 0;
+	uint64_t number_of_bytes   = 0;
+	uint64_t number_of_runs    = 0;
+	uint64_t run_index         = 0;
+	uint64_t start_cycles      = 0;
+	uint64_t start_time        = 0;
+	double cycles_per_byte     = 0.0;
+	double gigabytes_per_sec   = 0.0;
+	double seconds             = 0.0;
+
+	if( cold_cache == 0 )
+	{
+		/* Warm up the caches and the branch predictors
+		 */
+		if( kernel->calculate(
+		     buffer,
+		     buffer_size,
+		     &checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate: %" PRIs_SYSTEM " checksum.",
+			 function,
+			 kernel->name );
+
+			return( -1 );
+		}
+		*checksum_sum ^= checksum;
+
+		/* The number of runs is doubled until the measurement takes
+		 * at least the minimum time
+		 */
+		number_of_runs = 1;
+
+		do
+		{
+			start_cycles = assorted_timer_get_cycles();
+			start_time   = assorted_timer_get_time();
+
+			for( run_index = 0;
+			     run_index < number_of_runs;
+			     run_index++ )
+			{
+				if( kernel->calculate(
+				     buffer,
+				     buffer_size,
+				     &checksum,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to calculate: %" PRIs_SYSTEM " checksum.",
+					 function,
+					 kernel->name );
+
+					return( -1 );
+				}
+				*checksum_sum ^= checksum;
+			}
+			elapsed_time   = assorted_timer_get_time() - start_time;
+			elapsed_cycles = assorted_timer_get_cycles() - start_cycles;
+
+			if( elapsed_time >= minimum_time )
+			{
+				break;
+			}
+			number_of_runs *= 2;
+		}
+		while( number_of_runs != 0 );
+	}
+	else
+	{
+		/* Only the calculation is measured, the eviction is not
+		 */
+		for( run_index = 0;
+		     run_index < CHECKSUMBENCH_MAXIMUM_NUMBER_OF_COLD_RUNS;
+		     run_index++ )
+		{
+			checksumbench_evict_caches(
+			 eviction_buffer,
+			 (uint8_t) run_index );
+
+			start_cycles = assorted_timer_get_cycles();
+			start_time   = assorted_timer_get_time();
+
+			if( kernel->calculate(
+			     buffer,
+			     buffer_size,
+			     &checksum,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate: %" PRIs_SYSTEM " checksum.",
+				 function,
+				 kernel->name );
+
+				return( -1 );
+			}
+			elapsed_time   += assorted_timer_get_time() - start_time;
+			elapsed_cycles += assorted_timer_get_cycles() - start_cycles;
+
+			*checksum_sum ^= checksum;
+
+			number_of_runs++;
+
+			if( elapsed_time >= minimum_time )
+			{
+				break;
+			}
+		}
+	}
+	number_of_bytes = number_of_runs * (uint64_t) buffer_size;
+	seconds         = (double) elapsed_time / 1000000000.0;
+
+	if( elapsed_time > 0 )
+	{
+		gigabytes_per_sec = (double) number_of_bytes / (double) elapsed_time;
+	}
+	cycles_per_byte = (double) elapsed_cycles / (double) number_of_bytes;
+
+	fprintf(
+	 stdout,
+	 "%" PRIs_SYSTEM ",%" PRIzd ",%" PRIzd ",%s,%" PRIu64 ",%.9f,%.3f,",
+	 kernel->name,
+	 (ssize_t) buffer_size,
+	 (ssize_t) alignment,
+	 ( cold_cache != 0 ) ? "cold" : "warm",
+	 number_of_runs,
+	 seconds,
+	 gigabytes_per_sec );
+
+#if defined( ASSORTED_TIMER_HAVE_CYCLE_COUNTER )
+	fprintf(
+	 stdout,
+	 "%.3f\n",
+	 cycles_per_byte );
+#else
+	fprintf(
+	 stdout,
+	 "\n" );
+#endif
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error      = NULL;
+	system_character_t *filter    = NULL;
+	uint8_t *buffer               = NULL;
+	uint8_t *eviction_buffer      = NULL;
+	uint8_t *aligned_buffer       = NULL;
+	char *program                 = "checksumbench";
+	system_integer_t option       = 0;
+	uint64_t checksum_sum         = 0;
+	uint64_t minimum_time         = 50;
+	size_t alignment_index        = 0;
+	size_t buffer_index           = 0;
+	size_t buffer_size            = 0;
+	size_t maximum_buffer_size    = CHECKSUMBENCH_MAXIMUM_BUFFER_SIZE;
+	size_t minimum_buffer_size    = CHECKSUMBENCH_MINIMUM_BUFFER_SIZE;
+	uint32_t random_value         = 0x12345678UL;
+	int cold_cache                = 0;
+	int kernel_index              = 0;
+	int verbose                   = 0;
+
+	/* The version is printed to stderr to keep stdout machine-readable
+	 */
+	assorted_output_version_fprint(
+	 stderr,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "f:hm:n:s:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'f':
+				filter = optarg;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				assorted_cpu_features_set_mask(
+				 (uint32_t) system_string_copy_to_64bit( optarg ) );
+
+				break;
+
+			case 'n':
+				minimum_buffer_size = (size_t) system_string_copy_to_64bit(
+				                                optarg );
+
+				break;
+
+			case 's':
+				maximum_buffer_size = (size_t) system_string_copy_to_64bit(
+				                                optarg );
+
+				break;
+
+			case 't':
+				minimum_time = system_string_copy_to_64bit(
+				                optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( minimum_buffer_size == 0 )
+	 || ( minimum_buffer_size > maximum_buffer_size )
+	 || ( maximum_buffer_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - CHECKSUMBENCH_BUFFER_ALIGNMENT - 8 ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid minimum or maximum buffer size.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	/* Room is added for the alignment of the buffer and the largest
+	 * benchmarked alignment
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * ( maximum_buffer_size + CHECKSUMBENCH_BUFFER_ALIGNMENT + 8 ) );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		goto on_error;
+	}
+	eviction_buffer = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * CHECKSUMBENCH_EVICTION_BUFFER_SIZE );
+
+	if( eviction_buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create eviction buffer.\n" );
+
+		goto on_error;
+	}
+	/* Fill the buffer with pseudo random data so that the data does not
+	 * favor any of the calculation methods
+	 */
+	for( buffer_index = 0;
+	     buffer_index < ( maximum_buffer_size + CHECKSUMBENCH_BUFFER_ALIGNMENT + 8 );
+	     buffer_index++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		buffer[ buffer_index ] = (uint8_t) ( random_value >> 16 );
+	}
+	aligned_buffer = &( buffer[ ( CHECKSUMBENCH_BUFFER_ALIGNMENT - ( (intptr_t) buffer % CHECKSUMBENCH_BUFFER_ALIGNMENT ) ) % CHECKSUMBENCH_BUFFER_ALIGNMENT ] );
+
+	if( verbose != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "CPU features: 0x%08" PRIx32 "\n",
+		 assorted_cpu_features_get() );
+	}
+	fprintf(
+	 stdout,
+	 "method,size,alignment,cache,iterations,seconds,gigabytes_per_second,cycles_per_byte\n" );
+
+	for( kernel_index = 0;
+	     checksumbench_kernels[ kernel_index ].name != NULL;
+	     kernel_index++ )
+	{
+		if( ( filter != NULL )
+		 && ( system_string_search_string(
+		       checksumbench_kernels[ kernel_index ].name,
+		       filter,
+		       system_string_length(
+		        checksumbench_kernels[ kernel_index ].name ) ) == NULL ) )
+		{
+			continue;
+		}
+		for( buffer_size = minimum_buffer_size;
+		     buffer_size <= maximum_buffer_size;
+		     buffer_size *= 4 )
+		{
+			if( ( checksumbench_kernels[ kernel_index ].maximum_buffer_size != 0 )
+			 && ( buffer_size > checksumbench_kernels[ kernel_index ].maximum_buffer_size ) )
+			{
+				break;
+			}
+			for( alignment_index = 0;
+			     alignment_index < 3;
+			     alignment_index++ )
+			{
+				for( cold_cache = 0;
+				     cold_cache < 2;
+				     cold_cache++ )
+				{
+					if( checksumbench_run(
+					     &( checksumbench_kernels[ kernel_index ] ),
+					     &( aligned_buffer[ checksumbench_alignments[ alignment_index ] ] ),
+					     buffer_size,
+					     checksumbench_alignments[ alignment_index ],
+					     cold_cache,
+					     minimum_time * 1000000UL,
+					     eviction_buffer,
+					     &checksum_sum,
+					     &error ) != 1 )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to benchmark: %" PRIs_SYSTEM ".\n",
+						 checksumbench_kernels[ kernel_index ].name );
+
+						goto on_error;
+					}
+				}
+			}
+			fflush(
+			 stdout );
+		}
+	}
+	if( verbose != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Combined checksums: 0x%08" PRIx64 "\n",
+		 checksum_sum );
+	}
+	memory_free(
+	 eviction_buffer );
+
+	memory_free(
+	 buffer );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( eviction_buffer != NULL )
+	{
+		memory_free(
+		 eviction_buffer );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -29,13 +29,37 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_async_file.h"
+#include "assorted_checksum_cache.h"
+#include "assorted_cpu_features.h"
 #include "assorted_crc32.h"
+#include "assorted_crc32_parallel.h"
+#include "assorted_crc32_syndrome_table.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_memory_map.h"
 #include "assorted_output.h"
+#include "assorted_progress.h"
+#include "assorted_signal.h"
 #include "assorted_system_string.h"
+#include "assorted_unused.h"
+
+/* The size of the chunks the source file is read in,
+ * when using multiple threads this is the size per thread
+ */
+#define CRC32SUM_CHUNK_SIZE			( 4 * 1024 * 1024 )
+
+/* The maximum number of threads
+ */
+#define CRC32SUM_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum block size
+ */
+#define CRC32SUM_MAXIMUM_BLOCK_SIZE		( 1024 * 1024 * 1024 )
+
+assorted_progress_t *crc32sum_progress = NULL;
 
 /* Prints the executable usage information
  */
@@ -48,20 +72,42 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use crc32sum to calculate a CRC-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: crc32sum [ -c crc ] [ -i initial_value ] [ -o offset ]\n"
-	                 "                [ -p polynomial ] [ -s size ] [ -12hvVw ] source\n\n" );
+	fprintf( stream, "Usage: crc32sum [ -b block_size ] [ -c crc ] [ -C cache_file ]\n"
+	                 "                [ -i initial_value ] [ -m features_mask ] [ -o offset ]\n"
+	                 "                [ -p polynomial ] [ -s size ] [ -j number_of_threads ]\n"
+	                 "                [ -12345AhMvVw ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the modulo-2 calculation method\n" );
-	fprintf( stream, "\t-2:     use the table lookup calculation method (default)\n" );
+	fprintf( stream, "\t-2:     use the table lookup calculation method\n" );
+	fprintf( stream, "\t-3:     use the slicing-by-8 table lookup calculation method\n" );
+	fprintf( stream, "\t-4:     use the slicing-by-16 table lookup calculation method\n" );
+	fprintf( stream, "\t-5:     use the fastest calculation method for the polynomial\n"
+	                 "\t        supported by the CPU (default), which is carry-less\n"
+	                 "\t        multiplication folding for 0xedb88320, the CRC-32C\n"
+	                 "\t        instruction for 0x82f63b78 and otherwise slicing-by-16\n" );
+	fprintf( stream, "\t-A:     use asynchronous direct I/O instead of reading the source file\n" );
+	fprintf( stream, "\t-b:     calculate a CRC-32 per block of the specified size, using\n"
+	                 "\t        the fastest calculation method, where the blocks are\n"
+	                 "\t        calculated in parallel when multiple threads are used\n" );
 	fprintf( stream, "\t-c:     check the calculated CRC-32 with the one provided.\n"
 	                 "\t        On a mismatch crc32 will try to locate the error.\n" );
+	fprintf( stream, "\t-C:     use the checksum cache file, where the checksum of data of\n"
+	                 "\t        an unchanged file is retrieved instead of calculated\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial value (default is 0)\n" );
+	fprintf( stream, "\t-j:     number of threads used by the fastest calculation method,\n"
+	                 "\t        where the CRC-32 of the data per thread are combined\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-m:     mask of the CPU features used by the fastest calculation\n"
+	                 "\t        method, where 0 only uses portable code, intended for\n"
+	                 "\t        benchmarking (default is all supported CPU features)\n" );
+	fprintf( stream, "\t-M:     use memory mapped input instead of reading the source file\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-p:     polynomial (default is 0xedb88320)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\t-w:     use weak CRC calculation, without the initial and\n"
@@ -69,6 +115,17 @@ void usage_fprint(
 	fprintf( stream, "\n" );
 }
 
+/* Signal handler for crc32sum
+ */
+void crc32sum_signal_handler(
+      assorted_signal_t signal ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( signal )
+
+	assorted_progress_signal_abort(
+	 crc32sum_progress );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -77,25 +134,49 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "crc32sum";
-	system_integer_t option      = 0;
-	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
-	off_t source_offset          = 0;
-	uint32_t calculated_crc32    = 0;
-	uint32_t crc32               = 0;
-	uint32_t initial_value       = 0;
-	uint32_t polynomial          = 0xedb88320UL;
-	uint8_t bit_index            = 0;
-	uint8_t weak_crc             = 0;
-	int calculation_method       = 2;
-	int result                   = 0;
-	int validate_crc             = 0;
-	int verbose                  = 0;
+	assorted_checksum_cache_key_t checksum_cache_key;
+
+	assorted_checksum_cache_t *checksum_cache = NULL;
+	libcerror_error_t *error                  = NULL;
+	libcfile_file_t *source_file              = NULL;
+	assorted_async_file_t *async_file         = NULL;
+	assorted_memory_map_t *memory_map         = NULL;
+	system_character_t *cache_filename        = NULL;
+	system_character_t *source                = NULL;
+	const uint8_t *chunk_data                 = NULL;
+	uint32_t *block_crc32_values              = NULL;
+	uint8_t *buffer                           = NULL;
+	char *program                             = "crc32sum";
+	system_integer_t option                   = 0;
+	size64_t block_size                       = 0;
+	size64_t remaining_size                   = 0;
+	size64_t source_size                      = 0;
+	size_t block_index                        = 0;
+	size_t chunk_size                         = 0;
+	size_t error_offset                       = 0;
+	size_t number_of_blocks                   = 0;
+	size_t chunk_data_size                    = 0;
+	size_t read_size                          = 0;
+	ssize_t read_count                        = 0;
+	off_t block_end                           = 0;
+	off_t block_offset                        = 0;
+	off_t source_offset                       = 0;
+	uint64_t cached_checksum                  = 0;
+	uint32_t calculated_crc32                 = 0;
+	uint32_t crc32                            = 0;
+	uint32_t initial_value                    = 0;
+	uint32_t polynomial                       = 0xedb88320UL;
+	uint8_t bit_index                         = 0;
+	uint8_t error_bit                         = 0;
+	uint8_t weak_crc                          = 0;
+	int calculation_method                    = 5;
+	int is_cached                             = 0;
+	int number_of_threads                     = 1;
+	int result                                = 0;
+	int use_asynchronous_io                   = 0;
+	int use_memory_map                        = 0;
+	int validate_crc                          = 0;
+	int verbose                               = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -104,7 +185,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12c:hi:o:p:s:vVw" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12345Ab:c:C:hj:Mi:m:o:p:s:t:vVw" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -130,6 +211,31 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case '3':
+				calculation_method = 3;
+
+				break;
+
+			case '4':
+				calculation_method = 4;
+
+				break;
+
+			case '5':
+				calculation_method = 5;
+
+				break;
+
+			case 'A':
+				use_asynchronous_io = 1;
+
+				break;
+
+			case 'b':
+				block_size = system_string_copy_to_64bit( optarg );
+
+				break;
+
 			case 'c':
 				crc32 = system_string_copy_to_long( optarg );
 
@@ -137,6 +243,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'C':
+				cache_filename = optarg;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -148,6 +259,17 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'm':
+				assorted_cpu_features_set_mask(
+				 (uint32_t) system_string_copy_to_64bit( optarg ) );
+
+				break;
+
+			case 'M':
+				use_memory_map = 1;
+
+				break;
+
 			case 'o':
 				source_offset = system_string_copy_to_long( optarg );
 
@@ -163,6 +285,12 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -193,12 +321,89 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( number_of_threads < 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value zero or less.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_threads > CRC32SUM_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value exceeds maximum.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( block_size != 0 )
+	{
+		if( block_size > (size64_t) CRC32SUM_MAXIMUM_BLOCK_SIZE )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid block size value exceeds maximum.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( calculation_method != 5 )
+		{
+			fprintf(
+			 stderr,
+			 "Block size is only supported by the fastest calculation method.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( validate_crc != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Checking the calculated CRC-32 is not supported with a block size.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( cache_filename != NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Checksum cache is not supported with a block size.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	/* The progress is only reported in verbose mode but the abort flag is always checked
+	 */
+	if( assorted_progress_initialize(
+	     &crc32sum_progress,
+	     ASSORTED_PROGRESS_DEFAULT_INTERVAL,
+	     ( verbose != 0 ) ? &assorted_progress_fprint : NULL,
+	     (void *) stderr,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create progress.\n" );
+
+		goto on_error;
+	}
+	if( assorted_signal_attach(
+	     crc32sum_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
@@ -254,24 +459,207 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
+	if( cache_filename != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		if( assorted_checksum_cache_initialize(
+		     &checksum_cache,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create checksum cache.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = assorted_checksum_cache_open(
+		          checksum_cache,
+		          cache_filename,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open checksum cache.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Checksum cache not supported, calculating CRC-32 instead.\n" );
+
+			if( assorted_checksum_cache_free(
+			     &checksum_cache,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free checksum cache.\n" );
+
+				goto on_error;
+			}
+		}
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
+	chunk_size = CRC32SUM_CHUNK_SIZE;
 
-	if( buffer == NULL )
+	if( calculation_method == 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		/* The modulo-2 calculation method cannot be continued from the CRC-32
+		 * of the preceding data, hence the data is calculated as a single chunk
+		 */
+		if( source_size > (size64_t) SSIZE_MAX )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		chunk_size = (size_t) source_size;
+
+		if( use_asynchronous_io != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Asynchronous I/O not supported by the modulo-2 calculation method, reading source file instead.\n" );
+
+			use_asynchronous_io = 0;
+		}
+	}
+	else if( ( calculation_method == 5 )
+	      && ( number_of_threads > 1 ) )
+	{
+		chunk_size *= (size_t) number_of_threads;
+	}
+	if( block_size != 0 )
+	{
+		/* A chunk contains whole blocks so that blocks are not split across chunks
+		 */
+		chunk_size = (size_t) ( ( ( chunk_size + block_size - 1 ) / block_size ) * block_size );
+
+		number_of_blocks = (size_t) ( chunk_size / block_size );
+
+		block_crc32_values = (uint32_t *) memory_allocate(
+		                                   sizeof( uint32_t ) * number_of_blocks );
+
+		if( block_crc32_values == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create block CRC-32 values.\n" );
+
+			goto on_error;
+		}
+	}
+	if( use_memory_map != 0 )
+	{
+		if( assorted_memory_map_initialize(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create memory map.\n" );
+
+			goto on_error;
+		}
+		result = assorted_memory_map_open(
+		          memory_map,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to memory map source file.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Memory mapped input not supported, reading source file instead.\n" );
+
+			if( assorted_memory_map_free(
+			     &memory_map,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free memory map.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( use_asynchronous_io != 0 )
+	 && ( memory_map == NULL ) )
+	{
+		if( assorted_async_file_initialize(
+		     &async_file,
+		     chunk_size,
+		     ASSORTED_ASYNC_FILE_DEFAULT_QUEUE_DEPTH,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create asynchronous file.\n" );
+
+			goto on_error;
+		}
+		result = assorted_async_file_open(
+		          async_file,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file for asynchronous I/O.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Asynchronous I/O not supported, reading source file instead.\n" );
+
+			if( assorted_async_file_free(
+			     &async_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free asynchronous file.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( memory_map == NULL )
+	 && ( async_file == NULL ) )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * chunk_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Position the source file at the right offset
 	 */
@@ -287,22 +675,339 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	if( calculation_method == 2 )
+	{
+		assorted_crc32_initialize_table(
+		 polynomial );
+	}
+	else if( ( calculation_method == 3 )
+	      || ( calculation_method == 4 ) )
+	{
+		assorted_crc32_initialize_slicing_table(
+		 polynomial );
+	}
+	/* The data is read in chunks, where the CRC-32 of the preceding chunks
+	 * is used as the initial value of the next chunk, except for the modulo-2
+	 * calculation method of which the data is a single chunk
+	 */
+	calculated_crc32 = initial_value;
+	remaining_size   = source_size;
+
+	if( checksum_cache != NULL )
+	{
+		if( memory_set(
+		     &checksum_cache_key,
+		     0,
+		     sizeof( assorted_checksum_cache_key_t ) ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to clear checksum cache key.\n" );
+
+			goto on_error;
+		}
+		checksum_cache_key.offset        = (uint64_t) source_offset;
+		checksum_cache_key.size          = (uint64_t) source_size;
+		checksum_cache_key.initial_value = (uint64_t) initial_value;
+		checksum_cache_key.parameters    = (uint64_t) polynomial;
+		checksum_cache_key.method        = ASSORTED_CHECKSUM_CACHE_METHOD_CRC32;
+		/* The calculation methods do not all produce the same CRC, hence
+		 * the calculation method is part of the key
+		 */
+		checksum_cache_key.flags         = ( (uint32_t) calculation_method << 8 ) | (uint32_t) weak_crc;
+
+		result = assorted_checksum_cache_get_checksum(
+		          checksum_cache,
+		          source,
+		          &checksum_cache_key,
+		          &cached_checksum,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve checksum from cache.\n" );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			calculated_crc32 = (uint32_t) cached_checksum;
+			remaining_size = 0;
+			is_cached      = 1;
+
+			if( verbose != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Retrieved CRC-32 from checksum cache.\n" );
+			}
+		}
+	}
 
-	if( read_count != (ssize_t) source_size )
+	while( remaining_size > 0 )
+	{
+		read_size = chunk_size;
+
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		if( memory_map != NULL )
+		{
+			chunk_data = &( memory_map->data[ source_size - remaining_size ] );
+		}
+		else if( async_file != NULL )
+		{
+			result = assorted_async_file_read_next(
+			          async_file,
+			          &chunk_data,
+			          &chunk_data_size,
+			          &error );
+
+			if( ( result != 1 )
+			 || ( chunk_data_size != read_size ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      buffer,
+				      read_size,
+				      &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			chunk_data = buffer;
+		}
+		if( block_size != 0 )
+		{
+			result = assorted_crc32_parallel_calculate_blocks(
+				  block_crc32_values,
+				  number_of_blocks,
+				  chunk_data,
+				  read_size,
+				  (size_t) block_size,
+				  initial_value,
+				  weak_crc,
+				  polynomial,
+				  number_of_threads,
+				  &error );
+		}
+		else if( calculation_method == 1 )
+		{
+			result = assorted_crc32_calculate_modulo2(
+				  &calculated_crc32,
+				  chunk_data,
+				  read_size,
+				  calculated_crc32,
+				  weak_crc,
+				  &error );
+		}
+		else if( calculation_method == 2 )
+		{
+			result = assorted_crc32_calculate(
+				  &calculated_crc32,
+				  chunk_data,
+				  read_size,
+				  calculated_crc32,
+				  weak_crc,
+				  &error );
+		}
+		else if( calculation_method == 3 )
+		{
+			result = assorted_crc32_calculate_slicing_by_8(
+				  &calculated_crc32,
+				  chunk_data,
+				  read_size,
+				  calculated_crc32,
+				  weak_crc,
+				  &error );
+		}
+		else if( calculation_method == 4 )
+		{
+			result = assorted_crc32_calculate_slicing_by_16(
+				  &calculated_crc32,
+				  chunk_data,
+				  read_size,
+				  calculated_crc32,
+				  weak_crc,
+				  &error );
+		}
+		else if( ( calculation_method == 5 )
+		      && ( number_of_threads > 1 ) )
+		{
+			result = assorted_crc32_parallel_calculate(
+				  &calculated_crc32,
+				  chunk_data,
+				  read_size,
+				  calculated_crc32,
+				  weak_crc,
+				  polynomial,
+				  number_of_threads,
+				  &error );
+		}
+		else if( calculation_method == 5 )
+		{
+			result = assorted_crc32_calculate_with_polynomial(
+				  &calculated_crc32,
+				  chunk_data,
+				  read_size,
+				  calculated_crc32,
+				  weak_crc,
+				  polynomial,
+				  &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate CRC-32.\n" );
+
+			goto on_error;
+		}
+		if( block_size != 0 )
+		{
+			block_offset = source_offset + (off_t) ( source_size - remaining_size );
+			block_end    = block_offset + (off_t) read_size;
+
+			for( block_index = 0;
+			     block_offset < block_end;
+			     block_index++ )
+			{
+				fprintf(
+				 stdout,
+				 "block 0x%08" PRIx64 " - 0x%08" PRIx64 ": CRC-32: 0x%08" PRIx32 "\n",
+				 (uint64_t) block_offset,
+				 (uint64_t) ( ( block_end - block_offset ) > (off_t) block_size ? block_offset + (off_t) block_size : block_end ),
+				 block_crc32_values[ block_index ] );
+
+				block_offset += (off_t) block_size;
+			}
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 chunk_data,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
+
+		result = assorted_progress_update(
+		          crc32sum_progress,
+		          (uint64_t) ( source_size - remaining_size ),
+		          0,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to update progress.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( checksum_cache != NULL )
+	 && ( is_cached == 0 ) )
+	{
+		if( assorted_checksum_cache_set_checksum(
+		     checksum_cache,
+		     source,
+		     &checksum_cache_key,
+		     (uint64_t) calculated_crc32,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to store checksum in cache.\n" );
+
+			goto on_error;
+		}
+	}
+	if( checksum_cache != NULL )
+	{
+		if( assorted_checksum_cache_free(
+		     &checksum_cache,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free checksum cache.\n" );
+
+			goto on_error;
+		}
+	}
+	if( memory_map != NULL )
+	{
+		if( assorted_memory_map_free(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free memory map.\n" );
+
+			goto on_error;
+		}
+	}
+	if( async_file != NULL )
+	{
+		if( assorted_async_file_free(
+		     &async_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free asynchronous file.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Clean up
+	 */
+	if( assorted_signal_detach(
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to read from source file.\n" );
+		 "Unable to detach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( assorted_progress_free(
+	     &crc32sum_progress,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free progress.\n" );
 
 		goto on_error;
 	}
-	/* Clean up
-	 */
 	if( libcfile_file_close(
 	     source_file,
 	     &error ) != 0 )
@@ -323,50 +1028,21 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( calculation_method == 1 )
-	{
-		result = assorted_crc32_calculate_modulo2(
-			  &calculated_crc32,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  weak_crc,
-			  &error );
-	}
-	else if( calculation_method == 2 )
+	if( block_crc32_values != NULL )
 	{
-                assorted_crc32_initialize_table(
-                 polynomial );
+		memory_free(
+		 block_crc32_values );
 
-		result = assorted_crc32_calculate(
-			  &calculated_crc32,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  weak_crc,
-			  &error );
+		block_crc32_values = NULL;
 	}
-	if( result != 1 )
+	else
 	{
 		fprintf(
-		 stderr,
-		 "Unable to calculate CRC-32.\n" );
-
-		goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
+		 stdout,
+		 "Calculated CRC-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 calculated_crc32,
+		 calculated_crc32 );
 	}
-	fprintf(
-	 stdout,
-	 "Calculated CRC-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
-	 calculated_crc32,
-	 calculated_crc32 );
-
 	if( validate_crc != 0 )
 	{
 		if( calculated_crc32 != crc32 )
@@ -400,12 +1076,13 @@ int main( int argc, char * const argv[] )
 				 "Single bit-error in bit: %" PRIu8 " of CRC-32\n",
 				 bit_index );
 			}
-			result = assorted_crc32_locate_error_offset(
+			result = assorted_crc32_syndrome_table_locate_error_offset(
 			          crc32,
 			          calculated_crc32,
-			          buffer,
-			          source_size,
-			          initial_value,
+			          (size_t) source_size,
+			          polynomial,
+			          &error_offset,
+			          &error_bit,
 			          &error );
 
 			if( result == -1 )
@@ -416,6 +1093,14 @@ int main( int argc, char * const argv[] )
 
 				goto on_error;
 			}
+			else if( result != 0 )
+			{
+				fprintf(
+				 stdout,
+				 "Single bit-error in bit: %" PRIu8 " of byte at offset: %" PRIi64 "\n",
+				 error_bit,
+				 (int64_t) source_offset + (int64_t) error_offset );
+			}
 		}
 		else
 		{
@@ -441,6 +1126,37 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( crc32sum_progress != NULL )
+	{
+		assorted_signal_detach(
+		 NULL );
+		assorted_progress_free(
+		 &crc32sum_progress,
+		 NULL );
+	}
+	if( checksum_cache != NULL )
+	{
+		assorted_checksum_cache_free(
+		 &checksum_cache,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( async_file != NULL )
+	{
+		assorted_async_file_free(
+		 &async_file,
+		 NULL );
+	}
+	if( block_crc32_values != NULL )
+	{
+		memory_free(
+		 block_crc32_values );
+	}
 	if( buffer != NULL )
 	{
 		memory_free(
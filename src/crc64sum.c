@@ -29,14 +29,22 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_async_file.h"
+#include "assorted_checksum_cache.h"
+#include "assorted_cpu_features.h"
 #include "assorted_crc64.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_memory_map.h"
 #include "assorted_output.h"
 #include "assorted_system_string.h"
 
+/* The size of the chunks the source file is read in
+ */
+#define CRC64SUM_CHUNK_SIZE	( 4 * 1024 * 1024 )
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -46,22 +54,38 @@ void usage_fprint(
 	{
 		return;
 	}
-/* TODO add [ -p polynomial ] support */
 	fprintf( stream, "Use crc64sum to calculate a CRC-64 of file data.\n\n" );
 
-	fprintf( stream, "Usage: crc64sum [ -i initial_value ] [ -o offset ]\n"
-	                 "                [ -s size ] [ -12hvV ] source\n\n" );
+	fprintf( stream, "Usage: crc64sum [ -C cache_file ] [ -i initial_value ] [ -m features_mask ]\n"
+	                 "                [ -o offset ] [ -p polynomial ] [ -s size ] [ -12345AhMvVw ]\n"
+	                 "                source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the table lookup calculation method (default)\n" );
 	fprintf( stream, "\t-2:     method 2\n" );
+	fprintf( stream, "\t-3:     use the ECMA-182 slicing-by-8 calculation method\n" );
+	fprintf( stream, "\t-4:     use the XZ slicing-by-8 calculation method\n" );
+	fprintf( stream, "\t-5:     use the fastest calculation method for the polynomial\n"
+	                 "\t        supported by the CPU, which is carry-less multiplication\n"
+	                 "\t        folding and otherwise slicing-by-8\n" );
+	fprintf( stream, "\t-A:     use asynchronous direct I/O instead of reading the source file\n" );
+	fprintf( stream, "\t-C:     use the checksum cache file, where the checksum of data of\n"
+	                 "\t        an unchanged file is retrieved instead of calculated\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial CRC-64 (default is 0)\n" );
+	fprintf( stream, "\t-m:     mask of the CPU features used by the fastest calculation\n"
+	                 "\t        method, where 0 only uses portable code, intended for\n"
+	                 "\t        benchmarking (default is all supported CPU features)\n" );
+	fprintf( stream, "\t-M:     use memory mapped input instead of reading the source file\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     reversed polynomial used by the fastest calculation\n"
+	                 "\t        method (default is 0xc96c5795d7870f42)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-w:     use weak CRC calculation, without the initial and\n"
+	                 "\t        final XOR with -1, used by the fastest calculation method\n" );
 	fprintf( stream, "\n" );
 }
 
@@ -73,20 +97,36 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "crc64sum";
-	system_integer_t option      = 0;
-	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
-	off_t source_offset          = 0;
-	uint64_t calculated_crc64    = 0;
-	uint64_t initial_value       = 0;
-	int calculation_method       = 1;
-	int result                   = 0;
-	int verbose                  = 0;
+	assorted_checksum_cache_key_t checksum_cache_key;
+
+	assorted_checksum_cache_t *checksum_cache = NULL;
+	libcerror_error_t *error                  = NULL;
+	libcfile_file_t *source_file              = NULL;
+	assorted_async_file_t *async_file         = NULL;
+	assorted_memory_map_t *memory_map         = NULL;
+	system_character_t *cache_filename        = NULL;
+	system_character_t *source                = NULL;
+	const uint8_t *chunk_data                 = NULL;
+	uint8_t *buffer                           = NULL;
+	char *program                             = "crc64sum";
+	system_integer_t option                   = 0;
+	size64_t remaining_size                   = 0;
+	size64_t source_size                      = 0;
+	size_t chunk_data_size                    = 0;
+	size_t read_size                          = 0;
+	ssize_t read_count                        = 0;
+	off_t source_offset                       = 0;
+	uint64_t cached_checksum                  = 0;
+	uint64_t calculated_crc64                 = 0;
+	uint64_t initial_value                    = 0;
+	uint64_t polynomial                       = ASSORTED_CRC64_POLYNOMIAL_XZ;
+	uint8_t weak_crc                          = 0;
+	int calculation_method                    = 1;
+	int is_cached                             = 0;
+	int result                                = 0;
+	int use_asynchronous_io                   = 0;
+	int use_memory_map                        = 0;
+	int verbose                               = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -95,7 +135,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12345AC:hMi:m:o:p:s:vVw" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -121,6 +161,31 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case '3':
+				calculation_method = 3;
+
+				break;
+
+			case '4':
+				calculation_method = 4;
+
+				break;
+
+			case '5':
+				calculation_method = 5;
+
+				break;
+
+			case 'A':
+				use_asynchronous_io = 1;
+
+				break;
+
+			case 'C':
+				cache_filename = optarg;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -132,11 +197,27 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'm':
+				assorted_cpu_features_set_mask(
+				 (uint32_t) system_string_copy_to_64bit( optarg ) );
+
+				break;
+
+			case 'M':
+				use_memory_map = 1;
+
+				break;
+
 			case 'o':
 				source_offset = system_string_copy_to_long( optarg );
 
 				break;
 
+			case 'p':
+				polynomial = system_string_copy_to_64bit( optarg );
+
+				break;
+
 			case 's':
 				source_size = system_string_copy_to_long( optarg );
 
@@ -152,6 +233,11 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case 'w':
+				weak_crc = 1;
+
+				break;
 		}
 	}
 	if( optind == argc )
@@ -228,24 +314,156 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
+	if( cache_filename != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		if( assorted_checksum_cache_initialize(
+		     &checksum_cache,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create checksum cache.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = assorted_checksum_cache_open(
+		          checksum_cache,
+		          cache_filename,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open checksum cache.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Checksum cache not supported, calculating CRC-64 instead.\n" );
+
+			if( assorted_checksum_cache_free(
+			     &checksum_cache,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free checksum cache.\n" );
+
+				goto on_error;
+			}
+		}
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
+	if( use_memory_map != 0 )
+	{
+		if( assorted_memory_map_initialize(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create memory map.\n" );
+
+			goto on_error;
+		}
+		result = assorted_memory_map_open(
+		          memory_map,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to memory map source file.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Memory mapped input not supported, reading source file instead.\n" );
 
-	if( buffer == NULL )
+			if( assorted_memory_map_free(
+			     &memory_map,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free memory map.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( use_asynchronous_io != 0 )
+	 && ( memory_map == NULL ) )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		if( assorted_async_file_initialize(
+		     &async_file,
+		     CRC64SUM_CHUNK_SIZE,
+		     ASSORTED_ASYNC_FILE_DEFAULT_QUEUE_DEPTH,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create asynchronous file.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = assorted_async_file_open(
+		          async_file,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file for asynchronous I/O.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Asynchronous I/O not supported, reading source file instead.\n" );
+
+			if( assorted_async_file_free(
+			     &async_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free asynchronous file.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( memory_map == NULL )
+	 && ( async_file == NULL ) )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * CRC64SUM_CHUNK_SIZE );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Position the source file at the right offset
 	 */
@@ -261,19 +479,232 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	/* The data is read in chunks, where the CRC-64 of the preceding chunks
+	 * is used as the initial value of the next chunk
+	 */
+	calculated_crc64 = initial_value;
+	remaining_size   = source_size;
 
-	if( read_count != (ssize_t) source_size )
+	if( checksum_cache != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		if( memory_set(
+		     &checksum_cache_key,
+		     0,
+		     sizeof( assorted_checksum_cache_key_t ) ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to clear checksum cache key.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		checksum_cache_key.offset        = (uint64_t) source_offset;
+		checksum_cache_key.size          = (uint64_t) source_size;
+		checksum_cache_key.initial_value = (uint64_t) initial_value;
+		checksum_cache_key.parameters    = polynomial;
+		checksum_cache_key.method        = ASSORTED_CHECKSUM_CACHE_METHOD_CRC64;
+		/* The calculation methods do not all produce the same CRC, hence
+		 * the calculation method is part of the key
+		 */
+		checksum_cache_key.flags         = ( (uint32_t) calculation_method << 8 ) | (uint32_t) weak_crc;
+
+		result = assorted_checksum_cache_get_checksum(
+		          checksum_cache,
+		          source,
+		          &checksum_cache_key,
+		          &cached_checksum,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve checksum from cache.\n" );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			calculated_crc64 = cached_checksum;
+			remaining_size = 0;
+			is_cached      = 1;
+
+			if( verbose != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Retrieved CRC-64 from checksum cache.\n" );
+			}
+		}
+	}
+
+	while( remaining_size > 0 )
+	{
+		read_size = CRC64SUM_CHUNK_SIZE;
+
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		if( memory_map != NULL )
+		{
+			chunk_data = &( memory_map->data[ source_size - remaining_size ] );
+		}
+		else if( async_file != NULL )
+		{
+			result = assorted_async_file_read_next(
+			          async_file,
+			          &chunk_data,
+			          &chunk_data_size,
+			          &error );
+
+			if( ( result != 1 )
+			 || ( chunk_data_size != read_size ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      buffer,
+				      read_size,
+				      &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			chunk_data = buffer;
+		}
+		if( calculation_method == 1 )
+		{
+			result = assorted_crc64_calculate_1(
+				  &calculated_crc64,
+				  chunk_data,
+				  read_size,
+				  calculated_crc64,
+				  &error );
+		}
+		else if( calculation_method == 2 )
+		{
+			result = assorted_crc64_calculate_2(
+				  &calculated_crc64,
+				  chunk_data,
+				  read_size,
+				  calculated_crc64,
+				  &error );
+		}
+		else if( calculation_method == 3 )
+		{
+			result = assorted_crc64_calculate_ecma182_slicing_by_8(
+				  &calculated_crc64,
+				  chunk_data,
+				  read_size,
+				  calculated_crc64,
+				  &error );
+		}
+		else if( calculation_method == 4 )
+		{
+			result = assorted_crc64_calculate_xz_slicing_by_8(
+				  &calculated_crc64,
+				  chunk_data,
+				  read_size,
+				  calculated_crc64,
+				  &error );
+		}
+		else if( calculation_method == 5 )
+		{
+			result = assorted_crc64_calculate_with_polynomial(
+				  &calculated_crc64,
+				  chunk_data,
+				  read_size,
+				  calculated_crc64,
+				  weak_crc,
+				  polynomial,
+				  &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate CRC-64.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 chunk_data,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
+	}
+	if( ( checksum_cache != NULL )
+	 && ( is_cached == 0 ) )
+	{
+		if( assorted_checksum_cache_set_checksum(
+		     checksum_cache,
+		     source,
+		     &checksum_cache_key,
+		     (uint64_t) calculated_crc64,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to store checksum in cache.\n" );
+
+			goto on_error;
+		}
+	}
+	if( checksum_cache != NULL )
+	{
+		if( assorted_checksum_cache_free(
+		     &checksum_cache,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free checksum cache.\n" );
+
+			goto on_error;
+		}
+	}
+	if( memory_map != NULL )
+	{
+		if( assorted_memory_map_free(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free memory map.\n" );
+
+			goto on_error;
+		}
+	}
+	if( async_file != NULL )
+	{
+		if( assorted_async_file_free(
+		     &async_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free asynchronous file.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
@@ -297,39 +728,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( calculation_method == 1 )
-	{
-		result = assorted_crc64_calculate_1(
-			  &calculated_crc64,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  &error );
-	}
-	else if( calculation_method == 2 )
-	{
-		result = assorted_crc64_calculate_2(
-			  &calculated_crc64,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  &error );
-	}
-	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate CRC-64.\n" );
-
-		goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
 	fprintf(
 	 stdout,
 	 "Calculated CRC-64: %" PRIu64 " (0x%08" PRIx64 ")\n",
@@ -349,6 +747,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( checksum_cache != NULL )
+	{
+		assorted_checksum_cache_free(
+		 &checksum_cache,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( async_file != NULL )
+	{
+		assorted_async_file_free(
+		 &async_file,
+		 NULL );
+	}
 	if( buffer != NULL )
 	{
 		memory_free(
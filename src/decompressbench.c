@@ -0,0 +1,1566 @@
+/*
+ * Benchmarks the DEFLATE, BZIP2 and LZMA decoders against the external libraries
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+#include <bzlib.h>
+#endif
+
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+#include <lzma.h>
+#endif
+
+#include "assorted_arena.h"
+#include "assorted_bzip.h"
+#include "assorted_deflate.h"
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_lzma.h"
+#include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "assorted_timer.h"
+
+/* The size of the header that stores the size of a counted allocation,
+ * which retains the alignment of the allocation
+ */
+#define DECOMPRESSBENCH_ALLOCATION_HEADER_SIZE	16
+
+enum DECOMPRESSBENCH_CODECS
+{
+	DECOMPRESSBENCH_CODEC_DEFLATE	= 0,
+	DECOMPRESSBENCH_CODEC_BZIP2	= 1,
+	DECOMPRESSBENCH_CODEC_LZMA	= 2,
+	DECOMPRESSBENCH_NUMBER_OF_CODECS
+};
+
+enum DECOMPRESSBENCH_IMPLEMENTATIONS
+{
+	DECOMPRESSBENCH_IMPLEMENTATION_EXTERNAL	= 0,
+	DECOMPRESSBENCH_IMPLEMENTATION_INTERNAL	= 1
+};
+
+/* The names of the codecs
+ */
+static const char *decompressbench_codec_names[ DECOMPRESSBENCH_NUMBER_OF_CODECS ] = {
+	"deflate",
+	"bzip2",
+	"lzma" };
+
+/* The allocations made by the external libraries
+ */
+static uint64_t decompressbench_number_of_allocations = 0;
+static size_t decompressbench_allocated_size          = 0;
+static size_t decompressbench_maximum_allocated_size  = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use decompressbench to benchmark the DEFLATE, BZIP2 and LZMA decoders\n"
+	                 "against zlib, bzlib and liblzma.\n\n" );
+
+	fprintf( stream, "Usage: decompressbench [ -c codec ] [ -t minimum_time ] [ -hvV ]\n"
+	                 "                       source [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: a source file, zlib, bzip2 and xz compressed files are\n"
+	                 "\t        benchmarked as-is, other files are compressed with\n"
+	                 "\t        every external library first\n\n" );
+
+	fprintf( stream, "\t-c:     only benchmark a specific codec, options: bzip2,\n"
+	                 "\t        deflate, lzma (default is all codecs)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-t:     minimum time of a measurement in milliseconds\n"
+	                 "\t        (default is 200)\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+	fprintf( stream, "The results are written to stdout as comma separated values with\n"
+	                 "the columns: file, codec, implementation, compressed size,\n"
+	                 "uncompressed size, iterations, seconds, MB/s, peak RSS in KiB,\n"
+	                 "number of allocations and peak allocated bytes of a single run and\n"
+	                 "if the output is identical to the reference data.\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Allocates memory and maintains the allocation statistics
+ * Returns a pointer to the memory or NULL on error
+ */
+static void *decompressbench_allocate(
+              size_t size )
+{
+	uint8_t *block = NULL;
+
+	if( size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - DECOMPRESSBENCH_ALLOCATION_HEADER_SIZE ) )
+	{
+		return( NULL );
+	}
+	block = (uint8_t *) memory_allocate(
+	                     size + DECOMPRESSBENCH_ALLOCATION_HEADER_SIZE );
+
+	if( block == NULL )
+	{
+		return( NULL );
+	}
+	*( (size_t *) block ) = size;
+
+	decompressbench_number_of_allocations += 1;
+	decompressbench_allocated_size        += size;
+
+	if( decompressbench_allocated_size > decompressbench_maximum_allocated_size )
+	{
+		decompressbench_maximum_allocated_size = decompressbench_allocated_size;
+	}
+	return( &( block[ DECOMPRESSBENCH_ALLOCATION_HEADER_SIZE ] ) );
+}
+
+/* Frees memory allocated by decompressbench_allocate
+ */
+static void decompressbench_free(
+             void *memory )
+{
+	uint8_t *block = NULL;
+
+	if( memory == NULL )
+	{
+		return;
+	}
+	block = &( ( (uint8_t *) memory )[ -DECOMPRESSBENCH_ALLOCATION_HEADER_SIZE ] );
+
+	decompressbench_allocated_size -= *( (size_t *) block );
+
+	memory_free(
+	 block );
+}
+
+/* Resets the allocation statistics
+ */
+static void decompressbench_reset_allocation_statistics(
+             void )
+{
+	decompressbench_number_of_allocations  = 0;
+	decompressbench_allocated_size         = 0;
+	decompressbench_maximum_allocated_size = 0;
+}
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+
+/* Allocates memory for zlib
+ */
+static voidpf decompressbench_zlib_allocate(
+               voidpf opaque,
+               uInt number_of_items,
+               uInt item_size )
+{
+	if( ( item_size != 0 )
+	 && ( number_of_items > ( (size_t) SSIZE_MAX / item_size ) ) )
+	{
+		return( Z_NULL );
+	}
+	return( (voidpf) decompressbench_allocate(
+	                  (size_t) number_of_items * item_size ) );
+}
+
+/* Frees memory for zlib
+ */
+static void decompressbench_zlib_free(
+             voidpf opaque,
+             voidpf memory )
+{
+	decompressbench_free(
+	 memory );
+}
+
+#endif /* defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) */
+
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+
+/* Allocates memory for bzlib
+ */
+static void *decompressbench_bzip2_allocate(
+              void *opaque,
+              int number_of_items,
+              int item_size )
+{
+	if( ( number_of_items < 0 )
+	 || ( item_size < 0 ) )
+	{
+		return( NULL );
+	}
+	return( decompressbench_allocate(
+	         (size_t) number_of_items * (size_t) item_size ) );
+}
+
+/* Frees memory for bzlib
+ */
+static void decompressbench_bzip2_free(
+             void *opaque,
+             void *memory )
+{
+	decompressbench_free(
+	 memory );
+}
+
+#endif /* defined( HAVE_BZLIB ) || defined( BZ_DLL ) */
+
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+
+/* Allocates memory for liblzma
+ */
+static void *decompressbench_lzma_allocate(
+              void *opaque,
+              size_t number_of_items,
+              size_t item_size )
+{
+	if( ( item_size != 0 )
+	 && ( number_of_items > ( (size_t) SSIZE_MAX / item_size ) ) )
+	{
+		return( NULL );
+	}
+	return( decompressbench_allocate(
+	         number_of_items * item_size ) );
+}
+
+/* Frees memory for liblzma
+ */
+static void decompressbench_lzma_free(
+             void *opaque,
+             void *memory )
+{
+	decompressbench_free(
+	 memory );
+}
+
+#endif /* defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL ) */
+
+/* Resets the peak resident set size of the process
+ * This is only supported on Linux, elsewhere the peak resident set size of
+ * the lifetime of the process is reported
+ */
+static void decompressbench_reset_peak_resident_set_size(
+             void )
+{
+#if defined( __linux__ )
+	FILE *stream = NULL;
+
+	stream = file_stream_open(
+	          "/proc/self/clear_refs",
+	          FILE_STREAM_OPEN_WRITE );
+
+	if( stream != NULL )
+	{
+		file_stream_write(
+		 stream,
+		 "5",
+		 1 );
+
+		file_stream_close(
+		 stream );
+	}
+#endif
+}
+
+/* Retrieves the peak resident set size of the process in KiB
+ * Returns 0 if not available
+ */
+static uint64_t decompressbench_get_peak_resident_set_size(
+                 void )
+{
+	uint64_t peak_resident_set_size = 0;
+
+#if defined( __linux__ )
+	char line[ 128 ];
+
+	FILE *stream = NULL;
+
+	stream = file_stream_open(
+	          "/proc/self/status",
+	          FILE_STREAM_OPEN_READ );
+
+	if( stream != NULL )
+	{
+		while( file_stream_get_string(
+		        stream,
+		        line,
+		        128 ) != NULL )
+		{
+			if( narrow_string_compare(
+			     line,
+			     "VmHWM:",
+			     6 ) == 0 )
+			{
+				peak_resident_set_size = (uint64_t) strtoull(
+				                                     &( line[ 6 ] ),
+				                                     NULL,
+				                                     10 );
+
+				break;
+			}
+		}
+		file_stream_close(
+		 stream );
+	}
+#elif defined( HAVE_GETRUSAGE ) && defined( HAVE_SYS_RESOURCE_H )
+	struct rusage resource_usage;
+
+	if( getrusage(
+	     RUSAGE_SELF,
+	     &resource_usage ) == 0 )
+	{
+#if defined( __APPLE__ )
+		/* On Mac OS X the value is in bytes
+		 */
+		peak_resident_set_size = (uint64_t) resource_usage.ru_maxrss / 1024;
+#else
+		peak_resident_set_size = (uint64_t) resource_usage.ru_maxrss;
+#endif
+	}
+#endif
+	return( peak_resident_set_size );
+}
+
+/* Determines the codec of compressed data
+ * Returns 1 if the data is compressed, 0 if not
+ */
+static int decompressbench_get_codec(
+            const uint8_t *data,
+            size_t data_size,
+            int *codec )
+{
+	if( data_size >= 6 )
+	{
+		if( ( data[ 0 ] == 0xfd )
+		 && ( data[ 1 ] == '7' )
+		 && ( data[ 2 ] == 'z' )
+		 && ( data[ 3 ] == 'X' )
+		 && ( data[ 4 ] == 'Z' )
+		 && ( data[ 5 ] == 0x00 ) )
+		{
+			*codec = DECOMPRESSBENCH_CODEC_LZMA;
+
+			return( 1 );
+		}
+	}
+	if( data_size >= 4 )
+	{
+		if( ( data[ 0 ] == 'B' )
+		 && ( data[ 1 ] == 'Z' )
+		 && ( data[ 2 ] == 'h' )
+		 && ( data[ 3 ] >= '1' )
+		 && ( data[ 3 ] <= '9' ) )
+		{
+			*codec = DECOMPRESSBENCH_CODEC_BZIP2;
+
+			return( 1 );
+		}
+	}
+	if( data_size >= 2 )
+	{
+		/* A zlib header consists of the DEFLATE compression method with
+		 * a window size of at most 32 KiB and a check value
+		 */
+		if( ( ( data[ 0 ] & 0x0f ) == 8 )
+		 && ( ( data[ 0 ] >> 4 ) <= 7 )
+		 && ( ( ( ( (uint16_t) data[ 0 ] << 8 ) | data[ 1 ] ) % 31 ) == 0 )
+		 && ( ( data[ 1 ] & 0x20 ) == 0 ) )
+		{
+			*codec = DECOMPRESSBENCH_CODEC_DEFLATE;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if the external library of a codec is available
+ * Returns 1 if available or 0 if not
+ */
+static int decompressbench_have_external_library(
+            int codec )
+{
+	switch( codec )
+	{
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+		case DECOMPRESSBENCH_CODEC_DEFLATE:
+			return( 1 );
+#endif
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+		case DECOMPRESSBENCH_CODEC_BZIP2:
+			return( 1 );
+#endif
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+		case DECOMPRESSBENCH_CODEC_LZMA:
+			return( 1 );
+#endif
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Compresses data using the external library of a codec
+ * Returns 1 if successful or -1 on error
+ */
+static int decompressbench_compress_external(
+            int codec,
+            const uint8_t *uncompressed_data,
+            size_t uncompressed_data_size,
+            uint8_t **compressed_data,
+            size_t *compressed_data_size,
+            libcerror_error_t **error )
+{
+	uint8_t *safe_compressed_data      = NULL;
+	static char *function              = "decompressbench_compress_external";
+	size_t safe_compressed_data_size   = 0;
+	int result                         = 0;
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+	uLongf zlib_compressed_data_size   = 0;
+#endif
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+	unsigned int bzip2_compressed_size = 0;
+#endif
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+	size_t lzma_compressed_data_offset = 0;
+#endif
+
+	if( uncompressed_data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bound of BZIP2 is used for every codec since it is the largest
+	 */
+	safe_compressed_data_size = uncompressed_data_size + ( uncompressed_data_size / 100 ) + 65536;
+
+	safe_compressed_data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * safe_compressed_data_size );
+
+	if( safe_compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	switch( codec )
+	{
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+		case DECOMPRESSBENCH_CODEC_DEFLATE:
+			zlib_compressed_data_size = (uLongf) safe_compressed_data_size;
+
+			if( compress2(
+			     (Bytef *) safe_compressed_data,
+			     &zlib_compressed_data_size,
+			     (Bytef *) uncompressed_data,
+			     (uLong) uncompressed_data_size,
+			     Z_DEFAULT_COMPRESSION ) == Z_OK )
+			{
+				safe_compressed_data_size = (size_t) zlib_compressed_data_size;
+
+				result = 1;
+			}
+			break;
+#endif
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+		case DECOMPRESSBENCH_CODEC_BZIP2:
+			bzip2_compressed_size = (unsigned int) safe_compressed_data_size;
+
+			if( BZ2_bzBuffToBuffCompress(
+			     (char *) safe_compressed_data,
+			     &bzip2_compressed_size,
+			     (char *) uncompressed_data,
+			     (unsigned int) uncompressed_data_size,
+			     9,
+			     0,
+			     0 ) == BZ_OK )
+			{
+				safe_compressed_data_size = (size_t) bzip2_compressed_size;
+
+				result = 1;
+			}
+			break;
+#endif
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+		case DECOMPRESSBENCH_CODEC_LZMA:
+			if( lzma_easy_buffer_encode(
+			     LZMA_PRESET_DEFAULT,
+			     LZMA_CHECK_CRC64,
+			     NULL,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     safe_compressed_data,
+			     &lzma_compressed_data_offset,
+			     safe_compressed_data_size ) == LZMA_OK )
+			{
+				safe_compressed_data_size = lzma_compressed_data_offset;
+
+				result = 1;
+			}
+			break;
+#endif
+		default:
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		memory_free(
+		 safe_compressed_data );
+
+		return( -1 );
+	}
+	*compressed_data      = safe_compressed_data;
+	*compressed_data_size = safe_compressed_data_size;
+
+	return( 1 );
+}
+
+/* Decompresses data using the external library of a codec
+ * Returns 1 if successful, 0 if the uncompressed data is too small or -1 on error
+ */
+static int decompressbench_decompress_external(
+            int codec,
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function              = "decompressbench_decompress_external";
+	int result                         = -1;
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+	z_stream zlib_stream;
+
+	int zlib_result                    = 0;
+#endif
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+	bz_stream bzip2_stream;
+
+	int bzip2_result                   = 0;
+#endif
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+	lzma_allocator lzma_allocator      = { &decompressbench_lzma_allocate, &decompressbench_lzma_free, NULL };
+	lzma_ret lzma_result               = LZMA_OK;
+	uint64_t lzma_memory_limit         = UINT64_MAX;
+	size_t lzma_compressed_data_offset = 0;
+	size_t lzma_uncompressed_size      = 0;
+#endif
+
+	if( ( compressed_data_size > (size_t) UINT32_MAX )
+	 || ( *uncompressed_data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed or uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( codec )
+	{
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+		case DECOMPRESSBENCH_CODEC_DEFLATE:
+			memory_set(
+			 &zlib_stream,
+			 0,
+			 sizeof( z_stream ) );
+
+			zlib_stream.zalloc    = &decompressbench_zlib_allocate;
+			zlib_stream.zfree     = &decompressbench_zlib_free;
+			zlib_stream.next_in   = (Bytef *) compressed_data;
+			zlib_stream.avail_in  = (uInt) compressed_data_size;
+			zlib_stream.next_out  = (Bytef *) uncompressed_data;
+			zlib_stream.avail_out = (uInt) *uncompressed_data_size;
+
+			if( inflateInit(
+			     &zlib_stream ) != Z_OK )
+			{
+				break;
+			}
+			zlib_result = inflate(
+			               &zlib_stream,
+			               Z_FINISH );
+
+			inflateEnd(
+			 &zlib_stream );
+
+			if( zlib_result == Z_STREAM_END )
+			{
+				*uncompressed_data_size = (size_t) zlib_stream.total_out;
+
+				result = 1;
+			}
+			else if( ( ( zlib_result == Z_OK )
+			        || ( zlib_result == Z_BUF_ERROR ) )
+			      && ( zlib_stream.avail_out == 0 ) )
+			{
+				result = 0;
+			}
+			break;
+#endif
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+		case DECOMPRESSBENCH_CODEC_BZIP2:
+			memory_set(
+			 &bzip2_stream,
+			 0,
+			 sizeof( bz_stream ) );
+
+			bzip2_stream.bzalloc   = &decompressbench_bzip2_allocate;
+			bzip2_stream.bzfree    = &decompressbench_bzip2_free;
+			bzip2_stream.next_in   = (char *) compressed_data;
+			bzip2_stream.avail_in  = (unsigned int) compressed_data_size;
+			bzip2_stream.next_out  = (char *) uncompressed_data;
+			bzip2_stream.avail_out = (unsigned int) *uncompressed_data_size;
+
+			if( BZ2_bzDecompressInit(
+			     &bzip2_stream,
+			     0,
+			     0 ) != BZ_OK )
+			{
+				break;
+			}
+			bzip2_result = BZ2_bzDecompress(
+			                &bzip2_stream );
+
+			BZ2_bzDecompressEnd(
+			 &bzip2_stream );
+
+			if( bzip2_result == BZ_STREAM_END )
+			{
+				*uncompressed_data_size = (size_t) bzip2_stream.total_out_lo32;
+
+				result = 1;
+			}
+			else if( ( bzip2_result == BZ_OK )
+			      && ( bzip2_stream.avail_out == 0 ) )
+			{
+				result = 0;
+			}
+			break;
+#endif
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+		case DECOMPRESSBENCH_CODEC_LZMA:
+			lzma_result = lzma_stream_buffer_decode(
+			               &lzma_memory_limit,
+			               0,
+			               &lzma_allocator,
+			               compressed_data,
+			               &lzma_compressed_data_offset,
+			               compressed_data_size,
+			               uncompressed_data,
+			               &lzma_uncompressed_size,
+			               *uncompressed_data_size );
+
+			if( lzma_result == LZMA_OK )
+			{
+				*uncompressed_data_size = lzma_uncompressed_size;
+
+				result = 1;
+			}
+			else if( lzma_result == LZMA_BUF_ERROR )
+			{
+				result = 0;
+			}
+			break;
+#endif
+		default:
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+	}
+	return( result );
+}
+
+/* Decompresses data using the external library of a codec into a buffer
+ * that is grown until the uncompressed data fits
+ * Returns 1 if successful or -1 on error
+ */
+static int decompressbench_decompress_reference(
+            int codec,
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	uint8_t *safe_uncompressed_data    = NULL;
+	static char *function              = "decompressbench_decompress_reference";
+	size_t maximum_uncompressed_size   = 0;
+	size_t safe_uncompressed_data_size = 0;
+	int result                         = 0;
+
+	maximum_uncompressed_size = ( compressed_data_size * 4 ) + 65536;
+
+	while( maximum_uncompressed_size <= (size_t) UINT32_MAX )
+	{
+		safe_uncompressed_data = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * maximum_uncompressed_size );
+
+		if( safe_uncompressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		safe_uncompressed_data_size = maximum_uncompressed_size;
+
+		result = decompressbench_decompress_external(
+		          codec,
+		          compressed_data,
+		          compressed_data_size,
+		          safe_uncompressed_data,
+		          &safe_uncompressed_data_size,
+		          error );
+
+		if( result == 1 )
+		{
+			*uncompressed_data      = safe_uncompressed_data;
+			*uncompressed_data_size = safe_uncompressed_data_size;
+
+			return( 1 );
+		}
+		memory_free(
+		 safe_uncompressed_data );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		maximum_uncompressed_size *= 2;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+	 "%s: invalid uncompressed data size value exceeds maximum.",
+	 function );
+
+	return( -1 );
+}
+
+/* Benchmarks one implementation of a codec
+ * Writes a line of comma separated values to stdout
+ * Returns 1 if the output is identical to the reference data, 0 if not or -1 on error
+ */
+static int decompressbench_benchmark(
+            const system_character_t *filename,
+            int codec,
+            int implementation,
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            const uint8_t *reference_data,
+            size_t reference_data_size,
+            uint64_t minimum_time,
+            libcerror_error_t **error )
+{
+	assorted_bzip_context_t *bzip_context       = NULL;
+	assorted_deflate_context_t *deflate_context = NULL;
+	assorted_lzma_context_t *lzma_context       = NULL;
+	uint8_t *uncompressed_data                  = NULL;
+	static char *function                       = "decompressbench_benchmark";
+	size_t uncompressed_data_size               = 0;
+	uint64_t elapsed_time                       = 0;
+	uint64_t number_of_allocations              = 0;
+	uint64_t number_of_runs                     = 0;
+	uint64_t peak_resident_set_size             = 0;
+	uint64_t run_index                          = 0;
+	uint64_t start_time                         = 0;
+	size_t maximum_allocated_size               = 0;
+	double megabytes_per_second                 = 0.0;
+	int is_identical                            = 0;
+	int result                                  = 0;
+
+	/* The uncompressed data is allocated upfront so that it is part of
+	 * the peak resident set size of both implementations
+	 */
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ( reference_data_size + 1 ) );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_set(
+	 uncompressed_data,
+	 0,
+	 reference_data_size + 1 );
+
+	if( implementation == DECOMPRESSBENCH_IMPLEMENTATION_INTERNAL )
+	{
+		switch( codec )
+		{
+			case DECOMPRESSBENCH_CODEC_DEFLATE:
+				result = assorted_deflate_context_initialize(
+				          &deflate_context,
+				          error );
+				break;
+
+			case DECOMPRESSBENCH_CODEC_BZIP2:
+				result = assorted_bzip_context_initialize(
+				          &bzip_context,
+				          error );
+				break;
+
+			case DECOMPRESSBENCH_CODEC_LZMA:
+				result = assorted_lzma_context_initialize(
+				          &lzma_context,
+				          error );
+				break;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	decompressbench_reset_peak_resident_set_size();
+	decompressbench_reset_allocation_statistics();
+
+	/* The first run is used to determine if the output is identical and
+	 * the allocations of a single run
+	 */
+	number_of_runs = 1;
+
+	while( number_of_runs != 0 )
+	{
+		start_time = assorted_timer_get_time();
+
+		for( run_index = 0;
+		     run_index < number_of_runs;
+		     run_index++ )
+		{
+			uncompressed_data_size = reference_data_size + 1;
+
+			if( implementation == DECOMPRESSBENCH_IMPLEMENTATION_EXTERNAL )
+			{
+				result = decompressbench_decompress_external(
+				          codec,
+				          compressed_data,
+				          compressed_data_size,
+				          uncompressed_data,
+				          &uncompressed_data_size,
+				          error );
+			}
+			else if( codec == DECOMPRESSBENCH_CODEC_DEFLATE )
+			{
+				result = assorted_deflate_context_decompress_zlib(
+				          deflate_context,
+				          compressed_data,
+				          compressed_data_size,
+				          uncompressed_data,
+				          &uncompressed_data_size,
+				          error );
+			}
+			else if( codec == DECOMPRESSBENCH_CODEC_BZIP2 )
+			{
+				result = assorted_bzip_context_decompress(
+				          bzip_context,
+				          compressed_data,
+				          compressed_data_size,
+				          uncompressed_data,
+				          &uncompressed_data_size,
+				          error );
+			}
+			else
+			{
+				result = assorted_lzma_context_decompress(
+				          lzma_context,
+				          compressed_data,
+				          compressed_data_size,
+				          uncompressed_data,
+				          &uncompressed_data_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		elapsed_time = assorted_timer_get_time() - start_time;
+
+		if( elapsed_time == 0 )
+		{
+			elapsed_time = 1;
+		}
+		if( number_of_runs == 1 )
+		{
+			is_identical = 0;
+
+			if( ( uncompressed_data_size == reference_data_size )
+			 && ( memory_compare(
+			       uncompressed_data,
+			       reference_data,
+			       reference_data_size ) == 0 ) )
+			{
+				is_identical = 1;
+			}
+			/* The scratch memory of the internal decoders is allocated
+			 * from the arena of the context
+			 */
+			if( implementation == DECOMPRESSBENCH_IMPLEMENTATION_EXTERNAL )
+			{
+				number_of_allocations  = decompressbench_number_of_allocations;
+				maximum_allocated_size = decompressbench_maximum_allocated_size;
+			}
+			else if( deflate_context != NULL )
+			{
+				number_of_allocations  = (uint64_t) deflate_context->arena->number_of_overflow_blocks;
+				maximum_allocated_size = deflate_context->arena->overflow_size;
+			}
+			else if( bzip_context != NULL )
+			{
+				number_of_allocations  = (uint64_t) bzip_context->arena->number_of_overflow_blocks;
+				maximum_allocated_size = bzip_context->arena->overflow_size;
+			}
+			else if( lzma_context != NULL )
+			{
+				number_of_allocations  = (uint64_t) lzma_context->arena->number_of_overflow_blocks;
+				maximum_allocated_size = lzma_context->arena->overflow_size;
+			}
+		}
+		if( elapsed_time >= minimum_time )
+		{
+			break;
+		}
+		number_of_runs *= 2;
+	}
+	peak_resident_set_size = decompressbench_get_peak_resident_set_size();
+
+	megabytes_per_second = ( (double) reference_data_size * (double) number_of_runs * 1000.0 ) / (double) elapsed_time;
+
+	fprintf(
+	 stdout,
+	 "%" PRIs_SYSTEM ",%s,%s,%" PRIzd ",%" PRIzd ",%" PRIu64 ",%.6f,%.3f,%" PRIu64 ",%" PRIu64 ",%" PRIzd ",%s\n",
+	 filename,
+	 decompressbench_codec_names[ codec ],
+	 ( implementation == DECOMPRESSBENCH_IMPLEMENTATION_EXTERNAL ) ? "external" : "internal",
+	 (ssize_t) compressed_data_size,
+	 (ssize_t) reference_data_size,
+	 number_of_runs,
+	 (double) elapsed_time / 1000000000.0,
+	 megabytes_per_second,
+	 peak_resident_set_size,
+	 number_of_allocations,
+	 (ssize_t) maximum_allocated_size,
+	 ( is_identical != 0 ) ? "yes" : "no" );
+
+	if( deflate_context != NULL )
+	{
+		if( assorted_deflate_context_free(
+		     &deflate_context,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( bzip_context != NULL )
+	{
+		if( assorted_bzip_context_free(
+		     &bzip_context,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( lzma_context != NULL )
+	{
+		if( assorted_lzma_context_free(
+		     &lzma_context,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	memory_free(
+	 uncompressed_data );
+
+	return( is_identical );
+
+on_error:
+	if( lzma_context != NULL )
+	{
+		assorted_lzma_context_free(
+		 &lzma_context,
+		 NULL );
+	}
+	if( bzip_context != NULL )
+	{
+		assorted_bzip_context_free(
+		 &bzip_context,
+		 NULL );
+	}
+	if( deflate_context != NULL )
+	{
+		assorted_deflate_context_free(
+		 &deflate_context,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Reads the data of a file
+ * Returns 1 if successful or -1 on error
+ */
+static int decompressbench_read_file(
+            const system_character_t *filename,
+            uint8_t **data,
+            size_t *data_size,
+            libcerror_error_t **error )
+{
+	libcfile_file_t *file = NULL;
+	uint8_t *safe_data    = NULL;
+	static char *function = "decompressbench_read_file";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_get_size(
+	     file,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * (size_t) file_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              file,
+	              safe_data,
+	              (size_t) file_size,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	*data      = safe_data;
+	*data_size = (size_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error              = NULL;
+	system_character_t *option_codec      = NULL;
+	uint8_t *compressed_data              = NULL;
+	uint8_t *file_data                    = NULL;
+	uint8_t *reference_data               = NULL;
+	char *program                         = "decompressbench";
+	system_integer_t option               = 0;
+	size_t compressed_data_size           = 0;
+	size_t file_data_size                 = 0;
+	size_t reference_data_size            = 0;
+	uint64_t minimum_time                 = 200;
+	int codec                             = 0;
+	int file_codec                        = 0;
+	int implementation                    = 0;
+	int is_compressed                     = 0;
+	int number_of_differences             = 0;
+	int result                            = 0;
+	int selected_codec                    = -1;
+	int source_index                      = 0;
+	int verbose                           = 0;
+
+	/* The version is printed to stderr to keep stdout machine-readable
+	 */
+	assorted_output_version_fprint(
+	 stderr,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:ht:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'c':
+				option_codec = optarg;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 't':
+				minimum_time = system_string_copy_to_64bit(
+				                optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_codec != NULL )
+	{
+		if( system_string_compare(
+		     option_codec,
+		     _SYSTEM_STRING( "deflate" ),
+		     8 ) == 0 )
+		{
+			selected_codec = DECOMPRESSBENCH_CODEC_DEFLATE;
+		}
+		else if( system_string_compare(
+		          option_codec,
+		          _SYSTEM_STRING( "bzip2" ),
+		          6 ) == 0 )
+		{
+			selected_codec = DECOMPRESSBENCH_CODEC_BZIP2;
+		}
+		else if( system_string_compare(
+		          option_codec,
+		          _SYSTEM_STRING( "lzma" ),
+		          5 ) == 0 )
+		{
+			selected_codec = DECOMPRESSBENCH_CODEC_LZMA;
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported codec: %" PRIs_SYSTEM "\n",
+			 option_codec );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	fprintf(
+	 stdout,
+	 "file,codec,implementation,compressed_size,uncompressed_size,iterations,seconds,megabytes_per_second,peak_rss_kib,allocations,allocated_bytes,identical\n" );
+
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( decompressbench_read_file(
+		     argv[ source_index ],
+		     &file_data,
+		     &file_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read source file: %" PRIs_SYSTEM ".\n",
+			 argv[ source_index ] );
+
+			goto on_error;
+		}
+		is_compressed = decompressbench_get_codec(
+		                 file_data,
+		                 file_data_size,
+		                 &file_codec );
+
+		for( codec = 0;
+		     codec < DECOMPRESSBENCH_NUMBER_OF_CODECS;
+		     codec++ )
+		{
+			if( ( selected_codec != -1 )
+			 && ( codec != selected_codec ) )
+			{
+				continue;
+			}
+			if( ( is_compressed != 0 )
+			 && ( codec != file_codec ) )
+			{
+				continue;
+			}
+			/* The external library provides the reference data
+			 */
+			if( decompressbench_have_external_library(
+			     codec ) == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Skipping %s of source file: %" PRIs_SYSTEM " since the external library is not available.\n",
+				 decompressbench_codec_names[ codec ],
+				 argv[ source_index ] );
+
+				continue;
+			}
+			if( is_compressed != 0 )
+			{
+				compressed_data      = file_data;
+				compressed_data_size = file_data_size;
+
+				result = decompressbench_decompress_reference(
+				          codec,
+				          compressed_data,
+				          compressed_data_size,
+				          &reference_data,
+				          &reference_data_size,
+				          &error );
+			}
+			else
+			{
+				reference_data      = file_data;
+				reference_data_size = file_data_size;
+
+				result = decompressbench_compress_external(
+				          codec,
+				          reference_data,
+				          reference_data_size,
+				          &compressed_data,
+				          &compressed_data_size,
+				          &error );
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to prepare %s data of source file: %" PRIs_SYSTEM ".\n",
+				 decompressbench_codec_names[ codec ],
+				 argv[ source_index ] );
+
+				goto on_error;
+			}
+			for( implementation = DECOMPRESSBENCH_IMPLEMENTATION_EXTERNAL;
+			     implementation <= DECOMPRESSBENCH_IMPLEMENTATION_INTERNAL;
+			     implementation++ )
+			{
+				result = decompressbench_benchmark(
+				          argv[ source_index ],
+				          codec,
+				          implementation,
+				          compressed_data,
+				          compressed_data_size,
+				          reference_data,
+				          reference_data_size,
+				          minimum_time * 1000000UL,
+				          &error );
+
+				if( result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to benchmark %s of source file: %" PRIs_SYSTEM ".\n",
+					 decompressbench_codec_names[ codec ],
+					 argv[ source_index ] );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					number_of_differences++;
+				}
+			}
+			fflush(
+			 stdout );
+
+			if( is_compressed != 0 )
+			{
+				memory_free(
+				 reference_data );
+			}
+			else
+			{
+				memory_free(
+				 compressed_data );
+			}
+			compressed_data = NULL;
+			reference_data  = NULL;
+		}
+		memory_free(
+		 file_data );
+
+		file_data = NULL;
+	}
+	if( number_of_differences != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Output differs from the reference data in %d benchmarks.\n",
+		 number_of_differences );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( compressed_data != NULL )
+	 && ( compressed_data != file_data ) )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( ( reference_data != NULL )
+	 && ( reference_data != file_data ) )
+	{
+		memory_free(
+		 reference_data );
+	}
+	if( file_data != NULL )
+	{
+		memory_free(
+		 file_data );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -30,6 +30,8 @@
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "assorted_memory_map.h"
 #include "decompression_handle.h"
 
 #define DECOMPRESSION_HANDLE_NOTIFY_STREAM	stdout
@@ -260,6 +262,52 @@ int decompression_handle_free(
 	}
 	if( *decompression_handle != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *decompression_handle )->prefetch_thread != NULL )
+		{
+			libcthreads_thread_join(
+			 &( ( *decompression_handle )->prefetch_thread ),
+			 NULL );
+		}
+		if( ( *decompression_handle )->write_thread != NULL )
+		{
+			libcthreads_thread_join(
+			 &( ( *decompression_handle )->write_thread ),
+			 NULL );
+		}
+#endif
+		if( ( *decompression_handle )->input_memory_map != NULL )
+		{
+			if( assorted_memory_map_free(
+			     &( ( *decompression_handle )->input_memory_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input memory map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *decompression_handle )->input_async_file != NULL )
+		{
+			if( assorted_async_file_free(
+			     &( ( *decompression_handle )->input_async_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input asynchronous file.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcfile_file_free(
 		     &( ( *decompression_handle )->input_file ),
 		     error ) != 1 )
@@ -273,6 +321,37 @@ int decompression_handle_free(
 
 			result = -1;
 		}
+		if( ( *decompression_handle )->output_file != NULL )
+		{
+			if( libcfile_file_free(
+			     &( ( *decompression_handle )->output_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *decompression_handle )->chunk_buffer != NULL )
+		{
+			memory_free(
+			 ( *decompression_handle )->chunk_buffer );
+		}
+		if( ( *decompression_handle )->prefetch_buffer != NULL )
+		{
+			memory_free(
+			 ( *decompression_handle )->prefetch_buffer );
+		}
+		if( ( *decompression_handle )->write_buffer != NULL )
+		{
+			memory_free(
+			 ( *decompression_handle )->write_buffer );
+		}
 		memory_free(
 		 *decompression_handle );
 
@@ -398,7 +477,90 @@ int decompression_handle_set_input_size(
 	return( 1 );
 }
 
+/* Sets the value to indicate the input should be memory mapped
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_handle_set_use_memory_map(
+     decompression_handle_t *decompression_handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_set_use_memory_map";
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	decompression_handle->use_memory_map = use_memory_map;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate the input should be read with asynchronous direct I/O
+ * The input is read ahead in chunks that bypass the file cache, where supported
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_handle_set_use_direct_io(
+     decompression_handle_t *decompression_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_set_use_direct_io";
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	decompression_handle->use_direct_io = use_direct_io;
+
+	return( 1 );
+}
+
+/* Sets if asynchronous I/O should be used
+ * When set the next input chunk is prefetched by decompression_handle_read_next_data
+ * and decompression_handle_write_next_data writes on a separate thread
+ * This has no effect without multi-thread support
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_handle_set_use_asynchronous_io(
+     decompression_handle_t *decompression_handle,
+     uint8_t use_asynchronous_io,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_set_use_asynchronous_io";
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	decompression_handle->use_asynchronous_io = use_asynchronous_io;
+
+	return( 1 );
+}
+
 /* Opens the input
+ * If memory mapping or direct I/O was requested but is not supported the input is read instead
  * Returns 1 if successful or -1 on error
  */
 int decompression_handle_open_input(
@@ -473,6 +635,119 @@ int decompression_handle_open_input(
 		}
 		decompression_handle->input_size -= decompression_handle->input_offset;
 	}
+	decompression_handle->input_read_offset = 0;
+
+	if( decompression_handle->use_memory_map != 0 )
+	{
+		if( assorted_memory_map_initialize(
+		     &( decompression_handle->input_memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create input memory map.",
+			 function );
+
+			return( -1 );
+		}
+		result = assorted_memory_map_open(
+		          decompression_handle->input_memory_map,
+		          filename,
+		          decompression_handle->input_offset,
+		          decompression_handle->input_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map input file.",
+			 function );
+
+			assorted_memory_map_free(
+			 &( decompression_handle->input_memory_map ),
+			 NULL );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( assorted_memory_map_free(
+			     &( decompression_handle->input_memory_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input memory map.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( decompression_handle->use_direct_io != 0 )
+	 && ( decompression_handle->input_memory_map == NULL ) )
+	{
+		if( assorted_async_file_initialize(
+		     &( decompression_handle->input_async_file ),
+		     DECOMPRESSION_HANDLE_CHUNK_SIZE,
+		     ASSORTED_ASYNC_FILE_DEFAULT_QUEUE_DEPTH,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create input asynchronous file.",
+			 function );
+
+			return( -1 );
+		}
+		result = assorted_async_file_open(
+		          decompression_handle->input_async_file,
+		          filename,
+		          decompression_handle->input_offset,
+		          decompression_handle->input_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input file for asynchronous I/O.",
+			 function );
+
+			assorted_async_file_free(
+			 &( decompression_handle->input_async_file ),
+			 NULL );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( assorted_async_file_free(
+			     &( decompression_handle->input_async_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input asynchronous file.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
 	return( 1 );
 }
 
@@ -496,6 +771,53 @@ int decompression_handle_close_input(
 
 		return( -1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( decompression_handle_join_prefetch_thread(
+	     decompression_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join prefetch thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( decompression_handle->input_memory_map != NULL )
+	{
+		if( assorted_memory_map_free(
+		     &( decompression_handle->input_memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input memory map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( decompression_handle->input_async_file != NULL )
+	{
+		if( assorted_async_file_free(
+		     &( decompression_handle->input_async_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input asynchronous file.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libcfile_file_close(
 	     decompression_handle->input_file,
 	     error ) != 0 )
@@ -513,6 +835,8 @@ int decompression_handle_close_input(
 }
 
 /* Reads compressed data
+ * The compressed data is read from the start of the input, which with direct I/O
+ * is read sequentially and must not have been read before
  * Returns 1 if successful or -1 on error
  */
 int decompression_handle_read_data(
@@ -535,6 +859,69 @@ int decompression_handle_read_data(
 
 		return( -1 );
 	}
+	if( decompression_handle->input_memory_map != NULL )
+	{
+		if( compressed_data_size > decompression_handle->input_memory_map->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     compressed_data,
+		     decompression_handle->input_memory_map->data,
+		     compressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( decompression_handle->input_async_file != NULL )
+	{
+		if( decompression_handle->input_read_offset != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid input read offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = assorted_async_file_read_buffer(
+		              decompression_handle->input_async_file,
+		              compressed_data,
+		              compressed_data_size,
+		              error );
+
+		if( read_count != (ssize_t) compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from input file.",
+			 function );
+
+			return( -1 );
+		}
+		decompression_handle->input_read_offset += compressed_data_size;
+
+		return( 1 );
+	}
 	if( libcfile_file_seek_offset(
 	     decompression_handle->input_file,
 	     decompression_handle->input_offset,
@@ -570,20 +957,21 @@ int decompression_handle_read_data(
 	return( 1 );
 }
 
-/* Writes uncompressed data
- * Returns 1 if successful or -1 on error
+/* Reads a chunk of compressed data from the input file
+ * The chunk ends at the next multiple of the chunk size in the input file or at the end of the input
+ * Returns 1 if successful, 0 if no more data is available or -1 on error
  */
-int decompression_handle_write_data(
+int decompression_handle_read_chunk(
      decompression_handle_t *decompression_handle,
-     const system_character_t *output_filename,
-     const uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
+     uint8_t *chunk_data,
+     size64_t read_offset,
+     size_t *read_size,
      libcerror_error_t **error )
 {
-	libcfile_file_t *output_file = NULL;
-	static char *function        = "decompression_handle_write_data";
-	ssize_t write_count          = 0;
-	int result                   = 0;
+	static char *function = "decompression_handle_read_chunk";
+	size64_t file_offset  = 0;
+	size_t safe_read_size = 0;
+	ssize_t read_count    = 0;
 
 	if( decompression_handle == NULL )
 	{
@@ -591,80 +979,654 @@ int decompression_handle_write_data(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid info handle.",
+		 "%s: invalid decompression handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( output_filename == NULL )
-	{
-		fprintf(
-		 decompression_handle->notify_stream,
-		 "Uncompressed data:\n" );
-
-		libcnotify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-		return( 1 );
-	}
-	if( libcfile_file_initialize(
-	     &output_file,
-	     error ) != 1 )
+	if( chunk_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create output file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          output_file,
-	          output_filename,
-	          LIBCFILE_OPEN_WRITE,
-	          error );
-#else
-	result = libcfile_file_open(
-	          output_file,
-	          output_filename,
-	          LIBCFILE_OPEN_WRITE,
-	          error );
-#endif
- 	if( result != 1 )
+	if( read_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open output file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	write_count = libcfile_file_write_buffer(
-		       output_file,
-		       uncompressed_data,
-		       uncompressed_data_size,
-		       error );
+	if( read_offset >= decompression_handle->input_size )
+	{
+		return( 0 );
+	}
+	file_offset    = (size64_t) decompression_handle->input_offset + read_offset;
+	safe_read_size = DECOMPRESSION_HANDLE_CHUNK_SIZE - (size_t) ( file_offset % DECOMPRESSION_HANDLE_CHUNK_SIZE );
 
-	if( write_count != (ssize_t) uncompressed_data_size )
+	if( (size64_t) safe_read_size > ( decompression_handle->input_size - read_offset ) )
+	{
+		safe_read_size = (size_t) ( decompression_handle->input_size - read_offset );
+	}
+	if( libcfile_file_seek_offset(
+	     decompression_handle->input_file,
+	     (off64_t) file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write to output file.",
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek in input file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	read_count = libcfile_file_read_buffer(
+	              decompression_handle->input_file,
+	              chunk_data,
+	              safe_read_size,
+	              error );
+
+	if( read_count != (ssize_t) safe_read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from input file.",
+		 function );
+
+		return( -1 );
+	}
+	*read_size = safe_read_size;
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads the chunk to prefetch from a separate thread
+ * The error is not available from the prefetch thread, the result is stored in the handle
+ * Returns 1
+ */
+int decompression_handle_prefetch_callback(
+     decompression_handle_t *decompression_handle )
+{
+	if( decompression_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( decompression_handle->abort != 0 )
+	{
+		decompression_handle->prefetch_result = -1;
+	}
+	else
+	{
+		decompression_handle->prefetch_result = decompression_handle_read_chunk(
+		                                         decompression_handle,
+		                                         decompression_handle->prefetch_buffer,
+		                                         decompression_handle->prefetch_read_offset,
+		                                         &( decompression_handle->prefetch_size ),
+		                                         NULL );
+	}
+	return( 1 );
+}
+
+/* Waits for the prefetch thread to finish if it is running
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_handle_join_prefetch_thread(
+     decompression_handle_t *decompression_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_join_prefetch_thread";
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->prefetch_thread != NULL )
+	{
+		if( libcthreads_thread_join(
+		     &( decompression_handle->prefetch_thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join prefetch thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the data in the write buffer from a separate thread
+ * The error is not available from the write thread, the result is stored in the handle
+ * Returns 1
+ */
+int decompression_handle_write_callback(
+     decompression_handle_t *decompression_handle )
+{
+	ssize_t write_count = 0;
+
+	if( decompression_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( decompression_handle->abort != 0 )
+	{
+		decompression_handle->write_result = -1;
+
+		return( 1 );
+	}
+	write_count = libcfile_file_write_buffer(
+	               decompression_handle->output_file,
+	               decompression_handle->write_buffer,
+	               decompression_handle->write_size,
+	               NULL );
+
+	if( write_count != (ssize_t) decompression_handle->write_size )
+	{
+		decompression_handle->write_result = -1;
+	}
+	else
+	{
+		decompression_handle->write_result = 1;
+	}
+	return( 1 );
+}
+
+/* Waits for the write thread to finish if it is running
+ * Returns 1 if successful or -1 on error, including when the asynchronous write failed
+ */
+int decompression_handle_join_write_thread(
+     decompression_handle_t *decompression_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_join_write_thread";
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->write_thread == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_thread_join(
+	     &( decompression_handle->write_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join write thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->write_result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to output file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Reads the next chunk of compressed data
+ * The data is either part of the memory mapped input, of a buffer of the input asynchronous
+ * file or of the chunk buffer of the handle and remains valid until the next call. Reads after
+ * the first are aligned to the chunk size in the input file, except with direct I/O where
+ * the chunks are relative to the input offset and are read ahead. When asynchronous I/O is
+ * used the following chunk is prefetched while the caller processes the data
+ * Returns 1 if successful, 0 if no more data is available or -1 on error
+ */
+int decompression_handle_read_next_data(
+     decompression_handle_t *decompression_handle,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_read_next_data";
+	size_t read_size      = 0;
+	int result            = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	uint8_t *chunk_buffer = NULL;
+#endif
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->input_read_offset >= decompression_handle->input_size )
+	{
+		return( 0 );
+	}
+	if( decompression_handle->input_memory_map != NULL )
+	{
+		read_size = DECOMPRESSION_HANDLE_CHUNK_SIZE - (size_t) ( ( (size64_t) decompression_handle->input_offset + decompression_handle->input_read_offset ) % DECOMPRESSION_HANDLE_CHUNK_SIZE );
+
+		if( (size64_t) read_size > ( decompression_handle->input_size - decompression_handle->input_read_offset ) )
+		{
+			read_size = (size_t) ( decompression_handle->input_size - decompression_handle->input_read_offset );
+		}
+		*data      = &( decompression_handle->input_memory_map->data[ decompression_handle->input_read_offset ] );
+		*data_size = read_size;
+
+		decompression_handle->input_read_offset += read_size;
+
+		return( 1 );
+	}
+	if( decompression_handle->input_async_file != NULL )
+	{
+		result = assorted_async_file_read_next(
+		          decompression_handle->input_async_file,
+		          data,
+		          &read_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIu64 ".",
+			 function,
+			 decompression_handle->input_read_offset );
+
+			return( -1 );
+		}
+		*data_size = read_size;
+
+		decompression_handle->input_read_offset += read_size;
+
+		return( 1 );
+	}
+	if( decompression_handle->chunk_buffer == NULL )
+	{
+		decompression_handle->chunk_buffer = (uint8_t *) memory_allocate(
+		                                                  sizeof( uint8_t ) * DECOMPRESSION_HANDLE_CHUNK_SIZE );
+
+		if( decompression_handle->chunk_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( decompression_handle->prefetch_thread != NULL )
+	{
+		if( decompression_handle_join_prefetch_thread(
+		     decompression_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join prefetch thread.",
+			 function );
+
+			return( -1 );
+		}
+		/* A failed prefetch is read again below, which provides the error
+		 */
+		if( ( decompression_handle->prefetch_result == 1 )
+		 && ( decompression_handle->prefetch_read_offset == decompression_handle->input_read_offset ) )
+		{
+			chunk_buffer                          = decompression_handle->chunk_buffer;
+			decompression_handle->chunk_buffer    = decompression_handle->prefetch_buffer;
+			decompression_handle->prefetch_buffer = chunk_buffer;
+
+			read_size = decompression_handle->prefetch_size;
+			result    = 1;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( result == 0 )
+	{
+		result = decompression_handle_read_chunk(
+		          decompression_handle,
+		          decompression_handle->chunk_buffer,
+		          decompression_handle->input_read_offset,
+		          &read_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk at offset: %" PRIu64 ".",
+			 function,
+			 decompression_handle->input_read_offset );
+
+			return( -1 );
+		}
+	}
+	*data      = decompression_handle->chunk_buffer;
+	*data_size = read_size;
+
+	decompression_handle->input_read_offset += read_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( decompression_handle->use_asynchronous_io != 0 )
+	 && ( decompression_handle->input_read_offset < decompression_handle->input_size ) )
+	{
+		if( decompression_handle->prefetch_buffer == NULL )
+		{
+			decompression_handle->prefetch_buffer = (uint8_t *) memory_allocate(
+			                                                     sizeof( uint8_t ) * DECOMPRESSION_HANDLE_CHUNK_SIZE );
+
+			if( decompression_handle->prefetch_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create prefetch buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		decompression_handle->prefetch_read_offset = decompression_handle->input_read_offset;
+		decompression_handle->prefetch_result      = 0;
+
+		if( libcthreads_thread_create(
+		     &( decompression_handle->prefetch_thread ),
+		     NULL,
+		     (int (*)(void *)) &decompression_handle_prefetch_callback,
+		     (void *) decompression_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create prefetch thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+}
+
+/* Retrieves the memory mapped input data
+ * The data remains valid until the input is closed
+ * Returns 1 if successful, 0 if the input is not memory mapped or -1 on error
+ */
+int decompression_handle_get_input_data(
+     decompression_handle_t *decompression_handle,
+     const uint8_t **input_data,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_get_input_data";
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->input_memory_map == NULL )
+	{
+		return( 0 );
+	}
+	*input_data = decompression_handle->input_memory_map->data;
+
+	return( 1 );
+}
+
+/* Opens the output
+ * If no filename is provided the data is printed to the notify stream
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_handle_open_output(
+     decompression_handle_t *decompression_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_open_output";
+	int result            = 0;
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->output_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decompression handle - output already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		fprintf(
+		 decompression_handle->notify_stream,
+		 "Uncompressed data:\n" );
+
+		decompression_handle->output_is_open = 1;
+
+		return( 1 );
+	}
+	if( libcfile_file_initialize(
+	     &( decompression_handle->output_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          decompression_handle->output_file,
+	          filename,
+	          LIBCFILE_OPEN_WRITE,
+	          error );
+#else
+	result = libcfile_file_open(
+	          decompression_handle->output_file,
+	          filename,
+	          LIBCFILE_OPEN_WRITE,
+	          error );
+#endif
+ 	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		goto on_error;
+	}
+	decompression_handle->output_is_open = 1;
+
+	return( 1 );
+
+on_error:
+	if( decompression_handle->output_file != NULL )
+	{
+		libcfile_file_free(
+		 &( decompression_handle->output_file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the output
+ * Returns the 0 if succesful or -1 on error
+ */
+int decompression_handle_close_output(
+     decompression_handle_t *decompression_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_close_output";
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->output_is_open == 0 )
+	{
+		return( 0 );
+	}
+	decompression_handle->output_is_open = 0;
+
+	if( decompression_handle->output_file == NULL )
+	{
+		return( 0 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( decompression_handle_join_write_thread(
+	     decompression_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to complete asynchronous write.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	if( libcfile_file_close(
-	     output_file,
+	     decompression_handle->output_file,
 	     error ) != 0 )
 	{
 		libcerror_error_set(
@@ -677,7 +1639,7 @@ int decompression_handle_write_data(
 		goto on_error;
 	}
 	if( libcfile_file_free(
-	     &output_file,
+	     &( decompression_handle->output_file ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -689,15 +1651,244 @@ int decompression_handle_write_data(
 
 		goto on_error;
 	}
-	return( 1 );
+	return( 0 );
 
 on_error:
-	if( output_file != NULL )
+	if( decompression_handle->output_file != NULL )
 	{
 		libcfile_file_free(
-		 &output_file,
+		 &( decompression_handle->output_file ),
 		 NULL );
 	}
 	return( -1 );
 }
 
+/* Writes the next chunk of uncompressed data to the output
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_handle_write_next_data(
+     decompression_handle_t *decompression_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_write_next_data";
+	ssize_t write_count   = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	void *reallocation    = NULL;
+#endif
+
+	if( decompression_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->output_is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decompression handle - output not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( decompression_handle->output_file == NULL )
+	{
+		libcnotify_print_data(
+		 data,
+		 data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( decompression_handle_join_write_thread(
+	     decompression_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to complete previous asynchronous write.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle->use_asynchronous_io != 0 )
+	{
+		/* The data is copied since the caller can reuse it after this function returns
+		 */
+		if( data_size > decompression_handle->write_buffer_size )
+		{
+			reallocation = memory_reallocate(
+			                decompression_handle->write_buffer,
+			                sizeof( uint8_t ) * data_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize write buffer.",
+				 function );
+
+				return( -1 );
+			}
+			decompression_handle->write_buffer      = (uint8_t *) reallocation;
+			decompression_handle->write_buffer_size = data_size;
+		}
+		if( memory_copy(
+		     decompression_handle->write_buffer,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to write buffer.",
+			 function );
+
+			return( -1 );
+		}
+		decompression_handle->write_size   = data_size;
+		decompression_handle->write_result = 0;
+
+		if( libcthreads_thread_create(
+		     &( decompression_handle->write_thread ),
+		     NULL,
+		     (int (*)(void *)) &decompression_handle_write_callback,
+		     (void *) decompression_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create write thread.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	write_count = libcfile_file_write_buffer(
+	               decompression_handle->output_file,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to output file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_handle_write_data(
+     decompression_handle_t *decompression_handle,
+     const system_character_t *output_filename,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_handle_write_data";
+
+	if( decompression_handle_open_output(
+	     decompression_handle,
+	     output_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_handle_write_next_data(
+	     decompression_handle,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		decompression_handle_close_output(
+		 decompression_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( decompression_handle_close_output(
+	     decompression_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -26,13 +26,20 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "assorted_async_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
+#include "assorted_libcthreads.h"
+#include "assorted_memory_map.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The size of the chunks the input is read in by decompression_handle_read_next_data
+ */
+#define DECOMPRESSION_HANDLE_CHUNK_SIZE		( 1024 * 1024 )
+
 typedef struct decompression_handle decompression_handle_t;
 
 struct decompression_handle
@@ -49,6 +56,85 @@ struct decompression_handle
 	 */
 	off64_t input_offset;
 
+	/* The input memory map
+	 */
+	assorted_memory_map_t *input_memory_map;
+
+	/* Value to indicate the input should be memory mapped
+	 */
+	uint8_t use_memory_map;
+
+	/* The input asynchronous file
+	 */
+	assorted_async_file_t *input_async_file;
+
+	/* Value to indicate the input should be read with asynchronous direct I/O
+	 */
+	uint8_t use_direct_io;
+
+	/* The offset of the next chunk relative from the input offset
+	 */
+	size64_t input_read_offset;
+
+	/* The chunk buffer
+	 */
+	uint8_t *chunk_buffer;
+
+	/* The output file
+	 */
+	libcfile_file_t *output_file;
+
+	/* Value to indicate the output is open
+	 */
+	uint8_t output_is_open;
+
+	/* Value to indicate the next input chunk should be prefetched and
+	 * the output should be written on a separate thread
+	 */
+	uint8_t use_asynchronous_io;
+
+	/* The prefetch buffer
+	 */
+	uint8_t *prefetch_buffer;
+
+	/* The offset of the prefetched chunk relative from the input offset
+	 */
+	size64_t prefetch_read_offset;
+
+	/* The size of the prefetched chunk
+	 */
+	size_t prefetch_size;
+
+	/* The result of the prefetch, 1 if the prefetched chunk is available
+	 */
+	int prefetch_result;
+
+	/* The write buffer
+	 */
+	uint8_t *write_buffer;
+
+	/* The size of the write buffer
+	 */
+	size_t write_buffer_size;
+
+	/* The size of the data in the write buffer
+	 */
+	size_t write_size;
+
+	/* The result of the asynchronous write, 1 if successful
+	 */
+	int write_result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The prefetch thread
+	 */
+	libcthreads_thread_t *prefetch_thread;
+
+	/* The write thread
+	 */
+	libcthreads_thread_t *write_thread;
+#endif
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -86,6 +172,21 @@ int decompression_handle_set_input_size(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int decompression_handle_set_use_memory_map(
+     decompression_handle_t *decompression_handle,
+     uint8_t use_memory_map,
+     libcerror_error_t **error );
+
+int decompression_handle_set_use_asynchronous_io(
+     decompression_handle_t *decompression_handle,
+     uint8_t use_asynchronous_io,
+     libcerror_error_t **error );
+
+int decompression_handle_set_use_direct_io(
+     decompression_handle_t *decompression_handle,
+     uint8_t use_direct_io,
+     libcerror_error_t **error );
+
 int decompression_handle_open_input(
      decompression_handle_t *decompression_handle,
      const system_character_t *filename,
@@ -101,6 +202,57 @@ int decompression_handle_read_data(
      size_t compressed_data_size,
      libcerror_error_t **error );
 
+int decompression_handle_read_chunk(
+     decompression_handle_t *decompression_handle,
+     uint8_t *chunk_data,
+     size64_t read_offset,
+     size_t *read_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int decompression_handle_prefetch_callback(
+     decompression_handle_t *decompression_handle );
+
+int decompression_handle_join_prefetch_thread(
+     decompression_handle_t *decompression_handle,
+     libcerror_error_t **error );
+
+int decompression_handle_write_callback(
+     decompression_handle_t *decompression_handle );
+
+int decompression_handle_join_write_thread(
+     decompression_handle_t *decompression_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int decompression_handle_read_next_data(
+     decompression_handle_t *decompression_handle,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int decompression_handle_get_input_data(
+     decompression_handle_t *decompression_handle,
+     const uint8_t **input_data,
+     libcerror_error_t **error );
+
+int decompression_handle_open_output(
+     decompression_handle_t *decompression_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int decompression_handle_close_output(
+     decompression_handle_t *decompression_handle,
+     libcerror_error_t **error );
+
+int decompression_handle_write_next_data(
+     decompression_handle_t *decompression_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int decompression_handle_write_data(
      decompression_handle_t *decompression_handle,
      const system_character_t *output_filename,
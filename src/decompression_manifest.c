@@ -0,0 +1,727 @@
+/*
+ * Decompression manifest
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "assorted_codec.h"
+#include "assorted_libcerror.h"
+#include "decompression_manifest.h"
+
+/* Creates a manifest
+ * Make sure the value manifest is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_manifest_initialize(
+     decompression_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_manifest_initialize";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*manifest = memory_allocate_structure(
+	             decompression_manifest_t );
+
+	if( *manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *manifest,
+	     0,
+	     sizeof( decompression_manifest_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear manifest.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *manifest != NULL )
+	{
+		memory_free(
+		 *manifest );
+
+		*manifest = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a manifest
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_manifest_free(
+     decompression_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "decompression_manifest_free";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest != NULL )
+	{
+		if( ( *manifest )->entries != NULL )
+		{
+			memory_free(
+			 ( *manifest )->entries );
+		}
+		memory_free(
+		 *manifest );
+
+		*manifest = NULL;
+	}
+	return( 1 );
+}
+
+/* Parses a decimal or 0x prefixed hexadecimal integer
+ * Returns 1 if successful, 0 if the string is not a valid integer or -1 on error
+ */
+int decompression_manifest_parse_integer(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function    = "decompression_manifest_parse_integer";
+	size_t string_index      = 0;
+	uint64_t safe_value      = 0;
+	uint8_t base             = 10;
+	uint8_t character_value  = 0;
+	uint8_t digit_value      = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length > 2 )
+	 && ( string[ 0 ] == '0' )
+	 && ( ( string[ 1 ] == 'x' )
+	  ||  ( string[ 1 ] == 'X' ) ) )
+	{
+		base         = 16;
+		string_index = 2;
+	}
+	if( string_index >= string_length )
+	{
+		return( 0 );
+	}
+	while( string_index < string_length )
+	{
+		character_value = (uint8_t) string[ string_index++ ];
+
+		if( ( character_value >= (uint8_t) '0' )
+		 && ( character_value <= (uint8_t) '9' ) )
+		{
+			digit_value = character_value - (uint8_t) '0';
+		}
+		else if( ( base == 16 )
+		      && ( character_value >= (uint8_t) 'a' )
+		      && ( character_value <= (uint8_t) 'f' ) )
+		{
+			digit_value = character_value - (uint8_t) 'a' + 10;
+		}
+		else if( ( base == 16 )
+		      && ( character_value >= (uint8_t) 'A' )
+		      && ( character_value <= (uint8_t) 'F' ) )
+		{
+			digit_value = character_value - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			return( 0 );
+		}
+		if( safe_value > ( ( UINT64_MAX - digit_value ) / base ) )
+		{
+			return( 0 );
+		}
+		safe_value = ( safe_value * base ) + digit_value;
+	}
+	*value_64bit = safe_value;
+
+	return( 1 );
+}
+
+/* Parses a line of the manifest and appends its entry
+ * A line contains the offset, the compressed size, the expected uncompressed size
+ * or 0 if not known and the name of the codec, separated by whitespace.
+ * Empty lines and lines starting with # are ignored
+ * Returns 1 if successful, 0 if the line is not valid or -1 on error
+ */
+int decompression_manifest_append_line(
+     decompression_manifest_t *manifest,
+     const char *line,
+     size_t line_length,
+     libcerror_error_t **error )
+{
+	const char *fields[ 4 ];
+	size_t field_lengths[ 4 ];
+	uint64_t values[ 3 ];
+
+	decompression_manifest_entry_t *entry = NULL;
+	void *reallocation                    = NULL;
+	static char *function                 = "decompression_manifest_append_line";
+	size_t field_start                    = 0;
+	size_t line_index                     = 0;
+	int field_index                       = 0;
+	int number_of_allocated_entries       = 0;
+	int number_of_fields                  = 0;
+	int result                            = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	while( line_index < line_length )
+	{
+		while( ( line_index < line_length )
+		    && ( ( line[ line_index ] == ' ' )
+		     ||  ( line[ line_index ] == '\t' ) ) )
+		{
+			line_index++;
+		}
+		if( line_index >= line_length )
+		{
+			break;
+		}
+		if( ( number_of_fields == 0 )
+		 && ( line[ line_index ] == '#' ) )
+		{
+			return( 1 );
+		}
+		if( number_of_fields >= 4 )
+		{
+			return( 0 );
+		}
+		field_start = line_index;
+
+		while( ( line_index < line_length )
+		    && ( line[ line_index ] != ' ' )
+		    && ( line[ line_index ] != '\t' ) )
+		{
+			line_index++;
+		}
+		fields[ number_of_fields ]        = &( line[ field_start ] );
+		field_lengths[ number_of_fields ] = line_index - field_start;
+
+		number_of_fields++;
+	}
+	if( number_of_fields == 0 )
+	{
+		return( 1 );
+	}
+	if( number_of_fields != 4 )
+	{
+		return( 0 );
+	}
+	for( field_index = 0;
+	     field_index < 3;
+	     field_index++ )
+	{
+		result = decompression_manifest_parse_integer(
+		          fields[ field_index ],
+		          field_lengths[ field_index ],
+		          &( values[ field_index ] ),
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+	}
+	if( ( values[ 0 ] > (uint64_t) INT64_MAX )
+	 || ( values[ 1 ] == 0 )
+	 || ( values[ 1 ] > (uint64_t) SSIZE_MAX )
+	 || ( values[ 2 ] > (uint64_t) SSIZE_MAX ) )
+	{
+		return( 0 );
+	}
+	if( manifest->number_of_entries >= manifest->number_of_allocated_entries )
+	{
+		if( manifest->number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_entries = manifest->number_of_allocated_entries * 2;
+
+		if( number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 1024;
+		}
+		reallocation = memory_reallocate(
+		                manifest->entries,
+		                sizeof( decompression_manifest_entry_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		manifest->entries                     = (decompression_manifest_entry_t *) reallocation;
+		manifest->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( manifest->entries[ manifest->number_of_entries ] );
+
+	result = assorted_codec_get_codec_by_name(
+	          fields[ 3 ],
+	          field_lengths[ 3 ],
+	          &( entry->codec ),
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	entry->offset                 = (off64_t) values[ 0 ];
+	entry->compressed_data_size   = (size_t) values[ 1 ];
+	entry->uncompressed_data_size = (size_t) values[ 2 ];
+
+	manifest->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the entries of a manifest from a file
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_manifest_read_file(
+     decompression_manifest_t *manifest,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char *line                = NULL;
+	FILE *manifest_stream     = NULL;
+	static char *function     = "decompression_manifest_read_file";
+	size_t line_length        = 0;
+	size_t line_number        = 0;
+	int result                = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	line = narrow_string_allocate(
+	        DECOMPRESSION_MANIFEST_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	manifest_stream = file_stream_open_wide(
+	                   filename,
+	                   _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	manifest_stream = file_stream_open(
+	                   filename,
+	                   FILE_STREAM_OPEN_READ );
+#endif
+	if( manifest_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open manifest: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	while( file_stream_get_string(
+	        manifest_stream,
+	        line,
+	        DECOMPRESSION_MANIFEST_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( DECOMPRESSION_MANIFEST_MAXIMUM_LINE_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %" PRIzd " value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == '\r' ) )
+		{
+			line_length--;
+		}
+		result = decompression_manifest_append_line(
+		          manifest,
+		          line,
+		          line_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid or unsupported line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     manifest_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close manifest.",
+		 function );
+
+		manifest_stream = NULL;
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( manifest_stream != NULL )
+	{
+		file_stream_close(
+		 manifest_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+/* Decompresses the compressed data of an entry
+ * Without an expected uncompressed size the buffer is sized from the output size
+ * hint of the codec and, if the hint is an estimate, doubled up to the maximum
+ * uncompressed data size until the data fits
+ * The uncompressed data is allocated and must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int decompression_manifest_entry_decompress(
+     const decompression_manifest_entry_t *entry,
+     const uint8_t *compressed_data,
+     size_t maximum_uncompressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_uncompressed_data    = NULL;
+	static char *function              = "decompression_manifest_entry_decompress";
+	size_t allocated_size              = 0;
+	size_t safe_uncompressed_data_size = 0;
+	int is_upper_bound                 = 1;
+	int result                         = 0;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->uncompressed_data_size > 0 )
+	{
+		allocated_size = entry->uncompressed_data_size;
+	}
+	else
+	{
+		is_upper_bound = assorted_codec_get_output_size_hint(
+		                  entry->codec,
+		                  compressed_data,
+		                  entry->compressed_data_size,
+		                  &allocated_size,
+		                  error );
+
+		if( is_upper_bound == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine output size hint.",
+			 function );
+
+			goto on_error;
+		}
+		if( allocated_size > maximum_uncompressed_data_size )
+		{
+			allocated_size = maximum_uncompressed_data_size;
+		}
+	}
+	if( allocated_size == 0 )
+	{
+		allocated_size = 1;
+	}
+	do
+	{
+		safe_uncompressed_data = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * allocated_size );
+
+		if( safe_uncompressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create uncompressed data.",
+			 function );
+
+			goto on_error;
+		}
+		safe_uncompressed_data_size = allocated_size;
+
+		result = assorted_codec_decompress(
+		          entry->codec,
+		          compressed_data,
+		          entry->compressed_data_size,
+		          safe_uncompressed_data,
+		          &safe_uncompressed_data_size,
+		          error );
+
+		if( result == 1 )
+		{
+			break;
+		}
+		memory_free(
+		 safe_uncompressed_data );
+
+		safe_uncompressed_data = NULL;
+
+		if( ( is_upper_bound != 0 )
+		 || ( allocated_size >= maximum_uncompressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+		libcerror_error_free(
+		 error );
+
+		if( allocated_size > ( maximum_uncompressed_data_size / 2 ) )
+		{
+			allocated_size = maximum_uncompressed_data_size;
+		}
+		else
+		{
+			allocated_size *= 2;
+		}
+	}
+	while( result != 1 );
+
+	*uncompressed_data      = safe_uncompressed_data;
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_uncompressed_data != NULL )
+	{
+		memory_free(
+		 safe_uncompressed_data );
+	}
+	return( -1 );
+}
+
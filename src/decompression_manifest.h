@@ -0,0 +1,115 @@
+/*
+ * Decompression manifest
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DECOMPRESSION_MANIFEST_H )
+#define _DECOMPRESSION_MANIFEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_codec.h"
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a line of the manifest
+ */
+#define DECOMPRESSION_MANIFEST_MAXIMUM_LINE_SIZE	1024
+
+typedef struct decompression_manifest_entry decompression_manifest_entry_t;
+
+struct decompression_manifest_entry
+{
+	/* The offset of the compressed data in the source
+	 */
+	off64_t offset;
+
+	/* The size of the compressed data
+	 */
+	size_t compressed_data_size;
+
+	/* The expected size of the uncompressed data, 0 if not known
+	 */
+	size_t uncompressed_data_size;
+
+	/* The codec
+	 */
+	const assorted_codec_t *codec;
+};
+
+typedef struct decompression_manifest decompression_manifest_t;
+
+struct decompression_manifest
+{
+	/* The entries
+	 */
+	decompression_manifest_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int decompression_manifest_initialize(
+     decompression_manifest_t **manifest,
+     libcerror_error_t **error );
+
+int decompression_manifest_free(
+     decompression_manifest_t **manifest,
+     libcerror_error_t **error );
+
+int decompression_manifest_parse_integer(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int decompression_manifest_append_line(
+     decompression_manifest_t *manifest,
+     const char *line,
+     size_t line_length,
+     libcerror_error_t **error );
+
+int decompression_manifest_read_file(
+     decompression_manifest_t *manifest,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int decompression_manifest_entry_decompress(
+     const decompression_manifest_entry_t *entry,
+     const uint8_t *compressed_data,
+     size_t maximum_uncompressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DECOMPRESSION_MANIFEST_H ) */
+
@@ -0,0 +1,925 @@
+/*
+ * Decryption manifest
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "decryption_manifest.h"
+
+/* Creates a manifest
+ * Make sure the value manifest is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int decryption_manifest_initialize(
+     decryption_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "decryption_manifest_initialize";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*manifest = memory_allocate_structure(
+	             decryption_manifest_t );
+
+	if( *manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *manifest,
+	     0,
+	     sizeof( decryption_manifest_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear manifest.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *manifest != NULL )
+	{
+		memory_free(
+		 *manifest );
+
+		*manifest = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a manifest
+ * Returns 1 if successful or -1 on error
+ */
+int decryption_manifest_free(
+     decryption_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "decryption_manifest_free";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest != NULL )
+	{
+		if( ( *manifest )->entries != NULL )
+		{
+			memory_free(
+			 ( *manifest )->entries );
+		}
+		if( ( *manifest )->keys != NULL )
+		{
+			memory_set(
+			 ( *manifest )->keys,
+			 0,
+			 sizeof( decryption_manifest_key_t ) * ( *manifest )->number_of_allocated_keys );
+
+			memory_free(
+			 ( *manifest )->keys );
+		}
+		if( ( *manifest )->key_table != NULL )
+		{
+			memory_free(
+			 ( *manifest )->key_table );
+		}
+		memory_free(
+		 *manifest );
+
+		*manifest = NULL;
+	}
+	return( 1 );
+}
+
+/* Parses a decimal or 0x prefixed hexadecimal integer
+ * Returns 1 if successful, 0 if the string is not a valid integer or -1 on error
+ */
+int decryption_manifest_parse_integer(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function    = "decryption_manifest_parse_integer";
+	size_t string_index      = 0;
+	uint64_t safe_value      = 0;
+	uint8_t base             = 10;
+	uint8_t character_value  = 0;
+	uint8_t digit_value      = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length > 2 )
+	 && ( string[ 0 ] == '0' )
+	 && ( ( string[ 1 ] == 'x' )
+	  ||  ( string[ 1 ] == 'X' ) ) )
+	{
+		base         = 16;
+		string_index = 2;
+	}
+	if( string_index >= string_length )
+	{
+		return( 0 );
+	}
+	while( string_index < string_length )
+	{
+		character_value = (uint8_t) string[ string_index++ ];
+
+		if( ( character_value >= (uint8_t) '0' )
+		 && ( character_value <= (uint8_t) '9' ) )
+		{
+			digit_value = character_value - (uint8_t) '0';
+		}
+		else if( ( base == 16 )
+		      && ( character_value >= (uint8_t) 'a' )
+		      && ( character_value <= (uint8_t) 'f' ) )
+		{
+			digit_value = character_value - (uint8_t) 'a' + 10;
+		}
+		else if( ( base == 16 )
+		      && ( character_value >= (uint8_t) 'A' )
+		      && ( character_value <= (uint8_t) 'F' ) )
+		{
+			digit_value = character_value - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			return( 0 );
+		}
+		if( safe_value > ( ( UINT64_MAX - digit_value ) / base ) )
+		{
+			return( 0 );
+		}
+		safe_value = ( safe_value * base ) + digit_value;
+	}
+	*value_64bit = safe_value;
+
+	return( 1 );
+}
+
+/* Parses a base16 formatted key
+ * Returns 1 if successful, 0 if the string is not a valid key or -1 on error
+ */
+int decryption_manifest_parse_key(
+     const char *string,
+     size_t string_length,
+     uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "decryption_manifest_parse_key";
+	size_t key_index        = 0;
+	size_t string_index     = 0;
+	uint8_t character_value = 0;
+	uint8_t nibble_value    = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length == 0 )
+	 || ( ( string_length % 2 ) != 0 )
+	 || ( ( string_length / 2 ) > key_data_size ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character_value = (uint8_t) string[ string_index ];
+
+		if( ( character_value >= (uint8_t) '0' )
+		 && ( character_value <= (uint8_t) '9' ) )
+		{
+			nibble_value = character_value - (uint8_t) '0';
+		}
+		else if( ( character_value >= (uint8_t) 'a' )
+		      && ( character_value <= (uint8_t) 'f' ) )
+		{
+			nibble_value = character_value - (uint8_t) 'a' + 10;
+		}
+		else if( ( character_value >= (uint8_t) 'A' )
+		      && ( character_value <= (uint8_t) 'F' ) )
+		{
+			nibble_value = character_value - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			return( 0 );
+		}
+		key_index = string_index / 2;
+
+		if( ( string_index % 2 ) == 0 )
+		{
+			key_data[ key_index ] = nibble_value << 4;
+		}
+		else
+		{
+			key_data[ key_index ] |= nibble_value;
+		}
+	}
+	*key_size = string_length / 2;
+
+	return( 1 );
+}
+
+/* Retrieves the index of a key, the key is added if not present
+ * Keys are looked up by hash so that a key schedule is only computed once per distinct key
+ * Returns 1 if successful or -1 on error
+ */
+int decryption_manifest_get_key_index(
+     decryption_manifest_t *manifest,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     int *key_index,
+     libcerror_error_t **error )
+{
+	decryption_manifest_key_t *key = NULL;
+	void *reallocation             = NULL;
+	int *key_table                 = NULL;
+	static char *function          = "decryption_manifest_get_key_index";
+	size_t byte_index              = 0;
+	uint32_t hash                  = 0x811c9dc5UL;
+	int number_of_allocated_keys   = 0;
+	int number_of_slots            = 0;
+	int safe_key_index             = 0;
+	int slot_index                 = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size == 0 )
+	 || ( key_data_size > DECRYPTION_MANIFEST_MAXIMUM_KEY_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key table is kept at most half full
+	 */
+	if( ( manifest->number_of_keys + 1 ) > ( manifest->number_of_key_table_slots / 2 ) )
+	{
+		if( manifest->number_of_key_table_slots > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of key table slots value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_slots = manifest->number_of_key_table_slots * 2;
+
+		if( number_of_slots == 0 )
+		{
+			number_of_slots = 256;
+		}
+		key_table = (int *) memory_allocate(
+		                     sizeof( int ) * number_of_slots );
+
+		if( key_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create key table.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     key_table,
+		     0,
+		     sizeof( int ) * number_of_slots ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear key table.",
+			 function );
+
+			memory_free(
+			 key_table );
+
+			return( -1 );
+		}
+		for( safe_key_index = 0;
+		     safe_key_index < manifest->number_of_keys;
+		     safe_key_index++ )
+		{
+			slot_index = (int) ( manifest->keys[ safe_key_index ].hash & (uint32_t) ( number_of_slots - 1 ) );
+
+			while( key_table[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+			}
+			key_table[ slot_index ] = safe_key_index + 1;
+		}
+		if( manifest->key_table != NULL )
+		{
+			memory_free(
+			 manifest->key_table );
+		}
+		manifest->key_table                 = key_table;
+		manifest->number_of_key_table_slots = number_of_slots;
+	}
+	/* The hash is the 32-bit FNV-1a of the key data
+	 */
+	for( byte_index = 0;
+	     byte_index < key_data_size;
+	     byte_index++ )
+	{
+		hash ^= key_data[ byte_index ];
+		hash *= 0x01000193UL;
+	}
+	slot_index = (int) ( hash & (uint32_t) ( manifest->number_of_key_table_slots - 1 ) );
+
+	while( manifest->key_table[ slot_index ] != 0 )
+	{
+		safe_key_index = manifest->key_table[ slot_index ] - 1;
+
+		key = &( manifest->keys[ safe_key_index ] );
+
+		if( ( key->hash == hash )
+		 && ( key->data_size == key_data_size )
+		 && ( memory_compare(
+		       key->data,
+		       key_data,
+		       key_data_size ) == 0 ) )
+		{
+			*key_index = safe_key_index;
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( manifest->number_of_key_table_slots - 1 );
+	}
+	if( manifest->number_of_keys >= manifest->number_of_allocated_keys )
+	{
+		number_of_allocated_keys = manifest->number_of_allocated_keys * 2;
+
+		if( number_of_allocated_keys == 0 )
+		{
+			number_of_allocated_keys = 64;
+		}
+		reallocation = memory_reallocate(
+		                manifest->keys,
+		                sizeof( decryption_manifest_key_t ) * number_of_allocated_keys );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize keys.",
+			 function );
+
+			return( -1 );
+		}
+		manifest->keys                     = (decryption_manifest_key_t *) reallocation;
+		manifest->number_of_allocated_keys = number_of_allocated_keys;
+	}
+	key = &( manifest->keys[ manifest->number_of_keys ] );
+
+	if( memory_copy(
+	     key->data,
+	     key_data,
+	     key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key data.",
+		 function );
+
+		return( -1 );
+	}
+	key->data_size = key_data_size;
+	key->hash      = hash;
+
+	manifest->key_table[ slot_index ] = manifest->number_of_keys + 1;
+
+	*key_index = manifest->number_of_keys;
+
+	manifest->number_of_keys += 1;
+
+	return( 1 );
+}
+
+/* Parses a line of the manifest and appends its entry
+ * A line contains the offset, the size and the base16 formatted key of
+ * the encrypted data, separated by whitespace.
+ * Empty lines and lines starting with # are ignored
+ * Returns 1 if successful, 0 if the line is not valid or -1 on error
+ */
+int decryption_manifest_append_line(
+     decryption_manifest_t *manifest,
+     const char *line,
+     size_t line_length,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ DECRYPTION_MANIFEST_MAXIMUM_KEY_SIZE ];
+	const char *fields[ 3 ];
+	size_t field_lengths[ 3 ];
+	uint64_t values[ 2 ];
+
+	decryption_manifest_entry_t *entry = NULL;
+	void *reallocation                 = NULL;
+	static char *function              = "decryption_manifest_append_line";
+	size_t field_start                 = 0;
+	size_t key_data_size               = 0;
+	size_t line_index                  = 0;
+	int field_index                    = 0;
+	int key_index                      = 0;
+	int number_of_allocated_entries    = 0;
+	int number_of_fields               = 0;
+	int result                         = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	while( line_index < line_length )
+	{
+		while( ( line_index < line_length )
+		    && ( ( line[ line_index ] == ' ' )
+		     ||  ( line[ line_index ] == '\t' ) ) )
+		{
+			line_index++;
+		}
+		if( line_index >= line_length )
+		{
+			break;
+		}
+		if( ( number_of_fields == 0 )
+		 && ( line[ line_index ] == '#' ) )
+		{
+			return( 1 );
+		}
+		if( number_of_fields >= 3 )
+		{
+			return( 0 );
+		}
+		field_start = line_index;
+
+		while( ( line_index < line_length )
+		    && ( line[ line_index ] != ' ' )
+		    && ( line[ line_index ] != '\t' ) )
+		{
+			line_index++;
+		}
+		fields[ number_of_fields ]        = &( line[ field_start ] );
+		field_lengths[ number_of_fields ] = line_index - field_start;
+
+		number_of_fields++;
+	}
+	if( number_of_fields == 0 )
+	{
+		return( 1 );
+	}
+	if( number_of_fields != 3 )
+	{
+		return( 0 );
+	}
+	for( field_index = 0;
+	     field_index < 2;
+	     field_index++ )
+	{
+		result = decryption_manifest_parse_integer(
+		          fields[ field_index ],
+		          field_lengths[ field_index ],
+		          &( values[ field_index ] ),
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+	}
+	if( ( values[ 0 ] > (uint64_t) INT64_MAX )
+	 || ( values[ 1 ] == 0 )
+	 || ( values[ 1 ] > (uint64_t) SSIZE_MAX ) )
+	{
+		return( 0 );
+	}
+	result = decryption_manifest_parse_key(
+	          fields[ 2 ],
+	          field_lengths[ 2 ],
+	          key_data,
+	          DECRYPTION_MANIFEST_MAXIMUM_KEY_SIZE,
+	          &key_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = decryption_manifest_get_key_index(
+	          manifest,
+	          key_data,
+	          key_data_size,
+	          &key_index,
+	          error );
+
+	memory_set(
+	 key_data,
+	 0,
+	 DECRYPTION_MANIFEST_MAXIMUM_KEY_SIZE );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key index.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest->number_of_entries >= manifest->number_of_allocated_entries )
+	{
+		if( manifest->number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_entries = manifest->number_of_allocated_entries * 2;
+
+		if( number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 1024;
+		}
+		reallocation = memory_reallocate(
+		                manifest->entries,
+		                sizeof( decryption_manifest_entry_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		manifest->entries                     = (decryption_manifest_entry_t *) reallocation;
+		manifest->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( manifest->entries[ manifest->number_of_entries ] );
+
+	entry->offset    = (off64_t) values[ 0 ];
+	entry->data_size = (size_t) values[ 1 ];
+	entry->key_index = key_index;
+
+	manifest->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the entries of a manifest from a file
+ * Returns 1 if successful or -1 on error
+ */
+int decryption_manifest_read_file(
+     decryption_manifest_t *manifest,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char *line                = NULL;
+	FILE *manifest_stream     = NULL;
+	static char *function     = "decryption_manifest_read_file";
+	size_t line_length        = 0;
+	size_t line_number        = 0;
+	int result                = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	line = narrow_string_allocate(
+	        DECRYPTION_MANIFEST_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	manifest_stream = file_stream_open_wide(
+	                   filename,
+	                   _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	manifest_stream = file_stream_open(
+	                   filename,
+	                   FILE_STREAM_OPEN_READ );
+#endif
+	if( manifest_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open manifest: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	while( file_stream_get_string(
+	        manifest_stream,
+	        line,
+	        DECRYPTION_MANIFEST_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( DECRYPTION_MANIFEST_MAXIMUM_LINE_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %" PRIzd " value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == '\r' ) )
+		{
+			line_length--;
+		}
+		result = decryption_manifest_append_line(
+		          manifest,
+		          line,
+		          line_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid or unsupported line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     manifest_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close manifest.",
+		 function );
+
+		manifest_stream = NULL;
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( manifest_stream != NULL )
+	{
+		file_stream_close(
+		 manifest_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
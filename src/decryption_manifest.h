@@ -0,0 +1,158 @@
+/*
+ * Decryption manifest
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DECRYPTION_MANIFEST_H )
+#define _DECRYPTION_MANIFEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a line of the manifest
+ */
+#define DECRYPTION_MANIFEST_MAXIMUM_LINE_SIZE	1024
+
+/* The maximum size of a key
+ */
+#define DECRYPTION_MANIFEST_MAXIMUM_KEY_SIZE	256
+
+typedef struct decryption_manifest_entry decryption_manifest_entry_t;
+
+struct decryption_manifest_entry
+{
+	/* The offset of the encrypted data in the source
+	 */
+	off64_t offset;
+
+	/* The size of the encrypted data
+	 */
+	size_t data_size;
+
+	/* The index of the key
+	 */
+	int key_index;
+};
+
+typedef struct decryption_manifest_key decryption_manifest_key_t;
+
+struct decryption_manifest_key
+{
+	/* The key data
+	 */
+	uint8_t data[ DECRYPTION_MANIFEST_MAXIMUM_KEY_SIZE ];
+
+	/* The key data size
+	 */
+	size_t data_size;
+
+	/* The hash of the key data
+	 */
+	uint32_t hash;
+};
+
+typedef struct decryption_manifest decryption_manifest_t;
+
+struct decryption_manifest
+{
+	/* The entries
+	 */
+	decryption_manifest_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The distinct keys
+	 */
+	decryption_manifest_key_t *keys;
+
+	/* The number of keys
+	 */
+	int number_of_keys;
+
+	/* The number of allocated keys
+	 */
+	int number_of_allocated_keys;
+
+	/* The key lookup table, contains the key index + 1 or 0 if not set
+	 */
+	int *key_table;
+
+	/* The number of slots in the key lookup table, which is a power of 2
+	 */
+	int number_of_key_table_slots;
+};
+
+int decryption_manifest_initialize(
+     decryption_manifest_t **manifest,
+     libcerror_error_t **error );
+
+int decryption_manifest_free(
+     decryption_manifest_t **manifest,
+     libcerror_error_t **error );
+
+int decryption_manifest_parse_integer(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int decryption_manifest_parse_key(
+     const char *string,
+     size_t string_length,
+     uint8_t *key_data,
+     size_t key_data_size,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+int decryption_manifest_get_key_index(
+     decryption_manifest_t *manifest,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     int *key_index,
+     libcerror_error_t **error );
+
+int decryption_manifest_append_line(
+     decryption_manifest_t *manifest,
+     const char *line,
+     size_t line_length,
+     libcerror_error_t **error );
+
+int decryption_manifest_read_file(
+     decryption_manifest_t *manifest,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DECRYPTION_MANIFEST_H ) */
+
@@ -29,14 +29,20 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_async_file.h"
 #include "assorted_fletcher64.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_memory_map.h"
 #include "assorted_output.h"
 #include "assorted_system_string.h"
 
+/* The size of the chunks the source file is read in
+ */
+#define FLETCHER64SUM_CHUNK_SIZE	( 4 * 1024 * 1024 )
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -49,12 +55,14 @@ void usage_fprint(
 	fprintf( stream, "Use fletcher64sum to calculate a Fletcher-64 of file data.\n\n" );
 
 	fprintf( stream, "Usage: fletcher64sum [ -i initial_value ] [ -o offset ] [ -s size ]\n"
-	                 "[ -hvV ] source\n\n" );
+	                 "[ -AhMvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-A:     use asynchronous direct I/O instead of reading the source file\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial Fletcher-64 (default is 0)\n" );
+	fprintf( stream, "\t-M:     use memory mapped input instead of reading the source file\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is 0)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
@@ -70,19 +78,28 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "fletcher64sum";
-	system_integer_t option      = 0;
-	size_t source_size           = 0;
-	ssize_t read_count           = 0;
-	off_t source_offset          = 0;
-	uint64_t fletcher64          = 0;
-	uint64_t previous_key        = 0;
-	int result                   = 0;
-	int verbose                  = 0;
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *source_file      = NULL;
+	assorted_async_file_t *async_file = NULL;
+	assorted_memory_map_t *memory_map = NULL;
+	system_character_t *source        = NULL;
+	const uint8_t *chunk_data         = NULL;
+	uint8_t *buffer                   = NULL;
+	char *program                     = "fletcher64sum";
+	system_integer_t option           = 0;
+	size64_t remaining_size           = 0;
+	size64_t source_size              = 0;
+	size_t chunk_data_size            = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	off_t source_offset               = 0;
+	uint64_t chunk_fletcher64         = 0;
+	uint64_t fletcher64               = 0;
+	uint64_t previous_key             = 0;
+	int result                        = 0;
+	int use_asynchronous_io           = 0;
+	int use_memory_map                = 0;
+	int verbose                       = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -91,7 +108,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "AhMi:o:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -107,6 +124,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case 'A':
+				use_asynchronous_io = 1;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -118,6 +140,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'M':
+				use_memory_map = 1;
+
+				break;
+
 			case 'o':
 				source_offset = system_string_copy_to_long( optarg );
 
@@ -167,24 +194,113 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
+	if( use_memory_map != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		if( assorted_memory_map_initialize(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create memory map.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = assorted_memory_map_open(
+		          memory_map,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to memory map source file.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Memory mapped input not supported, reading source file instead.\n" );
+
+			if( assorted_memory_map_free(
+			     &memory_map,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free memory map.\n" );
+
+				goto on_error;
+			}
+		}
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
+	if( ( use_asynchronous_io != 0 )
+	 && ( memory_map == NULL ) )
+	{
+		if( assorted_async_file_initialize(
+		     &async_file,
+		     FLETCHER64SUM_CHUNK_SIZE,
+		     ASSORTED_ASYNC_FILE_DEFAULT_QUEUE_DEPTH,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create asynchronous file.\n" );
 
-	if( buffer == NULL )
+			goto on_error;
+		}
+		result = assorted_async_file_open(
+		          async_file,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file for asynchronous I/O.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Asynchronous I/O not supported, reading source file instead.\n" );
+
+			if( assorted_async_file_free(
+			     &async_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free asynchronous file.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( memory_map == NULL )
+	 && ( async_file == NULL ) )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * FLETCHER64SUM_CHUNK_SIZE );
 
-		goto on_error;
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Open the source file
 	 */
@@ -233,19 +349,121 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	/* The data is read in chunks, where the Fletcher-64 of every chunk
+	 * is combined with the Fletcher-64 of the preceding chunks
+	 */
+	remaining_size = source_size;
 
-	if( read_count != (ssize_t) source_size )
+	while( remaining_size > 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		read_size = FLETCHER64SUM_CHUNK_SIZE;
 
-		goto on_error;
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		if( memory_map != NULL )
+		{
+			chunk_data = &( memory_map->data[ source_size - remaining_size ] );
+		}
+		else if( async_file != NULL )
+		{
+			result = assorted_async_file_read_next(
+			          async_file,
+			          &chunk_data,
+			          &chunk_data_size,
+			          &error );
+
+			if( ( result != 1 )
+			 || ( chunk_data_size != read_size ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      buffer,
+				      read_size,
+				      &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			chunk_data = buffer;
+		}
+		if( assorted_fletcher64_calculate_simd(
+		     &chunk_fletcher64,
+		     chunk_data,
+		     read_size,
+		     previous_key,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate Fletcher-64.\n" );
+
+			goto on_error;
+		}
+		if( remaining_size == source_size )
+		{
+			fletcher64 = chunk_fletcher64;
+		}
+		else if( assorted_fletcher64_combine(
+		          &fletcher64,
+		          fletcher64,
+		          chunk_fletcher64,
+		          (size64_t) read_size,
+		          &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to combine Fletcher-64.\n" );
+
+			goto on_error;
+		}
+		libcnotify_print_data(
+		 chunk_data,
+		 read_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		remaining_size -= read_size;
+	}
+	if( memory_map != NULL )
+	{
+		if( assorted_memory_map_free(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free memory map.\n" );
+
+			goto on_error;
+		}
+	}
+	if( async_file != NULL )
+	{
+		if( assorted_async_file_free(
+		     &async_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free asynchronous file.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
@@ -269,23 +487,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( assorted_fletcher64_calculate(
-	     &fletcher64,
-	     buffer,
-	     source_size,
-	     previous_key,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate Fletcher-64.\n" );
-
-		goto on_error;
-	}
-	libcnotify_print_data(
-	 buffer,
-	 source_size,
-	 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 
 	memory_free(
 	 buffer );
@@ -306,6 +507,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( async_file != NULL )
+	{
+		assorted_async_file_free(
+		 &async_file,
+		 NULL );
+	}
 	if( buffer != NULL )
 	{
 		memory_free(
@@ -35,6 +35,7 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_libfmos.h"
+#include "assorted_lzfse.h"
 #include "assorted_output.h"
 #include "assorted_system_string.h"
 
@@ -49,14 +50,20 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use lzfsedecompress to decompress data as LZFSE compressed data.\n\n" );
 
-	fprintf( stream, "Usage: lzfsedecompress [ -d size ] [ -o offset ] [ -s size ] [ -hvV ]\n"
-	                 "       source\n\n" );
+	fprintf( stream, "Usage: lzfsedecompress [ -d size ] [ -o offset ]\n"
+	                 "                       [ -j number_of_threads ] [ -s size ]\n"
+	                 "                       [ -12hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-1:     use the libfmos decompression method (default)\n" );
+	fprintf( stream, "\t-2:     use the native decompression method\n" );
 	fprintf( stream, "\t-d:     size of the decompressed data (default is 16384).\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     entropy decode the blocks in parallel using the number\n"
+	                 "\t        of threads, implies -2\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     same as -j\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
@@ -86,6 +93,8 @@ int main( int argc, char * const argv[] )
 	ssize_t read_count                = 0;
 	ssize_t write_count               = 0;
 	off_t source_offset               = 0;
+	int decompression_method          = 1;
+	int number_of_threads             = 0;
 	int print_count                   = 0;
 	int result                        = 0;
 	int verbose                       = 0;
@@ -97,7 +106,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "d:ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12d:hj:o:p:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -113,6 +122,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) '1':
+				decompression_method = 1;
+
+				break;
+
+			case (system_integer_t) '2':
+				decompression_method = 2;
+
+				break;
+
 			case (system_integer_t) 'd':
 				uncompressed_data_size = system_string_copy_to_long( optarg );
 
@@ -129,6 +148,12 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'j':
+			case 'p':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
 			case 's':
 				source_size = system_string_copy_to_long( optarg );
 
@@ -159,6 +184,23 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( number_of_threads < 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_threads > 0 )
+	{
+		decompression_method = 2;
+	}
+	else
+	{
+		number_of_threads = 1;
+	}
+
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -299,12 +341,26 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfmos_lzfse_decompress(
-	     buffer,
-	     source_size,
-	     uncompressed_data,
-	     &uncompressed_data_size,
-	     &error ) != 1 )
+	if( decompression_method == 2 )
+	{
+		result = assorted_lzfse_decompress(
+		          buffer,
+		          (size_t) source_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          number_of_threads,
+		          &error );
+	}
+	else
+	{
+		result = libfmos_lzfse_decompress(
+		          buffer,
+		          (size_t) source_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
+	if( result != 1 )
 	{
 		fprintf(
 		 stderr,
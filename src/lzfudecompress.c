@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -35,9 +36,12 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_lzfu.h"
+#include "assorted_lzfu_parallel.h"
 #include "assorted_output.h"
 #include "assorted_system_string.h"
 
+#define LZFUDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS	64
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -49,11 +53,17 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use lzfudecompress to decompress data as LZFu compressed data.\n\n" );
 
-	fprintf( stream, "Usage: lzfudecompress [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: lzfudecompress [ -j number_of_threads ] [ -o offset ] [ -s size ]\n"
+	                 "                      [ -bhvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-b:     the source contains consecutive LZFu compressed items, such\n"
+	                 "\t        as compressed RTF streams, that are decompressed as a batch\n"
+	                 "\t        and written in order\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to decompress the items of a batch\n"
+	                 "\t        (default is 1)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
@@ -71,22 +81,31 @@ int main( int argc, char * const argv[] )
 {
 	char destination[ 128 ];
 
-	libcerror_error_t *error          = NULL;
-	libcfile_file_t *destination_file = NULL;
-	libcfile_file_t *source_file      = NULL;
-	system_character_t *source        = NULL;
-	uint8_t *buffer                   = NULL;
-	uint8_t *uncompressed_data        = NULL;
-	char *program                     = "lzfudecompress";
-	system_integer_t option           = 0;
-	size64_t source_size              = 0;
-	size_t uncompressed_data_size     = 0;
-	ssize_t read_count                = 0;
-	ssize_t write_count               = 0;
-	off_t source_offset               = 0;
-	int print_count                   = 0;
-	int result                        = 0;
-	int verbose                       = 0;
+	assorted_lzfu_parallel_item_t *items = NULL;
+	libcerror_error_t *error             = NULL;
+	libcfile_file_t *destination_file    = NULL;
+	libcfile_file_t *source_file         = NULL;
+	system_character_t *source           = NULL;
+	uint8_t *buffer                      = NULL;
+	uint8_t *uncompressed_data           = NULL;
+	char *program                        = "lzfudecompress";
+	system_integer_t option              = 0;
+	size64_t source_size                 = 0;
+	size_t compressed_data_offset        = 0;
+	size_t item_index                    = 0;
+	size_t item_size                     = 0;
+	size_t number_of_items               = 0;
+	size_t uncompressed_data_offset      = 0;
+	size_t uncompressed_data_size        = 0;
+	ssize_t read_count                   = 0;
+	ssize_t write_count                  = 0;
+	off_t source_offset                  = 0;
+	uint32_t value_32bit                 = 0;
+	int batch                            = 0;
+	int number_of_threads                = 1;
+	int print_count                      = 0;
+	int result                           = 0;
+	int verbose                          = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -95,7 +114,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "bhj:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -111,12 +130,23 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case 'b':
+				batch = 1;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
 			case 'o':
 				source_offset = system_string_copy_to_long( optarg );
 
@@ -150,6 +180,15 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LZFUDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	source = argv[ optind ];
 
 	libcnotify_stream_set(
@@ -232,19 +271,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	uncompressed_data_size = source_size * 16;
-
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
 	/* Position the source file at the right offset
 	 */
 	if( libcfile_file_seek_offset(
@@ -290,18 +316,187 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( assorted_lzfu_decompress(
-	     buffer,
-	     source_size,
-	     uncompressed_data,
-	     &uncompressed_data_size,
-	     &error ) != 1 )
+	if( batch == 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to decompress data.\n" );
+		uncompressed_data_size = source_size * 16;
 
-		goto on_error;
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		if( assorted_lzfu_decompress(
+		     buffer,
+		     source_size,
+		     uncompressed_data,
+		     &uncompressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress data.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		/* The compressed data size in the header of an item excludes
+		 * the 4 bytes of the compressed data size itself
+		 */
+		while( compressed_data_offset < (size_t) source_size )
+		{
+			if( ( (size_t) source_size - compressed_data_offset ) < sizeof( assorted_lzfu_header_t ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid item: %" PRIzd " size value too small.\n",
+				 number_of_items );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ compressed_data_offset ] ),
+			 value_32bit );
+
+			item_size = (size_t) value_32bit + 4;
+
+			if( ( item_size < sizeof( assorted_lzfu_header_t ) )
+			 || ( item_size > ( (size_t) source_size - compressed_data_offset ) ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid item: %" PRIzd " size value out of bounds.\n",
+				 number_of_items );
+
+				goto on_error;
+			}
+			compressed_data_offset += item_size;
+
+			number_of_items++;
+		}
+		items = (assorted_lzfu_parallel_item_t *) memory_allocate(
+		                                           sizeof( assorted_lzfu_parallel_item_t ) * number_of_items );
+
+		if( items == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create items.\n" );
+
+			goto on_error;
+		}
+		compressed_data_offset = 0;
+
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ compressed_data_offset ] ),
+			 value_32bit );
+
+			items[ item_index ].compressed_data      = &( buffer[ compressed_data_offset ] );
+			items[ item_index ].compressed_data_size = (size_t) value_32bit + 4;
+
+			if( assorted_lzfu_get_uncompressed_data_size(
+			     items[ item_index ].compressed_data,
+			     items[ item_index ].compressed_data_size,
+			     &( items[ item_index ].uncompressed_data_size ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to determine uncompressed data size of item: %" PRIzd ".\n",
+				 item_index );
+
+				goto on_error;
+			}
+			if( items[ item_index ].uncompressed_data_size > ( (size_t) SSIZE_MAX - uncompressed_data_size ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid uncompressed data size value exceeds maximum.\n" );
+
+				goto on_error;
+			}
+			compressed_data_offset += items[ item_index ].compressed_data_size;
+			uncompressed_data_size += items[ item_index ].uncompressed_data_size;
+		}
+		if( uncompressed_data_size == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid uncompressed data size value is zero.\n" );
+
+			goto on_error;
+		}
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			items[ item_index ].uncompressed_data = &( uncompressed_data[ uncompressed_data_offset ] );
+
+			uncompressed_data_offset += items[ item_index ].uncompressed_data_size;
+		}
+		result = assorted_lzfu_parallel_decompress(
+		          items,
+		          number_of_items,
+		          number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress items.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* Decompress the first item that failed again to retrieve the error
+			 */
+			for( item_index = 0;
+			     item_index < number_of_items;
+			     item_index++ )
+			{
+				if( items[ item_index ].result != 1 )
+				{
+					break;
+				}
+			}
+			assorted_lzfu_decompress(
+			 items[ item_index ].compressed_data,
+			 items[ item_index ].compressed_data_size,
+			 items[ item_index ].uncompressed_data,
+			 &( items[ item_index ].uncompressed_data_size ),
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unable to decompress item: %" PRIzd ".\n",
+			 item_index );
+
+			goto on_error;
+		}
 	}
 	/* Open the destination file
 	 */
@@ -336,19 +531,47 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	write_count = libcfile_file_write_buffer(
-		       destination_file,
-		       uncompressed_data,
-		       uncompressed_data_size,
-		       &error );
+	if( batch == 0 )
+	{
+		write_count = libcfile_file_write_buffer(
+			       destination_file,
+			       uncompressed_data,
+			       uncompressed_data_size,
+			       &error );
 
-	if( write_count != (ssize_t) uncompressed_data_size )
+		if( write_count != (ssize_t) uncompressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
+	}
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to write to destination file.\n" );
+		/* An item can decompress to less than the size in its header
+		 */
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			write_count = libcfile_file_write_buffer(
+				       destination_file,
+				       items[ item_index ].uncompressed_data,
+				       items[ item_index ].uncompressed_data_size,
+				       &error );
+
+			if( write_count != (ssize_t) items[ item_index ].uncompressed_data_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write item: %" PRIzd " to destination file.\n",
+				 item_index );
 
-		goto on_error;
+				goto on_error;
+			}
+		}
 	}
 	/* Clean up
 	 */
@@ -392,6 +615,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( items != NULL )
+	{
+		memory_free(
+		 items );
+	}
 	memory_free(
 	 uncompressed_data );
 
@@ -426,6 +654,11 @@ on_error:
 		 &destination_file,
 		 NULL );
 	}
+	if( items != NULL )
+	{
+		memory_free(
+		 items );
+	}
 	if( uncompressed_data != NULL )
 	{
 		memory_free(
@@ -39,8 +39,18 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_lzma.h"
+#include "assorted_lzma_parallel.h"
+#include "assorted_lzma_stream.h"
 #include "assorted_output.h"
+#include "assorted_progress.h"
+#include "assorted_signal.h"
 #include "assorted_system_string.h"
+#include "assorted_unused.h"
+
+#define LZMADECOMPRESS_MINIMUM_BUFFER_SIZE	65536
+#define LZMADECOMPRESS_READ_BUFFER_SIZE		( 1024 * 1024 )
+
+assorted_progress_t *lzmadecompress_progress = NULL;
 
 /* Prints the executable usage information
  */
@@ -53,23 +63,586 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use lzmadecompress to decompress data as LZMA compressed data.\n\n" );
 
-	fprintf( stream, "Usage: lzmadecompress [ -d size ] [ -o offset ] [ -s size ] [ -12hvV ]\n"
-	                 "       source\n\n" );
+	fprintf( stream, "Usage: lzmadecompress [ -d size ] [ -o offset ] [ -s size ]\n"
+	                 "                      [ -j number_of_threads ] [ -12ThvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the liblzma decompression method\n" );
 	fprintf( stream, "\t-2:     use the internal decompression method (default)\n" );
-	fprintf( stream, "\t-d:     size of the decompressed data (default is 16 times the size\n"
-	                 "\t        of the data)).\n" );
+	fprintf( stream, "\t-d:     size of the decompressed data buffer of the multi-threaded\n"
+	                 "\t        internal decompression method (default is the size stored\n"
+	                 "\t        in the index or to grow the buffer as needed)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used by the internal decompression\n"
+	                 "\t        method (default is 1), the blocks listed in the index\n"
+	                 "\t        are decompressed in parallel\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-T:     only verify the compressed data, the decompressed data\n"
+	                 "\t        is not stored\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Signal handler for lzmadecompress
+ */
+void lzmadecompress_signal_handler(
+      assorted_signal_t signal ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( signal )
+
+	assorted_progress_signal_abort(
+	 lzmadecompress_progress );
+}
+
+/* Writes uncompressed data to the destination file, if set, and updates the progress
+ * Returns 1 on success or -1 on error
+ */
+int lzmadecompress_write_data(
+     intptr_t *destination_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "lzmadecompress_write_data";
+	ssize_t write_count   = 0;
+	int result            = 0;
+
+	if( destination_file != NULL )
+	{
+		write_count = libcfile_file_write_buffer(
+		               (libcfile_file_t *) destination_file,
+		               data,
+		               data_size,
+		               error );
+
+		if( write_count != (ssize_t) data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data to destination file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( lzmadecompress_progress != NULL )
+	{
+		result = assorted_progress_update(
+		          lzmadecompress_progress,
+		          lzmadecompress_progress->bytes_read,
+		          lzmadecompress_progress->bytes_written + data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads compressed data from the source file and updates the progress
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t lzmadecompress_read_data(
+         libcfile_file_t *source_file,
+         uint8_t *data,
+         size_t read_size,
+         size64_t source_size,
+         size64_t *remaining_size,
+         libcerror_error_t **error )
+{
+	static char *function = "lzmadecompress_read_data";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( remaining_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid remaining size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) read_size > *remaining_size )
+	{
+		read_size = (size_t) *remaining_size;
+	}
+	read_count = libcfile_file_read_buffer(
+	              source_file,
+	              data,
+	              read_size,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data from source file.",
+		 function );
+
+		return( -1 );
+	}
+	*remaining_size -= read_size;
+
+	if( lzmadecompress_progress != NULL )
+	{
+		result = assorted_progress_update(
+		          lzmadecompress_progress,
+		          (uint64_t) ( source_size - *remaining_size ),
+		          lzmadecompress_progress->bytes_written,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
+/* Decompresses the compressed data from the source file with the internal stream decoder,
+ * the source file is read in parts and only the dictionary is kept in memory
+ * Returns 1 on success or -1 on error
+ */
+int lzmadecompress_decompress_stream(
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     libcfile_file_t *destination_file,
+     uint64_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_lzma_stream_t *stream = NULL;
+	uint8_t *buffer                = NULL;
+	void *reallocation             = NULL;
+	static char *function          = "lzmadecompress_decompress_stream";
+	size64_t remaining_size        = source_size;
+	size_t buffer_offset           = 0;
+	size_t buffer_size             = LZMADECOMPRESS_READ_BUFFER_SIZE;
+	size_t data_size               = 0;
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* When verifying the destination file is not set and the data is only counted
+	 */
+	if( assorted_lzma_stream_initialize(
+	     &stream,
+	     &lzmadecompress_write_data,
+	     (intptr_t *) destination_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		/* The part of the buffer that was not consumed by the stream is kept, the buffer
+		 * is only grown when a single part, such as the index, does not fit
+		 */
+		if( buffer_offset > 0 )
+		{
+			if( memory_move(
+			     buffer,
+			     &( buffer[ buffer_offset ] ),
+			     data_size - buffer_offset ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move remaining data.",
+				 function );
+
+				goto on_error;
+			}
+			data_size    -= buffer_offset;
+			buffer_offset = 0;
+		}
+		else if( data_size == buffer_size )
+		{
+			if( buffer_size > ( (size_t) SSIZE_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid buffer size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = memory_reallocate(
+			                buffer,
+			                sizeof( uint8_t ) * buffer_size * 2 );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize buffer.",
+				 function );
+
+				goto on_error;
+			}
+			buffer       = (uint8_t *) reallocation;
+			buffer_size *= 2;
+		}
+		if( remaining_size > 0 )
+		{
+			read_count = lzmadecompress_read_data(
+			              source_file,
+			              &( buffer[ data_size ] ),
+			              buffer_size - data_size,
+			              source_size,
+			              &remaining_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data.",
+				 function );
+
+				goto on_error;
+			}
+			data_size += (size_t) read_count;
+		}
+		result = assorted_lzma_stream_feed(
+		          stream,
+		          buffer,
+		          data_size,
+		          &buffer_offset,
+		          (uint8_t) ( remaining_size == 0 ),
+		          error );
+
+		if( ( result == -1 )
+		 || ( ( result == 0 )
+		  &&  ( remaining_size == 0 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result == 0 );
+
+	*uncompressed_data_size = stream->uncompressed_data_size;
+
+	if( assorted_lzma_stream_free(
+	     &stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		assorted_lzma_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
+
+/* Decompresses the compressed data from the source file using liblzma,
+ * the source file is read in parts and the uncompressed data is written
+ * to the destination file, if set, as it is decoded
+ * Returns 1 on success or -1 on error
+ */
+int lzmadecompress_decompress_liblzma(
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     libcfile_file_t *destination_file,
+     uint64_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	lzma_stream lzma_compressed_stream = LZMA_STREAM_INIT;
+	uint8_t *compressed_data           = NULL;
+	uint8_t *uncompressed_data         = NULL;
+	static char *function              = "lzmadecompress_decompress_liblzma";
+	size64_t remaining_size            = source_size;
+	size_t write_size                  = 0;
+	ssize_t read_count                 = 0;
+	lzma_action lzma_action            = LZMA_RUN;
+	lzma_ret lzma_result               = LZMA_OK;
+	int lzma_initialized               = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * LZMADECOMPRESS_READ_BUFFER_SIZE );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The uncompressed data is decoded into a buffer that is overwritten
+	 * for every part, liblzma verifies the integrity check of every block
+	 */
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * LZMADECOMPRESS_READ_BUFFER_SIZE );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( lzma_stream_decoder(
+	     &lzma_compressed_stream,
+	     UINT64_MAX,
+	     0 ) != LZMA_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	lzma_initialized = 1;
+
+	do
+	{
+		if( ( lzma_compressed_stream.avail_in == 0 )
+		 && ( remaining_size > 0 ) )
+		{
+			read_count = lzmadecompress_read_data(
+			              source_file,
+			              compressed_data,
+			              LZMADECOMPRESS_READ_BUFFER_SIZE,
+			              source_size,
+			              &remaining_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data.",
+				 function );
+
+				goto on_error;
+			}
+			lzma_compressed_stream.next_in  = compressed_data;
+			lzma_compressed_stream.avail_in = (size_t) read_count;
+
+			if( remaining_size == 0 )
+			{
+				lzma_action = LZMA_FINISH;
+			}
+		}
+		lzma_compressed_stream.next_out  = uncompressed_data;
+		lzma_compressed_stream.avail_out = LZMADECOMPRESS_READ_BUFFER_SIZE;
+
+		/* The compressed data is truncated if no more data can be decoded
+		 * after the last part was read, liblzma then returns LZMA_BUF_ERROR
+		 */
+		lzma_result = lzma_code(
+		               &lzma_compressed_stream,
+		               lzma_action );
+
+		if( ( lzma_result != LZMA_OK )
+		 && ( lzma_result != LZMA_STREAM_END ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data with error: %d.",
+			 function,
+			 lzma_result );
+
+			goto on_error;
+		}
+		write_size = LZMADECOMPRESS_READ_BUFFER_SIZE - lzma_compressed_stream.avail_out;
+
+		if( write_size > 0 )
+		{
+			if( lzmadecompress_write_data(
+			     (intptr_t *) destination_file,
+			     uncompressed_data,
+			     write_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	while( lzma_result != LZMA_STREAM_END );
+
+	*uncompressed_data_size = (uint64_t) lzma_compressed_stream.total_out;
+
+	lzma_end(
+	 &lzma_compressed_stream );
+
+	memory_free(
+	 uncompressed_data );
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( lzma_initialized != 0 )
+	{
+		lzma_end(
+		 &lzma_compressed_stream );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -86,22 +659,25 @@ int main( int argc, char * const argv[] )
 	system_character_t *source         = NULL;
 	uint8_t *buffer                    = NULL;
 	uint8_t *uncompressed_data         = NULL;
+	void *reallocation                 = NULL;
 	char *program                      = "lzmadecompress";
 	system_integer_t option            = 0;
 	size64_t source_size               = 0;
+	uint64_t index_uncompressed_size   = 0;
+	uint64_t total_uncompressed_size   = 0;
+	size_t safe_uncompressed_data_size = 0;
 	size_t uncompressed_data_size      = 0;
 	ssize_t read_count                 = 0;
 	ssize_t write_count                = 0;
 	off_t source_offset                = 0;
+	uint8_t grow_uncompressed_data     = 0;
+	uint8_t verify_data                = 0;
 	int decompression_method           = 2;
+	int number_of_threads              = 1;
 	int print_count                    = 0;
 	int result                         = 0;
 	int verbose                        = 0;
 
-#if defined( HAVE_LIBLZMA ) || defined( LIBLZMA_DLL )
-	lzma_stream lzma_compressed_stream = LZMA_STREAM_INIT;
-#endif
-
 	assorted_output_version_fprint(
 	 stdout,
 	 program );
@@ -109,7 +685,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12d:ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12d:hj:o:s:t:TvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -156,6 +732,17 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'T':
+				verify_data = 1;
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -181,12 +768,45 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( number_of_threads < 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value zero or less.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	/* The progress is only reported in verbose mode but the abort flag is always checked
+	 */
+	if( assorted_progress_initialize(
+	     &lzmadecompress_progress,
+	     ASSORTED_PROGRESS_DEFAULT_INTERVAL,
+	     ( verbose != 0 ) ? &assorted_progress_fprint : NULL,
+	     (void *) stderr,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create progress.\n" );
+
+		goto on_error;
+	}
+	if( assorted_signal_attach(
+	     lzmadecompress_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
@@ -242,40 +862,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) ( SSIZE_MAX / 16 ) )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
-	}
-	if( uncompressed_data_size == 0 )
-	{
-		uncompressed_data_size = source_size * 16;
-	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
 	/* Position the source file at the right offset
 	 */
 	if( libcfile_file_seek_offset(
@@ -305,22 +891,47 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Read and decompress the data
-	 */
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
+	if( verify_data == 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		/* Open the destination file
+		 */
+		if( libcfile_file_initialize(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create destination file.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          destination_file,
+		          destination,
+		          LIBCFILE_OPEN_WRITE,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          destination_file,
+		          destination,
+		          LIBCFILE_OPEN_WRITE,
+		          &error );
+#endif
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open destination file.\n" );
+
+			goto on_error;
+		}
 	}
+	/* The liblzma and the single-threaded internal decompression methods read
+	 * the source file in parts and write the uncompressed data while it is decoded,
+	 * the multi-threaded internal decompression method requires all compressed data
+	 * in memory since the blocks listed in the index are decompressed in parallel
+	 */
 	if( decompression_method == 1 )
 	{
 #if !defined( HAVE_LIBLZMA ) && !defined( LIBLZMA_DLL )
@@ -331,124 +942,279 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 
 #else
-		if( lzma_stream_decoder(
-		     &lzma_compressed_stream,
-		     UINT64_MAX,
-		     0 ) != LZMA_OK )
+		if( lzmadecompress_decompress_liblzma(
+		     source_file,
+		     source_size,
+		     destination_file,
+		     &total_uncompressed_size,
+		     &error ) != 1 )
+		{
+			if( lzmadecompress_progress->abort != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Aborted.\n" );
+			}
+			else
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+			}
+			goto on_error;
+		}
+#endif /* !defined( HAVE_LIBLZMA ) && !defined( LIBLZMA_DLL ) */
+	}
+	else if( number_of_threads == 1 )
+	{
+		if( lzmadecompress_decompress_stream(
+		     source_file,
+		     source_size,
+		     destination_file,
+		     &total_uncompressed_size,
+		     &error ) != 1 )
+		{
+			if( lzmadecompress_progress->abort != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Aborted.\n" );
+			}
+			else
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+			}
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( source_size > (size64_t) ( SSIZE_MAX / 4 ) )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to decompress data.\n" );
+			 "Invalid source size value exceeds maximum.\n" );
 
 			goto on_error;
 		}
-		lzma_compressed_stream.next_in   = buffer;
-		lzma_compressed_stream.avail_in  = source_size;
-		lzma_compressed_stream.next_out  = uncompressed_data;
-		lzma_compressed_stream.avail_out = uncompressed_data_size;
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * source_size );
 
-		if( lzma_code(
-		     &lzma_compressed_stream,
-		     LZMA_RUN ) != LZMA_STREAM_END )
+		if( buffer == NULL )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to decompress data.\n" );
+			 "Unable to create buffer.\n" );
 
 			goto on_error;
 		}
-		uncompressed_data_size = (size_t) lzma_compressed_stream.total_out;
+		read_count = libcfile_file_read_buffer(
+		              source_file,
+		              buffer,
+		              (size_t) source_size,
+		              &error );
 
-		lzma_end(
-		 &lzma_compressed_stream );
+		if( read_count != (ssize_t) source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
 
-#endif /* !defined( HAVE_BZLIB ) && !defined( BZ_DLL ) */
-	}
-	else if( decompression_method == 2 )
-	{
-		if( assorted_lzma_decompress(
-		     buffer,
-		     source_size,
-		     uncompressed_data,
-		     &uncompressed_data_size,
-		     &error ) != 1 )
+			goto on_error;
+		}
+		result = assorted_progress_update(
+		          lzmadecompress_progress,
+		          (uint64_t) source_size,
+		          0,
+		          &error );
+
+		if( result == -1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to decompress data.\n" );
+			 "Unable to update progress.\n" );
 
 			goto on_error;
 		}
-	}
-	/* Open the destination file
-	 */
-	if( libcfile_file_initialize(
-	     &destination_file,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create destination file.\n" );
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		/* Without an explicit size the uncompressed data buffer is sized from
+		 * the index, otherwise it starts at 4 times the size of the compressed
+		 * data, and is doubled when the data does not fit
+		 */
+		if( uncompressed_data_size == 0 )
+		{
+			grow_uncompressed_data = 1;
+
+			result = assorted_lzma_get_uncompressed_data_size(
+			          buffer,
+			          (size_t) source_size,
+			          &index_uncompressed_size,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_free(
+				 &error );
+			}
+			if( ( result == 1 )
+			 && ( index_uncompressed_size > 0 )
+			 && ( index_uncompressed_size <= (uint64_t) SSIZE_MAX ) )
+			{
+				uncompressed_data_size = (size_t) index_uncompressed_size;
+			}
+			else
+			{
+				uncompressed_data_size = (size_t) source_size * 4;
+
+				if( uncompressed_data_size < LZMADECOMPRESS_MINIMUM_BUFFER_SIZE )
+				{
+					uncompressed_data_size = LZMADECOMPRESS_MINIMUM_BUFFER_SIZE;
+				}
+			}
+		}
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		do
+		{
+			safe_uncompressed_data_size = uncompressed_data_size;
+
+			result = assorted_lzma_parallel_decompress(
+			          buffer,
+			          source_size,
+			          number_of_threads,
+			          uncompressed_data,
+			          &safe_uncompressed_data_size,
+			          &error );
+
+			if( result == 1 )
+			{
+				uncompressed_data_size = safe_uncompressed_data_size;
+			}
+			else if( ( grow_uncompressed_data == 0 )
+			      || ( libcerror_error_matches(
+			            error,
+			            LIBCERROR_ERROR_DOMAIN_OUTPUT,
+			            LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE ) == 0 )
+			      || ( uncompressed_data_size > ( (size_t) SSIZE_MAX / 2 ) ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+
+				goto on_error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &error );
+
+				uncompressed_data_size *= 2;
+
+				reallocation = memory_reallocate(
+				                uncompressed_data,
+				                sizeof( uint8_t ) * uncompressed_data_size );
+
+				if( reallocation == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to resize uncompressed data buffer.\n" );
+
+					goto on_error;
+				}
+				uncompressed_data = (uint8_t *) reallocation;
+			}
+		}
+		while( result != 1 );
+
+		total_uncompressed_size = (uint64_t) uncompressed_data_size;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          destination_file,
-	          destination,
-	          LIBCFILE_OPEN_WRITE,
-	          &error );
-#else
-	result = libcfile_file_open(
-	          destination_file,
-	          destination,
-	          LIBCFILE_OPEN_WRITE,
-	          &error );
-#endif
- 	if( result != 1 )
+	if( verify_data != 0 )
 	{
 		fprintf(
-		 stderr,
-		 "Unable to open destination file.\n" );
-
-		goto on_error;
+		 stdout,
+		 "Verified %" PRIu64 " bytes of uncompressed data.\n",
+		 total_uncompressed_size );
 	}
-	write_count = libcfile_file_write_buffer(
-		       destination_file,
-		       uncompressed_data,
-		       uncompressed_data_size,
-		       &error );
-
-	if( write_count != (ssize_t) uncompressed_data_size )
+	else if( uncompressed_data != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to write to destination file.\n" );
+		write_count = libcfile_file_write_buffer(
+			       destination_file,
+			       uncompressed_data,
+			       uncompressed_data_size,
+			       &error );
 
-		goto on_error;
+		if( write_count != (ssize_t) uncompressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
-	if( libcfile_file_close(
-	     destination_file,
-	     &error ) != 0 )
+	if( assorted_signal_detach(
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to close destination file.\n" );
+		 "Unable to detach signal handler.\n" );
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
-	     &destination_file,
+	if( assorted_progress_free(
+	     &lzmadecompress_progress,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to free destination file.\n" );
+		 "Unable to free progress.\n" );
 
 		goto on_error;
 	}
+	if( destination_file != NULL )
+	{
+		if( libcfile_file_close(
+		     destination_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close destination file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free destination file.\n" );
+
+			goto on_error;
+		}
+	}
 	if( libcfile_file_close(
 	     source_file,
 	     &error ) != 0 )
@@ -469,9 +1235,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 uncompressed_data );
-
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
 	memory_free(
 	 buffer );
 
@@ -497,6 +1265,14 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( lzmadecompress_progress != NULL )
+	{
+		assorted_signal_detach(
+		 NULL );
+		assorted_progress_free(
+		 &lzmadecompress_progress,
+		 NULL );
+	}
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
@@ -34,6 +34,7 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_libfwnt.h"
+#include "assorted_lznt1_parallel.h"
 #include "assorted_output.h"
 #include "assorted_system_string.h"
 
@@ -100,10 +101,12 @@ void usage_fprint(
 	fprintf( stream, "Use lznt1decompress to decompress LZNT1 compressed data.\n\n" );
 
 #if defined( WINAPI )
-	fprintf( stream, "Usage: lznt1decompress [ -d size ] [ -o offset ] [ -s size ]\n"
+	fprintf( stream, "Usage: lznt1decompress [ -d size ] [ -o offset ]\n"
+	                 "                       [ -j number_of_threads ] [ -s size ]\n"
 	                 "                       [ -t target ] [ -12hvV ] source\n\n" );
 #else
-	fprintf( stream, "Usage: lznt1decompress [ -d size ] [ -o offset ] [ -s size ]\n"
+	fprintf( stream, "Usage: lznt1decompress [ -d size ] [ -o offset ]\n"
+	                 "                       [ -j number_of_threads ] [ -s size ]\n"
 	                 "                       [ -t target ] [ -hvV ] source\n\n" );
 #endif
 
@@ -115,7 +118,10 @@ void usage_fprint(
 #endif
 	fprintf( stream, "\t-d:     size of the decompressed data (default is 65536).\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     decompress the chunks in parallel using the number of\n"
+	                 "\t        threads\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     same as -j\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
 	                 "\t        by default the data will be written to stdout in\n"
@@ -149,6 +155,7 @@ int main( int argc, char * const argv[] )
 	ssize_t read_count                       = 0;
 	ssize_t write_count                      = 0;
 	off_t source_offset                      = 0;
+	int number_of_threads                    = 0;
 	int result                               = 0;
 	int verbose                              = 0;
 
@@ -162,9 +169,9 @@ int main( int argc, char * const argv[] )
 	 program );
 
 #if defined( WINAPI )
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV12" );
+	options_string = _SYSTEM_STRING( "d:hj:o:p:s:t:vV12" );
 #else
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV" );
+	options_string = _SYSTEM_STRING( "d:hj:o:p:s:t:vV" );
 #endif
 	while( ( option = assorted_getopt(
 	                   argc,
@@ -209,6 +216,11 @@ int main( int argc, char * const argv[] )
 				source_offset = system_string_copy_to_long( optarg );
 				break;
 
+			case (system_integer_t) 'j':
+			case (system_integer_t) 'p':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+				break;
+
 			case (system_integer_t) 's':
 				source_size = system_string_copy_to_long( optarg );
 				break;
@@ -243,6 +255,14 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( number_of_threads < 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -433,12 +453,25 @@ int main( int argc, char * const argv[] )
 	else if( decompression_method == 2 )
 #endif
 	{
-		result = libfwnt_lznt1_decompress(
-		          buffer,
-		          (size_t) source_size,
-		          uncompressed_data,
-		          &uncompressed_data_size,
-		          &error );
+		if( number_of_threads > 0 )
+		{
+			result = assorted_lznt1_parallel_decompress(
+			          buffer,
+			          (size_t) source_size,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          number_of_threads,
+			          &error );
+		}
+		else
+		{
+			result = libfwnt_lznt1_decompress(
+			          buffer,
+			          (size_t) source_size,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          &error );
+		}
 	}
 	if( result == -1 )
 	{
@@ -35,6 +35,7 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_libfmos.h"
+#include "assorted_lzvn.h"
 #include "assorted_output.h"
 #include "assorted_system_string.h"
 
@@ -49,11 +50,13 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use lzvndecompress to decompress data as LZVN compressed data.\n\n" );
 
-	fprintf( stream, "Usage: lzvndecompress [ -d size ] [ -o offset ] [ -s size ] [ -hvV ]\n"
-	                 "       source\n\n" );
+	fprintf( stream, "Usage: lzvndecompress [ -d size ] [ -o offset ] [ -s size ]\n"
+	                 "                      [ -12hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-1:     use the libfmos decompression method (default)\n" );
+	fprintf( stream, "\t-2:     use the native decompression method\n" );
 	fprintf( stream, "\t-d:     size of the decompressed data (default is 16 times the size\n"
 	                 "\t        of the data)).\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
@@ -87,6 +90,7 @@ int main( int argc, char * const argv[] )
 	ssize_t read_count                = 0;
 	ssize_t write_count               = 0;
 	off_t source_offset               = 0;
+	int decompression_method          = 1;
 	int print_count                   = 0;
 	int result                        = 0;
 	int verbose                       = 0;
@@ -98,7 +102,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "d:ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12d:ho:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -114,6 +118,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) '1':
+				decompression_method = 1;
+
+				break;
+
+			case (system_integer_t) '2':
+				decompression_method = 2;
+
+				break;
+
 			case (system_integer_t) 'd':
 				uncompressed_data_size = system_string_copy_to_long( optarg );
 
@@ -300,12 +314,25 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfmos_lzvn_decompress(
-	     buffer,
-	     source_size,
-	     uncompressed_data,
-	     &uncompressed_data_size,
-	     &error ) != 1 )
+	if( decompression_method == 2 )
+	{
+		result = assorted_lzvn_decompress(
+		          buffer,
+		          (size_t) source_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
+	else
+	{
+		result = libfmos_lzvn_decompress(
+		          buffer,
+		          (size_t) source_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
+	if( result != 1 )
 	{
 		fprintf(
 		 stderr,
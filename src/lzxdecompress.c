@@ -34,8 +34,10 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_libfwnt.h"
+#include "assorted_lzx_parallel.h"
 #include "assorted_output.h"
 #include "assorted_signal.h"
+#include "assorted_system_string.h"
 #include "assorted_unused.h"
 #include "decompression_handle.h"
 
@@ -53,14 +55,30 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use lzxdecompress to decompress LZX compressed data.\n\n" );
 
-	fprintf( stream, "Usage: lzxdecompress [ -d size ] [ -o offset ] [ -s size ]\n"
-	                 "                     [ -t target ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: lzxdecompress [ -d size ] [ -e entry_size ] [ -i interval ]\n"
+	                 "                     [ -o offset ] [ -O uncompressed_offset ]\n"
+	                 "                     [ -j number_of_threads ] [ -r reset_table ]\n"
+	                 "                     [ -s size ] [ -t target ] [ -AhMvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-A:     use asynchronous direct I/O instead of reading the source file\n" );
 	fprintf( stream, "\t-d:     size of the decompressed data (default is 65536).\n" );
+	fprintf( stream, "\t-e:     size of a reset table entry, 4 or 8 (default is 8)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     uncompressed size between reset points (default is 32768)\n" );
+	fprintf( stream, "\t-j:     decompress the frames between reset points in parallel\n"
+	                 "\t        using the number of threads, requires a reset table\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-M:     use memory mapped input instead of reading the source file\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-O:     offset of the uncompressed data to extract, requires\n"
+	                 "\t        a reset table (default is 0)\n" );
+	fprintf( stream, "\t-p:     same as -j\n" );
+	fprintf( stream, "\t-r:     file containing the reset table, the little-endian\n"
+	                 "\t        compressed data offsets of the reset points, such as\n"
+	                 "\t        a WIM chunk table. Only the frames that cover the\n"
+	                 "\t        requested uncompressed data are decompressed\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
 	                 "\t        by default the data will be written to stdout in\n"
@@ -123,17 +141,33 @@ int main( int argc, char * const argv[] )
 #endif
 {
 	libcerror_error_t *error                 = NULL;
+	libcfile_file_t *reset_table_file        = NULL;
+	system_character_t *option_output_offset = NULL;
+	system_character_t *option_reset_table   = NULL;
 	system_character_t *option_source_offset = NULL;
 	system_character_t *option_source_size   = NULL;
 	system_character_t *option_target_path   = NULL;
 	system_character_t *options_string       = NULL;
 	system_character_t *source               = NULL;
+	const uint8_t *compressed_data           = NULL;
+	uint64_t *reset_offsets                  = NULL;
 	uint8_t *buffer                          = NULL;
+	uint8_t *reset_table_data                = NULL;
 	uint8_t *uncompressed_data               = NULL;
 	char *program                            = "lzxdecompress";
 	system_integer_t option                  = 0;
+	size64_t reset_table_size                = 0;
+	ssize_t read_count                       = 0;
 	size_t buffer_size                       = 0;
+	size_t number_of_reset_offsets           = 0;
+	size_t reset_interval                    = ASSORTED_LZX_PARALLEL_DEFAULT_RESET_INTERVAL;
+	size_t string_length                     = 0;
 	size_t uncompressed_data_size            = 0;
+	uint64_t uncompressed_offset             = 0;
+	uint8_t entry_size                       = 8;
+	uint8_t use_direct_io                    = 0;
+	uint8_t use_memory_map                   = 0;
+	int number_of_threads                    = 1;
 	int result                               = 0;
 	int verbose                              = 0;
 
@@ -141,7 +175,7 @@ int main( int argc, char * const argv[] )
 	 stdout,
 	 program );
 
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV" );
+	options_string = _SYSTEM_STRING( "Ad:e:hi:j:Mo:O:p:r:s:t:vV" );
 
 	while( ( option = assorted_getopt(
 	                   argc,
@@ -162,6 +196,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'A':
+				use_direct_io = 1;
+
+				break;
+
 			case (system_integer_t) 'd':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				uncompressed_data_size = _wtol( optarg );
@@ -170,17 +209,48 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case (system_integer_t) 'e':
+				entry_size = (uint8_t) system_string_copy_to_long( optarg );
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'i':
+				reset_interval = (size_t) system_string_copy_to_long( optarg );
+
+				break;
+
+			case (system_integer_t) 'M':
+				use_memory_map = 1;
+
+				break;
+
 			case (system_integer_t) 'o':
 				option_source_offset = optarg;
 
 				break;
 
+			case (system_integer_t) 'O':
+				option_output_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+			case (system_integer_t) 'p':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_reset_table = optarg;
+
+				break;
+
 			case (system_integer_t) 's':
 				option_source_size = optarg;
 
@@ -216,12 +286,70 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > 64 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( option_reset_table == NULL )
+	 && ( ( number_of_threads > 1 )
+	  ||  ( option_output_offset != NULL ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing reset table.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( entry_size != 4 )
+	 && ( entry_size != 8 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported reset table entry size.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( reset_interval == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid reset interval value is zero.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( option_output_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_output_offset );
+
+		if( assorted_system_string_copy_from_64_bit_in_decimal(
+		     option_output_offset,
+		     string_length + 1,
+		     &uncompressed_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported uncompressed offset.\n" );
+
+			goto on_error;
+		}
+	}
+
 	if( decompression_handle_initialize(
 	     &lzxdecompress_decompression_handle,
 	     &error ) != 1 )
@@ -260,6 +388,28 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( decompression_handle_set_use_memory_map(
+	     lzxdecompress_decompression_handle,
+	     use_memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set use memory map.\n" );
+
+		goto on_error;
+	}
+	if( decompression_handle_set_use_direct_io(
+	     lzxdecompress_decompression_handle,
+	     use_direct_io,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set use direct I/O.\n" );
+
+		goto on_error;
+	}
 	if( decompression_handle_open_input(
 	     lzxdecompress_decompression_handle,
 	     source,
@@ -288,21 +438,39 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Create the input buffer
+	/* A memory mapped input is decompressed directly from the mapping
 	 */
-	buffer_size = lzxdecompress_decompression_handle->input_size;
-
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
+	result = decompression_handle_get_input_data(
+	          lzxdecompress_decompression_handle,
+	          &compressed_data,
+	          &error );
 
-	if( buffer == NULL )
+	if( result == -1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create buffer.\n" );
+		 "Unable to retrieve input data.\n" );
 
 		goto on_error;
 	}
+	else if( result == 0 )
+	{
+		/* Create the input buffer
+		 */
+		buffer_size = lzxdecompress_decompression_handle->input_size;
+
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * buffer_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+	}
 	if( uncompressed_data_size == 0 )
 	{
 		uncompressed_data_size = 32768;
@@ -336,17 +504,21 @@ int main( int argc, char * const argv[] )
 	 lzxdecompress_decompression_handle->input_offset,
 	 lzxdecompress_decompression_handle->input_offset );
 
-	if( decompression_handle_read_data(
-	     lzxdecompress_decompression_handle,
-	     buffer,
-	     lzxdecompress_decompression_handle->input_size,
-	     &error ) != 1 )
+	if( buffer != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		if( decompression_handle_read_data(
+		     lzxdecompress_decompression_handle,
+		     buffer,
+		     lzxdecompress_decompression_handle->input_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		compressed_data = buffer;
 	}
 	/* Decompress the data
 	 */
@@ -357,16 +529,157 @@ int main( int argc, char * const argv[] )
 		 "Compressed data:\n" );
 
 		libcnotify_print_data(
-		 buffer,
+		 compressed_data,
 		 lzxdecompress_decompression_handle->input_size,
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
-	result = libfwnt_lzx_decompress(
-	          buffer,
-	          (size_t) lzxdecompress_decompression_handle->input_size,
-	          uncompressed_data,
-	          &uncompressed_data_size,
-	          &error );
+	if( option_reset_table != NULL )
+	{
+		if( libcfile_file_initialize(
+		     &reset_table_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create reset table file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          reset_table_file,
+		          option_reset_table,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          reset_table_file,
+		          option_reset_table,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#endif
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open reset table file: %" PRIs_SYSTEM ".\n",
+			 option_reset_table );
+
+			goto on_error;
+		}
+		if( libcfile_file_get_size(
+		     reset_table_file,
+		     &reset_table_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of reset table file.\n" );
+
+			goto on_error;
+		}
+		if( reset_table_size == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid reset table size value is zero.\n" );
+
+			goto on_error;
+		}
+		if( reset_table_size > (size64_t) ( 128 * 1024 * 1024 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid reset table size value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		reset_table_data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * (size_t) reset_table_size );
+
+		if( reset_table_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create reset table data.\n" );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+		              reset_table_file,
+		              reset_table_data,
+		              (size_t) reset_table_size,
+		              &error );
+
+		if( read_count != (ssize_t) reset_table_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read reset table file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_close(
+		     reset_table_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close reset table file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &reset_table_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free reset table file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_lzx_parallel_get_reset_offsets(
+		     reset_table_data,
+		     (size_t) reset_table_size,
+		     entry_size,
+		     (size_t) lzxdecompress_decompression_handle->input_size,
+		     &reset_offsets,
+		     &number_of_reset_offsets,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve reset offsets.\n" );
+
+			goto on_error;
+		}
+		memory_free(
+		 reset_table_data );
+
+		reset_table_data = NULL;
+
+		result = assorted_lzx_parallel_decompress(
+		          compressed_data,
+		          (size_t) lzxdecompress_decompression_handle->input_size,
+		          reset_offsets,
+		          number_of_reset_offsets,
+		          reset_interval,
+		          (size64_t) uncompressed_offset,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          number_of_threads,
+		          &error );
+	}
+	else
+	{
+		result = libfwnt_lzx_decompress(
+		          compressed_data,
+		          (size_t) lzxdecompress_decompression_handle->input_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
 
 	if( result == -1 )
 	{
@@ -396,6 +709,13 @@ int main( int argc, char * const argv[] )
 	}
 	/* Clean up
 	 */
+	if( reset_offsets != NULL )
+	{
+		memory_free(
+		 reset_offsets );
+
+		reset_offsets = NULL;
+	}
 	memory_free(
 	 uncompressed_data );
 
@@ -440,6 +760,22 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( reset_offsets != NULL )
+	{
+		memory_free(
+		 reset_offsets );
+	}
+	if( reset_table_data != NULL )
+	{
+		memory_free(
+		 reset_table_data );
+	}
+	if( reset_table_file != NULL )
+	{
+		libcfile_file_free(
+		 &reset_table_file,
+		 NULL );
+	}
 	if( uncompressed_data != NULL )
 	{
 		memory_free(
@@ -34,6 +34,7 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_libfwnt.h"
+#include "assorted_lzxpress_huffman.h"
 #include "assorted_output.h"
 
 #if defined( WINAPI )
@@ -54,6 +55,51 @@
 #define STATUS_BAD_COMPRESSION_BUFFER	0xc0000242
 #endif
 
+#if !defined( COMPRESSION_ENGINE_STANDARD )
+#define COMPRESSION_ENGINE_STANDARD	0x0000
+#endif
+
+/* Cross Windows safe version of RtlGetCompressionWorkSpaceSize
+ * Returns 0 if successful or an error code on error
+ */
+NTSTATUS lzxpresscompress_RtlGetCompressionWorkSpaceSize(
+          unsigned short CompressionFormatAndEngine,
+          unsigned long *CompressBufferWorkSpaceSize,
+          unsigned long *CompressFragmentWorkSpaceSize )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	NTSTATUS result        = 1;
+
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "ntdll.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( 1 );
+	}
+	function = GetProcAddress(
+	            library_handle,
+	            (LPCSTR) "RtlGetCompressionWorkSpaceSize");
+
+	if( function != NULL )
+	{
+		result = function(
+		          CompressionFormatAndEngine,
+		          CompressBufferWorkSpaceSize,
+		          CompressFragmentWorkSpaceSize );
+	}
+	/* This call should be after using the function
+	 * in most cases ntdll.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle) != TRUE )
+	{
+		result = 1;
+	}
+	return( result );
+}
+
 /* Cross Windows safe version of RtlDecompressBufferEx
  * Returns 0 if successful or an error code on error
  */
@@ -118,10 +164,10 @@ void usage_fprint(
 
 #if defined( WINAPI )
 	fprintf( stream, "Usage: lzxpressdecompress [ -d size ] [ -o offset ] [ -s size ]\n"
-	                 "                          [ -t target ] [ -1234hvV ] source\n\n" );
+	                 "                          [ -t target ] [ -12345hvV ] source\n\n" );
 #else
 	fprintf( stream, "Usage: lzxpressdecompress [ -d size ] [ -o offset ] [ -s size ]\n"
-	                 "                          [ -t target ] [ -12hvV ] source\n\n" );
+	                 "                          [ -t target ] [ -125hvV ] source\n\n" );
 #endif
 
 	fprintf( stream, "\tsource: the source file\n\n" );
@@ -132,6 +178,7 @@ void usage_fprint(
 	fprintf( stream, "\t-3:     use the WINAPI LZ77 + DIRECT2 decompression method\n" );
 	fprintf( stream, "\t-4:     use the WINAPI Huffman decompression method\n" );
 #endif
+	fprintf( stream, "\t-5:     use the native Huffman decompression method\n" );
 	fprintf( stream, "\t-d:     size of the decompressed data (default is 65536).\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
@@ -174,6 +221,8 @@ int main( int argc, char * const argv[] )
 
 #if defined( WINAPI )
 	void *workspace                          = NULL;
+	unsigned long fragment_workspace_size    = 0;
+	unsigned long workspace_size             = 0;
 	unsigned short winapi_compression_method = 0;
 #endif
 
@@ -182,9 +231,9 @@ int main( int argc, char * const argv[] )
 	 program );
 
 #if defined( WINAPI )
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV1234" );
+	options_string = _SYSTEM_STRING( "d:ho:s:t:vV12345" );
 #else
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV12" );
+	options_string = _SYSTEM_STRING( "d:ho:s:t:vV125" );
 #endif
 	while( ( option = assorted_getopt(
 	                   argc,
@@ -227,6 +276,11 @@ int main( int argc, char * const argv[] )
 				break;
 
 #endif
+			case (system_integer_t) '5':
+				decompression_method = 5;
+
+				break;
+
 			case (system_integer_t) 'd':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				uncompressed_data_size = _wtol( optarg );
@@ -406,6 +460,50 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+#if defined( WINAPI )
+	/* The workspace is sized for the compression format and allocated once
+	 * before decompression
+	 */
+	if( ( decompression_method == 3 )
+	 || ( decompression_method == 4 ) )
+	{
+		if( decompression_method == 3 )
+		{
+			winapi_compression_method = COMPRESSION_FORMAT_XPRESS;
+		}
+		else if( decompression_method == 4 )
+		{
+			winapi_compression_method = COMPRESSION_FORMAT_XPRESS_HUFF;
+		}
+		if( lzxpresscompress_RtlGetCompressionWorkSpaceSize(
+		     winapi_compression_method | COMPRESSION_ENGINE_STANDARD,
+		     &workspace_size,
+		     &fragment_workspace_size ) != STATUS_SUCCESS )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine workspace size.\n" );
+
+			goto on_error;
+		}
+		if( workspace_size == 0 )
+		{
+			workspace_size = 1;
+		}
+		workspace = (void *) memory_allocate(
+		                      (size_t) workspace_size );
+
+		if( workspace == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create workspace.\n" );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( WINAPI ) */
+
 	/* Position the source file at the right offset
 	 */
 	if( libcfile_file_seek_offset(
@@ -472,30 +570,19 @@ int main( int argc, char * const argv[] )
 		          &uncompressed_data_size,
 		          &error );
 	}
+	else if( decompression_method == 5 )
+	{
+		result = assorted_lzxpress_huffman_decompress(
+		          buffer,
+		          (size_t) source_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
 #if defined( WINAPI )
 	else if( ( decompression_method == 3 )
 	      || ( decompression_method == 4 ) )
 	{
-		if( decompression_method == 3 )
-		{
-			winapi_compression_method = COMPRESSION_FORMAT_XPRESS;
-		}
-		else if( decompression_method == 4 )
-		{
-			winapi_compression_method = COMPRESSION_FORMAT_XPRESS_HUFF;
-		}
-/* TODO: determine workspace size: RtlGetCompressionWorkSpaceSize */
-		workspace = (void *) memory_allocate(
-		                      16 * 1024 * 1024 );
-
-		if( workspace == NULL )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to create workspace.\n" );
-
-			goto on_error;
-		}
 		result = lzxpresscompress_RtlDecompressBufferEx(
 		          winapi_compression_method,
 		          (unsigned char *) uncompressed_data,
@@ -505,9 +592,6 @@ int main( int argc, char * const argv[] )
 		          (unsigned long *) &uncompressed_data_size,
 		          workspace );
 
-		memory_free(
-		 workspace );
-
 		if( result == STATUS_SUCCESS )
 		{
 			result = 1;
@@ -664,6 +748,15 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+#if defined( WINAPI )
+	if( workspace != NULL )
+	{
+		memory_free(
+		 workspace );
+
+		workspace = NULL;
+	}
+#endif
 	memory_free(
 	 uncompressed_data );
 
@@ -694,6 +787,13 @@ on_error:
 		 &destination_file,
 		 NULL );
 	}
+#if defined( WINAPI )
+	if( workspace != NULL )
+	{
+		memory_free(
+		 workspace );
+	}
+#endif
 	if( uncompressed_data != NULL )
 	{
 		memory_free(
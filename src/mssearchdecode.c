@@ -19,7 +19,9 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -35,9 +37,77 @@
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_libuna.h"
 #include "assorted_mssearch.h"
 #include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+#define MSSEARCHDECODE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The size of the record data that is read per batch
+ */
+#define MSSEARCHDECODE_BATCH_SIZE			( 4 * 1024 * 1024 )
+
+/* The maximum size of a record
+ */
+#define MSSEARCHDECODE_MAXIMUM_RECORD_SIZE		( 64 * 1024 * 1024 )
+
+/* The record size that marks a record that could not be decoded in the destination
+ */
+#define MSSEARCHDECODE_FAILED_RECORD_SIZE		0xffffffffUL
+
+typedef struct mssearchdecode_task mssearchdecode_task_t;
+
+struct mssearchdecode_task
+{
+	/* The record data, which is decoded in place
+	 */
+	uint8_t *record_data;
+
+	/* The record data size
+	 */
+	size_t record_data_size;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* The uncompressed data, reused across records
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The output data, which contains the length-prefixed values of the records
+	 * and is reused across batches
+	 */
+	uint8_t *output_data;
+
+	/* The output data size
+	 */
+	size_t output_data_size;
+
+	/* The output data offset
+	 */
+	size_t output_data_offset;
+
+	/* The number of records that could not be decoded
+	 */
+	int number_of_failed_records;
+
+	/* The result of the decoding, 0 if not decoded
+	 */
+	int result;
+};
 
 /* Prints the executable usage information
  */
@@ -50,395 +120,218 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use mssearchdecode to decode MS Search encoded data.\n\n" );
 
-	fprintf( stream, "Usage: mssearchdecode [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: mssearchdecode [ -o offset ] [ -j number_of_threads ] [ -s size ]\n"
+	                 "                      [ -bhvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-b:     decode a stream of records, where every record consists of\n"
+	                 "\t        a 32-bit little-endian size followed by the encoded data,\n"
+	                 "\t        such as a column exported from an ESE database. The values\n"
+	                 "\t        are written as a stream of records to source.mssearch.decoded\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to decode records with -b\n"
+	                 "\t        (default is 1)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     same as -j\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
 }
 
-/* The main program
+/* Resizes a buffer if it is smaller than the required size
+ * Returns 1 if successful or -1 on error
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain( int argc, wchar_t * const argv[] )
-#else
-int main( int argc, char * const argv[] )
-#endif
+int mssearchdecode_resize_buffer(
+     uint8_t **buffer,
+     size_t *buffer_size,
+     size_t required_size,
+     libcerror_error_t **error )
 {
-	char destination[ 128 ];
-
-	libcerror_error_t *error         = NULL;
-	libcfile_file_t *source_file     = NULL;
-	system_character_t *source       = NULL;
-	system_character_t *value_string = NULL;
-	uint8_t *buffer                  = NULL;
-	uint8_t *decoded_data            = NULL;
-	uint8_t *narrow_value_string     = NULL;
-	uint8_t *uncompressed_data       = NULL;
-	uint8_t *value_utf16_stream      = NULL;
-	static char *function            = "main";
-	char *program                    = "mssearchdecode";
-	system_integer_t option          = 0;
-	size64_t source_size             = 0;
-	size_t buffer_size               = 0;
-	size_t decoded_data_size         = 0;
-	size_t narrow_value_string_size  = 0;
-	size_t uncompressed_data_size    = 0;
-	size_t value_string_size         = 0;
-	size_t value_utf16_stream_size   = 0;
-	ssize_t read_count               = 0;
-	off_t source_offset              = 0;
-	uint8_t compression_type         = 0;
-	int ascii_codepage               = LIBUNA_CODEPAGE_WINDOWS_1252;
-	int print_count                  = 0;
-	int result                       = 0;
-	int verbose                      = 0;
-
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-	libcnotify_verbose_set(
-	 1 );
-
-	assorted_output_version_fprint(
-	 stdout,
-	 program );
+	void *reallocation    = NULL;
+	static char *function = "mssearchdecode_resize_buffer";
+	size_t safe_size      = 0;
 
-	while( ( option = assorted_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	if( required_size <= *buffer_size )
 	{
-		switch( option )
-		{
-			case '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM "\n",
-				 argv[ optind ] );
-
-				usage_fprint(
-				 stdout );
-
-				return( EXIT_FAILURE );
-
-			case 'h':
-				usage_fprint(
-				 stdout );
-
-				return( EXIT_SUCCESS );
-
-			case 'o':
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				source_offset = _wtol( optarg );
-#else
-				source_offset = atol( optarg );
-#endif
-				break;
-
-			case 's':
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				source_size = _wtol( optarg );
-#else
-				source_size = atol( optarg );
-#endif
-				break;
-
-			case 'v':
-				verbose = 1;
-
-				break;
-
-			case 'V':
-				assorted_output_copyright_fprint(
-				 stdout );
-
-				return( EXIT_SUCCESS );
-		}
+		return( 1 );
 	}
-	if( optind == argc )
+	if( required_size > (size_t) SSIZE_MAX )
 	{
-		fprintf(
-		 stderr,
-		 "Missing source file.\n" );
-
-		usage_fprint(
-		 stdout );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
 
-		return( EXIT_FAILURE );
+		return( -1 );
 	}
-	source = argv[ optind ];
-
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-	libcnotify_verbose_set(
-	 verbose );
-
-	/* Open the source file
+	/* Grow the buffer at least twofold to limit the number of reallocations
 	 */
-	if( libcfile_file_initialize(
-	     &source_file,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create source file.\n" );
-
-		goto on_error;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          source_file,
-	          source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
-#else
-	result = libcfile_file_open(
-	          source_file,
-	          source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
-#endif
- 	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to open source file.\n" );
-
-		goto on_error;
-	}
-	if( source_size == 0 )
-	{
-		if( libcfile_file_get_size(
-		     source_file,
-		     &source_size,
-		     &error ) == -1 )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to determine size of source file.\n" );
-
-			goto on_error;
-		}
-	}
-	if( source_size == 0 )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value is zero.\n" );
+	safe_size = required_size;
 
-		return( EXIT_FAILURE );
-	}
-	if( source_size > (size_t) SSIZE_MAX )
+	if( ( *buffer_size <= ( (size_t) SSIZE_MAX / 2 ) )
+	 && ( safe_size < ( *buffer_size * 2 ) ) )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		return( EXIT_FAILURE );
+		safe_size = *buffer_size * 2;
 	}
-	/* Create the input buffer
-	 */
-	buffer_size = source_size;
+	reallocation = memory_reallocate(
+	                *buffer,
+	                sizeof( uint8_t ) * safe_size );
 
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
+	if( reallocation == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
 
-		return( EXIT_FAILURE );
+		return( -1 );
 	}
-	decoded_data_size = source_size;
+	*buffer      = (uint8_t *) reallocation;
+	*buffer_size = safe_size;
 
-	decoded_data = (uint8_t *) memory_allocate(
-	                            sizeof( uint8_t ) * decoded_data_size );
+	return( 1 );
+}
 
-	if( decoded_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create decoded data buffer.\n" );
+/* Decodes a MS Search encoded record in place and decompresses its value
+ * String values are converted to UTF-8, without end-of-string character,
+ * and other values are copied. The value is appended to the output data at
+ * the output data offset. The uncompressed data and output data buffers are
+ * resized if needed, so they can be reused across records.
+ * Returns 1 if successful or -1 on error
+ */
+int mssearchdecode_decode_record(
+     uint8_t *record_data,
+     size_t record_data_size,
+     int ascii_codepage,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t **output_data,
+     size_t *output_data_size,
+     size_t *output_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function    = "mssearchdecode_decode_record";
+	uint8_t *value_data      = NULL;
+	size_t string_size       = 0;
+	size_t value_data_size   = 0;
+	uint8_t compression_type = 0;
 
-		goto on_error;
-	}
-	/* Position the source file at the right offset
-	 */
-	if( libcfile_file_seek_offset(
-	     source_file,
-	     source_offset,
-	     SEEK_SET,
-	     &error ) == -1 )
+	if( record_data == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to seek offset in source file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	print_count = narrow_string_snprintf(
-	               destination,
-	               128,
-	               "%s.mssearch.decoded",
-	               source );
-
-	if( ( print_count < 0 )
-	 || ( print_count > 128 ) )
+	if( ( record_data_size < 1 )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
 	{
-		
-		fprintf(
-		 stderr,
-		 "Unable to set destination filename.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 stdout,
-	 "Starting MS Search decoding data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
-	 source,
-	 source_offset,
-	 source_offset );
-
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
+	if( assorted_mssearch_decode_in_place(
+	     record_data,
+	     record_data_size,
+	     error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode record data.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* Decodes the data
-	 */
-	fprintf(
-	 stderr,
-	 "Encoded data:\n" );
-
-	libcnotify_print_data(
-	 buffer,
-	 source_size,
-	 0 );
-
-	if( assorted_mssearch_decode(
-	     decoded_data,
-	     decoded_data_size,
-	     buffer,
-	     source_size,
-	     &error ) != 1 )
+	if( libcnotify_verbose != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to decode data.\n" );
+		libcnotify_printf(
+		 "%s: decoded data:\n",
+		 function );
+		libcnotify_print_data(
+		 record_data,
+		 record_data_size,
+		 0 );
 
-		goto on_error;
+		libcnotify_printf(
+		 "%s: compression type\t: 0x%02" PRIx8 "\n\n",
+		 function,
+		 record_data[ 0 ] );
 	}
-	fprintf(
-	 stderr,
-	 "Decoded data:\n" );
-
-	libcnotify_print_data(
-	 decoded_data,
-	 decoded_data_size,
-	 0 );
-
-	source_offset += source_size;
-	source_size   -= source_size;
-
-	fprintf(
-	 stderr,
-	 "Compression type:\t0x%02" PRIx8 "\n",
-	 decoded_data[ 0 ] );
-	fprintf(
-	 stderr,
-	 "\n" );
-
-	compression_type = decoded_data[ 0 ];
+	compression_type = record_data[ 0 ];
+	value_data       = &( record_data[ 1 ] );
+	value_data_size  = record_data_size - 1;
 
 	/* Byte-index compressed data
 	 */
 	if( ( compression_type & 0x02 ) != 0 )
 	{
 		if( assorted_mssearch_get_byte_index_uncompressed_data_size(
-		     &( decoded_data[ 1 ] ),
-		     decoded_data_size - 1,
-		     &uncompressed_data_size,
-		     &error ) != 1 )
+		     value_data,
+		     value_data_size,
+		     &string_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
-			 &error,
+			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve byte-index compressed data size.",
+			 "%s: unable to retrieve byte-index uncompressed data size.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		uncompressed_data_size += 1;
-
-		uncompressed_data = (uint8_t *) memory_allocate(
-		                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-		if( uncompressed_data == NULL )
+		/* The buffer needs to be at least 1 byte in size
+		 */
+		if( mssearchdecode_resize_buffer(
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     string_size + 1,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
-			 &error,
+			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create uncompressed data.",
+			 "%s: unable to resize uncompressed data.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		/* Add the first byte of the decoded data - 2 to have the
-		 * decompressed data look like decoded data for chained decompression
-		 */
-		uncompressed_data[ 0 ] = decoded_data[ 0 ] - 2;
-
-		result = assorted_mssearch_decompress_byte_indexed_compressed_data(
-		          &( uncompressed_data[ 1 ] ),
-		          uncompressed_data_size - 1,
-		          &( decoded_data[ 1 ] ),
-		          decoded_data_size - 1,
-		          &error );
-
-		if( result != 1 )
+		if( assorted_mssearch_decompress_byte_indexed(
+		     value_data,
+		     value_data_size,
+		     *uncompressed_data,
+		     &string_size,
+		     error ) != 1 )
 		{
-			fprintf(
-			 stderr,
-			 "Unable to decompress byte-index compressed data." );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress byte-index compressed data.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		libcnotify_printf(
-		 "%s: decompressed data:\n",
-		 function );
-		libcnotify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_size,
-		 0 );
-
-		memory_free(
-		 decoded_data );
-
-		decoded_data      = uncompressed_data;
-		decoded_data_size = uncompressed_data_size;
-
-		uncompressed_data = NULL;
+		value_data      = *uncompressed_data;
+		value_data_size = string_size;
 
 		compression_type &= ~( 0x02 );
 	}
@@ -446,270 +339,941 @@ int main( int argc, char * const argv[] )
 	 */
 	if( compression_type == 0 )
 	{
-		if( assorted_mssearch_get_run_length_uncompressed_utf16_string_size(
-		     &( decoded_data[ 1 ] ),
-		     decoded_data_size - 1,
-		     &value_utf16_stream_size,
-		     &error ) != 1 )
+		if( assorted_mssearch_get_run_length_utf8_string_size(
+		     value_data,
+		     value_data_size,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( mssearchdecode_resize_buffer(
+		     output_data,
+		     output_data_size,
+		     *output_data_offset + string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize output data.",
+			 function );
+
+			return( -1 );
+		}
+		if( assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+		     value_data,
+		     value_data_size,
+		     &( ( *output_data )[ *output_data_offset ] ),
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress run-length compressed UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		*output_data_offset += string_size - 1;
+	}
+	/* 8-bit compressed UTF-16 little-endian string
+	 */
+	else if( compression_type == 1 )
+	{
+		if( libuna_utf8_string_size_from_byte_stream(
+		     value_data,
+		     value_data_size,
+		     ascii_codepage,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( mssearchdecode_resize_buffer(
+		     output_data,
+		     output_data_size,
+		     *output_data_offset + string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize output data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_utf8_string_copy_from_byte_stream(
+		     &( ( *output_data )[ *output_data_offset ] ),
+		     string_size,
+		     value_data,
+		     value_data_size,
+		     ascii_codepage,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
-			 &error,
+			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve run-length uncompressed UTF-16 string size.",
+			 "%s: unable to retrieve UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( string_size > 0 )
+		{
+			*output_data_offset += string_size - 1;
+		}
+	}
+	/* uncompressed data
+	 */
+	else if( compression_type == 4 )
+	{
+		if( mssearchdecode_resize_buffer(
+		     output_data,
+		     output_data_size,
+		     *output_data_offset + value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize output data.",
 			 function );
 
+			return( -1 );
+		}
+		if( value_data_size > 0 )
+		{
+			if( memory_copy(
+			     &( ( *output_data )[ *output_data_offset ] ),
+			     value_data,
+			     value_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		*output_data_offset += value_data_size;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression type: 0x%02" PRIx8 ".",
+		 function,
+		 compression_type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes the records of a task
+ * Every value is written to the output data of the task prefixed by its 32-bit
+ * little-endian size, a record that cannot be decoded is written with
+ * MSSEARCHDECODE_FAILED_RECORD_SIZE as its size and without a value
+ */
+void mssearchdecode_task_decode(
+      mssearchdecode_task_t *task )
+{
+	libcerror_error_t *error  = NULL;
+	size_t record_data_offset = 0;
+	size_t size_offset        = 0;
+	uint32_t record_size      = 0;
+	int record_index          = 0;
+
+	if( task == NULL )
+	{
+		return;
+	}
+	task->result                   = -1;
+	task->output_data_offset       = 0;
+	task->number_of_failed_records = 0;
+
+	for( record_index = 0;
+	     record_index < task->number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( task->record_data[ record_data_offset ] ),
+		 record_size );
+
+		record_data_offset += 4;
+
+		if( mssearchdecode_resize_buffer(
+		     &( task->output_data ),
+		     &( task->output_data_size ),
+		     task->output_data_offset + 4,
+		     NULL ) != 1 )
+		{
+			return;
+		}
+		size_offset               = task->output_data_offset;
+		task->output_data_offset += 4;
+
+		if( mssearchdecode_decode_record(
+		     &( task->record_data[ record_data_offset ] ),
+		     (size_t) record_size,
+		     task->ascii_codepage,
+		     &( task->uncompressed_data ),
+		     &( task->uncompressed_data_size ),
+		     &( task->output_data ),
+		     &( task->output_data_size ),
+		     &( task->output_data_offset ),
+		     &error ) != 1 )
+		{
 			if( error != NULL )
 			{
-				libcnotify_print_error_backtrace(
-				 error );
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+				libcerror_error_free(
+				 &error );
 			}
-			libcerror_error_free(
-			 &error );
+			task->output_data_offset = size_offset + 4;
 
-			memory_free(
-			 decoded_data );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( task->output_data[ size_offset ] ),
+			 MSSEARCHDECODE_FAILED_RECORD_SIZE );
+
+			task->number_of_failed_records++;
 		}
-		if( value_utf16_stream_size > 0 )
+		else
 		{
-			value_utf16_stream = (uint8_t *) memory_allocate(
-							  sizeof( uint8_t ) * value_utf16_stream_size );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( task->output_data[ size_offset ] ),
+			 (uint32_t) ( task->output_data_offset - size_offset - 4 ) );
+		}
+		record_data_offset += record_size;
+	}
+	task->result = 1;
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decodes the records of a task from a thread pool
+ * Returns 1 on success or -1 on error
+ */
+int mssearchdecode_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	mssearchdecode_task_decode(
+	 (mssearchdecode_task_t *) value );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decodes the records of the tasks and writes their values to the destination
+ * The tasks are decoded on a thread pool and their output data is written
+ * in order of the tasks
+ * Returns 1 if successful or -1 on error
+ */
+int mssearchdecode_decode_tasks(
+     mssearchdecode_task_t *tasks,
+     int number_of_tasks,
+     int number_of_threads,
+     libcfile_file_t *destination_file,
+     int *number_of_failed_records,
+     libcerror_error_t **error )
+{
+	mssearchdecode_task_t *task            = NULL;
+	static char *function                  = "mssearchdecode_decode_tasks";
+	ssize_t write_count                    = 0;
+	int task_index                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
 
-			if( value_utf16_stream == NULL )
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		tasks[ task_index ].result = 0;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &mssearchdecode_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value UTF-16 stream.",
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	ASSORTED_UNREFERENCED_PARAMETER( number_of_threads )
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		task = &( tasks[ task_index ] );
+
+		/* Without a thread pool the records are decoded here
+		 */
+		if( task->result == 0 )
+		{
+			mssearchdecode_task_decode(
+			 task );
+		}
+		if( task->result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to decode records of task: %d.",
+			 function,
+			 task_index );
+
+			goto on_error;
+		}
+		write_count = libcfile_file_write_buffer(
+		               destination_file,
+		               task->output_data,
+		               task->output_data_offset,
+		               error );
+
+		if( write_count != (ssize_t) task->output_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write values of task: %d to destination.",
+			 function,
+			 task_index );
+
+			goto on_error;
+		}
+		*number_of_failed_records += task->number_of_failed_records;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Decodes a stream of length-prefixed records
+ * The records are read in batches, every batch is split into one task per thread
+ * with about the same amount of record data. The tasks keep their scratch buffers
+ * across batches.
+ * Returns 1 if successful or -1 on error
+ */
+int mssearchdecode_decode_records(
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     libcfile_file_t *destination_file,
+     int number_of_threads,
+     int ascii_codepage,
+     uint64_t *number_of_records,
+     int *number_of_failed_records,
+     libcerror_error_t **error )
+{
+	mssearchdecode_task_t *tasks = NULL;
+	uint8_t *buffer              = NULL;
+	static char *function        = "mssearchdecode_decode_records";
+	size64_t remaining_size      = 0;
+	size_t buffer_data_size      = 0;
+	size_t buffer_offset         = 0;
+	size_t buffer_size           = 0;
+	size_t read_size             = 0;
+	size_t task_data_size        = 0;
+	ssize_t read_count           = 0;
+	uint32_t record_size         = 0;
+	int number_of_tasks          = 0;
+	int task_index               = 0;
+
+	tasks = (mssearchdecode_task_t *) memory_allocate(
+	                                   sizeof( mssearchdecode_task_t ) * number_of_threads );
+
+	if( tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     tasks,
+	     0,
+	     sizeof( mssearchdecode_task_t ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tasks.",
+		 function );
+
+		memory_free(
+		 tasks );
+
+		return( -1 );
+	}
+	for( task_index = 0;
+	     task_index < number_of_threads;
+	     task_index++ )
+	{
+		tasks[ task_index ].ascii_codepage = ascii_codepage;
+	}
+	if( mssearchdecode_resize_buffer(
+	     &buffer,
+	     &buffer_size,
+	     MSSEARCHDECODE_BATCH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	remaining_size = source_size;
+
+	while( ( remaining_size > 0 )
+	    || ( buffer_data_size > 0 ) )
+	{
+		/* Fill the buffer behind the record data carried over from the previous batch
+		 */
+		read_size = buffer_size - buffer_data_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		if( read_size > 0 )
+		{
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              &( buffer[ buffer_data_size ] ),
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record data.",
 				 function );
 
 				goto on_error;
 			}
-			if( assorted_mssearch_decompress_run_length_compressed_utf16_string(
-			     value_utf16_stream,
-			     value_utf16_stream_size,
-			     &( decoded_data[ 1 ] ),
-			     decoded_data_size - 1,
-			     &error ) != 1 )
+			buffer_data_size += read_size;
+			remaining_size   -= read_size;
+		}
+		/* Split the complete records in the buffer into tasks
+		 */
+		task_data_size  = ( buffer_data_size / number_of_threads ) + 1;
+		buffer_offset   = 0;
+		number_of_tasks = 0;
+
+		while( ( buffer_data_size - buffer_offset ) >= 4 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 record_size );
+
+			if( record_size > MSSEARCHDECODE_MAXIMUM_RECORD_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid record: %" PRIu64 " size value out of bounds.",
+				 function,
+				 *number_of_records );
+
+				goto on_error;
+			}
+			if( (size_t) record_size > ( buffer_data_size - buffer_offset - 4 ) )
+			{
+				break;
+			}
+			if( ( number_of_tasks == 0 )
+			 || ( ( tasks[ number_of_tasks - 1 ].record_data_size >= task_data_size )
+			  &&  ( number_of_tasks < number_of_threads ) ) )
+			{
+				tasks[ number_of_tasks ].record_data       = &( buffer[ buffer_offset ] );
+				tasks[ number_of_tasks ].record_data_size  = 0;
+				tasks[ number_of_tasks ].number_of_records = 0;
+
+				number_of_tasks++;
+			}
+			tasks[ number_of_tasks - 1 ].record_data_size  += 4 + (size_t) record_size;
+			tasks[ number_of_tasks - 1 ].number_of_records += 1;
+
+			buffer_offset      += 4 + (size_t) record_size;
+			*number_of_records += 1;
+		}
+		if( number_of_tasks > 0 )
+		{
+			if( mssearchdecode_decode_tasks(
+			     tasks,
+			     number_of_tasks,
+			     number_of_threads,
+			     destination_file,
+			     number_of_failed_records,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
-				 &error,
+				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to decompress run-length compressed UTF-16 string.",
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to decode records.",
 				 function );
 
 				goto on_error;
 			}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( HAVE_EXTRA_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+		}
+		else if( remaining_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: truncated record: %" PRIu64 ".",
+			 function,
+			 *number_of_records );
+
+			goto on_error;
+		}
+		/* Carry over the incomplete record at the end of the buffer
+		 */
+		buffer_data_size -= buffer_offset;
+
+		if( ( buffer_offset > 0 )
+		 && ( buffer_data_size > 0 ) )
+		{
+			if( memory_move(
+			     buffer,
+			     &( buffer[ buffer_offset ] ),
+			     buffer_data_size ) == NULL )
 			{
-				libcnotify_printf(
-				 "%s: decompressed data:\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move record data.",
 				 function );
-				libcnotify_print_data(
-				 value_utf16_stream,
-				 value_utf16_stream_size,
-				 0 );
+
+				goto on_error;
 			}
-#endif
-			/* Sometimes the UTF-16 stream is cut-off in the surrogate high range
-			 * The last 2 bytes are ignored otherwise libuna will not convert
-			 * the stream to a string
-			 */
-			if( ( ( value_utf16_stream[ value_utf16_stream_size - 1 ] ) >= 0xd8 )
-			 && ( ( value_utf16_stream[ value_utf16_stream_size - 1 ] ) <= 0xdb ) )
+		}
+		/* Make sure the buffer can hold a record that is larger than a batch
+		 */
+		if( buffer_data_size >= 4 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 buffer,
+			 record_size );
+
+			if( mssearchdecode_resize_buffer(
+			     &buffer,
+			     &buffer_size,
+			     4 + (size_t) record_size,
+			     error ) != 1 )
 			{
-				value_utf16_stream_size -= 2;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize buffer.",
+				 function );
+
+				goto on_error;
 			}
+		}
+	}
+	for( task_index = 0;
+	     task_index < number_of_threads;
+	     task_index++ )
+	{
+		if( tasks[ task_index ].uncompressed_data != NULL )
+		{
 			memory_free(
-			 decoded_data );
+			 tasks[ task_index ].uncompressed_data );
+		}
+		if( tasks[ task_index ].output_data != NULL )
+		{
+			memory_free(
+			 tasks[ task_index ].output_data );
+		}
+	}
+	memory_free(
+	 tasks );
+
+	memory_free(
+	 buffer );
 
-			decoded_data = NULL;
+	return( 1 );
 
+on_error:
+	if( tasks != NULL )
+	{
+		for( task_index = 0;
+		     task_index < number_of_threads;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].uncompressed_data != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].uncompressed_data );
+			}
+			if( tasks[ task_index ].output_data != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].output_data );
+			}
+		}
+		memory_free(
+		 tasks );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libuna_utf16_string_size_from_utf16_stream(
-				  value_utf16_stream,
-				  value_utf16_stream_size,
-				  LIBUNA_ENDIAN_LITTLE,
-				  &value_string_size,
-				  &error );
+int wmain( int argc, wchar_t * const argv[] )
 #else
-			result = libuna_utf8_string_size_from_utf16_stream(
-				  value_utf16_stream,
-				  value_utf16_stream_size,
-				  LIBUNA_ENDIAN_LITTLE,
-				  &value_string_size,
-				  &error );
+int main( int argc, char * const argv[] )
 #endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine size of value UTF-16 stream.",
-				 function );
+{
+	char destination[ 128 ];
 
-				goto on_error;
-			}
-			value_string = system_string_allocate(
-					value_string_size );
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *destination_file = NULL;
+	libcfile_file_t *source_file      = NULL;
+	system_character_t *source        = NULL;
+	uint8_t *buffer                   = NULL;
+	uint8_t *output_data              = NULL;
+	uint8_t *uncompressed_data        = NULL;
+	char *program                     = "mssearchdecode";
+	system_integer_t option           = 0;
+	size64_t source_size              = 0;
+	size_t output_data_offset         = 0;
+	size_t output_data_size           = 0;
+	size_t uncompressed_data_size     = 0;
+	ssize_t read_count                = 0;
+	uint64_t number_of_records        = 0;
+	off_t source_offset               = 0;
+	int ascii_codepage                = LIBUNA_CODEPAGE_WINDOWS_1252;
+	int number_of_failed_records      = 0;
+	int number_of_threads             = 1;
+	int print_count                   = 0;
+	int record_stream                 = 0;
+	int result                        = 0;
+	int verbose                       = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "bhj:o:p:s:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				record_stream = 1;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'o':
+				source_offset = system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'j':
+			case 'p':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 's':
+				source_size = system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
 
-			if( value_string == NULL )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
+		usage_fprint(
+		 stdout );
 
-				goto on_error;
-			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libuna_utf16_string_copy_from_utf16_stream(
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  value_utf16_stream,
-				  value_utf16_stream_size,
-				  LIBUNA_ENDIAN_LITTLE,
-				  &error );
-#else
-			result = libuna_utf8_string_copy_from_utf16_stream(
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  value_utf16_stream,
-				  value_utf16_stream_size,
-				  LIBUNA_ENDIAN_LITTLE,
-				  &error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 &error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value string.",
-				 function );
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
 
-				goto on_error;
-			}
-			memory_free(
-			 value_utf16_stream );
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > MSSEARCHDECODE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
 
-			value_utf16_stream = NULL;
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
 
-			libcnotify_printf(
-			 "%s: decompressed data: %" PRIs_SYSTEM "\n",
-			 function,
-			 value_string );
+	/* Open the source file
+	 */
+	if( libcfile_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
 
-			memory_free(
-			 value_string );
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#endif
+ 	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
 
-			value_string = NULL;
-		}
+		goto on_error;
 	}
-	/* 8-bit compressed UTF-16 little-endian string
-	 */
-	else if( compression_type == 1 )
+	if( source_size == 0 )
 	{
-		if( libuna_utf8_string_size_from_byte_stream(
-		     &( decoded_data[ 1 ] ),
-		     decoded_data_size - 1,
-		     ascii_codepage,
-		     &value_string_size,
-		     &error ) != 1 )
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine size of value string.",
-			 function );
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
 
 			goto on_error;
 		}
-		narrow_value_string = (uint8_t *) memory_allocate(
-		                                   sizeof( uint8_t ) * value_string_size );
-
-		if( narrow_value_string == NULL )
+		if( source_size > (size64_t) source_offset )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
-			 function );
-
-			goto on_error;
+			source_size -= source_offset;
 		}
-		if( libuna_utf8_string_copy_from_byte_stream(
-		     narrow_value_string,
-		     value_string_size,
-		     &( decoded_data[ 1 ] ),
-		     decoded_data_size - 1,
-		     ascii_codepage,
-		     &error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value string.",
-			 function );
-
-			goto on_error;
+			source_size = 0;
 		}
-		memory_free(
-		 decoded_data );
-
-		decoded_data = NULL;
-
-		libcnotify_printf(
-		 "%s: decompressed data:\n",
-		 function );
-		libcnotify_print_data(
-		 narrow_value_string,
-		 narrow_value_string_size,
-		 0 );
-
-		memory_free(
-		 narrow_value_string );
-
-		narrow_value_string = NULL;
 	}
-	/* uncompressed data
-	 */
-	else if( compression_type == 4 )
+	if( source_size == 0 )
 	{
-		libcnotify_printf(
-		 "%s: decompressed data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( decoded_data[ 1 ] ),
-		 decoded_data_size - 1,
-		 0 );
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
 	}
-	else
+	/* Position the source file at the right offset
+	 */
+	if( libcfile_file_seek_offset(
+	     source_file,
+	     source_offset,
+	     SEEK_SET,
+	     &error ) == -1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unsupported compression type: 0x%02" PRIx8 "\n",
-		 compression_type );
+		 "Unable to seek offset in source file.\n" );
 
 		goto on_error;
 	}
-#ifdef NOWRITE
-	libcfile_file_t *destination_file = NULL;
-	ssize_t write_count               = 0;
+	fprintf(
+	 stdout,
+	 "Starting MS Search decoding data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
+	 source,
+	 source_offset,
+	 source_offset );
 
-	if( destination_file == NULL )
+	if( record_stream != 0 )
 	{
-		/* Open the destination file
-		 */
+		print_count = narrow_string_snprintf(
+		               destination,
+		               128,
+		               "%s.mssearch.decoded",
+		               source );
+
+		if( ( print_count < 0 )
+		 || ( print_count > 128 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set destination filename.\n" );
+
+			goto on_error;
+		}
 		if( libcfile_file_initialize(
 		     &destination_file,
 		     &error ) != 1 )
@@ -720,20 +1284,11 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_open_wide(
-		          destination_file,
-		          destination,
-		          LIBCFILE_OPEN_WRITE,
-		          &error );
-#else
-		result = libcfile_file_open(
-		          destination_file,
-		          destination,
-		          LIBCFILE_OPEN_WRITE,
-		          &error );
-#endif
- 		if( result != 1 )
+		if( libcfile_file_open(
+		     destination_file,
+		     destination,
+		     LIBCFILE_OPEN_WRITE,
+		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
@@ -741,25 +1296,22 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-	}
-	write_count = libcfile_file_write_buffer(
-		       destination_file,
-		       decoded_data,
-		       decoded_data_size,
-		       &error );
-
-	if( write_count != (ssize_t) decoded_data_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to write to destination file.\n" );
+		if( mssearchdecode_decode_records(
+		     source_file,
+		     source_size,
+		     destination_file,
+		     number_of_threads,
+		     ascii_codepage,
+		     &number_of_records,
+		     &number_of_failed_records,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decode records.\n" );
 
-		goto on_error;
-	}
-	/* Clean up
-	 */
-	if( destination_file != NULL )
-	{
+			goto on_error;
+		}
 		if( libcfile_file_close(
 		     destination_file,
 		     &error ) != 0 )
@@ -780,8 +1332,105 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		fprintf(
+		 stdout,
+		 "Decoded records:\t%" PRIu64 "\n",
+		 number_of_records );
+
+		fprintf(
+		 stdout,
+		 "Failed records:\t\t%d\n",
+		 number_of_failed_records );
+	}
+	else
+	{
+		if( source_size > (size64_t) MSSEARCHDECODE_MAXIMUM_RECORD_SIZE )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * (size_t) source_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      buffer,
+			      (size_t) source_size,
+			      &error );
+
+		if( read_count != (ssize_t) source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stderr,
+		 "Encoded data:\n" );
+
+		libcnotify_print_data(
+		 buffer,
+		 (size_t) source_size,
+		 0 );
+
+		if( mssearchdecode_decode_record(
+		     buffer,
+		     (size_t) source_size,
+		     ascii_codepage,
+		     &uncompressed_data,
+		     &uncompressed_data_size,
+		     &output_data,
+		     &output_data_size,
+		     &output_data_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decode data.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stderr,
+		 "Value:\n" );
+
+		libcnotify_print_data(
+		 output_data,
+		 output_data_offset,
+		 0 );
+
+		if( output_data != NULL )
+		{
+			memory_free(
+			 output_data );
+
+			output_data = NULL;
+		}
+		if( uncompressed_data != NULL )
+		{
+			memory_free(
+			 uncompressed_data );
+
+			uncompressed_data = NULL;
+		}
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
 	}
-#endif
 	/* Clean up
 	 */
 	if( libcfile_file_close(
@@ -804,30 +1453,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-/* TODO fix to remove safe guard */
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	if( decoded_data != NULL )
-	{
-		memory_free(
-		 decoded_data );
-	}
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
-	if( result == -1 )
-	{
-		fprintf(
-		 stdout,
-		 "MS Search decoding:\tFAILURE\n" );
-
-		return( EXIT_FAILURE );
-	}
 	fprintf(
 	 stdout,
 	 "MS Search decoding:\tSUCCESS\n" );
@@ -842,23 +1467,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-#ifdef NOWRITE
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
 		 &destination_file,
 		 NULL );
 	}
-#endif
-	if( uncompressed_data != NULL )
+	if( output_data != NULL )
 	{
 		memory_free(
-		 uncompressed_data );
+		 output_data );
 	}
-	if( decoded_data != NULL )
+	if( uncompressed_data != NULL )
 	{
 		memory_free(
-		 decoded_data );
+		 uncompressed_data );
 	}
 	if( buffer != NULL )
 	{
@@ -0,0 +1,1040 @@
+/*
+ * Calculates multiple checksums of file data in a single pass
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_adler32.h"
+#include "assorted_cpu_features.h"
+#include "assorted_crc32.h"
+#include "assorted_crc64.h"
+#include "assorted_fletcher32.h"
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libhmac.h"
+#include "assorted_memory_map.h"
+#include "assorted_output.h"
+#include "assorted_progress.h"
+#include "assorted_signal.h"
+#include "assorted_system_string.h"
+#include "assorted_unused.h"
+#include "digest_hash.h"
+#include "multisum_queue.h"
+
+/* The size of the chunks the source file is read in, which is small enough
+ * for a chunk to remain in the CPU cache while every checksum is calculated
+ */
+#define MULTISUM_CHUNK_SIZE		( 256 * 1024 )
+
+/* The maximum number of threads
+ */
+#define MULTISUM_MAXIMUM_NUMBER_OF_THREADS	64
+
+assorted_progress_t *multisum_progress = NULL;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use multisum to calculate multiple checksums of file data in a single\n"
+	                 "pass over the data.\n\n" );
+
+	fprintf( stream, "Usage: multisum [ -c checksum_types ] [ -f file_list ] [ -m features_mask ]\n"
+	                 "                [ -o offset ] [ -s size ] [ -j number_of_threads ]\n"
+	                 "                [ -hMrvV ] [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: the source file, when multiple sources are specified, or\n"
+	                 "\t        -f or -r are used, a line is printed per source with the\n"
+	                 "\t        checksums in hexadecimal, in the order: adler32, crc32, crc64,\n"
+	                 "\t        fletcher32, md5, followed by the name of the source\n\n" );
+
+	fprintf( stream, "\t-c:     comma separated list of the checksum types to calculate,\n"
+	                 "\t        options: adler32, crc32, crc64, fletcher32, md5 or all\n"
+	                 "\t        (default is all)\n" );
+	fprintf( stream, "\t-f:     file with a source per line to calculate the checksums of\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to calculate the checksums of\n"
+	                 "\t        multiple sources, where large sources are split into parts\n"
+	                 "\t        that are combined if only adler32, crc32 and fletcher32 are\n"
+	                 "\t        calculated (default is 1)\n" );
+	fprintf( stream, "\t-m:     mask of the CPU features used by the calculation methods,\n"
+	                 "\t        where 0 only uses portable code, intended for benchmarking\n"
+	                 "\t        (default is all supported CPU features)\n" );
+	fprintf( stream, "\t-M:     use memory mapped input instead of reading the source file\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0), only supported for a single source\n" );
+	fprintf( stream, "\t-r:     calculate the checksums of the files in source directories\n"
+	                 "\t        and their sub directories\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size), only supported\n"
+	                 "\t        for a single source\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Determines the checksum types from a comma separated string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int multisum_checksum_types_from_string(
+     const system_character_t *string,
+     uint8_t *checksum_types,
+     libcerror_error_t **error )
+{
+	static char *function       = "multisum_checksum_types_from_string";
+	size_t segment_length       = 0;
+	size_t segment_start        = 0;
+	size_t string_index         = 0;
+	size_t string_length        = 0;
+	uint8_t safe_checksum_types = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum types.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			continue;
+		}
+		segment_length = string_index - segment_start;
+
+		if( ( segment_length == 3 )
+		 && ( system_string_compare(
+		       &( string[ segment_start ] ),
+		       _SYSTEM_STRING( "all" ),
+		       3 ) == 0 ) )
+		{
+			safe_checksum_types |= MULTISUM_CHECKSUM_TYPE_ALL;
+		}
+		else if( ( segment_length == 3 )
+		      && ( system_string_compare(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "md5" ),
+		            3 ) == 0 ) )
+		{
+			safe_checksum_types |= MULTISUM_CHECKSUM_TYPE_MD5;
+		}
+		else if( ( segment_length == 5 )
+		      && ( system_string_compare(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "crc32" ),
+		            5 ) == 0 ) )
+		{
+			safe_checksum_types |= MULTISUM_CHECKSUM_TYPE_CRC32;
+		}
+		else if( ( segment_length == 5 )
+		      && ( system_string_compare(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "crc64" ),
+		            5 ) == 0 ) )
+		{
+			safe_checksum_types |= MULTISUM_CHECKSUM_TYPE_CRC64;
+		}
+		else if( ( segment_length == 7 )
+		      && ( system_string_compare(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "adler32" ),
+		            7 ) == 0 ) )
+		{
+			safe_checksum_types |= MULTISUM_CHECKSUM_TYPE_ADLER32;
+		}
+		else if( ( segment_length == 10 )
+		      && ( system_string_compare(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "fletcher32" ),
+		            10 ) == 0 ) )
+		{
+			safe_checksum_types |= MULTISUM_CHECKSUM_TYPE_FLETCHER32;
+		}
+		else
+		{
+			return( 0 );
+		}
+		segment_start = string_index + 1;
+	}
+	*checksum_types = safe_checksum_types;
+
+	return( 1 );
+}
+
+/* Signal handler for multisum
+ */
+void multisum_signal_handler(
+      assorted_signal_t signal ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( signal )
+
+	assorted_progress_signal_abort(
+	 multisum_progress );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	system_character_t md5_hash_string[ DIGEST_HASH_STRING_SIZE_MD5 ];
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	libcerror_error_t *error           = NULL;
+	libcfile_file_t *source_file       = NULL;
+	assorted_memory_map_t *memory_map  = NULL;
+	libhmac_md5_context_t *md5_context = NULL;
+	multisum_queue_t *queue            = NULL;
+	system_character_t *file_list      = NULL;
+	system_character_t *source         = NULL;
+	const uint8_t *chunk_data          = NULL;
+	uint8_t *buffer                    = NULL;
+	char *program                      = "multisum";
+	system_integer_t option            = 0;
+	size64_t remaining_size            = 0;
+	size64_t source_size               = 0;
+	size_t read_size                   = 0;
+	ssize_t read_count                 = 0;
+	off_t source_offset                = 0;
+	uint64_t crc64                     = 0;
+	uint32_t adler32                   = 0;
+	uint32_t chunk_fletcher32          = 0;
+	uint32_t crc32                     = 0;
+	uint32_t fletcher32                = 0;
+	uint8_t checksum_types             = MULTISUM_CHECKSUM_TYPE_ALL;
+	int argument_index                 = 0;
+	int number_of_threads              = 1;
+	int recursive                      = 0;
+	int result                         = 0;
+	int use_memory_map                 = 0;
+	int verbose                        = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:f:hj:Mm:o:rs:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'c':
+				result = multisum_checksum_types_from_string(
+				          optarg,
+				          &checksum_types,
+				          &error );
+
+				if( result != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported checksum types: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+
+			case 'f':
+				file_list = optarg;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				assorted_cpu_features_set_mask(
+				 (uint32_t) system_string_copy_to_64bit( optarg ) );
+
+				break;
+
+			case 'M':
+				use_memory_map = 1;
+
+				break;
+
+			case 'o':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				source_offset = _wtol( optarg );
+#else
+				source_offset = atol( optarg );
+#endif
+				break;
+
+			case 'r':
+				recursive = 1;
+
+				break;
+
+			case 's':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				source_size = _wtol( optarg );
+#else
+				source_size = atol( optarg );
+#endif
+				break;
+
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( optind == argc )
+	 && ( file_list == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_threads < 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value zero or less.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_threads > MULTISUM_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value exceeds maximum.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( ( ( argc - optind ) > 1 )
+	 || ( file_list != NULL )
+	 || ( recursive != 0 ) )
+	{
+		if( ( source_offset != 0 )
+		 || ( source_size != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Offset and size are only supported for a single source.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		/* The sources are calculated in batches by a thread pool
+		 * and the checksums are printed per source in input order
+		 */
+		if( multisum_queue_initialize(
+		     &queue,
+		     checksum_types,
+		     number_of_threads,
+		     stdout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create queue.\n" );
+
+			goto on_error;
+		}
+		if( multisum_queue_set_use_memory_map(
+		     queue,
+		     (uint8_t) use_memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set use memory map.\n" );
+
+			goto on_error;
+		}
+		if( multisum_queue_set_recursive(
+		     queue,
+		     (uint8_t) recursive,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set recursive.\n" );
+
+			goto on_error;
+		}
+		for( argument_index = optind;
+		     argument_index < argc;
+		     argument_index++ )
+		{
+			if( multisum_queue_append_source(
+			     queue,
+			     argv[ argument_index ],
+			     system_string_length(
+			      argv[ argument_index ] ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append source: %" PRIs_SYSTEM ".\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+		}
+		if( file_list != NULL )
+		{
+			if( multisum_queue_append_sources_from_file_list(
+			     queue,
+			     file_list,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append sources from file list: %" PRIs_SYSTEM ".\n",
+				 file_list );
+
+				goto on_error;
+			}
+		}
+		if( multisum_queue_flush(
+		     queue,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to flush queue.\n" );
+
+			goto on_error;
+		}
+		result = EXIT_SUCCESS;
+
+		if( queue->number_of_failed_sources != 0 )
+		{
+			result = EXIT_FAILURE;
+		}
+		if( multisum_queue_free(
+		     &queue,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free queue.\n" );
+
+			goto on_error;
+		}
+		return( result );
+	}
+	source = argv[ optind ];
+
+	/* The progress is only reported in verbose mode but the abort flag is always checked
+	 */
+	if( assorted_progress_initialize(
+	     &multisum_progress,
+	     ASSORTED_PROGRESS_DEFAULT_INTERVAL,
+	     ( verbose != 0 ) ? &assorted_progress_fprint : NULL,
+	     (void *) stderr,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create progress.\n" );
+
+		goto on_error;
+	}
+	if( assorted_signal_attach(
+	     multisum_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
+	/* Open the source file
+	 */
+	if( libcfile_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#endif
+ 	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size == 0 )
+	{
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( source_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
+	}
+	if( use_memory_map != 0 )
+	{
+		if( assorted_memory_map_initialize(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create memory map.\n" );
+
+			goto on_error;
+		}
+		result = assorted_memory_map_open(
+		          memory_map,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to memory map source file.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Memory mapped input not supported, reading source file instead.\n" );
+
+			if( assorted_memory_map_free(
+			     &memory_map,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free memory map.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( memory_map == NULL )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * MULTISUM_CHUNK_SIZE );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_MD5 ) != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &md5_context,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create MD5 context.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Position the source file at the right offset
+	 */
+	if( libcfile_file_seek_offset(
+	     source_file,
+	     source_offset,
+	     SEEK_SET,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to seek offset in source file.\n" );
+
+		goto on_error;
+	}
+	/* Every chunk is read once and passed to each of the checksum calculations
+	 * while it is still in the CPU cache
+	 */
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = MULTISUM_CHUNK_SIZE;
+
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		if( memory_map != NULL )
+		{
+			chunk_data = &( memory_map->data[ source_size - remaining_size ] );
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      buffer,
+				      read_size,
+				      &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			chunk_data = buffer;
+		}
+		if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_ADLER32 ) != 0 )
+		{
+			if( assorted_adler32_calculate_checksum_simd(
+			     &adler32,
+			     chunk_data,
+			     read_size,
+			     adler32,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calculate Adler-32.\n" );
+
+				goto on_error;
+			}
+		}
+		if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_CRC32 ) != 0 )
+		{
+			if( assorted_crc32_calculate_with_polynomial(
+			     &crc32,
+			     chunk_data,
+			     read_size,
+			     crc32,
+			     0,
+			     0xedb88320UL,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calculate CRC-32.\n" );
+
+				goto on_error;
+			}
+		}
+		if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_CRC64 ) != 0 )
+		{
+			if( assorted_crc64_calculate_with_polynomial(
+			     &crc64,
+			     chunk_data,
+			     read_size,
+			     crc64,
+			     0,
+			     ASSORTED_CRC64_POLYNOMIAL_XZ,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calculate CRC-64.\n" );
+
+				goto on_error;
+			}
+		}
+		if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_FLETCHER32 ) != 0 )
+		{
+			/* The Fletcher-32 of a chunk is calculated independently
+			 * and combined with the Fletcher-32 of the preceding chunks
+			 */
+			if( assorted_fletcher32_calculate_simd(
+			     &chunk_fletcher32,
+			     chunk_data,
+			     read_size,
+			     0,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calculate Fletcher-32.\n" );
+
+				goto on_error;
+			}
+			if( remaining_size == source_size )
+			{
+				fletcher32 = chunk_fletcher32;
+			}
+			else if( assorted_fletcher32_combine(
+			          &fletcher32,
+			          fletcher32,
+			          chunk_fletcher32,
+			          (size64_t) read_size,
+			          &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to combine Fletcher-32.\n" );
+
+				goto on_error;
+			}
+		}
+		if( md5_context != NULL )
+		{
+			if( libhmac_md5_update(
+			     md5_context,
+			     chunk_data,
+			     read_size,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to update MD5.\n" );
+
+				goto on_error;
+			}
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 chunk_data,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
+
+		result = assorted_progress_update(
+		          multisum_progress,
+		          (uint64_t) ( source_size - remaining_size ),
+		          0,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to update progress.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Aborted.\n" );
+
+			goto on_error;
+		}
+	}
+	if( memory_map != NULL )
+	{
+		if( assorted_memory_map_free(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free memory map.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Clean up
+	 */
+	if( assorted_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( assorted_progress_free(
+	     &multisum_progress,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free progress.\n" );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     md5_context,
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to finalize MD5.\n" );
+
+			goto on_error;
+		}
+		if( libhmac_md5_free(
+		     &md5_context,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free MD5 context.\n" );
+
+			goto on_error;
+		}
+		if( digest_hash_copy_to_string(
+		     md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     md5_hash_string,
+		     DIGEST_HASH_STRING_SIZE_MD5,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set MD5 hash string.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The output matches that of the individual checksum tools
+	 */
+	if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_ADLER32 ) != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Calculated Adler-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 adler32,
+		 adler32 );
+	}
+	if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_CRC32 ) != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Calculated CRC-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 crc32,
+		 crc32 );
+	}
+	if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_CRC64 ) != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Calculated CRC-64: %" PRIu64 " (0x%08" PRIx64 ")\n",
+		 crc64,
+		 crc64 );
+	}
+	if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_FLETCHER32 ) != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Calculated Fletcher-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 fletcher32,
+		 fletcher32 );
+	}
+	if( ( checksum_types & MULTISUM_CHECKSUM_TYPE_MD5 ) != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Calculated MD5: %" PRIs_SYSTEM "\n",
+		 md5_hash_string );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( multisum_progress != NULL )
+	{
+		assorted_signal_detach(
+		 NULL );
+		assorted_progress_free(
+		 &multisum_progress,
+		 NULL );
+	}
+	if( queue != NULL )
+	{
+		multisum_queue_free(
+		 &queue,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
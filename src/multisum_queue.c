@@ -0,0 +1,2121 @@
+/*
+ * Multisum work queue
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#include "assorted_adler32.h"
+#include "assorted_crc32.h"
+#include "assorted_crc64.h"
+#include "assorted_fletcher32.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcthreads.h"
+#include "assorted_libhmac.h"
+#include "assorted_memory_map.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+#include "digest_hash.h"
+#include "multisum_queue.h"
+
+/* The maximum size of a line in a file list
+ */
+#define MULTISUM_QUEUE_MAXIMUM_LINE_SIZE	32768
+
+/* Calculates the checksums of a part of a source
+ * The Adler-32 of the task must be set to its initial value
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_task_calculate(
+     multisum_queue_task_t *task,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *source_file       = NULL;
+	assorted_memory_map_t *memory_map  = NULL;
+	libhmac_md5_context_t *md5_context = NULL;
+	const uint8_t *chunk_data          = NULL;
+	uint8_t *buffer                    = NULL;
+	static char *function              = "multisum_queue_task_calculate";
+	size64_t remaining_size            = 0;
+	size64_t source_size               = 0;
+	size_t read_size                   = 0;
+	ssize_t read_count                 = 0;
+	uint32_t chunk_fletcher32          = 0;
+	int result                         = 0;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( task->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid task - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          task->filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          task->filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file.",
+		 function );
+
+		goto on_error;
+	}
+	source_size = task->size;
+
+	if( source_size == 0 )
+	{
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of source file.",
+			 function );
+
+			goto on_error;
+		}
+		if( source_size < (size64_t) task->offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid task offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		source_size -= (size64_t) task->offset;
+	}
+	if( ( task->use_memory_map != 0 )
+	 && ( source_size > 0 ) )
+	{
+		if( assorted_memory_map_initialize(
+		     &memory_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory map.",
+			 function );
+
+			goto on_error;
+		}
+		result = assorted_memory_map_open(
+		          memory_map,
+		          task->filename,
+		          task->offset,
+		          source_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map source file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( assorted_memory_map_free(
+			     &memory_map,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory map.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( memory_map == NULL )
+	 && ( source_size > 0 ) )
+	{
+		read_size = MULTISUM_QUEUE_CHUNK_SIZE;
+
+		if( source_size < (size64_t) read_size )
+		{
+			read_size = (size_t) source_size;
+		}
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * read_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     task->offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in source file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( task->checksum_types & MULTISUM_CHECKSUM_TYPE_MD5 ) != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = MULTISUM_QUEUE_CHUNK_SIZE;
+
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		if( memory_map != NULL )
+		{
+			chunk_data = &( memory_map->data[ source_size - remaining_size ] );
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from source file.",
+				 function );
+
+				goto on_error;
+			}
+			chunk_data = buffer;
+		}
+		if( ( task->checksum_types & MULTISUM_CHECKSUM_TYPE_ADLER32 ) != 0 )
+		{
+			if( assorted_adler32_calculate_checksum_simd(
+			     &( task->adler32 ),
+			     chunk_data,
+			     read_size,
+			     task->adler32,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate Adler-32.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( task->checksum_types & MULTISUM_CHECKSUM_TYPE_CRC32 ) != 0 )
+		{
+			if( assorted_crc32_calculate_with_polynomial(
+			     &( task->crc32 ),
+			     chunk_data,
+			     read_size,
+			     task->crc32,
+			     0,
+			     0xedb88320UL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate CRC-32.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( task->checksum_types & MULTISUM_CHECKSUM_TYPE_CRC64 ) != 0 )
+		{
+			if( assorted_crc64_calculate_with_polynomial(
+			     &( task->crc64 ),
+			     chunk_data,
+			     read_size,
+			     task->crc64,
+			     0,
+			     ASSORTED_CRC64_POLYNOMIAL_XZ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate CRC-64.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( task->checksum_types & MULTISUM_CHECKSUM_TYPE_FLETCHER32 ) != 0 )
+		{
+			if( assorted_fletcher32_calculate_simd(
+			     &chunk_fletcher32,
+			     chunk_data,
+			     read_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate Fletcher-32.",
+				 function );
+
+				goto on_error;
+			}
+			if( remaining_size == source_size )
+			{
+				task->fletcher32 = chunk_fletcher32;
+			}
+			else if( assorted_fletcher32_combine(
+			          &( task->fletcher32 ),
+			          task->fletcher32,
+			          chunk_fletcher32,
+			          (size64_t) read_size,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to combine Fletcher-32.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( md5_context != NULL )
+		{
+			if( libhmac_md5_update(
+			     md5_context,
+			     chunk_data,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update MD5.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		remaining_size -= read_size;
+	}
+	if( md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     md5_context,
+		     task->md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_md5_free(
+		     &md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( memory_map != NULL )
+	{
+		if( assorted_memory_map_free(
+		     &memory_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
+	}
+	if( libcfile_file_close(
+	     source_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source file.",
+		 function );
+
+		goto on_error;
+	}
+	task->calculated_size = source_size;
+
+	return( 1 );
+
+on_error:
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Calculates the checksums of a part of a source from a thread pool
+ * The error is not available from the worker thread, the result is stored in the task
+ * Returns 1 on success or -1 on error
+ */
+int multisum_queue_task_calculate_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	multisum_queue_task_t *task = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	task = (multisum_queue_task_t *) value;
+
+	task->result = multisum_queue_task_calculate(
+	                task,
+	                NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Creates a queue
+ * Make sure the value queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_initialize(
+     multisum_queue_t **queue,
+     uint8_t checksum_types,
+     int number_of_threads,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "multisum_queue_initialize";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checksum_types == 0 )
+	 || ( ( checksum_types & ~( MULTISUM_CHECKSUM_TYPE_ALL ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum types.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output stream.",
+		 function );
+
+		return( -1 );
+	}
+	*queue = memory_allocate_structure(
+	          multisum_queue_t );
+
+	if( *queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *queue,
+	     0,
+	     sizeof( multisum_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queue.",
+		 function );
+
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+
+		return( -1 );
+	}
+	( *queue )->checksum_types    = checksum_types;
+	( *queue )->number_of_threads = number_of_threads;
+	( *queue )->output_stream     = output_stream;
+
+	return( 1 );
+
+on_error:
+	if( *queue != NULL )
+	{
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a queue
+ * Sources that were not flushed are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_free(
+     multisum_queue_t **queue,
+     libcerror_error_t **error )
+{
+	static char *function = "multisum_queue_free";
+	size_t source_index   = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		for( source_index = 0;
+		     source_index < ( *queue )->number_of_sources;
+		     source_index++ )
+		{
+			memory_free(
+			 ( *queue )->sources[ source_index ].filename );
+		}
+		if( ( *queue )->tasks != NULL )
+		{
+			memory_free(
+			 ( *queue )->tasks );
+		}
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the use memory map value
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_set_use_memory_map(
+     multisum_queue_t *queue,
+     uint8_t use_memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "multisum_queue_set_use_memory_map";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	queue->use_memory_map = use_memory_map;
+
+	return( 1 );
+}
+
+/* Sets the recursive value
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_set_recursive(
+     multisum_queue_t *queue,
+     uint8_t recursive,
+     libcerror_error_t **error )
+{
+	static char *function = "multisum_queue_set_recursive";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	queue->recursive = recursive;
+
+	return( 1 );
+}
+
+#if defined( MULTISUM_QUEUE_HAVE_DIRECTORY_WALK )
+
+/* Compares two directory entry names
+ * Returns a value less than, equal to or greater than 0
+ */
+int multisum_queue_compare_entry_names(
+     const void *first_entry_name,
+     const void *second_entry_name )
+{
+	const system_character_t *first_name  = *( (const system_character_t **) first_entry_name );
+	const system_character_t *second_name = *( (const system_character_t **) second_entry_name );
+	size_t first_name_length              = system_string_length( first_name );
+	size_t second_name_length             = system_string_length( second_name );
+
+	/* Include the end-of-string character of the shortest name in the comparison
+	 */
+	if( first_name_length > second_name_length )
+	{
+		first_name_length = second_name_length;
+	}
+	return( system_string_compare(
+	         first_name,
+	         second_name,
+	         first_name_length + 1 ) );
+}
+
+/* Appends a directory entry name to an array of names
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_append_entry_name(
+     system_character_t ***entry_names,
+     size_t *number_of_entry_names,
+     size_t *number_of_allocated_entry_names,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+	system_character_t **reallocated_entry_names = NULL;
+	static char *function                        = "multisum_queue_append_entry_name";
+	size_t name_size                             = 0;
+
+	if( *number_of_entry_names >= *number_of_allocated_entry_names )
+	{
+		if( *number_of_allocated_entry_names == 0 )
+		{
+			*number_of_allocated_entry_names = 64;
+		}
+		else
+		{
+			*number_of_allocated_entry_names *= 2;
+		}
+		reallocated_entry_names = (system_character_t **) memory_reallocate(
+		                                                   *entry_names,
+		                                                   sizeof( system_character_t * ) * *number_of_allocated_entry_names );
+
+		if( reallocated_entry_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entry names.",
+			 function );
+
+			return( -1 );
+		}
+		*entry_names = reallocated_entry_names;
+	}
+	name_size = system_string_length(
+	             name ) + 1;
+
+	( *entry_names )[ *number_of_entry_names ] = system_string_allocate(
+	                                              name_size );
+
+	if( ( *entry_names )[ *number_of_entry_names ] == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     ( *entry_names )[ *number_of_entry_names ],
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		memory_free(
+		 ( *entry_names )[ *number_of_entry_names ] );
+
+		return( -1 );
+	}
+	*number_of_entry_names += 1;
+
+	return( 1 );
+}
+
+/* Appends the files in a directory and its sub directories to the queue
+ * The entries of a directory are appended sorted by name, symbolic links
+ * to directories in the directory are not followed
+ * Returns 1 if successful, 0 if the path is not a directory or -1 on error
+ */
+int multisum_queue_append_directory(
+     multisum_queue_t *queue,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	system_character_t **entry_names       = NULL;
+	system_character_t *entry_path         = NULL;
+	static char *function                  = "multisum_queue_append_directory";
+	size_t entry_name_index                = 0;
+	size_t entry_name_length               = 0;
+	size_t entry_path_length               = 0;
+	size_t number_of_allocated_entry_names = 0;
+	size_t number_of_entry_names           = 0;
+	int result                             = 0;
+
+#if defined( WINAPI )
+	system_character_t *find_path          = NULL;
+	HANDLE find_handle                     = INVALID_HANDLE_VALUE;
+	DWORD file_attributes                  = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+#else
+	struct dirent *directory_entry         = NULL;
+	DIR *directory                         = NULL;
+	struct stat file_statistics;
+#endif
+
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_attributes = GetFileAttributesW(
+	                   path );
+#else
+	file_attributes = GetFileAttributesA(
+	                   path );
+#endif
+	if( ( file_attributes == INVALID_FILE_ATTRIBUTES )
+	 || ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+	 || ( ( file_attributes & FILE_ATTRIBUTE_REPARSE_POINT ) != 0 ) )
+	{
+		return( 0 );
+	}
+	find_path = system_string_allocate(
+	             path_length + 3 );
+
+	if( find_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create find path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     find_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy find path.",
+		 function );
+
+		goto on_error;
+	}
+	find_path[ path_length ]     = (system_character_t) MULTISUM_QUEUE_PATH_SEPARATOR;
+	find_path[ path_length + 1 ] = (system_character_t) '*';
+	find_path[ path_length + 2 ] = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               find_path,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               find_path,
+	               &find_data );
+#endif
+	memory_free(
+	 find_path );
+
+	find_path = NULL;
+
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	do
+	{
+		if( ( find_data.cFileName[ 0 ] == (system_character_t) '.' )
+		 && ( ( find_data.cFileName[ 1 ] == 0 )
+		  || ( ( find_data.cFileName[ 1 ] == (system_character_t) '.' )
+		   && ( find_data.cFileName[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+		 && ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT ) != 0 ) )
+		{
+			continue;
+		}
+		if( multisum_queue_append_entry_name(
+		     &entry_names,
+		     &number_of_entry_names,
+		     &number_of_allocated_entry_names,
+		     find_data.cFileName,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( FindNextFileW(
+	        find_handle,
+	        &find_data ) != 0 );
+#else
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+#endif
+
+	FindClose(
+	 find_handle );
+
+	find_handle = INVALID_HANDLE_VALUE;
+#else
+	if( stat(
+	     path,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( !S_ISDIR( file_statistics.st_mode ) )
+	{
+		return( 0 );
+	}
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	for( directory_entry = readdir( directory );
+	     directory_entry != NULL;
+	     directory_entry = readdir( directory ) )
+	{
+		if( ( directory_entry->d_name[ 0 ] == '.' )
+		 && ( ( directory_entry->d_name[ 1 ] == 0 )
+		  || ( ( directory_entry->d_name[ 1 ] == '.' )
+		   && ( directory_entry->d_name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( multisum_queue_append_entry_name(
+		     &entry_names,
+		     &number_of_entry_names,
+		     &number_of_allocated_entry_names,
+		     directory_entry->d_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	closedir(
+	 directory );
+
+	directory = NULL;
+#endif /* defined( WINAPI ) */
+
+	/* Sort the entries so the output does not depend on the order
+	 * in which the file system returns them
+	 */
+	if( number_of_entry_names > 1 )
+	{
+		qsort(
+		 entry_names,
+		 number_of_entry_names,
+		 sizeof( system_character_t * ),
+		 &multisum_queue_compare_entry_names );
+	}
+	if( ( path_length > 0 )
+	 && ( path[ path_length - 1 ] == (system_character_t) MULTISUM_QUEUE_PATH_SEPARATOR ) )
+	{
+		path_length--;
+	}
+	for( entry_name_index = 0;
+	     entry_name_index < number_of_entry_names;
+	     entry_name_index++ )
+	{
+		entry_name_length = system_string_length(
+		                     entry_names[ entry_name_index ] );
+
+		entry_path_length = path_length + 1 + entry_name_length;
+
+		entry_path = system_string_allocate(
+		              entry_path_length + 1 );
+
+		if( entry_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     entry_path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path to entry path.",
+			 function );
+
+			goto on_error;
+		}
+		entry_path[ path_length ] = (system_character_t) MULTISUM_QUEUE_PATH_SEPARATOR;
+
+		if( system_string_copy(
+		     &( entry_path[ path_length + 1 ] ),
+		     entry_names[ entry_name_index ],
+		     entry_name_length + 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name to entry path.",
+			 function );
+
+			goto on_error;
+		}
+#if !defined( WINAPI )
+		if( ( lstat(
+		       entry_path,
+		       &file_statistics ) == 0 )
+		 && S_ISLNK( file_statistics.st_mode )
+		 && ( stat(
+		       entry_path,
+		       &file_statistics ) == 0 )
+		 && S_ISDIR( file_statistics.st_mode ) )
+		{
+			result = 1;
+		}
+		else
+#endif
+		{
+			result = multisum_queue_append_source(
+			          queue,
+			          entry_path,
+			          entry_path_length,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source: %" PRIs_SYSTEM ".",
+			 function,
+			 entry_path );
+
+			goto on_error;
+		}
+		memory_free(
+		 entry_path );
+
+		entry_path = NULL;
+
+		memory_free(
+		 entry_names[ entry_name_index ] );
+
+		entry_names[ entry_name_index ] = NULL;
+	}
+	if( entry_names != NULL )
+	{
+		memory_free(
+		 entry_names );
+	}
+	return( 1 );
+
+on_error:
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+#if defined( WINAPI )
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+	if( find_path != NULL )
+	{
+		memory_free(
+		 find_path );
+	}
+#else
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+#endif
+	if( entry_names != NULL )
+	{
+		for( entry_name_index = 0;
+		     entry_name_index < number_of_entry_names;
+		     entry_name_index++ )
+		{
+			if( entry_names[ entry_name_index ] != NULL )
+			{
+				memory_free(
+				 entry_names[ entry_name_index ] );
+			}
+		}
+		memory_free(
+		 entry_names );
+	}
+	return( -1 );
+}
+
+#endif /* defined( MULTISUM_QUEUE_HAVE_DIRECTORY_WALK ) */
+
+/* Appends a source to the queue
+ * If the queue is recursive and the source is a directory the files in the directory
+ * are appended instead. The current batch is flushed when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_append_source(
+     multisum_queue_t *queue,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_filename = NULL;
+	static char *function             = "multisum_queue_append_source";
+
+#if defined( MULTISUM_QUEUE_HAVE_DIRECTORY_WALK )
+	int result                        = 0;
+#endif
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( MULTISUM_QUEUE_HAVE_DIRECTORY_WALK )
+	if( queue->recursive != 0 )
+	{
+		result = multisum_queue_append_directory(
+		          queue,
+		          filename,
+		          filename_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			return( 1 );
+		}
+	}
+#endif
+	safe_filename = system_string_allocate(
+	                 filename_length + 1 );
+
+	if( safe_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     safe_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		memory_free(
+		 safe_filename );
+
+		return( -1 );
+	}
+	safe_filename[ filename_length ] = 0;
+
+	queue->sources[ queue->number_of_sources ].filename         = safe_filename;
+	queue->sources[ queue->number_of_sources ].first_task_index = 0;
+	queue->sources[ queue->number_of_sources ].number_of_tasks  = 0;
+
+	queue->number_of_sources += 1;
+
+	if( queue->number_of_sources >= MULTISUM_QUEUE_BATCH_SIZE )
+	{
+		if( multisum_queue_flush(
+		     queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the sources in a file list to the queue
+ * The file list contains a source per line, empty lines are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_append_sources_from_file_list(
+     multisum_queue_t *queue,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *line = NULL;
+	FILE *file_list_stream   = NULL;
+	static char *function    = "multisum_queue_append_sources_from_file_list";
+	size_t line_length       = 0;
+	size_t line_number       = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	line = system_string_allocate(
+	        MULTISUM_QUEUE_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_list_stream = file_stream_open_wide(
+	                    filename,
+	                    _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	file_list_stream = file_stream_open(
+	                    filename,
+	                    FILE_STREAM_OPEN_READ );
+#endif
+	if( file_list_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file list: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        file_list_stream,
+	        line,
+	        MULTISUM_QUEUE_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        file_list_stream,
+	        line,
+	        MULTISUM_QUEUE_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( MULTISUM_QUEUE_MAXIMUM_LINE_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %" PRIzd " value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length--;
+		}
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		line[ line_length ] = 0;
+
+		if( multisum_queue_append_source(
+		     queue,
+		     line,
+		     line_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source of line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_list_stream ) != 0 )
+	{
+		file_list_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file list.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( file_list_stream != NULL )
+	{
+		file_stream_close(
+		 file_list_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+/* Determines the number of tasks of a source
+ * A source is only split into parts if all checksum types can be combined
+ * and multiple threads are used
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_get_number_of_source_tasks(
+     multisum_queue_t *queue,
+     const system_character_t *filename,
+     size_t *number_of_tasks,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *source_file = NULL;
+	static char *function        = "multisum_queue_get_number_of_source_tasks";
+	size64_t source_size         = 0;
+	int result                   = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of tasks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_tasks = 1;
+
+	if( ( queue->number_of_threads <= 1 )
+	 || ( ( queue->checksum_types & ~( MULTISUM_CHECKSUM_TYPES_COMBINABLE ) ) != 0 ) )
+	{
+		return( 1 );
+	}
+	if( libcfile_file_initialize(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file.",
+		 function );
+
+		return( -1 );
+	}
+	/* A source that cannot be opened is not split, the error is reported
+	 * when its task is calculated
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          NULL );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          NULL );
+#endif
+	if( result == 1 )
+	{
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     NULL ) == 1 )
+		{
+			if( source_size > MULTISUM_QUEUE_PART_SIZE )
+			{
+				*number_of_tasks = (size_t) ( ( source_size + MULTISUM_QUEUE_PART_SIZE - 1 ) / MULTISUM_QUEUE_PART_SIZE );
+			}
+		}
+		libcfile_file_close(
+		 source_file,
+		 NULL );
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the checksums of a source
+ * The checksums of the parts of the source are combined in order
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_print_source(
+     multisum_queue_t *queue,
+     multisum_queue_source_t *source,
+     libcerror_error_t **error )
+{
+	system_character_t md5_hash_string[ DIGEST_HASH_STRING_SIZE_MD5 ];
+
+	multisum_queue_task_t *task = NULL;
+	static char *function       = "multisum_queue_print_source";
+	size_t task_index           = 0;
+	uint64_t crc64              = 0;
+	uint32_t adler32            = 0;
+	uint32_t crc32              = 0;
+	uint32_t fletcher32         = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	for( task_index = 0;
+	     task_index < source->number_of_tasks;
+	     task_index++ )
+	{
+		task = &( queue->tasks[ source->first_task_index + task_index ] );
+
+		if( task_index == 0 )
+		{
+			adler32    = task->adler32;
+			crc32      = task->crc32;
+			crc64      = task->crc64;
+			fletcher32 = task->fletcher32;
+
+			continue;
+		}
+		if( ( queue->checksum_types & MULTISUM_CHECKSUM_TYPE_ADLER32 ) != 0 )
+		{
+			if( assorted_adler32_combine(
+			     &adler32,
+			     adler32,
+			     task->adler32,
+			     task->calculated_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to combine Adler-32.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( queue->checksum_types & MULTISUM_CHECKSUM_TYPE_CRC32 ) != 0 )
+		{
+			if( assorted_crc32_combine(
+			     &crc32,
+			     crc32,
+			     task->crc32,
+			     task->calculated_size,
+			     0xedb88320UL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to combine CRC-32.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( queue->checksum_types & MULTISUM_CHECKSUM_TYPE_FLETCHER32 ) != 0 )
+		{
+			if( assorted_fletcher32_combine(
+			     &fletcher32,
+			     fletcher32,
+			     task->fletcher32,
+			     task->calculated_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to combine Fletcher-32.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( queue->checksum_types & MULTISUM_CHECKSUM_TYPE_ADLER32 ) != 0 )
+	{
+		fprintf(
+		 queue->output_stream,
+		 "%08" PRIx32 " ",
+		 adler32 );
+	}
+	if( ( queue->checksum_types & MULTISUM_CHECKSUM_TYPE_CRC32 ) != 0 )
+	{
+		fprintf(
+		 queue->output_stream,
+		 "%08" PRIx32 " ",
+		 crc32 );
+	}
+	if( ( queue->checksum_types & MULTISUM_CHECKSUM_TYPE_CRC64 ) != 0 )
+	{
+		fprintf(
+		 queue->output_stream,
+		 "%016" PRIx64 " ",
+		 crc64 );
+	}
+	if( ( queue->checksum_types & MULTISUM_CHECKSUM_TYPE_FLETCHER32 ) != 0 )
+	{
+		fprintf(
+		 queue->output_stream,
+		 "%08" PRIx32 " ",
+		 fletcher32 );
+	}
+	if( ( queue->checksum_types & MULTISUM_CHECKSUM_TYPE_MD5 ) != 0 )
+	{
+		if( digest_hash_copy_to_string(
+		     queue->tasks[ source->first_task_index ].md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     md5_hash_string,
+		     DIGEST_HASH_STRING_SIZE_MD5,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set MD5 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 queue->output_stream,
+		 "%" PRIs_SYSTEM " ",
+		 md5_hash_string );
+	}
+	fprintf(
+	 queue->output_stream,
+	 " %" PRIs_SYSTEM "\n",
+	 source->filename );
+
+	return( 1 );
+}
+
+/* Calculates the checksums of the sources of the current batch and prints them in input order
+ * A source that cannot be calculated is reported on stderr and counted as failed
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_queue_flush(
+     multisum_queue_t *queue,
+     libcerror_error_t **error )
+{
+	multisum_queue_task_t *reallocated_tasks = NULL;
+	multisum_queue_task_t *task              = NULL;
+	static char *function                    = "multisum_queue_flush";
+	size_t number_of_source_tasks            = 0;
+	size_t number_of_tasks                   = 0;
+	size_t source_index                      = 0;
+	size_t task_index                        = 0;
+	int source_failed                        = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool      = NULL;
+	int maximum_number_of_values             = 0;
+#endif
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue->number_of_sources == 0 )
+	{
+		return( 1 );
+	}
+	for( source_index = 0;
+	     source_index < queue->number_of_sources;
+	     source_index++ )
+	{
+		if( multisum_queue_get_number_of_source_tasks(
+		     queue,
+		     queue->sources[ source_index ].filename,
+		     &number_of_source_tasks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of tasks of source: %" PRIzd ".",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		queue->sources[ source_index ].first_task_index = number_of_tasks;
+		queue->sources[ source_index ].number_of_tasks  = number_of_source_tasks;
+
+		number_of_tasks += number_of_source_tasks;
+	}
+	if( number_of_tasks > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of tasks value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_tasks > queue->number_of_allocated_tasks )
+	{
+		reallocated_tasks = (multisum_queue_task_t *) memory_reallocate(
+		                                               queue->tasks,
+		                                               sizeof( multisum_queue_task_t ) * number_of_tasks );
+
+		if( reallocated_tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize tasks.",
+			 function );
+
+			goto on_error;
+		}
+		queue->tasks                     = reallocated_tasks;
+		queue->number_of_allocated_tasks = number_of_tasks;
+	}
+	if( memory_set(
+	     queue->tasks,
+	     0,
+	     sizeof( multisum_queue_task_t ) * number_of_tasks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tasks.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < queue->number_of_sources;
+	     source_index++ )
+	{
+		for( task_index = 0;
+		     task_index < queue->sources[ source_index ].number_of_tasks;
+		     task_index++ )
+		{
+			task = &( queue->tasks[ queue->sources[ source_index ].first_task_index + task_index ] );
+
+			task->filename       = queue->sources[ source_index ].filename;
+			task->checksum_types = queue->checksum_types;
+			task->use_memory_map = queue->use_memory_map;
+			task->offset         = (off64_t) task_index * MULTISUM_QUEUE_PART_SIZE;
+
+			/* The last part is calculated up to the end of the source
+			 */
+			if( task_index < ( queue->sources[ source_index ].number_of_tasks - 1 ) )
+			{
+				task->size = MULTISUM_QUEUE_PART_SIZE;
+			}
+			/* The Adler-32 of the parts after the first are combined
+			 * and therefore calculated with an initial value of 1
+			 */
+			if( task_index > 0 )
+			{
+				task->adler32 = 1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( queue->number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = queue->number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = (int) number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     queue->number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &multisum_queue_task_calculate_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( queue->tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %" PRIzd " onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( source_index = 0;
+	     source_index < queue->number_of_sources;
+	     source_index++ )
+	{
+		source_failed = 0;
+
+		for( task_index = 0;
+		     task_index < queue->sources[ source_index ].number_of_tasks;
+		     task_index++ )
+		{
+			task = &( queue->tasks[ queue->sources[ source_index ].first_task_index + task_index ] );
+
+			/* Without a thread pool the task is calculated here
+			 */
+			if( task->result == 0 )
+			{
+				task->result = multisum_queue_task_calculate(
+				                task,
+				                NULL );
+			}
+			if( task->result != 1 )
+			{
+				source_failed = 1;
+			}
+		}
+		if( source_failed != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate checksums of: %" PRIs_SYSTEM "\n",
+			 queue->sources[ source_index ].filename );
+
+			queue->number_of_failed_sources += 1;
+		}
+		else if( multisum_queue_print_source(
+		          queue,
+		          &( queue->sources[ source_index ] ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print source: %" PRIzd ".",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		memory_free(
+		 queue->sources[ source_index ].filename );
+
+		queue->sources[ source_index ].filename = NULL;
+	}
+	queue->number_of_sources = 0;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,281 @@
+/*
+ * Multisum work queue
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MULTISUM_QUEUE_H )
+#define _MULTISUM_QUEUE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define DIGEST_HASH_STRING_SIZE_MD5	33
+
+/* Directories can be walked on Windows and on POSIX systems with dirent
+ * that use narrow system strings
+ */
+#if defined( WINAPI )
+#define MULTISUM_QUEUE_HAVE_DIRECTORY_WALK	1
+#define MULTISUM_QUEUE_PATH_SEPARATOR		'\\'
+
+#elif defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define MULTISUM_QUEUE_HAVE_DIRECTORY_WALK	1
+#define MULTISUM_QUEUE_PATH_SEPARATOR		'/'
+
+#endif
+
+/* The number of sources that are calculated in a single batch
+ * the results of a batch are printed in input order before the next batch is started
+ */
+#define MULTISUM_QUEUE_BATCH_SIZE	4096
+
+/* The size of the parts a large source is split into, which are calculated
+ * independently and combined afterwards
+ */
+#define MULTISUM_QUEUE_PART_SIZE	( 32 * 1024 * 1024 )
+
+/* The size of the chunks a part is read in
+ */
+#define MULTISUM_QUEUE_CHUNK_SIZE	( 256 * 1024 )
+
+enum MULTISUM_CHECKSUM_TYPES
+{
+	MULTISUM_CHECKSUM_TYPE_ADLER32		= 0x01,
+	MULTISUM_CHECKSUM_TYPE_CRC32		= 0x02,
+	MULTISUM_CHECKSUM_TYPE_CRC64		= 0x04,
+	MULTISUM_CHECKSUM_TYPE_FLETCHER32	= 0x08,
+	MULTISUM_CHECKSUM_TYPE_MD5		= 0x10,
+
+	MULTISUM_CHECKSUM_TYPE_ALL		= 0x1f
+};
+
+/* The checksum types that can be combined from the checksums of consecutive parts
+ */
+#define MULTISUM_CHECKSUM_TYPES_COMBINABLE \
+	( MULTISUM_CHECKSUM_TYPE_ADLER32 | MULTISUM_CHECKSUM_TYPE_CRC32 | MULTISUM_CHECKSUM_TYPE_FLETCHER32 )
+
+typedef struct multisum_queue_task multisum_queue_task_t;
+
+struct multisum_queue_task
+{
+	/* The source filename
+	 */
+	const system_character_t *filename;
+
+	/* The checksum types
+	 */
+	uint8_t checksum_types;
+
+	/* Value to indicate memory mapped input should be used
+	 */
+	uint8_t use_memory_map;
+
+	/* The offset of the part
+	 */
+	off64_t offset;
+
+	/* The size of the part, 0 represents the remainder of the source
+	 */
+	size64_t size;
+
+	/* The size of the data that was calculated
+	 */
+	size64_t calculated_size;
+
+	/* The calculated Adler-32
+	 */
+	uint32_t adler32;
+
+	/* The calculated CRC-32
+	 */
+	uint32_t crc32;
+
+	/* The calculated CRC-64
+	 */
+	uint64_t crc64;
+
+	/* The calculated Fletcher-32
+	 */
+	uint32_t fletcher32;
+
+	/* The calculated MD5 hash
+	 */
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* The result of the task, 0 if not calculated
+	 */
+	int result;
+};
+
+typedef struct multisum_queue_source multisum_queue_source_t;
+
+struct multisum_queue_source
+{
+	/* The filename
+	 */
+	system_character_t *filename;
+
+	/* The index of the first task
+	 */
+	size_t first_task_index;
+
+	/* The number of tasks
+	 */
+	size_t number_of_tasks;
+};
+
+typedef struct multisum_queue multisum_queue_t;
+
+struct multisum_queue
+{
+	/* The checksum types
+	 */
+	uint8_t checksum_types;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate memory mapped input should be used
+	 */
+	uint8_t use_memory_map;
+
+	/* Value to indicate directories should be walked recursively
+	 */
+	uint8_t recursive;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* The sources of the current batch
+	 */
+	multisum_queue_source_t sources[ MULTISUM_QUEUE_BATCH_SIZE ];
+
+	/* The number of sources in the current batch
+	 */
+	size_t number_of_sources;
+
+	/* The tasks of the current batch
+	 */
+	multisum_queue_task_t *tasks;
+
+	/* The number of allocated tasks
+	 */
+	size_t number_of_allocated_tasks;
+
+	/* The number of sources that could not be calculated
+	 */
+	size_t number_of_failed_sources;
+};
+
+int multisum_queue_task_calculate(
+     multisum_queue_task_t *task,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int multisum_queue_task_calculate_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int multisum_queue_initialize(
+     multisum_queue_t **queue,
+     uint8_t checksum_types,
+     int number_of_threads,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+int multisum_queue_free(
+     multisum_queue_t **queue,
+     libcerror_error_t **error );
+
+int multisum_queue_set_use_memory_map(
+     multisum_queue_t *queue,
+     uint8_t use_memory_map,
+     libcerror_error_t **error );
+
+int multisum_queue_set_recursive(
+     multisum_queue_t *queue,
+     uint8_t recursive,
+     libcerror_error_t **error );
+
+#if defined( MULTISUM_QUEUE_HAVE_DIRECTORY_WALK )
+
+int multisum_queue_compare_entry_names(
+     const void *first_entry_name,
+     const void *second_entry_name );
+
+int multisum_queue_append_entry_name(
+     system_character_t ***entry_names,
+     size_t *number_of_entry_names,
+     size_t *number_of_allocated_entry_names,
+     const system_character_t *name,
+     libcerror_error_t **error );
+
+int multisum_queue_append_directory(
+     multisum_queue_t *queue,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+#endif /* defined( MULTISUM_QUEUE_HAVE_DIRECTORY_WALK ) */
+
+int multisum_queue_append_source(
+     multisum_queue_t *queue,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int multisum_queue_append_sources_from_file_list(
+     multisum_queue_t *queue,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int multisum_queue_get_number_of_source_tasks(
+     multisum_queue_t *queue,
+     const system_character_t *filename,
+     size_t *number_of_tasks,
+     libcerror_error_t **error );
+
+int multisum_queue_print_source(
+     multisum_queue_t *queue,
+     multisum_queue_source_t *source,
+     libcerror_error_t **error );
+
+int multisum_queue_flush(
+     multisum_queue_t *queue,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MULTISUM_QUEUE_H ) */
+
@@ -38,6 +38,12 @@
 #include "assorted_libfplist.h"
 #include "assorted_libuna.h"
 #include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "plistinfo_queue.h"
+
+/* The maximum number of threads
+ */
+#define PLISTINFO_MAXIMUM_NUMBER_OF_THREADS	64
 
 /* Prints the executable usage information
  */
@@ -50,13 +56,28 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use plistinfo to determine information about a Property List (plist) file.\n\n" );
 
-	fprintf( stream, "Usage: plistinfo [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: plistinfo [ -f file_list ] [ -k key_path ] [ -o offset ] [ -s size ]\n"
+	                 "                 [ -j number_of_threads ] [ -hrvV ] [ source ... ]\n\n" );
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\tsource: the source file, when multiple sources are specified, or\n"
+	                 "\t        -f or -r are used, the sources are read in batches and\n"
+	                 "\t        their information is printed in input order\n\n" );
 
+	fprintf( stream, "\t-f:     file with a source per line to determine the information of\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
-	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
-	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-j:     number of threads used to read multiple sources\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-k:     key path of a property to print, where the components are\n"
+	                 "\t        separated by '/' and a number indexes an array entry, for\n"
+	                 "\t        example: -k CFBundleIdentifier or -k Items/0/Name\n"
+	                 "\t        only the properties on the key path are read, the option\n"
+	                 "\t        can be specified multiple times\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0), only supported for a single source\n" );
+	fprintf( stream, "\t-r:     determine the information of the files in source directories\n"
+	                 "\t        and their sub directories\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size), only supported\n"
+	                 "\t        for a single source\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
@@ -70,19 +91,22 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error                 = NULL;
-	libcfile_file_t *source_file             = NULL;
-	libfplist_property_list_t *property_list = NULL;
-	system_character_t *source               = NULL;
-	uint8_t *buffer                          = NULL;
-	char *program                            = "plistinfo";
-	system_integer_t option                  = 0;
-	size64_t source_size                     = 0;
-	size_t buffer_size                       = 0;
-	ssize_t read_count                       = 0;
-	off_t source_offset                      = 0;
-	int result                               = 0;
-	int verbose                              = 0;
+	system_character_t *key_paths[ PLISTINFO_QUEUE_MAXIMUM_NUMBER_OF_KEY_PATHS ];
+
+	libcerror_error_t *error      = NULL;
+	plistinfo_queue_t *queue      = NULL;
+	system_character_t *file_list = NULL;
+	char *program                 = "plistinfo";
+	system_integer_t option       = 0;
+	size64_t source_size          = 0;
+	off_t source_offset           = 0;
+	int argument_index            = 0;
+	int key_path_index            = 0;
+	int number_of_key_paths       = 0;
+	int number_of_threads         = 1;
+	int recursive                 = 0;
+	int result                    = 0;
+	int verbose                   = 0;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -97,7 +121,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "f:hj:k:o:rs:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -113,12 +137,31 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'f':
+				file_list = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'k':
+				if( number_of_key_paths >= PLISTINFO_QUEUE_MAXIMUM_NUMBER_OF_KEY_PATHS )
+				{
+					fprintf(
+					 stderr,
+					 "Too many key paths, maximum is: %d.\n",
+					 PLISTINFO_QUEUE_MAXIMUM_NUMBER_OF_KEY_PATHS );
+
+					return( EXIT_FAILURE );
+				}
+				key_paths[ number_of_key_paths++ ] = optarg;
+
+				break;
+
 			case (system_integer_t) 'o':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_offset = _wtol( optarg );
@@ -127,6 +170,11 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case (system_integer_t) 'r':
+				recursive = 1;
+
+				break;
+
 			case (system_integer_t) 's':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_size = _wtol( optarg );
@@ -135,6 +183,12 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case (system_integer_t) 'j':
+			case (system_integer_t) 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -147,7 +201,8 @@ int main( int argc, char * const argv[] )
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( optind == argc )
+	 && ( file_list == NULL ) )
 	{
 		fprintf(
 		 stderr,
@@ -158,182 +213,156 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
-
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-	libcnotify_verbose_set(
-	 verbose );
-
-	/* Open the source file
-	 */
-	if( libcfile_file_initialize(
-	     &source_file,
-	     &error ) != 1 )
+	if( number_of_threads < 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create source file.\n" );
+		 "Invalid number of threads value zero or less.\n" );
 
-		goto on_error;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          source_file,
-	          source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
-#else
-	result = libcfile_file_open(
-	          source_file,
-	          source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
-#endif
- 	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to open source file.\n" );
-
-		goto on_error;
-	}
-	if( source_size == 0 )
-	{
-		if( libcfile_file_get_size(
-		     source_file,
-		     &source_size,
-		     &error ) == -1 )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to determine size of source file.\n" );
-
-			goto on_error;
-		}
+		return( EXIT_FAILURE );
 	}
-	if( source_size == 0 )
+	if( number_of_threads > PLISTINFO_MAXIMUM_NUMBER_OF_THREADS )
 	{
 		fprintf(
 		 stderr,
-		 "Invalid source size value is zero.\n" );
+		 "Invalid number of threads value exceeds maximum.\n" );
 
 		return( EXIT_FAILURE );
 	}
-	if( source_size > (size_t) SSIZE_MAX )
+	if( ( ( source_offset != 0 )
+	  || ( source_size != 0 ) )
+	 && ( ( ( argc - optind ) > 1 )
+	  || ( file_list != NULL )
+	  || ( recursive != 0 ) ) )
 	{
 		fprintf(
 		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		 "Offset and size are only supported for a single source.\n" );
 
 		return( EXIT_FAILURE );
 	}
-	/* Create the input buffer
-	 */
-	buffer_size = source_size;
-
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
 
-	if( buffer == NULL )
+	/* The sources are read in batches by a thread pool and the information
+	 * is printed per source in input order, a single source is a batch of one
+	 */
+	if( plistinfo_queue_initialize(
+	     &queue,
+	     number_of_threads,
+	     stdout,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create buffer.\n" );
+		 "Unable to create queue.\n" );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	/* Position the source file at the right offset
-	 */
-	if( libcfile_file_seek_offset(
-	     source_file,
-	     source_offset,
-	     SEEK_SET,
-	     &error ) == -1 )
+	if( plistinfo_queue_set_recursive(
+	     queue,
+	     (uint8_t) recursive,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to seek offset in source file.\n" );
+		 "Unable to set recursive.\n" );
 
 		goto on_error;
 	}
-	if( libfplist_property_list_initialize(
-	     &property_list,
+	if( plistinfo_queue_set_data_range(
+	     queue,
+	     (off64_t) source_offset,
+	     source_size,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create property list.\n" );
+		 "Unable to set data range.\n" );
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
+	for( key_path_index = 0;
+	     key_path_index < number_of_key_paths;
+	     key_path_index++ )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		if( plistinfo_queue_append_key_path(
+		     queue,
+		     key_paths[ key_path_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append key path: %" PRIs_SYSTEM ".\n",
+			 key_paths[ key_path_index ] );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( libfplist_property_list_copy_from_byte_stream(
-	     property_list,
-	     buffer,
-	     buffer_size,
-	     &error ) != 1 )
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read property list.\n" );
+		if( plistinfo_queue_append_source(
+		     queue,
+		     argv[ argument_index ],
+		     system_string_length(
+		      argv[ argument_index ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-/* TODO print plist info */
+	if( file_list != NULL )
+	{
+		if( plistinfo_queue_append_sources_from_file_list(
+		     queue,
+		     file_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append sources from file list: %" PRIs_SYSTEM ".\n",
+			 file_list );
 
-	/* Clean up
-	 */
-	if( libfplist_property_list_free(
-	     &property_list,
+			goto on_error;
+		}
+	}
+	if( plistinfo_queue_flush(
+	     queue,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to free property list.\n" );
+		 "Unable to flush queue.\n" );
 
 		goto on_error;
 	}
-	if( libcfile_file_close(
-	     source_file,
-	     &error ) != 0 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to close source file.\n" );
+	result = EXIT_SUCCESS;
 
-		goto on_error;
+	if( queue->number_of_failed_sources != 0 )
+	{
+		result = EXIT_FAILURE;
 	}
-	if( libcfile_file_free(
-	     &source_file,
+	if( plistinfo_queue_free(
+	     &queue,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to free source file.\n" );
+		 "Unable to free queue.\n" );
 
 		goto on_error;
 	}
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
-	return( EXIT_SUCCESS );
+	return( result );
 
 on_error:
 	if( error != NULL )
@@ -343,21 +372,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( property_list != NULL )
-	{
-		libfplist_property_list_free(
-		 &property_list,
-		 NULL );
-	}
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
-	if( source_file != NULL )
+	if( queue != NULL )
 	{
-		libcfile_file_free(
-		 &source_file,
+		plistinfo_queue_free(
+		 &queue,
 		 NULL );
 	}
 	return( EXIT_FAILURE );
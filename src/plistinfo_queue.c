@@ -0,0 +1,2554 @@
+/*
+ * Plistinfo work queue
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcthreads.h"
+#include "assorted_libfplist.h"
+#include "assorted_libuna.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+#include "plistinfo_queue.h"
+
+/* The maximum size of a line in a file list
+ */
+#define PLISTINFO_QUEUE_MAXIMUM_LINE_SIZE	32768
+
+/* The initial allocated size of the output data of a task
+ */
+#define PLISTINFO_QUEUE_INITIAL_OUTPUT_SIZE	4096
+
+/* Appends a string to the output data of a task
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_task_append_string(
+     plistinfo_queue_task_t *task,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	char *reallocated_output_data     = NULL;
+	static char *function             = "plistinfo_queue_task_append_string";
+	size_t allocated_output_data_size = 0;
+	size_t required_output_data_size  = 0;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - task->output_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	required_output_data_size = task->output_data_size + string_length;
+
+	if( required_output_data_size > task->allocated_output_data_size )
+	{
+		allocated_output_data_size = task->allocated_output_data_size;
+
+		if( allocated_output_data_size == 0 )
+		{
+			allocated_output_data_size = PLISTINFO_QUEUE_INITIAL_OUTPUT_SIZE;
+		}
+		while( allocated_output_data_size < required_output_data_size )
+		{
+			if( allocated_output_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				allocated_output_data_size = required_output_data_size;
+
+				break;
+			}
+			allocated_output_data_size *= 2;
+		}
+		reallocated_output_data = (char *) memory_reallocate(
+		                                    task->output_data,
+		                                    sizeof( char ) * allocated_output_data_size );
+
+		if( reallocated_output_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize output data.",
+			 function );
+
+			return( -1 );
+		}
+		task->output_data                = reallocated_output_data;
+		task->allocated_output_data_size = allocated_output_data_size;
+	}
+	if( string_length > 0 )
+	{
+		if( memory_copy(
+		     &( task->output_data[ task->output_data_size ] ),
+		     string,
+		     string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string to output data.",
+			 function );
+
+			return( -1 );
+		}
+		task->output_data_size += string_length;
+	}
+	return( 1 );
+}
+
+/* Appends the value type and value of a property to the output data of a task
+ * Only the value of the property itself is retrieved, the entries of arrays
+ * and dictionaries are not materialized
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_task_append_property_value(
+     plistinfo_queue_task_t *task,
+     libfplist_property_t *property,
+     libcerror_error_t **error )
+{
+	char value_string[ 64 ];
+
+	uint8_t *string            = NULL;
+	const char *type_string    = NULL;
+	static char *function      = "plistinfo_queue_task_append_property_value";
+	size_t data_size           = 0;
+	size_t string_size         = 0;
+	uint64_t value_64bit       = 0;
+	int number_of_entries      = 0;
+	int print_count            = 0;
+	int value_type             = 0;
+
+	if( libfplist_property_get_value_type(
+	     property,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		goto on_error;
+	}
+	switch( value_type )
+	{
+		case LIBFPLIST_VALUE_TYPE_ARRAY:
+			if( libfplist_property_get_array_number_of_entries(
+			     property,
+			     &number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of array entries.",
+				 function );
+
+				goto on_error;
+			}
+			print_count = narrow_string_snprintf(
+			               value_string,
+			               64,
+			               "array: %d entries",
+			               number_of_entries );
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_BINARY_DATA:
+			if( libfplist_property_get_value_data_size(
+			     property,
+			     &data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value data size.",
+				 function );
+
+				goto on_error;
+			}
+			print_count = narrow_string_snprintf(
+			               value_string,
+			               64,
+			               "binary data: %" PRIzd " bytes",
+			               data_size );
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_INTEGER:
+			if( libfplist_property_get_value_integer(
+			     property,
+			     &value_64bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve integer value.",
+				 function );
+
+				goto on_error;
+			}
+			print_count = narrow_string_snprintf(
+			               value_string,
+			               64,
+			               "integer: %" PRIi64 "",
+			               (int64_t) value_64bit );
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_STRING:
+			if( libfplist_property_get_value_string(
+			     property,
+			     &string,
+			     &string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string value.",
+				 function );
+
+				goto on_error;
+			}
+			type_string = "string: ";
+			print_count = 8;
+
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_BOOLEAN:
+			type_string = "boolean";
+			print_count = 7;
+
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_DATE:
+			type_string = "date";
+			print_count = 4;
+
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_DICTIONARY:
+			type_string = "dictionary";
+			print_count = 10;
+
+			break;
+
+		case LIBFPLIST_VALUE_TYPE_FLOATING_POINT:
+			type_string = "floating point";
+			print_count = 14;
+
+			break;
+
+		default:
+			type_string = "unknown";
+			print_count = 7;
+
+			break;
+	}
+	if( ( print_count < 0 )
+	 || ( print_count >= 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value string.",
+		 function );
+
+		goto on_error;
+	}
+	if( type_string == NULL )
+	{
+		type_string = value_string;
+	}
+	if( plistinfo_queue_task_append_string(
+	     task,
+	     type_string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value type.",
+		 function );
+
+		goto on_error;
+	}
+	if( string != NULL )
+	{
+		/* The string size includes the end-of-string character
+		 */
+		if( ( string_size > 1 )
+		 && ( plistinfo_queue_task_append_string(
+		       task,
+		       (char *) string,
+		       string_size - 1,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string value.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 string );
+	}
+	return( 1 );
+
+on_error:
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	return( -1 );
+}
+
+/* Retrieves the property of a key path
+ * The components of the key path are separated by '/', a component that
+ * consists of digits is used as the index of an array entry. Only the properties
+ * on the key path are materialized
+ * The property is the root property if the key path has no components
+ * Returns 1 if successful, 0 if no such property or -1 on error
+ */
+int plistinfo_queue_task_get_property_by_key_path(
+     plistinfo_queue_task_t *task,
+     libfplist_property_t *root_property,
+     const uint8_t *key_path,
+     libfplist_property_t **property,
+     libcerror_error_t **error )
+{
+	libfplist_property_t *current_property = NULL;
+	libfplist_property_t *sub_property     = NULL;
+	const uint8_t *component               = NULL;
+	static char *function                  = "plistinfo_queue_task_get_property_by_key_path";
+	size_t component_index                 = 0;
+	size_t component_length                = 0;
+	int entry_index                        = 0;
+	int is_index                           = 0;
+	int number_of_entries                  = 0;
+	int result                             = 1;
+	int value_type                         = 0;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root property.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	current_property = root_property;
+	component        = key_path;
+
+	while( *component != 0 )
+	{
+		if( *component == (uint8_t) PLISTINFO_QUEUE_KEY_PATH_SEPARATOR )
+		{
+			component++;
+
+			continue;
+		}
+		is_index    = 1;
+		entry_index = 0;
+
+		for( component_length = 0;
+		     component[ component_length ] != 0;
+		     component_length++ )
+		{
+			if( component[ component_length ] == (uint8_t) PLISTINFO_QUEUE_KEY_PATH_SEPARATOR )
+			{
+				break;
+			}
+		}
+		for( component_index = 0;
+		     component_index < component_length;
+		     component_index++ )
+		{
+			if( ( component[ component_index ] < (uint8_t) '0' )
+			 || ( component[ component_index ] > (uint8_t) '9' )
+			 || ( entry_index > ( ( INT_MAX - 9 ) / 10 ) ) )
+			{
+				is_index = 0;
+
+				break;
+			}
+			entry_index *= 10;
+			entry_index += (int) ( component[ component_index ] - (uint8_t) '0' );
+		}
+		if( libfplist_property_get_value_type(
+		     current_property,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( value_type == LIBFPLIST_VALUE_TYPE_ARRAY )
+		 && ( is_index != 0 ) )
+		{
+			if( libfplist_property_get_array_number_of_entries(
+			     current_property,
+			     &number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of array entries.",
+				 function );
+
+				goto on_error;
+			}
+			if( entry_index >= number_of_entries )
+			{
+				result = 0;
+			}
+			else if( libfplist_property_get_array_entry_by_index(
+			          current_property,
+			          entry_index,
+			          &sub_property,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve array entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		else if( value_type == LIBFPLIST_VALUE_TYPE_DICTIONARY )
+		{
+			result = libfplist_property_get_sub_property_by_utf8_name(
+			          current_property,
+			          component,
+			          component_length,
+			          &sub_property,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub property.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			result = 0;
+		}
+		/* The intermediate properties are only needed to reach the next component
+		 */
+		if( current_property != root_property )
+		{
+			if( libfplist_property_free(
+			     &current_property,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free property.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+		current_property = sub_property;
+		sub_property     = NULL;
+
+		component += component_length;
+	}
+	*property = current_property;
+
+	return( 1 );
+
+on_error:
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( ( current_property != NULL )
+	 && ( current_property != root_property ) )
+	{
+		libfplist_property_free(
+		 &current_property,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the information about a property list to the output data of a task
+ * Only the root property and the properties of the key paths are retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_task_append_property_list(
+     plistinfo_queue_task_t *task,
+     libfplist_property_list_t *property_list,
+     libcerror_error_t **error )
+{
+	libfplist_property_t *property      = NULL;
+	libfplist_property_t *root_property = NULL;
+	static char *function               = "plistinfo_queue_task_append_property_list";
+	size_t key_path_length              = 0;
+	int key_path_index                  = 0;
+	int result                          = 0;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfplist_property_list_has_plist_root_element(
+	          property_list,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if property list has plist root element.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = plistinfo_queue_task_append_string(
+		          task,
+		          "\tPlist root element\t: yes\n",
+		          26,
+		          error );
+	}
+	else
+	{
+		result = plistinfo_queue_task_append_string(
+		          task,
+		          "\tPlist root element\t: no\n",
+		          25,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append plist root element.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_get_root_property(
+	     property_list,
+	     &root_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root property.",
+		 function );
+
+		goto on_error;
+	}
+	if( plistinfo_queue_task_append_string(
+	     task,
+	     "\tRoot property\t\t: ",
+	     18,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root property.",
+		 function );
+
+		goto on_error;
+	}
+	if( plistinfo_queue_task_append_property_value(
+	     task,
+	     root_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root property value.",
+		 function );
+
+		goto on_error;
+	}
+	if( plistinfo_queue_task_append_string(
+	     task,
+	     "\n",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of line.",
+		 function );
+
+		goto on_error;
+	}
+	for( key_path_index = 0;
+	     key_path_index < task->number_of_key_paths;
+	     key_path_index++ )
+	{
+		key_path_length = narrow_string_length(
+		                   (char *) task->key_paths[ key_path_index ] );
+
+		if( plistinfo_queue_task_append_string(
+		     task,
+		     "\t",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append indentation.",
+			 function );
+
+			goto on_error;
+		}
+		if( plistinfo_queue_task_append_string(
+		     task,
+		     (char *) task->key_paths[ key_path_index ],
+		     key_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append key path: %d.",
+			 function,
+			 key_path_index );
+
+			goto on_error;
+		}
+		if( plistinfo_queue_task_append_string(
+		     task,
+		     "\t: ",
+		     3,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append separator.",
+			 function );
+
+			goto on_error;
+		}
+		result = plistinfo_queue_task_get_property_by_key_path(
+		          task,
+		          root_property,
+		          task->key_paths[ key_path_index ],
+		          &property,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve property of key path: %d.",
+			 function,
+			 key_path_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			result = plistinfo_queue_task_append_string(
+			          task,
+			          "not found",
+			          9,
+			          error );
+		}
+		else
+		{
+			result = plistinfo_queue_task_append_property_value(
+			          task,
+			          property,
+			          error );
+
+			if( property != root_property )
+			{
+				if( libfplist_property_free(
+				     &property,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free property.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			property = NULL;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value of key path: %d.",
+			 function,
+			 key_path_index );
+
+			goto on_error;
+		}
+		if( plistinfo_queue_task_append_string(
+		     task,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of line.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfplist_property_free(
+	     &root_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root property.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the property list of a source and formats its information into the output data
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_task_process(
+     plistinfo_queue_task_t *task,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *source_file             = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	uint8_t *buffer                          = NULL;
+	static char *function                    = "plistinfo_queue_task_process";
+	size64_t source_size                     = 0;
+	ssize_t read_count                       = 0;
+	int result                               = 0;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( task->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid task - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	task->output_data_size = 0;
+
+	if( libcfile_file_initialize(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          task->filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          task->filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file.",
+		 function );
+
+		goto on_error;
+	}
+	source_size = task->size;
+
+	if( source_size == 0 )
+	{
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of source file.",
+			 function );
+
+			goto on_error;
+		}
+		if( source_size < (size64_t) task->offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid task offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		source_size -= (size64_t) task->offset;
+	}
+	if( ( source_size == 0 )
+	 || ( source_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * (size_t) source_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_seek_offset(
+	     source_file,
+	     task->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in source file.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              source_file,
+	              buffer,
+	              (size_t) source_size,
+	              error );
+
+	if( read_count != (ssize_t) source_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     source_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_initialize(
+	     &property_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_copy_from_byte_stream(
+	     property_list,
+	     buffer,
+	     (size_t) source_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy property list from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( plistinfo_queue_task_append_property_list(
+	     task,
+	     property_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append property list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_free(
+	     &property_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free property list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Processes a source from a thread pool
+ * The error is not available from the worker thread, the result is stored in the task
+ * Returns 1 on success or -1 on error
+ */
+int plistinfo_queue_task_process_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	plistinfo_queue_task_t *task = NULL;
+
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	task = (plistinfo_queue_task_t *) value;
+
+	task->result = plistinfo_queue_task_process(
+	                task,
+	                NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Creates a queue
+ * Make sure the value queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_initialize(
+     plistinfo_queue_t **queue,
+     int number_of_threads,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "plistinfo_queue_initialize";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output stream.",
+		 function );
+
+		return( -1 );
+	}
+	*queue = memory_allocate_structure(
+	          plistinfo_queue_t );
+
+	if( *queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *queue,
+	     0,
+	     sizeof( plistinfo_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queue.",
+		 function );
+
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+
+		return( -1 );
+	}
+	( *queue )->number_of_threads = number_of_threads;
+	( *queue )->output_stream     = output_stream;
+
+	return( 1 );
+
+on_error:
+	if( *queue != NULL )
+	{
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a queue
+ * Sources that were not flushed are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_free(
+     plistinfo_queue_t **queue,
+     libcerror_error_t **error )
+{
+	static char *function = "plistinfo_queue_free";
+	size_t task_index     = 0;
+	int key_path_index    = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		for( task_index = 0;
+		     task_index < PLISTINFO_QUEUE_BATCH_SIZE;
+		     task_index++ )
+		{
+			if( ( *queue )->tasks[ task_index ].filename != NULL )
+			{
+				memory_free(
+				 ( *queue )->tasks[ task_index ].filename );
+			}
+			if( ( *queue )->tasks[ task_index ].output_data != NULL )
+			{
+				memory_free(
+				 ( *queue )->tasks[ task_index ].output_data );
+			}
+		}
+		for( key_path_index = 0;
+		     key_path_index < ( *queue )->number_of_key_paths;
+		     key_path_index++ )
+		{
+			memory_free(
+			 ( *queue )->key_paths[ key_path_index ] );
+		}
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the recursive value
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_set_recursive(
+     plistinfo_queue_t *queue,
+     uint8_t recursive,
+     libcerror_error_t **error )
+{
+	static char *function = "plistinfo_queue_set_recursive";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	queue->recursive = recursive;
+
+	return( 1 );
+}
+
+/* Sets the range of the property list data in the sources
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_set_data_range(
+     plistinfo_queue_t *queue,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "plistinfo_queue_set_data_range";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	queue->offset = offset;
+	queue->size   = size;
+
+	return( 1 );
+}
+
+/* Appends a key path, which is stored as an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_append_key_path(
+     plistinfo_queue_t *queue,
+     const system_character_t *key_path,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_key_path    = NULL;
+	static char *function     = "plistinfo_queue_append_key_path";
+	size_t key_path_length    = 0;
+	size_t utf8_key_path_size = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                = 0;
+#endif
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue->number_of_key_paths >= PLISTINFO_QUEUE_MAXIMUM_NUMBER_OF_KEY_PATHS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of key paths value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	key_path_length = system_string_length(
+	                   key_path );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_size_from_utf32(
+	          (libuna_utf32_character_t *) key_path,
+	          key_path_length + 1,
+	          &utf8_key_path_size,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_size_from_utf16(
+	          (libuna_utf16_character_t *) key_path,
+	          key_path_length + 1,
+	          &utf8_key_path_size,
+	          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 key path.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	utf8_key_path_size = key_path_length + 1;
+#endif
+	utf8_key_path = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * utf8_key_path_size );
+
+	if( utf8_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 key path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_copy_from_utf32(
+	          utf8_key_path,
+	          utf8_key_path_size,
+	          (libuna_utf32_character_t *) key_path,
+	          key_path_length + 1,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_copy_from_utf16(
+	          utf8_key_path,
+	          utf8_key_path_size,
+	          (libuna_utf16_character_t *) key_path,
+	          key_path_length + 1,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 key path.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( memory_copy(
+	     utf8_key_path,
+	     key_path,
+	     utf8_key_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 key path.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	queue->key_paths[ queue->number_of_key_paths ] = utf8_key_path;
+
+	queue->number_of_key_paths += 1;
+
+	return( 1 );
+
+on_error:
+	if( utf8_key_path != NULL )
+	{
+		memory_free(
+		 utf8_key_path );
+	}
+	return( -1 );
+}
+
+#if defined( PLISTINFO_QUEUE_HAVE_DIRECTORY_WALK )
+
+/* Compares two directory entry names
+ * Returns a value less than, equal to or greater than 0
+ */
+int plistinfo_queue_compare_entry_names(
+     const void *first_entry_name,
+     const void *second_entry_name )
+{
+	const system_character_t *first_name  = *( (const system_character_t **) first_entry_name );
+	const system_character_t *second_name = *( (const system_character_t **) second_entry_name );
+	size_t first_name_length              = system_string_length( first_name );
+	size_t second_name_length             = system_string_length( second_name );
+
+	/* Include the end-of-string character of the shortest name in the comparison
+	 */
+	if( first_name_length > second_name_length )
+	{
+		first_name_length = second_name_length;
+	}
+	return( system_string_compare(
+	         first_name,
+	         second_name,
+	         first_name_length + 1 ) );
+}
+
+/* Appends a directory entry name to an array of names
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_append_entry_name(
+     system_character_t ***entry_names,
+     size_t *number_of_entry_names,
+     size_t *number_of_allocated_entry_names,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+	system_character_t **reallocated_entry_names = NULL;
+	static char *function                        = "plistinfo_queue_append_entry_name";
+	size_t name_size                             = 0;
+
+	if( *number_of_entry_names >= *number_of_allocated_entry_names )
+	{
+		if( *number_of_allocated_entry_names == 0 )
+		{
+			*number_of_allocated_entry_names = 64;
+		}
+		else
+		{
+			*number_of_allocated_entry_names *= 2;
+		}
+		reallocated_entry_names = (system_character_t **) memory_reallocate(
+		                                                   *entry_names,
+		                                                   sizeof( system_character_t * ) * *number_of_allocated_entry_names );
+
+		if( reallocated_entry_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entry names.",
+			 function );
+
+			return( -1 );
+		}
+		*entry_names = reallocated_entry_names;
+	}
+	name_size = system_string_length(
+	             name ) + 1;
+
+	( *entry_names )[ *number_of_entry_names ] = system_string_allocate(
+	                                              name_size );
+
+	if( ( *entry_names )[ *number_of_entry_names ] == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     ( *entry_names )[ *number_of_entry_names ],
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		memory_free(
+		 ( *entry_names )[ *number_of_entry_names ] );
+
+		return( -1 );
+	}
+	*number_of_entry_names += 1;
+
+	return( 1 );
+}
+
+/* Appends the files in a directory and its sub directories to the queue
+ * The entries of a directory are appended sorted by name, symbolic links
+ * to directories in the directory are not followed
+ * Returns 1 if successful, 0 if the path is not a directory or -1 on error
+ */
+int plistinfo_queue_append_directory(
+     plistinfo_queue_t *queue,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	system_character_t **entry_names       = NULL;
+	system_character_t *entry_path         = NULL;
+	static char *function                  = "plistinfo_queue_append_directory";
+	size_t entry_name_index                = 0;
+	size_t entry_name_length               = 0;
+	size_t entry_path_length               = 0;
+	size_t number_of_allocated_entry_names = 0;
+	size_t number_of_entry_names           = 0;
+	int result                             = 0;
+
+#if defined( WINAPI )
+	system_character_t *find_path          = NULL;
+	HANDLE find_handle                     = INVALID_HANDLE_VALUE;
+	DWORD file_attributes                  = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+#else
+	struct dirent *directory_entry         = NULL;
+	DIR *directory                         = NULL;
+	struct stat file_statistics;
+#endif
+
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_attributes = GetFileAttributesW(
+	                   path );
+#else
+	file_attributes = GetFileAttributesA(
+	                   path );
+#endif
+	if( ( file_attributes == INVALID_FILE_ATTRIBUTES )
+	 || ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+	 || ( ( file_attributes & FILE_ATTRIBUTE_REPARSE_POINT ) != 0 ) )
+	{
+		return( 0 );
+	}
+	find_path = system_string_allocate(
+	             path_length + 3 );
+
+	if( find_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create find path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     find_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy find path.",
+		 function );
+
+		goto on_error;
+	}
+	find_path[ path_length ]     = (system_character_t) PLISTINFO_QUEUE_PATH_SEPARATOR;
+	find_path[ path_length + 1 ] = (system_character_t) '*';
+	find_path[ path_length + 2 ] = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               find_path,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               find_path,
+	               &find_data );
+#endif
+	memory_free(
+	 find_path );
+
+	find_path = NULL;
+
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	do
+	{
+		if( ( find_data.cFileName[ 0 ] == (system_character_t) '.' )
+		 && ( ( find_data.cFileName[ 1 ] == 0 )
+		  || ( ( find_data.cFileName[ 1 ] == (system_character_t) '.' )
+		   && ( find_data.cFileName[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+		 && ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT ) != 0 ) )
+		{
+			continue;
+		}
+		if( plistinfo_queue_append_entry_name(
+		     &entry_names,
+		     &number_of_entry_names,
+		     &number_of_allocated_entry_names,
+		     find_data.cFileName,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( FindNextFileW(
+	        find_handle,
+	        &find_data ) != 0 );
+#else
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+#endif
+
+	FindClose(
+	 find_handle );
+
+	find_handle = INVALID_HANDLE_VALUE;
+#else
+	if( stat(
+	     path,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( !S_ISDIR( file_statistics.st_mode ) )
+	{
+		return( 0 );
+	}
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	for( directory_entry = readdir( directory );
+	     directory_entry != NULL;
+	     directory_entry = readdir( directory ) )
+	{
+		if( ( directory_entry->d_name[ 0 ] == '.' )
+		 && ( ( directory_entry->d_name[ 1 ] == 0 )
+		  || ( ( directory_entry->d_name[ 1 ] == '.' )
+		   && ( directory_entry->d_name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( plistinfo_queue_append_entry_name(
+		     &entry_names,
+		     &number_of_entry_names,
+		     &number_of_allocated_entry_names,
+		     directory_entry->d_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	closedir(
+	 directory );
+
+	directory = NULL;
+#endif /* defined( WINAPI ) */
+
+	/* Sort the entries so the output does not depend on the order
+	 * in which the file system returns them
+	 */
+	if( number_of_entry_names > 1 )
+	{
+		qsort(
+		 entry_names,
+		 number_of_entry_names,
+		 sizeof( system_character_t * ),
+		 &plistinfo_queue_compare_entry_names );
+	}
+	if( ( path_length > 0 )
+	 && ( path[ path_length - 1 ] == (system_character_t) PLISTINFO_QUEUE_PATH_SEPARATOR ) )
+	{
+		path_length--;
+	}
+	for( entry_name_index = 0;
+	     entry_name_index < number_of_entry_names;
+	     entry_name_index++ )
+	{
+		entry_name_length = system_string_length(
+		                     entry_names[ entry_name_index ] );
+
+		entry_path_length = path_length + 1 + entry_name_length;
+
+		entry_path = system_string_allocate(
+		              entry_path_length + 1 );
+
+		if( entry_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     entry_path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path to entry path.",
+			 function );
+
+			goto on_error;
+		}
+		entry_path[ path_length ] = (system_character_t) PLISTINFO_QUEUE_PATH_SEPARATOR;
+
+		if( system_string_copy(
+		     &( entry_path[ path_length + 1 ] ),
+		     entry_names[ entry_name_index ],
+		     entry_name_length + 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name to entry path.",
+			 function );
+
+			goto on_error;
+		}
+#if !defined( WINAPI )
+		if( ( lstat(
+		       entry_path,
+		       &file_statistics ) == 0 )
+		 && S_ISLNK( file_statistics.st_mode )
+		 && ( stat(
+		       entry_path,
+		       &file_statistics ) == 0 )
+		 && S_ISDIR( file_statistics.st_mode ) )
+		{
+			result = 1;
+		}
+		else
+#endif
+		{
+			result = plistinfo_queue_append_source(
+			          queue,
+			          entry_path,
+			          entry_path_length,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source: %" PRIs_SYSTEM ".",
+			 function,
+			 entry_path );
+
+			goto on_error;
+		}
+		memory_free(
+		 entry_path );
+
+		entry_path = NULL;
+
+		memory_free(
+		 entry_names[ entry_name_index ] );
+
+		entry_names[ entry_name_index ] = NULL;
+	}
+	if( entry_names != NULL )
+	{
+		memory_free(
+		 entry_names );
+	}
+	return( 1 );
+
+on_error:
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+#if defined( WINAPI )
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+	if( find_path != NULL )
+	{
+		memory_free(
+		 find_path );
+	}
+#else
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+#endif
+	if( entry_names != NULL )
+	{
+		for( entry_name_index = 0;
+		     entry_name_index < number_of_entry_names;
+		     entry_name_index++ )
+		{
+			if( entry_names[ entry_name_index ] != NULL )
+			{
+				memory_free(
+				 entry_names[ entry_name_index ] );
+			}
+		}
+		memory_free(
+		 entry_names );
+	}
+	return( -1 );
+}
+
+#endif /* defined( PLISTINFO_QUEUE_HAVE_DIRECTORY_WALK ) */
+
+/* Appends a source to the queue
+ * If the queue is recursive and the source is a directory the files in the directory
+ * are appended instead. The current batch is flushed when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_append_source(
+     plistinfo_queue_t *queue,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	plistinfo_queue_task_t *task      = NULL;
+	system_character_t *safe_filename = NULL;
+	static char *function             = "plistinfo_queue_append_source";
+
+#if defined( PLISTINFO_QUEUE_HAVE_DIRECTORY_WALK )
+	int result                        = 0;
+#endif
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( PLISTINFO_QUEUE_HAVE_DIRECTORY_WALK )
+	if( queue->recursive != 0 )
+	{
+		result = plistinfo_queue_append_directory(
+		          queue,
+		          filename,
+		          filename_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			return( 1 );
+		}
+	}
+#endif
+	safe_filename = system_string_allocate(
+	                 filename_length + 1 );
+
+	if( safe_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     safe_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		memory_free(
+		 safe_filename );
+
+		return( -1 );
+	}
+	safe_filename[ filename_length ] = 0;
+
+	/* The output data of the task is retained from the previous batch
+	 */
+	task = &( queue->tasks[ queue->number_of_tasks ] );
+
+	task->filename            = safe_filename;
+	task->offset              = queue->offset;
+	task->size                = queue->size;
+	task->key_paths           = queue->key_paths;
+	task->number_of_key_paths = queue->number_of_key_paths;
+	task->output_data_size    = 0;
+	task->result              = 0;
+
+	queue->number_of_tasks += 1;
+
+	if( queue->number_of_tasks >= PLISTINFO_QUEUE_BATCH_SIZE )
+	{
+		if( plistinfo_queue_flush(
+		     queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the sources in a file list to the queue
+ * The file list contains a source per line, empty lines are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_append_sources_from_file_list(
+     plistinfo_queue_t *queue,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *line = NULL;
+	FILE *file_list_stream   = NULL;
+	static char *function    = "plistinfo_queue_append_sources_from_file_list";
+	size_t line_length       = 0;
+	size_t line_number       = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	line = system_string_allocate(
+	        PLISTINFO_QUEUE_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_list_stream = file_stream_open_wide(
+	                    filename,
+	                    _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	file_list_stream = file_stream_open(
+	                    filename,
+	                    FILE_STREAM_OPEN_READ );
+#endif
+	if( file_list_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file list: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        file_list_stream,
+	        line,
+	        PLISTINFO_QUEUE_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        file_list_stream,
+	        line,
+	        PLISTINFO_QUEUE_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( PLISTINFO_QUEUE_MAXIMUM_LINE_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %" PRIzd " value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length--;
+		}
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		line[ line_length ] = 0;
+
+		if( plistinfo_queue_append_source(
+		     queue,
+		     line,
+		     line_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source of line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_list_stream ) != 0 )
+	{
+		file_list_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file list.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( file_list_stream != NULL )
+	{
+		file_stream_close(
+		 file_list_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+
+/* Processes the sources of the current batch and prints their information in input order
+ * A source that cannot be processed is reported on stderr and counted as failed
+ * Returns 1 if successful or -1 on error
+ */
+int plistinfo_queue_flush(
+     plistinfo_queue_t *queue,
+     libcerror_error_t **error )
+{
+	plistinfo_queue_task_t *task           = NULL;
+	static char *function                  = "plistinfo_queue_flush";
+	size_t task_index                      = 0;
+	size_t write_count                     = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue->number_of_tasks == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( queue->number_of_threads > 1 )
+	 && ( queue->number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = queue->number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( (size_t) maximum_number_of_values > queue->number_of_tasks )
+		{
+			maximum_number_of_values = (int) queue->number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     queue->number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &plistinfo_queue_task_process_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < queue->number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( queue->tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %" PRIzd " onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( task_index = 0;
+	     task_index < queue->number_of_tasks;
+	     task_index++ )
+	{
+		task = &( queue->tasks[ task_index ] );
+
+		/* Without a thread pool the task is processed here
+		 */
+		if( task->result == 0 )
+		{
+			task->result = plistinfo_queue_task_process(
+			                task,
+			                NULL );
+		}
+		if( task->result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read property list: %" PRIs_SYSTEM "\n",
+			 task->filename );
+
+			queue->number_of_failed_sources += 1;
+		}
+		else
+		{
+			fprintf(
+			 queue->output_stream,
+			 "Property list: %" PRIs_SYSTEM "\n",
+			 task->filename );
+
+			if( task->output_data_size > 0 )
+			{
+				write_count = file_stream_write(
+				               queue->output_stream,
+				               task->output_data,
+				               task->output_data_size );
+
+				if( write_count != task->output_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write output of task: %" PRIzd ".",
+					 function,
+					 task_index );
+
+					goto on_error;
+				}
+			}
+			fprintf(
+			 queue->output_stream,
+			 "\n" );
+		}
+		memory_free(
+		 task->filename );
+
+		task->filename         = NULL;
+		task->output_data_size = 0;
+		task->result           = 0;
+	}
+	queue->number_of_tasks = 0;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,250 @@
+/*
+ * Plistinfo work queue
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PLISTINFO_QUEUE_H )
+#define _PLISTINFO_QUEUE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libfplist.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Directories can be walked on Windows and on POSIX systems with dirent
+ * that use narrow system strings
+ */
+#if defined( WINAPI )
+#define PLISTINFO_QUEUE_HAVE_DIRECTORY_WALK	1
+#define PLISTINFO_QUEUE_PATH_SEPARATOR		'\\'
+
+#elif defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define PLISTINFO_QUEUE_HAVE_DIRECTORY_WALK	1
+#define PLISTINFO_QUEUE_PATH_SEPARATOR		'/'
+
+#endif
+
+/* The number of sources that are processed in a single batch
+ * the output of a batch is printed in input order before the next batch is started
+ */
+#define PLISTINFO_QUEUE_BATCH_SIZE			1024
+
+/* The maximum number of key paths
+ */
+#define PLISTINFO_QUEUE_MAXIMUM_NUMBER_OF_KEY_PATHS	64
+
+/* The separator of the components of a key path
+ */
+#define PLISTINFO_QUEUE_KEY_PATH_SEPARATOR		'/'
+
+typedef struct plistinfo_queue_task plistinfo_queue_task_t;
+
+struct plistinfo_queue_task
+{
+	/* The source filename
+	 */
+	system_character_t *filename;
+
+	/* The offset of the property list data
+	 */
+	off64_t offset;
+
+	/* The size of the property list data, 0 represents the remainder of the source
+	 */
+	size64_t size;
+
+	/* The UTF-8 key paths, shared with the queue
+	 */
+	uint8_t **key_paths;
+
+	/* The number of key paths
+	 */
+	int number_of_key_paths;
+
+	/* The output data, which is retained between batches
+	 */
+	char *output_data;
+
+	/* The size of the output data
+	 */
+	size_t output_data_size;
+
+	/* The allocated size of the output data
+	 */
+	size_t allocated_output_data_size;
+
+	/* The result of the task, 0 if not processed
+	 */
+	int result;
+};
+
+typedef struct plistinfo_queue plistinfo_queue_t;
+
+struct plistinfo_queue
+{
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate directories should be walked recursively
+	 */
+	uint8_t recursive;
+
+	/* The offset of the property list data
+	 */
+	off64_t offset;
+
+	/* The size of the property list data, 0 represents the remainder of the source
+	 */
+	size64_t size;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* The UTF-8 key paths
+	 */
+	uint8_t *key_paths[ PLISTINFO_QUEUE_MAXIMUM_NUMBER_OF_KEY_PATHS ];
+
+	/* The number of key paths
+	 */
+	int number_of_key_paths;
+
+	/* The tasks of the current batch
+	 */
+	plistinfo_queue_task_t tasks[ PLISTINFO_QUEUE_BATCH_SIZE ];
+
+	/* The number of tasks in the current batch
+	 */
+	size_t number_of_tasks;
+
+	/* The number of sources that could not be processed
+	 */
+	size_t number_of_failed_sources;
+};
+
+int plistinfo_queue_task_append_string(
+     plistinfo_queue_task_t *task,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int plistinfo_queue_task_append_property_value(
+     plistinfo_queue_task_t *task,
+     libfplist_property_t *property,
+     libcerror_error_t **error );
+
+int plistinfo_queue_task_get_property_by_key_path(
+     plistinfo_queue_task_t *task,
+     libfplist_property_t *root_property,
+     const uint8_t *key_path,
+     libfplist_property_t **property,
+     libcerror_error_t **error );
+
+int plistinfo_queue_task_append_property_list(
+     plistinfo_queue_task_t *task,
+     libfplist_property_list_t *property_list,
+     libcerror_error_t **error );
+
+int plistinfo_queue_task_process(
+     plistinfo_queue_task_t *task,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int plistinfo_queue_task_process_callback(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int plistinfo_queue_initialize(
+     plistinfo_queue_t **queue,
+     int number_of_threads,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+int plistinfo_queue_free(
+     plistinfo_queue_t **queue,
+     libcerror_error_t **error );
+
+int plistinfo_queue_set_recursive(
+     plistinfo_queue_t *queue,
+     uint8_t recursive,
+     libcerror_error_t **error );
+
+int plistinfo_queue_set_data_range(
+     plistinfo_queue_t *queue,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int plistinfo_queue_append_key_path(
+     plistinfo_queue_t *queue,
+     const system_character_t *key_path,
+     libcerror_error_t **error );
+
+#if defined( PLISTINFO_QUEUE_HAVE_DIRECTORY_WALK )
+
+int plistinfo_queue_compare_entry_names(
+     const void *first_entry_name,
+     const void *second_entry_name );
+
+int plistinfo_queue_append_entry_name(
+     system_character_t ***entry_names,
+     size_t *number_of_entry_names,
+     size_t *number_of_allocated_entry_names,
+     const system_character_t *name,
+     libcerror_error_t **error );
+
+int plistinfo_queue_append_directory(
+     plistinfo_queue_t *queue,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+#endif /* defined( PLISTINFO_QUEUE_HAVE_DIRECTORY_WALK ) */
+
+int plistinfo_queue_append_source(
+     plistinfo_queue_t *queue,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int plistinfo_queue_append_sources_from_file_list(
+     plistinfo_queue_t *queue,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int plistinfo_queue_flush(
+     plistinfo_queue_t *queue,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PLISTINFO_QUEUE_H ) */
+
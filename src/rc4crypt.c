@@ -35,9 +35,52 @@
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_libfcrypto.h"
 #include "assorted_libuna.h"
 #include "assorted_output.h"
+#include "assorted_rc4.h"
+#include "assorted_system_string.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+#include "decryption_manifest.h"
+
+/* The size of the chunks the data is processed in
+ */
+#define RC4CRYPT_BUFFER_SIZE			( 1024 * 1024 )
+
+/* The number of manifest entries that are decrypted at a time
+ */
+#define RC4CRYPT_NUMBER_OF_TASKS		1024
+
+#define RC4CRYPT_MAXIMUM_NUMBER_OF_THREADS	64
+
+typedef struct rc4crypt_task rc4crypt_task_t;
+
+/* A task that decrypts the data of a manifest entry in place
+ */
+struct rc4crypt_task
+{
+	/* The key schedule, shared by all entries with the same key
+	 */
+	const assorted_rc4_key_schedule_t *key_schedule;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size, the data is reused by subsequent batches
+	 */
+	size_t allocated_data_size;
+
+	/* The result, 0 if not processed, 1 if successful or -1 on error
+	 */
+	int result;
+};
 
 /* Sets the keys
  * Returns 1 if successful or -1 on error
@@ -134,6 +177,703 @@ on_error:
 	return( -1 );
 }
 
+/* Decrypts the data of a task and sets its result
+ */
+void rc4crypt_task_run(
+      rc4crypt_task_t *task )
+{
+	if( task == NULL )
+	{
+		return;
+	}
+	task->result = assorted_rc4_crypt(
+	                task->key_schedule,
+	                task->data,
+	                task->data_size,
+	                task->data,
+	                task->data_size,
+	                NULL );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decrypts the data of a task from a thread pool
+ * Returns 1 on success or -1 on error
+ */
+int rc4crypt_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	rc4crypt_task_run(
+	 (rc4crypt_task_t *) value );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decrypts the data of tasks
+ * Returns 1 if successful or -1 on error
+ */
+int rc4crypt_crypt_tasks(
+     rc4crypt_task_t *tasks,
+     int number_of_tasks,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function                  = "rc4crypt_crypt_tasks";
+	int task_index                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+	if( tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tasks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &rc4crypt_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	ASSORTED_UNREFERENCED_PARAMETER( number_of_threads )
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the data is decrypted here
+	 */
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( tasks[ task_index ].result == 0 )
+		{
+			rc4crypt_task_run(
+			 &( tasks[ task_index ] ) );
+		}
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Decrypts the data of the entries listed in a manifest
+ * The source stays open for all entries and the key schedule of every distinct key
+ * is computed once. The entries are decrypted in batches, the entries of a batch
+ * in parallel, and written in the order of the manifest
+ * Returns 1 if successful or -1 on error
+ */
+int rc4crypt_crypt_manifest(
+     const system_character_t *source,
+     const system_character_t *manifest_filename,
+     const system_character_t *target_path,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	assorted_rc4_key_schedule_t *key_schedules = NULL;
+	decryption_manifest_entry_t *entry         = NULL;
+	decryption_manifest_key_t *key             = NULL;
+	decryption_manifest_t *manifest            = NULL;
+	libcfile_file_t *destination_file          = NULL;
+	libcfile_file_t *source_file               = NULL;
+	rc4crypt_task_t *tasks                     = NULL;
+	static char *function                      = "rc4crypt_crypt_manifest";
+	size64_t source_size                       = 0;
+	size64_t total_data_size                   = 0;
+	ssize_t read_count                         = 0;
+	ssize_t write_count                        = 0;
+	int entry_index                            = 0;
+	int key_index                              = 0;
+	int number_of_tasks                        = 0;
+	int result                                 = 0;
+	int task_index                             = 0;
+
+	if( decryption_manifest_initialize(
+	     &manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( decryption_manifest_read_file(
+	     manifest,
+	     manifest_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_get_size(
+	     source_file,
+	     &source_size,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of source file.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < manifest->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( manifest->entries[ entry_index ] );
+
+		if( ( (size64_t) entry->offset > source_size )
+		 || ( (size64_t) entry->data_size > ( source_size - (size64_t) entry->offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %d - range exceeds source size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( manifest->number_of_keys > 0 )
+	{
+		key_schedules = (assorted_rc4_key_schedule_t *) memory_allocate(
+		                                                 sizeof( assorted_rc4_key_schedule_t ) * manifest->number_of_keys );
+
+		if( key_schedules == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create key schedules.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( key_index = 0;
+	     key_index < manifest->number_of_keys;
+	     key_index++ )
+	{
+		key = &( manifest->keys[ key_index ] );
+
+		if( assorted_rc4_key_schedule_set_key(
+		     &( key_schedules[ key_index ] ),
+		     key->data,
+		     key->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key schedule: %d.",
+			 function,
+			 key_index );
+
+			goto on_error;
+		}
+	}
+	if( target_path != NULL )
+	{
+		if( libcfile_file_initialize(
+		     &destination_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination file.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          destination_file,
+		          target_path,
+		          LIBCFILE_OPEN_WRITE,
+		          error );
+#else
+		result = libcfile_file_open(
+		          destination_file,
+		          target_path,
+		          LIBCFILE_OPEN_WRITE,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open destination file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	tasks = (rc4crypt_task_t *) memory_allocate(
+	                             sizeof( rc4crypt_task_t ) * RC4CRYPT_NUMBER_OF_TASKS );
+
+	if( tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tasks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     tasks,
+	     0,
+	     sizeof( rc4crypt_task_t ) * RC4CRYPT_NUMBER_OF_TASKS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tasks.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < manifest->number_of_entries;
+	     entry_index += number_of_tasks )
+	{
+		number_of_tasks = manifest->number_of_entries - entry_index;
+
+		if( number_of_tasks > RC4CRYPT_NUMBER_OF_TASKS )
+		{
+			number_of_tasks = RC4CRYPT_NUMBER_OF_TASKS;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			entry = &( manifest->entries[ entry_index + task_index ] );
+
+			if( tasks[ task_index ].allocated_data_size < entry->data_size )
+			{
+				if( tasks[ task_index ].data != NULL )
+				{
+					memory_free(
+					 tasks[ task_index ].data );
+
+					tasks[ task_index ].allocated_data_size = 0;
+				}
+				tasks[ task_index ].data = (uint8_t *) memory_allocate(
+				                                        sizeof( uint8_t ) * entry->data_size );
+
+				if( tasks[ task_index ].data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create data of task: %d.",
+					 function,
+					 task_index );
+
+					goto on_error;
+				}
+				tasks[ task_index ].allocated_data_size = entry->data_size;
+			}
+			tasks[ task_index ].key_schedule = &( key_schedules[ entry->key_index ] );
+			tasks[ task_index ].data_size    = entry->data_size;
+			tasks[ task_index ].result       = 0;
+
+			if( libcfile_file_seek_offset(
+			     source_file,
+			     entry->offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek entry: %d in source file.",
+				 function,
+				 entry_index + task_index );
+
+				goto on_error;
+			}
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              tasks[ task_index ].data,
+			              entry->data_size,
+			              error );
+
+			if( read_count != (ssize_t) entry->data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read entry: %d from source file.",
+				 function,
+				 entry_index + task_index );
+
+				goto on_error;
+			}
+		}
+		if( rc4crypt_crypt_tasks(
+		     tasks,
+		     number_of_tasks,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decrypt entries.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to decrypt entry: %d.",
+				 function,
+				 entry_index + task_index );
+
+				goto on_error;
+			}
+			if( destination_file == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Decrypted data of entry: %d:\n",
+				 entry_index + task_index );
+
+				libcnotify_print_data(
+				 tasks[ task_index ].data,
+				 tasks[ task_index ].data_size,
+				 0 );
+			}
+			else
+			{
+				write_count = libcfile_file_write_buffer(
+				               destination_file,
+				               tasks[ task_index ].data,
+				               tasks[ task_index ].data_size,
+				               error );
+
+				if( write_count != (ssize_t) tasks[ task_index ].data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write entry: %d to destination file.",
+					 function,
+					 entry_index + task_index );
+
+					goto on_error;
+				}
+			}
+			total_data_size += tasks[ task_index ].data_size;
+		}
+	}
+	fprintf(
+	 stdout,
+	 "Decrypted %d entries with %d distinct keys into %" PRIu64 " bytes.\n",
+	 manifest->number_of_entries,
+	 manifest->number_of_keys,
+	 total_data_size );
+
+	for( task_index = 0;
+	     task_index < RC4CRYPT_NUMBER_OF_TASKS;
+	     task_index++ )
+	{
+		if( tasks[ task_index ].data != NULL )
+		{
+			memory_free(
+			 tasks[ task_index ].data );
+		}
+	}
+	memory_free(
+	 tasks );
+
+	tasks = NULL;
+
+	if( destination_file != NULL )
+	{
+		if( libcfile_file_close(
+		     destination_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close destination file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &destination_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free destination file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( key_schedules != NULL )
+	{
+		memory_set(
+		 key_schedules,
+		 0,
+		 sizeof( assorted_rc4_key_schedule_t ) * manifest->number_of_keys );
+
+		memory_free(
+		 key_schedules );
+
+		key_schedules = NULL;
+	}
+	if( libcfile_file_close(
+	     source_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( decryption_manifest_free(
+	     &manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free manifest.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( tasks != NULL )
+	{
+		for( task_index = 0;
+		     task_index < RC4CRYPT_NUMBER_OF_TASKS;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].data != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].data );
+			}
+		}
+		memory_free(
+		 tasks );
+	}
+	if( destination_file != NULL )
+	{
+		libcfile_file_free(
+		 &destination_file,
+		 NULL );
+	}
+	if( key_schedules != NULL )
+	{
+		memory_set(
+		 key_schedules,
+		 0,
+		 sizeof( assorted_rc4_key_schedule_t ) * manifest->number_of_keys );
+
+		memory_free(
+		 key_schedules );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( manifest != NULL )
+	{
+		decryption_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -145,14 +885,22 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use rc4crypt to de- or encrypt data using RC4.\n\n" );
 
-	fprintf( stream, "Usage: rc4crypt [ -k key ] [ -o offset ] [ -s size ]\n"
+	fprintf( stream, "Usage: rc4crypt [ -k key ] [ -m manifest ] [ -o offset ]\n"
+	                 "                [ -j number_of_threads ] [ -s size ]\n"
 	                 "                [ -t target ] [ -hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to decrypt the entries of\n"
+	                 "\t        a manifest (default is 1)\n" );
 	fprintf( stream, "\t-k:     the key formatted in base16\n" );
+	fprintf( stream, "\t-m:     the manifest, every line contains the offset, the size\n"
+	                 "\t        and the key formatted in base16 of encrypted data,\n"
+	                 "\t        separated by whitespace, the decrypted data is written\n"
+	                 "\t        in the order of the manifest\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     same as -j\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
 	                 "\t        by default the data will be written to stdout in\n"
@@ -175,20 +923,22 @@ int main( int argc, char * const argv[] )
 	libcfile_file_t *source_file           = NULL;
 	libfcrypto_rc4_context_t *context      = NULL;
 	system_character_t *option_keys        = NULL;
+	system_character_t *option_manifest    = NULL;
 	system_character_t *option_target_path = NULL;
 	system_character_t *source             = NULL;
 	uint8_t *buffer                        = NULL;
-	uint8_t *decrypted_data                = NULL;
 	uint8_t *key_data                      = NULL;
 	char *program                          = "rc4crypt";
 	system_integer_t option                = 0;
+	size64_t remaining_size                = 0;
 	size64_t source_size                   = 0;
 	size_t buffer_size                     = 0;
-	size_t decrypted_data_size             = 0;
 	size_t key_data_size                   = 0;
+	size_t read_size                       = 0;
 	ssize_t read_count                     = 0;
 	ssize_t write_count                    = 0;
 	off_t source_offset                    = 0;
+	int number_of_threads                  = 1;
 	int result                             = 0;
 	int verbose                            = 0;
 
@@ -205,7 +955,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hk:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "hj:k:m:o:p:s:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -232,6 +982,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'm':
+				option_manifest = optarg;
+
+				break;
+
 			case (system_integer_t) 'o':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_offset = _wtol( optarg );
@@ -240,6 +995,12 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case (system_integer_t) 'j':
+			case (system_integer_t) 'p':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
 			case (system_integer_t) 's':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_size = _wtol( optarg );
@@ -278,23 +1039,70 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
-	if( option_keys == NULL )
+	if( ( option_keys == NULL )
+	 && ( option_manifest == NULL ) )
 	{
 		fprintf(
 		 stderr,
-		 "Missing key.\n" );
+		 "Missing key or manifest.\n" );
 
 		usage_fprint(
 		 stdout );
 
 		return( EXIT_FAILURE );
 	}
+	if( ( option_keys != NULL )
+	 && ( option_manifest != NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Key and manifest cannot be combined.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > RC4CRYPT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( option_manifest != NULL )
+	{
+		fprintf(
+		 stdout,
+		 "Starting RC4 decrypting data of: %" PRIs_SYSTEM " using manifest: %" PRIs_SYSTEM ".\n",
+		 source,
+		 option_manifest );
+
+		if( rc4crypt_crypt_manifest(
+		     source,
+		     option_manifest,
+		     option_target_path,
+		     number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decrypt data using manifest.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "RC4 decryption:\tSUCCESS\n" );
+
+		return( EXIT_SUCCESS );
+	}
+
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
@@ -350,18 +1158,15 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	if( source_size > (size_t) SSIZE_MAX )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		return( EXIT_FAILURE );
-	}
-	/* Create the input buffer
+	/* The data is processed in chunks so that the memory usage does not
+	 * depend on the size of the source
 	 */
-	buffer_size = source_size;
+	buffer_size = RC4CRYPT_BUFFER_SIZE;
 
+	if( source_size < (size64_t) buffer_size )
+	{
+		buffer_size = (size_t) source_size;
+	}
 	buffer = (uint8_t *) memory_allocate(
 	                      sizeof( uint8_t ) * buffer_size );
 
@@ -371,19 +1176,6 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Unable to create buffer.\n" );
 
-		return( EXIT_FAILURE );
-	}
-	decrypted_data_size = source_size;
-
-	decrypted_data = (uint8_t *) memory_allocate(
-	                              sizeof( uint8_t ) * decrypted_data_size );
-
-	if( decrypted_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create decrypted data buffer.\n" );
-
 		goto on_error;
 	}
 	/* Position the source file at the right offset
@@ -417,22 +1209,6 @@ int main( int argc, char * const argv[] )
 	 source_offset,
 	 source_offset );
 
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
-
-		goto on_error;
-	}
-	/* Decrypts the data
-	 */
 	if( rc4crypt_set_keys(
 	     option_keys,
 	     &key_data,
@@ -473,43 +1249,7 @@ int main( int argc, char * const argv[] )
 
 	key_data = NULL;
 
-	if( option_target_path == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Encrypted data:\n" );
-
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
-	if( libfcrypto_rc4_crypt(
-	     context,
-	     buffer,
-	     source_size,
-	     decrypted_data,
-	     decrypted_data_size,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to decode data.\n" );
-
-		goto on_error;
-	}
-	if( option_target_path == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Decrypted data:\n" );
-
-		libcnotify_print_data(
-		 decrypted_data,
-		 decrypted_data_size,
-		 0 );
-	}
-	else
+	if( option_target_path != NULL )
 	{
 		if( libcfile_file_initialize(
 		     &destination_file,
@@ -542,20 +1282,91 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		write_count = libcfile_file_write_buffer(
-			       destination_file,
-			       decrypted_data,
-			       decrypted_data_size,
-			       &error );
+	}
+	/* Decrypts the data in place,
+	 * the RC4 context maintains the key stream state across the chunks
+	 */
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = buffer_size;
+
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      buffer,
+			      read_size,
+			      &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( option_target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Encrypted data:\n" );
 
-		if( write_count != (ssize_t) decrypted_data_size )
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 0 );
+		}
+		if( libfcrypto_rc4_crypt(
+		     context,
+		     buffer,
+		     read_size,
+		     buffer,
+		     read_size,
+		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to write to destination file.\n" );
+			 "Unable to decode data.\n" );
 
 			goto on_error;
 		}
+		if( option_target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Decrypted data:\n" );
+
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 0 );
+		}
+		else
+		{
+			write_count = libcfile_file_write_buffer(
+				       destination_file,
+				       buffer,
+				       read_size,
+				       &error );
+
+			if( write_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write to destination file.\n" );
+
+				goto on_error;
+			}
+		}
+		remaining_size -= read_size;
+	}
+	if( destination_file != NULL )
+	{
 		if( libcfile_file_close(
 		     destination_file,
 		     &error ) != 0 )
@@ -609,11 +1420,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( decrypted_data != NULL )
-	{
-		memory_free(
-		 decrypted_data );
-	}
 	if( buffer != NULL )
 	{
 		memory_free(
@@ -639,11 +1445,6 @@ on_error:
 		 &destination_file,
 		 NULL );
 	}
-	if( decrypted_data != NULL )
-	{
-		memory_free(
-		 decrypted_data );
-	}
 	if( key_data != NULL )
 	{
 		memory_set(
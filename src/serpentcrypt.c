@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -35,9 +36,95 @@
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_libfcrypto.h"
 #include "assorted_libuna.h"
 #include "assorted_output.h"
+#include "assorted_serpent.h"
+#include "assorted_system_string.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+
+#define SERPENTCRYPT_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The size of the chunks the data is processed in per thread, which is a multiple of the block size
+ */
+#define SERPENTCRYPT_BUFFER_SIZE		( 1024 * 1024 )
+
+/* The size of the scratch buffer of a task, which is a multiple of the block size
+ */
+#define SERPENTCRYPT_SCRATCH_SIZE		( 64 * 1024 )
+
+#define SERPENTCRYPT_BLOCK_SIZE			16
+
+enum SERPENTCRYPT_MODES
+{
+	SERPENTCRYPT_MODE_CBC			= 1,
+	SERPENTCRYPT_MODE_CTR			= 2,
+	SERPENTCRYPT_MODE_ECB			= 3,
+	SERPENTCRYPT_MODE_XTS			= 4
+};
+
+typedef struct serpentcrypt_task serpentcrypt_task_t;
+
+/* A task that de- or encrypts a block aligned part of a chunk
+ */
+struct serpentcrypt_task
+{
+	/* The context of the data key
+	 */
+	assorted_serpent_context_t *context;
+
+	/* The context of the tweak key, used by XTS
+	 */
+	assorted_serpent_context_t *tweak_context;
+
+	/* The reference context of the data key, used instead of the context when set
+	 */
+	libfcrypto_serpent_context_t *reference_context;
+
+	/* The reference context of the tweak key, used instead of the tweak context when set
+	 */
+	libfcrypto_serpent_context_t *reference_tweak_context;
+
+	/* The mode
+	 */
+	int mode;
+
+	/* The crypt mode
+	 */
+	int crypt_mode;
+
+	/* The data, that is de- or encrypted in place
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The initialization vector, for CBC this is the ciphertext block that precedes
+	 * the data and for CTR the counter block of the first block of the data
+	 */
+	uint8_t initialization_vector[ SERPENTCRYPT_BLOCK_SIZE ];
+
+	/* The data unit number of the first data unit of the data, used by XTS
+	 */
+	uint64_t data_unit_number;
+
+	/* The data unit size, used by XTS
+	 */
+	size_t data_unit_size;
+
+	/* The scratch buffer
+	 */
+	uint8_t scratch[ SERPENTCRYPT_SCRATCH_SIZE ];
+
+	/* The result, 0 if not processed, 1 if successful or -1 on error
+	 */
+	int result;
+};
+
 
 /* Sets the keys
  * Returns 1 if successful or -1 on error
@@ -134,6 +221,934 @@ on_error:
 	return( -1 );
 }
 
+/* Determines the mode from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int serpentcrypt_mode_from_string(
+     const system_character_t *string,
+     int *mode,
+     libcerror_error_t **error )
+{
+	static char *function = "serpentcrypt_mode_from_string";
+	size_t string_length  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( mode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mode.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length != 3 )
+	{
+		return( 0 );
+	}
+	if( system_string_compare(
+	     string,
+	     _SYSTEM_STRING( "cbc" ),
+	     3 ) == 0 )
+	{
+		*mode = SERPENTCRYPT_MODE_CBC;
+	}
+	else if( system_string_compare(
+	          string,
+	          _SYSTEM_STRING( "ctr" ),
+	          3 ) == 0 )
+	{
+		*mode = SERPENTCRYPT_MODE_CTR;
+	}
+	else if( system_string_compare(
+	          string,
+	          _SYSTEM_STRING( "ecb" ),
+	          3 ) == 0 )
+	{
+		*mode = SERPENTCRYPT_MODE_ECB;
+	}
+	else if( system_string_compare(
+	          string,
+	          _SYSTEM_STRING( "xts" ),
+	          3 ) == 0 )
+	{
+		*mode = SERPENTCRYPT_MODE_XTS;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Adds a value to a 128-bit big-endian counter block
+ */
+void serpentcrypt_counter_add(
+      uint8_t *counter,
+      uint64_t value )
+{
+	int byte_index = SERPENTCRYPT_BLOCK_SIZE - 1;
+
+	while( ( value != 0 )
+	    && ( byte_index >= 0 ) )
+	{
+		value += counter[ byte_index ];
+
+		counter[ byte_index ] = (uint8_t) ( value & 0xff );
+
+		value >>= 8;
+
+		byte_index--;
+	}
+}
+
+/* Multiplies a 128-bit little-endian XTS tweak by the primitive element of GF(2^128)
+ */
+void serpentcrypt_xts_multiply_tweak(
+      uint8_t *tweak )
+{
+	uint8_t carry      = 0;
+	uint8_t next_carry = 0;
+	int byte_index     = 0;
+
+	for( byte_index = 0;
+	     byte_index < SERPENTCRYPT_BLOCK_SIZE;
+	     byte_index++ )
+	{
+		next_carry = tweak[ byte_index ] >> 7;
+
+		tweak[ byte_index ] = (uint8_t) ( ( tweak[ byte_index ] << 1 ) | carry );
+
+		carry = next_carry;
+	}
+	if( carry != 0 )
+	{
+		tweak[ 0 ] ^= 0x87;
+	}
+}
+
+/* XORs data with other data
+ */
+void serpentcrypt_xor_data(
+      uint8_t *data,
+      const uint8_t *xor_data,
+      size_t size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset++ )
+	{
+		data[ data_offset ] ^= xor_data[ data_offset ];
+	}
+}
+
+/* De- or encrypts blocks of data with the data or tweak key of a task
+ * Returns 1 if successful or -1 on error
+ */
+int serpentcrypt_crypt_ecb(
+     serpentcrypt_task_t *task,
+     uint8_t use_tweak_key,
+     int crypt_mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	assorted_serpent_context_t *context             = NULL;
+	libfcrypto_serpent_context_t *reference_context = NULL;
+	static char *function                           = "serpentcrypt_crypt_ecb";
+	int serpent_crypt_mode                          = ASSORTED_SERPENT_CRYPT_MODE_DECRYPT;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( use_tweak_key != 0 )
+	{
+		context           = task->tweak_context;
+		reference_context = task->reference_tweak_context;
+	}
+	else
+	{
+		context           = task->context;
+		reference_context = task->reference_context;
+	}
+	if( reference_context != NULL )
+	{
+		if( libfcrypto_serpent_crypt_ecb(
+		     reference_context,
+		     crypt_mode,
+		     input_data,
+		     input_data_size,
+		     output_data,
+		     output_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to de- or encrypt data with reference context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( crypt_mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	{
+		serpent_crypt_mode = ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT;
+	}
+	if( assorted_serpent_crypt_ecb(
+	     context,
+	     serpent_crypt_mode,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to de- or encrypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts the data of a task in place
+ * Returns 1 if successful or -1 on error
+ */
+int serpentcrypt_task_crypt(
+     serpentcrypt_task_t *task,
+     libcerror_error_t **error )
+{
+	uint8_t tweak[ SERPENTCRYPT_BLOCK_SIZE ];
+
+	static char *function   = "serpentcrypt_task_crypt";
+	size_t block_offset     = 0;
+	size_t data_offset      = 0;
+	size_t data_unit_offset = 0;
+	size_t data_unit_size   = 0;
+	size_t keystream_size   = 0;
+	size_t segment_size     = 0;
+	int result              = 1;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	switch( task->mode )
+	{
+		case SERPENTCRYPT_MODE_CBC:
+			if( task->crypt_mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+			{
+				/* Every block depends on the previous ciphertext block
+				 */
+				for( data_offset = 0;
+				     data_offset < task->data_size;
+				     data_offset += SERPENTCRYPT_BLOCK_SIZE )
+				{
+					serpentcrypt_xor_data(
+					 &( task->data[ data_offset ] ),
+					 task->initialization_vector,
+					 SERPENTCRYPT_BLOCK_SIZE );
+
+					result = serpentcrypt_crypt_ecb(
+					          task,
+					          0,
+					          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+					          &( task->data[ data_offset ] ),
+					          SERPENTCRYPT_BLOCK_SIZE,
+					          &( task->data[ data_offset ] ),
+					          SERPENTCRYPT_BLOCK_SIZE,
+					          error );
+
+					if( result != 1 )
+					{
+						break;
+					}
+					if( memory_copy(
+					     task->initialization_vector,
+					     &( task->data[ data_offset ] ),
+					     SERPENTCRYPT_BLOCK_SIZE ) == NULL )
+					{
+						result = -1;
+
+						break;
+					}
+				}
+			}
+			else
+			{
+				/* The ciphertext of a segment is preserved in the scratch buffer
+				 * so that the segment can be decrypted in place
+				 */
+				while( data_offset < task->data_size )
+				{
+					segment_size = task->data_size - data_offset;
+
+					if( segment_size > SERPENTCRYPT_SCRATCH_SIZE )
+					{
+						segment_size = SERPENTCRYPT_SCRATCH_SIZE;
+					}
+					if( memory_copy(
+					     task->scratch,
+					     &( task->data[ data_offset ] ),
+					     segment_size ) == NULL )
+					{
+						result = -1;
+
+						break;
+					}
+					result = serpentcrypt_crypt_ecb(
+					          task,
+					          0,
+					          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+					          &( task->data[ data_offset ] ),
+					          segment_size,
+					          &( task->data[ data_offset ] ),
+					          segment_size,
+					          error );
+
+					if( result != 1 )
+					{
+						break;
+					}
+					serpentcrypt_xor_data(
+					 &( task->data[ data_offset ] ),
+					 task->initialization_vector,
+					 SERPENTCRYPT_BLOCK_SIZE );
+
+					serpentcrypt_xor_data(
+					 &( task->data[ data_offset + SERPENTCRYPT_BLOCK_SIZE ] ),
+					 task->scratch,
+					 segment_size - SERPENTCRYPT_BLOCK_SIZE );
+
+					if( memory_copy(
+					     task->initialization_vector,
+					     &( task->scratch[ segment_size - SERPENTCRYPT_BLOCK_SIZE ] ),
+					     SERPENTCRYPT_BLOCK_SIZE ) == NULL )
+					{
+						result = -1;
+
+						break;
+					}
+					data_offset += segment_size;
+				}
+			}
+			break;
+
+		case SERPENTCRYPT_MODE_CTR:
+			/* The key stream is the encrypted counter blocks, the last block
+			 * can be partial
+			 */
+			while( data_offset < task->data_size )
+			{
+				segment_size = task->data_size - data_offset;
+
+				if( segment_size > SERPENTCRYPT_SCRATCH_SIZE )
+				{
+					segment_size = SERPENTCRYPT_SCRATCH_SIZE;
+				}
+				keystream_size = segment_size;
+
+				if( ( keystream_size % SERPENTCRYPT_BLOCK_SIZE ) != 0 )
+				{
+					keystream_size += SERPENTCRYPT_BLOCK_SIZE - ( keystream_size % SERPENTCRYPT_BLOCK_SIZE );
+				}
+				for( block_offset = 0;
+				     block_offset < keystream_size;
+				     block_offset += SERPENTCRYPT_BLOCK_SIZE )
+				{
+					if( memory_copy(
+					     &( task->scratch[ block_offset ] ),
+					     task->initialization_vector,
+					     SERPENTCRYPT_BLOCK_SIZE ) == NULL )
+					{
+						result = -1;
+
+						break;
+					}
+					serpentcrypt_counter_add(
+					 task->initialization_vector,
+					 1 );
+				}
+				if( result != 1 )
+				{
+					break;
+				}
+				result = serpentcrypt_crypt_ecb(
+				          task,
+				          0,
+				          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+				          task->scratch,
+				          keystream_size,
+				          task->scratch,
+				          keystream_size,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				serpentcrypt_xor_data(
+				 &( task->data[ data_offset ] ),
+				 task->scratch,
+				 segment_size );
+
+				data_offset += segment_size;
+			}
+			break;
+
+		case SERPENTCRYPT_MODE_ECB:
+			result = serpentcrypt_crypt_ecb(
+			          task,
+			          0,
+			          task->crypt_mode,
+			          task->data,
+			          task->data_size,
+			          task->data,
+			          task->data_size,
+			          error );
+			break;
+
+		case SERPENTCRYPT_MODE_XTS:
+			/* The tweaks of a segment are stored in the scratch buffer so that
+			 * the segment is de- or encrypted with a single call
+			 */
+			while( data_offset < task->data_size )
+			{
+				if( memory_set(
+				     tweak,
+				     0,
+				     SERPENTCRYPT_BLOCK_SIZE ) == NULL )
+				{
+					result = -1;
+
+					break;
+				}
+				byte_stream_copy_from_uint64_little_endian(
+				 tweak,
+				 task->data_unit_number );
+
+				result = serpentcrypt_crypt_ecb(
+				          task,
+				          1,
+				          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+				          tweak,
+				          SERPENTCRYPT_BLOCK_SIZE,
+				          tweak,
+				          SERPENTCRYPT_BLOCK_SIZE,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				data_unit_size = task->data_size - data_offset;
+
+				if( data_unit_size > task->data_unit_size )
+				{
+					data_unit_size = task->data_unit_size;
+				}
+				for( data_unit_offset = 0;
+				     data_unit_offset < data_unit_size;
+				     data_unit_offset += segment_size )
+				{
+					segment_size = data_unit_size - data_unit_offset;
+
+					if( segment_size > SERPENTCRYPT_SCRATCH_SIZE )
+					{
+						segment_size = SERPENTCRYPT_SCRATCH_SIZE;
+					}
+					for( block_offset = 0;
+					     block_offset < segment_size;
+					     block_offset += SERPENTCRYPT_BLOCK_SIZE )
+					{
+						if( memory_copy(
+						     &( task->scratch[ block_offset ] ),
+						     tweak,
+						     SERPENTCRYPT_BLOCK_SIZE ) == NULL )
+						{
+							result = -1;
+
+							break;
+						}
+						serpentcrypt_xts_multiply_tweak(
+						 tweak );
+					}
+					if( result != 1 )
+					{
+						break;
+					}
+					serpentcrypt_xor_data(
+					 &( task->data[ data_offset + data_unit_offset ] ),
+					 task->scratch,
+					 segment_size );
+
+					result = serpentcrypt_crypt_ecb(
+					          task,
+					          0,
+					          task->crypt_mode,
+					          &( task->data[ data_offset + data_unit_offset ] ),
+					          segment_size,
+					          &( task->data[ data_offset + data_unit_offset ] ),
+					          segment_size,
+					          error );
+
+					if( result != 1 )
+					{
+						break;
+					}
+					serpentcrypt_xor_data(
+					 &( task->data[ data_offset + data_unit_offset ] ),
+					 task->scratch,
+					 segment_size );
+				}
+				if( result != 1 )
+				{
+					break;
+				}
+				data_offset += data_unit_size;
+
+				task->data_unit_number += 1;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported mode.",
+			 function );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to de- or encrypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts the data of a task and sets its result
+ */
+void serpentcrypt_task_run(
+      serpentcrypt_task_t *task )
+{
+	libcerror_error_t *error = NULL;
+
+	task->result = serpentcrypt_task_crypt(
+	                task,
+	                &error );
+
+	if( error != NULL )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* De- or encrypts the data of a task from a thread pool
+ * Returns 1 on success or -1 on error
+ */
+int serpentcrypt_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	serpentcrypt_task_run(
+	 (serpentcrypt_task_t *) value );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* De- or encrypts a chunk of data in place
+ * The chunk is split into one task per thread at block or data unit aligned
+ * boundaries. Except for CBC encryption every task only depends on the chaining
+ * state at its start, which is derived before the tasks are run.
+ * The chaining state, the initialization vector and data unit number, is
+ * updated to continue with the next chunk.
+ * Returns 1 if successful or -1 on error
+ */
+int serpentcrypt_crypt_buffer(
+     serpentcrypt_task_t *tasks,
+     int number_of_threads,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     uint64_t *data_unit_number,
+     libcerror_error_t **error )
+{
+	serpentcrypt_task_t *task              = NULL;
+	static char *function                  = "serpentcrypt_crypt_buffer";
+	size_t alignment_size                  = SERPENTCRYPT_BLOCK_SIZE;
+	size_t data_offset                     = 0;
+	size_t number_of_alignment_units       = 0;
+	size_t task_data_size                  = 0;
+	int number_of_tasks                    = 0;
+	int task_index                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+	if( tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector_size != SERPENTCRYPT_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initialization vector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_unit_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data unit number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tasks[ 0 ].mode != SERPENTCRYPT_MODE_CTR )
+	 && ( ( buffer_size % SERPENTCRYPT_BLOCK_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value not a multiple of the block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( tasks[ 0 ].mode == SERPENTCRYPT_MODE_XTS )
+	{
+		alignment_size = tasks[ 0 ].data_unit_size;
+	}
+	number_of_tasks = number_of_threads;
+
+	if( ( tasks[ 0 ].mode == SERPENTCRYPT_MODE_CBC )
+	 && ( tasks[ 0 ].crypt_mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT ) )
+	{
+		number_of_tasks = 1;
+	}
+	number_of_alignment_units = ( buffer_size + alignment_size - 1 ) / alignment_size;
+
+	if( (size_t) number_of_tasks > number_of_alignment_units )
+	{
+		number_of_tasks = (int) number_of_alignment_units;
+	}
+	task_data_size = ( ( number_of_alignment_units + number_of_tasks - 1 ) / number_of_tasks ) * alignment_size;
+
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( data_offset >= buffer_size )
+		{
+			number_of_tasks = task_index;
+
+			break;
+		}
+		task = &( tasks[ task_index ] );
+
+		task->data      = &( buffer[ data_offset ] );
+		task->data_size = buffer_size - data_offset;
+		task->result    = 0;
+
+		if( task->data_size > task_data_size )
+		{
+			task->data_size = task_data_size;
+		}
+		if( task->mode == SERPENTCRYPT_MODE_CBC )
+		{
+			if( task_index == 0 )
+			{
+				memory_copy(
+				 task->initialization_vector,
+				 initialization_vector,
+				 SERPENTCRYPT_BLOCK_SIZE );
+			}
+			else
+			{
+				memory_copy(
+				 task->initialization_vector,
+				 &( buffer[ data_offset - SERPENTCRYPT_BLOCK_SIZE ] ),
+				 SERPENTCRYPT_BLOCK_SIZE );
+			}
+		}
+		else if( task->mode == SERPENTCRYPT_MODE_CTR )
+		{
+			memory_copy(
+			 task->initialization_vector,
+			 initialization_vector,
+			 SERPENTCRYPT_BLOCK_SIZE );
+
+			serpentcrypt_counter_add(
+			 task->initialization_vector,
+			 (uint64_t) ( data_offset / SERPENTCRYPT_BLOCK_SIZE ) );
+		}
+		else if( task->mode == SERPENTCRYPT_MODE_XTS )
+		{
+			task->data_unit_number = *data_unit_number + (uint64_t) ( data_offset / alignment_size );
+		}
+		data_offset += task->data_size;
+	}
+	/* The last ciphertext block of the chunk is overwritten when it is decrypted in place
+	 */
+	if( ( tasks[ 0 ].mode == SERPENTCRYPT_MODE_CBC )
+	 && ( tasks[ 0 ].crypt_mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
+	{
+		memory_copy(
+		 initialization_vector,
+		 &( buffer[ buffer_size - SERPENTCRYPT_BLOCK_SIZE ] ),
+		 SERPENTCRYPT_BLOCK_SIZE );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &serpentcrypt_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		task = &( tasks[ task_index ] );
+
+		/* Without a thread pool the data is de- or encrypted here
+		 */
+		if( task->result == 0 )
+		{
+			serpentcrypt_task_run(
+			 task );
+		}
+		if( task->result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to de- or encrypt data of task: %d.",
+			 function,
+			 task_index );
+
+			goto on_error;
+		}
+	}
+	if( ( tasks[ 0 ].mode == SERPENTCRYPT_MODE_CBC )
+	 && ( tasks[ 0 ].crypt_mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT ) )
+	{
+		memory_copy(
+		 initialization_vector,
+		 &( buffer[ buffer_size - SERPENTCRYPT_BLOCK_SIZE ] ),
+		 SERPENTCRYPT_BLOCK_SIZE );
+	}
+	else if( tasks[ 0 ].mode == SERPENTCRYPT_MODE_CTR )
+	{
+		serpentcrypt_counter_add(
+		 initialization_vector,
+		 (uint64_t) ( ( buffer_size + SERPENTCRYPT_BLOCK_SIZE - 1 ) / SERPENTCRYPT_BLOCK_SIZE ) );
+	}
+	else if( tasks[ 0 ].mode == SERPENTCRYPT_MODE_XTS )
+	{
+		*data_unit_number += (uint64_t) number_of_alignment_units;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -145,18 +1160,33 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use serpentcrypt to de- or encrypt data using Serpent.\n\n" );
 
-	fprintf( stream, "Usage: serpentcrypt [ -k key ] [ -o offset ] [ -s size ]\n"
-	                 "                    [ -t target ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: serpentcrypt [ -i initialization_vector ] [ -k key ] [ -m mode ]\n"
+	                 "                    [ -n data_unit_number ] [ -o offset ]\n"
+	                 "                    [ -j number_of_threads ] [ -s size ]\n"
+	                 "                    [ -t target ] [ -u data_unit_size ] [ -ehrvV ]\n"
+	                 "                    source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-e:     encrypt the data instead of decrypting it\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
-	fprintf( stream, "\t-k:     the key formatted in base16\n" );
+	fprintf( stream, "\t-i:     the initialization vector formatted in base16,\n"
+	                 "\t        used by cbc and ctr (default is 0)\n" );
+	fprintf( stream, "\t-j:     number of threads (default is 1)\n" );
+	fprintf( stream, "\t-k:     the key formatted in base16, for xts the data key\n"
+	                 "\t        followed by the tweak key\n" );
+	fprintf( stream, "\t-m:     mode, options: cbc, ctr, ecb (default), xts\n" );
+	fprintf( stream, "\t-n:     the number of the first data unit, used by xts\n"
+	                 "\t        (default is 0)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     same as -j\n" );
+	fprintf( stream, "\t-r:     use the libfcrypto reference implementation instead of\n"
+	                 "\t        the bitsliced implementation\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
 	                 "\t        by default the data will be written to stdout in\n"
 	                 "\t        hexadecimal representation\n" );
+	fprintf( stream, "\t-u:     the data unit size, used by xts (default is 512)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
@@ -170,27 +1200,48 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error               = NULL;
-	libcfile_file_t *destination_file      = NULL;
-	libcfile_file_t *source_file           = NULL;
-	libfcrypto_serpent_context_t *context  = NULL;
-	system_character_t *option_keys        = NULL;
-	system_character_t *option_target_path = NULL;
-	system_character_t *source             = NULL;
-	uint8_t *buffer                        = NULL;
-	uint8_t *decrypted_data                = NULL;
-	uint8_t *key_data                      = NULL;
-	char *program                          = "serpentcrypt";
-	system_integer_t option                = 0;
-	size64_t source_size                   = 0;
-	size_t buffer_size                     = 0;
-	size_t decrypted_data_size             = 0;
-	size_t key_data_size                   = 0;
-	ssize_t read_count                     = 0;
-	ssize_t write_count                    = 0;
-	off_t source_offset                    = 0;
-	int result                             = 0;
-	int verbose                            = 0;
+	uint8_t initialization_vector[ SERPENTCRYPT_BLOCK_SIZE ];
+
+	assorted_serpent_context_t *context                   = NULL;
+	assorted_serpent_context_t *tweak_context             = NULL;
+	libcerror_error_t *error                              = NULL;
+	libcfile_file_t *destination_file                     = NULL;
+	libcfile_file_t *source_file                          = NULL;
+	libfcrypto_serpent_context_t *reference_context       = NULL;
+	libfcrypto_serpent_context_t *reference_tweak_context = NULL;
+	serpentcrypt_task_t *tasks                            = NULL;
+	system_character_t *option_initialization_vector      = NULL;
+	system_character_t *option_keys                       = NULL;
+	system_character_t *option_mode                       = NULL;
+	system_character_t *option_target_path                = NULL;
+	system_character_t *source                            = NULL;
+	uint8_t *buffer                                       = NULL;
+	uint8_t *initialization_vector_data                   = NULL;
+	uint8_t *key_data                                     = NULL;
+	char *crypt_mode_string                               = "decrypting";
+	char *operation_string                                = "decryption";
+	char *program                                         = "serpentcrypt";
+	system_integer_t option                               = 0;
+	size64_t remaining_size                               = 0;
+	size64_t source_size                                  = 0;
+	size_t alignment_size                                 = SERPENTCRYPT_BLOCK_SIZE;
+	size_t buffer_size                                    = 0;
+	size_t data_unit_size                                 = 512;
+	size_t initialization_vector_data_size                = 0;
+	size_t key_data_size                                  = 0;
+	size_t key_size                                       = 0;
+	size_t read_size                                      = 0;
+	ssize_t read_count                                    = 0;
+	ssize_t write_count                                   = 0;
+	uint64_t data_unit_number                             = 0;
+	off_t source_offset                                   = 0;
+	int crypt_mode                                        = LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT;
+	int mode                                              = SERPENTCRYPT_MODE_ECB;
+	int number_of_threads                                 = 1;
+	int result                                            = 0;
+	int task_index                                        = 0;
+	int use_reference                                     = 0;
+	int verbose                                           = 0;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -205,7 +1256,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hk:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "ehi:j:k:m:n:o:p:rs:t:u:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -221,17 +1272,39 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'e':
+				crypt_mode        = LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT;
+				crypt_mode_string = "encrypting";
+				operation_string  = "encryption";
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'i':
+				option_initialization_vector = optarg;
+
+				break;
+
 			case (system_integer_t) 'k':
 				option_keys = optarg;
 
 				break;
 
+			case (system_integer_t) 'm':
+				option_mode = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				data_unit_number = system_string_copy_to_64bit( optarg );
+
+				break;
+
 			case (system_integer_t) 'o':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_offset = _wtol( optarg );
@@ -240,6 +1313,17 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case (system_integer_t) 'j':
+			case (system_integer_t) 'p':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case (system_integer_t) 'r':
+				use_reference = 1;
+
+				break;
+
 			case (system_integer_t) 's':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_size = _wtol( optarg );
@@ -253,6 +1337,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'u':
+				data_unit_size = (size_t) system_string_copy_to_long( optarg );
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -289,6 +1378,43 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
+	if( option_mode != NULL )
+	{
+		if( serpentcrypt_mode_from_string(
+		     option_mode,
+		     &mode,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported mode.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > SERPENTCRYPT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( mode == SERPENTCRYPT_MODE_XTS )
+	{
+		if( ( data_unit_size < SERPENTCRYPT_BLOCK_SIZE )
+		 || ( data_unit_size > SERPENTCRYPT_BUFFER_SIZE )
+		 || ( ( data_unit_size % SERPENTCRYPT_BLOCK_SIZE ) != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported data unit size.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		alignment_size = data_unit_size;
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -348,20 +1474,27 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Invalid source size value is zero.\n" );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
+	if( ( mode != SERPENTCRYPT_MODE_CTR )
+	 && ( ( source_size % SERPENTCRYPT_BLOCK_SIZE ) != 0 ) )
 	{
 		fprintf(
 		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		 "Invalid source size value not a multiple of the block size.\n" );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	/* Create the input buffer
+	/* The data is processed in chunks so that the memory usage does not
+	 * depend on the size of the source, every thread gets a part of a chunk
+	 * that is aligned to the block or data unit size
 	 */
-	buffer_size = source_size;
+	buffer_size = ( SERPENTCRYPT_BUFFER_SIZE / alignment_size ) * alignment_size * (size_t) number_of_threads;
 
+	if( source_size < (size64_t) buffer_size )
+	{
+		buffer_size = (size_t) source_size;
+	}
 	buffer = (uint8_t *) memory_allocate(
 	                      sizeof( uint8_t ) * buffer_size );
 
@@ -371,19 +1504,6 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Unable to create buffer.\n" );
 
-		return( EXIT_FAILURE );
-	}
-	decrypted_data_size = source_size;
-
-	decrypted_data = (uint8_t *) memory_allocate(
-	                              sizeof( uint8_t ) * decrypted_data_size );
-
-	if( decrypted_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create decrypted data buffer.\n" );
-
 		goto on_error;
 	}
 	/* Position the source file at the right offset
@@ -400,39 +1520,66 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfcrypto_serpent_context_initialize(
-	     &context,
-	     &error ) != 1 )
+	if( use_reference != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create Serpent context.\n" );
+		if( libfcrypto_serpent_context_initialize(
+		     &reference_context,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create Serpent reference context.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( mode == SERPENTCRYPT_MODE_XTS )
+		{
+			if( libfcrypto_serpent_context_initialize(
+			     &reference_tweak_context,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create Serpent reference tweak context.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+	{
+		if( assorted_serpent_context_initialize(
+		     &context,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create Serpent context.\n" );
+
+			goto on_error;
+		}
+		if( mode == SERPENTCRYPT_MODE_XTS )
+		{
+			if( assorted_serpent_context_initialize(
+			     &tweak_context,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create Serpent tweak context.\n" );
+
+				goto on_error;
+			}
+		}
 	}
 	fprintf(
 	 stdout,
-	 "Starting Serpent decrypting data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
+	 "Starting Serpent %s data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
+	 crypt_mode_string,
 	 source,
 	 source_offset,
 	 source_offset );
 
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
-
-		goto on_error;
-	}
-	/* Decrypts the data
-	 */
 	if( serpentcrypt_set_keys(
 	     option_keys,
 	     &key_data,
@@ -445,11 +1592,64 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfcrypto_serpent_context_set_key(
-	     context,
-	     key_data,
-	     key_data_size * 8,
-	     &error ) != 1 )
+	/* For XTS the key consists of the data key followed by the tweak key
+	 */
+	key_size = key_data_size;
+
+	if( mode == SERPENTCRYPT_MODE_XTS )
+	{
+		if( ( key_data_size % 2 ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid XTS key size.\n" );
+
+			goto on_error;
+		}
+		key_size = key_data_size / 2;
+
+		if( use_reference != 0 )
+		{
+			result = libfcrypto_serpent_context_set_key(
+			          reference_tweak_context,
+			          &( key_data[ key_size ] ),
+			          key_size * 8,
+			          &error );
+		}
+		else
+		{
+			result = assorted_serpent_context_set_key(
+			          tweak_context,
+			          &( key_data[ key_size ] ),
+			          key_size * 8,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set tweak key in context.\n" );
+
+			goto on_error;
+		}
+	}
+	if( use_reference != 0 )
+	{
+		result = libfcrypto_serpent_context_set_key(
+		          reference_context,
+		          key_data,
+		          key_size * 8,
+		          &error );
+	}
+	else
+	{
+		result = assorted_serpent_context_set_key(
+		          context,
+		          key_data,
+		          key_size * 8,
+		          &error );
+	}
+	if( result != 1 )
 	{
 		fprintf(
 		 stderr,
@@ -473,44 +1673,79 @@ int main( int argc, char * const argv[] )
 
 	key_data = NULL;
 
-	if( option_target_path == NULL )
+	if( memory_set(
+	     initialization_vector,
+	     0,
+	     SERPENTCRYPT_BLOCK_SIZE ) == NULL )
 	{
 		fprintf(
 		 stderr,
-		 "Encrypted data:\n" );
+		 "Unable to clear initialization vector.\n" );
 
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
+		goto on_error;
 	}
-	if( libfcrypto_serpent_crypt_ecb(
-	     context,
-	     LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
-	     buffer,
-	     source_size,
-	     decrypted_data,
-	     decrypted_data_size,
-	     &error ) != 1 )
+	if( option_initialization_vector != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to decode data.\n" );
+		if( serpentcrypt_set_keys(
+		     option_initialization_vector,
+		     &initialization_vector_data,
+		     &initialization_vector_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve initialization vector from argument.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( initialization_vector_data_size != SERPENTCRYPT_BLOCK_SIZE )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid initialization vector size.\n" );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     initialization_vector,
+		     initialization_vector_data,
+		     SERPENTCRYPT_BLOCK_SIZE ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to copy initialization vector.\n" );
+
+			goto on_error;
+		}
+		memory_free(
+		 initialization_vector_data );
+
+		initialization_vector_data = NULL;
 	}
-	if( option_target_path == NULL )
+	tasks = (serpentcrypt_task_t *) memory_allocate(
+	                                 sizeof( serpentcrypt_task_t ) * number_of_threads );
+
+	if( tasks == NULL )
 	{
 		fprintf(
 		 stderr,
-		 "Decrypted data:\n" );
+		 "Unable to create tasks.\n" );
 
-		libcnotify_print_data(
-		 decrypted_data,
-		 decrypted_data_size,
-		 0 );
+		goto on_error;
 	}
-	else
+	for( task_index = 0;
+	     task_index < number_of_threads;
+	     task_index++ )
+	{
+		tasks[ task_index ].context                 = context;
+		tasks[ task_index ].tweak_context           = tweak_context;
+		tasks[ task_index ].reference_context       = reference_context;
+		tasks[ task_index ].reference_tweak_context = reference_tweak_context;
+		tasks[ task_index ].mode                    = mode;
+		tasks[ task_index ].crypt_mode              = crypt_mode;
+		tasks[ task_index ].data_unit_size          = data_unit_size;
+	}
+	if( option_target_path != NULL )
 	{
 		if( libcfile_file_initialize(
 		     &destination_file,
@@ -543,20 +1778,93 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		write_count = libcfile_file_write_buffer(
-			       destination_file,
-			       decrypted_data,
-			       decrypted_data_size,
-			       &error );
+	}
+	/* De- or encrypts the data in place, the chaining state is maintained
+	 * across the chunks
+	 */
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = buffer_size;
+
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      buffer,
+			      read_size,
+			      &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( option_target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Input data:\n" );
 
-		if( write_count != (ssize_t) decrypted_data_size )
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 0 );
+		}
+		if( serpentcrypt_crypt_buffer(
+		     tasks,
+		     number_of_threads,
+		     buffer,
+		     read_size,
+		     initialization_vector,
+		     SERPENTCRYPT_BLOCK_SIZE,
+		     &data_unit_number,
+		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to write to destination file.\n" );
+			 "Unable to de- or encrypt data.\n" );
 
 			goto on_error;
 		}
+		if( option_target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Output data:\n" );
+
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 0 );
+		}
+		else
+		{
+			write_count = libcfile_file_write_buffer(
+				       destination_file,
+				       buffer,
+				       read_size,
+				       &error );
+
+			if( write_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write to destination file.\n" );
+
+				goto on_error;
+			}
+		}
+		remaining_size -= read_size;
+	}
+	if( destination_file != NULL )
+	{
 		if( libcfile_file_close(
 		     destination_file,
 		     &error ) != 0 )
@@ -580,15 +1888,62 @@ int main( int argc, char * const argv[] )
 	}
 	/* Clean up
 	 */
-	if( libfcrypto_serpent_context_free(
-	     &context,
-	     &error ) != 1 )
+	memory_free(
+	 tasks );
+
+	tasks = NULL;
+
+	if( reference_tweak_context != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to free Serpent context.\n" );
+		if( libfcrypto_serpent_context_free(
+		     &reference_tweak_context,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free Serpent reference tweak context.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+	if( reference_context != NULL )
+	{
+		if( libfcrypto_serpent_context_free(
+		     &reference_context,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free Serpent reference context.\n" );
+
+			goto on_error;
+		}
+	}
+	if( tweak_context != NULL )
+	{
+		if( assorted_serpent_context_free(
+		     &tweak_context,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free Serpent tweak context.\n" );
+
+			goto on_error;
+		}
+	}
+	if( context != NULL )
+	{
+		if( assorted_serpent_context_free(
+		     &context,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free Serpent context.\n" );
+
+			goto on_error;
+		}
 	}
 	if( libcfile_file_close(
 	     source_file,
@@ -610,11 +1965,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( decrypted_data != NULL )
-	{
-		memory_free(
-		 decrypted_data );
-	}
 	if( buffer != NULL )
 	{
 		memory_free(
@@ -622,7 +1972,8 @@ int main( int argc, char * const argv[] )
 	}
 	fprintf(
 	 stdout,
-	 "Serpent decryption:\tSUCCESS\n" );
+	 "Serpent %s:\tSUCCESS\n",
+	 operation_string );
 
 	return( EXIT_SUCCESS );
 
@@ -640,11 +1991,6 @@ on_error:
 		 &destination_file,
 		 NULL );
 	}
-	if( decrypted_data != NULL )
-	{
-		memory_free(
-		 decrypted_data );
-	}
 	if( key_data != NULL )
 	{
 		memory_set(
@@ -655,9 +2001,37 @@ on_error:
 		memory_free(
 		 key_data );
 	}
-	if( context != NULL )
+	if( tasks != NULL )
+	{
+		memory_free(
+		 tasks );
+	}
+	if( initialization_vector_data != NULL )
+	{
+		memory_free(
+		 initialization_vector_data );
+	}
+	if( reference_tweak_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &reference_tweak_context,
+		 NULL );
+	}
+	if( reference_context != NULL )
 	{
 		libfcrypto_serpent_context_free(
+		 &reference_context,
+		 NULL );
+	}
+	if( tweak_context != NULL )
+	{
+		assorted_serpent_context_free(
+		 &tweak_context,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		assorted_serpent_context_free(
 		 &context,
 		 NULL );
 	}
@@ -674,7 +2048,8 @@ on_error:
 	}
 	fprintf(
 	 stdout,
-	 "Serpent decryption:\tFAILURE\n" );
+	 "Serpent %s:\tFAILURE\n",
+	 operation_string );
 
 	return( EXIT_FAILURE );
 }
@@ -0,0 +1,744 @@
+/*
+ * Carves compressed streams embedded in data
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_carve.h"
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_memory_map.h"
+#include "assorted_output.h"
+#include "assorted_system_string.h"
+
+/* The number of candidates that are scanned for and decoded at a time
+ */
+#define STREAMCARVE_NUMBER_OF_CANDIDATES		256
+
+#define STREAMCARVE_MAXIMUM_NUMBER_OF_THREADS		64
+
+#define STREAMCARVE_DEFAULT_MAXIMUM_SIZE		( 64 * 1024 * 1024 )
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use streamcarve to find and decompress zlib, gzip, bzip2 and xz\n"
+	                 "streams embedded in data.\n\n" );
+
+	fprintf( stream, "Usage: streamcarve [ -f formats ] [ -m maximum_size ] [ -p prefix ]\n"
+	                 "                   [ -j number_of_threads ] [ -hlvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-f:     comma separated formats to carve, options: all (default),\n"
+	                 "\t        bzip2, gzip, xz, zlib\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to decompress the streams (default\n"
+	                 "\t        is 1)\n" );
+	fprintf( stream, "\t-l:     only list the streams, the decompressed data is not stored\n" );
+	fprintf( stream, "\t-m:     maximum size of the decompressed data of a stream (default\n"
+	                 "\t        is 64 MiB), larger streams are reported as failed\n" );
+	fprintf( stream, "\t-p:     prefix of the destination files (default is the source),\n"
+	                 "\t        the files are named: prefix.0x<offset>.<format>\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Writes the uncompressed data of a candidate to a destination file
+ * Returns 1 on success or -1 on error
+ */
+int streamcarve_write_candidate(
+     assorted_carve_candidate_t *candidate,
+     const char *prefix,
+     libcerror_error_t **error )
+{
+	char destination[ 256 ];
+
+	libcfile_file_t *destination_file = NULL;
+	static char *function             = "streamcarve_write_candidate";
+	ssize_t write_count               = 0;
+	int print_count                   = 0;
+
+	if( candidate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidate.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               destination,
+	               256,
+	               "%s.0x%08" PRIx64 ".%s",
+	               prefix,
+	               (uint64_t) candidate->offset,
+	               assorted_carve_get_format_name(
+	                candidate->format ) );
+
+	if( ( print_count < 0 )
+	 || ( print_count > 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set destination filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &destination_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_open(
+	     destination_file,
+	     destination,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open destination file: %s.",
+		 function,
+		 destination );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               destination_file,
+	               candidate->uncompressed_data,
+	               candidate->uncompressed_data_size,
+	               error );
+
+	if( write_count != (ssize_t) candidate->uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to destination file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     destination_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close destination file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &destination_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( destination_file != NULL )
+	{
+		libcfile_file_free(
+		 &destination_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	assorted_carve_candidate_t *candidates = NULL;
+	assorted_memory_map_t *memory_map      = NULL;
+	libcerror_error_t *error               = NULL;
+	libcfile_file_t *source_file           = NULL;
+	system_character_t *option_formats     = NULL;
+	system_character_t *source             = NULL;
+	const uint8_t *data                    = NULL;
+	uint8_t *buffer                        = NULL;
+	const char *prefix                     = NULL;
+	char *program                          = "streamcarve";
+	system_integer_t option                = 0;
+	size64_t source_size                   = 0;
+	size_t candidate_index                 = 0;
+	size_t data_size                       = 0;
+	size_t maximum_size                    = STREAMCARVE_DEFAULT_MAXIMUM_SIZE;
+	size_t number_of_candidates            = 0;
+	size_t number_of_failed_streams        = 0;
+	size_t number_of_streams               = 0;
+	size_t scan_offset                     = 0;
+	size_t stream_end_offset               = 0;
+	ssize_t read_count                     = 0;
+	uint8_t formats                        = ASSORTED_CARVE_FORMAT_ALL;
+	uint8_t list_only                      = 0;
+	int number_of_threads                  = 1;
+	int result                             = 0;
+	int scan_result                        = 0;
+	int verbose                            = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "f:hj:lm:p:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'f':
+				option_formats = optarg;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'l':
+				list_only = 1;
+
+				break;
+
+			case 'm':
+				maximum_size = (size_t) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'p':
+				prefix = (const char *) optarg;
+
+				break;
+
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( prefix == NULL )
+	{
+		prefix = (const char *) source;
+	}
+	if( option_formats != NULL )
+	{
+		result = assorted_carve_formats_from_string(
+		          (const char *) option_formats,
+		          system_string_length(
+		           option_formats ),
+		          &formats,
+		          &error );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported formats: %" PRIs_SYSTEM ".\n",
+			 option_formats );
+
+			goto on_error;
+		}
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > STREAMCARVE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( maximum_size == 0 )
+	 || ( maximum_size > (size_t) SSIZE_MAX ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid maximum size value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	/* The source is memory mapped if supported, otherwise it is read
+	 */
+	if( assorted_memory_map_initialize(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create memory map.\n" );
+
+		goto on_error;
+	}
+	result = assorted_memory_map_open(
+	          memory_map,
+	          source,
+	          0,
+	          0,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open memory map.\n" );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		data      = memory_map->data;
+		data_size = memory_map->data_size;
+	}
+	else
+	{
+		if( libcfile_file_initialize(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create source file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#endif
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+		if( source_size > (size64_t) SSIZE_MAX )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		if( source_size > 0 )
+		{
+			buffer = (uint8_t *) memory_allocate(
+			                      sizeof( uint8_t ) * (size_t) source_size );
+
+			if( buffer == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create buffer.\n" );
+
+				goto on_error;
+			}
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              buffer,
+			              (size_t) source_size,
+			              &error );
+
+			if( read_count != (ssize_t) source_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+		}
+		data      = buffer;
+		data_size = (size_t) source_size;
+	}
+	candidates = (assorted_carve_candidate_t *) memory_allocate(
+	                                             sizeof( assorted_carve_candidate_t ) * STREAMCARVE_NUMBER_OF_CANDIDATES );
+
+	if( candidates == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create candidates.\n" );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     candidates,
+	     0,
+	     sizeof( assorted_carve_candidate_t ) * STREAMCARVE_NUMBER_OF_CANDIDATES ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear candidates.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Offset\tFormat\tCompressed size\tUncompressed size\n" );
+
+	/* The candidates are scanned for and decoded in batches, the candidates of
+	 * a batch are decoded in parallel and written in order of their offset
+	 */
+	while( ( data_size > 0 )
+	    && ( scan_result == 0 ) )
+	{
+		scan_result = assorted_carve_scan(
+		               data,
+		               data_size,
+		               formats,
+		               &scan_offset,
+		               candidates,
+		               STREAMCARVE_NUMBER_OF_CANDIDATES,
+		               &number_of_candidates,
+		               &error );
+
+		if( scan_result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan data.\n" );
+
+			goto on_error;
+		}
+		if( list_only != 0 )
+		{
+			for( candidate_index = 0;
+			     candidate_index < number_of_candidates;
+			     candidate_index++ )
+			{
+				fprintf(
+				 stdout,
+				 "0x%08" PRIx64 "\t%s\t\t\n",
+				 (uint64_t) candidates[ candidate_index ].offset,
+				 assorted_carve_get_format_name(
+				  candidates[ candidate_index ].format ) );
+			}
+			number_of_streams += number_of_candidates;
+
+			continue;
+		}
+		if( assorted_carve_decode_candidates(
+		     candidates,
+		     number_of_candidates,
+		     data,
+		     data_size,
+		     maximum_size,
+		     number_of_threads,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decode candidates.\n" );
+
+			goto on_error;
+		}
+		for( candidate_index = 0;
+		     candidate_index < number_of_candidates;
+		     candidate_index++ )
+		{
+			/* A candidate that is contained in a stream that was carved is
+			 * a false match in the compressed data and is ignored
+			 */
+			if( candidates[ candidate_index ].offset >= stream_end_offset )
+			{
+				if( candidates[ candidate_index ].result != 1 )
+				{
+					if( verbose != 0 )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to decode %s stream at offset: 0x%08" PRIx64 ".\n",
+						 assorted_carve_get_format_name(
+						  candidates[ candidate_index ].format ),
+						 (uint64_t) candidates[ candidate_index ].offset );
+					}
+					number_of_failed_streams++;
+				}
+				else
+				{
+					if( streamcarve_write_candidate(
+					     &( candidates[ candidate_index ] ),
+					     prefix,
+					     &error ) != 1 )
+					{
+						fprintf(
+						 stderr,
+						 "Unable to write stream.\n" );
+
+						goto on_error;
+					}
+					fprintf(
+					 stdout,
+					 "0x%08" PRIx64 "\t%s\t%" PRIzd "\t%" PRIzd "\n",
+					 (uint64_t) candidates[ candidate_index ].offset,
+					 assorted_carve_get_format_name(
+					  candidates[ candidate_index ].format ),
+					 candidates[ candidate_index ].compressed_data_size,
+					 candidates[ candidate_index ].uncompressed_data_size );
+
+					if( candidates[ candidate_index ].compressed_data_size > 0 )
+					{
+						stream_end_offset = candidates[ candidate_index ].offset
+						                  + candidates[ candidate_index ].compressed_data_size;
+					}
+					number_of_streams++;
+				}
+			}
+			if( assorted_carve_candidate_clear(
+			     &( candidates[ candidate_index ] ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to clear candidate.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( list_only != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Found %" PRIzd " candidate streams.\n",
+		 number_of_streams );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "Carved %" PRIzd " streams, %" PRIzd " candidates could not be decoded.\n",
+		 number_of_streams,
+		 number_of_failed_streams );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 candidates );
+
+	candidates = NULL;
+
+	if( source_file != NULL )
+	{
+		if( libcfile_file_close(
+		     source_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( assorted_memory_map_free(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free memory map.\n" );
+
+		goto on_error;
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( candidates != NULL )
+	{
+		for( candidate_index = 0;
+		     candidate_index < STREAMCARVE_NUMBER_OF_CANDIDATES;
+		     candidate_index++ )
+		{
+			assorted_carve_candidate_clear(
+			 &( candidates[ candidate_index ] ),
+			 NULL );
+		}
+		memory_free(
+		 candidates );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( EXIT_FAILURE );
+}
+
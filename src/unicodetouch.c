@@ -30,6 +30,14 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
@@ -38,6 +46,27 @@
 #include "assorted_output.h"
 #include "assorted_system_string.h"
 
+/* Files are created relative to an open directory descriptor on POSIX systems
+ * that provide openat, otherwise the target directory is prefixed to the name
+ */
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( AT_FDCWD )
+#define UNICODETOUCH_HAVE_OPENAT	1
+#endif
+
+#if defined( WINAPI )
+#define UNICODETOUCH_PATH_SEPARATOR	'\\'
+#else
+#define UNICODETOUCH_PATH_SEPARATOR	'/'
+#endif
+
+/* The maximum size of a target name
+ */
+#define UNICODETOUCH_MAXIMUM_NAME_SIZE	256
+
+/* The largest character value supported by RFC 2279 UTF-8
+ */
+#define UNICODETOUCH_MAXIMUM_CHARACTER	0x7fffffffUL
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -49,16 +78,465 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use unicodetouch to create a file with a specific Unicode character.\n\n" );
 
-	fprintf( stream, "Usage: unicodetouch [ -hvV ] character\n\n" );
+	fprintf( stream, "Usage: unicodetouch [ -r first-last ] [ -t target_directory ] [ -hvV ]\n"
+	                 "                    [ character ]\n\n" );
 
 	fprintf( stream, "\tcharacter: numeric character value\n\n" );
 
 	fprintf( stream, "\t-h:        shows this help\n" );
+	fprintf( stream, "\t-r:        create a file for every character value in the range\n"
+	                 "\t           first-last, the values are decimal or 0x prefixed\n"
+	                 "\t           hexadecimal, for example: -r 0xd800-0xdfff\n" );
+	fprintf( stream, "\t-t:        directory to create the files in (default is the\n"
+	                 "\t           current directory)\n" );
 	fprintf( stream, "\t-v:        verbose output to stderr\n" );
 	fprintf( stream, "\t-V:        print version\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Parses a decimal or 0x prefixed hexadecimal character value
+ * Returns 1 if successful, 0 if the string is not a valid character value or -1 on error
+ */
+int unicodetouch_parse_character_value(
+     const system_character_t *string,
+     size_t string_length,
+     uint32_t *character_value,
+     libcerror_error_t **error )
+{
+	static char *function      = "unicodetouch_parse_character_value";
+	size_t string_index        = 0;
+	uint64_t value_64bit       = 0;
+	uint8_t base               = 10;
+	uint8_t digit              = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( character_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid character value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length > 2 )
+	 && ( string[ 0 ] == (system_character_t) '0' )
+	 && ( ( string[ 1 ] == (system_character_t) 'x' )
+	  || ( string[ 1 ] == (system_character_t) 'X' ) ) )
+	{
+		base         = 16;
+		string_index = 2;
+	}
+	if( string_index >= string_length )
+	{
+		return( 0 );
+	}
+	while( string_index < string_length )
+	{
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'a' )
+		      && ( string[ string_index ] <= (system_character_t) 'f' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) 'a' + 10 );
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'A' )
+		      && ( string[ string_index ] <= (system_character_t) 'F' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) 'A' + 10 );
+		}
+		else
+		{
+			return( 0 );
+		}
+		value_64bit = ( value_64bit * base ) + digit;
+
+		if( value_64bit > UNICODETOUCH_MAXIMUM_CHARACTER )
+		{
+			return( 0 );
+		}
+		string_index++;
+	}
+	*character_value = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Parses a character value range formatted as first-last
+ * Returns 1 if successful, 0 if the string is not a valid range or -1 on error
+ */
+int unicodetouch_parse_range(
+     const system_character_t *string,
+     uint32_t *first_character_value,
+     uint32_t *last_character_value,
+     libcerror_error_t **error )
+{
+	static char *function = "unicodetouch_parse_range";
+	size_t separator_index = 0;
+	size_t string_length   = 0;
+	int result             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( separator_index = 0;
+	     separator_index < string_length;
+	     separator_index++ )
+	{
+		if( string[ separator_index ] == (system_character_t) '-' )
+		{
+			break;
+		}
+	}
+	if( separator_index >= string_length )
+	{
+		return( 0 );
+	}
+	result = unicodetouch_parse_character_value(
+	          string,
+	          separator_index,
+	          first_character_value,
+	          error );
+
+	if( result == 1 )
+	{
+		result = unicodetouch_parse_character_value(
+		          &( string[ separator_index + 1 ] ),
+		          string_length - ( separator_index + 1 ),
+		          last_character_value,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse character value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 1 )
+	 && ( *first_character_value > *last_character_value ) )
+	{
+		result = 0;
+	}
+	return( result );
+}
+
+/* Determines the target name of a character value
+ * Returns 1 if successful or -1 on error
+ */
+int unicodetouch_get_target_name(
+     uint32_t character_value,
+     system_character_t *target_name,
+     size_t target_name_size,
+     libcerror_error_t **error )
+{
+	system_character_t character_string[ 8 ];
+
+	static char *function         = "unicodetouch_get_target_name";
+	size_t character_string_index = 0;
+	int print_count               = 0;
+	int result                    = 0;
+
+	if( memory_set(
+	     character_string,
+	     0,
+	     8 * sizeof( system_character_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear character string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* Using UCS-2 to support unpaired UTF-16 surrogates
+	 */
+	result = libuna_unicode_character_copy_to_ucs2(
+	          character_value,
+	          (libuna_utf16_character_t *) character_string,
+	          8,
+	          &character_string_index,
+	          error );
+#else
+	/* Using RFC 2279 UTF-8 to support unpaired UTF-16 surrogates
+	 */
+	result = libuna_unicode_character_copy_to_utf8_rfc2279(
+	          character_value,
+	          (libuna_utf8_character_t *) character_string,
+	          8,
+	          &character_string_index,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to create Unicode character string.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = system_string_sprintf(
+	               target_name,
+	               target_name_size,
+	               _SYSTEM_STRING( "unicode_U+%08lx_%s" ),
+	               (unsigned long) character_value,
+	               character_string );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= target_name_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to create target name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates an empty target file
+ * The file is created relative to the directory descriptor if openat is
+ * available, otherwise relative to the target directory path
+ * Returns 1 if successful or -1 on error
+ */
+int unicodetouch_create_file(
+     int directory_descriptor,
+     const system_character_t *target_directory,
+     const system_character_t *target_name,
+     libcerror_error_t **error )
+{
+	static char *function            = "unicodetouch_create_file";
+
+#if defined( UNICODETOUCH_HAVE_OPENAT )
+	int file_descriptor              = 0;
+#else
+	system_character_t target_path[ 2 * UNICODETOUCH_MAXIMUM_NAME_SIZE ];
+
+	libcfile_file_t *target_file     = NULL;
+	size_t target_directory_length   = 0;
+	size_t target_name_length        = 0;
+	int result                       = 0;
+#endif
+
+	if( target_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( UNICODETOUCH_HAVE_OPENAT )
+	file_descriptor = openat(
+	                   directory_descriptor,
+	                   (const char *) target_name,
+	                   O_WRONLY | O_CREAT | O_TRUNC,
+	                   0644 );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create target file.",
+		 function );
+
+		return( -1 );
+	}
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close target file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	if( target_directory == NULL )
+	{
+		target_directory_length = 0;
+	}
+	else
+	{
+		target_directory_length = system_string_length(
+		                           target_directory );
+	}
+	target_name_length = system_string_length(
+	                      target_name );
+
+	if( ( target_directory_length >= UNICODETOUCH_MAXIMUM_NAME_SIZE )
+	 || ( target_name_length >= UNICODETOUCH_MAXIMUM_NAME_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_directory_length > 0 )
+	{
+		if( system_string_copy(
+		     target_path,
+		     target_directory,
+		     target_directory_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy target directory.",
+			 function );
+
+			return( -1 );
+		}
+		if( target_path[ target_directory_length - 1 ] != (system_character_t) UNICODETOUCH_PATH_SEPARATOR )
+		{
+			target_path[ target_directory_length++ ] = (system_character_t) UNICODETOUCH_PATH_SEPARATOR;
+		}
+	}
+	if( system_string_copy(
+	     &( target_path[ target_directory_length ] ),
+	     target_name,
+	     target_name_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &target_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create target file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          target_file,
+	          target_path,
+	          LIBCFILE_OPEN_WRITE,
+	          error );
+#else
+	result = libcfile_file_open(
+	          target_file,
+	          target_path,
+	          LIBCFILE_OPEN_WRITE,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open target file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     target_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close target file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &target_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free target file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( target_file != NULL )
+	{
+		libcfile_file_free(
+		 &target_file,
+		 NULL );
+	}
+	return( -1 );
+#endif /* defined( UNICODETOUCH_HAVE_OPENAT ) */
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -67,18 +545,24 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	system_character_t character_string[ 8 ];
-	system_character_t target[ 256 ];
-
-	libcerror_error_t *error      = NULL;
-	libcfile_file_t *target_file  = NULL;
-	char *program                 = "unicodetouch";
-	long character_value          = 0;
-	system_integer_t option       = 0;
-	size_t character_string_index = 0;
-	ssize_t print_count           = 0;
-	int result                    = 0;
-	int verbose                   = 0;
+	system_character_t target_name[ UNICODETOUCH_MAXIMUM_NAME_SIZE ];
+
+	libcerror_error_t *error                   = NULL;
+	system_character_t *range                  = NULL;
+	system_character_t *target_directory       = NULL;
+	char *program                              = "unicodetouch";
+	system_integer_t option                    = 0;
+	uint64_t number_of_created_files           = 0;
+	uint64_t number_of_failed_conversions      = 0;
+	uint64_t number_of_failed_creations        = 0;
+	uint32_t character_value                   = 0;
+	uint32_t first_character_value             = 0;
+	uint32_t first_failed_conversion           = 0;
+	uint32_t first_failed_creation             = 0;
+	uint32_t last_character_value              = 0;
+	int directory_descriptor                   = -1;
+	int result                                 = 0;
+	int verbose                                = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -87,7 +571,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "hr:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -109,6 +593,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case 'r':
+				range = optarg;
+
+				break;
+
+			case 't':
+				target_directory = optarg;
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -121,144 +615,170 @@ int main( int argc, char * const argv[] )
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
-	{
-		fprintf(
-		 stderr,
-		 "Missing character value.\n" );
-
-		usage_fprint(
-		 stdout );
-
-		return( EXIT_FAILURE );
-	}
-	character_value = system_string_copy_to_long( argv[ optind ] );
-
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
-	if( memory_set(
-	     character_string,
-	     0,
-	     8 * sizeof( system_character_t ) ) == NULL )
+	if( range != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to clear character string.\n" );
+		result = unicodetouch_parse_range(
+		          range,
+		          &first_character_value,
+		          &last_character_value,
+		          &error );
 
-		goto on_error;
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported character value range: %" PRIs_SYSTEM "\n",
+			 range );
+
+			goto on_error;
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	/* Using UCS-2 to support unpaired UTF-16 surrogates
-	 */
-	result = libuna_unicode_character_copy_to_ucs2(
-	          character_value,
-	          (libuna_utf16_character_t *) character_string,
-	          8,
-	          &character_string_index,
-	          &error );
-#else
-	/* Using RFC 2279 UTF-8 to support unpaired UTF-16 surrogates
-	 */
-	result = libuna_unicode_character_copy_to_utf8_rfc2279(
-	          character_value,
-	          (libuna_utf8_character_t *) character_string,
-	          8,
-	          &character_string_index,
-	          &error );
-#endif
-	if( result != 1 )
+	else if( optind == argc )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create Unicode character string.\n" );
+		 "Missing character value.\n" );
 
-		goto on_error;
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
 	}
-	if( memory_set(
-	     target,
-	     0,
-	     256 * sizeof( system_character_t ) ) == NULL )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to clear target file name.\n" );
+		first_character_value = (uint32_t) system_string_copy_to_long( argv[ optind ] );
+		last_character_value  = first_character_value;
+	}
+#if defined( UNICODETOUCH_HAVE_OPENAT )
+	if( target_directory == NULL )
+	{
+		directory_descriptor = AT_FDCWD;
+	}
+	else
+	{
+#if defined( O_DIRECTORY )
+		directory_descriptor = open(
+		                        (const char *) target_directory,
+		                        O_RDONLY | O_DIRECTORY );
+#else
+		directory_descriptor = open(
+		                        (const char *) target_directory,
+		                        O_RDONLY );
+#endif
+		if( directory_descriptor == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open target directory: %" PRIs_SYSTEM ".\n",
+			 target_directory );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	print_count = system_string_sprintf(
-	               target,
-	               256,
-	               _SYSTEM_STRING( "unicode_U+%08lx_%s" ),
-	               character_value,
-	               character_string ) ;
+#endif /* defined( UNICODETOUCH_HAVE_OPENAT ) */
 
-	if( ( print_count < 0 )
-	 || ( (size_t) print_count > 256 ) )
+	/* The failures are counted and reported after all character values are processed
+	 */
+	character_value = first_character_value;
+
+	do
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create target file name.\n" );
+		result = unicodetouch_get_target_name(
+		          character_value,
+		          target_name,
+		          UNICODETOUCH_MAXIMUM_NAME_SIZE,
+		          &error );
 
-		goto on_error;
+		if( result != 1 )
+		{
+			if( number_of_failed_conversions == 0 )
+			{
+				first_failed_conversion = character_value;
+			}
+			number_of_failed_conversions++;
+		}
+		else
+		{
+			result = unicodetouch_create_file(
+			          directory_descriptor,
+			          target_directory,
+			          target_name,
+			          &error );
+
+			if( result != 1 )
+			{
+				if( number_of_failed_creations == 0 )
+				{
+					first_failed_creation = character_value;
+				}
+				number_of_failed_creations++;
+			}
+			else
+			{
+				number_of_created_files++;
+			}
+		}
+		if( error != NULL )
+		{
+			if( verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+			libcerror_error_free(
+			 &error );
+		}
 	}
-	/* Open the target file
-	 */
-	if( libcfile_file_initialize(
-	     &target_file,
-	     &error ) != 1 )
+	while( character_value++ < last_character_value );
+
+#if defined( UNICODETOUCH_HAVE_OPENAT )
+	if( ( directory_descriptor != AT_FDCWD )
+	 && ( close(
+	       directory_descriptor ) != 0 ) )
 	{
+		directory_descriptor = -1;
+
 		fprintf(
 		 stderr,
-		 "Unable to create target file.\n" );
+		 "Unable to close target directory.\n" );
 
 		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          target_file,
-	          target,
-	          LIBCFILE_OPEN_WRITE,
-	          &error );
-#else
-	result = libcfile_file_open(
-	          target_file,
-	          target,
-	          LIBCFILE_OPEN_WRITE,
-	          &error );
+	directory_descriptor = -1;
 #endif
- 	if( result != 1 )
+	if( range != NULL )
 	{
 		fprintf(
-		 stderr,
-		 "Unable to open target file.\n" );
-
-		goto on_error;
+		 stdout,
+		 "Number of created files\t\t: %" PRIu64 "\n",
+		 number_of_created_files );
 	}
-	/* Clean up
-	 */
-	if( libcfile_file_close(
-	     target_file,
-	     &error ) != 0 )
+	if( number_of_failed_conversions != 0 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to close target file.\n" );
-
-		goto on_error;
+		 "Unable to create Unicode character string of: %" PRIu64 " character values, first: U+%08" PRIx32 "\n",
+		 number_of_failed_conversions,
+		 first_failed_conversion );
 	}
-	if( libcfile_file_free(
-	     &target_file,
-	     &error ) != 1 )
+	if( number_of_failed_creations != 0 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to free target file.\n" );
-
-		goto on_error;
+		 "Unable to create target file of: %" PRIu64 " character values, first: U+%08" PRIx32 "\n",
+		 number_of_failed_creations,
+		 first_failed_creation );
+	}
+	if( ( number_of_failed_conversions != 0 )
+	 || ( number_of_failed_creations != 0 ) )
+	{
+		return( EXIT_FAILURE );
 	}
 	return( EXIT_SUCCESS );
 
@@ -270,12 +790,14 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( target_file != NULL )
+#if defined( UNICODETOUCH_HAVE_OPENAT )
+	if( ( directory_descriptor != -1 )
+	 && ( directory_descriptor != AT_FDCWD ) )
 	{
-		libcfile_file_free(
-		 &target_file,
-		 NULL );
+		close(
+		 directory_descriptor );
 	}
+#endif
 	return( EXIT_FAILURE );
 }
 
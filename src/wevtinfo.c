@@ -38,6 +38,7 @@
 #include "assorted_libfwevt.h"
 #include "assorted_libuna.h"
 #include "assorted_output.h"
+#include "wevtinfo_template_cache.h"
 
 /* Prints the executable usage information
  */
@@ -48,9 +49,10 @@ void usage_fprint(
 	{
 		return;
 	}
-	fprintf( stream, "Use wevtinfo to determine information about a Windows Event Log binary XML document file.\n\n" );
+	fprintf( stream, "Use wevtinfo to determine information about a Windows Event Template\n"
+	                 "(WEVT_TEMPLATE) resource or a Windows Event Log binary XML document file.\n\n" );
 
-	fprintf( stream, "Usage: wevtinfo [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: wevtinfo [ -o offset ] [ -s size ] [ -hvVx ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -59,9 +61,755 @@ void usage_fprint(
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-x:     the source is a binary XML document instead of\n"
+	                 "\t        a WEVT_TEMPLATE resource\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Prints the UTF-8 XML string of a XML document
+ * Returns 1 if successful or -1 on error
+ */
+int wevtinfo_xml_document_fprint(
+     FILE *stream,
+     libfwevt_xml_document_t *xml_document,
+     libcerror_error_t **error )
+{
+	uint8_t *xml_string    = NULL;
+	static char *function  = "wevtinfo_xml_document_fprint";
+	size_t xml_string_size = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_get_utf8_xml_string_size(
+	     xml_document,
+	     &xml_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 XML string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( xml_string_size == 0 )
+	 || ( xml_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 XML string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	xml_string = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * xml_string_size );
+
+	if( xml_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 XML string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_document_get_utf8_xml_string(
+	     xml_document,
+	     xml_string,
+	     xml_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 XML string.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 stream,
+	 "%s\n",
+	 (char *) xml_string );
+
+	memory_free(
+	 xml_string );
+
+	return( 1 );
+
+on_error:
+	if( xml_string != NULL )
+	{
+		memory_free(
+		 xml_string );
+	}
+	return( -1 );
+}
+
+/* Prints the XML of a template
+ * Returns 1 if successful or -1 on error
+ */
+int wevtinfo_template_fprint(
+     FILE *stream,
+     libfwevt_template_t *wevt_template,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_t *xml_document = NULL;
+	static char *function                 = "wevtinfo_template_fprint";
+
+	if( libfwevt_xml_document_initialize(
+	     &xml_document,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create XML document.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_template_read_xml_document(
+	     wevt_template,
+	     xml_document,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read template XML document.",
+		 function );
+
+		goto on_error;
+	}
+	if( wevtinfo_xml_document_fprint(
+	     stream,
+	     xml_document,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print template XML document.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_document_free(
+	     &xml_document,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free XML document.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the template of a provider at a specific offset
+ * The template is only rendered the first time it is referenced, the cache
+ * tracks the templates by provider and offset. A template that cannot be
+ * rendered is reported on stderr
+ * Returns 1 if the template was printed, 0 if the template was printed before
+ * or is not available or -1 on error
+ */
+int wevtinfo_provider_template_fprint(
+     FILE *stream,
+     libfwevt_provider_t *provider,
+     int provider_index,
+     uint32_t template_offset,
+     wevtinfo_template_cache_t *template_cache,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *template_error            = NULL;
+	libfwevt_template_t *wevt_template           = NULL;
+	wevtinfo_template_cache_entry_t *cache_entry = NULL;
+	static char *function                        = "wevtinfo_provider_template_fprint";
+	int result                                   = 0;
+
+	result = wevtinfo_template_cache_get_entry(
+	          template_cache,
+	          provider_index,
+	          template_offset,
+	          &cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 1 )
+	{
+		return( 0 );
+	}
+	result = libfwevt_provider_get_template_by_offset(
+	          provider,
+	          template_offset,
+	          &wevt_template,
+	          &template_error );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 stream,
+		 "Template at offset: 0x%08" PRIx32 "\n",
+		 template_offset );
+
+		result = wevtinfo_template_fprint(
+		          stream,
+		          wevt_template,
+		          &template_error );
+
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to render template at offset: 0x%08" PRIx32 ".\n",
+		 template_offset );
+
+		libcnotify_print_error_backtrace(
+		 template_error );
+		libcerror_error_free(
+		 &template_error );
+	}
+	cache_entry->result = result;
+
+	if( wevt_template != NULL )
+	{
+		if( libfwevt_template_free(
+		     &wevt_template,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Prints the events of a provider, followed by the templates that are not
+ * referenced by an event. The output is written while the provider is traversed
+ * Returns 1 if successful or -1 on error
+ */
+int wevtinfo_provider_fprint(
+     FILE *stream,
+     libfwevt_provider_t *provider,
+     int provider_index,
+     wevtinfo_template_cache_t *template_cache,
+     libcerror_error_t **error )
+{
+	libfwevt_event_t *event            = NULL;
+	libfwevt_template_t *wevt_template = NULL;
+	static char *function              = "wevtinfo_provider_fprint";
+	uint32_t event_identifier          = 0;
+	uint32_t message_identifier        = 0;
+	uint32_t template_offset           = 0;
+	int event_index                    = 0;
+	int number_of_events               = 0;
+	int number_of_templates            = 0;
+	int template_index                 = 0;
+
+	if( libfwevt_provider_get_number_of_events(
+	     provider,
+	     &number_of_events,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of events.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_provider_get_number_of_templates(
+	     provider,
+	     &number_of_templates,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of templates.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 stream,
+	 "Provider: %d\n",
+	 provider_index + 1 );
+
+	fprintf(
+	 stream,
+	 "\tNumber of events\t: %d\n",
+	 number_of_events );
+
+	fprintf(
+	 stream,
+	 "\tNumber of templates\t: %d\n",
+	 number_of_templates );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	for( event_index = 0;
+	     event_index < number_of_events;
+	     event_index++ )
+	{
+		if( libfwevt_provider_get_event(
+		     provider,
+		     event_index,
+		     &event,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		if( libfwevt_event_get_identifier(
+		     event,
+		     &event_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d identifier.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		if( libfwevt_event_get_message_identifier(
+		     event,
+		     &message_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d message identifier.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		if( libfwevt_event_get_template_offset(
+		     event,
+		     &template_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d template offset.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		if( libfwevt_event_free(
+		     &event,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free event: %d.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		fprintf(
+		 stream,
+		 "Event: %d\n",
+		 event_index + 1 );
+
+		fprintf(
+		 stream,
+		 "\tIdentifier\t\t: %" PRIu32 "\n",
+		 event_identifier );
+
+		fprintf(
+		 stream,
+		 "\tMessage identifier\t: 0x%08" PRIx32 "\n",
+		 message_identifier );
+
+		if( template_offset != 0 )
+		{
+			fprintf(
+			 stream,
+			 "\tTemplate offset\t\t: 0x%08" PRIx32 "\n",
+			 template_offset );
+		}
+		fprintf(
+		 stream,
+		 "\n" );
+
+		if( template_offset != 0 )
+		{
+			if( wevtinfo_provider_template_fprint(
+			     stream,
+			     provider,
+			     provider_index,
+			     template_offset,
+			     template_cache,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print template at offset: 0x%08" PRIx32 ".",
+				 function,
+				 template_offset );
+
+				goto on_error;
+			}
+		}
+	}
+	for( template_index = 0;
+	     template_index < number_of_templates;
+	     template_index++ )
+	{
+		if( libfwevt_provider_get_template(
+		     provider,
+		     template_index,
+		     &wevt_template,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template: %d.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+		if( libfwevt_template_get_offset(
+		     wevt_template,
+		     &template_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template: %d offset.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+		if( libfwevt_template_free(
+		     &wevt_template,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template: %d.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+		if( wevtinfo_provider_template_fprint(
+		     stream,
+		     provider,
+		     provider_index,
+		     template_offset,
+		     template_cache,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print template: %d.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( wevt_template != NULL )
+	{
+		libfwevt_template_free(
+		 &wevt_template,
+		 NULL );
+	}
+	if( event != NULL )
+	{
+		libfwevt_event_free(
+		 &event,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the providers of a WEVT_TEMPLATE resource
+ * Returns 1 if successful or -1 on error
+ */
+int wevtinfo_manifest_fprint(
+     FILE *stream,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_manifest_t *manifest             = NULL;
+	libfwevt_provider_t *provider             = NULL;
+	wevtinfo_template_cache_t *template_cache = NULL;
+	static char *function                     = "wevtinfo_manifest_fprint";
+	int number_of_providers                   = 0;
+	int provider_index                        = 0;
+
+	if( libfwevt_manifest_initialize(
+	     &manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_manifest_read(
+	     manifest,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_manifest_get_number_of_providers(
+	     manifest,
+	     &number_of_providers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of providers.",
+		 function );
+
+		goto on_error;
+	}
+	if( wevtinfo_template_cache_initialize(
+	     &template_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create template cache.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 stream,
+	 "Windows Event Template (WEVT_TEMPLATE) information:\n" );
+
+	fprintf(
+	 stream,
+	 "\tNumber of providers\t: %d\n",
+	 number_of_providers );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	for( provider_index = 0;
+	     provider_index < number_of_providers;
+	     provider_index++ )
+	{
+		if( libfwevt_manifest_get_provider_by_index(
+		     manifest,
+		     provider_index,
+		     &provider,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider: %d.",
+			 function,
+			 provider_index );
+
+			goto on_error;
+		}
+		if( wevtinfo_provider_fprint(
+		     stream,
+		     provider,
+		     provider_index,
+		     template_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print provider: %d.",
+			 function,
+			 provider_index );
+
+			goto on_error;
+		}
+		if( libfwevt_provider_free(
+		     &provider,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free provider: %d.",
+			 function,
+			 provider_index );
+
+			goto on_error;
+		}
+	}
+	if( wevtinfo_template_cache_free(
+	     &template_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free template cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_manifest_free(
+	     &manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free manifest.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( provider != NULL )
+	{
+		libfwevt_provider_free(
+		 &provider,
+		 NULL );
+	}
+	if( template_cache != NULL )
+	{
+		wevtinfo_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	if( manifest != NULL )
+	{
+		libfwevt_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -81,6 +829,7 @@ int main( int argc, char * const argv[] )
 	size_t buffer_size                    = 0;
 	ssize_t read_count                    = 0;
 	off_t source_offset                   = 0;
+	int is_xml_document                   = 0;
 	int result                            = 0;
 	int verbose                           = 0;
 
@@ -97,7 +846,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "ho:s:vVx" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -145,6 +894,11 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'x':
+				is_xml_document = 1;
+
+				break;
 		}
 	}
 	if( optind == argc )
@@ -258,16 +1012,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfwevt_xml_document_initialize(
-	     &xml_document,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create XML document.\n" );
-
-		goto on_error;
-	}
 	read_count = libcfile_file_read_buffer(
 		      source_file,
 		      buffer,
@@ -282,35 +1026,73 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfwevt_xml_document_read(
-	     xml_document,
-	     buffer,
-	     buffer_size,
-	     0,
-	     1252,
-	     LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
-	     &error ) != 1 )
+	if( is_xml_document == 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read XML document.\n" );
+		if( wevtinfo_manifest_fprint(
+		     stdout,
+		     buffer,
+		     buffer_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print WEVT_TEMPLATE resource.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-/* TODO print wevt info */
-
-	/* Clean up
-	 */
-	if( libfwevt_xml_document_free(
-	     &xml_document,
-	     &error ) != 1 )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to free XML document.\n" );
+		if( libfwevt_xml_document_initialize(
+		     &xml_document,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create XML document.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( libfwevt_xml_document_read(
+		     xml_document,
+		     buffer,
+		     buffer_size,
+		     0,
+		     1252,
+		     LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read XML document.\n" );
+
+			goto on_error;
+		}
+		if( wevtinfo_xml_document_fprint(
+		     stdout,
+		     xml_document,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print XML document.\n" );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_document_free(
+		     &xml_document,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free XML document.\n" );
+
+			goto on_error;
+		}
 	}
+
+	/* Clean up
+	 */
 	if( libcfile_file_close(
 	     source_file,
 	     &error ) != 0 )
@@ -0,0 +1,349 @@
+/*
+ * Wevtinfo template cache
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "wevtinfo_template_cache.h"
+
+/* Creates a template cache
+ * Make sure the value cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int wevtinfo_template_cache_initialize(
+     wevtinfo_template_cache_t **cache,
+     libcerror_error_t **error )
+{
+	static char *function = "wevtinfo_template_cache_initialize";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*cache = memory_allocate_structure(
+	          wevtinfo_template_cache_t );
+
+	if( *cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache,
+	     0,
+	     sizeof( wevtinfo_template_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *cache != NULL )
+	{
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a template cache
+ * Returns 1 if successful or -1 on error
+ */
+int wevtinfo_template_cache_free(
+     wevtinfo_template_cache_t **cache,
+     libcerror_error_t **error )
+{
+	static char *function = "wevtinfo_template_cache_free";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		if( ( *cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *cache )->entries );
+		}
+		if( ( *cache )->entry_table != NULL )
+		{
+			memory_free(
+			 ( *cache )->entry_table );
+		}
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the entry of a template, the entry is added if not present
+ * An added entry has a result of 0, the entry remains valid until the next
+ * entry is added
+ * Returns 1 if the entry was present, 0 if the entry was added or -1 on error
+ */
+int wevtinfo_template_cache_get_entry(
+     wevtinfo_template_cache_t *cache,
+     int provider_index,
+     uint32_t template_offset,
+     wevtinfo_template_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ 8 ];
+
+	wevtinfo_template_cache_entry_t *safe_entry = NULL;
+	void *reallocation                          = NULL;
+	int *entry_table                            = NULL;
+	static char *function                       = "wevtinfo_template_cache_get_entry";
+	size_t byte_index                           = 0;
+	uint32_t hash                               = 0x811c9dc5UL;
+	int entry_index                             = 0;
+	int number_of_allocated_entries             = 0;
+	int number_of_slots                         = 0;
+	int slot_index                              = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid provider index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entry table is kept at most half full
+	 */
+	if( ( cache->number_of_entries + 1 ) > ( cache->number_of_entry_table_slots / 2 ) )
+	{
+		if( cache->number_of_entry_table_slots > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entry table slots value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_slots = cache->number_of_entry_table_slots * 2;
+
+		if( number_of_slots == 0 )
+		{
+			number_of_slots = 256;
+		}
+		entry_table = (int *) memory_allocate(
+		                       sizeof( int ) * number_of_slots );
+
+		if( entry_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry table.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     entry_table,
+		     0,
+		     sizeof( int ) * number_of_slots ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry table.",
+			 function );
+
+			memory_free(
+			 entry_table );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < cache->number_of_entries;
+		     entry_index++ )
+		{
+			slot_index = (int) ( cache->entries[ entry_index ].hash & (uint32_t) ( number_of_slots - 1 ) );
+
+			while( entry_table[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+			}
+			entry_table[ slot_index ] = entry_index + 1;
+		}
+		if( cache->entry_table != NULL )
+		{
+			memory_free(
+			 cache->entry_table );
+		}
+		cache->entry_table                 = entry_table;
+		cache->number_of_entry_table_slots = number_of_slots;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key_data[ 0 ] ),
+	 (uint32_t) provider_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key_data[ 4 ] ),
+	 template_offset );
+
+	/* The hash is the 32-bit FNV-1a of the provider index and template offset
+	 */
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index++ )
+	{
+		hash ^= key_data[ byte_index ];
+		hash *= 0x01000193UL;
+	}
+	slot_index = (int) ( hash & (uint32_t) ( cache->number_of_entry_table_slots - 1 ) );
+
+	while( cache->entry_table[ slot_index ] != 0 )
+	{
+		entry_index = cache->entry_table[ slot_index ] - 1;
+
+		safe_entry = &( cache->entries[ entry_index ] );
+
+		if( ( safe_entry->hash == hash )
+		 && ( safe_entry->provider_index == provider_index )
+		 && ( safe_entry->template_offset == template_offset ) )
+		{
+			*entry = safe_entry;
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( cache->number_of_entry_table_slots - 1 );
+	}
+	if( cache->number_of_entries >= cache->number_of_allocated_entries )
+	{
+		number_of_allocated_entries = cache->number_of_allocated_entries * 2;
+
+		if( number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		reallocation = memory_reallocate(
+		                cache->entries,
+		                sizeof( wevtinfo_template_cache_entry_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		cache->entries                     = (wevtinfo_template_cache_entry_t *) reallocation;
+		cache->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	safe_entry = &( cache->entries[ cache->number_of_entries ] );
+
+	safe_entry->provider_index  = provider_index;
+	safe_entry->template_offset = template_offset;
+	safe_entry->hash            = hash;
+	safe_entry->result          = 0;
+
+	cache->entry_table[ slot_index ] = cache->number_of_entries + 1;
+
+	*entry = safe_entry;
+
+	cache->number_of_entries += 1;
+
+	return( 0 );
+}
+
@@ -0,0 +1,101 @@
+/*
+ * Wevtinfo template cache
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _WEVTINFO_TEMPLATE_CACHE_H )
+#define _WEVTINFO_TEMPLATE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct wevtinfo_template_cache_entry wevtinfo_template_cache_entry_t;
+
+struct wevtinfo_template_cache_entry
+{
+	/* The index of the provider
+	 */
+	int provider_index;
+
+	/* The offset of the template
+	 */
+	uint32_t template_offset;
+
+	/* The hash of the provider index and template offset
+	 */
+	uint32_t hash;
+
+	/* The result of rendering the template, 1 if rendered, 0 if not
+	 * available or -1 on error
+	 */
+	int result;
+};
+
+typedef struct wevtinfo_template_cache wevtinfo_template_cache_t;
+
+struct wevtinfo_template_cache
+{
+	/* The entries
+	 */
+	wevtinfo_template_cache_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The entry lookup table, contains the entry index + 1 or 0 if not set
+	 */
+	int *entry_table;
+
+	/* The number of slots in the entry lookup table, which is a power of 2
+	 */
+	int number_of_entry_table_slots;
+};
+
+int wevtinfo_template_cache_initialize(
+     wevtinfo_template_cache_t **cache,
+     libcerror_error_t **error );
+
+int wevtinfo_template_cache_free(
+     wevtinfo_template_cache_t **cache,
+     libcerror_error_t **error );
+
+int wevtinfo_template_cache_get_entry(
+     wevtinfo_template_cache_t *cache,
+     int provider_index,
+     uint32_t template_offset,
+     wevtinfo_template_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _WEVTINFO_TEMPLATE_CACHE_H ) */
+
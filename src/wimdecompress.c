@@ -0,0 +1,1003 @@
+/*
+ * Decompresses the resources of a Windows Imaging (WIM) file
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_memory_map.h"
+#include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "assorted_wim_resource.h"
+
+#define WIMDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS		64
+
+#define WIMDECOMPRESS_FILE_HEADER_SIZE			204
+
+#define WIMDECOMPRESS_LOOKUP_TABLE_ENTRY_SIZE		50
+
+#define WIMDECOMPRESS_FILE_FLAG_COMPRESSION		0x00000002UL
+#define WIMDECOMPRESS_FILE_FLAG_COMPRESS_XPRESS		0x00020000UL
+#define WIMDECOMPRESS_FILE_FLAG_COMPRESS_LZX		0x00040000UL
+
+#define WIMDECOMPRESS_RESOURCE_FLAG_FREE		0x01
+#define WIMDECOMPRESS_RESOURCE_FLAG_COMPRESSED		0x04
+#define WIMDECOMPRESS_RESOURCE_FLAG_SPANNED		0x08
+
+typedef struct wimdecompress_resource wimdecompress_resource_t;
+
+struct wimdecompress_resource
+{
+	/* The (stored) size
+	 */
+	size64_t size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The uncompressed (original) size
+	 */
+	size64_t uncompressed_size;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use wimdecompress to decompress the resources of a Windows Imaging\n"
+	                 "(WIM) file.\n\n" );
+
+	fprintf( stream, "Usage: wimdecompress [ -i index ] [ -p prefix ] [ -j number_of_threads ]\n"
+	                 "                     [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     only decompress the resource with the lookup table index\n" );
+	fprintf( stream, "\t-j:     number of threads used to decompress the chunks of\n"
+	                 "\t        a resource (default is 1)\n" );
+	fprintf( stream, "\t-p:     write every uncompressed resource to a separate file\n"
+	                 "\t        named: prefix.<lookup table index> (default is source)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Reads a resource header (RESHDR_DISK_SHORT)
+ */
+void wimdecompress_resource_read_data(
+      wimdecompress_resource_t *resource,
+      const uint8_t *data )
+{
+	byte_stream_copy_to_uint64_little_endian(
+	 data,
+	 resource->size );
+
+	resource->flags = (uint8_t) ( resource->size >> 56 );
+	resource->size &= 0x00ffffffffffffffULL;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 resource->offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 resource->uncompressed_size );
+}
+
+/* Retrieves data from the source
+ * If the source is memory mapped data points into the memory map otherwise
+ * the data is read into data buffer, which must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int wimdecompress_get_data(
+     assorted_memory_map_t *memory_map,
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     off64_t offset,
+     size64_t size,
+     const uint8_t **data,
+     uint8_t **data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "wimdecompress_get_data";
+	ssize_t read_count    = 0;
+
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > source_size )
+	 || ( size > ( source_size - (size64_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range exceeds source size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file == NULL )
+	{
+		*data = &( memory_map->data[ offset ] );
+
+		return( 1 );
+	}
+	*data_buffer = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * (size_t) size );
+
+	if( *data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_seek_offset(
+	     source_file,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              source_file,
+	              *data_buffer,
+	              (size_t) size,
+	              error );
+
+	if( read_count != (ssize_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	*data = *data_buffer;
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 *data_buffer );
+
+	*data_buffer = NULL;
+
+	return( -1 );
+}
+
+/* Decompresses a resource into a newly allocated buffer
+ * Returns 1 if successful or -1 on error
+ */
+int wimdecompress_decompress_resource(
+     assorted_memory_map_t *memory_map,
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     wimdecompress_resource_t *resource,
+     int compression_method,
+     int number_of_threads,
+     uint8_t **uncompressed_data,
+     libcerror_error_t **error )
+{
+	const uint8_t *resource_data = NULL;
+	uint8_t *resource_buffer     = NULL;
+	static char *function        = "wimdecompress_decompress_resource";
+
+	if( resource->uncompressed_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid resource uncompressed size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( resource->flags & WIMDECOMPRESS_RESOURCE_FLAG_COMPRESSED ) == 0 )
+	 && ( resource->size != resource->uncompressed_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed resource size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( wimdecompress_get_data(
+	     memory_map,
+	     source_file,
+	     source_size,
+	     resource->offset,
+	     resource->size,
+	     &resource_data,
+	     &resource_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The uncompressed data is allocated once at its final size
+	 * so that the chunks can be decompressed into it in parallel
+	 */
+	*uncompressed_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * ( (size_t) resource->uncompressed_size + 1 ) );
+
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( resource->flags & WIMDECOMPRESS_RESOURCE_FLAG_COMPRESSED ) == 0 )
+	{
+		if( memory_copy(
+		     *uncompressed_data,
+		     resource_data,
+		     (size_t) resource->uncompressed_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy resource data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( assorted_wim_resource_decompress(
+	          resource_data,
+	          (size_t) resource->size,
+	          compression_method,
+	          *uncompressed_data,
+	          (size_t) resource->uncompressed_size,
+	          number_of_threads,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress resource data.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_buffer != NULL )
+	{
+		memory_free(
+		 resource_buffer );
+	}
+	return( 1 );
+
+on_error:
+	if( *uncompressed_data != NULL )
+	{
+		memory_free(
+		 *uncompressed_data );
+
+		*uncompressed_data = NULL;
+	}
+	if( resource_buffer != NULL )
+	{
+		memory_free(
+		 resource_buffer );
+	}
+	return( -1 );
+}
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int wimdecompress_write_output(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *output_file = NULL;
+	static char *function        = "wimdecompress_write_output";
+	ssize_t write_count          = 0;
+
+	if( libcfile_file_initialize(
+	     &output_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_open(
+	     output_file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               output_file,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     output_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &output_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( output_file != NULL )
+	{
+		libcfile_file_free(
+		 &output_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	char destination[ 256 ];
+
+	wimdecompress_resource_t lookup_table_resource;
+	wimdecompress_resource_t resource;
+
+	assorted_memory_map_t *memory_map         = NULL;
+	libcerror_error_t *error                  = NULL;
+	libcfile_file_t *source_file              = NULL;
+	system_character_t *option_index          = NULL;
+	system_character_t *source                = NULL;
+	const uint8_t *file_header_data           = NULL;
+	const char *prefix                        = NULL;
+	char *program                             = "wimdecompress";
+	uint8_t *file_header_buffer               = NULL;
+	uint8_t *lookup_table_data                = NULL;
+	uint8_t *uncompressed_data                = NULL;
+	system_integer_t option                   = 0;
+	size64_t source_size                      = 0;
+	size64_t total_uncompressed_size          = 0;
+	size_t number_of_entries                  = 0;
+	size_t entry_index                        = 0;
+	uint32_t file_flags                       = 0;
+	uint16_t part_number                      = 0;
+	uint16_t segment_number                   = 0;
+	int compression_method                    = ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_NONE;
+	int number_of_decompressed_resources      = 0;
+	int number_of_failed_resources            = 0;
+	int number_of_threads                     = 1;
+	int print_count                           = 0;
+	int result                                = 0;
+	int resource_index                        = -1;
+	int verbose                               = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:j:p:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'i':
+				option_index = optarg;
+
+				break;
+
+			case 'p':
+				prefix = (const char *) optarg;
+
+				break;
+
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( prefix == NULL )
+	{
+		prefix = (const char *) source;
+	}
+	if( option_index != NULL )
+	{
+		resource_index = (int) system_string_copy_to_long( option_index );
+
+		if( resource_index < 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid index value out of bounds.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > WIMDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	/* The source stays open for all resources, it is memory mapped if supported
+	 * otherwise the data of every resource is read
+	 */
+	if( assorted_memory_map_initialize(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create memory map.\n" );
+
+		goto on_error;
+	}
+	result = assorted_memory_map_open(
+	          memory_map,
+	          source,
+	          0,
+	          0,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open memory map.\n" );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		source_size = (size64_t) memory_map->data_size;
+	}
+	else
+	{
+		if( libcfile_file_initialize(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create source file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#endif
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( wimdecompress_get_data(
+	     memory_map,
+	     source_file,
+	     source_size,
+	     0,
+	     WIMDECOMPRESS_FILE_HEADER_SIZE,
+	     &file_header_data,
+	     &file_header_buffer,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read file header.\n" );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header_data,
+	     "MSWIM\x00\x00\x00",
+	     8 ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported file signature.\n" );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_header_data[ 16 ] ),
+	 file_flags );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( file_header_data[ 40 ] ),
+	 segment_number );
+
+	wimdecompress_resource_read_data(
+	 &lookup_table_resource,
+	 &( file_header_data[ 48 ] ) );
+
+	if( file_header_buffer != NULL )
+	{
+		memory_free(
+		 file_header_buffer );
+
+		file_header_buffer = NULL;
+	}
+	file_header_data = NULL;
+
+	if( ( file_flags & WIMDECOMPRESS_FILE_FLAG_COMPRESSION ) != 0 )
+	{
+		if( ( file_flags & WIMDECOMPRESS_FILE_FLAG_COMPRESS_LZX ) != 0 )
+		{
+			compression_method = ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_LZX;
+		}
+		else if( ( file_flags & WIMDECOMPRESS_FILE_FLAG_COMPRESS_XPRESS ) != 0 )
+		{
+			compression_method = ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS;
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported compression method in file flags: 0x%08" PRIx32 ".\n",
+			 file_flags );
+
+			goto on_error;
+		}
+	}
+	if( ( ( lookup_table_resource.flags & WIMDECOMPRESS_RESOURCE_FLAG_COMPRESSED ) != 0 )
+	 && ( compression_method == ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_NONE ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid compressed lookup table in uncompressed file.\n" );
+
+		goto on_error;
+	}
+	if( wimdecompress_decompress_resource(
+	     memory_map,
+	     source_file,
+	     source_size,
+	     &lookup_table_resource,
+	     compression_method,
+	     number_of_threads,
+	     &lookup_table_data,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read lookup table.\n" );
+
+		goto on_error;
+	}
+	number_of_entries = (size_t) lookup_table_resource.uncompressed_size / WIMDECOMPRESS_LOOKUP_TABLE_ENTRY_SIZE;
+
+	if( ( resource_index >= 0 )
+	 && ( (size_t) resource_index >= number_of_entries ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid index value out of bounds.\n" );
+
+		goto on_error;
+	}
+	/* The resources are decompressed one at a time, the chunks of
+	 * a resource are decompressed in parallel
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( ( resource_index >= 0 )
+		 && ( entry_index != (size_t) resource_index ) )
+		{
+			continue;
+		}
+		wimdecompress_resource_read_data(
+		 &resource,
+		 &( lookup_table_data[ entry_index * WIMDECOMPRESS_LOOKUP_TABLE_ENTRY_SIZE ] ) );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( lookup_table_data[ ( entry_index * WIMDECOMPRESS_LOOKUP_TABLE_ENTRY_SIZE ) + 24 ] ),
+		 part_number );
+
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Resource: %" PRIzd " at offset: %" PRIi64 " of size: %" PRIu64 " uncompressed size: %" PRIu64 " flags: 0x%02" PRIx8 " part: %" PRIu16 "\n",
+			 entry_index,
+			 resource.offset,
+			 resource.size,
+			 resource.uncompressed_size,
+			 resource.flags,
+			 part_number );
+		}
+		/* Resources that are free or stored in another part of a spanned set are skipped
+		 */
+		if( ( ( resource.flags & WIMDECOMPRESS_RESOURCE_FLAG_FREE ) != 0 )
+		 || ( part_number != segment_number ) )
+		{
+			continue;
+		}
+		if( ( ( resource.flags & WIMDECOMPRESS_RESOURCE_FLAG_SPANNED ) != 0 )
+		 || ( ( ( resource.flags & WIMDECOMPRESS_RESOURCE_FLAG_COMPRESSED ) != 0 )
+		  && ( compression_method == ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_NONE ) ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported resource: %" PRIzd " with flags: 0x%02" PRIx8 ".\n",
+			 entry_index,
+			 resource.flags );
+
+			number_of_failed_resources++;
+
+			continue;
+		}
+		if( wimdecompress_decompress_resource(
+		     memory_map,
+		     source_file,
+		     source_size,
+		     &resource,
+		     compression_method,
+		     number_of_threads,
+		     &uncompressed_data,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress resource: %" PRIzd " at offset: %" PRIi64 ".\n",
+			 entry_index,
+			 resource.offset );
+
+			if( verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+			libcerror_error_free(
+			 &error );
+
+			number_of_failed_resources++;
+
+			continue;
+		}
+		print_count = narrow_string_snprintf(
+		               destination,
+		               256,
+		               "%s.%" PRIzd "",
+		               prefix,
+		               entry_index );
+
+		if( ( print_count < 0 )
+		 || ( print_count > 256 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output filename.\n" );
+
+			goto on_error;
+		}
+		if( wimdecompress_write_output(
+		     destination,
+		     uncompressed_data,
+		     (size_t) resource.uncompressed_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write output file.\n" );
+
+			goto on_error;
+		}
+		memory_free(
+		 uncompressed_data );
+
+		uncompressed_data = NULL;
+
+		total_uncompressed_size += resource.uncompressed_size;
+
+		number_of_decompressed_resources++;
+	}
+	fprintf(
+	 stdout,
+	 "Decompressed %d resources into %" PRIu64 " bytes.\n",
+	 number_of_decompressed_resources,
+	 total_uncompressed_size );
+
+	/* Clean up
+	 */
+	memory_free(
+	 lookup_table_data );
+
+	lookup_table_data = NULL;
+
+	if( source_file != NULL )
+	{
+		if( libcfile_file_close(
+		     source_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( assorted_memory_map_free(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free memory map.\n" );
+
+		goto on_error;
+	}
+	if( number_of_failed_resources > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to decompress %d resources.\n",
+		 number_of_failed_resources );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( lookup_table_data != NULL )
+	{
+		memory_free(
+		 lookup_table_data );
+	}
+	if( file_header_buffer != NULL )
+	{
+		memory_free(
+		 file_header_buffer );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
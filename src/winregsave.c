@@ -33,11 +33,26 @@
 #include <winreg.h>
 #endif
 
+#include "assorted_crc32.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libhmac.h"
 #include "assorted_output.h"
+#include "digest_hash.h"
+
+/* The size of the buffer used to hash a saved hive file
+ */
+#define WINREGSAVE_HASH_BUFFER_SIZE		( 1024 * 1024 )
+
+/* The maximum size of a line in a key list
+ */
+#define WINREGSAVE_MAXIMUM_LINE_SIZE		4096
+
+/* The size of the MD5 hash string including the end-of-string character
+ */
+#define WINREGSAVE_MD5_HASH_STRING_SIZE		33
 
 /* Prints the executable usage information
  */
@@ -50,136 +65,295 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use winregsave to save a Windows Registry key to a Registry hive file.\n\n" );
 
-	fprintf( stream, "Usage: winregsave [ -12hvV ] key_path target\n\n" );
+	fprintf( stream, "Usage: winregsave [ -f key_list ] [ -12hvV ] [ key_path target ... ]\n\n" );
 
-	fprintf( stream, "\tkey_path: the path of the Windows Registry key.\n" );
+	fprintf( stream, "\tkey_path: the path of the Windows Registry key, for example:\n"
+	                 "\t          HKEY_LOCAL_MACHINE\\SOFTWARE or HKLM\\SOFTWARE\n" );
 	fprintf( stream, "\ttarget:   specify the target file to write the output data.\n\n" );
 
 	fprintf( stream, "\t-1:       write output in REG_STANDARD_FORMAT (default)\n" );
 	fprintf( stream, "\t-2:       write output in REG_LATEST_FORMAT\n" );
+	fprintf( stream, "\t-f:       file with a key path and target per line, separated\n"
+	                 "\t          by a tab\n" );
 	fprintf( stream, "\t-h:       shows this help\n" );
 	fprintf( stream, "\t-v:       verbose output to stderr\n" );
 	fprintf( stream, "\t-V:       print version\n" );
 	fprintf( stream, "\n" );
 }
 
-/* The main program
+/* Calculates the CRC-32 and MD5 of a file in a single pass
+ * Returns 1 if successful or -1 on error
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain( int argc, wchar_t * const argv[] )
-#else
-int main( int argc, char * const argv[] )
-#endif
+int winregsave_hash_file(
+     const system_character_t *filename,
+     uint32_t *crc32,
+     uint8_t *md5_hash,
+     size_t md5_hash_size,
+     libcerror_error_t **error )
 {
-	libcerror_error_t *error           = NULL;
-	system_character_t *key_path       = NULL;
-	system_character_t *options_string = NULL;
-	system_character_t *target_path    = NULL;
-	char *program                      = "winregsave";
-	system_integer_t option            = 0;
-	int verbose                        = 0;
+	libcfile_file_t *file              = NULL;
+	libhmac_md5_context_t *md5_context = NULL;
+	uint8_t *buffer                    = NULL;
+	static char *function              = "winregsave_hash_file";
+	ssize_t read_count                 = 0;
+	uint32_t safe_crc32                = 0;
+	int result                         = 0;
 
-#if defined( WINAPI )
-	TOKEN_PRIVILEGES priviledges_token;
-	LUID local_identifier;
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
 
-	HANDLE process_handle              = NULL;
-	HANDLE process_token               = NULL;
-	HKEY key_handle                    = NULL;
-	DWORD disposition                  = 0;
-	DWORD process_identifier           = 0;
-	DWORD save_key_flags               = REG_STANDARD_FORMAT;
-	LONG result                        = 0;
-#endif
+		return( -1 );
+	}
+	if( md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
+		 function );
 
-	assorted_output_version_fprint(
-	 stdout,
-	 program );
+		return( -1 );
+	}
+	if( md5_hash_size < LIBHMAC_MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid MD5 hash size value too small.",
+		 function );
 
-	options_string = _SYSTEM_STRING( "12hvV" );
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * WINREGSAVE_HASH_BUFFER_SIZE );
 
-	while( ( option = assorted_getopt(
-	                   argc,
-	                   argv,
-	                   options_string ) ) != (system_integer_t) -1 )
+	if( buffer == NULL )
 	{
-		switch( option )
-		{
-			case (system_integer_t) '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM "\n",
-				 argv[ optind ] );
-
-				usage_fprint(
-				 stdout );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
 
-				return( EXIT_FAILURE );
+		goto on_error;
+	}
+	if( libhmac_md5_initialize(
+	     &md5_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize MD5 context.",
+		 function );
 
-			case (system_integer_t) '1':
-#if defined( WINAPI )
-				save_key_flags = REG_STANDARD_FORMAT;
-#endif
-				break;
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
 
-			case (system_integer_t) '2':
-#if defined( WINAPI )
-				save_key_flags = REG_LATEST_FORMAT;
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
 #endif
-				break;
-
-			case (system_integer_t) 'h':
-				usage_fprint(
-				 stdout );
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
 
-				return( EXIT_SUCCESS );
+		goto on_error;
+	}
+	do
+	{
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              buffer,
+		              WINREGSAVE_HASH_BUFFER_SIZE,
+		              error );
 
-			case (system_integer_t) 'v':
-				verbose = 1;
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from file.",
+			 function );
 
-				break;
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		if( assorted_crc32_calculate_with_polynomial(
+		     &safe_crc32,
+		     buffer,
+		     (size_t) read_count,
+		     safe_crc32,
+		     0,
+		     0xedb88320UL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate CRC-32.",
+			 function );
 
-			case (system_integer_t) 'V':
-				assorted_output_copyright_fprint(
-				 stdout );
+			goto on_error;
+		}
+		if( libhmac_md5_update(
+		     md5_context,
+		     buffer,
+		     (size_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5.",
+			 function );
 
-				return( EXIT_SUCCESS );
+			goto on_error;
 		}
 	}
-	if( optind == argc )
-	{
-		fprintf(
-		 stderr,
-		 "Missing key path.\n" );
+	while( read_count > 0 );
 
-		usage_fprint(
-		 stdout );
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	key_path = argv[ optind++ ];
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
 
-	if( optind == argc )
+		goto on_error;
+	}
+	if( libhmac_md5_finalize(
+	     md5_context,
+	     md5_hash,
+	     md5_hash_size,
+	     error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Missing target file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize MD5.",
+		 function );
 
-		usage_fprint(
-		 stdout );
+		goto on_error;
+	}
+	if( libhmac_md5_free(
+	     &md5_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free MD5 context.",
+		 function );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	target_path = argv[ optind ];
+	memory_free(
+	 buffer );
 
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-	libcnotify_verbose_set(
-	 verbose );
+	*crc32 = safe_crc32;
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	if( md5_context != NULL )
+	{
+		libhmac_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
 
 #if defined( WINAPI )
+
+/* Enables the SE_BACKUP_NAME privilege of the process
+ * Returns 1 if successful or -1 on error
+ */
+int winregsave_enable_backup_privilege(
+     libcerror_error_t **error )
+{
+	TOKEN_PRIVILEGES priviledges_token;
+	LUID local_identifier;
+
+	HANDLE process_handle    = NULL;
+	HANDLE process_token     = NULL;
+	DWORD process_identifier = 0;
+	LONG result              = 0;
+
 	process_identifier = GetCurrentProcessId();
 
 	process_handle = OpenProcess(
@@ -192,7 +366,7 @@ int main( int argc, char * const argv[] )
 		result = GetLastError();
 
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
@@ -208,7 +382,7 @@ int main( int argc, char * const argv[] )
 		result = GetLastError();
 
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
@@ -216,7 +390,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Need SE_BACKUP_NAME priviledge to open key with REG_OPTION_BACKUP_RESTORE
+	/* Need SE_BACKUP_NAME priviledge to save a key
 	 */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( LookupPrivilegeValueW(
@@ -233,7 +407,7 @@ int main( int argc, char * const argv[] )
 		result = GetLastError();
 
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
@@ -256,7 +430,7 @@ int main( int argc, char * const argv[] )
 		result = GetLastError();
 
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
@@ -264,37 +438,201 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( CloseHandle(
+	     process_token ) == FALSE )
+	{
+		result = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "unable to close process token." );
+
+		goto on_error;
+	}
+	process_token = NULL;
+
+	if( CloseHandle(
+	     process_handle ) == FALSE )
+	{
+		result = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "unable to close process handle." );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( process_token != NULL )
+	{
+		CloseHandle(
+		 process_token );
+	}
+	if( process_handle != NULL )
+	{
+		CloseHandle(
+		 process_handle );
+	}
+	return( -1 );
+}
+
+/* Saves a key to a hive file
+ * The key path starts with the name of a root key such as HKEY_LOCAL_MACHINE or HKLM
+ * Returns 1 if successful or -1 on error
+ */
+int winregsave_save_key(
+     const system_character_t *key_path,
+     const system_character_t *target_path,
+     DWORD save_key_flags,
+     libcerror_error_t **error )
+{
+	const system_character_t *sub_key_path = NULL;
+	static char *function                  = "winregsave_save_key";
+	HKEY key_handle                        = NULL;
+	HKEY root_key_handle                   = NULL;
+	LONG result                            = 0;
+	size_t key_path_index                  = 0;
+	size_t key_path_length                 = 0;
+
+	if( key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path.",
+		 function );
+
+		return( -1 );
+	}
+	key_path_length = system_string_length(
+	                   key_path );
+
+	for( key_path_index = 0;
+	     key_path_index < key_path_length;
+	     key_path_index++ )
+	{
+		if( key_path[ key_path_index ] == (system_character_t) '\\' )
+		{
+			break;
+		}
+	}
+	if( ( ( key_path_index == 18 )
+	  &&  ( system_string_compare_no_case(
+	         key_path,
+	         _SYSTEM_STRING( "HKEY_LOCAL_MACHINE" ),
+	         18 ) == 0 ) )
+	 || ( ( key_path_index == 4 )
+	  &&  ( system_string_compare_no_case(
+	         key_path,
+	         _SYSTEM_STRING( "HKLM" ),
+	         4 ) == 0 ) ) )
+	{
+		root_key_handle = HKEY_LOCAL_MACHINE;
+	}
+	else if( ( ( key_path_index == 17 )
+	       &&  ( system_string_compare_no_case(
+	              key_path,
+	              _SYSTEM_STRING( "HKEY_CURRENT_USER" ),
+	              17 ) == 0 ) )
+	      || ( ( key_path_index == 4 )
+	       &&  ( system_string_compare_no_case(
+	              key_path,
+	              _SYSTEM_STRING( "HKCU" ),
+	              4 ) == 0 ) ) )
+	{
+		root_key_handle = HKEY_CURRENT_USER;
+	}
+	else if( ( ( key_path_index == 10 )
+	       &&  ( system_string_compare_no_case(
+	              key_path,
+	              _SYSTEM_STRING( "HKEY_USERS" ),
+	              10 ) == 0 ) )
+	      || ( ( key_path_index == 3 )
+	       &&  ( system_string_compare_no_case(
+	              key_path,
+	              _SYSTEM_STRING( "HKU" ),
+	              3 ) == 0 ) ) )
+	{
+		root_key_handle = HKEY_USERS;
+	}
+	else if( ( ( key_path_index == 17 )
+	       &&  ( system_string_compare_no_case(
+	              key_path,
+	              _SYSTEM_STRING( "HKEY_CLASSES_ROOT" ),
+	              17 ) == 0 ) )
+	      || ( ( key_path_index == 4 )
+	       &&  ( system_string_compare_no_case(
+	              key_path,
+	              _SYSTEM_STRING( "HKCR" ),
+	              4 ) == 0 ) ) )
+	{
+		root_key_handle = HKEY_CLASSES_ROOT;
+	}
+	else if( ( ( key_path_index == 19 )
+	       &&  ( system_string_compare_no_case(
+	              key_path,
+	              _SYSTEM_STRING( "HKEY_CURRENT_CONFIG" ),
+	              19 ) == 0 ) )
+	      || ( ( key_path_index == 4 )
+	       &&  ( system_string_compare_no_case(
+	              key_path,
+	              _SYSTEM_STRING( "HKCC" ),
+	              4 ) == 0 ) ) )
+	{
+		root_key_handle = HKEY_CURRENT_CONFIG;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported root key in key path: %" PRIs_SYSTEM ".",
+		 function,
+		 key_path );
+
+		return( -1 );
+	}
+	if( key_path_index < key_path_length )
+	{
+		sub_key_path = &( key_path[ key_path_index + 1 ] );
+	}
+	/* The key is opened instead of created so a missing key is reported
+	 */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = RegCreateKeyExW(
-	          HKEY_CURRENT_USER,
-	          L"TestKey",
+	result = RegOpenKeyExW(
+	          root_key_handle,
+	          sub_key_path,
 	          0,
-	          NULL,
-	          REG_OPTION_BACKUP_RESTORE,
-	          KEY_READ | ACCESS_SYSTEM_SECURITY,
-	          NULL,
-	          &key_handle,
-	          &disposition );
+	          KEY_READ,
+	          &key_handle );
 #else
-	result = RegCreateKeyExA(
-	          HKEY_CURRENT_USER,
-	          "TestKey",
+	result = RegOpenKeyExA(
+	          root_key_handle,
+	          sub_key_path,
 	          0,
-	          NULL,
-	          REG_OPTION_BACKUP_RESTORE,
-	          KEY_READ | ACCESS_SYSTEM_SECURITY,
-	          NULL,
-	          &key_handle,
-	          &disposition );
+	          KEY_READ,
+	          &key_handle );
 #endif
 	if( result != ERROR_SUCCESS )
 	{
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
-		 "unable to open key." );
+		 "%s: unable to open key: %" PRIs_SYSTEM ".",
+		 function,
+		 key_path );
 
 		goto on_error;
 	}
@@ -314,60 +652,452 @@ int main( int argc, char * const argv[] )
 	if( result != ERROR_SUCCESS )
 	{
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
-		 "unable to save key to file." );
+		 "%s: unable to save key to file: %" PRIs_SYSTEM ".",
+		 function,
+		 target_path );
 
 		goto on_error;
 	}
 	result = RegCloseKey(
 	          key_handle );
 
+	key_handle = NULL;
+
 	if( result != ERROR_SUCCESS )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to close key.\n" );
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "%s: unable to close key.",
+		 function );
 
 		goto on_error;
 	}
-	key_handle = NULL;
+	return( 1 );
 
-	if( CloseHandle(
-	     process_token ) == FALSE )
+on_error:
+	if( key_handle != NULL )
 	{
-		result = GetLastError();
+		RegCloseKey(
+		 key_handle );
+	}
+	return( -1 );
+}
 
-		libcerror_system_set_error(
-		 &error,
+#endif /* defined( WINAPI ) */
+
+/* Saves a key to a hive file and prints the CRC-32 and MD5 of the hive file
+ * The hive file is hashed directly after it was saved, while its data is still cached
+ * Returns 1 if successful or -1 on error
+ */
+int winregsave_save_key_with_hash(
+     const system_character_t *key_path,
+     const system_character_t *target_path,
+     uint32_t save_key_flags,
+     libcerror_error_t **error )
+{
+	system_character_t md5_hash_string[ WINREGSAVE_MD5_HASH_STRING_SIZE ];
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	static char *function = "winregsave_save_key_with_hash";
+	uint32_t crc32        = 0;
+
+#if defined( WINAPI )
+	if( winregsave_save_key(
+	     key_path,
+	     target_path,
+	     (DWORD) save_key_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 (uint32_t) result,
-		 "unable to close process token." );
+		 "%s: unable to save key.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	process_token = NULL;
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: saving a key requires WINAPI.",
+	 function );
 
-	if( CloseHandle(
-	     process_handle ) == FALSE )
+	return( -1 );
+#endif
+	if( winregsave_hash_file(
+	     target_path,
+	     &crc32,
+	     md5_hash,
+	     LIBHMAC_MD5_HASH_SIZE,
+	     error ) != 1 )
 	{
-		result = GetLastError();
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to hash file: %" PRIs_SYSTEM ".",
+		 function,
+		 target_path );
 
-		libcerror_system_set_error(
-		 &error,
+		return( -1 );
+	}
+	if( digest_hash_copy_to_string(
+	     md5_hash,
+	     LIBHMAC_MD5_HASH_SIZE,
+	     md5_hash_string,
+	     WINREGSAVE_MD5_HASH_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 (uint32_t) result,
-		 "unable to close process handle." );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set MD5 hash string.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stdout,
+	 "%" PRIs_SYSTEM "\t%" PRIs_SYSTEM "\t%08" PRIx32 "\t%" PRIs_SYSTEM "\n",
+	 key_path,
+	 target_path,
+	 crc32,
+	 md5_hash_string );
+
+	return( 1 );
+}
+
+/* Saves the keys in a key list, which contains a key path and target per line
+ * separated by a tab, empty lines are ignored
+ * Keys that cannot be saved are reported on stderr and counted
+ * Returns 1 if successful or -1 on error
+ */
+int winregsave_save_keys_from_file(
+     const system_character_t *filename,
+     uint32_t save_key_flags,
+     int *number_of_failed_keys,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *key_error = NULL;
+	system_character_t *line     = NULL;
+	FILE *key_list_stream        = NULL;
+	static char *function        = "winregsave_save_keys_from_file";
+	size_t line_length           = 0;
+	size_t line_number           = 0;
+	size_t separator_index       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_failed_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of failed keys.",
+		 function );
+
+		return( -1 );
+	}
+	line = system_string_allocate(
+	        WINREGSAVE_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	key_list_stream = file_stream_open_wide(
+	                   filename,
+	                   _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	key_list_stream = file_stream_open(
+	                   filename,
+	                   FILE_STREAM_OPEN_READ );
+#endif
+	if( key_list_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open key list: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
 
 		goto on_error;
 	}
-	process_handle = NULL;
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        key_list_stream,
+	        line,
+	        WINREGSAVE_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        key_list_stream,
+	        line,
+	        WINREGSAVE_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
 
-	return( EXIT_SUCCESS );
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( WINREGSAVE_MAXIMUM_LINE_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %" PRIzd " value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length--;
+		}
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		line[ line_length ] = 0;
+
+		for( separator_index = 0;
+		     separator_index < line_length;
+		     separator_index++ )
+		{
+			if( line[ separator_index ] == (system_character_t) '\t' )
+			{
+				break;
+			}
+		}
+		if( ( separator_index == 0 )
+		 || ( ( separator_index + 1 ) >= line_length ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		line[ separator_index ] = 0;
+
+		if( winregsave_save_key_with_hash(
+		     line,
+		     &( line[ separator_index + 1 ] ),
+		     save_key_flags,
+		     &key_error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to save key: %" PRIs_SYSTEM ".\n",
+			 line );
+
+			libcnotify_print_error_backtrace(
+			 key_error );
+			libcerror_error_free(
+			 &key_error );
+
+			*number_of_failed_keys += 1;
+		}
+	}
+	if( file_stream_close(
+	     key_list_stream ) != 0 )
+	{
+		key_list_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close key list.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( key_list_stream != NULL )
+	{
+		file_stream_close(
+		 key_list_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error           = NULL;
+	system_character_t *key_list       = NULL;
+	system_character_t *options_string = NULL;
+	char *program                      = "winregsave";
+	system_integer_t option            = 0;
+	uint32_t save_key_flags            = 1;
+	int argument_index                 = 0;
+	int number_of_failed_keys          = 0;
+	int verbose                        = 0;
+
+#if defined( WINAPI )
+	save_key_flags = (uint32_t) REG_STANDARD_FORMAT;
+#endif
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	options_string = _SYSTEM_STRING( "12f:hvV" );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) '1':
+#if defined( WINAPI )
+				save_key_flags = (uint32_t) REG_STANDARD_FORMAT;
+#endif
+				break;
+
+			case (system_integer_t) '2':
+#if defined( WINAPI )
+				save_key_flags = (uint32_t) REG_LATEST_FORMAT;
+#endif
+				break;
+
+			case (system_integer_t) 'f':
+				key_list = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( optind == argc )
+	 && ( key_list == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing key path.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( ( argc - optind ) % 2 ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+#if defined( WINAPI )
+	/* The privilege is enabled once for all keys
+	 */
+	if( winregsave_enable_backup_privilege(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to enable backup privilege.\n" );
+
+		goto on_error;
+	}
 #else
 	fprintf(
 	 stderr,
@@ -377,31 +1107,64 @@ int main( int argc, char * const argv[] )
 
 #endif /* defined( WINAPI ) */
 
-on_error:
-	if( error != NULL )
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index += 2 )
 	{
-		libcnotify_print_error_backtrace(
-		 error );
-		libcerror_error_free(
-		 &error );
+		if( winregsave_save_key_with_hash(
+		     argv[ argument_index ],
+		     argv[ argument_index + 1 ],
+		     save_key_flags,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to save key: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			number_of_failed_keys++;
+		}
 	}
-#if defined( WINAPI )
-	if( key_handle != NULL )
+	if( key_list != NULL )
 	{
-		RegCloseKey(
-		 key_handle );
+		if( winregsave_save_keys_from_file(
+		     key_list,
+		     save_key_flags,
+		     &number_of_failed_keys,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to save keys from key list: %" PRIs_SYSTEM ".\n",
+			 key_list );
+
+			goto on_error;
+		}
 	}
-	if( process_token != NULL )
+	if( number_of_failed_keys != 0 )
 	{
-		 CloseHandle(
-		 process_token );
+		fprintf(
+		 stderr,
+		 "Unable to save: %d key(s).\n",
+		 number_of_failed_keys );
+
+		return( EXIT_FAILURE );
 	}
-	if( process_handle != NULL )
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
 	{
-		 CloseHandle(
-		 process_handle );
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
 	}
-#endif
 	return( EXIT_FAILURE );
 }
 
@@ -42,6 +42,7 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "winshellfolder_trie.h"
 
 /* Prints the executable usage information
  */
@@ -54,11 +55,16 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use winshellfolder to determine a Shell Folder from a path.\n\n" );
 
-	fprintf( stream, "Usage: winshellfolder [ -12hvV ] path\n\n" );
+	fprintf( stream, "Usage: winshellfolder [ -k known_folders_file ] [ -l path_list_file ]\n"
+	                 "                      [ -hvV ] [ path ]\n\n" );
 
-	fprintf( stream, "\tpath: the path to determine the shell folder of.\n" );
+	fprintf( stream, "\tpath: the path to determine the shell folder of.\n\n" );
 
 	fprintf( stream, "\t-h:   shows this help\n" );
+	fprintf( stream, "\t-k:   read the known folders from a file instead of the system,\n"
+	                 "\t      every line contains a known folder identifier and path\n"
+	                 "\t      separated by a tab\n" );
+	fprintf( stream, "\t-l:   resolve the paths in a file, one path per line\n" );
 	fprintf( stream, "\t-v:   verbose output to stderr\n" );
 	fprintf( stream, "\t-V:   print version\n" );
 	fprintf( stream, "\n" );
@@ -490,96 +496,438 @@ on_error:
 	return( -1 );
 }
 
-#endif /* defined( WINAPI ) */
-
-/* The main program
+/* Inserts the known folders of the system into the trie
+ * Known folders without a file system path, such as virtual folders, are ignored
+ * Returns 1 if successful or -1 on error
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain( int argc, wchar_t * const argv[] )
-#else
-int main( int argc, char * const argv[] )
-#endif
+int winshellfolder_insert_known_folders(
+     winshellfolder_trie_t *trie,
+     libcerror_error_t **error )
 {
-	libcerror_error_t *error            = NULL;
-	system_character_t *options_string  = NULL;
-	system_character_t *path            = NULL;
-	char *program                       = "winshellfolder";
-	system_integer_t option             = 0;
-	int verbose                         = 0;
+	wchar_t guid_string[ 40 ];
 
-#if defined( WINAPI )
-	IShellFolder *desktop_folder        = NULL;
-	IShellFolder *program_files_folder  = NULL;
-	ITEMIDLIST *program_files_item_list = NULL;
-	HRESULT result                      = 0;
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	char narrow_guid_string[ 40 ];
+	char narrow_path[ MAX_PATH * 4 ];
 #endif
 
-	assorted_output_version_fprint(
-	 stdout,
-	 program );
+	IKnownFolder *known_folder                  = NULL;
+	IKnownFolderManager *known_folder_manager   = NULL;
+	KNOWNFOLDERID *known_folder_identifiers     = NULL;
+	PWSTR path                                  = NULL;
+	static char *function                       = "winshellfolder_insert_known_folders";
+	UINT known_folder_index                     = 0;
+	UINT number_of_known_folders                = 0;
+	HRESULT result                              = 0;
+	int string_length                           = 0;
+
+	if( trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trie.",
+		 function );
 
-	options_string = _SYSTEM_STRING( "hvV" );
+		return( -1 );
+	}
+	result = CoCreateInstance(
+	          &CLSID_KnownFolderManager,
+	          NULL,
+	          CLSCTX_INPROC_SERVER,
+	          &IID_IKnownFolderManager,
+	          (void *) &known_folder_manager );
 
-	while( ( option = assorted_getopt(
-	                   argc,
-	                   argv,
-	                   options_string ) ) != (system_integer_t) -1 )
+	if( FAILED( result ) )
 	{
-		switch( option )
-		{
-			case (system_integer_t) '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM "\n",
-				 argv[ optind ] );
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "%s: unable to create known folder manager.",
+		 function );
 
-				usage_fprint(
-				 stdout );
+		goto on_error;
+	}
+	result = known_folder_manager->lpVtbl->GetFolderIds(
+	          known_folder_manager,
+	          &known_folder_identifiers,
+	          &number_of_known_folders );
 
-				return( EXIT_FAILURE );
+	if( FAILED( result ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "%s: unable to retrieve known folder identifiers.",
+		 function );
 
-			case (system_integer_t) 'h':
-				usage_fprint(
-				 stdout );
+		goto on_error;
+	}
+	for( known_folder_index = 0;
+	     known_folder_index < number_of_known_folders;
+	     known_folder_index++ )
+	{
+		result = known_folder_manager->lpVtbl->GetFolder(
+		          known_folder_manager,
+		          &( known_folder_identifiers[ known_folder_index ] ),
+		          &known_folder );
 
-				return( EXIT_SUCCESS );
+		if( FAILED( result ) )
+		{
+			continue;
+		}
+		result = known_folder->lpVtbl->GetPath(
+		          known_folder,
+		          0,
+		          &path );
 
-			case (system_integer_t) 'v':
-				verbose = 1;
+		known_folder->lpVtbl->Release(
+		 known_folder );
 
-				break;
+		known_folder = NULL;
 
-			case (system_integer_t) 'V':
-				assorted_output_copyright_fprint(
-				 stdout );
+		if( FAILED( result ) )
+		{
+			continue;
+		}
+		string_length = StringFromGUID2(
+		                 &( known_folder_identifiers[ known_folder_index ] ),
+		                 guid_string,
+		                 40 );
 
-				return( EXIT_SUCCESS );
+		if( string_length <= 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to convert known folder identifier to string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = winshellfolder_trie_insert(
+		          trie,
+		          path,
+		          wcslen( path ),
+		          guid_string,
+		          (size_t) string_length - 1,
+		          error );
+#else
+		string_length = WideCharToMultiByte(
+		                 CP_ACP,
+		                 0,
+		                 guid_string,
+		                 -1,
+		                 narrow_guid_string,
+		                 40,
+		                 NULL,
+		                 NULL );
+
+		if( string_length > 1 )
+		{
+			string_length = WideCharToMultiByte(
+			                 CP_ACP,
+			                 0,
+			                 path,
+			                 -1,
+			                 narrow_path,
+			                 MAX_PATH * 4,
+			                 NULL,
+			                 NULL );
+		}
+		if( string_length <= 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+			 "%s: unable to convert known folder to narrow string.",
+			 function );
+
+			goto on_error;
 		}
+		result = winshellfolder_trie_insert(
+		          trie,
+		          narrow_path,
+		          (size_t) string_length - 1,
+		          narrow_guid_string,
+		          38,
+		          error );
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert known folder: %" PRIu32 ".",
+			 function,
+			 (uint32_t) known_folder_index );
+
+			goto on_error;
+		}
+		CoTaskMemFree(
+		 path );
+
+		path = NULL;
 	}
-/* TODO
-	if( optind == argc )
+	CoTaskMemFree(
+	 known_folder_identifiers );
+
+	known_folder_manager->lpVtbl->Release(
+	 known_folder_manager );
+
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		CoTaskMemFree(
+		 path );
+	}
+	if( known_folder_identifiers != NULL )
+	{
+		CoTaskMemFree(
+		 known_folder_identifiers );
+	}
+	if( known_folder_manager != NULL )
+	{
+		known_folder_manager->lpVtbl->Release(
+		 known_folder_manager );
+	}
+	return( -1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Resolves a path against the known folders and prints the result
+ * The longest known folder path prefix is replaced by its identifier,
+ * paths without a known folder prefix are printed unchanged
+ * Returns 1 if successful or -1 on error
+ */
+int winshellfolder_resolve_path(
+     winshellfolder_trie_t *trie,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	const system_character_t *identifier = NULL;
+	static char *function                = "winshellfolder_resolve_path";
+	size_t prefix_length                 = 0;
+	int result                           = 0;
+
+	result = winshellfolder_trie_get_longest_prefix(
+	          trie,
+	          path,
+	          path_length,
+	          &prefix_length,
+	          &identifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve longest known folder prefix.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
 	{
 		fprintf(
-		 stderr,
-		 "Missing path.\n" );
+		 stdout,
+		 "%" PRIs_SYSTEM "\n",
+		 path );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "%" PRIs_SYSTEM "%" PRIs_SYSTEM "\n",
+		 identifier,
+		 &( path[ prefix_length ] ) );
+	}
+	return( 1 );
+}
 
-		usage_fprint(
-		 stdout );
+/* Resolves the paths in a file, one path per line
+ * Returns 1 if successful or -1 on error
+ */
+int winshellfolder_resolve_paths_from_file(
+     winshellfolder_trie_t *trie,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *line = NULL;
+	FILE *file_stream         = NULL;
+	static char *function     = "winshellfolder_resolve_paths_from_file";
+	size_t line_length        = 0;
+	size_t line_number        = 0;
 
-		return( EXIT_FAILURE );
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
 	}
-	path = argv[ optind++ ];
-*/
+	line = system_string_allocate(
+	        WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE );
 
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-	libcnotify_verbose_set(
-	 verbose );
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open path list: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        file_stream,
+	        line,
+	        WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %" PRIzd " value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length--;
+		}
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		line[ line_length ] = 0;
+
+		if( winshellfolder_resolve_path(
+		     trie,
+		     line,
+		     line_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to resolve path of line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close path list.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
 
 #if defined( WINAPI )
 
+/* Prints the shell folders of the Desktop folder
+ * Returns 1 if successful or -1 on error
+ */
+int winshellfolder_print_desktop_folder(
+     libcerror_error_t **error )
+{
+	IShellFolder *desktop_folder        = NULL;
+	IShellFolder *program_files_folder  = NULL;
+	ITEMIDLIST *program_files_item_list = NULL;
+	HRESULT result                      = 0;
+
 	result = CoInitialize(
 	          NULL );
 
@@ -588,7 +936,7 @@ int main( int argc, char * const argv[] )
 		result = GetLastError();
 
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
@@ -604,7 +952,7 @@ int main( int argc, char * const argv[] )
 		result = GetLastError();
 
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
@@ -625,7 +973,7 @@ int main( int argc, char * const argv[] )
 		result = GetLastError();
 
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
@@ -645,7 +993,7 @@ int main( int argc, char * const argv[] )
 		result = GetLastError();
 
 		libcerror_system_set_error(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 (uint32_t) result,
@@ -656,10 +1004,10 @@ int main( int argc, char * const argv[] )
 */
 	if( winshellfolder_print_shell_folder(
 	     desktop_folder,
-	     &error ) != 1 )
+	     error ) != 1 )
 	{
 		libcerror_error_set(
-		 &error,
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
 		 "unable to print shell folder." );
@@ -685,25 +1033,9 @@ int main( int argc, char * const argv[] )
 
 	CoUninitialize();
 
-	return( EXIT_SUCCESS );
-#else
-	fprintf(
-	 stderr,
-	 "This program requires WINAPI.\n" );
-
-	return( EXIT_FAILURE );
-
-#endif /* defined( WINAPI ) */
+	return( 1 );
 
 on_error:
-	if( error != NULL )
-	{
-		libcnotify_print_error_backtrace(
-		 error );
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( WINAPI )
 	if( program_files_item_list != NULL )
 	{
 		CoTaskMemFree(
@@ -723,8 +1055,250 @@ on_error:
 	}
 	CoUninitialize();
 
+	return( -1 );
+}
+
 #endif /* defined( WINAPI ) */
 
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                = NULL;
+	system_character_t *known_folders_file  = NULL;
+	system_character_t *options_string      = NULL;
+	system_character_t *path                = NULL;
+	system_character_t *path_list_file      = NULL;
+	winshellfolder_trie_t *trie             = NULL;
+	char *program                           = "winshellfolder";
+	system_integer_t option                 = 0;
+	int verbose                             = 0;
+
+#if defined( WINAPI )
+	HRESULT result                          = 0;
+#endif
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	options_string = _SYSTEM_STRING( "hk:l:vV" );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'k':
+				known_folders_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'l':
+				path_list_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind < argc )
+	{
+		path = argv[ optind++ ];
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( ( path == NULL )
+	 && ( path_list_file == NULL ) )
+	{
+#if defined( WINAPI )
+		if( winshellfolder_print_desktop_folder(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print shell folder.\n" );
+
+			goto on_error;
+		}
+		return( EXIT_SUCCESS );
+#else
+		fprintf(
+		 stderr,
+		 "Missing path.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+#endif
+	}
+	/* The known folders are enumerated once and every path is resolved
+	 * with a longest prefix lookup
+	 */
+	if( winshellfolder_trie_initialize(
+	     &trie,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create known folder trie.\n" );
+
+		goto on_error;
+	}
+	if( known_folders_file != NULL )
+	{
+		if( winshellfolder_trie_read_file(
+		     trie,
+		     known_folders_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read known folders file.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+#if defined( WINAPI )
+		result = CoInitialize(
+		          NULL );
+
+		if( FAILED( result ) )
+		{
+			libcerror_system_set_error(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 (uint32_t) result,
+			 "unable to initialize COM." );
+
+			goto on_error;
+		}
+		result = winshellfolder_insert_known_folders(
+		          trie,
+		          &error );
+
+		CoUninitialize();
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to enumerate known folders.\n" );
+
+			goto on_error;
+		}
+#else
+		fprintf(
+		 stderr,
+		 "Missing known folders file.\n" );
+
+		goto on_error;
+#endif
+	}
+	if( verbose != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Number of known folders\t: %d\n",
+		 trie->number_of_known_folders );
+	}
+	if( path != NULL )
+	{
+		if( winshellfolder_resolve_path(
+		     trie,
+		     path,
+		     system_string_length(
+		      path ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to resolve path.\n" );
+
+			goto on_error;
+		}
+	}
+	if( path_list_file != NULL )
+	{
+		if( winshellfolder_resolve_paths_from_file(
+		     trie,
+		     path_list_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to resolve paths from file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( winshellfolder_trie_free(
+	     &trie,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free known folder trie.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( trie != NULL )
+	{
+		winshellfolder_trie_free(
+		 &trie,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
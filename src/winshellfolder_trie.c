@@ -0,0 +1,715 @@
+/*
+ * Known folder prefix trie
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "winshellfolder_trie.h"
+
+/* Folds a path character for comparison, '/' is treated as '\\' and
+ * only the ASCII letters are case folded
+ */
+#define winshellfolder_trie_fold_character( character ) \
+	( ( ( character ) == (system_character_t) '/' ) ? (system_character_t) '\\' : \
+	  ( ( ( character ) >= (system_character_t) 'A' ) && ( ( character ) <= (system_character_t) 'Z' ) ) ? \
+	  (system_character_t) ( ( character ) + ( 'a' - 'A' ) ) : ( character ) )
+
+/* Creates a trie
+ * Make sure the value trie is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int winshellfolder_trie_initialize(
+     winshellfolder_trie_t **trie,
+     libcerror_error_t **error )
+{
+	static char *function = "winshellfolder_trie_initialize";
+
+	if( trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trie != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trie value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*trie = memory_allocate_structure(
+	         winshellfolder_trie_t );
+
+	if( *trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create trie.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *trie,
+	     0,
+	     sizeof( winshellfolder_trie_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear trie.",
+		 function );
+
+		memory_free(
+		 *trie );
+
+		*trie = NULL;
+
+		return( -1 );
+	}
+	( *trie )->nodes = (winshellfolder_trie_node_t *) memory_allocate(
+	                                                   sizeof( winshellfolder_trie_node_t ) * 256 );
+
+	if( ( *trie )->nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create nodes.",
+		 function );
+
+		goto on_error;
+	}
+	( *trie )->number_of_allocated_nodes = 256;
+
+	/* The root node represents the empty prefix
+	 */
+	if( memory_set(
+	     &( ( *trie )->nodes[ 0 ] ),
+	     0,
+	     sizeof( winshellfolder_trie_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear root node.",
+		 function );
+
+		goto on_error;
+	}
+	( *trie )->number_of_nodes = 1;
+
+	return( 1 );
+
+on_error:
+	if( *trie != NULL )
+	{
+		if( ( *trie )->nodes != NULL )
+		{
+			memory_free(
+			 ( *trie )->nodes );
+		}
+		memory_free(
+		 *trie );
+
+		*trie = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a trie
+ * Returns 1 if successful or -1 on error
+ */
+int winshellfolder_trie_free(
+     winshellfolder_trie_t **trie,
+     libcerror_error_t **error )
+{
+	static char *function = "winshellfolder_trie_free";
+
+	if( trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trie != NULL )
+	{
+		if( ( *trie )->nodes != NULL )
+		{
+			memory_free(
+			 ( *trie )->nodes );
+		}
+		if( ( *trie )->identifiers != NULL )
+		{
+			memory_free(
+			 ( *trie )->identifiers );
+		}
+		memory_free(
+		 *trie );
+
+		*trie = NULL;
+	}
+	return( 1 );
+}
+
+/* Inserts a known folder path and its identifier
+ * Trailing path separators are ignored and the path is matched case-insensitive
+ * Returns 1 if successful, 0 if the path was already inserted or -1 on error
+ */
+int winshellfolder_trie_insert(
+     winshellfolder_trie_t *trie,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *identifier,
+     size_t identifier_length,
+     libcerror_error_t **error )
+{
+	winshellfolder_trie_node_t *node     = NULL;
+	void *reallocation                   = NULL;
+	static char *function                = "winshellfolder_trie_insert";
+	size_t allocated_identifiers_size    = 0;
+	size_t path_index                    = 0;
+	system_character_t character         = 0;
+	int child_index                      = 0;
+	int node_index                       = 0;
+	int number_of_allocated_nodes        = 0;
+
+	if( trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( identifier_length == 0 )
+	 || ( identifier_length > (size_t) ( INT_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid identifier length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( path_length > 0 )
+	    && ( winshellfolder_trie_fold_character( path[ path_length - 1 ] ) == (system_character_t) '\\' ) )
+	{
+		path_length--;
+	}
+	if( path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		character = winshellfolder_trie_fold_character(
+		             path[ path_index ] );
+
+		child_index = trie->nodes[ node_index ].first_child_index;
+
+		while( child_index != 0 )
+		{
+			if( trie->nodes[ child_index - 1 ].character == character )
+			{
+				break;
+			}
+			child_index = trie->nodes[ child_index - 1 ].next_sibling_index;
+		}
+		if( child_index != 0 )
+		{
+			node_index = child_index - 1;
+
+			continue;
+		}
+		if( trie->number_of_nodes >= trie->number_of_allocated_nodes )
+		{
+			if( trie->number_of_allocated_nodes > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of nodes value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_nodes = trie->number_of_allocated_nodes * 2;
+
+			reallocation = memory_reallocate(
+			                trie->nodes,
+			                sizeof( winshellfolder_trie_node_t ) * number_of_allocated_nodes );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize nodes.",
+				 function );
+
+				return( -1 );
+			}
+			trie->nodes                     = (winshellfolder_trie_node_t *) reallocation;
+			trie->number_of_allocated_nodes = number_of_allocated_nodes;
+		}
+		node = &( trie->nodes[ trie->number_of_nodes ] );
+
+		node->first_child_index  = 0;
+		node->next_sibling_index = trie->nodes[ node_index ].first_child_index;
+		node->identifier_offset  = 0;
+		node->character          = character;
+
+		trie->nodes[ node_index ].first_child_index = trie->number_of_nodes + 1;
+
+		node_index = trie->number_of_nodes;
+
+		trie->number_of_nodes += 1;
+	}
+	node = &( trie->nodes[ node_index ] );
+
+	if( node->identifier_offset != 0 )
+	{
+		return( 0 );
+	}
+	if( ( trie->identifiers_size + identifier_length + 1 ) > trie->allocated_identifiers_size )
+	{
+		allocated_identifiers_size = trie->allocated_identifiers_size * 2;
+
+		if( allocated_identifiers_size < ( trie->identifiers_size + identifier_length + 1 ) )
+		{
+			allocated_identifiers_size = trie->identifiers_size + identifier_length + 1024;
+		}
+		if( allocated_identifiers_size > (size_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid identifiers size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                trie->identifiers,
+		                sizeof( system_character_t ) * allocated_identifiers_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		trie->identifiers                = (system_character_t *) reallocation;
+		trie->allocated_identifiers_size = allocated_identifiers_size;
+	}
+	if( system_string_copy(
+	     &( trie->identifiers[ trie->identifiers_size ] ),
+	     identifier,
+	     identifier_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
+
+		return( -1 );
+	}
+	trie->identifiers[ trie->identifiers_size + identifier_length ] = 0;
+
+	node->identifier_offset = (int) trie->identifiers_size + 1;
+
+	trie->identifiers_size        += identifier_length + 1;
+	trie->number_of_known_folders += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the identifier of the longest known folder path that is a prefix of the path
+ * The prefix must end at a path separator or at the end of the path
+ * The identifier remains valid until the next insert
+ * Returns 1 if successful, 0 if no known folder path is a prefix or -1 on error
+ */
+int winshellfolder_trie_get_longest_prefix(
+     winshellfolder_trie_t *trie,
+     const system_character_t *path,
+     size_t path_length,
+     size_t *prefix_length,
+     const system_character_t **identifier,
+     libcerror_error_t **error )
+{
+	static char *function        = "winshellfolder_trie_get_longest_prefix";
+	size_t path_index            = 0;
+	system_character_t character = 0;
+	int child_index              = 0;
+	int identifier_offset        = 0;
+	int node_index               = 0;
+
+	if( trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefix_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix length.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		character = winshellfolder_trie_fold_character(
+		             path[ path_index ] );
+
+		/* A known folder path only matches complete path segments
+		 */
+		if( ( character == (system_character_t) '\\' )
+		 && ( trie->nodes[ node_index ].identifier_offset != 0 ) )
+		{
+			identifier_offset = trie->nodes[ node_index ].identifier_offset;
+			*prefix_length    = path_index;
+		}
+		child_index = trie->nodes[ node_index ].first_child_index;
+
+		while( child_index != 0 )
+		{
+			if( trie->nodes[ child_index - 1 ].character == character )
+			{
+				break;
+			}
+			child_index = trie->nodes[ child_index - 1 ].next_sibling_index;
+		}
+		if( child_index == 0 )
+		{
+			break;
+		}
+		node_index = child_index - 1;
+	}
+	if( ( path_index == path_length )
+	 && ( trie->nodes[ node_index ].identifier_offset != 0 ) )
+	{
+		identifier_offset = trie->nodes[ node_index ].identifier_offset;
+		*prefix_length    = path_length;
+	}
+	if( identifier_offset == 0 )
+	{
+		return( 0 );
+	}
+	*identifier = &( trie->identifiers[ identifier_offset - 1 ] );
+
+	return( 1 );
+}
+
+/* Reads known folders from a file
+ * Every line contains an identifier and a path separated by a tab
+ * Returns 1 if successful or -1 on error
+ */
+int winshellfolder_trie_read_file(
+     winshellfolder_trie_t *trie,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *line = NULL;
+	FILE *file_stream         = NULL;
+	static char *function     = "winshellfolder_trie_read_file";
+	size_t line_length        = 0;
+	size_t line_number        = 0;
+	size_t separator_index    = 0;
+
+	if( trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	line = system_string_allocate(
+	        WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open known folders file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        file_stream,
+	        line,
+	        WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %" PRIzd " value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == (system_character_t) '#' ) )
+		{
+			continue;
+		}
+		for( separator_index = 0;
+		     separator_index < line_length;
+		     separator_index++ )
+		{
+			if( line[ separator_index ] == (system_character_t) '\t' )
+			{
+				break;
+			}
+		}
+		if( ( separator_index == 0 )
+		 || ( ( separator_index + 1 ) >= line_length ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( winshellfolder_trie_insert(
+		     trie,
+		     &( line[ separator_index + 1 ] ),
+		     line_length - ( separator_index + 1 ),
+		     line,
+		     separator_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert known folder of line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close known folders file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
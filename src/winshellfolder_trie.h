@@ -0,0 +1,126 @@
+/*
+ * Known folder prefix trie
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _WINSHELLFOLDER_TRIE_H )
+#define _WINSHELLFOLDER_TRIE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a line of a known folders or path list file
+ */
+#define WINSHELLFOLDER_TRIE_MAXIMUM_LINE_SIZE	4096
+
+typedef struct winshellfolder_trie_node winshellfolder_trie_node_t;
+
+struct winshellfolder_trie_node
+{
+	/* The index + 1 of the first child node or 0 if not set
+	 */
+	int first_child_index;
+
+	/* The index + 1 of the next sibling node or 0 if not set
+	 */
+	int next_sibling_index;
+
+	/* The offset + 1 of the identifier or 0 if not set
+	 */
+	int identifier_offset;
+
+	/* The case folded character
+	 */
+	system_character_t character;
+};
+
+typedef struct winshellfolder_trie winshellfolder_trie_t;
+
+struct winshellfolder_trie
+{
+	/* The nodes, the first node is the root node
+	 */
+	winshellfolder_trie_node_t *nodes;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+	/* The number of allocated nodes
+	 */
+	int number_of_allocated_nodes;
+
+	/* The identifiers, stored as consecutive end-of-string terminated strings
+	 */
+	system_character_t *identifiers;
+
+	/* The size of the identifiers
+	 */
+	size_t identifiers_size;
+
+	/* The allocated size of the identifiers
+	 */
+	size_t allocated_identifiers_size;
+
+	/* The number of known folders
+	 */
+	int number_of_known_folders;
+};
+
+int winshellfolder_trie_initialize(
+     winshellfolder_trie_t **trie,
+     libcerror_error_t **error );
+
+int winshellfolder_trie_free(
+     winshellfolder_trie_t **trie,
+     libcerror_error_t **error );
+
+int winshellfolder_trie_insert(
+     winshellfolder_trie_t *trie,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *identifier,
+     size_t identifier_length,
+     libcerror_error_t **error );
+
+int winshellfolder_trie_get_longest_prefix(
+     winshellfolder_trie_t *trie,
+     const system_character_t *path,
+     size_t path_length,
+     size_t *prefix_length,
+     const system_character_t **identifier,
+     libcerror_error_t **error );
+
+int winshellfolder_trie_read_file(
+     winshellfolder_trie_t *trie,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _WINSHELLFOLDER_TRIE_H ) */
+
@@ -43,6 +43,8 @@
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "winshelllink_queue.h"
 
 /* Prints the executable usage information
  */
@@ -53,18 +55,133 @@ void usage_fprint(
 	{
 		return;
 	}
-	fprintf( stream, "Use winshelllink to determine a Shell Link from a path.\n\n" );
+	fprintf( stream, "Use winshelllink to read Shell Link (.lnk) files using the Windows shell.\n\n" );
+
+	fprintf( stream, "Usage: winshelllink [ -c path ] [ -f file_list ] [ -j number_of_threads ]\n"
+	                 "                    [ -hrvV ] [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: the shell link file, the shell link files are read in\n"
+	                 "\t        batches and their values are printed in input order\n\n" );
+
+	fprintf( stream, "\t-c:     create a shell link file named test.lnk that refers to path\n" );
+	fprintf( stream, "\t-f:     file with a shell link file per line to read\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to read multiple shell link files,\n"
+	                 "\t        every thread uses its own COM apartment and shell link\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-r:     read the .lnk files in source directories and their sub\n"
+	                 "\t        directories\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
 
-	fprintf( stream, "Usage: winshelllink [ -12hvV ] path\n\n" );
+#if defined( WINAPI )
 
-	fprintf( stream, "\tpath: the path to determine the shell link of.\n" );
+/* Creates a shell link file named test.lnk that refers to the path
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_create_shell_link(
+     system_character_t *path,
+     libcerror_error_t **error )
+{
+	IPersistFile *persist_file = NULL;
+	IShellLink *shell_link     = NULL;
+	HRESULT result             = 0;
 
-	fprintf( stream, "\t-h:   shows this help\n" );
-	fprintf( stream, "\t-v:   verbose output to stderr\n" );
-	fprintf( stream, "\t-V:   print version\n" );
-	fprintf( stream, "\n" );
+	result = CoCreateInstance(
+	          &CLSID_ShellLink,
+	          NULL,
+	          CLSCTX_INPROC_SERVER,
+	          &IID_IShellLink,
+	          (void *) &shell_link ); 
+
+	if( FAILED( result ) ) 
+	{ 
+		result = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "unable to create shell link." );
+
+		goto on_error;
+	}
+	shell_link->lpVtbl->SetPath(
+	 shell_link,
+	 path ); 
+
+	shell_link->lpVtbl->SetDescription(
+	 shell_link,
+	 L"description" ); 
+ 
+	result = shell_link->lpVtbl->QueryInterface(
+	          shell_link,
+	          &IID_IPersistFile,
+	          (void *) &persist_file ); 
+ 
+	if( FAILED( result ) ) 
+	{ 
+		result = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "unable to create persist file." );
+
+		goto on_error;
+	}
+	result = persist_file->lpVtbl->Save(
+	          persist_file,
+	          L"test.lnk",
+	          TRUE ); 
+
+	if( FAILED( result ) ) 
+	{ 
+		result = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "unable to write persist file." );
+
+		goto on_error;
+	}
+	persist_file->lpVtbl->Release(
+	 persist_file ); 
+
+	persist_file = NULL;
+
+	shell_link->lpVtbl->Release(
+	 shell_link ); 
+
+	shell_link = NULL;
+
+	return( 1 );
+
+on_error:
+	if( persist_file != NULL )
+	{
+		persist_file->lpVtbl->Release(
+		 persist_file ); 
+	}
+	if( shell_link != NULL )
+	{
+		shell_link->lpVtbl->Release(
+		 shell_link ); 
+	}
+	return( -1 );
 }
 
+#endif /* defined( WINAPI ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -74,23 +191,27 @@ int main( int argc, char * const argv[] )
 #endif
 {
 	libcerror_error_t *error           = NULL;
+	system_character_t *file_list      = NULL;
 	system_character_t *options_string = NULL;
 	system_character_t *path           = NULL;
+	winshelllink_queue_t *queue        = NULL;
 	char *program                      = "winshelllink";
 	system_integer_t option            = 0;
+	int argument_index                 = 0;
+	int number_of_threads              = 1;
+	int recursive                      = 0;
+	int result                         = 0;
 	int verbose                        = 0;
 
 #if defined( WINAPI )
-	IPersistFile *persist_file         = NULL;
-	IShellLink *shell_link             = NULL;
-	HRESULT result                     = 0;
+	HRESULT com_result                 = 0;
 #endif
 
 	assorted_output_version_fprint(
 	 stdout,
 	 program );
 
-	options_string = _SYSTEM_STRING( "hvV" );
+	options_string = _SYSTEM_STRING( "c:f:hj:rt:vV" );
 
 	while( ( option = assorted_getopt(
 	                   argc,
@@ -111,12 +232,33 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'c':
+				path = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				file_list = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'r':
+				recursive = 1;
+
+				break;
+
+			case (system_integer_t) 'j':
+			case (system_integer_t) 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -129,19 +271,35 @@ int main( int argc, char * const argv[] )
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( optind == argc )
+	 && ( file_list == NULL )
+	 && ( path == NULL ) )
 	{
 		fprintf(
 		 stderr,
-		 "Missing path.\n" );
+		 "Missing source file.\n" );
 
 		usage_fprint(
 		 stdout );
 
 		return( EXIT_FAILURE );
 	}
-	path = argv[ optind++ ];
+	if( number_of_threads < 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value zero or less.\n" );
 
+		return( EXIT_FAILURE );
+	}
+	if( number_of_threads > WINSHELLLINK_QUEUE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value exceeds maximum.\n" );
+
+		return( EXIT_FAILURE );
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
@@ -150,99 +308,122 @@ int main( int argc, char * const argv[] )
 
 #if defined( WINAPI )
 
-	result = CoInitialize(
-	          NULL );
+	/* COM is initialized once, the shell link of the calling thread is reused
+	 * for every shell link file it reads
+	 */
+	com_result = CoInitialize(
+	              NULL );
 
-	if( FAILED( result ) ) 
+	if( FAILED( com_result ) ) 
 	{ 
-		result = GetLastError();
-
 		libcerror_system_set_error(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 (uint32_t) result,
+		 (uint32_t) com_result,
 		 "unable to initialize COM." );
 
 		goto on_error;
 	}
-	result = CoCreateInstance(
-	          &CLSID_ShellLink,
-	          NULL,
-	          CLSCTX_INPROC_SERVER,
-	          &IID_IShellLink,
-	          (void *) &shell_link ); 
-
-	if( FAILED( result ) ) 
-	{ 
-		result = GetLastError();
+	if( path != NULL )
+	{
+		if( winshelllink_create_shell_link(
+		     path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create shell link.\n" );
 
-		libcerror_system_set_error(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 (uint32_t) result,
-		 "unable to create shell link." );
+			goto on_error;
+		}
+	}
+	if( winshelllink_queue_initialize(
+	     &queue,
+	     number_of_threads,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create queue.\n" );
 
 		goto on_error;
 	}
-	shell_link->lpVtbl->SetPath(
-	 shell_link,
-	 path ); 
-
-	shell_link->lpVtbl->SetDescription(
-	 shell_link,
-	 L"description" ); 
- 
-	result = shell_link->lpVtbl->QueryInterface(
-	          shell_link,
-	          &IID_IPersistFile,
-	          (void *) &persist_file ); 
- 
-	if( FAILED( result ) ) 
-	{ 
-		result = GetLastError();
-
-		libcerror_system_set_error(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 (uint32_t) result,
-		 "unable to create persist file." );
+	if( winshelllink_queue_set_recursive(
+	     queue,
+	     (uint8_t) recursive,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set recursive.\n" );
 
 		goto on_error;
 	}
-	result = persist_file->lpVtbl->Save(
-	          persist_file,
-	          L"test.lnk",
-	          TRUE ); 
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( winshelllink_queue_append_source(
+		     queue,
+		     argv[ argument_index ],
+		     system_string_length(
+		      argv[ argument_index ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
 
-	if( FAILED( result ) ) 
-	{ 
-		result = GetLastError();
+			goto on_error;
+		}
+	}
+	if( file_list != NULL )
+	{
+		if( winshelllink_queue_append_sources_from_file_list(
+		     queue,
+		     file_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append sources from file list: %" PRIs_SYSTEM ".\n",
+			 file_list );
 
-		libcerror_system_set_error(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 (uint32_t) result,
-		 "unable to write persist file." );
+			goto on_error;
+		}
+	}
+	if( winshelllink_queue_flush(
+	     queue,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to flush queue.\n" );
 
 		goto on_error;
 	}
-	persist_file->lpVtbl->Release(
-	 persist_file ); 
-
-	persist_file = NULL;
+	result = EXIT_SUCCESS;
 
-	shell_link->lpVtbl->Release(
-	 shell_link ); 
-
-	shell_link = NULL;
+	if( queue->number_of_failed_sources != 0 )
+	{
+		result = EXIT_FAILURE;
+	}
+	if( winshelllink_queue_free(
+	     &queue,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free queue.\n" );
 
+		goto on_error;
+	}
 	CoUninitialize();
 
-	return( EXIT_SUCCESS );
+	return( result );
 #else
 	fprintf(
 	 stderr,
@@ -260,21 +441,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-#if defined( WINAPI )
-	if( persist_file != NULL )
+	if( queue != NULL )
 	{
-		persist_file->lpVtbl->Release(
-		 persist_file ); 
+		winshelllink_queue_free(
+		 &queue,
+		 NULL );
 	}
-	if( shell_link != NULL )
+#if defined( WINAPI )
+	if( SUCCEEDED( com_result ) )
 	{
-		shell_link->lpVtbl->Release(
-		 shell_link ); 
+		CoUninitialize();
 	}
-	CoUninitialize();
-
-#endif /* defined( WINAPI ) */
-
+#endif
 	return( EXIT_FAILURE );
 }
 
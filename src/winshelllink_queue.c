@@ -0,0 +1,2065 @@
+/*
+ * Winshelllink work queue
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "winshelllink_queue.h"
+
+/* The maximum size of a line in a file list
+ */
+#define WINSHELLLINK_QUEUE_MAXIMUM_LINE_SIZE	32768
+
+/* The initial allocated size of the output data of a task
+ */
+#define WINSHELLLINK_QUEUE_INITIAL_OUTPUT_SIZE	1024
+
+/* The maximum number of characters of a shell link value, which corresponds
+ * to INFOTIPSIZE
+ */
+#define WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE	1024
+
+/* Appends a string to the output data of a task
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_task_append_string(
+     winshelllink_queue_task_t *task,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	char *reallocated_output_data     = NULL;
+	static char *function             = "winshelllink_queue_task_append_string";
+	size_t allocated_output_data_size = 0;
+	size_t required_output_data_size  = 0;
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - task->output_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	required_output_data_size = task->output_data_size + string_length;
+
+	if( required_output_data_size > task->allocated_output_data_size )
+	{
+		allocated_output_data_size = task->allocated_output_data_size;
+
+		if( allocated_output_data_size == 0 )
+		{
+			allocated_output_data_size = WINSHELLLINK_QUEUE_INITIAL_OUTPUT_SIZE;
+		}
+		while( allocated_output_data_size < required_output_data_size )
+		{
+			if( allocated_output_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				allocated_output_data_size = required_output_data_size;
+
+				break;
+			}
+			allocated_output_data_size *= 2;
+		}
+		reallocated_output_data = (char *) memory_reallocate(
+		                                    task->output_data,
+		                                    sizeof( char ) * allocated_output_data_size );
+
+		if( reallocated_output_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize output data.",
+			 function );
+
+			return( -1 );
+		}
+		task->output_data                = reallocated_output_data;
+		task->allocated_output_data_size = allocated_output_data_size;
+	}
+	if( string_length > 0 )
+	{
+		if( memory_copy(
+		     &( task->output_data[ task->output_data_size ] ),
+		     string,
+		     string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string to output data.",
+			 function );
+
+			return( -1 );
+		}
+		task->output_data_size += string_length;
+	}
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Appends a description and a wide string value to the output data of a task
+ * The value is converted to UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_task_append_value(
+     winshelllink_queue_task_t *task,
+     const char *description,
+     const wchar_t *value,
+     libcerror_error_t **error )
+{
+	char utf8_value[ WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE * 4 ];
+
+	static char *function = "winshelllink_queue_task_append_value";
+	int utf8_value_size   = 0;
+
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_value_size = WideCharToMultiByte(
+	                   CP_UTF8,
+	                   0,
+	                   value,
+	                   -1,
+	                   utf8_value,
+	                   WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE * 4,
+	                   NULL,
+	                   NULL );
+
+	if( utf8_value_size <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+		 "%s: unable to convert value to UTF-8.",
+		 function );
+
+		return( -1 );
+	}
+	if( winshelllink_queue_task_append_string(
+	     task,
+	     description,
+	     narrow_string_length(
+	      description ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append description.",
+		 function );
+
+		return( -1 );
+	}
+	/* The end-of-string character is replaced by an end-of-line character
+	 */
+	utf8_value[ utf8_value_size - 1 ] = '\n';
+
+	if( winshelllink_queue_task_append_string(
+	     task,
+	     utf8_value,
+	     (size_t) utf8_value_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Reads a shell link file with the shell link of the worker and appends its values
+ * to the output data of the task
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_task_process(
+     winshelllink_queue_task_t *task,
+     winshelllink_queue_worker_t *worker,
+     libcerror_error_t **error )
+{
+	static char *function   = "winshelllink_queue_task_process";
+
+#if defined( WINAPI )
+	wchar_t value[ WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE ];
+	char string[ 64 ];
+
+	wchar_t *wide_filename  = NULL;
+	HRESULT result          = 0;
+	int icon_index          = 0;
+	int print_count         = 0;
+	int show_command        = 0;
+	WORD hot_key            = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int wide_filename_size  = 0;
+#endif
+#endif /* defined( WINAPI ) */
+
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( worker->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing shell link.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wide_filename = task->filename;
+#else
+	wide_filename_size = MultiByteToWideChar(
+	                      CP_ACP,
+	                      0,
+	                      task->filename,
+	                      -1,
+	                      NULL,
+	                      0 );
+
+	if( wide_filename_size <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+		 "%s: unable to determine wide filename size.",
+		 function );
+
+		goto on_error;
+	}
+	wide_filename = (wchar_t *) memory_allocate(
+	                             sizeof( wchar_t ) * wide_filename_size );
+
+	if( wide_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create wide filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( MultiByteToWideChar(
+	     CP_ACP,
+	     0,
+	     task->filename,
+	     -1,
+	     wide_filename,
+	     wide_filename_size ) != wide_filename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_CONVERSION_FAILED,
+		 "%s: unable to convert filename.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	result = worker->persist_file->lpVtbl->Load(
+	          worker->persist_file,
+	          wide_filename,
+	          STGM_READ );
+
+	if( FAILED( result ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) result,
+		 "%s: unable to load shell link.",
+		 function );
+
+		goto on_error;
+	}
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	memory_free(
+	 wide_filename );
+
+	wide_filename = NULL;
+#endif
+	/* The values are retrieved without resolving the link target
+	 */
+	value[ 0 ] = 0;
+
+	result = worker->shell_link->lpVtbl->GetPath(
+	          worker->shell_link,
+	          value,
+	          WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE,
+	          NULL,
+	          SLGP_RAWPATH );
+
+	if( FAILED( result )
+	 || ( winshelllink_queue_task_append_value(
+	       task,
+	       "\tPath\t\t\t: ",
+	       value,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path.",
+		 function );
+
+		goto on_error;
+	}
+	value[ 0 ] = 0;
+
+	result = worker->shell_link->lpVtbl->GetArguments(
+	          worker->shell_link,
+	          value,
+	          WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE );
+
+	if( FAILED( result )
+	 || ( winshelllink_queue_task_append_value(
+	       task,
+	       "\tArguments\t\t: ",
+	       value,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve arguments.",
+		 function );
+
+		goto on_error;
+	}
+	value[ 0 ] = 0;
+
+	result = worker->shell_link->lpVtbl->GetWorkingDirectory(
+	          worker->shell_link,
+	          value,
+	          WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE );
+
+	if( FAILED( result )
+	 || ( winshelllink_queue_task_append_value(
+	       task,
+	       "\tWorking directory\t: ",
+	       value,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve working directory.",
+		 function );
+
+		goto on_error;
+	}
+	value[ 0 ] = 0;
+
+	result = worker->shell_link->lpVtbl->GetDescription(
+	          worker->shell_link,
+	          value,
+	          WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE );
+
+	if( FAILED( result )
+	 || ( winshelllink_queue_task_append_value(
+	       task,
+	       "\tDescription\t\t: ",
+	       value,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve description.",
+		 function );
+
+		goto on_error;
+	}
+	value[ 0 ] = 0;
+
+	result = worker->shell_link->lpVtbl->GetIconLocation(
+	          worker->shell_link,
+	          value,
+	          WINSHELLLINK_QUEUE_MAXIMUM_VALUE_SIZE,
+	          &icon_index );
+
+	if( FAILED( result )
+	 || ( winshelllink_queue_task_append_value(
+	       task,
+	       "\tIcon location\t\t: ",
+	       value,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve icon location.",
+		 function );
+
+		goto on_error;
+	}
+	result = worker->shell_link->lpVtbl->GetShowCmd(
+	          worker->shell_link,
+	          &show_command );
+
+	if( SUCCEEDED( result ) )
+	{
+		result = worker->shell_link->lpVtbl->GetHotkey(
+		          worker->shell_link,
+		          &hot_key );
+	}
+	if( FAILED( result ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 (uint32_t) result,
+		 "%s: unable to retrieve show command and hot key.",
+		 function );
+
+		goto on_error;
+	}
+	print_count = narrow_string_snprintf(
+	               string,
+	               64,
+	               "\tIcon index\t\t: %d\n\tShow command\t\t: %d\n\tHot key\t\t\t: 0x%04" PRIx16 "\n",
+	               icon_index,
+	               show_command,
+	               (uint16_t) hot_key );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format values.",
+		 function );
+
+		goto on_error;
+	}
+	if( winshelllink_queue_task_append_string(
+	     task,
+	     string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( wide_filename != NULL )
+	{
+		memory_free(
+		 wide_filename );
+	}
+#endif
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: reading shell links requires WINAPI.",
+	 function );
+
+	return( -1 );
+#endif /* defined( WINAPI ) */
+}
+
+/* Creates the shell link of a worker
+ * COM must be initialized on the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_worker_open(
+     winshelllink_queue_worker_t *worker,
+     libcerror_error_t **error )
+{
+	static char *function = "winshelllink_queue_worker_open";
+
+#if defined( WINAPI )
+	HRESULT result        = 0;
+#endif
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->is_open != 0 )
+	{
+		return( 1 );
+	}
+#if defined( WINAPI )
+	result = CoCreateInstance(
+	          &CLSID_ShellLink,
+	          NULL,
+	          CLSCTX_INPROC_SERVER,
+	          &IID_IShellLinkW,
+	          (void *) &( worker->shell_link ) );
+
+	if( FAILED( result ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 (uint32_t) result,
+		 "%s: unable to create shell link.",
+		 function );
+
+		worker->shell_link = NULL;
+
+		return( -1 );
+	}
+	result = worker->shell_link->lpVtbl->QueryInterface(
+	          worker->shell_link,
+	          &IID_IPersistFile,
+	          (void *) &( worker->persist_file ) );
+
+	if( FAILED( result ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 (uint32_t) result,
+		 "%s: unable to create persist file.",
+		 function );
+
+		worker->shell_link->lpVtbl->Release(
+		 worker->shell_link );
+
+		worker->shell_link   = NULL;
+		worker->persist_file = NULL;
+
+		return( -1 );
+	}
+#endif /* defined( WINAPI ) */
+
+	worker->is_open = 1;
+
+	return( 1 );
+}
+
+/* Releases the shell link of a worker
+ */
+void winshelllink_queue_worker_close(
+      winshelllink_queue_worker_t *worker )
+{
+	if( ( worker == NULL )
+	 || ( worker->is_open == 0 ) )
+	{
+		return;
+	}
+#if defined( WINAPI )
+	worker->persist_file->lpVtbl->Release(
+	 worker->persist_file );
+
+	worker->persist_file = NULL;
+
+	worker->shell_link->lpVtbl->Release(
+	 worker->shell_link );
+
+	worker->shell_link = NULL;
+#endif
+	worker->is_open = 0;
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Processes every number of workers task of the current batch from a worker thread
+ * The worker thread uses its own single-threaded COM apartment and shell link,
+ * tasks it cannot process remain unprocessed and are processed by the calling thread
+ * Returns 1 on success or -1 on error
+ */
+int winshelllink_queue_worker_callback(
+     winshelllink_queue_worker_t *worker )
+{
+	size_t task_index = 0;
+
+#if defined( WINAPI )
+	HRESULT result    = 0;
+#endif
+
+	if( ( worker == NULL )
+	 || ( worker->queue == NULL )
+	 || ( worker->worker_index < 0 )
+	 || ( worker->number_of_workers < 1 ) )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	result = CoInitializeEx(
+	          NULL,
+	          COINIT_APARTMENTTHREADED );
+
+	if( FAILED( result ) )
+	{
+		return( -1 );
+	}
+#endif
+	if( winshelllink_queue_worker_open(
+	     worker,
+	     NULL ) == 1 )
+	{
+		for( task_index = (size_t) worker->worker_index;
+		     task_index < worker->queue->number_of_tasks;
+		     task_index += (size_t) worker->number_of_workers )
+		{
+			worker->queue->tasks[ task_index ].result = winshelllink_queue_task_process(
+			                                             &( worker->queue->tasks[ task_index ] ),
+			                                             worker,
+			                                             NULL );
+		}
+		winshelllink_queue_worker_close(
+		 worker );
+	}
+#if defined( WINAPI )
+	CoUninitialize();
+#endif
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Creates a queue
+ * Make sure the value queue is referencing, is set to NULL
+ * COM must be initialized on the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_initialize(
+     winshelllink_queue_t **queue,
+     int number_of_threads,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "winshelllink_queue_initialize";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > WINSHELLLINK_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output stream.",
+		 function );
+
+		return( -1 );
+	}
+	*queue = memory_allocate_structure(
+	          winshelllink_queue_t );
+
+	if( *queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *queue,
+	     0,
+	     sizeof( winshelllink_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queue.",
+		 function );
+
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+
+		return( -1 );
+	}
+	( *queue )->number_of_threads = number_of_threads;
+	( *queue )->output_stream     = output_stream;
+
+	( *queue )->worker.queue             = *queue;
+	( *queue )->worker.worker_index      = 0;
+	( *queue )->worker.number_of_workers = 1;
+
+	return( 1 );
+
+on_error:
+	if( *queue != NULL )
+	{
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a queue
+ * Sources that were not flushed are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_free(
+     winshelllink_queue_t **queue,
+     libcerror_error_t **error )
+{
+	static char *function = "winshelllink_queue_free";
+	size_t task_index     = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		winshelllink_queue_worker_close(
+		 &( ( *queue )->worker ) );
+
+		for( task_index = 0;
+		     task_index < WINSHELLLINK_QUEUE_BATCH_SIZE;
+		     task_index++ )
+		{
+			if( ( *queue )->tasks[ task_index ].filename != NULL )
+			{
+				memory_free(
+				 ( *queue )->tasks[ task_index ].filename );
+			}
+			if( ( *queue )->tasks[ task_index ].output_data != NULL )
+			{
+				memory_free(
+				 ( *queue )->tasks[ task_index ].output_data );
+			}
+		}
+		memory_free(
+		 *queue );
+
+		*queue = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the recursive value
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_set_recursive(
+     winshelllink_queue_t *queue,
+     uint8_t recursive,
+     libcerror_error_t **error )
+{
+	static char *function = "winshelllink_queue_set_recursive";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	queue->recursive = recursive;
+
+	return( 1 );
+}
+
+/* Determines if a name has the shell link file extension .lnk
+ * Returns 1 if the name has the extension or 0 if not
+ */
+int winshelllink_queue_is_shell_link_name(
+     const system_character_t *name,
+     size_t name_length )
+{
+	if( ( name == NULL )
+	 || ( name_length < 5 ) )
+	{
+		return( 0 );
+	}
+	if( ( name[ name_length - 4 ] == (system_character_t) '.' )
+	 && ( ( name[ name_length - 3 ] == (system_character_t) 'l' )
+	  ||  ( name[ name_length - 3 ] == (system_character_t) 'L' ) )
+	 && ( ( name[ name_length - 2 ] == (system_character_t) 'n' )
+	  ||  ( name[ name_length - 2 ] == (system_character_t) 'N' ) )
+	 && ( ( name[ name_length - 1 ] == (system_character_t) 'k' )
+	  ||  ( name[ name_length - 1 ] == (system_character_t) 'K' ) ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+#if defined( WINSHELLLINK_QUEUE_HAVE_DIRECTORY_WALK )
+
+/* Compares two directory entry names
+ * Returns a value less than, equal to or greater than 0
+ */
+int winshelllink_queue_compare_entry_names(
+     const void *first_entry_name,
+     const void *second_entry_name )
+{
+	const system_character_t *first_name  = *( (const system_character_t **) first_entry_name );
+	const system_character_t *second_name = *( (const system_character_t **) second_entry_name );
+	size_t first_name_length              = system_string_length( first_name );
+	size_t second_name_length             = system_string_length( second_name );
+
+	/* Include the end-of-string character of the shortest name in the comparison
+	 */
+	if( first_name_length > second_name_length )
+	{
+		first_name_length = second_name_length;
+	}
+	return( system_string_compare(
+	         first_name,
+	         second_name,
+	         first_name_length + 1 ) );
+}
+
+/* Appends a directory entry name to an array of names
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_append_entry_name(
+     system_character_t ***entry_names,
+     size_t *number_of_entry_names,
+     size_t *number_of_allocated_entry_names,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+	system_character_t **reallocated_entry_names = NULL;
+	static char *function                        = "winshelllink_queue_append_entry_name";
+	size_t name_size                             = 0;
+
+	if( *number_of_entry_names >= *number_of_allocated_entry_names )
+	{
+		if( *number_of_allocated_entry_names == 0 )
+		{
+			*number_of_allocated_entry_names = 64;
+		}
+		else
+		{
+			*number_of_allocated_entry_names *= 2;
+		}
+		reallocated_entry_names = (system_character_t **) memory_reallocate(
+		                                                   *entry_names,
+		                                                   sizeof( system_character_t * ) * *number_of_allocated_entry_names );
+
+		if( reallocated_entry_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entry names.",
+			 function );
+
+			return( -1 );
+		}
+		*entry_names = reallocated_entry_names;
+	}
+	name_size = system_string_length(
+	             name ) + 1;
+
+	( *entry_names )[ *number_of_entry_names ] = system_string_allocate(
+	                                              name_size );
+
+	if( ( *entry_names )[ *number_of_entry_names ] == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     ( *entry_names )[ *number_of_entry_names ],
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		memory_free(
+		 ( *entry_names )[ *number_of_entry_names ] );
+
+		return( -1 );
+	}
+	*number_of_entry_names += 1;
+
+	return( 1 );
+}
+
+/* Appends the shell link files in a directory and its sub directories to the queue
+ * The entries of a directory are appended sorted by name, symbolic links
+ * to directories in the directory are not followed
+ * Returns 1 if successful, 0 if the path is not a directory or -1 on error
+ */
+int winshelllink_queue_append_directory(
+     winshelllink_queue_t *queue,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	system_character_t **entry_names       = NULL;
+	system_character_t *entry_path         = NULL;
+	static char *function                  = "winshelllink_queue_append_directory";
+	size_t entry_name_index                = 0;
+	size_t entry_name_length               = 0;
+	size_t entry_path_length               = 0;
+	size_t number_of_allocated_entry_names = 0;
+	size_t number_of_entry_names           = 0;
+	int result                             = 0;
+
+#if defined( WINAPI )
+	system_character_t *find_path          = NULL;
+	HANDLE find_handle                     = INVALID_HANDLE_VALUE;
+	DWORD file_attributes                  = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+#else
+	struct dirent *directory_entry         = NULL;
+	DIR *directory                         = NULL;
+	struct stat file_statistics;
+#endif
+
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_attributes = GetFileAttributesW(
+	                   path );
+#else
+	file_attributes = GetFileAttributesA(
+	                   path );
+#endif
+	if( ( file_attributes == INVALID_FILE_ATTRIBUTES )
+	 || ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+	 || ( ( file_attributes & FILE_ATTRIBUTE_REPARSE_POINT ) != 0 ) )
+	{
+		return( 0 );
+	}
+	find_path = system_string_allocate(
+	             path_length + 3 );
+
+	if( find_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create find path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     find_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy find path.",
+		 function );
+
+		goto on_error;
+	}
+	find_path[ path_length ]     = (system_character_t) WINSHELLLINK_QUEUE_PATH_SEPARATOR;
+	find_path[ path_length + 1 ] = (system_character_t) '*';
+	find_path[ path_length + 2 ] = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               find_path,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               find_path,
+	               &find_data );
+#endif
+	memory_free(
+	 find_path );
+
+	find_path = NULL;
+
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	do
+	{
+		if( ( find_data.cFileName[ 0 ] == (system_character_t) '.' )
+		 && ( ( find_data.cFileName[ 1 ] == 0 )
+		  || ( ( find_data.cFileName[ 1 ] == (system_character_t) '.' )
+		   && ( find_data.cFileName[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+		 && ( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT ) != 0 ) )
+		{
+			continue;
+		}
+		if( winshelllink_queue_append_entry_name(
+		     &entry_names,
+		     &number_of_entry_names,
+		     &number_of_allocated_entry_names,
+		     find_data.cFileName,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( FindNextFileW(
+	        find_handle,
+	        &find_data ) != 0 );
+#else
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+#endif
+
+	FindClose(
+	 find_handle );
+
+	find_handle = INVALID_HANDLE_VALUE;
+#else
+	if( stat(
+	     path,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( !S_ISDIR( file_statistics.st_mode ) )
+	{
+		return( 0 );
+	}
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	for( directory_entry = readdir( directory );
+	     directory_entry != NULL;
+	     directory_entry = readdir( directory ) )
+	{
+		if( ( directory_entry->d_name[ 0 ] == '.' )
+		 && ( ( directory_entry->d_name[ 1 ] == 0 )
+		  || ( ( directory_entry->d_name[ 1 ] == '.' )
+		   && ( directory_entry->d_name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( winshelllink_queue_append_entry_name(
+		     &entry_names,
+		     &number_of_entry_names,
+		     &number_of_allocated_entry_names,
+		     directory_entry->d_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	closedir(
+	 directory );
+
+	directory = NULL;
+#endif /* defined( WINAPI ) */
+
+	/* Sort the entries so the output does not depend on the order
+	 * in which the file system returns them
+	 */
+	if( number_of_entry_names > 1 )
+	{
+		qsort(
+		 entry_names,
+		 number_of_entry_names,
+		 sizeof( system_character_t * ),
+		 &winshelllink_queue_compare_entry_names );
+	}
+	if( ( path_length > 0 )
+	 && ( path[ path_length - 1 ] == (system_character_t) WINSHELLLINK_QUEUE_PATH_SEPARATOR ) )
+	{
+		path_length--;
+	}
+	for( entry_name_index = 0;
+	     entry_name_index < number_of_entry_names;
+	     entry_name_index++ )
+	{
+		entry_name_length = system_string_length(
+		                     entry_names[ entry_name_index ] );
+
+		entry_path_length = path_length + 1 + entry_name_length;
+
+		entry_path = system_string_allocate(
+		              entry_path_length + 1 );
+
+		if( entry_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     entry_path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path to entry path.",
+			 function );
+
+			goto on_error;
+		}
+		entry_path[ path_length ] = (system_character_t) WINSHELLLINK_QUEUE_PATH_SEPARATOR;
+
+		if( system_string_copy(
+		     &( entry_path[ path_length + 1 ] ),
+		     entry_names[ entry_name_index ],
+		     entry_name_length + 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name to entry path.",
+			 function );
+
+			goto on_error;
+		}
+#if !defined( WINAPI )
+		if( ( lstat(
+		       entry_path,
+		       &file_statistics ) == 0 )
+		 && S_ISLNK( file_statistics.st_mode )
+		 && ( stat(
+		       entry_path,
+		       &file_statistics ) == 0 )
+		 && S_ISDIR( file_statistics.st_mode ) )
+		{
+			result = 1;
+		}
+		else
+#endif
+		{
+			result = winshelllink_queue_append_directory(
+			          queue,
+			          entry_path,
+			          entry_path_length,
+			          error );
+
+			/* Only files with a .lnk extension are appended from a directory
+			 */
+			if( result == 0 )
+			{
+				result = 1;
+
+				if( winshelllink_queue_is_shell_link_name(
+				     entry_names[ entry_name_index ],
+				     entry_name_length ) != 0 )
+				{
+					result = winshelllink_queue_append_task(
+					          queue,
+					          entry_path,
+					          entry_path_length,
+					          error );
+				}
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source: %" PRIs_SYSTEM ".",
+			 function,
+			 entry_path );
+
+			goto on_error;
+		}
+		memory_free(
+		 entry_path );
+
+		entry_path = NULL;
+
+		memory_free(
+		 entry_names[ entry_name_index ] );
+
+		entry_names[ entry_name_index ] = NULL;
+	}
+	if( entry_names != NULL )
+	{
+		memory_free(
+		 entry_names );
+	}
+	return( 1 );
+
+on_error:
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+#if defined( WINAPI )
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+	if( find_path != NULL )
+	{
+		memory_free(
+		 find_path );
+	}
+#else
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+#endif
+	if( entry_names != NULL )
+	{
+		for( entry_name_index = 0;
+		     entry_name_index < number_of_entry_names;
+		     entry_name_index++ )
+		{
+			if( entry_names[ entry_name_index ] != NULL )
+			{
+				memory_free(
+				 entry_names[ entry_name_index ] );
+			}
+		}
+		memory_free(
+		 entry_names );
+	}
+	return( -1 );
+}
+
+#endif /* defined( WINSHELLLINK_QUEUE_HAVE_DIRECTORY_WALK ) */
+
+/* Appends a shell link file to the queue
+ * The current batch is flushed when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_append_task(
+     winshelllink_queue_t *queue,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	winshelllink_queue_task_t *task   = NULL;
+	system_character_t *safe_filename = NULL;
+	static char *function             = "winshelllink_queue_append_task";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_filename = system_string_allocate(
+	                 filename_length + 1 );
+
+	if( safe_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     safe_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		memory_free(
+		 safe_filename );
+
+		return( -1 );
+	}
+	safe_filename[ filename_length ] = 0;
+
+	/* The output data of the task is retained from the previous batch
+	 */
+	task = &( queue->tasks[ queue->number_of_tasks ] );
+
+	task->filename         = safe_filename;
+	task->output_data_size = 0;
+	task->result           = 0;
+
+	queue->number_of_tasks += 1;
+
+	if( queue->number_of_tasks >= WINSHELLLINK_QUEUE_BATCH_SIZE )
+	{
+		if( winshelllink_queue_flush(
+		     queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a source to the queue
+ * If the queue is recursive and the source is a directory the shell link files
+ * in the directory are appended instead
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_append_source(
+     winshelllink_queue_t *queue,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "winshelllink_queue_append_source";
+
+#if defined( WINSHELLLINK_QUEUE_HAVE_DIRECTORY_WALK )
+	int result            = 0;
+#endif
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINSHELLLINK_QUEUE_HAVE_DIRECTORY_WALK )
+	if( queue->recursive != 0 )
+	{
+		result = winshelllink_queue_append_directory(
+		          queue,
+		          filename,
+		          filename_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			return( 1 );
+		}
+	}
+#endif
+	if( winshelllink_queue_append_task(
+	     queue,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append task.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the sources in a file list to the queue
+ * The file list contains a source per line, empty lines are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_append_sources_from_file_list(
+     winshelllink_queue_t *queue,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *line = NULL;
+	FILE *file_list_stream   = NULL;
+	static char *function    = "winshelllink_queue_append_sources_from_file_list";
+	size_t line_length       = 0;
+	size_t line_number       = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	line = system_string_allocate(
+	        WINSHELLLINK_QUEUE_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_list_stream = file_stream_open_wide(
+	                    filename,
+	                    _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	file_list_stream = file_stream_open(
+	                    filename,
+	                    FILE_STREAM_OPEN_READ );
+#endif
+	if( file_list_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file list: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        file_list_stream,
+	        line,
+	        WINSHELLLINK_QUEUE_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        file_list_stream,
+	        line,
+	        WINSHELLLINK_QUEUE_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( WINSHELLLINK_QUEUE_MAXIMUM_LINE_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line: %" PRIzd " value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length--;
+		}
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		line[ line_length ] = 0;
+
+		if( winshelllink_queue_append_source(
+		     queue,
+		     line,
+		     line_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source of line: %" PRIzd ".",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_list_stream ) != 0 )
+	{
+		file_list_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file list.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( file_list_stream != NULL )
+	{
+		file_stream_close(
+		 file_list_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+
+
+/* Processes the shell link files of the current batch and prints their values in input order
+ * Every worker thread reuses a single shell link for all its files, a shell link
+ * file that cannot be read is reported on stderr and counted as failed
+ * Returns 1 if successful or -1 on error
+ */
+int winshelllink_queue_flush(
+     winshelllink_queue_t *queue,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ WINSHELLLINK_QUEUE_MAXIMUM_NUMBER_OF_THREADS ];
+	winshelllink_queue_worker_t workers[ WINSHELLLINK_QUEUE_MAXIMUM_NUMBER_OF_THREADS ];
+
+	int number_of_workers                  = 0;
+	int worker_index                       = 0;
+#endif
+
+	winshelllink_queue_task_t *task        = NULL;
+	static char *function                  = "winshelllink_queue_flush";
+	size_t task_index                      = 0;
+	size_t write_count                     = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue->number_of_tasks == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( queue->number_of_threads > 1 )
+	 && ( queue->number_of_tasks > 1 ) )
+	{
+		number_of_workers = queue->number_of_threads;
+
+		if( (size_t) number_of_workers > queue->number_of_tasks )
+		{
+			number_of_workers = (int) queue->number_of_tasks;
+		}
+		if( memory_set(
+		     threads,
+		     0,
+		     sizeof( libcthreads_thread_t * ) * WINSHELLLINK_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear threads.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     workers,
+		     0,
+		     sizeof( winshelllink_queue_worker_t ) * WINSHELLLINK_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear workers.",
+			 function );
+
+			return( -1 );
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			workers[ worker_index ].queue             = queue;
+			workers[ worker_index ].worker_index      = worker_index;
+			workers[ worker_index ].number_of_workers = number_of_workers;
+
+			if( libcthreads_thread_create(
+			     &( threads[ worker_index ] ),
+			     NULL,
+			     (int (*)(void *)) &winshelllink_queue_worker_callback,
+			     (void *) &( workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create worker thread: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join worker thread: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( task_index = 0;
+	     task_index < queue->number_of_tasks;
+	     task_index++ )
+	{
+		task = &( queue->tasks[ task_index ] );
+
+		/* Without worker threads, or if a worker thread could not create
+		 * its shell link, the task is processed here
+		 */
+		if( task->result == 0 )
+		{
+			task->result = winshelllink_queue_worker_open(
+			                &( queue->worker ),
+			                NULL );
+
+			if( task->result == 1 )
+			{
+				task->result = winshelllink_queue_task_process(
+				                task,
+				                &( queue->worker ),
+				                NULL );
+			}
+		}
+		if( task->result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read shell link: %" PRIs_SYSTEM "\n",
+			 task->filename );
+
+			queue->number_of_failed_sources += 1;
+		}
+		else
+		{
+			fprintf(
+			 queue->output_stream,
+			 "Shell link: %" PRIs_SYSTEM "\n",
+			 task->filename );
+
+			if( task->output_data_size > 0 )
+			{
+				write_count = file_stream_write(
+				               queue->output_stream,
+				               task->output_data,
+				               task->output_data_size );
+
+				if( write_count != task->output_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write output of task: %" PRIzd ".",
+					 function,
+					 task_index );
+
+					return( -1 );
+				}
+			}
+			fprintf(
+			 queue->output_stream,
+			 "\n" );
+		}
+		memory_free(
+		 task->filename );
+
+		task->filename         = NULL;
+		task->output_data_size = 0;
+		task->result           = 0;
+	}
+	queue->number_of_tasks = 0;
+
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( threads[ worker_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ worker_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+#endif
+}
+
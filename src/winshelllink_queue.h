@@ -0,0 +1,255 @@
+/*
+ * Winshelllink work queue
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _WINSHELLLINK_QUEUE_H )
+#define _WINSHELLLINK_QUEUE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#include <shobjidl.h>
+#include <objbase.h>
+#include <objidl.h>
+#include <shlguid.h>
+#endif
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Directories can be walked on Windows and on POSIX systems with dirent
+ * that use narrow system strings
+ */
+#if defined( WINAPI )
+#define WINSHELLLINK_QUEUE_HAVE_DIRECTORY_WALK	1
+#define WINSHELLLINK_QUEUE_PATH_SEPARATOR	'\\'
+
+#elif defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define WINSHELLLINK_QUEUE_HAVE_DIRECTORY_WALK	1
+#define WINSHELLLINK_QUEUE_PATH_SEPARATOR	'/'
+
+#endif
+
+/* The number of shell link files that are processed in a single batch
+ * the output of a batch is printed in input order before the next batch is started
+ */
+#define WINSHELLLINK_QUEUE_BATCH_SIZE		1024
+
+/* The maximum number of worker threads
+ */
+#define WINSHELLLINK_QUEUE_MAXIMUM_NUMBER_OF_THREADS	64
+
+typedef struct winshelllink_queue_task winshelllink_queue_task_t;
+
+struct winshelllink_queue_task
+{
+	/* The source filename
+	 */
+	system_character_t *filename;
+
+	/* The output data, which is retained between batches
+	 */
+	char *output_data;
+
+	/* The size of the output data
+	 */
+	size_t output_data_size;
+
+	/* The allocated size of the output data
+	 */
+	size_t allocated_output_data_size;
+
+	/* The result of the task, 0 if not processed
+	 */
+	int result;
+};
+
+typedef struct winshelllink_queue winshelllink_queue_t;
+
+typedef struct winshelllink_queue_worker winshelllink_queue_worker_t;
+
+struct winshelllink_queue_worker
+{
+	/* The queue
+	 */
+	winshelllink_queue_t *queue;
+
+	/* The index of the first task of the worker
+	 */
+	int worker_index;
+
+	/* The number of workers, a worker processes every number of workers task
+	 */
+	int number_of_workers;
+
+	/* Value to indicate the shell link was created
+	 */
+	uint8_t is_open;
+
+#if defined( WINAPI )
+	/* The shell link, which is reused for every shell link file of the worker
+	 */
+	IShellLinkW *shell_link;
+
+	/* The persist file interface of the shell link
+	 */
+	IPersistFile *persist_file;
+#endif
+};
+
+struct winshelllink_queue
+{
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate directories should be walked recursively
+	 */
+	uint8_t recursive;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* The worker of the calling thread, which is retained between batches
+	 */
+	winshelllink_queue_worker_t worker;
+
+	/* The tasks of the current batch
+	 */
+	winshelllink_queue_task_t tasks[ WINSHELLLINK_QUEUE_BATCH_SIZE ];
+
+	/* The number of tasks in the current batch
+	 */
+	size_t number_of_tasks;
+
+	/* The number of sources that could not be processed
+	 */
+	size_t number_of_failed_sources;
+};
+
+int winshelllink_queue_task_append_string(
+     winshelllink_queue_task_t *task,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+#if defined( WINAPI )
+
+int winshelllink_queue_task_append_value(
+     winshelllink_queue_task_t *task,
+     const char *description,
+     const wchar_t *value,
+     libcerror_error_t **error );
+
+#endif /* defined( WINAPI ) */
+
+int winshelllink_queue_task_process(
+     winshelllink_queue_task_t *task,
+     winshelllink_queue_worker_t *worker,
+     libcerror_error_t **error );
+
+int winshelllink_queue_worker_open(
+     winshelllink_queue_worker_t *worker,
+     libcerror_error_t **error );
+
+void winshelllink_queue_worker_close(
+      winshelllink_queue_worker_t *worker );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int winshelllink_queue_worker_callback(
+     winshelllink_queue_worker_t *worker );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int winshelllink_queue_initialize(
+     winshelllink_queue_t **queue,
+     int number_of_threads,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+int winshelllink_queue_free(
+     winshelllink_queue_t **queue,
+     libcerror_error_t **error );
+
+int winshelllink_queue_set_recursive(
+     winshelllink_queue_t *queue,
+     uint8_t recursive,
+     libcerror_error_t **error );
+
+int winshelllink_queue_is_shell_link_name(
+     const system_character_t *name,
+     size_t name_length );
+
+#if defined( WINSHELLLINK_QUEUE_HAVE_DIRECTORY_WALK )
+
+int winshelllink_queue_compare_entry_names(
+     const void *first_entry_name,
+     const void *second_entry_name );
+
+int winshelllink_queue_append_entry_name(
+     system_character_t ***entry_names,
+     size_t *number_of_entry_names,
+     size_t *number_of_allocated_entry_names,
+     const system_character_t *name,
+     libcerror_error_t **error );
+
+int winshelllink_queue_append_directory(
+     winshelllink_queue_t *queue,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+#endif /* defined( WINSHELLLINK_QUEUE_HAVE_DIRECTORY_WALK ) */
+
+int winshelllink_queue_append_task(
+     winshelllink_queue_t *queue,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int winshelllink_queue_append_source(
+     winshelllink_queue_t *queue,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int winshelllink_queue_append_sources_from_file_list(
+     winshelllink_queue_t *queue,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int winshelllink_queue_flush(
+     winshelllink_queue_t *queue,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _WINSHELLLINK_QUEUE_H ) */
+
@@ -30,14 +30,21 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_async_file.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_memory_map.h"
 #include "assorted_output.h"
 #include "assorted_system_string.h"
 #include "assorted_xor64.h"
 
+/* The size of the chunks the source file is read in, which is a multiple
+ * of 8 to keep the alignment of the 64-bit values across chunks
+ */
+#define XOR64SUM_CHUNK_SIZE	( 4 * 1024 * 1024 )
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -50,14 +57,17 @@ void usage_fprint(
 	fprintf( stream, "Use xor64sum to calculate a 64-bit XOR-64 of file data.\n\n" );
 
 	fprintf( stream, "Usage: xor64sum [ -i initial_value ] [ -o offset ] [ -s size ]\n"
-	                 "                [ -12hvV ] source\n\n" );
+	                 "                [ -123AhMvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the basic calculation method\n" );
-	fprintf( stream, "\t-2:     use the cpu-aligned calculation method (default)\n" );
+	fprintf( stream, "\t-2:     use the cpu-aligned calculation method\n" );
+	fprintf( stream, "\t-3:     use the SIMD calculation method (default)\n" );
+	fprintf( stream, "\t-A:     use asynchronous direct I/O instead of reading the source file\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial XOR-64 (default is 0)\n" );
+	fprintf( stream, "\t-M:     use memory mapped input instead of reading the source file\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
@@ -73,20 +83,29 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "xor64sum";
-	system_integer_t option      = 0;
-	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
-	off_t source_offset          = 0;
-	uint64_t checksum_value      = 0;
-	uint64_t initial_value       = 0;
-	int calculation_method       = 2;
-	int result                   = 0;
-	int verbose                  = 0;
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *source_file      = NULL;
+	assorted_async_file_t *async_file = NULL;
+	assorted_memory_map_t *memory_map = NULL;
+	system_character_t *source        = NULL;
+	const uint8_t *chunk_data         = NULL;
+	uint8_t *buffer                   = NULL;
+	char *program                     = "xor64sum";
+	system_integer_t option           = 0;
+	size64_t remaining_size           = 0;
+	size64_t source_size              = 0;
+	size_t chunk_data_size            = 0;
+	size_t chunk_size                 = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	off_t source_offset               = 0;
+	uint64_t checksum_value           = 0;
+	uint64_t initial_value            = 0;
+	int calculation_method            = 3;
+	int result                        = 0;
+	int use_asynchronous_io           = 0;
+	int use_memory_map                = 0;
+	int verbose                       = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -95,7 +114,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "123AhMi:o:s:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -121,6 +140,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case '3':
+				calculation_method = 3;
+
+				break;
+
+			case 'A':
+				use_asynchronous_io = 1;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -132,6 +161,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'M':
+				use_memory_map = 1;
+
+				break;
+
 			case 'o':
 				source_offset = system_string_copy_to_long( optarg );
 
@@ -228,24 +262,152 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX )
+	chunk_size = XOR64SUM_CHUNK_SIZE;
+
+	if( ( calculation_method == 1 )
+	 || ( calculation_method == 2 ) )
 	{
+		/* The basic and cpu-aligned calculation methods cannot be continued from
+		 * the XOR-64 of the preceding data, hence the data is calculated as a single chunk
+		 */
+		if( source_size > (size64_t) SSIZE_MAX )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		chunk_size = (size_t) source_size;
+
+		if( use_asynchronous_io != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Asynchronous I/O not supported by the calculation method, reading source file instead.\n" );
+
+			use_asynchronous_io = 0;
+		}
+	}
+	if( ( calculation_method == 2 )
+	 && ( use_memory_map != 0 ) )
+	{
+		/* The cpu-aligned calculation method depends on the alignment of the data
+		 * in memory, hence the data is read into a buffer
+		 */
 		fprintf(
 		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		 "Memory mapped input not supported by the cpu-aligned calculation method, reading source file instead.\n" );
 
-		goto on_error;
+		use_memory_map = 0;
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * (size_t) source_size );
+	if( use_memory_map != 0 )
+	{
+		if( assorted_memory_map_initialize(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create memory map.\n" );
+
+			goto on_error;
+		}
+		result = assorted_memory_map_open(
+		          memory_map,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to memory map source file.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Memory mapped input not supported, reading source file instead.\n" );
+
+			if( assorted_memory_map_free(
+			     &memory_map,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free memory map.\n" );
 
-	if( buffer == NULL )
+				goto on_error;
+			}
+		}
+	}
+	if( ( use_asynchronous_io != 0 )
+	 && ( memory_map == NULL ) )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		if( assorted_async_file_initialize(
+		     &async_file,
+		     chunk_size,
+		     ASSORTED_ASYNC_FILE_DEFAULT_QUEUE_DEPTH,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create asynchronous file.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = assorted_async_file_open(
+		          async_file,
+		          source,
+		          source_offset,
+		          source_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file for asynchronous I/O.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Asynchronous I/O not supported, reading source file instead.\n" );
+
+			if( assorted_async_file_free(
+			     &async_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free asynchronous file.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( memory_map == NULL )
+	 && ( async_file == NULL ) )
+	{
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * chunk_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Position the source file at the right offset
 	 */
@@ -261,19 +423,130 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	/* The data is read in chunks, where the XOR-64 of the preceding chunks
+	 * is used as the initial value of the next chunk, except for the basic
+	 * and cpu-aligned calculation methods of which the data is a single chunk
+	 */
+	checksum_value = initial_value;
+	remaining_size = source_size;
 
-	if( read_count != (ssize_t) source_size )
+	while( remaining_size > 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		read_size = chunk_size;
 
-		goto on_error;
+		if( remaining_size < (size64_t) read_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		if( memory_map != NULL )
+		{
+			chunk_data = &( memory_map->data[ source_size - remaining_size ] );
+		}
+		else if( async_file != NULL )
+		{
+			result = assorted_async_file_read_next(
+			          async_file,
+			          &chunk_data,
+			          &chunk_data_size,
+			          &error );
+
+			if( ( result != 1 )
+			 || ( chunk_data_size != read_size ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			read_count = libcfile_file_read_buffer(
+				      source_file,
+				      buffer,
+				      read_size,
+				      &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read from source file.\n" );
+
+				goto on_error;
+			}
+			chunk_data = buffer;
+		}
+		if( calculation_method == 1 )
+		{
+			result = assorted_xor64_calculate_checksum_little_endian_basic(
+			          &checksum_value,
+			          chunk_data,
+			          read_size,
+			          checksum_value,
+			          &error );
+		}
+		else if( calculation_method == 2 )
+		{
+			result = assorted_xor64_calculate_checksum_little_endian_cpu_aligned(
+			          &checksum_value,
+			          chunk_data,
+			          read_size,
+			          checksum_value,
+			          &error );
+		}
+		else if( calculation_method == 3 )
+		{
+			result = assorted_xor64_calculate_checksum_little_endian_simd(
+			          &checksum_value,
+			          chunk_data,
+			          read_size,
+			          checksum_value,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate XOR-64.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 chunk_data,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
+	}
+	if( memory_map != NULL )
+	{
+		if( assorted_memory_map_free(
+		     &memory_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free memory map.\n" );
+
+			goto on_error;
+		}
+	}
+	if( async_file != NULL )
+	{
+		if( assorted_async_file_free(
+		     &async_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free asynchronous file.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
@@ -297,39 +570,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( calculation_method == 1 )
-	{
-		result = assorted_xor64_calculate_checksum_little_endian_basic(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
-	}
-	else if( calculation_method == 2 )
-	{
-		result = assorted_xor64_calculate_checksum_little_endian_cpu_aligned(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
-	}
-	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate XOR-64.\n" );
-
-		goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
 	memory_free(
 	 buffer );
 
@@ -349,6 +589,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	if( async_file != NULL )
+	{
+		assorted_async_file_free(
+		 &async_file,
+		 NULL );
+	}
 	if( buffer != NULL )
 	{
 		memory_free(
@@ -35,6 +35,7 @@
 #endif
 
 #include "assorted_deflate.h"
+#include "assorted_deflate_parallel.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
@@ -53,16 +54,23 @@ void usage_fprint(
 	fprintf( stream, "Use zcompress to compress data as zlib compressed data.\n\n" );
 
 	fprintf( stream, "Usage: zcompress [ -l compression_level ] [ -o offset ]\n"
-	                 "                 [ -s size ] [ -12hvV ] source\n\n" );
+	                 "                 [ -s size ] [ -j number_of_threads ]\n"
+	                 "                 [ -12hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the zlib compression method\n" );
 	fprintf( stream, "\t-2:     use the internal compression method (default)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
-	fprintf( stream, "\t-l:     compression level (default is -1)\n" );
+	fprintf( stream, "\t-j:     number of threads used by the internal compression\n"
+	                 "\t        method, if more than 1 the data is compressed in\n"
+	                 "\t        chunks of 128 KiB in parallel (default is 1)\n" );
+	fprintf( stream, "\t-l:     compression level (default is -1), the internal\n"
+	                 "\t        compression method also supports level 10 that uses\n"
+	                 "\t        optimal parsing for archival\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
@@ -92,6 +100,7 @@ int main( int argc, char * const argv[] )
 	ssize_t write_count               = 0;
 	off_t source_offset               = 0;
 	int compression_method            = 2;
+	int number_of_threads             = 1;
 	int print_count                   = 0;
 	int result                        = 0;
 	int verbose                       = 0;
@@ -127,7 +136,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12hl:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12hj:l:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -183,6 +192,15 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case 'j':
+			case 't':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				number_of_threads = _wtol( optarg );
+#else
+				number_of_threads = atol( optarg );
+#endif
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -438,13 +456,28 @@ int main( int argc, char * const argv[] )
 	}
 	else if( compression_method == 2 )
 	{
-		if( assorted_deflate_compress(
-		     buffer,
-		     source_size,
-		     compression_level,
-		     compressed_data,
-		     &compressed_data_size,
-		     &error ) != 1 )
+		if( number_of_threads > 1 )
+		{
+			result = assorted_deflate_parallel_compress_zlib(
+			          buffer,
+			          source_size,
+			          compression_level,
+			          number_of_threads,
+			          compressed_data,
+			          &compressed_data_size,
+			          &error );
+		}
+		else
+		{
+			result = assorted_deflate_compress_zlib(
+			          buffer,
+			          source_size,
+			          compression_level,
+			          compressed_data,
+			          &compressed_data_size,
+			          &error );
+		}
+		if( result != 1 )
 		{
 			fprintf(
 			 stderr,
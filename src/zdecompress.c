@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -30,17 +31,33 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_DECODE_STATISTICS )
+#include <time.h>
+#endif
+
 #if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
 #include <zlib.h>
 #endif
 
 #include "assorted_deflate.h"
+#include "assorted_deflate_index.h"
+#include "assorted_deflate_parallel.h"
+#include "assorted_deflate_stream.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "assorted_progress.h"
+#include "assorted_signal.h"
 #include "assorted_system_string.h"
+#include "assorted_unused.h"
+
+/* The size of the buffers used by the internal decompression method
+ */
+#define ZDECOMPRESS_BUFFER_SIZE		65536
+
+assorted_progress_t *zdecompress_progress = NULL;
 
 /* Prints the executable usage information
  */
@@ -51,408 +68,1933 @@ void usage_fprint(
 	{
 		return;
 	}
-	fprintf( stream, "Use zdecompress to decompress data as zlib compressed data.\n\n" );
+	fprintf( stream, "Use zdecompress to decompress data as zlib or gzip compressed data.\n\n" );
 
-	fprintf( stream, "Usage: zdecompress [ -o offset ] [ -s size ] [ -12hvV ] source\n\n" );
+	fprintf( stream, "Usage: zdecompress [ -c spacing ] [ -i index_file ] [ -l length ]\n"
+	                 "                   [ -o offset ] [ -s size ] [ -j number_of_threads ]\n"
+	                 "                   [ -u uncompressed_offset ] [ -12ThvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-1:     use the zlib decompression method\n" );
 	fprintf( stream, "\t-2:     use the internal decompression method (default)\n" );
+	fprintf( stream, "\t-c:     uncompressed distance between index checkpoints\n"
+	                 "\t        (default is 1048576)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     index file, the index is read if the file exists\n"
+	                 "\t        otherwise it is created while decompressing\n" );
+	fprintf( stream, "\t-j:     number of threads used by the internal decompression\n"
+	                 "\t        method (default is 1), multiple threads cannot be\n"
+	                 "\t        combined with an index file\n" );
+	fprintf( stream, "\t-l:     length of the uncompressed data to write\n"
+	                 "\t        (default is all the data after the uncompressed offset)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-T:     only verify the compressed data, the decompressed data\n"
+	                 "\t        is not stored, cannot be combined with an index file\n"
+	                 "\t        or multiple threads\n" );
+	fprintf( stream, "\t-u:     uncompressed offset of the data to write (default is 0)\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
 }
 
-/* The main program
+/* Reads an index from a file
+ * Returns 1 if successful or -1 on error
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain( int argc, wchar_t * const argv[] )
-#else
-int main( int argc, char * const argv[] )
-#endif
+int zdecompress_read_index_file(
+     assorted_deflate_index_t *index,
+     const system_character_t *filename,
+     libcerror_error_t **error )
 {
-	char destination[ 128 ];
-
-	libcerror_error_t *error           = NULL;
-	libcfile_file_t *destination_file  = NULL;
-	libcfile_file_t *source_file       = NULL;
-	system_character_t *source         = NULL;
-	uint8_t *buffer                    = NULL;
-	uint8_t *uncompressed_data         = NULL;
-	char *program                      = "zdecompress";
-	system_integer_t option            = 0;
-	size64_t source_size               = 0;
-	size_t uncompressed_data_size      = 0;
-	ssize_t read_count                 = 0;
-	ssize_t write_count                = 0;
-	off_t source_offset                = 0;
-	int decompression_method           = 2;
-	int print_count                    = 0;
-	int result                         = 0;
-	int verbose                        = 0;
-
-#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
-	uLongf zlib_uncompressed_data_size = 0;
-#endif
-
-	assorted_output_version_fprint(
-	 stdout,
-	 program );
-
-	while( ( option = assorted_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "12ho:s:vV" ) ) ) != (system_integer_t) -1 )
-	{
-		switch( option )
-		{
-			case '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM "\n",
-				 argv[ optind ] );
-
-				usage_fprint(
-				 stdout );
-
-				return( EXIT_FAILURE );
-
-			case '1':
-				decompression_method = 1;
-
-				break;
-
-			case '2':
-				decompression_method = 2;
-
-				break;
-
-			case 'h':
-				usage_fprint(
-				 stdout );
-
-				return( EXIT_SUCCESS );
-
-			case 'o':
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				source_offset = _wtol( optarg );
-#else
-				source_offset = atol( optarg );
-#endif
-				break;
-
-			case 's':
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				source_size = _wtol( optarg );
-#else
-				source_size = atol( optarg );
-#endif
-				break;
-
-			case 'v':
-				verbose = 1;
-
-				break;
-
-			case 'V':
-				assorted_output_copyright_fprint(
-				 stdout );
-
-				return( EXIT_SUCCESS );
-		}
-	}
-	if( optind == argc )
-	{
-		fprintf(
-		 stderr,
-		 "Missing source file.\n" );
-
-		usage_fprint(
-		 stdout );
-
-		return( EXIT_FAILURE );
-	}
-	source = argv[ optind ];
-
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-	libcnotify_verbose_set(
-	 verbose );
+	libcfile_file_t *index_file = NULL;
+	uint8_t *index_data         = NULL;
+	static char *function       = "zdecompress_read_index_file";
+	size64_t index_data_size    = 0;
+	ssize_t read_count          = 0;
+	int result                  = 0;
 
-	/* Open the source file
-	 */
 	if( libcfile_file_initialize(
-	     &source_file,
-	     &error ) != 1 )
+	     &index_file,
+	     error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create source file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file.",
+		 function );
 
 		goto on_error;
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libcfile_file_open_wide(
-	          source_file,
-	          source,
+	          index_file,
+	          filename,
 	          LIBCFILE_OPEN_READ,
-	          &error );
+	          error );
 #else
 	result = libcfile_file_open(
-	          source_file,
-	          source,
+	          index_file,
+	          filename,
 	          LIBCFILE_OPEN_READ,
-	          &error );
+	          error );
 #endif
- 	if( result != 1 )
+	if( result != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open source file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
 
 		goto on_error;
 	}
-	if( source_size == 0 )
+	if( libcfile_file_get_size(
+	     index_file,
+	     &index_data_size,
+	     error ) != 1 )
 	{
-		if( libcfile_file_get_size(
-		     source_file,
-		     &source_size,
-		     &error ) == -1 )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to determine size of source file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( source_size == 0 )
+	if( ( index_data_size == 0 )
+	 || ( index_data_size > (size64_t) SSIZE_MAX ) )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value is zero.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index file size value out of bounds.",
+		 function );
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX / 16 )
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * (size_t) index_data_size );
+
+	if( index_data == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
 
 		goto on_error;
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
+	read_count = libcfile_file_read_buffer(
+	              index_file,
+	              index_data,
+	              (size_t) index_data_size,
+	              error );
 
-	if( buffer == NULL )
+	if( read_count != (ssize_t) index_data_size )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data.",
+		 function );
 
 		goto on_error;
 	}
-	uncompressed_data_size = source_size * 16;
+	if( assorted_deflate_index_read_data(
+	     index,
+	     index_data,
+	     (size_t) index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
+		 function );
 
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
+		goto on_error;
+	}
+	memory_free(
+	 index_data );
 
-	if( uncompressed_data == NULL )
+	index_data = NULL;
+
+	if( libcfile_file_close(
+	     index_file,
+	     error ) != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
 
 		goto on_error;
 	}
-	/* Position the source file at the right offset
-	 */
-	if( libcfile_file_seek_offset(
-	     source_file,
-	     source_offset,
-	     SEEK_SET,
-	     &error ) == -1 )
+	if( libcfile_file_free(
+	     &index_file,
+	     error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to seek offset in source file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file.",
+		 function );
 
 		goto on_error;
 	}
-	print_count = narrow_string_snprintf(
-	               destination,
-	               128,
-	               "%s.zdecompressed",
-	               source );
+	return( 1 );
 
-	if( ( print_count < 0 )
-	 || ( print_count > 128 ) )
+on_error:
+	if( index_data != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to set destination filename.\n" );
-
-		goto on_error;
+		memory_free(
+		 index_data );
 	}
-	/* Read and decompress the data
-	 */
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	if( index_file != NULL )
+	{
+		libcfile_file_free(
+		 &index_file,
+		 NULL );
+	}
+	return( -1 );
+}
 
-	if( read_count != (ssize_t) source_size )
+/* Writes an index to a file
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_write_index_file(
+     assorted_deflate_index_t *index,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *index_file = NULL;
+	uint8_t *index_data         = NULL;
+	static char *function       = "zdecompress_write_index_file";
+	size_t index_data_size      = 0;
+	ssize_t write_count         = 0;
+	int result                  = 0;
+
+	if( assorted_deflate_index_get_data_size(
+	     index,
+	     &index_data_size,
+	     error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index data size.",
+		 function );
 
 		goto on_error;
 	}
-	if( decompression_method == 1 )
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * index_data_size );
+
+	if( index_data == NULL )
 	{
-#if !defined( HAVE_ZLIB ) && !defined( ZLIB_DLL )
-		fprintf(
-		 stderr,
-		 "Missing zlib support.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
 
 		goto on_error;
-
-#else
-		zlib_uncompressed_data_size = (uLongf) uncompressed_data_size;
-
-		if( uncompress(
-		     (Bytef *) uncompressed_data,
-		     &zlib_uncompressed_data_size,
-		     (Bytef *) buffer,
-		     (uLong) source_size ) != Z_OK )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to decompress data.\n" );
-
-			goto on_error;
-		}
-		uncompressed_data_size = (size_t) zlib_uncompressed_data_size;
-
-#endif /* !defined( HAVE_ZLIB ) && !defined( ZLIB_DLL ) */
 	}
-	else if( decompression_method == 2 )
+	if( assorted_deflate_index_write_data(
+	     index,
+	     index_data,
+	     index_data_size,
+	     error ) != 1 )
 	{
-		if( assorted_deflate_decompress_zlib(
-		     buffer,
-		     source_size,
-		     uncompressed_data,
-		     &uncompressed_data_size,
-		     &error ) != 1 )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to decompress data.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	/* Open the destination file
-	 */
 	if( libcfile_file_initialize(
-	     &destination_file,
-	     &error ) != 1 )
+	     &index_file,
+	     error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create destination file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file.",
+		 function );
 
 		goto on_error;
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libcfile_file_open_wide(
-	          destination_file,
-	          destination,
+	          index_file,
+	          filename,
 	          LIBCFILE_OPEN_WRITE,
-	          &error );
+	          error );
 #else
 	result = libcfile_file_open(
-	          destination_file,
-	          destination,
+	          index_file,
+	          filename,
 	          LIBCFILE_OPEN_WRITE,
-	          &error );
+	          error );
 #endif
- 	if( result != 1 )
+	if( result != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open destination file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
 
 		goto on_error;
 	}
 	write_count = libcfile_file_write_buffer(
-		       destination_file,
-		       uncompressed_data,
-		       uncompressed_data_size,
-		       &error );
+	               index_file,
+	               index_data,
+	               index_data_size,
+	               error );
 
-	if( write_count != (ssize_t) uncompressed_data_size )
+	if( write_count != (ssize_t) index_data_size )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to write to destination file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index data.",
+		 function );
 
 		goto on_error;
 	}
-	/* Clean up
-	 */
 	if( libcfile_file_close(
-	     destination_file,
-	     &error ) != 0 )
+	     index_file,
+	     error ) != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to close destination file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
 
 		goto on_error;
 	}
 	if( libcfile_file_free(
-	     &destination_file,
-	     &error ) != 1 )
+	     &index_file,
+	     error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to free destination file.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file.",
+		 function );
 
 		goto on_error;
 	}
-	if( libcfile_file_close(
-	     source_file,
-	     &error ) != 0 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to close source file.\n" );
+	memory_free(
+	 index_data );
 
-		goto on_error;
+	return( 1 );
+
+on_error:
+	if( index_file != NULL )
+	{
+		libcfile_file_free(
+		 &index_file,
+		 NULL );
 	}
-	if( libcfile_file_free(
-	     &source_file,
-	     &error ) != 1 )
+	if( index_data != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to free source file.\n" );
-
-		goto on_error;
+		memory_free(
+		 index_data );
 	}
+	return( -1 );
+}
+
+/* Determines the initial size of the uncompressed data buffer
+ * The size is the sum of the sizes stored in gzip members if known,
+ * otherwise 4 times the size of the compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_get_uncompressed_data_size_hint(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t stream_format,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	assorted_deflate_parallel_gzip_member_t *members = NULL;
+	static char *function                            = "zdecompress_get_uncompressed_data_size_hint";
+	size_t member_index                              = 0;
+	size_t number_of_members                         = 0;
+	size_t safe_uncompressed_data_size               = 0;
+	int result                                       = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) ( SSIZE_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+	{
+		/* The member sizes are only known when the members contain their block size
+		 */
+		result = assorted_deflate_parallel_scan_gzip_members(
+		          compressed_data,
+		          compressed_data_size,
+		          &members,
+		          &number_of_members,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan gzip members.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			for( member_index = 0;
+			     member_index < number_of_members;
+			     member_index++ )
+			{
+				if( members[ member_index ].uncompressed_data_size > ( (size_t) SSIZE_MAX - safe_uncompressed_data_size ) )
+				{
+					safe_uncompressed_data_size = 0;
+
+					break;
+				}
+				safe_uncompressed_data_size += members[ member_index ].uncompressed_data_size;
+			}
+			memory_free(
+			 members );
+		}
+		/* Otherwise use the size stored in the footer of the last member
+		 */
+		else if( compressed_data_size >= 18 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( compressed_data[ compressed_data_size - 4 ] ),
+			 safe_uncompressed_data_size );
+		}
+	}
+	if( safe_uncompressed_data_size == 0 )
+	{
+		safe_uncompressed_data_size = compressed_data_size * 4;
+	}
+	if( safe_uncompressed_data_size < ZDECOMPRESS_BUFFER_SIZE )
+	{
+		safe_uncompressed_data_size = ZDECOMPRESS_BUFFER_SIZE;
+	}
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+}
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+
+/* Decompresses zlib compressed data from the source file using zlib, the source file
+ * is read a part at a time and the uncompressed data is written to the destination
+ * file, if set, as it is decoded
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_decompress_zlib(
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     libcfile_file_t *destination_file,
+     uint64_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	z_stream zlib_stream;
+
+	uint8_t *compressed_data   = NULL;
+	uint8_t *uncompressed_data = NULL;
+	static char *function      = "zdecompress_decompress_zlib";
+	size64_t remaining_size    = 0;
+	size_t read_size           = 0;
+	size_t write_size          = 0;
+	ssize_t read_count         = 0;
+	ssize_t write_count        = 0;
+	int result                 = 0;
+	int zlib_initialized       = 0;
+	int zlib_result            = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &zlib_stream,
+	     0,
+	     sizeof( z_stream ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ZDECOMPRESS_BUFFER_SIZE );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The uncompressed data is decoded into a buffer that is overwritten
+	 * for every part, zlib verifies the Adler-32 checksum
+	 */
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ZDECOMPRESS_BUFFER_SIZE );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( inflateInit(
+	     &zlib_stream ) != Z_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize stream.",
+		 function );
+
+		goto on_error;
+	}
+	zlib_initialized = 1;
+	remaining_size   = source_size;
+
+	/* zlib returns Z_BUF_ERROR when no progress can be made
+	 * which is the case for truncated compressed data
+	 */
+	do
+	{
+		if( ( zlib_stream.avail_in == 0 )
+		 && ( remaining_size > 0 ) )
+		{
+			read_size = ZDECOMPRESS_BUFFER_SIZE;
+
+			if( (size64_t) read_size > remaining_size )
+			{
+				read_size = (size_t) remaining_size;
+			}
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              compressed_data,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data from source file.",
+				 function );
+
+				goto on_error;
+			}
+			remaining_size -= read_size;
+
+			zlib_stream.next_in  = (Bytef *) compressed_data;
+			zlib_stream.avail_in = (uInt) read_size;
+		}
+		zlib_stream.next_out  = (Bytef *) uncompressed_data;
+		zlib_stream.avail_out = (uInt) ZDECOMPRESS_BUFFER_SIZE;
+
+		zlib_result = inflate(
+		               &zlib_stream,
+		               Z_NO_FLUSH );
+
+		if( ( zlib_result != Z_OK )
+		 && ( zlib_result != Z_STREAM_END ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data with error: %d.",
+			 function,
+			 zlib_result );
+
+			goto on_error;
+		}
+		write_size = ZDECOMPRESS_BUFFER_SIZE - zlib_stream.avail_out;
+
+		if( ( destination_file != NULL )
+		 && ( write_size > 0 ) )
+		{
+			write_count = libcfile_file_write_buffer(
+			               destination_file,
+			               uncompressed_data,
+			               write_size,
+			               error );
+
+			if( write_count != (ssize_t) write_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write uncompressed data to destination file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		result = assorted_progress_update(
+		          zdecompress_progress,
+		          (uint64_t) ( source_size - remaining_size ),
+		          (uint64_t) zlib_stream.total_out,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( zlib_result != Z_STREAM_END );
+
+	*uncompressed_data_size = (uint64_t) zlib_stream.total_out;
+
+	inflateEnd(
+	 &zlib_stream );
+
 	memory_free(
 	 uncompressed_data );
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( zlib_initialized != 0 )
+	{
+		inflateEnd(
+		 &zlib_stream );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_ZLIB ) || defined( ZLIB_DLL ) */
+
+#if defined( HAVE_DECODE_STATISTICS )
+
+/* Prints the decode statistics
+ */
+void zdecompress_statistics_fprint(
+      FILE *stream,
+      assorted_deflate_statistics_t *statistics )
+{
+	uint64_t number_of_symbols = 0;
+	int code_index             = 0;
+
+	if( ( stream == NULL )
+	 || ( statistics == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "Decode statistics:\n" );
+
+	fprintf(
+	 stream,
+	 "\tNumber of uncompressed blocks\t\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 statistics->number_of_uncompressed_blocks,
+	 statistics->uncompressed_blocks_data_size );
+
+	fprintf(
+	 stream,
+	 "\tNumber of fixed Huffman blocks\t\t: %" PRIu64 "\n",
+	 statistics->number_of_fixed_huffman_blocks );
+
+	fprintf(
+	 stream,
+	 "\tNumber of dynamic Huffman blocks\t: %" PRIu64 "\n",
+	 statistics->number_of_dynamic_huffman_blocks );
+
+	number_of_symbols = statistics->number_of_literals + statistics->number_of_matches;
+
+	fprintf(
+	 stream,
+	 "\tNumber of literals\t\t\t: %" PRIu64 "",
+	 statistics->number_of_literals );
+
+	if( number_of_symbols > 0 )
+	{
+		fprintf(
+		 stream,
+		 " (%" PRIu64 "%%)",
+		 ( statistics->number_of_literals * 100 ) / number_of_symbols );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "\tNumber of matches\t\t\t: %" PRIu64 "\n",
+	 statistics->number_of_matches );
+
+	fprintf(
+	 stream,
+	 "\tBuild trees time\t\t\t: %" PRIu64 " ms\n",
+	 ( statistics->build_trees_time * 1000 ) / CLOCKS_PER_SEC );
+
+	fprintf(
+	 stream,
+	 "\tDecode time\t\t\t\t: %" PRIu64 " ms\n",
+	 ( statistics->decode_time * 1000 ) / CLOCKS_PER_SEC );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "Matches per length code:\n" );
+
+	for( code_index = 0;
+	     code_index < 29;
+	     code_index++ )
+	{
+		if( statistics->match_sizes[ code_index ] != 0 )
+		{
+			fprintf(
+			 stream,
+			 "\t%3d (size %3" PRIu16 ")\t: %" PRIu64 "\n",
+			 257 + code_index,
+			 assorted_deflate_literal_codes_base[ code_index ],
+			 statistics->match_sizes[ code_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fprintf(
+	 stream,
+	 "Matches per distance code:\n" );
+
+	for( code_index = 0;
+	     code_index < 30;
+	     code_index++ )
+	{
+		if( statistics->match_distances[ code_index ] != 0 )
+		{
+			fprintf(
+			 stream,
+			 "\t%3d (distance %5" PRIu16 ")\t: %" PRIu64 "\n",
+			 code_index,
+			 assorted_deflate_distance_codes_base[ code_index ],
+			 statistics->match_distances[ code_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+}
+
+#endif /* defined( HAVE_DECODE_STATISTICS ) */
+
+/* Signal handler for zdecompress
+ */
+void zdecompress_signal_handler(
+      assorted_signal_t signal ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( signal )
+
+	assorted_progress_signal_abort(
+	 zdecompress_progress );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	char destination[ 128 ];
+
+	assorted_deflate_checkpoint_t *checkpoint = NULL;
+	assorted_deflate_index_t *index           = NULL;
+	assorted_deflate_stream_t *stream         = NULL;
+	libcerror_error_t *error                  = NULL;
+	libcfile_file_t *destination_file         = NULL;
+	libcfile_file_t *source_file              = NULL;
+	system_character_t *index_filename        = NULL;
+	system_character_t *source                = NULL;
+	uint8_t *buffer                           = NULL;
+	uint8_t *uncompressed_data                = NULL;
+	void *reallocation                        = NULL;
+	char *program                             = "zdecompress";
+	system_integer_t option                   = 0;
+	size64_t remaining_size                   = 0;
+	size64_t source_size                      = 0;
+	size64_t uncompressed_length              = 0;
+	uint64_t checkpoint_spacing               = ASSORTED_DEFLATE_INDEX_DEFAULT_SPACING;
+	uint64_t range_end_offset                 = 0;
+	uint64_t stream_offset                    = 0;
+	uint64_t uncompressed_offset              = 0;
+	size_t compressed_data_offset             = 0;
+	size_t read_size                          = 0;
+	size_t safe_uncompressed_data_size        = 0;
+	size_t uncompressed_data_size             = 0;
+	size_t write_offset                       = 0;
+	size_t write_size                         = 0;
+	ssize_t read_count                        = 0;
+	ssize_t write_count                       = 0;
+	off_t source_offset                       = 0;
+	uint8_t signature[ 2 ]                    = { 0, 0 };
+	uint8_t build_index                       = 0;
+	uint8_t stream_format                     = ASSORTED_DEFLATE_STREAM_FORMAT_ZLIB;
+	uint8_t verify_data                       = 0;
+	int decompression_method                  = 2;
+	int number_of_threads                     = 1;
+	int print_count                           = 0;
+	int progress_result                       = 0;
+	int result                                = 0;
+	int verbose                               = 0;
+
+#if defined( HAVE_DECODE_STATISTICS )
+	assorted_deflate_statistics_t statistics;
+#endif
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "12c:hi:j:l:o:s:t:Tu:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case '1':
+				decompression_method = 1;
+
+				break;
+
+			case '2':
+				decompression_method = 2;
+
+				break;
+
+			case 'c':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				checkpoint_spacing = _wtol( optarg );
+#else
+				checkpoint_spacing = atol( optarg );
+#endif
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'i':
+				index_filename = optarg;
+
+				break;
+
+			case 'l':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				uncompressed_length = _wtol( optarg );
+#else
+				uncompressed_length = atol( optarg );
+#endif
+				break;
+
+			case 'o':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				source_offset = _wtol( optarg );
+#else
+				source_offset = atol( optarg );
+#endif
+				break;
+
+			case 's':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				source_size = _wtol( optarg );
+#else
+				source_size = atol( optarg );
+#endif
+				break;
+
+			case 'j':
+			case 't':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				number_of_threads = _wtol( optarg );
+#else
+				number_of_threads = atol( optarg );
+#endif
+				break;
+
+			case 'T':
+				verify_data = 1;
+
+				break;
+
+			case 'u':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				uncompressed_offset = _wtol( optarg );
+#else
+				uncompressed_offset = atol( optarg );
+#endif
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	/* The progress is only reported in verbose mode but the abort flag is always checked
+	 */
+	if( assorted_progress_initialize(
+	     &zdecompress_progress,
+	     ASSORTED_PROGRESS_DEFAULT_INTERVAL,
+	     ( verbose != 0 ) ? &assorted_progress_fprint : NULL,
+	     (void *) stderr,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create progress.\n" );
+
+		goto on_error;
+	}
+	if( assorted_signal_attach(
+	     zdecompress_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
+	/* Open the source file
+	 */
+	if( libcfile_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#else
+	result = libcfile_file_open(
+	          source_file,
+	          source,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+#endif
+ 	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size == 0 )
+	{
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( source_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
+	}
+	if( number_of_threads < 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value zero or less.\n" );
+
+		goto on_error;
+	}
+	if( ( number_of_threads > 1 )
+	 && ( index_filename != NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Index file not supported with multiple threads.\n" );
+
+		goto on_error;
+	}
+	if( ( verify_data != 0 )
+	 && ( ( number_of_threads > 1 )
+	  || ( index_filename != NULL ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Verify mode not supported with an index file or multiple threads.\n" );
+
+		goto on_error;
+	}
+	/* Position the source file at the right offset
+	 */
+	if( libcfile_file_seek_offset(
+	     source_file,
+	     source_offset,
+	     SEEK_SET,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to seek offset in source file.\n" );
+
+		goto on_error;
+	}
+	/* Determine if the data is gzip compressed from the member signature
+	 */
+	if( source_size >= 2 )
+	{
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      signature,
+			      2,
+			      &error );
+
+		if( read_count != 2 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read signature from source file.\n" );
+
+			goto on_error;
+		}
+		if( ( signature[ 0 ] == 0x1f )
+		 && ( signature[ 1 ] == 0x8b ) )
+		{
+			stream_format = ASSORTED_DEFLATE_STREAM_FORMAT_GZIP;
+		}
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     source_offset,
+		     SEEK_SET,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to seek offset in source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( stream_format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+	 && ( decompression_method == 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Gzip compressed data not supported by the zlib decompression method.\n" );
+
+		goto on_error;
+	}
+	if( ( stream_format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+	 && ( index_filename != NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Index file not supported with gzip compressed data.\n" );
+
+		goto on_error;
+	}
+	print_count = narrow_string_snprintf(
+	               destination,
+	               128,
+	               "%s.zdecompressed",
+	               source );
+
+	if( ( print_count < 0 )
+	 || ( print_count > 128 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set destination filename.\n" );
+
+		goto on_error;
+	}
+	if( verify_data == 0 )
+	{
+		/* Open the destination file
+		 */
+		if( libcfile_file_initialize(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create destination file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          destination_file,
+		          destination,
+		          LIBCFILE_OPEN_WRITE,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          destination_file,
+		          destination,
+		          LIBCFILE_OPEN_WRITE,
+		          &error );
+#endif
+	 	if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open destination file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( decompression_method == 1 )
+	{
+#if !defined( HAVE_ZLIB ) && !defined( ZLIB_DLL )
+		fprintf(
+		 stderr,
+		 "Missing zlib support.\n" );
+
+		goto on_error;
+
+#else
+		if( zdecompress_decompress_zlib(
+		     source_file,
+		     source_size,
+		     destination_file,
+		     &stream_offset,
+		     &error ) != 1 )
+		{
+			if( zdecompress_progress->abort != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Aborted.\n" );
+			}
+			else
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+			}
+			goto on_error;
+		}
+		if( verify_data != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Verified %" PRIu64 " bytes of uncompressed data.\n",
+			 stream_offset );
+		}
+#endif /* !defined( HAVE_ZLIB ) && !defined( ZLIB_DLL ) */
+	}
+	else if( ( decompression_method == 2 )
+	      && ( number_of_threads > 1 ) )
+	{
+		/* The parallel decompression requires all the compressed data
+		 */
+		if( source_size > (size64_t) SSIZE_MAX / 4 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * source_size );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+			      source_file,
+			      buffer,
+			      source_size,
+		              &error );
+
+		if( read_count != (ssize_t) source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( zdecompress_get_uncompressed_data_size_hint(
+		     buffer,
+		     (size_t) source_size,
+		     stream_format,
+		     &uncompressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine uncompressed data size.\n" );
+
+			goto on_error;
+		}
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		/* The uncompressed data buffer is doubled until the data fits
+		 */
+		do
+		{
+			safe_uncompressed_data_size = uncompressed_data_size;
+
+			if( stream_format == ASSORTED_DEFLATE_STREAM_FORMAT_GZIP )
+			{
+				result = assorted_deflate_parallel_decompress_gzip(
+				          buffer,
+				          source_size,
+				          number_of_threads,
+				          uncompressed_data,
+				          &safe_uncompressed_data_size,
+				          &error );
+			}
+			else
+			{
+				result = assorted_deflate_parallel_decompress_zlib(
+				          buffer,
+				          source_size,
+				          number_of_threads,
+				          uncompressed_data,
+				          &safe_uncompressed_data_size,
+				          &error );
+			}
+			if( result == 1 )
+			{
+				uncompressed_data_size = safe_uncompressed_data_size;
+			}
+			else if( ( libcerror_error_matches(
+			            error,
+			            LIBCERROR_ERROR_DOMAIN_OUTPUT,
+			            LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE ) == 0 )
+			      || ( uncompressed_data_size > ( (size_t) SSIZE_MAX / 2 ) ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+
+				goto on_error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &error );
+
+				uncompressed_data_size *= 2;
+
+				reallocation = memory_reallocate(
+				                uncompressed_data,
+				                sizeof( uint8_t ) * uncompressed_data_size );
+
+				if( reallocation == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to resize uncompressed data buffer.\n" );
+
+					goto on_error;
+				}
+				uncompressed_data = (uint8_t *) reallocation;
+			}
+		}
+		while( result != 1 );
+		/* Only write the requested range of the uncompressed data
+		 */
+		write_offset = 0;
+		write_size   = 0;
+
+		if( uncompressed_offset < (uint64_t) uncompressed_data_size )
+		{
+			write_offset = (size_t) uncompressed_offset;
+			write_size   = uncompressed_data_size - write_offset;
+
+			if( ( uncompressed_length != 0 )
+			 && ( uncompressed_length < (size64_t) write_size ) )
+			{
+				write_size = (size_t) uncompressed_length;
+			}
+		}
+		write_count = libcfile_file_write_buffer(
+			       destination_file,
+			       &( uncompressed_data[ write_offset ] ),
+			       write_size,
+			       &error );
+
+		if( write_count != (ssize_t) write_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
+	}
+	else if( decompression_method == 2 )
+	{
+		/* The data is decompressed a part at a time so the memory used
+		 * does not depend on the size of the compressed data
+		 */
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * ZDECOMPRESS_BUFFER_SIZE );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * ZDECOMPRESS_BUFFER_SIZE );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		if( checkpoint_spacing == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid checkpoint spacing value is zero.\n" );
+
+			goto on_error;
+		}
+		if( uncompressed_length == 0 )
+		{
+			range_end_offset = UINT64_MAX;
+		}
+		else if( uncompressed_length > ( UINT64_MAX - uncompressed_offset ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid uncompressed length value out of bounds.\n" );
+
+			goto on_error;
+		}
+		else
+		{
+			range_end_offset = uncompressed_offset + uncompressed_length;
+		}
+		if( index_filename != NULL )
+		{
+			if( assorted_deflate_index_initialize(
+			     &index,
+			     checkpoint_spacing,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create index.\n" );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libcfile_file_exists_wide(
+			          index_filename,
+			          &error );
+#else
+			result = libcfile_file_exists(
+			          index_filename,
+			          &error );
+#endif
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to determine if index file exists.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				build_index = 1;
+			}
+			else
+			{
+				if( zdecompress_read_index_file(
+				     index,
+				     index_filename,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to read index file.\n" );
+
+					goto on_error;
+				}
+				result = assorted_deflate_index_get_checkpoint_by_offset(
+				          index,
+				          uncompressed_offset,
+				          &checkpoint,
+				          &error );
+
+				if( result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to retrieve checkpoint.\n" );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					checkpoint = NULL;
+				}
+			}
+		}
+		if( assorted_deflate_stream_initialize(
+		     &stream,
+		     stream_format,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create stream.\n" );
+
+			goto on_error;
+		}
+		remaining_size = source_size;
+
+#if defined( HAVE_DECODE_STATISTICS )
+		if( memory_set(
+		     &statistics,
+		     0,
+		     sizeof( assorted_deflate_statistics_t ) ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to clear statistics.\n" );
+
+			goto on_error;
+		}
+		if( assorted_deflate_stream_set_statistics(
+		     stream,
+		     &statistics,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set stream statistics.\n" );
+
+			goto on_error;
+		}
+#endif
+		if( checkpoint != NULL )
+		{
+			/* Continue decompressing from the byte that contains the checkpoint
+			 */
+			if( ( checkpoint->compressed_bit_offset / 8 ) >= source_size )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid checkpoint compressed offset value out of bounds.\n" );
+
+				goto on_error;
+			}
+			if( libcfile_file_seek_offset(
+			     source_file,
+			     source_offset + (off_t) ( checkpoint->compressed_bit_offset / 8 ),
+			     SEEK_SET,
+			     &error ) == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to seek checkpoint offset in source file.\n" );
+
+				goto on_error;
+			}
+			remaining_size -= checkpoint->compressed_bit_offset / 8;
+			stream_offset   = checkpoint->uncompressed_offset;
+		}
+		else if( build_index != 0 )
+		{
+			if( assorted_deflate_stream_set_index(
+			     stream,
+			     index,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set stream index.\n" );
+
+				goto on_error;
+			}
+		}
+		result = 0;
+
+		while( result == 0 )
+		{
+			if( ( compressed_data_offset >= read_size )
+			 && ( remaining_size > 0 ) )
+			{
+				read_size = ZDECOMPRESS_BUFFER_SIZE;
+
+				if( (size64_t) read_size > remaining_size )
+				{
+					read_size = (size_t) remaining_size;
+				}
+				read_count = libcfile_file_read_buffer(
+					      source_file,
+					      buffer,
+					      read_size,
+				              &error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to read from source file.\n" );
+
+					goto on_error;
+				}
+				remaining_size        -= read_size;
+				compressed_data_offset = 0;
+			}
+			if( checkpoint != NULL )
+			{
+				if( assorted_deflate_stream_resume(
+				     stream,
+				     checkpoint,
+				     buffer,
+				     read_size,
+				     &compressed_data_offset,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to resume stream at checkpoint.\n" );
+
+					goto on_error;
+				}
+				checkpoint = NULL;
+			}
+			uncompressed_data_size = ZDECOMPRESS_BUFFER_SIZE;
+
+			if( ( compressed_data_offset >= read_size )
+			 && ( remaining_size == 0 ) )
+			{
+				result = assorted_deflate_stream_finish(
+				          stream,
+				          uncompressed_data,
+				          &uncompressed_data_size,
+				          &error );
+			}
+			else
+			{
+				result = assorted_deflate_stream_feed(
+				          stream,
+				          buffer,
+				          read_size,
+				          &compressed_data_offset,
+				          uncompressed_data,
+				          &uncompressed_data_size,
+				          &error );
+			}
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to decompress data.\n" );
+
+				goto on_error;
+			}
+			/* Only write the part of the uncompressed data within the requested range
+			 */
+			write_offset = 0;
+			write_size   = uncompressed_data_size;
+
+			if( stream_offset < uncompressed_offset )
+			{
+				if( ( uncompressed_offset - stream_offset ) < (uint64_t) write_size )
+				{
+					write_offset = (size_t) ( uncompressed_offset - stream_offset );
+				}
+				else
+				{
+					write_offset = write_size;
+				}
+			}
+			if( stream_offset >= range_end_offset )
+			{
+				write_size = 0;
+			}
+			else if( ( range_end_offset - stream_offset ) < (uint64_t) write_size )
+			{
+				write_size = (size_t) ( range_end_offset - stream_offset );
+			}
+			if( ( verify_data == 0 )
+			 && ( write_size > write_offset ) )
+			{
+				write_count = libcfile_file_write_buffer(
+					       destination_file,
+					       &( uncompressed_data[ write_offset ] ),
+					       write_size - write_offset,
+					       &error );
+
+				if( write_count != (ssize_t) ( write_size - write_offset ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write to destination file.\n" );
+
+					goto on_error;
+				}
+			}
+			stream_offset += uncompressed_data_size;
+
+			progress_result = assorted_progress_update(
+			                   zdecompress_progress,
+			                   (uint64_t) ( source_size - remaining_size ),
+			                   stream_offset,
+			                   &error );
+
+			if( progress_result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to update progress.\n" );
+
+				goto on_error;
+			}
+			else if( progress_result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Aborted.\n" );
+
+				goto on_error;
+			}
+			/* The remainder of the stream is only needed to complete the index
+			 * or to verify the data
+			 */
+			if( ( build_index == 0 )
+			 && ( verify_data == 0 )
+			 && ( stream_offset >= range_end_offset ) )
+			{
+				break;
+			}
+		}
+		if( verify_data != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Verified %" PRIu64 " bytes of uncompressed data.\n",
+			 stream_offset );
+		}
+#if defined( HAVE_DECODE_STATISTICS )
+		if( verbose != 0 )
+		{
+			zdecompress_statistics_fprint(
+			 stderr,
+			 &statistics );
+		}
+#endif
+		if( build_index != 0 )
+		{
+			if( zdecompress_write_index_file(
+			     index,
+			     index_filename,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write index file.\n" );
+
+				goto on_error;
+			}
+		}
+		if( index != NULL )
+		{
+			if( assorted_deflate_index_free(
+			     &index,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free index.\n" );
+
+				goto on_error;
+			}
+		}
+		if( assorted_deflate_stream_free(
+		     &stream,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free stream.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Clean up
+	 */
+	if( assorted_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( assorted_progress_free(
+	     &zdecompress_progress,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free progress.\n" );
+
+		goto on_error;
+	}
+	if( destination_file != NULL )
+	{
+		if( libcfile_file_close(
+		     destination_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close destination file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free destination file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( libcfile_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
 
+		goto on_error;
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
 	memory_free(
 	 buffer );
 
@@ -478,6 +2020,26 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( zdecompress_progress != NULL )
+	{
+		assorted_signal_detach(
+		 NULL );
+		assorted_progress_free(
+		 &zdecompress_progress,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		assorted_deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		assorted_deflate_index_free(
+		 &index,
+		 NULL );
+	}
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
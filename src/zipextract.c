@@ -0,0 +1,1557 @@
+/*
+ * Extracts the members of a ZIP archive
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "assorted_memory_map.h"
+#include "assorted_output.h"
+#include "assorted_system_string.h"
+#include "assorted_thread_pool.h"
+#include "assorted_unused.h"
+#include "assorted_zip_member.h"
+
+#define ZIPEXTRACT_MAXIMUM_NUMBER_OF_THREADS				64
+
+#define ZIPEXTRACT_NUMBER_OF_TASKS_PER_THREAD				16
+
+#define ZIPEXTRACT_CENTRAL_DIRECTORY_ENTRY_SIZE				46
+
+#define ZIPEXTRACT_END_OF_CENTRAL_DIRECTORY_SIZE			22
+
+#define ZIPEXTRACT_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE		20
+
+#define ZIPEXTRACT_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE			56
+
+#define ZIPEXTRACT_FLAG_ENCRYPTED					0x0001
+
+typedef struct zipextract_task zipextract_task_t;
+
+struct zipextract_task
+{
+	/* The index of the central directory entry
+	 */
+	uint64_t entry_index;
+
+	/* The name, which points into the central directory
+	 */
+	const uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The general purpose bit flags
+	 */
+	uint16_t flags;
+
+	/* The compression method
+	 */
+	uint16_t compression_method;
+
+	/* The CRC-32 of the uncompressed data
+	 */
+	uint32_t checksum;
+
+	/* The offset of the local file header
+	 */
+	off64_t local_file_header_offset;
+
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data buffer, used if the source is not memory mapped
+	 */
+	uint8_t *compressed_data_buffer;
+
+	/* The compressed data size
+	 */
+	size64_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size64_t uncompressed_data_size;
+
+	/* The result of the extraction, 0 if not extracted
+	 */
+	int result;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use zipextract to extract the members of a ZIP archive.\n\n" );
+
+	fprintf( stream, "Usage: zipextract [ -m pattern ] [ -p prefix ] [ -j number_of_threads ]\n"
+	                 "                  [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads used to extract members\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-m:     only extract the members with a name that matches\n"
+	                 "\t        the pattern, where * matches any sequence of\n"
+	                 "\t        characters and ? a single character\n" );
+	fprintf( stream, "\t-p:     write every member to a separate file named:\n"
+	                 "\t        prefix.<central directory entry index>\n"
+	                 "\t        (default is source)\n" );
+	fprintf( stream, "\t-t:     same as -j\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr, including the names\n"
+	                 "\t        of the extracted members\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Retrieves data from the source
+ * If the source is memory mapped data points into the memory map otherwise
+ * the data is read into data buffer, which must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int zipextract_get_data(
+     assorted_memory_map_t *memory_map,
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     off64_t offset,
+     size64_t size,
+     const uint8_t **data,
+     uint8_t **data_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "zipextract_get_data";
+	ssize_t read_count    = 0;
+
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > source_size )
+	 || ( size > ( source_size - (size64_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range exceeds source size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file == NULL )
+	{
+		*data = &( memory_map->data[ offset ] );
+
+		return( 1 );
+	}
+	*data_buffer = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * ( (size_t) size + 1 ) );
+
+	if( *data_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_seek_offset(
+	     source_file,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              source_file,
+	              *data_buffer,
+	              (size_t) size,
+	              error );
+
+	if( read_count != (ssize_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	*data = *data_buffer;
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 *data_buffer );
+
+	*data_buffer = NULL;
+
+	return( -1 );
+}
+
+
+/* Determines if a name matches a pattern
+ * The pattern supports * to match any sequence of characters and ? to match
+ * a single character
+ * Returns 1 if the name matches, 0 if not
+ */
+int zipextract_name_matches_pattern(
+     const uint8_t *name,
+     size_t name_size,
+     const char *pattern )
+{
+	size_t backtrack_name_index    = 0;
+	size_t backtrack_pattern_index = 0;
+	size_t name_index              = 0;
+	size_t pattern_index           = 0;
+	uint8_t has_backtrack          = 0;
+
+	while( name_index < name_size )
+	{
+		if( pattern[ pattern_index ] == '*' )
+		{
+			pattern_index++;
+
+			backtrack_pattern_index = pattern_index;
+			backtrack_name_index    = name_index;
+			has_backtrack           = 1;
+		}
+		else if( ( pattern[ pattern_index ] != 0 )
+		      && ( ( pattern[ pattern_index ] == '?' )
+		       || ( (uint8_t) pattern[ pattern_index ] == name[ name_index ] ) ) )
+		{
+			pattern_index++;
+			name_index++;
+		}
+		else if( has_backtrack != 0 )
+		{
+			/* Let the last * match one more character
+			 */
+			backtrack_name_index++;
+
+			pattern_index = backtrack_pattern_index;
+			name_index    = backtrack_name_index;
+		}
+		else
+		{
+			return( 0 );
+		}
+	}
+	while( pattern[ pattern_index ] == '*' )
+	{
+		pattern_index++;
+	}
+	if( pattern[ pattern_index ] != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads the end of central directory record
+ * If the archive uses ZIP64 extensions the values are read from
+ * the ZIP64 end of central directory record
+ * Returns 1 if successful or -1 on error
+ */
+int zipextract_read_end_of_central_directory(
+     assorted_memory_map_t *memory_map,
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     uint64_t *number_of_entries,
+     off64_t *central_directory_offset,
+     size64_t *central_directory_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *data                = NULL;
+	uint8_t *data_buffer               = NULL;
+	static char *function              = "zipextract_read_end_of_central_directory";
+	size64_t read_size                 = 0;
+	size_t data_offset                 = 0;
+	uint64_t value_64bit               = 0;
+	uint32_t value_32bit               = 0;
+	uint16_t value_16bit               = 0;
+	uint8_t is_zip64                   = 0;
+
+	/* The end of central directory record is followed by a comment of at most 65535 bytes
+	 */
+	read_size = ZIPEXTRACT_END_OF_CENTRAL_DIRECTORY_SIZE + 65535;
+
+	if( read_size > source_size )
+	{
+		read_size = source_size;
+	}
+	if( read_size < ZIPEXTRACT_END_OF_CENTRAL_DIRECTORY_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( zipextract_get_data(
+	     memory_map,
+	     source_file,
+	     source_size,
+	     (off64_t) ( source_size - read_size ),
+	     read_size,
+	     &data,
+	     &data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read end of central directory record.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = (size_t) read_size - ZIPEXTRACT_END_OF_CENTRAL_DIRECTORY_SIZE;
+
+	while( memory_compare(
+	        &( data[ data_offset ] ),
+	        "PK\x05\x06",
+	        4 ) != 0 )
+	{
+		if( data_offset == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: unable to find end of central directory record.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset--;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ data_offset + 10 ] ),
+	 value_16bit );
+
+	*number_of_entries = (uint64_t) value_16bit;
+
+	if( value_16bit == 0xffff )
+	{
+		is_zip64 = 1;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ data_offset + 12 ] ),
+	 value_32bit );
+
+	*central_directory_size = (size64_t) value_32bit;
+
+	if( value_32bit == 0xffffffffUL )
+	{
+		is_zip64 = 1;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ data_offset + 16 ] ),
+	 value_32bit );
+
+	*central_directory_offset = (off64_t) value_32bit;
+
+	if( value_32bit == 0xffffffffUL )
+	{
+		is_zip64 = 1;
+	}
+	/* The ZIP64 end of central directory locator precedes the end of central directory record
+	 */
+	if( is_zip64 != 0 )
+	{
+		if( data_offset < ZIPEXTRACT_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid ZIP64 end of central directory locator value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset -= ZIPEXTRACT_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE;
+
+		if( memory_compare(
+		     &( data[ data_offset ] ),
+		     "PK\x06\x07",
+		     4 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: unsupported ZIP64 end of central directory locator signature.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 value_64bit );
+
+		if( data_buffer != NULL )
+		{
+			memory_free(
+			 data_buffer );
+
+			data_buffer = NULL;
+		}
+		if( ( value_64bit > source_size )
+		 || ( ZIPEXTRACT_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE > ( source_size - value_64bit ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid ZIP64 end of central directory record offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( zipextract_get_data(
+		     memory_map,
+		     source_file,
+		     source_size,
+		     (off64_t) value_64bit,
+		     ZIPEXTRACT_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE,
+		     &data,
+		     &data_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read ZIP64 end of central directory record.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_compare(
+		     data,
+		     "PK\x06\x06",
+		     4 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: unsupported ZIP64 end of central directory record signature.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 32 ] ),
+		 *number_of_entries );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 40 ] ),
+		 *central_directory_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 48 ] ),
+		 value_64bit );
+
+		*central_directory_offset = (off64_t) value_64bit;
+	}
+	if( data_buffer != NULL )
+	{
+		memory_free(
+		 data_buffer );
+	}
+	return( 1 );
+
+on_error:
+	if( data_buffer != NULL )
+	{
+		memory_free(
+		 data_buffer );
+	}
+	return( -1 );
+}
+
+/* Reads a central directory file header into a task
+ * Returns 1 if successful or -1 on error
+ */
+int zipextract_read_central_directory_entry(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     zipextract_task_t *task,
+     libcerror_error_t **error )
+{
+	static char *function          = "zipextract_read_central_directory_entry";
+	size_t extra_field_end_offset  = 0;
+	size_t extra_field_offset      = 0;
+	size_t safe_data_offset        = 0;
+	uint64_t value_64bit           = 0;
+	uint32_t value_32bit           = 0;
+	uint16_t comment_size          = 0;
+	uint16_t extra_field_size      = 0;
+	uint16_t name_size             = 0;
+	uint16_t tag_data_size         = 0;
+	uint16_t tag_type              = 0;
+	uint8_t has_zip64_compressed   = 0;
+	uint8_t has_zip64_offset       = 0;
+	uint8_t has_zip64_uncompressed = 0;
+
+	safe_data_offset = *data_offset;
+
+	if( ZIPEXTRACT_CENTRAL_DIRECTORY_ENTRY_SIZE > ( data_size - safe_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid central directory entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     &( data[ safe_data_offset ] ),
+	     "PK\x01\x02",
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported central directory entry signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ safe_data_offset + 8 ] ),
+	 task->flags );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ safe_data_offset + 10 ] ),
+	 task->compression_method );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ safe_data_offset + 16 ] ),
+	 task->checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ safe_data_offset + 20 ] ),
+	 value_32bit );
+
+	task->compressed_data_size = (size64_t) value_32bit;
+	has_zip64_compressed       = (uint8_t) ( value_32bit == 0xffffffffUL );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ safe_data_offset + 24 ] ),
+	 value_32bit );
+
+	task->uncompressed_data_size = (size64_t) value_32bit;
+	has_zip64_uncompressed       = (uint8_t) ( value_32bit == 0xffffffffUL );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ safe_data_offset + 28 ] ),
+	 name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ safe_data_offset + 30 ] ),
+	 extra_field_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ safe_data_offset + 32 ] ),
+	 comment_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ safe_data_offset + 42 ] ),
+	 value_32bit );
+
+	task->local_file_header_offset = (off64_t) value_32bit;
+	has_zip64_offset               = (uint8_t) ( value_32bit == 0xffffffffUL );
+
+	safe_data_offset += ZIPEXTRACT_CENTRAL_DIRECTORY_ENTRY_SIZE;
+
+	if( ( (size_t) name_size + (size_t) extra_field_size + (size_t) comment_size ) > ( data_size - safe_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid central directory entry variable size data value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	task->name      = &( data[ safe_data_offset ] );
+	task->name_size = (size_t) name_size;
+
+	extra_field_offset     = safe_data_offset + name_size;
+	extra_field_end_offset = extra_field_offset + extra_field_size;
+
+	/* The ZIP64 extended information extra field only contains the values
+	 * that do not fit in the central directory entry, in order
+	 */
+	while( ( extra_field_end_offset - extra_field_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ extra_field_offset ] ),
+		 tag_type );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ extra_field_offset + 2 ] ),
+		 tag_data_size );
+
+		extra_field_offset += 4;
+
+		if( (size_t) tag_data_size > ( extra_field_end_offset - extra_field_offset ) )
+		{
+			break;
+		}
+		if( tag_type == 0x0001 )
+		{
+			safe_data_offset = extra_field_offset;
+
+			if( ( has_zip64_uncompressed != 0 )
+			 && ( ( extra_field_offset + tag_data_size - safe_data_offset ) >= 8 ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( data[ safe_data_offset ] ),
+				 task->uncompressed_data_size );
+
+				safe_data_offset += 8;
+			}
+			if( ( has_zip64_compressed != 0 )
+			 && ( ( extra_field_offset + tag_data_size - safe_data_offset ) >= 8 ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( data[ safe_data_offset ] ),
+				 task->compressed_data_size );
+
+				safe_data_offset += 8;
+			}
+			if( ( has_zip64_offset != 0 )
+			 && ( ( extra_field_offset + tag_data_size - safe_data_offset ) >= 8 ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( data[ safe_data_offset ] ),
+				 value_64bit );
+
+				task->local_file_header_offset = (off64_t) value_64bit;
+			}
+		}
+		extra_field_offset += tag_data_size;
+	}
+	*data_offset = extra_field_end_offset + comment_size;
+
+	return( 1 );
+}
+
+/* Extracts the member of a task
+ */
+void zipextract_task_extract(
+      zipextract_task_t *task )
+{
+	if( task == NULL )
+	{
+		return;
+	}
+	task->result = -1;
+
+	if( task->uncompressed_data_size > (size64_t) ( SSIZE_MAX - 1 ) )
+	{
+		return;
+	}
+	task->uncompressed_data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * ( (size_t) task->uncompressed_data_size + 1 ) );
+
+	if( task->uncompressed_data == NULL )
+	{
+		return;
+	}
+	task->result = assorted_zip_member_decompress(
+	                task->compressed_data,
+	                (size_t) task->compressed_data_size,
+	                task->compression_method,
+	                task->checksum,
+	                task->uncompressed_data,
+	                (size_t) task->uncompressed_data_size,
+	                NULL );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Extracts the member of a task from a thread pool
+ * Returns 1 on success or -1 on error
+ */
+int zipextract_task_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	zipextract_task_extract(
+	 (zipextract_task_t *) value );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Extracts the members of tasks
+ * Returns 1 if successful or -1 on error
+ */
+int zipextract_extract_tasks(
+     zipextract_task_t *tasks,
+     int number_of_tasks,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function                  = "zipextract_extract_tasks";
+	int task_index                         = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_thread_pool_t *thread_pool    = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+	if( tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tasks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_tasks > 1 ) )
+	{
+		maximum_number_of_values = number_of_threads * ASSORTED_THREAD_POOL_NUMBER_OF_VALUES_PER_THREAD;
+
+		if( maximum_number_of_values > number_of_tasks )
+		{
+			maximum_number_of_values = number_of_tasks;
+		}
+		if( assorted_thread_pool_create(
+		     &thread_pool,
+		     number_of_threads,
+		     maximum_number_of_values,
+		     (int (*)(intptr_t *, void *)) &zipextract_task_callback,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( assorted_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( tasks[ task_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push task: %d onto thread pool queue.",
+				 function,
+				 task_index );
+
+				goto on_error;
+			}
+		}
+		if( assorted_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	ASSORTED_UNREFERENCED_PARAMETER( number_of_threads )
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a thread pool the members are extracted here
+	 */
+	for( task_index = 0;
+	     task_index < number_of_tasks;
+	     task_index++ )
+	{
+		if( tasks[ task_index ].result == 0 )
+		{
+			zipextract_task_extract(
+			 &( tasks[ task_index ] ) );
+		}
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int zipextract_write_output(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *output_file = NULL;
+	static char *function        = "zipextract_write_output";
+	ssize_t write_count          = 0;
+
+	if( libcfile_file_initialize(
+	     &output_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_open(
+	     output_file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               output_file,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     output_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &output_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( output_file != NULL )
+	{
+		libcfile_file_free(
+		 &output_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	char destination[ 256 ];
+
+	assorted_memory_map_t *memory_map         = NULL;
+	libcerror_error_t *error                  = NULL;
+	libcfile_file_t *source_file              = NULL;
+	system_character_t *source                = NULL;
+	zipextract_task_t *tasks                  = NULL;
+	const uint8_t *central_directory_data     = NULL;
+	const uint8_t *local_file_header_data     = NULL;
+	const char *pattern                       = NULL;
+	const char *prefix                        = NULL;
+	char *program                             = "zipextract";
+	uint8_t *central_directory_data_buffer    = NULL;
+	uint8_t *local_file_header_data_buffer    = NULL;
+	system_integer_t option                   = 0;
+	off64_t central_directory_offset          = 0;
+	size64_t central_directory_size           = 0;
+	size64_t source_size                      = 0;
+	size64_t total_uncompressed_size          = 0;
+	size_t central_directory_data_offset      = 0;
+	size_t local_file_header_size             = 0;
+	uint64_t entry_index                      = 0;
+	uint64_t number_of_entries                = 0;
+	int maximum_number_of_tasks               = 0;
+	int number_of_extracted_members           = 0;
+	int number_of_failed_members              = 0;
+	int number_of_tasks                       = 0;
+	int number_of_threads                     = 1;
+	int print_count                           = 0;
+	int result                                = 0;
+	int task_index                            = 0;
+	int verbose                               = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hj:m:p:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				pattern = (const char *) optarg;
+
+				break;
+
+			case 'p':
+				prefix = (const char *) optarg;
+
+				break;
+
+			case 'j':
+			case 't':
+				number_of_threads = (int) system_string_copy_to_long( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( prefix == NULL )
+	{
+		prefix = (const char *) source;
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > ZIPEXTRACT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid number of threads value out of bounds.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	/* The source stays open for all members, it is memory mapped if supported
+	 * otherwise the data of every member is read
+	 */
+	if( assorted_memory_map_initialize(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create memory map.\n" );
+
+		goto on_error;
+	}
+	result = assorted_memory_map_open(
+	          memory_map,
+	          source,
+	          0,
+	          0,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open memory map.\n" );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		source_size = (size64_t) memory_map->data_size;
+	}
+	else
+	{
+		if( libcfile_file_initialize(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create source file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#else
+		result = libcfile_file_open(
+		          source_file,
+		          source,
+		          LIBCFILE_OPEN_READ,
+		          &error );
+#endif
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( zipextract_read_end_of_central_directory(
+	     memory_map,
+	     source_file,
+	     source_size,
+	     &number_of_entries,
+	     &central_directory_offset,
+	     &central_directory_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read end of central directory.\n" );
+
+		goto on_error;
+	}
+	if( zipextract_get_data(
+	     memory_map,
+	     source_file,
+	     source_size,
+	     central_directory_offset,
+	     central_directory_size,
+	     &central_directory_data,
+	     &central_directory_data_buffer,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read central directory.\n" );
+
+		goto on_error;
+	}
+	maximum_number_of_tasks = number_of_threads * ZIPEXTRACT_NUMBER_OF_TASKS_PER_THREAD;
+
+	tasks = (zipextract_task_t *) memory_allocate(
+	                               sizeof( zipextract_task_t ) * maximum_number_of_tasks );
+
+	if( tasks == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create tasks.\n" );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     tasks,
+	     0,
+	     sizeof( zipextract_task_t ) * maximum_number_of_tasks ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear tasks.\n" );
+
+		goto on_error;
+	}
+	/* The members are extracted in batches, the central directory determines
+	 * which members are part of the archive
+	 */
+	while( entry_index < number_of_entries )
+	{
+		number_of_tasks = 0;
+
+		while( ( entry_index < number_of_entries )
+		    && ( number_of_tasks < maximum_number_of_tasks ) )
+		{
+			tasks[ number_of_tasks ].entry_index = entry_index;
+			tasks[ number_of_tasks ].result      = 0;
+
+			if( zipextract_read_central_directory_entry(
+			     central_directory_data,
+			     (size_t) central_directory_size,
+			     &central_directory_data_offset,
+			     &( tasks[ number_of_tasks ] ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read central directory entry: %" PRIu64 ".\n",
+				 entry_index );
+
+				goto on_error;
+			}
+			entry_index++;
+
+			/* Directories have no data
+			 */
+			if( ( tasks[ number_of_tasks ].name_size > 0 )
+			 && ( tasks[ number_of_tasks ].name[ tasks[ number_of_tasks ].name_size - 1 ] == '/' ) )
+			{
+				continue;
+			}
+			if( ( pattern != NULL )
+			 && ( zipextract_name_matches_pattern(
+			       tasks[ number_of_tasks ].name,
+			       tasks[ number_of_tasks ].name_size,
+			       pattern ) == 0 ) )
+			{
+				continue;
+			}
+			if( ( tasks[ number_of_tasks ].flags & ZIPEXTRACT_FLAG_ENCRYPTED ) != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported encrypted member: %" PRIu64 ".\n",
+				 tasks[ number_of_tasks ].entry_index );
+
+				number_of_failed_members++;
+
+				continue;
+			}
+			result = zipextract_get_data(
+			          memory_map,
+			          source_file,
+			          source_size,
+			          tasks[ number_of_tasks ].local_file_header_offset,
+			          ASSORTED_ZIP_MEMBER_LOCAL_FILE_HEADER_SIZE,
+			          &local_file_header_data,
+			          &local_file_header_data_buffer,
+			          &error );
+
+			if( result == 1 )
+			{
+				result = assorted_zip_member_read_local_file_header(
+				          local_file_header_data,
+				          ASSORTED_ZIP_MEMBER_LOCAL_FILE_HEADER_SIZE,
+				          &local_file_header_size,
+				          &error );
+			}
+			if( local_file_header_data_buffer != NULL )
+			{
+				memory_free(
+				 local_file_header_data_buffer );
+
+				local_file_header_data_buffer = NULL;
+			}
+			if( result == 1 )
+			{
+				result = zipextract_get_data(
+				          memory_map,
+				          source_file,
+				          source_size,
+				          tasks[ number_of_tasks ].local_file_header_offset + (off64_t) local_file_header_size,
+				          tasks[ number_of_tasks ].compressed_data_size,
+				          &( tasks[ number_of_tasks ].compressed_data ),
+				          &( tasks[ number_of_tasks ].compressed_data_buffer ),
+				          &error );
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read member: %" PRIu64 " data.\n",
+				 tasks[ number_of_tasks ].entry_index );
+
+				if( error != NULL )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+					libcerror_error_free(
+					 &error );
+				}
+				number_of_failed_members++;
+
+				continue;
+			}
+			number_of_tasks++;
+		}
+		if( zipextract_extract_tasks(
+		     tasks,
+		     number_of_tasks,
+		     number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to extract members.\n" );
+
+			goto on_error;
+		}
+		for( task_index = 0;
+		     task_index < number_of_tasks;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to extract member: %" PRIu64 " with compression method: %" PRIu16 ".\n",
+				 tasks[ task_index ].entry_index,
+				 tasks[ task_index ].compression_method );
+
+				number_of_failed_members++;
+			}
+			else
+			{
+				print_count = narrow_string_snprintf(
+				               destination,
+				               256,
+				               "%s.%" PRIu64 "",
+				               prefix,
+				               tasks[ task_index ].entry_index );
+
+				if( ( print_count < 0 )
+				 || ( print_count > 256 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to set output filename.\n" );
+
+					goto on_error;
+				}
+				if( zipextract_write_output(
+				     destination,
+				     tasks[ task_index ].uncompressed_data,
+				     (size_t) tasks[ task_index ].uncompressed_data_size,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write output file.\n" );
+
+					goto on_error;
+				}
+				if( verbose != 0 )
+				{
+					fprintf(
+					 stderr,
+					 "Extracted: %.*s to: %s\n",
+					 (int) tasks[ task_index ].name_size,
+					 (char *) tasks[ task_index ].name,
+					 destination );
+				}
+				total_uncompressed_size += tasks[ task_index ].uncompressed_data_size;
+
+				number_of_extracted_members++;
+			}
+			if( tasks[ task_index ].uncompressed_data != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].uncompressed_data );
+
+				tasks[ task_index ].uncompressed_data = NULL;
+			}
+			if( tasks[ task_index ].compressed_data_buffer != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].compressed_data_buffer );
+
+				tasks[ task_index ].compressed_data_buffer = NULL;
+			}
+		}
+	}
+	fprintf(
+	 stdout,
+	 "Extracted %d members into %" PRIu64 " bytes.\n",
+	 number_of_extracted_members,
+	 total_uncompressed_size );
+
+	/* Clean up
+	 */
+	memory_free(
+	 tasks );
+
+	tasks = NULL;
+
+	if( central_directory_data_buffer != NULL )
+	{
+		memory_free(
+		 central_directory_data_buffer );
+
+		central_directory_data_buffer = NULL;
+	}
+	if( source_file != NULL )
+	{
+		if( libcfile_file_close(
+		     source_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( assorted_memory_map_free(
+	     &memory_map,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free memory map.\n" );
+
+		goto on_error;
+	}
+	if( number_of_failed_members > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( tasks != NULL )
+	{
+		for( task_index = 0;
+		     task_index < maximum_number_of_tasks;
+		     task_index++ )
+		{
+			if( tasks[ task_index ].uncompressed_data != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].uncompressed_data );
+			}
+			if( tasks[ task_index ].compressed_data_buffer != NULL )
+			{
+				memory_free(
+				 tasks[ task_index ].compressed_data_buffer );
+			}
+		}
+		memory_free(
+		 tasks );
+	}
+	if( central_directory_data_buffer != NULL )
+	{
+		memory_free(
+		 central_directory_data_buffer );
+	}
+	if( source_file != NULL )
+	{
+		libcfile_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		assorted_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
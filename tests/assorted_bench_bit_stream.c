@@ -0,0 +1,410 @@
+/*
+ * Microbenchmark of the bit stream functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_bench_counters.h"
+#include "assorted_test_libcerror.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_bit_stream.h"
+#include "../src/assorted_timer.h"
+
+/* The size of the synthetic byte stream, which fits in the L2 cache
+ */
+#define ASSORTED_BENCH_BIT_STREAM_DATA_SIZE	( 256 * 1024 )
+
+/* The default minimum time of a measurement in milliseconds
+ */
+#define ASSORTED_BENCH_MINIMUM_TIME		100
+
+enum ASSORTED_BENCH_BIT_STREAM_FUNCTIONS
+{
+	ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE			= 0,
+	ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE_BACK_TO_FRONT	= 1,
+	ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE_FRONT_TO_BACK	= 2
+};
+
+/* The number of bits read per value
+ */
+static uint8_t assorted_bench_bit_stream_number_of_bits[ 8 ] = {
+	1, 3, 7, 9, 13, 16, 24, 32 };
+
+/* Prevents the benchmark loops from being optimized away
+ */
+volatile uint32_t assorted_bench_bit_stream_sink = 0;
+
+/* Fills a buffer with pseudo random data using xorshift64
+ */
+void assorted_bench_bit_stream_fill_random(
+      uint8_t *data,
+      size_t data_size )
+{
+	uint64_t state      = 0x9e3779b97f4a7c15ULL;
+	size_t data_offset  = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		data[ data_offset ] = (uint8_t) ( state >> 32 );
+	}
+}
+
+/* Reads all the values of a number of bits from the bit stream
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bench_bit_stream_read_values(
+     assorted_bit_stream_t *bit_stream,
+     int function,
+     uint8_t number_of_bits,
+     uint64_t number_of_values,
+     libcerror_error_t **error )
+{
+	uint64_t value_index = 0;
+	uint32_t checksum    = 0;
+	uint32_t value_32bit = 0;
+	int result           = 0;
+
+	if( assorted_bit_stream_set_byte_stream_offset(
+	     bit_stream,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		switch( function )
+		{
+			case ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE_BACK_TO_FRONT:
+				result = assorted_bit_stream_get_value_back_to_front(
+				          bit_stream,
+				          number_of_bits,
+				          &value_32bit,
+				          error );
+				break;
+
+			case ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE_FRONT_TO_BACK:
+				result = assorted_bit_stream_get_value_front_to_back(
+				          bit_stream,
+				          number_of_bits,
+				          &value_32bit,
+				          error );
+				break;
+
+			default:
+				result = assorted_bit_stream_get_value(
+				          bit_stream,
+				          number_of_bits,
+				          &value_32bit,
+				          error );
+				break;
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+		checksum ^= value_32bit;
+	}
+	assorted_bench_bit_stream_sink ^= checksum;
+
+	return( 1 );
+}
+
+/* Benchmarks a bit stream function
+ * Writes a line of comma separated values to stdout
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bench_bit_stream_function(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t storage_type,
+     int function,
+     uint8_t number_of_bits,
+     uint64_t minimum_time,
+     assorted_bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	const char *function_name         = NULL;
+	uint64_t elapsed_time             = 0;
+	uint64_t number_of_runs           = 1;
+	uint64_t number_of_values         = 0;
+	uint64_t run_index                = 0;
+	uint64_t start_time               = 0;
+
+	if( assorted_bit_stream_initialize(
+	     &bit_stream,
+	     data,
+	     data_size,
+	     0,
+	     storage_type,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	switch( function )
+	{
+		case ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE_BACK_TO_FRONT:
+			function_name = "assorted_bit_stream_get_value_back_to_front";
+			break;
+
+		case ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE_FRONT_TO_BACK:
+			function_name = "assorted_bit_stream_get_value_front_to_back";
+			break;
+
+		default:
+			function_name = "assorted_bit_stream_get_value";
+			break;
+	}
+	number_of_values = ( (uint64_t) data_size * 8 ) / number_of_bits;
+
+	/* Warm up the caches and the branch predictors
+	 */
+	if( assorted_bench_bit_stream_read_values(
+	     bit_stream,
+	     function,
+	     number_of_bits,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( number_of_runs != 0 )
+	{
+		assorted_bench_counters_start(
+		 counters );
+
+		start_time = assorted_timer_get_time();
+
+		for( run_index = 0;
+		     run_index < number_of_runs;
+		     run_index++ )
+		{
+			if( assorted_bench_bit_stream_read_values(
+			     bit_stream,
+			     function,
+			     number_of_bits,
+			     number_of_values,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		elapsed_time = assorted_timer_get_time() - start_time;
+
+		assorted_bench_counters_stop(
+		 counters );
+
+		if( elapsed_time >= minimum_time )
+		{
+			break;
+		}
+		number_of_runs *= 2;
+	}
+	number_of_values *= number_of_runs;
+
+	fprintf(
+	 stdout,
+	 "%s,%s,%" PRIu8 ",%" PRIu64 ",%.6f,%.3f",
+	 function_name,
+	 ( storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT ) ? "back_to_front" : "front_to_back",
+	 number_of_bits,
+	 number_of_values,
+	 (double) elapsed_time / 1000000000.0,
+	 (double) elapsed_time / (double) number_of_values );
+
+	assorted_bench_counters_fprint(
+	 stdout,
+	 counters,
+	 number_of_values );
+
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ * An optional argument contains the minimum time of a measurement in milliseconds
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	assorted_bench_counters_t counters;
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	uint64_t minimum_time    = ASSORTED_BENCH_MINIMUM_TIME;
+	int bits_index           = 0;
+	int function             = 0;
+	int storage_type_index   = 0;
+	uint8_t storage_type     = 0;
+
+	if( argc > 1 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		minimum_time = (uint64_t) wcstoul(
+		                           argv[ 1 ],
+		                           NULL,
+		                           10 );
+#else
+		minimum_time = (uint64_t) strtoul(
+		                           argv[ 1 ],
+		                           NULL,
+		                           10 );
+#endif
+	}
+	if( assorted_bench_counters_open(
+	     &counters ) == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Hardware performance counters not available.\n" );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_BENCH_BIT_STREAM_DATA_SIZE );
+
+	if( data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create data.\n" );
+
+		goto on_error;
+	}
+	assorted_bench_bit_stream_fill_random(
+	 data,
+	 ASSORTED_BENCH_BIT_STREAM_DATA_SIZE );
+
+	fprintf(
+	 stdout,
+	 "function,storage_type,number_of_bits,values,seconds,nanoseconds_per_value,cycles_per_value,instructions_per_value,branch_misses_per_value\n" );
+
+	for( storage_type_index = 0;
+	     storage_type_index < 2;
+	     storage_type_index++ )
+	{
+		if( storage_type_index == 0 )
+		{
+			storage_type = ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT;
+			function     = ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE_BACK_TO_FRONT;
+		}
+		else
+		{
+			storage_type = ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK;
+			function     = ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE_FRONT_TO_BACK;
+		}
+		for( bits_index = 0;
+		     bits_index < 8;
+		     bits_index++ )
+		{
+			if( assorted_bench_bit_stream_function(
+			     data,
+			     ASSORTED_BENCH_BIT_STREAM_DATA_SIZE,
+			     storage_type,
+			     ASSORTED_BENCH_BIT_STREAM_FUNCTION_GET_VALUE,
+			     assorted_bench_bit_stream_number_of_bits[ bits_index ],
+			     minimum_time * 1000000,
+			     &counters,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( assorted_bench_bit_stream_function(
+			     data,
+			     ASSORTED_BENCH_BIT_STREAM_DATA_SIZE,
+			     storage_type,
+			     function,
+			     assorted_bench_bit_stream_number_of_bits[ bits_index ],
+			     minimum_time * 1000000,
+			     &counters,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	assorted_bench_counters_close(
+	 &counters );
+
+	memory_free(
+	 data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run benchmark.\n" );
+
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_bench_counters_close(
+	 &counters );
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,253 @@
+/*
+ * Hardware performance counters for the benchmarks
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "assorted_bench_counters.h"
+
+#if defined( HAVE_ASSORTED_BENCH_COUNTERS )
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+/* The perf event configuration of the counters
+ */
+static const uint64_t assorted_bench_counters_configurations[ ASSORTED_BENCH_NUMBER_OF_COUNTERS ] = {
+	PERF_COUNT_HW_CPU_CYCLES,
+	PERF_COUNT_HW_INSTRUCTIONS,
+	PERF_COUNT_HW_BRANCH_MISSES };
+
+#endif /* defined( HAVE_ASSORTED_BENCH_COUNTERS ) */
+
+/* Opens the hardware performance counters of the calling thread
+ * The counters are opened as a group led by the cycles counter
+ * Returns 1 if the counters are available or 0 if not
+ */
+int assorted_bench_counters_open(
+     assorted_bench_counters_t *counters )
+{
+#if defined( HAVE_ASSORTED_BENCH_COUNTERS )
+	struct perf_event_attr attributes;
+
+	int counter_index = 0;
+	int group_fd      = -1;
+#endif
+
+	if( counters == NULL )
+	{
+		return( 0 );
+	}
+	memory_set(
+	 counters,
+	 0,
+	 sizeof( assorted_bench_counters_t ) );
+
+#if defined( HAVE_ASSORTED_BENCH_COUNTERS )
+	for( counter_index = 0;
+	     counter_index < ASSORTED_BENCH_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		memory_set(
+		 &attributes,
+		 0,
+		 sizeof( struct perf_event_attr ) );
+
+		attributes.type           = PERF_TYPE_HARDWARE;
+		attributes.size           = sizeof( struct perf_event_attr );
+		attributes.config         = assorted_bench_counters_configurations[ counter_index ];
+		attributes.disabled       = ( counter_index == 0 ) ? 1 : 0;
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv     = 1;
+
+		counters->file_descriptors[ counter_index ] = (int) syscall(
+		                                                     __NR_perf_event_open,
+		                                                     &attributes,
+		                                                     0,
+		                                                     -1,
+		                                                     group_fd,
+		                                                     0 );
+
+		if( counter_index == 0 )
+		{
+			/* Without the group leader no counters are available, which is
+			 * common in virtual machines and with a restrictive perf_event_paranoid
+			 */
+			if( counters->file_descriptors[ counter_index ] == -1 )
+			{
+				counters->file_descriptors[ 1 ] = -1;
+				counters->file_descriptors[ 2 ] = -1;
+
+				return( 0 );
+			}
+			group_fd = counters->file_descriptors[ counter_index ];
+		}
+	}
+	return( 1 );
+#else
+	counters->file_descriptors[ 0 ] = -1;
+	counters->file_descriptors[ 1 ] = -1;
+	counters->file_descriptors[ 2 ] = -1;
+
+	return( 0 );
+#endif
+}
+
+/* Closes the hardware performance counters
+ */
+void assorted_bench_counters_close(
+      assorted_bench_counters_t *counters )
+{
+#if defined( HAVE_ASSORTED_BENCH_COUNTERS )
+	int counter_index = 0;
+#endif
+
+	if( counters == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_ASSORTED_BENCH_COUNTERS )
+	for( counter_index = ASSORTED_BENCH_NUMBER_OF_COUNTERS - 1;
+	     counter_index >= 0;
+	     counter_index-- )
+	{
+		if( counters->file_descriptors[ counter_index ] != -1 )
+		{
+			close(
+			 counters->file_descriptors[ counter_index ] );
+
+			counters->file_descriptors[ counter_index ] = -1;
+		}
+	}
+#endif
+}
+
+/* Resets and starts the hardware performance counters
+ */
+void assorted_bench_counters_start(
+      assorted_bench_counters_t *counters )
+{
+	if( counters == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_ASSORTED_BENCH_COUNTERS )
+	if( counters->file_descriptors[ 0 ] != -1 )
+	{
+		ioctl(
+		 counters->file_descriptors[ 0 ],
+		 PERF_EVENT_IOC_RESET,
+		 PERF_IOC_FLAG_GROUP );
+
+		ioctl(
+		 counters->file_descriptors[ 0 ],
+		 PERF_EVENT_IOC_ENABLE,
+		 PERF_IOC_FLAG_GROUP );
+	}
+#endif
+}
+
+/* Stops the hardware performance counters and reads their values
+ */
+void assorted_bench_counters_stop(
+      assorted_bench_counters_t *counters )
+{
+#if defined( HAVE_ASSORTED_BENCH_COUNTERS )
+	uint64_t value    = 0;
+	int counter_index = 0;
+#endif
+
+	if( counters == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_ASSORTED_BENCH_COUNTERS )
+	if( counters->file_descriptors[ 0 ] == -1 )
+	{
+		return;
+	}
+	ioctl(
+	 counters->file_descriptors[ 0 ],
+	 PERF_EVENT_IOC_DISABLE,
+	 PERF_IOC_FLAG_GROUP );
+
+	for( counter_index = 0;
+	     counter_index < ASSORTED_BENCH_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		value = 0;
+
+		if( counters->file_descriptors[ counter_index ] != -1 )
+		{
+			if( read(
+			     counters->file_descriptors[ counter_index ],
+			     &value,
+			     sizeof( uint64_t ) ) != (ssize_t) sizeof( uint64_t ) )
+			{
+				value = 0;
+			}
+		}
+		counters->values[ counter_index ] = value;
+	}
+#endif
+}
+
+/* Prints the cycles, instructions and branch misses per item as comma separated values
+ * Empty values are printed for the counters that are not available
+ */
+void assorted_bench_counters_fprint(
+      FILE *stream,
+      assorted_bench_counters_t *counters,
+      uint64_t number_of_items )
+{
+	int counter_index = 0;
+
+	if( ( stream == NULL )
+	 || ( counters == NULL ) )
+	{
+		return;
+	}
+	for( counter_index = 0;
+	     counter_index < ASSORTED_BENCH_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		if( ( counters->file_descriptors[ counter_index ] == -1 )
+		 || ( number_of_items == 0 ) )
+		{
+			fprintf(
+			 stream,
+			 "," );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 ",%.3f",
+			 (double) counters->values[ counter_index ] / (double) number_of_items );
+		}
+	}
+}
+
@@ -0,0 +1,79 @@
+/*
+ * Hardware performance counters for the benchmarks
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#if !defined( _ASSORTED_BENCH_COUNTERS_H )
+#define _ASSORTED_BENCH_COUNTERS_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( __linux__ ) && defined( HAVE_LINUX_PERF_EVENT_H )
+#define HAVE_ASSORTED_BENCH_COUNTERS		1
+#endif
+
+enum ASSORTED_BENCH_COUNTERS
+{
+	ASSORTED_BENCH_COUNTER_CYCLES		= 0,
+	ASSORTED_BENCH_COUNTER_INSTRUCTIONS	= 1,
+	ASSORTED_BENCH_COUNTER_BRANCH_MISSES	= 2,
+	ASSORTED_BENCH_NUMBER_OF_COUNTERS
+};
+
+typedef struct assorted_bench_counters assorted_bench_counters_t;
+
+struct assorted_bench_counters
+{
+	/* The file descriptors of the counters, -1 if not available
+	 */
+	int file_descriptors[ ASSORTED_BENCH_NUMBER_OF_COUNTERS ];
+
+	/* The values of the counters of the last measurement
+	 */
+	uint64_t values[ ASSORTED_BENCH_NUMBER_OF_COUNTERS ];
+};
+
+int assorted_bench_counters_open(
+     assorted_bench_counters_t *counters );
+
+void assorted_bench_counters_close(
+      assorted_bench_counters_t *counters );
+
+void assorted_bench_counters_start(
+      assorted_bench_counters_t *counters );
+
+void assorted_bench_counters_stop(
+      assorted_bench_counters_t *counters );
+
+void assorted_bench_counters_fprint(
+      FILE *stream,
+      assorted_bench_counters_t *counters,
+      uint64_t number_of_items );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_BENCH_COUNTERS_H ) */
+
@@ -0,0 +1,652 @@
+/*
+ * Microbenchmark of the Huffman tree functions
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_bench_counters.h"
+#include "assorted_test_libcerror.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_bit_stream.h"
+#include "../src/assorted_bit_stream_writer.h"
+#include "../src/assorted_huffman_tree.h"
+#include "../src/assorted_timer.h"
+
+/* The number of symbols in the synthetic streams
+ */
+#define ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_STREAM_SYMBOLS	( 256 * 1024 )
+
+/* The maximum number of symbols of a Huffman tree
+ */
+#define ASSORTED_BENCH_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS	288
+
+/* The default minimum time of a measurement in milliseconds
+ */
+#define ASSORTED_BENCH_MINIMUM_TIME				100
+
+enum ASSORTED_BENCH_HUFFMAN_TREE_CASES
+{
+	ASSORTED_BENCH_HUFFMAN_TREE_CASE_RANDOM_BITS	= 0,
+	ASSORTED_BENCH_HUFFMAN_TREE_CASE_SKEWED		= 1,
+	ASSORTED_BENCH_HUFFMAN_TREE_CASE_MAXIMUM_LENGTH	= 2,
+	ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_CASES
+};
+
+/* The names of the cases
+ */
+static const char *assorted_bench_huffman_tree_case_names[ ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_CASES ] = {
+	"random_bits",
+	"skewed",
+	"maximum_length" };
+
+/* Prevents the benchmark loops from being optimized away
+ */
+volatile uint32_t assorted_bench_huffman_tree_sink = 0;
+
+/* Retrieves the next pseudo random value using xorshift64
+ */
+uint64_t assorted_bench_huffman_tree_random(
+          uint64_t *state )
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+
+	return( *state );
+}
+
+/* Determines the code sizes and the symbol frequencies of a case
+ * The frequencies are the distribution the symbols of the stream are drawn from
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bench_huffman_tree_get_case(
+     int case_index,
+     uint8_t *code_sizes,
+     uint32_t *frequencies,
+     int *number_of_symbols,
+     libcerror_error_t **error )
+{
+	int symbol = 0;
+
+	memory_set(
+	 code_sizes,
+	 0,
+	 sizeof( uint8_t ) * ASSORTED_BENCH_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS );
+
+	memory_set(
+	 frequencies,
+	 0,
+	 sizeof( uint32_t ) * ASSORTED_BENCH_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS );
+
+	switch( case_index )
+	{
+		case ASSORTED_BENCH_HUFFMAN_TREE_CASE_RANDOM_BITS:
+			/* The fixed DEFLATE literals tree is complete, hence any
+			 * sequence of random bits can be decoded
+			 */
+			for( symbol = 0;
+			     symbol < 288;
+			     symbol++ )
+			{
+				if( symbol < 144 )
+				{
+					code_sizes[ symbol ] = 8;
+				}
+				else if( symbol < 256 )
+				{
+					code_sizes[ symbol ] = 9;
+				}
+				else if( symbol < 280 )
+				{
+					code_sizes[ symbol ] = 7;
+				}
+				else
+				{
+					code_sizes[ symbol ] = 8;
+				}
+			}
+			*number_of_symbols = 288;
+
+			break;
+
+		case ASSORTED_BENCH_HUFFMAN_TREE_CASE_SKEWED:
+			/* A Zipf-like distribution as found in text literals
+			 */
+			for( symbol = 0;
+			     symbol < 256;
+			     symbol++ )
+			{
+				frequencies[ symbol ] = 1 + ( 1000000 / (uint32_t) ( ( symbol + 1 ) * ( symbol + 1 ) ) );
+			}
+			*number_of_symbols = 256;
+
+			if( assorted_huffman_tree_build_code_sizes(
+			     frequencies,
+			     256,
+			     15,
+			     code_sizes,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			break;
+
+		case ASSORTED_BENCH_HUFFMAN_TREE_CASE_MAXIMUM_LENGTH:
+			/* Symbol 0 to 13 use code sizes 1 to 14 and symbol 14 and 15
+			 * use code size 15, the stream consists of the symbols with
+			 * a code size of 12 or more that are decoded using a sub table
+			 */
+			for( symbol = 0;
+			     symbol < 16;
+			     symbol++ )
+			{
+				if( symbol < 14 )
+				{
+					code_sizes[ symbol ] = (uint8_t) ( symbol + 1 );
+				}
+				else
+				{
+					code_sizes[ symbol ] = 15;
+				}
+				if( code_sizes[ symbol ] >= 12 )
+				{
+					frequencies[ symbol ] = 1;
+				}
+			}
+			*number_of_symbols = 16;
+
+			break;
+	}
+	return( 1 );
+}
+
+/* Creates a synthetic stream of a case
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bench_huffman_tree_create_stream(
+     int case_index,
+     const uint8_t *code_sizes,
+     const uint32_t *frequencies,
+     int number_of_symbols,
+     uint8_t storage_type,
+     uint8_t *data,
+     size_t data_size,
+     uint16_t *symbols,
+     libcerror_error_t **error )
+{
+	uint32_t codes[ ASSORTED_BENCH_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+	uint64_t cumulative_frequencies[ ASSORTED_BENCH_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	uint64_t random_state                           = 0x9e3779b97f4a7c15ULL;
+	uint64_t random_value                           = 0;
+	uint64_t total_frequency                        = 0;
+	size_t data_offset                              = 0;
+	int stream_index                                = 0;
+	int symbol                                      = 0;
+
+	if( case_index == ASSORTED_BENCH_HUFFMAN_TREE_CASE_RANDOM_BITS )
+	{
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			data[ data_offset ] = (uint8_t) ( assorted_bench_huffman_tree_random(
+			                                   &random_state ) >> 32 );
+		}
+		return( 1 );
+	}
+	if( assorted_huffman_tree_build_codes(
+	     code_sizes,
+	     number_of_symbols,
+	     storage_type,
+	     codes,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		total_frequency += frequencies[ symbol ];
+
+		cumulative_frequencies[ symbol ] = total_frequency;
+	}
+	memory_set(
+	 data,
+	 0,
+	 data_size );
+
+	if( assorted_bit_stream_writer_initialize(
+	     &bit_stream_writer,
+	     data,
+	     data_size,
+	     0,
+	     storage_type,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( stream_index = 0;
+	     stream_index < ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_STREAM_SYMBOLS;
+	     stream_index++ )
+	{
+		random_value = assorted_bench_huffman_tree_random(
+		                &random_state ) % total_frequency;
+
+		for( symbol = 0;
+		     symbol < number_of_symbols;
+		     symbol++ )
+		{
+			if( random_value < cumulative_frequencies[ symbol ] )
+			{
+				break;
+			}
+		}
+		symbols[ stream_index ] = (uint16_t) symbol;
+
+		if( assorted_bit_stream_writer_write_value(
+		     bit_stream_writer,
+		     codes[ symbol ],
+		     code_sizes[ symbol ],
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( assorted_bit_stream_writer_flush(
+	     bit_stream_writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( assorted_bit_stream_writer_free(
+	     &bit_stream_writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &bit_stream_writer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes the symbols of the stream
+ * If symbols is not NULL the decoded symbols are compared against it
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bench_huffman_tree_decode_symbols(
+     assorted_huffman_tree_t *huffman_tree,
+     assorted_bit_stream_t *bit_stream,
+     const uint16_t *symbols,
+     libcerror_error_t **error )
+{
+	uint32_t checksum = 0;
+	uint16_t symbol   = 0;
+	int stream_index  = 0;
+
+	if( assorted_bit_stream_set_byte_stream_offset(
+	     bit_stream,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( stream_index = 0;
+	     stream_index < ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_STREAM_SYMBOLS;
+	     stream_index++ )
+	{
+		if( assorted_huffman_tree_get_symbol_from_bit_stream(
+		     huffman_tree,
+		     bit_stream,
+		     &symbol,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( symbols != NULL )
+		 && ( symbol != symbols[ stream_index ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "assorted_bench_huffman_tree_decode_symbols: symbol: %d mismatch.",
+			 stream_index );
+
+			return( -1 );
+		}
+		checksum += symbol;
+	}
+	assorted_bench_huffman_tree_sink ^= checksum;
+
+	return( 1 );
+}
+
+/* Benchmarks assorted_huffman_tree_get_symbol_from_bit_stream for a case
+ * Writes a line of comma separated values to stdout
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_bench_huffman_tree_case(
+     int case_index,
+     uint8_t storage_type,
+     uint64_t minimum_time,
+     assorted_bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	uint8_t code_sizes[ ASSORTED_BENCH_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+	uint32_t frequencies[ ASSORTED_BENCH_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+
+	assorted_bit_stream_t *bit_stream       = NULL;
+	assorted_huffman_tree_t *huffman_tree   = NULL;
+	uint16_t *symbols                       = NULL;
+	uint8_t *data                           = NULL;
+	size_t data_size                        = 0;
+	uint64_t elapsed_time                   = 0;
+	uint64_t number_of_runs                 = 1;
+	uint64_t number_of_symbols_decoded      = 0;
+	uint64_t run_index                      = 0;
+	uint64_t start_time                     = 0;
+	int number_of_symbols                   = 0;
+
+	if( assorted_bench_huffman_tree_get_case(
+	     case_index,
+	     code_sizes,
+	     frequencies,
+	     &number_of_symbols,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The stream is padded so that the bit stream can refill at the end
+	 */
+	data_size = ( ( (size_t) ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_STREAM_SYMBOLS * 15 ) / 8 ) + 64;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		goto on_error;
+	}
+	symbols = (uint16_t *) memory_allocate(
+	                        sizeof( uint16_t ) * ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_STREAM_SYMBOLS );
+
+	if( symbols == NULL )
+	{
+		goto on_error;
+	}
+	if( assorted_bench_huffman_tree_create_stream(
+	     case_index,
+	     code_sizes,
+	     frequencies,
+	     number_of_symbols,
+	     storage_type,
+	     data,
+	     data_size,
+	     symbols,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( assorted_huffman_tree_initialize(
+	     &huffman_tree,
+	     number_of_symbols,
+	     15,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( assorted_huffman_tree_build(
+	     huffman_tree,
+	     code_sizes,
+	     number_of_symbols,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( assorted_bit_stream_initialize(
+	     &bit_stream,
+	     data,
+	     data_size,
+	     0,
+	     storage_type,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Verify the decoded symbols, this also warms up the caches and the
+	 * branch predictors and builds the lookup table
+	 */
+	if( assorted_bench_huffman_tree_decode_symbols(
+	     huffman_tree,
+	     bit_stream,
+	     ( case_index == ASSORTED_BENCH_HUFFMAN_TREE_CASE_RANDOM_BITS ) ? NULL : symbols,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( number_of_runs != 0 )
+	{
+		assorted_bench_counters_start(
+		 counters );
+
+		start_time = assorted_timer_get_time();
+
+		for( run_index = 0;
+		     run_index < number_of_runs;
+		     run_index++ )
+		{
+			if( assorted_bench_huffman_tree_decode_symbols(
+			     huffman_tree,
+			     bit_stream,
+			     NULL,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		elapsed_time = assorted_timer_get_time() - start_time;
+
+		assorted_bench_counters_stop(
+		 counters );
+
+		if( elapsed_time >= minimum_time )
+		{
+			break;
+		}
+		number_of_runs *= 2;
+	}
+	number_of_symbols_decoded = number_of_runs * ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_STREAM_SYMBOLS;
+
+	fprintf(
+	 stdout,
+	 "assorted_huffman_tree_get_symbol_from_bit_stream,%s,%s,%" PRIu8 ",%" PRIu64 ",%.6f,%.3f",
+	 ( storage_type == ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT ) ? "back_to_front" : "front_to_back",
+	 assorted_bench_huffman_tree_case_names[ case_index ],
+	 huffman_tree->largest_code_size,
+	 number_of_symbols_decoded,
+	 (double) elapsed_time / 1000000000.0,
+	 (double) elapsed_time / (double) number_of_symbols_decoded );
+
+	assorted_bench_counters_fprint(
+	 stdout,
+	 counters,
+	 number_of_symbols_decoded );
+
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( assorted_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( assorted_huffman_tree_free(
+	     &huffman_tree,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 symbols );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	if( symbols != NULL )
+	{
+		memory_free(
+		 symbols );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* The main program
+ * An optional argument contains the minimum time of a measurement in milliseconds
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	assorted_bench_counters_t counters;
+
+	libcerror_error_t *error = NULL;
+	uint64_t minimum_time    = ASSORTED_BENCH_MINIMUM_TIME;
+	int case_index           = 0;
+	int storage_type_index   = 0;
+	uint8_t storage_type     = 0;
+
+	if( argc > 1 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		minimum_time = (uint64_t) wcstoul(
+		                           argv[ 1 ],
+		                           NULL,
+		                           10 );
+#else
+		minimum_time = (uint64_t) strtoul(
+		                           argv[ 1 ],
+		                           NULL,
+		                           10 );
+#endif
+	}
+	if( assorted_bench_counters_open(
+	     &counters ) == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Hardware performance counters not available.\n" );
+	}
+	fprintf(
+	 stdout,
+	 "function,storage_type,case,largest_code_size,symbols,seconds,nanoseconds_per_symbol,cycles_per_symbol,instructions_per_symbol,branch_misses_per_symbol\n" );
+
+	for( storage_type_index = 0;
+	     storage_type_index < 2;
+	     storage_type_index++ )
+	{
+		if( storage_type_index == 0 )
+		{
+			storage_type = ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT;
+		}
+		else
+		{
+			storage_type = ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK;
+		}
+		for( case_index = 0;
+		     case_index < ASSORTED_BENCH_HUFFMAN_TREE_NUMBER_OF_CASES;
+		     case_index++ )
+		{
+			if( assorted_bench_huffman_tree_case(
+			     case_index,
+			     storage_type,
+			     minimum_time * 1000000,
+			     &counters,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	assorted_bench_counters_close(
+	 &counters );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	fprintf(
+	 stderr,
+	 "Unable to run benchmark.\n" );
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_bench_counters_close(
+	 &counters );
+
+	return( EXIT_FAILURE );
+}
+
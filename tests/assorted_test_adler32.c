@@ -142,6 +142,539 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_adler32_get_simd_method function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_get_simd_method(
+     void )
+{
+	int simd_method = 0;
+
+	simd_method = assorted_adler32_get_simd_method();
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "simd_method",
+	 simd_method,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_INT(
+	 "simd_method",
+	 simd_method,
+	 ASSORTED_ADLER32_SIMD_METHOD_NEON + 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_adler32_calculate_checksum_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_calculate_checksum_simd(
+     void )
+{
+	uint8_t data[ 12007 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 0;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < 12007;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = assorted_adler32_calculate_checksum_simd(
+	          &checksum_value,
+	          assorted_test_adler32_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test sizes that are not a multiple of the SIMD width and that span
+	 * multiple modulo calculations
+	 */
+	for( data_size = 31;
+	     data_size <= 12007;
+	     data_size += 1597 )
+	{
+		result = assorted_adler32_calculate_checksum_basic1(
+		          &expected_checksum_value,
+		          &( data[ 12007 - data_size ] ),
+		          data_size,
+		          0xfff0fff0UL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_adler32_calculate_checksum_simd(
+		          &checksum_value,
+		          &( data[ 12007 - data_size ] ),
+		          data_size,
+		          0xfff0fff0UL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum_value",
+		 checksum_value,
+		 expected_checksum_value );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test if the sums do not overflow with data of all bits set
+	 */
+	memory_set(
+	 data,
+	 0xff,
+	 12007 );
+
+	result = assorted_adler32_calculate_checksum_simd(
+	          &checksum_value,
+	          data,
+	          12007,
+	          0xfff0fff0UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xb2c7bacaUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( ASSORTED_ADLER32_HAVE_SSSE3 )
+	/* Test the SSSE3 kernel which is superseded by the AVX2 kernel when supported
+	 */
+	if( assorted_adler32_get_simd_method() != ASSORTED_ADLER32_SIMD_METHOD_NONE )
+	{
+		checksum_value = assorted_adler32_simd_ssse3(
+		                  0xfff0fff0UL,
+		                  data,
+		                  12000 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum_value",
+		 checksum_value,
+		 (uint32_t) 0xabe1b3d1UL );
+	}
+#endif /* defined( ASSORTED_ADLER32_HAVE_SSSE3 ) */
+
+	/* Test error cases
+	 */
+	result = assorted_adler32_calculate_checksum_simd(
+	          NULL,
+	          assorted_test_adler32_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_calculate_checksum_simd(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_calculate_checksum_simd(
+	          &checksum_value,
+	          assorted_test_adler32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_adler32_copy_calculate_checksum function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_copy_calculate_checksum(
+     void )
+{
+	uint8_t copied_data[ 20011 ];
+	uint8_t data[ 20011 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 0;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < 20011;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = assorted_adler32_copy_calculate_checksum(
+	          &checksum_value,
+	          copied_data,
+	          assorted_test_adler32_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x5101098cUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test sizes that span multiple copy blocks
+	 */
+	for( data_size = 31;
+	     data_size <= 20011;
+	     data_size += 3329 )
+	{
+		result = assorted_adler32_calculate_checksum_basic1(
+		          &expected_checksum_value,
+		          &( data[ 20011 - data_size ] ),
+		          data_size,
+		          0xfff0fff0UL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_adler32_copy_calculate_checksum(
+		          &checksum_value,
+		          copied_data,
+		          &( data[ 20011 - data_size ] ),
+		          data_size,
+		          0xfff0fff0UL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum_value",
+		 checksum_value,
+		 expected_checksum_value );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          copied_data,
+		          &( data[ 20011 - data_size ] ),
+		          data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = assorted_adler32_copy_calculate_checksum(
+	          NULL,
+	          copied_data,
+	          assorted_test_adler32_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_copy_calculate_checksum(
+	          &checksum_value,
+	          NULL,
+	          assorted_test_adler32_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_copy_calculate_checksum(
+	          &checksum_value,
+	          copied_data,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the adler32_combine function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_combine(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint32_t checksum_value        = 0;
+	uint32_t expected_value        = 0;
+	uint32_t first_checksum_value  = 0;
+	uint32_t second_checksum_value = 0;
+	int result                     = 0;
+
+	result = assorted_adler32_calculate_checksum_basic1(
+	          &expected_value,
+	          assorted_test_adler32_data,
+	          16,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_adler32_calculate_checksum_basic1(
+	          &first_checksum_value,
+	          assorted_test_adler32_data,
+	          5,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_adler32_calculate_checksum_basic1(
+	          &second_checksum_value,
+	          &( assorted_test_adler32_data[ 5 ] ),
+	          11,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_adler32_combine(
+	          &checksum_value,
+	          first_checksum_value,
+	          second_checksum_value,
+	          11,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 expected_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test combining with an empty second buffer
+	 */
+	result = assorted_adler32_combine(
+	          &checksum_value,
+	          expected_value,
+	          1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 expected_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_adler32_combine(
+	          NULL,
+	          first_checksum_value,
+	          second_checksum_value,
+	          11,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -173,6 +706,22 @@ int main(
 	 "assorted_adler32_calculate_checksum_basic1",
 	 assorted_test_adler32_calculate_checksum_basic1 );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_adler32_combine",
+	 assorted_test_adler32_combine );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_adler32_get_simd_method",
+	 assorted_test_adler32_get_simd_method );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_adler32_calculate_checksum_simd",
+	 assorted_test_adler32_calculate_checksum_simd );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_adler32_copy_calculate_checksum",
+	 assorted_test_adler32_copy_calculate_checksum );
+
 	/* TODO add tests for assorted_adler32_calculate_checksum_basic2 */
 
 	/* TODO add tests for assorted_adler32_calculate_checksum_unfolded4_1 */
@@ -189,7 +738,6 @@ int main(
 
 	/* TODO add tests for assorted_adler32_calculate_checksum_cpu_aligned */
 
-	/* TODO add tests for assorted_adler32_calculate_checksum_simd */
 
 #endif /* defined( __GNUC__ ) */
 
@@ -0,0 +1,981 @@
+/*
+ * Rolling Adler-32 functions testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_adler32.h"
+#include "../src/assorted_adler32_rolling.h"
+
+/* Define to make assorted_test_adler32_rolling generate verbose output
+#define ASSORTED_TEST_ADLER32_ROLLING_VERBOSE
+ */
+
+#define ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE		8192
+#define ASSORTED_TEST_ADLER32_ROLLING_WINDOW_SIZE	48
+
+#if defined( __GNUC__ )
+
+/* Fills a buffer with pseudo random test data
+ */
+void assorted_test_adler32_rolling_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	uint32_t value     = 0x12345678UL;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		value = ( value * 1103515245UL ) + 12345UL;
+
+		data[ data_offset ] = (uint8_t) ( value >> 16 );
+	}
+}
+
+/* Tests the assorted_adler32_rolling_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_rolling_initialize(
+     void )
+{
+	assorted_adler32_rolling_t *rolling = NULL;
+	libcerror_error_t *error            = NULL;
+	uint32_t checksum_value             = 0;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_adler32_rolling_initialize(
+	          &rolling,
+	          ASSORTED_TEST_ADLER32_ROLLING_WINDOW_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "rolling",
+	 rolling );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if an empty window has the Adler-32 of empty data
+	 */
+	result = assorted_adler32_rolling_get_checksum(
+	          rolling,
+	          &checksum_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_adler32_rolling_free(
+	          &rolling,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "rolling",
+	 rolling );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_adler32_rolling_initialize(
+	          NULL,
+	          ASSORTED_TEST_ADLER32_ROLLING_WINDOW_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_rolling_initialize(
+	          &rolling,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_rolling_initialize(
+	          &rolling,
+	          (size_t) ASSORTED_ADLER32_ROLLING_MAXIMUM_WINDOW_SIZE + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rolling != NULL )
+	{
+		assorted_adler32_rolling_free(
+		 &rolling,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_adler32_rolling_set_window function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_rolling_set_window(
+     void )
+{
+	uint8_t data[ ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE ];
+
+	assorted_adler32_rolling_t *rolling = NULL;
+	libcerror_error_t *error            = NULL;
+	uint32_t checksum_value             = 0;
+	uint32_t expected_value             = 0;
+	int result                          = 0;
+
+	assorted_test_adler32_rolling_fill_data(
+	 data,
+	 ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE );
+
+	/* Initialize test
+	 */
+	result = assorted_adler32_rolling_initialize(
+	          &rolling,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "rolling",
+	 rolling );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_adler32_rolling_set_window(
+	          rolling,
+	          data,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_adler32_rolling_get_checksum(
+	          rolling,
+	          &checksum_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_adler32_calculate_checksum_basic2(
+	          &expected_value,
+	          data,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 expected_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_adler32_rolling_set_window(
+	          NULL,
+	          data,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_rolling_set_window(
+	          rolling,
+	          NULL,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_rolling_set_window(
+	          rolling,
+	          data,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_adler32_rolling_free(
+	          &rolling,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rolling != NULL )
+	{
+		assorted_adler32_rolling_free(
+		 &rolling,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_adler32_rolling_update function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_rolling_update(
+     void )
+{
+	uint8_t data[ ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE ];
+
+	assorted_adler32_rolling_t *rolling = NULL;
+	libcerror_error_t *error            = NULL;
+	size_t data_offset                  = 0;
+	size_t window_offset                = 0;
+	uint32_t checksum_value             = 0;
+	uint32_t expected_value             = 0;
+	int result                          = 0;
+
+	assorted_test_adler32_rolling_fill_data(
+	 data,
+	 ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE );
+
+	/* Initialize test
+	 */
+	result = assorted_adler32_rolling_initialize(
+	          &rolling,
+	          ASSORTED_TEST_ADLER32_ROLLING_WINDOW_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "rolling",
+	 rolling );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the rolling Adler-32 matches the Adler-32 of the window after every byte
+	 */
+	for( data_offset = 0;
+	     data_offset < ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE;
+	     data_offset++ )
+	{
+		result = assorted_adler32_rolling_update(
+		          rolling,
+		          data[ data_offset ],
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_adler32_rolling_get_checksum(
+		          rolling,
+		          &checksum_value,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		window_offset = 0;
+
+		if( data_offset >= ASSORTED_TEST_ADLER32_ROLLING_WINDOW_SIZE )
+		{
+			window_offset = data_offset + 1 - ASSORTED_TEST_ADLER32_ROLLING_WINDOW_SIZE;
+		}
+		result = assorted_adler32_calculate_checksum_basic2(
+		          &expected_value,
+		          &( data[ window_offset ] ),
+		          data_offset + 1 - window_offset,
+		          1,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum_value",
+		 checksum_value,
+		 expected_value );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test if a reset empties the window
+	 */
+	result = assorted_adler32_rolling_reset(
+	          rolling,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_adler32_rolling_update(
+	          rolling,
+	          0xff,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_adler32_rolling_get_checksum(
+	          rolling,
+	          &checksum_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x01000100UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_adler32_rolling_update(
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_rolling_get_checksum(
+	          rolling,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_adler32_rolling_free(
+	          &rolling,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rolling != NULL )
+	{
+		assorted_adler32_rolling_free(
+		 &rolling,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_adler32_rolling_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_rolling_scan(
+     void )
+{
+	size_t boundary_offsets[ ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE ];
+	size_t expected_offsets[ ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE ];
+	uint8_t data[ ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE ];
+
+	assorted_adler32_rolling_t *rolling = NULL;
+	libcerror_error_t *error            = NULL;
+	size_t boundary_index               = 0;
+	size_t data_offset                  = 0;
+	size_t expected_number_of_offsets   = 0;
+	size_t number_of_boundaries         = 0;
+	size_t scanned_size                 = 0;
+	size_t split_size                   = 0;
+	size_t total_number_of_boundaries   = 0;
+	uint32_t checksum_value             = 0;
+	int result                          = 0;
+
+	assorted_test_adler32_rolling_fill_data(
+	 data,
+	 ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE );
+
+	/* Initialize test
+	 */
+	result = assorted_adler32_rolling_initialize(
+	          &rolling,
+	          ASSORTED_TEST_ADLER32_ROLLING_WINDOW_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "rolling",
+	 rolling );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Determine the expected boundaries byte by byte
+	 */
+	for( data_offset = 0;
+	     data_offset < ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE;
+	     data_offset++ )
+	{
+		result = assorted_adler32_rolling_update(
+		          rolling,
+		          data[ data_offset ],
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_adler32_rolling_get_checksum(
+		          rolling,
+		          &checksum_value,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( ( data_offset >= ( ASSORTED_TEST_ADLER32_ROLLING_WINDOW_SIZE - 1 ) )
+		 && ( ( checksum_value & 0x3f ) == 0 ) )
+		{
+			expected_offsets[ expected_number_of_offsets++ ] = data_offset + 1;
+		}
+	}
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "expected_number_of_offsets",
+	 (int) expected_number_of_offsets,
+	 0 );
+
+	/* Test scanning the data in one or more parts
+	 */
+	for( split_size = 1;
+	     split_size <= ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE;
+	     split_size *= 3 )
+	{
+		result = assorted_adler32_rolling_reset(
+		          rolling,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		data_offset                = 0;
+		total_number_of_boundaries = 0;
+
+		while( data_offset < ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE )
+		{
+			scanned_size = ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE - data_offset;
+
+			if( scanned_size > split_size )
+			{
+				scanned_size = split_size;
+			}
+			result = assorted_adler32_rolling_scan(
+			          rolling,
+			          &( data[ data_offset ] ),
+			          scanned_size,
+			          0x3f,
+			          boundary_offsets,
+			          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+			          &number_of_boundaries,
+			          &scanned_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( boundary_index = 0;
+			     boundary_index < number_of_boundaries;
+			     boundary_index++ )
+			{
+				ASSORTED_TEST_ASSERT_LESS_THAN_INT(
+				 "total_number_of_boundaries",
+				 (int) total_number_of_boundaries,
+				 (int) expected_number_of_offsets );
+
+				ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+				 "boundary_offset",
+				 data_offset + boundary_offsets[ boundary_index ],
+				 expected_offsets[ total_number_of_boundaries ] );
+
+				total_number_of_boundaries++;
+			}
+			data_offset += scanned_size;
+		}
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "total_number_of_boundaries",
+		 total_number_of_boundaries,
+		 expected_number_of_offsets );
+	}
+	/* Test if the scan stops at the maximum number of boundaries
+	 */
+	result = assorted_adler32_rolling_reset(
+	          rolling,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data_offset                = 0;
+	total_number_of_boundaries = 0;
+
+	while( data_offset < ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE )
+	{
+		result = assorted_adler32_rolling_scan(
+		          rolling,
+		          &( data[ data_offset ] ),
+		          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE - data_offset,
+		          0x3f,
+		          boundary_offsets,
+		          1,
+		          &number_of_boundaries,
+		          &scanned_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_boundaries != 0 )
+		{
+			ASSORTED_TEST_ASSERT_LESS_THAN_INT(
+			 "total_number_of_boundaries",
+			 (int) total_number_of_boundaries,
+			 (int) expected_number_of_offsets );
+
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "boundary_offset",
+			 data_offset + boundary_offsets[ 0 ],
+			 expected_offsets[ total_number_of_boundaries ] );
+
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "scanned_size",
+			 scanned_size,
+			 boundary_offsets[ 0 ] );
+
+			total_number_of_boundaries++;
+		}
+		data_offset += scanned_size;
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "total_number_of_boundaries",
+	 total_number_of_boundaries,
+	 expected_number_of_offsets );
+
+	/* Test error cases
+	 */
+	result = assorted_adler32_rolling_scan(
+	          NULL,
+	          data,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          0x3f,
+	          boundary_offsets,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          &number_of_boundaries,
+	          &scanned_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_rolling_scan(
+	          rolling,
+	          NULL,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          0x3f,
+	          boundary_offsets,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          &number_of_boundaries,
+	          &scanned_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_rolling_scan(
+	          rolling,
+	          data,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          0x3f,
+	          boundary_offsets,
+	          0,
+	          &number_of_boundaries,
+	          &scanned_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_adler32_rolling_scan(
+	          rolling,
+	          data,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          0x3f,
+	          boundary_offsets,
+	          ASSORTED_TEST_ADLER32_ROLLING_DATA_SIZE,
+	          &number_of_boundaries,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_adler32_rolling_free(
+	          &rolling,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rolling != NULL )
+	{
+		assorted_adler32_rolling_free(
+		 &rolling,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_ADLER32_ROLLING_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_adler32_rolling_initialize",
+	 assorted_test_adler32_rolling_initialize );
+
+	/* TODO: add tests for assorted_adler32_rolling_free */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_adler32_rolling_set_window",
+	 assorted_test_adler32_rolling_set_window );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_adler32_rolling_update",
+	 assorted_test_adler32_rolling_update );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_adler32_rolling_scan",
+	 assorted_test_adler32_rolling_scan );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,285 @@
+/*
+ * Aligned and huge page backed memory testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_aligned_memory.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_aligned_memory_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_aligned_memory_allocate(
+     void )
+{
+	uint8_t *memory = NULL;
+
+	/* Test regular cases
+	 */
+	memory = (uint8_t *) assorted_aligned_memory_allocate(
+	                      1000 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "memory alignment",
+	 (size_t) ( (intptr_t) memory % ASSORTED_ALIGNED_MEMORY_ALIGNMENT ),
+	 (size_t) 0 );
+
+	memory_set(
+	 memory,
+	 0xff,
+	 1000 );
+
+	assorted_aligned_memory_free(
+	 memory );
+
+	/* Test an allocation that can be backed by huge pages
+	 */
+	memory = (uint8_t *) assorted_aligned_memory_allocate(
+	                      ( 2 * ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE ) + 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "memory alignment",
+	 (size_t) ( (intptr_t) memory % ASSORTED_ALIGNED_MEMORY_ALIGNMENT ),
+	 (size_t) 0 );
+
+	memory_set(
+	 memory,
+	 0xff,
+	 ( 2 * ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE ) + 1 );
+
+	assorted_aligned_memory_free(
+	 memory );
+
+	/* Test error cases
+	 */
+	memory = (uint8_t *) assorted_aligned_memory_allocate(
+	                      0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "memory",
+	 memory );
+
+	memory = (uint8_t *) assorted_aligned_memory_allocate(
+	                      (size_t) SSIZE_MAX + 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "memory",
+	 memory );
+
+	return( 1 );
+
+on_error:
+	if( memory != NULL )
+	{
+		assorted_aligned_memory_free(
+		 memory );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_aligned_memory_reallocate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_aligned_memory_reallocate(
+     void )
+{
+	uint8_t *memory       = NULL;
+	uint8_t *reallocation = NULL;
+	size_t byte_index     = 0;
+
+	/* Test regular cases
+	 */
+	memory = (uint8_t *) assorted_aligned_memory_reallocate(
+	                      NULL,
+	                      256 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	for( byte_index = 0;
+	     byte_index < 256;
+	     byte_index++ )
+	{
+		memory[ byte_index ] = (uint8_t) byte_index;
+	}
+	/* Test growing into an allocation that can be backed by huge pages
+	 */
+	reallocation = (uint8_t *) assorted_aligned_memory_reallocate(
+	                            memory,
+	                            ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "reallocation",
+	 reallocation );
+
+	memory = reallocation;
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "memory alignment",
+	 (size_t) ( (intptr_t) memory % ASSORTED_ALIGNED_MEMORY_ALIGNMENT ),
+	 (size_t) 0 );
+
+	for( byte_index = 0;
+	     byte_index < 256;
+	     byte_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "memory[ byte_index ]",
+		 memory[ byte_index ],
+		 (uint8_t) byte_index );
+	}
+	memory_set(
+	 &( memory[ 256 ] ),
+	 0xff,
+	 ASSORTED_ALIGNED_MEMORY_HUGE_PAGE_SIZE - 256 );
+
+	/* Test shrinking
+	 */
+	reallocation = (uint8_t *) assorted_aligned_memory_reallocate(
+	                            memory,
+	                            128 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "reallocation",
+	 reallocation );
+
+	memory = reallocation;
+
+	for( byte_index = 0;
+	     byte_index < 128;
+	     byte_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "memory[ byte_index ]",
+		 memory[ byte_index ],
+		 (uint8_t) byte_index );
+	}
+	/* Test error cases
+	 */
+	reallocation = (uint8_t *) assorted_aligned_memory_reallocate(
+	                            memory,
+	                            (size_t) SSIZE_MAX + 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "reallocation",
+	 reallocation );
+
+	/* The memory is left unchanged on error
+	 */
+	for( byte_index = 0;
+	     byte_index < 128;
+	     byte_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "memory[ byte_index ]",
+		 memory[ byte_index ],
+		 (uint8_t) byte_index );
+	}
+	assorted_aligned_memory_free(
+	 memory );
+
+	return( 1 );
+
+on_error:
+	if( memory != NULL )
+	{
+		assorted_aligned_memory_free(
+		 memory );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_aligned_memory_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_aligned_memory_free(
+     void )
+{
+	/* Test error cases
+	 */
+	assorted_aligned_memory_free(
+	 NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_aligned_memory_allocate",
+	 assorted_test_aligned_memory_allocate );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_aligned_memory_reallocate",
+	 assorted_test_aligned_memory_reallocate );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_aligned_memory_free",
+	 assorted_test_aligned_memory_free );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -0,0 +1,759 @@
+/*
+ * Arena (bump) allocator testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_memory.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_arena.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_arena_initialize(
+     void )
+{
+	assorted_arena_t *arena  = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "arena->data_size",
+	 arena->data_size,
+	 (size_t) 1024 );
+
+	result = assorted_arena_free(
+	          &arena,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_arena_initialize(
+	          NULL,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (assorted_arena_t *) 0x12345678UL;
+
+	result = assorted_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	arena = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_arena_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_arena_allocate(
+     void )
+{
+	assorted_arena_t *arena  = NULL;
+	libcerror_error_t *error = NULL;
+	void *memory1            = NULL;
+	void *memory2            = NULL;
+	void *memory3            = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_arena_initialize(
+	          &arena,
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_arena_allocate(
+	          arena,
+	          3,
+	          &memory1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "memory1",
+	 memory1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_arena_allocate(
+	          arena,
+	          20,
+	          &memory2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The allocations are aligned and consecutive in the slab
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "memory2 - memory1",
+	 (size_t) ( (uint8_t *) memory2 - (uint8_t *) memory1 ),
+	 (size_t) ASSORTED_ARENA_ALIGNMENT );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "arena->data_offset",
+	 arena->data_offset,
+	 (size_t) 48 );
+
+	/* The allocation does not fit in the slab
+	 */
+	result = assorted_arena_allocate(
+	          arena,
+	          100,
+	          &memory3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "memory3",
+	 memory3 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_overflow_blocks",
+	 arena->number_of_overflow_blocks,
+	 1 );
+
+	memory_set(
+	 memory3,
+	 0xff,
+	 100 );
+
+	/* Test error cases
+	 */
+	result = assorted_arena_allocate(
+	          NULL,
+	          16,
+	          &memory1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_arena_allocate(
+	          arena,
+	          (size_t) SSIZE_MAX + 1,
+	          &memory1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_arena_allocate(
+	          arena,
+	          16,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_arena_free(
+	          &arena,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_arena_rewind function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_arena_rewind(
+     void )
+{
+	assorted_arena_t *arena  = NULL;
+	libcerror_error_t *error = NULL;
+	void *memory1            = NULL;
+	void *memory2            = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_arena_initialize(
+	          &arena,
+	          256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	data_offset = arena->data_offset;
+
+	result = assorted_arena_allocate(
+	          arena,
+	          32,
+	          &memory1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_arena_rewind(
+	          arena,
+	          data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The memory after the data offset is reused
+	 */
+	result = assorted_arena_allocate(
+	          arena,
+	          32,
+	          &memory2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "memory2 == memory1",
+	 (int) ( memory2 == memory1 ),
+	 1 );
+
+	/* Test error cases
+	 */
+	result = assorted_arena_rewind(
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_arena_rewind(
+	          arena,
+	          arena->data_offset + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_arena_free(
+	          &arena,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_arena_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_arena_reset(
+     void )
+{
+	assorted_arena_t *arena  = NULL;
+	libcerror_error_t *error = NULL;
+	void *memory             = NULL;
+	int allocation_index     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Without a slab all allocations are overflow blocks
+	 */
+	for( allocation_index = 0;
+	     allocation_index < 20;
+	     allocation_index++ )
+	{
+		result = assorted_arena_allocate(
+		          arena,
+		          100,
+		          &memory,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_overflow_blocks",
+	 arena->number_of_overflow_blocks,
+	 20 );
+
+	result = assorted_arena_reset(
+	          arena,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_overflow_blocks",
+	 arena->number_of_overflow_blocks,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "arena->data_size",
+	 arena->data_size,
+	 (size_t) ( 20 * 112 ) );
+
+	/* After the reset the same allocations fit in the slab
+	 */
+	for( allocation_index = 0;
+	     allocation_index < 20;
+	     allocation_index++ )
+	{
+		result = assorted_arena_allocate(
+		          arena,
+		          100,
+		          &memory,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_overflow_blocks",
+	 arena->number_of_overflow_blocks,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "arena->data_offset",
+	 arena->data_offset,
+	 arena->data_size );
+
+	/* Test error cases
+	 */
+	result = assorted_arena_reset(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_arena_free(
+	          &arena,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_arena_initialize",
+	 assorted_test_arena_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_arena_free",
+	 assorted_test_arena_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_arena_allocate",
+	 assorted_test_arena_allocate );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_arena_rewind",
+	 assorted_test_arena_rewind );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_arena_reset",
+	 assorted_test_arena_reset );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -34,6 +34,7 @@
 #include "assorted_test_unused.h"
 
 #include "../src/assorted_ascii7.h"
+#include "../src/assorted_cpu_features.h"
 
 /* Define to make assorted_test_ascii7 generate verbose output
 #define ASSORTED_TEST_ASCII7_VERBOSE
@@ -42,6 +43,12 @@
 uint8_t assorted_test_ascii7_compressed_data[ 16 ] = {
 	0x78, 0xda, 0xbd, 0x59, 0x6d, 0x8f, 0xdb, 0xb8, 0x11, 0xfe, 0x7c, 0xfa, 0x15, 0xc4, 0x7e, 0xb9 };
 
+uint8_t assorted_test_ascii7_uncompressed_data[ 11 ] = {
+	'H', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd' };
+
+uint8_t assorted_test_ascii7_expected_compressed_data[ 10 ] = {
+	0x48, 0x65, 0x36, 0xfb, 0x0d, 0xba, 0xbf, 0xe5, 0x6c, 0x32 };
+
 #if defined( __GNUC__ )
 
 /* Tests the assorted_ascii7_get_uncompressed_data_size function
@@ -303,6 +310,603 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_ascii7_get_compressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_get_compressed_data_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data,
+	          11,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 10 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data,
+	          1,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_ascii7_get_compressed_data_size(
+	          NULL,
+	          11,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data,
+	          0,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data,
+	          11,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_ascii7_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_compress(
+     void )
+{
+	uint8_t compressed_data[ 16 ];
+	uint8_t uncompressed_data[ 11 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_size = 16;
+
+	result = assorted_ascii7_compress(
+	          assorted_test_ascii7_uncompressed_data,
+	          11,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 10 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          compressed_data,
+	          assorted_test_ascii7_expected_compressed_data,
+	          10 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 16;
+
+	result = assorted_ascii7_compress(
+	          NULL,
+	          11,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_ascii7_compress(
+	          assorted_test_ascii7_uncompressed_data,
+	          11,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_ascii7_compress(
+	          assorted_test_ascii7_uncompressed_data,
+	          11,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 9;
+
+	result = assorted_ascii7_compress(
+	          assorted_test_ascii7_uncompressed_data,
+	          11,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data contains a byte that is not 7-bit ASCII
+	 */
+	result = memory_copy(
+	          uncompressed_data,
+	          assorted_test_ascii7_uncompressed_data,
+	          11 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	uncompressed_data[ 5 ] = 0xa0;
+
+	compressed_data_size = 16;
+
+	result = assorted_ascii7_compress(
+	          uncompressed_data,
+	          11,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_ascii7_get_simd_method function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_get_simd_method(
+     void )
+{
+	int simd_method = 0;
+
+	simd_method = assorted_ascii7_get_simd_method();
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "simd_method",
+	 simd_method,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_INT(
+	 "simd_method",
+	 simd_method,
+	 ASSORTED_ASCII7_SIMD_METHOD_NEON + 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_ascii7_decompress function with and without the SIMD kernels
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_decompress_simd(
+     void )
+{
+	uint8_t compressed_data[ 1024 ];
+	uint8_t expected_data[ 1280 ];
+	uint8_t uncompressed_data[ 1280 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	size_t compressed_data_size   = 0;
+	size_t expected_data_size     = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	for( compressed_data_offset = 0;
+	     compressed_data_offset < 1024;
+	     compressed_data_offset++ )
+	{
+		compressed_data[ compressed_data_offset ] = (uint8_t) ( ( compressed_data_offset * 167 ) + ( compressed_data_offset >> 3 ) );
+	}
+	/* Test regular cases with sizes that end inside and at the end of a SIMD block
+	 */
+	for( compressed_data_size = 2;
+	     compressed_data_size <= 1024;
+	     compressed_data_size += 11 )
+	{
+		assorted_cpu_features_set_mask(
+		 0 );
+
+		expected_data_size = 1280;
+
+		result = assorted_ascii7_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          expected_data,
+		          &expected_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		assorted_cpu_features_set_mask(
+		 ASSORTED_CPU_FEATURE_ALL );
+
+		uncompressed_data_size = 1280;
+
+		result = assorted_ascii7_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 expected_data_size );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          expected_data,
+		          expected_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_ALL );
+
+	return( 0 );
+}
+
+/* Tests the assorted_ascii7_compress function with and without the SIMD kernels
+ * and the round-trip with assorted_ascii7_decompress
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_compress_simd(
+     void )
+{
+	uint8_t compressed_data[ 1024 ];
+	uint8_t expected_data[ 1024 ];
+	uint8_t uncompressed_data[ 1280 ];
+	uint8_t source_data[ 1152 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t expected_data_size     = 0;
+	size_t source_data_offset     = 0;
+	size_t source_data_size       = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	for( source_data_offset = 0;
+	     source_data_offset < 1152;
+	     source_data_offset++ )
+	{
+		source_data[ source_data_offset ] = (uint8_t) ( ( ( source_data_offset * 167 ) + ( source_data_offset >> 3 ) ) & 0x7f );
+	}
+	source_data[ 0 ] = 0xff;
+
+	/* Test regular cases with sizes that end inside and at the end of a SIMD block
+	 */
+	for( source_data_size = 1;
+	     source_data_size <= 1152;
+	     source_data_size += 13 )
+	{
+		assorted_cpu_features_set_mask(
+		 0 );
+
+		expected_data_size = 1024;
+
+		result = assorted_ascii7_compress(
+		          source_data,
+		          source_data_size,
+		          expected_data,
+		          &expected_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		assorted_cpu_features_set_mask(
+		 ASSORTED_CPU_FEATURE_ALL );
+
+		compressed_data_size = 1024;
+
+		result = assorted_ascii7_compress(
+		          source_data,
+		          source_data_size,
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "compressed_data_size",
+		 compressed_data_size,
+		 expected_data_size );
+
+		result = memory_compare(
+		          compressed_data,
+		          expected_data,
+		          expected_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( compressed_data_size < 2 )
+		{
+			continue;
+		}
+		uncompressed_data_size = 1280;
+
+		result = assorted_ascii7_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* When the number of septets modulo 8 is 7 the padding contains
+		 * a complete septet, which decompresses as a trailing 0-byte
+		 */
+		expected_data_size = source_data_size;
+
+		if( ( ( source_data_size - 1 ) % 8 ) == 7 )
+		{
+			expected_data_size += 1;
+		}
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 expected_data_size );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          source_data,
+		          source_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error case where the data contains a byte that is not 7-bit ASCII inside a SIMD block
+	 */
+	source_data[ 100 ] = 0x80;
+
+	compressed_data_size = 1024;
+
+	result = assorted_ascii7_compress(
+	          source_data,
+	          1152,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_ALL );
+
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -334,10 +938,30 @@ int main(
 	 "assorted_ascii7_get_uncompressed_data_size",
 	 assorted_test_ascii7_get_uncompressed_data_size );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_ascii7_get_compressed_data_size",
+	 assorted_test_ascii7_get_compressed_data_size );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_ascii7_get_simd_method",
+	 assorted_test_ascii7_get_simd_method );
+
 	ASSORTED_TEST_RUN(
 	 "assorted_ascii7_decompress",
 	 assorted_test_ascii7_decompress );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_ascii7_decompress_simd",
+	 assorted_test_ascii7_decompress_simd );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_ascii7_compress",
+	 assorted_test_ascii7_compress );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_ascii7_compress_simd",
+	 assorted_test_ascii7_compress_simd );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,701 @@
+/*
+ * Library async_file functions testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_memory.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_async_file.h"
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+#include <unistd.h>
+#endif
+
+/* The size of the test data, which is not a multiple of the chunk size
+ */
+#define ASSORTED_TEST_ASYNC_FILE_DATA_SIZE	( 5 * 8192 + 1234 )
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_async_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_async_file_initialize(
+     void )
+{
+	assorted_async_file_t *async_file = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_async_file_initialize(
+	          &async_file,
+	          8192,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "async_file",
+	 async_file );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "async_file->returned_slot_index",
+	 async_file->returned_slot_index,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "async_file->slots[ 1 ].buffer alignment",
+	 (int) ( (intptr_t) async_file->slots[ 1 ].buffer % ASSORTED_ASYNC_FILE_ALIGNMENT ),
+	 0 );
+
+	result = assorted_async_file_free(
+	          &async_file,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "async_file",
+	 async_file );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_async_file_initialize(
+	          NULL,
+	          8192,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	async_file = (assorted_async_file_t *) 0x12345678UL;
+
+	result = assorted_async_file_initialize(
+	          &async_file,
+	          8192,
+	          4,
+	          &error );
+
+	async_file = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_async_file_initialize(
+	          &async_file,
+	          0,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_async_file_initialize(
+	          &async_file,
+	          8192,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_async_file_initialize(
+	          &async_file,
+	          8192,
+	          ASSORTED_ASYNC_FILE_MAXIMUM_QUEUE_DEPTH + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( async_file != NULL )
+	{
+		assorted_async_file_free(
+		 &async_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_async_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_async_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_async_file_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+
+/* Tests the assorted_async_file_read_next and assorted_async_file_read_buffer functions
+ * The functions are tested if the kernel supports io_uring
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_async_file_read(
+     void )
+{
+	char filename[ 64 ];
+
+	uint8_t buffer[ 3000 ];
+
+	assorted_async_file_t *async_file = NULL;
+	libcerror_error_t *error          = NULL;
+	uint8_t *file_data                = NULL;
+	const uint8_t *data               = NULL;
+	ssize_t read_count                = 0;
+	size_t data_offset                = 0;
+	size_t data_size                  = 0;
+	int file_descriptor               = -1;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	file_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * ASSORTED_TEST_ASYNC_FILE_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "file_data",
+	 file_data );
+
+	for( data_offset = 0;
+	     data_offset < ASSORTED_TEST_ASYNC_FILE_DATA_SIZE;
+	     data_offset++ )
+	{
+		file_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + ( data_offset >> 8 ) );
+	}
+	memory_copy(
+	 filename,
+	 "/tmp/assorted_test_async_file.XXXXXX",
+	 37 );
+
+	file_descriptor = mkstemp(
+	                   filename );
+
+	ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_descriptor",
+	 file_descriptor,
+	 -1 );
+
+	result = (int) write(
+	                file_descriptor,
+	                file_data,
+	                ASSORTED_TEST_ASYNC_FILE_DATA_SIZE );
+
+	close(
+	 file_descriptor );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 ASSORTED_TEST_ASYNC_FILE_DATA_SIZE );
+
+	/* A queue depth of 2 reuses every slot for multiple chunks
+	 */
+	result = assorted_async_file_initialize(
+	          &async_file,
+	          8192,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read next with an unaligned offset to the end of the file
+	 */
+	result = assorted_async_file_open(
+	          async_file,
+	          filename,
+	          100,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		/* The kernel does not support io_uring or it is not permitted
+		 */
+		goto on_success;
+	}
+	data_offset = 100;
+
+	do
+	{
+		result = assorted_async_file_read_next(
+		          async_file,
+		          &data,
+		          &data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			if( ( data_offset + 8192 ) < ASSORTED_TEST_ASYNC_FILE_DATA_SIZE )
+			{
+				ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+				 "data_size",
+				 data_size,
+				 (size_t) 8192 );
+			}
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "data",
+			 memory_compare(
+			  data,
+			  &( file_data[ data_offset ] ),
+			  data_size ),
+			 0 );
+
+			data_offset += data_size;
+		}
+	}
+	while( result == 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) ASSORTED_TEST_ASYNC_FILE_DATA_SIZE );
+
+	result = assorted_async_file_close(
+	          async_file,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer with a size that is not a multiple of the chunk size
+	 */
+	result = assorted_async_file_open(
+	          async_file,
+	          filename,
+	          5000,
+	          20000,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 5000;
+
+	do
+	{
+		read_count = assorted_async_file_read_buffer(
+		              async_file,
+		              buffer,
+		              3000,
+		              &error );
+
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "buffer",
+		 memory_compare(
+		  buffer,
+		  &( file_data[ data_offset ] ),
+		  (size_t) read_count ),
+		 0 );
+
+		data_offset += (size_t) read_count;
+	}
+	while( read_count == 3000 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 25000 );
+
+	result = assorted_async_file_close(
+	          async_file,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read next after a partial read buffer returns the rest of the chunk
+	 */
+	result = assorted_async_file_open(
+	          async_file,
+	          filename,
+	          5000,
+	          20000,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = assorted_async_file_read_buffer(
+	              async_file,
+	              buffer,
+	              3000,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 3000 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_async_file_read_next(
+	          async_file,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 5192 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 memory_compare(
+	  data,
+	  &( file_data[ 8000 ] ),
+	  data_size ),
+	 0 );
+
+	result = assorted_async_file_close(
+	          async_file,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_async_file_open(
+	          async_file,
+	          filename,
+	          ASSORTED_TEST_ASYNC_FILE_DATA_SIZE,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_async_file_read_next(
+	          async_file,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+on_success:
+	/* Clean up
+	 */
+	result = assorted_async_file_free(
+	          &async_file,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	unlink(
+	 filename );
+
+	memory_free(
+	 file_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( async_file != NULL )
+	{
+		assorted_async_file_free(
+		 &async_file,
+		 NULL );
+	}
+	if( file_descriptor != -1 )
+	{
+		unlink(
+		 filename );
+	}
+	if( file_data != NULL )
+	{
+		memory_free(
+		 file_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING ) */
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_async_file_initialize",
+	 assorted_test_async_file_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_async_file_free",
+	 assorted_test_async_file_free );
+
+	/* TODO add tests for assorted_async_file_open */
+
+	/* TODO add tests for assorted_async_file_close */
+
+#if defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_async_file_read",
+	 assorted_test_async_file_read );
+
+#endif /* defined( ASSORTED_ASYNC_FILE_HAVE_IO_URING ) */
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -435,10 +435,10 @@ int assorted_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 0 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -470,10 +470,10 @@ int assorted_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000007UL );
+	 (uint64_t) 0x0000000000000007ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -505,10 +505,10 @@ int assorted_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 2 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -540,10 +540,10 @@ int assorted_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 6 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -656,44 +656,983 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) */
-
-/* The main program
+/* Tests the assorted_bit_stream_peek_bits function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
-#endif
+int assorted_test_bit_stream_peek_bits(
+     void )
 {
-	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
-	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+	assorted_bit_stream_t *bit_stream = NULL;
+	libcerror_error_t *error          = NULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_BIT_STREAM_VERBOSE )
-	libcnotify_verbose_set(
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_bit_stream_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-#endif
 
-#if defined( __GNUC__ )
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	ASSORTED_TEST_RUN(
-	 "assorted_bit_stream_initialize",
-	 assorted_test_bit_stream_initialize );
+	/* Test regular cases
+	 */
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
 
-	ASSORTED_TEST_RUN(
-	 "assorted_bit_stream_free",
-	 assorted_test_bit_stream_free );
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	ASSORTED_TEST_RUN(
-	 "assorted_bit_stream_get_value",
-	 assorted_test_bit_stream_get_value );
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000a78UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 7 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 56 );
+
+	/* Peeking again should not consume any bits
+	 */
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000a78UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 56 );
+
+	result = assorted_bit_stream_skip_bits(
+	          bit_stream,
+	          12,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          32,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xf6d59bddUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test peek near the end of the byte stream
+	 */
+	result = assorted_bit_stream_set_byte_stream_offset(
+	          bit_stream,
+	          14,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          20,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x0000b97eUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 16 );
+
+	/* Test front to back storage type
+	 */
+	bit_stream->storage_type = ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK;
+
+	result = assorted_bit_stream_set_byte_stream_offset(
+	          bit_stream,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x0000078dUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_skip_bits(
+	          bit_stream,
+	          12,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          32,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xabd596d8UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_set_byte_stream_offset(
+	          bit_stream,
+	          14,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          20,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x0007eb90UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_peek_bits(
+	          NULL,
+	          32,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          64,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_peek_bits(
+	          bit_stream,
+	          32,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bit_stream_skip_bits function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_skip_bits(
+     void )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	libcerror_error_t *error          = NULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_bit_stream_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_bit_stream_skip_bits(
+	          bit_stream,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 7 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 52 );
+
+	result = assorted_bit_stream_skip_bits(
+	          bit_stream,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_get_value(
+	          bit_stream,
+	          8,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x000000daUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_skip_bits(
+	          NULL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_skip_bits(
+	          bit_stream,
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bit_stream->byte_stream_offset = 16;
+	bit_stream->bit_buffer_size    = 0;
+
+	result = assorted_bit_stream_skip_bits(
+	          bit_stream,
+	          8,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bit_stream_get_value_back_to_front function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_get_value_back_to_front(
+     void )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	libcerror_error_t *error          = NULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_bit_stream_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_bit_stream_get_value_back_to_front(
+	          bit_stream,
+	          4,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000008UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 7 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 52 );
+
+	result = assorted_bit_stream_get_value_back_to_front(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000da7UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 40 );
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_get_value_back_to_front(
+	          NULL,
+	          4,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_get_value_back_to_front(
+	          bit_stream,
+	          64,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_get_value_back_to_front(
+	          bit_stream,
+	          4,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bit_stream->byte_stream_offset = 16;
+	bit_stream->bit_buffer_size    = 0;
+
+	result = assorted_bit_stream_get_value_back_to_front(
+	          bit_stream,
+	          32,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bit_stream_get_value_front_to_back function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_get_value_front_to_back(
+     void )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	libcerror_error_t *error          = NULL;
+	uint32_t value_32bit              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_bit_stream_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_bit_stream_get_value_front_to_back(
+	          bit_stream,
+	          4,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000007UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 7 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 52 );
+
+	result = assorted_bit_stream_get_value_front_to_back(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x000008daUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 40 );
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_get_value_front_to_back(
+	          NULL,
+	          4,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_get_value_front_to_back(
+	          bit_stream,
+	          64,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_get_value_front_to_back(
+	          bit_stream,
+	          4,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bit_stream->byte_stream_offset = 16;
+	bit_stream->bit_buffer_size    = 0;
+
+	result = assorted_bit_stream_get_value_front_to_back(
+	          bit_stream,
+	          32,
+	          &value_32bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_BIT_STREAM_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_initialize",
+	 assorted_test_bit_stream_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_free",
+	 assorted_test_bit_stream_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_get_value",
+	 assorted_test_bit_stream_get_value );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_peek_bits",
+	 assorted_test_bit_stream_peek_bits );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_skip_bits",
+	 assorted_test_bit_stream_skip_bits );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_get_value_back_to_front",
+	 assorted_test_bit_stream_get_value_back_to_front );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_get_value_front_to_back",
+	 assorted_test_bit_stream_get_value_front_to_back );
 
 #endif /* defined( __GNUC__ ) */
 
@@ -0,0 +1,1125 @@
+/*
+ * Bit-stream writer testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_memory.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_bit_stream_writer.h"
+
+/* Define to make assorted_test_bit_stream_writer generate verbose output
+#define ASSORTED_TEST_BIT_STREAM_WRITER_VERBOSE
+ */
+
+uint8_t assorted_test_bit_stream_writer_data[ 16 ];
+
+uint8_t assorted_test_bit_stream_writer_expected_data_back_to_front[ 5 ] = {
+	0xfd, 0x23, 0xd1, 0xbc, 0x3a };
+
+uint8_t assorted_test_bit_stream_writer_expected_data_front_to_back[ 5 ] = {
+	0xbf, 0x12, 0x3a, 0xbc, 0xdc };
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_bit_stream_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_writer_initialize(
+     void )
+{
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_writer_free(
+	          &bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_writer_initialize(
+	          NULL,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bit_stream_writer = (assorted_bit_stream_writer_t *) 0x12345678UL;
+
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	bit_stream_writer = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          NULL,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          (size_t) SSIZE_MAX + 1,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          0,
+	          0xff,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test assorted_bit_stream_writer_initialize with malloc failing
+		 */
+		assorted_test_malloc_attempts_before_fail = test_number;
+
+		result = assorted_bit_stream_writer_initialize(
+		          &bit_stream_writer,
+		          assorted_test_bit_stream_writer_data,
+		          16,
+		          0,
+		          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+		          &error );
+
+		if( assorted_test_malloc_attempts_before_fail != -1 )
+		{
+			assorted_test_malloc_attempts_before_fail = -1;
+
+			if( bit_stream_writer != NULL )
+			{
+				assorted_bit_stream_writer_free(
+				 &bit_stream_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "bit_stream_writer",
+			 bit_stream_writer );
+
+			ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test assorted_bit_stream_writer_initialize with memset failing
+		 */
+		assorted_test_memset_attempts_before_fail = test_number;
+
+		result = assorted_bit_stream_writer_initialize(
+		          &bit_stream_writer,
+		          assorted_test_bit_stream_writer_data,
+		          16,
+		          0,
+		          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+		          &error );
+
+		if( assorted_test_memset_attempts_before_fail != -1 )
+		{
+			assorted_test_memset_attempts_before_fail = -1;
+
+			if( bit_stream_writer != NULL )
+			{
+				assorted_bit_stream_writer_free(
+				 &bit_stream_writer,
+				 NULL );
+			}
+		}
+		else
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "bit_stream_writer",
+			 bit_stream_writer );
+
+			ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ASSORTED_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &bit_stream_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bit_stream_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_writer_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Writes the test values to a bit stream writer
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_test_bit_stream_writer_write_test_values(
+     assorted_bit_stream_writer_t *bit_stream_writer,
+     libcerror_error_t **error )
+{
+	uint32_t values[ 5 ]        = { 0x00000005UL, 0x0000001fUL, 0x00000123UL, 0x0000abcdUL, 0x00000003UL };
+	uint8_t number_of_bits[ 5 ] = { 3, 5, 12, 16, 2 };
+	int value_index             = 0;
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		if( assorted_bit_stream_writer_write_value(
+		     bit_stream_writer,
+		     values[ value_index ],
+		     number_of_bits[ value_index ],
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the assorted_bit_stream_writer_write_value function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_writer_write_value(
+     void )
+{
+	uint8_t expected_data[ 4 ]                      = { 0x8f, 0x67, 0x45, 0x23 };
+
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_bit_stream_writer_write_value(
+	          bit_stream_writer,
+	          0x12345678UL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream_writer->bit_buffer_size",
+	 bit_stream_writer->bit_buffer_size,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_writer_write_value(
+	          bit_stream_writer,
+	          0xffffffffUL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream_writer->bit_buffer",
+	 bit_stream_writer->bit_buffer,
+	 (uint64_t) 0x0fUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream_writer->bit_buffer_size",
+	 bit_stream_writer->bit_buffer_size,
+	 4 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_writer_write_value(
+	          bit_stream_writer,
+	          0x12345678UL,
+	          32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream_writer->byte_stream_offset",
+	 bit_stream_writer->byte_stream_offset,
+	 (size_t) 4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream_writer->bit_buffer_size",
+	 bit_stream_writer->bit_buffer_size,
+	 4 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_bit_stream_writer_data,
+	          expected_data,
+	          4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_writer_write_value(
+	          NULL,
+	          0x0fUL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_writer_write_value(
+	          bit_stream_writer,
+	          0x0fUL,
+	          33,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bit_stream_writer->byte_stream_offset = 14;
+
+	result = assorted_bit_stream_writer_write_value(
+	          bit_stream_writer,
+	          0x12345678UL,
+	          32,
+	          &error );
+
+	bit_stream_writer->byte_stream_offset = 4;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_writer_free(
+	          &bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &bit_stream_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bit_stream_writer_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_writer_flush(
+     void )
+{
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_test_bit_stream_writer_write_test_values(
+	          bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_writer_flush(
+	          bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream_writer->byte_stream_offset",
+	 bit_stream_writer->byte_stream_offset,
+	 (size_t) 5 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream_writer->bit_buffer_size",
+	 bit_stream_writer->bit_buffer_size,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_bit_stream_writer_data,
+	          assorted_test_bit_stream_writer_expected_data_back_to_front,
+	          5 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_bit_stream_writer_free(
+	          &bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_test_bit_stream_writer_write_test_values(
+	          bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_writer_flush(
+	          bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream_writer->byte_stream_offset",
+	 bit_stream_writer->byte_stream_offset,
+	 (size_t) 5 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream_writer->bit_buffer_size",
+	 bit_stream_writer->bit_buffer_size,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_bit_stream_writer_data,
+	          assorted_test_bit_stream_writer_expected_data_front_to_back,
+	          5 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_writer_flush(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_writer_write_value(
+	          bit_stream_writer,
+	          0x01UL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	bit_stream_writer->byte_stream_offset = 16;
+
+	result = assorted_bit_stream_writer_flush(
+	          bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_writer_free(
+	          &bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &bit_stream_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bit_stream_writer_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bit_stream_writer_write_data(
+     void )
+{
+	uint8_t data[ 2 ]                               = { 0x11, 0x22 };
+	uint8_t expected_data[ 3 ]                      = { 0x05, 0x11, 0x22 };
+
+	assorted_bit_stream_writer_t *bit_stream_writer = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_writer_initialize(
+	          &bit_stream_writer,
+	          assorted_test_bit_stream_writer_data,
+	          16,
+	          0,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_bit_stream_writer_write_value(
+	          bit_stream_writer,
+	          0x05UL,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_writer_write_data(
+	          bit_stream_writer,
+	          data,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream_writer->byte_stream_offset",
+	 bit_stream_writer->byte_stream_offset,
+	 (size_t) 3 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_bit_stream_writer_data,
+	          expected_data,
+	          3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_bit_stream_writer_write_data(
+	          NULL,
+	          data,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_writer_write_data(
+	          bit_stream_writer,
+	          NULL,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bit_stream_writer_write_data(
+	          bit_stream_writer,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bit_stream_writer->byte_stream_offset = 15;
+
+	result = assorted_bit_stream_writer_write_data(
+	          bit_stream_writer,
+	          data,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_writer_free(
+	          &bit_stream_writer,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream_writer",
+	 bit_stream_writer );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream_writer != NULL )
+	{
+		assorted_bit_stream_writer_free(
+		 &bit_stream_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_BIT_STREAM_WRITER_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_writer_initialize",
+	 assorted_test_bit_stream_writer_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_writer_free",
+	 assorted_test_bit_stream_writer_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_writer_write_value",
+	 assorted_test_bit_stream_writer_write_value );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_writer_flush",
+	 assorted_test_bit_stream_writer_flush );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bit_stream_writer_write_data",
+	 assorted_test_bit_stream_writer_write_data );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -31,6 +31,7 @@
 #include "assorted_test_libcerror.h"
 #include "assorted_test_libcnotify.h"
 #include "assorted_test_macros.h"
+#include "assorted_test_memory.h"
 #include "assorted_test_unused.h"
 
 #include "../src/assorted_bit_stream.h"
@@ -61,6 +62,15 @@ uint8_t assorted_test_bzip_compressed_data2[ 122 ] = {
 	0xf3, 0x2f, 0x19, 0x0a, 0x3e, 0x96, 0x3e, 0x82, 0x0a, 0x03, 0xa8, 0x0a, 0x0b, 0x35, 0x44, 0xfc,
 	0x5d, 0xc9, 0x14, 0xe1, 0x42, 0x43, 0xbc, 0xb7, 0xe8, 0x58 };
 
+/* 10000 zero bytes followed by 600 times "assorted"
+ */
+uint8_t assorted_test_bzip_compressed_data3[ 76 ] = {
+	0x42, 0x5a, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0xd5, 0xdd, 0x48, 0xbc, 0x00, 0x00,
+	0x13, 0xc9, 0x80, 0xc0, 0x00, 0x08, 0x00, 0x26, 0x00, 0x9c, 0x00, 0x00, 0x08, 0x20, 0x00, 0x6a,
+	0x0a, 0x55, 0x06, 0x27, 0xa8, 0x14, 0xaa, 0x0c, 0x6a, 0x32, 0xa3, 0xde, 0xe2, 0xae, 0xaa, 0x48,
+	0xf3, 0x42, 0x91, 0x82, 0x91, 0x82, 0x91, 0x82, 0x91, 0xd0, 0xa4, 0x60, 0xa4, 0x7c, 0x29, 0x19,
+	0x51, 0xf8, 0xbb, 0x92, 0x29, 0xc2, 0x84, 0x86, 0xae, 0xea, 0x45, 0xe0 };
+
 uint8_t assorted_test_bzip_uncompressed_data1[ 108 ] = {
 	0x49, 0x66, 0x20, 0x50, 0x65, 0x74, 0x65, 0x72, 0x20, 0x50, 0x69, 0x70, 0x65, 0x72, 0x20,
 	0x70, 0x69, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x61, 0x20, 0x70, 0x65, 0x63, 0x6b, 0x20, 0x6f,
@@ -107,19 +117,6 @@ uint8_t assorted_test_bzip_uncompressed_data2[ 512 ] = {
 
 #if defined( __GNUC__ )
 
-/* Tests the assorted_bzip_initialize_crc32_table function
- * Returns 1 if successful or 0 if not
- */
-int assorted_test_bzip_initialize_crc32_table(
-     void )
-{
-	/* Test invocation of function only
-	 */
-	assorted_bzip_initialize_crc32_table();
-
-	return( 1 );
-}
-
 /* Tests the assorted_bzip_calculate_crc32 function
  * Returns 1 if successful or 0 if not
  */
@@ -154,6 +151,45 @@ int assorted_test_bzip_calculate_crc32(
 	 "error",
 	 error );
 
+	/* Test regular cases with the data provided in parts that are not a multiple of 8
+	 */
+	result = assorted_bzip_calculate_crc32(
+	          &checksum,
+	          (uint8_t *) data,
+	          3,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bzip_calculate_crc32(
+	          &checksum,
+	          (uint8_t *) &( data[ 3 ] ),
+	          10,
+	          checksum,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x8e9a7706UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = assorted_bzip_calculate_crc32(
@@ -235,12 +271,19 @@ int assorted_test_bzip_reverse_burrows_wheeler_transform(
 	       	's', 's', 's', 'e', 'e', 'l', 'l', 'h', 'o', 'l', 'l', ' ', ' ', ' ', 'e', 'a',
 	       	'a', ' ', 'b' };
 
+	/* Consecutive run-lengths of 4 + 255, 4 + 255 and 4 + 3 times 'a' followed by 'b'
+	 */
+	uint8_t runs_input_data[ 16 ] = {
+		'a', 'a', 'a', 'a', 0xff, 0xff, 'b', 'a', 'a', 'a', 'a', 'a', 'a', 0x03, 'a', 'a' };
+
+	uint8_t runs_output_data[ 528 ];
 	uint8_t output_data[ 35 ];
-	size_t permutations[ 35 ];
+	uint32_t permutations[ 35 ];
 
 	libcerror_error_t *error  = NULL;
 	void *memset_result       = NULL;
 	size_t output_data_offset = 0;
+	size_t output_data_index  = 0;
 	int result                = 0;
 
 	/* Initialize test
@@ -248,7 +291,7 @@ int assorted_test_bzip_reverse_burrows_wheeler_transform(
 	memset_result = memory_set(
 	                 permutations,
 	                 0,
-	                 sizeof( size_t ) * 32 );
+	                 sizeof( uint32_t ) * 35 );
 
 	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
 	 "memset_result",
@@ -292,6 +335,48 @@ int assorted_test_bzip_reverse_burrows_wheeler_transform(
 	 result,
 	 0 );
 
+	/* Test consecutive run-lengths
+	 */
+	output_data_offset = 0;
+
+	result = assorted_bzip_reverse_burrows_wheeler_transform(
+	          runs_input_data,
+	          16,
+	          permutations,
+	          6,
+	          runs_output_data,
+	          528,
+	          &output_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "output_data_offset",
+	 output_data_offset,
+	 (size_t) 526 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( output_data_index = 0;
+	     output_data_index < 525;
+	     output_data_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "runs_output_data[ output_data_index ]",
+		 runs_output_data[ output_data_index ],
+		 (uint8_t) 'a' );
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "runs_output_data[ 525 ]",
+	 runs_output_data[ 525 ],
+	 (uint8_t) 'b' );
+
 	/* Test error cases
 	 */
 	output_data_offset = 0;
@@ -318,32 +403,132 @@ int assorted_test_bzip_reverse_burrows_wheeler_transform(
 	libcerror_error_free(
 	 &error );
 
+	/* Test error case where the run-lengths do not fit in the output data
+	 */
+	output_data_offset = 0;
+
+	result = assorted_bzip_reverse_burrows_wheeler_transform(
+	          runs_input_data,
+	          16,
+	          permutations,
+	          6,
+	          runs_output_data,
+	          500,
+	          &output_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
 	return( 0 );
 }
 
-/* Tests the assorted_bzip_read_stream_header function
+/* Tests the assorted_bzip_reverse_burrows_wheeler_transform_checksum function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_bzip_read_stream_header(
+int assorted_test_bzip_reverse_burrows_wheeler_transform_checksum(
      void )
 {
-	libcerror_error_t *error      = NULL;
-	size_t compressed_data_offset = 0;
-	uint8_t compression_level     = 0;
-	int result                    = 0;
+	uint8_t expected_output_data[ 35 ] = {
+		's', 'h', 'e', ' ', 's', 'e', 'l', 'l', 's', ' ', 's', 'e', 'a', 's', 'h', 'e',
+	       	'l', 'l', 's', ' ', 'b', 'y', ' ', 't', 'h', 'e', ' ', 's', 'e', 'a', 's', 'h',
+	       	'o', 'r', 'e' };
+
+	uint8_t input_data[ 35 ] = {
+		's', 's', 'e', 'e', 'y', 'e', 'e', ' ', 'h', 'h', 's', 's', 'h', 's', 'r', 't',
+	       	's', 's', 's', 'e', 'e', 'l', 'l', 'h', 'o', 'l', 'l', ' ', ' ', ' ', 'e', 'a',
+	       	'a', ' ', 'b' };
+
+	/* Consecutive run-lengths of 4 + 255, 4 + 255 and 4 + 3 times 'a' followed by 'b'
+	 */
+	uint8_t runs_input_data[ 16 ] = {
+		'a', 'a', 'a', 'a', 0xff, 0xff, 'b', 'a', 'a', 'a', 'a', 'a', 'a', 0x03, 'a', 'a' };
+
+	uint8_t runs_output_data[ 526 ];
+	uint32_t permutations[ 35 ];
+
+	libcerror_error_t *error     = NULL;
+	void *memset_result          = NULL;
+	size_t output_data_offset    = 0;
+	uint32_t crc32               = 0;
+	uint32_t expected_crc32      = 0;
+	uint32_t expected_runs_crc32 = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bzip_calculate_crc32(
+	          &expected_crc32,
+	          expected_output_data,
+	          35,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memset_result = memory_set(
+	                 runs_output_data,
+	                 'a',
+	                 525 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	runs_output_data[ 525 ] = 'b';
+
+	result = assorted_bzip_calculate_crc32(
+	          &expected_runs_crc32,
+	          runs_output_data,
+	          526,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	compressed_data_offset = 0;
+	crc32              = 0;
+	output_data_offset = 0;
 
-	result = assorted_bzip_read_stream_header(
-	          assorted_test_bzip_compressed_data1,
-	          125,
-	          &compressed_data_offset,
-	          &compression_level,
+	result = assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+	          input_data,
+	          35,
+	          permutations,
+	          30,
+	          &crc32,
+	          &output_data_offset,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -351,24 +536,65 @@ int assorted_test_bzip_read_stream_header(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
-	 "compression_level",
-	 compression_level,
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "output_data_offset",
+	 output_data_offset,
+	 (size_t) 35 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 expected_crc32 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test consecutive run-lengths
+	 */
+	crc32              = 0;
+	output_data_offset = 0;
+
+	result = assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+	          runs_input_data,
+	          16,
+	          permutations,
+	          6,
+	          &crc32,
+	          &output_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
 
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "output_data_offset",
+	 output_data_offset,
+	 (size_t) 526 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 expected_runs_crc32 );
+
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	compressed_data_offset = 0;
+	crc32              = 0;
+	output_data_offset = 0;
 
-	result = assorted_bzip_read_stream_header(
+	result = assorted_bzip_reverse_burrows_wheeler_transform_checksum(
 	          NULL,
-	          125,
-	          &compressed_data_offset,
-	          &compression_level,
+	          35,
+	          permutations,
+	          30,
+	          &crc32,
+	          &output_data_offset,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -383,11 +609,13 @@ int assorted_test_bzip_read_stream_header(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_bzip_read_stream_header(
-	          assorted_test_bzip_compressed_data1,
-	          (size_t) SSIZE_MAX + 1,
-	          &compressed_data_offset,
-	          &compression_level,
+	result = assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+	          input_data,
+	          35,
+	          NULL,
+	          30,
+	          &crc32,
+	          &output_data_offset,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -402,11 +630,34 @@ int assorted_test_bzip_read_stream_header(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_bzip_read_stream_header(
-	          assorted_test_bzip_compressed_data1,
-	          125,
+	result = assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+	          input_data,
+	          35,
+	          permutations,
+	          35,
+	          &crc32,
+	          &output_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+	          input_data,
+	          35,
+	          permutations,
+	          30,
 	          NULL,
-	          &compression_level,
+	          &output_data_offset,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -421,10 +672,139 @@ int assorted_test_bzip_read_stream_header(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_bzip_read_stream_header(
-	          assorted_test_bzip_compressed_data1,
-	          125,
-	          &compressed_data_offset,
+	result = assorted_bzip_reverse_burrows_wheeler_transform_checksum(
+	          input_data,
+	          35,
+	          permutations,
+	          30,
+	          &crc32,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_read_stream_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_read_stream_header(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	uint8_t compression_level     = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_offset = 0;
+
+	result = assorted_bzip_read_stream_header(
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          &compressed_data_offset,
+	          &compression_level,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compression_level",
+	 compression_level,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_offset = 0;
+
+	result = assorted_bzip_read_stream_header(
+	          NULL,
+	          125,
+	          &compressed_data_offset,
+	          &compression_level,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_read_stream_header(
+	          assorted_test_bzip_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &compressed_data_offset,
+	          &compression_level,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_read_stream_header(
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          NULL,
+	          &compression_level,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_read_stream_header(
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          &compressed_data_offset,
 	          NULL,
 	          &error );
 
@@ -560,6 +940,7 @@ int assorted_test_bzip_read_block_header(
 	assorted_bit_stream_t *bit_stream = NULL;
 	libcerror_error_t *error          = NULL;
 	uint64_t signature                = 0;
+	uint32_t checksum                 = 0;
 	uint32_t origin_pointer           = 0;
 	int result                        = 0;
 
@@ -611,6 +992,7 @@ int assorted_test_bzip_read_block_header(
 	          bit_stream,
 	          signature,
 	          &origin_pointer,
+	          &checksum,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -623,6 +1005,11 @@ int assorted_test_bzip_read_block_header(
 	 origin_pointer,
 	 (uint32_t) 24 );
 
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x5a55c41eUL );
+
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -633,6 +1020,7 @@ int assorted_test_bzip_read_block_header(
 	          NULL,
 	          signature,
 	          &origin_pointer,
+	          &checksum,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -694,6 +1082,7 @@ int assorted_test_bzip_read_symbol_stack(
 	libcerror_error_t *error             = NULL;
 	void *memset_result                  = NULL;
 	uint64_t signature                   = 0;
+	uint32_t checksum                    = 0;
 	uint32_t origin_pointer              = 0;
 	uint16_t number_of_symbols           = 0;
 	int result                           = 0;
@@ -744,6 +1133,7 @@ int assorted_test_bzip_read_symbol_stack(
 	          bit_stream,
 	          signature,
 	          &origin_pointer,
+	          &checksum,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -868,6 +1258,7 @@ int assorted_test_bzip_read_selectors(
 	libcerror_error_t *error          = NULL;
 	void *memset_result               = NULL;
 	uint64_t signature                = 0;
+	uint32_t checksum                 = 0;
 	uint32_t origin_pointer           = 0;
 	uint32_t value_32bit              = 0;
 	uint16_t number_of_selectors      = 0;
@@ -921,6 +1312,7 @@ int assorted_test_bzip_read_selectors(
 	          bit_stream,
 	          signature,
 	          &origin_pointer,
+	          &checksum,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1089,6 +1481,7 @@ int assorted_test_bzip_read_huffman_tree(
 	libcerror_error_t *error              = NULL;
 	void *memset_result                   = NULL;
 	uint64_t signature                    = 0;
+	uint32_t checksum                     = 0;
 	uint32_t origin_pointer               = 0;
 	uint32_t value_32bit                  = 0;
 	uint16_t number_of_selectors          = 0;
@@ -1142,6 +1535,7 @@ int assorted_test_bzip_read_huffman_tree(
 	          bit_stream,
 	          signature,
 	          &origin_pointer,
+	          &checksum,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1356,6 +1750,7 @@ int assorted_test_bzip_read_huffman_trees(
 	libcerror_error_t *error                    = NULL;
 	void *memset_result                         = NULL;
 	uint64_t signature                          = 0;
+	uint32_t checksum                           = 0;
 	uint32_t origin_pointer                     = 0;
 	uint32_t value_32bit                        = 0;
 	uint16_t number_of_selectors                = 0;
@@ -1410,6 +1805,7 @@ int assorted_test_bzip_read_huffman_trees(
 	          bit_stream,
 	          signature,
 	          &origin_pointer,
+	          &checksum,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1624,6 +2020,7 @@ int assorted_test_bzip_read_block_data(
 	void *memset_result                         = NULL;
 	size_t block_data_size                      = 0;
 	uint64_t signature                          = 0;
+	uint32_t checksum                           = 0;
 	uint32_t origin_pointer                     = 0;
 	uint32_t value_32bit                        = 0;
 	uint16_t number_of_selectors                = 0;
@@ -1678,6 +2075,7 @@ int assorted_test_bzip_read_block_data(
 	          bit_stream,
 	          signature,
 	          &origin_pointer,
+	          &checksum,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1910,26 +2308,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the assorted_bzip_read_stream_footer function
+/* Tests the assorted_bzip_decoder_initialize function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_bzip_read_stream_footer(
+int assorted_test_bzip_decoder_initialize(
      void )
 {
-	assorted_bit_stream_t *bit_stream = NULL;
-	libcerror_error_t *error          = NULL;
-	uint64_t signature                = 0;
-	uint32_t checksum                 = 0;
-	int result                        = 0;
+	assorted_bzip_decoder_t *decoder = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = assorted_bit_stream_initialize(
-	          &bit_stream,
-	          assorted_test_bzip_compressed_data1,
-	          125,
-	          107,
-	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	result = assorted_bzip_decoder_initialize(
+	          &decoder,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1938,16 +2330,15 @@ int assorted_test_bzip_read_stream_footer(
 	 1 );
 
 	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "bit_stream",
-	 bit_stream );
+	 "decoder",
+	 decoder );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = assorted_bzip_read_signature(
-	          bit_stream,
-	          &signature,
+	result = assorted_bzip_decoder_free(
+	          &decoder,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1955,45 +2346,40 @@ int assorted_test_bzip_read_stream_footer(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
-	 "signature",
-	 signature,
-	 (uint64_t) 0x177245385090UL );
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = assorted_bzip_read_stream_footer(
-	          bit_stream,
-	          signature,
-	          &checksum,
+	result = assorted_bzip_decoder_initialize(
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
-	 "checksum",
-	 checksum,
-	 (uint32_t) 0x5a55c41eUL );
+	 -1 );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = assorted_bzip_read_stream_footer(
-	          NULL,
-	          signature,
-	          &checksum,
+	libcerror_error_free(
+	 &error );
+
+	decoder = (assorted_bzip_decoder_t *) 0x12345678UL;
+
+	result = assorted_bzip_decoder_initialize(
+	          &decoder,
 	          &error );
 
+	decoder = NULL;
+
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2006,58 +2392,76 @@ int assorted_test_bzip_read_stream_footer(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		assorted_bzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
 	 */
-	result = assorted_bit_stream_free(
-	          &bit_stream,
+	result = assorted_bzip_decoder_free(
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
+	 -1 );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
-	if( bit_stream != NULL )
+	if( error != NULL )
 	{
-		assorted_bit_stream_free(
-		 &bit_stream,
-		 NULL );
+		libcerror_error_free(
+		 &error );
 	}
 	return( 0 );
 }
 
-/* Tests the assorted_bzip_decompress function
+/* Tests the assorted_bzip_decoder_resize function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_bzip_decompress(
+int assorted_test_bzip_decoder_resize(
      void )
 {
-	uint8_t uncompressed_data[ 512 ];
-
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	assorted_bzip_decoder_t *decoder = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *block_data              = NULL;
+	int result                       = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	uncompressed_data_size = 512;
-
-	result = assorted_bzip_decompress(
-	          assorted_test_bzip_compressed_data1,
-	          125,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	result = assorted_bzip_decoder_initialize(
+	          &decoder,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2065,32 +2469,1372 @@ int assorted_test_bzip_decompress(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 108 );
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          uncompressed_data,
-	          assorted_test_bzip_uncompressed_data1,
+	/* Test regular cases
+	 */
+	result = assorted_bzip_decoder_resize(
+	          decoder,
+	          200000,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decoder->maximum_block_data_size",
+	 decoder->maximum_block_data_size,
+	 (size_t) 200000 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder->block_data",
+	 decoder->block_data );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder->permutations",
+	 decoder->permutations );
+
+	/* Test that a smaller size does not reallocate the buffers
+	 */
+	block_data = decoder->block_data;
+
+	result = assorted_bzip_decoder_resize(
+	          decoder,
+	          100000,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decoder->maximum_block_data_size",
+	 decoder->maximum_block_data_size,
+	 (size_t) 200000 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "decoder->block_data == block_data",
+	 (int) ( decoder->block_data == block_data ),
+	 1 );
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_decoder_resize(
+	          NULL,
+	          100000,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_decoder_resize(
+	          decoder,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_decoder_resize(
+	          decoder,
+	          900001,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bzip_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		assorted_bzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_read_stream_footer function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_read_stream_footer(
+     void )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	libcerror_error_t *error          = NULL;
+	uint64_t signature                = 0;
+	uint32_t checksum                 = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          107,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bzip_read_signature(
+	          bit_stream,
+	          &signature,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "signature",
+	 signature,
+	 (uint64_t) 0x177245385090UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_read_stream_footer(
+	          bit_stream,
+	          signature,
+	          &checksum,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x5a55c41eUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_read_stream_footer(
+	          NULL,
+	          signature,
+	          &checksum,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = assorted_bzip_decompress(
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 108 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_bzip_uncompressed_data1,
 	          108 );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 0 );
+
+	uncompressed_data_size = 512;
+
+	result = assorted_bzip_decompress(
+	          assorted_test_bzip_compressed_data2,
+	          122,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 512 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_bzip_uncompressed_data2,
+	          512 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+/* TODO: test uncompressed data too small */
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = assorted_bzip_decompress(
+	          NULL,
+	          125,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_decompress(
+	          assorted_test_bzip_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_decompress(
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_decompress(
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_verify function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_verify(
+     void )
+{
+	uint8_t compressed_data[ 122 ];
+
+	libcerror_error_t *error      = NULL;
+	void *memcpy_result           = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_verify(
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 108 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bzip_verify(
+	          assorted_test_bzip_compressed_data2,
+	          122,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 512 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test uncompressed data that exceeds the size of the checksum buffer
+	 */
+	result = assorted_bzip_verify(
+	          assorted_test_bzip_compressed_data3,
+	          76,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 14800 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_verify(
+	          NULL,
+	          125,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_verify(
+	          assorted_test_bzip_compressed_data1,
+	          125,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test verify with a corrupted stream checksum
+	 */
+	memcpy_result = memory_copy(
+	                 compressed_data,
+	                 assorted_test_bzip_compressed_data2,
+	                 122 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	compressed_data[ 120 ] ^= 0x01;
+
+	result = assorted_bzip_verify(
+	          compressed_data,
+	          122,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_run_length_encode function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_run_length_encode(
+     void )
+{
+	uint8_t expected_block_data[ 12 ] = {
+		'a', 'b', 'b', 'b', 'c', 'c', 'c', 'c', 6, 'd', 'd', 'd' };
+
+	uint8_t uncompressed_data[ 16 ] = {
+		'a', 'b', 'b', 'b', 'c', 'c', 'c', 'c', 'c', 'c', 'c', 'c', 'c', 'c', 'd', 'd' };
+
+	uint8_t block_data[ 16 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t block_data_size          = 0;
+	size_t uncompressed_data_offset = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_run_length_encode(
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          block_data,
+	          16,
+	          &block_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 11 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          block_data,
+	          expected_block_data,
+	          11 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a run that does not fit ends the block
+	 */
+	uncompressed_data_offset = 0;
+
+	result = assorted_bzip_run_length_encode(
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          block_data,
+	          8,
+	          &block_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 4 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test determining the size of the block data only
+	 */
+	result = assorted_bzip_run_length_encode(
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          NULL,
+	          16,
+	          &block_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block_data_size",
+	 block_data_size,
+	 (size_t) 7 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_offset = 0;
+
+	result = assorted_bzip_run_length_encode(
+	          NULL,
+	          16,
+	          &uncompressed_data_offset,
+	          block_data,
+	          16,
+	          &block_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_run_length_encode(
+	          uncompressed_data,
+	          16,
+	          NULL,
+	          block_data,
+	          16,
+	          &block_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_offset = 17;
+
+	result = assorted_bzip_run_length_encode(
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          block_data,
+	          16,
+	          &block_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_offset = 0;
+
+	result = assorted_bzip_run_length_encode(
+	          uncompressed_data,
+	          16,
+	          &uncompressed_data_offset,
+	          block_data,
+	          16,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_compressor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_compressor_initialize(
+     void )
+{
+	assorted_bzip_compressor_t *compressor = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_compressor_initialize(
+	          &compressor,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressor->maximum_block_data_size",
+	 compressor->maximum_block_data_size,
+	 (size_t) 99981 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bzip_compressor_free(
+	          &compressor,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_compressor_initialize(
+	          NULL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressor = (assorted_bzip_compressor_t *) 0x12345678UL;
+
+	result = assorted_bzip_compressor_initialize(
+	          &compressor,
+	          1,
+	          &error );
+
+	compressor = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_compressor_initialize(
+	          &compressor,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_compressor_initialize(
+	          &compressor,
+	          10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressor != NULL )
+	{
+		assorted_bzip_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_compressor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_compressor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_compressor_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_compressor_build_code_sizes function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_compressor_build_code_sizes(
+     void )
+{
+	uint32_t frequencies[ 8 ] = {
+		100, 0, 1, 1, 0, 0, 50, 3 };
+
+	uint8_t code_sizes[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	uint32_t code_space      = 0;
+	uint16_t symbol          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_compressor_build_code_sizes(
+	          frequencies,
+	          8,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every symbol has a code and the code is complete
+	 */
+	for( symbol = 0;
+	     symbol < 8;
+	     symbol++ )
+	{
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+		 "code_sizes[ symbol ]",
+		 (int) code_sizes[ symbol ],
+		 0 );
+
+		code_space += (uint32_t) 1 << ( ASSORTED_BZIP_MAXIMUM_CODE_SIZE - code_sizes[ symbol ] );
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "code_space",
+	 code_space,
+	 (uint32_t) 1 << ASSORTED_BZIP_MAXIMUM_CODE_SIZE );
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_compressor_build_code_sizes(
+	          NULL,
+	          8,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_compressor_build_code_sizes(
+	          frequencies,
+	          2,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_compressor_build_code_sizes(
+	          frequencies,
+	          8,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_compress(
+     void )
+{
+	uint8_t compressed_data[ 1024 ];
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_size = 1024;
+
+	result = assorted_bzip_compress(
+	          assorted_test_bzip_uncompressed_data2,
+	          512,
+	          9,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 3 ]",
+	 compressed_data[ 3 ],
+	 (uint8_t) '9' );
+
+	uncompressed_data_size = 512;
+
+	result = assorted_bzip_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 512 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_bzip_uncompressed_data2,
+	          512 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test empty data, which is stored as a stream header and footer
+	 */
+	compressed_data_size = 1024;
+
+	result = assorted_bzip_compress(
+	          assorted_test_bzip_uncompressed_data2,
+	          0,
+	          1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 14 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 1024;
+
+	result = assorted_bzip_compress(
+	          NULL,
+	          512,
+	          9,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_compress(
+	          assorted_test_bzip_uncompressed_data2,
+	          512,
+	          0,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_compress(
+	          assorted_test_bzip_uncompressed_data2,
+	          512,
+	          9,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	uncompressed_data_size = 512;
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = assorted_bzip_decompress(
-	          assorted_test_bzip_compressed_data2,
-	          122,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_compress(
+	          assorted_test_bzip_uncompressed_data2,
+	          512,
+	          9,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the compressed data is too small
+	 */
+	compressed_data_size = 32;
+
+	result = assorted_bzip_compress(
+	          assorted_test_bzip_uncompressed_data2,
+	          512,
+	          9,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_context_initialize(
+     void )
+{
+	assorted_bzip_context_t *context = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_context_initialize(
+	          &context,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2098,36 +3842,35 @@ int assorted_test_bzip_decompress(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 512 );
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          uncompressed_data,
-	          assorted_test_bzip_uncompressed_data2,
-	          512 );
+	result = assorted_bzip_context_free(
+	          &context,
+	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-/* TODO: test uncompressed data too small */
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	uncompressed_data_size = 512;
-
-	result = assorted_bzip_decompress(
+	result = assorted_bzip_context_initialize(
 	          NULL,
-	          125,
-	          uncompressed_data,
-	          &uncompressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2142,13 +3885,14 @@ int assorted_test_bzip_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_bzip_decompress(
-	          assorted_test_bzip_compressed_data1,
-	          (size_t) SSIZE_MAX + 1,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	context = (assorted_bzip_context_t *) 0x12345678UL;
+
+	result = assorted_bzip_context_initialize(
+	          &context,
 	          &error );
 
+	context = NULL;
+
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2161,11 +3905,36 @@ int assorted_test_bzip_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_bzip_decompress(
-	          assorted_test_bzip_compressed_data1,
-	          125,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_bzip_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_context_free(
 	          NULL,
-	          &uncompressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2180,11 +3949,153 @@ int assorted_test_bzip_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_bzip_decompress(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_context_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_context_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 512 ];
+
+	assorted_bzip_context_t *context = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t uncompressed_data_size    = 0;
+	int iteration                    = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bzip_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * After the first stream the scratch memory fits in the slab of the arena
+	 */
+	for( iteration = 0;
+	     iteration < 3;
+	     iteration++ )
+	{
+		uncompressed_data_size = 512;
+
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+		assorted_test_memory_reset_statistics();
+#endif
+		result = assorted_bzip_context_decompress(
+		          context,
+		          assorted_test_bzip_compressed_data1,
+		          125,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 108 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_bzip_uncompressed_data1,
+		          108 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( iteration > 0 )
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "context->arena->number_of_overflow_blocks",
+			 context->arena->number_of_overflow_blocks,
+			 0 );
+		}
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+		/* The slab of the arena is grown by the reset of the second stream
+		 */
+		if( iteration == 0 )
+		{
+			assorted_test_memory_statistics_fprint(
+			 stdout,
+			 "assorted_bzip_context_decompress first stream" );
+		}
+		else if( iteration == 2 )
+		{
+			assorted_test_memory_statistics_fprint(
+			 stdout,
+			 "assorted_bzip_context_decompress reused context" );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "assorted_test_memory_number_of_allocations",
+			 assorted_test_memory_number_of_allocations,
+			 (uint64_t) 0 );
+		}
+#endif
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = assorted_bzip_context_decompress(
+	          NULL,
 	          assorted_test_bzip_compressed_data1,
 	          125,
 	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_context_decompress(
+	          context,
 	          NULL,
+	          125,
+	          uncompressed_data,
+	          &uncompressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2199,6 +4110,25 @@ int assorted_test_bzip_decompress(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = assorted_bzip_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -2207,6 +4137,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( context != NULL )
+	{
+		assorted_bzip_context_free(
+		 &context,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2237,10 +4173,6 @@ int main(
 
 #if defined( __GNUC__ )
 
-	ASSORTED_TEST_RUN(
-	 "assorted_bzip_initialize_crc32_table",
-	 assorted_test_bzip_initialize_crc32_table );
-
 	ASSORTED_TEST_RUN(
 	 "assorted_bzip_calculate_crc32",
 	 assorted_test_bzip_calculate_crc32 );
@@ -2249,6 +4181,10 @@ int main(
 	 "assorted_bzip_reverse_burrows_wheeler_transform",
 	 assorted_test_bzip_reverse_burrows_wheeler_transform );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_reverse_burrows_wheeler_transform_checksum",
+	 assorted_test_bzip_reverse_burrows_wheeler_transform_checksum );
+
 	ASSORTED_TEST_RUN(
 	 "assorted_bzip_read_stream_header",
 	 assorted_test_bzip_read_stream_header );
@@ -2281,14 +4217,71 @@ int main(
 	 "assorted_bzip_read_block_data",
 	 assorted_test_bzip_read_block_data );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_decoder_initialize",
+	 assorted_test_bzip_decoder_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_decoder_free",
+	 assorted_test_bzip_decoder_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_decoder_resize",
+	 assorted_test_bzip_decoder_resize );
+
+	/* TODO add tests for assorted_bzip_decoder_read_block */
+
 	ASSORTED_TEST_RUN(
 	 "assorted_bzip_read_stream_footer",
 	 assorted_test_bzip_read_stream_footer );
 
+	/* TODO add tests for assorted_bzip_decode_stream */
+
 	ASSORTED_TEST_RUN(
 	 "assorted_bzip_decompress",
 	 assorted_test_bzip_decompress );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_verify",
+	 assorted_test_bzip_verify );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_run_length_encode",
+	 assorted_test_bzip_run_length_encode );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_compressor_initialize",
+	 assorted_test_bzip_compressor_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_compressor_free",
+	 assorted_test_bzip_compressor_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_compressor_build_code_sizes",
+	 assorted_test_bzip_compressor_build_code_sizes );
+
+	/* TODO add tests for assorted_bzip_compressor_sort_block, assorted_bzip_compressor_encode_symbols,
+	 * assorted_bzip_compressor_build_huffman_trees, assorted_bzip_compressor_compress_block and
+	 * assorted_bzip_compressor_write_block
+	 */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_compress",
+	 assorted_test_bzip_compress );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_context_initialize",
+	 assorted_test_bzip_context_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_context_free",
+	 assorted_test_bzip_context_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_context_decompress",
+	 assorted_test_bzip_context_decompress );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
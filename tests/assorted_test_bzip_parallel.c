@@ -0,0 +1,1033 @@
+/*
+ * BZip parallel decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_bzip.h"
+#include "../src/assorted_bzip_parallel.h"
+
+/* Define to make assorted_test_bzip_parallel generate verbose output
+#define ASSORTED_TEST_BZIP_PARALLEL_VERBOSE
+ */
+
+/* The size of the uncompressed test data, 3 blocks of compression level 1
+ */
+#define ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE	205000
+
+/* The compressed test data, 205000 bytes of "assorted" at compression level 1
+ * with block signatures at bit offsets 32, 439 and 850
+ */
+uint8_t assorted_test_bzip_parallel_compressed_data[ 163 ] = {
+	0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x88, 0x59, 0x75, 0xd4, 0x00, 0x18,
+	0x68, 0x81, 0x80, 0x26, 0x00, 0x9c, 0x00, 0x20, 0x00, 0x70, 0x43, 0x00, 0x14, 0xa8, 0x1a, 0x6a,
+	0x12, 0x82, 0xef, 0x21, 0x28, 0x2c, 0x84, 0xa0, 0xb1, 0x12, 0x82, 0xc4, 0x4a, 0x0b, 0x48, 0x94,
+	0x16, 0x22, 0x50, 0x5e, 0x84, 0xa0, 0xbe, 0x62, 0x82, 0xb2, 0x4c, 0xa6, 0xb2, 0xcb, 0x07, 0xdc,
+	0x9e, 0x01, 0x55, 0xbc, 0x03, 0x00, 0x4c, 0x01, 0x38, 0x00, 0x40, 0x00, 0xe0, 0x86, 0x00, 0x29,
+	0x4a, 0x33, 0x4c, 0x44, 0xa0, 0xbe, 0x44, 0xa0, 0xb5, 0x12, 0x82, 0xd8, 0x4a, 0x0b, 0xb0, 0x94,
+	0x16, 0x42, 0x50, 0x5d, 0x44, 0xa0, 0xb1, 0xb0, 0x94, 0x17, 0x8c, 0x50, 0x56, 0x49, 0x94, 0xd6,
+	0x56, 0xc8, 0x82, 0x30, 0x40, 0x00, 0xec, 0x20, 0x60, 0x09, 0x80, 0x27, 0x00, 0x08, 0x00, 0x14,
+	0x21, 0x80, 0x13, 0x55, 0x03, 0x4d, 0x24, 0x2b, 0x71, 0x0a, 0xc8, 0x85, 0x6f, 0x12, 0x15, 0xe8,
+	0x85, 0x69, 0x21, 0x5e, 0x48, 0x56, 0x44, 0x2b, 0xe2, 0xee, 0x48, 0xa7, 0x0a, 0x12, 0x16, 0x28,
+	0x00, 0x61, 0xa0
+};
+
+/* Fills the test data with the uncompressed data of the compressed test data
+ */
+void assorted_test_bzip_parallel_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	const char *string = "assorted";
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) string[ data_offset % 8 ];
+	}
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_bzip_parallel_find_block_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_parallel_find_block_signature(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t bit_offset      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	bit_offset = 0;
+
+	result = assorted_bzip_parallel_find_block_signature(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          &bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_offset",
+	 bit_offset,
+	 (uint64_t) 32 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	bit_offset = 33;
+
+	result = assorted_bzip_parallel_find_block_signature(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          &bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_offset",
+	 bit_offset,
+	 (uint64_t) 439 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	bit_offset = 440;
+
+	result = assorted_bzip_parallel_find_block_signature(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          &bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_offset",
+	 bit_offset,
+	 (uint64_t) 850 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	bit_offset = 851;
+
+	result = assorted_bzip_parallel_find_block_signature(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          &bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_parallel_find_block_signature(
+	          NULL,
+	          163,
+	          &bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_find_block_signature(
+	          assorted_test_bzip_parallel_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_find_block_signature(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_parallel_decompress_block function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_parallel_decompress_block(
+     void )
+{
+	assorted_bzip_parallel_block_t block;
+
+	assorted_bzip_decoder_t *decoder = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *data                    = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	assorted_test_bzip_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+	result = memory_set(
+	          &block,
+	          0,
+	          sizeof( assorted_bzip_parallel_block_t ) ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	block.compressed_data         = assorted_test_bzip_parallel_compressed_data;
+	block.compressed_data_size    = 163;
+	block.start_bit_offset        = 439;
+	block.maximum_block_data_size = 100000;
+
+	result = assorted_bzip_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_parallel_decompress_block(
+	          &block,
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "block.end_bit_offset",
+	 block.end_bit_offset,
+	 (uint64_t) 850 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "block.uncompressed_data",
+	 block.uncompressed_data );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block.uncompressed_data_size",
+	 block.uncompressed_data_size,
+	 (size_t) 99982 );
+
+	/* The second block starts after the 99981 bytes of the first block
+	 */
+	result = memory_compare(
+	          block.uncompressed_data,
+	          &( data[ 99981 ] ),
+	          block.uncompressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 block.uncompressed_data );
+
+	block.uncompressed_data = NULL;
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_parallel_decompress_block(
+	          NULL,
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_decompress_block(
+	          &block,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing a block from a bit offset without a block signature
+	 */
+	block.start_bit_offset = 440;
+
+	result = assorted_bzip_parallel_decompress_block(
+	          &block,
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "block.uncompressed_data",
+	 block.uncompressed_data );
+
+	/* Clean up
+	 */
+	result = assorted_bzip_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block.uncompressed_data != NULL )
+	{
+		memory_free(
+		 block.uncompressed_data );
+	}
+	if( decoder != NULL )
+	{
+		assorted_bzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_parallel_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_parallel_decompress(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *data                 = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t uncompressed_data_size = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	assorted_test_bzip_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		uncompressed_data_size = ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE;
+
+		result = assorted_bzip_parallel_decompress(
+		          assorted_test_bzip_parallel_compressed_data,
+		          163,
+		          number_of_threads,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          data,
+		          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE;
+
+	result = assorted_bzip_parallel_decompress(
+	          NULL,
+	          163,
+	          1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_decompress(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_decompress(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          1,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_decompress(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          1,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing with an uncompressed data size that is too small
+	 */
+	uncompressed_data_size = ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE - 1;
+
+	result = assorted_bzip_parallel_decompress(
+	          assorted_test_bzip_parallel_compressed_data,
+	          163,
+	          1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_parallel_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_parallel_compress(
+     void )
+{
+	uint8_t compressed_data[ 4096 ];
+	uint8_t expected_compressed_data[ 4096 ];
+
+	libcerror_error_t *error             = NULL;
+	uint8_t *data                        = NULL;
+	uint8_t *uncompressed_data           = NULL;
+	size_t compressed_data_size          = 0;
+	size_t expected_compressed_data_size = 0;
+	size_t uncompressed_data_size        = 0;
+	int number_of_threads                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	assorted_test_bzip_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+	expected_compressed_data_size = 4096;
+
+	result = assorted_bzip_compress(
+	          data,
+	          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE,
+	          1,
+	          expected_compressed_data,
+	          &expected_compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		compressed_data_size = 4096;
+
+		result = assorted_bzip_parallel_compress(
+		          data,
+		          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE,
+		          1,
+		          number_of_threads,
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "compressed_data_size",
+		 compressed_data_size,
+		 expected_compressed_data_size );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The blocks are joined at bit level into the same stream as a sequential compression
+		 */
+		result = memory_compare(
+		          compressed_data,
+		          expected_compressed_data,
+		          expected_compressed_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		uncompressed_data_size = ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE;
+
+		result = assorted_bzip_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          data,
+		          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	compressed_data_size = 4096;
+
+	result = assorted_bzip_parallel_compress(
+	          NULL,
+	          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE,
+	          1,
+	          1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_compress(
+	          data,
+	          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE,
+	          0,
+	          1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_compress(
+	          data,
+	          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE,
+	          1,
+	          0,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_compress(
+	          data,
+	          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE,
+	          1,
+	          1,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_parallel_compress(
+	          data,
+	          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE,
+	          1,
+	          1,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressing with a compressed data size that is too small
+	 */
+	compressed_data_size = expected_compressed_data_size - 1;
+
+	result = assorted_bzip_parallel_compress(
+	          data,
+	          ASSORTED_TEST_BZIP_PARALLEL_DATA_SIZE,
+	          1,
+	          2,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_BZIP_PARALLEL_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_parallel_find_block_signature",
+	 assorted_test_bzip_parallel_find_block_signature );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_parallel_decompress_block",
+	 assorted_test_bzip_parallel_decompress_block );
+
+	/* TODO add tests for assorted_bzip_parallel_decompress_block_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_parallel_decompress",
+	 assorted_test_bzip_parallel_decompress );
+
+	/* TODO add tests for assorted_bzip_parallel_compress_block and assorted_bzip_parallel_compress_block_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_parallel_compress",
+	 assorted_test_bzip_parallel_compress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -0,0 +1,1188 @@
+/*
+ * BZip streaming decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_bzip.h"
+#include "../src/assorted_bzip_stream.h"
+
+/* Define to make assorted_test_bzip_stream generate verbose output
+#define ASSORTED_TEST_BZIP_STREAM_VERBOSE
+ */
+
+/* The size of the uncompressed test data, 3 blocks of compression level 1
+ */
+#define ASSORTED_TEST_BZIP_STREAM_DATA_SIZE	205000
+
+/* The compressed test data, 205000 bytes of "assorted" at compression level 1
+ */
+uint8_t assorted_test_bzip_stream_compressed_data[ 163 ] = {
+	0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x88, 0x59, 0x75, 0xd4, 0x00, 0x18,
+	0x68, 0x81, 0x80, 0x26, 0x00, 0x9c, 0x00, 0x20, 0x00, 0x70, 0x43, 0x00, 0x14, 0xa8, 0x1a, 0x6a,
+	0x12, 0x82, 0xef, 0x21, 0x28, 0x2c, 0x84, 0xa0, 0xb1, 0x12, 0x82, 0xc4, 0x4a, 0x0b, 0x48, 0x94,
+	0x16, 0x22, 0x50, 0x5e, 0x84, 0xa0, 0xbe, 0x62, 0x82, 0xb2, 0x4c, 0xa6, 0xb2, 0xcb, 0x07, 0xdc,
+	0x9e, 0x01, 0x55, 0xbc, 0x03, 0x00, 0x4c, 0x01, 0x38, 0x00, 0x40, 0x00, 0xe0, 0x86, 0x00, 0x29,
+	0x4a, 0x33, 0x4c, 0x44, 0xa0, 0xbe, 0x44, 0xa0, 0xb5, 0x12, 0x82, 0xd8, 0x4a, 0x0b, 0xb0, 0x94,
+	0x16, 0x42, 0x50, 0x5d, 0x44, 0xa0, 0xb1, 0xb0, 0x94, 0x17, 0x8c, 0x50, 0x56, 0x49, 0x94, 0xd6,
+	0x56, 0xc8, 0x82, 0x30, 0x40, 0x00, 0xec, 0x20, 0x60, 0x09, 0x80, 0x27, 0x00, 0x08, 0x00, 0x14,
+	0x21, 0x80, 0x13, 0x55, 0x03, 0x4d, 0x24, 0x2b, 0x71, 0x0a, 0xc8, 0x85, 0x6f, 0x12, 0x15, 0xe8,
+	0x85, 0x69, 0x21, 0x5e, 0x48, 0x56, 0x44, 0x2b, 0xe2, 0xee, 0x48, 0xa7, 0x0a, 0x12, 0x16, 0x28,
+	0x00, 0x61, 0xa0
+};
+
+/* Fills the test data with the uncompressed data of the compressed test data
+ */
+void assorted_test_bzip_stream_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	const char *string = "assorted";
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) string[ data_offset % 8 ];
+	}
+}
+
+/* Compares the uncompressed data passed by the stream with the uncompressed data of the compressed test data
+ * The sink contains the offset of the data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_test_bzip_stream_write_data(
+     intptr_t *sink,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const char *string = "assorted";
+	size_t *offset     = (size_t *) sink;
+	size_t data_offset = 0;
+
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( error )
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( data[ data_offset ] != (uint8_t) string[ ( *offset + data_offset ) % 8 ] )
+		{
+			return( -1 );
+		}
+	}
+	*offset += data_size;
+
+	return( 1 );
+}
+
+/* Fails to write the uncompressed data passed by the stream
+ * Returns -1
+ */
+int assorted_test_bzip_stream_write_data_failure(
+     intptr_t *sink ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error ASSORTED_TEST_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( sink )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( data )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( data_size )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_bzip_stream_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_stream_initialize(
+     void )
+{
+	assorted_bzip_stream_t *stream = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bzip_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_stream_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream = (assorted_bzip_stream_t *) 0x12345678UL;
+
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	stream = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_bzip_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_stream_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_stream_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_stream_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_stream_feed function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_stream_feed(
+     void )
+{
+	uint8_t compressed_data[ 171 ];
+
+	assorted_bzip_stream_t *stream  = NULL;
+	libcerror_error_t *error        = NULL;
+	uint8_t *data                   = NULL;
+	uint8_t *uncompressed_data      = NULL;
+	size_t compressed_data_offset   = 0;
+	size_t compressed_data_size     = 0;
+	size_t uncompressed_data_offset = 0;
+	size_t uncompressed_data_size   = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	assorted_test_bzip_stream_fill_data(
+	 data,
+	 ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with the compressed data provided in parts
+	 * of 7 bytes and the uncompressed data retrieved in parts of 4096 bytes
+	 */
+	result = 0;
+
+	while( ( result == 0 )
+	    && ( compressed_data_offset < 163 ) )
+	{
+		compressed_data_size = compressed_data_offset + 7;
+
+		if( compressed_data_size > 163 )
+		{
+			compressed_data_size = 163;
+		}
+		do
+		{
+			uncompressed_data_size = 4096;
+
+			if( uncompressed_data_size > ( ASSORTED_TEST_BZIP_STREAM_DATA_SIZE - uncompressed_data_offset ) )
+			{
+				uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE - uncompressed_data_offset;
+			}
+			result = assorted_bzip_stream_feed(
+			          stream,
+			          assorted_test_bzip_stream_compressed_data,
+			          compressed_data_size,
+			          &compressed_data_offset,
+			          &( uncompressed_data[ uncompressed_data_offset ] ),
+			          &uncompressed_data_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			uncompressed_data_offset += uncompressed_data_size;
+		}
+		while( ( result == 0 )
+		    && ( uncompressed_data_size != 0 ) );
+	}
+	/* The last block is only decoded when the input is final or
+	 * when sufficient data is available
+	 */
+	while( result == 0 )
+	{
+		uncompressed_data_size = 4096;
+
+		if( uncompressed_data_size > ( ASSORTED_TEST_BZIP_STREAM_DATA_SIZE - uncompressed_data_offset ) )
+		{
+			uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE - uncompressed_data_offset;
+		}
+		result = assorted_bzip_stream_finish(
+		          stream,
+		          &( uncompressed_data[ uncompressed_data_offset ] ),
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+		 "uncompressed_data_size",
+		 (int) uncompressed_data_size,
+		 0 );
+
+		uncompressed_data_offset += uncompressed_data_size;
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 163 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          data,
+	          ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_bzip_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with data trailing the compressed data
+	 * with the uncompressed data retrieved at once
+	 */
+	result = memory_copy(
+	          compressed_data,
+	          assorted_test_bzip_stream_compressed_data,
+	          163 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &( compressed_data[ 163 ] ),
+	          0xff,
+	          8 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 0;
+	uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE;
+
+	result = assorted_bzip_stream_feed(
+	          stream,
+	          compressed_data,
+	          171,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 171 );
+
+	uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE;
+
+	result = assorted_bzip_stream_finish(
+	          stream,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          data,
+	          ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_offset = 0;
+	uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE;
+
+	result = assorted_bzip_stream_feed(
+	          stream,
+	          compressed_data,
+	          171,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bzip_stream_feed(
+	          NULL,
+	          compressed_data,
+	          171,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_bzip_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_stream_finish function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_stream_finish(
+     void )
+{
+	uint8_t compressed_data[ 163 ];
+
+	assorted_bzip_stream_t *stream = NULL;
+	libcerror_error_t *error       = NULL;
+	uint8_t *uncompressed_data     = NULL;
+	size_t compressed_data_offset  = 0;
+	size_t uncompressed_data_size  = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases with truncated compressed data
+	 */
+	uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE;
+
+	result = assorted_bzip_stream_feed(
+	          stream,
+	          assorted_test_bzip_stream_compressed_data,
+	          100,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE;
+
+	result = assorted_bzip_stream_finish(
+	          stream,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases with a corrupted stream checksum
+	 */
+	result = memory_copy(
+	          compressed_data,
+	          assorted_test_bzip_stream_compressed_data,
+	          163 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	compressed_data[ 161 ] ^= 0xff;
+
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 0;
+	uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE;
+
+	result = assorted_bzip_stream_feed(
+	          stream,
+	          compressed_data,
+	          163,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE;
+
+	result = assorted_bzip_stream_finish(
+	          stream,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_BZIP_STREAM_DATA_SIZE;
+
+	result = assorted_bzip_stream_finish(
+	          NULL,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_bzip_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_bzip_stream_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_bzip_stream_decompress(
+     void )
+{
+	assorted_bzip_stream_t *stream = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t data_offset             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_bzip_stream_decompress(
+	          stream,
+	          assorted_test_bzip_stream_compressed_data,
+	          163,
+	          &assorted_test_bzip_stream_write_data,
+	          (intptr_t *) &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) ASSORTED_TEST_BZIP_STREAM_DATA_SIZE );
+
+	result = assorted_bzip_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the compressed data is truncated
+	 */
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 0;
+
+	result = assorted_bzip_stream_decompress(
+	          stream,
+	          assorted_test_bzip_stream_compressed_data,
+	          100,
+	          &assorted_test_bzip_stream_write_data,
+	          (intptr_t *) &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the sink fails
+	 */
+	result = assorted_bzip_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bzip_stream_decompress(
+	          stream,
+	          assorted_test_bzip_stream_compressed_data,
+	          163,
+	          &assorted_test_bzip_stream_write_data_failure,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = assorted_bzip_stream_decompress(
+	          NULL,
+	          assorted_test_bzip_stream_compressed_data,
+	          163,
+	          &assorted_test_bzip_stream_write_data,
+	          (intptr_t *) &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_stream_decompress(
+	          stream,
+	          NULL,
+	          163,
+	          &assorted_test_bzip_stream_write_data,
+	          (intptr_t *) &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_stream_decompress(
+	          stream,
+	          assorted_test_bzip_stream_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &assorted_test_bzip_stream_write_data,
+	          (intptr_t *) &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_bzip_stream_decompress(
+	          stream,
+	          assorted_test_bzip_stream_compressed_data,
+	          163,
+	          NULL,
+	          (intptr_t *) &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bzip_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_bzip_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_BZIP_STREAM_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_stream_initialize",
+	 assorted_test_bzip_stream_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_stream_free",
+	 assorted_test_bzip_stream_free );
+
+	/* TODO add tests for assorted_bzip_stream_read_input */
+
+	/* TODO add tests for assorted_bzip_stream_write_output */
+
+	/* TODO add tests for assorted_bzip_stream_read_stream_header */
+
+	/* TODO add tests for assorted_bzip_stream_read_block */
+
+	/* TODO add tests for assorted_bzip_stream_decode */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_stream_feed",
+	 assorted_test_bzip_stream_feed );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_stream_finish",
+	 assorted_test_bzip_stream_finish );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_bzip_stream_decompress",
+	 assorted_test_bzip_stream_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -0,0 +1,656 @@
+/*
+ * Cabinet (CAB) folder decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_cab_folder.h"
+#include "../src/assorted_deflate.h"
+#include "../src/assorted_deflate_stream.h"
+
+/* Define to make assorted_test_cab_folder generate verbose output
+#define ASSORTED_TEST_CAB_FOLDER_VERBOSE
+ */
+
+/* The folder consists of 2 data blocks of 32768 bytes and a last data block
+ * of 1000 bytes
+ */
+#define ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS		3
+#define ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE	( ( 2 * 32768 ) + 1000 )
+#define ASSORTED_TEST_CAB_FOLDER_MAXIMUM_DATA_SIZE		( 3 * ( 8 + 2 + 65536 ) )
+
+uint8_t assorted_test_cab_folder_data[ ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE ];
+
+uint8_t assorted_test_cab_folder_mszip_data[ ASSORTED_TEST_CAB_FOLDER_MAXIMUM_DATA_SIZE ];
+
+size_t assorted_test_cab_folder_mszip_data_size = 0;
+
+uint8_t assorted_test_cab_folder_stored_data[ ASSORTED_TEST_CAB_FOLDER_MAXIMUM_DATA_SIZE ];
+
+size_t assorted_test_cab_folder_stored_data_size = 0;
+
+uint8_t assorted_test_cab_folder_uncompressed_data[ ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE + 1 ];
+
+#if defined( __GNUC__ )
+
+/* Initializes the folder data
+ * Every MSZIP data block uses the preceding uncompressed data as preset dictionary
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_folder_initialize_data(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t data_offset            = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	for( data_offset = 0;
+	     data_offset < ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE;
+	     data_offset++ )
+	{
+		assorted_test_cab_folder_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) % 251 ) ^ (uint8_t) ( data_offset / 509 );
+	}
+	data_offset = 0;
+
+	while( data_offset < ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE )
+	{
+		uncompressed_data_size = ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE - data_offset;
+
+		if( uncompressed_data_size > 32768 )
+		{
+			uncompressed_data_size = 32768;
+		}
+		compressed_data_size = ASSORTED_TEST_CAB_FOLDER_MAXIMUM_DATA_SIZE - ( assorted_test_cab_folder_mszip_data_size + 10 );
+
+		result = assorted_deflate_compress_with_dictionary(
+		          assorted_test_cab_folder_data,
+		          data_offset + uncompressed_data_size,
+		          data_offset,
+		          6,
+		          1,
+		          &( assorted_test_cab_folder_mszip_data[ assorted_test_cab_folder_mszip_data_size + 10 ] ),
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( assorted_test_cab_folder_mszip_data[ assorted_test_cab_folder_mszip_data_size ] ),
+		 0 );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( assorted_test_cab_folder_mszip_data[ assorted_test_cab_folder_mszip_data_size + 4 ] ),
+		 (uint16_t) ( compressed_data_size + 2 ) );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( assorted_test_cab_folder_mszip_data[ assorted_test_cab_folder_mszip_data_size + 6 ] ),
+		 (uint16_t) uncompressed_data_size );
+
+		assorted_test_cab_folder_mszip_data[ assorted_test_cab_folder_mszip_data_size + 8 ] = (uint8_t) 'C';
+		assorted_test_cab_folder_mszip_data[ assorted_test_cab_folder_mszip_data_size + 9 ] = (uint8_t) 'K';
+
+		assorted_test_cab_folder_mszip_data_size += 10 + compressed_data_size;
+
+		/* The stored data block has a reserved area of 4 bytes
+		 */
+		memory_set(
+		 &( assorted_test_cab_folder_stored_data[ assorted_test_cab_folder_stored_data_size ] ),
+		 0,
+		 12 );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( assorted_test_cab_folder_stored_data[ assorted_test_cab_folder_stored_data_size + 4 ] ),
+		 (uint16_t) uncompressed_data_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( assorted_test_cab_folder_stored_data[ assorted_test_cab_folder_stored_data_size + 6 ] ),
+		 (uint16_t) uncompressed_data_size );
+
+		memory_copy(
+		 &( assorted_test_cab_folder_stored_data[ assorted_test_cab_folder_stored_data_size + 12 ] ),
+		 &( assorted_test_cab_folder_data[ data_offset ] ),
+		 uncompressed_data_size );
+
+		assorted_test_cab_folder_stored_data_size += 12 + uncompressed_data_size;
+
+		data_offset += uncompressed_data_size;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_cab_folder_get_uncompressed_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_folder_get_uncompressed_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_cab_folder_get_uncompressed_size(
+	          assorted_test_cab_folder_mszip_data,
+	          assorted_test_cab_folder_mszip_data_size,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_cab_folder_get_uncompressed_size(
+	          assorted_test_cab_folder_stored_data,
+	          assorted_test_cab_folder_stored_data_size,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          4,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_cab_folder_get_uncompressed_size(
+	          NULL,
+	          assorted_test_cab_folder_mszip_data_size,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the last data block exceeds the folder data
+	 */
+	result = assorted_cab_folder_get_uncompressed_size(
+	          assorted_test_cab_folder_mszip_data,
+	          assorted_test_cab_folder_mszip_data_size - 1,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_cab_folder_decompress_mszip_block function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_folder_decompress_mszip_block(
+     void )
+{
+	uint8_t compressed_data[ 8 ] = {
+		'C', 'X', 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	assorted_deflate_stream_t *stream = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t compressed_data_size       = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_deflate_stream_initialize(
+	          &stream,
+	          ASSORTED_DEFLATE_STREAM_FORMAT_DEFLATE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 &( assorted_test_cab_folder_mszip_data[ 4 ] ),
+	 compressed_data_size );
+
+	result = assorted_cab_folder_decompress_mszip_block(
+	          stream,
+	          &( assorted_test_cab_folder_mszip_data[ 8 ] ),
+	          compressed_data_size,
+	          assorted_test_cab_folder_uncompressed_data,
+	          32768,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_cab_folder_uncompressed_data,
+	          assorted_test_cab_folder_data,
+	          32768 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_cab_folder_decompress_mszip_block(
+	          NULL,
+	          &( assorted_test_cab_folder_mszip_data[ 8 ] ),
+	          compressed_data_size,
+	          assorted_test_cab_folder_uncompressed_data,
+	          32768,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data block signature is invalid
+	 */
+	result = assorted_cab_folder_decompress_mszip_block(
+	          stream,
+	          compressed_data,
+	          8,
+	          assorted_test_cab_folder_uncompressed_data,
+	          32768,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the uncompressed data block size exceeds the maximum
+	 */
+	result = assorted_cab_folder_decompress_mszip_block(
+	          stream,
+	          &( assorted_test_cab_folder_mszip_data[ 8 ] ),
+	          compressed_data_size,
+	          assorted_test_cab_folder_uncompressed_data,
+	          32769,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_deflate_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_cab_folder_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_folder_decompress(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 assorted_test_cab_folder_uncompressed_data,
+	 0,
+	 ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE );
+
+	result = assorted_cab_folder_decompress(
+	          assorted_test_cab_folder_mszip_data,
+	          assorted_test_cab_folder_mszip_data_size,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          0,
+	          ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_MSZIP,
+	          assorted_test_cab_folder_uncompressed_data,
+	          ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_cab_folder_uncompressed_data,
+	          assorted_test_cab_folder_data,
+	          ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_set(
+	 assorted_test_cab_folder_uncompressed_data,
+	 0,
+	 ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE );
+
+	result = assorted_cab_folder_decompress(
+	          assorted_test_cab_folder_stored_data,
+	          assorted_test_cab_folder_stored_data_size,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          4,
+	          ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_NONE,
+	          assorted_test_cab_folder_uncompressed_data,
+	          ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_cab_folder_uncompressed_data,
+	          assorted_test_cab_folder_data,
+	          ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_cab_folder_decompress(
+	          assorted_test_cab_folder_mszip_data,
+	          assorted_test_cab_folder_mszip_data_size,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          0,
+	          ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_MSZIP,
+	          NULL,
+	          ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the uncompressed data size does not match
+	 */
+	result = assorted_cab_folder_decompress(
+	          assorted_test_cab_folder_mszip_data,
+	          assorted_test_cab_folder_mszip_data_size,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          0,
+	          ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_MSZIP,
+	          assorted_test_cab_folder_uncompressed_data,
+	          ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the compression type is not supported
+	 */
+	result = assorted_cab_folder_decompress(
+	          assorted_test_cab_folder_mszip_data,
+	          assorted_test_cab_folder_mszip_data_size,
+	          ASSORTED_TEST_CAB_FOLDER_NUMBER_OF_BLOCKS,
+	          0,
+	          ASSORTED_CAB_FOLDER_COMPRESSION_TYPE_LZX,
+	          assorted_test_cab_folder_uncompressed_data,
+	          ASSORTED_TEST_CAB_FOLDER_UNCOMPRESSED_DATA_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_CAB_FOLDER_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	if( assorted_test_cab_folder_initialize_data() != 1 )
+	{
+		goto on_error;
+	}
+	ASSORTED_TEST_RUN(
+	 "assorted_cab_folder_get_uncompressed_size",
+	 assorted_test_cab_folder_get_uncompressed_size );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_cab_folder_decompress_mszip_block",
+	 assorted_test_cab_folder_decompress_mszip_block );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_cab_folder_decompress",
+	 assorted_test_cab_folder_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
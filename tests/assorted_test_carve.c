@@ -0,0 +1,980 @@
+/*
+ * Compressed stream carving testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_carve.h"
+
+/* Define to make assorted_test_carve generate verbose output
+#define ASSORTED_TEST_CARVE_VERBOSE
+ */
+
+/* The zlib, gzip, bzip2 and xz compressed forms of the uncompressed data separated by padding
+ */
+uint8_t assorted_test_carve_data[ 209 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xda, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28, 0xcf, 0x2f,
+	0xca, 0x49, 0x51, 0xc8, 0x40, 0xb0, 0x01, 0x69, 0xe7, 0x08, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57,
+	0x28, 0xcf, 0x2f, 0xca, 0x49, 0x51, 0xc8, 0x40, 0xb0, 0x01, 0x3b, 0xce, 0xe2, 0xea, 0x17, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x5a, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53,
+	0x59, 0x76, 0x66, 0x8c, 0x42, 0x00, 0x00, 0x03, 0x91, 0x80, 0x40, 0x00, 0x06, 0x44, 0x90, 0x80,
+	0x20, 0x00, 0x20, 0xaa, 0x86, 0x9e, 0x81, 0x0c, 0x08, 0xec, 0x44, 0x57, 0xed, 0x68, 0x63, 0x11,
+	0xa2, 0xee, 0x48, 0xa7, 0x0a, 0x12, 0x0e, 0xcc, 0xd1, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x01, 0x69, 0x22, 0xde, 0x36, 0x02, 0x00, 0x21, 0x01,
+	0x16, 0x00, 0x00, 0x00, 0x74, 0x2f, 0xe5, 0xa3, 0xe0, 0x00, 0x16, 0x00, 0x12, 0x5d, 0x00, 0x34,
+	0x19, 0x49, 0xee, 0x8d, 0xe9, 0x17, 0x89, 0x3a, 0x33, 0x5f, 0xfd, 0x81, 0x44, 0x08, 0x81, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x3b, 0xce, 0xe2, 0xea, 0x00, 0x01, 0x2a, 0x17, 0xc4, 0xfc, 0x3e, 0xcc,
+	0x90, 0x42, 0x99, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x5a, 0x00, 0x00, 0x00, 0x00,
+	0x00 };
+
+size_t assorted_test_carve_offsets[ 4 ] = {
+	5, 32, 71, 128 };
+
+uint8_t assorted_test_carve_formats[ 4 ] = {
+	ASSORTED_CARVE_FORMAT_ZLIB, ASSORTED_CARVE_FORMAT_GZIP, ASSORTED_CARVE_FORMAT_BZIP2, ASSORTED_CARVE_FORMAT_XZ };
+
+size_t assorted_test_carve_compressed_data_sizes[ 4 ] = {
+	22, 34, 0, 0 };
+
+uint8_t assorted_test_carve_uncompressed_data[ 23 ] = {
+	'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', ' ', 'h', 'e', 'l', 'l',
+	'o', ' ', 'w', 'o', 'r', 'l', 'd' };
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_carve_formats_from_string function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_carve_formats_from_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t formats          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_carve_formats_from_string(
+	          "all",
+	          3,
+	          &formats,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "formats",
+	 formats,
+	 (uint8_t) ASSORTED_CARVE_FORMAT_ALL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_carve_formats_from_string(
+	          "zlib,xz",
+	          7,
+	          &formats,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "formats",
+	 formats,
+	 (uint8_t) ( ASSORTED_CARVE_FORMAT_ZLIB | ASSORTED_CARVE_FORMAT_XZ ) );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_carve_formats_from_string(
+	          "gzip,lzx",
+	          8,
+	          &formats,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_carve_formats_from_string(
+	          NULL,
+	          3,
+	          &formats,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_carve_formats_from_string(
+	          "all",
+	          3,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_carve_validate_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_carve_validate_header(
+     void )
+{
+	int offset_index = 0;
+	uint8_t format   = 0;
+	int result       = 0;
+
+	/* Test regular cases
+	 */
+	for( offset_index = 0;
+	     offset_index < 4;
+	     offset_index++ )
+	{
+		result = assorted_carve_validate_header(
+		          assorted_test_carve_data,
+		          209,
+		          assorted_test_carve_offsets[ offset_index ],
+		          ASSORTED_CARVE_FORMAT_ALL,
+		          &format );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "format",
+		 format,
+		 assorted_test_carve_formats[ offset_index ] );
+	}
+	/* Test a format that was not requested
+	 */
+	result = assorted_carve_validate_header(
+	          assorted_test_carve_data,
+	          209,
+	          5,
+	          ASSORTED_CARVE_FORMAT_GZIP,
+	          &format );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test padding
+	 */
+	result = assorted_carve_validate_header(
+	          assorted_test_carve_data,
+	          209,
+	          0,
+	          ASSORTED_CARVE_FORMAT_ALL,
+	          &format );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_carve_validate_header(
+	          NULL,
+	          209,
+	          5,
+	          ASSORTED_CARVE_FORMAT_ALL,
+	          &format );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_carve_validate_header(
+	          assorted_test_carve_data,
+	          209,
+	          209,
+	          ASSORTED_CARVE_FORMAT_ALL,
+	          &format );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_carve_find_signature_basic function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_carve_find_signature_basic(
+     void )
+{
+	size_t data_offset = 0;
+
+	/* Test regular cases
+	 */
+	data_offset = assorted_carve_find_signature_basic(
+	               assorted_test_carve_data,
+	               209,
+	               ASSORTED_CARVE_FORMAT_ALL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 5 );
+
+	data_offset = assorted_carve_find_signature_basic(
+	               assorted_test_carve_data,
+	               5,
+	               ASSORTED_CARVE_FORMAT_ALL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 5 );
+
+	data_offset = assorted_carve_find_signature_basic(
+	               &( assorted_test_carve_data[ 124 ] ),
+	               85,
+	               ASSORTED_CARVE_FORMAT_XZ );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 4 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_carve_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_carve_scan(
+     void )
+{
+	assorted_carve_candidate_t candidates[ 16 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t candidate_index      = 0;
+	size_t number_of_candidates = 0;
+	size_t scan_offset          = 0;
+	int offset_index            = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_carve_scan(
+	          assorted_test_carve_data,
+	          209,
+	          ASSORTED_CARVE_FORMAT_ALL,
+	          &scan_offset,
+	          candidates,
+	          16,
+	          &number_of_candidates,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "scan_offset",
+	 scan_offset,
+	 (size_t) 209 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every stream must be found, the compressed data can contain false matches
+	 */
+	for( offset_index = 0;
+	     offset_index < 4;
+	     offset_index++ )
+	{
+		for( candidate_index = 0;
+		     candidate_index < number_of_candidates;
+		     candidate_index++ )
+		{
+			if( candidates[ candidate_index ].offset == assorted_test_carve_offsets[ offset_index ] )
+			{
+				break;
+			}
+		}
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+		 "candidate_index",
+		 (int) candidate_index,
+		 (int) number_of_candidates );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "format",
+		 candidates[ candidate_index ].format,
+		 assorted_test_carve_formats[ offset_index ] );
+	}
+	/* Test continuing a scan that filled the candidates
+	 */
+	scan_offset = 0;
+
+	result = assorted_carve_scan(
+	          assorted_test_carve_data,
+	          209,
+	          ASSORTED_CARVE_FORMAT_ALL,
+	          &scan_offset,
+	          candidates,
+	          1,
+	          &number_of_candidates,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_candidates",
+	 number_of_candidates,
+	 (size_t) 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "candidates[ 0 ].offset",
+	 candidates[ 0 ].offset,
+	 (size_t) 5 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "scan_offset",
+	 scan_offset,
+	 (size_t) 6 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	scan_offset = 130;
+
+	result = assorted_carve_scan(
+	          assorted_test_carve_data,
+	          209,
+	          ASSORTED_CARVE_FORMAT_XZ,
+	          &scan_offset,
+	          candidates,
+	          16,
+	          &number_of_candidates,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_candidates",
+	 number_of_candidates,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	scan_offset = 0;
+
+	result = assorted_carve_scan(
+	          NULL,
+	          209,
+	          ASSORTED_CARVE_FORMAT_ALL,
+	          &scan_offset,
+	          candidates,
+	          16,
+	          &number_of_candidates,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_carve_scan(
+	          assorted_test_carve_data,
+	          209,
+	          ASSORTED_CARVE_FORMAT_ALL,
+	          NULL,
+	          candidates,
+	          16,
+	          &number_of_candidates,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_carve_scan(
+	          assorted_test_carve_data,
+	          209,
+	          ASSORTED_CARVE_FORMAT_ALL,
+	          &scan_offset,
+	          candidates,
+	          0,
+	          &number_of_candidates,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_carve_candidate_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_carve_candidate_decode(
+     void )
+{
+	assorted_carve_candidate_t candidate;
+
+	libcerror_error_t *error = NULL;
+	int offset_index         = 0;
+	int result               = 0;
+
+	memory_set(
+	 &candidate,
+	 0,
+	 sizeof( assorted_carve_candidate_t ) );
+
+	/* Test regular cases
+	 */
+	for( offset_index = 0;
+	     offset_index < 4;
+	     offset_index++ )
+	{
+		candidate.offset = assorted_test_carve_offsets[ offset_index ];
+		candidate.format = assorted_test_carve_formats[ offset_index ];
+
+		result = assorted_carve_candidate_decode(
+		          &candidate,
+		          assorted_test_carve_data,
+		          209,
+		          1024,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "candidate.compressed_data_size",
+		 candidate.compressed_data_size,
+		 assorted_test_carve_compressed_data_sizes[ offset_index ] );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "candidate.uncompressed_data_size",
+		 candidate.uncompressed_data_size,
+		 (size_t) 23 );
+
+		result = memory_compare(
+		          candidate.uncompressed_data,
+		          assorted_test_carve_uncompressed_data,
+		          23 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = assorted_carve_candidate_clear(
+		          &candidate,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "candidate.uncompressed_data",
+		 candidate.uncompressed_data );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	candidate.offset = 5;
+	candidate.format = ASSORTED_CARVE_FORMAT_ZLIB;
+
+	result = assorted_carve_candidate_decode(
+	          NULL,
+	          assorted_test_carve_data,
+	          209,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_carve_candidate_decode(
+	          &candidate,
+	          NULL,
+	          209,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a maximum uncompressed data size that is too small
+	 */
+	result = assorted_carve_candidate_decode(
+	          &candidate,
+	          assorted_test_carve_data,
+	          209,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "candidate.uncompressed_data",
+	 candidate.uncompressed_data );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a truncated stream
+	 */
+	result = assorted_carve_candidate_decode(
+	          &candidate,
+	          assorted_test_carve_data,
+	          20,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_carve_candidate_clear(
+	 &candidate,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the assorted_carve_decode_candidates function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_carve_decode_candidates(
+     void )
+{
+	assorted_carve_candidate_t candidates[ 5 ];
+
+	libcerror_error_t *error = NULL;
+	int candidate_index      = 0;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	memory_set(
+	 candidates,
+	 0,
+	 sizeof( assorted_carve_candidate_t ) * 5 );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads += 3 )
+	{
+		for( candidate_index = 0;
+		     candidate_index < 4;
+		     candidate_index++ )
+		{
+			candidates[ candidate_index ].offset = assorted_test_carve_offsets[ candidate_index ];
+			candidates[ candidate_index ].format = assorted_test_carve_formats[ candidate_index ];
+		}
+		result = assorted_carve_decode_candidates(
+		          candidates,
+		          4,
+		          assorted_test_carve_data,
+		          209,
+		          1024,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( candidate_index = 0;
+		     candidate_index < 4;
+		     candidate_index++ )
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "candidates[ candidate_index ].result",
+			 candidates[ candidate_index ].result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "candidates[ candidate_index ].uncompressed_data_size",
+			 candidates[ candidate_index ].uncompressed_data_size,
+			 (size_t) 23 );
+
+			result = memory_compare(
+			          candidates[ candidate_index ].uncompressed_data,
+			          assorted_test_carve_uncompressed_data,
+			          23 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			result = assorted_carve_candidate_clear(
+			          &( candidates[ candidate_index ] ),
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	/* Test a candidate that fails to decode
+	 */
+	for( candidate_index = 0;
+	     candidate_index < 4;
+	     candidate_index++ )
+	{
+		candidates[ candidate_index ].offset = assorted_test_carve_offsets[ candidate_index ];
+		candidates[ candidate_index ].format = assorted_test_carve_formats[ candidate_index ];
+	}
+	candidates[ 4 ].offset = 0;
+	candidates[ 4 ].format = ASSORTED_CARVE_FORMAT_ZLIB;
+
+	result = assorted_carve_decode_candidates(
+	          candidates,
+	          5,
+	          assorted_test_carve_data,
+	          209,
+	          1024,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "candidates[ 3 ].result",
+	 candidates[ 3 ].result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "candidates[ 4 ].result",
+	 candidates[ 4 ].result,
+	 -1 );
+
+	for( candidate_index = 0;
+	     candidate_index < 5;
+	     candidate_index++ )
+	{
+		assorted_carve_candidate_clear(
+		 &( candidates[ candidate_index ] ),
+		 NULL );
+	}
+	/* Test error cases
+	 */
+	result = assorted_carve_decode_candidates(
+	          NULL,
+	          4,
+	          assorted_test_carve_data,
+	          209,
+	          1024,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_carve_decode_candidates(
+	          candidates,
+	          4,
+	          assorted_test_carve_data,
+	          209,
+	          1024,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( candidate_index = 0;
+	     candidate_index < 5;
+	     candidate_index++ )
+	{
+		assorted_carve_candidate_clear(
+		 &( candidates[ candidate_index ] ),
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_CARVE_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_carve_formats_from_string",
+	 assorted_test_carve_formats_from_string );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_carve_validate_header",
+	 assorted_test_carve_validate_header );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_carve_find_signature_basic",
+	 assorted_test_carve_find_signature_basic );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_carve_scan",
+	 assorted_test_carve_scan );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_carve_candidate_decode",
+	 assorted_test_carve_candidate_decode );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_carve_decode_candidates",
+	 assorted_test_carve_decode_candidates );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
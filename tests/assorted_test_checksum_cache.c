@@ -0,0 +1,688 @@
+/*
+ * Checksum cache testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_memory.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_checksum_cache.h"
+
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_checksum_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_cache_initialize(
+     void )
+{
+	assorted_checksum_cache_t *checksum_cache = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_checksum_cache_initialize(
+	          &checksum_cache,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "checksum_cache",
+	 checksum_cache );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "checksum_cache->file_descriptor",
+	 checksum_cache->file_descriptor,
+	 -1 );
+
+	result = assorted_checksum_cache_free(
+	          &checksum_cache,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "checksum_cache",
+	 checksum_cache );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_checksum_cache_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	checksum_cache = (assorted_checksum_cache_t *) 0x12345678UL;
+
+	result = assorted_checksum_cache_initialize(
+	          &checksum_cache,
+	          &error );
+
+	checksum_cache = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checksum_cache != NULL )
+	{
+		assorted_checksum_cache_free(
+		 &checksum_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_checksum_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_checksum_cache_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_checksum_cache_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_cache_hash(
+     void )
+{
+	uint64_t hash = 0;
+
+	/* Test regular cases
+	 */
+	hash = assorted_checksum_cache_hash(
+	        NULL,
+	        0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xcbf29ce484222325ULL );
+
+	hash = assorted_checksum_cache_hash(
+	        (uint8_t *) "a",
+	        1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xaf63dc4c8601ec8cULL );
+
+	hash = assorted_checksum_cache_hash(
+	        (uint8_t *) "foobar",
+	        6 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0x85944171f73967e8ULL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_checksum_cache_key_write function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_cache_key_write(
+     void )
+{
+	uint8_t entry_data[ ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE ];
+
+	assorted_checksum_cache_key_t key;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 entry_data,
+	 0xff,
+	 ASSORTED_CHECKSUM_CACHE_ENTRY_SIZE );
+
+	memory_set(
+	 &key,
+	 0,
+	 sizeof( assorted_checksum_cache_key_t ) );
+
+	key.device_identifier = 0x0102030405060708ULL;
+	key.file_size         = 0x1000;
+	key.method            = ASSORTED_CHECKSUM_CACHE_METHOD_CRC32;
+	key.flags             = 1;
+
+	assorted_checksum_cache_key_write(
+	 &key,
+	 entry_data );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_data[ 0 ]",
+	 entry_data[ 0 ],
+	 (uint8_t) 0x08 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_data[ 7 ]",
+	 entry_data[ 7 ],
+	 (uint8_t) 0x01 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_data[ 17 ]",
+	 entry_data[ 17 ],
+	 (uint8_t) 0x10 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_data[ 64 ]",
+	 entry_data[ 64 ],
+	 (uint8_t) ASSORTED_CHECKSUM_CACHE_METHOD_CRC32 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_data[ 68 ]",
+	 entry_data[ 68 ],
+	 (uint8_t) 1 );
+
+	/* The key is only written to the first 72 bytes of the entry data
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_data[ 72 ]",
+	 entry_data[ 72 ],
+	 (uint8_t) 0xff );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+
+/* Tests the assorted_checksum_cache_get_checksum and assorted_checksum_cache_set_checksum functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_checksum_cache_get_and_set_checksum(
+     void )
+{
+	char cache_filename[ 64 ];
+	char data_filename[ 64 ];
+
+	struct utimbuf file_times;
+
+	assorted_checksum_cache_key_t key;
+
+	assorted_checksum_cache_t *checksum_cache = NULL;
+	libcerror_error_t *error                  = NULL;
+	uint64_t checksum                         = 0;
+	int file_descriptor                       = -1;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 cache_filename,
+	 0,
+	 64 );
+
+	memory_copy(
+	 data_filename,
+	 "/tmp/assorted_test_checksum_cache.XXXXXX",
+	 41 );
+
+	file_descriptor = mkstemp(
+	                   data_filename );
+
+	ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_descriptor",
+	 file_descriptor,
+	 -1 );
+
+	result = (int) write(
+	                file_descriptor,
+	                "checksum cache test data",
+	                24 );
+
+	close(
+	 file_descriptor );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 24 );
+
+	/* Make the file old enough for its checksum to be stored
+	 */
+	file_times.actime  = 1577836800;
+	file_times.modtime = 1577836800;
+
+	result = utime(
+	          data_filename,
+	          &file_times );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_copy(
+	 cache_filename,
+	 data_filename,
+	 41 );
+
+	memory_copy(
+	 &( cache_filename[ 40 ] ),
+	 ".cache",
+	 7 );
+
+	result = assorted_checksum_cache_initialize(
+	          &checksum_cache,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "checksum_cache",
+	 checksum_cache );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cache file is created if it does not exist
+	 */
+	result = assorted_checksum_cache_open(
+	          checksum_cache,
+	          cache_filename,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_cache->number_of_entries",
+	 checksum_cache->number_of_entries,
+	 (uint32_t) ASSORTED_CHECKSUM_CACHE_DEFAULT_NUMBER_OF_ENTRIES );
+
+	memory_set(
+	 &key,
+	 0,
+	 sizeof( assorted_checksum_cache_key_t ) );
+
+	key.size          = 24;
+	key.initial_value = 1;
+	key.method        = ASSORTED_CHECKSUM_CACHE_METHOD_ADLER32;
+
+	/* Test regular cases
+	 */
+	result = assorted_checksum_cache_get_checksum(
+	          checksum_cache,
+	          data_filename,
+	          &key,
+	          &checksum,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "key.file_size",
+	 key.file_size,
+	 (uint64_t) 24 );
+
+	result = assorted_checksum_cache_set_checksum(
+	          checksum_cache,
+	          data_filename,
+	          &key,
+	          0x722f0902UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_checksum_cache_get_checksum(
+	          checksum_cache,
+	          data_filename,
+	          &key,
+	          &checksum,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum",
+	 checksum,
+	 (uint64_t) 0x722f0902UL );
+
+	/* A different method does not match the cached checksum
+	 */
+	key.method = ASSORTED_CHECKSUM_CACHE_METHOD_CRC32;
+
+	result = assorted_checksum_cache_get_checksum(
+	          checksum_cache,
+	          data_filename,
+	          &key,
+	          &checksum,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A modified file does not match the cached checksum
+	 */
+	key.method = ASSORTED_CHECKSUM_CACHE_METHOD_ADLER32;
+
+	file_times.modtime = 1577836801;
+
+	result = utime(
+	          data_filename,
+	          &file_times );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_checksum_cache_get_checksum(
+	          checksum_cache,
+	          data_filename,
+	          &key,
+	          &checksum,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_checksum_cache_get_checksum(
+	          NULL,
+	          data_filename,
+	          &key,
+	          &checksum,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_checksum_cache_set_checksum(
+	          checksum_cache,
+	          data_filename,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_checksum_cache_free(
+	          &checksum_cache,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	unlink(
+	 cache_filename );
+
+	unlink(
+	 data_filename );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checksum_cache != NULL )
+	{
+		assorted_checksum_cache_free(
+		 &checksum_cache,
+		 NULL );
+	}
+	if( cache_filename[ 0 ] != 0 )
+	{
+		unlink(
+		 cache_filename );
+	}
+	if( file_descriptor != -1 )
+	{
+		unlink(
+		 data_filename );
+	}
+	return( 0 );
+}
+
+#endif /* defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE ) */
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_checksum_cache_initialize",
+	 assorted_test_checksum_cache_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_checksum_cache_free",
+	 assorted_test_checksum_cache_free );
+
+	/* TODO add tests for assorted_checksum_cache_create_file */
+
+	/* TODO add tests for assorted_checksum_cache_open */
+
+	/* TODO add tests for assorted_checksum_cache_close */
+
+	/* TODO add tests for assorted_checksum_cache_key_set_file_identity */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_checksum_cache_key_write",
+	 assorted_test_checksum_cache_key_write );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_checksum_cache_hash",
+	 assorted_test_checksum_cache_hash );
+
+#if defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_checksum_cache_get_and_set_checksum",
+	 assorted_test_checksum_cache_get_and_set_checksum );
+
+#endif /* defined( ASSORTED_CHECKSUM_CACHE_HAVE_CACHE ) */
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
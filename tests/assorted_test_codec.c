@@ -0,0 +1,925 @@
+/*
+ * Codec registry testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_codec.h"
+
+/* Define to make assorted_test_codec generate verbose output
+#define ASSORTED_TEST_CODEC_VERBOSE
+ */
+
+uint8_t assorted_test_codec_zlib_compressed_data[ 22 ] = {
+	0x78, 0x9c, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0x28, 0xcf, 0x2f, 0xca, 0x49, 0x51, 0xc8, 0x40,
+	0xb0, 0x01, 0x69, 0xe7, 0x08, 0xd9 };
+
+uint8_t assorted_test_codec_uncompressed_data[ 23 ] = {
+	'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', ' ', 'h', 'e', 'l', 'l',
+	'o', ' ', 'w', 'o', 'r', 'l', 'd' };
+
+uint8_t assorted_test_codec_bzip2_signature[ 4 ] = {
+	'B', 'Z', 'h', '9' };
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_codec_get_number_of_codecs function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_codec_get_number_of_codecs(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_codecs     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_codec_get_number_of_codecs(
+	          &number_of_codecs,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "number_of_codecs",
+	 number_of_codecs,
+	 16 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_codec_get_number_of_codecs(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_codec_get_codec_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_codec_get_codec_by_index(
+     void )
+{
+	const assorted_codec_t *codec = NULL;
+	libcerror_error_t *error      = NULL;
+	int codec_index               = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	for( codec_index = 0;
+	     codec_index < 16;
+	     codec_index++ )
+	{
+		codec = NULL;
+
+		result = assorted_codec_get_codec_by_index(
+		          codec_index,
+		          &codec,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "codec",
+		 codec );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "codec->name",
+		 codec->name );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "codec->decompress",
+		 codec->decompress );
+	}
+	/* Test error cases
+	 */
+	result = assorted_codec_get_codec_by_index(
+	          -1,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_codec_get_codec_by_index(
+	          16,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_codec_get_codec_by_index(
+	          0,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_codec_get_codec_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_codec_get_codec_by_name(
+     void )
+{
+	const assorted_codec_t *codec = NULL;
+	libcerror_error_t *error      = NULL;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_codec_get_codec_by_name(
+	          "zlib",
+	          4,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "codec",
+	 codec );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "codec->stream_feed",
+	 codec->stream_feed );
+
+	result = assorted_codec_get_codec_by_name(
+	          "lzxpress_huffman",
+	          16,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "codec->flags",
+	 codec->flags,
+	 (uint8_t) ASSORTED_CODEC_FLAG_EXTERNAL );
+
+	/* Test a name that is a prefix of a codec name
+	 */
+	result = assorted_codec_get_codec_by_name(
+	          "lzxpress_huffman",
+	          10,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_codec_get_codec_by_name(
+	          "bogus",
+	          5,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_codec_get_codec_by_name(
+	          NULL,
+	          4,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_codec_get_codec_by_name(
+	          "zlib",
+	          4,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_codec_probe function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_codec_probe(
+     void )
+{
+	const assorted_codec_t *codec = NULL;
+	libcerror_error_t *error      = NULL;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_codec_probe(
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "codec",
+	 codec );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "codec->name",
+	 memory_compare(
+	  codec->name,
+	  "zlib",
+	  5 ),
+	 0 );
+
+	result = assorted_codec_probe(
+	          assorted_test_codec_bzip2_signature,
+	          4,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "codec->name",
+	 memory_compare(
+	  codec->name,
+	  "bzip2",
+	  6 ),
+	 0 );
+
+	result = assorted_codec_probe(
+	          assorted_test_codec_uncompressed_data,
+	          23,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_codec_probe(
+	          NULL,
+	          22,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_codec_probe(
+	          assorted_test_codec_zlib_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_codec_probe(
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_codec_get_output_size_hint function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_codec_get_output_size_hint(
+     void )
+{
+	const assorted_codec_t *codec = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	result = assorted_codec_get_codec_by_name(
+	          "zlib",
+	          4,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_codec_get_output_size_hint(
+	          codec,
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_CODEC_MINIMUM_OUTPUT_SIZE_HINT );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_codec_get_output_size_hint(
+	          NULL,
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_codec_get_output_size_hint(
+	          codec,
+	          NULL,
+	          22,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_codec_get_output_size_hint(
+	          codec,
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_codec_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_codec_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	const assorted_codec_t *codec = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	result = assorted_codec_probe(
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 64;
+
+	result = assorted_codec_decompress(
+	          codec,
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 23 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_codec_uncompressed_data,
+	          23 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 64;
+
+	result = assorted_codec_decompress(
+	          NULL,
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_codec_decompress(
+	          codec,
+	          assorted_test_codec_uncompressed_data,
+	          23,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the stream functions of a codec
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_codec_stream(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	const assorted_codec_t *codec = NULL;
+	libcerror_error_t *error      = NULL;
+	intptr_t *stream              = NULL;
+	size_t compressed_data_offset = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	result = assorted_codec_get_codec_by_name(
+	          "zlib",
+	          4,
+	          &codec,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = codec->stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = 64;
+
+	result = codec->stream_feed(
+	          stream,
+	          assorted_test_codec_zlib_compressed_data,
+	          22,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 23 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_codec_uncompressed_data,
+	          23 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = codec->stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		codec->stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_CODEC_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_codec_get_number_of_codecs",
+	 assorted_test_codec_get_number_of_codecs );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_codec_get_codec_by_index",
+	 assorted_test_codec_get_codec_by_index );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_codec_get_codec_by_name",
+	 assorted_test_codec_get_codec_by_name );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_codec_probe",
+	 assorted_test_codec_probe );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_codec_get_output_size_hint",
+	 assorted_test_codec_get_output_size_hint );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_codec_decompress",
+	 assorted_test_codec_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_codec_stream",
+	 assorted_test_codec_stream );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
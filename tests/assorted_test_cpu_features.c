@@ -0,0 +1,209 @@
+/*
+ * CPU feature functions testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_adler32.h"
+#include "../src/assorted_cpu_features.h"
+#include "../src/assorted_crc32.h"
+
+/* Define to make assorted_test_cpu_features generate verbose output
+#define ASSORTED_TEST_CPU_FEATURES_VERBOSE
+ */
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_cpu_features_get function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cpu_features_get(
+     void )
+{
+	uint32_t cpu_features = 0;
+
+	cpu_features = assorted_cpu_features_get();
+
+	/* Test if only known CPU features are set
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "cpu_features",
+	 (uint32_t) ( cpu_features & ~( (uint32_t) 0x000003ffUL ) ),
+	 (uint32_t) 0 );
+
+	/* Test if the CPU features are consistent
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "cpu_features",
+	 assorted_cpu_features_get(),
+	 cpu_features );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_cpu_features_set_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cpu_features_set_mask(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	uint32_t cpu_features    = 0;
+	int result               = 0;
+
+	cpu_features = assorted_cpu_features_get();
+
+	/* Test if the portable kernels are used when all CPU features are masked
+	 */
+	assorted_cpu_features_set_mask(
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "cpu_features",
+	 assorted_cpu_features_get(),
+	 (uint32_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "fold_method",
+	 assorted_crc32_get_fold_method(),
+	 ASSORTED_CRC32_FOLD_METHOD_NONE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "simd_method",
+	 assorted_adler32_get_simd_method(),
+	 ASSORTED_ADLER32_SIMD_METHOD_NONE );
+
+	result = assorted_crc32_calculate_folded(
+	          &checksum_value,
+	          (uint8_t *) "123456789",
+	          9,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xcbf43926UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a subset of the CPU features can be enabled
+	 */
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_SSE2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "cpu_features",
+	 assorted_cpu_features_get(),
+	 (uint32_t) ( cpu_features & ASSORTED_CPU_FEATURE_SSE2 ) );
+
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_ALL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "cpu_features",
+	 assorted_cpu_features_get(),
+	 cpu_features );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_ALL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_CPU_FEATURES_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_cpu_features_get",
+	 assorted_test_cpu_features_get );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_cpu_features_set_mask",
+	 assorted_test_cpu_features_set_mask );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -160,24 +160,1348 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_crc32_initialize_slicing_table function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_initialize_slicing_table(
+     void )
+{
+	/* Test invocation of function only
+	 */
+	assorted_crc32_initialize_slicing_table(
+	 0xedb88320UL );
+
+	return( 1 );
+}
+
 /* Tests the assorted_crc32_calculate function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_crc32_calculate(
+int assorted_test_crc32_calculate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc32_calculate(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_calculate(
+	          NULL,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_calculate_slicing_by_8 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_slicing_by_8(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc32_calculate_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that is not a multiple of the number of bytes per iteration
+	 */
+	result = assorted_crc32_calculate(
+	          &expected_checksum_value,
+	          assorted_test_crc32_data,
+	          13,
+	          0x12345678UL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_crc32_calculate_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          13,
+	          0x12345678UL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 expected_checksum_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_calculate_slicing_by_8(
+	          NULL,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_slicing_by_8(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_calculate_slicing_by_16 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_slicing_by_16(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc32_calculate_slicing_by_16(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that is not a multiple of the number of bytes per iteration
+	 */
+	result = assorted_crc32_calculate(
+	          &expected_checksum_value,
+	          assorted_test_crc32_data,
+	          13,
+	          0x12345678UL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_crc32_calculate_slicing_by_16(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          13,
+	          0x12345678UL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 expected_checksum_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_calculate_slicing_by_16(
+	          NULL,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_slicing_by_16(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_slicing_by_16(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_get_fold_method function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_get_fold_method(
+     void )
+{
+	int fold_method = 0;
+
+	fold_method = assorted_crc32_get_fold_method();
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "fold_method",
+	 fold_method,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_INT(
+	 "fold_method",
+	 fold_method,
+	 ASSORTED_CRC32_FOLD_METHOD_PMULL + 1 );
+
+	/* Test if the fold method is consistent
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "fold_method",
+	 assorted_crc32_get_fold_method(),
+	 fold_method );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_calculate_folded function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_folded(
+     void )
+{
+	uint8_t data[ 1031 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 0;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1031;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = assorted_crc32_calculate_folded(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test sizes and offsets that are handled by the different folding widths
+	 * and are not a multiple of the folding width
+	 */
+	for( data_size = 63;
+	     data_size <= 1030;
+	     data_size += 161 )
+	{
+		for( data_offset = 0;
+		     data_offset <= 1;
+		     data_offset++ )
+		{
+			result = assorted_crc32_calculate(
+			          &expected_checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size,
+			          0x12345678UL,
+			          (uint8_t) data_offset,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_crc32_calculate_folded(
+			          &checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size,
+			          0x12345678UL,
+			          (uint8_t) data_offset,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum_value",
+			 checksum_value,
+			 expected_checksum_value );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = assorted_crc32_calculate_folded(
+	          NULL,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_folded(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_folded(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_copy_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_copy_calculate(
+     void )
+{
+	uint8_t copied_data[ 1031 ];
+	uint8_t data[ 1031 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 0;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1031;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = assorted_crc32_copy_calculate(
+	          &checksum_value,
+	          copied_data,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          copied_data,
+	          assorted_test_crc32_data,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test sizes and offsets that are handled by the folding and
+	 * are not a multiple of the folding width
+	 */
+	for( data_size = 63;
+	     data_size <= 1030;
+	     data_size += 161 )
+	{
+		for( data_offset = 0;
+		     data_offset <= 1;
+		     data_offset++ )
+		{
+			result = assorted_crc32_calculate(
+			          &expected_checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size,
+			          0x12345678UL,
+			          (uint8_t) data_offset,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_crc32_copy_calculate(
+			          &checksum_value,
+			          &( copied_data[ 1 - data_offset ] ),
+			          &( data[ data_offset ] ),
+			          data_size,
+			          0x12345678UL,
+			          (uint8_t) data_offset,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum_value",
+			 checksum_value,
+			 expected_checksum_value );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          &( copied_data[ 1 - data_offset ] ),
+			          &( data[ data_offset ] ),
+			          data_size );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = assorted_crc32_copy_calculate(
+	          NULL,
+	          copied_data,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_copy_calculate(
+	          &checksum_value,
+	          NULL,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_copy_calculate(
+	          &checksum_value,
+	          copied_data,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_copy_calculate(
+	          &checksum_value,
+	          copied_data,
+	          assorted_test_crc32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_combine function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_combine(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	uint32_t first_checksum_value    = 0;
+	uint32_t second_checksum_value   = 0;
+	uint8_t weak_crc                 = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	for( weak_crc = 0;
+	     weak_crc <= 1;
+	     weak_crc++ )
+	{
+		result = assorted_crc32_calculate(
+		          &expected_checksum_value,
+		          assorted_test_crc32_data,
+		          16,
+		          0x12345678UL,
+		          weak_crc,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_crc32_calculate(
+		          &first_checksum_value,
+		          assorted_test_crc32_data,
+		          5,
+		          0x12345678UL,
+		          weak_crc,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_crc32_calculate(
+		          &second_checksum_value,
+		          &( assorted_test_crc32_data[ 5 ] ),
+		          11,
+		          0,
+		          weak_crc,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_crc32_combine(
+		          &checksum_value,
+		          first_checksum_value,
+		          second_checksum_value,
+		          11,
+		          0xedb88320UL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum_value",
+		 checksum_value,
+		 expected_checksum_value );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test combining with an empty second buffer
+	 */
+	result = assorted_crc32_combine(
+	          &checksum_value,
+	          0xf862619aUL,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xf862619aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_combine(
+	          NULL,
+	          0,
+	          0,
+	          16,
+	          0xedb88320UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_combine(
+	          &checksum_value,
+	          0,
+	          0,
+	          16,
+	          0x04c11db7UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_get_polynomial_table function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_get_polynomial_table(
+     void )
+{
+	const assorted_crc32_polynomial_table_t *polynomial_table  = NULL;
+	const assorted_crc32_polynomial_table_t *polynomial_table2 = NULL;
+	libcerror_error_t *error                                   = NULL;
+	uint32_t polynomial                                        = 0;
+	int result                                                 = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc32_get_polynomial_table(
+	          0xedb88320UL,
+	          &polynomial_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "polynomial_table",
+	 polynomial_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "polynomial_table->polynomial",
+	 polynomial_table->polynomial,
+	 (uint32_t) 0xedb88320UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "polynomial_table->slicing_table[ 0 ][ 1 ]",
+	 polynomial_table->slicing_table[ 0 ][ 1 ],
+	 (uint32_t) 0x77073096UL );
+
+	/* Test if the cached table is retrieved
+	 */
+	result = assorted_crc32_get_polynomial_table(
+	          0xedb88320UL,
+	          &polynomial_table2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INTPTR(
+	 "polynomial_table2",
+	 (intptr_t) polynomial_table2,
+	 (intptr_t) polynomial_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the cache reports full when more polynomials are used than can be cached
+	 */
+	for( polynomial = 0x80000001UL;
+	     polynomial < 0x80000001UL + ( 2 * ASSORTED_CRC32_NUMBER_OF_CACHED_TABLES );
+	     polynomial++ )
+	{
+		polynomial_table2 = NULL;
+
+		result = assorted_crc32_get_polynomial_table(
+		          polynomial,
+		          &polynomial_table2,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "polynomial_table2->polynomial",
+		 polynomial_table2->polynomial,
+		 polynomial );
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "polynomial_table2",
+	 polynomial_table2 );
+
+	/* Test if a cached table is not replaced when the cache is full
+	 */
+	result = assorted_crc32_get_polynomial_table(
+	          0xedb88320UL,
+	          &polynomial_table2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INTPTR(
+	 "polynomial_table2",
+	 (intptr_t) polynomial_table2,
+	 (intptr_t) polynomial_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+	/* Test error cases
+	 */
+	result = assorted_crc32_get_polynomial_table(
+	          0xedb88320UL,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_get_polynomial_table(
+	          0x04c11db7UL,
+	          &polynomial_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_calculate_castagnoli function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_castagnoli(
      void )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t checksum_value  = 0;
-	int result               = 0;
+	uint8_t check_data[ 9 ] = {
+		'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+	uint8_t *data                    = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 0;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int result                       = 0;
 
 	/* Test regular cases
 	 */
-	result = assorted_crc32_calculate(
+	result = assorted_crc32_calculate_castagnoli(
+	          &checksum_value,
+	          check_data,
+	          9,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xe3069283UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test sizes that are handled by the long and short interleaved streams
+	 * with an unaligned buffer
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( ( 3 * ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE ) + 1024 ) );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_offset = 0;
+	     data_offset < ( ( 3 * ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE ) + 1024 );
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	assorted_crc32_initialize_table(
+	 0x82f63b78UL );
+
+	for( data_size = ( 3 * ASSORTED_CRC32_CASTAGNOLI_SHORT_SIZE ) - 1;
+	     data_size < ( 3 * ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE ) + 1023;
+	     data_size += ( 3 * ASSORTED_CRC32_CASTAGNOLI_LONG_SIZE ) - 5 )
+	{
+		result = assorted_crc32_calculate(
+		          &expected_checksum_value,
+		          &( data[ 1 ] ),
+		          data_size,
+		          0x12345678UL,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_crc32_calculate_castagnoli(
+		          &checksum_value,
+		          &( data[ 1 ] ),
+		          data_size,
+		          0x12345678UL,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum_value",
+		 checksum_value,
+		 expected_checksum_value );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	assorted_crc32_initialize_table(
+	 0xedb88320UL );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_calculate_castagnoli(
+	          NULL,
+	          check_data,
+	          9,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_castagnoli(
+	          &checksum_value,
+	          NULL,
+	          9,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_castagnoli(
+	          &checksum_value,
+	          check_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	assorted_crc32_initialize_table(
+	 0xedb88320UL );
+
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_calculate_with_polynomial function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_with_polynomial(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc32_calculate_with_polynomial(
 	          &checksum_value,
 	          assorted_test_crc32_data,
 	          16,
 	          0,
 	          0,
+	          0xedb88320UL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -194,14 +1518,59 @@ int assorted_test_crc32_calculate(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test a polynomial without a dedicated calculation method
 	 */
+	assorted_crc32_initialize_table(
+	 0xeb31d82eUL );
+
 	result = assorted_crc32_calculate(
+	          &expected_checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          &error );
+
+	assorted_crc32_initialize_table(
+	 0xedb88320UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_crc32_calculate_with_polynomial(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          0xeb31d82eUL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 expected_checksum_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_calculate_with_polynomial(
 	          NULL,
 	          assorted_test_crc32_data,
 	          16,
 	          0,
 	          0,
+	          0xeb31d82eUL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -216,12 +1585,13 @@ int assorted_test_crc32_calculate(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_crc32_calculate(
+	result = assorted_crc32_calculate_with_polynomial(
 	          &checksum_value,
 	          NULL,
 	          16,
 	          0,
 	          0,
+	          0xeb31d82eUL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -236,12 +1606,34 @@ int assorted_test_crc32_calculate(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_crc32_calculate(
+	result = assorted_crc32_calculate_with_polynomial(
 	          &checksum_value,
 	          assorted_test_crc32_data,
 	          (size_t) SSIZE_MAX + 1,
 	          0,
 	          0,
+	          0xeb31d82eUL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_calculate_with_polynomial(
+	          &checksum_value,
+	          assorted_test_crc32_data,
+	          16,
+	          0,
+	          0,
+	          0x04c11db7UL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -259,6 +1651,11 @@ int assorted_test_crc32_calculate(
 	return( 1 );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
 	return( 0 );
 }
 
@@ -293,6 +1690,10 @@ int main(
 	 "assorted_crc32_initialize_table",
 	 assorted_test_crc32_initialize_table );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_initialize_slicing_table",
+	 assorted_test_crc32_initialize_slicing_table );
+
 	ASSORTED_TEST_RUN(
 	 "assorted_crc32_calculate_modulo2",
 	 assorted_test_crc32_calculate_modulo2 );
@@ -301,9 +1702,43 @@ int main(
 	 "assorted_crc32_calculate",
 	 assorted_test_crc32_calculate );
 
-	/* TODO add tests for assorted_crc32_validate */
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_calculate_slicing_by_8",
+	 assorted_test_crc32_calculate_slicing_by_8 );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_calculate_slicing_by_16",
+	 assorted_test_crc32_calculate_slicing_by_16 );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_get_fold_method",
+	 assorted_test_crc32_get_fold_method );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_calculate_folded",
+	 assorted_test_crc32_calculate_folded );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_copy_calculate",
+	 assorted_test_crc32_copy_calculate );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_combine",
+	 assorted_test_crc32_combine );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_get_polynomial_table",
+	 assorted_test_crc32_get_polynomial_table );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_calculate_castagnoli",
+	 assorted_test_crc32_calculate_castagnoli );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_calculate_with_polynomial",
+	 assorted_test_crc32_calculate_with_polynomial );
 
-	/* TODO add tests for assorted_crc32_locate_error_offset */
+	/* TODO add tests for assorted_crc32_validate */
 
 #endif /* defined( __GNUC__ ) */
 
@@ -0,0 +1,679 @@
+/*
+ * CRC-32 parallel calculation testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_crc32.h"
+#include "../src/assorted_crc32_parallel.h"
+
+/* Define to make assorted_test_crc32_parallel generate verbose output
+#define ASSORTED_TEST_CRC32_PARALLEL_VERBOSE
+ */
+
+/* The data size is larger than 3 x the minimum chunk size and not a multiple of 64
+ */
+#define ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE	( ( 3 * 1024 * 1024 ) + 1001 )
+
+/* The block size is not a divisor of the data size
+ */
+#define ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE	100000
+
+#define ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS \
+	( ( ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE + ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE - 1 ) / ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE )
+
+uint8_t assorted_test_crc32_parallel_data[ ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE ];
+
+uint32_t assorted_test_crc32_parallel_crc32_values[ ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS ];
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_crc32_parallel_calculate_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_parallel_calculate_chunk(
+     void )
+{
+	uint8_t data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	assorted_crc32_parallel_chunk_t chunk;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	chunk.buffer        = data;
+	chunk.size          = 16;
+	chunk.initial_value = 0;
+	chunk.weak_crc      = 0;
+	chunk.polynomial    = 0xedb88320UL;
+	chunk.crc32         = 0;
+	chunk.result        = 0;
+
+	result = assorted_crc32_parallel_calculate_chunk(
+	          &chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk.crc32",
+	 chunk.crc32,
+	 (uint32_t) 0xcecee288UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_parallel_calculate_chunk(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk.buffer = NULL;
+
+	result = assorted_crc32_parallel_calculate_chunk(
+	          &chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_parallel_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_parallel_calculate(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	uint32_t checksum_value          = 0;
+	uint32_t expected_checksum_value = 0;
+	int number_of_threads            = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE;
+	     data_offset++ )
+	{
+		assorted_test_crc32_parallel_data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 11 ) );
+	}
+	/* Test regular cases
+	 */
+	assorted_crc32_initialize_table(
+	 0xedb88320UL );
+
+	result = assorted_crc32_calculate(
+	          &expected_checksum_value,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          0x12345678UL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads += 3 )
+	{
+		result = assorted_crc32_parallel_calculate(
+		          &checksum_value,
+		          assorted_test_crc32_parallel_data,
+		          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+		          0x12345678UL,
+		          0,
+		          0xedb88320UL,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum_value",
+		 checksum_value,
+		 expected_checksum_value );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a weak CRC-32C
+	 */
+	assorted_crc32_initialize_table(
+	 0x82f63b78UL );
+
+	result = assorted_crc32_calculate(
+	          &expected_checksum_value,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          0x12345678UL,
+	          1,
+	          &error );
+
+	assorted_crc32_initialize_table(
+	 0xedb88320UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_crc32_parallel_calculate(
+	          &checksum_value,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          0x12345678UL,
+	          1,
+	          0x82f63b78UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 expected_checksum_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty buffer
+	 */
+	result = assorted_crc32_parallel_calculate(
+	          &checksum_value,
+	          assorted_test_crc32_parallel_data,
+	          0,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_parallel_calculate(
+	          NULL,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_parallel_calculate(
+	          &checksum_value,
+	          NULL,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_parallel_calculate(
+	          &checksum_value,
+	          assorted_test_crc32_parallel_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_parallel_calculate(
+	          &checksum_value,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_parallel_calculate_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_parallel_calculate_blocks(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	size_t block_index               = 0;
+	size_t block_size                = 0;
+	size_t data_offset               = 0;
+	uint32_t expected_checksum_value = 0;
+	int number_of_threads            = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE;
+	     data_offset++ )
+	{
+		assorted_test_crc32_parallel_data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 11 ) );
+	}
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads += 3 )
+	{
+		result = assorted_crc32_parallel_calculate_blocks(
+		          assorted_test_crc32_parallel_crc32_values,
+		          ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS,
+		          assorted_test_crc32_parallel_data,
+		          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+		          ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE,
+		          0x12345678UL,
+		          0,
+		          0xedb88320UL,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_offset = 0;
+
+		for( block_index = 0;
+		     block_index < ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS;
+		     block_index++ )
+		{
+			block_size = ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE - data_offset;
+
+			if( block_size > ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE )
+			{
+				block_size = ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE;
+			}
+			result = assorted_crc32_calculate_with_polynomial(
+			          &expected_checksum_value,
+			          &( assorted_test_crc32_parallel_data[ data_offset ] ),
+			          block_size,
+			          0x12345678UL,
+			          0,
+			          0xedb88320UL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum_value",
+			 assorted_test_crc32_parallel_crc32_values[ block_index ],
+			 expected_checksum_value );
+
+			data_offset += block_size;
+		}
+	}
+	/* Test an empty buffer
+	 */
+	result = assorted_crc32_parallel_calculate_blocks(
+	          assorted_test_crc32_parallel_crc32_values,
+	          0,
+	          assorted_test_crc32_parallel_data,
+	          0,
+	          ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_parallel_calculate_blocks(
+	          NULL,
+	          ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_parallel_calculate_blocks(
+	          assorted_test_crc32_parallel_crc32_values,
+	          ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS,
+	          NULL,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_parallel_calculate_blocks(
+	          assorted_test_crc32_parallel_crc32_values,
+	          ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          0,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_parallel_calculate_blocks(
+	          assorted_test_crc32_parallel_crc32_values,
+	          ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS - 1,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_parallel_calculate_blocks(
+	          assorted_test_crc32_parallel_crc32_values,
+	          ASSORTED_TEST_CRC32_PARALLEL_NUMBER_OF_BLOCKS,
+	          assorted_test_crc32_parallel_data,
+	          ASSORTED_TEST_CRC32_PARALLEL_DATA_SIZE,
+	          ASSORTED_TEST_CRC32_PARALLEL_BLOCK_SIZE,
+	          0,
+	          0,
+	          0xedb88320UL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_CRC32_PARALLEL_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_parallel_calculate_chunk",
+	 assorted_test_crc32_parallel_calculate_chunk );
+
+	/* TODO add tests for assorted_crc32_parallel_calculate_chunk_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_parallel_calculate",
+	 assorted_test_crc32_parallel_calculate );
+
+	/* TODO add tests for assorted_crc32_parallel_calculate_block_range */
+
+	/* TODO add tests for assorted_crc32_parallel_calculate_block_range_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_parallel_calculate_blocks",
+	 assorted_test_crc32_parallel_calculate_blocks );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -0,0 +1,710 @@
+/*
+ * CRC-32 single-bit error syndrome table testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_crc32.h"
+#include "../src/assorted_crc32_syndrome_table.h"
+
+/* Define to make assorted_test_crc32_syndrome_table generate verbose output
+#define ASSORTED_TEST_CRC32_SYNDROME_TABLE_VERBOSE
+ */
+
+#define ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE	4096
+
+uint8_t assorted_test_crc32_syndrome_table_data[ ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE ];
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_crc32_syndrome_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_syndrome_table_initialize(
+     void )
+{
+	assorted_crc32_syndrome_table_t *syndrome_table = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc32_syndrome_table_initialize(
+	          &syndrome_table,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0xedb88320UL,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE * 8,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "syndrome_table",
+	 syndrome_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "syndrome_table->step_size",
+	 syndrome_table->step_size,
+	 (uint64_t) 1 );
+
+	result = assorted_crc32_syndrome_table_free(
+	          &syndrome_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "syndrome_table",
+	 syndrome_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_syndrome_table_initialize(
+	          NULL,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0xedb88320UL,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	syndrome_table = (assorted_crc32_syndrome_table_t *) 0x12345678UL;
+
+	result = assorted_crc32_syndrome_table_initialize(
+	          &syndrome_table,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0xedb88320UL,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	syndrome_table = NULL;
+
+	result = assorted_crc32_syndrome_table_initialize(
+	          &syndrome_table,
+	          0,
+	          0xedb88320UL,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_syndrome_table_initialize(
+	          &syndrome_table,
+	          (size_t) SSIZE_MAX + 1,
+	          0xedb88320UL,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_syndrome_table_initialize(
+	          &syndrome_table,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0x04c11db7UL,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_syndrome_table_initialize(
+	          &syndrome_table,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0xedb88320UL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( syndrome_table != NULL )
+	{
+		assorted_crc32_syndrome_table_free(
+		 &syndrome_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_syndrome_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_syndrome_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_syndrome_table_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_syndrome_table_get_error_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_syndrome_table_get_error_offset(
+     void )
+{
+	uint32_t maximum_number_of_steps[ 3 ] = {
+		ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE * 8, 181, 1 };
+
+	assorted_crc32_syndrome_table_t *syndrome_table = NULL;
+	libcerror_error_t *error                        = NULL;
+	size_t data_offset                              = 0;
+	size_t error_offset                             = 0;
+	uint32_t calculated_checksum_value              = 0;
+	uint32_t checksum_value                         = 0;
+	uint8_t bit_index                               = 0;
+	uint8_t error_bit                               = 0;
+	int result                                      = 0;
+	int table_index                                 = 0;
+
+	for( data_offset = 0;
+	     data_offset < ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE;
+	     data_offset++ )
+	{
+		assorted_test_crc32_syndrome_table_data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	assorted_crc32_initialize_table(
+	 0xedb88320UL );
+
+	result = assorted_crc32_calculate(
+	          &checksum_value,
+	          assorted_test_crc32_syndrome_table_data,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases with a lookup per error, a stepped lookup and a single syndrome
+	 */
+	for( table_index = 0;
+	     table_index < 3;
+	     table_index++ )
+	{
+		result = assorted_crc32_syndrome_table_initialize(
+		          &syndrome_table,
+		          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+		          0xedb88320UL,
+		          maximum_number_of_steps[ table_index ],
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "syndrome_table",
+		 syndrome_table );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( data_offset = 0;
+		     data_offset < ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE;
+		     data_offset += 509 )
+		{
+			bit_index = (uint8_t) ( data_offset % 8 );
+
+			assorted_test_crc32_syndrome_table_data[ data_offset ] ^= (uint8_t) ( 1 << bit_index );
+
+			result = assorted_crc32_calculate(
+			          &calculated_checksum_value,
+			          assorted_test_crc32_syndrome_table_data,
+			          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+			          0,
+			          0,
+			          &error );
+
+			assorted_test_crc32_syndrome_table_data[ data_offset ] ^= (uint8_t) ( 1 << bit_index );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_crc32_syndrome_table_get_error_offset(
+			          syndrome_table,
+			          checksum_value,
+			          calculated_checksum_value,
+			          &error_offset,
+			          &error_bit,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "error_offset",
+			 error_offset,
+			 data_offset );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+			 "error_bit",
+			 error_bit,
+			 bit_index );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Test without an error
+		 */
+		result = assorted_crc32_syndrome_table_get_error_offset(
+		          syndrome_table,
+		          checksum_value,
+		          checksum_value,
+		          &error_offset,
+		          &error_bit,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( table_index < 2 )
+		{
+			result = assorted_crc32_syndrome_table_free(
+			          &syndrome_table,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = assorted_crc32_syndrome_table_get_error_offset(
+	          NULL,
+	          checksum_value,
+	          calculated_checksum_value,
+	          &error_offset,
+	          &error_bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_syndrome_table_get_error_offset(
+	          syndrome_table,
+	          checksum_value,
+	          calculated_checksum_value,
+	          NULL,
+	          &error_bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_syndrome_table_get_error_offset(
+	          syndrome_table,
+	          checksum_value,
+	          calculated_checksum_value,
+	          &error_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_crc32_syndrome_table_free(
+	          &syndrome_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( syndrome_table != NULL )
+	{
+		assorted_crc32_syndrome_table_free(
+		 &syndrome_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc32_syndrome_table_locate_error_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_syndrome_table_locate_error_offset(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	size_t error_offset                = 0;
+	uint32_t calculated_checksum_value = 0;
+	uint32_t checksum_value            = 0;
+	uint8_t error_bit                  = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	assorted_crc32_initialize_table(
+	 0xedb88320UL );
+
+	result = assorted_crc32_calculate(
+	          &checksum_value,
+	          assorted_test_crc32_syndrome_table_data,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0x12345678UL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	assorted_test_crc32_syndrome_table_data[ 1234 ] ^= 0x80;
+
+	result = assorted_crc32_calculate(
+	          &calculated_checksum_value,
+	          assorted_test_crc32_syndrome_table_data,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0x12345678UL,
+	          1,
+	          &error );
+
+	assorted_test_crc32_syndrome_table_data[ 1234 ] ^= 0x80;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_crc32_syndrome_table_locate_error_offset(
+	          checksum_value,
+	          calculated_checksum_value,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0xedb88320UL,
+	          &error_offset,
+	          &error_bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "error_offset",
+	 error_offset,
+	 (size_t) 1234 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "error_bit",
+	 error_bit,
+	 7 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc32_syndrome_table_locate_error_offset(
+	          checksum_value,
+	          calculated_checksum_value,
+	          (size_t) SSIZE_MAX + 1,
+	          0xedb88320UL,
+	          &error_offset,
+	          &error_bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc32_syndrome_table_locate_error_offset(
+	          checksum_value,
+	          calculated_checksum_value,
+	          ASSORTED_TEST_CRC32_SYNDROME_TABLE_DATA_SIZE,
+	          0x04c11db7UL,
+	          &error_offset,
+	          &error_bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_CRC32_SYNDROME_TABLE_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_syndrome_table_initialize",
+	 assorted_test_crc32_syndrome_table_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_syndrome_table_free",
+	 assorted_test_crc32_syndrome_table_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_syndrome_table_get_error_offset",
+	 assorted_test_crc32_syndrome_table_get_error_offset );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc32_syndrome_table_locate_error_offset",
+	 assorted_test_crc32_syndrome_table_locate_error_offset );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -240,6 +240,734 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_crc64_calculate_ecma182_slicing_by_8 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_ecma182_slicing_by_8(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc64_calculate_ecma182_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xad24192bac16a7ddULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the CRC-64 can be calculated in parts
+	 */
+	result = assorted_crc64_calculate_ecma182_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          5,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_crc64_calculate_ecma182_slicing_by_8(
+	          &checksum_value,
+	          &( assorted_test_crc64_data[ 5 ] ),
+	          11,
+	          checksum_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xad24192bac16a7ddULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the check value of the CRC-64 variant
+	 */
+	result = assorted_crc64_calculate_ecma182_slicing_by_8(
+	          &checksum_value,
+	          (uint8_t *) "123456789",
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0x6c40df5f0b497347ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc64_calculate_ecma182_slicing_by_8(
+	          NULL,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc64_calculate_ecma182_slicing_by_8(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc64_calculate_ecma182_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc64_calculate_xz_slicing_by_8 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_xz_slicing_by_8(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc64_calculate_xz_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xde435fd0b583bc34ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the CRC-64 can be calculated in parts
+	 */
+	result = assorted_crc64_calculate_xz_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          5,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_crc64_calculate_xz_slicing_by_8(
+	          &checksum_value,
+	          &( assorted_test_crc64_data[ 5 ] ),
+	          11,
+	          checksum_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xde435fd0b583bc34ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the check value of the CRC-64 variant
+	 */
+	result = assorted_crc64_calculate_xz_slicing_by_8(
+	          &checksum_value,
+	          (uint8_t *) "123456789",
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0x995dc9bbdf1939faULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc64_calculate_xz_slicing_by_8(
+	          NULL,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc64_calculate_xz_slicing_by_8(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc64_calculate_xz_slicing_by_8(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc64_get_polynomial_table function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_get_polynomial_table(
+     void )
+{
+	const assorted_crc64_polynomial_table_t *polynomial_table  = NULL;
+	const assorted_crc64_polynomial_table_t *polynomial_table2 = NULL;
+	libcerror_error_t *error                                   = NULL;
+	int result                                                 = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_crc64_get_polynomial_table(
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          &polynomial_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "polynomial_table",
+	 polynomial_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "polynomial_table->polynomial",
+	 polynomial_table->polynomial,
+	 (uint64_t) ASSORTED_CRC64_POLYNOMIAL_XZ );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "polynomial_table->slicing_table[ 0 ][ 1 ]",
+	 polynomial_table->slicing_table[ 0 ][ 1 ],
+	 (uint64_t) 0xb32e4cbe03a75f6fULL );
+
+	/* Test if the cached table is retrieved
+	 */
+	result = assorted_crc64_get_polynomial_table(
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          &polynomial_table2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INTPTR(
+	 "polynomial_table2",
+	 (intptr_t) polynomial_table2,
+	 (intptr_t) polynomial_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc64_get_polynomial_table(
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc64_get_polynomial_table(
+	          0x42f0e1eba9ea3693ULL,
+	          &polynomial_table2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_crc64_get_fold_method function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_get_fold_method(
+     void )
+{
+	int fold_method = 0;
+
+	fold_method = assorted_crc64_get_fold_method();
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "fold_method",
+	 fold_method,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_INT(
+	 "fold_method",
+	 fold_method,
+	 ASSORTED_CRC64_FOLD_METHOD_PMULL + 1 );
+
+	/* Test if the fold method is consistent
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "fold_method",
+	 assorted_crc64_get_fold_method(),
+	 fold_method );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_crc64_calculate_with_polynomial function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_with_polynomial(
+     void )
+{
+	uint8_t data[ 1031 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 0;
+	uint64_t checksum_value          = 0;
+	uint64_t expected_checksum_value = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1031;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = assorted_crc64_calculate_with_polynomial(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          0,
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xde435fd0b583bc34ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the check value of the CRC-64/NVMe variant
+	 */
+	result = assorted_crc64_calculate_with_polynomial(
+	          &checksum_value,
+	          (uint8_t *) "123456789",
+	          9,
+	          0,
+	          0,
+	          ASSORTED_CRC64_POLYNOMIAL_NVME,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xae8b14860a799888ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test sizes and offsets that are handled by folding and are not a multiple
+	 * of the folding width
+	 */
+	for( data_size = 63;
+	     data_size <= 1030;
+	     data_size += 161 )
+	{
+		for( data_offset = 0;
+		     data_offset < 2;
+		     data_offset++ )
+		{
+			result = assorted_crc64_calculate_xz_slicing_by_8(
+			          &expected_checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x0123456789abcdefULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_crc64_calculate_with_polynomial(
+			          &checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size - data_offset,
+			          0x0123456789abcdefULL,
+			          0,
+			          ASSORTED_CRC64_POLYNOMIAL_XZ,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "checksum_value",
+			 checksum_value,
+			 expected_checksum_value );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test if a weak CRC-64 is the CRC-64 without the initial and final XOR
+	 */
+	result = assorted_crc64_calculate_with_polynomial(
+	          &expected_checksum_value,
+	          data,
+	          1031,
+	          0xffffffffffffffffULL,
+	          1,
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	expected_checksum_value ^= 0xffffffffffffffffULL;
+
+	result = assorted_crc64_calculate_with_polynomial(
+	          &checksum_value,
+	          data,
+	          1031,
+	          0,
+	          0,
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 expected_checksum_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_crc64_calculate_with_polynomial(
+	          NULL,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          0,
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc64_calculate_with_polynomial(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          0,
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc64_calculate_with_polynomial(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          ASSORTED_CRC64_POLYNOMIAL_XZ,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_crc64_calculate_with_polynomial(
+	          &checksum_value,
+	          assorted_test_crc64_data,
+	          16,
+	          0,
+	          0,
+	          0x42f0e1eba9ea3693ULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -277,6 +1005,26 @@ int main(
 	 "assorted_crc64_calculate_2",
 	 assorted_test_crc64_calculate_2 );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_crc64_calculate_ecma182_slicing_by_8",
+	 assorted_test_crc64_calculate_ecma182_slicing_by_8 );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc64_calculate_xz_slicing_by_8",
+	 assorted_test_crc64_calculate_xz_slicing_by_8 );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc64_get_polynomial_table",
+	 assorted_test_crc64_get_polynomial_table );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc64_get_fold_method",
+	 assorted_test_crc64_get_fold_method );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_crc64_calculate_with_polynomial",
+	 assorted_test_crc64_calculate_with_polynomial );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
@@ -31,8 +31,10 @@
 #include "assorted_test_libcerror.h"
 #include "assorted_test_libcnotify.h"
 #include "assorted_test_macros.h"
+#include "assorted_test_memory.h"
 #include "assorted_test_unused.h"
 
+#include "../src/assorted_arena.h"
 #include "../src/assorted_bit_stream.h"
 #include "../src/assorted_deflate.h"
 #include "../src/assorted_huffman_tree.h"
@@ -688,6 +690,79 @@ uint8_t assorted_test_deflate_uncompressed_data[ 7640 ] = {
 	0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x4c, 0x69,
 	0x62, 0x72, 0x61, 0x72, 0x79, 0x2e, 0x0a, 0x0a };
 
+/* The gzip member header with a BGZF extra field, name, comment and header checksum
+ */
+uint8_t assorted_test_deflate_gzip_member_header_data[ 27 ] = {
+	0x1f, 0x8b, 0x08, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00,
+	0x5f, 0x0a, 0x74, 0x65, 0x73, 0x74, 0x00, 0x63, 0x00, 0xca, 0xa6 };
+
+/* The gzip member header without optional fields
+ */
+uint8_t assorted_test_deflate_gzip_basic_member_header_data[ 10 ] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03 };
+
+/* The gzip member footer of the uncompressed data
+ */
+uint8_t assorted_test_deflate_gzip_member_footer_data[ 8 ] = {
+	0x9f, 0xaf, 0x72, 0x82, 0xd8, 0x1d, 0x00, 0x00 };
+
+/* The size of the gzip compressed test data, 2 members and 2 bytes of trailing data
+ */
+#define ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE	( 27 + 2621 + 8 + 10 + 2621 + 8 + 2 )
+
+/* Builds the gzip compressed test data from the DEFLATE compressed data of the zlib compressed test data
+ */
+void assorted_test_deflate_build_gzip_data(
+      uint8_t *gzip_data )
+{
+	size_t gzip_data_offset = 0;
+
+	memory_copy(
+	 &( gzip_data[ gzip_data_offset ] ),
+	 assorted_test_deflate_gzip_member_header_data,
+	 27 );
+
+	gzip_data_offset += 27;
+
+	memory_copy(
+	 &( gzip_data[ gzip_data_offset ] ),
+	 &( assorted_test_deflate_compressed_data[ 2 ] ),
+	 2621 );
+
+	gzip_data_offset += 2621;
+
+	memory_copy(
+	 &( gzip_data[ gzip_data_offset ] ),
+	 assorted_test_deflate_gzip_member_footer_data,
+	 8 );
+
+	gzip_data_offset += 8;
+
+	memory_copy(
+	 &( gzip_data[ gzip_data_offset ] ),
+	 assorted_test_deflate_gzip_basic_member_header_data,
+	 10 );
+
+	gzip_data_offset += 10;
+
+	memory_copy(
+	 &( gzip_data[ gzip_data_offset ] ),
+	 &( assorted_test_deflate_compressed_data[ 2 ] ),
+	 2621 );
+
+	gzip_data_offset += 2621;
+
+	memory_copy(
+	 &( gzip_data[ gzip_data_offset ] ),
+	 assorted_test_deflate_gzip_member_footer_data,
+	 8 );
+
+	gzip_data_offset += 8;
+
+	gzip_data[ gzip_data_offset++ ] = 0;
+	gzip_data[ gzip_data_offset++ ] = 0;
+}
+
 #if defined( __GNUC__ )
 
 /* Tests the assorted_deflate_build_dynamic_huffman_trees function
@@ -1013,6 +1088,67 @@ int assorted_test_deflate_build_fixed_huffman_trees(
 	 "error",
 	 error );
 
+	/* The prebuilt lookup tables of the fixed Huffman trees must match
+	 * the lookup tables of the built fixed Huffman trees
+	 */
+	result = assorted_huffman_tree_build_lookup_table(
+	          literals_huffman_tree,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "literals_huffman_tree->lookup_table_bits",
+	 literals_huffman_tree->lookup_table_bits,
+	 assorted_deflate_fixed_huffman_literals_tree.lookup_table_bits );
+
+	result = memory_compare(
+	          literals_huffman_tree->lookup_table,
+	          assorted_deflate_fixed_huffman_literals_lookup_table,
+	          sizeof( uint32_t ) * 512 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_huffman_tree_build_lookup_table(
+	          distances_huffman_tree,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "distances_huffman_tree->lookup_table_bits",
+	 distances_huffman_tree->lookup_table_bits,
+	 assorted_deflate_fixed_huffman_distances_tree.lookup_table_bits );
+
+	result = memory_compare(
+	          distances_huffman_tree->lookup_table,
+	          assorted_deflate_fixed_huffman_distances_lookup_table,
+	          sizeof( uint32_t ) * 32 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	result = assorted_deflate_build_fixed_huffman_trees(
@@ -1139,48 +1275,93 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the assorted_deflate_decode_huffman function
+/* Tests the assorted_deflate_copy_match function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_deflate_decode_huffman(
+int assorted_test_deflate_copy_match(
      void )
 {
-	uint8_t uncompressed_data[ 8192 ];
+	uint8_t expected_data[ 64 ];
+	uint8_t uncompressed_data[ 64 ];
 
-	assorted_bit_stream_t *bit_stream               = NULL;
-	assorted_huffman_tree_t *distances_huffman_tree = NULL;
-	assorted_huffman_tree_t *literals_huffman_tree  = NULL;
-	libcerror_error_t *error                        = NULL;
-	size_t uncompressed_data_offset                 = 0;
-	int result                                      = 0;
+	libcerror_error_t *error    = NULL;
+	size_t data_offset          = 0;
+	uint16_t compression_offset = 0;
+	uint16_t compression_size   = 0;
+	int result                  = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = assorted_bit_stream_initialize(
-	          &bit_stream,
-	          assorted_test_deflate_compressed_data,
-	          2627,
-	          2,
-	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
-	          &error );
+	for( compression_offset = 1;
+	     compression_offset <= 16;
+	     compression_offset++ )
+	{
+		for( compression_size = 3;
+		     compression_size <= 40;
+		     compression_size += 37 )
+		{
+			for( data_offset = 0;
+			     data_offset < 64;
+			     data_offset++ )
+			{
+				uncompressed_data[ data_offset ] = (uint8_t) ( 'a' + data_offset );
+				expected_data[ data_offset ]     = (uint8_t) ( 'a' + data_offset );
+			}
+			for( data_offset = 16;
+			     data_offset < (size_t) ( 16 + compression_size );
+			     data_offset++ )
+			{
+				expected_data[ data_offset ] = expected_data[ data_offset - compression_offset ];
+			}
+			result = assorted_deflate_copy_match(
+			          uncompressed_data,
+			          64,
+			          16,
+			          compression_offset,
+			          compression_size,
+			          &error );
 
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "bit_stream",
-	 bit_stream );
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+			result = memory_compare(
+			          uncompressed_data,
+			          expected_data,
+			          16 + compression_size );
 
-	result = assorted_huffman_tree_initialize(
-	          &literals_huffman_tree,
-	          288,
-	          15,
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test a match at the end of the uncompressed data
+	 */
+	for( data_offset = 0;
+	     data_offset < 64;
+	     data_offset++ )
+	{
+		uncompressed_data[ data_offset ] = (uint8_t) ( 'a' + data_offset );
+		expected_data[ data_offset ]     = (uint8_t) ( 'a' + data_offset );
+	}
+	for( data_offset = 40;
+	     data_offset < 64;
+	     data_offset++ )
+	{
+		expected_data[ data_offset ] = expected_data[ data_offset - 8 ];
+	}
+	result = assorted_deflate_copy_match(
+	          uncompressed_data,
+	          64,
+	          40,
+	          8,
+	          24,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1188,45 +1369,28 @@ int assorted_test_deflate_decode_huffman(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "literals_huffman_tree",
-	 literals_huffman_tree );
-
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = assorted_huffman_tree_initialize(
-	          &distances_huffman_tree,
-	          30,
-	          15,
-	          &error );
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_data,
+	          64 );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "distances_huffman_tree",
-	 distances_huffman_tree );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test regular cases
-	 */
+	 0 );
 
 	/* Test error cases
 	 */
-	result = assorted_deflate_decode_huffman(
+	result = assorted_deflate_copy_match(
 	          NULL,
-	          literals_huffman_tree,
-	          distances_huffman_tree,
-	          uncompressed_data,
-	          8192,
-	          &uncompressed_data_offset,
+	          64,
+	          16,
+	          1,
+	          3,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1241,13 +1405,12 @@ int assorted_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_decode_huffman(
-	          bit_stream,
-	          NULL,
-	          distances_huffman_tree,
+	result = assorted_deflate_copy_match(
 	          uncompressed_data,
-	          8192,
-	          &uncompressed_data_offset,
+	          (size_t) SSIZE_MAX + 1,
+	          16,
+	          1,
+	          3,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1262,13 +1425,12 @@ int assorted_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_decode_huffman(
-	          bit_stream,
-	          literals_huffman_tree,
-	          NULL,
+	result = assorted_deflate_copy_match(
 	          uncompressed_data,
-	          8192,
-	          &uncompressed_data_offset,
+	          64,
+	          65,
+	          1,
+	          3,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1283,13 +1445,12 @@ int assorted_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_decode_huffman(
-	          bit_stream,
-	          literals_huffman_tree,
-	          distances_huffman_tree,
-	          NULL,
-	          8192,
-	          &uncompressed_data_offset,
+	result = assorted_deflate_copy_match(
+	          uncompressed_data,
+	          64,
+	          16,
+	          17,
+	          3,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1304,13 +1465,12 @@ int assorted_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_decode_huffman(
-	          bit_stream,
-	          literals_huffman_tree,
-	          distances_huffman_tree,
+	result = assorted_deflate_copy_match(
 	          uncompressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_offset,
+	          64,
+	          16,
+	          1,
+	          49,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1325,31 +1485,41 @@ int assorted_test_deflate_decode_huffman(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_decode_huffman(
-	          bit_stream,
-	          literals_huffman_tree,
-	          distances_huffman_tree,
-	          uncompressed_data,
-	          8192,
-	          NULL,
-	          &error );
+	return( 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+/* Tests the assorted_deflate_decode_huffman_fast function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decode_huffman_fast(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
 
-	libcerror_error_free(
-	 &error );
+	assorted_bit_stream_t *bit_stream               = NULL;
+	assorted_huffman_tree_t *distances_huffman_tree = NULL;
+	assorted_huffman_tree_t *literals_huffman_tree  = NULL;
+	libcerror_error_t *error                        = NULL;
+	size_t uncompressed_data_offset                 = 0;
+	uint32_t value_32bit                            = 0;
+	int result                                      = 0;
 
-	/* Clean up
+	/* Initialize test
 	 */
-	result = assorted_huffman_tree_free(
-	          &distances_huffman_tree,
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          2,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1357,16 +1527,18 @@ int assorted_test_deflate_decode_huffman(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "distances_huffman_tree",
-	 distances_huffman_tree );
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = assorted_huffman_tree_free(
+	result = assorted_huffman_tree_initialize(
 	          &literals_huffman_tree,
+	          288,
+	          15,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1374,7 +1546,7 @@ int assorted_test_deflate_decode_huffman(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
 	 "literals_huffman_tree",
 	 literals_huffman_tree );
 
@@ -1382,8 +1554,10 @@ int assorted_test_deflate_decode_huffman(
 	 "error",
 	 error );
 
-	result = assorted_bit_stream_free(
-	          &bit_stream,
+	result = assorted_huffman_tree_initialize(
+	          &distances_huffman_tree,
+	          30,
+	          15,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1391,55 +1565,40 @@ int assorted_test_deflate_decode_huffman(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "distances_huffman_tree",
+	 distances_huffman_tree );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	/* The test data contains a single dynamic Huffman compressed block
+	 */
+	result = assorted_bit_stream_get_value_back_to_front(
+	          bit_stream,
+	          3,
+	          &value_32bit,
+	          &error );
 
-on_error:
-	if( distances_huffman_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &distances_huffman_tree,
-		 NULL );
-	}
-	if( literals_huffman_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &literals_huffman_tree,
-		 NULL );
-	}
-	if( bit_stream != NULL )
-	{
-		assorted_bit_stream_free(
-		 &bit_stream,
-		 NULL );
-	}
-	return( 0 );
-}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the assorted_deflate_calculate_adler32 function
- * Returns 1 if successful or 0 if not
- */
-int assorted_test_deflate_calculate_adler32(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	uint32_t checksum        = 0;
-	int result               = 0;
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000005UL );
 
-	/* Test regular cases
-	 */
-	result = assorted_deflate_calculate_adler32(
-	          &checksum,
-	          assorted_test_deflate_uncompressed_data,
-	          7640,
-	          1,
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_build_dynamic_huffman_trees(
+	          bit_stream,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1447,22 +1606,20 @@ int assorted_test_deflate_calculate_adler32(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
-	 "checksum",
-	 checksum,
-	 (uint32_t) 0x304a56a4UL );
-
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = assorted_deflate_calculate_adler32(
+	result = assorted_deflate_decode_huffman_fast(
+	          bit_stream,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
 	          NULL,
-	          assorted_test_deflate_uncompressed_data,
-	          7640,
-	          1,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1477,91 +1634,71 @@ int assorted_test_deflate_calculate_adler32(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_calculate_adler32(
-	          &checksum,
-	          NULL,
-	          7640,
-	          1,
+	/* Test regular cases
+	 */
+	result = assorted_huffman_tree_build_lookup_table(
+	          literals_huffman_tree,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = assorted_deflate_calculate_adler32(
-	          &checksum,
-	          assorted_test_deflate_uncompressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          1,
+	result = assorted_huffman_tree_build_lookup_table(
+	          distances_huffman_tree,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	return( 0 );
-}
-
-/* Tests the assorted_deflate_read_block_header function
- * Returns 1 if successful or 0 if not
- */
-int assorted_test_deflate_read_block_header(
-     void )
-{
-	assorted_bit_stream_t *bit_stream = NULL;
-	libcerror_error_t *error          = NULL;
-	uint8_t block_type                = 0;
-	uint8_t last_block_flag           = 0;
-	int result                        = 0;
-
-	/* Initialize test
+	/* The fast loop stops before the end of the compressed data after which
+	 * the remaining symbols are decoded with bounds checks
 	 */
-	result = assorted_bit_stream_initialize(
-	          &bit_stream,
-	          assorted_test_deflate_compressed_data,
-	          2627,
-	          2,
-	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	result = assorted_deflate_decode_huffman_fast(
+	          bit_stream,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "bit_stream",
-	 bit_stream );
+	ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+	 "uncompressed_data_offset",
+	 (uint64_t) uncompressed_data_offset,
+	 (uint64_t) 7640 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = assorted_deflate_read_block_header(
+	result = assorted_deflate_decode_huffman(
 	          bit_stream,
-	          &block_type,
-	          &last_block_flag,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1569,58 +1706,103 @@ int assorted_test_deflate_read_block_header(
 	 result,
 	 1 );
 
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 7640 );
+
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_data,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
 	 */
-	result = assorted_bit_stream_free(
-	          &bit_stream,
+	uncompressed_data_offset = 0;
+
+	result = assorted_deflate_decode_huffman_fast(
+	          NULL,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
+	 -1 );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = assorted_bit_stream_initialize(
-	          &bit_stream,
-	          assorted_test_deflate_compressed_data,
-	          2627,
-	          2,
-	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decode_huffman_fast(
+	          bit_stream,
+	          NULL,
+	          distances_huffman_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "bit_stream",
-	 bit_stream );
+	 "error",
+	 error );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decode_huffman_fast(
+	          bit_stream,
+	          literals_huffman_tree,
+	          NULL,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = assorted_deflate_read_block_header(
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decode_huffman_fast(
+	          bit_stream,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          NULL,
+	          8192,
+	          &uncompressed_data_offset,
 	          NULL,
-	          &block_type,
-	          &last_block_flag,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1635,10 +1817,14 @@ int assorted_test_deflate_read_block_header(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_read_block_header(
+	result = assorted_deflate_decode_huffman_fast(
 	          bit_stream,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_offset,
 	          NULL,
-	          &last_block_flag,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1653,9 +1839,13 @@ int assorted_test_deflate_read_block_header(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_read_block_header(
+	result = assorted_deflate_decode_huffman_fast(
 	          bit_stream,
-	          &block_type,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          uncompressed_data,
+	          8192,
+	          NULL,
 	          NULL,
 	          &error );
 
@@ -1673,8 +1863,8 @@ int assorted_test_deflate_read_block_header(
 
 	/* Clean up
 	 */
-	result = assorted_bit_stream_free(
-	          &bit_stream,
+	result = assorted_huffman_tree_free(
+	          &distances_huffman_tree,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1683,47 +1873,90 @@ int assorted_test_deflate_read_block_header(
 	 1 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
+	 "distances_huffman_tree",
+	 distances_huffman_tree );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
+	result = assorted_huffman_tree_free(
+	          &literals_huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "literals_huffman_tree",
+	 literals_huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( distances_huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &distances_huffman_tree,
+		 NULL );
+	}
+	if( literals_huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &literals_huffman_tree,
+		 NULL );
+	}
 	if( bit_stream != NULL )
 	{
 		assorted_bit_stream_free(
 		 &bit_stream,
 		 NULL );
 	}
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
 	return( 0 );
 }
 
-/* Tests the assorted_deflate_read_block function
+/* Tests the assorted_deflate_decode_huffman function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_deflate_read_block(
+int assorted_test_deflate_decode_huffman(
      void )
 {
 	uint8_t uncompressed_data[ 8192 ];
 
-	assorted_bit_stream_t *bit_stream             = NULL;
-	assorted_huffman_tree_t *fixed_distances_tree = NULL;
-	assorted_huffman_tree_t *fixed_literals_tree  = NULL;
-	libcerror_error_t *error                      = NULL;
-	size_t uncompressed_data_offset               = 0;
-	size_t uncompressed_data_size                 = 7640;
-	uint8_t block_type                            = 0;
-	uint8_t last_block_flag                       = 0;
-	int result                                    = 0;
+	assorted_bit_stream_t *bit_stream               = NULL;
+	assorted_huffman_tree_t *distances_huffman_tree = NULL;
+	assorted_huffman_tree_t *literals_huffman_tree  = NULL;
+	libcerror_error_t *error                        = NULL;
+	size_t uncompressed_data_offset                 = 0;
+	int result                                      = 0;
 
 	/* Initialize test
 	 */
@@ -1749,7 +1982,7 @@ int assorted_test_deflate_read_block(
 	 error );
 
 	result = assorted_huffman_tree_initialize(
-	          &fixed_literals_tree,
+	          &literals_huffman_tree,
 	          288,
 	          15,
 	          &error );
@@ -1760,15 +1993,15 @@ int assorted_test_deflate_read_block(
 	 1 );
 
 	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "fixed_literals_tree",
-	 fixed_literals_tree );
+	 "literals_huffman_tree",
+	 literals_huffman_tree );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = assorted_huffman_tree_initialize(
-	          &fixed_distances_tree,
+	          &distances_huffman_tree,
 	          30,
 	          15,
 	          &error );
@@ -1779,37 +2012,8 @@ int assorted_test_deflate_read_block(
 	 1 );
 
 	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "fixed_distances_tree",
-	 fixed_distances_tree );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = assorted_deflate_build_fixed_huffman_trees(
-	          fixed_literals_tree,
-	          fixed_distances_tree,
-	          &error );
-
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = assorted_deflate_read_block_header(
-	          bit_stream,
-	          &block_type,
-	          &last_block_flag,
-	          &error );
-
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	 "distances_huffman_tree",
+	 distances_huffman_tree );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1817,84 +2021,39 @@ int assorted_test_deflate_read_block(
 
 	/* Test regular cases
 	 */
-	result = assorted_deflate_read_block(
-	          bit_stream,
-	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
-	          uncompressed_data,
-	          uncompressed_data_size,
-	          &uncompressed_data_offset,
-	          &error );
-
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 7640 );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-/* TODO: test uncompressed data too small */
-
-	/* Clean up
-	 */
-	result = assorted_bit_stream_free(
-	          &bit_stream,
-	          &error );
-
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
 
-	/* Initialize test
+	/* Test error cases
 	 */
-	result = assorted_bit_stream_initialize(
-	          &bit_stream,
-	          assorted_test_deflate_compressed_data,
-	          2627,
-	          2,
-	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	result = assorted_deflate_decode_huffman(
+	          NULL,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          uncompressed_data,
+	          8192,
+	          &uncompressed_data_offset,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "bit_stream",
-	 bit_stream );
-
-	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = assorted_deflate_read_block(
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decode_huffman(
+	          bit_stream,
 	          NULL,
-	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
+	          distances_huffman_tree,
 	          uncompressed_data,
-	          uncompressed_data_size,
+	          8192,
 	          &uncompressed_data_offset,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1909,14 +2068,14 @@ int assorted_test_deflate_read_block(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_read_block(
+	result = assorted_deflate_decode_huffman(
 	          bit_stream,
-	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
+	          literals_huffman_tree,
 	          NULL,
-	          uncompressed_data_size,
+	          uncompressed_data,
+	          8192,
 	          &uncompressed_data_offset,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1931,14 +2090,14 @@ int assorted_test_deflate_read_block(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_read_block(
+	result = assorted_deflate_decode_huffman(
 	          bit_stream,
-	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
-	          uncompressed_data,
-	          (size_t) SSIZE_MAX + 1,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
+	          NULL,
+	          8192,
 	          &uncompressed_data_offset,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1953,13 +2112,13 @@ int assorted_test_deflate_read_block(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_read_block(
+	result = assorted_deflate_decode_huffman(
 	          bit_stream,
-	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
 	          uncompressed_data,
-	          uncompressed_data_size,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_offset,
 	          NULL,
 	          &error );
 
@@ -1975,14 +2134,14 @@ int assorted_test_deflate_read_block(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_read_block(
+	result = assorted_deflate_decode_huffman(
 	          bit_stream,
-	          block_type,
-	          fixed_literals_tree,
-	          fixed_distances_tree,
+	          literals_huffman_tree,
+	          distances_huffman_tree,
 	          uncompressed_data,
-	          uncompressed_data_size,
-	          &uncompressed_data_offset,
+	          8192,
+	          NULL,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2000,7 +2159,7 @@ int assorted_test_deflate_read_block(
 	/* Clean up
 	 */
 	result = assorted_huffman_tree_free(
-	          &fixed_distances_tree,
+	          &distances_huffman_tree,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2009,15 +2168,15 @@ int assorted_test_deflate_read_block(
 	 1 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "fixed_distances_tree",
-	 fixed_distances_tree );
+	 "distances_huffman_tree",
+	 distances_huffman_tree );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = assorted_huffman_tree_free(
-	          &fixed_literals_tree,
+	          &literals_huffman_tree,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2026,8 +2185,8 @@ int assorted_test_deflate_read_block(
 	 1 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "fixed_literals_tree",
-	 fixed_literals_tree );
+	 "literals_huffman_tree",
+	 literals_huffman_tree );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2043,8 +2202,3670 @@ int assorted_test_deflate_read_block(
 	 1 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "bit_stream",
-	 bit_stream );
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( distances_huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &distances_huffman_tree,
+		 NULL );
+	}
+	if( literals_huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &literals_huffman_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_calculate_adler32 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_calculate_adler32(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_calculate_adler32(
+	          &checksum,
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x304a56a4UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_calculate_adler32(
+	          NULL,
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_calculate_adler32(
+	          &checksum,
+	          NULL,
+	          7640,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_calculate_adler32(
+	          &checksum,
+	          assorted_test_deflate_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_compressor_initialize and assorted_deflate_compressor_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_compressor_initialize(
+     void )
+{
+	assorted_deflate_compressor_t *compressor = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_compressor_initialize(
+	          &compressor,
+	          -1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "compressor->compression_level",
+	 compressor->compression_level,
+	 6 );
+
+	result = assorted_deflate_compressor_free(
+	          &compressor,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test optimal parsing compression level
+	 */
+	result = assorted_deflate_compressor_initialize(
+	          &compressor,
+	          10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressor->match_tree",
+	 compressor->match_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "compressor->chain_table",
+	 compressor->chain_table );
+
+	result = assorted_deflate_compressor_free(
+	          &compressor,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_compressor_initialize(
+	          NULL,
+	          -1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressor = (assorted_deflate_compressor_t *) 0x12345678UL;
+
+	result = assorted_deflate_compressor_initialize(
+	          &compressor,
+	          -1,
+	          &error );
+
+	compressor = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compressor_initialize(
+	          &compressor,
+	          11,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compressor_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressor != NULL )
+	{
+		assorted_deflate_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_compressor_find_tree_matches function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_compressor_find_tree_matches(
+     void )
+{
+	uint32_t matches[ 32 ];
+
+	uint8_t data[ 12 ] = {
+		'a', 'b', 'c', 'd', 'a', 'b', 'c', 'd', 'a', 'b', 'c', 'd' };
+
+	assorted_deflate_compressor_t *compressor = NULL;
+	libcerror_error_t *error                  = NULL;
+	size_t data_offset                        = 0;
+	uint8_t number_of_matches                 = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_deflate_compressor_initialize(
+	          &compressor,
+	          10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( data_offset = 0;
+	     data_offset < 4;
+	     data_offset++ )
+	{
+		result = assorted_deflate_compressor_find_tree_matches(
+		          compressor,
+		          data,
+		          12,
+		          data_offset,
+		          NULL,
+		          &number_of_matches,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "number_of_matches",
+		 number_of_matches,
+		 0 );
+	}
+	result = assorted_deflate_compressor_find_tree_matches(
+	          compressor,
+	          data,
+	          12,
+	          4,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_matches",
+	 number_of_matches,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "matches[ 0 ]",
+	 matches[ 0 ],
+	 (uint32_t) ( ( 8 << 16 ) | 4 ) );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_compressor_find_tree_matches(
+	          NULL,
+	          data,
+	          12,
+	          5,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compressor_find_tree_matches(
+	          compressor,
+	          NULL,
+	          12,
+	          5,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compressor_find_tree_matches(
+	          compressor,
+	          data,
+	          12,
+	          12,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compressor_find_tree_matches(
+	          compressor,
+	          data,
+	          12,
+	          5,
+	          matches,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_deflate_compressor_free(
+	          &compressor,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressor != NULL )
+	{
+		assorted_deflate_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_compressor_get_block_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_compressor_get_block_size(
+     void )
+{
+	uint32_t distances_frequencies[ 30 ];
+	uint32_t literals_frequencies[ 286 ];
+
+	libcerror_error_t *error = NULL;
+	uint64_t block_size      = 0;
+	uint16_t symbol          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * Every byte value once is smallest as an uncompressed block
+	 */
+	for( symbol = 0;
+	     symbol < 286;
+	     symbol++ )
+	{
+		literals_frequencies[ symbol ] = ( symbol < 256 ) ? 1 : 0;
+	}
+	for( symbol = 0;
+	     symbol < 30;
+	     symbol++ )
+	{
+		distances_frequencies[ symbol ] = 0;
+	}
+	result = assorted_deflate_compressor_get_block_size(
+	          literals_frequencies,
+	          distances_frequencies,
+	          256,
+	          &block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "block_size",
+	 block_size,
+	 (uint64_t) ( 3 + 32 + ( 256 * 8 ) ) );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A single repeated byte value is smaller as a compressed block
+	 */
+	for( symbol = 0;
+	     symbol < 256;
+	     symbol++ )
+	{
+		literals_frequencies[ symbol ] = ( symbol == 'A' ) ? 256 : 0;
+	}
+	result = assorted_deflate_compressor_get_block_size(
+	          literals_frequencies,
+	          distances_frequencies,
+	          256,
+	          &block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+	 "block_size",
+	 block_size,
+	 (uint64_t) ( 3 + 32 + ( 256 * 8 ) ) );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_compressor_get_block_size(
+	          NULL,
+	          distances_frequencies,
+	          256,
+	          &block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compressor_get_block_size(
+	          literals_frequencies,
+	          NULL,
+	          256,
+	          &block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compressor_get_block_size(
+	          literals_frequencies,
+	          distances_frequencies,
+	          256,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_compress_with_dictionary function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_compress_with_dictionary(
+     void )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t first_data_size        = 0;
+	size_t uncompressed_data_size = 0;
+	int compression_level         = 0;
+	int result                    = 0;
+
+	/* Test regular cases where the second part uses the first part as preset dictionary
+	 */
+	for( compression_level = 0;
+	     compression_level <= 10;
+	     compression_level++ )
+	{
+		first_data_size = 8192;
+
+		result = assorted_deflate_compress_with_dictionary(
+		          assorted_test_deflate_uncompressed_data,
+		          4096,
+		          0,
+		          compression_level,
+		          0,
+		          compressed_data,
+		          &first_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_data_size = 8192 - first_data_size;
+
+		result = assorted_deflate_compress_with_dictionary(
+		          assorted_test_deflate_uncompressed_data,
+		          7640,
+		          4096,
+		          compression_level,
+		          1,
+		          &( compressed_data[ first_data_size ] ),
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_data_size  += first_data_size;
+		uncompressed_data_size = 8192;
+
+		result = assorted_deflate_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          NULL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_data,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	compressed_data_size = 8192;
+
+	result = assorted_deflate_compress_with_dictionary(
+	          NULL,
+	          7640,
+	          4096,
+	          -1,
+	          1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compress_with_dictionary(
+	          assorted_test_deflate_uncompressed_data,
+	          4096,
+	          4097,
+	          -1,
+	          1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_compress(
+     void )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t compressed_data_size     = 0;
+	size_t level9_compressed_size   = 0;
+	size_t uncompressed_data_size   = 0;
+	int compression_level           = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	for( compression_level = -1;
+	     compression_level <= 10;
+	     compression_level++ )
+	{
+		compressed_data_size = 8192;
+
+		result = assorted_deflate_compress(
+		          assorted_test_deflate_uncompressed_data,
+		          7640,
+		          compression_level,
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( compression_level != 0 )
+		{
+			ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+			 "compressed_data_size",
+			 (uint64_t) compressed_data_size,
+			 (uint64_t) 7640 );
+		}
+		/* Optimal parsing should not result in larger compressed data than lazy matching
+		 */
+		if( compression_level == 9 )
+		{
+			level9_compressed_size = compressed_data_size;
+		}
+		else if( compression_level == 10 )
+		{
+			ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+			 "compressed_data_size",
+			 (uint64_t) compressed_data_size,
+			 (uint64_t) level9_compressed_size + 1 );
+		}
+		uncompressed_data_size = 8192;
+
+		result = assorted_deflate_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          NULL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_data,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test with empty uncompressed data
+	 */
+	compressed_data_size = 8192;
+
+	result = assorted_deflate_compress(
+	          assorted_test_deflate_uncompressed_data,
+	          0,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 8192;
+
+	result = assorted_deflate_compress(
+	          NULL,
+	          7640,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compress(
+	          assorted_test_deflate_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compress(
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          11,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compress(
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          -1,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compress(
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          -1,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	compressed_data_size = 64;
+
+	result = assorted_deflate_compress(
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_compress_zlib function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_compress_zlib(
+     void )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 8192;
+	size_t uncompressed_data_size = 8192;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_compress_zlib(
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 0 ]",
+	 compressed_data[ 0 ],
+	 0x78 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 1 ]",
+	 compressed_data[ 1 ],
+	 0x9c );
+
+	result = assorted_deflate_decompress_zlib(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_data,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 8192;
+
+	result = assorted_deflate_compress_zlib(
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          -1,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compress_zlib(
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          -1,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 5;
+
+	result = assorted_deflate_compress_zlib(
+	          assorted_test_deflate_uncompressed_data,
+	          7640,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_compress_zlib_with_dictionary function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_compress_zlib_with_dictionary(
+     void )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 8192;
+	size_t uncompressed_data_size = 8192;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_compress_zlib_with_dictionary(
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          &( assorted_test_deflate_uncompressed_data[ 2048 ] ),
+	          7640 - 2048,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 0 ]",
+	 compressed_data[ 0 ],
+	 0x78 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 1 ]",
+	 compressed_data[ 1 ],
+	 0xbb );
+
+	result = assorted_deflate_decompress_zlib_with_dictionary(
+	          compressed_data,
+	          compressed_data_size,
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ( 7640 - 2048 ) );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          &( assorted_test_deflate_uncompressed_data[ 2048 ] ),
+	          7640 - 2048 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 8192;
+
+	result = assorted_deflate_compress_zlib_with_dictionary(
+	          NULL,
+	          2048,
+	          &( assorted_test_deflate_uncompressed_data[ 2048 ] ),
+	          7640 - 2048,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compress_zlib_with_dictionary(
+	          assorted_test_deflate_uncompressed_data,
+	          0,
+	          &( assorted_test_deflate_uncompressed_data[ 2048 ] ),
+	          7640 - 2048,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_compress_zlib_with_dictionary(
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          NULL,
+	          7640 - 2048,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 9;
+
+	result = assorted_deflate_compress_zlib_with_dictionary(
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          &( assorted_test_deflate_uncompressed_data[ 2048 ] ),
+	          7640 - 2048,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_read_gzip_member_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_read_gzip_member_header(
+     void )
+{
+	uint8_t member_header_data[ 27 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	size_t member_size            = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_member_header_data,
+	          27,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 27 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_size",
+	 member_size,
+	 (size_t) 2656 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 0;
+
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_basic_member_header_data,
+	          10,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 10 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_size",
+	 member_size,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an incomplete member header
+	 */
+	compressed_data_offset = 0;
+
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_member_header_data,
+	          26,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_member_header_data,
+	          20,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_member_header_data,
+	          9,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_read_gzip_member_header(
+	          NULL,
+	          27,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_member_header_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_member_header_data,
+	          27,
+	          NULL,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_member_header_data,
+	          27,
+	          &compressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_offset = 28;
+
+	result = assorted_deflate_read_gzip_member_header(
+	          assorted_test_deflate_gzip_member_header_data,
+	          27,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	memory_copy(
+	 member_header_data,
+	 assorted_test_deflate_gzip_member_header_data,
+	 27 );
+
+	member_header_data[ 1 ] = 0xff;
+
+	compressed_data_offset = 0;
+
+	result = assorted_deflate_read_gzip_member_header(
+	          member_header_data,
+	          27,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported compression method
+	 */
+	memory_copy(
+	 member_header_data,
+	 assorted_test_deflate_gzip_member_header_data,
+	 27 );
+
+	member_header_data[ 2 ] = 0x07;
+
+	result = assorted_deflate_read_gzip_member_header(
+	          member_header_data,
+	          27,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a header checksum mismatch
+	 */
+	memory_copy(
+	 member_header_data,
+	 assorted_test_deflate_gzip_member_header_data,
+	 27 );
+
+	member_header_data[ 26 ] ^= 0xff;
+
+	result = assorted_deflate_read_gzip_member_header(
+	          member_header_data,
+	          27,
+	          &compressed_data_offset,
+	          &member_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_read_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_read_block_header(
+     void )
+{
+	assorted_bit_stream_t *bit_stream = NULL;
+	libcerror_error_t *error          = NULL;
+	uint8_t block_type                = 0;
+	uint8_t last_block_flag           = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          2,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_read_block_header(
+	          bit_stream,
+	          &block_type,
+	          &last_block_flag,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          2,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_read_block_header(
+	          NULL,
+	          &block_type,
+	          &last_block_flag,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_block_header(
+	          bit_stream,
+	          NULL,
+	          &last_block_flag,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_block_header(
+	          bit_stream,
+	          &block_type,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_read_block function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_read_block(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	assorted_bit_stream_t *bit_stream             = NULL;
+	assorted_huffman_tree_t *fixed_distances_tree = NULL;
+	assorted_huffman_tree_t *fixed_literals_tree  = NULL;
+	libcerror_error_t *error                      = NULL;
+	size_t uncompressed_data_offset               = 0;
+	size_t uncompressed_data_size                 = 7640;
+	uint8_t block_type                            = 0;
+	uint8_t last_block_flag                       = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          2,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_huffman_tree_initialize(
+	          &fixed_literals_tree,
+	          288,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "fixed_literals_tree",
+	 fixed_literals_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_huffman_tree_initialize(
+	          &fixed_distances_tree,
+	          30,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "fixed_distances_tree",
+	 fixed_distances_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_build_fixed_huffman_trees(
+	          fixed_literals_tree,
+	          fixed_distances_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_read_block_header(
+	          bit_stream,
+	          &block_type,
+	          &last_block_flag,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_read_block(
+	          bit_stream,
+	          block_type,
+	          fixed_literals_tree,
+	          fixed_distances_tree,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          &uncompressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+/* TODO: test uncompressed data too small */
+
+	/* Clean up
+	 */
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          2,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_read_block(
+	          NULL,
+	          block_type,
+	          fixed_literals_tree,
+	          fixed_distances_tree,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          &uncompressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_block(
+	          bit_stream,
+	          block_type,
+	          fixed_literals_tree,
+	          fixed_distances_tree,
+	          NULL,
+	          uncompressed_data_size,
+	          &uncompressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_block(
+	          bit_stream,
+	          block_type,
+	          fixed_literals_tree,
+	          fixed_distances_tree,
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_block(
+	          bit_stream,
+	          block_type,
+	          fixed_literals_tree,
+	          fixed_distances_tree,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_read_block(
+	          bit_stream,
+	          block_type,
+	          fixed_literals_tree,
+	          fixed_distances_tree,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          &uncompressed_data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_huffman_tree_free(
+	          &fixed_distances_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "fixed_distances_tree",
+	 fixed_distances_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_huffman_tree_free(
+	          &fixed_literals_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "fixed_literals_tree",
+	 fixed_literals_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( fixed_distances_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &fixed_distances_tree,
+		 NULL );
+	}
+	if( fixed_literals_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &fixed_literals_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	assorted_deflate_statistics_t statistics;
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 8192;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_decompress(
+	          &( assorted_test_deflate_compressed_data[ 2 ] ),
+	          2627 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_data,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_set(
+	 &statistics,
+	 0,
+	 sizeof( assorted_deflate_statistics_t ) );
+
+	uncompressed_data_size = 8192;
+
+	result = assorted_deflate_decompress(
+	          &( assorted_test_deflate_compressed_data[ 2 ] ),
+	          2627 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &statistics,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_DECODE_STATISTICS )
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_dynamic_huffman_blocks",
+	 statistics.number_of_dynamic_huffman_blocks,
+	 (uint64_t) 1 );
+
+	ASSORTED_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics.number_of_matches",
+	 (int64_t) statistics.number_of_matches,
+	 (int64_t) 0 );
+#else
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_dynamic_huffman_blocks",
+	 statistics.number_of_dynamic_huffman_blocks,
+	 (uint64_t) 0 );
+#endif
+
+/* TODO: test uncompressed data too small */
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_decompress(
+	          NULL,
+	          2627 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress(
+	          &( assorted_test_deflate_compressed_data[ 2 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress(
+	          &( assorted_test_deflate_compressed_data[ 2 ] ),
+	          2627 - 6,
+	          NULL,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress(
+	          &( assorted_test_deflate_compressed_data[ 2 ] ),
+	          2627 - 6,
+	          uncompressed_data,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_decompress_with_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress_with_arena(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	assorted_arena_t *arena       = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 8192;
+	int iteration                 = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first iteration uses overflow blocks, the second the grown slab
+	 */
+	for( iteration = 0;
+	     iteration < 2;
+	     iteration++ )
+	{
+		uncompressed_data_size = 8192;
+
+		result = assorted_deflate_decompress_with_arena(
+		          &( assorted_test_deflate_compressed_data[ 2 ] ),
+		          2627 - 6,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          NULL,
+		          arena,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_data,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "arena->data_offset",
+		 arena->data_offset,
+		 (size_t) 0 );
+
+		if( iteration > 0 )
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "arena->number_of_overflow_blocks",
+			 arena->number_of_overflow_blocks,
+			 0 );
+		}
+		result = assorted_arena_reset(
+		          arena,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = assorted_deflate_decompress_with_arena(
+	          NULL,
+	          2627 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          arena,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_arena_free(
+	          &arena,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		assorted_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_decompress_zlib function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress_zlib(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 7640;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_data,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+/* TODO: test uncompressed data too small */
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_decompress_zlib(
+	          NULL,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress_zlib(
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_decompress_zlib_with_dictionary function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress_zlib_with_dictionary(
+     void )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 8192;
+	size_t uncompressed_data_size = 8192;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_deflate_compress_zlib_with_dictionary(
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          &( assorted_test_deflate_uncompressed_data[ 2048 ] ),
+	          7640 - 2048,
+	          6,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_decompress_zlib_with_dictionary(
+	          compressed_data,
+	          compressed_data_size,
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ( 7640 - 2048 ) );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          &( assorted_test_deflate_uncompressed_data[ 2048 ] ),
+	          7640 - 2048 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data that does not require a preset dictionary
+	 */
+	uncompressed_data_size = 8192;
+
+	result = assorted_deflate_decompress_zlib_with_dictionary(
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 8192;
+
+	result = assorted_deflate_decompress_zlib(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 8192;
+
+	result = assorted_deflate_decompress_zlib_with_dictionary(
+	          compressed_data,
+	          compressed_data_size,
+	          assorted_test_deflate_uncompressed_data,
+	          2047,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress_zlib_with_dictionary(
+	          compressed_data,
+	          compressed_data_size,
+	          NULL,
+	          2048,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_decompress_gzip function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress_gzip(
+     void )
+{
+	uint8_t gzip_data[ ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE ];
+	uint8_t uncompressed_data[ 16384 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 16384;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	assorted_test_deflate_build_gzip_data(
+	 gzip_data );
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_decompress_gzip(
+	          gzip_data,
+	          ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ( 2 * 7640 ) );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_data,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( uncompressed_data[ 7640 ] ),
+	          assorted_test_deflate_uncompressed_data,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 16384;
+
+	result = assorted_deflate_decompress_gzip(
+	          NULL,
+	          ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress_gzip(
+	          gzip_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress_gzip(
+	          gzip_data,
+	          ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_decompress_gzip(
+	          gzip_data,
+	          ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a truncated member footer
+	 */
+	result = assorted_deflate_decompress_gzip(
+	          gzip_data,
+	          ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE - 5,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with uncompressed data too small
+	 */
+	uncompressed_data_size = 8192;
+
+	result = assorted_deflate_decompress_gzip(
+	          gzip_data,
+	          ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a checksum mismatch
+	 */
+	uncompressed_data_size = 16384;
+
+	gzip_data[ 27 + 2621 ] ^= 0xff;
+
+	result = assorted_deflate_decompress_gzip(
+	          gzip_data,
+	          ASSORTED_TEST_DEFLATE_GZIP_DATA_SIZE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_context_initialize(
+     void )
+{
+	assorted_deflate_context_t *context = NULL;
+	libcerror_error_t *error            = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_context_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (assorted_deflate_context_t *) 0x12345678UL;
+
+	result = assorted_deflate_context_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_deflate_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_context_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_context_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_context_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	assorted_deflate_context_t *context = NULL;
+	libcerror_error_t *error            = NULL;
+	size_t uncompressed_data_size       = 0;
+	int iteration                       = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_deflate_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * After the first stream the scratch memory fits in the slab of the arena
+	 */
+	for( iteration = 0;
+	     iteration < 3;
+	     iteration++ )
+	{
+		uncompressed_data_size = 8192;
+
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+		assorted_test_memory_reset_statistics();
+#endif
+		result = assorted_deflate_context_decompress(
+		          context,
+		          &( assorted_test_deflate_compressed_data[ 2 ] ),
+		          2627 - 6,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          NULL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_data,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( iteration > 0 )
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "context->arena->number_of_overflow_blocks",
+			 context->arena->number_of_overflow_blocks,
+			 0 );
+		}
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+		/* The slab of the arena is grown by the reset of the second stream
+		 */
+		if( iteration == 0 )
+		{
+			assorted_test_memory_statistics_fprint(
+			 stdout,
+			 "assorted_deflate_context_decompress first stream" );
+		}
+		else if( iteration == 2 )
+		{
+			assorted_test_memory_statistics_fprint(
+			 stdout,
+			 "assorted_deflate_context_decompress reused context" );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "assorted_test_memory_number_of_allocations",
+			 assorted_test_memory_number_of_allocations,
+			 (uint64_t) 0 );
+		}
+#endif
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 8192;
+
+	result = assorted_deflate_context_decompress(
+	          NULL,
+	          &( assorted_test_deflate_compressed_data[ 2 ] ),
+	          2627 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_context_decompress(
+	          context,
+	          NULL,
+	          2627 - 6,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_deflate_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_deflate_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_context_decompress_zlib function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_context_decompress_zlib(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	assorted_deflate_context_t *context = NULL;
+	libcerror_error_t *error            = NULL;
+	size_t uncompressed_data_size       = 0;
+	int iteration                       = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_deflate_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * After the first stream the scratch memory fits in the slab of the arena
+	 */
+	for( iteration = 0;
+	     iteration < 3;
+	     iteration++ )
+	{
+		uncompressed_data_size = 8192;
+
+		result = assorted_deflate_context_decompress_zlib(
+		          context,
+		          assorted_test_deflate_compressed_data,
+		          2627,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_data,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( iteration > 0 )
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "context->arena->number_of_overflow_blocks",
+			 context->arena->number_of_overflow_blocks,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 8192;
+
+	result = assorted_deflate_context_decompress_zlib(
+	          NULL,
+	          assorted_test_deflate_compressed_data,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_context_decompress_zlib(
+	          context,
+	          NULL,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_deflate_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2053,51 +5874,37 @@ int assorted_test_deflate_read_block(
 	return( 1 );
 
 on_error:
-	if( fixed_distances_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &fixed_distances_tree,
-		 NULL );
-	}
-	if( fixed_literals_tree != NULL )
-	{
-		assorted_huffman_tree_free(
-		 &fixed_literals_tree,
-		 NULL );
-	}
-	if( bit_stream != NULL )
-	{
-		assorted_bit_stream_free(
-		 &bit_stream,
-		 NULL );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
 		 &error );
 	}
+	if( context != NULL )
+	{
+		assorted_deflate_context_free(
+		 &context,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the assorted_deflate_decompress function
+/* Tests the assorted_deflate_dictionary_initialize function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_deflate_decompress(
+int assorted_test_deflate_dictionary_initialize(
      void )
 {
-	uint8_t uncompressed_data[ 8192 ];
-
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 8192;
-	int result                    = 0;
+	assorted_deflate_dictionary_t *dictionary = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
 
 	/* Test regular cases
 	 */
-	result = assorted_deflate_decompress(
-	          &( assorted_test_deflate_compressed_data[ 2 ] ),
-	          2627 - 6,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	result = assorted_deflate_dictionary_initialize(
+	          &dictionary,
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          -1,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2105,34 +5912,48 @@ int assorted_test_deflate_decompress(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 7640 );
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "dictionary",
+	 dictionary );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = memory_compare(
-	          uncompressed_data,
-	          assorted_test_deflate_uncompressed_data,
-	          7640 );
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "dictionary->dictionary_size",
+	 dictionary->dictionary_size,
+	 (size_t) 2048 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "dictionary->compressor->hashed_dictionary_size",
+	 dictionary->compressor->hashed_dictionary_size,
+	 (size_t) ( 2048 - 258 ) );
+
+	result = assorted_deflate_dictionary_free(
+	          &dictionary,
+	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-/* TODO: test uncompressed data too small */
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "dictionary",
+	 dictionary );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = assorted_deflate_decompress(
+	result = assorted_deflate_dictionary_initialize(
 	          NULL,
-	          2627 - 6,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          -1,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2147,13 +5968,17 @@ int assorted_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_decompress(
-	          &( assorted_test_deflate_compressed_data[ 2 ] ),
-	          (size_t) SSIZE_MAX + 1,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	dictionary = (assorted_deflate_dictionary_t *) 0x12345678UL;
+
+	result = assorted_deflate_dictionary_initialize(
+	          &dictionary,
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          -1,
 	          &error );
 
+	dictionary = NULL;
+
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -2166,11 +5991,11 @@ int assorted_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_decompress(
-	          &( assorted_test_deflate_compressed_data[ 2 ] ),
-	          2627 - 6,
+	result = assorted_deflate_dictionary_initialize(
+	          &dictionary,
 	          NULL,
-	          &uncompressed_data_size,
+	          2048,
+	          -1,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2185,11 +6010,11 @@ int assorted_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_deflate_decompress(
-	          &( assorted_test_deflate_compressed_data[ 2 ] ),
-	          2627 - 6,
-	          uncompressed_data,
-	          NULL,
+	result = assorted_deflate_dictionary_initialize(
+	          &dictionary,
+	          assorted_test_deflate_uncompressed_data,
+	          2048,
+	          11,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2197,6 +6022,10 @@ int assorted_test_deflate_decompress(
 	 result,
 	 -1 );
 
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "dictionary",
+	 dictionary );
+
 	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2212,120 +6041,244 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( dictionary != NULL )
+	{
+		assorted_deflate_dictionary_free(
+		 &dictionary,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the assorted_deflate_decompress_zlib function
+/* Tests the assorted_deflate_dictionary_compress_zlib function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_deflate_decompress_zlib(
+int assorted_test_deflate_dictionary_compress_zlib(
      void )
 {
+	uint8_t compressed_data[ 8192 ];
+	uint8_t expected_compressed_data[ 8192 ];
 	uint8_t uncompressed_data[ 8192 ];
 
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 7640;
-	int result                    = 0;
+	size_t record_offsets[ 4 ]                = { 2048, 3048, 5048, 7640 };
+	int compression_levels[ 4 ]               = { 0, 1, 6, 10 };
+
+	assorted_deflate_dictionary_t *dictionary = NULL;
+	libcerror_error_t *error                  = NULL;
+	size_t compressed_data_size               = 0;
+	size_t expected_compressed_data_size      = 0;
+	size_t record_size                        = 0;
+	size_t uncompressed_data_size             = 0;
+	int level_index                           = 0;
+	int record_index                          = 0;
+	int result                                = 0;
 
 	/* Test regular cases
+	 * Records compressed with the same dictionary, of which the hash tables are reused,
+	 * are expected to be identical to records compressed with a new dictionary
 	 */
-	result = assorted_deflate_decompress_zlib(
-	          assorted_test_deflate_compressed_data,
-	          2627,
-	          uncompressed_data,
-	          &uncompressed_data_size,
-	          &error );
+	for( level_index = 0;
+	     level_index < 4;
+	     level_index++ )
+	{
+		result = assorted_deflate_dictionary_initialize(
+		          &dictionary,
+		          assorted_test_deflate_uncompressed_data,
+		          2048,
+		          compression_levels[ level_index ],
+		          &error );
 
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 7640 );
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	ASSORTED_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		/* A failed record is not expected to affect the records that follow
+		 */
+		compressed_data_size = 16;
+
+		result = assorted_deflate_dictionary_compress_zlib(
+		          dictionary,
+		          &( assorted_test_deflate_uncompressed_data[ 5048 ] ),
+		          7640 - 5048,
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
 
-	result = memory_compare(
-	          uncompressed_data,
-	          assorted_test_deflate_uncompressed_data,
-	          7640 );
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-/* TODO: test uncompressed data too small */
+		libcerror_error_free(
+		 &error );
 
-	/* Test error cases
-	 */
-	result = assorted_deflate_decompress_zlib(
-	          NULL,
-	          2627,
-	          uncompressed_data,
-	          &uncompressed_data_size,
-	          &error );
+		for( record_index = 0;
+		     record_index < 3;
+		     record_index++ )
+		{
+			record_size = record_offsets[ record_index + 1 ] - record_offsets[ record_index ];
 
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+			compressed_data_size = 8192;
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			result = assorted_deflate_dictionary_compress_zlib(
+			          dictionary,
+			          &( assorted_test_deflate_uncompressed_data[ record_offsets[ record_index ] ] ),
+			          record_size,
+			          compressed_data,
+			          &compressed_data_size,
+			          &error );
 
-	libcerror_error_free(
-	 &error );
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	result = assorted_deflate_decompress_zlib(
-	          assorted_test_deflate_compressed_data,
-	          (size_t) SSIZE_MAX + 1,
-	          uncompressed_data,
-	          &uncompressed_data_size,
-	          &error );
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
 
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+			expected_compressed_data_size = 8192;
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			result = assorted_deflate_compress_zlib_with_dictionary(
+			          assorted_test_deflate_uncompressed_data,
+			          2048,
+			          &( assorted_test_deflate_uncompressed_data[ record_offsets[ record_index ] ] ),
+			          record_size,
+			          compression_levels[ level_index ],
+			          expected_compressed_data,
+			          &expected_compressed_data_size,
+			          &error );
 
-	libcerror_error_free(
-	 &error );
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	result = assorted_deflate_decompress_zlib(
-	          assorted_test_deflate_compressed_data,
-	          2627,
-	          NULL,
-	          &uncompressed_data_size,
-	          &error );
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
 
-	ASSORTED_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "compressed_data_size",
+			 compressed_data_size,
+			 expected_compressed_data_size );
 
-	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			result = memory_compare(
+			          compressed_data,
+			          expected_compressed_data,
+			          compressed_data_size );
 
-	libcerror_error_free(
-	 &error );
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			/* The first record directly follows the dictionary in the test data
+			 */
+			if( record_index == 0 )
+			{
+				expected_compressed_data_size = 8192;
+
+				result = assorted_deflate_compress_with_dictionary(
+				          assorted_test_deflate_uncompressed_data,
+				          record_offsets[ 1 ],
+				          2048,
+				          compression_levels[ level_index ],
+				          1,
+				          expected_compressed_data,
+				          &expected_compressed_data_size,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ASSORTED_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+				 "expected_compressed_data_size",
+				 expected_compressed_data_size,
+				 compressed_data_size - 10 );
+
+				result = memory_compare(
+				          &( compressed_data[ 6 ] ),
+				          expected_compressed_data,
+				          expected_compressed_data_size );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+			uncompressed_data_size = 8192;
+
+			result = assorted_deflate_dictionary_decompress_zlib(
+			          dictionary,
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          &error );
 
-	result = assorted_deflate_decompress_zlib(
-	          assorted_test_deflate_compressed_data,
-	          2627,
-	          uncompressed_data,
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "uncompressed_data_size",
+			 uncompressed_data_size,
+			 record_size );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          uncompressed_data,
+			          &( assorted_test_deflate_uncompressed_data[ record_offsets[ record_index ] ] ),
+			          record_size );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = assorted_deflate_dictionary_free(
+		          &dictionary,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	compressed_data_size = 8192;
+
+	result = assorted_deflate_dictionary_compress_zlib(
 	          NULL,
+	          &( assorted_test_deflate_uncompressed_data[ 2048 ] ),
+	          1000,
+	          compressed_data,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -2348,6 +6301,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( dictionary != NULL )
+	{
+		assorted_deflate_dictionary_free(
+		 &dictionary,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2386,6 +6345,14 @@ int main(
 	 "assorted_deflate_build_fixed_huffman_trees",
 	 assorted_test_deflate_build_fixed_huffman_trees );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_copy_match",
+	 assorted_test_deflate_copy_match );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_decode_huffman_fast",
+	 assorted_test_deflate_decode_huffman_fast );
+
 	ASSORTED_TEST_RUN(
 	 "assorted_deflate_decode_huffman",
 	 assorted_test_deflate_decode_huffman );
@@ -2394,8 +6361,44 @@ int main(
 	 "assorted_deflate_calculate_adler32",
 	 assorted_test_deflate_calculate_adler32 );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_compressor_initialize",
+	 assorted_test_deflate_compressor_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_compressor_find_tree_matches",
+	 assorted_test_deflate_compressor_find_tree_matches );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_compressor_get_block_size",
+	 assorted_test_deflate_compressor_get_block_size );
+
+/* TODO add tests for assorted_deflate_compressor_add_dictionary */
+
+/* TODO add tests for assorted_deflate_compressor_compress */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_compress_with_dictionary",
+	 assorted_test_deflate_compress_with_dictionary );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_compress",
+	 assorted_test_deflate_compress );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_compress_zlib",
+	 assorted_test_deflate_compress_zlib );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_compress_zlib_with_dictionary",
+	 assorted_test_deflate_compress_zlib_with_dictionary );
+
 /* TODO add tests for assorted_deflate_read_data_header */
 
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_read_gzip_member_header",
+	 assorted_test_deflate_read_gzip_member_header );
+
 	ASSORTED_TEST_RUN(
 	 "assorted_deflate_read_block_header",
 	 assorted_test_deflate_read_block_header );
@@ -2408,10 +6411,52 @@ int main(
 	 "assorted_deflate_decompress",
 	 assorted_test_deflate_decompress );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_decompress_with_arena",
+	 assorted_test_deflate_decompress_with_arena );
+
 	ASSORTED_TEST_RUN(
 	 "assorted_deflate_decompress_zlib",
 	 assorted_test_deflate_decompress_zlib );
 
+/* TODO add tests for assorted_deflate_decompress_zlib_with_preset_dictionary */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_decompress_zlib_with_dictionary",
+	 assorted_test_deflate_decompress_zlib_with_dictionary );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_decompress_gzip",
+	 assorted_test_deflate_decompress_gzip );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_context_initialize",
+	 assorted_test_deflate_context_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_context_free",
+	 assorted_test_deflate_context_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_context_decompress",
+	 assorted_test_deflate_context_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_context_decompress_zlib",
+	 assorted_test_deflate_context_decompress_zlib );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_dictionary_initialize",
+	 assorted_test_deflate_dictionary_initialize );
+
+/* TODO add tests for assorted_deflate_dictionary_resize_data */
+
+/* TODO add tests for assorted_deflate_dictionary_restore_compressor */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_dictionary_compress_zlib",
+	 assorted_test_deflate_dictionary_compress_zlib );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
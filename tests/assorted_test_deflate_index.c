@@ -0,0 +1,1203 @@
+/*
+ * Deflate checkpoint index testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_memory.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_deflate_index.h"
+
+/* Define to make assorted_test_deflate_index generate verbose output
+#define ASSORTED_TEST_DEFLATE_INDEX_VERBOSE
+ */
+
+uint8_t assorted_test_deflate_index_window[ 16 ] = {
+	0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20 };
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_deflate_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_initialize(
+     void )
+{
+	assorted_deflate_index_t *index = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_index_initialize(
+	          &index,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	result = assorted_deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_index_initialize(
+	          NULL,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index = (assorted_deflate_index_t *) 0x12345678UL;
+
+	result = assorted_deflate_index_initialize(
+	          &index,
+	          1024,
+	          &error );
+
+	index = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_initialize(
+	          &index,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test assorted_deflate_index_initialize with malloc failing
+		 */
+		assorted_test_malloc_attempts_before_fail = test_number;
+
+		result = assorted_deflate_index_initialize(
+		          &index,
+		          1024,
+		          &error );
+
+		if( assorted_test_malloc_attempts_before_fail != -1 )
+		{
+			assorted_test_malloc_attempts_before_fail = -1;
+
+			if( index != NULL )
+			{
+				assorted_deflate_index_free(
+				 &index,
+				 NULL );
+			}
+		}
+		else
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "index",
+			 index );
+
+			ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test assorted_deflate_index_initialize with memset failing
+		 */
+		assorted_test_memset_attempts_before_fail = test_number;
+
+		result = assorted_deflate_index_initialize(
+		          &index,
+		          1024,
+		          &error );
+
+		if( assorted_test_memset_attempts_before_fail != -1 )
+		{
+			assorted_test_memset_attempts_before_fail = -1;
+
+			if( index != NULL )
+			{
+				assorted_deflate_index_free(
+				 &index,
+				 NULL );
+			}
+		}
+		else
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "index",
+			 index );
+
+			ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ASSORTED_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		assorted_deflate_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_index_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_index_append_checkpoint function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_append_checkpoint(
+     void )
+{
+	assorted_deflate_index_t *index = NULL;
+	libcerror_error_t *error        = NULL;
+	uint64_t checkpoint_offset      = 0;
+	uint32_t checkpoint_index       = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_deflate_index_initialize(
+	          &index,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          16,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test appending more checkpoints than initially allocated
+	 */
+	for( checkpoint_index = 1;
+	     checkpoint_index < 40;
+	     checkpoint_index++ )
+	{
+		checkpoint_offset = (uint64_t) checkpoint_index * 1024;
+
+		result = assorted_deflate_index_append_checkpoint(
+		          index,
+		          checkpoint_offset * 2,
+		          checkpoint_offset,
+		          assorted_test_deflate_index_window,
+		          16,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "index->number_of_checkpoints",
+	 index->number_of_checkpoints,
+	 (uint32_t) 40 );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_index_append_checkpoint(
+	          NULL,
+	          131072,
+	          65536,
+	          assorted_test_deflate_index_window,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          131072,
+	          65536,
+	          NULL,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          131072,
+	          65536,
+	          assorted_test_deflate_index_window,
+	          ASSORTED_DEFLATE_INDEX_WINDOW_SIZE + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an uncompressed offset that is not after that of the last checkpoint
+	 */
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          131072,
+	          1024,
+	          assorted_test_deflate_index_window,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		assorted_deflate_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_index_get_checkpoint_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_get_checkpoint_by_offset(
+     void )
+{
+	assorted_deflate_checkpoint_t *checkpoint = NULL;
+	assorted_deflate_index_t *index           = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_deflate_index_initialize(
+	          &index,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_index_get_checkpoint_by_offset(
+	          index,
+	          0,
+	          &checkpoint,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          16,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          8000,
+	          2048,
+	          assorted_test_deflate_index_window,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          16000,
+	          4096,
+	          assorted_test_deflate_index_window,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_get_checkpoint_by_offset(
+	          index,
+	          0,
+	          &checkpoint,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint->uncompressed_offset",
+	 checkpoint->uncompressed_offset,
+	 (uint64_t) 0 );
+
+	result = assorted_deflate_index_get_checkpoint_by_offset(
+	          index,
+	          4095,
+	          &checkpoint,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint->uncompressed_offset",
+	 checkpoint->uncompressed_offset,
+	 (uint64_t) 2048 );
+
+	result = assorted_deflate_index_get_checkpoint_by_offset(
+	          index,
+	          1000000,
+	          &checkpoint,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint->compressed_bit_offset",
+	 checkpoint->compressed_bit_offset,
+	 (uint64_t) 16000 );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_index_get_checkpoint_by_offset(
+	          NULL,
+	          0,
+	          &checkpoint,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_get_checkpoint_by_offset(
+	          index,
+	          0,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		assorted_deflate_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_index_write_data and assorted_deflate_index_read_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_read_data(
+     void )
+{
+	uint8_t data[ 128 ];
+
+	assorted_deflate_index_t *index = NULL;
+	libcerror_error_t *error        = NULL;
+	size_t data_size                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_deflate_index_initialize(
+	          &index,
+	          2048,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          16,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_append_checkpoint(
+	          index,
+	          8003,
+	          2048,
+	          assorted_test_deflate_index_window,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_index_get_data_size(
+	          index,
+	          &data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 76 );
+
+	result = assorted_deflate_index_write_data(
+	          index,
+	          data,
+	          128,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_initialize(
+	          &index,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_read_data(
+	          index,
+	          data,
+	          data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "index->spacing",
+	 index->spacing,
+	 (uint64_t) 2048 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "index->number_of_checkpoints",
+	 index->number_of_checkpoints,
+	 (uint32_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "index->checkpoints[ 1 ].compressed_bit_offset",
+	 index->checkpoints[ 1 ].compressed_bit_offset,
+	 (uint64_t) 8003 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "index->checkpoints[ 1 ].window_size",
+	 index->checkpoints[ 1 ].window_size,
+	 (uint32_t) 16 );
+
+	result = memory_compare(
+	          index->checkpoints[ 1 ].window,
+	          assorted_test_deflate_index_window,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_index_write_data(
+	          NULL,
+	          data,
+	          128,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_write_data(
+	          index,
+	          NULL,
+	          128,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_write_data(
+	          index,
+	          data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_get_data_size(
+	          index,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading data into an index that contains checkpoints
+	 */
+	result = assorted_deflate_index_read_data(
+	          index,
+	          data,
+	          data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_initialize(
+	          &index,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_deflate_index_read_data(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_index_read_data(
+	          index,
+	          NULL,
+	          data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading truncated data
+	 */
+	result = assorted_deflate_index_read_data(
+	          index,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "index->number_of_checkpoints",
+	 index->number_of_checkpoints,
+	 (uint32_t) 0 );
+
+	/* Test reading data with an invalid signature
+	 */
+	data[ 0 ] = 0xff;
+
+	result = assorted_deflate_index_read_data(
+	          index,
+	          data,
+	          data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		assorted_deflate_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_DEFLATE_INDEX_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_index_initialize",
+	 assorted_test_deflate_index_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_index_free",
+	 assorted_test_deflate_index_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_index_append_checkpoint",
+	 assorted_test_deflate_index_append_checkpoint );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_index_get_checkpoint_by_offset",
+	 assorted_test_deflate_index_get_checkpoint_by_offset );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_index_read_data",
+	 assorted_test_deflate_index_read_data );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
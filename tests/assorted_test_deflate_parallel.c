@@ -0,0 +1,2081 @@
+/*
+ * Deflate (zlib) parallel compression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_adler32.h"
+#include "../src/assorted_crc32.h"
+#include "../src/assorted_deflate.h"
+#include "../src/assorted_deflate_parallel.h"
+
+/* Define to make assorted_test_deflate_parallel generate verbose output
+#define ASSORTED_TEST_DEFLATE_PARALLEL_VERBOSE
+ */
+
+/* The size of the test data, 2 full chunks and a partial chunk
+ */
+#define ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE	300000
+
+/* The size of the decompression test data, large enough for multiple decompression chunks
+ */
+#define ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE	1048576
+
+/* Fills the test data with pseudo random words
+ */
+void assorted_test_deflate_parallel_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	uint32_t value     = 1;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		value = ( value * 1103515245UL ) + 12345;
+
+		if( ( ( value >> 16 ) % 6 ) == 0 )
+		{
+			data[ data_offset ] = (uint8_t) ' ';
+		}
+		else
+		{
+			data[ data_offset ] = (uint8_t) ( 'a' + ( ( value >> 20 ) % 8 ) );
+		}
+	}
+}
+
+/* Creates gzip compressed data that consists of multiple members
+ * If add_block_size is set the members contain a BGZF block size extra field
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_test_deflate_parallel_build_gzip_data(
+     const uint8_t *data,
+     size_t data_size,
+     size_t member_data_size,
+     uint8_t add_block_size,
+     uint8_t *gzip_data,
+     size_t *gzip_data_size,
+     libcerror_error_t **error )
+{
+	size_t compressed_data_size  = 0;
+	size_t data_offset           = 0;
+	size_t gzip_data_offset      = 0;
+	size_t header_size           = 0;
+	size_t member_offset         = 0;
+	size_t member_size           = 0;
+	size_t read_size             = 0;
+	uint32_t calculated_checksum = 0;
+
+	while( data_offset < data_size )
+	{
+		read_size = data_size - data_offset;
+
+		if( read_size > member_data_size )
+		{
+			read_size = member_data_size;
+		}
+		member_offset = gzip_data_offset;
+		header_size   = 10;
+
+		if( add_block_size != 0 )
+		{
+			header_size += 8;
+		}
+		if( ( header_size + 8 ) > ( *gzip_data_size - member_offset ) )
+		{
+			return( -1 );
+		}
+		gzip_data[ member_offset ]     = 0x1f;
+		gzip_data[ member_offset + 1 ] = 0x8b;
+		gzip_data[ member_offset + 2 ] = 0x08;
+		gzip_data[ member_offset + 3 ] = 0x00;
+		gzip_data[ member_offset + 4 ] = 0x00;
+		gzip_data[ member_offset + 5 ] = 0x00;
+		gzip_data[ member_offset + 6 ] = 0x00;
+		gzip_data[ member_offset + 7 ] = 0x00;
+		gzip_data[ member_offset + 8 ] = 0x00;
+		gzip_data[ member_offset + 9 ] = 0xff;
+
+		if( add_block_size != 0 )
+		{
+			gzip_data[ member_offset + 3 ]  = 0x04;
+			gzip_data[ member_offset + 10 ] = 0x06;
+			gzip_data[ member_offset + 11 ] = 0x00;
+			gzip_data[ member_offset + 12 ] = 0x42;
+			gzip_data[ member_offset + 13 ] = 0x43;
+			gzip_data[ member_offset + 14 ] = 0x02;
+			gzip_data[ member_offset + 15 ] = 0x00;
+		}
+		gzip_data_offset += header_size;
+
+		compressed_data_size = *gzip_data_size - gzip_data_offset - 8;
+
+		if( assorted_deflate_compress(
+		     &( data[ data_offset ] ),
+		     read_size,
+		     6,
+		     &( gzip_data[ gzip_data_offset ] ),
+		     &compressed_data_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		gzip_data_offset += compressed_data_size;
+
+		if( assorted_crc32_calculate(
+		     &calculated_checksum,
+		     &( data[ data_offset ] ),
+		     read_size,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( gzip_data[ gzip_data_offset ] ),
+		 calculated_checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( gzip_data[ gzip_data_offset + 4 ] ),
+		 (uint32_t) read_size );
+
+		gzip_data_offset += 8;
+
+		if( add_block_size != 0 )
+		{
+			member_size = gzip_data_offset - member_offset;
+
+			if( member_size > 65536 )
+			{
+				return( -1 );
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( gzip_data[ member_offset + 16 ] ),
+			 (uint16_t) ( member_size - 1 ) );
+		}
+		data_offset += read_size;
+	}
+	*gzip_data_size = gzip_data_offset;
+
+	return( 1 );
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_deflate_parallel_compress_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_compress_chunk(
+     void )
+{
+	assorted_deflate_parallel_chunk_t chunk;
+
+	libcerror_error_t *error = NULL;
+	uint8_t *compressed_data = NULL;
+	uint8_t *data            = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	assorted_test_deflate_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	result = assorted_adler32_calculate_checksum_unfolded16_4(
+	          &checksum_value,
+	          &( data[ ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE ] ),
+	          ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &chunk,
+	 0,
+	 sizeof( assorted_deflate_parallel_chunk_t ) );
+
+	chunk.uncompressed_data        = data;
+	chunk.uncompressed_data_size   = 2 * ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE;
+	chunk.uncompressed_data_offset = ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE;
+	chunk.compression_level        = 6;
+	chunk.compressed_data          = compressed_data;
+	chunk.compressed_data_size     = ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE;
+
+	result = assorted_deflate_parallel_compress_chunk(
+	          &chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk.checksum",
+	 chunk.checksum,
+	 checksum_value );
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "chunk.compressed_data_size",
+	 (int) chunk.compressed_data_size,
+	 5 );
+
+	/* A chunk that is not the last chunk ends with an empty uncompressed block
+	 */
+	result = memory_compare(
+	          &( compressed_data[ chunk.compressed_data_size - 4 ] ),
+	          "\x00\x00\xff\xff",
+	          4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_parallel_compress_chunk(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk.uncompressed_data_size   = ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE;
+	chunk.uncompressed_data_offset = ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE + 1;
+	chunk.compressed_data_size     = ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE;
+
+	result = assorted_deflate_parallel_compress_chunk(
+	          &chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk.uncompressed_data_size   = 2 * ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE;
+	chunk.uncompressed_data_offset = ASSORTED_DEFLATE_PARALLEL_CHUNK_SIZE;
+	chunk.compressed_data_size     = 16;
+
+	result = assorted_deflate_parallel_compress_chunk(
+	          &chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 compressed_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_parallel_compress_chunk_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_compress_chunk_callback(
+     void )
+{
+	assorted_deflate_parallel_chunk_t chunk;
+	uint8_t compressed_data[ 128 ];
+	uint8_t data[ 64 ];
+
+	int result = 0;
+
+	/* Initialize test
+	 */
+	assorted_test_deflate_parallel_fill_data(
+	 data,
+	 64 );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 &chunk,
+	 0,
+	 sizeof( assorted_deflate_parallel_chunk_t ) );
+
+	chunk.uncompressed_data      = data;
+	chunk.uncompressed_data_size = 64;
+	chunk.compression_level      = 1;
+	chunk.last_block_flag        = 1;
+	chunk.compressed_data        = compressed_data;
+	chunk.compressed_data_size   = 128;
+
+	result = assorted_deflate_parallel_compress_chunk_callback(
+	          (intptr_t *) &chunk,
+	          NULL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "chunk.result",
+	 chunk.result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_parallel_compress_chunk_callback(
+	          NULL,
+	          NULL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	chunk.compressed_data_size = 4;
+
+	result = assorted_deflate_parallel_compress_chunk_callback(
+	          (intptr_t *) &chunk,
+	          NULL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "chunk.result",
+	 chunk.result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_parallel_compress_zlib function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_compress_zlib(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *compressed_data      = NULL;
+	uint8_t *data                 = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	assorted_test_deflate_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		compressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE;
+
+		result = assorted_deflate_parallel_compress_zlib(
+		          data,
+		          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE,
+		          -1,
+		          number_of_threads,
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE;
+
+		result = assorted_deflate_decompress_zlib(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          data,
+		          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test compressing empty data
+	 */
+	compressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE;
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          data,
+	          0,
+	          0,
+	          2,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE;
+
+	result = assorted_deflate_decompress_zlib(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE;
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          NULL,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE,
+	          -1,
+	          2,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          -1,
+	          2,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          data,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE,
+	          -1,
+	          0,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          data,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE,
+	          -1,
+	          2,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          data,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE,
+	          -1,
+	          2,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 5;
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          data,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE,
+	          -1,
+	          2,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data too small to contain the compressed chunks
+	 */
+	compressed_data_size = 1024;
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          data,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE,
+	          -1,
+	          2,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	memory_free(
+	 compressed_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_parallel_is_block_start function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_is_block_start(
+     void )
+{
+	uint8_t dynamic_block_data[ 3 ]         = { 0x05, 0x00, 0x00 };
+	uint8_t fixed_block_data[ 3 ]           = { 0x03, 0x00, 0x00 };
+	uint8_t invalid_dynamic_block_data[ 3 ] = { 0xfd, 0x00, 0x00 };
+	uint8_t uncompressed_block_data[ 9 ]    = { 0x01, 0x04, 0x00, 0xfb, 0xff, 'T', 'e', 's', 't' };
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_parallel_is_block_start(
+	          dynamic_block_data,
+	          3,
+	          0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_deflate_parallel_is_block_start(
+	          uncompressed_block_data,
+	          9,
+	          0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_deflate_parallel_is_block_start(
+	          uncompressed_block_data,
+	          4,
+	          0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_deflate_parallel_is_block_start(
+	          fixed_block_data,
+	          3,
+	          0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_deflate_parallel_is_block_start(
+	          invalid_dynamic_block_data,
+	          3,
+	          0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_parallel_is_block_start(
+	          NULL,
+	          3,
+	          0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_deflate_parallel_is_block_start(
+	          dynamic_block_data,
+	          3,
+	          24 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_parallel_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_decompress(
+     void )
+{
+	uint8_t uncompressed_block_data[ 9 ] = { 0x01, 0x04, 0x00, 0xfb, 0xff, 'T', 'e', 's', 't' };
+	libcerror_error_t *error             = NULL;
+	uint8_t *compressed_data             = NULL;
+	uint8_t *data                        = NULL;
+	uint8_t *uncompressed_data           = NULL;
+	size_t compressed_data_offset        = 0;
+	size_t compressed_data_size          = 0;
+	size_t uncompressed_data_size        = 0;
+	int number_of_threads                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	assorted_test_deflate_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	compressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+	result = assorted_deflate_compress(
+	          data,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE,
+	          -1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		compressed_data_offset = 0;
+		uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+		result = assorted_deflate_parallel_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          number_of_threads,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "compressed_data_offset",
+		 compressed_data_offset,
+		 compressed_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          data,
+		          ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test decompressing an uncompressed block
+	 */
+	compressed_data_offset = 0;
+	uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+	result = assorted_deflate_parallel_decompress(
+	          uncompressed_block_data,
+	          9,
+	          &compressed_data_offset,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 9 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 4 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "Test",
+	          4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_offset = 0;
+	uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+	result = assorted_deflate_parallel_decompress(
+	          NULL,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_decompress(
+	          compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &compressed_data_offset,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          NULL,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          2,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          2,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing with uncompressed data too small
+	 */
+	compressed_data_offset = 0;
+	uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE - 1;
+
+	result = assorted_deflate_parallel_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          &compressed_data_offset,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing truncated compressed data
+	 */
+	compressed_data_offset = 0;
+	uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+	result = assorted_deflate_parallel_decompress(
+	          compressed_data,
+	          compressed_data_size / 2,
+	          &compressed_data_offset,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 compressed_data );
+
+	compressed_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_parallel_decompress_zlib function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_decompress_zlib(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *compressed_data      = NULL;
+	uint8_t *data                 = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	assorted_test_deflate_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	compressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+	result = assorted_deflate_parallel_compress_zlib(
+	          data,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE,
+	          -1,
+	          3,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+		result = assorted_deflate_parallel_decompress_zlib(
+		          compressed_data,
+		          compressed_data_size,
+		          number_of_threads,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          data,
+		          ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+	result = assorted_deflate_parallel_decompress_zlib(
+	          compressed_data,
+	          compressed_data_size,
+	          2,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing with a corrupted checksum
+	 */
+	compressed_data[ compressed_data_size - 1 ] ^= 0xff;
+
+	result = assorted_deflate_parallel_decompress_zlib(
+	          compressed_data,
+	          compressed_data_size,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 compressed_data );
+
+	compressed_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_parallel_scan_gzip_members function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_scan_gzip_members(
+     void )
+{
+	assorted_deflate_parallel_gzip_member_t *members = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint8_t *data                                    = NULL;
+	uint8_t *gzip_data                               = NULL;
+	size_t gzip_data_size                            = 0;
+	size_t number_of_members                         = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	gzip_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "gzip_data",
+	 gzip_data );
+
+	assorted_test_deflate_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE );
+
+	gzip_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE;
+
+	result = assorted_test_deflate_parallel_build_gzip_data(
+	          data,
+	          ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE,
+	          65536,
+	          1,
+	          gzip_data,
+	          &gzip_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_deflate_parallel_scan_gzip_members(
+	          gzip_data,
+	          gzip_data_size,
+	          &members,
+	          &number_of_members,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "members",
+	 members );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_members",
+	 number_of_members,
+	 (size_t) 5 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "members[ 0 ].uncompressed_data_size",
+	 members[ 0 ].uncompressed_data_size,
+	 (size_t) 65536 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "members[ 4 ].uncompressed_data_size",
+	 members[ 4 ].uncompressed_data_size,
+	 (size_t) ( ASSORTED_TEST_DEFLATE_PARALLEL_DATA_SIZE - ( 4 * 65536 ) ) );
+
+	memory_free(
+	 members );
+
+	members = NULL;
+
+	/* Test with an incomplete last member
+	 */
+	result = assorted_deflate_parallel_scan_gzip_members(
+	          gzip_data,
+	          gzip_data_size - 1,
+	          &members,
+	          &number_of_members,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "members",
+	 members );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_deflate_parallel_scan_gzip_members(
+	          NULL,
+	          gzip_data_size,
+	          &members,
+	          &number_of_members,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_scan_gzip_members(
+	          gzip_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &members,
+	          &number_of_members,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_scan_gzip_members(
+	          gzip_data,
+	          gzip_data_size,
+	          NULL,
+	          &number_of_members,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_scan_gzip_members(
+	          gzip_data,
+	          gzip_data_size,
+	          &members,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 gzip_data );
+
+	gzip_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( members != NULL )
+	{
+		memory_free(
+		 members );
+	}
+	if( gzip_data != NULL )
+	{
+		memory_free(
+		 gzip_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_deflate_parallel_decompress_gzip function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_decompress_gzip(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *data                 = NULL;
+	uint8_t *gzip_data            = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t gzip_data_size         = 0;
+	size_t uncompressed_data_size = 0;
+	uint8_t add_block_size        = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	gzip_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "gzip_data",
+	 gzip_data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	assorted_test_deflate_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+	/* Test regular cases with and without member block sizes
+	 */
+	for( add_block_size = 0;
+	     add_block_size <= 1;
+	     add_block_size++ )
+	{
+		gzip_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+		result = assorted_test_deflate_parallel_build_gzip_data(
+		          data,
+		          ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE,
+		          65536,
+		          add_block_size,
+		          gzip_data,
+		          &gzip_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( number_of_threads = 1;
+		     number_of_threads <= 3;
+		     number_of_threads++ )
+		{
+			uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+			result = assorted_deflate_parallel_decompress_gzip(
+			          gzip_data,
+			          gzip_data_size,
+			          number_of_threads,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+			 "uncompressed_data_size",
+			 uncompressed_data_size,
+			 (size_t) ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          uncompressed_data,
+			          data,
+			          ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+	result = assorted_deflate_parallel_decompress_gzip(
+	          NULL,
+	          gzip_data_size,
+	          1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_decompress_gzip(
+	          gzip_data,
+	          gzip_data_size,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_decompress_gzip(
+	          gzip_data,
+	          gzip_data_size,
+	          1,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_deflate_parallel_decompress_gzip(
+	          gzip_data,
+	          gzip_data_size,
+	          1,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with uncompressed data too small
+	 */
+	uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE - 1;
+
+	result = assorted_deflate_parallel_decompress_gzip(
+	          gzip_data,
+	          gzip_data_size,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a checksum mismatch in the last member
+	 */
+	gzip_data[ gzip_data_size - 8 ] ^= 0xff;
+
+	for( number_of_threads = 1;
+	     number_of_threads <= 2;
+	     number_of_threads++ )
+	{
+		uncompressed_data_size = ASSORTED_TEST_DEFLATE_PARALLEL_DECOMPRESSION_DATA_SIZE;
+
+		result = assorted_deflate_parallel_decompress_gzip(
+		          gzip_data,
+		          gzip_data_size,
+		          number_of_threads,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 gzip_data );
+
+	gzip_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( gzip_data != NULL )
+	{
+		memory_free(
+		 gzip_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_DEFLATE_PARALLEL_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_parallel_compress_chunk",
+	 assorted_test_deflate_parallel_compress_chunk );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_parallel_compress_chunk_callback",
+	 assorted_test_deflate_parallel_compress_chunk_callback );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_parallel_compress_zlib",
+	 assorted_test_deflate_parallel_compress_zlib );
+
+	/* TODO add tests for assorted_deflate_parallel_set_bit_offset */
+
+	/* TODO add tests for assorted_deflate_parallel_resize_symbols */
+
+	/* TODO add tests for assorted_deflate_parallel_decode_huffman */
+
+	/* TODO add tests for assorted_deflate_parallel_decode_uncompressed_block */
+
+	/* TODO add tests for assorted_deflate_parallel_decode_blocks */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_parallel_is_block_start",
+	 assorted_test_deflate_parallel_is_block_start );
+
+	/* TODO add tests for assorted_deflate_parallel_decompress_chunk */
+
+	/* TODO add tests for assorted_deflate_parallel_decompress_chunk_callback */
+
+	/* TODO add tests for assorted_deflate_parallel_resolve_chunk */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_parallel_decompress",
+	 assorted_test_deflate_parallel_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_parallel_decompress_zlib",
+	 assorted_test_deflate_parallel_decompress_zlib );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_parallel_scan_gzip_members",
+	 assorted_test_deflate_parallel_scan_gzip_members );
+
+	/* TODO add tests for assorted_deflate_parallel_decompress_gzip_member */
+
+	/* TODO add tests for assorted_deflate_parallel_decompress_gzip_member_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_deflate_parallel_decompress_gzip",
+	 assorted_test_deflate_parallel_decompress_gzip );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
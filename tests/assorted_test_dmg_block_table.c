@@ -0,0 +1,532 @@
+/*
+ * Apple Disk Image (DMG) block table (mish) testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_dmg_block_table.h"
+
+/* Define to make assorted_test_dmg_block_table generate verbose output
+#define ASSORTED_TEST_DMG_BLOCK_TABLE_VERBOSE
+ */
+
+/* A block table of 324 bytes that starts at sector 8 with data offset 4096
+ * and contains an ADC, a sparse and a terminator entry
+ */
+uint8_t assorted_test_dmg_block_table_data[ 324 ] = {
+	0x6d, 0x69, 0x73, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ )
+
+/* Copies the test block table data and changes the value of a single byte
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_dmg_block_table_copy_data(
+     uint8_t *block_table_data,
+     size_t byte_offset,
+     uint8_t byte_value )
+{
+	if( block_table_data == NULL )
+	{
+		return( 0 );
+	}
+	if( byte_offset >= 324 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     block_table_data,
+	     assorted_test_dmg_block_table_data,
+	     324 ) == NULL )
+	{
+		return( 0 );
+	}
+	block_table_data[ byte_offset ] = byte_value;
+
+	return( 1 );
+}
+
+/* Tests the assorted_dmg_block_table_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_dmg_block_table_get_number_of_entries(
+     void )
+{
+	uint8_t block_table_data[ 324 ];
+
+	libcerror_error_t *error   = NULL;
+	uint32_t number_of_entries = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_dmg_block_table_get_number_of_entries(
+	          assorted_test_dmg_block_table_data,
+	          324,
+	          &number_of_entries,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 (uint32_t) 3 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_dmg_block_table_get_number_of_entries(
+	          NULL,
+	          324,
+	          &number_of_entries,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_dmg_block_table_get_number_of_entries(
+	          assorted_test_dmg_block_table_data,
+	          100,
+	          &number_of_entries,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_dmg_block_table_get_number_of_entries(
+	          assorted_test_dmg_block_table_data,
+	          324,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test block table data with the number of entries exceeding the data
+	 */
+	result = assorted_dmg_block_table_get_number_of_entries(
+	          assorted_test_dmg_block_table_data,
+	          323,
+	          &number_of_entries,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test block table data with an invalid signature
+	 */
+	result = assorted_test_dmg_block_table_copy_data(
+	          block_table_data,
+	          0,
+	          'M' );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_dmg_block_table_get_number_of_entries(
+	          block_table_data,
+	          324,
+	          &number_of_entries,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test block table data with an unsupported format version
+	 */
+	result = assorted_test_dmg_block_table_copy_data(
+	          block_table_data,
+	          7,
+	          2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_dmg_block_table_get_number_of_entries(
+	          block_table_data,
+	          324,
+	          &number_of_entries,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_dmg_block_table_get_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_dmg_block_table_get_entries(
+     void )
+{
+	assorted_dmg_block_table_entry_t entries[ 3 ];
+	uint8_t block_table_data[ 324 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_dmg_block_table_get_entries(
+	          assorted_test_dmg_block_table_data,
+	          324,
+	          entries,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "entries[ 0 ].type",
+	 entries[ 0 ].type,
+	 (uint32_t) ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_ADC );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT64(
+	 "entries[ 0 ].uncompressed_data_offset",
+	 (int64_t) entries[ 0 ].uncompressed_data_offset,
+	 (int64_t) 4096 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "entries[ 0 ].uncompressed_data_size",
+	 (uint64_t) entries[ 0 ].uncompressed_data_size,
+	 (uint64_t) 8192 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT64(
+	 "entries[ 0 ].compressed_data_offset",
+	 (int64_t) entries[ 0 ].compressed_data_offset,
+	 (int64_t) 4096 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "entries[ 0 ].compressed_data_size",
+	 (uint64_t) entries[ 0 ].compressed_data_size,
+	 (uint64_t) 600 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "entries[ 1 ].type",
+	 entries[ 1 ].type,
+	 (uint32_t) ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_SPARSE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT64(
+	 "entries[ 1 ].uncompressed_data_offset",
+	 (int64_t) entries[ 1 ].uncompressed_data_offset,
+	 (int64_t) 12288 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "entries[ 1 ].uncompressed_data_size",
+	 (uint64_t) entries[ 1 ].uncompressed_data_size,
+	 (uint64_t) 4096 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "entries[ 2 ].type",
+	 entries[ 2 ].type,
+	 (uint32_t) ASSORTED_DMG_BLOCK_TABLE_ENTRY_TYPE_TERMINATOR );
+
+	/* Test error cases
+	 */
+	result = assorted_dmg_block_table_get_entries(
+	          NULL,
+	          324,
+	          entries,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_dmg_block_table_get_entries(
+	          assorted_test_dmg_block_table_data,
+	          324,
+	          NULL,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_dmg_block_table_get_entries(
+	          assorted_test_dmg_block_table_data,
+	          324,
+	          entries,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a block table entry with a sector range that exceeds the maximum
+	 */
+	result = assorted_test_dmg_block_table_copy_data(
+	          block_table_data,
+	          212,
+	          0x7f );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_dmg_block_table_get_entries(
+	          block_table_data,
+	          324,
+	          entries,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a block table entry with a compressed data range that exceeds the maximum
+	 */
+	result = assorted_test_dmg_block_table_copy_data(
+	          block_table_data,
+	          228,
+	          0x80 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_dmg_block_table_get_entries(
+	          block_table_data,
+	          324,
+	          entries,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_DMG_BLOCK_TABLE_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_dmg_block_table_get_number_of_entries",
+	 assorted_test_dmg_block_table_get_number_of_entries );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_dmg_block_table_get_entries",
+	 assorted_test_dmg_block_table_get_entries );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -142,6 +142,342 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_fletcher64_calculate_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher64_calculate_simd(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	uint64_t checksum_value  = 0;
+	uint64_t expected_value  = 0;
+	int result               = 0;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 1048576 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_offset = 0;
+	     data_offset < 1048576;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	for( data_size = 0;
+	     data_size < 1048576;
+	     data_size = ( data_size * 3 ) + 4 )
+	{
+		result = assorted_fletcher64_calculate(
+		          &expected_value,
+		          data,
+		          data_size,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_fletcher64_calculate_simd(
+		          &checksum_value,
+		          data,
+		          data_size,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "checksum_value",
+		 checksum_value,
+		 expected_value );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test if the deferred modulo calculation does not overflow
+	 */
+	if( memory_set(
+	     data,
+	     0xfe,
+	     1048576 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = assorted_fletcher64_calculate(
+	          &checksum_value,
+	          data,
+	          1048576,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xf5f5f5f5fbfbfbfbULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_fletcher64_calculate_simd(
+	          &checksum_value,
+	          data,
+	          1048576,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0xf5f5f5f5fbfbfbfbULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_fletcher64_calculate_simd(
+	          NULL,
+	          data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_fletcher64_calculate_simd(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_fletcher64_calculate_simd(
+	          &checksum_value,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_fletcher64_combine function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher64_combine(
+     void )
+{
+	uint8_t data[ 1032 ];
+
+	libcerror_error_t *error       = NULL;
+	size_t data_offset             = 0;
+	size_t first_size              = 0;
+	uint64_t checksum_value        = 0;
+	uint64_t expected_value        = 0;
+	uint64_t first_checksum_value  = 0;
+	uint64_t second_checksum_value = 0;
+	int result                     = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1032;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	result = assorted_fletcher64_calculate(
+	          &expected_value,
+	          data,
+	          1032,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( first_size = 0;
+	     first_size <= 1032;
+	     first_size += 172 )
+	{
+		result = assorted_fletcher64_calculate(
+		          &first_checksum_value,
+		          data,
+		          first_size,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_fletcher64_calculate(
+		          &second_checksum_value,
+		          &( data[ first_size ] ),
+		          1032 - first_size,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_fletcher64_combine(
+		          &checksum_value,
+		          first_checksum_value,
+		          second_checksum_value,
+		          1032 - first_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "checksum_value",
+		 checksum_value,
+		 expected_value );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = assorted_fletcher64_combine(
+	          NULL,
+	          first_checksum_value,
+	          second_checksum_value,
+	          1032,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_fletcher64_combine(
+	          &checksum_value,
+	          first_checksum_value,
+	          second_checksum_value,
+	          1032 - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -173,6 +509,14 @@ int main(
 	 "assorted_fletcher64_calculate",
 	 assorted_test_fletcher64_calculate );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_fletcher64_calculate_simd",
+	 assorted_test_fletcher64_calculate_simd );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_fletcher64_combine",
+	 assorted_test_fletcher64_combine );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
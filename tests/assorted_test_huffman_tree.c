@@ -453,21 +453,1352 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_huffman_tree_set_symbol_values function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_set_symbol_values(
+     void )
+{
+	uint8_t code_size_array[ 4 ] = {
+		2, 2, 2, 2 };
+	uint32_t symbol_values[ 4 ] = {
+		0x00000001UL, 0x00000002UL, 0x00000003UL, 0x003fffffUL };
+
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error              = NULL;
+	uint16_t symbol                       = 0;
+	uint8_t code_size                     = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_huffman_tree_initialize(
+	          &huffman_tree,
+	          4,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_huffman_tree_set_symbol_values(
+	          huffman_tree,
+	          symbol_values,
+	          4,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The symbol retrieved does not contain the symbol value
+	 */
+	result = assorted_huffman_tree_get_symbol_from_value(
+	          huffman_tree,
+	          0x00000003UL,
+	          &symbol,
+	          &code_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_size",
+	 code_size,
+	 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The lookup table entry contains the symbol value above the symbol
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "huffman_tree->lookup_table[ 3 ]",
+	 huffman_tree->lookup_table[ 3 ],
+	 (uint32_t) 0xffffff02UL );
+
+	/* The number of code sizes cannot exceed the number of symbol values
+	 */
+	result = assorted_huffman_tree_set_symbol_values(
+	          huffman_tree,
+	          symbol_values,
+	          3,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = assorted_huffman_tree_set_symbol_values(
+	          NULL,
+	          symbol_values,
+	          4,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_set_symbol_values(
+	          huffman_tree,
+	          NULL,
+	          4,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_set_symbol_values(
+	          huffman_tree,
+	          symbol_values,
+	          -1,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_set_symbol_values(
+	          huffman_tree,
+	          symbol_values,
+	          5,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_set_symbol_values(
+	          huffman_tree,
+	          symbol_values,
+	          4,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_set_symbol_values(
+	          huffman_tree,
+	          symbol_values,
+	          4,
+	          17,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_set_symbol_values(
+	          huffman_tree,
+	          symbol_values,
+	          4,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the assorted_huffman_tree_build function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_huffman_tree_build(
+int assorted_test_huffman_tree_build(
+     void )
+{
+	uint8_t code_size_array[ 318 ];
+
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error              = NULL;
+	uint16_t symbol                       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	for( symbol = 0;
+	     symbol < 318;
+	     symbol++ )
+	{
+		if( symbol < 144 )
+		{
+			code_size_array[ symbol ] = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_size_array[ symbol ] = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_size_array[ symbol ] = 7;
+		}
+		else if( symbol < 288 )
+		{
+			code_size_array[ symbol ] = 8;
+		}
+		else
+		{
+			code_size_array[ symbol ] = 5;
+		}
+	}
+	result = assorted_huffman_tree_initialize(
+	          &huffman_tree,
+	          288,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          288,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_huffman_tree_build(
+	          NULL,
+	          code_size_array,
+	          288,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build(
+	          huffman_tree,
+	          NULL,
+	          288,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          -1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+
+	/* Test assorted_huffman_tree_build with malloc failing
+	 */
+	assorted_test_malloc_attempts_before_fail = 0;
+
+	result = assorted_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          288,
+	          &error );
+
+	if( assorted_test_malloc_attempts_before_fail != -1 )
+	{
+		assorted_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( OPTIMIZATION_DISABLED )
+
+	/* Test assorted_huffman_tree_build with memset failing
+	 */
+	assorted_test_memset_attempts_before_fail = 0;
+
+	result = assorted_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          288,
+	          &error );
+
+	if( assorted_test_memset_attempts_before_fail != -1 )
+	{
+		assorted_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( OPTIMIZATION_DISABLED ) */
+#endif /* defined( HAVE_ASSORTED_TEST_MEMORY ) */
+
+	/* TODO test errornous data */
+
+	/* Clean up
+	 */
+	result = assorted_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_huffman_tree_build_code_sizes function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_build_code_sizes(
+     void )
+{
+	uint32_t frequencies[ 5 ] = { 1, 1, 2, 4, 8 };
+	uint8_t code_sizes[ 5 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_huffman_tree_build_code_sizes(
+	          frequencies,
+	          5,
+	          15,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 0 ]",
+	 code_sizes[ 0 ],
+	 4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 1 ]",
+	 code_sizes[ 1 ],
+	 4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 2 ]",
+	 code_sizes[ 2 ],
+	 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 3 ]",
+	 code_sizes[ 3 ],
+	 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 4 ]",
+	 code_sizes[ 4 ],
+	 1 );
+
+	/* Test with length limited code sizes
+	 */
+	result = assorted_huffman_tree_build_code_sizes(
+	          frequencies,
+	          5,
+	          3,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 0 ]",
+	 code_sizes[ 0 ],
+	 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 1 ]",
+	 code_sizes[ 1 ],
+	 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 2 ]",
+	 code_sizes[ 2 ],
+	 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 3 ]",
+	 code_sizes[ 3 ],
+	 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 4 ]",
+	 code_sizes[ 4 ],
+	 1 );
+
+	/* Test with a single used symbol
+	 */
+	frequencies[ 0 ] = 0;
+	frequencies[ 1 ] = 0;
+	frequencies[ 2 ] = 0;
+	frequencies[ 3 ] = 0;
+
+	result = assorted_huffman_tree_build_code_sizes(
+	          frequencies,
+	          5,
+	          15,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 0 ]",
+	 code_sizes[ 0 ],
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 1 ]",
+	 code_sizes[ 1 ],
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "code_sizes[ 4 ]",
+	 code_sizes[ 4 ],
+	 1 );
+
+	/* Test error cases
+	 */
+	result = assorted_huffman_tree_build_code_sizes(
+	          NULL,
+	          5,
+	          15,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build_code_sizes(
+	          frequencies,
+	          1,
+	          15,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build_code_sizes(
+	          frequencies,
+	          5,
+	          2,
+	          code_sizes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build_code_sizes(
+	          frequencies,
+	          5,
+	          15,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_huffman_tree_build_codes function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_build_codes(
+     void )
+{
+	uint8_t code_sizes[ 4 ] = { 3, 3, 2, 1 };
+	uint32_t codes[ 4 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_huffman_tree_build_codes(
+	          code_sizes,
+	          4,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          codes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The codes are stored bit reversed
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "codes[ 0 ]",
+	 codes[ 0 ],
+	 (uint32_t) 0x00000003UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "codes[ 1 ]",
+	 codes[ 1 ],
+	 (uint32_t) 0x00000007UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "codes[ 2 ]",
+	 codes[ 2 ],
+	 (uint32_t) 0x00000001UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "codes[ 3 ]",
+	 codes[ 3 ],
+	 (uint32_t) 0x00000000UL );
+
+	/* Test with a front to back storage type
+	 */
+	result = assorted_huffman_tree_build_codes(
+	          code_sizes,
+	          4,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	          codes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "codes[ 0 ]",
+	 codes[ 0 ],
+	 (uint32_t) 0x00000006UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "codes[ 1 ]",
+	 codes[ 1 ],
+	 (uint32_t) 0x00000007UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "codes[ 2 ]",
+	 codes[ 2 ],
+	 (uint32_t) 0x00000002UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "codes[ 3 ]",
+	 codes[ 3 ],
+	 (uint32_t) 0x00000000UL );
+
+	/* Test error cases
+	 */
+	result = assorted_huffman_tree_build_codes(
+	          NULL,
+	          4,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          codes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build_codes(
+	          code_sizes,
+	          -1,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          codes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build_codes(
+	          code_sizes,
+	          4,
+	          0xff,
+	          codes,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build_codes(
+	          code_sizes,
+	          4,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_huffman_tree_resize_lookup_table function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_resize_lookup_table(
+     void )
+{
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error              = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_huffman_tree_initialize(
+	          &huffman_tree,
+	          288,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_huffman_tree_resize_lookup_table(
+	          huffman_tree,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree->lookup_table",
+	 huffman_tree->lookup_table );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "huffman_tree->lookup_table_size",
+	 huffman_tree->lookup_table_size,
+	 16 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the entries are preserved
+	 */
+	huffman_tree->lookup_table[ 15 ] = 0x12345678UL;
+
+	result = assorted_huffman_tree_resize_lookup_table(
+	          huffman_tree,
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "huffman_tree->lookup_table_size",
+	 huffman_tree->lookup_table_size,
+	 64 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "huffman_tree->lookup_table[ 15 ]",
+	 huffman_tree->lookup_table[ 15 ],
+	 (uint32_t) 0x12345678UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_huffman_tree_resize_lookup_table(
+	          NULL,
+	          128,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_resize_lookup_table(
+	          huffman_tree,
+	          32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_huffman_tree_build_lookup_table function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_build_lookup_table(
+     void )
+{
+	uint8_t code_size_array[ 288 ];
+
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error              = NULL;
+	uint16_t symbol                       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	for( symbol = 0;
+	     symbol < 288;
+	     symbol++ )
+	{
+		if( symbol < 144 )
+		{
+			code_size_array[ symbol ] = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_size_array[ symbol ] = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_size_array[ symbol ] = 7;
+		}
+		else
+		{
+			code_size_array[ symbol ] = 8;
+		}
+	}
+	result = assorted_huffman_tree_initialize(
+	          &huffman_tree,
+	          288,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_huffman_tree_build_lookup_table(
+	          huffman_tree,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          288,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_huffman_tree_build_lookup_table(
+	          huffman_tree,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree->lookup_table",
+	 huffman_tree->lookup_table );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "huffman_tree->lookup_table_bits",
+	 huffman_tree->lookup_table_bits,
+	 9 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The fixed literal and length code 0x30 (8-bit code 00110000)
+	 * maps to symbol 0, stored in reversed bit order
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "huffman_tree->lookup_table[ 0x0c ]",
+	 huffman_tree->lookup_table[ 0x0c ],
+	 (uint32_t) 0x00000008UL );
+
+	result = assorted_huffman_tree_build_lookup_table(
+	          huffman_tree,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "huffman_tree->lookup_table[ 0x60 ]",
+	 huffman_tree->lookup_table[ 0x60 ],
+	 (uint32_t) 0x00000008UL );
+
+	/* Test error cases
+	 */
+	result = assorted_huffman_tree_build_lookup_table(
+	          NULL,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_build_lookup_table(
+	          huffman_tree,
+	          0xff,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_huffman_tree_get_symbol_from_bit_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_huffman_tree_get_symbol_from_bit_stream(
      void )
 {
 	uint8_t code_size_array[ 318 ];
 
-	assorted_huffman_tree_t *huffman_tree = NULL;
-	libcerror_error_t *error              = NULL;
-	uint16_t symbol                       = 0;
-	int result                            = 0;
+	assorted_bit_stream_t *bit_stream     = NULL;
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error              = NULL;
+	uint16_t symbol                       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_bit_stream_initialize(
+	          &bit_stream,
+	          assorted_test_huffman_tree_data,
+	          2627,
+	          2,
+	          ASSORTED_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
 	for( symbol = 0;
 	     symbol < 318;
 	     symbol++ )
@@ -512,8 +1843,6 @@ int assorted_test_huffman_tree_build(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
 	result = assorted_huffman_tree_build(
 	          huffman_tree,
 	          code_size_array,
@@ -529,12 +1858,38 @@ int assorted_test_huffman_tree_build(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
+	symbol = 0;
+
+	result = assorted_huffman_tree_get_symbol_from_bit_stream(
+	          huffman_tree,
+	          bit_stream,
+	          &symbol,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 (uint16_t) 141 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = assorted_huffman_tree_build(
+	symbol = 0;
+
+	result = assorted_huffman_tree_get_symbol_from_bit_stream(
 	          NULL,
-	          code_size_array,
-	          288,
+	          bit_stream,
+	          &symbol,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -549,10 +1904,10 @@ int assorted_test_huffman_tree_build(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_huffman_tree_build(
+	result = assorted_huffman_tree_get_symbol_from_bit_stream(
 	          huffman_tree,
 	          NULL,
-	          288,
+	          &symbol,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -567,10 +1922,10 @@ int assorted_test_huffman_tree_build(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_huffman_tree_build(
+	result = assorted_huffman_tree_get_symbol_from_bit_stream(
 	          huffman_tree,
-	          code_size_array,
-	          -1,
+	          bit_stream,
+	          NULL,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -585,70 +1940,29 @@ int assorted_test_huffman_tree_build(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_ASSORTED_TEST_MEMORY )
-
-	/* Test assorted_huffman_tree_build with malloc failing
-	 */
-	assorted_test_malloc_attempts_before_fail = 0;
-
-	result = assorted_huffman_tree_build(
-	          huffman_tree,
-	          code_size_array,
-	          288,
-	          &error );
-
-	if( assorted_test_malloc_attempts_before_fail != -1 )
-	{
-		assorted_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		ASSORTED_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( OPTIMIZATION_DISABLED )
-
-	/* Test assorted_huffman_tree_build with memset failing
-	 */
-	assorted_test_memset_attempts_before_fail = 0;
+/* TODO add byte stream seek function */
+        bit_stream->byte_stream_offset = 2627;
+        bit_stream->bit_buffer_size    = 0;
 
-	result = assorted_huffman_tree_build(
+	result = assorted_huffman_tree_get_symbol_from_bit_stream(
 	          huffman_tree,
-	          code_size_array,
-	          288,
+	          bit_stream,
+	          &symbol,
 	          &error );
 
-	if( assorted_test_memset_attempts_before_fail != -1 )
-	{
-		assorted_test_memset_attempts_before_fail = -1;
-	}
-	else
-	{
-		ASSORTED_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+        bit_stream->byte_stream_offset = 2;
 
-		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( OPTIMIZATION_DISABLED ) */
-#endif /* defined( HAVE_ASSORTED_TEST_MEMORY ) */
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* TODO test errornous data */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
@@ -669,6 +1983,23 @@ int assorted_test_huffman_tree_build(
 	 "error",
 	 error );
 
+	result = assorted_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -678,21 +2009,29 @@ on_error:
 		 &huffman_tree,
 		 NULL );
 	}
+	if( bit_stream != NULL )
+	{
+		assorted_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the assorted_huffman_tree_get_symbol_from_bit_stream function
+/* Tests the assorted_huffman_tree_get_symbols_from_bit_stream function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_huffman_tree_get_symbol_from_bit_stream(
+int assorted_test_huffman_tree_get_symbols_from_bit_stream(
      void )
 {
-	uint8_t code_size_array[ 318 ];
+	uint8_t code_size_array[ 4 ] = { 2, 2, 2, 2 };
 
 	assorted_bit_stream_t *bit_stream     = NULL;
 	assorted_huffman_tree_t *huffman_tree = NULL;
 	libcerror_error_t *error              = NULL;
+	uint16_t second_symbol                = 0;
 	uint16_t symbol                       = 0;
+	uint8_t number_of_symbols             = 0;
 	int result                            = 0;
 
 	/* Initialize test
@@ -718,34 +2057,9 @@ int assorted_test_huffman_tree_get_symbol_from_bit_stream(
 	 "error",
 	 error );
 
-	for( symbol = 0;
-	     symbol < 318;
-	     symbol++ )
-	{
-		if( symbol < 144 )
-		{
-			code_size_array[ symbol ] = 8;
-		}
-		else if( symbol < 256 )
-		{
-			code_size_array[ symbol ] = 9;
-		}
-		else if( symbol < 280 )
-		{
-			code_size_array[ symbol ] = 7;
-		}
-		else if( symbol < 288 )
-		{
-			code_size_array[ symbol ] = 8;
-		}
-		else
-		{
-			code_size_array[ symbol ] = 5;
-		}
-	}
 	result = assorted_huffman_tree_initialize(
 	          &huffman_tree,
-	          288,
+	          4,
 	          15,
 	          &error );
 
@@ -765,7 +2079,7 @@ int assorted_test_huffman_tree_get_symbol_from_bit_stream(
 	result = assorted_huffman_tree_build(
 	          huffman_tree,
 	          code_size_array,
-	          288,
+	          4,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -777,14 +2091,45 @@ int assorted_test_huffman_tree_get_symbol_from_bit_stream(
 	 "error",
 	 error );
 
+	huffman_tree->number_of_literal_symbols = 4;
+
 	/* Test regular cases
 	 */
-	symbol = 0;
+	result = assorted_huffman_tree_get_symbols_from_bit_stream(
+	          huffman_tree,
+	          bit_stream,
+	          &symbol,
+	          &second_symbol,
+	          &number_of_symbols,
+	          &error );
 
-	result = assorted_huffman_tree_get_symbol_from_bit_stream(
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "symbol",
+	 symbol,
+	 (uint16_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_symbols",
+	 number_of_symbols,
+	 (uint8_t) 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The lookup table is built by the first call, subsequent calls return literal pairs
+	 */
+	result = assorted_huffman_tree_get_symbols_from_bit_stream(
 	          huffman_tree,
 	          bit_stream,
 	          &symbol,
+	          &second_symbol,
+	          &number_of_symbols,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -795,7 +2140,17 @@ int assorted_test_huffman_tree_get_symbol_from_bit_stream(
 	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
 	 "symbol",
 	 symbol,
-	 (uint16_t) 141 );
+	 (uint16_t) 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "second_symbol",
+	 second_symbol,
+	 (uint16_t) 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_symbols",
+	 number_of_symbols,
+	 (uint8_t) 2 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -803,12 +2158,12 @@ int assorted_test_huffman_tree_get_symbol_from_bit_stream(
 
 	/* Test error cases
 	 */
-	symbol = 0;
-
-	result = assorted_huffman_tree_get_symbol_from_bit_stream(
+	result = assorted_huffman_tree_get_symbols_from_bit_stream(
 	          NULL,
 	          bit_stream,
 	          &symbol,
+	          &second_symbol,
+	          &number_of_symbols,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -823,10 +2178,12 @@ int assorted_test_huffman_tree_get_symbol_from_bit_stream(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_huffman_tree_get_symbol_from_bit_stream(
+	result = assorted_huffman_tree_get_symbols_from_bit_stream(
 	          huffman_tree,
 	          NULL,
 	          &symbol,
+	          &second_symbol,
+	          &number_of_symbols,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -841,10 +2198,12 @@ int assorted_test_huffman_tree_get_symbol_from_bit_stream(
 	libcerror_error_free(
 	 &error );
 
-	result = assorted_huffman_tree_get_symbol_from_bit_stream(
+	result = assorted_huffman_tree_get_symbols_from_bit_stream(
 	          huffman_tree,
 	          bit_stream,
 	          NULL,
+	          &second_symbol,
+	          &number_of_symbols,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -859,17 +2218,33 @@ int assorted_test_huffman_tree_get_symbol_from_bit_stream(
 	libcerror_error_free(
 	 &error );
 
-/* TODO add byte stream seek function */
-        bit_stream->byte_stream_offset = 2627;
-        bit_stream->bit_buffer_size    = 0;
-
-	result = assorted_huffman_tree_get_symbol_from_bit_stream(
+	result = assorted_huffman_tree_get_symbols_from_bit_stream(
 	          huffman_tree,
 	          bit_stream,
 	          &symbol,
+	          NULL,
+	          &number_of_symbols,
 	          &error );
 
-        bit_stream->byte_stream_offset = 2;
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_huffman_tree_get_symbols_from_bit_stream(
+	          huffman_tree,
+	          bit_stream,
+	          &symbol,
+	          &second_symbol,
+	          NULL,
+	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -972,14 +2347,38 @@ int main(
 	 "assorted_huffman_tree_free",
 	 assorted_test_huffman_tree_free );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_huffman_tree_set_symbol_values",
+	 assorted_test_huffman_tree_set_symbol_values );
+
 	ASSORTED_TEST_RUN(
 	 "assorted_huffman_tree_build",
 	 assorted_test_huffman_tree_build );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_huffman_tree_build_code_sizes",
+	 assorted_test_huffman_tree_build_code_sizes );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_huffman_tree_build_codes",
+	 assorted_test_huffman_tree_build_codes );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_huffman_tree_resize_lookup_table",
+	 assorted_test_huffman_tree_resize_lookup_table );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_huffman_tree_build_lookup_table",
+	 assorted_test_huffman_tree_build_lookup_table );
+
 	ASSORTED_TEST_RUN(
 	 "assorted_huffman_tree_get_symbol_from_bit_stream",
 	 assorted_test_huffman_tree_get_symbol_from_bit_stream );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_huffman_tree_get_symbols_from_bit_stream",
+	 assorted_test_huffman_tree_get_symbols_from_bit_stream );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
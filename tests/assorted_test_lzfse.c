@@ -0,0 +1,767 @@
+/*
+ * ZIP archive member decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_lzfse.h"
+
+/* Define to make assorted_test_lzfse generate verbose output
+#define ASSORTED_TEST_LZFSE_VERBOSE
+ */
+
+uint8_t assorted_test_lzfse_uncompressed_data[ 90 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	'h', 'e', ' ', 'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g', '.', ' ', 'T', 'h', 'e',
+	' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ', 'f', 'o', 'x',
+	' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't', 'h', 'e', ' ',
+	'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g', '.', '\n' };
+
+uint8_t assorted_test_lzfse_compressed_data[ 208 ] = {
+	0x62, 0x76, 0x78, 0x32, 0x5a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x20, 0x02, 0x00, 0x03, 0x00, 0x30,
+	0x0c, 0x75, 0xd7, 0xd7, 0x2f, 0x0c, 0x00, 0x30, 0x9e, 0x00, 0x00, 0x00, 0x2f, 0x7c, 0xb0, 0x07,
+	0x9c, 0x03, 0x00, 0x5c, 0x03, 0x00, 0xd7, 0x9c, 0xc3, 0x35, 0x00, 0x00, 0x00, 0xd7, 0xf0, 0x3e,
+	0x00, 0x00, 0x00, 0xdf, 0x03, 0xdf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xab, 0x00, 0x00,
+	0x00, 0x70, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3d, 0x00, 0x00, 0xc0,
+	0xfd, 0xfd, 0xfd, 0xfd, 0x5b, 0x70, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0x45,
+	0xdc, 0xdf, 0xbf, 0x05, 0xf7, 0xf7, 0x6f, 0xc1, 0xfd, 0xfd, 0xfd, 0xfd, 0x3d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x65, 0xd2, 0xc1, 0x24, 0x71, 0x02, 0x04,
+	0xfc, 0x09, 0x85, 0x82, 0x8d, 0x2d, 0xf6, 0x92, 0x18, 0x3d, 0xc4, 0xe1, 0x07, 0x05, 0x76, 0x0b,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xca, 0x9e, 0x08, 0x62, 0x76, 0x78, 0x24 };
+
+uint8_t assorted_test_lzfse_multi_block_compressed_data[ 236 ] = {
+	0x62, 0x76, 0x78, 0x2d, 0x20, 0x00, 0x00, 0x00, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63,
+	0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70,
+	0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x62, 0x76, 0x78, 0x32, 0x20, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x70, 0xd8, 0xf2, 0xa6, 0xbc, 0xda, 0x0a, 0x00, 0x60,
+	0x91, 0x00, 0x00, 0x00, 0x10, 0x40, 0x00, 0x04, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+	0xc0, 0x23, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x06, 0x8f, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0f, 0x14, 0x00, 0x00, 0x00, 0xdf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x0f, 0xf0, 0x3d, 0xc0, 0xf7, 0x00, 0xf0, 0x3d, 0xc0,
+	0xf7, 0x00, 0x00, 0xc0, 0xf7, 0xf0, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x2f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x06, 0x62,
+	0x76, 0x78, 0x6e, 0x1a, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x38, 0x2d, 0xff, 0xe1, 0x0a,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x76, 0x78, 0x24 };
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_lzfse_read_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfse_read_block_header(
+     void )
+{
+	uint8_t block_data[ 12 ];
+
+	libcerror_error_t *error       = NULL;
+	size_t block_size              = 0;
+	size_t uncompressed_block_size = 0;
+	uint32_t block_type            = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzfse_read_block_header(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          &block_type,
+	          &block_size,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "block_type",
+	 block_type,
+	 (uint32_t) ASSORTED_LZFSE_BLOCK_TYPE_COMPRESSED_V2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block_size",
+	 block_size,
+	 (size_t) 204 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_block_size",
+	 uncompressed_block_size,
+	 (size_t) 90 );
+
+	result = assorted_lzfse_read_block_header(
+	          &( assorted_test_lzfse_compressed_data[ 204 ] ),
+	          4,
+	          &block_type,
+	          &block_size,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "block_type",
+	 block_type,
+	 (uint32_t) ASSORTED_LZFSE_BLOCK_TYPE_END_OF_STREAM );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "block_size",
+	 block_size,
+	 (size_t) 4 );
+
+	/* Test error cases
+	 */
+	result = assorted_lzfse_read_block_header(
+	          NULL,
+	          208,
+	          &block_type,
+	          &block_size,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfse_read_block_header(
+	          assorted_test_lzfse_compressed_data,
+	          3,
+	          &block_type,
+	          &block_size,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfse_read_block_header(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          NULL,
+	          &block_size,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfse_read_block_header(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          &block_type,
+	          NULL,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfse_read_block_header(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          &block_type,
+	          &block_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block payload exceeds the compressed data
+	 */
+	result = assorted_lzfse_read_block_header(
+	          assorted_test_lzfse_compressed_data,
+	          203,
+	          &block_type,
+	          &block_size,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block signature is invalid
+	 */
+	memory_copy(
+	 block_data,
+	 assorted_test_lzfse_multi_block_compressed_data,
+	 12 );
+
+	block_data[ 3 ] = 0x33;
+
+	result = assorted_lzfse_read_block_header(
+	          block_data,
+	          12,
+	          &block_type,
+	          &block_size,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block is a compressed (version 1) block
+	 */
+	block_data[ 3 ] = 0x31;
+
+	result = assorted_lzfse_read_block_header(
+	          block_data,
+	          12,
+	          &block_type,
+	          &block_size,
+	          &uncompressed_block_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzfse_get_number_of_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfse_get_number_of_blocks(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t number_of_blocks  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzfse_get_number_of_blocks(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          &number_of_blocks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (size_t) 1 );
+
+	result = assorted_lzfse_get_number_of_blocks(
+	          assorted_test_lzfse_multi_block_compressed_data,
+	          236,
+	          &number_of_blocks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (size_t) 3 );
+
+	/* Test error cases
+	 */
+	result = assorted_lzfse_get_number_of_blocks(
+	          NULL,
+	          208,
+	          &number_of_blocks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfse_get_number_of_blocks(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the end of stream block is missing
+	 */
+	result = assorted_lzfse_get_number_of_blocks(
+	          assorted_test_lzfse_compressed_data,
+	          204,
+	          &number_of_blocks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzfse_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfse_decompress(
+     void )
+{
+	uint8_t compressed_data[ 208 ];
+	uint8_t uncompressed_data[ 100 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 2;
+	     number_of_threads++ )
+	{
+		memory_set(
+		 uncompressed_data,
+		 0,
+		 100 );
+
+		uncompressed_data_size = 100;
+
+		result = assorted_lzfse_decompress(
+		          assorted_test_lzfse_compressed_data,
+		          208,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 90 );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_lzfse_uncompressed_data,
+		          90 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_set(
+		 uncompressed_data,
+		 0,
+		 100 );
+
+		uncompressed_data_size = 100;
+
+		result = assorted_lzfse_decompress(
+		          assorted_test_lzfse_multi_block_compressed_data,
+		          236,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 90 );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_lzfse_uncompressed_data,
+		          90 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 100;
+
+	result = assorted_lzfse_decompress(
+	          NULL,
+	          208,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfse_decompress(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          NULL,
+	          &uncompressed_data_size,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfse_decompress(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          uncompressed_data,
+	          NULL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfse_decompress(
+	          assorted_test_lzfse_compressed_data,
+	          208,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the uncompressed data is too small
+	 */
+	uncompressed_data_size = 89;
+
+	result = assorted_lzfse_decompress(
+	          assorted_test_lzfse_multi_block_compressed_data,
+	          236,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the entropy encoded data is corrupted
+	 */
+	memory_copy(
+	 compressed_data,
+	 assorted_test_lzfse_compressed_data,
+	 208 );
+
+	compressed_data[ 203 ] ^= 0x80;
+
+	uncompressed_data_size = 100;
+
+	result = assorted_lzfse_decompress(
+	          compressed_data,
+	          208,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZFSE_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzfse_read_block_header",
+	 assorted_test_lzfse_read_block_header );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzfse_get_number_of_blocks",
+	 assorted_test_lzfse_get_number_of_blocks );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzfse_decompress",
+	 assorted_test_lzfse_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -42,6 +42,92 @@
 uint8_t assorted_test_lzfu_compressed_data[ 16 ] = {
 	0x78, 0xda, 0xbd, 0x59, 0x6d, 0x8f, 0xdb, 0xb8, 0x11, 0xfe, 0x7c, 0xfa, 0x15, 0xc4, 0x7e, 0xb9 };
 
+uint8_t assorted_test_lzfu_uncompressed_data[ 43 ] = {
+	0x7b, 0x5c, 0x72, 0x74, 0x66, 0x31, 0x5c, 0x61, 0x6e, 0x73, 0x69, 0x5c, 0x61, 0x6e, 0x73, 0x69,
+	0x63, 0x70, 0x67, 0x31, 0x32, 0x35, 0x32, 0x5c, 0x70, 0x61, 0x72, 0x64, 0x20, 0x68, 0x65, 0x6c,
+	0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x7d, 0x0d, 0x0a };
+
+uint8_t assorted_test_lzfu_expected_compressed_data[ 50 ] = {
+	0x2e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4c, 0x5a, 0x46, 0x75, 0xbf, 0x53, 0xac, 0x65,
+	0x03, 0x00, 0x0a, 0x0d, 0x62, 0x63, 0x70, 0x67, 0x31, 0x32, 0x35, 0x02, 0x32, 0x0a, 0xf3, 0x20,
+	0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x00, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x7d, 0x0d, 0x02, 0x0a,
+	0x0f, 0xa0 };
+
+uint8_t assorted_test_lzfu_uncompressed_lzfu_data[ 59 ] = {
+	0x37, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4d, 0x45, 0x4c, 0x41, 0x00, 0x00, 0x00, 0x00,
+	0x7b, 0x5c, 0x72, 0x74, 0x66, 0x31, 0x5c, 0x61, 0x6e, 0x73, 0x69, 0x5c, 0x61, 0x6e, 0x73, 0x69,
+	0x63, 0x70, 0x67, 0x31, 0x32, 0x35, 0x32, 0x5c, 0x70, 0x61, 0x72, 0x64, 0x20, 0x68, 0x65, 0x6c,
+	0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x7d, 0x0d, 0x0a };
+
+/* The sink of the uncompressed data used to test assorted_lzfu_decompress_to_sink
+ */
+typedef struct assorted_test_lzfu_sink assorted_test_lzfu_sink_t;
+
+struct assorted_test_lzfu_sink
+{
+	/* The expected uncompressed data
+	 */
+	const uint8_t *data;
+
+	/* The size of the expected uncompressed data
+	 */
+	size_t data_size;
+
+	/* The offset of the next uncompressed data
+	 */
+	size_t data_offset;
+};
+
+/* Compares the uncompressed data passed to the sink with the expected uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_test_lzfu_write_data(
+     intptr_t *sink,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	assorted_test_lzfu_sink_t *test_sink = (assorted_test_lzfu_sink_t *) sink;
+
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( error )
+
+	/* The data is passed from the lz buffer hence never more than 4096 bytes at a time
+	 */
+	if( ( data_size > 4096 )
+	 || ( data_size > test_sink->data_size )
+	 || ( test_sink->data_offset > ( test_sink->data_size - data_size ) ) )
+	{
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     &( test_sink->data[ test_sink->data_offset ] ),
+	     data_size ) != 0 )
+	{
+		return( -1 );
+	}
+	test_sink->data_offset += data_size;
+
+	return( 1 );
+}
+
+/* Fails to write the uncompressed data passed to the sink
+ * Returns -1
+ */
+int assorted_test_lzfu_write_data_failure(
+     intptr_t *sink ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error ASSORTED_TEST_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( sink )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( data )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( data_size )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
 #if defined( __GNUC__ )
 
 /* Tests the assorted_lzfu_get_uncompressed_data_size function
@@ -140,13 +226,237 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_lzfu_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_compress(
+     void )
+{
+	uint8_t compressed_data[ 64 ];
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_size = 64;
+
+	result = assorted_lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          43,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 50 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          compressed_data,
+	          assorted_test_lzfu_expected_compressed_data,
+	          50 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the compressed data can be decompressed
+	 * The end marker is decompressed as 2 trailing zero bytes
+	 */
+	uncompressed_data_size = 64;
+
+	result = assorted_lzfu_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 45 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzfu_uncompressed_data,
+	          43 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test compressing empty data
+	 */
+	compressed_data_size = 64;
+
+	result = assorted_lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          0,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 19 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 64;
+
+	result = assorted_lzfu_compress(
+	          NULL,
+	          43,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          43,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          43,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressing into compressed data that is too small
+	 */
+	compressed_data_size = 49;
+
+	result = assorted_lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          43,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the assorted_lzfu_decompress function
  * Returns 1 if successful or 0 if not
  */
 int assorted_test_lzfu_decompress(
      void )
 {
-	uint8_t uncompressed_data[ 16 ];
+	uint8_t uncompressed_data[ 64 ];
 
 	libcerror_error_t *error      = NULL;
 	size_t uncompressed_data_size = 0;
@@ -179,6 +489,41 @@ int assorted_test_lzfu_decompress(
 	 error );
 */
 
+	/* Test uncompressed data
+	 */
+	uncompressed_data_size = 64;
+
+	result = assorted_lzfu_decompress(
+	          assorted_test_lzfu_uncompressed_lzfu_data,
+	          59,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 43 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzfu_uncompressed_data,
+	          43 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	uncompressed_data_size = 16;
@@ -286,6 +631,309 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_lzfu_decompress_to_sink function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_decompress_to_sink(
+     void )
+{
+	uint8_t compressed_data[ 50 ];
+
+	assorted_test_lzfu_sink_t test_sink;
+
+	libcerror_error_t *error       = NULL;
+	uint8_t *large_compressed_data = NULL;
+	uint8_t *large_data            = NULL;
+	size_t data_offset             = 0;
+	size_t large_compressed_size   = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	test_sink.data        = assorted_test_lzfu_uncompressed_data;
+	test_sink.data_size   = 43;
+	test_sink.data_offset = 0;
+
+	result = assorted_lzfu_decompress_to_sink(
+	          assorted_test_lzfu_expected_compressed_data,
+	          50,
+	          &assorted_test_lzfu_write_data,
+	          (intptr_t *) &test_sink,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "test_sink.data_offset",
+	 test_sink.data_offset,
+	 (size_t) 43 );
+
+	/* Test uncompressed data
+	 */
+	test_sink.data        = assorted_test_lzfu_uncompressed_data;
+	test_sink.data_size   = 43;
+	test_sink.data_offset = 0;
+
+	result = assorted_lzfu_decompress_to_sink(
+	          assorted_test_lzfu_uncompressed_lzfu_data,
+	          59,
+	          &assorted_test_lzfu_write_data,
+	          (intptr_t *) &test_sink,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "test_sink.data_offset",
+	 test_sink.data_offset,
+	 (size_t) 43 );
+
+	/* Test with uncompressed data that wraps around the lz buffer multiple times
+	 */
+	large_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 20000 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "large_data",
+	 large_data );
+
+	for( data_offset = 0;
+	     data_offset < 20000;
+	     data_offset++ )
+	{
+		large_data[ data_offset ] = (uint8_t) ( ( data_offset % 251 ) ^ ( data_offset / 1000 ) );
+	}
+	large_compressed_size = 2 * 20000 + 64;
+
+	large_compressed_data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * large_compressed_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "large_compressed_data",
+	 large_compressed_data );
+
+	result = assorted_lzfu_compress(
+	          large_data,
+	          20000,
+	          large_compressed_data,
+	          &large_compressed_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	test_sink.data        = large_data;
+	test_sink.data_size   = 20000;
+	test_sink.data_offset = 0;
+
+	result = assorted_lzfu_decompress_to_sink(
+	          large_compressed_data,
+	          large_compressed_size,
+	          &assorted_test_lzfu_write_data,
+	          (intptr_t *) &test_sink,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "test_sink.data_offset",
+	 test_sink.data_offset,
+	 (size_t) 20000 );
+
+	memory_free(
+	 large_compressed_data );
+
+	large_compressed_data = NULL;
+
+	memory_free(
+	 large_data );
+
+	large_data = NULL;
+
+	/* Test error case where the CRC does not match
+	 */
+	result = memory_copy(
+	          compressed_data,
+	          assorted_test_lzfu_expected_compressed_data,
+	          50 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	compressed_data[ 12 ] ^= 0xff;
+
+	test_sink.data        = assorted_test_lzfu_uncompressed_data;
+	test_sink.data_size   = 43;
+	test_sink.data_offset = 0;
+
+	result = assorted_lzfu_decompress_to_sink(
+	          compressed_data,
+	          50,
+	          &assorted_test_lzfu_write_data,
+	          (intptr_t *) &test_sink,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the sink fails
+	 */
+	result = assorted_lzfu_decompress_to_sink(
+	          assorted_test_lzfu_expected_compressed_data,
+	          50,
+	          &assorted_test_lzfu_write_data_failure,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzfu_decompress_to_sink(
+	          NULL,
+	          50,
+	          &assorted_test_lzfu_write_data,
+	          (intptr_t *) &test_sink,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_decompress_to_sink(
+	          assorted_test_lzfu_expected_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &assorted_test_lzfu_write_data,
+	          (intptr_t *) &test_sink,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_decompress_to_sink(
+	          assorted_test_lzfu_expected_compressed_data,
+	          8,
+	          &assorted_test_lzfu_write_data,
+	          (intptr_t *) &test_sink,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_decompress_to_sink(
+	          assorted_test_lzfu_expected_compressed_data,
+	          50,
+	          NULL,
+	          (intptr_t *) &test_sink,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( large_compressed_data != NULL )
+	{
+		memory_free(
+		 large_compressed_data );
+	}
+	if( large_data != NULL )
+	{
+		memory_free(
+		 large_data );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -317,12 +965,18 @@ int main(
 	 "assorted_lzfu_get_uncompressed_data_size",
 	 assorted_test_lzfu_get_uncompressed_data_size );
 
-	/* TODO add tests for lzfu_compress */
+	ASSORTED_TEST_RUN(
+	 "assorted_lzfu_compress",
+	 assorted_test_lzfu_compress );
 
 	ASSORTED_TEST_RUN(
 	 "assorted_lzfu_decompress",
 	 assorted_test_lzfu_decompress );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_lzfu_decompress_to_sink",
+	 assorted_test_lzfu_decompress_to_sink );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,462 @@
+/*
+ * LZFu parallel decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_lzfu.h"
+#include "../src/assorted_lzfu_parallel.h"
+
+/* Define to make assorted_test_lzfu_parallel generate verbose output
+#define ASSORTED_TEST_LZFU_PARALLEL_VERBOSE
+ */
+
+#define ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS	600
+#define ASSORTED_TEST_LZFU_PARALLEL_ITEM_SIZE		128
+
+uint8_t assorted_test_lzfu_parallel_uncompressed_data[ ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS ][ ASSORTED_TEST_LZFU_PARALLEL_ITEM_SIZE ];
+uint8_t assorted_test_lzfu_parallel_compressed_data[ ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS ][ ASSORTED_TEST_LZFU_PARALLEL_ITEM_SIZE ];
+uint8_t assorted_test_lzfu_parallel_decompressed_data[ ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS ][ ASSORTED_TEST_LZFU_PARALLEL_ITEM_SIZE ];
+
+assorted_lzfu_parallel_item_t assorted_test_lzfu_parallel_items[ ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS ];
+
+/* Retrieves the uncompressed data size of an item
+ */
+#define assorted_test_lzfu_parallel_get_item_data_size( item_index ) \
+	( 20 + ( ( item_index ) % 50 ) )
+
+/* Compresses the test items
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_parallel_initialize_items(
+     void )
+{
+	const char *pattern         = "{\\rtf1 assorted\\par}";
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	size_t data_offset          = 0;
+	size_t data_size            = 0;
+	size_t item_index           = 0;
+	int result                  = 0;
+
+	for( item_index = 0;
+	     item_index < ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS;
+	     item_index++ )
+	{
+		data_size = assorted_test_lzfu_parallel_get_item_data_size( item_index );
+
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			assorted_test_lzfu_parallel_uncompressed_data[ item_index ][ data_offset ] = (uint8_t) pattern[ ( data_offset + item_index ) % 20 ];
+		}
+		compressed_data_size = ASSORTED_TEST_LZFU_PARALLEL_ITEM_SIZE;
+
+		result = assorted_lzfu_compress(
+		          assorted_test_lzfu_parallel_uncompressed_data[ item_index ],
+		          data_size,
+		          assorted_test_lzfu_parallel_compressed_data[ item_index ],
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		assorted_test_lzfu_parallel_items[ item_index ].compressed_data        = assorted_test_lzfu_parallel_compressed_data[ item_index ];
+		assorted_test_lzfu_parallel_items[ item_index ].compressed_data_size   = compressed_data_size;
+		assorted_test_lzfu_parallel_items[ item_index ].uncompressed_data      = assorted_test_lzfu_parallel_decompressed_data[ item_index ];
+		assorted_test_lzfu_parallel_items[ item_index ].uncompressed_data_size = ASSORTED_TEST_LZFU_PARALLEL_ITEM_SIZE;
+		assorted_test_lzfu_parallel_items[ item_index ].result                 = 0;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Checks the decompressed test items
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_parallel_check_items(
+     void )
+{
+	size_t item_index = 0;
+	int result        = 0;
+
+	for( item_index = 0;
+	     item_index < ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS;
+	     item_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 assorted_test_lzfu_parallel_items[ item_index ].result,
+		 1 );
+
+		/* The end marker is decompressed as 2 trailing zero bytes
+		 */
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 assorted_test_lzfu_parallel_items[ item_index ].uncompressed_data_size,
+		 (size_t) ( assorted_test_lzfu_parallel_get_item_data_size( item_index ) + 2 ) );
+
+		result = memory_compare(
+		          assorted_test_lzfu_parallel_decompressed_data[ item_index ],
+		          assorted_test_lzfu_parallel_uncompressed_data[ item_index ],
+		          assorted_test_lzfu_parallel_get_item_data_size( item_index ) );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_lzfu_parallel_decompress_items function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_parallel_decompress_items(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_test_lzfu_parallel_initialize_items();
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = assorted_lzfu_parallel_decompress_items(
+	          assorted_test_lzfu_parallel_items,
+	          ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_test_lzfu_parallel_check_items();
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = assorted_lzfu_parallel_decompress_items(
+	          NULL,
+	          ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_parallel_decompress_items(
+	          assorted_test_lzfu_parallel_items,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzfu_parallel_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_parallel_decompress(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads += 3 )
+	{
+		result = assorted_test_lzfu_parallel_initialize_items();
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_lzfu_parallel_decompress(
+		          assorted_test_lzfu_parallel_items,
+		          ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = assorted_test_lzfu_parallel_check_items();
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test decompressing items where one item is corrupted
+	 */
+	result = assorted_test_lzfu_parallel_initialize_items();
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	assorted_test_lzfu_parallel_compressed_data[ 300 ][ 20 ] ^= 0xff;
+
+	result = assorted_lzfu_parallel_decompress(
+	          assorted_test_lzfu_parallel_items,
+	          ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 assorted_test_lzfu_parallel_items[ 300 ].result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 assorted_test_lzfu_parallel_items[ 299 ].result,
+	 1 );
+
+	/* Test decompressing no items
+	 */
+	result = assorted_lzfu_parallel_decompress(
+	          assorted_test_lzfu_parallel_items,
+	          0,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzfu_parallel_decompress(
+	          NULL,
+	          ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_parallel_decompress(
+	          assorted_test_lzfu_parallel_items,
+	          (size_t) SSIZE_MAX,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzfu_parallel_decompress(
+	          assorted_test_lzfu_parallel_items,
+	          ASSORTED_TEST_LZFU_PARALLEL_NUMBER_OF_ITEMS,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZFU_PARALLEL_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzfu_parallel_decompress_items",
+	 assorted_test_lzfu_parallel_decompress_items );
+
+	/* TODO add tests for assorted_lzfu_parallel_decompress_task_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzfu_parallel_decompress",
+	 assorted_test_lzfu_parallel_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -31,6 +31,7 @@
 #include "assorted_test_libcerror.h"
 #include "assorted_test_libcnotify.h"
 #include "assorted_test_macros.h"
+#include "assorted_test_memory.h"
 #include "assorted_test_unused.h"
 
 #include "../src/assorted_lzma.h"
@@ -39,8 +40,2517 @@
 #define ASSORTED_TEST_LZMA_VERBOSE
  */
 
+uint8_t assorted_test_lzma_compressed_data[ 116 ] = {
+	0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x01, 0x69, 0x22, 0xde, 0x36, 0x04, 0xc0, 0x3b, 0x59,
+	0x21, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x77, 0xad, 0xbe,
+	0xe0, 0x00, 0x58, 0x00, 0x33, 0x5d, 0x00, 0x2a, 0x1a, 0x08, 0xa2, 0x03, 0x25, 0x66, 0xf1, 0x4b,
+	0x78, 0xc5, 0xa2, 0x05, 0xff, 0x2e, 0xe6, 0xd9, 0xd2, 0x20, 0x1a, 0xad, 0x34, 0xf8, 0xe2, 0x1d,
+	0xe8, 0x41, 0x36, 0xfa, 0xdc, 0x06, 0x69, 0xbb, 0x3c, 0xe4, 0x10, 0x34, 0x27, 0x09, 0xeb, 0xb3,
+	0x66, 0xe3, 0xed, 0x37, 0x4b, 0x50, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x0a, 0xe9, 0x9a,
+	0x00, 0x01, 0x53, 0x59, 0xec, 0x52, 0xa7, 0xa3, 0x90, 0x42, 0x99, 0x0d, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x59, 0x5a };
+
+/* The same data compressed with a CRC-64 check
+ */
+uint8_t assorted_test_lzma_crc64_compressed_data[ 112 ] = {
+	0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x04, 0xe6, 0xd6, 0xb4, 0x46, 0x02, 0x00, 0x21, 0x01,
+	0x16, 0x00, 0x00, 0x00, 0x74, 0x2f, 0xe5, 0xa3, 0xe0, 0x00, 0x58, 0x00, 0x33, 0x5d, 0x00, 0x2a,
+	0x1a, 0x08, 0xa2, 0x03, 0x25, 0x66, 0xf1, 0x4b, 0x78, 0xc5, 0xa2, 0x05, 0xff, 0x2e, 0xe6, 0xd9,
+	0xd2, 0x20, 0x1a, 0xad, 0x34, 0xf8, 0xe2, 0x1d, 0xe8, 0x41, 0x36, 0xfa, 0xdc, 0x06, 0x69, 0xbb,
+	0x3c, 0xe4, 0x10, 0x34, 0x27, 0x09, 0xeb, 0xb3, 0x66, 0xe3, 0xed, 0x37, 0x4b, 0x50, 0xff, 0xb3,
+	0x00, 0x00, 0x00, 0x00, 0x1b, 0x2d, 0x72, 0xdc, 0xf4, 0xb3, 0xf8, 0xcb, 0x00, 0x01, 0x4f, 0x59,
+	0xb1, 0x0f, 0xd0, 0x45, 0x1f, 0xb6, 0xf3, 0x7d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x5a };
+
+/* The same data compressed with a SHA-256 check
+ */
+uint8_t assorted_test_lzma_sha256_compressed_data[ 136 ] = {
+	0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x0a, 0xe1, 0xfb, 0x0c, 0xa1, 0x02, 0x00, 0x21, 0x01,
+	0x16, 0x00, 0x00, 0x00, 0x74, 0x2f, 0xe5, 0xa3, 0xe0, 0x00, 0x58, 0x00, 0x33, 0x5d, 0x00, 0x2a,
+	0x1a, 0x08, 0xa2, 0x03, 0x25, 0x66, 0xf1, 0x4b, 0x78, 0xc5, 0xa2, 0x05, 0xff, 0x2e, 0xe6, 0xd9,
+	0xd2, 0x20, 0x1a, 0xad, 0x34, 0xf8, 0xe2, 0x1d, 0xe8, 0x41, 0x36, 0xfa, 0xdc, 0x06, 0x69, 0xbb,
+	0x3c, 0xe4, 0x10, 0x34, 0x27, 0x09, 0xeb, 0xb3, 0x66, 0xe3, 0xed, 0x37, 0x4b, 0x50, 0xff, 0xb3,
+	0x00, 0x00, 0x00, 0x00, 0x63, 0x52, 0x41, 0xac, 0x82, 0x3e, 0xe4, 0xa8, 0x1f, 0xbb, 0x41, 0x0c,
+	0x92, 0xbe, 0x61, 0x6b, 0x0a, 0x89, 0x19, 0x10, 0x83, 0xd8, 0xd7, 0xb5, 0xd2, 0x32, 0xc8, 0x23,
+	0xdc, 0x8d, 0xf4, 0xf5, 0x00, 0x01, 0x67, 0x59, 0x1b, 0xa1, 0x8d, 0x18, 0x18, 0x9b, 0x4b, 0x9a,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x59, 0x5a };
+
+uint8_t assorted_test_lzma_uncompressed_data[ 89 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	'h', 'e', ' ', 'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g', '.', ' ', 'T', 'h', 'e',
+	' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ', 'f', 'o', 'x',
+	' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't', 'h', 'e', ' ',
+	'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g', '.' };
+
 #if defined( __GNUC__ )
 
+/* Tests the assorted_lzma_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_decoder_initialize(
+     void )
+{
+	assorted_lzma_decoder_t *decoder = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "alignment",
+	 (int) ( (intptr_t) decoder->probabilities % 64 ),
+	 0 );
+
+	result = assorted_lzma_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_decoder_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decoder = (assorted_lzma_decoder_t *) 0x12345678UL;
+
+	result = assorted_lzma_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	decoder = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		assorted_lzma_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_decoder_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_decoder_set_properties function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_decoder_set_properties(
+     void )
+{
+	assorted_lzma_decoder_t *decoder = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_lzma_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_decoder_set_properties(
+	          decoder,
+	          0x5d,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "decoder->number_of_literal_context_bits",
+	 decoder->number_of_literal_context_bits,
+	 (uint8_t) 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "decoder->number_of_literal_position_bits",
+	 decoder->number_of_literal_position_bits,
+	 (uint8_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "decoder->number_of_position_bits",
+	 decoder->number_of_position_bits,
+	 (uint8_t) 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_decoder_set_properties(
+	          NULL,
+	          0x5d,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_decoder_set_properties(
+	          decoder,
+	          225,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with more than 4 literal context and position bits
+	 */
+	result = assorted_lzma_decoder_set_properties(
+	          decoder,
+	          0x0d,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_lzma_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		assorted_lzma_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_decoder_reset_state function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_decoder_reset_state(
+     void )
+{
+	assorted_lzma_decoder_t *decoder = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_lzma_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_decoder_set_properties(
+	          decoder,
+	          0x5d,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	decoder->state          = 7;
+	decoder->distances[ 0 ] = 1;
+
+	result = assorted_lzma_decoder_reset_state(
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "decoder->state",
+	 decoder->state,
+	 (uint8_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decoder->distances[ 0 ]",
+	 decoder->distances[ 0 ],
+	 (uint32_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "decoder->probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_MATCH ]",
+	 decoder->probabilities[ ASSORTED_LZMA_PROBABILITIES_IS_MATCH ],
+	 (uint16_t) ASSORTED_LZMA_INITIAL_PROBABILITY );
+
+	/* The properties value 0x5d uses 8 literal states
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "last literal probability",
+	 decoder->probabilities[ ASSORTED_LZMA_PROBABILITIES_LITERALS + ( 8 * 0x300 ) - 1 ],
+	 (uint16_t) ASSORTED_LZMA_INITIAL_PROBABILITY );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_decoder_reset_state(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_lzma_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		assorted_lzma_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_read_variable_size_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_read_variable_size_integer(
+     void )
+{
+	uint8_t data[ 10 ] = {
+		0x7f, 0x80, 0x01, 0xff, 0xff, 0x03, 0x80, 0x00, 0x80, 0x80 };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_read_variable_size_integer(
+	          data,
+	          10,
+	          &data_offset,
+	          &value_64bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x7f );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_read_variable_size_integer(
+	          data,
+	          10,
+	          &data_offset,
+	          &value_64bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x80 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_read_variable_size_integer(
+	          data,
+	          10,
+	          &data_offset,
+	          &value_64bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 6 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xffff );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_read_variable_size_integer(
+	          NULL,
+	          10,
+	          &data_offset,
+	          &value_64bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_read_variable_size_integer(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &data_offset,
+	          &value_64bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_read_variable_size_integer(
+	          data,
+	          10,
+	          NULL,
+	          &value_64bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_read_variable_size_integer(
+	          data,
+	          10,
+	          &data_offset,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a non-minimal encoding
+	 */
+	result = assorted_lzma_read_variable_size_integer(
+	          data,
+	          10,
+	          &data_offset,
+	          &value_64bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a truncated integer
+	 */
+	data_offset = 8;
+
+	result = assorted_lzma_read_variable_size_integer(
+	          data,
+	          10,
+	          &data_offset,
+	          &value_64bit,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_get_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_get_uncompressed_data_size(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	uint64_t uncompressed_data_size = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_get_uncompressed_data_size(
+	          assorted_test_lzma_compressed_data,
+	          116,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (uint64_t) 89 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data without a stream footer
+	 */
+	result = assorted_lzma_get_uncompressed_data_size(
+	          assorted_test_lzma_compressed_data,
+	          115,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_get_uncompressed_data_size(
+	          NULL,
+	          116,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_get_uncompressed_data_size(
+	          assorted_test_lzma_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_get_uncompressed_data_size(
+	          assorted_test_lzma_compressed_data,
+	          116,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_check_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_check_initialize(
+     void )
+{
+	assorted_lzma_check_t *check = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_check_initialize(
+	          &check,
+	          ASSORTED_LZMA_CHECK_TYPE_SHA256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "check",
+	 check );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "check->check_size",
+	 check->check_size,
+	 (size_t) 32 );
+
+	result = assorted_lzma_check_free(
+	          &check,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "check",
+	 check );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the size of an unsupported check type is determined
+	 */
+	result = assorted_lzma_check_initialize(
+	          &check,
+	          0x07,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "check",
+	 check );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "check->check_size",
+	 check->check_size,
+	 (size_t) 16 );
+
+	result = assorted_lzma_check_free(
+	          &check,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_check_initialize(
+	          NULL,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	check = (assorted_lzma_check_t *) 0x12345678UL;
+
+	result = assorted_lzma_check_initialize(
+	          &check,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          &error );
+
+	check = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_check_initialize(
+	          &check,
+	          0x10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( check != NULL )
+	{
+		assorted_lzma_check_free(
+		 &check,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_check_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_check_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_check_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_check_read function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_check_read(
+     void )
+{
+	assorted_lzma_check_t *check  = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_check_initialize(
+	          &check,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "check",
+	 check );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the check is the same when it is updated in parts
+	 */
+	result = assorted_lzma_check_update(
+	          check,
+	          assorted_test_lzma_uncompressed_data,
+	          45,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_check_update(
+	          check,
+	          &( assorted_test_lzma_uncompressed_data[ 45 ] ),
+	          44,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 84;
+
+	result = assorted_lzma_check_read(
+	          check,
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          &compressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 92 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the check no longer matches after it was reset
+	 */
+	result = assorted_lzma_check_reset(
+	          check,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 84;
+
+	result = assorted_lzma_check_read(
+	          check,
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          &compressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 84 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_check_read(
+	          NULL,
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          &compressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_check_read(
+	          check,
+	          NULL,
+	          112,
+	          &compressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_check_read(
+	          check,
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data too small to contain the check
+	 */
+	result = assorted_lzma_check_read(
+	          check,
+	          assorted_test_lzma_crc64_compressed_data,
+	          90,
+	          &compressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_check_free(
+	          &check,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a SHA-256 check
+	 */
+	result = assorted_lzma_check_initialize(
+	          &check,
+	          ASSORTED_LZMA_CHECK_TYPE_SHA256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_check_update(
+	          check,
+	          assorted_test_lzma_uncompressed_data,
+	          45,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_check_update(
+	          check,
+	          &( assorted_test_lzma_uncompressed_data[ 45 ] ),
+	          44,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_offset = 84;
+
+	result = assorted_lzma_check_read(
+	          check,
+	          assorted_test_lzma_sha256_compressed_data,
+	          136,
+	          &compressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 116 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_check_free(
+	          &check,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( check != NULL )
+	{
+		assorted_lzma_check_free(
+		 &check,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_read_block_check function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_read_block_check(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_offset = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_offset = 84;
+
+	result = assorted_lzma_read_block_check(
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          &compressed_data_offset,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          assorted_test_lzma_uncompressed_data,
+	          89,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 92 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a CRC-32 check
+	 */
+	compressed_data_offset = 92;
+
+	result = assorted_lzma_read_block_check(
+	          assorted_test_lzma_compressed_data,
+	          116,
+	          &compressed_data_offset,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC32,
+	          assorted_test_lzma_uncompressed_data,
+	          89,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 96 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_offset = 84;
+
+	result = assorted_lzma_read_block_check(
+	          NULL,
+	          112,
+	          &compressed_data_offset,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          assorted_test_lzma_uncompressed_data,
+	          89,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_read_block_check(
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          NULL,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          assorted_test_lzma_uncompressed_data,
+	          89,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_read_block_check(
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          &compressed_data_offset,
+	          0x10,
+	          assorted_test_lzma_uncompressed_data,
+	          89,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_read_block_check(
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          &compressed_data_offset,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          NULL,
+	          89,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data too small to contain the check
+	 */
+	result = assorted_lzma_read_block_check(
+	          assorted_test_lzma_crc64_compressed_data,
+	          90,
+	          &compressed_data_offset,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          assorted_test_lzma_uncompressed_data,
+	          89,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a CRC-64 mismatch
+	 */
+	result = assorted_lzma_read_block_check(
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          &compressed_data_offset,
+	          ASSORTED_LZMA_CHECK_TYPE_CRC64,
+	          assorted_test_lzma_uncompressed_data,
+	          88,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 84 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_decompress(
+     void )
+{
+	uint8_t compressed_data[ 136 ];
+	uint8_t uncompressed_data[ 128 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_lzma_decompress(
+	          assorted_test_lzma_compressed_data,
+	          116,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 89 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzma_uncompressed_data,
+	          89 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a CRC-64 check
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_lzma_decompress(
+	          assorted_test_lzma_crc64_compressed_data,
+	          112,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 89 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a SHA-256 check
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_lzma_decompress(
+	          assorted_test_lzma_sha256_compressed_data,
+	          136,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 89 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_lzma_decompress(
+	          NULL,
+	          116,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_decompress(
+	          assorted_test_lzma_compressed_data,
+	          116,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_decompress(
+	          assorted_test_lzma_compressed_data,
+	          116,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with uncompressed data too small
+	 */
+	uncompressed_data_size = 64;
+
+	result = assorted_lzma_decompress(
+	          assorted_test_lzma_compressed_data,
+	          116,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a CRC-64 check that does not match
+	 */
+	memory_copy(
+	 compressed_data,
+	 assorted_test_lzma_crc64_compressed_data,
+	 112 );
+
+	compressed_data[ 84 ] ^= 0x01;
+
+	uncompressed_data_size = 128;
+
+	result = assorted_lzma_decompress(
+	          compressed_data,
+	          112,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a SHA-256 check that does not match
+	 */
+	memory_copy(
+	 compressed_data,
+	 assorted_test_lzma_sha256_compressed_data,
+	 136 );
+
+	compressed_data[ 115 ] ^= 0x01;
+
+	uncompressed_data_size = 128;
+
+	result = assorted_lzma_decompress(
+	          compressed_data,
+	          136,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with truncated compressed data
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_lzma_decompress(
+	          assorted_test_lzma_compressed_data,
+	          64,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_context_initialize(
+     void )
+{
+	assorted_lzma_context_t *context = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_context_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (assorted_lzma_context_t *) 0x12345678UL;
+
+	result = assorted_lzma_context_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_lzma_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_context_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_context_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_context_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 128 ];
+
+	assorted_lzma_context_t *context = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t uncompressed_data_size    = 0;
+	int iteration                    = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_lzma_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * After the first stream the scratch memory fits in the slab of the arena
+	 */
+	for( iteration = 0;
+	     iteration < 3;
+	     iteration++ )
+	{
+		uncompressed_data_size = 128;
+
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+		assorted_test_memory_reset_statistics();
+#endif
+		result = assorted_lzma_context_decompress(
+		          context,
+		          assorted_test_lzma_compressed_data,
+		          116,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 89 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_lzma_uncompressed_data,
+		          89 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( iteration > 0 )
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "context->arena->number_of_overflow_blocks",
+			 context->arena->number_of_overflow_blocks,
+			 0 );
+		}
+#if defined( HAVE_ASSORTED_TEST_MEMORY )
+		/* The slab of the arena is grown by the reset of the second stream
+		 */
+		if( iteration == 0 )
+		{
+			assorted_test_memory_statistics_fprint(
+			 stdout,
+			 "assorted_lzma_context_decompress first stream" );
+		}
+		else if( iteration == 2 )
+		{
+			assorted_test_memory_statistics_fprint(
+			 stdout,
+			 "assorted_lzma_context_decompress reused context" );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "assorted_test_memory_number_of_allocations",
+			 assorted_test_memory_number_of_allocations,
+			 (uint64_t) 0 );
+		}
+#endif
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_lzma_context_decompress(
+	          NULL,
+	          assorted_test_lzma_compressed_data,
+	          116,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_context_decompress(
+	          context,
+	          NULL,
+	          116,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_lzma_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_lzma_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_compress(
+     void )
+{
+	int compression_presets[ 2 ] = {
+		ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+		ASSORTED_LZMA_COMPRESSION_PRESET_NORMAL };
+
+	libcerror_error_t *error      = NULL;
+	uint8_t *compressed_data      = NULL;
+	uint8_t *test_data            = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t compressed_data_size   = 0;
+	size_t test_data_offset       = 0;
+	size_t test_data_size         = 0;
+	size_t uncompressed_data_size = 0;
+	uint32_t random_value         = 0x12345678UL;
+	int preset_index              = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 * The test data consists of repetitive text, random data that does not compress
+	 * and a run of the same byte value
+	 */
+	test_data_size = 262144;
+
+	test_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * test_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "test_data",
+	 test_data );
+
+	for( test_data_offset = 0;
+	     test_data_offset < 131072;
+	     test_data_offset++ )
+	{
+		test_data[ test_data_offset ] = assorted_test_lzma_uncompressed_data[ test_data_offset % 89 ];
+	}
+	for( test_data_offset = 131072;
+	     test_data_offset < 212992;
+	     test_data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		test_data[ test_data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	for( test_data_offset = 212992;
+	     test_data_offset < test_data_size;
+	     test_data_offset++ )
+	{
+		test_data[ test_data_offset ] = 'A';
+	}
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ( test_data_size + 1024 ) );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * test_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	/* Test regular cases
+	 */
+	for( preset_index = 0;
+	     preset_index < 2;
+	     preset_index++ )
+	{
+		compressed_data_size = test_data_size + 1024;
+
+		result = assorted_lzma_compress(
+		          test_data,
+		          test_data_size,
+		          compression_presets[ preset_index ],
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+		 "compressed_data_size",
+		 (uint64_t) compressed_data_size,
+		 (uint64_t) 100000 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_size = test_data_size;
+
+		result = assorted_lzma_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 test_data_size );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          test_data,
+		          test_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test with data that does not span multiple positions
+		 */
+		compressed_data_size = test_data_size + 1024;
+
+		result = assorted_lzma_compress(
+		          assorted_test_lzma_uncompressed_data,
+		          1,
+		          compression_presets[ preset_index ],
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_size = test_data_size;
+
+		result = assorted_lzma_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test with empty data, which results in a stream without blocks
+	 */
+	compressed_data_size = test_data_size + 1024;
+
+	result = assorted_lzma_compress(
+	          test_data,
+	          0,
+	          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 32 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = test_data_size;
+
+	result = assorted_lzma_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = test_data_size + 1024;
+
+	result = assorted_lzma_compress(
+	          NULL,
+	          test_data_size,
+	          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_compress(
+	          test_data,
+	          test_data_size,
+	          0,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_compress(
+	          test_data,
+	          test_data_size,
+	          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a compressed data size that is too small
+	 */
+	compressed_data_size = 1024;
+
+	result = assorted_lzma_compress(
+	          test_data,
+	          test_data_size,
+	          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 compressed_data );
+
+	compressed_data = NULL;
+
+	memory_free(
+	 test_data );
+
+	test_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( test_data != NULL )
+	{
+		memory_free(
+		 test_data );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -68,6 +2578,84 @@ int main(
 
 #if defined( __GNUC__ )
 
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_decoder_initialize",
+	 assorted_test_lzma_decoder_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_decoder_free",
+	 assorted_test_lzma_decoder_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_decoder_set_properties",
+	 assorted_test_lzma_decoder_set_properties );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_decoder_reset_state",
+	 assorted_test_lzma_decoder_reset_state );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_read_variable_size_integer",
+	 assorted_test_lzma_read_variable_size_integer );
+
+	/* TODO add tests for assorted_lzma_read_stream_header */
+
+	/* TODO add tests for assorted_lzma_read_block_header */
+
+	/* TODO add tests for assorted_lzma_read_lzma */
+
+	/* TODO add tests for assorted_lzma_decoder_read_lzma2_chunk */
+
+	/* TODO add tests for assorted_lzma_decoder_read_lzma2_chunks */
+
+	/* TODO add tests for assorted_lzma_read_lzma2_block */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_check_initialize",
+	 assorted_test_lzma_check_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_check_free",
+	 assorted_test_lzma_check_free );
+
+	/* TODO add tests for assorted_lzma_check_reset */
+
+	/* TODO add tests for assorted_lzma_check_update */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_check_read",
+	 assorted_test_lzma_check_read );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_read_block_check",
+	 assorted_test_lzma_read_block_check );
+
+	/* TODO add tests for assorted_lzma_read_stream_footer */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_get_uncompressed_data_size",
+	 assorted_test_lzma_get_uncompressed_data_size );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_decompress",
+	 assorted_test_lzma_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_context_initialize",
+	 assorted_test_lzma_context_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_context_free",
+	 assorted_test_lzma_context_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_context_decompress",
+	 assorted_test_lzma_context_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_compress",
+	 assorted_test_lzma_compress );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1229 @@
+/*
+ * LZMA parallel decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_lzma.h"
+#include "../src/assorted_lzma_parallel.h"
+
+/* Define to make assorted_test_lzma_parallel generate verbose output
+#define ASSORTED_TEST_LZMA_PARALLEL_VERBOSE
+ */
+
+#define ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE	3000
+
+/* xz compressed data with 3 blocks of 1000 bytes each
+ */
+uint8_t assorted_test_lzma_parallel_blocks_compressed_data[ 184 ] = {
+	0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x01, 0x69, 0x22, 0xde, 0x36, 0x03, 0xc0, 0x1b, 0xe8,
+	0x07, 0x21, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xeb, 0xb1, 0xb4, 0xe0, 0x03, 0xe7, 0x00,
+	0x13, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x27, 0x1b, 0xc0, 0x3a, 0x00, 0x00, 0x00, 0x72, 0xf2, 0xa6, 0x22, 0x03, 0xc0, 0x1b, 0xe8,
+	0x07, 0x21, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xeb, 0xb1, 0xb4, 0xe0, 0x03, 0xe7, 0x00,
+	0x13, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x27, 0x1b, 0xc0, 0x3a, 0x00, 0x00, 0x00, 0x72, 0xf2, 0xa6, 0x22, 0x03, 0xc0, 0x1b, 0xe8,
+	0x07, 0x21, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xeb, 0xb1, 0xb4, 0xe0, 0x03, 0xe7, 0x00,
+	0x13, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x27, 0x1b, 0xc0, 0x3a, 0x00, 0x00, 0x00, 0x72, 0xf2, 0xa6, 0x22, 0x00, 0x03, 0x2f, 0xe8,
+	0x07, 0x2f, 0xe8, 0x07, 0x2f, 0xe8, 0x07, 0x00, 0xe4, 0x76, 0x69, 0xb6, 0x9b, 0xe3, 0x51, 0x40,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x5a
+};
+
+/* xz compressed data with a single block containing 3 LZMA2 chunks of 1000 bytes each that reset the dictionary
+ */
+uint8_t assorted_test_lzma_parallel_resets_compressed_data[ 132 ] = {
+	0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x01, 0x69, 0x22, 0xde, 0x36, 0x02, 0x00, 0x21, 0x01,
+	0x16, 0x00, 0x00, 0x00, 0x74, 0x2f, 0xe5, 0xa3, 0xe0, 0x03, 0xe7, 0x00, 0x13, 0x5d, 0x00, 0x30,
+	0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b, 0xb2, 0x27, 0x1b, 0xc0,
+	0x3a, 0x00, 0xe0, 0x03, 0xe7, 0x00, 0x13, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13,
+	0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b, 0xb2, 0x27, 0x1b, 0xc0, 0x3a, 0x00, 0xe0, 0x03, 0xe7, 0x00,
+	0x13, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x27, 0x1b, 0xc0, 0x3a, 0x00, 0x00, 0x00, 0x31, 0x5e, 0xf3, 0x60, 0x00, 0x01, 0x5f, 0xb8,
+	0x17, 0x00, 0x00, 0x00, 0x0c, 0x42, 0xf4, 0xd3, 0x3e, 0x30, 0x0d, 0x8b, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x59, 0x5a
+};
+
+/* Fills the test data with the uncompressed data of the compressed test data
+ */
+void assorted_test_lzma_parallel_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	const char *string = "assorted";
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) string[ data_offset % 8 ];
+	}
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_lzma_parallel_append_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_parallel_append_segment(
+     void )
+{
+	assorted_lzma_parallel_segment_t *segment  = NULL;
+	assorted_lzma_parallel_segment_t *segments = NULL;
+	libcerror_error_t *error                   = NULL;
+	size_t maximum_number_of_segments          = 0;
+	size_t number_of_segments                  = 0;
+	size_t segment_index                       = 0;
+	int result                                 = 0;
+
+	/* Test regular cases
+	 */
+	for( segment_index = 0;
+	     segment_index < 20;
+	     segment_index++ )
+	{
+		result = assorted_lzma_parallel_append_segment(
+		          &segments,
+		          &number_of_segments,
+		          &maximum_number_of_segments,
+		          &segment,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "segment",
+		 segment );
+
+		segment->uncompressed_data_offset = segment_index;
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_segments",
+	 number_of_segments,
+	 (size_t) 20 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_number_of_segments",
+	 maximum_number_of_segments,
+	 (size_t) 32 );
+
+	/* The segments must be preserved when the array is reallocated
+	 */
+	for( segment_index = 0;
+	     segment_index < 20;
+	     segment_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "segments[ segment_index ].uncompressed_data_offset",
+		 segments[ segment_index ].uncompressed_data_offset,
+		 segment_index );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "segments[ segment_index ].result",
+		 segments[ segment_index ].result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = assorted_lzma_parallel_append_segment(
+	          NULL,
+	          &number_of_segments,
+	          &maximum_number_of_segments,
+	          &segment,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_parallel_append_segment(
+	          &segments,
+	          &number_of_segments,
+	          &maximum_number_of_segments,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 segments );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segments != NULL )
+	{
+		memory_free(
+		 segments );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_parallel_split_block function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_parallel_split_block(
+     void )
+{
+	uint8_t uncompressed_data[ ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE ];
+
+	assorted_lzma_parallel_segment_t *segments = NULL;
+	libcerror_error_t *error                   = NULL;
+	size_t maximum_number_of_segments          = 0;
+	size_t number_of_segments                  = 0;
+	size_t segment_index                       = 0;
+	int result                                 = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_parallel_split_block(
+	          assorted_test_lzma_parallel_resets_compressed_data,
+	          103,
+	          24,
+	          uncompressed_data,
+	          0,
+	          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE,
+	          0,
+	          &segments,
+	          &number_of_segments,
+	          &maximum_number_of_segments,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every LZMA2 chunk resets the dictionary hence every chunk is a segment
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_segments",
+	 number_of_segments,
+	 (size_t) 3 );
+
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "segments[ segment_index ].compressed_data_offset",
+		 segments[ segment_index ].compressed_data_offset,
+		 (size_t) ( 24 + ( segment_index * 26 ) ) );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "segments[ segment_index ].uncompressed_data_offset",
+		 segments[ segment_index ].uncompressed_data_offset,
+		 (size_t) ( segment_index * 1000 ) );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "segments[ segment_index ].uncompressed_data_end_offset",
+		 segments[ segment_index ].uncompressed_data_end_offset,
+		 (size_t) ( ( segment_index + 1 ) * 1000 ) );
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "segments[ 2 ].compressed_data_end_offset",
+	 segments[ 2 ].compressed_data_end_offset,
+	 (size_t) 103 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "segments[ 1 ].is_last_segment",
+	 segments[ 1 ].is_last_segment,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "segments[ 2 ].is_last_segment",
+	 segments[ 2 ].is_last_segment,
+	 1 );
+
+	/* Test that segments smaller than the minimum segment size are merged
+	 */
+	number_of_segments = 0;
+
+	result = assorted_lzma_parallel_split_block(
+	          assorted_test_lzma_parallel_resets_compressed_data,
+	          103,
+	          24,
+	          uncompressed_data,
+	          0,
+	          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE,
+	          1001,
+	          &segments,
+	          &number_of_segments,
+	          &maximum_number_of_segments,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_segments",
+	 number_of_segments,
+	 (size_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "segments[ 0 ].compressed_data_end_offset",
+	 segments[ 0 ].compressed_data_end_offset,
+	 (size_t) 76 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "segments[ 0 ].uncompressed_data_end_offset",
+	 segments[ 0 ].uncompressed_data_end_offset,
+	 (size_t) 2000 );
+
+	/* Test error cases
+	 */
+	number_of_segments = 0;
+
+	result = assorted_lzma_parallel_split_block(
+	          NULL,
+	          103,
+	          24,
+	          uncompressed_data,
+	          0,
+	          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE,
+	          0,
+	          &segments,
+	          &number_of_segments,
+	          &maximum_number_of_segments,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test splitting a block with an uncompressed size that does not match the LZMA2 chunks
+	 */
+	number_of_segments = 0;
+
+	result = assorted_lzma_parallel_split_block(
+	          assorted_test_lzma_parallel_resets_compressed_data,
+	          103,
+	          24,
+	          uncompressed_data,
+	          0,
+	          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE - 1,
+	          0,
+	          &segments,
+	          &number_of_segments,
+	          &maximum_number_of_segments,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test splitting a block that is missing the end of chunks control code
+	 */
+	number_of_segments = 0;
+
+	result = assorted_lzma_parallel_split_block(
+	          assorted_test_lzma_parallel_resets_compressed_data,
+	          102,
+	          24,
+	          uncompressed_data,
+	          0,
+	          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE,
+	          0,
+	          &segments,
+	          &number_of_segments,
+	          &maximum_number_of_segments,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 segments );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segments != NULL )
+	{
+		memory_free(
+		 segments );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_parallel_decompress_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_parallel_decompress_segment(
+     void )
+{
+	uint8_t data[ ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE ];
+	uint8_t uncompressed_data[ ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE ];
+
+	assorted_lzma_decoder_t *decoder           = NULL;
+	assorted_lzma_parallel_segment_t *segments = NULL;
+	libcerror_error_t *error                   = NULL;
+	size_t maximum_number_of_segments          = 0;
+	size_t number_of_segments                  = 0;
+	size_t segment_index                       = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	assorted_test_lzma_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE );
+
+	result = assorted_lzma_parallel_split_block(
+	          assorted_test_lzma_parallel_resets_compressed_data,
+	          103,
+	          24,
+	          uncompressed_data,
+	          0,
+	          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE,
+	          0,
+	          &segments,
+	          &number_of_segments,
+	          &maximum_number_of_segments,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_segments",
+	 number_of_segments,
+	 (size_t) 3 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = memory_set(
+	          uncompressed_data,
+	          0,
+	          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The segments are decompressed out of order since they do not depend on each other
+	 */
+	for( segment_index = 3;
+	     segment_index > 0;
+	     segment_index-- )
+	{
+		result = assorted_lzma_parallel_decompress_segment(
+		          &( segments[ segment_index - 1 ] ),
+		          decoder,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = memory_compare(
+	          uncompressed_data,
+	          data,
+	          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_parallel_decompress_segment(
+	          NULL,
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_parallel_decompress_segment(
+	          &( segments[ 0 ] ),
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing a segment that does not end where its uncompressed data ends
+	 */
+	segments[ 0 ].uncompressed_data_end_offset = 999;
+
+	result = assorted_lzma_parallel_decompress_segment(
+	          &( segments[ 0 ] ),
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_lzma_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 segments );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		assorted_lzma_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( segments != NULL )
+	{
+		memory_free(
+		 segments );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_parallel_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_parallel_decompress(
+     void )
+{
+	uint8_t data[ ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE ];
+	uint8_t uncompressed_data[ ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	assorted_test_lzma_parallel_fill_data(
+	 data,
+	 ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		uncompressed_data_size = ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE;
+
+		result = assorted_lzma_parallel_decompress(
+		          assorted_test_lzma_parallel_blocks_compressed_data,
+		          184,
+		          number_of_threads,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          data,
+		          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		uncompressed_data_size = ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE;
+
+		result = assorted_lzma_parallel_decompress(
+		          assorted_test_lzma_parallel_resets_compressed_data,
+		          132,
+		          number_of_threads,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          data,
+		          ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE;
+
+	result = assorted_lzma_parallel_decompress(
+	          NULL,
+	          184,
+	          1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_parallel_decompress(
+	          assorted_test_lzma_parallel_blocks_compressed_data,
+	          184,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_parallel_decompress(
+	          assorted_test_lzma_parallel_blocks_compressed_data,
+	          184,
+	          1,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing with an uncompressed data buffer that is too small
+	 */
+	uncompressed_data_size = ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE - 1;
+
+	result = assorted_lzma_parallel_decompress(
+	          assorted_test_lzma_parallel_blocks_compressed_data,
+	          184,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing truncated compressed data
+	 */
+	uncompressed_data_size = ASSORTED_TEST_LZMA_PARALLEL_DATA_SIZE;
+
+	result = assorted_lzma_parallel_decompress(
+	          assorted_test_lzma_parallel_blocks_compressed_data,
+	          183,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_parallel_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_parallel_compress(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	uint8_t *compressed_data                = NULL;
+	uint8_t *parallel_compressed_data       = NULL;
+	uint8_t *test_data                      = NULL;
+	uint8_t *uncompressed_data              = NULL;
+	size_t compressed_data_size             = 0;
+	size_t maximum_compressed_data_size     = 0;
+	size_t parallel_compressed_data_size    = 0;
+	size_t test_data_offset                 = 0;
+	size_t test_data_size                   = 0;
+	size_t uncompressed_data_size           = 0;
+	uint32_t random_value                   = 0x12345678UL;
+	int number_of_threads                   = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 * The test data is larger than 2 blocks of the fast compression preset
+	 */
+	test_data_size               = ( 7 * 1024 * 1024 ) + 1000;
+	maximum_compressed_data_size = test_data_size + ( test_data_size >> 10 ) + 1024;
+
+	test_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * test_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "test_data",
+	 test_data );
+
+	for( test_data_offset = 0;
+	     test_data_offset < test_data_size;
+	     test_data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		test_data[ test_data_offset ] = (uint8_t) "assorted"[ ( random_value >> 16 ) % 8 ];
+	}
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * maximum_compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data",
+	 compressed_data );
+
+	parallel_compressed_data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * maximum_compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_compressed_data",
+	 parallel_compressed_data );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * test_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	compressed_data_size = maximum_compressed_data_size;
+
+	result = assorted_lzma_compress(
+	          test_data,
+	          test_data_size,
+	          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The parallel compressed data is identical to the sequentially compressed data
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads++ )
+	{
+		parallel_compressed_data_size = maximum_compressed_data_size;
+
+		result = assorted_lzma_parallel_compress(
+		          test_data,
+		          test_data_size,
+		          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+		          number_of_threads,
+		          parallel_compressed_data,
+		          &parallel_compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "parallel_compressed_data_size",
+		 parallel_compressed_data_size,
+		 compressed_data_size );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          parallel_compressed_data,
+		          compressed_data,
+		          compressed_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test if the blocks are decompressed in parallel using the index
+	 */
+	uncompressed_data_size = test_data_size;
+
+	result = assorted_lzma_parallel_decompress(
+	          parallel_compressed_data,
+	          parallel_compressed_data_size,
+	          4,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 test_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          test_data,
+	          test_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	parallel_compressed_data_size = maximum_compressed_data_size;
+
+	result = assorted_lzma_parallel_compress(
+	          NULL,
+	          test_data_size,
+	          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+	          2,
+	          parallel_compressed_data,
+	          &parallel_compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_parallel_compress(
+	          test_data,
+	          test_data_size,
+	          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+	          0,
+	          parallel_compressed_data,
+	          &parallel_compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a compressed data size that is too small
+	 */
+	parallel_compressed_data_size = 4096;
+
+	result = assorted_lzma_parallel_compress(
+	          test_data,
+	          test_data_size,
+	          ASSORTED_LZMA_COMPRESSION_PRESET_FAST,
+	          2,
+	          parallel_compressed_data,
+	          &parallel_compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	memory_free(
+	 parallel_compressed_data );
+
+	parallel_compressed_data = NULL;
+
+	memory_free(
+	 compressed_data );
+
+	compressed_data = NULL;
+
+	memory_free(
+	 test_data );
+
+	test_data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( parallel_compressed_data != NULL )
+	{
+		memory_free(
+		 parallel_compressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( test_data != NULL )
+	{
+		memory_free(
+		 test_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZMA_PARALLEL_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_parallel_append_segment",
+	 assorted_test_lzma_parallel_append_segment );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_parallel_split_block",
+	 assorted_test_lzma_parallel_split_block );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_parallel_decompress_segment",
+	 assorted_test_lzma_parallel_decompress_segment );
+
+	/* TODO add tests for assorted_lzma_parallel_decompress_segment_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_parallel_decompress",
+	 assorted_test_lzma_parallel_decompress );
+
+	/* TODO add tests for assorted_lzma_parallel_compress_block */
+
+	/* TODO add tests for assorted_lzma_parallel_compress_block_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_parallel_compress",
+	 assorted_test_lzma_parallel_compress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -0,0 +1,1376 @@
+/*
+ * LZMA streaming decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_lzma.h"
+#include "../src/assorted_lzma_stream.h"
+
+/* Define to make assorted_test_lzma_stream generate verbose output
+#define ASSORTED_TEST_LZMA_STREAM_VERBOSE
+ */
+
+#define ASSORTED_TEST_LZMA_STREAM_DATA_SIZE	( 3 * 1024 * 1024 )
+
+/* xz compressed data of 3 MiB with a dictionary size of 4 KiB
+ */
+uint8_t assorted_test_lzma_stream_compressed_data[ 816 ] = {
+	0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x01, 0x69, 0x22, 0xde, 0x36, 0x03, 0xc0, 0xea, 0x01,
+	0x80, 0x80, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x81, 0xb5, 0x31, 0x0a, 0xef, 0xff, 0xff, 0x00,
+	0xe2, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x28, 0x99, 0x64, 0x80, 0x86, 0x5e, 0x3b, 0x97, 0xfe, 0xa4, 0x5c, 0x2a, 0xc9, 0x4b, 0x22,
+	0x2a, 0xf4, 0xab, 0x74, 0xdd, 0xf7, 0xcb, 0xff, 0xf5, 0x1f, 0xb6, 0x3b, 0xf8, 0xc1, 0xc3, 0x1c,
+	0x71, 0x97, 0xe7, 0xad, 0xe4, 0x99, 0x4c, 0x74, 0x37, 0x85, 0x14, 0x14, 0x43, 0x25, 0x5a, 0x25,
+	0x58, 0x0b, 0x2d, 0xad, 0x24, 0xa9, 0xa9, 0xf2, 0x4c, 0xc6, 0xc0, 0xdd, 0xba, 0x42, 0xdf, 0xe2,
+	0xb1, 0xdd, 0x18, 0x22, 0xc8, 0x4c, 0x21, 0x2a, 0x8d, 0x86, 0x5a, 0xca, 0xfc, 0x99, 0x0b, 0xa1,
+	0x5d, 0x49, 0xde, 0x26, 0x28, 0x94, 0x71, 0x1f, 0x3d, 0x8f, 0x24, 0xe1, 0x70, 0x9e, 0xa7, 0x23,
+	0x5f, 0xec, 0x28, 0xcb, 0x85, 0xd1, 0x95, 0x98, 0x8a, 0x7e, 0x2a, 0x91, 0xf2, 0x27, 0x75, 0xf7,
+	0x19, 0xc0, 0x06, 0x98, 0x4d, 0x98, 0xfd, 0xd8, 0xaf, 0xd5, 0x90, 0x0f, 0xc4, 0x25, 0x53, 0xf8,
+	0xf5, 0x91, 0x36, 0x31, 0x05, 0xa5, 0xb0, 0xee, 0x6f, 0xc1, 0x70, 0x4d, 0x47, 0x0c, 0xd1, 0x91,
+	0x11, 0xaa, 0xad, 0x60, 0x1d, 0xba, 0xce, 0xb1, 0x27, 0x18, 0x5c, 0x59, 0x86, 0xe9, 0x66, 0x52,
+	0x58, 0xbe, 0xe9, 0x76, 0xac, 0x59, 0xe4, 0xe5, 0x5b, 0x05, 0x08, 0xf9, 0xc7, 0xda, 0xad, 0xfc,
+	0xfb, 0x52, 0x2b, 0x74, 0xcd, 0x1e, 0x5b, 0x20, 0x42, 0xf9, 0xdd, 0x53, 0x3d, 0xf8, 0x29, 0x64,
+	0x09, 0x3b, 0x80, 0xcb, 0x2a, 0x6c, 0xdf, 0xb5, 0x3b, 0xf0, 0xc4, 0xbd, 0x2e, 0x5f, 0xaa, 0x0e,
+	0xa0, 0xa8, 0x37, 0x70, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x78, 0xf0, 0x78, 0x03, 0xc0, 0xea, 0x01,
+	0x80, 0x80, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x81, 0xb5, 0x31, 0x0a, 0xef, 0xff, 0xff, 0x00,
+	0xe2, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x28, 0x99, 0x64, 0x80, 0x86, 0x5e, 0x3b, 0x97, 0xfe, 0xa4, 0x5c, 0x2a, 0xc9, 0x4b, 0x22,
+	0x2a, 0xf4, 0xab, 0x74, 0xdd, 0xf7, 0xcb, 0xff, 0xf5, 0x1f, 0xb6, 0x3b, 0xf8, 0xc1, 0xc3, 0x1c,
+	0x71, 0x97, 0xe7, 0xad, 0xe4, 0x99, 0x4c, 0x74, 0x37, 0x85, 0x14, 0x14, 0x43, 0x25, 0x5a, 0x25,
+	0x58, 0x0b, 0x2d, 0xad, 0x24, 0xa9, 0xa9, 0xf2, 0x4c, 0xc6, 0xc0, 0xdd, 0xba, 0x42, 0xdf, 0xe2,
+	0xb1, 0xdd, 0x18, 0x22, 0xc8, 0x4c, 0x21, 0x2a, 0x8d, 0x86, 0x5a, 0xca, 0xfc, 0x99, 0x0b, 0xa1,
+	0x5d, 0x49, 0xde, 0x26, 0x28, 0x94, 0x71, 0x1f, 0x3d, 0x8f, 0x24, 0xe1, 0x70, 0x9e, 0xa7, 0x23,
+	0x5f, 0xec, 0x28, 0xcb, 0x85, 0xd1, 0x95, 0x98, 0x8a, 0x7e, 0x2a, 0x91, 0xf2, 0x27, 0x75, 0xf7,
+	0x19, 0xc0, 0x06, 0x98, 0x4d, 0x98, 0xfd, 0xd8, 0xaf, 0xd5, 0x90, 0x0f, 0xc4, 0x25, 0x53, 0xf8,
+	0xf5, 0x91, 0x36, 0x31, 0x05, 0xa5, 0xb0, 0xee, 0x6f, 0xc1, 0x70, 0x4d, 0x47, 0x0c, 0xd1, 0x91,
+	0x11, 0xaa, 0xad, 0x60, 0x1d, 0xba, 0xce, 0xb1, 0x27, 0x18, 0x5c, 0x59, 0x86, 0xe9, 0x66, 0x52,
+	0x58, 0xbe, 0xe9, 0x76, 0xac, 0x59, 0xe4, 0xe5, 0x5b, 0x05, 0x08, 0xf9, 0xc7, 0xda, 0xad, 0xfc,
+	0xfb, 0x52, 0x2b, 0x74, 0xcd, 0x1e, 0x5b, 0x20, 0x42, 0xf9, 0xdd, 0x53, 0x3d, 0xf8, 0x29, 0x64,
+	0x09, 0x3b, 0x80, 0xcb, 0x2a, 0x6c, 0xdf, 0xb5, 0x3b, 0xf0, 0xc4, 0xbd, 0x2e, 0x5f, 0xaa, 0x0e,
+	0xa0, 0xa8, 0x37, 0x70, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x78, 0xf0, 0x78, 0x03, 0xc0, 0xea, 0x01,
+	0x80, 0x80, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00, 0x81, 0xb5, 0x31, 0x0a, 0xef, 0xff, 0xff, 0x00,
+	0xe2, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x28, 0x99, 0x64, 0x80, 0x86, 0x5e, 0x3b, 0x97, 0xfe, 0xa4, 0x5c, 0x2a, 0xc9, 0x4b, 0x22,
+	0x2a, 0xf4, 0xab, 0x74, 0xdd, 0xf7, 0xcb, 0xff, 0xf5, 0x1f, 0xb6, 0x3b, 0xf8, 0xc1, 0xc3, 0x1c,
+	0x71, 0x97, 0xe7, 0xad, 0xe4, 0x99, 0x4c, 0x74, 0x37, 0x85, 0x14, 0x14, 0x43, 0x25, 0x5a, 0x25,
+	0x58, 0x0b, 0x2d, 0xad, 0x24, 0xa9, 0xa9, 0xf2, 0x4c, 0xc6, 0xc0, 0xdd, 0xba, 0x42, 0xdf, 0xe2,
+	0xb1, 0xdd, 0x18, 0x22, 0xc8, 0x4c, 0x21, 0x2a, 0x8d, 0x86, 0x5a, 0xca, 0xfc, 0x99, 0x0b, 0xa1,
+	0x5d, 0x49, 0xde, 0x26, 0x28, 0x94, 0x71, 0x1f, 0x3d, 0x8f, 0x24, 0xe1, 0x70, 0x9e, 0xa7, 0x23,
+	0x5f, 0xec, 0x28, 0xcb, 0x85, 0xd1, 0x95, 0x98, 0x8a, 0x7e, 0x2a, 0x91, 0xf2, 0x27, 0x75, 0xf7,
+	0x19, 0xc0, 0x06, 0x98, 0x4d, 0x98, 0xfd, 0xd8, 0xaf, 0xd5, 0x90, 0x0f, 0xc4, 0x25, 0x53, 0xf8,
+	0xf5, 0x91, 0x36, 0x31, 0x05, 0xa5, 0xb0, 0xee, 0x6f, 0xc1, 0x70, 0x4d, 0x47, 0x0c, 0xd1, 0x91,
+	0x11, 0xaa, 0xad, 0x60, 0x1d, 0xba, 0xce, 0xb1, 0x27, 0x18, 0x5c, 0x59, 0x86, 0xe9, 0x66, 0x52,
+	0x58, 0xbe, 0xe9, 0x76, 0xac, 0x59, 0xe4, 0xe5, 0x5b, 0x05, 0x08, 0xf9, 0xc7, 0xda, 0xad, 0xfc,
+	0xfb, 0x52, 0x2b, 0x74, 0xcd, 0x1e, 0x5b, 0x20, 0x42, 0xf9, 0xdd, 0x53, 0x3d, 0xf8, 0x29, 0x64,
+	0x09, 0x3b, 0x80, 0xcb, 0x2a, 0x6c, 0xdf, 0xb5, 0x3b, 0xf0, 0xc4, 0xbd, 0x2e, 0x5f, 0xaa, 0x0e,
+	0xa0, 0xa8, 0x37, 0x70, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x78, 0xf0, 0x78, 0x00, 0x03, 0xfe, 0x01,
+	0x80, 0x80, 0x40, 0xfe, 0x01, 0x80, 0x80, 0x40, 0xfe, 0x01, 0x80, 0x80, 0x40, 0x00, 0x00, 0x00,
+	0xf7, 0x8b, 0xb7, 0x4a, 0x86, 0x00, 0x08, 0x96, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x5a
+};
+
+/* xz compressed data with 3 blocks of 1000 bytes each
+ */
+uint8_t assorted_test_lzma_stream_blocks_compressed_data[ 184 ] = {
+	0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x01, 0x69, 0x22, 0xde, 0x36, 0x03, 0xc0, 0x1b, 0xe8,
+	0x07, 0x21, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xeb, 0xb1, 0xb4, 0xe0, 0x03, 0xe7, 0x00,
+	0x13, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x27, 0x1b, 0xc0, 0x3a, 0x00, 0x00, 0x00, 0x72, 0xf2, 0xa6, 0x22, 0x03, 0xc0, 0x1b, 0xe8,
+	0x07, 0x21, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xeb, 0xb1, 0xb4, 0xe0, 0x03, 0xe7, 0x00,
+	0x13, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x27, 0x1b, 0xc0, 0x3a, 0x00, 0x00, 0x00, 0x72, 0xf2, 0xa6, 0x22, 0x03, 0xc0, 0x1b, 0xe8,
+	0x07, 0x21, 0x01, 0x16, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xeb, 0xb1, 0xb4, 0xe0, 0x03, 0xe7, 0x00,
+	0x13, 0x5d, 0x00, 0x30, 0x9c, 0xec, 0xde, 0x74, 0x85, 0x13, 0x99, 0xde, 0x72, 0x9d, 0x7e, 0x8b,
+	0xb2, 0x27, 0x1b, 0xc0, 0x3a, 0x00, 0x00, 0x00, 0x72, 0xf2, 0xa6, 0x22, 0x00, 0x03, 0x2f, 0xe8,
+	0x07, 0x2f, 0xe8, 0x07, 0x2f, 0xe8, 0x07, 0x00, 0xe4, 0x76, 0x69, 0xb6, 0x9b, 0xe3, 0x51, 0x40,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x5a
+};
+
+/* Compares the uncompressed data written by the stream with the uncompressed data of the compressed test data
+ * The sink contains the offset of the data
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_test_lzma_stream_write_data(
+     intptr_t *sink,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const char *string = "assorted";
+	size_t *offset     = (size_t *) sink;
+	size_t data_offset = 0;
+
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( error )
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( data[ data_offset ] != (uint8_t) string[ ( *offset + data_offset ) % 8 ] )
+		{
+			return( -1 );
+		}
+	}
+	*offset += data_size;
+
+	return( 1 );
+}
+
+/* Fails to write the uncompressed data written by the stream
+ * Returns -1
+ */
+int assorted_test_lzma_stream_write_data_failure(
+     intptr_t *sink ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error ASSORTED_TEST_ATTRIBUTE_UNUSED )
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( sink )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( data )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( data_size )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_lzma_stream_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_stream_initialize(
+     void )
+{
+	assorted_lzma_stream_t *stream = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_stream_initialize(
+	          &stream,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_stream_initialize(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream = (assorted_lzma_stream_t *) 0x12345678UL;
+
+	result = assorted_lzma_stream_initialize(
+	          &stream,
+	          NULL,
+	          NULL,
+	          &error );
+
+	stream = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_lzma_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_stream_free function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_stream_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_stream_free(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_stream_set_dictionary_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_stream_set_dictionary_size(
+     void )
+{
+	assorted_lzma_stream_t *stream = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_lzma_stream_initialize(
+	          &stream,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_stream_set_dictionary_size(
+	          stream,
+	          4095,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "stream->history_size",
+	 stream->history_size,
+	 (size_t) ( 4096 + 16 ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "stream->maximum_window_size",
+	 stream->maximum_window_size,
+	 (size_t) ( ( 2 * ( 4096 + 16 ) ) + ASSORTED_LZMA_STREAM_MAXIMUM_CHUNK_SIZE ) );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_stream_set_dictionary_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_lzma_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_lzma_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_stream_prepare_window function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_stream_prepare_window(
+     void )
+{
+	assorted_lzma_stream_t *stream = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_lzma_stream_initialize(
+	          &stream,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_stream_set_dictionary_size(
+	          stream,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test growing the window
+	 */
+	result = assorted_lzma_stream_prepare_window(
+	          stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream->window",
+	 stream->window );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "stream->window_size",
+	 stream->window_size,
+	 stream->maximum_window_size );
+
+	/* Test moving the history to the start of a full window
+	 */
+	stream->window_offset     = stream->window_size - 16;
+	stream->output_offset     = 0;
+	stream->dictionary_offset = 5;
+
+	result = assorted_lzma_stream_prepare_window(
+	          stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "stream->window_offset",
+	 stream->window_offset,
+	 stream->history_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "stream->output_offset",
+	 stream->output_offset,
+	 stream->history_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "stream->dictionary_offset",
+	 stream->dictionary_offset,
+	 (size_t) 5 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "stream->uncompressed_data_size",
+	 stream->uncompressed_data_size,
+	 (uint64_t) ( stream->maximum_window_size - 16 ) );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_stream_prepare_window(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_lzma_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_lzma_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_stream_get_lzma2_chunk_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_stream_get_lzma2_chunk_size(
+     void )
+{
+	uint8_t compressed_chunk_header[ 6 ]   = { 0xe0, 0x00, 0xff, 0x00, 0x23, 0x5d };
+	uint8_t uncompressed_chunk_header[ 3 ] = { 0x01, 0x03, 0xe7 };
+	uint8_t end_of_chunks[ 1 ]             = { 0x00 };
+	uint8_t invalid_control_code[ 1 ]      = { 0x7f };
+	libcerror_error_t *error               = NULL;
+	size_t chunk_size                      = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_stream_get_lzma2_chunk_size(
+	          end_of_chunks,
+	          1,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_stream_get_lzma2_chunk_size(
+	          uncompressed_chunk_header,
+	          3,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) ( 3 + 1000 ) );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_stream_get_lzma2_chunk_size(
+	          compressed_chunk_header,
+	          6,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) ( 6 + 36 ) );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an incomplete chunk header
+	 */
+	result = assorted_lzma_stream_get_lzma2_chunk_size(
+	          compressed_chunk_header,
+	          5,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_stream_get_lzma2_chunk_size(
+	          compressed_chunk_header,
+	          0,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_stream_get_lzma2_chunk_size(
+	          NULL,
+	          1,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_stream_get_lzma2_chunk_size(
+	          end_of_chunks,
+	          1,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_stream_get_lzma2_chunk_size(
+	          invalid_control_code,
+	          1,
+	          &chunk_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_stream_feed function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_stream_feed(
+     void )
+{
+	assorted_lzma_stream_t *stream = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t compressed_data_offset  = 0;
+	size_t compressed_data_size    = 0;
+	size_t data_offset             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_lzma_stream_initialize(
+	          &stream,
+	          &assorted_test_lzma_stream_write_data,
+	          (intptr_t *) &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test feeding the compressed data 1 byte at a time, where an
+	 * incomplete part is provided again with the next byte
+	 */
+	result = 0;
+
+	for( compressed_data_size = 1;
+	     compressed_data_size <= 816;
+	     compressed_data_size++ )
+	{
+		result = assorted_lzma_stream_feed(
+		          stream,
+		          assorted_test_lzma_stream_compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          (uint8_t) ( compressed_data_size == 816 ),
+		          &error );
+
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_offset",
+	 compressed_data_offset,
+	 (size_t) 816 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) ASSORTED_TEST_LZMA_STREAM_DATA_SIZE );
+
+	/* Test that the index is not read from input that is not final
+	 */
+	data_offset                    = 0;
+	compressed_data_offset         = 0;
+	stream->state                  = ASSORTED_LZMA_STREAM_STATE_STREAM_HEADER;
+	stream->uncompressed_data_size = 0;
+
+	result = assorted_lzma_stream_feed(
+	          stream,
+	          assorted_test_lzma_stream_blocks_compressed_data,
+	          184,
+	          &compressed_data_offset,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 3000 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "stream->state",
+	 (int) stream->state,
+	 (int) ASSORTED_LZMA_STREAM_STATE_INDEX );
+
+	result = assorted_lzma_stream_feed(
+	          stream,
+	          assorted_test_lzma_stream_blocks_compressed_data,
+	          184,
+	          &compressed_data_offset,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test feeding truncated compressed data as final input
+	 */
+	compressed_data_offset = 0;
+	stream->state          = ASSORTED_LZMA_STREAM_STATE_STREAM_HEADER;
+
+	result = assorted_lzma_stream_feed(
+	          stream,
+	          assorted_test_lzma_stream_blocks_compressed_data,
+	          100,
+	          &compressed_data_offset,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	compressed_data_offset = 0;
+
+	result = assorted_lzma_stream_feed(
+	          NULL,
+	          assorted_test_lzma_stream_blocks_compressed_data,
+	          184,
+	          &compressed_data_offset,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_stream_feed(
+	          stream,
+	          NULL,
+	          184,
+	          &compressed_data_offset,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_stream_feed(
+	          stream,
+	          assorted_test_lzma_stream_blocks_compressed_data,
+	          184,
+	          NULL,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_offset = 185;
+
+	result = assorted_lzma_stream_feed(
+	          stream,
+	          assorted_test_lzma_stream_blocks_compressed_data,
+	          184,
+	          &compressed_data_offset,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_lzma_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_lzma_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzma_stream_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzma_stream_decompress(
+     void )
+{
+	uint8_t compressed_data[ 184 ];
+
+	assorted_lzma_stream_t *stream = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t data_offset             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_lzma_stream_initialize(
+	          &stream,
+	          &assorted_test_lzma_stream_write_data,
+	          (intptr_t *) &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_lzma_stream_decompress(
+	          stream,
+	          assorted_test_lzma_stream_compressed_data,
+	          816,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) ASSORTED_TEST_LZMA_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "stream->uncompressed_data_size",
+	 stream->uncompressed_data_size,
+	 (uint64_t) ASSORTED_TEST_LZMA_STREAM_DATA_SIZE );
+
+	/* The window is bounded by the dictionary size of 4 KiB
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "stream->window_size",
+	 stream->window_size,
+	 stream->maximum_window_size );
+
+	result = ( stream->window_size < ASSORTED_TEST_LZMA_STREAM_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test decompressing multiple blocks
+	 */
+	data_offset                    = 0;
+	stream->uncompressed_data_size = 0;
+
+	result = assorted_lzma_stream_decompress(
+	          stream,
+	          assorted_test_lzma_stream_blocks_compressed_data,
+	          184,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 3000 );
+
+	/* Test decompressing a block with a CRC-32 check that does not match
+	 */
+	memory_copy(
+	 compressed_data,
+	 assorted_test_lzma_stream_blocks_compressed_data,
+	 184 );
+
+	compressed_data[ 56 ] ^= 0x01;
+
+	data_offset = 0;
+
+	result = assorted_lzma_stream_decompress(
+	          stream,
+	          compressed_data,
+	          184,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzma_stream_decompress(
+	          NULL,
+	          assorted_test_lzma_stream_compressed_data,
+	          816,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_stream_decompress(
+	          stream,
+	          NULL,
+	          816,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompressing truncated compressed data
+	 */
+	result = assorted_lzma_stream_decompress(
+	          stream,
+	          assorted_test_lzma_stream_compressed_data,
+	          400,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_lzma_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decompressing with a write function that fails
+	 */
+	result = assorted_lzma_stream_initialize(
+	          &stream,
+	          &assorted_test_lzma_stream_write_data_failure,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_lzma_stream_decompress(
+	          stream,
+	          assorted_test_lzma_stream_blocks_compressed_data,
+	          184,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzma_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		assorted_lzma_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZMA_STREAM_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_stream_initialize",
+	 assorted_test_lzma_stream_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_stream_free",
+	 assorted_test_lzma_stream_free );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_stream_set_dictionary_size",
+	 assorted_test_lzma_stream_set_dictionary_size );
+
+	/* TODO add tests for assorted_lzma_stream_write_output */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_stream_prepare_window",
+	 assorted_test_lzma_stream_prepare_window );
+
+	/* TODO add tests for assorted_lzma_stream_read_lzma2_block */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_stream_get_lzma2_chunk_size",
+	 assorted_test_lzma_stream_get_lzma2_chunk_size );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_stream_feed",
+	 assorted_test_lzma_stream_feed );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzma_stream_decompress",
+	 assorted_test_lzma_stream_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
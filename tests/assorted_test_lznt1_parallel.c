@@ -0,0 +1,682 @@
+/*
+ * LZNT1 parallel decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_lznt1_parallel.h"
+
+/* Define to make assorted_test_lznt1_parallel generate verbose output
+#define ASSORTED_TEST_LZNT1_PARALLEL_VERBOSE
+ */
+
+#define ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS	40
+
+/* A compressed chunk of 43 bytes that decompresses into 408 bytes
+ * of repetitions of: "assorted LZNT1 parallel test data "
+ */
+uint8_t assorted_test_lznt1_parallel_compressed_chunk[ 43 ] = {
+	0x28, 0xb0, 0x00, 0x61, 0x73, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x00, 0x20, 0x4c, 0x5a, 0x4e,
+	0x54, 0x31, 0x20, 0x70, 0x00, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x20, 0x00, 0x74, 0x65,
+	0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x04, 0x61, 0x20, 0x73, 0x85 };
+
+uint8_t assorted_test_lznt1_parallel_compressed_data[ ( ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ( 2 + ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE ) ) + 2 ];
+uint8_t assorted_test_lznt1_parallel_uncompressed_data[ ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE ];
+uint8_t assorted_test_lznt1_parallel_decompressed_data[ ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE ];
+
+size_t assorted_test_lznt1_parallel_compressed_data_size   = 0;
+size_t assorted_test_lznt1_parallel_uncompressed_data_size = 0;
+
+/* Creates the test data
+ * Every 5th chunk is a compressed chunk that decompresses into less than 4096 bytes
+ * the other chunks are uncompressed chunks
+ */
+void assorted_test_lznt1_parallel_initialize_data(
+      void )
+{
+	const char *pattern             = "assorted LZNT1 parallel test data ";
+	size_t chunk_index              = 0;
+	size_t compressed_data_offset   = 0;
+	size_t data_offset              = 0;
+	size_t uncompressed_data_offset = 0;
+
+	for( chunk_index = 0;
+	     chunk_index < ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS;
+	     chunk_index++ )
+	{
+		if( ( chunk_index % 5 ) == 4 )
+		{
+			memory_copy(
+			 &( assorted_test_lznt1_parallel_compressed_data[ compressed_data_offset ] ),
+			 assorted_test_lznt1_parallel_compressed_chunk,
+			 43 );
+
+			compressed_data_offset += 43;
+
+			for( data_offset = 0;
+			     data_offset < 408;
+			     data_offset++ )
+			{
+				assorted_test_lznt1_parallel_uncompressed_data[ uncompressed_data_offset++ ] = (uint8_t) pattern[ data_offset % 34 ];
+			}
+		}
+		else
+		{
+			/* An uncompressed chunk with chunk header: 0x3fff
+			 */
+			assorted_test_lznt1_parallel_compressed_data[ compressed_data_offset++ ] = 0xff;
+			assorted_test_lznt1_parallel_compressed_data[ compressed_data_offset++ ] = 0x3f;
+
+			for( data_offset = 0;
+			     data_offset < ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE;
+			     data_offset++ )
+			{
+				assorted_test_lznt1_parallel_uncompressed_data[ uncompressed_data_offset ] = (uint8_t) ( ( chunk_index * 7 ) + ( data_offset / 3 ) );
+
+				assorted_test_lznt1_parallel_compressed_data[ compressed_data_offset++ ] = assorted_test_lznt1_parallel_uncompressed_data[ uncompressed_data_offset++ ];
+			}
+		}
+	}
+	/* The end of the compressed data
+	 */
+	assorted_test_lznt1_parallel_compressed_data[ compressed_data_offset++ ] = 0x00;
+	assorted_test_lznt1_parallel_compressed_data[ compressed_data_offset++ ] = 0x00;
+
+	assorted_test_lznt1_parallel_compressed_data_size   = compressed_data_offset;
+	assorted_test_lznt1_parallel_uncompressed_data_size = uncompressed_data_offset;
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_lznt1_parallel_get_number_of_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lznt1_parallel_get_number_of_chunks(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t number_of_chunks  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lznt1_parallel_get_number_of_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 (size_t) ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test compressed data without the end of the compressed data
+	 */
+	result = assorted_lznt1_parallel_get_number_of_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size - 2,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 (size_t) ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_lznt1_parallel_get_number_of_chunks(
+	          NULL,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lznt1_parallel_get_number_of_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lznt1_parallel_get_number_of_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test truncated compressed data
+	 */
+	result = assorted_lznt1_parallel_get_number_of_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          100,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lznt1_parallel_get_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lznt1_parallel_get_chunks(
+     void )
+{
+	assorted_lznt1_parallel_chunk_t chunks[ ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lznt1_parallel_get_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE,
+	          chunks,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunks[ 4 ].compressed_data_size",
+	 chunks[ 4 ].compressed_data_size,
+	 (size_t) 43 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunks[ 5 ].compressed_data_size",
+	 chunks[ 5 ].compressed_data_size,
+	 (size_t) ( 2 + ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "chunks[ 5 ].compressed_data offset",
+	 (int) ( chunks[ 5 ].compressed_data - assorted_test_lznt1_parallel_compressed_data ),
+	 ( 4 * ( 2 + ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE ) ) + 43 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "chunks[ 5 ].uncompressed_data offset",
+	 (int) ( chunks[ 5 ].uncompressed_data - assorted_test_lznt1_parallel_decompressed_data ),
+	 5 * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunks[ 5 ].uncompressed_data_size",
+	 chunks[ 5 ].uncompressed_data_size,
+	 (size_t) ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE );
+
+	/* Test error cases
+	 */
+	result = assorted_lznt1_parallel_get_chunks(
+	          NULL,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE,
+	          chunks,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lznt1_parallel_get_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          NULL,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE,
+	          chunks,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lznt1_parallel_get_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE,
+	          NULL,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test more chunks than in the compressed data
+	 */
+	result = assorted_lznt1_parallel_get_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE,
+	          chunks,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed data too small
+	 */
+	result = assorted_lznt1_parallel_get_chunks(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE,
+	          chunks,
+	          ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lznt1_parallel_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lznt1_parallel_decompress(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads += 3 )
+	{
+		memory_set(
+		 assorted_test_lznt1_parallel_decompressed_data,
+		 0,
+		 ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE );
+
+		uncompressed_data_size = ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE;
+
+		result = assorted_lznt1_parallel_decompress(
+		          assorted_test_lznt1_parallel_compressed_data,
+		          assorted_test_lznt1_parallel_compressed_data_size,
+		          assorted_test_lznt1_parallel_decompressed_data,
+		          &uncompressed_data_size,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 assorted_test_lznt1_parallel_uncompressed_data_size );
+
+		result = memory_compare(
+		          assorted_test_lznt1_parallel_decompressed_data,
+		          assorted_test_lznt1_parallel_uncompressed_data,
+		          assorted_test_lznt1_parallel_uncompressed_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test decompressing no chunks
+	 */
+	uncompressed_data_size = ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE;
+
+	result = assorted_lznt1_parallel_decompress(
+	          &( assorted_test_lznt1_parallel_compressed_data[ assorted_test_lznt1_parallel_compressed_data_size - 2 ] ),
+	          2,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 0 );
+
+	/* Test decompressing where one chunk is corrupted
+	 * the flag byte of the last tokens of the compressed chunk is changed
+	 * so that the last back-reference is truncated
+	 */
+	assorted_test_lznt1_parallel_compressed_data[ ( 4 * ( 2 + ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE ) ) + 38 ] = 0x06;
+
+	uncompressed_data_size = ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE;
+
+	result = assorted_lznt1_parallel_decompress(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	assorted_test_lznt1_parallel_compressed_data[ ( 4 * ( 2 + ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE ) ) + 38 ] = 0x04;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_LZNT1_PARALLEL_NUMBER_OF_CHUNKS * ASSORTED_LZNT1_PARALLEL_CHUNK_SIZE;
+
+	result = assorted_lznt1_parallel_decompress(
+	          NULL,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lznt1_parallel_decompress(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          NULL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lznt1_parallel_decompress(
+	          assorted_test_lznt1_parallel_compressed_data,
+	          assorted_test_lznt1_parallel_compressed_data_size,
+	          assorted_test_lznt1_parallel_decompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZNT1_PARALLEL_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	assorted_test_lznt1_parallel_initialize_data();
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lznt1_parallel_get_number_of_chunks",
+	 assorted_test_lznt1_parallel_get_number_of_chunks );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lznt1_parallel_get_chunks",
+	 assorted_test_lznt1_parallel_get_chunks );
+
+	/* TODO add tests for assorted_lznt1_parallel_decompress_chunks */
+
+	/* TODO add tests for assorted_lznt1_parallel_decompress_task_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lznt1_parallel_decompress",
+	 assorted_test_lznt1_parallel_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -0,0 +1,518 @@
+/*
+ * ZIP archive member decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_lzvn.h"
+
+/* Define to make assorted_test_lzvn generate verbose output
+#define ASSORTED_TEST_LZVN_VERBOSE
+ */
+
+uint8_t assorted_test_lzvn_uncompressed_data[ 90 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	'h', 'e', ' ', 'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g', '.', ' ', 'T', 'h', 'e',
+	' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ', 'f', 'o', 'x',
+	' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't', 'h', 'e', ' ',
+	'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g', '.', '\n' };
+
+uint8_t assorted_test_lzvn_compressed_data[ 62 ] = {
+	0x0e, 0xe0, 0x0d, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f,
+	0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65,
+	0xc0, 0x1f, 0x72, 0x20, 0x74, 0xe7, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0xc8, 0x2d, 0x67,
+	0x2e, 0x20, 0xf0, 0x18, 0xe1, 0x0a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_lzvn_decompress_block function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_decompress_block(
+     void )
+{
+	uint8_t compressed_data[ 2 ];
+	uint8_t uncompressed_data[ 100 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t uncompressed_data_offset = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 uncompressed_data,
+	 0,
+	 100 );
+
+	uncompressed_data_offset = 10;
+
+	result = assorted_lzvn_decompress_block(
+	          assorted_test_lzvn_compressed_data,
+	          62,
+	          uncompressed_data,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 100 );
+
+	result = memory_compare(
+	          &( uncompressed_data[ 10 ] ),
+	          assorted_test_lzvn_uncompressed_data,
+	          90 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a match that refers to data that precedes the uncompressed data offset
+	 */
+	compressed_data[ 0 ] = 0x00;
+	compressed_data[ 1 ] = 0x0a;
+
+	uncompressed_data_offset = 10;
+
+	result = assorted_lzvn_decompress_block(
+	          compressed_data,
+	          2,
+	          uncompressed_data,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 13 );
+
+	result = memory_compare(
+	          &( uncompressed_data[ 10 ] ),
+	          uncompressed_data,
+	          3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_offset = 0;
+
+	result = assorted_lzvn_decompress_block(
+	          NULL,
+	          62,
+	          uncompressed_data,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzvn_decompress_block(
+	          assorted_test_lzvn_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzvn_decompress_block(
+	          assorted_test_lzvn_compressed_data,
+	          62,
+	          NULL,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzvn_decompress_block(
+	          assorted_test_lzvn_compressed_data,
+	          62,
+	          uncompressed_data,
+	          100,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_offset = 101;
+
+	result = assorted_lzvn_decompress_block(
+	          assorted_test_lzvn_compressed_data,
+	          62,
+	          uncompressed_data,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the uncompressed data is too small
+	 */
+	uncompressed_data_offset = 0;
+
+	result = assorted_lzvn_decompress_block(
+	          assorted_test_lzvn_compressed_data,
+	          62,
+	          uncompressed_data,
+	          89,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the compressed data is truncated
+	 */
+	uncompressed_data_offset = 0;
+
+	result = assorted_lzvn_decompress_block(
+	          assorted_test_lzvn_compressed_data,
+	          10,
+	          uncompressed_data,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the match distance exceeds the uncompressed data offset
+	 */
+	uncompressed_data_offset = 2;
+
+	result = assorted_lzvn_decompress_block(
+	          compressed_data,
+	          2,
+	          uncompressed_data,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the opcode is undefined
+	 */
+	compressed_data[ 0 ] = 0x70;
+
+	uncompressed_data_offset = 10;
+
+	result = assorted_lzvn_decompress_block(
+	          compressed_data,
+	          2,
+	          uncompressed_data,
+	          100,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzvn_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 100 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 uncompressed_data,
+	 0,
+	 100 );
+
+	uncompressed_data_size = 100;
+
+	result = assorted_lzvn_decompress(
+	          assorted_test_lzvn_compressed_data,
+	          62,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 90 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzvn_uncompressed_data,
+	          90 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_lzvn_decompress(
+	          assorted_test_lzvn_compressed_data,
+	          62,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 89;
+
+	result = assorted_lzvn_decompress(
+	          assorted_test_lzvn_compressed_data,
+	          62,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZVN_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzvn_decompress_block",
+	 assorted_test_lzvn_decompress_block );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzvn_decompress",
+	 assorted_test_lzvn_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
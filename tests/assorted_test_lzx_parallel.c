@@ -0,0 +1,883 @@
+/*
+ * LZX parallel decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_lzx_parallel.h"
+
+/* Define to make assorted_test_lzx_parallel generate verbose output
+#define ASSORTED_TEST_LZX_PARALLEL_VERBOSE
+ */
+
+#define ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE	512
+
+/* A WIM style reset table with 4-byte entries that does not contain
+ * the offset of the first frame
+ */
+uint8_t assorted_test_lzx_parallel_reset_table_data[ 16 ] = {
+	0x64, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00 };
+
+/* A reset table with 8-byte entries
+ */
+uint8_t assorted_test_lzx_parallel_reset_table_data_64bit[ 16 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint64_t assorted_test_lzx_parallel_reset_offsets[ 5 ] = {
+	0, 100, 200, 300, 400 };
+
+/* The compressed data is not valid LZX compressed data
+ */
+uint8_t assorted_test_lzx_parallel_compressed_data[ ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE ];
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_lzx_parallel_get_reset_offsets function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzx_parallel_get_reset_offsets(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint64_t *reset_offsets        = NULL;
+	size_t number_of_reset_offsets = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          assorted_test_lzx_parallel_reset_table_data,
+	          16,
+	          4,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          &reset_offsets,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "reset_offsets",
+	 reset_offsets );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_reset_offsets",
+	 number_of_reset_offsets,
+	 (size_t) 5 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "reset_offsets[ 0 ]",
+	 reset_offsets[ 0 ],
+	 (uint64_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "reset_offsets[ 4 ]",
+	 reset_offsets[ 4 ],
+	 (uint64_t) 400 );
+
+	memory_free(
+	 reset_offsets );
+
+	reset_offsets = NULL;
+
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          assorted_test_lzx_parallel_reset_table_data_64bit,
+	          16,
+	          8,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          &reset_offsets,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "reset_offsets",
+	 reset_offsets );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_reset_offsets",
+	 number_of_reset_offsets,
+	 (size_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "reset_offsets[ 1 ]",
+	 reset_offsets[ 1 ],
+	 (uint64_t) 256 );
+
+	memory_free(
+	 reset_offsets );
+
+	reset_offsets = NULL;
+
+	/* Test error cases
+	 */
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          NULL,
+	          16,
+	          4,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          &reset_offsets,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          assorted_test_lzx_parallel_reset_table_data,
+	          (size_t) SSIZE_MAX + 1,
+	          4,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          &reset_offsets,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          assorted_test_lzx_parallel_reset_table_data,
+	          16,
+	          2,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          &reset_offsets,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          assorted_test_lzx_parallel_reset_table_data,
+	          15,
+	          4,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          &reset_offsets,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          assorted_test_lzx_parallel_reset_table_data,
+	          16,
+	          4,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          NULL,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          assorted_test_lzx_parallel_reset_table_data,
+	          16,
+	          4,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          &reset_offsets,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a reset offset exceeds the compressed data size
+	 */
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          assorted_test_lzx_parallel_reset_table_data,
+	          16,
+	          4,
+	          400,
+	          &reset_offsets,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the reset offsets are not increasing
+	 */
+	result = assorted_lzx_parallel_get_reset_offsets(
+	          &( assorted_test_lzx_parallel_reset_table_data_64bit[ 8 ] ),
+	          8,
+	          4,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          &reset_offsets,
+	          &number_of_reset_offsets,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reset_offsets != NULL )
+	{
+		memory_free(
+		 reset_offsets );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzx_parallel_get_frames function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzx_parallel_get_frames(
+     void )
+{
+	assorted_lzx_parallel_frame_t frames[ 4 ];
+	uint8_t uncompressed_data[ 4096 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzx_parallel_get_frames(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          1,
+	          uncompressed_data,
+	          4096,
+	          frames,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INTPTR(
+	 "frames[ 0 ].compressed_data",
+	 (intptr_t) frames[ 0 ].compressed_data,
+	 (intptr_t) &( assorted_test_lzx_parallel_compressed_data[ 100 ] ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "frames[ 0 ].compressed_data_size",
+	 frames[ 0 ].compressed_data_size,
+	 (size_t) 100 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "frames[ 3 ].compressed_data_size",
+	 frames[ 3 ].compressed_data_size,
+	 (size_t) ( ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE - 400 ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INTPTR(
+	 "frames[ 2 ].uncompressed_data",
+	 (intptr_t) frames[ 2 ].uncompressed_data,
+	 (intptr_t) &( uncompressed_data[ 2048 ] ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "frames[ 3 ].uncompressed_data_size",
+	 frames[ 3 ].uncompressed_data_size,
+	 (size_t) 1024 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "frames[ 3 ].result",
+	 frames[ 3 ].result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_lzx_parallel_get_frames(
+	          NULL,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          1,
+	          uncompressed_data,
+	          4096,
+	          frames,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_frames(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          NULL,
+	          5,
+	          1024,
+	          1,
+	          uncompressed_data,
+	          4096,
+	          frames,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_frames(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          0,
+	          1,
+	          uncompressed_data,
+	          4096,
+	          frames,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_frames(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          2,
+	          uncompressed_data,
+	          4096,
+	          frames,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_frames(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          1,
+	          NULL,
+	          4096,
+	          frames,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_get_frames(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          1,
+	          uncompressed_data,
+	          4096,
+	          NULL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the uncompressed data is too small
+	 */
+	result = assorted_lzx_parallel_get_frames(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          1,
+	          uncompressed_data,
+	          3072,
+	          frames,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzx_parallel_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzx_parallel_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 4096 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test decompressing a range beyond the end of the data
+	 */
+	uncompressed_data_size = 4096;
+
+	result = assorted_lzx_parallel_decompress(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          5 * 1024,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 0 );
+
+	/* Test decompressing invalid compressed data
+	 */
+	uncompressed_data_size = 4096;
+
+	result = assorted_lzx_parallel_decompress(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          1024,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = assorted_lzx_parallel_decompress(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          NULL,
+	          5,
+	          1024,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_decompress(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          0,
+	          1024,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_decompress(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          0,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_decompress(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          0,
+	          NULL,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_decompress(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          0,
+	          uncompressed_data,
+	          NULL,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzx_parallel_decompress(
+	          assorted_test_lzx_parallel_compressed_data,
+	          ASSORTED_TEST_LZX_PARALLEL_COMPRESSED_DATA_SIZE,
+	          assorted_test_lzx_parallel_reset_offsets,
+	          5,
+	          1024,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZX_PARALLEL_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzx_parallel_get_reset_offsets",
+	 assorted_test_lzx_parallel_get_reset_offsets );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzx_parallel_get_frames",
+	 assorted_test_lzx_parallel_get_frames );
+
+	/* TODO add tests for assorted_lzx_parallel_decompress_frames */
+
+	/* TODO add tests for assorted_lzx_parallel_decompress_task_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzx_parallel_decompress",
+	 assorted_test_lzx_parallel_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
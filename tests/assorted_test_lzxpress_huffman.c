@@ -0,0 +1,554 @@
+/*
+ * LZXPRESS Huffman decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_huffman_tree.h"
+#include "../src/assorted_lzxpress_huffman.h"
+
+/* Define to make assorted_test_lzxpress_huffman generate verbose output
+#define ASSORTED_TEST_LZXPRESS_HUFFMAN_VERBOSE
+ */
+
+uint8_t assorted_test_lzxpress_huffman_compressed_data[ 277 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x45, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00,
+	0x40, 0x00, 0x55, 0x04, 0x00, 0x00, 0x50, 0x05, 0x00, 0x50, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xed, 0x9d, 0xc5, 0x4a, 0x4b, 0x10, 0xda, 0xac, 0x83, 0x5d, 0x11, 0x9e, 0x2a, 0x85, 0xfc, 0xf1,
+	0xbc, 0x83, 0x24, 0x00, 0x00 };
+
+uint8_t assorted_test_lzxpress_huffman_uncompressed_data[ 85 ] = \
+	"LZXPRESS Huffman test data, LZXPRESS Huffman test data, LZXPRESS Huffman test data.\n";
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_lzxpress_huffman_decompress_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzxpress_huffman_decompress_chunk(
+     void )
+{
+	uint8_t uncompressed_data[ 256 ];
+
+	assorted_huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error              = NULL;
+	size_t compressed_data_offset         = 0;
+	size_t uncompressed_data_offset       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_huffman_tree_initialize(
+	          &huffman_tree,
+	          ASSORTED_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS,
+	          ASSORTED_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the test data consists of a single chunk that contains the end of data symbol
+	 */
+	result = assorted_lzxpress_huffman_decompress_chunk(
+	          huffman_tree,
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) 84 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzxpress_huffman_uncompressed_data,
+	          84 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test end of data, no more chunks remain
+	 */
+	result = assorted_lzxpress_huffman_decompress_chunk(
+	          huffman_tree,
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_offset   = 0;
+	uncompressed_data_offset = 0;
+
+	result = assorted_lzxpress_huffman_decompress_chunk(
+	          NULL,
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzxpress_huffman_decompress_chunk(
+	          huffman_tree,
+	          NULL,
+	          277,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzxpress_huffman_decompress_chunk(
+	          huffman_tree,
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          NULL,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_offset = 277 + 1;
+
+	result = assorted_lzxpress_huffman_decompress_chunk(
+	          huffman_tree,
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          &uncompressed_data_offset,
+	          &error );
+
+	compressed_data_offset = 0;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzxpress_huffman_decompress_chunk(
+	          huffman_tree,
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          &compressed_data_offset,
+	          NULL,
+	          256,
+	          &uncompressed_data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzxpress_huffman_decompress_chunk(
+	          huffman_tree,
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          &compressed_data_offset,
+	          uncompressed_data,
+	          256,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		assorted_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_lzxpress_huffman_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzxpress_huffman_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 256 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 256;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 84 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzxpress_huffman_uncompressed_data,
+	          84 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decompressing into a buffer that is too small
+	 * the uncompressed data is truncated
+	 */
+	uncompressed_data_size = 16;
+
+	result = assorted_lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 16 );
+
+	/* Test decompressing with over-subscribed code sizes
+	 */
+	assorted_test_lzxpress_huffman_compressed_data[ 0 ] = 0x11;
+
+	uncompressed_data_size = 256;
+
+	result = assorted_lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	assorted_test_lzxpress_huffman_compressed_data[ 0 ] = 0x00;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 256;
+
+	result = assorted_lzxpress_huffman_decompress(
+	          NULL,
+	          277,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_compressed_data,
+	          277,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_LZXPRESS_HUFFMAN_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzxpress_huffman_decompress_chunk",
+	 assorted_test_lzxpress_huffman_decompress_chunk );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_lzxpress_huffman_decompress",
+	 assorted_test_lzxpress_huffman_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
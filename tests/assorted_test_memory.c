@@ -20,6 +20,8 @@
  */
 
 #include <common.h>
+#include <file_stream.h>
+#include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
@@ -29,12 +31,14 @@
 #define __USE_GNU
 #include <dlfcn.h>
 #undef __USE_GNU
+#include <malloc.h>
 #endif
 
 #include "assorted_test_memory.h"
 
 #if defined( HAVE_ASSORTED_TEST_MEMORY )
 
+static void (*assorted_test_real_free)(void *)                          = NULL;
 static void *(*assorted_test_real_malloc)(size_t)                       = NULL;
 static void *(*assorted_test_real_memcpy)(void *, const void *, size_t) = NULL;
 static void *(*assorted_test_real_memset)(void *, int, size_t)          = NULL;
@@ -45,7 +49,115 @@ int assorted_test_memcpy_attempts_before_fail                           = -1;
 int assorted_test_memset_attempts_before_fail                           = -1;
 int assorted_test_realloc_attempts_before_fail                          = -1;
 
-/* Custom malloc for testing memory error cases
+/* The allocation statistics, the live size is based on the usable size
+ * of the allocations since free does not provide the size
+ */
+uint64_t assorted_test_memory_number_of_allocations                     = 0;
+uint64_t assorted_test_memory_allocated_size                            = 0;
+size_t assorted_test_memory_maximum_live_size                           = 0;
+
+static size_t assorted_test_memory_live_size                            = 0;
+
+/* Adds an allocation to the statistics
+ */
+static void assorted_test_memory_add_allocation(
+             void *ptr )
+{
+	size_t usable_size = 0;
+
+	if( ptr == NULL )
+	{
+		return;
+	}
+	usable_size = malloc_usable_size(
+	               ptr );
+
+	assorted_test_memory_number_of_allocations += 1;
+	assorted_test_memory_allocated_size        += usable_size;
+	assorted_test_memory_live_size             += usable_size;
+
+	if( assorted_test_memory_live_size > assorted_test_memory_maximum_live_size )
+	{
+		assorted_test_memory_maximum_live_size = assorted_test_memory_live_size;
+	}
+}
+
+/* Removes an allocation from the statistics
+ */
+static void assorted_test_memory_remove_allocation(
+             void *ptr )
+{
+	size_t usable_size = 0;
+
+	if( ptr == NULL )
+	{
+		return;
+	}
+	usable_size = malloc_usable_size(
+	               ptr );
+
+	/* Allocations made before the statistics were reset are not accounted for
+	 */
+	if( usable_size > assorted_test_memory_live_size )
+	{
+		assorted_test_memory_live_size = 0;
+	}
+	else
+	{
+		assorted_test_memory_live_size -= usable_size;
+	}
+}
+
+/* Resets the allocation statistics
+ */
+void assorted_test_memory_reset_statistics(
+      void )
+{
+	assorted_test_memory_number_of_allocations = 0;
+	assorted_test_memory_allocated_size        = 0;
+	assorted_test_memory_maximum_live_size     = 0;
+	assorted_test_memory_live_size             = 0;
+}
+
+/* Prints the allocation statistics
+ */
+void assorted_test_memory_statistics_fprint(
+      FILE *stream,
+      const char *name )
+{
+	if( ( stream == NULL )
+	 || ( name == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "%s: %" PRIu64 " allocations, %" PRIu64 " bytes allocated, %" PRIzd " bytes peak live memory\n",
+	 name,
+	 assorted_test_memory_number_of_allocations,
+	 assorted_test_memory_allocated_size,
+	 (ssize_t) assorted_test_memory_maximum_live_size );
+}
+
+/* Custom free for maintaining the allocation statistics
+ */
+void free(
+      void *ptr )
+{
+	if( assorted_test_real_free == NULL )
+	{
+		assorted_test_real_free = dlsym(
+		                           RTLD_NEXT,
+		                           "free" );
+	}
+	assorted_test_memory_remove_allocation(
+	 ptr );
+
+	assorted_test_real_free(
+	 ptr );
+}
+
+/* Custom malloc for testing memory error cases and maintaining the allocation statistics
  * Note this function might fail if compiled with optimation
  * Returns a pointer to newly allocated data or NULL
  */
@@ -73,6 +185,9 @@ void *malloc(
 	ptr = assorted_test_real_malloc(
 	       size );
 
+	assorted_test_memory_add_allocation(
+	 ptr );
+
 	return( ptr );
 }
 
@@ -142,7 +257,7 @@ void *memset(
 	return( ptr );
 }
 
-/* Custom realloc for testing memory error cases
+/* Custom realloc for testing memory error cases and maintaining the allocation statistics
  * Note this function might fail if compiled with optimation
  * Returns a pointer to reallocated data or NULL
  */
@@ -150,6 +265,8 @@ void *realloc(
        void *ptr,
        size_t size )
 {
+	void *reallocated_ptr = NULL;
+
 	if( assorted_test_real_realloc == NULL )
 	{
 		assorted_test_real_realloc = dlsym(
@@ -166,11 +283,29 @@ void *realloc(
 	{
 		assorted_test_realloc_attempts_before_fail--;
 	}
-	ptr = assorted_test_real_realloc(
-	       ptr,
-	       size );
+	assorted_test_memory_remove_allocation(
+	 ptr );
 
-	return( ptr );
+	reallocated_ptr = assorted_test_real_realloc(
+	                   ptr,
+	                   size );
+
+	if( reallocated_ptr == NULL )
+	{
+		/* The original allocation remains valid unless it was freed
+		 * by a reallocation to size 0
+		 */
+		if( size != 0 )
+		{
+			assorted_test_memory_add_allocation(
+			 ptr );
+		}
+		return( NULL );
+	}
+	assorted_test_memory_add_allocation(
+	 reallocated_ptr );
+
+	return( reallocated_ptr );
 }
 
 #endif /* defined( HAVE_ASSORTED_TEST_MEMORY ) */
@@ -23,6 +23,8 @@
 #define _ASSORTED_TEST_MEMORY_H
 
 #include <common.h>
+#include <file_stream.h>
+#include <types.h>
 
 #if defined( __cplusplus )
 extern "C" {
@@ -42,6 +44,19 @@ extern int assorted_test_memset_attempts_before_fail;
 
 extern int assorted_test_realloc_attempts_before_fail;
 
+extern uint64_t assorted_test_memory_number_of_allocations;
+
+extern uint64_t assorted_test_memory_allocated_size;
+
+extern size_t assorted_test_memory_maximum_live_size;
+
+void assorted_test_memory_reset_statistics(
+      void );
+
+void assorted_test_memory_statistics_fprint(
+      FILE *stream,
+      const char *name );
+
 #endif /* defined( HAVE_ASSORTED_TEST_MEMORY ) */
 
 #if defined( __cplusplus )
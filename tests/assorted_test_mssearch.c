@@ -0,0 +1,1087 @@
+/*
+ * Windows Search (MSSearch) decoding testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_cpu_features.h"
+#include "../src/assorted_mssearch.h"
+
+/* Define to make assorted_test_mssearch generate verbose output
+#define ASSORTED_TEST_MSSEARCH_VERBOSE
+ */
+
+uint8_t assorted_test_mssearch_encoded_data[ 16 ] = {
+	0x78, 0xda, 0xbd, 0x59, 0x6d, 0x8f, 0xdb, 0xb8, 0x11, 0xfe, 0x7c, 0xfa, 0x15, 0xc4, 0x7e, 0xb9 };
+
+uint8_t assorted_test_mssearch_decoded_data[ 16 ] = {
+	0x7b, 0xda, 0xbf, 0x5f, 0x6a, 0x8b, 0xdd, 0xba, 0x1a, 0xf6, 0x76, 0xf4, 0x1a, 0xc8, 0x70, 0xb3 };
+
+uint8_t assorted_test_mssearch_run_length_compressed_data[ 33 ] = {
+	0x0a, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x02, 0x00, 0xe9, 0x41,
+	0x02, 0x20, 0xac, 0x13, 0x01, 0xd8, 0x3d, 0x01, 0xde, 0x00, 0x01, 0xdc, 0x00, 0x02, 0x00, 0x6f,
+	0x6b };
+
+uint8_t assorted_test_mssearch_run_length_utf8_string[ 29 ] = {
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xc3, 0xa9, 0x41, 0xe2, 0x82, 0xac,
+	0xe2, 0x80, 0x93, 0xf0, 0x9f, 0x98, 0x80, 0xef, 0xbf, 0xbd, 0x6f, 0x6b, 0x00 };
+
+uint16_t assorted_test_mssearch_run_length_utf16_string[ 20 ] = {
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00e9, 0x0041,
+	0x20ac, 0x2013, 0xd83d, 0xde00, 0xdc00, 0x006f, 0x006b, 0x0000 };
+
+uint8_t assorted_test_mssearch_byte_indexed_compressed_data[ 289 ] = {
+	0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x66, 0x56, 0x66, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xe6, 0xe4, 0x9a, 0x0f, 0x50, 0x3c, 0x05, 0xee, 0x8f, 0x56, 0xc1, 0x8a, 0x63, 0x33,
+	0x0a, 0xa2, 0x80, 0x86, 0xbd, 0x96, 0x62, 0x7d, 0xd2, 0xe3, 0x81, 0xff, 0xe4, 0xb6, 0x00, 0x00,
+	0x1a };
+
+uint8_t assorted_test_mssearch_byte_indexed_uncompressed_data[ 89 ] = {
+	0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20,
+	0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e, 0x20, 0x54, 0x68, 0x65,
+	0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78,
+	0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e };
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_mssearch_get_simd_method function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_get_simd_method(
+     void )
+{
+	int simd_method = 0;
+
+	simd_method = assorted_mssearch_get_simd_method();
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "simd_method",
+	 simd_method,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_INT(
+	 "simd_method",
+	 simd_method,
+	 ASSORTED_MSSEARCH_SIMD_METHOD_NEON + 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_mssearch_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decode(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_mssearch_decode(
+	          data,
+	          16,
+	          assorted_test_mssearch_encoded_data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          assorted_test_mssearch_decoded_data,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_mssearch_decode(
+	          NULL,
+	          16,
+	          assorted_test_mssearch_encoded_data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decode(
+	          data,
+	          16,
+	          NULL,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decode(
+	          data,
+	          16,
+	          assorted_test_mssearch_encoded_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decode(
+	          data,
+	          15,
+	          assorted_test_mssearch_encoded_data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_mssearch_decode_in_place function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decode_in_place(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = memory_copy(
+	          data,
+	          assorted_test_mssearch_encoded_data,
+	          16 ) != NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_mssearch_decode_in_place(
+	          data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          assorted_test_mssearch_decoded_data,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_mssearch_decode_in_place(
+	          NULL,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_mssearch_decode function with and without the SIMD kernels
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decode_simd(
+     void )
+{
+	uint8_t data[ 1024 ];
+	uint8_t encoded_data[ 1024 ];
+	uint8_t expected_data[ 1024 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		encoded_data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases with sizes that end inside and at the end of a SIMD block
+	 */
+	for( data_size = 1;
+	     data_size <= 1024;
+	     data_size += 13 )
+	{
+		assorted_cpu_features_set_mask(
+		 0 );
+
+		result = assorted_mssearch_decode(
+		          expected_data,
+		          data_size,
+		          encoded_data,
+		          data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		assorted_cpu_features_set_mask(
+		 ASSORTED_CPU_FEATURE_ALL );
+
+		result = memory_copy(
+		          data,
+		          encoded_data,
+		          data_size ) != NULL;
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_mssearch_decode_in_place(
+		          data,
+		          data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          expected_data,
+		          data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_ALL );
+
+	return( 0 );
+}
+
+/* Tests the assorted_mssearch_get_run_length_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_get_run_length_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_mssearch_get_run_length_utf8_string_size(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 100 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_mssearch_get_run_length_utf8_string_size(
+	          NULL,
+	          33,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_get_run_length_utf8_string_size(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+     void )
+{
+	uint8_t utf8_string[ 100 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_size = 100;
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 29 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          assorted_test_mssearch_run_length_utf8_string,
+	          29 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a string that is cut-off after a high surrogate
+	 */
+	utf8_string_size = 100;
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          23,
+	          utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 20 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          assorted_test_mssearch_run_length_utf8_string,
+	          19 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "utf8_string[ 19 ]",
+	 (int) utf8_string[ 19 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_size = 100;
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+	          NULL,
+	          33,
+	          utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          utf8_string,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an UTF-8 string buffer that is too small
+	 */
+	utf8_string_size = 28;
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decompress_run_length_compressed_utf16_string_to_utf16(
+     void )
+{
+	uint16_t utf16_string[ 34 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf16_string_size = 34;
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          utf16_string,
+	          &utf16_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 20 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          assorted_test_mssearch_run_length_utf16_string,
+	          sizeof( uint16_t ) * 20 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16(
+	          NULL,
+	          33,
+	          utf16_string,
+	          &utf16_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          NULL,
+	          &utf16_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an UTF-16 string buffer that is too small
+	 */
+	utf16_string_size = 33;
+
+	result = assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16(
+	          assorted_test_mssearch_run_length_compressed_data,
+	          33,
+	          utf16_string,
+	          &utf16_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_mssearch_decompress_byte_indexed function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decompress_byte_indexed(
+     void )
+{
+	uint8_t uncompressed_data[ 128 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_mssearch_decompress_byte_indexed(
+	          assorted_test_mssearch_byte_indexed_compressed_data,
+	          289,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 89 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_mssearch_byte_indexed_uncompressed_data,
+	          89 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the wrapper with the stored uncompressed data size
+	 */
+	result = assorted_mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          89,
+	          assorted_test_mssearch_byte_indexed_compressed_data,
+	          289,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_mssearch_byte_indexed_uncompressed_data,
+	          89 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_mssearch_decompress_byte_indexed(
+	          NULL,
+	          289,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decompress_byte_indexed(
+	          assorted_test_mssearch_byte_indexed_compressed_data,
+	          2,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decompress_byte_indexed(
+	          assorted_test_mssearch_byte_indexed_compressed_data,
+	          289,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_mssearch_decompress_byte_indexed(
+	          assorted_test_mssearch_byte_indexed_compressed_data,
+	          289,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an uncompressed data buffer smaller than the stored size
+	 */
+	uncompressed_data_size = 88;
+
+	result = assorted_mssearch_decompress_byte_indexed(
+	          assorted_test_mssearch_byte_indexed_compressed_data,
+	          289,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test truncated compressed data
+	 */
+	uncompressed_data_size = 128;
+
+	result = assorted_mssearch_decompress_byte_indexed(
+	          assorted_test_mssearch_byte_indexed_compressed_data,
+	          264,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_MSSEARCH_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_mssearch_get_simd_method",
+	 assorted_test_mssearch_get_simd_method );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_mssearch_decode",
+	 assorted_test_mssearch_decode );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_mssearch_decode_in_place",
+	 assorted_test_mssearch_decode_in_place );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_mssearch_decode_simd",
+	 assorted_test_mssearch_decode_simd );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_mssearch_get_run_length_utf8_string_size",
+	 assorted_test_mssearch_get_run_length_utf8_string_size );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf8",
+	 assorted_test_mssearch_decompress_run_length_compressed_utf16_string_to_utf8 );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_mssearch_decompress_run_length_compressed_utf16_string_to_utf16",
+	 assorted_test_mssearch_decompress_run_length_compressed_utf16_string_to_utf16 );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_mssearch_decompress_byte_indexed",
+	 assorted_test_mssearch_decompress_byte_indexed );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -0,0 +1,436 @@
+/*
+ * RC4 stream cipher testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_rc4.h"
+
+/* Define to make assorted_test_rc4 generate verbose output
+#define ASSORTED_TEST_RC4_VERBOSE
+ */
+
+/* Test vectors from RFC 6229
+ */
+uint8_t assorted_test_rc4_key_40bit[ 5 ] = {
+	0x01, 0x02, 0x03, 0x04, 0x05 };
+
+uint8_t assorted_test_rc4_key_stream_40bit[ 16 ] = {
+	0xb2, 0x39, 0x63, 0x05, 0xf0, 0x3d, 0xc0, 0x27, 0xcc, 0xc3, 0x52, 0x4a, 0x0a, 0x11, 0x18, 0xa8 };
+
+uint8_t assorted_test_rc4_key_256bit[ 32 ] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+	0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20 };
+
+uint8_t assorted_test_rc4_key_stream_256bit[ 16 ] = {
+	0xea, 0xa6, 0xbd, 0x25, 0x88, 0x0b, 0xf9, 0x3d, 0x3f, 0x5d, 0x1e, 0x4c, 0xa2, 0x61, 0x1d, 0x91 };
+
+uint8_t assorted_test_rc4_key_stream_256bit_offset_1024[ 16 ] = {
+	0x7f, 0xec, 0x5b, 0xfd, 0x9f, 0x9b, 0x89, 0xce, 0x65, 0x48, 0x30, 0x90, 0x92, 0xd7, 0xe9, 0x58 };
+
+/* Tests the assorted_rc4_key_schedule_set_key function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_rc4_key_schedule_set_key(
+     void )
+{
+	assorted_rc4_key_schedule_t key_schedule;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_rc4_key_schedule_set_key(
+	          &key_schedule,
+	          assorted_test_rc4_key_40bit,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_rc4_key_schedule_set_key(
+	          NULL,
+	          assorted_test_rc4_key_40bit,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_rc4_key_schedule_set_key(
+	          &key_schedule,
+	          NULL,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_rc4_key_schedule_set_key(
+	          &key_schedule,
+	          assorted_test_rc4_key_40bit,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_rc4_key_schedule_set_key(
+	          &key_schedule,
+	          assorted_test_rc4_key_40bit,
+	          ASSORTED_RC4_MAXIMUM_KEY_SIZE + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_rc4_crypt function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_rc4_crypt(
+     void )
+{
+	assorted_rc4_key_schedule_t key_schedule;
+
+	uint8_t data[ 1040 ];
+	uint8_t key_stream[ 1040 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 1040 );
+
+	result = assorted_rc4_key_schedule_set_key(
+	          &key_schedule,
+	          assorted_test_rc4_key_40bit,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = assorted_rc4_crypt(
+	          &key_schedule,
+	          data,
+	          16,
+	          key_stream,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_stream,
+	          assorted_test_rc4_key_stream_40bit,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = assorted_rc4_key_schedule_set_key(
+	          &key_schedule,
+	          assorted_test_rc4_key_256bit,
+	          32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_rc4_crypt(
+	          &key_schedule,
+	          data,
+	          1040,
+	          key_stream,
+	          1040,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key_stream,
+	          assorted_test_rc4_key_stream_256bit,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( key_stream[ 1024 ] ),
+	          assorted_test_rc4_key_stream_256bit_offset_1024,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the key schedule is reused and that data can be decrypted in place
+	 */
+	result = assorted_rc4_crypt(
+	          &key_schedule,
+	          key_stream,
+	          1040,
+	          key_stream,
+	          1040,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          key_stream,
+	          data,
+	          1040 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_rc4_crypt(
+	          NULL,
+	          data,
+	          16,
+	          key_stream,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_rc4_crypt(
+	          &key_schedule,
+	          NULL,
+	          16,
+	          key_stream,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_rc4_crypt(
+	          &key_schedule,
+	          data,
+	          16,
+	          NULL,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_rc4_crypt(
+	          &key_schedule,
+	          data,
+	          16,
+	          key_stream,
+	          8,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_RC4_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	ASSORTED_TEST_RUN(
+	 "assorted_rc4_key_schedule_set_key",
+	 assorted_test_rc4_key_schedule_set_key );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_rc4_crypt",
+	 assorted_test_rc4_crypt );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,693 @@
+/*
+ * Serpent block cipher testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_cpu_features.h"
+#include "../src/assorted_serpent.h"
+
+/* Define to make assorted_test_serpent generate verbose output
+#define ASSORTED_TEST_SERPENT_VERBOSE
+ */
+
+uint8_t assorted_test_serpent_key[ 32 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+uint8_t assorted_test_serpent_plaintext[ 16 ] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
+uint8_t assorted_test_serpent_ciphertext_128bit[ 16 ] = {
+	0x56, 0x3e, 0x2c, 0xf8, 0x74, 0x0a, 0x27, 0xc1, 0x64, 0x80, 0x45, 0x60, 0x39, 0x1e, 0x9b, 0x27 };
+
+uint8_t assorted_test_serpent_ciphertext_192bit[ 16 ] = {
+	0x6a, 0xb8, 0x16, 0xc8, 0x2d, 0xe5, 0x3b, 0x93, 0x00, 0x50, 0x08, 0xaf, 0xa2, 0x24, 0x6a, 0x02 };
+
+uint8_t assorted_test_serpent_ciphertext_256bit[ 16 ] = {
+	0x28, 0x68, 0xb7, 0xa2, 0xd2, 0x8e, 0xcd, 0x5e, 0x4f, 0xde, 0xfa, 0xc3, 0xc4, 0x33, 0x00, 0x74 };
+
+/* Tests the assorted_serpent_get_simd_method function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_get_simd_method(
+     void )
+{
+	int simd_method = 0;
+
+	simd_method = assorted_serpent_get_simd_method();
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "simd_method",
+	 simd_method,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_INT(
+	 "simd_method",
+	 simd_method,
+	 ASSORTED_SERPENT_SIMD_METHOD_NEON + 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the assorted_serpent_context_initialize and assorted_serpent_context_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_context_initialize(
+     void )
+{
+	assorted_serpent_context_t *context = NULL;
+	libcerror_error_t *error            = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_serpent_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_serpent_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_serpent_context_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_serpent_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_serpent_context_set_key function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_context_set_key(
+     void )
+{
+	assorted_serpent_context_t *context = NULL;
+	libcerror_error_t *error            = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_serpent_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = assorted_serpent_context_set_key(
+	          context,
+	          assorted_test_serpent_key,
+	          256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_serpent_context_set_key(
+	          NULL,
+	          assorted_test_serpent_key,
+	          256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_serpent_context_set_key(
+	          context,
+	          NULL,
+	          256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_serpent_context_set_key(
+	          context,
+	          assorted_test_serpent_key,
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_serpent_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_serpent_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_serpent_crypt_ecb function with the known test vectors
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_crypt_ecb(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	uint8_t *ciphertexts[ 3 ] = {
+		assorted_test_serpent_ciphertext_128bit,
+		assorted_test_serpent_ciphertext_192bit,
+		assorted_test_serpent_ciphertext_256bit };
+
+	assorted_serpent_context_t *context = NULL;
+	libcerror_error_t *error            = NULL;
+	int key_index                       = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = assorted_serpent_context_initialize(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( key_index = 0;
+	     key_index < 3;
+	     key_index++ )
+	{
+		result = assorted_serpent_context_set_key(
+		          context,
+		          assorted_test_serpent_key,
+		          (size_t) ( 128 + ( key_index * 64 ) ),
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = assorted_serpent_crypt_ecb(
+		          context,
+		          ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT,
+		          assorted_test_serpent_plaintext,
+		          16,
+		          data,
+		          16,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          ciphertexts[ key_index ],
+		          16 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test decryption in place
+		 */
+		result = assorted_serpent_crypt_ecb(
+		          context,
+		          ASSORTED_SERPENT_CRYPT_MODE_DECRYPT,
+		          data,
+		          16,
+		          data,
+		          16,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          assorted_test_serpent_plaintext,
+		          16 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = assorted_serpent_crypt_ecb(
+	          NULL,
+	          ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT,
+	          assorted_test_serpent_plaintext,
+	          16,
+	          data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_serpent_crypt_ecb(
+	          context,
+	          ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT,
+	          assorted_test_serpent_plaintext,
+	          15,
+	          data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_serpent_crypt_ecb(
+	          context,
+	          ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT,
+	          assorted_test_serpent_plaintext,
+	          16,
+	          data,
+	          8,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = assorted_serpent_context_free(
+	          &context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_serpent_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_serpent_crypt_ecb function with and without the SIMD kernels
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_crypt_ecb_simd(
+     void )
+{
+	uint8_t data[ 1024 ];
+	uint8_t expected_data[ 1024 ];
+	uint8_t plaintext[ 1024 ];
+
+	assorted_serpent_context_t *context = NULL;
+	libcerror_error_t *error            = NULL;
+	size_t data_offset                  = 0;
+	size_t data_size                    = 0;
+	int crypt_mode                      = 0;
+	int result                          = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		plaintext[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases with sizes that do not fill the widest SIMD kernel
+	 */
+	for( crypt_mode = ASSORTED_SERPENT_CRYPT_MODE_DECRYPT;
+	     crypt_mode <= ASSORTED_SERPENT_CRYPT_MODE_ENCRYPT;
+	     crypt_mode++ )
+	{
+		for( data_size = 16;
+		     data_size <= 1024;
+		     data_size += 48 )
+		{
+			assorted_cpu_features_set_mask(
+			 0 );
+
+			result = assorted_serpent_context_initialize(
+			          &context,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_serpent_context_set_key(
+			          context,
+			          assorted_test_serpent_key,
+			          256,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_serpent_crypt_ecb(
+			          context,
+			          crypt_mode,
+			          plaintext,
+			          data_size,
+			          expected_data,
+			          data_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_serpent_context_free(
+			          &context,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			assorted_cpu_features_set_mask(
+			 ASSORTED_CPU_FEATURE_ALL );
+
+			result = assorted_serpent_context_initialize(
+			          &context,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_serpent_context_set_key(
+			          context,
+			          assorted_test_serpent_key,
+			          256,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = assorted_serpent_crypt_ecb(
+			          context,
+			          crypt_mode,
+			          plaintext,
+			          data_size,
+			          data,
+			          data_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = assorted_serpent_context_free(
+			          &context,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = memory_compare(
+			          data,
+			          expected_data,
+			          data_size );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		assorted_serpent_context_free(
+		 &context,
+		 NULL );
+	}
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_ALL );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_SERPENT_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	ASSORTED_TEST_RUN(
+	 "assorted_serpent_get_simd_method",
+	 assorted_test_serpent_get_simd_method );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_serpent_context_initialize",
+	 assorted_test_serpent_context_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_serpent_context_set_key",
+	 assorted_test_serpent_context_set_key );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_serpent_crypt_ecb",
+	 assorted_test_serpent_crypt_ecb );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_serpent_crypt_ecb_simd",
+	 assorted_test_serpent_crypt_ecb_simd );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
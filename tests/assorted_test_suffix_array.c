@@ -0,0 +1,259 @@
+/*
+ * Suffix array functions testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_suffix_array.h"
+
+/* "banana" followed by the sentinel, where a is 1, b is 2 and n is 3
+ */
+int32_t assorted_test_suffix_array_banana_text[ 7 ] = {
+	2, 1, 3, 1, 3, 1, 0 };
+
+int32_t assorted_test_suffix_array_banana_suffix_array[ 7 ] = {
+	6, 5, 3, 1, 0, 4, 2 };
+
+/* "mississippi" followed by the sentinel, where i is 1, m is 2, p is 3 and s is 4
+ * The LMS substrings are not unique, hence the reduced text is sorted recursively
+ */
+int32_t assorted_test_suffix_array_mississippi_text[ 12 ] = {
+	2, 1, 4, 4, 1, 4, 4, 1, 3, 3, 1, 0 };
+
+int32_t assorted_test_suffix_array_mississippi_suffix_array[ 12 ] = {
+	11, 10, 7, 4, 1, 0, 9, 8, 6, 3, 5, 2 };
+
+/* Tests the assorted_suffix_array_build function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_suffix_array_build(
+     void )
+{
+	int32_t suffix_array[ 12 ];
+	int32_t invalid_text[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int suffix_index         = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_suffix_array_build(
+	          assorted_test_suffix_array_banana_text,
+	          7,
+	          4,
+	          suffix_array,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( suffix_index = 0;
+	     suffix_index < 7;
+	     suffix_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "suffix_array[ suffix_index ]",
+		 (int) suffix_array[ suffix_index ],
+		 (int) assorted_test_suffix_array_banana_suffix_array[ suffix_index ] );
+	}
+	result = assorted_suffix_array_build(
+	          assorted_test_suffix_array_mississippi_text,
+	          12,
+	          5,
+	          suffix_array,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( suffix_index = 0;
+	     suffix_index < 12;
+	     suffix_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "suffix_array[ suffix_index ]",
+		 (int) suffix_array[ suffix_index ],
+		 (int) assorted_test_suffix_array_mississippi_suffix_array[ suffix_index ] );
+	}
+	/* Test error cases
+	 */
+	result = assorted_suffix_array_build(
+	          NULL,
+	          7,
+	          4,
+	          suffix_array,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_suffix_array_build(
+	          assorted_test_suffix_array_banana_text,
+	          0,
+	          4,
+	          suffix_array,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_suffix_array_build(
+	          assorted_test_suffix_array_banana_text,
+	          7,
+	          4,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the text does not end with the sentinel
+	 */
+	result = assorted_suffix_array_build(
+	          assorted_test_suffix_array_banana_text,
+	          6,
+	          4,
+	          suffix_array,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a character is out of bounds of the alphabet
+	 */
+	invalid_text[ 0 ] = 1;
+	invalid_text[ 1 ] = 4;
+	invalid_text[ 2 ] = 0;
+
+	result = assorted_suffix_array_build(
+	          invalid_text,
+	          3,
+	          4,
+	          suffix_array,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_suffix_array_build",
+	 assorted_test_suffix_array_build );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
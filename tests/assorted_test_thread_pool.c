@@ -0,0 +1,839 @@
+/*
+ * Work stealing thread pool testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_thread_pool.h"
+
+/* Define to make assorted_test_thread_pool generate verbose output
+#define ASSORTED_TEST_THREAD_POOL_VERBOSE
+ */
+
+#define ASSORTED_TEST_THREAD_POOL_NUMBER_OF_VALUES	256
+
+typedef struct assorted_test_thread_pool_value assorted_test_thread_pool_value_t;
+
+struct assorted_test_thread_pool_value
+{
+	/* The index of the value
+	 */
+	int index;
+
+	/* The amount of work of the value
+	 */
+	uint32_t amount_of_work;
+
+	/* The result of the work
+	 */
+	uint32_t result;
+
+	/* Value to indicate the value was processed
+	 */
+	int is_processed;
+};
+
+assorted_test_thread_pool_value_t assorted_test_thread_pool_values[ ASSORTED_TEST_THREAD_POOL_NUMBER_OF_VALUES ];
+
+/* Initializes the test values
+ * The amount of work varies per value so the values complete out of order
+ */
+void assorted_test_thread_pool_initialize_values(
+      void )
+{
+	int value_index = 0;
+
+	for( value_index = 0;
+	     value_index < ASSORTED_TEST_THREAD_POOL_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		assorted_test_thread_pool_values[ value_index ].index          = value_index;
+		assorted_test_thread_pool_values[ value_index ].amount_of_work = (uint32_t) ( ( ( value_index * 7919 ) % 13 ) * 2000 );
+		assorted_test_thread_pool_values[ value_index ].result         = 0;
+		assorted_test_thread_pool_values[ value_index ].is_processed   = 0;
+	}
+}
+
+/* Processes a test value
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_test_thread_pool_callback(
+     intptr_t *value,
+     void *arguments ASSORTED_TEST_ATTRIBUTE_UNUSED )
+{
+	assorted_test_thread_pool_value_t *test_value = NULL;
+	uint32_t result                               = 0;
+	uint32_t work_index                           = 0;
+
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	test_value = (assorted_test_thread_pool_value_t *) value;
+
+	result = (uint32_t) test_value->index;
+
+	for( work_index = 0;
+	     work_index < test_value->amount_of_work;
+	     work_index++ )
+	{
+		result = ( result * 1103515245UL ) + 12345;
+	}
+	test_value->result       = result;
+	test_value->is_processed = 1;
+
+	return( 1 );
+}
+
+#if defined( __GNUC__ ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the assorted_thread_pool_create function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_thread_pool_create(
+     void )
+{
+	assorted_thread_pool_t *thread_pool = NULL;
+	libcerror_error_t *error            = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          4,
+	          16,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_thread_pool_create(
+	          NULL,
+	          4,
+	          16,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          0,
+	          16,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          ASSORTED_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          16,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          4,
+	          0,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          4,
+	          16,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_thread_pool_push function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_thread_pool_push(
+     void )
+{
+	assorted_thread_pool_t *thread_pool = NULL;
+	libcerror_error_t *error            = NULL;
+	int number_of_processed_values      = 0;
+	int result                          = 0;
+	int value_index                     = 0;
+
+	/* Test regular cases
+	 * The maximum number of values is smaller than the number of values
+	 * so that pushing blocks until values are finished
+	 */
+	assorted_test_thread_pool_initialize_values();
+
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          4,
+	          8,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < ASSORTED_TEST_THREAD_POOL_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		result = assorted_thread_pool_push(
+		          thread_pool,
+		          (intptr_t *) &( assorted_test_thread_pool_values[ value_index ] ),
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = assorted_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < ASSORTED_TEST_THREAD_POOL_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		number_of_processed_values += assorted_test_thread_pool_values[ value_index ].is_processed;
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "number_of_processed_values",
+	 number_of_processed_values,
+	 ASSORTED_TEST_THREAD_POOL_NUMBER_OF_VALUES );
+
+	/* Test error cases
+	 */
+	result = assorted_thread_pool_push(
+	          NULL,
+	          (intptr_t *) &( assorted_test_thread_pool_values[ 0 ] ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_thread_pool_pop_completed function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_thread_pool_pop_completed(
+     void )
+{
+	assorted_test_thread_pool_value_t *test_value = NULL;
+	assorted_thread_pool_t *thread_pool           = NULL;
+	libcerror_error_t *error                      = NULL;
+	int number_of_completed_values                = 0;
+	int result                                    = 0;
+	int value_index                               = 0;
+
+	/* Test regular cases
+	 */
+	assorted_test_thread_pool_initialize_values();
+
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          4,
+	          8,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          ASSORTED_THREAD_POOL_FLAG_ORDERED_COMPLETION,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The values are retrieved in the order they were pushed
+	 * while at most 8 values are in the thread pool
+	 */
+	while( number_of_completed_values < ASSORTED_TEST_THREAD_POOL_NUMBER_OF_VALUES )
+	{
+		while( ( value_index < ASSORTED_TEST_THREAD_POOL_NUMBER_OF_VALUES )
+		    && ( ( value_index - number_of_completed_values ) < 8 ) )
+		{
+			result = assorted_thread_pool_push(
+			          thread_pool,
+			          (intptr_t *) &( assorted_test_thread_pool_values[ value_index ] ),
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			value_index++;
+		}
+		result = assorted_thread_pool_pop_completed(
+		          thread_pool,
+		          (intptr_t **) &test_value,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "test_value",
+		 test_value );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "test_value->index",
+		 test_value->index,
+		 number_of_completed_values );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "test_value->is_processed",
+		 test_value->is_processed,
+		 1 );
+
+		number_of_completed_values++;
+	}
+	/* No values remain to be retrieved
+	 */
+	result = assorted_thread_pool_pop_completed(
+	          thread_pool,
+	          (intptr_t **) &test_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_thread_pool_pop_completed(
+	          NULL,
+	          (intptr_t **) &test_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_thread_pool_pop_completed(
+	          thread_pool,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the thread pool does not have ordered completion
+	 */
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          2,
+	          8,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_thread_pool_pop_completed(
+	          thread_pool,
+	          (intptr_t **) &test_value,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_thread_pool_join function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_thread_pool_join(
+     void )
+{
+	assorted_thread_pool_t *thread_pool = NULL;
+	libcerror_error_t *error            = NULL;
+	int number_of_processed_values      = 0;
+	int result                          = 0;
+	int value_index                     = 0;
+
+	/* Test regular cases
+	 * The values that are pushed are processed before the threads stop
+	 */
+	assorted_test_thread_pool_initialize_values();
+
+	result = assorted_thread_pool_create(
+	          &thread_pool,
+	          2,
+	          32,
+	          &assorted_test_thread_pool_callback,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 32;
+	     value_index++ )
+	{
+		result = assorted_thread_pool_push(
+		          thread_pool,
+		          (intptr_t *) &( assorted_test_thread_pool_values[ value_index ] ),
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = assorted_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 32;
+	     value_index++ )
+	{
+		number_of_processed_values += assorted_test_thread_pool_values[ value_index ].is_processed;
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "number_of_processed_values",
+	 number_of_processed_values,
+	 32 );
+
+	/* Test error cases
+	 */
+	result = assorted_thread_pool_join(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		assorted_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_THREAD_POOL_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_thread_pool_create",
+	 assorted_test_thread_pool_create );
+
+	/* TODO add tests for assorted_thread_pool_free */
+
+	/* TODO add tests for assorted_thread_pool_worker_take_value */
+
+	/* TODO add tests for assorted_thread_pool_worker_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_thread_pool_push",
+	 assorted_test_thread_pool_push );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_thread_pool_pop_completed",
+	 assorted_test_thread_pool_pop_completed );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_thread_pool_join",
+	 assorted_test_thread_pool_join );
+
+#endif /* defined( __GNUC__ ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
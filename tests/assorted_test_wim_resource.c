@@ -0,0 +1,532 @@
+/*
+ * WIM resource decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_wim_resource.h"
+
+/* Define to make assorted_test_wim_resource generate verbose output
+#define ASSORTED_TEST_WIM_RESOURCE_VERBOSE
+ */
+
+/* The resource consists of a chunk table with 2 entries, 2 stored chunks
+ * and a LZXPRESS Huffman compressed last chunk of 84 bytes
+ */
+#define ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE			( 8 + ( 2 * 32768 ) + 277 )
+#define ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE	( ( 2 * 32768 ) + 84 )
+
+uint8_t assorted_test_wim_resource_xpress_chunk_data[ 277 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x45, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00,
+	0x40, 0x00, 0x55, 0x04, 0x00, 0x00, 0x50, 0x05, 0x00, 0x50, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xed, 0x9d, 0xc5, 0x4a, 0x4b, 0x10, 0xda, 0xac, 0x83, 0x5d, 0x11, 0x9e, 0x2a, 0x85, 0xfc, 0xf1,
+	0xbc, 0x83, 0x24, 0x00, 0x00 };
+
+uint8_t assorted_test_wim_resource_data[ ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE ];
+
+uint8_t assorted_test_wim_resource_uncompressed_data[ ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE + 1 ];
+
+#if defined( __GNUC__ )
+
+/* Initializes the resource data
+ */
+void assorted_test_wim_resource_initialize_data(
+      void )
+{
+	size_t data_offset = 0;
+
+	/* The chunk table entries contain the offsets of the second and third chunk
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( assorted_test_wim_resource_data[ 0 ] ),
+	 32768 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( assorted_test_wim_resource_data[ 4 ] ),
+	 65536 );
+
+	for( data_offset = 0;
+	     data_offset < ( 2 * 32768 );
+	     data_offset++ )
+	{
+		assorted_test_wim_resource_data[ 8 + data_offset ] = (uint8_t) ( ( data_offset * 7 ) % 251 );
+	}
+	memory_copy(
+	 &( assorted_test_wim_resource_data[ 8 + ( 2 * 32768 ) ] ),
+	 assorted_test_wim_resource_xpress_chunk_data,
+	 277 );
+}
+
+/* Tests the assorted_wim_resource_get_number_of_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_wim_resource_get_number_of_chunks(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t number_of_chunks  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_wim_resource_get_number_of_chunks(
+	          (size64_t) ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 (size_t) 3 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_wim_resource_get_number_of_chunks(
+	          (size64_t) 32768,
+	          &number_of_chunks,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 (size_t) 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_wim_resource_get_number_of_chunks(
+	          (size64_t) 32768,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_wim_resource_get_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_wim_resource_get_chunks(
+     void )
+{
+	assorted_wim_resource_chunk_t chunks[ 3 ];
+	uint8_t invalid_chunk_table_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_wim_resource_get_chunks(
+	          assorted_test_wim_resource_data,
+	          ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE,
+	          ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS,
+	          assorted_test_wim_resource_uncompressed_data,
+	          ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE,
+	          chunks,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunks[ 0 ].compressed_data_size",
+	 chunks[ 0 ].compressed_data_size,
+	 (size_t) 32768 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INTPTR(
+	 "chunks[ 1 ].compressed_data",
+	 (intptr_t) chunks[ 1 ].compressed_data,
+	 (intptr_t) &( assorted_test_wim_resource_data[ 8 + 32768 ] ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunks[ 2 ].compressed_data_size",
+	 chunks[ 2 ].compressed_data_size,
+	 (size_t) 277 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INTPTR(
+	 "chunks[ 2 ].uncompressed_data",
+	 (intptr_t) chunks[ 2 ].uncompressed_data,
+	 (intptr_t) &( assorted_test_wim_resource_uncompressed_data[ 2 * 32768 ] ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "chunks[ 2 ].uncompressed_data_size",
+	 chunks[ 2 ].uncompressed_data_size,
+	 (size_t) 84 );
+
+	/* Test error cases
+	 */
+	result = assorted_wim_resource_get_chunks(
+	          NULL,
+	          ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE,
+	          ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS,
+	          assorted_test_wim_resource_uncompressed_data,
+	          ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE,
+	          chunks,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_wim_resource_get_chunks(
+	          assorted_test_wim_resource_data,
+	          ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE,
+	          ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_NONE,
+	          assorted_test_wim_resource_uncompressed_data,
+	          ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE,
+	          chunks,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_wim_resource_get_chunks(
+	          assorted_test_wim_resource_data,
+	          ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE,
+	          ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS,
+	          assorted_test_wim_resource_uncompressed_data,
+	          ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE,
+	          chunks,
+	          2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the chunk offsets are not increasing
+	 */
+	memory_copy(
+	 invalid_chunk_table_data,
+	 assorted_test_wim_resource_data,
+	 16 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( invalid_chunk_table_data[ 0 ] ),
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( invalid_chunk_table_data[ 4 ] ),
+	 4 );
+
+	result = assorted_wim_resource_get_chunks(
+	          invalid_chunk_table_data,
+	          16,
+	          ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS,
+	          assorted_test_wim_resource_uncompressed_data,
+	          ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE,
+	          chunks,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_wim_resource_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_wim_resource_decompress(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads += 3 )
+	{
+		memory_set(
+		 assorted_test_wim_resource_uncompressed_data,
+		 0,
+		 ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE );
+
+		result = assorted_wim_resource_decompress(
+		          assorted_test_wim_resource_data,
+		          ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE,
+		          ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS,
+		          assorted_test_wim_resource_uncompressed_data,
+		          ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE,
+		          number_of_threads,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          assorted_test_wim_resource_uncompressed_data,
+		          &( assorted_test_wim_resource_data[ 8 ] ),
+		          2 * 32768 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          &( assorted_test_wim_resource_uncompressed_data[ 2 * 32768 ] ),
+		          "LZXPRESS Huffman test data, LZXPRESS Huffman test data, LZXPRESS Huffman test data.\n",
+		          84 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = assorted_wim_resource_decompress(
+	          assorted_test_wim_resource_data,
+	          ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE,
+	          ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS,
+	          assorted_test_wim_resource_uncompressed_data,
+	          ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the last chunk decompresses into less data than expected
+	 */
+	result = assorted_wim_resource_decompress(
+	          assorted_test_wim_resource_data,
+	          ASSORTED_TEST_WIM_RESOURCE_DATA_SIZE,
+	          ASSORTED_WIM_RESOURCE_COMPRESSION_METHOD_XPRESS,
+	          assorted_test_wim_resource_uncompressed_data,
+	          ASSORTED_TEST_WIM_RESOURCE_UNCOMPRESSED_DATA_SIZE + 1,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_WIM_RESOURCE_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	assorted_test_wim_resource_initialize_data();
+
+	ASSORTED_TEST_RUN(
+	 "assorted_wim_resource_get_number_of_chunks",
+	 assorted_test_wim_resource_get_number_of_chunks );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_wim_resource_get_chunks",
+	 assorted_test_wim_resource_get_chunks );
+
+	/* TODO add tests for assorted_wim_resource_decompress_chunk */
+
+	/* TODO add tests for assorted_wim_resource_decompress_chunks */
+
+	/* TODO add tests for assorted_wim_resource_decompress_task_callback */
+
+	ASSORTED_TEST_RUN(
+	 "assorted_wim_resource_decompress",
+	 assorted_test_wim_resource_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
@@ -33,6 +33,7 @@
 #include "assorted_test_macros.h"
 #include "assorted_test_unused.h"
 
+#include "../src/assorted_cpu_features.h"
 #include "../src/assorted_xor64.h"
 
 /* Define to make assorted_test_xor64 generate verbose output
@@ -240,6 +241,183 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the assorted_xor64_calculate_checksum_little_endian_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_xor64_calculate_checksum_little_endian_simd(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	uint32_t features_masks[ 3 ] = {
+		ASSORTED_CPU_FEATURE_ALL,
+		ASSORTED_CPU_FEATURE_ALL & ~( (uint32_t) ASSORTED_CPU_FEATURE_AVX512F ),
+		0 };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	size_t mask_index        = 0;
+	size_t start_offset      = 0;
+	uint64_t checksum_value  = 0;
+	uint64_t expected_value  = 0;
+	int result               = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 167 ) + ( data_offset >> 3 ) );
+	}
+	/* Test regular cases with every available SIMD kernel and the unaligned
+	 * head and tail at every offset
+	 */
+	for( mask_index = 0;
+	     mask_index < 3;
+	     mask_index++ )
+	{
+		assorted_cpu_features_set_mask(
+		 features_masks[ mask_index ] );
+
+		for( start_offset = 0;
+		     start_offset < 64;
+		     start_offset++ )
+		{
+			for( data_size = 0;
+			     data_size <= ( 1024 - 64 );
+			     data_size += 37 )
+			{
+				/* The XOR-64 of the little-endian 64-bit values, where a partial value is padded with zero bytes
+				 */
+				expected_value = 0x12345678UL;
+
+				for( data_offset = 0;
+				     data_offset < data_size;
+				     data_offset++ )
+				{
+					expected_value ^= (uint64_t) data[ start_offset + data_offset ] << ( ( data_offset % 8 ) * 8 );
+				}
+
+				result = assorted_xor64_calculate_checksum_little_endian_simd(
+				          &checksum_value,
+				          &( data[ start_offset ] ),
+				          data_size,
+				          0x12345678UL,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+				 "checksum_value",
+				 checksum_value,
+				 expected_value );
+
+				ASSORTED_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+	}
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_ALL );
+
+	result = assorted_xor64_calculate_checksum_little_endian_simd(
+	          &checksum_value,
+	          assorted_test_xor64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0x01a54b78a3c12469ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_xor64_calculate_checksum_little_endian_simd(
+	          NULL,
+	          assorted_test_xor64_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_xor64_calculate_checksum_little_endian_simd(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_xor64_calculate_checksum_little_endian_simd(
+	          &checksum_value,
+	          assorted_test_xor64_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_cpu_features_set_mask(
+	 ASSORTED_CPU_FEATURE_ALL );
+
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -275,6 +453,10 @@ int main(
 	 "assorted_xor64_calculate_checksum_little_endian_cpu_aligned",
 	 assorted_test_xor64_calculate_checksum_little_endian_cpu_aligned );
 
+	ASSORTED_TEST_RUN(
+	 "assorted_xor64_calculate_checksum_little_endian_simd",
+	 assorted_test_xor64_calculate_checksum_little_endian_simd );
+
 #endif /* defined( __GNUC__ ) */
 
 	return( EXIT_SUCCESS );
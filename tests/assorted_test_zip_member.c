@@ -0,0 +1,466 @@
+/*
+ * ZIP archive member decompression testing program
+ *
+ * Copyright (C) 2008-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_libcnotify.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_zip_member.h"
+
+/* Define to make assorted_test_zip_member generate verbose output
+#define ASSORTED_TEST_ZIP_MEMBER_VERBOSE
+ */
+
+uint8_t assorted_test_zip_member_uncompressed_data[ 90 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	'h', 'e', ' ', 'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g', '.', ' ', 'T', 'h', 'e',
+	' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ', 'f', 'o', 'x',
+	' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't', 'h', 'e', ' ',
+	'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g', '.', '\n' };
+
+uint8_t assorted_test_zip_member_compressed_data[ 50 ] = {
+	0x0b, 0xc9, 0x48, 0x55, 0x28, 0x2c, 0xcd, 0x4c, 0xce, 0x56, 0x48, 0x2a, 0xca, 0x2f, 0xcf, 0x53,
+	0x48, 0xcb, 0xaf, 0x50, 0xc8, 0x2a, 0xcd, 0x2d, 0x28, 0x56, 0xc8, 0x2f, 0x4b, 0x2d, 0x52, 0x28,
+	0x01, 0x4a, 0xe7, 0x24, 0x56, 0x55, 0x2a, 0xa4, 0xe4, 0xa7, 0xeb, 0x29, 0x84, 0x90, 0xa0, 0x98,
+	0x0b, 0x00 };
+
+uint8_t assorted_test_zip_member_local_file_header_data[ 38 ] = {
+	'P', 'K', 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xd9,
+	0xff, 0x7a, 0x32, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'f', 'o',
+	'x', '.', 't', 'x', 't', 0x00 };
+
+#define ASSORTED_TEST_ZIP_MEMBER_CHECKSUM	0x7affd9d2UL
+
+#if defined( __GNUC__ )
+
+/* Tests the assorted_zip_member_read_local_file_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_zip_member_read_local_file_header(
+     void )
+{
+	uint8_t local_file_header_data[ 30 ];
+
+	libcerror_error_t *error = NULL;
+	size_t header_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_zip_member_read_local_file_header(
+	          assorted_test_zip_member_local_file_header_data,
+	          38,
+	          &header_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "header_size",
+	 header_size,
+	 (size_t) 38 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = assorted_zip_member_read_local_file_header(
+	          NULL,
+	          38,
+	          &header_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_zip_member_read_local_file_header(
+	          assorted_test_zip_member_local_file_header_data,
+	          29,
+	          &header_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_zip_member_read_local_file_header(
+	          assorted_test_zip_member_local_file_header_data,
+	          38,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is invalid
+	 */
+	memory_copy(
+	 local_file_header_data,
+	 assorted_test_zip_member_local_file_header_data,
+	 30 );
+
+	local_file_header_data[ 3 ] = 0x06;
+
+	result = assorted_zip_member_read_local_file_header(
+	          local_file_header_data,
+	          30,
+	          &header_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the assorted_zip_member_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_zip_member_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 91 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 uncompressed_data,
+	 0,
+	 91 );
+
+	result = assorted_zip_member_decompress(
+	          assorted_test_zip_member_compressed_data,
+	          50,
+	          ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_DEFLATE,
+	          ASSORTED_TEST_ZIP_MEMBER_CHECKSUM,
+	          uncompressed_data,
+	          90,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_zip_member_uncompressed_data,
+	          90 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_set(
+	 uncompressed_data,
+	 0,
+	 91 );
+
+	result = assorted_zip_member_decompress(
+	          assorted_test_zip_member_uncompressed_data,
+	          90,
+	          ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_STORED,
+	          ASSORTED_TEST_ZIP_MEMBER_CHECKSUM,
+	          uncompressed_data,
+	          90,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_zip_member_uncompressed_data,
+	          90 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = assorted_zip_member_decompress(
+	          NULL,
+	          50,
+	          ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_DEFLATE,
+	          ASSORTED_TEST_ZIP_MEMBER_CHECKSUM,
+	          uncompressed_data,
+	          90,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = assorted_zip_member_decompress(
+	          assorted_test_zip_member_compressed_data,
+	          50,
+	          ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_DEFLATE,
+	          ASSORTED_TEST_ZIP_MEMBER_CHECKSUM,
+	          NULL,
+	          90,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the checksum does not match
+	 */
+	result = assorted_zip_member_decompress(
+	          assorted_test_zip_member_compressed_data,
+	          50,
+	          ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_DEFLATE,
+	          ASSORTED_TEST_ZIP_MEMBER_CHECKSUM ^ 1,
+	          uncompressed_data,
+	          90,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data decompresses into less data than expected
+	 */
+	result = assorted_zip_member_decompress(
+	          assorted_test_zip_member_compressed_data,
+	          50,
+	          ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_DEFLATE,
+	          ASSORTED_TEST_ZIP_MEMBER_CHECKSUM,
+	          uncompressed_data,
+	          91,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the stored data size does not match
+	 */
+	result = assorted_zip_member_decompress(
+	          assorted_test_zip_member_uncompressed_data,
+	          89,
+	          ASSORTED_ZIP_MEMBER_COMPRESSION_METHOD_STORED,
+	          ASSORTED_TEST_ZIP_MEMBER_CHECKSUM,
+	          uncompressed_data,
+	          90,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the compression method is not supported
+	 */
+	result = assorted_zip_member_decompress(
+	          assorted_test_zip_member_compressed_data,
+	          50,
+	          14,
+	          ASSORTED_TEST_ZIP_MEMBER_CHECKSUM,
+	          uncompressed_data,
+	          90,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ASSORTED_TEST_ZIP_MEMBER_VERBOSE )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+#if defined( __GNUC__ )
+
+	ASSORTED_TEST_RUN(
+	 "assorted_zip_member_read_local_file_header",
+	 assorted_test_zip_member_read_local_file_header );
+
+	ASSORTED_TEST_RUN(
+	 "assorted_zip_member_decompress",
+	 assorted_test_zip_member_decompress );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) */
+}
+
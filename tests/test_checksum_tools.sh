@@ -0,0 +1,163 @@
+#!/bin/bash
+# Tests the checksum tools on data that is read in multiple chunks.
+#
+# Version: 20261015
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+# The size of the test data, which is larger than the 4 MiB chunks the tools read
+TEST_DATA_SIZE=9437192;
+
+# The checksums of every calculation method of the test data calculated as a single buffer,
+# where the second range is an exact multiple of the chunk size at an unaligned offset
+TEST_CASES="adler32sum|-1|0x69386178
+adler32sum|-1 -o 3 -s 9437184|0xea65602a
+adler32sum|-2|0x69386178
+adler32sum|-2 -o 3 -s 9437184|0xea65602a
+adler32sum|-3|0x69386178
+adler32sum|-3 -o 3 -s 9437184|0xea65602a
+adler32sum|-4|0x69386178
+adler32sum|-4 -o 3 -s 9437184|0xea65602a
+crc32sum|-1|0x7cfd5607
+crc32sum|-1 -o 3 -s 9437184|0xd785e801
+crc32sum|-2|0x7cfd5617
+crc32sum|-2 -o 3 -s 9437184|0xd785e88d
+crc32sum|-3|0x7cfd5617
+crc32sum|-3 -o 3 -s 9437184|0xd785e88d
+crc32sum|-4|0x7cfd5617
+crc32sum|-4 -o 3 -s 9437184|0xd785e88d
+crc32sum|-5|0x7cfd5617
+crc32sum|-5 -o 3 -s 9437184|0xd785e88d
+crc32sum|-5 -t 3|0x7cfd5617
+crc32sum|-5 -t 3 -o 3 -s 9437184|0xd785e88d
+crc64sum||0xa9d278ab4a337c57
+crc64sum|-1|0xa9d278ab4a337c57
+crc64sum|-1 -o 3 -s 9437184|0xa3dfe86fedb2179a
+crc64sum|-2|0xb00a24b908e6524d
+crc64sum|-2 -o 3 -s 9437184|0xcd8acda5373009ef
+crc64sum|-3|0x313a7504e8ce9f6e
+crc64sum|-3 -o 3 -s 9437184|0x7b6abed25febf6bf
+crc64sum|-4|0xf4e05bbfc86fcaa3
+crc64sum|-4 -o 3 -s 9437184|0xedcd81b18396591a
+crc64sum|-5|0xf4e05bbfc86fcaa3
+crc64sum|-5 -o 3 -s 9437184|0xedcd81b18396591a
+fletcher32sum|-s 9437192|0x6ad8f434
+fletcher32sum|-o 3 -s 9437184|0x690ef2e6
+fletcher64sum|-s 9437192|0x59045d5a6edaeef0
+fletcher64sum|-o 3 -s 9437184|0xd7b59b671b18a2c
+xor32sum|-1|0x3f0c363e
+xor32sum|-1 -o 3 -s 9437184|0x090f3a0d
+xor32sum|-2|0x3f0c363e
+xor32sum|-2 -o 3 -s 9437184|0x090f3a0d
+xor32sum|-3|0x3f0c363e
+xor32sum|-3 -o 3 -s 9437184|0x090f3a0d
+xor64sum|-1|0x83031323a37023a
+xor64sum|-1 -o 3 -s 9437184|0x43b013005080b02
+xor64sum|-2|0x32060004
+xor64sum|-2 -o 3 -s 9437184|0x07000432
+xor64sum|-3|0xb38320834340436
+xor64sum|-3 -o 3 -s 9437184|0x60e07010f013d0c";
+
+# The additional options the test cases are also run with
+OPTION_SETS="-M -A";
+
+TOOLS_DIRECTORY="../src";
+
+test_checksum_tool()
+{
+	local TOOL_NAME=$1;
+	local OPTIONS=$2;
+	local EXPECTED_CHECKSUM=$3;
+	local INPUT_FILE=$4;
+
+	local TEST_DESCRIPTION="Testing: ${TOOL_NAME} `echo ${OPTIONS}`";
+	local TOOL_EXECUTABLE="${TOOLS_DIRECTORY}/${TOOL_NAME}";
+
+	if ! test -x "${TOOL_EXECUTABLE}";
+	then
+		TOOL_EXECUTABLE="${TOOL_EXECUTABLE}.exe";
+	fi
+	if ! test -x "${TOOL_EXECUTABLE}";
+	then
+		echo "${TEST_DESCRIPTION} (SKIP)";
+
+		return ${EXIT_IGNORE};
+	fi
+	local CHECKSUM=`${TOOL_EXECUTABLE} ${OPTIONS} ${INPUT_FILE} 2> /dev/null | sed -n 's/^Calculated .* (\(0x[0-9a-f]*\))$/\1/p'`;
+
+	if test "${CHECKSUM}" != "${EXPECTED_CHECKSUM}";
+	then
+		echo "${TEST_DESCRIPTION} (FAIL)";
+		echo "Expected: ${EXPECTED_CHECKSUM} calculated: ${CHECKSUM}";
+
+		return ${EXIT_FAILURE};
+	fi
+	echo "${TEST_DESCRIPTION} (PASS)";
+
+	return ${EXIT_SUCCESS};
+}
+
+if ! test -z ${SKIP_TOOLS_TESTS};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TMPDIR=`mktemp -d "${TMPDIR:-/tmp}/assorted_test_checksum_tools.XXXXXX"`;
+
+if ! test -d "${TMPDIR}";
+then
+	echo "Unable to create temporary directory.";
+
+	exit ${EXIT_FAILURE};
+fi
+
+INPUT_FILE="${TMPDIR}/input";
+
+seq 1 2000000 | head -c ${TEST_DATA_SIZE} > "${INPUT_FILE}";
+
+RESULT=${EXIT_IGNORE};
+
+OLDIFS=${IFS};
+
+# IFS="\n" is not supported by all platforms.
+IFS="
+";
+
+for TEST_CASE in ${TEST_CASES};
+do
+	TOOL_NAME=`echo "${TEST_CASE}" | cut -d '|' -f 1`;
+	OPTIONS=`echo "${TEST_CASE}" | cut -d '|' -f 2`;
+	EXPECTED_CHECKSUM=`echo "${TEST_CASE}" | cut -d '|' -f 3`;
+
+	IFS=" ";
+
+	for OPTION_SET in "" ${OPTION_SETS};
+	do
+		test_checksum_tool "${TOOL_NAME}" "${OPTION_SET} ${OPTIONS}" "${EXPECTED_CHECKSUM}" "${INPUT_FILE}";
+		RESULT=$?;
+
+		if test ${RESULT} -eq ${EXIT_FAILURE};
+		then
+			break;
+		fi
+	done
+	IFS="
+";
+
+	if test ${RESULT} -eq ${EXIT_FAILURE};
+	then
+		break;
+	fi
+done
+
+IFS=${OLDIFS};
+
+rm -rf "${TMPDIR}";
+
+if test ${RESULT} -eq ${EXIT_IGNORE};
+then
+	exit ${EXIT_IGNORE};
+fi
+exit ${RESULT};
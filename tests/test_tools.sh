@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="adler32 ascii7 bit_stream bzip crc32 crc64 deflate fletcher32 fletcher64 huffman_tree lzfu lzma xor32 xor64";
+LIBRARY_TESTS="adler32 adler32_rolling aligned_memory arena ascii7 async_file bit_stream bit_stream_writer bzip bzip_parallel bzip_stream cab_folder carve checksum_cache codec cpu_features crc32 crc32_parallel crc32_syndrome_table crc64 deflate deflate_index deflate_parallel deflate_stream dmg_block_table fletcher32 fletcher64 huffman_tree lzfse lzfu lzfu_parallel lznt1_parallel lzma lzma_parallel lzma_stream lzvn lzx_parallel lzxpress_huffman mssearch rc4 serpent suffix_array thread_pool wim_resource xor32 xor64 zip_member";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 